@@ -0,0 +1,439 @@
+#include "benchmark/benchmark_api.h"
+#include "avhuff.h"
+#include "bitmap.h"
+#include "cdrom.h"
+#include "chd.h"
+#include "chdcodec.h"
+#include "unzip.h"
+
+#include <zlib.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+// the CHD decompressors decoding hunks like the ones chdman writes: hard
+// disk sectors of code, text and empty space, CD frames of mode 1 data or
+// audio, and laserdisc A/V frames; each hunk is compressed once with the
+// matching compressor before timing starts, so the CHD exists only long
+// enough to give the codecs their hunk size and A/V metadata
+//
+// also archive_file extraction of every file in a zip built from similar
+// data, stored or deflated; set BENCH_7Z_FILE to an existing .7z archive to
+// time 7z extraction as well, since there is no 7z writer to build one
+
+namespace {
+
+constexpr uint32_t DISK_HUNK_BYTES = 4096;
+constexpr uint32_t CD_HUNK_BYTES = CD_FRAMES_PER_HUNK * CD_FRAME_SIZE;
+
+constexpr int AV_WIDTH = 720;
+constexpr int AV_HEIGHT = 480;
+constexpr int AV_CHANNELS = 2;
+constexpr int AV_RATE = 48000;
+constexpr int AV_FPS = 29;
+constexpr int AV_FPSFRAC = 970030;
+
+char const *const CHD_FILENAME = "chd_codec_bench.chd";
+char const *const ZIP_FILENAME = "chd_codec_bench.zip";
+
+
+class bench_random
+{
+public:
+	bench_random(uint32_t seed) : m_seed(seed) { }
+	uint32_t operator()() { m_seed = m_seed * 1103515245 + 12345; return m_seed >> 8; }
+
+private:
+	uint32_t m_seed;
+};
+
+
+// 512-byte sectors that are empty, text or low-entropy code
+void fill_disk_data(uint8_t *dest, uint32_t bytes, bench_random &rand)
+{
+	static char const text[] = "Insert coin. Press start button. Game over. High score table. ";
+	for (uint32_t offs = 0; offs < bytes; offs += 512)
+	{
+		uint32_t const kind = rand() & 3;
+		for (uint32_t i = 0; i < 512 && offs + i < bytes; i++)
+		{
+			if (kind == 0)
+				dest[offs + i] = 0;
+			else if (kind == 1)
+				dest[offs + i] = text[(offs / 512 + i) % (sizeof(text) - 1)];
+			else
+				dest[offs + i] = (rand() & 7) ? (0x40 + (rand() & 0x1f)) : rand();
+		}
+	}
+}
+
+// 16-bit stereo: two tones and a little noise
+void fill_audio_data(uint8_t *dest, uint32_t bytes, uint32_t &phase, bench_random &rand)
+{
+	for (uint32_t offs = 0; offs + 4 <= bytes; offs += 4, phase++)
+	{
+		int16_t const left = int16_t(9000.0 * std::sin(phase * 0.0627) + 3000.0 * std::sin(phase * 0.211) + int(rand() & 0xff) - 128);
+		int16_t const right = int16_t(9000.0 * std::sin(phase * 0.0593) + 3000.0 * std::sin(phase * 0.173) + int(rand() & 0xff) - 128);
+		dest[offs + 0] = left;
+		dest[offs + 1] = left >> 8;
+		dest[offs + 2] = right;
+		dest[offs + 3] = right >> 8;
+	}
+}
+
+// CD frames: 2352 bytes of mode 1 sector or audio, then empty subcode
+std::vector<uint8_t> make_cd_hunk(bool audio, bench_random &rand)
+{
+	std::vector<uint8_t> hunk(CD_HUNK_BYTES, 0);
+	uint32_t phase = 0;
+	for (int frame = 0; frame < CD_FRAMES_PER_HUNK; frame++)
+	{
+		uint8_t *const sector = &hunk[frame * CD_FRAME_SIZE];
+		if (audio)
+		{
+			fill_audio_data(sector, CD_MAX_SECTOR_DATA, phase, rand);
+		}
+		else
+		{
+			static uint8_t const sync[12] = { 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00 };
+			std::memcpy(sector, sync, sizeof(sync));
+			sector[12] = 0x00;
+			sector[13] = 0x02;
+			sector[14] = frame;
+			sector[15] = 0x01;
+			fill_disk_data(sector + 16, 2048, rand);
+			ecc_generate(sector);
+		}
+	}
+	return hunk;
+}
+
+// one A/V frame: a soft gradient picture with some noise, and its audio
+std::vector<uint8_t> make_av_hunk(uint32_t hunkbytes, uint32_t samples, bench_random &rand)
+{
+	bitmap_yuy16 bitmap(AV_WIDTH, AV_HEIGHT);
+	for (int y = 0; y < AV_HEIGHT; y++)
+		for (int x = 0; x < AV_WIDTH; x++)
+		{
+			uint8_t const luma = ((x + y) / 4 + (rand() & 3)) & 0xff;
+			uint8_t const chroma = (x & 1) ? (0x80 + y / 16) : (0x80 - x / 32);
+			bitmap.pix(y, x) = (luma << 8) | chroma;
+		}
+
+	std::vector<int16_t> audio[AV_CHANNELS];
+	int16_t *channels[AV_CHANNELS];
+	for (int ch = 0; ch < AV_CHANNELS; ch++)
+	{
+		audio[ch].resize(samples);
+		for (uint32_t i = 0; i < samples; i++)
+			audio[ch][i] = int16_t(8000.0 * std::sin(i * (0.05 + ch * 0.013)) + int(rand() & 0x7f) - 64);
+		channels[ch] = &audio[ch][0];
+	}
+
+	std::vector<uint8_t> hunk;
+	avhuff_encoder::assemble_data(hunk, bitmap, AV_CHANNELS, samples, channels);
+	hunk.resize(hunkbytes, 0);
+	return hunk;
+}
+
+
+// compressed hunks ready to decode, plus the decompressor for them
+struct codec_hunks
+{
+	chd_file chd;
+	std::unique_ptr<chd_decompressor> decompressor;
+	std::vector<std::vector<uint8_t> > compressed;
+	uint32_t hunkbytes = 0;
+	std::string error;
+};
+
+std::unique_ptr<codec_hunks> compress_hunks(chd_codec_type type, int count)
+{
+	auto result = std::make_unique<codec_hunks>();
+	bool const cd = (type == CHD_CODEC_CD_ZLIB) || (type == CHD_CODEC_CD_LZMA) || (type == CHD_CODEC_CD_FLAC) || (type == CHD_CODEC_CD_ZSTD);
+	bool const av = (type == CHD_CODEC_AVHUFF);
+	bench_random rand(type);
+
+	// the A/V hunk is sized to hold one frame, as chdman does
+	uint32_t const fps_times_1million = AV_FPS * 1000000 + AV_FPSFRAC;
+	uint32_t const samples = (uint64_t(AV_RATE) * 1000000 + fps_times_1million - 1) / fps_times_1million;
+	uint32_t const unitbytes = cd ? CD_FRAME_SIZE : av ? 1 : 512;
+	result->hunkbytes = cd ? CD_HUNK_BYTES : av ? avhuff_encoder::raw_data_size(AV_WIDTH, AV_HEIGHT, AV_CHANNELS, samples) : DISK_HUNK_BYTES;
+
+	chd_codec_type compression[4] = { type, CHD_CODEC_NONE, CHD_CODEC_NONE, CHD_CODEC_NONE };
+	chd_error err = result->chd.create(CHD_FILENAME, uint64_t(result->hunkbytes) * count, result->hunkbytes, unitbytes, compression);
+	if (err == CHDERR_NONE && av)
+	{
+		char metadata[256];
+		snprintf(metadata, sizeof(metadata), AV_METADATA_FORMAT, AV_FPS, AV_FPSFRAC, AV_WIDTH, AV_HEIGHT, 0, AV_CHANNELS, AV_RATE);
+		err = result->chd.write_metadata(AV_METADATA_TAG, 0, std::string(metadata));
+	}
+	if (err != CHDERR_NONE)
+	{
+		result->error = std::string("creating CHD: ") + chd_file::error_string(err);
+		std::remove(CHD_FILENAME);
+		return result;
+	}
+
+	try
+	{
+		std::unique_ptr<chd_compressor> compressor(chd_codec_list::new_compressor(type, result->chd));
+		result->decompressor.reset(chd_codec_list::new_decompressor(type, result->chd));
+		std::vector<uint8_t> dest(result->hunkbytes);
+		uint32_t phase = 0;
+		for (int hunknum = 0; hunknum < count; hunknum++)
+		{
+			std::vector<uint8_t> hunk(result->hunkbytes);
+			if (cd)
+				hunk = make_cd_hunk((type == CHD_CODEC_CD_FLAC) || (hunknum & 1), rand);
+			else if (av)
+				hunk = make_av_hunk(result->hunkbytes, samples, rand);
+			else if (type == CHD_CODEC_FLAC)
+				fill_audio_data(&hunk[0], result->hunkbytes, phase, rand);
+			else
+				fill_disk_data(&hunk[0], result->hunkbytes, rand);
+
+			uint32_t const complen = compressor->compress(&hunk[0], result->hunkbytes, &dest[0]);
+			result->compressed.emplace_back(dest.begin(), dest.begin() + complen);
+		}
+	}
+	catch (chd_error const &err)
+	{
+		result->error = std::string("compressing hunk: ") + chd_file::error_string(err);
+	}
+
+	result->chd.close();
+	std::remove(CHD_FILENAME);
+	return result;
+}
+
+void decompress_hunks(benchmark::State &state, chd_codec_type type)
+{
+	std::unique_ptr<codec_hunks> const hunks = compress_hunks(type, state.range(0));
+	if (!hunks->error.empty())
+	{
+		state.SkipWithError(hunks->error.c_str());
+		return;
+	}
+
+	size_t compbytes = 0;
+	for (auto const &hunk : hunks->compressed)
+		compbytes += hunk.size();
+	char label[64];
+	snprintf(label, sizeof(label), "%s, %.1f%% of original", chd_codec_list::codec_name(type), 100.0 * compbytes / (double(hunks->hunkbytes) * hunks->compressed.size()));
+	state.SetLabel(label);
+
+	std::vector<uint8_t> dest(hunks->hunkbytes);
+	while (state.KeepRunning())
+	{
+		for (auto const &hunk : hunks->compressed)
+			hunks->decompressor->decompress(&hunk[0], hunk.size(), &dest[0], hunks->hunkbytes);
+		benchmark::DoNotOptimize(dest.data());
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * hunks->hunkbytes * hunks->compressed.size());
+}
+
+
+// write a zip of ROM-sized files, stored or deflated, with just the fields
+// archive_file needs; returns the total uncompressed size, or 0 on failure
+uint64_t write_zip(char const *filename, bool deflated)
+{
+	FILE *const file = std::fopen(filename, "wb");
+	if (!file)
+		return 0;
+
+	auto put16 = [] (std::vector<uint8_t> &buf, uint16_t value) { buf.push_back(value); buf.push_back(value >> 8); };
+	auto put32 = [] (std::vector<uint8_t> &buf, uint32_t value) { for (int i = 0; i < 4; i++) buf.push_back(value >> (i * 8)); };
+
+	bench_random rand(0x2a);
+	std::vector<uint8_t> central;
+	uint64_t total = 0;
+	uint32_t offset = 0;
+	int const files = 16;
+	for (int filenum = 0; filenum < files; filenum++)
+	{
+		// alternate program ROMs and sample ROMs of 32kB to 256kB
+		std::vector<uint8_t> data(0x8000 << (filenum & 3));
+		uint32_t phase = 0;
+		if (filenum & 4)
+			fill_audio_data(&data[0], data.size(), phase, rand);
+		else
+			fill_disk_data(&data[0], data.size(), rand);
+		char name[16];
+		snprintf(name, sizeof(name), "rom%02d.bin", filenum);
+		uint32_t const crc = crc32(0, &data[0], data.size());
+
+		std::vector<uint8_t> payload;
+		if (deflated)
+		{
+			payload.resize(compressBound(data.size()));
+			z_stream stream;
+			std::memset(&stream, 0, sizeof(stream));
+			deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+			stream.next_in = &data[0];
+			stream.avail_in = data.size();
+			stream.next_out = &payload[0];
+			stream.avail_out = payload.size();
+			deflate(&stream, Z_FINISH);
+			payload.resize(stream.total_out);
+			deflateEnd(&stream);
+		}
+		else
+		{
+			payload = data;
+		}
+
+		std::vector<uint8_t> header;
+		put32(header, 0x04034b50);
+		put16(header, 20);
+		put16(header, 0);
+		put16(header, deflated ? 8 : 0);
+		put32(header, 0);
+		put32(header, crc);
+		put32(header, payload.size());
+		put32(header, data.size());
+		put16(header, std::strlen(name));
+		put16(header, 0);
+		header.insert(header.end(), name, name + std::strlen(name));
+		std::fwrite(&header[0], 1, header.size(), file);
+		std::fwrite(&payload[0], 1, payload.size(), file);
+
+		put32(central, 0x02014b50);
+		put16(central, 20);
+		put16(central, 20);
+		put16(central, 0);
+		put16(central, deflated ? 8 : 0);
+		put32(central, 0);
+		put32(central, crc);
+		put32(central, payload.size());
+		put32(central, data.size());
+		put16(central, std::strlen(name));
+		put16(central, 0);
+		put16(central, 0);
+		put16(central, 0);
+		put16(central, 0);
+		put32(central, 0);
+		put32(central, offset);
+		central.insert(central.end(), name, name + std::strlen(name));
+
+		offset += header.size() + payload.size();
+		total += data.size();
+	}
+
+	std::vector<uint8_t> end;
+	put32(end, 0x06054b50);
+	put16(end, 0);
+	put16(end, 0);
+	put16(end, files);
+	put16(end, files);
+	put32(end, central.size());
+	put32(end, offset);
+	put16(end, 0);
+	std::fwrite(&central[0], 1, central.size(), file);
+	std::fwrite(&end[0], 1, end.size(), file);
+	return (std::fclose(file) == 0) ? total : 0;
+}
+
+void extract_archive(benchmark::State &state, util::archive_file &archive)
+{
+	std::vector<uint8_t> buffer;
+	uint64_t total = 0;
+	while (state.KeepRunning())
+	{
+		total = 0;
+		for (int index = archive.first_file(); index >= 0; index = archive.next_file())
+		{
+			if (archive.current_is_directory())
+				continue;
+			buffer.resize(archive.current_uncompressed_length());
+			if (archive.decompress(buffer.data(), buffer.size()) != util::archive_file::error::NONE)
+			{
+				state.SkipWithError("decompressing archive member");
+				return;
+			}
+			total += buffer.size();
+		}
+		benchmark::DoNotOptimize(buffer.data());
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * total);
+}
+
+} // anonymous namespace
+
+
+static void BM_chd_decompress_zlib(benchmark::State& state) {
+	decompress_hunks(state, CHD_CODEC_ZLIB);
+}
+static void BM_chd_decompress_lzma(benchmark::State& state) {
+	decompress_hunks(state, CHD_CODEC_LZMA);
+}
+static void BM_chd_decompress_huffman(benchmark::State& state) {
+	decompress_hunks(state, CHD_CODEC_HUFFMAN);
+}
+static void BM_chd_decompress_flac(benchmark::State& state) {
+	decompress_hunks(state, CHD_CODEC_FLAC);
+}
+static void BM_chd_decompress_zstd(benchmark::State& state) {
+	decompress_hunks(state, CHD_CODEC_ZSTD);
+}
+static void BM_chd_decompress_cd_zlib(benchmark::State& state) {
+	decompress_hunks(state, CHD_CODEC_CD_ZLIB);
+}
+static void BM_chd_decompress_cd_lzma(benchmark::State& state) {
+	decompress_hunks(state, CHD_CODEC_CD_LZMA);
+}
+static void BM_chd_decompress_cd_flac(benchmark::State& state) {
+	decompress_hunks(state, CHD_CODEC_CD_FLAC);
+}
+static void BM_chd_decompress_cd_zstd(benchmark::State& state) {
+	decompress_hunks(state, CHD_CODEC_CD_ZSTD);
+}
+static void BM_chd_decompress_avhuff(benchmark::State& state) {
+	decompress_hunks(state, CHD_CODEC_AVHUFF);
+}
+static void BM_archive_extract_zip(benchmark::State& state) {
+	if (!write_zip(ZIP_FILENAME, state.range(0) != 0))
+	{
+		state.SkipWithError("writing zip file");
+		return;
+	}
+	util::archive_file::ptr zip;
+	if (util::archive_file::open_zip(ZIP_FILENAME, zip) != util::archive_file::error::NONE)
+		state.SkipWithError("opening zip file");
+	else
+		extract_archive(state, *zip);
+	zip.reset();
+	util::archive_file::cache_clear();
+	std::remove(ZIP_FILENAME);
+}
+static void BM_archive_extract_7z(benchmark::State& state) {
+	char const *const filename = std::getenv("BENCH_7Z_FILE");
+	util::archive_file::ptr archive;
+	if (!filename || !*filename)
+		state.SkipWithError("set BENCH_7Z_FILE to a .7z archive");
+	else if (util::archive_file::open_7z(filename, archive) != util::archive_file::error::NONE)
+		state.SkipWithError("opening 7z file");
+	else
+		extract_archive(state, *archive);
+	archive.reset();
+	util::archive_file::cache_clear();
+}
+// Register the functions as benchmarks; the argument is the number of hunks
+// decoded, or whether the zip members are deflated
+BENCHMARK(BM_chd_decompress_zlib)->Arg(16);
+BENCHMARK(BM_chd_decompress_lzma)->Arg(16);
+BENCHMARK(BM_chd_decompress_huffman)->Arg(16);
+BENCHMARK(BM_chd_decompress_flac)->Arg(16);
+BENCHMARK(BM_chd_decompress_zstd)->Arg(16);
+BENCHMARK(BM_chd_decompress_cd_zlib)->Arg(16);
+BENCHMARK(BM_chd_decompress_cd_lzma)->Arg(16);
+BENCHMARK(BM_chd_decompress_cd_flac)->Arg(16);
+BENCHMARK(BM_chd_decompress_cd_zstd)->Arg(16);
+BENCHMARK(BM_chd_decompress_avhuff)->Arg(2);
+BENCHMARK(BM_archive_extract_zip)->Arg(0)->Arg(1);
+BENCHMARK(BM_archive_extract_7z);
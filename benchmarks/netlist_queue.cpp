@@ -0,0 +1,78 @@
+#include "benchmark/benchmark_api.h"
+#include "netlist/plib/ptime.h"
+#include "netlist/plib/ptimed_queue.h"
+
+#include <random>
+#include <vector>
+
+// the netlist event queues driven the way a TTL netlist drives them: each
+// event fans out to a few nets rescheduled one to three gate delays ahead,
+// with the occasional long timer and a net already queued removed first
+
+namespace {
+
+using bench_time = plib::ptime<std::int64_t, 10'000'000'000LL>;
+
+struct bench_net
+{
+	bench_time  sched;
+	bool        queued = false;
+};
+
+using bench_entry = plib::pqentry_t<bench_time, bench_net *>;
+
+template <typename Queue>
+void run_events(benchmark::State &state)
+{
+	int const nets = state.range(0);
+	std::vector<bench_net> net(nets);
+	Queue queue(nets * 2);
+	std::mt19937 rng(1);
+	bench_time now = bench_time::zero();
+
+	for (int i = 0; i < nets / 2; i++)
+	{
+		net[i].sched = bench_time::from_raw(rng() % 500);
+		net[i].queued = true;
+		queue.template emplace<false>(net[i].sched, &net[i]);
+	}
+
+	while (state.KeepRunning())
+	{
+		for (int event = 0; event < 1000 && !queue.empty(); event++)
+		{
+			now = queue.top().exec_time();
+			queue.top().object()->queued = false;
+			queue.pop();
+
+			for (int fanout = 1 + rng() % 3; fanout > 0; fanout--)
+			{
+				bench_net &target = net[rng() % nets];
+				if (target.queued)
+					queue.template remove<false>(&target, target.sched);
+				bool const timer = (rng() % 16) == 0;
+				target.sched = now + bench_time::from_raw(timer ? 100000 + rng() % 200000 : 80 + (rng() % 25) * 10);
+				target.queued = true;
+				queue.template emplace<false>(target.sched, &target);
+			}
+			while (queue.size() > std::size_t(nets - 3))
+			{
+				queue.top().object()->queued = false;
+				queue.pop();
+			}
+		}
+	}
+}
+
+} // anonymous namespace
+
+
+static void BM_netlist_queue_linear(benchmark::State& state) {
+	run_events<plib::timed_queue_linear<bench_entry, false>>(state);
+}
+static void BM_netlist_queue_calendar(benchmark::State& state) {
+	run_events<plib::timed_queue_calendar<bench_entry, false>>(state);
+}
+// Register the functions as benchmarks; the argument is the number of nets
+BENCHMARK(BM_netlist_queue_linear)->Arg(16)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(BM_netlist_queue_calendar)->Arg(16)->Arg(64)->Arg(256)->Arg(1024);
@@ -0,0 +1,517 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/******************************************************************************
+
+  CPU core throughput benchmark for the cpubench standalone build.
+
+  Each system is a single CPU running from flat RAM.  The program is a
+  short loop with a fixed mix of loads, stores, ALU operations, shifts,
+  stack or register moves and a branch, which walks a 4kB buffer at 0x8000
+  and increments a 32-bit iteration counter at 0xf000 in the CPU's own byte
+  order.  On exit the counter gives the number of instructions executed;
+  the occasional extra instruction the 8-bit CPUs need to carry into the
+  upper counter bytes is not counted.
+
+  Results are emulated MIPS (instructions per emulated second) and host
+  nanoseconds per emulated instruction.  r4600 uses the DRC when -drc is
+  enabled; r4600i always uses the interpreter.
+
+******************************************************************************/
+
+#include "emu.h"
+#include "cpu/i386/i386.h"
+#include "cpu/m6502/m6502.h"
+#include "cpu/m68000/m68000.h"
+#include "cpu/mips/mips3.h"
+#include "cpu/sh/sh2.h"
+#include "cpu/z80/z80.h"
+
+
+namespace {
+
+constexpr offs_t COUNTER_ADDRESS = 0xf000;
+
+
+struct program_segment
+{
+	offs_t      address;
+	const u8 *  data;
+	size_t      length;
+};
+
+
+/******************************************************************************
+ Programs
+******************************************************************************/
+
+// 15 instructions per iteration
+const u8 z80_code[] =
+{
+	0x31, 0x00, 0xe0,           // ld   sp,$e000
+	0x21, 0x00, 0x80,           // ld   hl,$8000
+	0xdd, 0x21, 0x00, 0xf0,     // ld   ix,$f000
+	0x7e,                       // loop: ld a,(hl)
+	0x80,                       // add  a,b
+	0x77,                       // ld   (hl),a
+	0x23,                       // inc  hl
+	0xa9,                       // xor  c
+	0x4f,                       // ld   c,a
+	0xcb, 0x3f,                 // srl  a
+	0x47,                       // ld   b,a
+	0x7c,                       // ld   a,h
+	0xe6, 0x8f,                 // and  $8f
+	0x67,                       // ld   h,a
+	0xc5,                       // push bc
+	0xc1,                       // pop  bc
+	0xdd, 0x34, 0x00,           // inc  (ix+0)
+	0x20, 0xec,                 // jr   nz,loop
+	0xdd, 0x34, 0x01,           // inc  (ix+1)
+	0x20, 0xe7,                 // jr   nz,loop
+	0xdd, 0x34, 0x02,           // inc  (ix+2)
+	0x20, 0xe2,                 // jr   nz,loop
+	0xdd, 0x34, 0x03,           // inc  (ix+3)
+	0x18, 0xdd                  // jr   loop
+};
+
+const program_segment z80_program[] =
+{
+	{ 0x0000, z80_code, sizeof(z80_code) }
+};
+
+
+// 14 instructions per iteration
+const u8 m6502_code[] =
+{
+	0xa9, 0x00,                 // lda  #$00
+	0x85, 0x10,                 // sta  $10
+	0xa9, 0x80,                 // lda  #$80
+	0x85, 0x11,                 // sta  $11
+	0xa0, 0x00,                 // ldy  #$00
+	0xa2, 0x00,                 // ldx  #$00
+	0xb1, 0x10,                 // loop: lda ($10),y
+	0x18,                       // clc
+	0x65, 0x12,                 // adc  $12
+	0x91, 0x10,                 // sta  ($10),y
+	0x85, 0x12,                 // sta  $12
+	0x4a,                       // lsr  a
+	0x5d, 0x00, 0x81,           // eor  $8100,x
+	0x9d, 0x00, 0x81,           // sta  $8100,x
+	0xe8,                       // inx
+	0xc8,                       // iny
+	0x48,                       // pha
+	0x68,                       // pla
+	0xee, 0x00, 0xf0,           // inc  $f000
+	0xd0, 0xe7,                 // bne  loop
+	0xee, 0x01, 0xf0,           // inc  $f001
+	0xd0, 0xe2,                 // bne  loop
+	0xee, 0x02, 0xf0,           // inc  $f002
+	0xd0, 0xdd,                 // bne  loop
+	0xee, 0x03, 0xf0,           // inc  $f003
+	0x4c, 0x0c, 0x02            // jmp  loop
+};
+
+const u8 m6502_vectors[] =
+{
+	0x00, 0x02,                 // reset
+	0x00, 0x02                  // irq/brk
+};
+
+const program_segment m6502_program[] =
+{
+	{ 0x0200, m6502_code, sizeof(m6502_code) },
+	{ 0xfffc, m6502_vectors, sizeof(m6502_vectors) }
+};
+
+
+// 12 instructions per iteration
+const u8 m68000_vectors[] =
+{
+	0x00, 0x00, 0xe0, 0x00,     // initial SSP
+	0x00, 0x00, 0x04, 0x00      // initial PC
+};
+
+const u8 m68000_code[] =
+{
+	0x41, 0xf9, 0x00, 0x00, 0x80, 0x00, // lea     $8000,a0
+	0x43, 0xf9, 0x00, 0x00, 0xf0, 0x00, // lea     $f000,a1
+	0x42, 0x91,                 // clr.l   (a1)
+	0x20, 0x10,                 // loop: move.l (a0),d0
+	0xd0, 0x81,                 // add.l   d1,d0
+	0x20, 0xc0,                 // move.l  d0,(a0)+
+	0xb1, 0x82,                 // eor.l   d0,d2
+	0xe4, 0x8a,                 // lsr.l   #2,d2
+	0x22, 0x02,                 // move.l  d2,d1
+	0x26, 0x08,                 // move.l  a0,d3
+	0x02, 0x43, 0x0f, 0xff,     // andi.w  #$0fff,d3
+	0x00, 0x43, 0x80, 0x00,     // ori.w   #$8000,d3
+	0x20, 0x43,                 // movea.l d3,a0
+	0x52, 0x91,                 // addq.l  #1,(a1)
+	0x60, 0xe4                  // bra.s   loop
+};
+
+const program_segment m68000_program[] =
+{
+	{ 0x0000, m68000_vectors, sizeof(m68000_vectors) },
+	{ 0x0400, m68000_code, sizeof(m68000_code) }
+};
+
+
+// 13 instructions per iteration, including the delay slot
+const u8 sh2_vectors[] =
+{
+	0x00, 0x00, 0x04, 0x00,     // power-on PC
+	0x00, 0x00, 0xe0, 0x00      // power-on SP
+};
+
+const u8 sh2_code[] =
+{
+	0xe1, 0x80,                 // mov     #$80,r1
+	0x61, 0x1c,                 // extu.b  r1,r1
+	0x41, 0x18,                 // shll8   r1
+	0xe2, 0xf0,                 // mov     #$f0,r2
+	0x62, 0x2c,                 // extu.b  r2,r2
+	0x42, 0x18,                 // shll8   r2
+	0xe7, 0x10,                 // mov     #$10,r7
+	0x47, 0x18,                 // shll8   r7
+	0x77, 0xff,                 // add     #-1,r7
+	0x66, 0x13,                 // mov     r1,r6
+	0xe0, 0x00,                 // mov     #0,r0
+	0x22, 0x02,                 // mov.l   r0,@r2
+	0xe3, 0x00,                 // mov     #0,r3
+	0xe5, 0x00,                 // mov     #0,r5
+	0x68, 0x33,                 // loop: mov r3,r8
+	0x38, 0x6c,                 // add     r6,r8
+	0x64, 0x82,                 // mov.l   @r8,r4
+	0x34, 0x5c,                 // add     r5,r4
+	0x28, 0x42,                 // mov.l   r4,@r8
+	0x25, 0x4a,                 // xor     r4,r5
+	0x45, 0x09,                 // shlr2   r5
+	0x73, 0x04,                 // add     #4,r3
+	0x23, 0x79,                 // and     r7,r3
+	0x60, 0x22,                 // mov.l   @r2,r0
+	0x70, 0x01,                 // add     #1,r0
+	0xaf, 0xf3,                 // bra     loop
+	0x22, 0x02                  // mov.l   r0,@r2
+};
+
+const program_segment sh2_program[] =
+{
+	{ 0x0000, sh2_vectors, sizeof(sh2_vectors) },
+	{ 0x0400, sh2_code, sizeof(sh2_code) }
+};
+
+
+// 12 instructions per iteration, including the delay slot; the reset
+// vector at 0xbfc00000 is a mirror of 0, so it jumps to the loop in kseg0
+const u8 r4600_reset[] =
+{
+	0x3c, 0x08, 0x80, 0x00,     // lui     t0,$8000
+	0x35, 0x08, 0x01, 0x00,     // ori     t0,t0,$0100
+	0x01, 0x00, 0x00, 0x08,     // jr      t0
+	0x00, 0x00, 0x00, 0x00      // nop
+};
+
+const u8 r4600_code[] =
+{
+	0x3c, 0x10, 0x80, 0x00,     // lui     s0,$8000
+	0x36, 0x10, 0x80, 0x00,     // ori     s0,s0,$8000
+	0x3c, 0x11, 0x80, 0x00,     // lui     s1,$8000
+	0x36, 0x31, 0xf0, 0x00,     // ori     s1,s1,$f000
+	0xae, 0x20, 0x00, 0x00,     // sw      zero,0(s1)
+	0x00, 0x00, 0x98, 0x25,     // or      s3,zero,zero
+	0x00, 0x00, 0x90, 0x25,     // or      s2,zero,zero
+	0x02, 0x12, 0x40, 0x21,     // loop: addu t0,s0,s2
+	0x8d, 0x09, 0x00, 0x00,     // lw      t1,0(t0)
+	0x01, 0x33, 0x48, 0x21,     // addu    t1,t1,s3
+	0xad, 0x09, 0x00, 0x00,     // sw      t1,0(t0)
+	0x02, 0x69, 0x98, 0x26,     // xor     s3,s3,t1
+	0x00, 0x13, 0x98, 0x82,     // srl     s3,s3,2
+	0x26, 0x52, 0x00, 0x04,     // addiu   s2,s2,4
+	0x32, 0x52, 0x0f, 0xff,     // andi    s2,s2,$0fff
+	0x8e, 0x2a, 0x00, 0x00,     // lw      t2,0(s1)
+	0x25, 0x4a, 0x00, 0x01,     // addiu   t2,t2,1
+	0x10, 0x00, 0xff, 0xf5,     // b       loop
+	0xae, 0x2a, 0x00, 0x00      // sw      t2,0(s1)
+};
+
+const program_segment r4600_program[] =
+{
+	{ 0x0000, r4600_reset, sizeof(r4600_reset) },
+	{ 0x0100, r4600_code, sizeof(r4600_code) }
+};
+
+
+// 11 instructions per iteration, in real mode with 32-bit operands; the
+// reset vector at 0xfffffff0 is a mirror of 0xfff0
+const u8 i386_code[] =
+{
+	0x66, 0x31, 0xc0,           // xor     eax,eax
+	0x8e, 0xd8,                 // mov     ds,ax
+	0x8e, 0xd0,                 // mov     ss,ax
+	0xbc, 0x00, 0xe0,           // mov     sp,$e000
+	0xbe, 0x00, 0x80,           // mov     si,$8000
+	0x66, 0x31, 0xdb,           // xor     ebx,ebx
+	0x66, 0xa3, 0x00, 0xf0,     // mov     [$f000],eax
+	0x66, 0x8b, 0x04,           // loop: mov eax,[si]
+	0x66, 0x01, 0xd8,           // add     eax,ebx
+	0x66, 0x89, 0x04,           // mov     [si],eax
+	0x66, 0x31, 0xc3,           // xor     ebx,eax
+	0x66, 0xc1, 0xeb, 0x02,     // shr     ebx,2
+	0x83, 0xc6, 0x04,           // add     si,4
+	0x81, 0xe6, 0xff, 0x8f,     // and     si,$8fff
+	0x53,                       // push    bx
+	0x5b,                       // pop     bx
+	0x66, 0xff, 0x06, 0x00, 0xf0, // inc   dword [$f000]
+	0xeb, 0xe0                  // jmp     loop
+};
+
+const u8 i386_reset[] =
+{
+	0xea, 0x00, 0x01, 0x00, 0x00 // jmp    $0000:$0100
+};
+
+const program_segment i386_program[] =
+{
+	{ 0x0100, i386_code, sizeof(i386_code) },
+	{ 0xfff0, i386_reset, sizeof(i386_reset) }
+};
+
+} // anonymous namespace
+
+
+class cpubench_state : public driver_device
+{
+public:
+	cpubench_state(const machine_config &mconfig, device_type type, const char *tag)
+		: driver_device(mconfig, type, tag),
+		m_maincpu(*this, "maincpu"),
+		m_program(nullptr),
+		m_segments(0),
+		m_loop_instructions(0),
+		m_start_ticks(0)
+	{
+	}
+
+	void init_z80() { load_program(z80_program, 15); }
+	void init_m6502() { load_program(m6502_program, 14); }
+	void init_m68000() { load_program(m68000_program, 12); }
+	void init_sh2() { load_program(sh2_program, 13); }
+	void init_r4600() { load_program(r4600_program, 12); }
+	void init_i80386() { load_program(i386_program, 11); }
+
+	void z80(machine_config &config);
+	void m6502(machine_config &config);
+	void m68000(machine_config &config);
+	void sh2(machine_config &config);
+	void r4600(machine_config &config);
+	void r4600i(machine_config &config);
+	void i80386(machine_config &config);
+
+private:
+	required_device<cpu_device> m_maincpu;
+	const program_segment *m_program;
+	size_t m_segments;
+	u32 m_loop_instructions;
+	osd_ticks_t m_start_ticks;
+
+	template <size_t N> void load_program(const program_segment (&program)[N], u32 loop_instructions);
+	void report();
+
+	virtual void machine_start() override;
+	virtual void machine_reset() override;
+
+	void z80_mem(address_map &map);
+	void m6502_mem(address_map &map);
+	void m68000_mem(address_map &map);
+	void sh2_mem(address_map &map);
+	void r4600_mem(address_map &map);
+	void i386_mem(address_map &map);
+};
+
+
+/******************************************************************************
+ Machine Start/Reset
+******************************************************************************/
+
+template <size_t N>
+void cpubench_state::load_program(const program_segment (&program)[N], u32 loop_instructions)
+{
+	m_program = program;
+	m_segments = N;
+	m_loop_instructions = loop_instructions;
+
+	// the programs don't modify themselves, so loading once before the
+	// first reset is enough; CPUs that fetch vectors on reset see them
+	address_space &space = m_maincpu->space(AS_PROGRAM);
+	for (size_t seg = 0; seg < m_segments; seg++)
+		for (size_t i = 0; i < m_program[seg].length; i++)
+			space.write_byte(m_program[seg].address + i, m_program[seg].data[i]);
+}
+
+void cpubench_state::machine_start()
+{
+	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&cpubench_state::report, this));
+}
+
+void cpubench_state::machine_reset()
+{
+	m_maincpu->space(AS_PROGRAM).write_dword(COUNTER_ADDRESS, 0);
+	m_start_ticks = osd_ticks();
+}
+
+void cpubench_state::report()
+{
+	double const instructions = double(m_maincpu->space(AS_PROGRAM).read_dword(COUNTER_ADDRESS)) * m_loop_instructions;
+	double const emulated = machine().time().as_double();
+	double const host = double(osd_ticks() - m_start_ticks) / double(osd_ticks_per_second());
+	if (instructions == 0.0 || emulated == 0.0)
+	{
+		osd_printf_info("%-8s no instructions completed\n", machine().system().name);
+		return;
+	}
+
+	osd_printf_info("%-8s %10.3f emulated MIPS %10.3f host ns/instruction %8.3f cycles/instruction\n",
+			machine().system().name,
+			instructions / emulated / 1e6,
+			host * 1e9 / instructions,
+			double(m_maincpu->total_cycles()) / instructions);
+}
+
+
+/******************************************************************************
+ Address Maps
+******************************************************************************/
+
+void cpubench_state::z80_mem(address_map &map)
+{
+	map(0x0000, 0xffff).ram();
+}
+
+void cpubench_state::m6502_mem(address_map &map)
+{
+	map(0x0000, 0xffff).ram();
+}
+
+void cpubench_state::m68000_mem(address_map &map)
+{
+	map(0x000000, 0x00ffff).ram();
+}
+
+void cpubench_state::sh2_mem(address_map &map)
+{
+	map(0x00000000, 0x0000ffff).ram();
+}
+
+void cpubench_state::r4600_mem(address_map &map)
+{
+	map(0x00000000, 0x0000ffff).ram().mirror(0x1fc00000);
+}
+
+void cpubench_state::i386_mem(address_map &map)
+{
+	map(0x00000000, 0x0000ffff).ram().mirror(0xffff0000);
+}
+
+
+/******************************************************************************
+ Input Ports
+******************************************************************************/
+
+static INPUT_PORTS_START( cpubench )
+INPUT_PORTS_END
+
+
+/******************************************************************************
+ Machine Drivers
+******************************************************************************/
+
+void cpubench_state::z80(machine_config &config)
+{
+	Z80(config, m_maincpu, 4'000'000);
+	m_maincpu->set_addrmap(AS_PROGRAM, &cpubench_state::z80_mem);
+}
+
+void cpubench_state::m6502(machine_config &config)
+{
+	M6502(config, m_maincpu, 2'000'000);
+	m_maincpu->set_addrmap(AS_PROGRAM, &cpubench_state::m6502_mem);
+}
+
+void cpubench_state::m68000(machine_config &config)
+{
+	M68000(config, m_maincpu, 12'000'000);
+	m_maincpu->set_addrmap(AS_PROGRAM, &cpubench_state::m68000_mem);
+}
+
+void cpubench_state::sh2(machine_config &config)
+{
+	SH2(config, m_maincpu, 28'636'363);
+	m_maincpu->set_addrmap(AS_PROGRAM, &cpubench_state::sh2_mem);
+}
+
+void cpubench_state::r4600(machine_config &config)
+{
+	r4600be_device &maincpu(R4600BE(config, m_maincpu, 100'000'000));
+	maincpu.set_icache_size(16384);
+	maincpu.set_dcache_size(16384);
+	maincpu.set_addrmap(AS_PROGRAM, &cpubench_state::r4600_mem);
+}
+
+void cpubench_state::r4600i(machine_config &config)
+{
+	r4600(config);
+	m_maincpu->set_force_no_drc(true);
+}
+
+void cpubench_state::i80386(machine_config &config)
+{
+	I386(config, m_maincpu, 25'000'000);
+	m_maincpu->set_addrmap(AS_PROGRAM, &cpubench_state::i386_mem);
+}
+
+
+/******************************************************************************
+ ROM Definitions
+******************************************************************************/
+
+ROM_START(i80386)
+	ROM_REGION(0x0, "maincpu", 0)
+ROM_END
+
+ROM_START(m6502)
+	ROM_REGION(0x0, "maincpu", 0)
+ROM_END
+
+ROM_START(m68000)
+	ROM_REGION(0x0, "maincpu", 0)
+ROM_END
+
+ROM_START(r4600)
+	ROM_REGION(0x0, "maincpu", 0)
+ROM_END
+
+ROM_START(r4600i)
+	ROM_REGION(0x0, "maincpu", 0)
+ROM_END
+
+ROM_START(sh2)
+	ROM_REGION(0x0, "maincpu", 0)
+ROM_END
+
+ROM_START(z80)
+	ROM_REGION(0x0, "maincpu", 0)
+ROM_END
+
+
+/******************************************************************************
+ Drivers
+******************************************************************************/
+
+/*    YEAR  NAME      PARENT  COMPAT  MACHINE   INPUT     STATE           INIT         COMPANY        FULLNAME                            FLAGS */
+COMP( 2021, i80386,   0,      0,      i80386,   cpubench, cpubench_state, init_i80386, "MAMEdev",     "CPU benchmark (i386)",             MACHINE_NO_SOUND_HW )
+COMP( 2021, m6502,    0,      0,      m6502,    cpubench, cpubench_state, init_m6502,  "MAMEdev",     "CPU benchmark (6502)",             MACHINE_NO_SOUND_HW )
+COMP( 2021, m68000,   0,      0,      m68000,   cpubench, cpubench_state, init_m68000, "MAMEdev",     "CPU benchmark (68000)",            MACHINE_NO_SOUND_HW )
+COMP( 2021, r4600,    0,      0,      r4600,    cpubench, cpubench_state, init_r4600,  "MAMEdev",     "CPU benchmark (R4600, DRC)",       MACHINE_NO_SOUND_HW )
+COMP( 2021, r4600i,   0,      0,      r4600i,   cpubench, cpubench_state, init_r4600,  "MAMEdev",     "CPU benchmark (R4600, interpreter)", MACHINE_NO_SOUND_HW )
+COMP( 2021, sh2,      0,      0,      sh2,      cpubench, cpubench_state, init_sh2,    "MAMEdev",     "CPU benchmark (SH-2)",             MACHINE_NO_SOUND_HW )
+COMP( 2021, z80,      0,      0,      z80,      cpubench, cpubench_state, init_z80,    "MAMEdev",     "CPU benchmark (Z80)",              MACHINE_NO_SOUND_HW )
@@ -0,0 +1,162 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    main.cpp
+
+    Controls execution of the CPU core throughput benchmark.
+
+    cpubench [system] [seconds]
+
+    Runs the named benchmark system, or all of them, for the given number
+    of emulated seconds (10 by default) and prints emulated MIPS and host
+    time per emulated instruction for each.
+
+***************************************************************************/
+
+#include "emu.h"
+
+#include "ui/uimain.h"
+
+#include "emuopts.h"
+#include "drivenum.h"
+
+#include "xmlfile.h"
+
+#include "modules/lib/osdobj_common.h"
+
+#include <cstdlib>
+
+
+GAME_EXTERN(i80386);
+GAME_EXTERN(m6502);
+GAME_EXTERN(m68000);
+GAME_EXTERN(r4600);
+GAME_EXTERN(r4600i);
+GAME_EXTERN(sh2);
+GAME_EXTERN(z80);
+
+const game_driver * const driver_list::s_drivers_sorted[8] =
+{
+	&GAME_NAME(___empty),
+	&GAME_NAME(i80386),
+	&GAME_NAME(m6502),
+	&GAME_NAME(m68000),
+	&GAME_NAME(r4600),
+	&GAME_NAME(r4600i),
+	&GAME_NAME(sh2),
+	&GAME_NAME(z80),
+};
+
+std::size_t const driver_list::s_driver_count = 8;
+
+// ======================> cpubench_machine_manager
+
+class cpubench_machine_manager : public machine_manager
+{
+private:
+	DISABLE_COPYING(cpubench_machine_manager);
+	// construction/destruction
+	cpubench_machine_manager(emu_options &options, osd_interface &osd) : machine_manager(options, osd) { }
+public:
+	static cpubench_machine_manager *instance(emu_options &options, osd_interface &osd)
+	{
+		if (!m_manager)
+		{
+			m_manager = new cpubench_machine_manager(options, osd);
+		}
+		return m_manager;
+	}
+
+	static cpubench_machine_manager *instance() { return m_manager; }
+
+	~cpubench_machine_manager() { delete m_manager;  m_manager = nullptr; }
+
+	int execute(const game_driver &system)
+	{
+		machine_config config(system, m_options);
+		running_machine machine(config, *this);
+		return machine.run(false);
+	}
+
+	virtual ui_manager* create_ui(running_machine& machine) override {
+		m_ui = std::make_unique<ui_manager>(machine);
+		return m_ui.get();
+	}
+
+private:
+	static cpubench_machine_manager* m_manager;
+	std::unique_ptr<ui_manager> m_ui;
+};
+
+//**************************************************************************
+//  MACHINE MANAGER
+//**************************************************************************
+
+cpubench_machine_manager* cpubench_machine_manager::m_manager = nullptr;
+
+int emulator_info::start_frontend(emu_options &options, osd_interface &osd, std::vector<std::string> &args)
+{
+	// a system name picks one benchmark, a number sets the emulated seconds
+	const char *name = nullptr;
+	int seconds = 10;
+	for (std::size_t arg = 1; arg < args.size(); arg++)
+	{
+		if (!args[arg].empty() && isdigit(u8(args[arg][0])))
+			seconds = std::atoi(args[arg].c_str());
+		else
+			name = args[arg].c_str();
+	}
+
+	int const index = name ? driver_list::find(name) : -1;
+	if (name && index < 0)
+	{
+		osd_printf_error("Unknown benchmark system %s\n", name);
+		return EMU_ERR_NO_SUCH_SYSTEM;
+	}
+
+	options.set_value(OSDOPTION_VIDEO, "none", OPTION_PRIORITY_MAXIMUM);
+	options.set_value(OSDOPTION_SOUND, "none", OPTION_PRIORITY_MAXIMUM);
+	options.set_value(OPTION_THROTTLE, false, OPTION_PRIORITY_MAXIMUM);
+	options.set_value(OPTION_SECONDS_TO_RUN, seconds, OPTION_PRIORITY_MAXIMUM);
+
+	cpubench_machine_manager::instance(options,osd)->start_http_server();
+	for (std::size_t drvnum = 1; drvnum < driver_list::total(); drvnum++)
+		if (!name || int(drvnum) == index)
+			cpubench_machine_manager::instance(options,osd)->execute(driver_list::driver(drvnum));
+	return 0;
+}
+
+int emulator_info::start_frontend(emu_options &options, osd_interface &osd, int argc, char *argv[])
+{
+	std::vector<std::string> args(argv, argv + argc);
+	return start_frontend(options, osd, args);
+}
+
+const char * emulator_info::get_bare_build_version() { return nullptr; }
+
+const char * emulator_info::get_build_version() { return nullptr; }
+
+void emulator_info::display_ui_chooser(running_machine& machine) { }
+
+void emulator_info::draw_user_interface(running_machine& machine) { }
+
+void emulator_info::periodic_check() { }
+
+bool emulator_info::frame_hook() { return false; }
+
+void emulator_info::sound_hook() { }
+
+void emulator_info::layout_script_cb(layout_file &file, const char *script) { }
+
+const char * emulator_info::get_appname() { return nullptr; }
+
+const char * emulator_info::get_appname_lower() { return "cpubench"; }
+
+const char * emulator_info::get_configname() { return nullptr; }
+
+const char * emulator_info::get_copyright() { return nullptr; }
+
+const char * emulator_info::get_copyright_info() { return nullptr; }
+
+bool emulator_info::standalone() { return true; }
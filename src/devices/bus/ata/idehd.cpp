@@ -499,6 +499,10 @@ void ata_mass_storage_device::read_first_sector()
 	{
 		set_dasp(ASSERT_LINE);
 
+		/* fetch the whole transfer while the seek and sector times run */
+		if (m_command != IDE_COMMAND_VERIFY_SECTORS && m_command != IDE_COMMAND_VERIFY_SECTORS_NORETRY)
+			start_read_ahead(lba_address(), m_sector_count);
+
 		start_busy(seek_time(), PARAM_COMMAND);
 	}
 }
@@ -821,6 +825,7 @@ void ide_hdd_device::device_start()
 
 void ide_hdd_device::device_reset()
 {
+	m_read_ahead.reset();
 	m_handle = m_image->get_chd_file();
 	m_disk = m_image->get_hard_disk_file();
 
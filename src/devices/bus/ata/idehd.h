@@ -42,6 +42,7 @@ protected:
 
 	virtual int read_sector(uint32_t lba, void *buffer) = 0;
 	virtual int write_sector(uint32_t lba, const void *buffer) = 0;
+	virtual void start_read_ahead(uint32_t lba, uint32_t count) { }
 	virtual attotime seek_time();
 
 	void ide_build_identify_device();
@@ -102,8 +103,9 @@ protected:
 	// optional information overrides
 	virtual void device_add_mconfig(machine_config &config) override;
 
-	virtual int read_sector(uint32_t lba, void *buffer) override { return !m_disk ? 0 : hard_disk_read(m_disk, lba, buffer); }
-	virtual int write_sector(uint32_t lba, const void *buffer) override { return !m_disk ? 0 : hard_disk_write(m_disk, lba, buffer); }
+	virtual int read_sector(uint32_t lba, void *buffer) override { return !m_disk ? 0 : m_read_ahead.read(m_disk, lba, buffer); }
+	virtual int write_sector(uint32_t lba, const void *buffer) override { m_read_ahead.reset(); return !m_disk ? 0 : hard_disk_write(m_disk, lba, buffer); }
+	virtual void start_read_ahead(uint32_t lba, uint32_t count) override { m_read_ahead.start(m_disk, lba, count); }
 	virtual uint8_t calculate_status() override;
 
 	chd_file       *m_handle;
@@ -118,6 +120,7 @@ private:
 	required_device<harddisk_image_device> m_image;
 
 	emu_timer *     m_last_status_timer;
+	hard_disk_read_ahead m_read_ahead;
 };
 
 // device type definition
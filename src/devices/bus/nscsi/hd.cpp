@@ -37,6 +37,7 @@ void nscsi_harddisk_device::device_start()
 void nscsi_harddisk_device::device_reset()
 {
 	nscsi_full_device::device_reset();
+	read_ahead.reset();
 	harddisk = image->get_hard_disk_file();
 	if(!harddisk) {
 		scsi_id = -1;
@@ -69,7 +70,7 @@ uint8_t nscsi_harddisk_device::scsi_get_data(int id, int pos)
 		int clba = lba + pos / bytes_per_sector;
 		if(clba != cur_lba) {
 			cur_lba = clba;
-			if(!hard_disk_read(harddisk, cur_lba, block)) {
+			if(!read_ahead.read(harddisk, cur_lba, block)) {
 				LOG("HD READ ERROR !\n");
 				memset(block, 0, sizeof(block));
 			}
@@ -92,6 +93,7 @@ void nscsi_harddisk_device::scsi_put_data(int id, int pos, uint8_t data)
 	block[offset] = data;
 	cur_lba = lba + pos / bytes_per_sector;
 	if(offset == bytes_per_sector-1) {
+		read_ahead.reset();
 		if(!hard_disk_write(harddisk, cur_lba, block))
 			LOG("HD WRITE ERROR !\n");
 	}
@@ -119,7 +121,12 @@ void nscsi_harddisk_device::scsi_command()
 
 		LOG("command READ start=%08x blocks=%04x\n", lba, blocks);
 
+		read_ahead.reset();
 		if(hard_disk_read(harddisk, lba, block)) {
+			// the rest of the transfer is fetched while the bus moves the data
+			cur_lba = lba;
+			if(blocks > 1)
+				read_ahead.start(harddisk, lba + 1, blocks - 1);
 			scsi_data_in(2, blocks*bytes_per_sector);
 			scsi_status_complete(SS_GOOD);
 		}
@@ -475,7 +482,12 @@ void nscsi_harddisk_device::scsi_command()
 
 		LOG("command READ EXTENDED start=%08x blocks=%04x\n",lba, blocks);
 
+		read_ahead.reset();
 		if(hard_disk_read(harddisk, lba, block)) {
+			// the rest of the transfer is fetched while the bus moves the data
+			cur_lba = lba;
+			if(blocks > 1)
+				read_ahead.start(harddisk, lba + 1, blocks - 1);
 			scsi_data_in(2, blocks*bytes_per_sector);
 			scsi_status_complete(SS_GOOD);
 		}
@@ -506,6 +518,7 @@ void nscsi_harddisk_device::scsi_command()
 		{
 			hard_disk_info *info = hard_disk_get_info(harddisk);
 			auto block = std::make_unique<uint8_t[]>(info->sectorbytes);
+			read_ahead.reset();
 			for(int cyl = 0; cyl < info->cylinders; cyl++) {
 				for(int head = 0; head < info->heads; head++) {
 					for(int sector = 0; sector < info->sectors; sector++) {
@@ -39,6 +39,7 @@
 
 #define ARM7DRC_STRICT_VERIFY      0x0001          /* verify all instructions */
 #define ARM7DRC_FLUSH_PC           0x0008          /* flush the PC value before each memory access */
+#define ARM7DRC_VALIDATE           0x0010          /* check translated instructions against the interpreter */
 
 #define ARM7DRC_COMPATIBLE_OPTIONS (ARM7DRC_STRICT_VERIFY | ARM7DRC_FLUSH_PC)
 #define ARM7DRC_FASTEST_OPTIONS    (0)
@@ -47,6 +48,8 @@
  *  PUBLIC FUNCTIONS
  ***************************************************************************************************/
 
+class arm7_frontend;
+
 class arm7_cpu_device : public cpu_device, public arm7_disassembler::config
 {
 public:
@@ -55,7 +58,22 @@ public:
 
 	void set_high_vectors() { m_vectorbase = 0xffff0000; }
 
+	// the recompiler is used unless a driver turns it off or -nodrc is given
+	void set_drc(bool enable) { m_enable_drc = enable; }
+
+	void arm7drc_set_options(uint32_t options);
+	void arm7drc_add_fastram(offs_t start, offs_t end, uint8_t readonly, void *base);
+	void arm7drc_add_hotspot(offs_t pc, uint32_t opcode, uint32_t cycles);
+
+	// callbacks from recompiled code
+	void func_drc_interpret();
+	void func_drc_access(int size, bool write);
+	void func_drc_validate_begin();
+	void func_drc_validate_end();
+
 protected:
+	friend class arm7_frontend;
+
 	enum
 	{
 		ARCHFLAG_T    = 1,        // Thumb present
@@ -421,8 +439,7 @@ protected:
 		compiler_state &operator=(compiler_state const &) = delete;
 
 		uint32_t         cycles = 0;                 /* accumulated cycles */
-		uint8_t          checkints = 0;              /* need to check interrupts before next instruction */
-		uint8_t          checksoftints = 0;          /* need to check software interrupts before next instruction */
+		uint32_t         mode = 0;                   /* mode the block is being compiled for */
 		uml::code_label  labelnum;                   /* index for local labels */
 	};
 
@@ -432,34 +449,31 @@ protected:
 		/* core state */
 		std::unique_ptr<drc_cache> cache;               /* pointer to the DRC code cache */
 		std::unique_ptr<drcuml_state> drcuml;           /* DRC UML generator state */
-		//arm7_frontend *     drcfe = nullptr;            /* pointer to the DRC front-end state */
+		std::unique_ptr<arm7_frontend> drcfe;           /* pointer to the DRC front-end state */
 		uint32_t            drcoptions = 0;             /* configurable DRC options */
 
 		/* internal stuff */
-		uint8_t             cache_dirty = 0;            /* true if we need to flush the cache */
-		uint32_t            jmpdest = 0;                /* destination jump target */
+		bool                cache_dirty = false;        /* true if we need to flush the cache */
+		uint32_t            mode = 0;                   /* current global mode */
+		uint32_t            nextpc = 0;                 /* PC following an interpreted instruction */
+		uint32_t            exit = 0;                   /* exit code requested by an interpreted instruction */
 
 		/* parameters for subroutines */
-		uint64_t            numcycles = 0;              /* return value from gettotalcycles */
-		uint32_t            mode = 0;                   /* current global mode */
-		const char *        format = nullptr;           /* format string for print_debug */
-		uint32_t            arg0 = 0;                   /* print_debug argument 1 */
-		uint32_t            arg1 = 0;                   /* print_debug argument 2 */
+		uint32_t            arg0 = 0;                   /* memory accessor address */
+		uint32_t            arg1 = 0;                   /* memory accessor data */
 
-		/* register mappings */
-		uml::parameter      regmap[/*NUM_REGS*/37];     /* parameter to register mappings for all 16 integer registers */
+		/* validation against the interpreter */
+		uint32_t            saved_r[/*NUM_REGS*/37];    /* registers before the instruction */
+		uint32_t            expected_r[/*NUM_REGS*/37]; /* registers as the interpreter left them */
 
 		/* subroutines */
 		uml::code_handle *  entry = nullptr;            /* entry point */
 		uml::code_handle *  nocode = nullptr;           /* nocode exception handler */
 		uml::code_handle *  out_of_cycles = nullptr;    /* out of cycles exception handler */
-		uml::code_handle *  tlb_translate = nullptr;    /* tlb translation handler */
-		uml::code_handle *  detect_fault = nullptr;     /* tlb fault detection handler */
+		uml::code_handle *  interrupt = nullptr;        /* pending exception handler */
 		uml::code_handle *  check_irq = nullptr;        /* irq check handler */
 		uml::code_handle *  read8 = nullptr;            /* read byte */
 		uml::code_handle *  write8 = nullptr;           /* write byte */
-		uml::code_handle *  read16 = nullptr;           /* read half */
-		uml::code_handle *  write16 = nullptr;          /* write half */
 		uml::code_handle *  read32 = nullptr;           /* read word */
 		uml::code_handle *  write32 = nullptr;          /* write word */
 
@@ -472,149 +486,36 @@ protected:
 		hotspot_info        hotspot[ARM7_MAX_HOTSPOTS];
 	} m_impstate;
 
-	typedef void ( arm7_cpu_device::*arm7thumb_drcophandler)(drcuml_block &, compiler_state &, const opcode_desc *);
-	static const arm7thumb_drcophandler drcthumb_handler[0x40*0x10];
-
-	void drctg00_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Shift left */
-	void drctg00_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Shift right */
-	void drctg01_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg01_10(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg01_11(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* SUB Rd, Rs, Rn */
-	void drctg01_12(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADD Rd, Rs, #imm */
-	void drctg01_13(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* SUB Rd, Rs, #imm */
-	void drctg02_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg02_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg03_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADD Rd, #Offset8 */
-	void drctg03_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* SUB Rd, #Offset8 */
-	void drctg04_00_00(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* AND Rd, Rs */
-	void drctg04_00_01(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* EOR Rd, Rs */
-	void drctg04_00_02(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* LSL Rd, Rs */
-	void drctg04_00_03(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* LSR Rd, Rs */
-	void drctg04_00_04(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ASR Rd, Rs */
-	void drctg04_00_05(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADC Rd, Rs */
-	void drctg04_00_06(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* SBC Rd, Rs */
-	void drctg04_00_07(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ROR Rd, Rs */
-	void drctg04_00_08(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* TST Rd, Rs */
-	void drctg04_00_09(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* NEG Rd, Rs */
-	void drctg04_00_0a(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* CMP Rd, Rs */
-	void drctg04_00_0b(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* CMN Rd, Rs - check flags, add dasm */
-	void drctg04_00_0c(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ORR Rd, Rs */
-	void drctg04_00_0d(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* MUL Rd, Rs */
-	void drctg04_00_0e(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* BIC Rd, Rs */
-	void drctg04_00_0f(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* MVN Rd, Rs */
-	void drctg04_01_00(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg04_01_01(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADD Rd, HRs */
-	void drctg04_01_02(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADD HRd, Rs */
-	void drctg04_01_03(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Add HRd, HRs */
-	void drctg04_01_10(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* CMP Rd, Rs */
-	void drctg04_01_11(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* CMP Rd, Hs */
-	void drctg04_01_12(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* CMP Hd, Rs */
-	void drctg04_01_13(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* CMP Hd, Hs */
-	void drctg04_01_20(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* MOV Rd, Rs (undefined) */
-	void drctg04_01_21(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* MOV Rd, Hs */
-	void drctg04_01_22(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* MOV Hd, Rs */
-	void drctg04_01_23(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* MOV Hd, Hs */
-	void drctg04_01_30(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg04_01_31(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg04_01_32(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg04_01_33(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg04_0203(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg05_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* STR Rd, [Rn, Rm] */
-	void drctg05_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* STRH Rd, [Rn, Rm] */
-	void drctg05_2(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* STRB Rd, [Rn, Rm] */
-	void drctg05_3(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* LDSB Rd, [Rn, Rm] todo, add dasm */
-	void drctg05_4(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* LDR Rd, [Rn, Rm] */
-	void drctg05_5(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* LDRH Rd, [Rn, Rm] */
-	void drctg05_6(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* LDRB Rd, [Rn, Rm] */
-	void drctg05_7(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* LDSH Rd, [Rn, Rm] */
-	void drctg06_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Store */
-	void drctg06_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Load */
-	void drctg07_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Store */
-	void drctg07_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* Load */
-	void drctg08_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Store */
-	void drctg08_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Load */
-	void drctg09_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Store */
-	void drctg09_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Load */
-	void drctg0a_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* ADD Rd, PC, #nn */
-	void drctg0a_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADD Rd, SP, #nn */
-	void drctg0b_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADD SP, #imm */
-	void drctg0b_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_2(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_3(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_4(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* PUSH {Rlist} */
-	void drctg0b_5(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* PUSH {Rlist}{LR} */
-	void drctg0b_6(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_7(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_8(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_9(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_a(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_b(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_c(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* POP {Rlist} */
-	void drctg0b_d(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* POP {Rlist}{PC} */
-	void drctg0b_e(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_f(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0c_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Store */
-	void drctg0c_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Load */
-	void drctg0d_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_EQ:
-	void drctg0d_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_NE:
-	void drctg0d_2(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_CS:
-	void drctg0d_3(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_CC:
-	void drctg0d_4(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_MI:
-	void drctg0d_5(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_PL:
-	void drctg0d_6(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_VS:
-	void drctg0d_7(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_VC:
-	void drctg0d_8(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_HI:
-	void drctg0d_9(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_LS:
-	void drctg0d_a(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_GE:
-	void drctg0d_b(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_LT:
-	void drctg0d_c(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_GT:
-	void drctg0d_d(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_LE:
-	void drctg0d_e(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_AL:
-	void drctg0d_f(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // SWI (this is sort of a "hole" in the opcode encoding)
-	void drctg0e_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0e_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0f_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0f_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* BL */
+	bool m_enable_drc;
+	bool m_isdrc;
 
 	void update_reg_ptr();
 	const int* m_reg_group;
-	void load_fast_iregs(drcuml_block &block);
-	void save_fast_iregs(drcuml_block &block);
+	void arm7_run_instruction();
+	void arm7_execute_instruction();
 	void arm7_drc_init();
-	void arm7_drc_exit();
+	uint32_t drc_compute_mode() const;
 	void execute_run_drc();
-	void arm7drc_set_options(uint32_t options);
-	void arm7drc_add_fastram(offs_t start, offs_t end, uint8_t readonly, void *base);
-	void arm7drc_add_hotspot(offs_t pc, uint32_t opcode, uint32_t cycles);
 	void code_flush_cache();
-	void code_compile_block(uint8_t mode, offs_t pc);
-	void cfunc_get_cycles();
-	void cfunc_unimplemented();
+	void code_compile_block(uint32_t mode, offs_t pc);
 	void static_generate_entry_point();
+	void static_generate_exit(uml::code_handle *&handleptr, const char *name, uint32_t result);
 	void static_generate_check_irq();
-	void static_generate_nocode_handler();
-	void static_generate_out_of_cycles();
-	void static_generate_detect_fault(uml::code_handle **handleptr);
-	void static_generate_tlb_translate(uml::code_handle **handleptr);
-	void static_generate_memory_accessor(int size, bool istlb, bool iswrite, const char *name, uml::code_handle *&handleptr);
-	void generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param);
+	void static_generate_memory_accessor(int size, bool iswrite, const char *name, uml::code_handle *&handleptr);
+	uml::parameter drc_reg(const compiler_state &compiler, int reg) const;
+	void generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param, bool allow_exception);
 	void generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
 	void generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void generate_delay_slot_and_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint8_t linkreg);
-
-	typedef bool ( arm7_cpu_device::*drcarm7ops_ophandler)(drcuml_block &, compiler_state &, const opcode_desc *, uint32_t);
-	static const drcarm7ops_ophandler drcops_handler[0x10];
-
-	void saturate_qbit_overflow(drcuml_block &block);
-	bool drcarm7ops_0123(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool drcarm7ops_4567(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool drcarm7ops_89(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool drcarm7ops_ab(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool drcarm7ops_cd(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool drcarm7ops_e(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool drcarm7ops_f(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-
+	void generate_interpret(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_branch(drcuml_block &block, compiler_state &compiler, uml::parameter target);
+	void generate_condition(drcuml_block &block, uint32_t cond, uml::code_label skip);
+	void generate_logical_flags(drcuml_block &block, int carry);
+	void generate_arith_flags(drcuml_block &block, bool subtract);
+	int generate_shift_operand(drcuml_block &block, const compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool need_carry);
+	void generate_arm_alu(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
+	void generate_arm_mem_single(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
+	void generate_arm_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_thumb_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
 };
 
 
@@ -755,6 +656,24 @@ public:
 	sa1110_cpu_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock);
 };
 
+class arm7_frontend : public drc_frontend
+{
+public:
+	// construction/destruction
+	arm7_frontend(arm7_cpu_device *arm7, uint32_t window_start, uint32_t window_end, uint32_t max_sequence);
+
+protected:
+	// required overrides
+	virtual bool describe(opcode_desc &desc, const opcode_desc *prev) override;
+
+private:
+	bool describe_arm(opcode_desc &desc, uint32_t op);
+	bool describe_thumb(opcode_desc &desc, uint32_t op);
+	void describe_interpret(opcode_desc &desc, bool writes_pc);
+
+	arm7_cpu_device *m_arm7;
+};
+
 DECLARE_DEVICE_TYPE(ARM7,         arm7_cpu_device)
 DECLARE_DEVICE_TYPE(ARM7_BE,      arm7_be_cpu_device)
 DECLARE_DEVICE_TYPE(ARM710A,      arm710a_cpu_device)
@@ -1336,6 +1336,11 @@ u32 arm7_disassembler::opcode_alignment() const
 	return m_config->get_t_flag() ? 2 : 4;
 }
 
+u64 arm7_disassembler::decode_mode() const
+{
+	return m_config->get_t_flag() ? 1 : 0;
+}
+
 offs_t arm7_disassembler::disassemble(std::ostream &stream, offs_t pc, const data_buffer &opcodes, const data_buffer &params)
 {
 	if(m_config->get_t_flag())
@@ -33,11 +33,24 @@
 
 #define SINGLE_INSTRUCTION_MODE         (0)
 
+
+
 /***************************************************************************
     CONSTANTS
 ***************************************************************************/
 
-#include "arm7tdrc.hxx"
+/* mode bits passed to the hash table on top of the CPSR mode field */
+#define ARM7DRC_MODE_THUMB              0x10
+#define ARM7DRC_MODE_INTERPRET          0x20    /* not a hash mode: the state can only be interpreted */
+
+/* opcode_desc user flags */
+#define ARM7_UF_INTERPRET               (1 << 0)    /* instruction is handed to the interpreter */
+
+/* how the carry is produced for logical operations */
+#define DRC_CARRY_KEEP                  0
+#define DRC_CARRY_CLEAR                 1
+#define DRC_CARRY_SET                   2
+#define DRC_CARRY_I3                    3
 
 /* map variables */
 #define MAPVAR_PC                       uml::M0
@@ -49,30 +62,41 @@
 /* compilation boundaries -- how far back/forward does the analysis extend? */
 #define COMPILE_BACKWARDS_BYTES         128
 #define COMPILE_FORWARDS_BYTES          512
-#define COMPILE_MAX_INSTRUCTIONS        ((COMPILE_BACKWARDS_BYTES/4) + (COMPILE_FORWARDS_BYTES/4))
 #define COMPILE_MAX_SEQUENCE            64
 
 /* exit codes */
 #define EXECUTE_OUT_OF_CYCLES           0
 #define EXECUTE_MISSING_CODE            1
-#define EXECUTE_UNMAPPED_CODE           2
-#define EXECUTE_RESET_CACHE             3
+#define EXECUTE_INTERPRET               2
+#define EXECUTE_REDISPATCH              3
+
+#include "arm7fe.hxx"
+#include "arm7tdrc.hxx"
 
 
 /***************************************************************************
-    INLINE FUNCTIONS
+    PRIVATE GLOBAL VARIABLES
 ***************************************************************************/
 
-/*-------------------------------------------------
-    epc - compute the exception PC from a
-    descriptor
--------------------------------------------------*/
+/* ARM NZCV flags for each combination of UML C, V, Z and S flags */
+static const uint32_t s_arm_flags_add[16] =
+{
+	0x00000000, 0x20000000, 0x10000000, 0x30000000, 0x40000000, 0x60000000, 0x50000000, 0x70000000,
+	0x80000000, 0xa0000000, 0x90000000, 0xb0000000, 0xc0000000, 0xe0000000, 0xd0000000, 0xf0000000
+};
 
-static inline uint32_t epc(const opcode_desc *desc)
+/* same, for subtractions: the ARM carry is the inverse of the UML borrow */
+static const uint32_t s_arm_flags_sub[16] =
 {
-	return desc->pc;
-}
+	0x20000000, 0x00000000, 0x30000000, 0x10000000, 0x60000000, 0x40000000, 0x70000000, 0x50000000,
+	0xa0000000, 0x80000000, 0xb0000000, 0x90000000, 0xe0000000, 0xc0000000, 0xf0000000, 0xd0000000
+};
+
+
 
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
 
 /*-------------------------------------------------
     alloc_handle - allocate a handle if not
@@ -86,59 +110,23 @@ static inline void alloc_handle(drcuml_state &drcuml, uml::code_handle *&handlep
 }
 
 
-/*-------------------------------------------------
-    load_fast_iregs - load any fast integer
-    registers
--------------------------------------------------*/
-
-void arm7_cpu_device::load_fast_iregs(drcuml_block &block)
-{
-	int regnum;
-
-	for (regnum = 0; regnum < std::size(m_impstate.regmap); regnum++)
-		if (m_impstate.regmap[regnum].is_int_register())
-			UML_DMOV(block, uml::ireg(m_impstate.regmap[regnum].ireg() - uml::REG_I0), uml::mem(&m_r[regnum]));
-}
-
-
-/*-------------------------------------------------
-    save_fast_iregs - save any fast integer
-    registers
--------------------------------------------------*/
-
-void arm7_cpu_device::save_fast_iregs(drcuml_block &block)
-{
-	int regnum;
-
-	for (regnum = 0; regnum < std::size(m_impstate.regmap); regnum++)
-		if (m_impstate.regmap[regnum].is_int_register())
-			UML_DMOV(block, uml::mem(&m_r[regnum]), uml::ireg(m_impstate.regmap[regnum].ireg() - uml::REG_I0));
-}
-
-
 
 /***************************************************************************
     CORE CALLBACKS
 ***************************************************************************/
 
 /*-------------------------------------------------
-    arm7_init - initialize the processor
+    arm7_drc_init - initialize the recompiler
 -------------------------------------------------*/
 
 void arm7_cpu_device::arm7_drc_init()
 {
-	drcbe_info beinfo;
-	uint32_t flags = 0;
-
-	/* allocate enough space for the cache and the core */
-
 	/* allocate the implementation-specific state from the full cache */
-	m_impstate = arm7imp_state();
 	try { m_impstate.cache = std::make_unique<drc_cache>(CACHE_SIZE); }
 	catch (std::bad_alloc const &) { throw emu_fatalerror("Unable to allocate cache of size %d\n", (uint32_t)(CACHE_SIZE)); }
 
 	/* initialize the UML generator */
-	m_impstate.drcuml = std::make_unique<drcuml_state>(*this, *m_impstate.cache, flags, 1, 32, 1);
+	m_impstate.drcuml = std::make_unique<drcuml_state>(*this, *m_impstate.cache, 0, 32, 32, 1);
 
 	/* add symbols for our stuff */
 	m_impstate.drcuml->symbol_add(&m_icount, sizeof(m_icount), "icount");
@@ -151,38 +139,9 @@ void arm7_cpu_device::arm7_drc_init()
 	m_impstate.drcuml->symbol_add(&m_impstate.mode, sizeof(m_impstate.mode), "mode");
 	m_impstate.drcuml->symbol_add(&m_impstate.arg0, sizeof(m_impstate.arg0), "arg0");
 	m_impstate.drcuml->symbol_add(&m_impstate.arg1, sizeof(m_impstate.arg1), "arg1");
-	m_impstate.drcuml->symbol_add(&m_impstate.numcycles, sizeof(m_impstate.numcycles), "numcycles");
-	//m_impstate.drcuml->symbol_add(&m_impstate.fpmode, sizeof(m_impstate.fpmode), "fpmode"); // TODO
 
 	/* initialize the front-end helper */
-	//m_impstate.drcfe = std::make_unique<arm7_frontend>(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE);
-
-	/* allocate memory for cache-local state and initialize it */
-	//memcpy(&m_impstate.fpmode, fpmode_source, sizeof(fpmode_source)); // TODO
-
-	/* compute the register parameters */
-	for (int regnum = 0; regnum < 37; regnum++)
-	{
-		m_impstate.regmap[regnum] = (regnum == 0) ? uml::parameter(0) : uml::parameter::make_memory(&m_r[regnum]);
-	}
-
-	/* if we have registers to spare, assign r2, r3, r4 to leftovers */
-	//if (!DISABLE_FAST_REGISTERS) // TODO
-	{
-		m_impstate.drcuml->get_backend_info(beinfo);
-		if (beinfo.direct_iregs > 4)
-		{   // PC
-			m_impstate.regmap[eR15] = uml::I4;
-		}
-		if (beinfo.direct_iregs > 5)
-		{   // Status
-			m_impstate.regmap[eCPSR] = uml::I5;
-		}
-		if (beinfo.direct_iregs > 6)
-		{   // SP
-			m_impstate.regmap[eR13] = uml::I6;
-		}
-	}
+	m_impstate.drcfe = std::make_unique<arm7_frontend>(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE);
 
 	/* mark the cache dirty so it is updated on next execute */
 	m_impstate.cache_dirty = true;
@@ -190,47 +149,169 @@ void arm7_cpu_device::arm7_drc_init()
 
 
 /*-------------------------------------------------
-    arm7_execute - execute the CPU for the
-    specified number of cycles
+    drc_compute_mode - work out which kind of
+    code can run with the current state
 -------------------------------------------------*/
 
-void arm7_cpu_device::execute_run_drc()
+uint32_t arm7_cpu_device::drc_compute_mode() const
 {
-	drcuml_state &drcuml = *m_impstate.drcuml;
-	int execute_result;
+	/* 26-bit code and anything behind the MMU stays in the interpreter */
+	if (!(GET_CPSR & SR_MODE32) || (m_control & COPRO_CTRL_MMU_EN))
+		return ARM7DRC_MODE_INTERPRET;
+
+	return (GET_CPSR & MODE_FLAG) | (T_IS_SET(GET_CPSR) ? ARM7DRC_MODE_THUMB : 0);
+}
 
-	/* reset the cache if dirty */
-	if (m_impstate.cache_dirty)
-		code_flush_cache();
-	m_impstate.cache_dirty = false;
 
-	/* execute */
+/*-------------------------------------------------
+    execute_run_drc - run translated code until
+    out of cycles
+-------------------------------------------------*/
+
+void arm7_cpu_device::execute_run_drc()
+{
 	do
 	{
-		/* run as much as we can */
-		execute_result = drcuml.execute(*m_impstate.entry);
+		/* reset the cache if dirty */
+		if (m_impstate.cache_dirty)
+		{
+			code_flush_cache();
+			m_impstate.cache_dirty = false;
+		}
+
+		/* take anything raised since the last instruction */
+		arm7_check_irq_state();
+
+		/* step through anything that can't be translated */
+		m_impstate.mode = drc_compute_mode();
+		if (m_impstate.mode & ARM7DRC_MODE_INTERPRET)
+		{
+			arm7_run_instruction();
+			continue;
+		}
+
+		/* execute */
+		int const execute_result = m_impstate.drcuml->execute(*m_impstate.entry);
 
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
 			code_compile_block(m_impstate.mode, m_r[eR15]);
-		else if (execute_result == EXECUTE_UNMAPPED_CODE)
-			fatalerror("Attempted to execute unmapped code at PC=%08X\n", m_r[eR15]);
-		else if (execute_result == EXECUTE_RESET_CACHE)
-			code_flush_cache();
 
-	} while (execute_result != EXECUTE_OUT_OF_CYCLES);
+		/* translated code asked for this instruction to be interpreted */
+		else if (execute_result == EXECUTE_INTERPRET)
+			arm7_run_instruction();
+	} while (m_icount > 0);
+}
+
+
+/*-------------------------------------------------
+    func_drc_interpret - run the instruction at
+    the current PC through the interpreter
+-------------------------------------------------*/
+
+void arm7_cpu_device::func_drc_interpret()
+{
+	/* translated code doesn't maintain the prefetch queue */
+	m_insn_prefetch_count = 0;
+	m_insn_prefetch_index = 0;
+
+	arm7_run_instruction();
+
+	/* leave the translated code if it no longer describes what comes next */
+	if (m_r[eR15] != m_impstate.nextpc || m_impstate.cache_dirty || drc_compute_mode() != m_impstate.mode)
+		m_impstate.exit = EXECUTE_REDISPATCH;
+	else
+		m_impstate.exit = 0;
+}
+
+static void cfunc_drc_interpret(void *param)
+{
+	((arm7_cpu_device *)param)->func_drc_interpret();
+}
+
+
+/*-------------------------------------------------
+    func_drc_access - slow path for memory
+    accesses from translated code
+-------------------------------------------------*/
+
+void arm7_cpu_device::func_drc_access(int size, bool write)
+{
+	if (write)
+	{
+		if (size == 1)
+			WRITE8(m_impstate.arg0, m_impstate.arg1);
+		else
+			WRITE32(m_impstate.arg0, m_impstate.arg1);
+	}
+	else
+	{
+		if (size == 1)
+			m_impstate.arg1 = READ8(m_impstate.arg0);
+		else
+			m_impstate.arg1 = READ32(m_impstate.arg0);
+	}
+}
+
+template <int Size, bool Write>
+static void cfunc_drc_access(void *param)
+{
+	((arm7_cpu_device *)param)->func_drc_access(Size, Write);
 }
 
+
 /*-------------------------------------------------
-    arm7_exit - cleanup from execution
+    func_drc_validate_begin - run the instruction
+    at the current PC through the interpreter and
+    remember the result, leaving the state as it
+    was
 -------------------------------------------------*/
 
-void arm7_cpu_device::arm7_drc_exit()
+void arm7_cpu_device::func_drc_validate_begin()
+{
+	int const icount = m_icount;
+
+	std::copy(std::begin(m_r), std::end(m_r), std::begin(m_impstate.saved_r));
+	m_insn_prefetch_count = 0;
+	m_insn_prefetch_index = 0;
+	update_insn_prefetch(m_r[eR15]);
+	arm7_execute_instruction();
+	std::copy(std::begin(m_r), std::end(m_r), std::begin(m_impstate.expected_r));
+
+	std::copy(std::begin(m_impstate.saved_r), std::end(m_impstate.saved_r), std::begin(m_r));
+	update_reg_ptr();
+	m_icount = icount;
+	m_insn_prefetch_count = 0;
+	m_insn_prefetch_index = 0;
+}
+
+static void cfunc_drc_validate_begin(void *param)
 {
-	/* clean up the DRC */
-	//m_impstate.drcfe.reset();
-	m_impstate.drcuml.reset();
-	m_impstate.cache.reset();
+	((arm7_cpu_device *)param)->func_drc_validate_begin();
+}
+
+
+/*-------------------------------------------------
+    func_drc_validate_end - compare the state
+    left by translated code with what the
+    interpreter produced
+-------------------------------------------------*/
+
+void arm7_cpu_device::func_drc_validate_end()
+{
+	for (int regnum = 0; regnum < 37; regnum++)
+	{
+		if (m_r[regnum] != m_impstate.expected_r[regnum])
+		{
+			logerror("arm7drc: %08X: r%d is %08X, interpreter has %08X\n", m_impstate.saved_r[eR15], regnum, m_r[regnum], m_impstate.expected_r[regnum]);
+			m_r[regnum] = m_impstate.expected_r[regnum];
+		}
+	}
+}
+
+static void cfunc_drc_validate_end(void *param)
+{
+	((arm7_cpu_device *)param)->func_drc_validate_end();
 }
 
 
@@ -295,21 +376,18 @@ void arm7_cpu_device::code_flush_cache()
 
 	try
 	{
-		/* generate the entry point and out-of-cycles handlers */
+		/* generate the entry point and exit handlers */
 		static_generate_entry_point();
-		static_generate_nocode_handler();
-		static_generate_out_of_cycles();
-		static_generate_tlb_translate(nullptr); // TODO FIXME
-		static_generate_detect_fault(nullptr); // TODO FIXME
-		//static_generate_tlb_mismatch();
+		static_generate_exit(m_impstate.nocode, "nocode", EXECUTE_MISSING_CODE);
+		static_generate_exit(m_impstate.out_of_cycles, "out_of_cycles", EXECUTE_OUT_OF_CYCLES);
+		static_generate_exit(m_impstate.interrupt, "interrupt", EXECUTE_REDISPATCH);
+		static_generate_check_irq();
 
 		/* add subroutines for memory accesses */
-		static_generate_memory_accessor(1, false, false, "read8",       m_impstate.read8);
-		static_generate_memory_accessor(1, true,  false, "write8",      m_impstate.write8);
-		static_generate_memory_accessor(2, false, false, "read16",      m_impstate.read16);
-		static_generate_memory_accessor(2, true,  false, "write16",     m_impstate.write16);
-		static_generate_memory_accessor(4, false, false, "read32",      m_impstate.read32);
-		static_generate_memory_accessor(4, true,  false, "write32",     m_impstate.write32);
+		static_generate_memory_accessor(1, false, "read8",       m_impstate.read8);
+		static_generate_memory_accessor(1, true,  "write8",      m_impstate.write8);
+		static_generate_memory_accessor(4, false, "read32",      m_impstate.read32);
+		static_generate_memory_accessor(4, true,  "write32",     m_impstate.write32);
 	}
 	catch (drcuml_block::abort_compilation &)
 	{
@@ -323,20 +401,16 @@ void arm7_cpu_device::code_flush_cache()
     given mode at the specified pc
 -------------------------------------------------*/
 
-void arm7_cpu_device::code_compile_block(uint8_t mode, offs_t pc)
+void arm7_cpu_device::code_compile_block(uint32_t mode, offs_t pc)
 {
 	drcuml_state &drcuml = *m_impstate.drcuml;
-	compiler_state compiler = { 0 };
 	const opcode_desc *seqlast;
 	bool override = false;
 
 	g_profiler.start(PROFILER_DRC_COMPILE);
 
 	/* get a description of this sequence */
-	// TODO FIXME
-	const opcode_desc *desclist = nullptr; //m_impstate.drcfe->describe_code(pc); // TODO
-//  if (drcuml.logging() || drcuml.logging_native())
-//      log_opcode_desc(drcuml, desclist, 0);
+	const opcode_desc *desclist = m_impstate.drcfe->describe_code(pc);
 
 	/* if we get an error back, flush the cache and try again */
 	bool succeeded = false;
@@ -344,8 +418,10 @@ void arm7_cpu_device::code_compile_block(uint8_t mode, offs_t pc)
 	{
 		try
 		{
+			compiler_state compiler = { 0, mode, 1 };
+
 			/* start the block */
-			drcuml_block &block(drcuml.begin_block(4096));
+			drcuml_block &block(drcuml.begin_block(8192));
 
 			/* loop until we get through all instruction sequences */
 			for (const opcode_desc *seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
@@ -378,9 +454,7 @@ void arm7_cpu_device::code_compile_block(uint8_t mode, offs_t pc)
 				/* otherwise, redispatch to that fixed PC and skip the rest of the processing */
 				else
 				{
-					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
-					UML_HASHJMP(block, 0, seqhead->pc, *m_impstate.nocode);
-																							// hashjmp <mode>,seqhead->pc,nocode
+					UML_HASHJMP(block, mode, seqhead->pc, *m_impstate.nocode);              // hashjmp <mode>,seqhead->pc,nocode
 					continue;
 				}
 
@@ -388,32 +462,26 @@ void arm7_cpu_device::code_compile_block(uint8_t mode, offs_t pc)
 				if (m_program->get_write_ptr(seqhead->physpc) != nullptr)
 					generate_checksum_block(block, compiler, seqhead, seqlast);
 
-				/* label this instruction, if it may be jumped to locally */
-				if (seqhead->flags & OPFLAG_IS_BRANCH_TARGET)
-					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
-
 				/* iterate over instructions in the sequence and compile them */
 				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
 					generate_sequence_instruction(block, compiler, curdesc);
 
+				/* branches have already left */
+				if (seqlast->flags & OPFLAG_IS_UNCONDITIONAL_BRANCH)
+					continue;
+
 				/* if we need to return to the start, do it */
 				if (seqlast->flags & OPFLAG_RETURN_TO_START)
 					nextpc = pc;
 
 				/* otherwise we just go to the next instruction */
 				else
-					nextpc = seqlast->pc + (seqlast->skipslots + 1) * 4;
+					nextpc = seqlast->pc + seqlast->length;
 
 				/* count off cycles and go there */
-				generate_update_cycles(block, compiler, nextpc);          // <subtract cycles>
-
-				/* if the last instruction can change modes, use a variable mode; otherwise, assume the same mode */
-				/*if (seqlast->flags & OPFLAG_CAN_CHANGE_MODES)
-				    UML_HASHJMP(block, uml::mem(&m_impstate.mode), nextpc, *m_impstate.nocode);
-				                                                                            // hashjmp <mode>,nextpc,nocode
-				else*/ if (seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
-					UML_HASHJMP(block, m_impstate.mode, nextpc, *m_impstate.nocode);
-																							// hashjmp <mode>,nextpc,nocode
+				generate_update_cycles(block, compiler, nextpc, true);                    // <subtract cycles>
+				if (seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
+					UML_HASHJMP(block, mode, nextpc, *m_impstate.nocode);                   // hashjmp <mode>,nextpc,nocode
 			}
 
 			/* end the sequence */
@@ -429,32 +497,6 @@ void arm7_cpu_device::code_compile_block(uint8_t mode, offs_t pc)
 }
 
 
-/***************************************************************************
-    C FUNCTION CALLBACKS
-***************************************************************************/
-
-/*-------------------------------------------------
-    cfunc_get_cycles - compute the total number
-    of cycles executed so far
--------------------------------------------------*/
-
-void arm7_cpu_device::cfunc_get_cycles()
-{
-	m_impstate.numcycles = total_cycles();
-}
-
-
-/*-------------------------------------------------
-    cfunc_unimplemented - handler for
-    unimplemented opcdes
--------------------------------------------------*/
-
-void arm7_cpu_device::cfunc_unimplemented()
-{
-	uint32_t opcode = m_impstate.arg0;
-	fatalerror("PC=%08X: Unimplemented op %08X\n", m_r[eR15], opcode);
-}
-
 
 /***************************************************************************
     STATIC CODEGEN
@@ -469,697 +511,218 @@ void arm7_cpu_device::static_generate_entry_point()
 {
 	drcuml_state &drcuml = *m_impstate.drcuml;
 
-	drcuml_block &block(drcuml.begin_block(110));
+	drcuml_block &block(drcuml.begin_block(20));
 
 	/* forward references */
-	//alloc_handle(drcuml, &m_impstate.exception_norecover[EXCEPTION_INTERRUPT], "interrupt_norecover");
 	alloc_handle(drcuml, m_impstate.nocode, "nocode");
-	alloc_handle(drcuml, m_impstate.detect_fault, "detect_fault");
-	alloc_handle(drcuml, m_impstate.tlb_translate, "tlb_translate");
 
 	alloc_handle(drcuml, m_impstate.entry, "entry");
-	UML_HANDLE(block, *m_impstate.entry);                           // handle  entry
-
-	/* load fast integer registers */
-	load_fast_iregs(block);
-
-	UML_CALLH(block, *m_impstate.check_irq);
+	UML_HANDLE(block, *m_impstate.entry);                                           // handle  entry
 
 	/* generate a hash jump via the current mode and PC */
-	UML_HASHJMP(block, 0, uml::mem(&m_pc), *m_impstate.nocode);       // hashjmp 0,<pc>,nocode
+	UML_HASHJMP(block, uml::mem(&m_impstate.mode), uml::mem(&R15), *m_impstate.nocode);
+																					// hashjmp <mode>,<pc>,nocode
 	block.end();
 }
 
 
 /*-------------------------------------------------
-    static_generate_check_irq - generate a handler
-    to check IRQs
+    static_generate_exit - generate a handler
+    that records the PC passed to it and leaves
+    with the given result
 -------------------------------------------------*/
 
-void arm7_cpu_device::static_generate_check_irq()
+void arm7_cpu_device::static_generate_exit(uml::code_handle *&handleptr, const char *name, uint32_t result)
 {
-	drcuml_state &drcuml = *m_impstate.drcuml;
-	uml::code_label noirq;
-	int nodabt = 0;
-	int nopabt = 0;
-	int irqadjust = 0;
-	int nofiq = 0;
-	int irq32 = 0;
-	int swi32 = 0;
-	int done = 0;
-	int label = 1;
-
 	/* begin generating */
-	drcuml_block &block(drcuml.begin_block(120));
+	drcuml_block &block(m_impstate.drcuml->begin_block(10));
 
-	/* generate a hash jump via the current mode and PC */
-	alloc_handle(drcuml, m_impstate.check_irq, "check_irq");
-	UML_HANDLE(block, *m_impstate.check_irq);                       // handle  check_irq
-	/* Exception priorities:
-
-	    Reset
-	    Data abort
-	    FIRQ
-	    IRQ
-	    Prefetch abort
-	    Undefined instruction
-	    Software Interrupt
-	*/
-
-	UML_ADD(block, uml::I0, uml::mem(&R15), 4);                                   // add      i0, PC, 4  ;insn pc
-
-	// Data Abort
-	UML_TEST(block, uml::mem(&m_pendingAbtD), 1);                          // test     pendingAbtD, 1
-	UML_JMPc(block, uml::COND_Z, nodabt = label++);                          // jmpz     nodabt
-
-	UML_ROLINS(block, uml::mem(&GET_CPSR), eARM7_MODE_ABT, 0, MODE_FLAG);     // rolins   CPSR, eARM7_MODE_ABT, 0, MODE_FLAG
-	UML_MOV(block, uml::mem(&GetRegister(14)), uml::I0);                    // mov      LR, i0
-	UML_MOV(block, uml::mem(&GetRegister(SPSR)), uml::mem(&GET_CPSR));      // mov      SPSR, CPSR
-	UML_OR(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), I_MASK);              // or       CPSR, CPSR, I_MASK
-	UML_ROLAND(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), 0, ~T_MASK);      // roland   CPSR, CPSR, 0, ~T_MASK
-	UML_MOV(block, uml::mem(&R15), 0x00000010);                              // mov      PC, 0x10 (Data Abort vector address)
-	UML_MOV(block, uml::mem(&m_pendingAbtD), 0);                           // mov      pendingAbtD, 0
-	UML_JMP(block, irqadjust = label++);                                // jmp      irqadjust
-
-	UML_LABEL(block, nodabt);                                           // nodabt:
-
-	// FIQ
-	UML_TEST(block, uml::mem(&m_pendingFiq), 1);                           // test     pendingFiq, 1
-	UML_JMPc(block, uml::COND_Z, nofiq = label++);                           // jmpz     nofiq
-	UML_TEST(block, uml::mem(&GET_CPSR), F_MASK);                            // test     CPSR, F_MASK
-	UML_JMPc(block, uml::COND_Z, nofiq);                                     // jmpz     nofiq
-
-	UML_MOV(block, uml::mem(&GetRegister(14)), uml::I0);                    // mov      LR, i0
-	UML_MOV(block, uml::mem(&GetRegister(SPSR)), uml::mem(&GET_CPSR));      // mov      SPSR, CPSR
-	UML_OR(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), I_MASK | F_MASK);     // or       CPSR, CPSR, I_MASK | F_MASK
-	UML_ROLAND(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), 0, ~T_MASK);          // roland   CPSR, CPSR, 0, ~T_MASK
-	UML_MOV(block, uml::mem(&R15), 0x0000001c);                              // mov      PC, 0x1c (FIQ vector address)
-	UML_MOV(block, uml::mem(&m_pendingFiq), 0);                            // mov      pendingFiq, 0
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, nofiq);                                            // nofiq:
-
-	// IRQ
-	UML_TEST(block, uml::mem(&m_pendingIrq), 1);                           // test     pendingIrq, 1
-	UML_JMPc(block, uml::COND_Z, noirq = label++);                           // jmpz     noirq
-	UML_TEST(block, uml::mem(&GET_CPSR), I_MASK);                            // test     CPSR, I_MASK
-	UML_JMPc(block, uml::COND_Z, noirq);                                     // jmpz     noirq
-
-	UML_MOV(block, uml::mem(&GetRegister(14)), uml::I0);                    // mov      LR, i0
-	UML_TEST(block, uml::mem(&GET_CPSR), SR_MODE32);                         // test     CPSR, MODE32
-	UML_JMPc(block, uml::COND_NZ, irq32 = label++);                          // jmpnz    irq32
-	UML_AND(block, uml::I1, uml::I0, 0xf4000000);                                 // and      i1, i0, 0xf4000000
-	UML_OR(block, uml::mem(&R15), uml::I1, 0x0800001a);                           // or       PC, i1, 0x0800001a
-	UML_AND(block, uml::I1, uml::mem(&GET_CPSR), 0x0fffff3f);                     // and      i1, CPSR, 0x0fffff3f
-	UML_ROLAND(block, uml::I0, uml::mem(&R15), 32-20, 0x0000000c);                // roland   i0, R15, 32-20, 0x0000000c
-	UML_ROLINS(block, uml::I0, uml::mem(&R15), 0, 0xf0000000);                    // rolins   i0, R15, 0, 0xf0000000
-	UML_OR(block, uml::mem(&GET_CPSR), uml::I0, uml::I1);                              // or       CPSR, i0, i1
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, irq32);                                            // irq32:
-	UML_MOV(block, uml::mem(&GetRegister(SPSR)), uml::mem(&GET_CPSR));      // mov      SPSR, CPSR
-	UML_OR(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), I_MASK);              // or       CPSR, CPSR, I_MASK
-	UML_ROLAND(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), 0, ~T_MASK);          // roland   CPSR, CPSR, 0, ~T_MASK
-	UML_MOV(block, uml::mem(&R15), 0x00000018);                              // mov      PC, 0x18 (IRQ vector address)
-
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, noirq);                                            // noirq:
-
-	// Prefetch Abort
-	UML_TEST(block, uml::mem(&m_pendingAbtP), 1);                          // test     pendingAbtP, 1
-	UML_JMPc(block, uml::COND_Z, nopabt = label++);                          // jmpz     nopabt
-
-	UML_ROLINS(block, uml::mem(&GET_CPSR), eARM7_MODE_ABT, 0, MODE_FLAG);     // rolins   CPSR, eARM7_MODE_ABT, 0, MODE_FLAG
-	UML_MOV(block, uml::mem(&GetRegister(14)), uml::I0);                    // mov      LR, i0
-	UML_MOV(block, uml::mem(&GetRegister(SPSR)), uml::mem(&GET_CPSR));      // mov      SPSR, CPSR
-	UML_OR(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), I_MASK);              // or       CPSR, CPSR, I_MASK
-	UML_ROLAND(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), 0, ~T_MASK);          // roland   CPSR, CPSR, 0, ~T_MASK
-	UML_MOV(block, uml::mem(&R15), 0x0000000c);                              // mov      PC, 0x0c (Prefetch Abort vector address)
-	UML_MOV(block, uml::mem(&m_pendingAbtP), 0);                           // mov      pendingAbtP, 0
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, nopabt);                                           // nopabt:
-
-	// Undefined instruction
-	UML_TEST(block, uml::mem(&m_pendingUnd), 1);                           // test     pendingUnd, 1
-	UML_JMPc(block, uml::COND_Z, nopabt = label++);                          // jmpz     nound
-
-	UML_ROLINS(block, uml::mem(&GET_CPSR), eARM7_MODE_UND, 0, MODE_FLAG);     // rolins   CPSR, eARM7_MODE_UND, 0, MODE_FLAG
-	UML_MOV(block, uml::I1, (uint64_t)-4);                                             // mov      i1, -4
-	UML_TEST(block, uml::mem(&GET_CPSR), T_MASK);                            // test     CPSR, T_MASK
-	UML_MOVc(block, uml::COND_NZ, uml::I1, (uint64_t)-2);                                   // movnz    i1, -2
-	UML_ADD(block, uml::mem(&GetRegister(14)), uml::I0, uml::I1);                // add      LR, i0, i1
-	UML_MOV(block, uml::mem(&GetRegister(SPSR)), uml::mem(&GET_CPSR));      // mov      SPSR, CPSR
-	UML_OR(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), I_MASK);              // or       CPSR, CPSR, I_MASK
-	UML_ROLAND(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), 0, ~T_MASK);          // roland   CPSR, CPSR, 0, ~T_MASK
-	UML_MOV(block, uml::mem(&R15), 0x00000004);                              // mov      PC, 0x0c (Undefined Insn vector address)
-	UML_MOV(block, uml::mem(&m_pendingUnd), 0);                            // mov      pendingUnd, 0
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, nopabt);                                           // nopabt:
-
-	// Software Interrupt
-	UML_TEST(block, uml::mem(&m_pendingSwi), 1);                           // test     pendingSwi, 1
-	UML_JMPc(block, uml::COND_Z, done = label++);                            // jmpz     done
-
-	UML_ROLINS(block, uml::mem(&GET_CPSR), eARM7_MODE_SVC, 0, MODE_FLAG);     // rolins   CPSR, eARM7_MODE_SVC, 0, MODE_FLAG
-	UML_MOV(block, uml::I1, (uint64_t)-4);                                             // mov      i1, -4
-	UML_TEST(block, uml::mem(&GET_CPSR), T_MASK);                            // test     CPSR, T_MASK
-	UML_MOVc(block, uml::COND_NZ, uml::I1, (uint64_t)-2);                                   // movnz    i1, -2
-	UML_ADD(block, uml::mem(&GetRegister(14)), uml::I0, uml::I1);                // add      LR, i0, i1
-
-	UML_TEST(block, uml::mem(&GET_CPSR), SR_MODE32);                         // test     CPSR, MODE32
-	UML_JMPc(block, uml::COND_NZ, swi32 = label++);                          // jmpnz    swi32
-	UML_AND(block, uml::I1, uml::I0, 0xf4000000);                                 // and      i1, i0, 0xf4000000
-	UML_OR(block, uml::mem(&R15), uml::I1, 0x0800001b);                           // or       PC, i1, 0x0800001b
-	UML_AND(block, uml::I1, uml::mem(&GET_CPSR), 0x0fffff3f);                     // and      i1, CPSR, 0x0fffff3f
-	UML_ROLAND(block, uml::I0, uml::mem(&R15), 32-20, 0x0000000c);                // roland   i0, R15, 32-20, 0x0000000c
-	UML_ROLINS(block, uml::I0, uml::mem(&R15), 0, 0xf0000000);                    // rolins   i0, R15, 0, 0xf0000000
-	UML_OR(block, uml::mem(&GET_CPSR), uml::I0, uml::I1);                              // or       CPSR, i0, i1
-	UML_MOV(block, uml::mem(&m_pendingSwi), 0);                            // mov      pendingSwi, 0
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, swi32);                                            // irq32:
-	UML_MOV(block, uml::mem(&GetRegister(SPSR)), uml::mem(&GET_CPSR));      // mov      SPSR, CPSR
-	UML_OR(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), I_MASK);              // or       CPSR, CPSR, I_MASK
-	UML_ROLAND(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), 0, ~T_MASK);          // roland   CPSR, CPSR, 0, ~T_MASK
-	UML_MOV(block, uml::mem(&R15), 0x00000008);                              // mov      PC, 0x08 (SWI vector address)
-	UML_MOV(block, uml::mem(&m_pendingSwi), 0);                            // mov      pendingSwi, 0
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, irqadjust);                                        // irqadjust:
-	UML_MOV(block, uml::I1, 0);                                              // mov      i1, 0
-	UML_TEST(block, uml::mem(&COPRO_CTRL), COPRO_CTRL_MMU_EN | COPRO_CTRL_INTVEC_ADJUST);    // test COPRO_CTRL, MMU_EN | INTVEC_ADJUST
-	UML_MOVc(block, uml::COND_NZ, uml::I1, 0xffff0000);                           // movnz    i1, 0xffff0000
-	UML_OR(block, uml::mem(&R15), uml::mem(&R15), uml::I1);                             // or       PC, i1
-
-	UML_LABEL(block, done);                                             // done:
-
-	block.end();
-}
-
-/*-------------------------------------------------
-    static_generate_nocode_handler - generate an
-    exception handler for "out of code"
--------------------------------------------------*/
-
-void arm7_cpu_device::static_generate_nocode_handler()
-{
-	drcuml_state &drcuml = *m_impstate.drcuml;
-
-	/* begin generating */
-	drcuml_block &block(drcuml.begin_block(10));
-
-	/* generate a hash jump via the current mode and PC */
-	alloc_handle(drcuml, m_impstate.nocode, "nocode");
-	UML_HANDLE(block, *m_impstate.nocode);                                  // handle  nocode
-	UML_GETEXP(block, uml::I0);                                                      // getexp  i0
-	UML_MOV(block, uml::mem(&R15), uml::I0);                                              // mov     [pc],i0
-	save_fast_iregs(block);
-	UML_EXIT(block, EXECUTE_MISSING_CODE);                                      // exit    EXECUTE_MISSING_CODE
+	alloc_handle(*m_impstate.drcuml, handleptr, name);
+	UML_HANDLE(block, *handleptr);                                                  // handle  name
+	UML_GETEXP(block, uml::I0);                                                     // getexp  i0
+	UML_MOV(block, uml::mem(&R15), uml::I0);                                        // mov     [pc],i0
+	UML_EXIT(block, result);                                                        // exit    result
 
 	block.end();
 }
 
 
 /*-------------------------------------------------
-    static_generate_out_of_cycles - generate an
-    out of cycles exception handler
+    static_generate_check_irq - generate a
+    subroutine that returns non-zero in i0 if an
+    exception can be taken
 -------------------------------------------------*/
 
-void arm7_cpu_device::static_generate_out_of_cycles()
+void arm7_cpu_device::static_generate_check_irq()
 {
-	drcuml_state &drcuml = *m_impstate.drcuml;
-
 	/* begin generating */
-	drcuml_block &block(drcuml.begin_block(10));
-
-	/* generate a hash jump via the current mode and PC */
-	alloc_handle(drcuml, m_impstate.out_of_cycles, "out_of_cycles");
-	UML_HANDLE(block, *m_impstate.out_of_cycles);                       // handle  out_of_cycles
-	UML_GETEXP(block, uml::I0);                                                  // getexp  i0
-	UML_MOV(block, uml::mem(&R15), uml::I0);                                          // mov     <pc>,i0
-	save_fast_iregs(block);
-	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);                                 // exit    EXECUTE_OUT_OF_CYCLES
+	drcuml_block &block(m_impstate.drcuml->begin_block(40));
+
+	alloc_handle(*m_impstate.drcuml, m_impstate.check_irq, "check_irq");
+	UML_HANDLE(block, *m_impstate.check_irq);                                       // handle  check_irq
+
+	/* IRQ and FIQ only count while unmasked */
+	UML_LOAD(block, uml::I0, &m_pendingIrq, 0, uml::SIZE_BYTE, uml::SCALE_x1);      // load    i0,[pendingIrq],byte
+	UML_TEST(block, uml::mem(&GET_CPSR), I_MASK);                                   // test    [cpsr],I_MASK
+	UML_MOVc(block, uml::COND_NZ, uml::I0, 0);                                      // mov     i0,0,nz
+	UML_LOAD(block, uml::I1, &m_pendingFiq, 0, uml::SIZE_BYTE, uml::SCALE_x1);      // load    i1,[pendingFiq],byte
+	UML_TEST(block, uml::mem(&GET_CPSR), F_MASK);                                   // test    [cpsr],F_MASK
+	UML_MOVc(block, uml::COND_NZ, uml::I1, 0);                                      // mov     i1,0,nz
+	UML_OR(block, uml::I0, uml::I0, uml::I1);                                       // or      i0,i0,i1
+
+	/* aborts and traps are always taken */
+	for (bool const *pending : { &m_pendingAbtD, &m_pendingAbtP, &m_pendingUnd, &m_pendingSwi })
+	{
+		UML_LOAD(block, uml::I1, pending, 0, uml::SIZE_BYTE, uml::SCALE_x1);        // load    i1,[pending],byte
+		UML_OR(block, uml::I0, uml::I0, uml::I1);                                   // or      i0,i0,i1
+	}
+	UML_RET(block);                                                                 // ret
 
 	block.end();
 }
 
 
 /*------------------------------------------------------------------
-    static_generate_detect_fault
+    static_generate_memory_accessor - generate a
+    read or write subroutine; the address is in
+    i0, write data in i1 and read data is
+    returned in i0; i0-i3 are trashed
 ------------------------------------------------------------------*/
 
-void arm7_cpu_device::static_generate_detect_fault(uml::code_handle **handleptr)
+void arm7_cpu_device::static_generate_memory_accessor(int size, bool iswrite, const char *name, uml::code_handle *&handleptr)
 {
-	/* on entry, flags are in I2, vaddr is in I3, desc_lvl1 is in I4, ap is in R5 */
-	/* on exit, fault result is in I6 */
-	drcuml_state &drcuml = *m_impstate.drcuml;
-	int donefault = 0;
-	int checkuser = 0;
+	uml::c_function func;
 	int label = 1;
 
-	/* begin generating */
-	drcuml_block &block(drcuml.begin_block(1024));
-
-	/* add a global entry for this */
-	alloc_handle(drcuml, m_impstate.detect_fault, "detect_fault");
-	UML_HANDLE(block, *m_impstate.detect_fault);                // handle   detect_fault
-
-	UML_ROLAND(block, uml::I6, uml::I4, 32-4, 0x0f<<1);                       // roland   i6, i4, 32-4, 0xf<<1
-	UML_ROLAND(block, uml::I6, uml::mem(&COPRO_DOMAIN_ACCESS_CONTROL), uml::I6, 3);// roland   i6, COPRO_DOMAIN_ACCESS_CONTROL, i6, 3
-	// if permission == 3, FAULT_NONE
-	UML_CMP(block, uml::I6, 3);                                          // cmp      i6, 3
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_NONE);                        // move     i6, FAULT_NONE
-	UML_JMPc(block, uml::COND_E, donefault = label++);                   // jmpe     donefault
-	// if permission == 0 || permission == 2, FAULT_DOMAIN
-	UML_CMP(block, uml::I6, 1);                                          // cmp      i6, 1
-	UML_MOVc(block, uml::COND_NE, uml::I6, FAULT_DOMAIN);                     // movne    i6, FAULT_DOMAIN
-	UML_JMPc(block, uml::COND_NE, donefault);                            // jmpne    donefault
-
-	// if permission == 1
-	UML_CMP(block, uml::I5, 3);                                          // cmp      i5, 3
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_NONE);                        // move     i6, FAULT_NONE
-	UML_JMPc(block, uml::COND_E, donefault);                             // jmpe     donefault
-	UML_CMP(block, uml::I5, 0);                                          // cmp      i5, 1
-	UML_JMPc(block, uml::COND_NE, checkuser = label++);                  // jmpne    checkuser
-	UML_ROLAND(block, uml::I6, uml::mem(&COPRO_CTRL),                         // roland   i6, COPRO_CTRL, 32 - COPRO_CTRL_SYSTEM_SHIFT,
-				32 - COPRO_CTRL_SYSTEM_SHIFT,                       //          COPRO_CTRL_SYSTEM | COPRO_CTRL_ROM
-				COPRO_CTRL_SYSTEM | COPRO_CTRL_ROM);
-	// if s == 0 && r == 0, FAULT_PERMISSION
-	UML_CMP(block, uml::I6, 0);                                          // cmp      i6, 0
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_PERMISSION);                  // move     i6, FAULT_PERMISSION
-	UML_JMPc(block, uml::COND_E, donefault);                             // jmpe     donefault
-	// if s == 1 && r == 1, FAULT_PERMISSION
-	UML_CMP(block, uml::I6, 3);                                          // cmp      i6, 3
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_PERMISSION);                  // move     i6, FAULT_PERMISSION
-	UML_JMPc(block, uml::COND_E, donefault);                             // jmpe     donefault
-	// if flags & TLB_WRITE, FAULT_PERMISSION
-	UML_TEST(block, uml::I2, ARM7_TLB_WRITE);                            // test     i2, ARM7_TLB_WRITE
-	UML_MOVc(block, uml::COND_NZ, uml::I6, FAULT_PERMISSION);                 // move     i6, FAULT_PERMISSION
-	UML_JMPc(block, uml::COND_NZ, donefault);                            // jmpe     donefault
-	// if r == 1 && s == 0, FAULT_NONE
-	UML_CMP(block, uml::I6, 2);                                          // cmp      i6, 2
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_NONE);                        // move     i6, FAULT_NONE
-	UML_JMPc(block, uml::COND_E, donefault);                             // jmpe     donefault
-	UML_AND(block, uml::I6, uml::mem(&GET_CPSR), MODE_FLAG);                  // and      i6, GET_CPSR, MODE_FLAG
-	UML_CMP(block, uml::I6, eARM7_MODE_USER);                            // cmp      i6, eARM7_MODE_USER
-	// if r == 0 && s == 1 && usermode, FAULT_PERMISSION
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_PERMISSION);                  // move     i6, FAULT_PERMISSION
-	UML_MOVc(block, uml::COND_NE, uml::I6, FAULT_NONE);                       // movne    i6, FAULT_NONE
-	UML_JMP(block, donefault);                                      // jmp      donefault
-
-	UML_LABEL(block, checkuser);                                    // checkuser:
-	// if !write, FAULT_NONE
-	UML_TEST(block, uml::I2, ARM7_TLB_WRITE);                            // test     i2, ARM7_TLB_WRITE
-	UML_MOVc(block, uml::COND_Z, uml::I6, FAULT_NONE);                        // movz     i6, FAULT_NONE
-	UML_JMPc(block, uml::COND_Z, donefault);                             // jmp      donefault
-	UML_AND(block, uml::I6, uml::mem(&GET_CPSR), MODE_FLAG);                  // and      i6, GET_CPSR, MODE_FLAG
-	UML_CMP(block, uml::I6, eARM7_MODE_USER);                            // cmp      i6, eARM7_MODE_USER
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_PERMISSION);                  // move     i6, FAULT_PERMISSION
-	UML_MOVc(block, uml::COND_NE, uml::I6, FAULT_NONE);                       // move     i6, FAULT_NONE
-
-	UML_LABEL(block, donefault);                                    // donefault:
-	UML_RET(block);                                                 // ret
-}
-
-/*------------------------------------------------------------------
-    static_generate_tlb_translate
-------------------------------------------------------------------*/
-
-void arm7_cpu_device::static_generate_tlb_translate(uml::code_handle **handleptr)
-{
-	/* on entry, address is in I0 and flags are in I2 */
-	/* on exit, translated address is in I0 and success/failure is in I2 */
-	/* routine trashes I4-I7 */
-	drcuml_state &drcuml = *m_impstate.drcuml;
-	uml::code_label smallfault;
-	uml::code_label smallprefetch;
-	int nopid = 0;
-	int nounmapped = 0;
-	int nounmapped2 = 0;
-	int nocoarse = 0;
-	int nofine = 0;
-	int nosection = 0;
-	int nolargepage = 0;
-	int nosmallpage = 0;
-	int notinypage = 0;
-	int handlefault = 0;
-	int level2 = 0;
-	int prefetch = 0;
-	int prefetch2 = 0;
-	int label = 1;
-
-	/* begin generating */
-	drcuml_block &block(drcuml.begin_block(170));
-
-	alloc_handle(drcuml, m_impstate.tlb_translate, "tlb_translate");
-	UML_HANDLE(block, *m_impstate.tlb_translate);               // handle   tlb_translate
-
-	// I3: vaddr
-	UML_CMP(block, uml::I0, 32 * 1024 * 1024);                           // cmp      i0, 32*1024*1024
-	UML_JMPc(block, uml::COND_GE, nopid = label++);                      // jmpge    nopid
-	UML_AND(block, uml::I3, uml::mem(&COPRO_FCSE_PID), 0xfe000000);           // and      i3, COPRO_FCSE_PID, 0xfe000000
-	UML_ADD(block, uml::I3, uml::I3, uml::I0);                                     // add      i3, i3, i0
-
-	// I4: desc_lvl1
-	UML_AND(block, uml::I4, uml::mem(&COPRO_TLB_BASE), COPRO_TLB_BASE_MASK);  // and      i4, COPRO_TLB_BASE, COPRO_TLB_BASE_MASK
-	UML_ROLINS(block, uml::I4, uml::I3, 32 - COPRO_TLB_VADDR_FLTI_MASK_SHIFT, // rolins   i4, i3, 32-COPRO_TLB_VADDR_FLTI_MASK_SHIFT,
-				COPRO_TLB_VADDR_FLTI_MASK);                         //          COPRO_TLB_VADDR_FLTI_MASK
-	UML_READ(block, uml::I4, uml::I4, uml::SIZE_DWORD, uml::SPACE_PROGRAM);             // read32   i4, i4, PROGRAM
-
-	// I7: desc_lvl1 & 3
-	UML_AND(block, uml::I7, uml::I4, 3);                                      // and      i7, i4, 3
-
-	UML_CMP(block, uml::I7, COPRO_TLB_UNMAPPED);                         // cmp      i7, COPRO_TLB_UNMAPPED
-	UML_JMPc(block, uml::COND_NE, nounmapped = label++);                 // jmpne    nounmapped
-
-	// TLB Unmapped
-	UML_TEST(block, uml::I2, ARM7_TLB_ABORT_D);                          // test     i2, ARM7_TLB_ABORT_D
-	UML_MOVc(block, uml::COND_E, uml::mem(&COPRO_FAULT_STATUS_D), (5 << 0));  // move     COPRO_FAULT_STATUS_D, (5 << 0)
-	UML_MOVc(block, uml::COND_E, uml::mem(&COPRO_FAULT_ADDRESS), uml::I3);         // move     COPRO_FAULT_ADDRESS, i3
-	UML_MOVc(block, uml::COND_E, uml::mem(&m_pendingAbtD), 1);             // move     pendingAbtD, 1
-	UML_MOVc(block, uml::COND_E, uml::I2, 0);                                 // move     i2, 0
-	UML_RETc(block, uml::COND_E);                                        // rete
-
-	UML_TEST(block, uml::I2, ARM7_TLB_ABORT_P);                          // test     i2, ARM7_TLB_ABORT_P
-	UML_MOVc(block, uml::COND_E, uml::mem(&m_pendingAbtP), 1);             // move     pendingAbtP, 1
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, nounmapped);                                   // nounmapped:
-	UML_CMP(block, uml::I7, COPRO_TLB_COARSE_TABLE);                     // cmp      i7, COPRO_TLB_COARSE_TABLE
-	UML_JMPc(block, uml::COND_NE, nocoarse = label++);                   // jmpne    nocoarse
-
-	UML_ROLAND(block, uml::I5, uml::I4, 32-4, 0x0f<<1);                       // roland   i5, i4, 32-4, 0xf<<1
-	UML_ROLAND(block, uml::I5, uml::mem(&COPRO_DOMAIN_ACCESS_CONTROL), uml::I5, 3);// roland   i5, COPRO_DOMAIN_ACCESS_CONTROL, i5, 3
-	UML_CMP(block, uml::I5, 1);                                          // cmp      i5, 1
-	UML_JMPc(block, uml::COND_E, level2 = label++);                      // jmpe     level2
-	UML_CMP(block, uml::I5, 3);                                          // cmp      i5, 3
-	UML_JMPc(block, uml::COND_NE, nofine = label++);                     // jmpne    nofine
-	UML_LABEL(block, level2);                                       // level2:
-
-	// I7: desc_level2
-	UML_AND(block, uml::I7, uml::I4, COPRO_TLB_CFLD_ADDR_MASK);               // and      i7, i4, COPRO_TLB_CFLD_ADDR_MASK
-	UML_ROLINS(block, uml::I7, uml::I3, 32 - COPRO_TLB_VADDR_CSLTI_MASK_SHIFT,// rolins   i7, i3, 32 - COPRO_TLB_VADDR_CSLTI_MASK_SHIFT
-				COPRO_TLB_VADDR_CSLTI_MASK);                        //          COPRO_TLB_VADDR_CSLTI_MASK
-	UML_READ(block, uml::I7, uml::I7, uml::SIZE_DWORD, uml::SPACE_PROGRAM);             // read32   i7, i7, PROGRAM
-	UML_JMP(block, nofine);                                         // jmp      nofine
-
-	UML_LABEL(block, nocoarse);                                     // nocoarse:
-	UML_CMP(block, uml::I7, COPRO_TLB_SECTION_TABLE);                    // cmp      i7, COPRO_TLB_SECTION_TABLE
-	UML_JMPc(block, uml::COND_NE, nosection = label++);                  // jmpne    nosection
-
-	UML_ROLAND(block, uml::I5, uml::I4, 32-10, 3);                            // roland   i7, i4, 32-10, 3
-	// result in I6
-	UML_CALLH(block, *m_impstate.detect_fault);                 // callh    detect_fault
-	UML_CMP(block, uml::I6, FAULT_NONE);                                 // cmp      i6, FAULT_NONE
-	UML_JMPc(block, uml::COND_NE, handlefault = label++);                // jmpne    handlefault
-
-	// no fault, return translated address
-	UML_AND(block, uml::I0, uml::I3, ~COPRO_TLB_SECTION_PAGE_MASK);           // and      i0, i3, ~COPRO_TLB_SECTION_PAGE_MASK
-	UML_ROLINS(block, uml::I0, uml::I4, 0, COPRO_TLB_SECTION_PAGE_MASK);      // rolins   i0, i4, COPRO_TLB_SECTION_PAGE_MASK
-	UML_MOV(block, uml::I2, 1);                                          // mov      i2, 1
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, handlefault);                                  // handlefault:
-	UML_TEST(block, uml::I2, ARM7_TLB_ABORT_D);                          // test     i2, ARM7_TLB_ABORT_D
-	UML_JMPc(block, uml::COND_Z, prefetch = label++);                    // jmpz     prefetch
-	UML_MOV(block, uml::mem(&COPRO_FAULT_ADDRESS), uml::I3);                  // mov      COPRO_FAULT_ADDRESS, i3
-	UML_MOV(block, uml::mem(&m_pendingAbtD), 1);                      // mov      m_pendingAbtD, 1
-	UML_ROLAND(block, uml::I5, uml::I4, 31, 0xf0);                            // roland   i5, i4, 31, 0xf0
-	UML_CMP(block, uml::I6, FAULT_DOMAIN);                               // cmp      i6, FAULT_DOMAIN
-	UML_MOVc(block, uml::COND_E, uml::I6, 9 << 0);                            // move     i6, 9 << 0
-	UML_MOVc(block, uml::COND_NE, uml::I6, 13 << 0);                          // movne    i6, 13 << 0
-	UML_OR(block, uml::mem(&COPRO_FAULT_STATUS_D), uml::I5, uml::I6);              // or       COPRO_FAULT_STATUS_D, i5, i6
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, prefetch);                                     // prefetch:
-	UML_MOV(block, uml::mem(&m_pendingAbtP), 1);                      // mov      m_pendingAbtP, 1
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, nosection);                                    // nosection:
-	UML_CMP(block, uml::I7, COPRO_TLB_FINE_TABLE);                       // cmp      i7, COPRO_TLB_FINE_TABLE
-	UML_JMPc(block, uml::COND_NE, nofine);                               // jmpne    nofine
-
-	// Not yet implemented
-	UML_MOV(block, uml::I2, 1);                                          // mov      i2, 1
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, nofine);                                       // nofine:
-
-	// I7: desc_lvl2
-	UML_AND(block, uml::I6, uml::I7, 3);                                      // and      i6, i7, 3
-	UML_CMP(block, uml::I6, COPRO_TLB_UNMAPPED);                         // cmp      i6, COPRO_TLB_UNMAPPED
-	UML_JMPc(block, uml::COND_NE, nounmapped2 = label++);                // jmpne    nounmapped2
-
-	UML_TEST(block, uml::I2, ARM7_TLB_ABORT_D);                          // test     i2, ARM7_TLB_ABORT_D
-	UML_JMPc(block, uml::COND_Z, prefetch2 = label++);                   // jmpz     prefetch2
-	UML_MOV(block, uml::mem(&COPRO_FAULT_ADDRESS), uml::I3);                  // mov      COPRO_FAULT_ADDRESS, i3
-	UML_MOV(block, uml::mem(&m_pendingAbtD), 1);                      // mov      m_pendingAbtD, 1
-	UML_ROLAND(block, uml::I5, uml::I4, 31, 0xf0);                            // roland   i5, i4, 31, 0xf0
-	UML_OR(block, uml::I5, uml::I5, 7 << 0);                                  // or       i5, i5, 7 << 0
-	UML_OR(block, uml::mem(&COPRO_FAULT_STATUS_D), uml::I5, uml::I6);              // or       COPRO_FAULT_STATUS_D, i5, i6
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, prefetch2);                                    // prefetch2:
-	UML_MOV(block, uml::mem(&m_pendingAbtP), 1);                      // mov      m_pendingAbtP, 1
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, nounmapped2);                                  // nounmapped2:
-	UML_CMP(block, uml::I6, COPRO_TLB_LARGE_PAGE);                       // cmp      i6, COPRO_TLB_LARGE_PAGE
-	UML_JMPc(block, uml::COND_NE, nolargepage = label++);                // jmpne    nolargepage
-
-	UML_AND(block, uml::I0, uml::I3, ~COPRO_TLB_LARGE_PAGE_MASK);             // and      i0, i3, ~COPRO_TLB_LARGE_PAGE_MASK
-	UML_ROLINS(block, uml::I0, uml::I7, 0, COPRO_TLB_LARGE_PAGE_MASK);        // rolins   i0, i7, 0, COPRO_TLB_LARGE_PAGE_MASK
-	UML_MOV(block, uml::I2, 1);                                          // mov      i2, 1
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, nolargepage);                                  // nolargepage:
-	UML_CMP(block, uml::I6, COPRO_TLB_SMALL_PAGE);                       // cmp      i6, COPRO_TLB_SMALL_PAGE
-	UML_JMPc(block, uml::COND_NE, nosmallpage = label++);                // jmpne    nosmallpage
-
-	UML_ROLAND(block, uml::I5, uml::I3, 32-9, 3<<1);                          // roland   i5, i3, 32-9, 3<<1
-	UML_ROLAND(block, uml::I6, uml::I7, 32-4, 0xff);                          // roland   i6, i7, 32-4, 0xff
-	UML_SHR(block, uml::I5, uml::I7, uml::I5);                                     // shr      i5, i7, i5
-	UML_AND(block, uml::I5, uml::I5, 3);                                      // and      i5, i5, 3
-	// result in I6
-	UML_CALLH(block, *m_impstate.detect_fault);                 // callh    detect_fault
-
-	UML_CMP(block, uml::I6, FAULT_NONE);                                 // cmp      i6, FAULT_NONE
-	UML_JMPc(block, uml::COND_NE, smallfault = label++);                 // jmpne    smallfault
-	UML_AND(block, uml::I0, uml::I7, COPRO_TLB_SMALL_PAGE_MASK);              // and      i0, i7, COPRO_TLB_SMALL_PAGE_MASK
-	UML_ROLINS(block, uml::I0, uml::I3, 0, ~COPRO_TLB_SMALL_PAGE_MASK);       // rolins   i0, i3, 0, ~COPRO_TLB_SMALL_PAGE_MASK
-	UML_MOV(block, uml::I2, 1);                                          // mov      i2, 1
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, smallfault);                                   // smallfault:
-	UML_TEST(block, uml::I2, ARM7_TLB_ABORT_D);                          // test     i2, ARM7_TLB_ABORT_D
-	UML_JMPc(block, uml::COND_NZ, smallprefetch = label++);              // jmpnz    smallprefetch
-	UML_MOV(block, uml::mem(&COPRO_FAULT_ADDRESS), uml::I3);                  // mov      COPRO_FAULT_ADDRESS, i3
-	UML_MOV(block, uml::mem(&m_pendingAbtD), 1);                      // mov      pendingAbtD, 1
-	UML_CMP(block, uml::I6, FAULT_DOMAIN);                               // cmp      i6, FAULT_DOMAIN
-	UML_MOVc(block, uml::COND_E, uml::I5, 11 << 0);                           // move     i5, 11 << 0
-	UML_MOVc(block, uml::COND_NE, uml::I5, 15 << 0);                          // movne    i5, 15 << 0
-	UML_ROLINS(block, uml::I5, uml::I4, 31, 0xf0);                            // rolins   i5, i4, 31, 0xf0
-	UML_MOV(block, uml::mem(&COPRO_FAULT_STATUS_D), uml::I5);                 // mov      COPRO_FAULT_STATUS_D, i5
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, smallprefetch);                                // smallprefetch:
-	UML_MOV(block, uml::mem(&m_pendingAbtP), 1);                      // mov      pendingAbtP, 1
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, nosmallpage);                                  // nosmallpage:
-	UML_CMP(block, uml::I6, COPRO_TLB_TINY_PAGE);                        // cmp      i6, COPRO_TLB_TINY_PAGE
-	UML_JMPc(block, uml::COND_NE, notinypage = label++);                 // jmpne    notinypage
-
-	UML_AND(block, uml::I0, uml::I3, ~COPRO_TLB_TINY_PAGE_MASK);              // and      i0, i3, ~COPRO_TLB_TINY_PAGE_MASK
-	UML_ROLINS(block, uml::I0, uml::I7, 0, COPRO_TLB_TINY_PAGE_MASK);         // rolins   i0, i7, 0, COPRO_TLB_TINY_PAGE_MASK
-	UML_MOV(block, uml::I2, 1);                                          // mov      i2, 1
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, notinypage);                                   // notinypage:
-	UML_MOV(block, uml::I0, uml::I3);                                         // mov      i0, i3
-	UML_RET(block);                                                 // ret
-
-	block.end();
-}
-
-/*------------------------------------------------------------------
-    static_generate_memory_accessor
-------------------------------------------------------------------*/
-
-void arm7_cpu_device::static_generate_memory_accessor(int size, bool istlb, bool iswrite, const char *name, uml::code_handle *&handleptr)
-{
-	/* on entry, address is in I0; data for writes is in I1, fetch type in I2 */
-	/* on exit, read result is in I0 */
-	/* routine trashes I0-I3 */
-	drcuml_state &drcuml = *m_impstate.drcuml;
-	//int tlbmiss = 0;
-	int label = 1;
+	if (size == 1)
+		func = iswrite ? cfunc_drc_access<1, true> : cfunc_drc_access<1, false>;
+	else
+		func = iswrite ? cfunc_drc_access<4, true> : cfunc_drc_access<4, false>;
 
 	/* begin generating */
-	drcuml_block &block(drcuml.begin_block(1024));
+	drcuml_block &block(m_impstate.drcuml->begin_block(1024));
 
 	/* add a global entry for this */
-	alloc_handle(drcuml, handleptr, name);
-	UML_HANDLE(block, *handleptr);                                         // handle  *handleptr
-
-	if (istlb)
-	{
-		UML_TEST(block, uml::mem(&COPRO_CTRL), COPRO_CTRL_MMU_EN);               // test     COPRO_CTRL, COPRO_CTRL_MMU_EN
-		if (iswrite)
-		{
-			UML_MOVc(block, uml::COND_NZ, uml::I3, ARM7_TLB_WRITE);                   // movnz    i3, ARM7_TLB_WRITE
-		}
-		else
-		{
-			UML_MOVc(block, uml::COND_NZ, uml::I3, ARM7_TLB_READ);                    // movnz    i3, ARM7_TLB_READ
-		}
-		UML_OR(block, uml::I2, uml::I2, uml::I3);                                          // or       i2, i2, i3
-		UML_CALLHc(block, uml::COND_NZ, *m_impstate.tlb_translate);          // callhnz  tlb_translate
-	}
+	alloc_handle(*m_impstate.drcuml, handleptr, name);
+	UML_HANDLE(block, *handleptr);                                                  // handle  name
 
-	/* general case: assume paging and perform a translation */
+	/* fast RAM goes straight to memory unless the debugger wants to see the accesses */
 	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
 	{
-		for (int ramnum = 0; ramnum < ARM7_MAX_FASTRAM; ramnum++)
+		for (uint32_t ramnum = 0; ramnum < m_impstate.fastram_select; ramnum++)
 		{
-			if (m_impstate.fastram[ramnum].base != nullptr && (!iswrite || !m_impstate.fastram[ramnum].readonly))
-			{
-				void *fastbase = (uint8_t *)m_impstate.fastram[ramnum].base - m_impstate.fastram[ramnum].start;
-				uint32_t skip = label++;
-				if (m_impstate.fastram[ramnum].end != 0xffffffff)
-				{
-					UML_CMP(block, uml::I0, m_impstate.fastram[ramnum].end);     // cmp     i0, end
-					UML_JMPc(block, uml::COND_A, skip);                              // ja      skip
-				}
-				if (m_impstate.fastram[ramnum].start != 0x00000000)
-				{
-					UML_CMP(block, uml::I0, m_impstate.fastram[ramnum].start);   // cmp     i0, fastram_start
-					UML_JMPc(block, uml::COND_B, skip);                              // jb      skip
-				}
+			fast_ram_info const &fastram = m_impstate.fastram[ramnum];
+			if (iswrite && fastram.readonly)
+				continue;
 
-				if (!iswrite)
-				{
-					if (size == 1)
-					{
-						UML_XOR(block, uml::I0, uml::I0, (m_endian == ENDIANNESS_BIG) ? BYTE4_XOR_BE(0) : BYTE4_XOR_LE(0));
-																						// xor     i0, i0, bytexor
-						UML_LOAD(block, uml::I0, fastbase, uml::I0, uml::SIZE_BYTE, uml::SCALE_x1);         // load    i0, fastbase, i0, byte
-					}
-					else if (size == 2)
-					{
-						UML_XOR(block, uml::I0, uml::I0, (m_endian == ENDIANNESS_BIG) ? WORD_XOR_BE(0) : WORD_XOR_LE(0));
-																						// xor     i0, i0, wordxor
-						UML_LOAD(block, uml::I0, fastbase, uml::I0, uml::SIZE_WORD, uml::SCALE_x1);         // load    i0, fastbase, i0, word_x1
-					}
-					else if (size == 4)
-					{
-						UML_LOAD(block, uml::I0, fastbase, uml::I0, uml::SIZE_DWORD, uml::SCALE_x1);        // load    i0, fastbase, i0, dword_x1
-					}
-					UML_RET(block);                                                     // ret
-				}
-				else
-				{
-					if (size == 1)
-					{
-						UML_XOR(block, uml::I0, uml::I0, (m_endian == ENDIANNESS_BIG) ? BYTE4_XOR_BE(0) : BYTE4_XOR_LE(0));
-																						// xor     i0, i0, bytexor
-						UML_STORE(block, fastbase, uml::I0, uml::I1, uml::SIZE_BYTE, uml::SCALE_x1);        // store   fastbase, i0, i1, byte
-					}
-					else if (size == 2)
-					{
-						UML_XOR(block, uml::I0, uml::I0, (m_endian == ENDIANNESS_BIG) ? WORD_XOR_BE(0) : WORD_XOR_LE(0));
-																						// xor     i0, i0, wordxor
-						UML_STORE(block, fastbase, uml::I0, uml::I1, uml::SIZE_WORD, uml::SCALE_x1);        // store   fastbase, i0, i1, word_x1
-					}
-					else if (size == 4)
-					{
-						UML_STORE(block, fastbase, uml::I0, uml::I1, uml::SIZE_DWORD, uml::SCALE_x1);       // store   fastbase,i0,i1,dword_x1
-					}
-					UML_RET(block);                                                     // ret
-				}
-
-				UML_LABEL(block, skip);                                                 // skip:
-			}
-		}
-	}
-
-	switch (size)
-	{
-		case 1:
-			if (iswrite)
+			void *fastbase = (uint8_t *)fastram.base - fastram.start;
+			uml::code_label const skip = label++;
+			if (fastram.end != 0xffffffff)
 			{
-				UML_WRITE(block, uml::I0, uml::I1, uml::SIZE_BYTE, uml::SPACE_PROGRAM);                 // write   i0, i1, program_byte
+				UML_CMP(block, uml::I0, fastram.end);                               // cmp     i0,end
+				UML_JMPc(block, uml::COND_A, skip);                                 // ja      skip
 			}
-			else
+			if (fastram.start != 0x00000000)
 			{
-				UML_READ(block, uml::I0, uml::I0, uml::SIZE_BYTE, uml::SPACE_PROGRAM);                  // read    i0, i0, program_byte
+				UML_CMP(block, uml::I0, fastram.start);                             // cmp     i0,fastram_start
+				UML_JMPc(block, uml::COND_B, skip);                                 // jb      skip
 			}
-			break;
 
-		case 2:
-			if (iswrite)
-			{
-				UML_WRITE(block, uml::I0, uml::I1, uml::SIZE_WORD, uml::SPACE_PROGRAM);                 // write   i0,i1,program_word
-			}
-			else
+			if (size == 1)
 			{
-				UML_READ(block, uml::I0, uml::I0, uml::SIZE_WORD, uml::SPACE_PROGRAM);                  // read    i0,i0,program_word
+				UML_XOR(block, uml::I0, uml::I0, (m_endian == ENDIANNESS_BIG) ? BYTE4_XOR_BE(0) : BYTE4_XOR_LE(0));
+																					// xor     i0,i0,bytexor
+				if (iswrite)
+					UML_STORE(block, fastbase, uml::I0, uml::I1, uml::SIZE_BYTE, uml::SCALE_x1);
+																					// store   fastbase,i0,i1,byte
+				else
+					UML_LOAD(block, uml::I0, fastbase, uml::I0, uml::SIZE_BYTE, uml::SCALE_x1);
+																					// load    i0,fastbase,i0,byte
 			}
-			break;
-
-		case 4:
-			if (iswrite)
+			else if (iswrite)
 			{
-				UML_WRITE(block, uml::I0, uml::I1, uml::SIZE_DWORD, uml::SPACE_PROGRAM);                // write   i0,i1,program_dword
+				/* word writes ignore the low address bits */
+				UML_AND(block, uml::I0, uml::I0, 0xfffffffc);                       // and     i0,i0,~3
+				UML_STORE(block, fastbase, uml::I0, uml::I1, uml::SIZE_DWORD, uml::SCALE_x1);
+																					// store   fastbase,i0,i1,dword_x1
 			}
 			else
 			{
-				UML_READ(block, uml::I0, uml::I0, uml::SIZE_DWORD, uml::SPACE_PROGRAM);                 // read    i0,i0,program_dword
+				/* misaligned word reads rotate the data; leave them to the slow path */
+				UML_TEST(block, uml::I0, 3);                                        // test    i0,3
+				UML_JMPc(block, uml::COND_NZ, skip);                                // jnz     skip
+				UML_LOAD(block, uml::I0, fastbase, uml::I0, uml::SIZE_DWORD, uml::SCALE_x1);
+																					// load    i0,fastbase,i0,dword_x1
 			}
-			break;
+			UML_RET(block);                                                         // ret
+
+			UML_LABEL(block, skip);                                                 // skip:
+		}
 	}
+
+	/* everything else goes through the interpreter's accessors */
+	UML_MOV(block, uml::mem(&m_impstate.arg0), uml::I0);                            // mov     [arg0],i0
+	if (iswrite)
+		UML_MOV(block, uml::mem(&m_impstate.arg1), uml::I1);                        // mov     [arg1],i1
+	UML_CALLC(block, func, this);                                                   // callc   cfunc_drc_access
+	if (!iswrite)
+		UML_MOV(block, uml::I0, uml::mem(&m_impstate.arg1));                        // mov     i0,[arg1]
 	UML_RET(block);                                                                 // ret
 
 	block.end();
 }
 
+
+
 /***************************************************************************
     CODE GENERATION
 ***************************************************************************/
 
 /*-------------------------------------------------
-    generate_update_cycles - generate code to
-    subtract cycles from the icount and generate
-    an exception if out
+    drc_reg - return the storage for a register
+    as banked in the mode being compiled
 -------------------------------------------------*/
 
-void arm7_cpu_device::generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param)
+uml::parameter arm7_cpu_device::drc_reg(const compiler_state &compiler, int reg) const
 {
-	/* check full interrupts if pending */
-	if (compiler.checkints)
-	{
-		compiler.checkints = false;
-		UML_CALLH(block, *m_impstate.check_irq);
-	}
+	return uml::mem(&m_r[sRegisterTable[compiler.mode & MODE_FLAG][reg]]);
+}
+
 
+/*-------------------------------------------------
+    generate_update_cycles - generate code to
+    subtract cycles from the icount and leave if
+    out, or if an exception can be taken
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param, bool allow_exception)
+{
 	/* account for cycles */
 	if (compiler.cycles > 0)
 	{
 		UML_SUB(block, uml::mem(&m_icount), uml::mem(&m_icount), MAPVAR_CYCLES);    // sub     icount,icount,cycles
-		UML_MAPVAR(block, MAPVAR_CYCLES, 0);                                    // mapvar  cycles,0
-		UML_EXHc(block, uml::COND_S, *m_impstate.out_of_cycles, param);          // exh     out_of_cycles,nextpc
+		UML_MAPVAR(block, MAPVAR_CYCLES, 0);                                        // mapvar  cycles,0
+		if (allow_exception)
+		{
+			UML_CMP(block, uml::mem(&m_icount), 0);                                 // cmp     icount,0
+			UML_EXHc(block, uml::COND_LE, *m_impstate.out_of_cycles, param);        // exh     out_of_cycles,nextpc,le
+		}
 	}
 	compiler.cycles = 0;
+
+	/* leave so the interpreter can take a pending exception */
+	if (allow_exception)
+	{
+		uml::code_label const skip = compiler.labelnum++;
+		UML_LOAD(block, uml::I0, &m_pending_interrupt, 0, uml::SIZE_BYTE, uml::SCALE_x1);
+																					// load    i0,[pending_interrupt],byte
+		UML_TEST(block, uml::I0, uml::I0);                                          // test    i0,i0
+		UML_JMPc(block, uml::COND_Z, skip);                                         // jz      skip
+		UML_CALLH(block, *m_impstate.check_irq);                                    // callh   check_irq
+		UML_TEST(block, uml::I0, uml::I0);                                          // test    i0,i0
+		UML_EXHc(block, uml::COND_NZ, *m_impstate.interrupt, param);                // exh     interrupt,nextpc,nz
+		UML_LABEL(block, skip);                                                     // skip:
+	}
 }
 
 
@@ -1170,60 +733,21 @@ void arm7_cpu_device::generate_update_cycles(drcuml_block &block, compiler_state
 
 void arm7_cpu_device::generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast)
 {
-	const opcode_desc *curdesc;
-	if (m_impstate.drcuml->logging())
-	{
-		block.append_comment("[Validation for %08X]", seqhead->pc);                // comment
-	}
+	/* only the first instruction is checked unless asked for more */
+	const opcode_desc *const last = (m_impstate.drcoptions & ARM7DRC_STRICT_VERIFY) ? seqlast : seqhead;
 
-	/* loose verify or single instruction: just compare and fail */
-	if (!(m_impstate.drcoptions & ARM7DRC_STRICT_VERIFY) || seqhead->next() == nullptr)
-	{
-		if (!(seqhead->flags & OPFLAG_VIRTUAL_NOOP))
-		{
-			uint32_t sum = seqhead->opptr.l[0];
-			const void *base = m_prptr(seqhead->physpc);
-			UML_LOAD(block, uml::I0, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);             // load    i0,base,0,dword
-
-			if (seqhead->delay.first() != nullptr && seqhead->physpc != seqhead->delay.first()->physpc)
-			{
-				base = m_prptr(seqhead->delay.first()->physpc);
-				UML_LOAD(block, uml::I1, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);         // load    i1,base,dword
-				UML_ADD(block, uml::I0, uml::I0, uml::I1);                                 // add     i0,i0,i1
-
-				sum += seqhead->delay.first()->opptr.l[0];
-			}
-
-			UML_CMP(block, uml::I0, sum);                                        // cmp     i0,opptr[0]
-			UML_EXHc(block, uml::COND_NE, *m_impstate.nocode, epc(seqhead)); // exne    nocode,seqhead->pc
-		}
-	}
+	if (m_impstate.drcuml->logging())
+		block.append_comment("[Validation for %08X]", seqhead->pc);                    // comment
 
-	/* full verification; sum up everything */
-	else
+	for (const opcode_desc *curdesc = seqhead; curdesc != last->next(); curdesc = curdesc->next())
 	{
-		uint32_t sum = 0;
-		const void *base = m_prptr(seqhead->physpc);
-		UML_LOAD(block, uml::I0, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);                 // load    i0,base,0,dword
-		sum += seqhead->opptr.l[0];
-		for (curdesc = seqhead->next(); curdesc != seqlast->next(); curdesc = curdesc->next())
-			if (!(curdesc->flags & OPFLAG_VIRTUAL_NOOP))
-			{
-				base = m_prptr(curdesc->physpc);
-				UML_LOAD(block, uml::I1, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);         // load    i1,base,dword
-				UML_ADD(block, uml::I0, uml::I0, uml::I1);                                 // add     i0,i0,i1
-				sum += curdesc->opptr.l[0];
+		const void *base = m_prptr(curdesc->physpc & ~3);
+		if (base == nullptr)
+			continue;
 
-				if (curdesc->delay.first() != nullptr && (curdesc == seqlast || (curdesc->next() != nullptr && curdesc->next()->physpc != curdesc->delay.first()->physpc)))
-				{
-					base = m_prptr(curdesc->delay.first()->physpc);
-					UML_LOAD(block, uml::I1, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);     // load    i1,base,dword
-					UML_ADD(block, uml::I0, uml::I0, uml::I1);                             // add     i0,i0,i1
-					sum += curdesc->delay.first()->opptr.l[0];
-				}
-			}
-		UML_CMP(block, uml::I0, sum);                                            // cmp     i0,sum
-		UML_EXHc(block, uml::COND_NE, *m_impstate.nocode, epc(seqhead));     // exne    nocode,seqhead->pc
+		UML_LOAD(block, uml::I0, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);          // load    i0,base,dword
+		UML_CMP(block, uml::I0, curdesc->userdata0);                                // cmp     i0,opcode
+		UML_EXHc(block, uml::COND_NE, *m_impstate.nocode, seqhead->pc);             // exh     nocode,seqhead->pc,ne
 	}
 }
 
@@ -1235,26 +759,19 @@ void arm7_cpu_device::generate_checksum_block(drcuml_block &block, compiler_stat
 
 void arm7_cpu_device::generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
 {
-	//offs_t expc;
-	int hotnum;
+	bool const interpret = (desc->userflags & ARM7_UF_INTERPRET) != 0;
 
-	/* add an entry for the log */
-	// TODO FIXME
-//  if (m_impstate.drcuml->logging() && !(desc->flags & OPFLAG_VIRTUAL_NOOP))
-//      log_add_disasm_comment(block, desc->pc, desc->opptr.l[0]);
+	/* Thumb code is unconditional apart from its branches */
+	uint32_t const cond = (compiler.mode & ARM7DRC_MODE_THUMB) ? COND_AL : (desc->opptr.l[0] >> INSN_COND_SHIFT);
 
 	/* set the PC map variable */
-	//expc = (desc->flags & OPFLAG_IN_DELAY_SLOT) ? desc->pc - 3 : desc->pc;
-	UML_MAPVAR(block, MAPVAR_PC, desc->pc);                                 // mapvar  PC,pc
-
-	/* accumulate total cycles */
-	compiler.cycles += desc->cycles;
+	UML_MAPVAR(block, MAPVAR_PC, desc->pc);                                         // mapvar  PC,desc->pc
 
-	/* update the icount map variable */
-	UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                     // mapvar  CYCLES,compiler.cycles
+	/* accumulate total cycles; a skipped instruction only costs one */
+	compiler.cycles += (cond != COND_AL && !interpret) ? 1 : desc->cycles;
 
-	/* is this a hotspot? */
-	for (hotnum = 0; hotnum < ARM7_MAX_HOTSPOTS; hotnum++)
+	/* add extra cycles for hotspots */
+	for (uint32_t hotnum = 0; hotnum < m_impstate.hotspot_select; hotnum++)
 	{
 		if (m_impstate.hotspot[hotnum].pc != 0 && desc->pc == m_impstate.hotspot[hotnum].pc && desc->opptr.l[0] == m_impstate.hotspot[hotnum].opcode)
 		{
@@ -1264,550 +781,487 @@ void arm7_cpu_device::generate_sequence_instruction(drcuml_block &block, compile
 	}
 
 	/* update the icount map variable */
-	UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                     // mapvar  CYCLES,compiler.cycles
+	UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                              // mapvar  CYCLES,compiler.cycles
 
-	/* if we are debugging, call the debugger */
-	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) != 0)
+	/* anything the recompiler doesn't handle goes to the interpreter */
+	if (interpret)
 	{
-		UML_MOV(block, uml::mem(&R15), desc->pc);                                // mov     [pc],desc->pc
-		save_fast_iregs(block);
-		UML_DEBUG(block, desc->pc);                                         // debug   desc->pc
+		generate_interpret(block, compiler, desc);
+		return;
 	}
 
-	/* if we hit an unmapped address, fatal error */
-	if (desc->flags & OPFLAG_COMPILER_UNMAPPED)
+	/* if we are debugging, call the debugger */
+	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) != 0)
 	{
-		UML_MOV(block, uml::mem(&R15), desc->pc);                                // mov     R15,desc->pc
-		save_fast_iregs(block);
-		UML_EXIT(block, EXECUTE_UNMAPPED_CODE);                             // exit    EXECUTE_UNMAPPED_CODE
+		UML_MOV(block, uml::mem(&R15), desc->pc);                                   // mov     [pc],desc->pc
+		UML_DEBUG(block, desc->pc);                                                 // debug   desc->pc
 	}
 
-	/* otherwise, unless this is a virtual no-op, it's a regular instruction */
-	else if (!(desc->flags & OPFLAG_VIRTUAL_NOOP))
+	/* register-only instructions can be checked against the interpreter */
+	bool const validate = (m_impstate.drcoptions & ARM7DRC_VALIDATE) && !(desc->flags & (OPFLAG_IS_BRANCH | OPFLAG_READS_MEMORY | OPFLAG_WRITES_MEMORY));
+	if (validate)
 	{
-		/* compile the instruction */
-		if (!generate_opcode(block, compiler, desc))
-		{
-			UML_MOV(block, uml::mem(&R15), desc->pc);                            // mov     R15,desc->pc
-			UML_MOV(block, uml::mem(&m_impstate.arg0), desc->opptr.l[0]);    // mov     [arg0],desc->opptr.l
-			//UML_CALLC(block, cfunc_unimplemented, arm);                     // callc   cfunc_unimplemented // TODO FIXME
-		}
+		UML_MOV(block, uml::mem(&R15), desc->pc);                                   // mov     [pc],desc->pc
+		UML_CALLC(block, cfunc_drc_validate_begin, this);                           // callc   cfunc_drc_validate_begin
 	}
-}
 
-
-/*------------------------------------------------------------------
-    generate_delay_slot_and_branch
-------------------------------------------------------------------*/
-
-void arm7_cpu_device::generate_delay_slot_and_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint8_t linkreg)
-{
-	compiler_state compiler_temp(compiler);
-
-	/* update the cycles and jump through the hash table to the target */
-	if (desc->targetpc != BRANCH_TARGET_DYNAMIC)
+	/* compile the instruction */
+	if (compiler.mode & ARM7DRC_MODE_THUMB)
+		generate_thumb_opcode(block, compiler, desc);
+	else if (cond != COND_AL)
 	{
-		generate_update_cycles(block, compiler_temp, desc->targetpc);   // <subtract cycles>
-		UML_HASHJMP(block, 0, desc->targetpc, *m_impstate.nocode);
-																					// hashjmp 0,desc->targetpc,nocode
+		uml::code_label const skip = compiler.labelnum++;
+		generate_condition(block, cond, skip);
+		if (desc->cycles > 1)
+			UML_SUB(block, uml::mem(&m_icount), uml::mem(&m_icount), desc->cycles - 1);
+																					// sub     icount,icount,cycles - 1
+		generate_arm_opcode(block, compiler, desc);
+		UML_LABEL(block, skip);                                                     // skip:
+		UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                          // mapvar  CYCLES,compiler.cycles
 	}
 	else
+		generate_arm_opcode(block, compiler, desc);
+
+	if (validate)
 	{
-		generate_update_cycles(block, compiler_temp, uml::mem(&m_impstate.jmpdest));
-																					// <subtract cycles>
-		UML_HASHJMP(block, 0, uml::mem(&m_impstate.jmpdest), *m_impstate.nocode);// hashjmp 0,<rsreg>,nocode
+		UML_MOV(block, uml::mem(&R15), desc->pc + desc->length);                    // mov     [pc],nextpc
+		UML_CALLC(block, cfunc_drc_validate_end, this);                             // callc   cfunc_drc_validate_end
 	}
+}
 
-	/* update the label */
-	compiler.labelnum = compiler_temp.labelnum;
 
-	/* reset the mapvar to the current cycles and account for skipped slots */
-	compiler.cycles += desc->skipslots;
-	UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                             // mapvar  CYCLES,compiler.cycles
+/*-------------------------------------------------
+    generate_interpret - generate code to run a
+    single instruction through the interpreter
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_interpret(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	uint32_t const nextpc = desc->pc + desc->length;
+
+	/* the interpreter charges its own cycles */
+	generate_update_cycles(block, compiler, desc->pc, false);                       // <subtract cycles>
+	UML_MOV(block, uml::mem(&R15), desc->pc);                                       // mov     [pc],desc->pc
+	UML_MOV(block, uml::mem(&m_impstate.nextpc), nextpc);                           // mov     [nextpc],nextpc
+	UML_CALLC(block, cfunc_drc_interpret, this);                                    // callc   cfunc_drc_interpret
+
+	/* leave if it went somewhere else or changed the mode */
+	UML_MOV(block, uml::I0, uml::mem(&m_impstate.exit));                            // mov     i0,[exit]
+	UML_TEST(block, uml::I0, uml::I0);                                              // test    i0,i0
+	UML_EXITc(block, uml::COND_NZ, uml::I0);                                        // exit    i0,nz
+	UML_CMP(block, uml::mem(&m_icount), 0);                                         // cmp     icount,0
+	UML_EXHc(block, uml::COND_LE, *m_impstate.out_of_cycles, nextpc);               // exh     out_of_cycles,nextpc,le
 }
 
 
-const arm7_cpu_device::drcarm7ops_ophandler arm7_cpu_device::drcops_handler[0x10] =
-{
-	&arm7_cpu_device::drcarm7ops_0123, &arm7_cpu_device::drcarm7ops_0123, &arm7_cpu_device::drcarm7ops_0123, &arm7_cpu_device::drcarm7ops_0123,
-	&arm7_cpu_device::drcarm7ops_4567, &arm7_cpu_device::drcarm7ops_4567, &arm7_cpu_device::drcarm7ops_4567, &arm7_cpu_device::drcarm7ops_4567,
-	&arm7_cpu_device::drcarm7ops_89,   &arm7_cpu_device::drcarm7ops_89,   &arm7_cpu_device::drcarm7ops_ab,   &arm7_cpu_device::drcarm7ops_ab,
-	&arm7_cpu_device::drcarm7ops_cd,   &arm7_cpu_device::drcarm7ops_cd,   &arm7_cpu_device::drcarm7ops_e,    &arm7_cpu_device::drcarm7ops_f,
-};
+/*-------------------------------------------------
+    generate_branch - generate code to update the
+    cycle count and jump to a static or dynamic
+    target
+-------------------------------------------------*/
 
-void arm7_cpu_device::saturate_qbit_overflow(drcuml_block &block)
+void arm7_cpu_device::generate_branch(drcuml_block &block, compiler_state &compiler, uml::parameter target)
 {
-	UML_MOV(block, uml::I1, 0);
-	UML_DCMP(block, uml::I0, 0x000000007fffffffL);
-	UML_MOVc(block, uml::COND_G, uml::I1, Q_MASK);
-	UML_MOVc(block, uml::COND_G, uml::I0, 0x7fffffff);
-	UML_DCMP(block, uml::I0, 0xffffffff80000000ULL);
-	UML_MOVc(block, uml::COND_L, uml::I1, Q_MASK);
-	UML_MOVc(block, uml::COND_L, uml::I0, 0x80000000);
-	UML_OR(block, DRC_CPSR, DRC_CPSR, uml::I1);
+	compiler_state compiler_temp(compiler);
+
+	generate_update_cycles(block, compiler_temp, target, true);                     // <subtract cycles>
+	UML_HASHJMP(block, compiler.mode, target, *m_impstate.nocode);                  // hashjmp <mode>,target,nocode
+	compiler.labelnum = compiler_temp.labelnum;
 }
 
-bool arm7_cpu_device::drcarm7ops_0123(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t insn)
+
+/*-------------------------------------------------
+    generate_condition - generate code to jump to
+    skip if an ARM condition code fails
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_condition(drcuml_block &block, uint32_t cond, uml::code_label skip)
 {
-	uml::code_label done;
-	/* Branch and Exchange (BX) */
-	if ((insn & 0x0ffffff0) == 0x012fff10)     // bits 27-4 == 000100101111111111110001
-	{
-		UML_MOV(block, DRC_PC, DRC_REG(insn & 0x0f));
-		UML_TEST(block, DRC_PC, 1);
-		UML_JMPc(block, uml::COND_Z, done = compiler.labelnum++);
-		UML_OR(block, DRC_CPSR, DRC_CPSR, T_MASK);
-		UML_AND(block, DRC_PC, DRC_PC, ~1);
-	}
-	else if ((insn & 0x0ff000f0) == 0x01600010) // CLZ - v5
-	{
-		uint32_t rm = insn&0xf;
-		uint32_t rd = (insn>>12)&0xf;
+	/* odd conditions are the inverse of the even one before them; work out the UML
+	   conditions here since the ARM names clash with the UML ones inside the macros */
+	bool const inverted = (cond & 1) != 0;
+	uml::condition_t const fail_clear = inverted ? uml::COND_NZ : uml::COND_Z;
+	uml::condition_t const fail_set = inverted ? uml::COND_Z : uml::COND_NZ;
 
-		UML_LZCNT(block, DRC_REG(rd), DRC_REG(rm));
-		UML_ADD(block, DRC_PC, DRC_PC, 4);
-	}
-	else if ((insn & 0x0ff000f0) == 0x01000050) // QADD - v5
-	{
-		uint32_t rm = insn&0xf;
-		uint32_t rn = (insn>>16)&0xf;
-		uint32_t rd = (insn>>12)&0xf;
-		UML_DSEXT(block, uml::I0, DRC_REG(rm), uml::SIZE_DWORD);
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		UML_DADD(block, uml::I0, uml::I0, uml::I1);
-		saturate_qbit_overflow(block);
-		UML_MOV(block, DRC_REG(rd), uml::I0);
-		UML_ADD(block, DRC_PC, DRC_PC, 4);
-	}
-	else if ((insn & 0x0ff000f0) == 0x01400050) // QDADD - v5
-	{
-		uint32_t rm = insn&0xf;
-		uint32_t rn = (insn>>16)&0xf;
-		uint32_t rd = (insn>>12)&0xf;
-
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		UML_DADD(block, uml::I0, uml::I1, uml::I1);
-		saturate_qbit_overflow(block);
-
-		UML_DSEXT(block, uml::I0, DRC_REG(rm), uml::SIZE_DWORD);
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		UML_DADD(block, uml::I1, uml::I1, uml::I1);
-		UML_DADD(block, uml::I0, uml::I0, uml::I1);
-		saturate_qbit_overflow(block);
-		UML_MOV(block, DRC_REG(rd), uml::I0);
-
-		UML_ADD(block, DRC_PC, DRC_PC, 4);
-	}
-	else if ((insn & 0x0ff000f0) == 0x01200050) // QSUB - v5
+	switch (cond)
 	{
-		uint32_t rm = insn&0xf;
-		uint32_t rn = (insn>>16)&0xf;
-		uint32_t rd = (insn>>12)&0xf;
-
-		UML_DSEXT(block, uml::I0, DRC_REG(rm), uml::SIZE_DWORD);
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		UML_DSUB(block, uml::I0, uml::I0, uml::I1);
-		saturate_qbit_overflow(block);
-		UML_MOV(block, DRC_REG(rd), uml::I0);
-		UML_ADD(block, DRC_PC, DRC_PC, 4);
-	}
-	else if ((insn & 0x0ff000f0) == 0x01600050) // QDSUB - v5
-	{
-		uint32_t rm = insn&0xf;
-		uint32_t rn = (insn>>16)&0xf;
-		uint32_t rd = (insn>>12)&0xf;
-
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		UML_DADD(block, uml::I0, uml::I1, uml::I1);
-		saturate_qbit_overflow(block);
-
-		UML_DSEXT(block, uml::I0, DRC_REG(rm), uml::SIZE_DWORD);
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		UML_DADD(block, uml::I1, uml::I1, uml::I1);
-		UML_DSUB(block, uml::I0, uml::I0, uml::I1);
-		saturate_qbit_overflow(block);
-		UML_MOV(block, DRC_REG(rd), uml::I0);
-
-		UML_ADD(block, DRC_PC, DRC_PC, 4);
-	}
-	else if ((insn & 0x0ff00090) == 0x01000080) // SMLAxy - v5
-	{
-		uint32_t rm = insn&0xf;
-		uint32_t rn = (insn>>8)&0xf;
-		uint32_t rd = (insn>>16)&0xf;
-		uint32_t ra = (insn>>12)&0xf;
-
-		UML_MOV(block, uml::I0, DRC_REG(rm));
-		UML_MOV(block, uml::I1, DRC_REG(rn));
+		case COND_EQ:
+		case COND_NE:
+			UML_TEST(block, uml::mem(&GET_CPSR), Z_MASK);                           // test    [cpsr],Z_MASK
+			UML_JMPc(block, fail_clear, skip);                                      // jmp     skip,!cond
+			break;
 
-		// select top and bottom halves of src1/src2 and sign extend if necessary
-		if (insn & 0x20)
-		{
-			UML_SHR(block, uml::I0, uml::I0, 16);
-		}
-		UML_SEXT(block, uml::I0, uml::I0, uml::SIZE_WORD);
+		case COND_CS:
+		case COND_CC:
+			UML_TEST(block, uml::mem(&GET_CPSR), C_MASK);                           // test    [cpsr],C_MASK
+			UML_JMPc(block, fail_clear, skip);                                      // jmp     skip,!cond
+			break;
 
-		if (insn & 0x40)
-		{
-			UML_SHR(block, uml::I1, uml::I1, 16);
-		}
-		UML_SEXT(block, uml::I0, uml::I0, uml::SIZE_WORD);
-
-		// do the signed multiply
-		UML_MULS(block, uml::I0, uml::I1, uml::I0, uml::I1);
-		UML_DSHL(block, uml::I0, uml::I0, 32);
-		UML_DOR(block, uml::I0, uml::I0, uml::I1);
-		UML_MOV(block, uml::I1, DRC_REG(ra));
-		UML_DADD(block, uml::I0, uml::I0, uml::I1);
-		// and the accumulate.  NOTE: only the accumulate can cause an overflow, which is why we do it this way.
-		saturate_qbit_overflow(block);
-		UML_MOV(block, DRC_REG(rd), uml::I0);
-		UML_ADD(block, DRC_PC, DRC_PC, 4);
-	}
-	else if ((insn & 0x0ff00090) == 0x01400080) // SMLALxy - v5
-	{
-		uint32_t rm = insn&0xf;
-		uint32_t rn = (insn>>8)&0xf;
-		uint32_t rdh = (insn>>16)&0xf;
-		uint32_t rdl = (insn>>12)&0xf;
-
-		UML_DSEXT(block, uml::I0, DRC_REG(rm), uml::SIZE_DWORD);
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		// do the signed multiply
-		UML_DMULS(block, uml::I2, uml::I3, uml::I0, uml::I1);
-
-		UML_MOV(block, uml::I0, DRC_REG(rdh));
-		UML_MOV(block, uml::I1, DRC_REG(rdl));
-		UML_DSHL(block, uml::I0, uml::I0, 32);
-		UML_DOR(block, uml::I0, uml::I0, uml::I1);
-		UML_DADD(block, uml::I0, uml::I0, uml::I2);
-		UML_MOV(block, DRC_REG(rdl), uml::I0);
-		UML_DSHR(block, uml::I0, uml::I0, 32);
-		UML_MOV(block, DRC_REG(rdh), uml::I0);
-	}
-	else if ((insn & 0x0ff00090) == 0x01600080) // SMULxy - v5
-	{
-		int32_t src1 = GetRegister(insn&0xf);
-		int32_t src2 = GetRegister((insn>>8)&0xf);
-		int32_t res;
+		case COND_MI:
+		case COND_PL:
+			UML_TEST(block, uml::mem(&GET_CPSR), N_MASK);                           // test    [cpsr],N_MASK
+			UML_JMPc(block, fail_clear, skip);                                      // jmp     skip,!cond
+			break;
 
-		// select top and bottom halves of src1/src2 and sign extend if necessary
-		if (insn & 0x20)
-		{
-			src1 >>= 16;
-		}
+		case COND_VS:
+		case COND_VC:
+			UML_TEST(block, uml::mem(&GET_CPSR), V_MASK);                           // test    [cpsr],V_MASK
+			UML_JMPc(block, fail_clear, skip);                                      // jmp     skip,!cond
+			break;
 
-		src1 &= 0xffff;
-		if (src1 & 0x8000)
-		{
-			src1 |= 0xffff0000;
-		}
+		case COND_HI:
+		case COND_LS:
+			/* higher is C set and Z clear */
+			UML_AND(block, uml::I0, uml::mem(&GET_CPSR), C_MASK | Z_MASK);          // and     i0,[cpsr],C_MASK | Z_MASK
+			UML_CMP(block, uml::I0, C_MASK);                                        // cmp     i0,C_MASK
+			UML_JMPc(block, inverted ? uml::COND_E : uml::COND_NE, skip);           // jmp     skip,!cond
+			break;
 
-		if (insn & 0x40)
-		{
-			src2 >>= 16;
-		}
+		case COND_GE:
+		case COND_LT:
+			/* line N up with V and compare */
+			UML_SHR(block, uml::I0, uml::mem(&GET_CPSR), N_BIT - V_BIT);            // shr     i0,[cpsr],N_BIT - V_BIT
+			UML_XOR(block, uml::I0, uml::I0, uml::mem(&GET_CPSR));                  // xor     i0,i0,[cpsr]
+			UML_TEST(block, uml::I0, V_MASK);                                       // test    i0,V_MASK
+			UML_JMPc(block, fail_set, skip);                                        // jmp     skip,!cond
+			break;
 
-		src2 &= 0xffff;
-		if (src2 & 0x8000)
-		{
-			src2 |= 0xffff0000;
-		}
+		case COND_GT:
+		case COND_LE:
+			/* as above; nothing is shifted into Z, so it survives the xor */
+			UML_SHR(block, uml::I0, uml::mem(&GET_CPSR), N_BIT - V_BIT);            // shr     i0,[cpsr],N_BIT - V_BIT
+			UML_XOR(block, uml::I0, uml::I0, uml::mem(&GET_CPSR));                  // xor     i0,i0,[cpsr]
+			UML_TEST(block, uml::I0, V_MASK | Z_MASK);                              // test    i0,V_MASK | Z_MASK
+			UML_JMPc(block, fail_set, skip);                                        // jmp     skip,!cond
+			break;
 
-		res = src1 * src2;
-		SetRegister((insn>>16)&0xf, res);
-		R15 += 4;
+		default:
+			break;
 	}
-	else if ((insn & 0x0ff000b0) == 0x012000a0) // SMULWy - v5
+}
+
+
+/*-------------------------------------------------
+    generate_logical_flags - set N and Z from the
+    result in i0, and C as requested
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_logical_flags(drcuml_block &block, int carry)
+{
+	UML_TEST(block, uml::I0, uml::I0);                                              // test    i0,i0
+	UML_GETFLGS(block, uml::I2, uml::FLAG_Z | uml::FLAG_S);                         // getflgs i2,zs
+	UML_LOAD(block, uml::I2, s_arm_flags_add, uml::I2, uml::SIZE_DWORD, uml::SCALE_x4);
+																					// load    i2,arm_flags_add,i2,dword
+
+	switch (carry)
 	{
-		int32_t src1 = GetRegister(insn&0xf);
-		int32_t src2 = GetRegister((insn>>8)&0xf);
-		int64_t res;
+		case DRC_CARRY_KEEP:
+			UML_ROLINS(block, uml::mem(&GET_CPSR), uml::I2, 0, N_MASK | Z_MASK);    // rolins  [cpsr],i2,0,N_MASK | Z_MASK
+			return;
 
-		if (insn & 0x40)
-		{
-			src2 >>= 16;
-		}
-		else
-		{
-			src2 &= 0xffff;
-			if (src2 & 0x8000)
-			{
-				src2 |= 0xffff;
-			}
-		}
+		case DRC_CARRY_SET:
+			UML_OR(block, uml::I2, uml::I2, C_MASK);                                // or      i2,i2,C_MASK
+			break;
 
-		res = (int64_t)src1 * (int64_t)src2;
-		res >>= 16;
-		SetRegister((insn>>16)&0xf, (uint32_t)res);
+		case DRC_CARRY_I3:
+			UML_ROLINS(block, uml::I2, uml::I3, C_BIT, C_MASK);                     // rolins  i2,i3,C_BIT,C_MASK
+			break;
 	}
-	else if ((insn & 0x0ff000b0) == 0x01200080) // SMLAWy - v5
-	{
-		int32_t src1 = GetRegister(insn&0xf);
-		int32_t src2 = GetRegister((insn>>8)&0xf);
-		int32_t src3 = GetRegister((insn>>12)&0xf);
-		int64_t res;
+	UML_ROLINS(block, uml::mem(&GET_CPSR), uml::I2, 0, N_MASK | Z_MASK | C_MASK);   // rolins  [cpsr],i2,0,N_MASK | Z_MASK | C_MASK
+}
 
-		if (insn & 0x40)
-		{
-			src2 >>= 16;
-		}
-		else
-		{
-			src2 &= 0xffff;
-			if (src2 & 0x8000)
-			{
-				src2 |= 0xffff;
-			}
-		}
 
-		res = (int64_t)src1 * (int64_t)src2;
-		res >>= 16;
+/*-------------------------------------------------
+    generate_arith_flags - set NZCV from the
+    flags of the add or subtract just emitted
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_arith_flags(drcuml_block &block, bool subtract)
+{
+	UML_GETFLGS(block, uml::I2, uml::FLAG_C | uml::FLAG_V | uml::FLAG_Z | uml::FLAG_S);
+																					// getflgs i2,cvzs
+	UML_LOAD(block, uml::I2, subtract ? s_arm_flags_sub : s_arm_flags_add, uml::I2, uml::SIZE_DWORD, uml::SCALE_x4);
+																					// load    i2,arm_flags,i2,dword
+	UML_ROLINS(block, uml::mem(&GET_CPSR), uml::I2, 0, N_MASK | Z_MASK | C_MASK | V_MASK);
+																					// rolins  [cpsr],i2,0,NZCV
+}
 
-		// check for overflow and set the Q bit
-		saturate_qbit_overflow((int64_t)src3 + res);
 
-		// do the real accumulate
-		src3 += (int32_t)res;
+/*-------------------------------------------------
+    generate_shift_operand - generate code to put
+    an immediate-shifted register operand in i1;
+    the carry out goes in i3 if asked for, and
+    the return value says where it is
+-------------------------------------------------*/
 
-		// write the result back
-		SetRegister((insn>>16)&0xf, (uint32_t)res);
-	}
+int arm7_cpu_device::generate_shift_operand(drcuml_block &block, const compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool need_carry)
+{
+	uint32_t const rm = op & INSN_OP2_RM;
+	uint32_t const k = (op & INSN_OP2_SHIFT) >> INSN_OP2_SHIFT_SHIFT;
+
+	/* the PC reads 8 bytes ahead */
+	if (rm == 15)
+		UML_MOV(block, uml::I0, desc->pc + 8);                                      // mov     i0,pc + 8
 	else
-	/* Multiply OR Swap OR Half Word Data Transfer */
-	if ((insn & 0x0e000000) == 0 && (insn & 0x80) && (insn & 0x10))  // bits 27-25=000 bit 7=1 bit 4=1
+		UML_MOV(block, uml::I0, drc_reg(compiler, rm));                             // mov     i0,rm
+
+	switch ((op & INSN_OP2_SHIFT_TYPE) >> (INSN_OP2_SHIFT_TYPE_SHIFT + 1))
 	{
-		/* Half Word Data Transfer */
-		if (insn & 0x60)         // bits = 6-5 != 00
-		{
-			HandleHalfWordDT(insn);
-		}
-		else
-		/* Swap */
-		if (insn & 0x01000000)   // bit 24 = 1
-		{
-			HandleSwap(insn);
-		}
-		/* Multiply Or Multiply Long */
-		else
-		{
-			/* multiply long */
-			if (insn & 0x800000) // Bit 23 = 1 for Multiply Long
+		case 0:     /* LSL */
+			if (k == 0)
 			{
-				/* Signed? */
-				if (insn & 0x00400000)
-					HandleSMulLong(insn);
-				else
-					HandleUMulLong(insn);
+				UML_MOV(block, uml::I1, uml::I0);                                   // mov     i1,i0
+				return DRC_CARRY_KEEP;
 			}
-			/* multiply */
+			UML_SHL(block, uml::I1, uml::I0, k);                                    // shl     i1,i0,k
+			if (need_carry)
+				UML_ROLAND(block, uml::I3, uml::I0, k, 1);                          // roland  i3,i0,k,1
+			break;
+
+		case 1:     /* LSR; #0 means #32 */
+			if (k == 0)
+				UML_MOV(block, uml::I1, 0);                                         // mov     i1,0
 			else
+				UML_SHR(block, uml::I1, uml::I0, k);                                // shr     i1,i0,k
+			if (need_carry)
+				UML_ROLAND(block, uml::I3, uml::I0, (33 - k) & 31, 1);              // roland  i3,i0,33-k,1
+			break;
+
+		case 2:     /* ASR; #0 means #32 */
+			UML_SAR(block, uml::I1, uml::I0, k ? k : 31);                           // sar     i1,i0,k
+			if (need_carry)
+				UML_ROLAND(block, uml::I3, uml::I0, (33 - k) & 31, 1);              // roland  i3,i0,33-k,1
+			break;
+
+		case 3:     /* ROR; #0 means RRX */
+			if (k == 0)
 			{
-				HandleMul(insn);
+				if (need_carry)
+					UML_AND(block, uml::I3, uml::I0, 1);                            // and     i3,i0,1
+				UML_SHR(block, uml::I1, uml::I0, 1);                                // shr     i1,i0,1
+				UML_ROLAND(block, uml::I2, uml::mem(&GET_CPSR), 31 - C_BIT, 0x80000000);
+																					// roland  i2,[cpsr],31 - C_BIT,0x80000000
+				UML_OR(block, uml::I1, uml::I1, uml::I2);                           // or      i1,i1,i2
 			}
-			R15 += 4;
-		}
-	}
-	/* Data Processing OR PSR Transfer */
-	else if ((insn & 0x0c000000) == 0)   // bits 27-26 == 00 - This check can only exist properly after Multiplication check above
-	{
-		/* PSR Transfer (MRS & MSR) */
-		if (((insn & 0x00100000) == 0) && ((insn & 0x01800000) == 0x01000000)) // S bit must be clear, and bit 24,23 = 10
-		{
-			HandlePSRTransfer(insn);
-			ARM7_ICOUNT += 2;       // PSR only takes 1 - S Cycle, so we add + 2, since at end, we -3..
-			R15 += 4;
-		}
-		/* Data Processing */
-		else
-		{
-			HandleALU(insn);
-		}
+			else
+			{
+				UML_ROR(block, uml::I1, uml::I0, k);                                // ror     i1,i0,k
+				if (need_carry)
+					UML_ROLAND(block, uml::I3, uml::I0, (33 - k) & 31, 1);          // roland  i3,i0,33-k,1
+			}
+			break;
 	}
 
-	UML_LABEL(block, done);
-	return true;
-}
-
-bool arm7_cpu_device::drcarm7ops_4567(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
-{
-	return false;
-}
-
-bool arm7_cpu_device::drcarm7ops_89(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
-{
-	return false;
+	return need_carry ? DRC_CARRY_I3 : DRC_CARRY_KEEP;
 }
 
-bool arm7_cpu_device::drcarm7ops_ab(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
-{
-	return false;
-}
-
-bool arm7_cpu_device::drcarm7ops_cd(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
-{
-	return false;
-}
-
-bool arm7_cpu_device::drcarm7ops_e(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
-{
-	return false;
-}
-
-bool arm7_cpu_device::drcarm7ops_f(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
-{
-	return false;
-}
 
 /*-------------------------------------------------
-    generate_opcode - generate code for a specific
-    opcode
+    generate_arm_alu - generate code for a data
+    processing instruction with an immediate or
+    immediate-shifted operand
 -------------------------------------------------*/
 
-bool arm7_cpu_device::generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+void arm7_cpu_device::generate_arm_alu(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
 {
-	//int in_delay_slot = ((desc->flags & OPFLAG_IN_DELAY_SLOT) != 0);
-	uint32_t op = desc->opptr.l[0];
-	uint8_t opswitch = op >> 26;
-	uml::code_label skip;
-	uml::code_label contdecode;
-	uml::code_label unexecuted;
-
-	if (T_IS_SET(GET_CPSR))
+	uint32_t const opcode = (op & INSN_OPCODE) >> INSN_OPCODE_SHIFT;
+	uint32_t const rn = (op & INSN_RN) >> INSN_RN_SHIFT;
+	uint32_t const rd = (op & INSN_RD) >> INSN_RD_SHIFT;
+	bool const setflags = (op & INSN_S) != 0;
+	int carry = DRC_CARRY_KEEP;
+
+	/* the second operand goes in i1 */
+	if (op & INSN_I)
 	{
-		// "In Thumb state, bit [0] is undefined and must be ignored. Bits [31:1] contain the PC."
-		UML_AND(block, uml::I0, DRC_PC, ~1);
+		uint32_t const by = (op & INSN_OP2_ROTATE) >> INSN_OP2_ROTATE_SHIFT;
+		uint32_t const imm = by ? ROR(op & INSN_OP2_IMM, by << 1) : (op & INSN_OP2_IMM);
+		if (by)
+			carry = (imm & SIGN_BIT) ? DRC_CARRY_SET : DRC_CARRY_CLEAR;
+		UML_MOV(block, uml::I1, imm);                                               // mov     i1,imm
 	}
 	else
-	{
-		UML_AND(block, uml::I0, DRC_PC, ~3);
-	}
-
-	UML_TEST(block, uml::mem(&COPRO_CTRL), COPRO_CTRL_MMU_EN);                       // test     COPRO_CTRL, COPRO_CTRL_MMU_EN
-	UML_MOVc(block, uml::COND_NZ, uml::I2, ARM7_TLB_ABORT_P | ARM7_TLB_READ);             // movnz    i0, ARM7_TLB_ABORT_P | ARM7_TLB_READ
-	UML_CALLHc(block, uml::COND_NZ, *m_impstate.tlb_translate);                  // callhnz  tlb_translate);
+		carry = generate_shift_operand(block, compiler, desc, op, setflags);
 
-	if (T_IS_SET(GET_CPSR))
+	/* the first operand goes in i2; MOV and MVN have none and the PC reads 8 bytes ahead */
+	if ((opcode & 0xd) != 0xd)
 	{
-		//UML_CALLH(block, *m_impstate.drcthumb[(op & 0xffc0) >> 6]);          // callh    drcthumb[op] // TODO FIXME
-		return true;
+		if (rn == 15)
+			UML_MOV(block, uml::I2, desc->pc + 8);                                  // mov     i2,pc + 8
+		else
+			UML_MOV(block, uml::I2, drc_reg(compiler, rn));                         // mov     i2,rn
 	}
 
-	switch (op >> INSN_COND_SHIFT)
+	switch (opcode)
 	{
-		case COND_EQ:
-			UML_TEST(block, DRC_CPSR, Z_MASK);
-			UML_JMPc(block, uml::COND_Z, unexecuted = compiler.labelnum++);
-			break;
-		case COND_NE:
-			UML_TEST(block, DRC_CPSR, Z_MASK);
-			UML_JMPc(block, uml::COND_NZ, unexecuted = compiler.labelnum++);
-			break;
-		case COND_CS:
-			UML_TEST(block, DRC_CPSR, C_MASK);
-			UML_JMPc(block, uml::COND_Z, unexecuted = compiler.labelnum++);
-			break;
-		case COND_CC:
-			UML_TEST(block, DRC_CPSR, C_MASK);
-			UML_JMPc(block, uml::COND_NZ, unexecuted = compiler.labelnum++);
-			break;
-		case COND_MI:
-			UML_TEST(block, DRC_CPSR, N_MASK);
-			UML_JMPc(block, uml::COND_Z, unexecuted = compiler.labelnum++);
+		case OPCODE_AND:
+		case OPCODE_TST:
+			UML_AND(block, uml::I0, uml::I2, uml::I1);                              // and     i0,i2,i1
 			break;
-		case COND_PL:
-			UML_TEST(block, DRC_CPSR, N_MASK);
-			UML_JMPc(block, uml::COND_NZ, unexecuted = compiler.labelnum++);
+
+		case OPCODE_EOR:
+		case OPCODE_TEQ:
+			UML_XOR(block, uml::I0, uml::I2, uml::I1);                              // xor     i0,i2,i1
 			break;
-		case COND_VS:
-			UML_TEST(block, DRC_CPSR, V_MASK);
-			UML_JMPc(block, uml::COND_Z, unexecuted = compiler.labelnum++);
+
+		case OPCODE_SUB:
+		case OPCODE_CMP:
+			UML_SUB(block, uml::I0, uml::I2, uml::I1);                              // sub     i0,i2,i1
+			if (setflags)
+				generate_arith_flags(block, true);
 			break;
-		case COND_VC:
-			UML_TEST(block, DRC_CPSR, V_MASK);
-			UML_JMPc(block, uml::COND_NZ, unexecuted = compiler.labelnum++);
+
+		case OPCODE_RSB:
+			UML_SUB(block, uml::I0, uml::I1, uml::I2);                              // sub     i0,i1,i2
+			if (setflags)
+				generate_arith_flags(block, true);
 			break;
-		case COND_HI:
-			UML_TEST(block, DRC_CPSR, Z_MASK);
-			UML_JMPc(block, uml::COND_NZ, unexecuted = compiler.labelnum++);
-			UML_TEST(block, DRC_CPSR, C_MASK);
-			UML_JMPc(block, uml::COND_Z, unexecuted = compiler.labelnum++);
+
+		case OPCODE_ADD:
+		case OPCODE_CMN:
+			UML_ADD(block, uml::I0, uml::I2, uml::I1);                              // add     i0,i2,i1
+			if (setflags)
+				generate_arith_flags(block, false);
 			break;
-		case COND_LS:
-			UML_TEST(block, DRC_CPSR, Z_MASK);
-			UML_JMPc(block, uml::COND_NZ, contdecode = compiler.labelnum++);
-			UML_TEST(block, DRC_CPSR, C_MASK);
-			UML_JMPc(block, uml::COND_Z, contdecode);
-			UML_JMP(block, unexecuted);
+
+		case OPCODE_ADC:
+			UML_CARRY(block, uml::mem(&GET_CPSR), C_BIT);                           // carry   [cpsr],C_BIT
+			UML_ADDC(block, uml::I0, uml::I2, uml::I1);                             // addc    i0,i2,i1
+			if (setflags)
+				generate_arith_flags(block, false);
 			break;
-		case COND_GE:
-			UML_TEST(block, DRC_CPSR, N_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I0, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I0, 1);
-			UML_TEST(block, DRC_CPSR, V_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I1, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I1, 1);
-			UML_CMP(block, uml::I0, uml::I1);
-			UML_JMPc(block, uml::COND_NE, unexecuted);
+
+		case OPCODE_SBC:
+		case OPCODE_RSC:
+			/* the UML borrow is the inverse of the ARM carry */
+			UML_XOR(block, uml::I3, uml::mem(&GET_CPSR), C_MASK);                   // xor     i3,[cpsr],C_MASK
+			UML_CARRY(block, uml::I3, C_BIT);                                       // carry   i3,C_BIT
+			if (opcode == OPCODE_SBC)
+				UML_SUBB(block, uml::I0, uml::I2, uml::I1);                         // subb    i0,i2,i1
+			else
+				UML_SUBB(block, uml::I0, uml::I1, uml::I2);                         // subb    i0,i1,i2
+			if (setflags)
+				generate_arith_flags(block, true);
 			break;
-		case COND_LT:
-			UML_TEST(block, DRC_CPSR, N_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I0, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I0, 1);
-			UML_TEST(block, DRC_CPSR, V_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I1, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I1, 1);
-			UML_CMP(block, uml::I0, uml::I1);
-			UML_JMPc(block, uml::COND_E, unexecuted);
+
+		case OPCODE_ORR:
+			UML_OR(block, uml::I0, uml::I2, uml::I1);                               // or      i0,i2,i1
 			break;
-		case COND_GT:
-			UML_TEST(block, DRC_CPSR, Z_MASK);
-			UML_JMPc(block, uml::COND_NZ, unexecuted);
-			UML_TEST(block, DRC_CPSR, N_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I0, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I0, 1);
-			UML_TEST(block, DRC_CPSR, V_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I1, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I1, 1);
-			UML_CMP(block, uml::I0, uml::I1);
-			UML_JMPc(block, uml::COND_NE, unexecuted);
+
+		case OPCODE_MOV:
+			UML_MOV(block, uml::I0, uml::I1);                                       // mov     i0,i1
 			break;
-		case COND_LE:
-			UML_TEST(block, DRC_CPSR, N_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I0, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I0, 1);
-			UML_TEST(block, DRC_CPSR, V_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I1, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I1, 1);
-			UML_CMP(block, uml::I0, uml::I1);
-			UML_JMPc(block, uml::COND_NE, contdecode);
-			UML_TEST(block, DRC_CPSR, Z_MASK);
-			UML_JMPc(block, uml::COND_Z, unexecuted);
+
+		case OPCODE_BIC:
+			UML_XOR(block, uml::I1, uml::I1, 0xffffffff);                           // xor     i1,i1,~0
+			UML_AND(block, uml::I0, uml::I2, uml::I1);                              // and     i0,i2,i1
 			break;
-		case COND_NV:
-			UML_JMP(block, unexecuted);
+
+		case OPCODE_MVN:
+			UML_XOR(block, uml::I0, uml::I1, 0xffffffff);                           // xor     i0,i1,~0
 			break;
 	}
 
-	UML_LABEL(block, contdecode);
+	/* logical operations set N and Z from the result and C from the shifter */
+	if (setflags && ((opcode & 0x6) == 0 || (opcode & 0xc) == 0xc))
+		generate_logical_flags(block, carry);
+
+	/* the test opcodes don't write a result */
+	if ((opcode & 0xc) != 0x8)
+		UML_MOV(block, drc_reg(compiler, rd), uml::I0);                             // mov     rd,i0
+}
 
-	(this->*drcops_handler[(op & 0xF000000) >> 24])(block, compiler, desc, op);
 
-	UML_LABEL(block, unexecuted);
-	UML_ADD(block, DRC_PC, DRC_PC, 4);
-	UML_ADD(block, MAPVAR_CYCLES, MAPVAR_CYCLES, 2);                                // add      cycles, cycles, 2
+/*-------------------------------------------------
+    generate_arm_mem_single - generate code for
+    LDR/STR/LDRB/STRB
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_arm_mem_single(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
+{
+	uint32_t const rn = (op & INSN_RN) >> INSN_RN_SHIFT;
+	uint32_t const rd = (op & INSN_RD) >> INSN_RD_SHIFT;
+	bool const byte = (op & INSN_SDT_B) != 0;
 
-	UML_LABEL(block, skip);
+	/* the offset goes in i1 */
+	if (op & INSN_I)
+		generate_shift_operand(block, compiler, desc, op, false);
+	else
+		UML_MOV(block, uml::I1, op & INSN_SDT_IMM);                                 // mov     i1,offset
 
-	switch (opswitch)
+	/* the frontend keeps writeback away from the PC, which reads 8 bytes ahead */
+	uml::parameter const base = (rn == 15) ? uml::parameter(desc->pc + 8) : drc_reg(compiler, rn);
+	if (op & INSN_SDT_P)
+	{
+		if (op & INSN_SDT_U)
+			UML_ADD(block, uml::I0, base, uml::I1);                                 // add     i0,rn,i1
+		else
+			UML_SUB(block, uml::I0, base, uml::I1);                                 // sub     i0,rn,i1
+		if (op & INSN_SDT_W)
+			UML_MOV(block, drc_reg(compiler, rn), uml::I0);                         // mov     rn,i0
+	}
+	else
 	{
-		/* ----- sub-groups ----- */
+		/* post-indexing always writes back; keep the new base in i4 across the access */
+		UML_MOV(block, uml::I0, base);                                              // mov     i0,rn
+		if (op & INSN_SDT_U)
+			UML_ADD(block, uml::I4, uml::I0, uml::I1);                              // add     i4,i0,i1
+		else
+			UML_SUB(block, uml::I4, uml::I0, uml::I1);                              // sub     i4,i0,i1
+	}
 
-		case 0x00:  /* SPECIAL - MIPS I */
-			return true;
+	if (m_impstate.drcoptions & ARM7DRC_FLUSH_PC)
+		UML_MOV(block, uml::mem(&R15), desc->pc);                                   // mov     [pc],desc->pc
 
-		// TODO: FINISH ME
+	if (op & INSN_SDT_L)
+	{
+		UML_CALLH(block, byte ? *m_impstate.read8 : *m_impstate.read32);           // callh   read
+		UML_MOV(block, drc_reg(compiler, rd), uml::I0);                             // mov     rd,i0
+	}
+	else
+	{
+		/* a stored PC reads 12 bytes ahead */
+		if (rd == 15)
+			UML_MOV(block, uml::I1, desc->pc + 12);                                 // mov     i1,pc + 12
+		else
+			UML_MOV(block, uml::I1, drc_reg(compiler, rd));                         // mov     i1,rd
+		UML_CALLH(block, byte ? *m_impstate.write8 : *m_impstate.write32);         // callh   write
 	}
 
-	return false;
+	/* the interpreter drops post-indexed writeback when the base is also transferred */
+	if (!(op & INSN_SDT_P) && rd != rn)
+		UML_MOV(block, drc_reg(compiler, rn), uml::I4);                             // mov     rn,i4
+}
+
+
+/*-------------------------------------------------
+    generate_arm_opcode - generate code for an
+    ARM instruction the frontend left native
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_arm_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	uint32_t const op = desc->opptr.l[0];
+
+	switch ((op >> 25) & 7)
+	{
+		case 0:
+		case 1:
+			generate_arm_alu(block, compiler, desc, op);
+			break;
+
+		case 2:
+		case 3:
+			generate_arm_mem_single(block, compiler, desc, op);
+			break;
+
+		case 5:
+			if (op & INSN_BL)
+				UML_MOV(block, drc_reg(compiler, 14), desc->pc + 4);                // mov     lr,pc + 4
+			generate_branch(block, compiler, desc->targetpc);
+			break;
+
+		default:
+			/* everything else carries ARM7_UF_INTERPRET */
+			break;
+	}
 }
@@ -63,6 +63,11 @@ u32 cosmac_disassembler::opcode_alignment() const
 	return 1;
 }
 
+u64 cosmac_disassembler::decode_mode() const
+{
+	return m_config ? ((u64(m_config->get_p()) << 8) | m_config->get_x()) : 0;
+}
+
 cosmac_disassembler::cosmac_disassembler(int variant, cosmac_disassembler::config *conf) : m_variant(variant), m_config(conf)
 {
 }
@@ -0,0 +1,4190 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    drcbearm64.cpp
+
+    64-bit ARM (AArch64) back-end for the universal machine language.
+
+****************************************************************************
+
+    Future improvements/changes:
+
+    * Keep the UML carry flag in the host sense where no consumer needs
+        it inverted, to avoid the NZCV round trips after ADD/ADDC
+
+    * Use the bundled assembler instead of the local encoder once it
+        supports AArch64
+
+    * Optimize to avoid unnecessary reloads
+
+****************************************************************************
+
+    ----------------------
+    ABI/conventions (AAPCS64)
+    ----------------------
+
+    Registers:
+        X0-X7      - volatile, integer function parameters 1-8, X0 is the
+                     function return value
+        X8         - volatile, indirect result location
+        X9-X15     - volatile
+        X16-X17    - volatile, intra-procedure-call scratch
+        X18        - platform register, must not be touched
+        X19-X28    - non-volatile
+        X29        - frame pointer
+        X30        - link register
+        SP         - stack pointer, must remain 16-byte aligned
+
+        D0-D7      - volatile, FP function parameters 1-8
+        D8-D15     - non-volatile (low 64 bits only)
+        D16-D31    - volatile
+
+
+    ---------------
+    Execution model
+    ---------------
+
+    Registers:
+        X0-X3      - function parameters and scratch
+        X9-X15     - temporary registers
+        X16        - scratch register for addresses
+        X17        - scratch register for immediates and flags
+        X19-X27    - map to I0-I8
+        X28        - pointer to the near cache
+        X29        - frame pointer
+        X30        - link register
+
+        D0-D2      - temporary registers
+        D8-D15     - map to F0-F7
+
+    Flags:
+        UML S, Z and V live in the host N, Z and V flags.  UML U is
+        only ever produced by FCMP, where an unordered result sets the
+        host V flag, so V|U maps to V.  The host C flag is the inverse
+        of the UML carry, which is what SUBS/SBCS and FCMP produce
+        natively; ADD and ADDC invert it on the way in and out.
+
+    Entry point:
+        Assumes 2 parameters passed: the near cache base and the codeptr
+        of the code to execute once the environment is set up.
+
+    Exit point:
+        Assumes exit value is in W0.
+
+    Runtime stack:
+        [sp]       - saved x29
+        [sp+8]     - saved x30
+        [sp+16]    - saved x19-x28
+        [sp+96]    - saved d8-d15
+        [sp+160]   - caller's frame
+
+    Every handle pushes X30 on entry, so [stacksave-16] holds the
+    return address of the outermost handle call.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "drcbearm64.h"
+
+#include "debugger.h"
+#include "emuopts.h"
+
+#include <cstddef>
+
+
+namespace drc {
+
+using namespace uml;
+
+using namespace arm64;
+
+
+
+//**************************************************************************
+//  DEBUGGING
+//**************************************************************************
+
+#define LOG_HASHJMPS            (0)
+
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+const uint32_t PTYPE_M    = 1 << parameter::PTYPE_MEMORY;
+const uint32_t PTYPE_I    = 1 << parameter::PTYPE_IMMEDIATE;
+const uint32_t PTYPE_R    = 1 << parameter::PTYPE_INT_REGISTER;
+const uint32_t PTYPE_F    = 1 << parameter::PTYPE_FLOAT_REGISTER;
+//const uint32_t PTYPE_MI   = PTYPE_M | PTYPE_I;
+//const uint32_t PTYPE_RI   = PTYPE_R | PTYPE_I;
+const uint32_t PTYPE_MR   = PTYPE_M | PTYPE_R;
+const uint32_t PTYPE_MRI  = PTYPE_M | PTYPE_R | PTYPE_I;
+const uint32_t PTYPE_MF   = PTYPE_M | PTYPE_F;
+
+// fixed register assignments
+const greg REG_PARAM1     = greg{ 0, true };
+const greg REG_PARAM2     = greg{ 1, true };
+const greg REG_PARAM3     = greg{ 2, true };
+const greg REG_PARAM4     = greg{ 3, true };
+
+const greg TEMP_REG1      = greg{ 9, true };
+const greg TEMP_REG2      = greg{ 10, true };
+const greg TEMP_REG3      = greg{ 11, true };
+const greg TEMP_REG4      = greg{ 12, true };
+const greg TEMP_REG5      = greg{ 13, true };
+const greg TEMP_REG6      = greg{ 14, true };
+const greg TEMP_REG7      = greg{ 15, true };
+
+const greg SCRATCH_REG1   = greg{ 16, true };
+const greg SCRATCH_REG2   = greg{ 17, true };
+
+const greg BASE_REG       = greg{ 28, true };
+const greg FP_REG         = greg{ 29, true };
+const greg LR_REG         = greg{ 30, true };
+const greg ZR_REG         = greg{ 31, true };
+const greg SP_REG         = greg{ 31, true };
+
+const vreg FTEMP_REG1     = vreg{ 0, true };
+const vreg FTEMP_REG2     = vreg{ 1, true };
+const vreg FTEMP_REG3     = vreg{ 2, true };
+
+// host condition codes
+enum arm64_condition : uint8_t
+{
+	ARM_EQ = 0, ARM_NE, ARM_CS, ARM_CC, ARM_MI, ARM_PL, ARM_VS, ARM_VC,
+	ARM_HI, ARM_LS, ARM_GE, ARM_LT, ARM_GT, ARM_LE, ARM_AL
+};
+
+// shifted register operand types
+enum arm64_shift : uint8_t
+{
+	SHIFT_LSL = 0, SHIFT_LSR, SHIFT_ASR, SHIFT_ROR
+};
+
+// extended register operand types
+enum arm64_extend : uint8_t
+{
+	EXTEND_UXTB = 0, EXTEND_UXTH, EXTEND_UXTW, EXTEND_UXTX,
+	EXTEND_SXTB, EXTEND_SXTH, EXTEND_SXTW, EXTEND_SXTX
+};
+
+// logical (shifted register) opcodes; the immediate forms are derived from these
+const uint32_t LOGIC_AND  = 0x0a000000;
+const uint32_t LOGIC_BIC  = 0x0a200000;
+const uint32_t LOGIC_ORR  = 0x2a000000;
+const uint32_t LOGIC_ORN  = 0x2a200000;
+const uint32_t LOGIC_EOR  = 0x4a000000;
+const uint32_t LOGIC_ANDS = 0x6a000000;
+
+// load/store opcodes (unsigned offset form); bits 31:30 give the access size
+const uint32_t LDST_STRB   = 0x39000000;
+const uint32_t LDST_LDRB   = 0x39400000;
+const uint32_t LDST_LDRSBX = 0x39800000;
+const uint32_t LDST_LDRSBW = 0x39c00000;
+const uint32_t LDST_STRH   = 0x79000000;
+const uint32_t LDST_LDRH   = 0x79400000;
+const uint32_t LDST_LDRSHX = 0x79800000;
+const uint32_t LDST_LDRSHW = 0x79c00000;
+const uint32_t LDST_STRW   = 0xb9000000;
+const uint32_t LDST_LDRW   = 0xb9400000;
+const uint32_t LDST_LDRSW  = 0xb9800000;
+const uint32_t LDST_STRX   = 0xf9000000;
+const uint32_t LDST_LDRX   = 0xf9400000;
+const uint32_t LDST_STRS   = 0xbd000000;
+const uint32_t LDST_LDRS   = 0xbd400000;
+const uint32_t LDST_STRD   = 0xfd000000;
+const uint32_t LDST_LDRD   = 0xfd400000;
+const uint32_t LDST_STRQ   = 0x3d800000;
+const uint32_t LDST_LDRQ   = 0x3dc00000;
+
+// load/store pair opcodes (signed offset form)
+const uint32_t LDSTP_STPX  = 0xa9000000;
+const uint32_t LDSTP_LDPX  = 0xa9400000;
+const uint32_t LDSTP_STPD  = 0x6d000000;
+const uint32_t LDSTP_LDPD  = 0x6d400000;
+
+// vector three-register opcodes on 16 bytes or eight halfwords
+const uint32_t VEC_AND     = 0x4e201c00;
+const uint32_t VEC_ORR     = 0x4ea01c00;
+const uint32_t VEC_EOR     = 0x6e201c00;
+const uint32_t VEC_ADD_8H  = 0x4e608400;
+const uint32_t VEC_SUB_8H  = 0x6e608400;
+const uint32_t VEC_SQADD_8H = 0x4e600c00;
+const uint32_t VEC_SQSUB_8H = 0x4e602c00;
+
+// floating point to integer conversions
+const uint32_t FCVT_NS     = 0x1e200000;    // round to nearest, ties to even
+const uint32_t FCVT_PS     = 0x1e280000;    // round towards plus infinity
+const uint32_t FCVT_MS     = 0x1e300000;    // round towards minus infinity
+const uint32_t FCVT_ZS     = 0x1e380000;    // round towards zero
+
+// NZCV bits
+const uint32_t NZCV_N      = 0x80000000;
+const uint32_t NZCV_Z      = 0x40000000;
+const uint32_t NZCV_C      = 0x20000000;
+const uint32_t NZCV_V      = 0x10000000;
+
+
+
+//**************************************************************************
+//  MACROS
+//**************************************************************************
+
+#define ARM_CONDITION(condition)        (condition_map[condition - uml::COND_Z])
+#define ARM_NOT_CONDITION(condition)    arm64_condition(condition_map[condition - uml::COND_Z] ^ 1)
+
+#define assert_no_condition(inst)       assert((inst).condition() == uml::COND_ALWAYS)
+#define assert_any_condition(inst)      assert((inst).condition() == uml::COND_ALWAYS || ((inst).condition() >= uml::COND_Z && (inst).condition() < uml::COND_MAX))
+#define assert_no_flags(inst)           assert((inst).flags() == 0)
+#define assert_flags(inst, valid)       assert(((inst).flags() & ~(valid)) == 0)
+
+
+
+//**************************************************************************
+//  GLOBAL VARIABLES
+//**************************************************************************
+
+drcbe_arm64::opcode_generate_func drcbe_arm64::s_opcode_table[OP_MAX];
+
+// register mapping tables
+static const uint8_t int_register_map[REG_I_COUNT] =
+{
+	19, 20, 21, 22, 23, 24, 25, 26, 27
+};
+
+static const uint8_t float_register_map[REG_F_COUNT] =
+{
+	8, 9, 10, 11, 12, 13, 14, 15
+};
+
+// condition mapping table; remember that the host carry is the inverse of the UML carry
+static const arm64_condition condition_map[uml::COND_MAX - uml::COND_Z] =
+{
+	ARM_EQ,     // COND_Z = 0x80,    requires Z
+	ARM_NE,     // COND_NZ,          requires Z
+	ARM_MI,     // COND_S,           requires S
+	ARM_PL,     // COND_NS,          requires S
+	ARM_CC,     // COND_C,           requires C
+	ARM_CS,     // COND_NC,          requires C
+	ARM_VS,     // COND_V,           requires V
+	ARM_VC,     // COND_NV,          requires V
+	ARM_VS,     // COND_U,           requires U
+	ARM_VC,     // COND_NU,          requires U
+	ARM_HI,     // COND_A,           requires CZ
+	ARM_LS,     // COND_BE,          requires CZ
+	ARM_GT,     // COND_G,           requires SVZ
+	ARM_LE,     // COND_LE,          requires SVZ
+	ARM_LT,     // COND_L,           requires SV
+	ARM_GE,     // COND_GE,          requires SV
+};
+
+// load and store opcodes by operand size
+static const uint32_t load_op[4] = { LDST_LDRB, LDST_LDRH, LDST_LDRW, LDST_LDRX };
+static const uint32_t store_op[4] = { LDST_STRB, LDST_STRH, LDST_STRW, LDST_STRX };
+
+
+
+//**************************************************************************
+//  TABLES
+//**************************************************************************
+
+const drcbe_arm64::opcode_table_entry drcbe_arm64::s_opcode_table_source[] =
+{
+	// Compile-time opcodes
+	{ uml::OP_HANDLE,  &drcbe_arm64::op_handle },     // HANDLE  handle
+	{ uml::OP_HASH,    &drcbe_arm64::op_hash },       // HASH    mode,pc
+	{ uml::OP_LABEL,   &drcbe_arm64::op_label },      // LABEL   imm
+	{ uml::OP_COMMENT, &drcbe_arm64::op_comment },    // COMMENT string
+	{ uml::OP_MAPVAR,  &drcbe_arm64::op_mapvar },     // MAPVAR  mapvar,value
+
+	// Control Flow Operations
+	{ uml::OP_NOP,     &drcbe_arm64::op_nop },        // NOP
+	{ uml::OP_DEBUG,   &drcbe_arm64::op_debug },      // DEBUG   pc
+	{ uml::OP_EXIT,    &drcbe_arm64::op_exit },       // EXIT    src1[,c]
+	{ uml::OP_HASHJMP, &drcbe_arm64::op_hashjmp },    // HASHJMP mode,pc,handle
+	{ uml::OP_JMP,     &drcbe_arm64::op_jmp },        // JMP     imm[,c]
+	{ uml::OP_EXH,     &drcbe_arm64::op_exh },        // EXH     handle,param[,c]
+	{ uml::OP_CALLH,   &drcbe_arm64::op_callh },      // CALLH   handle[,c]
+	{ uml::OP_RET,     &drcbe_arm64::op_ret },        // RET     [c]
+	{ uml::OP_CALLC,   &drcbe_arm64::op_callc },      // CALLC   func,ptr[,c]
+	{ uml::OP_RECOVER, &drcbe_arm64::op_recover },    // RECOVER dst,mapvar
+
+	// Internal Register Operations
+	{ uml::OP_SETFMOD, &drcbe_arm64::op_setfmod },    // SETFMOD src
+	{ uml::OP_GETFMOD, &drcbe_arm64::op_getfmod },    // GETFMOD dst
+	{ uml::OP_GETEXP,  &drcbe_arm64::op_getexp },     // GETEXP  dst
+	{ uml::OP_GETFLGS, &drcbe_arm64::op_getflgs },    // GETFLGS dst[,f]
+	{ uml::OP_SAVE,    &drcbe_arm64::op_save },       // SAVE    dst
+	{ uml::OP_RESTORE, &drcbe_arm64::op_restore },    // RESTORE dst
+
+	// Integer Operations
+	{ uml::OP_LOAD,    &drcbe_arm64::op_load },       // LOAD    dst,base,index,size
+	{ uml::OP_LOADS,   &drcbe_arm64::op_loads },      // LOADS   dst,base,index,size
+	{ uml::OP_STORE,   &drcbe_arm64::op_store },      // STORE   base,index,src,size
+	{ uml::OP_READ,    &drcbe_arm64::op_read },       // READ    dst,src1,spacesize
+	{ uml::OP_READM,   &drcbe_arm64::op_readm },      // READM   dst,src1,mask,spacesize
+	{ uml::OP_WRITE,   &drcbe_arm64::op_write },      // WRITE   dst,src1,spacesize
+	{ uml::OP_WRITEM,  &drcbe_arm64::op_writem },     // WRITEM  dst,src1,spacesize
+	{ uml::OP_CARRY,   &drcbe_arm64::op_carry },      // CARRY   src,bitnum
+	{ uml::OP_SET,     &drcbe_arm64::op_set },        // SET     dst,c
+	{ uml::OP_MOV,     &drcbe_arm64::op_mov },        // MOV     dst,src[,c]
+	{ uml::OP_SEXT,    &drcbe_arm64::op_sext },       // SEXT    dst,src
+	{ uml::OP_ROLAND,  &drcbe_arm64::op_roland },     // ROLAND  dst,src1,src2,src3
+	{ uml::OP_ROLINS,  &drcbe_arm64::op_rolins },     // ROLINS  dst,src1,src2,src3
+	{ uml::OP_ADD,     &drcbe_arm64::op_add },        // ADD     dst,src1,src2[,f]
+	{ uml::OP_ADDC,    &drcbe_arm64::op_addc },       // ADDC    dst,src1,src2[,f]
+	{ uml::OP_SUB,     &drcbe_arm64::op_sub },        // SUB     dst,src1,src2[,f]
+	{ uml::OP_SUBB,    &drcbe_arm64::op_subc },       // SUBB    dst,src1,src2[,f]
+	{ uml::OP_CMP,     &drcbe_arm64::op_cmp },        // CMP     src1,src2[,f]
+	{ uml::OP_MULU,    &drcbe_arm64::op_mulu },       // MULU    dst,edst,src1,src2[,f]
+	{ uml::OP_MULS,    &drcbe_arm64::op_muls },       // MULS    dst,edst,src1,src2[,f]
+	{ uml::OP_DIVU,    &drcbe_arm64::op_divu },       // DIVU    dst,edst,src1,src2[,f]
+	{ uml::OP_DIVS,    &drcbe_arm64::op_divs },       // DIVS    dst,edst,src1,src2[,f]
+	{ uml::OP_AND,     &drcbe_arm64::op_and },        // AND     dst,src1,src2[,f]
+	{ uml::OP_TEST,    &drcbe_arm64::op_test },       // TEST    src1,src2[,f]
+	{ uml::OP_OR,      &drcbe_arm64::op_or },         // OR      dst,src1,src2[,f]
+	{ uml::OP_XOR,     &drcbe_arm64::op_xor },        // XOR     dst,src1,src2[,f]
+	{ uml::OP_LZCNT,   &drcbe_arm64::op_lzcnt },      // LZCNT   dst,src[,f]
+	{ uml::OP_TZCNT,   &drcbe_arm64::op_tzcnt },      // TZCNT   dst,src[,f]
+	{ uml::OP_BSWAP,   &drcbe_arm64::op_bswap },      // BSWAP   dst,src
+	{ uml::OP_SHL,     &drcbe_arm64::op_shift<uml::OP_SHL> },       // SHL     dst,src,count[,f]
+	{ uml::OP_SHR,     &drcbe_arm64::op_shift<uml::OP_SHR> },       // SHR     dst,src,count[,f]
+	{ uml::OP_SAR,     &drcbe_arm64::op_shift<uml::OP_SAR> },       // SAR     dst,src,count[,f]
+	{ uml::OP_ROL,     &drcbe_arm64::op_shift<uml::OP_ROL> },       // ROL     dst,src,count[,f]
+	{ uml::OP_ROLC,    &drcbe_arm64::op_rotc<uml::OP_ROLC> },       // ROLC    dst,src,count[,f]
+	{ uml::OP_ROR,     &drcbe_arm64::op_shift<uml::OP_ROR> },       // ROR     dst,src,count[,f]
+	{ uml::OP_RORC,    &drcbe_arm64::op_rotc<uml::OP_RORC> },       // RORC    dst,src,count[,f]
+
+	// Floating Point Operations
+	{ uml::OP_FLOAD,   &drcbe_arm64::op_fload },      // FLOAD   dst,base,index
+	{ uml::OP_FSTORE,  &drcbe_arm64::op_fstore },     // FSTORE  base,index,src
+	{ uml::OP_FREAD,   &drcbe_arm64::op_fread },      // FREAD   dst,space,src1
+	{ uml::OP_FWRITE,  &drcbe_arm64::op_fwrite },     // FWRITE  space,dst,src1
+	{ uml::OP_FMOV,    &drcbe_arm64::op_fmov },       // FMOV    dst,src1[,c]
+	{ uml::OP_FTOINT,  &drcbe_arm64::op_ftoint },     // FTOINT  dst,src1,size,round
+	{ uml::OP_FFRINT,  &drcbe_arm64::op_ffrint },     // FFRINT  dst,src1,size
+	{ uml::OP_FFRFLT,  &drcbe_arm64::op_ffrflt },     // FFRFLT  dst,src1,size
+	{ uml::OP_FRNDS,   &drcbe_arm64::op_frnds },      // FRNDS   dst,src1
+	{ uml::OP_FADD,    &drcbe_arm64::op_float_alu<uml::OP_FADD> },  // FADD    dst,src1,src2
+	{ uml::OP_FSUB,    &drcbe_arm64::op_float_alu<uml::OP_FSUB> },  // FSUB    dst,src1,src2
+	{ uml::OP_FCMP,    &drcbe_arm64::op_fcmp },       // FCMP    src1,src2
+	{ uml::OP_FMUL,    &drcbe_arm64::op_float_alu<uml::OP_FMUL> },  // FMUL    dst,src1,src2
+	{ uml::OP_FDIV,    &drcbe_arm64::op_float_alu<uml::OP_FDIV> },  // FDIV    dst,src1,src2
+	{ uml::OP_FNEG,    &drcbe_arm64::op_float_unary<uml::OP_FNEG> },    // FNEG    dst,src1
+	{ uml::OP_FABS,    &drcbe_arm64::op_float_unary<uml::OP_FABS> },    // FABS    dst,src1
+	{ uml::OP_FSQRT,   &drcbe_arm64::op_float_unary<uml::OP_FSQRT> },   // FSQRT   dst,src1
+	{ uml::OP_FRECIP,  &drcbe_arm64::op_float_unary<uml::OP_FRECIP> },  // FRECIP  dst,src1
+	{ uml::OP_FRSQRT,  &drcbe_arm64::op_float_unary<uml::OP_FRSQRT> },  // FRSQRT  dst,src1
+	{ uml::OP_FCOPYI,  &drcbe_arm64::op_fcopyi },     // FCOPYI  dst,src
+	{ uml::OP_ICOPYF,  &drcbe_arm64::op_icopyf },     // ICOPYF  dst,src
+
+	// Vector Operations
+	{ uml::OP_VMOV,    &drcbe_arm64::op_vmov },       // VMOV    dst,src
+	{ uml::OP_VSHUF,   &drcbe_arm64::op_vshuf },      // VSHUF   dst,src,lanes
+	{ uml::OP_VAND,    &drcbe_arm64::op_valu<uml::OP_VAND> },   // VAND    dst,src1,src2
+	{ uml::OP_VOR,     &drcbe_arm64::op_valu<uml::OP_VOR> },    // VOR     dst,src1,src2
+	{ uml::OP_VXOR,    &drcbe_arm64::op_valu<uml::OP_VXOR> },   // VXOR    dst,src1,src2
+	{ uml::OP_VADD,    &drcbe_arm64::op_valu<uml::OP_VADD> },   // VADD    dst,src1,src2
+	{ uml::OP_VSUB,    &drcbe_arm64::op_valu<uml::OP_VSUB> },   // VSUB    dst,src1,src2
+	{ uml::OP_VADDS,   &drcbe_arm64::op_valu<uml::OP_VADDS> },  // VADDS   dst,src1,src2
+	{ uml::OP_VSUBS,   &drcbe_arm64::op_valu<uml::OP_VSUBS> }   // VSUBS   dst,src1,src2
+};
+
+
+
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  encode_logical_immediate - encode a value as
+//  the N:immr:imms field of a logical immediate
+//  instruction, returning false if it can't be
+//-------------------------------------------------
+
+static bool encode_logical_immediate(uint64_t value, bool wide, uint32_t &encoded)
+{
+	// replicate 32-bit values so both widths can be handled alike
+	if (!wide)
+		value = (value & 0xffffffffU) | (value << 32);
+
+	// all zeroes and all ones can't be encoded
+	if (value == 0 || value == ~uint64_t(0))
+		return false;
+
+	// find the smallest element size that repeats across the value
+	unsigned size = 64;
+	while (size > 2)
+	{
+		unsigned const half = size / 2;
+		uint64_t const mask = (uint64_t(1) << half) - 1;
+		if ((value & mask) != ((value >> half) & mask))
+			break;
+		size = half;
+	}
+	uint64_t const elemmask = (size == 64) ? ~uint64_t(0) : ((uint64_t(1) << size) - 1);
+	uint64_t const elem = value & elemmask;
+
+	// the element must be a rotated run of ones; rotate it so the run starts at bit 0
+	unsigned rotation = 0;
+	uint64_t run = elem;
+	while ((run & 1) == 0 || ((run >> (size - 1)) & 1) != 0)
+	{
+		run = ((run >> 1) | ((run & 1) << (size - 1))) & elemmask;
+		if (++rotation == size)
+			return false;
+	}
+	unsigned ones = 0;
+	while ((run >> ones) & 1)
+		ones++;
+	if (ones == size || (run >> ones) != 0)
+		return false;
+
+	// rotating right by immr recovers the original element
+	unsigned const immr = (size - rotation) & (size - 1);
+	unsigned const nimms = ((~(size - 1) << 1) | (ones - 1)) & 0x7f;
+	unsigned const n = ((nimms >> 6) & 1) ^ 1;
+	encoded = (n << 12) | (immr << 6) | (nimms & 0x3f);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  contiguous_mask - return true if a non-zero
+//  mask is a single run of ones, and where it is
+//-------------------------------------------------
+
+static bool contiguous_mask(uint64_t mask, unsigned &lsb, unsigned &width)
+{
+	if (mask == 0)
+		return false;
+	lsb = 0;
+	while (!BIT(mask, lsb))
+		lsb++;
+	uint64_t const shifted = mask >> lsb;
+	if (shifted & (shifted + 1))
+		return false;
+	width = 0;
+	while (width < 64 - lsb && BIT(shifted, width))
+		width++;
+	return true;
+}
+
+
+
+//**************************************************************************
+//  A64 ENCODER
+//**************************************************************************
+
+// instructions are collected in a buffer and copied into the cache once the block is complete
+class drcbe_arm64::assembler
+{
+public:
+	assembler(arm64code *origin) : m_origin(origin) { m_code.reserve(1024); }
+
+	// buffer state
+	arm64code *origin() const { return m_origin; }
+	arm64code *ptr() const { return m_origin + m_code.size(); }
+	const arm64code *data() const { return m_code.data(); }
+	size_t count() const { return m_code.size(); }
+	size_t size() const { return m_code.size() * sizeof(arm64code); }
+
+	// labels
+	int new_label() { m_labels.push_back(-1); return int(m_labels.size() - 1); }
+	void bind(int label) { assert(m_labels[label] < 0); m_labels[label] = int(m_code.size()); }
+	int uml_label(uml::code_label label)
+	{
+		auto const found = m_uml_labels.find(label.label());
+		if (found != m_uml_labels.end())
+			return found->second;
+		int const result = new_label();
+		m_uml_labels.emplace(label.label(), result);
+		return result;
+	}
+
+	// patch all branches now that every label is bound
+	void resolve()
+	{
+		for (fixup const &f : m_fixups)
+		{
+			if (m_labels[f.label] < 0)
+				throw emu_fatalerror("drcbe_arm64: branch to unbound label\n");
+			int32_t const delta = m_labels[f.label] - int32_t(f.index);
+			uint32_t &op = m_code[f.index];
+			switch (f.type)
+			{
+				case FIXUP_B26:
+					if (delta < -0x2000000 || delta >= 0x2000000)
+						throw emu_fatalerror("drcbe_arm64: branch out of range\n");
+					op |= delta & 0x3ffffff;
+					break;
+
+				case FIXUP_B19:
+					if (delta < -0x40000 || delta >= 0x40000)
+						throw emu_fatalerror("drcbe_arm64: conditional branch out of range\n");
+					op |= (delta & 0x7ffff) << 5;
+					break;
+
+				case FIXUP_B14:
+					if (delta < -0x2000 || delta >= 0x2000)
+						throw emu_fatalerror("drcbe_arm64: test and branch out of range\n");
+					op |= (delta & 0x3fff) << 5;
+					break;
+			}
+		}
+		m_fixups.clear();
+	}
+
+	// comments for the log
+	void comment(std::string &&text) { m_comments.emplace_back(m_code.size(), std::move(text)); }
+	std::vector<std::pair<size_t, std::string> > const &comments() const { return m_comments; }
+
+	// raw output
+	void emit(uint32_t op) { m_code.push_back(op); }
+
+	// range checks for PC-relative forms
+	bool in_range(const void *target, intptr_t range) const
+	{
+		intptr_t const delta = intptr_t(target) - intptr_t(ptr());
+		return !(delta & 3) && (delta >= -range) && (delta < range);
+	}
+	bool in_page_range(const void *target) const
+	{
+		intptr_t const delta = (intptr_t(target) >> 12) - (intptr_t(ptr()) >> 12);
+		return (delta >= -0x100000) && (delta < 0x100000);
+	}
+
+	// add/subtract (immediate)
+	void addsub(bool sub, bool setflags, greg d, greg n, uint32_t imm, bool lsl12 = false)
+	{
+		assert(imm < 0x1000);
+		emit(sf(d) | (sub ? 0x40000000 : 0) | (setflags ? 0x20000000 : 0) | 0x11000000 | (lsl12 ? 0x00400000 : 0) | (imm << 10) | (n.id << 5) | d.id);
+	}
+	void add(greg d, greg n, uint32_t imm, bool lsl12 = false) { addsub(false, false, d, n, imm, lsl12); }
+	void adds(greg d, greg n, uint32_t imm) { addsub(false, true, d, n, imm); }
+	void sub(greg d, greg n, uint32_t imm, bool lsl12 = false) { addsub(true, false, d, n, imm, lsl12); }
+	void subs(greg d, greg n, uint32_t imm) { addsub(true, true, d, n, imm); }
+	void cmp(greg n, uint32_t imm) { subs(ZR_REG.sized(n.wide), n, imm); }
+
+	// add/subtract (shifted register)
+	void addsub(bool sub, bool setflags, greg d, greg n, greg m, arm64_shift shift = SHIFT_LSL, unsigned amount = 0)
+	{
+		emit(sf(d) | (sub ? 0x40000000 : 0) | (setflags ? 0x20000000 : 0) | 0x0b000000 | (shift << 22) | (m.id << 16) | (amount << 10) | (n.id << 5) | d.id);
+	}
+	void add(greg d, greg n, greg m, arm64_shift shift = SHIFT_LSL, unsigned amount = 0) { addsub(false, false, d, n, m, shift, amount); }
+	void sub(greg d, greg n, greg m, arm64_shift shift = SHIFT_LSL, unsigned amount = 0) { addsub(true, false, d, n, m, shift, amount); }
+	void cmp(greg n, greg m, arm64_shift shift = SHIFT_LSL, unsigned amount = 0) { addsub(true, true, ZR_REG.sized(n.wide), n, m, shift, amount); }
+	void neg(greg d, greg m) { sub(d, ZR_REG.sized(d.wide), m); }
+
+	// add/subtract (extended register)
+	void add(greg d, greg n, greg m, arm64_extend ext, unsigned amount = 0)
+	{
+		emit(sf(d) | 0x0b200000 | (m.id << 16) | (ext << 13) | (amount << 10) | (n.id << 5) | d.id);
+	}
+	void cmp(greg n, greg m, arm64_extend ext)
+	{
+		emit(sf(n) | 0x6b200000 | (m.id << 16) | (ext << 13) | (n.id << 5) | ZR_REG.id);
+	}
+
+	// add/subtract with carry
+	void adc(greg d, greg n, greg m) { emit(sf(d) | 0x1a000000 | (m.id << 16) | (n.id << 5) | d.id); }
+	void adcs(greg d, greg n, greg m) { emit(sf(d) | 0x3a000000 | (m.id << 16) | (n.id << 5) | d.id); }
+	void sbc(greg d, greg n, greg m) { emit(sf(d) | 0x5a000000 | (m.id << 16) | (n.id << 5) | d.id); }
+	void sbcs(greg d, greg n, greg m) { emit(sf(d) | 0x7a000000 | (m.id << 16) | (n.id << 5) | d.id); }
+
+	// logical (immediate); returns false if the value can't be encoded
+	bool logical(uint32_t op, greg d, greg n, uint64_t imm)
+	{
+		uint32_t encoded;
+		if (!encode_logical_immediate(imm, d.wide, encoded))
+			return false;
+		emit(sf(d) | (op & 0x60000000) | 0x12000000 | (encoded << 10) | (n.id << 5) | d.id);
+		return true;
+	}
+
+	// logical (shifted register)
+	void logical(uint32_t op, greg d, greg n, greg m, arm64_shift shift = SHIFT_LSL, unsigned amount = 0)
+	{
+		emit(sf(d) | op | (shift << 22) | (m.id << 16) | (amount << 10) | (n.id << 5) | d.id);
+	}
+	void orr(greg d, greg n, greg m, arm64_shift shift = SHIFT_LSL, unsigned amount = 0) { logical(LOGIC_ORR, d, n, m, shift, amount); }
+	void mov(greg d, greg m) { if (d.id != m.id || d.wide != m.wide) orr(d, ZR_REG.sized(d.wide), m); }
+	void mvn(greg d, greg m) { logical(LOGIC_ORN, d, ZR_REG.sized(d.wide), m); }
+	void tst(greg n, greg m) { logical(LOGIC_ANDS, ZR_REG.sized(n.wide), n, m); }
+
+	// move wide (immediate)
+	void movz(greg d, uint16_t imm, unsigned shift = 0) { emit(sf(d) | 0x52800000 | ((shift / 16) << 21) | (imm << 5) | d.id); }
+	void movn(greg d, uint16_t imm, unsigned shift = 0) { emit(sf(d) | 0x12800000 | ((shift / 16) << 21) | (imm << 5) | d.id); }
+	void movk(greg d, uint16_t imm, unsigned shift = 0) { emit(sf(d) | 0x72800000 | ((shift / 16) << 21) | (imm << 5) | d.id); }
+
+	// bitfield
+	void sbfm(greg d, greg n, unsigned immr, unsigned imms) { bitfield(0x13000000, d, n, immr, imms); }
+	void bfm(greg d, greg n, unsigned immr, unsigned imms) { bitfield(0x33000000, d, n, immr, imms); }
+	void ubfm(greg d, greg n, unsigned immr, unsigned imms) { bitfield(0x53000000, d, n, immr, imms); }
+	void lsl(greg d, greg n, unsigned shift) { ubfm(d, n, (width(d) - shift) & (width(d) - 1), width(d) - 1 - shift); }
+	void lsr(greg d, greg n, unsigned shift) { ubfm(d, n, shift, width(d) - 1); }
+	void asr(greg d, greg n, unsigned shift) { sbfm(d, n, shift, width(d) - 1); }
+	void ubfx(greg d, greg n, unsigned lsb, unsigned bits) { ubfm(d, n, lsb, lsb + bits - 1); }
+	void sbfx(greg d, greg n, unsigned lsb, unsigned bits) { sbfm(d, n, lsb, lsb + bits - 1); }
+	void bfi(greg d, greg n, unsigned lsb, unsigned bits) { bfm(d, n, (width(d) - lsb) & (width(d) - 1), bits - 1); }
+	void bfxil(greg d, greg n, unsigned lsb, unsigned bits) { bfm(d, n, lsb, lsb + bits - 1); }
+	void sxtb(greg d, greg n) { sbfm(d, n, 0, 7); }
+	void sxth(greg d, greg n) { sbfm(d, n, 0, 15); }
+	void sxtw(greg d, greg n) { sbfm(d.x(), n.x(), 0, 31); }
+	void uxtb(greg d, greg n) { ubfm(d.w(), n.w(), 0, 7); }
+	void uxth(greg d, greg n) { ubfm(d.w(), n.w(), 0, 15); }
+
+	// extract, and rotate by immediate which is a special case of it
+	void extr(greg d, greg n, greg m, unsigned lsb) { emit(sf(d) | (d.wide ? 0x00400000 : 0) | 0x13800000 | (m.id << 16) | (lsb << 10) | (n.id << 5) | d.id); }
+	void ror(greg d, greg n, unsigned shift) { extr(d, n, n, shift); }
+
+	// conditional select
+	void csel(greg d, greg n, greg m, arm64_condition cond) { emit(sf(d) | 0x1a800000 | (m.id << 16) | (cond << 12) | (n.id << 5) | d.id); }
+	void csinc(greg d, greg n, greg m, arm64_condition cond) { emit(sf(d) | 0x1a800400 | (m.id << 16) | (cond << 12) | (n.id << 5) | d.id); }
+	void cset(greg d, arm64_condition cond) { csinc(d, ZR_REG.sized(d.wide), ZR_REG.sized(d.wide), arm64_condition(cond ^ 1)); }
+
+	// data processing (2 source)
+	void udiv(greg d, greg n, greg m) { dp2(0x02, d, n, m); }
+	void sdiv(greg d, greg n, greg m) { dp2(0x03, d, n, m); }
+	void lslv(greg d, greg n, greg m) { dp2(0x08, d, n, m); }
+	void lsrv(greg d, greg n, greg m) { dp2(0x09, d, n, m); }
+	void asrv(greg d, greg n, greg m) { dp2(0x0a, d, n, m); }
+	void rorv(greg d, greg n, greg m) { dp2(0x0b, d, n, m); }
+
+	// data processing (1 source)
+	void rbit(greg d, greg n) { emit(sf(d) | 0x5ac00000 | (n.id << 5) | d.id); }
+	void rev(greg d, greg n) { emit((d.wide ? 0xdac00c00 : 0x5ac00800) | (n.id << 5) | d.id); }
+	void clz(greg d, greg n) { emit(sf(d) | 0x5ac01000 | (n.id << 5) | d.id); }
+
+	// data processing (3 source)
+	void madd(greg d, greg n, greg m, greg a) { emit(sf(d) | 0x1b000000 | (m.id << 16) | (a.id << 10) | (n.id << 5) | d.id); }
+	void msub(greg d, greg n, greg m, greg a) { emit(sf(d) | 0x1b008000 | (m.id << 16) | (a.id << 10) | (n.id << 5) | d.id); }
+	void mul(greg d, greg n, greg m) { madd(d, n, m, ZR_REG.sized(d.wide)); }
+	void smull(greg d, greg n, greg m) { emit(0x9b200000 | (m.id << 16) | (ZR_REG.id << 10) | (n.id << 5) | d.id); }
+	void umull(greg d, greg n, greg m) { emit(0x9ba00000 | (m.id << 16) | (ZR_REG.id << 10) | (n.id << 5) | d.id); }
+	void smulh(greg d, greg n, greg m) { emit(0x9b407c00 | (m.id << 16) | (n.id << 5) | d.id); }
+	void umulh(greg d, greg n, greg m) { emit(0x9bc07c00 | (m.id << 16) | (n.id << 5) | d.id); }
+
+	// system registers
+	void mrs_nzcv(greg t) { emit(0xd53b4200 | t.id); }
+	void msr_nzcv(greg t) { emit(0xd51b4200 | t.id); }
+	void mrs_fpcr(greg t) { emit(0xd53b4400 | t.id); }
+	void msr_fpcr(greg t) { emit(0xd51b4400 | t.id); }
+	void nop() { emit(0xd503201f); }
+
+	// branches to labels
+	void b(int label) { branch(0x14000000, label, FIXUP_B26); }
+	void b(arm64_condition cond, int label) { branch(0x54000000 | cond, label, FIXUP_B19); }
+	void cbz(greg t, int label) { branch(sf(t) | 0x34000000 | t.id, label, FIXUP_B19); }
+	void cbnz(greg t, int label) { branch(sf(t) | 0x35000000 | t.id, label, FIXUP_B19); }
+	void tbz(greg t, unsigned bit, int label) { branch(((bit & 0x20) << 26) | 0x36000000 | ((bit & 0x1f) << 19) | t.id, label, FIXUP_B14); }
+	void tbnz(greg t, unsigned bit, int label) { branch(((bit & 0x20) << 26) | 0x37000000 | ((bit & 0x1f) << 19) | t.id, label, FIXUP_B14); }
+
+	// branches to absolute targets; the caller checks the range
+	void b(const void *target) { assert(in_range(target, 0x8000000)); emit(0x14000000 | ((offset_to(target) >> 2) & 0x3ffffff)); }
+	void bl(const void *target) { assert(in_range(target, 0x8000000)); emit(0x94000000 | ((offset_to(target) >> 2) & 0x3ffffff)); }
+	void b(arm64_condition cond, const void *target) { assert(in_range(target, 0x100000)); emit(0x54000000 | (((offset_to(target) >> 2) & 0x7ffff) << 5) | cond); }
+
+	// branches to registers
+	void br(greg n) { emit(0xd61f0000 | (n.id << 5)); }
+	void blr(greg n) { emit(0xd63f0000 | (n.id << 5)); }
+	void ret(greg n = LR_REG) { emit(0xd65f0000 | (n.id << 5)); }
+
+	// loads and stores; op is one of the LDST_* unsigned offset opcodes
+	static bool ldst_offset_ok(uint32_t op, int64_t offset)
+	{
+		unsigned const scale = op >> 30;
+		return (offset >= 0) && !(offset & ((1 << scale) - 1)) && ((offset >> scale) < 0x1000);
+	}
+	void ldst(uint32_t op, unsigned t, greg n, uint32_t offset)
+	{
+		assert(ldst_offset_ok(op, offset));
+		emit(op | ((offset >> (op >> 30)) << 10) | (n.id << 5) | t);
+	}
+	void ldst_unscaled(uint32_t op, unsigned t, greg n, int32_t offset)
+	{
+		assert(offset >= -0x100 && offset < 0x100);
+		emit((op & ~0x01000000) | ((offset & 0x1ff) << 12) | (n.id << 5) | t);
+	}
+	void ldst_pre(uint32_t op, unsigned t, greg n, int32_t offset) { ldst_unscaled(op | 0xc00, t, n, offset); }
+	void ldst_post(uint32_t op, unsigned t, greg n, int32_t offset) { ldst_unscaled(op | 0x400, t, n, offset); }
+	void ldst(uint32_t op, unsigned t, greg n, greg m, arm64_extend ext, bool shift)
+	{
+		emit((op & ~0x01000000) | 0x00200800 | (m.id << 16) | (ext << 13) | (shift ? 0x1000 : 0) | (n.id << 5) | t);
+	}
+
+	// load/store pairs; op is one of the LDSTP_* signed offset opcodes, all with 8-byte elements
+	void ldstp(uint32_t op, unsigned t1, unsigned t2, greg n, int32_t offset)
+	{
+		assert(!(offset & 7) && offset >= -0x200 && offset < 0x200);
+		emit(op | (((offset >> 3) & 0x7f) << 15) | (t2 << 10) | (n.id << 5) | t1);
+	}
+	void ldstp_pre(uint32_t op, unsigned t1, unsigned t2, greg n, int32_t offset) { ldstp(op | 0x00800000, t1, t2, n, offset); }
+	void ldstp_post(uint32_t op, unsigned t1, unsigned t2, greg n, int32_t offset) { ldstp((op & ~0x01000000) | 0x00800000, t1, t2, n, offset); }
+
+	// PC-relative addresses
+	void adr(greg d, const void *target)
+	{
+		intptr_t const delta = offset_to(target);
+		assert(delta >= -0x100000 && delta < 0x100000);
+		emit(0x10000000 | ((delta & 3) << 29) | (((delta >> 2) & 0x7ffff) << 5) | d.id);
+	}
+	void adrp(greg d, const void *target)
+	{
+		assert(in_page_range(target));
+		intptr_t const delta = (intptr_t(target) >> 12) - (intptr_t(ptr()) >> 12);
+		emit(0x90000000 | ((delta & 3) << 29) | (((delta >> 2) & 0x7ffff) << 5) | d.id);
+	}
+
+	// floating point moves
+	void fmov(vreg d, vreg n) { if (d != n) emit(0x1e204000 | ftype(d) | (n.id << 5) | d.id); }
+	void fmov(vreg d, greg n) { assert(d.dbl == n.wide); emit((d.dbl ? 0x9e670000 : 0x1e270000) | (n.id << 5) | d.id); }
+	void fmov(greg d, vreg n) { assert(d.wide == n.dbl); emit((n.dbl ? 0x9e660000 : 0x1e260000) | (n.id << 5) | d.id); }
+	void fmov_one(vreg d) { emit(0x1e201000 | ftype(d) | (0x70 << 13) | d.id); }
+
+	// floating point arithmetic
+	void fadd(vreg d, vreg n, vreg m) { emit(0x1e202800 | ftype(d) | (m.id << 16) | (n.id << 5) | d.id); }
+	void fsub(vreg d, vreg n, vreg m) { emit(0x1e203800 | ftype(d) | (m.id << 16) | (n.id << 5) | d.id); }
+	void fmul(vreg d, vreg n, vreg m) { emit(0x1e200800 | ftype(d) | (m.id << 16) | (n.id << 5) | d.id); }
+	void fdiv(vreg d, vreg n, vreg m) { emit(0x1e201800 | ftype(d) | (m.id << 16) | (n.id << 5) | d.id); }
+	void fneg(vreg d, vreg n) { emit(0x1e214000 | ftype(d) | (n.id << 5) | d.id); }
+	void fabs(vreg d, vreg n) { emit(0x1e20c000 | ftype(d) | (n.id << 5) | d.id); }
+	void fsqrt(vreg d, vreg n) { emit(0x1e21c000 | ftype(d) | (n.id << 5) | d.id); }
+	void frinti(vreg d, vreg n) { emit(0x1e27c000 | ftype(d) | (n.id << 5) | d.id); }
+	void fcmp(vreg n, vreg m) { emit(0x1e202000 | ftype(n) | (m.id << 16) | (n.id << 5)); }
+	void fcsel(vreg d, vreg n, vreg m, arm64_condition cond) { emit(0x1e200c00 | ftype(d) | (m.id << 16) | (cond << 12) | (n.id << 5) | d.id); }
+
+	// vector operations on whole 128-bit registers
+	void vec3(uint32_t op, vreg d, vreg n, vreg m) { emit(op | (m.id << 16) | (n.id << 5) | d.id); }
+	void vmov(vreg d, vreg n) { if (d != n) vec3(VEC_ORR, d, n, n); }
+	void ins_h(vreg d, unsigned dlane, vreg n, unsigned nlane) { emit(0x6e000400 | (((dlane << 2) | 2) << 16) | (nlane << 12) | (n.id << 5) | d.id); }
+	void dup_h(vreg d, vreg n, unsigned lane) { emit(0x4e000400 | (((lane << 2) | 2) << 16) | (n.id << 5) | d.id); }
+
+	// floating point conversions
+	void fcvt(vreg d, vreg n) { assert(d.dbl != n.dbl); emit((n.dbl ? 0x1e624000 : 0x1e22c000) | (n.id << 5) | d.id); }
+	void fcvt(uint32_t op, greg d, vreg n) { emit(sf(d) | op | ftype(n) | (n.id << 5) | d.id); }
+	void scvtf(vreg d, greg n) { emit(sf(n) | 0x1e220000 | ftype(d) | (n.id << 5) | d.id); }
+
+private:
+	enum fixup_type { FIXUP_B26, FIXUP_B19, FIXUP_B14 };
+	struct fixup
+	{
+		size_t      index;
+		int         label;
+		fixup_type  type;
+	};
+
+	static uint32_t sf(greg r) { return r.wide ? 0x80000000 : 0; }
+	static uint32_t ftype(vreg r) { return r.dbl ? 0x00400000 : 0; }
+	static unsigned width(greg r) { return r.wide ? 64 : 32; }
+
+	intptr_t offset_to(const void *target) const { return intptr_t(target) - intptr_t(ptr()); }
+
+	void branch(uint32_t op, int label, fixup_type type)
+	{
+		m_fixups.push_back(fixup{ m_code.size(), label, type });
+		emit(op);
+	}
+	void bitfield(uint32_t op, greg d, greg n, unsigned immr, unsigned imms)
+	{
+		assert(immr < width(d) && imms < width(d));
+		emit(sf(d) | (d.wide ? 0x00400000 : 0) | op | (immr << 16) | (imms << 10) | (n.id << 5) | d.id);
+	}
+	void dp2(uint32_t opcode, greg d, greg n, greg m)
+	{
+		emit(sf(d) | 0x1ac00000 | (m.id << 16) | (opcode << 10) | (n.id << 5) | d.id);
+	}
+
+	std::vector<uint32_t>                       m_code;
+	arm64code *                                 m_origin;
+	std::vector<int>                            m_labels;
+	std::map<uint32_t, int>                     m_uml_labels;
+	std::vector<fixup>                          m_fixups;
+	std::vector<std::pair<size_t, std::string> > m_comments;
+};
+
+
+
+//-------------------------------------------------
+//  param_normalize - convert a full parameter
+//  into a reduced set
+//-------------------------------------------------
+
+drcbe_arm64::be_parameter::be_parameter(drcbe_arm64 &drcbe, const parameter &param, uint32_t allowed)
+{
+	int regnum;
+
+	switch (param.type())
+	{
+		// immediates pass through
+		case parameter::PTYPE_IMMEDIATE:
+			assert(allowed & PTYPE_I);
+			*this = param.immediate();
+			break;
+
+		// memory passes through
+		case parameter::PTYPE_MEMORY:
+			assert(allowed & PTYPE_M);
+			*this = make_memory(param.memory());
+			break;
+
+		// if a register maps to a register, keep it as a register; otherwise map it to memory
+		case parameter::PTYPE_INT_REGISTER:
+			assert(allowed & PTYPE_R);
+			assert(allowed & PTYPE_M);
+			regnum = int_register_map[param.ireg() - REG_I0];
+			if (regnum != 0)
+				*this = make_ireg(regnum);
+			else
+				*this = make_memory(&drcbe.m_state.r[param.ireg() - REG_I0]);
+			break;
+
+		// if a register maps to a register, keep it as a register; otherwise map it to memory
+		case parameter::PTYPE_FLOAT_REGISTER:
+			assert(allowed & PTYPE_F);
+			assert(allowed & PTYPE_M);
+			regnum = float_register_map[param.freg() - REG_F0];
+			if (regnum != 0)
+				*this = make_freg(regnum);
+			else
+				*this = make_memory(&drcbe.m_state.f[param.freg() - REG_F0]);
+			break;
+
+		// everything else is unexpected
+		default:
+			fatalerror("Unexpected parameter type\n");
+	}
+}
+
+
+//-------------------------------------------------
+//  select_register - select a register to use,
+//  preferring the parameter's own register
+//-------------------------------------------------
+
+inline greg drcbe_arm64::be_parameter::select_register(greg defreg) const
+{
+	if (m_type == PTYPE_INT_REGISTER)
+		return greg{ uint8_t(m_value), defreg.wide };
+	return defreg;
+}
+
+inline vreg drcbe_arm64::be_parameter::select_register(vreg defreg) const
+{
+	if (m_type == PTYPE_FLOAT_REGISTER)
+		return vreg{ uint8_t(m_value), defreg.dbl };
+	return defreg;
+}
+
+
+
+//**************************************************************************
+//  BACKEND CALLBACKS
+//**************************************************************************
+
+//-------------------------------------------------
+//  drcbe_arm64 - constructor
+//-------------------------------------------------
+
+drcbe_arm64::drcbe_arm64(drcuml_state &drcuml, device_t &device, drc_cache &cache, uint32_t flags, int modes, int addrbits, int ignorebits)
+	: drcbe_interface(drcuml, cache, device),
+		m_hash(cache, modes, addrbits, ignorebits),
+		m_map(cache, 0xaaaaaaaa5555),
+		m_log(nullptr),
+		m_basevalue(cache.near()),
+		m_entry(nullptr),
+		m_exit(nullptr),
+		m_nocode(nullptr),
+		m_near(*(near_state *)cache.alloc_near(sizeof(m_near)))
+{
+	// get pointers to C functions we need to call
+	using debugger_hook_func = void (*)(device_debug *, offs_t);
+	static const debugger_hook_func debugger_inst_hook = [] (device_debug *dbg, offs_t pc) { dbg->instruction_hook(pc); };
+	m_near.debug_cpu_instruction_hook = (void *)debugger_inst_hook;
+	if (LOG_HASHJMPS)
+	{
+		m_near.debug_log_hashjmp = (void *)debug_log_hashjmp;
+		m_near.debug_log_hashjmp_fail = (void *)debug_log_hashjmp_fail;
+	}
+	m_near.drcmap_get_value = (void *)&drc_map_variables::static_get_value;
+
+	// build the flags map, indexed by NZCV; the host carry is the inverse of the UML carry
+	for (int entry = 0; entry < std::size(m_near.flagsmap); entry++)
+	{
+		uint8_t flags = 0;
+		if (entry & 0x8) flags |= FLAG_S;
+		if (entry & 0x4) flags |= FLAG_Z;
+		if (!(entry & 0x2)) flags |= FLAG_C;
+		if (entry & 0x1) flags |= FLAG_V | FLAG_U;
+		m_near.flagsmap[entry] = flags;
+	}
+	for (int entry = 0; entry < std::size(m_near.flagsunmap); entry++)
+	{
+		uint32_t nzcv = 0;
+		if (entry & FLAG_S) nzcv |= NZCV_N;
+		if (entry & FLAG_Z) nzcv |= NZCV_Z;
+		if (!(entry & FLAG_C)) nzcv |= NZCV_C;
+		if (entry & (FLAG_V | FLAG_U)) nzcv |= NZCV_V;
+		m_near.flagsunmap[entry] = nzcv;
+	}
+
+	// build the opcode table (static but it doesn't hurt to regenerate it)
+	for (auto & elem : s_opcode_table_source)
+		s_opcode_table[elem.opcode] = elem.func;
+
+	// create the log
+	if (device.machine().options().drc_log_native())
+	{
+		std::string filename = std::string("drcbearm64_").append(device.shortname()).append(".asm");
+		m_log = fopen(filename.c_str(), "w");
+	}
+}
+
+
+//-------------------------------------------------
+//  ~drcbe_arm64 - destructor
+//-------------------------------------------------
+
+drcbe_arm64::~drcbe_arm64()
+{
+	// close the log
+	if (m_log != nullptr)
+		fclose(m_log);
+}
+
+
+//-------------------------------------------------
+//  emit - copy assembled code into the cache
+//-------------------------------------------------
+
+size_t drcbe_arm64::emit(assembler &a)
+{
+	a.resolve();
+
+	size_t const alignment = drccodeptr(a.origin()) - m_cache.top();
+	size_t const code_size = a.size();
+
+	// test if enough room remains in drc cache
+	drccodeptr *cachetop = m_cache.begin_codegen(alignment + code_size);
+	if (cachetop == nullptr)
+		return 0;
+
+	memcpy(a.origin(), a.data(), code_size);
+
+	// update the drc cache and end codegen; this also invalidates the instruction cache
+	*cachetop += alignment + code_size;
+	m_cache.end_codegen();
+
+	return code_size;
+}
+
+
+//-------------------------------------------------
+//  reset - reset back-end specific state
+//-------------------------------------------------
+
+void drcbe_arm64::reset()
+{
+	// output a note to the log
+	if (m_log != nullptr)
+		fprintf(m_log, "%s", "\n\n===========\nCACHE RESET\n===========\n\n");
+
+	// generate a little bit of glue code to set up the environment
+	arm64code *dst = (arm64code *)(uintptr_t(m_cache.top() + 3) & ~uintptr_t(3));
+	assembler a(dst);
+
+	// generate an entry point
+	m_entry = (arm64_entry_point_func)dst;
+	a.ldstp_pre(LDSTP_STPX, FP_REG.id, LR_REG.id, SP_REG, -160);                        // stp   x29,x30,[sp,#-160]!
+	a.add(FP_REG, SP_REG, 0);                                                           // mov   x29,sp
+	for (int regnum = 19; regnum < 29; regnum += 2)
+		a.ldstp(LDSTP_STPX, regnum, regnum + 1, SP_REG, 16 + 8 * (regnum - 19));     // stp   xN,xN+1,[sp,#off]
+	for (int regnum = 8; regnum < 16; regnum += 2)
+		a.ldstp(LDSTP_STPD, regnum, regnum + 1, SP_REG, 96 + 8 * (regnum - 8));      // stp   dN,dN+1,[sp,#off]
+	a.mov(BASE_REG, REG_PARAM1);                                                        // mov   x28,x0
+
+	// save the host rounding mode and apply the UML one
+	a.mrs_fpcr(TEMP_REG1);                                                              // mrs   x9,fpcr
+	emit_mem(a, LDST_STRW, TEMP_REG1.id, &m_near.fpcrsave);                             // str   w9,[fpcrsave]
+	emit_mem(a, LDST_LDRB, TEMP_REG1.id, &m_state.fmod);                                // ldrb  w9,[fmod]
+	emit_set_rounding(a, TEMP_REG1.w());
+
+	a.add(SCRATCH_REG1, SP_REG, 0);                                                     // mov   x16,sp
+	emit_mem(a, LDST_STRX, SCRATCH_REG1.id, &m_near.stacksave);                         // str   x16,[stacksave]
+	a.br(REG_PARAM2);                                                                   // br    x1
+
+	// generate an exit point
+	m_exit = a.ptr();
+	size_t const exit_index = a.count();
+	emit_mem(a, LDST_LDRX, SCRATCH_REG1.id, &m_near.stacksave);                         // ldr   x16,[stacksave]
+	a.add(SP_REG, SCRATCH_REG1, 0);                                                     // mov   sp,x16
+	emit_mem(a, LDST_LDRW, TEMP_REG1.id, &m_near.fpcrsave);                             // ldr   w9,[fpcrsave]
+	a.msr_fpcr(TEMP_REG1);                                                              // msr   fpcr,x9
+	for (int regnum = 19; regnum < 29; regnum += 2)
+		a.ldstp(LDSTP_LDPX, regnum, regnum + 1, SP_REG, 16 + 8 * (regnum - 19));     // ldp   xN,xN+1,[sp,#off]
+	for (int regnum = 8; regnum < 16; regnum += 2)
+		a.ldstp(LDSTP_LDPD, regnum, regnum + 1, SP_REG, 96 + 8 * (regnum - 8));      // ldp   dN,dN+1,[sp,#off]
+	a.ldstp_post(LDSTP_LDPX, FP_REG.id, LR_REG.id, SP_REG, 160);                        // ldp   x29,x30,[sp],#160
+	a.ret();                                                                            // ret
+
+	// generate a no code point
+	m_nocode = a.ptr();
+	size_t const nocode_index = a.count();
+	a.ret();                                                                            // ret
+
+	// emit the generated code
+	size_t const bytes = emit(a);
+	if (!bytes)
+		fatalerror("drcbe_arm64: no room in the cache for the entry and exit code\n");
+
+	if (m_log != nullptr)
+	{
+		fprintf(m_log, "\nentry_point\n");
+		for (size_t index = 0; index < a.count(); index++)
+		{
+			if (index == exit_index)
+				fprintf(m_log, "\nexit_point\n");
+			else if (index == nocode_index)
+				fprintf(m_log, "\nnocode_point\n");
+			fprintf(m_log, "%p: %08x\n", (void *)(dst + index), a.data()[index]);
+		}
+	}
+
+	// reset our hash tables
+	m_hash.reset();
+	m_hash.set_default_codeptr(drccodeptr(m_nocode));
+}
+
+
+//-------------------------------------------------
+//  execute - execute a block of code referenced
+//  by the given handle
+//-------------------------------------------------
+
+int drcbe_arm64::execute(code_handle &entry)
+{
+	// call our entry point which will jump to the destination
+	m_cache.codegen_complete();
+	return (*m_entry)(m_basevalue, (arm64code *)entry.codeptr());
+}
+
+
+//-------------------------------------------------
+//  generate - generate code
+//-------------------------------------------------
+
+void drcbe_arm64::generate(drcuml_block &block, const instruction *instlist, uint32_t numinst)
+{
+	// tell all of our utility objects that a block is beginning
+	m_hash.block_begin(block, instlist, numinst);
+	m_map.block_begin(block);
+
+	// compute the base by aligning the cache top to a cache line (assumed to be 64 bytes)
+	arm64code *dst = (arm64code *)(uintptr_t(m_cache.top() + 63) & ~uintptr_t(63));
+	assembler a(dst);
+
+	// generate code
+	std::string blockname;
+	for (int inum = 0; inum < numinst; inum++)
+	{
+		const instruction &inst = instlist[inum];
+		assert(inst.opcode() < std::size(s_opcode_table));
+
+		// add a comment
+		if (m_log != nullptr)
+			a.comment(inst.disasm(&m_drcuml));
+
+		// extract a blockname
+		if (blockname.empty())
+		{
+			if (inst.opcode() == OP_HANDLE)
+				blockname = inst.param(0).handle().string();
+			else if (inst.opcode() == OP_HASH)
+				blockname = string_format("Code: mode=%d PC=%08X", (uint32_t)inst.param(0).immediate(), (offs_t)inst.param(1).immediate());
+		}
+
+		// generate code
+		(this->*s_opcode_table[inst.opcode()])(a, inst);
+	}
+
+	// emit the generated code
+	size_t const bytes = emit(a);
+	if (!bytes)
+		block.abort();
+
+	// log it
+	if (m_log != nullptr)
+		log_code(a, blockname.empty() ? "Unknown block" : blockname.c_str());
+
+	// tell all of our utility objects that the block is finished
+	m_hash.block_end(block);
+	m_map.block_end(block);
+}
+
+
+//-------------------------------------------------
+//  hash_exists - return true if the given mode/pc
+//  exists in the hash table
+//-------------------------------------------------
+
+bool drcbe_arm64::hash_exists(uint32_t mode, uint32_t pc)
+{
+	return m_hash.code_exists(mode, pc);
+}
+
+
+//-------------------------------------------------
+//  hash_invalidate - forget the code for the
+//  given mode/pc so it is compiled again
+//-------------------------------------------------
+
+void drcbe_arm64::hash_invalidate(uint32_t mode, uint32_t pc)
+{
+	m_hash.invalidate(mode, pc);
+}
+
+
+//-------------------------------------------------
+//  get_info - return information about the
+//  back-end implementation
+//-------------------------------------------------
+
+void drcbe_arm64::get_info(drcbe_info &info)
+{
+	for (info.direct_iregs = 0; info.direct_iregs < REG_I_COUNT; info.direct_iregs++)
+		if (int_register_map[info.direct_iregs] == 0)
+			break;
+	for (info.direct_fregs = 0; info.direct_fregs < REG_F_COUNT; info.direct_fregs++)
+		if (float_register_map[info.direct_fregs] == 0)
+			break;
+}
+
+
+//-------------------------------------------------
+//  log_code - write a block's code words to the
+//  log, interleaved with the UML it came from
+//-------------------------------------------------
+
+void drcbe_arm64::log_code(assembler const &a, const char *name)
+{
+	fprintf(m_log, "\n%s\n", name);
+
+	auto comment = a.comments().begin();
+	for (size_t index = 0; index < a.count(); index++)
+	{
+		for ( ; comment != a.comments().end() && comment->first == index; ++comment)
+			fprintf(m_log, "%24s; %s\n", "", comment->second.c_str());
+		fprintf(m_log, "%p: %08x\n", (void *)(a.origin() + index), a.data()[index]);
+	}
+	for ( ; comment != a.comments().end(); ++comment)
+		fprintf(m_log, "%24s; %s\n", "", comment->second.c_str());
+}
+
+
+
+/***************************************************************************
+    EMITTERS FOR SIMPLE CONSTRUCTS
+***************************************************************************/
+
+//-------------------------------------------------
+//  emit_mem - load or store a register at an
+//  arbitrary address, using the near cache base
+//  register where possible
+//-------------------------------------------------
+
+void drcbe_arm64::emit_mem(assembler &a, uint32_t op, unsigned reg, const void *ptr)
+{
+	int64_t const offset = (const uint8_t *)ptr - m_basevalue;
+	unsigned const scale = op >> 30;
+
+	if (assembler::ldst_offset_ok(op, offset))
+	{
+		a.ldst(op, reg, BASE_REG, offset);                                              // ldr   reg,[x28,#offset]
+	}
+	else if (offset >= -0x100 && offset < 0x100)
+	{
+		a.ldst_unscaled(op, reg, BASE_REG, offset);                                     // ldur  reg,[x28,#offset]
+	}
+	else if (offset >= 0 && offset < 0x1000000 && !(offset & ((1 << scale) - 1)))
+	{
+		a.add(SCRATCH_REG1, BASE_REG, offset >> 12, true);                              // add   x16,x28,#hi,lsl #12
+		a.ldst(op, reg, SCRATCH_REG1, offset & 0xfff);                                  // ldr   reg,[x16,#lo]
+	}
+	else if (a.in_page_range(ptr))
+	{
+		uint32_t const lo = uintptr_t(ptr) & 0xfff;
+		a.adrp(SCRATCH_REG1, ptr);                                                      // adrp  x16,ptr
+		if (assembler::ldst_offset_ok(op, lo))
+			a.ldst(op, reg, SCRATCH_REG1, lo);                                          // ldr   reg,[x16,#lo]
+		else
+		{
+			a.add(SCRATCH_REG1, SCRATCH_REG1, lo);                                      // add   x16,x16,#lo
+			a.ldst(op, reg, SCRATCH_REG1, 0);                                           // ldr   reg,[x16]
+		}
+	}
+	else
+	{
+		mov_reg_imm(a, SCRATCH_REG1, uintptr_t(ptr));                                   // mov   x16,ptr
+		a.ldst(op, reg, SCRATCH_REG1, 0);                                               // ldr   reg,[x16]
+	}
+}
+
+
+//-------------------------------------------------
+//  emit_vmem - load or store a whole 128-bit
+//  vector register at an arbitrary address
+//-------------------------------------------------
+
+void drcbe_arm64::emit_vmem(assembler &a, uint32_t op, vreg reg, const void *ptr)
+{
+	int64_t const offset = (const uint8_t *)ptr - m_basevalue;
+
+	if (offset >= 0 && offset < 0x10000 && !(offset & 15))
+	{
+		a.emit(op | ((offset >> 4) << 10) | (BASE_REG.id << 5) | reg.id);               // ldr   qreg,[x28,#offset]
+	}
+	else if (offset >= -0x100 && offset < 0x100)
+	{
+		a.ldst_unscaled(op, reg.id, BASE_REG, offset);                                  // ldur  qreg,[x28,#offset]
+	}
+	else
+	{
+		emit_address(a, SCRATCH_REG1, ptr);                                             // mov   x16,ptr
+		a.emit(op | (SCRATCH_REG1.id << 5) | reg.id);                                   // ldr   qreg,[x16]
+	}
+}
+
+
+//-------------------------------------------------
+//  emit_address - load an address into a
+//  register
+//-------------------------------------------------
+
+void drcbe_arm64::emit_address(assembler &a, greg reg, const void *ptr)
+{
+	int64_t const offset = (const uint8_t *)ptr - m_basevalue;
+
+	if (offset >= 0 && offset < 0x1000)
+	{
+		a.add(reg, BASE_REG, offset);                                                   // add   reg,x28,#offset
+	}
+	else if (offset >= 0 && offset < 0x1000000)
+	{
+		a.add(reg, BASE_REG, offset >> 12, true);                                       // add   reg,x28,#hi,lsl #12
+		if (offset & 0xfff)
+			a.add(reg, reg, offset & 0xfff);                                            // add   reg,reg,#lo
+	}
+	else if ((intptr_t(ptr) - intptr_t(a.ptr()) >= -0x100000) && (intptr_t(ptr) - intptr_t(a.ptr()) < 0x100000))
+	{
+		a.adr(reg, ptr);                                                                // adr   reg,ptr
+	}
+	else if (a.in_page_range(ptr))
+	{
+		a.adrp(reg, ptr);                                                               // adrp  reg,ptr
+		if (uintptr_t(ptr) & 0xfff)
+			a.add(reg, reg, uintptr_t(ptr) & 0xfff);                                    // add   reg,reg,#lo
+	}
+	else
+	{
+		mov_reg_imm(a, reg, uintptr_t(ptr));                                            // mov   reg,ptr
+	}
+}
+
+
+//-------------------------------------------------
+//  emit_call - call a function directly if it is
+//  in range of BL, or through a register
+//-------------------------------------------------
+
+void drcbe_arm64::emit_call(assembler &a, const void *target)
+{
+	if (a.in_range(target, 0x8000000))
+		a.bl(target);                                                                   // bl    target
+	else
+	{
+		mov_reg_imm(a, SCRATCH_REG1, uintptr_t(target));                                // mov   x16,target
+		a.blr(SCRATCH_REG1);                                                            // blr   x16
+	}
+}
+
+
+//-------------------------------------------------
+//  emit_call_mem - call through a function
+//  pointer in memory
+//-------------------------------------------------
+
+void drcbe_arm64::emit_call_mem(assembler &a, const void *ptr)
+{
+	emit_mem(a, LDST_LDRX, SCRATCH_REG1.id, ptr);                                       // ldr   x16,[ptr]
+	a.blr(SCRATCH_REG1);                                                                // blr   x16
+}
+
+
+//-------------------------------------------------
+//  emit_call_handle - call a code handle, going
+//  through its pointer if it isn't bound yet
+//-------------------------------------------------
+
+void drcbe_arm64::emit_call_handle(assembler &a, code_handle &handle)
+{
+	if (handle.codeptr() != nullptr)
+		emit_call(a, handle.codeptr());                                                 // bl    *targetptr
+	else
+		emit_call_mem(a, handle.codeptr_addr());                                        // blr   [targetptr]
+}
+
+
+//-------------------------------------------------
+//  emit_jump - jump to an absolute target
+//-------------------------------------------------
+
+void drcbe_arm64::emit_jump(assembler &a, const void *target)
+{
+	if (a.in_range(target, 0x8000000))
+		a.b(target);                                                                    // b     target
+	else
+	{
+		mov_reg_imm(a, SCRATCH_REG1, uintptr_t(target));                                // mov   x16,target
+		a.br(SCRATCH_REG1);                                                             // br    x16
+	}
+}
+
+
+//-------------------------------------------------
+//  emit_set_carry - set the UML carry flag from
+//  bit 0 of a register, leaving the other flags
+//-------------------------------------------------
+
+void drcbe_arm64::emit_set_carry(assembler &a, greg bit)
+{
+	a.logical(LOGIC_EOR, SCRATCH_REG1.w(), bit.w(), 1);                                 // eor   w16,bit,#1
+	a.mrs_nzcv(SCRATCH_REG2);                                                           // mrs   x17,nzcv
+	a.bfi(SCRATCH_REG2, SCRATCH_REG1, 29, 1);                                           // bfi   x17,x16,#29,#1
+	a.msr_nzcv(SCRATCH_REG2);                                                           // msr   nzcv,x17
+}
+
+
+//-------------------------------------------------
+//  emit_invert_carry - convert the host carry
+//  flag to or from the UML sense
+//-------------------------------------------------
+
+void drcbe_arm64::emit_invert_carry(assembler &a)
+{
+	a.mrs_nzcv(SCRATCH_REG2);                                                           // mrs   x17,nzcv
+	a.logical(LOGIC_EOR, SCRATCH_REG2, SCRATCH_REG2, NZCV_C);                           // eor   x17,x17,#C
+	a.msr_nzcv(SCRATCH_REG2);                                                           // msr   nzcv,x17
+}
+
+
+//-------------------------------------------------
+//  emit_set_overflow - set the V flag from bit 0
+//  of a register, leaving the other flags
+//-------------------------------------------------
+
+void drcbe_arm64::emit_set_overflow(assembler &a, greg bit)
+{
+	a.mrs_nzcv(SCRATCH_REG2);                                                           // mrs   x17,nzcv
+	a.bfi(SCRATCH_REG2, bit.x(), 28, 1);                                                // bfi   x17,bit,#28,#1
+	a.msr_nzcv(SCRATCH_REG2);                                                           // msr   nzcv,x17
+}
+
+
+//-------------------------------------------------
+//  emit_set_rounding - apply a UML rounding mode
+//  held in a register to the FPCR; the register
+//  is modified
+//-------------------------------------------------
+
+void drcbe_arm64::emit_set_rounding(assembler &a, greg mode)
+{
+	// UML trunc/round/ceil/floor map to RMode 3/0/1/2
+	a.add(mode.w(), mode.w(), 3);                                                       // add   mode,mode,#3
+	a.mrs_fpcr(SCRATCH_REG2);                                                           // mrs   x17,fpcr
+	a.bfi(SCRATCH_REG2, mode.x(), 22, 2);                                               // bfi   x17,mode,#22,#2
+	a.msr_fpcr(SCRATCH_REG2);                                                           // msr   fpcr,x17
+}
+
+
+//-------------------------------------------------
+//  emit_indexed - load or store a register at
+//  base + index << scale
+//-------------------------------------------------
+
+void drcbe_arm64::emit_indexed(assembler &a, uint32_t op, unsigned reg, const void *base, be_parameter const &indp, unsigned scale)
+{
+	if (indp.is_immediate())
+	{
+		// compute the address at compile time
+		emit_mem(a, op, reg, (const uint8_t *)base + (int64_t(int32_t(indp.immediate())) << scale));
+	}
+	else
+	{
+		greg const indreg = get_reg_param(a, TEMP_REG2.w(), indp);
+		emit_address(a, SCRATCH_REG1, base);                                            // mov   x16,base
+		if (scale == (op >> 30))
+			a.ldst(op, reg, SCRATCH_REG1, indreg, EXTEND_SXTW, scale != 0);             // ldr   reg,[x16,ind,sxtw #scale]
+		else
+		{
+			a.add(SCRATCH_REG1, SCRATCH_REG1, indreg, EXTEND_SXTW, scale);              // add   x16,x16,ind,sxtw #scale
+			a.ldst(op, reg, SCRATCH_REG1, 0);                                           // ldr   reg,[x16]
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  add_param - add or subtract a parameter,
+//  using an immediate form where possible
+//-------------------------------------------------
+
+void drcbe_arm64::add_param(assembler &a, bool sub, bool setflags, greg dst, greg src1, be_parameter const &src2)
+{
+	if (src2.is_immediate())
+	{
+		uint64_t const imm = dst.wide ? src2.immediate() : uint32_t(src2.immediate());
+		uint64_t const negimm = dst.wide ? (0 - imm) : uint32_t(0 - imm);
+		if (imm < 0x1000)
+		{
+			a.addsub(sub, setflags, dst, src1, imm);                                    // add   dst,src1,#imm
+			return;
+		}
+		if (!(imm & 0xfff) && imm < 0x1000000)
+		{
+			a.addsub(sub, setflags, dst, src1, imm >> 12, true);                        // add   dst,src1,#imm,lsl #12
+			return;
+		}
+
+		// the carry out differs for the negated form, so only use it when it isn't wanted
+		if (!setflags && negimm < 0x1000)
+		{
+			a.addsub(!sub, false, dst, src1, negimm);                                   // sub   dst,src1,#-imm
+			return;
+		}
+	}
+
+	greg const src2reg = get_reg_param(a, SCRATCH_REG2.sized(dst.wide), src2);
+	a.addsub(sub, setflags, dst, src1, src2reg);                                        // add   dst,src1,src2
+}
+
+
+//-------------------------------------------------
+//  logical_param - apply a logical operation with
+//  a parameter, using an immediate form where
+//  possible
+//-------------------------------------------------
+
+void drcbe_arm64::logical_param(assembler &a, uint32_t op, greg dst, greg src1, be_parameter const &src2)
+{
+	if (src2.is_immediate() && a.logical(op, dst, src1, src2.immediate()))
+		return;                                                                         // and   dst,src1,#imm
+
+	greg const src2reg = get_reg_param(a, SCRATCH_REG2.sized(dst.wide), src2);
+	a.logical(op, dst, src1, src2reg);                                                  // and   dst,src1,src2
+}
+
+
+//-------------------------------------------------
+//  mov_reg_imm - load an immediate into a
+//  register in as few instructions as possible
+//-------------------------------------------------
+
+void drcbe_arm64::mov_reg_imm(assembler &a, greg reg, uint64_t imm)
+{
+	// values that fit in 32 bits zero-extend from the W form
+	if (!reg.wide || imm <= 0xffffffffU)
+	{
+		reg = reg.w();
+		imm = uint32_t(imm);
+	}
+	unsigned const chunks = reg.wide ? 4 : 2;
+
+	unsigned zeros = 0, ones = 0;
+	for (unsigned chunk = 0; chunk < chunks; chunk++)
+	{
+		uint16_t const value = imm >> (16 * chunk);
+		zeros += (value == 0x0000) ? 1 : 0;
+		ones += (value == 0xffff) ? 1 : 0;
+	}
+
+	// a repeating bit pattern may be a single ORR where MOVZ/MOVK would take several
+	if (zeros < chunks - 1 && ones < chunks - 1 && a.logical(LOGIC_ORR, reg, ZR_REG.sized(reg.wide), imm))
+		return;                                                                         // mov   reg,#imm
+
+	// start from all ones or all zeroes, whichever leaves fewer chunks to fill in
+	bool const inverted = ones > zeros;
+	uint16_t const fill = inverted ? 0xffff : 0x0000;
+	bool first = true;
+	for (unsigned chunk = 0; chunk < chunks; chunk++)
+	{
+		uint16_t const value = imm >> (16 * chunk);
+		if (value == fill && !(first && chunk == chunks - 1))
+			continue;
+		if (!first)
+			a.movk(reg, value, 16 * chunk);                                             // movk  reg,#value,lsl #shift
+		else if (inverted)
+			a.movn(reg, ~value, 16 * chunk);                                            // movn  reg,#~value,lsl #shift
+		else
+			a.movz(reg, value, 16 * chunk);                                             // movz  reg,#value,lsl #shift
+		first = false;
+	}
+}
+
+
+//-------------------------------------------------
+//  mov_reg_param - move a parameter into a
+//  register
+//-------------------------------------------------
+
+void drcbe_arm64::mov_reg_param(assembler &a, greg reg, be_parameter const &param)
+{
+	if (param.is_immediate())
+		mov_reg_imm(a, reg, reg.wide ? param.immediate() : uint32_t(param.immediate()));
+	else if (param.is_memory())
+		emit_mem(a, reg.wide ? LDST_LDRX : LDST_LDRW, reg.id, param.memory());          // ldr   reg,[param]
+	else if (param.is_int_register())
+		a.mov(reg, greg{ uint8_t(param.ireg()), reg.wide });                            // mov   reg,param
+}
+
+
+//-------------------------------------------------
+//  get_reg_param - return a register holding a
+//  parameter, loading it into the temporary if
+//  it isn't already in one
+//-------------------------------------------------
+
+greg drcbe_arm64::get_reg_param(assembler &a, greg temp, be_parameter const &param)
+{
+	if (param.is_int_register())
+		return greg{ uint8_t(param.ireg()), temp.wide };
+	mov_reg_param(a, temp, param);
+	return temp;
+}
+
+
+//-------------------------------------------------
+//  mov_param_reg - move a register into a
+//  parameter
+//-------------------------------------------------
+
+void drcbe_arm64::mov_param_reg(assembler &a, be_parameter const &param, greg reg)
+{
+	assert(!param.is_immediate());
+	if (param.is_memory())
+		emit_mem(a, reg.wide ? LDST_STRX : LDST_STRW, reg.id, param.memory());          // str   reg,[param]
+	else if (param.is_int_register())
+		a.mov(greg{ uint8_t(param.ireg()), reg.wide }, reg);                            // mov   param,reg
+}
+
+
+//-------------------------------------------------
+//  mov_freg_param - move a parameter into a
+//  floating point register
+//-------------------------------------------------
+
+void drcbe_arm64::mov_freg_param(assembler &a, vreg reg, be_parameter const &param)
+{
+	if (param.is_memory())
+		emit_mem(a, reg.dbl ? LDST_LDRD : LDST_LDRS, reg.id, param.memory());           // ldr   reg,[param]
+	else if (param.is_float_register())
+		a.fmov(reg, vreg{ uint8_t(param.freg()), reg.dbl });                            // fmov  reg,param
+}
+
+
+//-------------------------------------------------
+//  get_freg_param - return a floating point
+//  register holding a parameter
+//-------------------------------------------------
+
+vreg drcbe_arm64::get_freg_param(assembler &a, vreg temp, be_parameter const &param)
+{
+	if (param.is_float_register())
+		return vreg{ uint8_t(param.freg()), temp.dbl };
+	mov_freg_param(a, temp, param);
+	return temp;
+}
+
+
+//-------------------------------------------------
+//  mov_param_freg - move a floating point
+//  register into a parameter
+//-------------------------------------------------
+
+void drcbe_arm64::mov_param_freg(assembler &a, be_parameter const &param, vreg reg)
+{
+	if (param.is_memory())
+		emit_mem(a, reg.dbl ? LDST_STRD : LDST_STRS, reg.id, param.memory());           // str   reg,[param]
+	else if (param.is_float_register())
+		a.fmov(vreg{ uint8_t(param.freg()), reg.dbl }, reg);                            // fmov  param,reg
+}
+
+
+
+/***************************************************************************
+    DEBUG HELPERS
+***************************************************************************/
+
+//-------------------------------------------------
+//  debug_log_hashjmp - callback to handle
+//  logging of hashjmps
+//-------------------------------------------------
+
+void drcbe_arm64::debug_log_hashjmp(offs_t pc, int mode)
+{
+	printf("mode=%d PC=%08X\n", mode, pc);
+}
+
+
+//-------------------------------------------------
+//  debug_log_hashjmp_fail - callback to handle
+//  logging of hashjmps that fail
+//-------------------------------------------------
+
+void drcbe_arm64::debug_log_hashjmp_fail()
+{
+	printf("  (FAIL)\n");
+}
+
+
+
+
+/***************************************************************************
+    COMPILE-TIME OPCODES
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_handle - process a HANDLE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_handle(assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 1);
+	assert(inst.param(0).is_code_handle());
+
+	// emit a jump around the stack adjust in case code falls through here
+	int const skip = a.new_label();
+	a.b(skip);                                                                          // b     skip
+
+	// register the current pointer for the handle
+	inst.param(0).handle().set_codeptr(drccodeptr(a.ptr()));
+
+	// by default, the handle points to prolog code that saves the return address
+	a.ldst_pre(LDST_STRX, LR_REG.id, SP_REG, -16);                                      // str   x30,[sp,#-16]!
+	a.bind(skip);                                                                   // skip:
+}
+
+
+//-------------------------------------------------
+//  op_hash - process a HASH opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_hash(assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 2);
+	assert(inst.param(0).is_immediate());
+	assert(inst.param(1).is_immediate());
+
+	// register the current pointer for the mode/PC
+	m_hash.set_codeptr(inst.param(0).immediate(), inst.param(1).immediate(), drccodeptr(a.ptr()));
+}
+
+
+//-------------------------------------------------
+//  op_label - process a LABEL opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_label(assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 1);
+	assert(inst.param(0).is_code_label());
+
+	// register the current pointer for the label
+	a.bind(a.uml_label(inst.param(0).label()));
+}
+
+
+//-------------------------------------------------
+//  op_comment - process a COMMENT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_comment(assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 1);
+	assert(inst.param(0).is_string());
+
+	// do nothing
+}
+
+
+//-------------------------------------------------
+//  op_mapvar - process a MAPVAR opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_mapvar(assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 2);
+	assert(inst.param(0).is_mapvar());
+	assert(inst.param(1).is_immediate());
+
+	// set the value of the specified mapvar
+	m_map.set_value(drccodeptr(a.ptr()), inst.param(0).mapvar(), inst.param(1).immediate());
+}
+
+
+
+/***************************************************************************
+    CONTROL FLOW OPCODES
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_nop - process a NOP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_nop(assembler &a, const instruction &inst)
+{
+	// nothing
+}
+
+
+//-------------------------------------------------
+//  op_debug - process a DEBUG opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_debug(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	if ((m_device.machine().debug_flags & DEBUG_FLAG_ENABLED) != 0)
+	{
+		// normalize parameters
+		be_parameter pcp(*this, inst.param(0), PTYPE_MRI);
+
+		// test and branch
+		int const skip = a.new_label();
+		emit_mem(a, LDST_LDRW, TEMP_REG1.id, &m_device.machine().debug_flags);          // ldr   w9,[debug_flags]
+		a.logical(LOGIC_AND, TEMP_REG1.w(), TEMP_REG1.w(), DEBUG_FLAG_CALL_HOOK);       // and   w9,w9,#DEBUG_FLAG_CALL_HOOK
+		a.cbz(TEMP_REG1.w(), skip);                                                     // cbz   w9,skip
+
+		// push the parameter
+		mov_reg_imm(a, REG_PARAM1, uintptr_t(m_device.debug()));                        // mov   x0,device.debug
+		mov_reg_param(a, REG_PARAM2.w(), pcp);                                          // mov   w1,pcp
+		emit_call_mem(a, &m_near.debug_cpu_instruction_hook);                           // blr   debug_cpu_instruction_hook
+
+		a.bind(skip);                                                               // skip:
+	}
+}
+
+
+//-------------------------------------------------
+//  op_exit - process an EXIT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_exit(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter retp(*this, inst.param(0), PTYPE_MRI);
+
+	// load the parameter into W0 and exit
+	mov_reg_param(a, REG_PARAM1.w(), retp);                                             // mov   w0,retp
+	if (inst.condition() == uml::COND_ALWAYS)
+		emit_jump(a, m_exit);                                                           // b     exit
+	else if (a.in_range(m_exit, 0x100000))
+		a.b(ARM_CONDITION(inst.condition()), m_exit);                                   // b.cc  exit
+	else
+	{
+		int const skip = a.new_label();
+		a.b(ARM_NOT_CONDITION(inst.condition()), skip);                                 // b.!cc skip
+		emit_jump(a, m_exit);                                                           // b     exit
+		a.bind(skip);                                                               // skip:
+	}
+}
+
+
+//-------------------------------------------------
+//  op_hashjmp - process a HASHJMP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_hashjmp(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter modep(*this, inst.param(0), PTYPE_MRI);
+	be_parameter pcp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &exp = inst.param(2);
+	assert(exp.is_code_handle());
+
+	if (LOG_HASHJMPS)
+	{
+		mov_reg_param(a, REG_PARAM1.w(), pcp);
+		mov_reg_param(a, REG_PARAM2.w(), modep);
+		emit_call_mem(a, &m_near.debug_log_hashjmp);
+	}
+
+	// extract one level of the hash table index from the PC
+	auto const level_index = [&a] (greg dst, greg pc, unsigned shift, offs_t mask)
+	{
+		if (mask != 0)
+			a.ubfx(dst, pc, shift, 32 - count_leading_zeros(mask));                     // ubfx  dst,pc,#shift,#bits
+		else
+			a.movz(dst, 0);                                                             // mov   dst,#0
+	};
+
+	// load the level 2 entry from the level 1 table in TEMP_REG4, with an immediate PC
+	auto const load_immediate_pc = [this, &a] (uint32_t pc)
+	{
+		uint32_t const l1val = ((pc >> m_hash.l1shift()) & m_hash.l1mask()) * sizeof(void *);
+		uint32_t const l2val = ((pc >> m_hash.l2shift()) & m_hash.l2mask()) * sizeof(void *);
+		if (assembler::ldst_offset_ok(LDST_LDRX, l1val))
+			a.ldst(LDST_LDRX, TEMP_REG4.id, TEMP_REG4, l1val);                          // ldr   x12,[x12,#l1val]
+		else
+		{
+			mov_reg_imm(a, TEMP_REG2, l1val);
+			a.ldst(LDST_LDRX, TEMP_REG4.id, TEMP_REG4, TEMP_REG2, EXTEND_UXTX, false);  // ldr   x12,[x12,x10]
+		}
+		if (assembler::ldst_offset_ok(LDST_LDRX, l2val))
+			a.ldst(LDST_LDRX, SCRATCH_REG1.id, TEMP_REG4, l2val);                       // ldr   x16,[x12,#l2val]
+		else
+		{
+			mov_reg_imm(a, TEMP_REG3, l2val);
+			a.ldst(LDST_LDRX, SCRATCH_REG1.id, TEMP_REG4, TEMP_REG3, EXTEND_UXTX, false); // ldr   x16,[x12,x11]
+		}
+	};
+
+	// load the level 2 entry from the level 1 table in TEMP_REG4, with a PC in a register
+	auto const load_register_pc = [this, &a, &level_index] (greg pc)
+	{
+		level_index(TEMP_REG2.w(), pc, m_hash.l1shift(), m_hash.l1mask());
+		level_index(TEMP_REG3.w(), pc, m_hash.l2shift(), m_hash.l2mask());
+		a.ldst(LDST_LDRX, TEMP_REG4.id, TEMP_REG4, TEMP_REG2.w(), EXTEND_UXTW, true);   // ldr   x12,[x12,w10,uxtw #3]
+		a.ldst(LDST_LDRX, SCRATCH_REG1.id, TEMP_REG4, TEMP_REG3.w(), EXTEND_UXTW, true); // ldr   x16,[x12,w11,uxtw #3]
+	};
+
+	// reset the stack to the level it had on entry, since hash jumps never return
+	emit_mem(a, LDST_LDRX, SCRATCH_REG1.id, &m_near.stacksave);                         // ldr   x16,[stacksave]
+	a.add(SP_REG, SCRATCH_REG1, 0);                                                     // mov   sp,x16
+
+	// fixed mode cases
+	if (modep.is_immediate() && m_hash.is_mode_populated(modep.immediate()))
+	{
+		// a straight immediate jump is direct, though we need the PC in W9 in case of failure
+		if (pcp.is_immediate())
+		{
+			uint32_t const l1val = (pcp.immediate() >> m_hash.l1shift()) & m_hash.l1mask();
+			uint32_t const l2val = (pcp.immediate() >> m_hash.l2shift()) & m_hash.l2mask();
+			emit_mem(a, LDST_LDRX, SCRATCH_REG1.id, &m_hash.base()[modep.immediate()][l1val][l2val]); // ldr   x16,[l1val][l2val]
+		}
+
+		// a fixed mode but variable PC
+		else
+		{
+			greg const pcreg = get_reg_param(a, TEMP_REG1.w(), pcp);
+			emit_address(a, TEMP_REG4, &m_hash.base()[modep.immediate()][0]);             // add   x12,base[mode]
+			a.ldst(LDST_LDRX, TEMP_REG4.id, TEMP_REG4, 0);                              // ldr   x12,[x12]
+			load_register_pc(pcreg);
+		}
+	}
+
+	// variable mode cases
+	else
+	{
+		greg const modereg = get_reg_param(a, TEMP_REG5.w(), modep);
+		emit_address(a, TEMP_REG4, m_hash.base());                                      // add   x12,base
+		a.ldst(LDST_LDRX, TEMP_REG4.id, TEMP_REG4, modereg, EXTEND_UXTW, true);         // ldr   x12,[x12,mode,uxtw #3]
+
+		if (pcp.is_immediate())
+			load_immediate_pc(pcp.immediate());
+		else
+			load_register_pc(get_reg_param(a, TEMP_REG1.w(), pcp));
+	}
+	a.blr(SCRATCH_REG1);                                                                // blr   x16
+
+	// in all cases, if there is no code, we return here to generate the exception
+	if (LOG_HASHJMPS)
+		emit_call_mem(a, &m_near.debug_log_hashjmp_fail);
+
+	mov_reg_param(a, TEMP_REG1.w(), pcp);                                               // mov   w9,pcp
+	emit_mem(a, LDST_STRW, TEMP_REG1.id, &m_state.exp);                                 // str   w9,[exp]
+	emit_call_handle(a, exp.handle());                                                  // bl    exp
+}
+
+
+//-------------------------------------------------
+//  op_jmp - process a JMP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_jmp(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	const parameter &labelp = inst.param(0);
+	assert(labelp.is_code_label());
+
+	int const target = a.uml_label(labelp.label());
+	if (inst.condition() == uml::COND_ALWAYS)
+		a.b(target);                                                                    // b     target
+	else
+		a.b(ARM_CONDITION(inst.condition()), target);                                   // b.cc  target
+}
+
+
+//-------------------------------------------------
+//  op_exh - process an EXH opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_exh(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	const parameter &handp = inst.param(0);
+	assert(handp.is_code_handle());
+	be_parameter exp(*this, inst.param(1), PTYPE_MRI);
+
+	// perform the exception processing
+	int const no_exception = a.new_label();
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.b(ARM_NOT_CONDITION(inst.condition()), no_exception);                         // b.!cc no_exception
+	mov_reg_param(a, TEMP_REG1.w(), exp);                                               // mov   w9,exp
+	emit_mem(a, LDST_STRW, TEMP_REG1.id, &m_state.exp);                                 // str   w9,[exp]
+	emit_call_handle(a, handp.handle());                                                // bl    handle
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(no_exception);
+}
+
+
+//-------------------------------------------------
+//  op_callh - process a CALLH opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_callh(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	const parameter &handp = inst.param(0);
+	assert(handp.is_code_handle());
+
+	// skip if conditional
+	int const skip = a.new_label();
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.b(ARM_NOT_CONDITION(inst.condition()), skip);                                 // b.!cc skip
+
+	// jump through the handle; directly if a normal jump
+	emit_call_handle(a, handp.handle());                                                // bl    handle
+
+	// resolve the conditional link
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(skip);                                                               // skip:
+}
+
+
+//-------------------------------------------------
+//  op_ret - process a RET opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_ret(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 0);
+
+	// skip if conditional
+	int const skip = a.new_label();
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.b(ARM_NOT_CONDITION(inst.condition()), skip);                                 // b.!cc skip
+
+	// return
+	a.ldst_post(LDST_LDRX, LR_REG.id, SP_REG, 16);                                      // ldr   x30,[sp],#16
+	a.ret();                                                                            // ret
+
+	// resolve the conditional link
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(skip);                                                               // skip:
+}
+
+
+//-------------------------------------------------
+//  op_callc - process a CALLC opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_callc(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	const parameter &funcp = inst.param(0);
+	assert(funcp.is_c_function());
+	be_parameter paramp(*this, inst.param(1), PTYPE_M);
+
+	// skip if conditional
+	int const skip = a.new_label();
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.b(ARM_NOT_CONDITION(inst.condition()), skip);                                 // b.!cc skip
+
+	// perform the call
+	mov_reg_imm(a, REG_PARAM1, uintptr_t(paramp.memory()));                             // mov   x0,paramp
+	emit_call(a, (const void *)(uintptr_t)funcp.cfunc());                               // bl    funcp
+
+	// resolve the conditional link
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(skip);                                                               // skip:
+}
+
+
+//-------------------------------------------------
+//  op_recover - process a RECOVER opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_recover(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+
+	// call the recovery code with the return address saved by the outermost handle
+	emit_mem(a, LDST_LDRX, SCRATCH_REG1.id, &m_near.stacksave);                         // ldr   x16,[stacksave]
+	a.ldst_unscaled(LDST_LDRX, REG_PARAM2.id, SCRATCH_REG1, -16);                       // ldur  x1,[x16,#-16]
+	a.sub(REG_PARAM2, REG_PARAM2, 1);                                                   // sub   x1,x1,#1
+	mov_reg_imm(a, REG_PARAM1, uintptr_t(&m_map));                                      // mov   x0,m_map
+	mov_reg_imm(a, REG_PARAM3.w(), inst.param(1).mapvar());                             // mov   w2,param[1].value
+	emit_call_mem(a, &m_near.drcmap_get_value);                                         // blr   drcmap_get_value
+	mov_param_reg(a, dstp, REG_PARAM1.w());                                             // mov   dstp,w0
+}
+
+
+
+/***************************************************************************
+    INTERNAL REGISTER OPCODES
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_setfmod - process a SETFMOD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_setfmod(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter srcp(*this, inst.param(0), PTYPE_MRI);
+
+	// immediate case
+	if (srcp.is_immediate())
+		mov_reg_imm(a, TEMP_REG1.w(), srcp.immediate() & 3);                            // mov   w9,srcp & 3
+
+	// register/memory case
+	else
+	{
+		greg const srcreg = get_reg_param(a, TEMP_REG1.w(), srcp);
+		a.logical(LOGIC_AND, TEMP_REG1.w(), srcreg, 3);                                 // and   w9,srcp,#3
+	}
+	emit_mem(a, LDST_STRB, TEMP_REG1.id, &m_state.fmod);                                // strb  w9,[fmod]
+	emit_set_rounding(a, TEMP_REG1.w());
+}
+
+
+//-------------------------------------------------
+//  op_getfmod - process a GETFMOD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_getfmod(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	greg const dstreg = dstp.select_register(TEMP_REG1.w());
+
+	// fetch the current mode and store to the destination
+	emit_mem(a, LDST_LDRB, dstreg.id, &m_state.fmod);                                   // ldrb  dstreg,[fmod]
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_getexp - process a GETEXP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_getexp(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	greg const dstreg = dstp.select_register(TEMP_REG1.w());
+
+	// fetch the exception parameter and store to the destination
+	emit_mem(a, LDST_LDRW, dstreg.id, &m_state.exp);                                    // ldr   dstreg,[exp]
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_getflgs - process a GETFLGS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_getflgs(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter maskp(*this, inst.param(1), PTYPE_I);
+	assert(maskp.is_immediate());
+	greg const dstreg = dstp.select_register(TEMP_REG1.w());
+
+	// translate the host flags through the map, then mask
+	a.mrs_nzcv(TEMP_REG2);                                                              // mrs   x10,nzcv
+	a.lsr(TEMP_REG2.w(), TEMP_REG2.w(), 28);                                            // lsr   w10,w10,#28
+	emit_address(a, SCRATCH_REG1, &m_near.flagsmap[0]);                                 // add   x16,flagsmap
+	a.ldst(LDST_LDRB, dstreg.id, SCRATCH_REG1, TEMP_REG2.w(), EXTEND_UXTW, false);      // ldrb  dstreg,[x16,w10,uxtw]
+	if ((maskp.immediate() & 0x1f) != 0x1f)
+		logical_param(a, LOGIC_AND, dstreg, dstreg, be_parameter(maskp.immediate() & 0x1f)); // and   dstreg,dstreg,maskp
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_save - process a SAVE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_save(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+
+	// copy live state to the destination
+	mov_reg_imm(a, TEMP_REG1, uintptr_t(dstp.memory()));                                // mov   x9,dstp
+
+	// copy flags
+	a.mrs_nzcv(TEMP_REG2);                                                              // mrs   x10,nzcv
+	a.lsr(TEMP_REG2.w(), TEMP_REG2.w(), 28);                                            // lsr   w10,w10,#28
+	emit_address(a, SCRATCH_REG1, &m_near.flagsmap[0]);                                 // add   x16,flagsmap
+	a.ldst(LDST_LDRB, TEMP_REG2.id, SCRATCH_REG1, TEMP_REG2.w(), EXTEND_UXTW, false);   // ldrb  w10,[x16,w10,uxtw]
+	a.ldst(LDST_STRB, TEMP_REG2.id, TEMP_REG1, offsetof(drcuml_machine_state, flags));  // strb  w10,state->flags
+
+	// copy fmod and exp
+	emit_mem(a, LDST_LDRB, TEMP_REG2.id, &m_state.fmod);                                // ldrb  w10,[fmod]
+	a.ldst(LDST_STRB, TEMP_REG2.id, TEMP_REG1, offsetof(drcuml_machine_state, fmod));   // strb  w10,state->fmod
+	emit_mem(a, LDST_LDRW, TEMP_REG2.id, &m_state.exp);                                 // ldr   w10,[exp]
+	a.ldst(LDST_STRW, TEMP_REG2.id, TEMP_REG1, offsetof(drcuml_machine_state, exp));    // str   w10,state->exp
+
+	// copy integer registers
+	int regoffs = offsetof(drcuml_machine_state, r);
+	for (int regnum = 0; regnum < std::size(m_state.r); regnum++)
+	{
+		if (int_register_map[regnum] != 0)
+			a.ldst(LDST_STRX, int_register_map[regnum], TEMP_REG1, regoffs + 8 * regnum);
+		else
+		{
+			emit_mem(a, LDST_LDRX, TEMP_REG2.id, &m_state.r[regnum].d);
+			a.ldst(LDST_STRX, TEMP_REG2.id, TEMP_REG1, regoffs + 8 * regnum);
+		}
+	}
+
+	// copy FP registers
+	regoffs = offsetof(drcuml_machine_state, f);
+	for (int regnum = 0; regnum < std::size(m_state.f); regnum++)
+	{
+		if (float_register_map[regnum] != 0)
+			a.ldst(LDST_STRD, float_register_map[regnum], TEMP_REG1, regoffs + 8 * regnum);
+		else
+		{
+			emit_mem(a, LDST_LDRX, TEMP_REG2.id, &m_state.f[regnum].d);
+			a.ldst(LDST_STRX, TEMP_REG2.id, TEMP_REG1, regoffs + 8 * regnum);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  op_restore - process a RESTORE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_restore(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+
+	// normalize parameters
+	be_parameter srcp(*this, inst.param(0), PTYPE_M);
+
+	// copy live state from the destination
+	mov_reg_imm(a, TEMP_REG1, uintptr_t(srcp.memory()));                                // mov   x9,srcp
+
+	// copy integer registers
+	int regoffs = offsetof(drcuml_machine_state, r);
+	for (int regnum = 0; regnum < std::size(m_state.r); regnum++)
+	{
+		if (int_register_map[regnum] != 0)
+			a.ldst(LDST_LDRX, int_register_map[regnum], TEMP_REG1, regoffs + 8 * regnum);
+		else
+		{
+			a.ldst(LDST_LDRX, TEMP_REG2.id, TEMP_REG1, regoffs + 8 * regnum);
+			emit_mem(a, LDST_STRX, TEMP_REG2.id, &m_state.r[regnum].d);
+		}
+	}
+
+	// copy FP registers
+	regoffs = offsetof(drcuml_machine_state, f);
+	for (int regnum = 0; regnum < std::size(m_state.f); regnum++)
+	{
+		if (float_register_map[regnum] != 0)
+			a.ldst(LDST_LDRD, float_register_map[regnum], TEMP_REG1, regoffs + 8 * regnum);
+		else
+		{
+			a.ldst(LDST_LDRX, TEMP_REG2.id, TEMP_REG1, regoffs + 8 * regnum);
+			emit_mem(a, LDST_STRX, TEMP_REG2.id, &m_state.f[regnum].d);
+		}
+	}
+
+	// copy fmod and exp
+	a.ldst(LDST_LDRB, TEMP_REG2.id, TEMP_REG1, offsetof(drcuml_machine_state, fmod));   // ldrb  w10,state->fmod
+	a.logical(LOGIC_AND, TEMP_REG2.w(), TEMP_REG2.w(), 3);                              // and   w10,w10,#3
+	emit_mem(a, LDST_STRB, TEMP_REG2.id, &m_state.fmod);                                // strb  w10,[fmod]
+	emit_set_rounding(a, TEMP_REG2.w());
+	a.ldst(LDST_LDRW, TEMP_REG2.id, TEMP_REG1, offsetof(drcuml_machine_state, exp));    // ldr   w10,state->exp
+	emit_mem(a, LDST_STRW, TEMP_REG2.id, &m_state.exp);                                 // str   w10,[exp]
+
+	// copy flags
+	a.ldst(LDST_LDRB, TEMP_REG2.id, TEMP_REG1, offsetof(drcuml_machine_state, flags));  // ldrb  w10,state->flags
+	a.logical(LOGIC_AND, TEMP_REG2.w(), TEMP_REG2.w(), 0x1f);                           // and   w10,w10,#0x1f
+	emit_address(a, SCRATCH_REG1, &m_near.flagsunmap[0]);                               // add   x16,flagsunmap
+	a.ldst(LDST_LDRW, TEMP_REG2.id, SCRATCH_REG1, TEMP_REG2.w(), EXTEND_UXTW, true);    // ldr   w10,[x16,w10,uxtw #2]
+	a.msr_nzcv(TEMP_REG2);                                                              // msr   nzcv,x10
+}
+
+
+
+/***************************************************************************
+    INTEGER OPERATIONS
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_load - process a LOAD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_load(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter basep(*this, inst.param(1), PTYPE_M);
+	be_parameter indp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &scalesizep = inst.param(3);
+	assert(scalesizep.is_size_scale());
+	int const size = scalesizep.size();
+
+	// narrow loads zero-extend, so the full register can be used for any size
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(inst.size() == 8));
+	emit_indexed(a, load_op[size], dstreg.id, basep.memory(), indp, scalesizep.scale()); // ldr   dstreg,[basep + indp]
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_loads - process a LOADS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_loads(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter basep(*this, inst.param(1), PTYPE_M);
+	be_parameter indp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &scalesizep = inst.param(3);
+	assert(scalesizep.is_size_scale());
+	int const size = scalesizep.size();
+	bool const wide = inst.size() == 8;
+
+	// pick the sign-extending load for the size
+	uint32_t op;
+	switch (size)
+	{
+		case SIZE_BYTE:     op = wide ? LDST_LDRSBX : LDST_LDRSBW;  break;
+		case SIZE_WORD:     op = wide ? LDST_LDRSHX : LDST_LDRSHW;  break;
+		case SIZE_DWORD:    op = wide ? LDST_LDRSW : LDST_LDRW;     break;
+		default:            op = LDST_LDRX;                         break;
+	}
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	emit_indexed(a, op, dstreg.id, basep.memory(), indp, scalesizep.scale());          // ldrs  dstreg,[basep + indp]
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_store - process a STORE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_store(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter basep(*this, inst.param(0), PTYPE_M);
+	be_parameter indp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &scalesizep = inst.param(3);
+	assert(scalesizep.is_size_scale());
+	int const size = scalesizep.size();
+
+	// stores of zero can use the zero register directly
+	greg const srcreg = srcp.is_immediate_value(0) ? ZR_REG : get_reg_param(a, TEMP_REG1.sized(inst.size() == 8), srcp);
+	emit_indexed(a, store_op[size], srcreg.id, basep.memory(), indp, scalesizep.scale()); // str   srcreg,[basep + indp]
+}
+
+
+//-------------------------------------------------
+//  op_read - process a READ opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_read(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter addrp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(2);
+	assert(spacesizep.is_size_space());
+
+	auto const &accessors = m_accessors[spacesizep.space()];
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(inst.size() == 8));
+
+	// set up a call to the read handler
+	mov_reg_imm(a, REG_PARAM1, uintptr_t(m_space[spacesizep.space()]));                 // mov   x0,space
+	mov_reg_param(a, REG_PARAM2.w(), addrp);                                            // mov   w1,addrp
+
+	// the upper bits of narrow return values are unspecified, so extend them explicitly
+	if (spacesizep.size() == SIZE_BYTE)
+	{
+		emit_call_mem(a, &accessors.read_byte);                                         // blr   read_byte
+		a.uxtb(dstreg, REG_PARAM1);                                                     // uxtb  dstreg,w0
+	}
+	else if (spacesizep.size() == SIZE_WORD)
+	{
+		emit_call_mem(a, &accessors.read_word);                                         // blr   read_word
+		a.uxth(dstreg, REG_PARAM1);                                                     // uxth  dstreg,w0
+	}
+	else if (spacesizep.size() == SIZE_DWORD)
+	{
+		emit_call_mem(a, &accessors.read_dword);                                        // blr   read_dword
+		a.mov(dstreg.w(), REG_PARAM1.w());                                              // mov   dstreg,w0
+	}
+	else if (spacesizep.size() == SIZE_QWORD)
+	{
+		emit_call_mem(a, &accessors.read_qword);                                        // blr   read_qword
+		a.mov(dstreg, REG_PARAM1.sized(dstreg.wide));                                   // mov   dstreg,x0
+	}
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_readm - process a READM opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_readm(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter addrp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter maskp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(3);
+	assert(spacesizep.is_size_space());
+
+	auto const &accessors = m_accessors[spacesizep.space()];
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(inst.size() == 8));
+
+	// set up a call to the read handler
+	mov_reg_imm(a, REG_PARAM1, uintptr_t(m_space[spacesizep.space()]));                 // mov   x0,space
+	mov_reg_param(a, REG_PARAM2.w(), addrp);                                            // mov   w1,addrp
+	mov_reg_param(a, REG_PARAM3.sized(spacesizep.size() == SIZE_QWORD), maskp);          // mov   w2,maskp
+	if (spacesizep.size() == SIZE_WORD)
+	{
+		emit_call_mem(a, &accessors.read_word_masked);                                  // blr   read_word_masked
+		a.uxth(dstreg, REG_PARAM1);                                                     // uxth  dstreg,w0
+	}
+	else if (spacesizep.size() == SIZE_DWORD)
+	{
+		emit_call_mem(a, &accessors.read_dword_masked);                                 // blr   read_dword_masked
+		a.mov(dstreg.w(), REG_PARAM1.w());                                              // mov   dstreg,w0
+	}
+	else if (spacesizep.size() == SIZE_QWORD)
+	{
+		emit_call_mem(a, &accessors.read_qword_masked);                                 // blr   read_qword_masked
+		a.mov(dstreg, REG_PARAM1.sized(dstreg.wide));                                   // mov   dstreg,x0
+	}
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_write - process a WRITE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_write(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter addrp(*this, inst.param(0), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(2);
+	assert(spacesizep.is_size_space());
+
+	auto const &accessors = m_accessors[spacesizep.space()];
+
+	// set up a call to the write handler
+	mov_reg_imm(a, REG_PARAM1, uintptr_t(m_space[spacesizep.space()]));                 // mov   x0,space
+	mov_reg_param(a, REG_PARAM2.w(), addrp);                                            // mov   w1,addrp
+	mov_reg_param(a, REG_PARAM3.sized(spacesizep.size() == SIZE_QWORD), srcp);           // mov   w2,srcp
+	if (spacesizep.size() == SIZE_BYTE)
+		emit_call_mem(a, &accessors.write_byte);                                        // blr   write_byte
+	else if (spacesizep.size() == SIZE_WORD)
+		emit_call_mem(a, &accessors.write_word);                                        // blr   write_word
+	else if (spacesizep.size() == SIZE_DWORD)
+		emit_call_mem(a, &accessors.write_dword);                                       // blr   write_dword
+	else if (spacesizep.size() == SIZE_QWORD)
+		emit_call_mem(a, &accessors.write_qword);                                       // blr   write_qword
+}
+
+
+//-------------------------------------------------
+//  op_writem - process a WRITEM opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_writem(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter addrp(*this, inst.param(0), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter maskp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(3);
+	assert(spacesizep.is_size_space());
+
+	auto const &accessors = m_accessors[spacesizep.space()];
+	bool const wide = spacesizep.size() == SIZE_QWORD;
+
+	// set up a call to the write handler
+	mov_reg_imm(a, REG_PARAM1, uintptr_t(m_space[spacesizep.space()]));                 // mov   x0,space
+	mov_reg_param(a, REG_PARAM2.w(), addrp);                                            // mov   w1,addrp
+	mov_reg_param(a, REG_PARAM3.sized(wide), srcp);                                     // mov   w2,srcp
+	mov_reg_param(a, REG_PARAM4.sized(wide), maskp);                                    // mov   w3,maskp
+	if (spacesizep.size() == SIZE_WORD)
+		emit_call_mem(a, &accessors.write_word_masked);                                 // blr   write_word_masked
+	else if (spacesizep.size() == SIZE_DWORD)
+		emit_call_mem(a, &accessors.write_dword_masked);                                // blr   write_dword_masked
+	else if (spacesizep.size() == SIZE_QWORD)
+		emit_call_mem(a, &accessors.write_qword_masked);                                // blr   write_qword_masked
+}
+
+
+//-------------------------------------------------
+//  op_carry - process a CARRY opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_carry(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C);
+
+	// normalize parameters
+	be_parameter srcp(*this, inst.param(0), PTYPE_MRI);
+	be_parameter bitp(*this, inst.param(1), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+	unsigned const width = inst.size() * 8;
+
+	// immediate source and bit
+	if (srcp.is_immediate() && bitp.is_immediate())
+	{
+		mov_reg_imm(a, TEMP_REG1.w(), BIT(srcp.immediate(), bitp.immediate() & (width - 1))); // mov   w9,bit
+		emit_set_carry(a, TEMP_REG1);
+	}
+
+	// immediate bit
+	else if (bitp.is_immediate())
+	{
+		unsigned const bit = bitp.immediate() & (width - 1);
+		greg const srcreg = get_reg_param(a, TEMP_REG1.sized(wide), srcp);
+		if (bit != 0)
+		{
+			a.lsr(TEMP_REG1.sized(wide), srcreg, bit);                                  // lsr   x9,srcreg,#bit
+			emit_set_carry(a, TEMP_REG1);
+		}
+		else
+			emit_set_carry(a, srcreg);
+	}
+
+	// variable bit; the shift count is implicitly masked to the operand width
+	else
+	{
+		greg const bitreg = get_reg_param(a, TEMP_REG2.sized(wide), bitp);
+		greg const srcreg = get_reg_param(a, TEMP_REG1.sized(wide), srcp);
+		a.lsrv(TEMP_REG1.sized(wide), srcreg, bitreg);                                  // lsr   x9,srcreg,bitreg
+		emit_set_carry(a, TEMP_REG1);
+	}
+}
+
+
+//-------------------------------------------------
+//  op_set - process a SET opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_set(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(inst.size() == 8));
+
+	// always condition means 1
+	if (inst.condition() == uml::COND_ALWAYS)
+		a.movz(dstreg, 1);                                                              // mov   dstreg,#1
+	else
+		a.cset(dstreg, ARM_CONDITION(inst.condition()));                                // cset  dstreg,cc
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_mov - process a MOV opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_mov(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+
+	// a conditional move to a register is a select, which leaves the flags alone
+	if (inst.condition() != uml::COND_ALWAYS && dstp.is_int_register())
+	{
+		greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+		greg const srcreg = srcp.is_immediate_value(0) ? ZR_REG.sized(wide) : get_reg_param(a, TEMP_REG1.sized(wide), srcp);
+		a.csel(dstreg, srcreg, dstreg, ARM_CONDITION(inst.condition()));               // csel  dstreg,srcreg,dstreg,cc
+		return;
+	}
+
+	// skip if conditional
+	int const skip = a.new_label();
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.b(ARM_NOT_CONDITION(inst.condition()), skip);                                 // b.!cc skip
+
+	// stores of zero can use the zero register directly
+	if (dstp.is_memory() && srcp.is_immediate_value(0))
+		mov_param_reg(a, dstp, ZR_REG.sized(wide));                                     // str   zr,[dstp]
+	else
+	{
+		greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+		mov_reg_param(a, dstreg, srcp);                                                 // mov   dstreg,srcp
+		mov_param_reg(a, dstp, dstreg);                                                 // mov   dstp,dstreg
+	}
+
+	// resolve the jump
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(skip);                                                               // skip:
+}
+
+
+//-------------------------------------------------
+//  op_sext - process a SEXT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_sext(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_S | FLAG_Z);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &sizep = inst.param(2);
+	assert(sizep.is_size());
+	bool const wide = inst.size() == 8;
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+
+	// memory can be loaded with a sign-extending load
+	if (srcp.is_memory())
+	{
+		uint32_t op;
+		switch (sizep.size())
+		{
+			case SIZE_BYTE:     op = wide ? LDST_LDRSBX : LDST_LDRSBW;  break;
+			case SIZE_WORD:     op = wide ? LDST_LDRSHX : LDST_LDRSHW;  break;
+			case SIZE_DWORD:    op = wide ? LDST_LDRSW : LDST_LDRW;     break;
+			default:            op = LDST_LDRX;                         break;
+		}
+		emit_mem(a, op, dstreg.id, srcp.memory());                                      // ldrs  dstreg,[srcp]
+	}
+
+	// immediates are extended at compile time
+	else if (srcp.is_immediate())
+	{
+		int64_t value;
+		switch (sizep.size())
+		{
+			case SIZE_BYTE:     value = int8_t(srcp.immediate());   break;
+			case SIZE_WORD:     value = int16_t(srcp.immediate());  break;
+			case SIZE_DWORD:    value = int32_t(srcp.immediate());  break;
+			default:            value = srcp.immediate();           break;
+		}
+		mov_reg_imm(a, dstreg, value);                                                  // mov   dstreg,#value
+	}
+
+	// registers use the extend instructions
+	else
+	{
+		greg const srcreg = greg{ uint8_t(srcp.ireg()), wide };
+		switch (sizep.size())
+		{
+			case SIZE_BYTE:     a.sxtb(dstreg, srcreg);                 break;          // sxtb  dstreg,srcreg
+			case SIZE_WORD:     a.sxth(dstreg, srcreg);                 break;          // sxth  dstreg,srcreg
+			case SIZE_DWORD:
+				if (wide)
+					a.sxtw(dstreg, srcreg);                                             // sxtw  dstreg,srcreg
+				else
+					a.mov(dstreg, srcreg);                                              // mov   dstreg,srcreg
+				break;
+			default:            a.mov(dstreg, srcreg);                  break;          // mov   dstreg,srcreg
+		}
+	}
+
+	if (inst.flags() != 0)
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_roland - process an ROLAND opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_roland(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_S | FLAG_Z);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+	be_parameter maskp(*this, inst.param(3), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+	unsigned const width = inst.size() * 8;
+	uint64_t const sizemask = wide ? ~uint64_t(0) : 0xffffffffU;
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const srcreg = get_reg_param(a, TEMP_REG2.sized(wide), srcp);
+
+	// a right-aligned field is a single bitfield extract
+	unsigned lsb, bits;
+	if (shiftp.is_immediate() && maskp.is_immediate() && contiguous_mask(maskp.immediate() & sizemask, lsb, bits) && lsb == 0)
+	{
+		unsigned const srclsb = (width - (shiftp.immediate() & (width - 1))) & (width - 1);
+		if (srclsb + bits <= width)
+		{
+			a.ubfx(dstreg, srcreg, srclsb, bits);                                       // ubfx  dstreg,srcreg,#lsb,#bits
+			if (inst.flags() != 0)
+				a.tst(dstreg, dstreg);                                                  // tst   dstreg,dstreg
+			mov_param_reg(a, dstp, dstreg);                                             // mov   dstp,dstreg
+			return;
+		}
+	}
+
+	// rotate into a temporary, since the mask may be in the destination register
+	greg rotreg = srcreg;
+	if (shiftp.is_immediate())
+	{
+		unsigned const shift = shiftp.immediate() & (width - 1);
+		if (shift != 0)
+		{
+			rotreg = TEMP_REG2.sized(wide);
+			a.ror(rotreg, srcreg, width - shift);                                       // ror   x10,srcreg,#(width - shift)
+		}
+	}
+	else
+	{
+		greg const shiftreg = get_reg_param(a, TEMP_REG3.sized(wide), shiftp);
+		rotreg = TEMP_REG2.sized(wide);
+		a.neg(TEMP_REG3.sized(wide), shiftreg);                                         // neg   x11,shiftreg
+		a.rorv(rotreg, srcreg, TEMP_REG3.sized(wide));                                  // ror   x10,srcreg,x11
+	}
+
+	logical_param(a, inst.flags() ? LOGIC_ANDS : LOGIC_AND, dstreg, rotreg, maskp);     // and   dstreg,x10,maskp
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_rolins - process an ROLINS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_rolins(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_S | FLAG_Z);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+	be_parameter maskp(*this, inst.param(3), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+	unsigned const width = inst.size() * 8;
+	uint64_t const sizemask = wide ? ~uint64_t(0) : 0xffffffffU;
+
+	greg const srcreg = get_reg_param(a, TEMP_REG2.sized(wide), srcp);
+
+	// a contiguous mask whose field starts at bit 0 of either side is a single bitfield insert
+	unsigned lsb, bits;
+	if (shiftp.is_immediate() && maskp.is_immediate() && contiguous_mask(maskp.immediate() & sizemask, lsb, bits))
+	{
+		unsigned const shift = shiftp.immediate() & (width - 1);
+		unsigned const srclsb = (lsb - shift) & (width - 1);
+		if (srclsb == 0 || (lsb == 0 && srclsb + bits <= width))
+		{
+			greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+			mov_reg_param(a, dstreg, dstp);                                             // mov   dstreg,dstp
+			if (srclsb == 0)
+				a.bfi(dstreg, srcreg, lsb, bits);                                       // bfi   dstreg,srcreg,#lsb,#bits
+			else
+				a.bfxil(dstreg, srcreg, srclsb, bits);                                  // bfxil dstreg,srcreg,#lsb,#bits
+			if (inst.flags() != 0)
+				a.tst(dstreg, dstreg);                                                  // tst   dstreg,dstreg
+			mov_param_reg(a, dstp, dstreg);                                             // mov   dstp,dstreg
+			return;
+		}
+	}
+
+	// rotate the source into a temporary
+	greg rotreg = srcreg;
+	if (shiftp.is_immediate())
+	{
+		unsigned const shift = shiftp.immediate() & (width - 1);
+		if (shift != 0)
+		{
+			rotreg = TEMP_REG2.sized(wide);
+			a.ror(rotreg, srcreg, width - shift);                                       // ror   x10,srcreg,#(width - shift)
+		}
+	}
+	else
+	{
+		greg const shiftreg = get_reg_param(a, TEMP_REG3.sized(wide), shiftp);
+		rotreg = TEMP_REG2.sized(wide);
+		a.neg(TEMP_REG3.sized(wide), shiftreg);                                         // neg   x11,shiftreg
+		a.rorv(rotreg, srcreg, TEMP_REG3.sized(wide));                                  // ror   x10,srcreg,x11
+	}
+
+	// merge under the mask
+	greg const maskreg = get_reg_param(a, TEMP_REG4.sized(wide), maskp);
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	mov_reg_param(a, dstreg, dstp);                                                     // mov   dstreg,dstp
+	a.logical(LOGIC_AND, TEMP_REG2.sized(wide), rotreg, maskreg);                       // and   x10,x10,maskreg
+	a.logical(LOGIC_BIC, dstreg, dstreg, maskreg);                                      // bic   dstreg,dstreg,maskreg
+	a.logical(LOGIC_ORR, dstreg, dstreg, TEMP_REG2.sized(wide));                       // orr   dstreg,dstreg,x10
+	if (inst.flags() != 0)
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_add - process a ADD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_add(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+	if (src1p.is_immediate() && !src2p.is_immediate())
+		std::swap(src1p, src2p);
+	bool const wide = inst.size() == 8;
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const src1reg = get_reg_param(a, TEMP_REG2.sized(wide), src1p);
+	add_param(a, false, inst.flags() != 0, dstreg, src1reg, src2p);                     // adds  dstreg,src1reg,src2p
+	if (inst.flags() & FLAG_C)
+		emit_invert_carry(a);
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_addc - process a ADDC opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_addc(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const src1reg = get_reg_param(a, TEMP_REG2.sized(wide), src1p);
+	greg const src2reg = get_reg_param(a, TEMP_REG3.sized(wide), src2p);
+
+	// ADC wants the carry in the host sense
+	emit_invert_carry(a);
+	if (inst.flags() != 0)
+		a.adcs(dstreg, src1reg, src2reg);                                               // adcs  dstreg,src1reg,src2reg
+	else
+		a.adc(dstreg, src1reg, src2reg);                                                // adc   dstreg,src1reg,src2reg
+	if (inst.flags() & FLAG_C)
+		emit_invert_carry(a);
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_sub - process a SUB opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_sub(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+
+	// subtracting from zero is a negate
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const src1reg = src1p.is_immediate_value(0) ? ZR_REG.sized(wide) : get_reg_param(a, TEMP_REG2.sized(wide), src1p);
+	if (src1reg.id == ZR_REG.id)
+	{
+		greg const src2reg = get_reg_param(a, TEMP_REG3.sized(wide), src2p);
+		a.addsub(true, inst.flags() != 0, dstreg, src1reg, src2reg);                    // negs  dstreg,src2reg
+	}
+	else
+		add_param(a, true, inst.flags() != 0, dstreg, src1reg, src2p);                  // subs  dstreg,src1reg,src2p
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_subc - process a SUBC opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_subc(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const src1reg = get_reg_param(a, TEMP_REG2.sized(wide), src1p);
+	greg const src2reg = get_reg_param(a, TEMP_REG3.sized(wide), src2p);
+
+	// the host borrow already has the UML sense
+	if (inst.flags() != 0)
+		a.sbcs(dstreg, src1reg, src2reg);                                               // sbcs  dstreg,src1reg,src2reg
+	else
+		a.sbc(dstreg, src1reg, src2reg);                                                // sbc   dstreg,src1reg,src2reg
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_cmp - process a CMP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_cmp(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter src1p(*this, inst.param(0), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(1), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+
+	greg const src1reg = get_reg_param(a, TEMP_REG2.sized(wide), src1p);
+	add_param(a, true, true, ZR_REG.sized(wide), src1reg, src2p);                       // cmp   src1reg,src2p
+}
+
+
+//-------------------------------------------------
+//  emit_mul - generate code for MULU and MULS
+//-------------------------------------------------
+
+void drcbe_arm64::emit_mul(assembler &a, const instruction &inst, bool issigned)
+{
+	uint8_t const zsflags = inst.flags() & (FLAG_Z | FLAG_S);
+	uint8_t const vflag = inst.flags() & FLAG_V;
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter edstp(*this, inst.param(1), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(2), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(3), PTYPE_MRI);
+	bool const compute_hi = (dstp != edstp);
+	bool const wide = inst.size() == 8;
+
+	greg const src1reg = get_reg_param(a, TEMP_REG2.sized(wide), src1p);
+	greg const src2reg = get_reg_param(a, TEMP_REG3.sized(wide), src2p);
+	greg const lo = TEMP_REG1;
+	greg const hi = TEMP_REG4;
+	greg const overflow = TEMP_REG5;
+
+	if (!wide)
+	{
+		// the whole 64-bit product fits in one register
+		if (issigned)
+			a.smull(lo, src1reg, src2reg);                                              // smull x9,src1reg,src2reg
+		else
+			a.umull(lo, src1reg, src2reg);                                              // umull x9,src1reg,src2reg
+		if (compute_hi)
+			a.lsr(hi, lo, 32);                                                          // lsr   x12,x9,#32
+
+		// overflow if the product doesn't fit in 32 bits
+		if (vflag)
+		{
+			a.cmp(lo, lo.w(), issigned ? EXTEND_SXTW : EXTEND_UXTW);                    // cmp   x9,w9,sxtw
+			a.cset(overflow.w(), ARM_NE);                                               // cset  w13,ne
+		}
+		if (zsflags || vflag)
+		{
+			if (compute_hi)
+				a.tst(lo, lo);                                                          // tst   x9,x9
+			else
+				a.tst(lo.w(), lo.w());                                                  // tst   w9,w9
+		}
+	}
+	else
+	{
+		a.mul(lo, src1reg, src2reg);                                                    // mul   x9,src1reg,src2reg
+		if (compute_hi || vflag)
+		{
+			if (issigned)
+				a.smulh(hi, src1reg, src2reg);                                          // smulh x12,src1reg,src2reg
+			else
+				a.umulh(hi, src1reg, src2reg);                                          // umulh x12,src1reg,src2reg
+		}
+
+		// overflow if the high half isn't just the extension of the low half
+		if (vflag)
+		{
+			if (issigned)
+				a.cmp(hi, lo, SHIFT_ASR, 63);                                           // cmp   x12,x9,asr #63
+			else
+				a.cmp(hi, 0);                                                           // cmp   x12,#0
+			a.cset(overflow.w(), ARM_NE);                                               // cset  w13,ne
+		}
+
+		// with a high half, Z covers all 128 bits and S comes from the top
+		if (zsflags || vflag)
+		{
+			if (compute_hi)
+			{
+				a.cmp(lo, 0);                                                           // cmp   x9,#0
+				a.cset(TEMP_REG6, ARM_NE);                                              // cset  x14,ne
+				a.orr(TEMP_REG6, hi, TEMP_REG6);                                        // orr   x14,x12,x14
+				a.tst(TEMP_REG6, TEMP_REG6);                                            // tst   x14,x14
+			}
+			else
+				a.tst(lo, lo);                                                          // tst   x9,x9
+		}
+	}
+	if (vflag)
+		emit_set_overflow(a, overflow);
+
+	mov_param_reg(a, dstp, lo.sized(wide));                                             // mov   dstp,lo
+	if (compute_hi)
+		mov_param_reg(a, edstp, hi.sized(wide));                                        // mov   edstp,hi
+}
+
+
+//-------------------------------------------------
+//  op_mulu - process a MULU opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_mulu(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_V | FLAG_Z | FLAG_S);
+
+	emit_mul(a, inst, false);
+}
+
+
+//-------------------------------------------------
+//  op_muls - process a MULS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_muls(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_V | FLAG_Z | FLAG_S);
+
+	emit_mul(a, inst, true);
+}
+
+
+//-------------------------------------------------
+//  emit_div - generate code for DIVU and DIVS
+//-------------------------------------------------
+
+void drcbe_arm64::emit_div(assembler &a, const instruction &inst, bool issigned)
+{
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter edstp(*this, inst.param(1), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(2), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(3), PTYPE_MRI);
+	bool const compute_rem = (dstp != edstp);
+	bool const wide = inst.size() == 8;
+
+	greg const src1reg = get_reg_param(a, TEMP_REG2.sized(wide), src1p);
+	greg const src2reg = get_reg_param(a, TEMP_REG3.sized(wide), src2p);
+	greg const quotient = TEMP_REG1.sized(wide);
+	greg const remainder = TEMP_REG4.sized(wide);
+
+	// dividing by zero leaves the destinations alone and sets only V
+	int const skip = a.new_label();
+	if (inst.flags() != 0)
+	{
+		a.movz(SCRATCH_REG2.w(), NZCV_V >> 16, 16);                                     // mov   w17,#V
+		a.msr_nzcv(SCRATCH_REG2);                                                       // msr   nzcv,x17
+	}
+	a.cbz(src2reg, skip);                                                               // cbz   src2reg,skip
+
+	if (issigned)
+		a.sdiv(quotient, src1reg, src2reg);                                             // sdiv  x9,src1reg,src2reg
+	else
+		a.udiv(quotient, src1reg, src2reg);                                             // udiv  x9,src1reg,src2reg
+	if (compute_rem)
+		a.msub(remainder, quotient, src2reg, src1reg);                                  // msub  x12,x9,src2reg,src1reg
+	if (inst.flags() != 0)
+		a.tst(quotient, quotient);                                                      // tst   x9,x9
+
+	mov_param_reg(a, dstp, quotient);                                                   // mov   dstp,x9
+	if (compute_rem)
+		mov_param_reg(a, edstp, remainder);                                             // mov   edstp,x12
+
+	a.bind(skip);                                                                   // skip:
+}
+
+
+//-------------------------------------------------
+//  op_divu - process a DIVU opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_divu(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_V | FLAG_Z | FLAG_S);
+
+	emit_div(a, inst, false);
+}
+
+
+//-------------------------------------------------
+//  op_divs - process a DIVS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_divs(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_V | FLAG_Z | FLAG_S);
+
+	emit_div(a, inst, true);
+}
+
+
+//-------------------------------------------------
+//  op_and - process a AND opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_and(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+	if (src1p.is_immediate() && !src2p.is_immediate())
+		std::swap(src1p, src2p);
+	bool const wide = inst.size() == 8;
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const src1reg = get_reg_param(a, TEMP_REG2.sized(wide), src1p);
+	logical_param(a, inst.flags() ? LOGIC_ANDS : LOGIC_AND, dstreg, src1reg, src2p);    // ands  dstreg,src1reg,src2p
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_test - process a TEST opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_test(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter src1p(*this, inst.param(0), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(1), PTYPE_MRI);
+	if (src1p.is_immediate() && !src2p.is_immediate())
+		std::swap(src1p, src2p);
+	bool const wide = inst.size() == 8;
+
+	greg const src1reg = get_reg_param(a, TEMP_REG2.sized(wide), src1p);
+	logical_param(a, LOGIC_ANDS, ZR_REG.sized(wide), src1reg, src2p);                   // tst   src1reg,src2p
+}
+
+
+//-------------------------------------------------
+//  op_or - process a OR opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_or(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+	if (src1p.is_immediate() && !src2p.is_immediate())
+		std::swap(src1p, src2p);
+	bool const wide = inst.size() == 8;
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const src1reg = get_reg_param(a, TEMP_REG2.sized(wide), src1p);
+	logical_param(a, LOGIC_ORR, dstreg, src1reg, src2p);                                // orr   dstreg,src1reg,src2p
+	if (inst.flags() != 0)
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_xor - process a XOR opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_xor(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+	if (src1p.is_immediate() && !src2p.is_immediate())
+		std::swap(src1p, src2p);
+	bool const wide = inst.size() == 8;
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const src1reg = get_reg_param(a, TEMP_REG2.sized(wide), src1p);
+	logical_param(a, LOGIC_EOR, dstreg, src1reg, src2p);                                // eor   dstreg,src1reg,src2p
+	if (inst.flags() != 0)
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_lzcnt - process a LZCNT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_lzcnt(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const srcreg = get_reg_param(a, TEMP_REG2.sized(wide), srcp);
+	a.clz(dstreg, srcreg);                                                              // clz   dstreg,srcreg
+	if (inst.flags() != 0)
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_tzcnt - process a TZCNT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_tzcnt(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+
+	// Z is set when the source is zero; test it before the destination can overwrite it
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const srcreg = get_reg_param(a, TEMP_REG2.sized(wide), srcp);
+	if (inst.flags() != 0)
+		a.tst(srcreg, srcreg);                                                          // tst   srcreg,srcreg
+	a.rbit(dstreg, srcreg);                                                             // rbit  dstreg,srcreg
+	a.clz(dstreg, dstreg);                                                              // clz   dstreg,dstreg
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_bswap - process a BSWAP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_bswap(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const srcreg = get_reg_param(a, TEMP_REG2.sized(wide), srcp);
+	a.rev(dstreg, srcreg);                                                              // rev   dstreg,srcreg
+	if (inst.flags() != 0)
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_shift - process a SHL/SHR/SAR/ROL/ROR
+//  opcode
+//-------------------------------------------------
+
+template <uml::opcode_t Opcode> void drcbe_arm64::op_shift(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+	unsigned const width = inst.size() * 8;
+	bool const carry = (inst.flags() & FLAG_C) != 0;
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const srcreg = get_reg_param(a, TEMP_REG2.sized(wide), srcp);
+	greg carryreg = TEMP_REG7.sized(wide);
+
+	if (shiftp.is_immediate())
+	{
+		// a zero count moves the value and leaves the flags alone
+		unsigned const shift = shiftp.immediate() & (width - 1);
+		if (shift == 0)
+		{
+			a.mov(dstreg, srcreg);                                                      // mov   dstreg,srcreg
+			mov_param_reg(a, dstp, dstreg);                                             // mov   dstp,dstreg
+			return;
+		}
+
+		// extract the last bit shifted out before the source can be overwritten
+		if (carry && Opcode == uml::OP_SHL)
+			a.ubfx(carryreg, srcreg, width - shift, 1);                                 // ubfx  x15,srcreg,#(width - shift),#1
+		else if (carry && (Opcode == uml::OP_SHR || Opcode == uml::OP_SAR))
+			a.ubfx(carryreg, srcreg, shift - 1, 1);                                     // ubfx  x15,srcreg,#(shift - 1),#1
+
+		switch (Opcode)
+		{
+			case uml::OP_SHL:   a.lsl(dstreg, srcreg, shift);           break;          // lsl   dstreg,srcreg,#shift
+			case uml::OP_SHR:   a.lsr(dstreg, srcreg, shift);           break;          // lsr   dstreg,srcreg,#shift
+			case uml::OP_SAR:   a.asr(dstreg, srcreg, shift);           break;          // asr   dstreg,srcreg,#shift
+			case uml::OP_ROL:   a.ror(dstreg, srcreg, width - shift);   break;          // ror   dstreg,srcreg,#(width - shift)
+			case uml::OP_ROR:   a.ror(dstreg, srcreg, shift);           break;          // ror   dstreg,srcreg,#shift
+			default:            assert(false);                          break;
+		}
+
+		// for rotates, the carry is the bit that wrapped around
+		if (carry && Opcode == uml::OP_ROL)
+			carryreg = dstreg;
+		else if (carry && Opcode == uml::OP_ROR)
+			a.lsr(carryreg, dstreg, width - 1);                                         // lsr   x15,dstreg,#(width - 1)
+
+		if (inst.flags() != 0)
+		{
+			a.tst(dstreg, dstreg);                                                      // tst   dstreg,dstreg
+			if (carry)
+				emit_set_carry(a, carryreg);
+		}
+	}
+	else
+	{
+		// the variable shift instructions implicitly mask the count to the operand width
+		greg const shiftreg = get_reg_param(a, TEMP_REG3.sized(wide), shiftp);
+		greg const result = TEMP_REG4.sized(wide);
+		greg const negshift = TEMP_REG5.sized(wide);
+		switch (Opcode)
+		{
+			case uml::OP_SHL:   a.lslv(result, srcreg, shiftreg);       break;          // lsl   x12,srcreg,shiftreg
+			case uml::OP_SHR:   a.lsrv(result, srcreg, shiftreg);       break;          // lsr   x12,srcreg,shiftreg
+			case uml::OP_SAR:   a.asrv(result, srcreg, shiftreg);       break;          // asr   x12,srcreg,shiftreg
+			case uml::OP_ROL:
+				a.neg(negshift, shiftreg);                                              // neg   x13,shiftreg
+				a.rorv(result, srcreg, negshift);                                       // ror   x12,srcreg,x13
+				break;
+			case uml::OP_ROR:   a.rorv(result, srcreg, shiftreg);       break;          // ror   x12,srcreg,shiftreg
+			default:            assert(false);                          break;
+		}
+
+		// compute the carry-out assuming a non-zero count
+		if (carry)
+		{
+			switch (Opcode)
+			{
+				case uml::OP_SHL:
+					a.neg(negshift, shiftreg);                                          // neg   x13,shiftreg
+					a.lsrv(carryreg, srcreg, negshift);                                 // lsr   x15,srcreg,x13
+					break;
+				case uml::OP_SHR:
+				case uml::OP_SAR:
+					a.sub(negshift, shiftreg, 1);                                       // sub   x13,shiftreg,#1
+					a.lsrv(carryreg, srcreg, negshift);                                 // lsr   x15,srcreg,x13
+					break;
+				case uml::OP_ROL:
+					carryreg = result;
+					break;
+				case uml::OP_ROR:
+					a.lsr(carryreg, result, width - 1);                                 // lsr   x15,x12,#(width - 1)
+					break;
+				default:
+					break;
+			}
+		}
+
+		a.mov(dstreg, result);                                                          // mov   dstreg,x12
+
+		// a zero count leaves the flags alone
+		if (inst.flags() != 0)
+		{
+			int const skip = a.new_label();
+			a.logical(LOGIC_AND, TEMP_REG6.w(), shiftreg.w(), width - 1);               // and   w14,shiftreg,#(width - 1)
+			a.cbz(TEMP_REG6.w(), skip);                                                 // cbz   w14,skip
+			a.tst(dstreg, dstreg);                                                      // tst   dstreg,dstreg
+			if (carry)
+				emit_set_carry(a, carryreg);
+			a.bind(skip);                                                           // skip:
+		}
+	}
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_rotc - process a ROLC/RORC opcode
+//-------------------------------------------------
+
+template <uml::opcode_t Opcode> void drcbe_arm64::op_rotc(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+	bool const wide = inst.size() == 8;
+	unsigned const width = inst.size() * 8;
+	bool const carry = (inst.flags() & FLAG_C) != 0;
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(wide));
+	greg const srcreg = get_reg_param(a, TEMP_REG2.sized(wide), srcp);
+	greg const carryin = TEMP_REG4.sized(wide);
+	greg const result = TEMP_REG5.sized(wide);
+	greg const negshift = TEMP_REG6.sized(wide);
+	greg const carryout = TEMP_REG7.sized(wide);
+
+	if (shiftp.is_immediate())
+	{
+		// a zero count moves the value and leaves the flags alone
+		unsigned const shift = shiftp.immediate() & (width - 1);
+		if (shift == 0)
+		{
+			a.mov(dstreg, srcreg);                                                      // mov   dstreg,srcreg
+			mov_param_reg(a, dstp, dstreg);                                             // mov   dstp,dstreg
+			return;
+		}
+
+		// the rotate passes through the carry, so the value is effectively width + 1 bits
+		a.cset(carryin, ARM_CC);                                                        // cset  x12,cc
+		if (Opcode == uml::OP_ROLC)
+		{
+			a.lsl(result, srcreg, shift);                                               // lsl   x13,srcreg,#shift
+			a.orr(result, result, carryin, SHIFT_LSL, shift - 1);                       // orr   x13,x13,x12,lsl #(shift - 1)
+			if (shift > 1)
+				a.orr(result, result, srcreg, SHIFT_LSR, width + 1 - shift);            // orr   x13,x13,srcreg,lsr #(width + 1 - shift)
+			if (carry)
+				a.ubfx(carryout, srcreg, width - shift, 1);                             // ubfx  x15,srcreg,#(width - shift),#1
+		}
+		else
+		{
+			a.lsr(result, srcreg, shift);                                               // lsr   x13,srcreg,#shift
+			a.orr(result, result, carryin, SHIFT_LSL, width - shift);                   // orr   x13,x13,x12,lsl #(width - shift)
+			if (shift > 1)
+				a.orr(result, result, srcreg, SHIFT_LSL, width + 1 - shift);            // orr   x13,x13,srcreg,lsl #(width + 1 - shift)
+			if (carry)
+				a.ubfx(carryout, srcreg, shift - 1, 1);                                 // ubfx  x15,srcreg,#(shift - 1),#1
+		}
+		a.mov(dstreg, result);                                                          // mov   dstreg,x13
+		if (inst.flags() != 0)
+		{
+			a.tst(dstreg, dstreg);                                                      // tst   dstreg,dstreg
+			if (carry)
+				emit_set_carry(a, carryout);
+		}
+	}
+	else
+	{
+		greg const shiftreg = TEMP_REG3.sized(wide);
+		a.logical(LOGIC_AND, shiftreg, get_reg_param(a, TEMP_REG3.sized(wide), shiftp), width - 1); // and   x11,shiftp,#(width - 1)
+
+		int const zero = a.new_label();
+		int const done = a.new_label();
+		a.cset(carryin, ARM_CC);                                                        // cset  x12,cc
+		a.cbz(shiftreg, zero);                                                          // cbz   x11,zero
+		a.neg(negshift, shiftreg);                                                      // neg   x14,x11
+		if (Opcode == uml::OP_ROLC)
+		{
+			a.lslv(result, srcreg, shiftreg);                                           // lsl   x13,srcreg,x11
+			a.sub(carryout, shiftreg, 1);                                               // sub   x15,x11,#1
+			a.lslv(carryout, carryin, carryout);                                        // lsl   x15,x12,x15
+			a.orr(result, result, carryout);                                            // orr   x13,x13,x15
+			a.lsr(carryout, srcreg, 1);                                                 // lsr   x15,srcreg,#1
+			a.lsrv(carryout, carryout, negshift);                                       // lsr   x15,x15,x14
+			a.orr(result, result, carryout);                                            // orr   x13,x13,x15
+			if (carry)
+				a.lsrv(carryout, srcreg, negshift);                                     // lsr   x15,srcreg,x14
+		}
+		else
+		{
+			a.lsrv(result, srcreg, shiftreg);                                           // lsr   x13,srcreg,x11
+			a.lslv(carryout, carryin, negshift);                                        // lsl   x15,x12,x14
+			a.orr(result, result, carryout);                                            // orr   x13,x13,x15
+			a.lsl(carryout, srcreg, 1);                                                 // lsl   x15,srcreg,#1
+			a.lslv(carryout, carryout, negshift);                                       // lsl   x15,x15,x14
+			a.orr(result, result, carryout);                                            // orr   x13,x13,x15
+			if (carry)
+			{
+				a.sub(carryout, shiftreg, 1);                                           // sub   x15,x11,#1
+				a.lsrv(carryout, srcreg, carryout);                                     // lsr   x15,srcreg,x15
+			}
+		}
+		a.mov(dstreg, result);                                                          // mov   dstreg,x13
+		if (inst.flags() != 0)
+		{
+			a.tst(dstreg, dstreg);                                                      // tst   dstreg,dstreg
+			if (carry)
+				emit_set_carry(a, carryout);
+		}
+		a.b(done);                                                                      // b     done
+
+		// a zero count moves the value and leaves the flags alone
+		a.bind(zero);                                                               // zero:
+		a.mov(dstreg, srcreg);                                                          // mov   dstreg,srcreg
+		a.bind(done);                                                               // done:
+	}
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+
+/***************************************************************************
+    FLOATING POINT OPERATIONS
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_fload - process a FLOAD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fload(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter basep(*this, inst.param(1), PTYPE_M);
+	be_parameter indp(*this, inst.param(2), PTYPE_MRI);
+	bool const dbl = inst.size() == 8;
+
+	vreg const dstreg = dstp.select_register(FTEMP_REG1.sized(dbl));
+	emit_indexed(a, dbl ? LDST_LDRD : LDST_LDRS, dstreg.id, basep.memory(), indp, dbl ? 3 : 2); // ldr   dstreg,[basep + indp]
+	mov_param_freg(a, dstp, dstreg);                                                    // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_fstore - process a FSTORE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fstore(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter basep(*this, inst.param(0), PTYPE_M);
+	be_parameter indp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(2), PTYPE_MF);
+	bool const dbl = inst.size() == 8;
+
+	vreg const srcreg = get_freg_param(a, FTEMP_REG1.sized(dbl), srcp);
+	emit_indexed(a, dbl ? LDST_STRD : LDST_STRS, srcreg.id, basep.memory(), indp, dbl ? 3 : 2); // str   srcreg,[basep + indp]
+}
+
+
+//-------------------------------------------------
+//  op_fread - process a FREAD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fread(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter addrp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(2);
+	assert(spacesizep.is_size_space());
+	assert((1 << spacesizep.size()) == inst.size());
+	bool const dbl = inst.size() == 8;
+
+	auto const &accessors = m_accessors[spacesizep.space()];
+
+	// set up a call to the read handler
+	mov_reg_imm(a, REG_PARAM1, uintptr_t(m_space[spacesizep.space()]));                 // mov   x0,space
+	mov_reg_param(a, REG_PARAM2.w(), addrp);                                            // mov   w1,addrp
+	emit_call_mem(a, dbl ? (const void *)&accessors.read_qword : (const void *)&accessors.read_dword); // blr   read_dword
+
+	// move the result bits to the destination without conversion
+	if (dstp.is_float_register())
+		a.fmov(vreg{ uint8_t(dstp.freg()), dbl }, REG_PARAM1.sized(dbl));               // fmov  dstp,x0
+	else
+		emit_mem(a, dbl ? LDST_STRX : LDST_STRW, REG_PARAM1.id, dstp.memory());         // str   x0,[dstp]
+}
+
+
+//-------------------------------------------------
+//  op_fwrite - process a FWRITE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fwrite(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter addrp(*this, inst.param(0), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+	const parameter &spacesizep = inst.param(2);
+	assert(spacesizep.is_size_space());
+	assert((1 << spacesizep.size()) == inst.size());
+	bool const dbl = inst.size() == 8;
+
+	auto const &accessors = m_accessors[spacesizep.space()];
+
+	// set up a call to the write handler
+	mov_reg_imm(a, REG_PARAM1, uintptr_t(m_space[spacesizep.space()]));                 // mov   x0,space
+	mov_reg_param(a, REG_PARAM2.w(), addrp);                                            // mov   w1,addrp
+	if (srcp.is_float_register())
+		a.fmov(REG_PARAM3.sized(dbl), vreg{ uint8_t(srcp.freg()), dbl });               // fmov  x2,srcp
+	else
+		emit_mem(a, dbl ? LDST_LDRX : LDST_LDRW, REG_PARAM3.id, srcp.memory());         // ldr   x2,[srcp]
+	emit_call_mem(a, dbl ? (const void *)&accessors.write_qword : (const void *)&accessors.write_dword); // blr   write_dword
+}
+
+
+//-------------------------------------------------
+//  op_fmov - process a FMOV opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fmov(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+	bool const dbl = inst.size() == 8;
+
+	// a conditional move to a register is a select, which leaves the flags alone
+	if (inst.condition() != uml::COND_ALWAYS && dstp.is_float_register())
+	{
+		vreg const dstreg = dstp.select_register(FTEMP_REG1.sized(dbl));
+		vreg const srcreg = get_freg_param(a, FTEMP_REG1.sized(dbl), srcp);
+		a.fcsel(dstreg, srcreg, dstreg, ARM_CONDITION(inst.condition()));              // fcsel dstreg,srcreg,dstreg,cc
+		return;
+	}
+
+	// skip if conditional
+	int const skip = a.new_label();
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.b(ARM_NOT_CONDITION(inst.condition()), skip);                                 // b.!cc skip
+
+	vreg const dstreg = dstp.select_register(FTEMP_REG1.sized(dbl));
+	mov_freg_param(a, dstreg, srcp);                                                    // fmov  dstreg,srcp
+	mov_param_freg(a, dstp, dstreg);                                                    // fmov  dstp,dstreg
+
+	// resolve the jump
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(skip);                                                               // skip:
+}
+
+
+//-------------------------------------------------
+//  op_ftoint - process a FTOINT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_ftoint(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+	const parameter &sizep = inst.param(2);
+	assert(sizep.is_size());
+	const parameter &roundp = inst.param(3);
+	assert(roundp.is_rounding());
+	bool const dbl = inst.size() == 8;
+
+	greg const dstreg = dstp.select_register(TEMP_REG1.sized(sizep.size() == SIZE_QWORD));
+	vreg const srcreg = get_freg_param(a, FTEMP_REG1.sized(dbl), srcp);
+
+	// each explicit rounding mode has its own conversion
+	switch (roundp.rounding())
+	{
+		case ROUND_TRUNC:   a.fcvt(FCVT_ZS, dstreg, srcreg);    break;                  // fcvtzs dstreg,srcreg
+		case ROUND_ROUND:   a.fcvt(FCVT_NS, dstreg, srcreg);    break;                  // fcvtns dstreg,srcreg
+		case ROUND_CEIL:    a.fcvt(FCVT_PS, dstreg, srcreg);    break;                  // fcvtps dstreg,srcreg
+		case ROUND_FLOOR:   a.fcvt(FCVT_MS, dstreg, srcreg);    break;                  // fcvtms dstreg,srcreg
+		default:
+			// the default mode rounds with FPCR first, as the conversions all ignore it
+			a.frinti(FTEMP_REG2.sized(dbl), srcreg);                                    // frinti d1,srcreg
+			a.fcvt(FCVT_ZS, dstreg, FTEMP_REG2.sized(dbl));                             // fcvtzs dstreg,d1
+			break;
+	}
+	mov_param_reg(a, dstp, dstreg);                                                     // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_ffrint - process a FFRINT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_ffrint(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &sizep = inst.param(2);
+	assert(sizep.is_size());
+	bool const dbl = inst.size() == 8;
+
+	vreg const dstreg = dstp.select_register(FTEMP_REG1.sized(dbl));
+	greg const srcreg = get_reg_param(a, TEMP_REG1.sized(sizep.size() == SIZE_QWORD), srcp);
+	a.scvtf(dstreg, srcreg);                                                            // scvtf dstreg,srcreg
+	mov_param_freg(a, dstp, dstreg);                                                    // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_ffrflt - process a FFRFLT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_ffrflt(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+	const parameter &sizep = inst.param(2);
+	assert(sizep.is_size());
+	bool const dbl = inst.size() == 8;
+	bool const srcdbl = sizep.size() == SIZE_QWORD;
+
+	vreg const dstreg = dstp.select_register(FTEMP_REG1.sized(dbl));
+	vreg const srcreg = get_freg_param(a, FTEMP_REG2.sized(srcdbl), srcp);
+	if (dbl != srcdbl)
+		a.fcvt(dstreg, srcreg);                                                         // fcvt  dstreg,srcreg
+	else
+		a.fmov(dstreg, srcreg);                                                         // fmov  dstreg,srcreg
+	mov_param_freg(a, dstp, dstreg);                                                    // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_frnds - process a FRNDS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_frnds(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	vreg const dstreg = dstp.select_register(FTEMP_REG1.d());
+	vreg const srcreg = get_freg_param(a, FTEMP_REG1.d(), srcp);
+	a.fcvt(FTEMP_REG2.s(), srcreg);                                                     // fcvt  s1,srcreg
+	a.fcvt(dstreg, FTEMP_REG2.s());                                                     // fcvt  dstreg,s1
+	mov_param_freg(a, dstp, dstreg);                                                    // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_float_alu - process a FADD/FSUB/FMUL/FDIV
+//  opcode
+//-------------------------------------------------
+
+template <uml::opcode_t Opcode> void drcbe_arm64::op_float_alu(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MF);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MF);
+	bool const dbl = inst.size() == 8;
+
+	vreg const dstreg = dstp.select_register(FTEMP_REG1.sized(dbl));
+	vreg const src1reg = get_freg_param(a, FTEMP_REG1.sized(dbl), src1p);
+	vreg const src2reg = get_freg_param(a, FTEMP_REG2.sized(dbl), src2p);
+	switch (Opcode)
+	{
+		case uml::OP_FADD:  a.fadd(dstreg, src1reg, src2reg);   break;                  // fadd  dstreg,src1reg,src2reg
+		case uml::OP_FSUB:  a.fsub(dstreg, src1reg, src2reg);   break;                  // fsub  dstreg,src1reg,src2reg
+		case uml::OP_FMUL:  a.fmul(dstreg, src1reg, src2reg);   break;                  // fmul  dstreg,src1reg,src2reg
+		case uml::OP_FDIV:  a.fdiv(dstreg, src1reg, src2reg);   break;                  // fdiv  dstreg,src1reg,src2reg
+		default:            assert(false);                      break;
+	}
+	mov_param_freg(a, dstp, dstreg);                                                    // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_fcmp - process a FCMP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fcmp(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_Z | FLAG_U);
+
+	// normalize parameters
+	be_parameter src1p(*this, inst.param(0), PTYPE_MF);
+	be_parameter src2p(*this, inst.param(1), PTYPE_MF);
+	bool const dbl = inst.size() == 8;
+
+	// the host flags come out with the UML sense: C clear when less than, V set when unordered
+	vreg const src1reg = get_freg_param(a, FTEMP_REG1.sized(dbl), src1p);
+	vreg const src2reg = get_freg_param(a, FTEMP_REG2.sized(dbl), src2p);
+	a.fcmp(src1reg, src2reg);                                                           // fcmp  src1reg,src2reg
+}
+
+
+//-------------------------------------------------
+//  op_float_unary - process a FNEG/FABS/FSQRT/
+//  FRECIP/FRSQRT opcode
+//-------------------------------------------------
+
+template <uml::opcode_t Opcode> void drcbe_arm64::op_float_unary(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+	bool const dbl = inst.size() == 8;
+
+	vreg const dstreg = dstp.select_register(FTEMP_REG1.sized(dbl));
+	vreg const srcreg = get_freg_param(a, FTEMP_REG1.sized(dbl), srcp);
+	vreg const one = FTEMP_REG2.sized(dbl);
+	switch (Opcode)
+	{
+		case uml::OP_FNEG:  a.fneg(dstreg, srcreg);             break;                  // fneg  dstreg,srcreg
+		case uml::OP_FABS:  a.fabs(dstreg, srcreg);             break;                  // fabs  dstreg,srcreg
+		case uml::OP_FSQRT: a.fsqrt(dstreg, srcreg);            break;                  // fsqrt dstreg,srcreg
+		case uml::OP_FRECIP:
+			// the estimate instructions are too coarse, so divide properly
+			a.fmov_one(one);                                                            // fmov  d1,#1.0
+			a.fdiv(dstreg, one, srcreg);                                                // fdiv  dstreg,d1,srcreg
+			break;
+		case uml::OP_FRSQRT:
+			a.fsqrt(FTEMP_REG3.sized(dbl), srcreg);                                     // fsqrt d2,srcreg
+			a.fmov_one(one);                                                            // fmov  d1,#1.0
+			a.fdiv(dstreg, one, FTEMP_REG3.sized(dbl));                                 // fdiv  dstreg,d1,d2
+			break;
+		default:
+			assert(false);
+			break;
+	}
+	mov_param_freg(a, dstp, dstreg);                                                    // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_fcopyi - process a FCOPYI opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fcopyi(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MR);
+	bool const dbl = inst.size() == 8;
+
+	if (dstp.is_float_register())
+	{
+		vreg const dstreg = vreg{ uint8_t(dstp.freg()), dbl };
+		if (srcp.is_memory())
+			emit_mem(a, dbl ? LDST_LDRD : LDST_LDRS, dstreg.id, srcp.memory());         // ldr   dstreg,[srcp]
+		else
+			a.fmov(dstreg, greg{ uint8_t(srcp.ireg()), dbl });                          // fmov  dstreg,srcp
+	}
+	else
+	{
+		greg const srcreg = get_reg_param(a, TEMP_REG1.sized(dbl), srcp);
+		emit_mem(a, dbl ? LDST_STRX : LDST_STRW, srcreg.id, dstp.memory());             // str   srcreg,[dstp]
+	}
+}
+
+
+//-------------------------------------------------
+//  op_icopyf - process a ICOPYF opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_icopyf(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+	bool const dbl = inst.size() == 8;
+
+	if (dstp.is_int_register())
+	{
+		greg const dstreg = greg{ uint8_t(dstp.ireg()), dbl };
+		if (srcp.is_memory())
+			emit_mem(a, dbl ? LDST_LDRX : LDST_LDRW, dstreg.id, srcp.memory());         // ldr   dstreg,[srcp]
+		else
+			a.fmov(dstreg, vreg{ uint8_t(srcp.freg()), dbl });                          // fmov  dstreg,srcp
+	}
+	else
+	{
+		vreg const srcreg = get_freg_param(a, FTEMP_REG1.sized(dbl), srcp);
+		emit_mem(a, dbl ? LDST_STRD : LDST_STRS, srcreg.id, dstp.memory());             // str   srcreg,[dstp]
+	}
+}
+
+
+//-------------------------------------------------
+//  op_vmov - process a VMOV opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_vmov(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+	be_parameter srcp(*this, inst.param(1), PTYPE_M);
+
+	emit_vmem(a, LDST_LDRQ, FTEMP_REG1, srcp.memory());                                // ldr   q0,[srcp]
+	emit_vmem(a, LDST_STRQ, FTEMP_REG1, dstp.memory());                                // str   q0,[dstp]
+}
+
+
+//-------------------------------------------------
+//  op_vshuf - process a VSHUF opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_vshuf(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+	be_parameter srcp(*this, inst.param(1), PTYPE_M);
+	uint32_t const lanes = inst.param(2).immediate();
+
+	bool splat = true;
+	for (int lane = 1; lane < 8; lane++)
+		splat = splat && (((lanes >> (lane * 4)) & 7) == (lanes & 7));
+
+	emit_vmem(a, LDST_LDRQ, FTEMP_REG2, srcp.memory());                                // ldr   q1,[srcp]
+	if (splat)
+	{
+		a.dup_h(FTEMP_REG1, FTEMP_REG2, lanes & 7);                                     // dup   v0.8h,v1.h[lane]
+	}
+	else
+	{
+		a.vmov(FTEMP_REG1, FTEMP_REG2);                                                 // mov   v0.16b,v1.16b
+		for (int lane = 0; lane < 8; lane++)
+			if (((lanes >> (lane * 4)) & 7) != lane)
+				a.ins_h(FTEMP_REG1, lane, FTEMP_REG2, (lanes >> (lane * 4)) & 7);      // mov   v0.h[lane],v1.h[sel]
+	}
+	emit_vmem(a, LDST_STRQ, FTEMP_REG1, dstp.memory());                                // str   q0,[dstp]
+}
+
+
+//-------------------------------------------------
+//  op_valu - process a VAND/VOR/VXOR/VADD/VSUB/
+//  VADDS/VSUBS opcode
+//-------------------------------------------------
+
+template <uml::opcode_t Opcode> void drcbe_arm64::op_valu(assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+	be_parameter src1p(*this, inst.param(1), PTYPE_M);
+	be_parameter src2p(*this, inst.param(2), PTYPE_M);
+
+	uint32_t const op =
+			(Opcode == OP_VAND) ? VEC_AND :
+			(Opcode == OP_VOR) ? VEC_ORR :
+			(Opcode == OP_VXOR) ? VEC_EOR :
+			(Opcode == OP_VADD) ? VEC_ADD_8H :
+			(Opcode == OP_VSUB) ? VEC_SUB_8H :
+			(Opcode == OP_VADDS) ? VEC_SQADD_8H :
+			VEC_SQSUB_8H;
+
+	emit_vmem(a, LDST_LDRQ, FTEMP_REG1, src1p.memory());                               // ldr   q0,[src1p]
+	emit_vmem(a, LDST_LDRQ, FTEMP_REG2, src2p.memory());                               // ldr   q1,[src2p]
+	a.vec3(op, FTEMP_REG1, FTEMP_REG1, FTEMP_REG2);                                     // op    v0,v0,v1
+	emit_vmem(a, LDST_STRQ, FTEMP_REG1, dstp.memory());                                // str   q0,[dstp]
+}
+
+} // namespace drc
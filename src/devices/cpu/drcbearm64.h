@@ -0,0 +1,305 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    drcbearm64.h
+
+    64-bit ARM (AArch64) back-end for the universal machine language.
+
+***************************************************************************/
+#ifndef MAME_CPU_DRCBEARM64_H
+#define MAME_CPU_DRCBEARM64_H
+
+#pragma once
+
+#include "drcuml.h"
+#include "drcbeut.h"
+
+#include <cstdio>
+
+
+namespace drc {
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+namespace arm64 {
+
+// a general purpose register, viewed as either W (32 bits) or X (64 bits)
+struct greg
+{
+	constexpr greg w() const { return greg{ id, false }; }
+	constexpr greg x() const { return greg{ id, true }; }
+	constexpr greg sized(bool wide64) const { return greg{ id, wide64 }; }
+	constexpr bool operator==(greg const &rhs) const { return id == rhs.id; }
+	constexpr bool operator!=(greg const &rhs) const { return id != rhs.id; }
+
+	uint8_t     id;             // register number; 31 is ZR or SP depending on instruction
+	bool        wide;           // true for the 64-bit view
+};
+
+// a SIMD&FP register, viewed as either S (single) or D (double)
+struct vreg
+{
+	constexpr vreg s() const { return vreg{ id, false }; }
+	constexpr vreg d() const { return vreg{ id, true }; }
+	constexpr vreg sized(bool double64) const { return vreg{ id, double64 }; }
+	constexpr bool operator==(vreg const &rhs) const { return id == rhs.id; }
+	constexpr bool operator!=(vreg const &rhs) const { return id != rhs.id; }
+
+	uint8_t     id;             // register number
+	bool        dbl;            // true for the double precision view
+};
+
+} // namespace arm64
+
+
+class drcbe_arm64 : public drcbe_interface
+{
+	typedef uint32_t arm64code;
+	typedef uint32_t (*arm64_entry_point_func)(uint8_t *basevalue, arm64code *entry);
+
+	using greg = arm64::greg;
+	using vreg = arm64::vreg;
+
+public:
+	// construction/destruction
+	drcbe_arm64(drcuml_state &drcuml, device_t &device, drc_cache &cache, uint32_t flags, int modes, int addrbits, int ignorebits);
+	virtual ~drcbe_arm64();
+
+	// required overrides
+	virtual void reset() override;
+	virtual int execute(uml::code_handle &entry) override;
+	virtual void generate(drcuml_block &block, const uml::instruction *instlist, uint32_t numinst) override;
+	virtual bool hash_exists(uint32_t mode, uint32_t pc) override;
+	virtual void hash_invalidate(uint32_t mode, uint32_t pc) override;
+	virtual void get_info(drcbe_info &info) override;
+	virtual bool logging() const override { return m_log != nullptr; }
+
+private:
+	// a minimal A64 encoder; code is assembled for its final address and copied into the cache by emit()
+	class assembler;
+
+	// a be_parameter is similar to a uml::parameter but maps to native registers/memory
+	class be_parameter
+	{
+	public:
+		static int const REG_MAX = 32;
+
+		// parameter types
+		enum be_parameter_type
+		{
+			PTYPE_NONE = 0,                     // invalid
+			PTYPE_IMMEDIATE,                    // immediate; value = sign-extended to 64 bits
+			PTYPE_INT_REGISTER,                 // integer register; value = 0-REG_MAX
+			PTYPE_FLOAT_REGISTER,               // floating point register; value = 0-REG_MAX
+			PTYPE_MEMORY,                       // memory; value = pointer to memory
+			PTYPE_MAX
+		};
+
+		// represents the value of a parameter
+		typedef uint64_t be_parameter_value;
+
+		// construction
+		be_parameter() : m_type(PTYPE_NONE), m_value(0) { }
+		be_parameter(be_parameter const &param) : m_type(param.m_type), m_value(param.m_value) { }
+		be_parameter(uint64_t val) : m_type(PTYPE_IMMEDIATE), m_value(val) { }
+		be_parameter(drcbe_arm64 &drcbe, const uml::parameter &param, uint32_t allowed);
+		be_parameter &operator=(be_parameter const &param) = default;
+
+		// creators for types that don't safely default
+		static inline be_parameter make_ireg(int regnum) { assert(regnum >= 0 && regnum < REG_MAX); return be_parameter(PTYPE_INT_REGISTER, regnum); }
+		static inline be_parameter make_freg(int regnum) { assert(regnum >= 0 && regnum < REG_MAX); return be_parameter(PTYPE_FLOAT_REGISTER, regnum); }
+		static inline be_parameter make_memory(void *base) { return be_parameter(PTYPE_MEMORY, reinterpret_cast<be_parameter_value>(base)); }
+		static inline be_parameter make_memory(const void *base) { return be_parameter(PTYPE_MEMORY, reinterpret_cast<be_parameter_value>(const_cast<void *>(base))); }
+
+		// operators
+		bool operator==(be_parameter const &rhs) const { return (m_type == rhs.m_type && m_value == rhs.m_value); }
+		bool operator!=(be_parameter const &rhs) const { return (m_type != rhs.m_type || m_value != rhs.m_value); }
+
+		// getters
+		be_parameter_type type() const { return m_type; }
+		uint64_t immediate() const { assert(m_type == PTYPE_IMMEDIATE); return m_value; }
+		uint32_t ireg() const { assert(m_type == PTYPE_INT_REGISTER); assert(m_value < REG_MAX); return m_value; }
+		uint32_t freg() const { assert(m_type == PTYPE_FLOAT_REGISTER); assert(m_value < REG_MAX); return m_value; }
+		void *memory() const { assert(m_type == PTYPE_MEMORY); return reinterpret_cast<void *>(m_value); }
+
+		// type queries
+		bool is_immediate() const { return (m_type == PTYPE_IMMEDIATE); }
+		bool is_int_register() const { return (m_type == PTYPE_INT_REGISTER); }
+		bool is_float_register() const { return (m_type == PTYPE_FLOAT_REGISTER); }
+		bool is_memory() const { return (m_type == PTYPE_MEMORY); }
+
+		// other queries
+		bool is_immediate_value(uint64_t value) const { return (m_type == PTYPE_IMMEDIATE && m_value == value); }
+
+		// helpers
+		greg select_register(greg defreg) const;
+		vreg select_register(vreg defreg) const;
+
+	private:
+		// private constructor
+		be_parameter(be_parameter_type type, be_parameter_value value) : m_type(type), m_value(value) { }
+
+		// internals
+		be_parameter_type   m_type;             // parameter type
+		be_parameter_value  m_value;            // parameter value
+	};
+
+	// code generation helpers
+	size_t emit(assembler &a);
+	void emit_mem(assembler &a, uint32_t op, unsigned reg, const void *ptr);
+	void emit_vmem(assembler &a, uint32_t op, vreg reg, const void *ptr);
+	void emit_address(assembler &a, greg reg, const void *ptr);
+	void emit_call(assembler &a, const void *target);
+	void emit_call_mem(assembler &a, const void *ptr);
+	void emit_call_handle(assembler &a, uml::code_handle &handle);
+	void emit_jump(assembler &a, const void *target);
+	void emit_set_carry(assembler &a, greg bit);
+	void emit_invert_carry(assembler &a);
+	void emit_set_overflow(assembler &a, greg bit);
+	void emit_set_rounding(assembler &a, greg mode);
+
+	static void debug_log_hashjmp(offs_t pc, int mode);
+	static void debug_log_hashjmp_fail();
+
+	// code generators
+	void op_handle(assembler &a, const uml::instruction &inst);
+	void op_hash(assembler &a, const uml::instruction &inst);
+	void op_label(assembler &a, const uml::instruction &inst);
+	void op_comment(assembler &a, const uml::instruction &inst);
+	void op_mapvar(assembler &a, const uml::instruction &inst);
+
+	void op_nop(assembler &a, const uml::instruction &inst);
+	void op_debug(assembler &a, const uml::instruction &inst);
+	void op_exit(assembler &a, const uml::instruction &inst);
+	void op_hashjmp(assembler &a, const uml::instruction &inst);
+	void op_jmp(assembler &a, const uml::instruction &inst);
+	void op_exh(assembler &a, const uml::instruction &inst);
+	void op_callh(assembler &a, const uml::instruction &inst);
+	void op_ret(assembler &a, const uml::instruction &inst);
+	void op_callc(assembler &a, const uml::instruction &inst);
+	void op_recover(assembler &a, const uml::instruction &inst);
+
+	void op_setfmod(assembler &a, const uml::instruction &inst);
+	void op_getfmod(assembler &a, const uml::instruction &inst);
+	void op_getexp(assembler &a, const uml::instruction &inst);
+	void op_getflgs(assembler &a, const uml::instruction &inst);
+	void op_save(assembler &a, const uml::instruction &inst);
+	void op_restore(assembler &a, const uml::instruction &inst);
+
+	void op_load(assembler &a, const uml::instruction &inst);
+	void op_loads(assembler &a, const uml::instruction &inst);
+	void op_store(assembler &a, const uml::instruction &inst);
+	void op_read(assembler &a, const uml::instruction &inst);
+	void op_readm(assembler &a, const uml::instruction &inst);
+	void op_write(assembler &a, const uml::instruction &inst);
+	void op_writem(assembler &a, const uml::instruction &inst);
+	void op_carry(assembler &a, const uml::instruction &inst);
+	void op_set(assembler &a, const uml::instruction &inst);
+	void op_mov(assembler &a, const uml::instruction &inst);
+	void op_sext(assembler &a, const uml::instruction &inst);
+	void op_roland(assembler &a, const uml::instruction &inst);
+	void op_rolins(assembler &a, const uml::instruction &inst);
+	void op_add(assembler &a, const uml::instruction &inst);
+	void op_addc(assembler &a, const uml::instruction &inst);
+	void op_sub(assembler &a, const uml::instruction &inst);
+	void op_subc(assembler &a, const uml::instruction &inst);
+	void op_cmp(assembler &a, const uml::instruction &inst);
+	void op_mulu(assembler &a, const uml::instruction &inst);
+	void op_muls(assembler &a, const uml::instruction &inst);
+	void op_divu(assembler &a, const uml::instruction &inst);
+	void op_divs(assembler &a, const uml::instruction &inst);
+	void op_and(assembler &a, const uml::instruction &inst);
+	void op_test(assembler &a, const uml::instruction &inst);
+	void op_or(assembler &a, const uml::instruction &inst);
+	void op_xor(assembler &a, const uml::instruction &inst);
+	void op_lzcnt(assembler &a, const uml::instruction &inst);
+	void op_tzcnt(assembler &a, const uml::instruction &inst);
+	void op_bswap(assembler &a, const uml::instruction &inst);
+	template <uml::opcode_t Opcode> void op_shift(assembler &a, const uml::instruction &inst);
+	template <uml::opcode_t Opcode> void op_rotc(assembler &a, const uml::instruction &inst);
+
+	void op_fload(assembler &a, const uml::instruction &inst);
+	void op_fstore(assembler &a, const uml::instruction &inst);
+	void op_fread(assembler &a, const uml::instruction &inst);
+	void op_fwrite(assembler &a, const uml::instruction &inst);
+	void op_fmov(assembler &a, const uml::instruction &inst);
+	void op_ftoint(assembler &a, const uml::instruction &inst);
+	void op_ffrint(assembler &a, const uml::instruction &inst);
+	void op_ffrflt(assembler &a, const uml::instruction &inst);
+	void op_frnds(assembler &a, const uml::instruction &inst);
+	template <uml::opcode_t Opcode> void op_float_alu(assembler &a, const uml::instruction &inst);
+	void op_fcmp(assembler &a, const uml::instruction &inst);
+	template <uml::opcode_t Opcode> void op_float_unary(assembler &a, const uml::instruction &inst);
+	void op_fcopyi(assembler &a, const uml::instruction &inst);
+	void op_icopyf(assembler &a, const uml::instruction &inst);
+	void op_vmov(assembler &a, const uml::instruction &inst);
+	void op_vshuf(assembler &a, const uml::instruction &inst);
+	template <uml::opcode_t Opcode> void op_valu(assembler &a, const uml::instruction &inst);
+
+	// alu and memory operation helpers
+	void add_param(assembler &a, bool sub, bool setflags, greg dst, greg src1, be_parameter const &src2);
+	void logical_param(assembler &a, uint32_t op, greg dst, greg src1, be_parameter const &src2);
+	void emit_indexed(assembler &a, uint32_t op, unsigned reg, const void *base, be_parameter const &indp, unsigned scale);
+	void emit_mul(assembler &a, const uml::instruction &inst, bool issigned);
+	void emit_div(assembler &a, const uml::instruction &inst, bool issigned);
+
+	// parameter helpers
+	void mov_reg_imm(assembler &a, greg reg, uint64_t imm);
+	void mov_reg_param(assembler &a, greg reg, be_parameter const &param);
+	greg get_reg_param(assembler &a, greg temp, be_parameter const &param);
+	void mov_param_reg(assembler &a, be_parameter const &param, greg reg);
+
+	// floating-point helpers
+	void mov_freg_param(assembler &a, vreg reg, be_parameter const &param);
+	vreg get_freg_param(assembler &a, vreg temp, be_parameter const &param);
+	void mov_param_freg(assembler &a, be_parameter const &param, vreg reg);
+
+	// logging
+	void log_code(assembler const &a, const char *name);
+
+	// internal state
+	drc_hash_table          m_hash;                 // hash table state
+	drc_map_variables       m_map;                  // code map
+	FILE *                  m_log;                  // logging
+
+	uint8_t *               m_basevalue;            // value of the base register
+
+	arm64_entry_point_func  m_entry;                // entry point
+	arm64code *             m_exit;                 // exit point
+	arm64code *             m_nocode;               // nocode handler
+
+	// state to live in the near cache
+	struct near_state
+	{
+		void *              debug_cpu_instruction_hook;// debugger callback
+		void *              debug_log_hashjmp;      // hashjmp debugging
+		void *              debug_log_hashjmp_fail; // hashjmp debugging
+		void *              drcmap_get_value;       // map lookup helper
+
+		uint64_t            stacksave;              // saved stack pointer
+		uint32_t            fpcrsave;               // saved floating point control register
+
+		uint8_t             flagsmap[0x10];         // NZCV to UML flags
+		uint32_t            flagsunmap[0x20];       // UML flags to NZCV
+	};
+	near_state &            m_near;
+
+	// globals
+	typedef void (drcbe_arm64::*opcode_generate_func)(assembler &a, const uml::instruction &inst);
+	struct opcode_table_entry
+	{
+		uml::opcode_t           opcode;             // opcode in question
+		opcode_generate_func    func;               // function pointer to the work
+	};
+	static const opcode_table_entry s_opcode_table_source[];
+	static opcode_generate_func s_opcode_table[uml::OP_MAX];
+};
+
+} // namespace drc
+
+using drc::drcbe_arm64;
+
+#endif // MAME_CPU_DRCBEARM64_H
@@ -12,6 +12,7 @@
 #include "debugger.h"
 #include "drcbec.h"
 
+#include <algorithm>
 #include <cmath>
 
 using namespace uml;
@@ -470,6 +471,17 @@ bool drcbe_c::hash_exists(uint32_t mode, uint32_t pc)
 }
 
 
+//-------------------------------------------------
+//  hash_invalidate - forget the code for the
+//  given mode/pc so it is compiled again
+//-------------------------------------------------
+
+void drcbe_c::hash_invalidate(uint32_t mode, uint32_t pc)
+{
+	m_hash.invalidate(mode, pc);
+}
+
+
 //-------------------------------------------------
 //  get_info - return information about the
 //  back-end implementation
@@ -2105,6 +2117,27 @@ int drcbe_c::execute(code_handle &entry)
 				*inst[0].pint64 = d2u(FDPARAM1);
 				break;
 
+
+			// ----------------------- Vector Operations -----------------------
+
+			case MAKE_OPCODE_SHORT(OP_VMOV, 4, 0):      // VMOV    dst,src
+				memmove(inst[0].v, inst[1].v, 16);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VSHUF, 4, 0):     // VSHUF   dst,src,lanes
+				vector_op(OP_VSHUF, inst[0].v, inst[1].v, nullptr, PARAM2);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VAND, 4, 0):      // VAND    dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VOR, 4, 0):       // VOR     dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VXOR, 4, 0):      // VXOR    dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VADD, 4, 0):      // VADD    dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VSUB, 4, 0):      // VSUB    dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VADDS, 4, 0):     // VADDS   dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VSUBS, 4, 0):     // VSUBS   dst,src1,src2
+				vector_op(opcode_t(OPCODE_GET_SHORT(opcode) >> 2), inst[0].v, inst[1].v, inst[2].v, 0);
+				break;
+
 			default:
 				fatalerror("Unexpected opcode!\n");
 		}
@@ -2311,6 +2344,36 @@ int drcbe_c::dmuls(uint64_t &dstlo, uint64_t &dsthi, int64_t src1, int64_t src2,
 	return ((hi >> 60) & FLAG_S) | ((dsthi != ((int64_t)lo >> 63)) << 1);
 }
 
+//-------------------------------------------------
+//  vector_op - perform an operation on eight
+//  16-bit lanes; operands may overlap
+//-------------------------------------------------
+
+void drcbe_c::vector_op(opcode_t opcode, void *dst, const void *src1, const void *src2, uint32_t lanes)
+{
+	int16_t a[8], b[8], r[8];
+	memcpy(a, src1, sizeof(a));
+	if (src2 != nullptr)
+		memcpy(b, src2, sizeof(b));
+
+	for (int i = 0; i < 8; i++)
+	{
+		switch (opcode)
+		{
+			case OP_VSHUF:  r[i] = a[(lanes >> (i * 4)) & 7];                                   break;
+			case OP_VAND:   r[i] = a[i] & b[i];                                                 break;
+			case OP_VOR:    r[i] = a[i] | b[i];                                                 break;
+			case OP_VXOR:   r[i] = a[i] ^ b[i];                                                 break;
+			case OP_VADD:   r[i] = int16_t(uint16_t(a[i]) + uint16_t(b[i]));                    break;
+			case OP_VSUB:   r[i] = int16_t(uint16_t(a[i]) - uint16_t(b[i]));                    break;
+			case OP_VADDS:  r[i] = std::clamp<int32_t>(int32_t(a[i]) + b[i], -0x8000, 0x7fff);  break;
+			case OP_VSUBS:  r[i] = std::clamp<int32_t>(int32_t(a[i]) - b[i], -0x8000, 0x7fff);  break;
+			default:        fatalerror("Unexpected vector opcode!\n");
+		}
+	}
+	memcpy(dst, r, sizeof(r));
+}
+
 uint32_t drcbe_c::tzcount32(uint32_t value)
 {
 	for (int i = 0; i < 32; i++)
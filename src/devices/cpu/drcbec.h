@@ -36,6 +36,7 @@ public:
 	virtual int execute(uml::code_handle &entry) override;
 	virtual void generate(drcuml_block &block, const uml::instruction *instlist, uint32_t numinst) override;
 	virtual bool hash_exists(uint32_t mode, uint32_t pc) override;
+	virtual void hash_invalidate(uint32_t mode, uint32_t pc) override;
 	virtual void get_info(drcbe_info &info) override;
 
 private:
@@ -46,6 +47,7 @@ private:
 	int dmuls(uint64_t &dstlo, uint64_t &dsthi, int64_t src1, int64_t src2, bool flags);
 	uint32_t tzcount32(uint32_t value);
 	uint64_t tzcount64(uint64_t value);
+	void vector_op(uml::opcode_t opcode, void *dst, const void *src1, const void *src2, uint32_t lanes);
 
 	// internal state
 	drc_hash_table          m_hash;                 // hash table state
@@ -188,6 +188,19 @@ bool drc_hash_table::set_codeptr(uint32_t mode, uint32_t pc, drccodeptr code)
 }
 
 
+//-------------------------------------------------
+//  invalidate - point an existing mode/pc entry
+//  back at the no-code handler
+//-------------------------------------------------
+
+void drc_hash_table::invalidate(uint32_t mode, uint32_t pc)
+{
+	// an entry with code always has its own tables, so nothing is allocated here
+	if (code_exists(mode, pc))
+		m_base[mode][(pc >> m_l1shift) & m_l1mask][(pc >> m_l2shift) & m_l2mask] = m_nocodeptr;
+}
+
+
 
 //**************************************************************************
 //  DRC MAP VARIABLES
@@ -51,6 +51,7 @@ public:
 	bool set_codeptr(uint32_t mode, uint32_t pc, drccodeptr code);
 	drccodeptr get_codeptr(uint32_t mode, uint32_t pc) { assert(mode < m_modes); return m_base[mode][(pc >> m_l1shift) & m_l1mask][(pc >> m_l2shift) & m_l2mask]; }
 	bool code_exists(uint32_t mode, uint32_t pc) { return get_codeptr(mode, pc) != m_nocodeptr; }
+	void invalidate(uint32_t mode, uint32_t pc);
 
 private:
 	// internal state
@@ -401,7 +401,18 @@ const drcbe_x64::opcode_table_entry drcbe_x64::s_opcode_table_source[] =
 	{ uml::OP_FRECIP,  &drcbe_x64::op_frecip },     // FRECIP  dst,src1
 	{ uml::OP_FRSQRT,  &drcbe_x64::op_frsqrt },     // FRSQRT  dst,src1
 	{ uml::OP_FCOPYI,  &drcbe_x64::op_fcopyi },     // FCOPYI  dst,src
-	{ uml::OP_ICOPYF,  &drcbe_x64::op_icopyf }      // ICOPYF  dst,src
+	{ uml::OP_ICOPYF,  &drcbe_x64::op_icopyf },     // ICOPYF  dst,src
+
+	// Vector Operations
+	{ uml::OP_VMOV,    &drcbe_x64::op_vmov },       // VMOV    dst,src
+	{ uml::OP_VSHUF,   &drcbe_x64::op_vshuf },      // VSHUF   dst,src,lanes
+	{ uml::OP_VAND,    &drcbe_x64::op_valu },       // VAND    dst,src1,src2
+	{ uml::OP_VOR,     &drcbe_x64::op_valu },       // VOR     dst,src1,src2
+	{ uml::OP_VXOR,    &drcbe_x64::op_valu },       // VXOR    dst,src1,src2
+	{ uml::OP_VADD,    &drcbe_x64::op_valu },       // VADD    dst,src1,src2
+	{ uml::OP_VSUB,    &drcbe_x64::op_valu },       // VSUB    dst,src1,src2
+	{ uml::OP_VADDS,   &drcbe_x64::op_valu },       // VADDS   dst,src1,src2
+	{ uml::OP_VSUBS,   &drcbe_x64::op_valu }        // VSUBS   dst,src1,src2
 };
 
 class ThrowableErrorHandler : public ErrorHandler
@@ -568,6 +579,20 @@ inline Gp drcbe_x64::get_base_register_and_offset(Assembler &a, void *target, Gp
 }
 
 
+//-------------------------------------------------
+//  vector_mem - address a 128-bit vector operand,
+//  loading its base into a register if it is out
+//  of reach of rbp
+//-------------------------------------------------
+
+inline Mem drcbe_x64::vector_mem(Assembler &a, be_parameter const &param, Gp const &reg)
+{
+	int32_t offset;
+	Gp const base = get_base_register_and_offset(a, param.memory(), reg, offset);
+	return xmmword_ptr(base, offset);
+}
+
+
 //-------------------------------------------------
 //  smart_call_r64 - generate a call either
 //  directly or via a call through pointer
@@ -622,6 +647,9 @@ drcbe_x64::drcbe_x64(drcuml_state &drcuml, device_t &device, drc_cache &cache, u
 		m_entry(nullptr),
 		m_exit(nullptr),
 		m_nocode(nullptr),
+		m_count_hashjmps(device.machine().options().verbose()),
+		m_chain_links(0),
+		m_chain_unlinks(0),
 		m_near(*(near_state *)cache.alloc_near(sizeof(m_near)))
 {
 	// build up necessary arrays
@@ -635,6 +663,8 @@ drcbe_x64::drcbe_x64(drcuml_state &drcuml, device_t &device, drc_cache &cache, u
 	memcpy(m_near.ssecontrol, sse_control, sizeof(m_near.ssecontrol));
 	m_near.single1 = 1.0f;
 	m_near.double1 = 1.0;
+	m_near.hashjmp_lookups = 0;
+	m_near.hashjmp_misses = 0;
 
 	// create absolute value masks that are aligned to SSE boundaries
 	m_absmask32 = (uint32_t *)(((uintptr_t)m_absmask32 + 15) & ~15);
@@ -686,6 +716,10 @@ drcbe_x64::drcbe_x64(drcuml_state &drcuml, device_t &device, drc_cache &cache, u
 		m_log = x86log_create_context(filename.c_str());
 		m_log_asmjit = fopen(std::string("drcbex64_asmjit_").append(device.shortname()).append(".asm").c_str(), "w");
 	}
+
+	// report how hash jumps went
+	if (m_count_hashjmps)
+		device.machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&drcbe_x64::report_stats, this));
 }
 
 
@@ -743,6 +777,79 @@ size_t drcbe_x64::emit(CodeHolder &ch)
 	return code_size;
 }
 
+//-------------------------------------------------
+//  chain_block - record the chained jumps in a
+//  block that has just been emitted, and link
+//  them and any jumps waiting for its code
+//-------------------------------------------------
+
+void drcbe_x64::chain_block(x86code *dst, const instruction *instlist, uint32_t numinst)
+{
+	// jumps out of this block can go straight to anything already generated
+	for (auto const &pending : m_pending_chains)
+	{
+		x86code *const site = dst + pending.second;
+		assert(*site == 0xe9);
+		m_chains[pending.first].push_back(site);
+	}
+	for (auto const &pending : m_pending_chains)
+		chain_update(pending.first, m_hash.get_codeptr(uint32_t(pending.first >> 32), uint32_t(pending.first)));
+	m_pending_chains.clear();
+
+	// jumps waiting for code in this block can now reach it
+	for (int inum = 0; inum < numinst; inum++)
+	{
+		const instruction &inst = instlist[inum];
+		if (inst.opcode() == OP_HASH)
+		{
+			uint64_t const key = (inst.param(0).immediate() << 32) | uint32_t(inst.param(1).immediate());
+			chain_update(key, m_hash.get_codeptr(uint32_t(inst.param(0).immediate()), uint32_t(inst.param(1).immediate())));
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  chain_update - point every chained jump to a
+//  mode/PC at its code, or back at the hash table
+//  lookup that follows each jump if there is none
+//-------------------------------------------------
+
+void drcbe_x64::chain_update(uint64_t key, drccodeptr target)
+{
+	auto const found = m_chains.find(key);
+	if (found == m_chains.end())
+		return;
+
+	bool const link = (target != nullptr) && (target != m_nocode);
+	for (x86code *const site : found->second)
+	{
+		// the cache must be writable here
+		x86code *const dest = link ? target : (site + 5);
+		int32_t const rel = int32_t(dest - (site + 5));
+		int32_t current;
+		memcpy(&current, site + 1, sizeof(current));
+		if (current != rel)
+		{
+			memcpy(site + 1, &rel, sizeof(rel));
+			++(link ? m_chain_links : m_chain_unlinks);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  report_stats - print what happened to hash
+//  jumps
+//-------------------------------------------------
+
+void drcbe_x64::report_stats()
+{
+	osd_printf_verbose("%s: x64 DRC hash jumps: %u table lookups, %u missing code\n", m_device.tag(), m_near.hashjmp_lookups, m_near.hashjmp_misses);
+	osd_printf_verbose("  chained jumps: %u linked, %u unlinked\n", m_chain_links, m_chain_unlinks);
+}
+
+
 //-------------------------------------------------
 //  reset - reset back-end specific state
 //-------------------------------------------------
@@ -819,9 +926,11 @@ void drcbe_x64::reset()
 		x86log_disasm_code_range(m_log, "nocode_point", m_nocode, dst + bytes);
 	}
 
-	// reset our hash tables
+	// reset our hash tables; all chained jumps went with the cache
 	m_hash.reset();
 	m_hash.set_default_codeptr(m_nocode);
+	m_pending_chains.clear();
+	m_chains.clear();
 }
 
 
@@ -845,6 +954,7 @@ int drcbe_x64::execute(code_handle &entry)
 void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint32_t numinst)
 {
 	// tell all of our utility objects that a block is beginning
+	m_pending_chains.clear();
 	m_hash.block_begin(block, instlist, numinst);
 	m_map.block_begin(block);
 
@@ -912,6 +1022,7 @@ void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint3
 	// tell all of our utility objects that the block is finished
 	m_hash.block_end(block);
 	m_map.block_end(block);
+	chain_block(dst, instlist, numinst);
 }
 
 
@@ -926,6 +1037,30 @@ bool drcbe_x64::hash_exists(uint32_t mode, uint32_t pc)
 }
 
 
+//-------------------------------------------------
+//  hash_invalidate - forget the code for the
+//  given mode/pc so it is compiled again
+//-------------------------------------------------
+
+void drcbe_x64::hash_invalidate(uint32_t mode, uint32_t pc)
+{
+	m_hash.invalidate(mode, pc);
+
+	// this may be called from running code, so chained jumps are pointed back at the table
+	// straight away rather than before the cache is next entered, as the running code could
+	// still follow one; the cache is only made writable for as long as that takes
+	uint64_t const key = (uint64_t(mode) << 32) | pc;
+	if (m_chains.find(key) != m_chains.end())
+	{
+		bool const executable = m_cache.executable();
+		m_cache.codegen_init();
+		chain_update(key, nullptr);
+		if (executable)
+			m_cache.codegen_complete();
+	}
+}
+
+
 //-------------------------------------------------
 //  get_info - return information about the
 //  back-end implementation
@@ -1393,17 +1528,28 @@ void drcbe_x64::op_hashjmp(Assembler &a, const instruction &inst)
 	// fixed mode cases
 	if (modep.is_immediate() && m_hash.is_mode_populated(modep.immediate()))
 	{
-		// a straight immediate jump is direct, though we need the PC in EAX in case of failure
+		// a straight immediate jump is chained straight to the target once it exists, and
+		// until then falls through to a call through the table entry
 		if (pcp.is_immediate())
 		{
 			uint32_t l1val = (pcp.immediate() >> m_hash.l1shift()) & m_hash.l1mask();
 			uint32_t l2val = (pcp.immediate() >> m_hash.l2shift()) & m_hash.l2mask();
+			Label lookup = a.newLabel();
+			a.lea(rsp, ptr(rsp, -8));                                                   // lea   rsp,[rsp-8]
+			m_pending_chains.emplace_back((modep.immediate() << 32) | uint32_t(pcp.immediate()), a.offset());
+			a.long_().jmp(lookup);                                                      // jmp   <target or lookup>
+			a.bind(lookup);
+			a.lea(rsp, ptr(rsp, 8));                                                    // lea   rsp,[rsp+8]
+			if (m_count_hashjmps)
+				a.inc(MABS(&m_near.hashjmp_lookups, 8));                                // inc   [hashjmp_lookups]
 			a.call(MABS(&m_hash.base()[modep.immediate()][l1val][l2val]));              // call  hash[modep][l1val][l2val]
 		}
 
 		// a fixed mode but variable PC
 		else
 		{
+			if (m_count_hashjmps)
+				a.inc(MABS(&m_near.hashjmp_lookups, 8));                                // inc   [hashjmp_lookups]
 			mov_reg_param(a, eax, pcp);                                                 // mov   eax,pcp
 			a.mov(edx, eax);                                                            // mov   edx,eax
 			a.shr(edx, m_hash.l1shift());                                               // shr   edx,l1shift
@@ -1416,6 +1562,8 @@ void drcbe_x64::op_hashjmp(Assembler &a, const instruction &inst)
 	else
 	{
 		// variable mode
+		if (m_count_hashjmps)
+			a.inc(MABS(&m_near.hashjmp_lookups, 8));                                    // inc   [hashjmp_lookups]
 		Gp modereg = modep.select_register(ecx);
 		mov_reg_param(a, modereg, modep);                                               // mov   modereg,modep
 		a.mov(rcx, ptr(rbp, modereg, 3, offset_from_rbp(m_hash.base())));               // mov   rcx,hash[modereg*8]
@@ -1445,6 +1593,8 @@ void drcbe_x64::op_hashjmp(Assembler &a, const instruction &inst)
 	if (LOG_HASHJMPS)
 		smart_call_m64(a, &m_near.debug_log_hashjmp_fail);
 
+	if (m_count_hashjmps)
+		a.inc(MABS(&m_near.hashjmp_misses, 8));                                         // inc   [hashjmp_misses]
 	mov_mem_param(a, MABS(&m_state.exp, 4), pcp);                                       // mov   [exp],param
 	a.sub(rsp, 8);                                                                      // sub   rsp,8
 	a.call(MABS(exp.handle().codeptr_addr()));                                          // call  [exp]
@@ -4933,4 +5083,118 @@ void drcbe_x64::op_icopyf(Assembler &a, const instruction &inst)
 	}
 }
 
+
+//-------------------------------------------------
+//  op_vmov - process a VMOV opcode
+//-------------------------------------------------
+
+void drcbe_x64::op_vmov(Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+	be_parameter srcp(*this, inst.param(1), PTYPE_M);
+
+	a.movdqu(xmm0, vector_mem(a, srcp, rcx));                                           // movdqu xmm0,[srcp]
+	a.movdqu(vector_mem(a, dstp, rdx), xmm0);                                           // movdqu [dstp],xmm0
+}
+
+
+//-------------------------------------------------
+//  op_vshuf - process a VSHUF opcode
+//-------------------------------------------------
+
+void drcbe_x64::op_vshuf(Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+	be_parameter srcp(*this, inst.param(1), PTYPE_M);
+	uint32_t const lanes = inst.param(2).immediate();
+
+	// work out whether the pattern is a broadcast, or only moves lanes within each half
+	int sel[8];
+	bool splat = true, halves = true;
+	for (int lane = 0; lane < 8; lane++)
+	{
+		sel[lane] = (lanes >> (lane * 4)) & 7;
+		splat = splat && (sel[lane] == sel[0]);
+		halves = halves && ((sel[lane] >> 2) == (lane >> 2));
+	}
+
+	a.movdqu(xmm0, vector_mem(a, srcp, rcx));                                           // movdqu xmm0,[srcp]
+	if (splat && sel[0] < 4)
+	{
+		a.pshuflw(xmm0, xmm0, sel[0] * 0x55);                                           // pshuflw xmm0,xmm0,lane*0x55
+		a.punpcklqdq(xmm0, xmm0);                                                       // punpcklqdq xmm0,xmm0
+	}
+	else if (splat)
+	{
+		a.pshufhw(xmm0, xmm0, (sel[0] - 4) * 0x55);                                     // pshufhw xmm0,xmm0,lane*0x55
+		a.punpckhqdq(xmm0, xmm0);                                                       // punpckhqdq xmm0,xmm0
+	}
+	else if (halves)
+	{
+		uint32_t const lo = sel[0] | (sel[1] << 2) | (sel[2] << 4) | (sel[3] << 6);
+		uint32_t const hi = (sel[4] - 4) | ((sel[5] - 4) << 2) | ((sel[6] - 4) << 4) | ((sel[7] - 4) << 6);
+		if (lo != 0xe4)
+			a.pshuflw(xmm0, xmm0, lo);                                                  // pshuflw xmm0,xmm0,lo
+		if (hi != 0xe4)
+			a.pshufhw(xmm0, xmm0, hi);                                                  // pshufhw xmm0,xmm0,hi
+	}
+	else
+	{
+		a.movdqa(xmm1, xmm0);                                                           // movdqa xmm1,xmm0
+		for (int lane = 0; lane < 8; lane++)
+			if (sel[lane] != lane)
+			{
+				a.pextrw(eax, xmm1, sel[lane]);                                         // pextrw eax,xmm1,sel
+				a.pinsrw(xmm0, eax, lane);                                              // pinsrw xmm0,eax,lane
+			}
+	}
+	a.movdqu(vector_mem(a, dstp, rdx), xmm0);                                           // movdqu [dstp],xmm0
+}
+
+
+//-------------------------------------------------
+//  op_valu - process a VAND/VOR/VXOR/VADD/VSUB/
+//  VADDS/VSUBS opcode
+//-------------------------------------------------
+
+void drcbe_x64::op_valu(Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+	be_parameter src1p(*this, inst.param(1), PTYPE_M);
+	be_parameter src2p(*this, inst.param(2), PTYPE_M);
+
+	a.movdqu(xmm0, vector_mem(a, src1p, rcx));                                          // movdqu xmm0,[src1p]
+	a.movdqu(xmm1, vector_mem(a, src2p, rdx));                                          // movdqu xmm1,[src2p]
+	switch (inst.opcode())
+	{
+		case OP_VAND:   a.pand(xmm0, xmm1);     break;                                  // pand   xmm0,xmm1
+		case OP_VOR:    a.por(xmm0, xmm1);      break;                                  // por    xmm0,xmm1
+		case OP_VXOR:   a.pxor(xmm0, xmm1);     break;                                  // pxor   xmm0,xmm1
+		case OP_VADD:   a.paddw(xmm0, xmm1);    break;                                  // paddw  xmm0,xmm1
+		case OP_VSUB:   a.psubw(xmm0, xmm1);    break;                                  // psubw  xmm0,xmm1
+		case OP_VADDS:  a.paddsw(xmm0, xmm1);   break;                                  // paddsw xmm0,xmm1
+		case OP_VSUBS:  a.psubsw(xmm0, xmm1);   break;                                  // psubsw xmm0,xmm1
+		default:        throw emu_fatalerror("drcbe_x64::op_valu: unexpected opcode");
+	}
+	a.movdqu(vector_mem(a, dstp, rax), xmm0);                                           // movdqu [dstp],xmm0
+}
+
 } // namespace drc
@@ -39,6 +39,7 @@ public:
 	virtual int execute(uml::code_handle &entry) override;
 	virtual void generate(drcuml_block &block, const uml::instruction *instlist, uint32_t numinst) override;
 	virtual bool hash_exists(uint32_t mode, uint32_t pc) override;
+	virtual void hash_invalidate(uint32_t mode, uint32_t pc) override;
 	virtual void get_info(drcbe_info &info) override;
 	virtual bool logging() const override { return m_log != nullptr; }
 
@@ -118,6 +119,7 @@ private:
 	void normalize_commutative(be_parameter &inner, be_parameter &outer);
 	int32_t offset_from_rbp(const void *ptr) const;
 	asmjit::x86::Gp get_base_register_and_offset(asmjit::x86::Assembler &a, void *target, asmjit::x86::Gp const &reg, int32_t &offset);
+	asmjit::x86::Mem vector_mem(asmjit::x86::Assembler &a, be_parameter const &param, asmjit::x86::Gp const &reg);
 	void smart_call_r64(asmjit::x86::Assembler &a, x86code *target, asmjit::x86::Gp const &reg);
 	void smart_call_m64(asmjit::x86::Assembler &a, x86code **target);
 
@@ -201,6 +203,9 @@ private:
 	void op_frsqrt(asmjit::x86::Assembler &a, const uml::instruction &inst);
 	void op_fcopyi(asmjit::x86::Assembler &a, const uml::instruction &inst);
 	void op_icopyf(asmjit::x86::Assembler &a, const uml::instruction &inst);
+	void op_vmov(asmjit::x86::Assembler &a, const uml::instruction &inst);
+	void op_vshuf(asmjit::x86::Assembler &a, const uml::instruction &inst);
+	void op_valu(asmjit::x86::Assembler &a, const uml::instruction &inst);
 
 	// alu and shift operation helpers
 	static bool ones(u64 const value, unsigned const size) noexcept { return (size == 4) ? u32(value) == 0xffffffffU : value == 0xffffffff'ffffffffULL; }
@@ -224,6 +229,11 @@ private:
 
 	size_t emit(asmjit::CodeHolder &ch);
 
+	// block chaining helpers
+	void chain_block(x86code *dst, const uml::instruction *instlist, uint32_t numinst);
+	void chain_update(uint64_t key, drccodeptr target);
+	void report_stats();
+
 	// internal state
 	drc_hash_table          m_hash;                 // hash table state
 	drc_map_variables       m_map;                  // code map
@@ -238,6 +248,13 @@ private:
 	x86code *               m_exit;                 // exit point
 	x86code *               m_nocode;               // nocode handler
 
+	// hash jumps to fixed targets are chained directly once the target exists
+	std::vector<std::pair<uint64_t, size_t> > m_pending_chains; // chained jumps in the block being generated
+	std::unordered_map<uint64_t, std::vector<x86code *> > m_chains; // chained jumps to each mode/PC
+	bool const              m_count_hashjmps;       // count hash table lookups for -verbose
+	uint64_t                m_chain_links;          // chained jumps pointed at a target
+	uint64_t                m_chain_unlinks;        // chained jumps pointed back at the hash table
+
 	// state to live in the near cache
 	struct near_state
 	{
@@ -255,6 +272,9 @@ private:
 		void *              stacksave;              // saved stack pointer
 		void *              hashstacksave;          // saved stack pointer for hashjmp
 
+		uint64_t            hashjmp_lookups;        // hash jumps through the table, when counting
+		uint64_t            hashjmp_misses;         // hash jumps that found no code
+
 		uint8_t               flagsmap[0x1000];       // flags map
 		uint64_t              flagsunmap[0x20];       // flags unmapper
 	};
@@ -283,6 +283,17 @@ const drcbe_x86::opcode_table_entry drcbe_x86::s_opcode_table_source[] =
 	{ uml::OP_FRSQRT,  &drcbe_x86::op_frsqrt },     // FRSQRT  dst,src1
 	{ uml::OP_FCOPYI,  &drcbe_x86::op_fcopyi },     // FCOPYI  dst,src
 	{ uml::OP_ICOPYF,  &drcbe_x86::op_icopyf },     // ICOPYF  dst,src
+
+	// Vector Operations
+	{ uml::OP_VMOV,    &drcbe_x86::op_vmov },       // VMOV    dst,src
+	{ uml::OP_VSHUF,   &drcbe_x86::op_vshuf },      // VSHUF   dst,src,lanes
+	{ uml::OP_VAND,    &drcbe_x86::op_valu },       // VAND    dst,src1,src2
+	{ uml::OP_VOR,     &drcbe_x86::op_valu },       // VOR     dst,src1,src2
+	{ uml::OP_VXOR,    &drcbe_x86::op_valu },       // VXOR    dst,src1,src2
+	{ uml::OP_VADD,    &drcbe_x86::op_valu },       // VADD    dst,src1,src2
+	{ uml::OP_VSUB,    &drcbe_x86::op_valu },       // VSUB    dst,src1,src2
+	{ uml::OP_VADDS,   &drcbe_x86::op_valu },       // VADDS   dst,src1,src2
+	{ uml::OP_VSUBS,   &drcbe_x86::op_valu }        // VSUBS   dst,src1,src2,
 };
 
 class ThrowableErrorHandler : public ErrorHandler
@@ -895,6 +906,17 @@ bool drcbe_x86::hash_exists(uint32_t mode, uint32_t pc)
 }
 
 
+//-------------------------------------------------
+//  hash_invalidate - forget the code for the
+//  given mode/pc so it is compiled again
+//-------------------------------------------------
+
+void drcbe_x86::hash_invalidate(uint32_t mode, uint32_t pc)
+{
+	m_hash.invalidate(mode, pc);
+}
+
+
 //-------------------------------------------------
 //  drcbex86_get_info - return information about
 //  the back-end implementation
@@ -6163,4 +6185,118 @@ int drcbe_x86::ddivs(uint64_t &dstlo, uint64_t &dsthi, int64_t src1, int64_t src
 	return ((dstlo == 0) << 2) | ((dstlo >> 60) & FLAG_S);
 }
 
+
+//-------------------------------------------------
+//  op_vmov - process a VMOV opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_vmov(Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+	be_parameter srcp(*this, inst.param(1), PTYPE_M);
+
+	a.movdqu(xmm0, MABS(srcp.memory(), 16));                                            // movdqu xmm0,[srcp]
+	a.movdqu(MABS(dstp.memory(), 16), xmm0);                                            // movdqu [dstp],xmm0
+}
+
+
+//-------------------------------------------------
+//  op_vshuf - process a VSHUF opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_vshuf(Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+	be_parameter srcp(*this, inst.param(1), PTYPE_M);
+	uint32_t const lanes = inst.param(2).immediate();
+
+	// work out whether the pattern is a broadcast, or only moves lanes within each half
+	int sel[8];
+	bool splat = true, halves = true;
+	for (int lane = 0; lane < 8; lane++)
+	{
+		sel[lane] = (lanes >> (lane * 4)) & 7;
+		splat = splat && (sel[lane] == sel[0]);
+		halves = halves && ((sel[lane] >> 2) == (lane >> 2));
+	}
+
+	a.movdqu(xmm0, MABS(srcp.memory(), 16));                                            // movdqu xmm0,[srcp]
+	if (splat && sel[0] < 4)
+	{
+		a.pshuflw(xmm0, xmm0, sel[0] * 0x55);                                           // pshuflw xmm0,xmm0,lane*0x55
+		a.punpcklqdq(xmm0, xmm0);                                                       // punpcklqdq xmm0,xmm0
+	}
+	else if (splat)
+	{
+		a.pshufhw(xmm0, xmm0, (sel[0] - 4) * 0x55);                                     // pshufhw xmm0,xmm0,lane*0x55
+		a.punpckhqdq(xmm0, xmm0);                                                       // punpckhqdq xmm0,xmm0
+	}
+	else if (halves)
+	{
+		uint32_t const lo = sel[0] | (sel[1] << 2) | (sel[2] << 4) | (sel[3] << 6);
+		uint32_t const hi = (sel[4] - 4) | ((sel[5] - 4) << 2) | ((sel[6] - 4) << 4) | ((sel[7] - 4) << 6);
+		if (lo != 0xe4)
+			a.pshuflw(xmm0, xmm0, lo);                                                  // pshuflw xmm0,xmm0,lo
+		if (hi != 0xe4)
+			a.pshufhw(xmm0, xmm0, hi);                                                  // pshufhw xmm0,xmm0,hi
+	}
+	else
+	{
+		a.movdqa(xmm1, xmm0);                                                           // movdqa xmm1,xmm0
+		for (int lane = 0; lane < 8; lane++)
+			if (sel[lane] != lane)
+			{
+				a.pextrw(eax, xmm1, sel[lane]);                                         // pextrw eax,xmm1,sel
+				a.pinsrw(xmm0, eax, lane);                                              // pinsrw xmm0,eax,lane
+			}
+	}
+	a.movdqu(MABS(dstp.memory(), 16), xmm0);                                            // movdqu [dstp],xmm0
+}
+
+
+//-------------------------------------------------
+//  op_valu - process a VAND/VOR/VXOR/VADD/VSUB/
+//  VADDS/VSUBS opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_valu(Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+	be_parameter src1p(*this, inst.param(1), PTYPE_M);
+	be_parameter src2p(*this, inst.param(2), PTYPE_M);
+
+	a.movdqu(xmm0, MABS(src1p.memory(), 16));                                           // movdqu xmm0,[src1p]
+	a.movdqu(xmm1, MABS(src2p.memory(), 16));                                           // movdqu xmm1,[src2p]
+	switch (inst.opcode())
+	{
+		case OP_VAND:   a.pand(xmm0, xmm1);     break;                                  // pand   xmm0,xmm1
+		case OP_VOR:    a.por(xmm0, xmm1);      break;                                  // por    xmm0,xmm1
+		case OP_VXOR:   a.pxor(xmm0, xmm1);     break;                                  // pxor   xmm0,xmm1
+		case OP_VADD:   a.paddw(xmm0, xmm1);    break;                                  // paddw  xmm0,xmm1
+		case OP_VSUB:   a.psubw(xmm0, xmm1);    break;                                  // psubw  xmm0,xmm1
+		case OP_VADDS:  a.paddsw(xmm0, xmm1);   break;                                  // paddsw xmm0,xmm1
+		case OP_VSUBS:  a.psubsw(xmm0, xmm1);   break;                                  // psubsw xmm0,xmm1
+		default:        throw emu_fatalerror("drcbe_x86::op_valu: unexpected opcode");
+	}
+	a.movdqu(MABS(dstp.memory(), 16), xmm0);                                            // movdqu [dstp],xmm0
+}
+
 } // namespace drc
@@ -40,6 +40,7 @@ public:
 	virtual int execute(uml::code_handle &entry) override;
 	virtual void generate(drcuml_block &block, const uml::instruction *instlist, uint32_t numinst) override;
 	virtual bool hash_exists(uint32_t mode, uint32_t pc) override;
+	virtual void hash_invalidate(uint32_t mode, uint32_t pc) override;
 	virtual void get_info(drcbe_info &info) override;
 	virtual bool logging() const override { return m_log != nullptr; }
 
@@ -209,6 +210,9 @@ private:
 	void op_frsqrt(asmjit::x86::Assembler &a, const uml::instruction &inst);
 	void op_fcopyi(asmjit::x86::Assembler &a, const uml::instruction &inst);
 	void op_icopyf(asmjit::x86::Assembler &a, const uml::instruction &inst);
+	void op_vmov(asmjit::x86::Assembler &a, const uml::instruction &inst);
+	void op_vshuf(asmjit::x86::Assembler &a, const uml::instruction &inst);
+	void op_valu(asmjit::x86::Assembler &a, const uml::instruction &inst);
 
 	// 32-bit code emission helpers
 	void emit_mov_r32_p32(asmjit::x86::Assembler &a, asmjit::x86::Gp const &reg, be_parameter const &param);
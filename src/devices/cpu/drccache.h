@@ -49,11 +49,14 @@ public:
 	drccodeptr near() const { return m_near; }
 	drccodeptr base() const { return m_base; }
 	drccodeptr top() const { return m_top; }
+	size_t size() const { return m_size; }
+	size_t used() const { return (m_neartop - m_near) + (m_top - m_base) + (m_near + m_size - m_end); }
 
 	// pointer checking
 	bool contains_pointer(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_near + m_size); }
 	bool contains_near_pointer(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_neartop); }
 	bool generating_code() const { return (m_codegen != nullptr); }
+	bool executable() const { return m_executable; }
 
 	// memory management
 	void flush();
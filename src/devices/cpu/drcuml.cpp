@@ -11,7 +11,7 @@
     Future improvements/changes:
 
     * UML optimizer:
-        - constant folding
+        - register allocation hints for the back-ends
 
     * Write a back-end validator:
         - checks all combinations of memory/register/immediate on all params
@@ -35,12 +35,15 @@
 #include "drcuml.h"
 
 #include "emuopts.h"
+#include "romload.h"
 #include "drcbec.h"
 #ifdef NATIVE_DRC
 #include "drcbex86.h"
 #include "drcbex64.h"
+#include "drcbearm64.h"
 #endif
 
+#include <algorithm>
 #include <fstream>
 
 
@@ -78,6 +81,153 @@ struct bevalidate_test
 
 
 
+//**************************************************************************
+//  OPTIMIZER HELPERS
+//**************************************************************************
+
+namespace {
+
+//-------------------------------------------------
+//  is_optimizer_barrier - return true if an
+//  instruction can be reached from elsewhere or
+//  may change registers behind the optimizer's
+//  back
+//-------------------------------------------------
+
+bool is_optimizer_barrier(uml::instruction const &inst)
+{
+	switch (inst.opcode())
+	{
+	case uml::OP_HANDLE:
+	case uml::OP_HASH:
+	case uml::OP_LABEL:
+	case uml::OP_EXH:
+	case uml::OP_CALLH:
+	case uml::OP_CALLC:
+	case uml::OP_RESTORE:
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+
+//-------------------------------------------------
+//  accesses_memory_through_operands - return true
+//  if an opcode only reads or writes memory via
+//  its memory operands
+//-------------------------------------------------
+
+bool accesses_memory_through_operands(uml::opcode_t opcode)
+{
+	switch (opcode)
+	{
+	case uml::OP_COMMENT:
+	case uml::OP_MAPVAR:
+	case uml::OP_NOP:
+	case uml::OP_JMP:
+	case uml::OP_LOAD:
+	case uml::OP_LOADS:
+	case uml::OP_FLOAD:
+		return true;
+
+	default:
+		return ((opcode >= uml::OP_CARRY) && (opcode <= uml::OP_RORC)) || ((opcode >= uml::OP_FMOV) && (opcode <= uml::OP_ICOPYF));
+	}
+}
+
+} // anonymous namespace
+
+
+
+//**************************************************************************
+//  PERSISTENT CACHE FORMAT
+//**************************************************************************
+
+namespace {
+
+// file header; the version changes whenever UML or the file layout does
+char const PERSIST_MAGIC[8] = { 'M', 'A', 'M', 'E', 'D', 'R', 'C', 'P' };
+constexpr u32 PERSIST_VERSION = 1;
+
+// how a memory pointer is relocated
+enum : u8
+{
+	PERSIST_RELOC_SYMBOL = 0,                       // offset from a named symbol
+	PERSIST_RELOC_REGION,                           // offset into a memory region
+	PERSIST_RELOC_SHARE                             // offset into a memory share
+};
+
+
+// C functions are saved relative to this, since they move together with it
+void persist_anchor(void *param)
+{
+}
+
+
+// C function offsets are only valid for the binary that saved them; there's
+// no portable way to identify the executable, so use when this file was built
+// and where functions from a few other modules ended up relative to the anchor
+std::string persist_build_id()
+{
+	auto const offset = [] (auto *func) { return reinterpret_cast<uintptr_t>(func) - reinterpret_cast<uintptr_t>(&persist_anchor); };
+	return util::string_format("%s %s|%X|%X|%X",
+			__DATE__, __TIME__,
+			offset(&osd_ticks),
+			offset(&osd_getenv),
+			offset(&emulator_info::get_build_version));
+}
+
+
+// little helpers for building and parsing the serialized data
+void put_u8(std::vector<u8> &data, u8 value) { data.push_back(value); }
+void put_u32(std::vector<u8> &data, u32 value) { for (int shift = 0; shift < 32; shift += 8) data.push_back(u8(value >> shift)); }
+void put_u64(std::vector<u8> &data, u64 value) { for (int shift = 0; shift < 64; shift += 8) data.push_back(u8(value >> shift)); }
+void put_string(std::vector<u8> &data, std::string_view string) { put_u32(data, string.length()); data.insert(data.end(), string.begin(), string.end()); }
+
+bool get_u8(u8 const *&src, u8 const *end, u8 &value)
+{
+	if (src >= end)
+		return false;
+	value = *src++;
+	return true;
+}
+
+bool get_u32(u8 const *&src, u8 const *end, u32 &value)
+{
+	if ((end - src) < 4)
+		return false;
+	value = 0;
+	for (int shift = 0; shift < 32; shift += 8)
+		value |= u32(*src++) << shift;
+	return true;
+}
+
+bool get_u64(u8 const *&src, u8 const *end, u64 &value)
+{
+	if ((end - src) < 8)
+		return false;
+	value = 0;
+	for (int shift = 0; shift < 64; shift += 8)
+		value |= u64(*src++) << shift;
+	return true;
+}
+
+bool get_string(u8 const *&src, u8 const *end, std::string &string)
+{
+	u32 length;
+	if (!get_u32(src, end, length) || (end - src) < length)
+		return false;
+	string.assign(reinterpret_cast<char const *>(src), length);
+	src += length;
+	return true;
+}
+
+} // anonymous namespace
+
+
+
 //**************************************************************************
 //  DRC BACKEND INTERFACE
 //**************************************************************************
@@ -148,7 +298,35 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 	, m_blocklist()
 	, m_handlelist()
 	, m_symlist()
+	, m_flags(flags)
+	, m_modes(modes)
+	, m_addrbits(addrbits)
+	, m_ignorebits(ignorebits)
+	, m_persist(device.machine().options().drc_cache())
+	, m_persist_loaded(false)
+	, m_persist_dirty(false)
+	, m_persist_restoring(false)
+	, m_persist_config()
+	, m_persist_key()
+	, m_persist_blocks()
+	, m_stats()
+	, m_code_pages()
+	, m_profile(device.machine().options().drc_profile() > 0)
+	, m_profile_timing(device.machine().options().drc_profile() > 1)
+	, m_profile_blocks()
+	, m_profile_current(nullptr)
+	, m_profile_start(0)
 {
+	// write out anything new when the machine goes away
+	if (m_persist)
+		device.machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&drcuml_state::persist_save, this));
+	if (device.machine().options().verbose())
+		device.machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&drcuml_state::report_stats, this));
+	if (m_profile)
+		device.machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&drcuml_state::profile_report, this));
+
+	// the cache belongs to the CPU and outlives the machine
+	device.machine().add_memory_reporter(device, "drc cache", [&cache] () { return cache.used(); });
 }
 
 
@@ -178,6 +356,13 @@ void drcuml_state::reset()
 		for (uml::code_handle &handle : m_handlelist)
 			*handle.codeptr_addr() = nullptr;
 
+		// nothing is left to invalidate
+		m_code_pages.clear();
+
+		// saved blocks may be used again now that everything is gone
+		for (auto &entry : m_persist_blocks)
+			entry.second.restored = false;
+
 		// call the backend to reset
 		m_beintf->reset();
 
@@ -275,6 +460,629 @@ const char *drcuml_state::symbol_find(void *base, u32 *offset)
 }
 
 
+//-------------------------------------------------
+//  report_stats - print what the optimizer has
+//  done
+//-------------------------------------------------
+
+void drcuml_state::report_stats()
+{
+	osd_printf_verbose("%s: UML optimizer saw %u instructions in %u blocks\n", m_device.tag(), m_stats.instructions, m_stats.blocks);
+	osd_printf_verbose("  flags: %u instructions generating unused flags\n", m_stats.flags_removed);
+	osd_printf_verbose("  constants: %u operands replaced, %u instructions folded\n", m_stats.constants, m_stats.folded);
+	osd_printf_verbose("  moves: %u redundant loads, %u redundant stores removed\n", m_stats.loads_removed, m_stats.stores_removed);
+}
+
+
+//-------------------------------------------------
+//  profile_block - add code to count entries to
+//  each hash entry point in a finished block
+//-------------------------------------------------
+
+void drcuml_state::profile_block(std::vector<uml::instruction> &instlist, u32 &numinst)
+{
+	std::vector<uml::instruction> instrumented;
+	instrumented.reserve(std::max<size_t>(instlist.size(), numinst * 2));
+	for (u32 index = 0; index < numinst; index++)
+	{
+		uml::instruction const &inst(instlist[index]);
+		instrumented.push_back(inst);
+		if (inst.opcode() != uml::OP_HASH)
+			continue;
+
+		// counters outlive cache resets, so retranslated blocks keep adding to them
+		u32 const mode(inst.param(0).immediate());
+		u32 const pc(inst.param(1).immediate());
+		profile_entry &entry(m_profile_blocks.emplace((u64(mode) << 32) | pc, profile_entry{ this, mode, pc, 0, 0 }).first->second);
+
+		// flags are undefined at an entry point, so bumping the counter in memory is free to change them
+		if (m_profile_timing)
+			instrumented.emplace_back().callc(&drcuml_state::profile_enter, &entry);
+		else
+			instrumented.emplace_back().dadd(uml::mem(&entry.hits), uml::mem(&entry.hits), 1);
+	}
+
+	// keep room for the largest block this one may be reused for
+	numinst = instrumented.size();
+	if (instrumented.size() < instlist.size())
+		instrumented.resize(instlist.size());
+	instlist.swap(instrumented);
+}
+
+
+//-------------------------------------------------
+//  profile_enter - count an entry to a block and
+//  charge the time since the last one to the
+//  previous block
+//-------------------------------------------------
+
+void drcuml_state::profile_enter(void *param)
+{
+	profile_entry &entry(*reinterpret_cast<profile_entry *>(param));
+	drcuml_state &drcuml(*entry.owner);
+	osd_ticks_t const now(osd_ticks());
+
+	if (drcuml.m_profile_current)
+		drcuml.m_profile_current->ticks += now - drcuml.m_profile_start;
+	drcuml.m_profile_current = &entry;
+	drcuml.m_profile_start = now;
+	entry.hits++;
+}
+
+
+//-------------------------------------------------
+//  execute_profiled - run generated code, making
+//  sure time outside it isn't charged to the last
+//  block entered
+//-------------------------------------------------
+
+int drcuml_state::execute_profiled(uml::code_handle &entry)
+{
+	m_profile_current = nullptr;
+	int const result(m_beintf->execute(entry));
+	if (m_profile_current)
+	{
+		m_profile_current->ticks += osd_ticks() - m_profile_start;
+		m_profile_current = nullptr;
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  profile_report - write the block profile as a
+//  sorted report, plus a debugger script that
+//  marks the hottest blocks in the disassembly
+//-------------------------------------------------
+
+void drcuml_state::profile_report()
+{
+	// sort by host time if we have it, otherwise by entries
+	std::vector<profile_entry const *> sorted;
+	u64 totalhits(0);
+	osd_ticks_t totalticks(0);
+	for (auto const &block : m_profile_blocks)
+	{
+		if (block.second.hits == 0)
+			continue;
+		sorted.push_back(&block.second);
+		totalhits += block.second.hits;
+		totalticks += block.second.ticks;
+	}
+	bool const timed(m_profile_timing && totalticks);
+	std::sort(
+			sorted.begin(),
+			sorted.end(),
+			[timed] (profile_entry const *a, profile_entry const *b) { return timed ? (a->ticks > b->ticks) : (a->hits > b->hits); });
+
+	std::ofstream report(util::string_format("drcprof_%s.txt", m_device.shortname()));
+	util::stream_format(report, "DRC block profile for %s (%s)\n\n", m_device.tag(), timed ? "sorted by host time" : "sorted by entries");
+	util::stream_format(report, "Mode  PC                 Entries  %%Entries        Host ticks    %%Time\n");
+	for (profile_entry const *block : sorted)
+	{
+		util::stream_format(
+				report,
+				"%4u  %08X  %16u  %7.3f%%  %16u  %6.3f%%\n",
+				block->mode,
+				block->pc,
+				block->hits,
+				100.0 * double(block->hits) / double(totalhits),
+				block->ticks,
+				totalticks ? (100.0 * double(block->ticks) / double(totalticks)) : 0.0);
+	}
+	util::stream_format(report, "\n%u blocks, %u entries, %u ticks\n", sorted.size(), totalhits, totalticks);
+
+	// a script for the debugger's source command
+	std::ofstream script(util::string_format("drcprof_%s.cmd", m_device.shortname()));
+	util::stream_format(script, "focus %s\n", m_device.tag());
+	for (size_t index = 0; (index < sorted.size()) && (index < 100); index++)
+	{
+		profile_entry const &block(*sorted[index]);
+		if (timed)
+			util::stream_format(script, "comadd %X,drc rank %u: %.2f%% of time in %u entries\n", block.pc, index + 1, 100.0 * double(block.ticks) / double(totalticks), block.hits);
+		else
+			util::stream_format(script, "comadd %X,drc rank %u: %.2f%% of entries\n", block.pc, index + 1, 100.0 * double(block.hits) / double(totalhits));
+	}
+}
+
+
+//-------------------------------------------------
+//  track_code - note that the code for a mode/PC
+//  was built from the given range of physical
+//  addresses
+//-------------------------------------------------
+
+void drcuml_state::track_code(u32 mode, u32 pc, offs_t start, offs_t end)
+{
+	u64 const entry((u64(mode) << 32) | pc);
+	for (offs_t page = start >> CODE_PAGE_SHIFT; page <= (end >> CODE_PAGE_SHIFT); page++)
+	{
+		std::vector<u64> &entries(m_code_pages[page]);
+		if (entries.empty() || (entries.back() != entry))
+			entries.push_back(entry);
+	}
+}
+
+
+//-------------------------------------------------
+//  invalidate_code - forget all code built from
+//  a range of physical addresses, so it is
+//  compiled again when next reached
+//-------------------------------------------------
+
+void drcuml_state::invalidate_code(offs_t start, offs_t end)
+{
+	// the code itself stays in the cache until the next reset; only the way in is removed
+	for (offs_t page = start >> CODE_PAGE_SHIFT; page <= (end >> CODE_PAGE_SHIFT); page++)
+	{
+		auto const found = m_code_pages.find(page);
+		if (found != m_code_pages.end())
+		{
+			for (u64 const entry : found->second)
+				m_beintf->hash_invalidate(u32(entry >> 32), u32(entry));
+			m_code_pages.erase(found);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  set_persistent_config - describe anything
+//  about the CPU core that changes the code it
+//  generates
+//-------------------------------------------------
+
+void drcuml_state::set_persistent_config(std::string &&config)
+{
+	// blocks translated with a different configuration are of no use
+	if (config != m_persist_config)
+	{
+		m_persist_config = std::move(config);
+		m_persist_blocks.clear();
+		m_persist_loaded = false;
+		m_persist_dirty = false;
+	}
+}
+
+
+//-------------------------------------------------
+//  restore_block - generate the block for a
+//  mode/PC from the persistent cache if it is
+//  there, returning true if so
+//-------------------------------------------------
+
+bool drcuml_state::restore_block(u32 mode, u32 pc)
+{
+	if (!m_persist)
+		return false;
+	if (!m_persist_loaded)
+		persist_load();
+
+	// each saved block is used at most once between resets, so one that fails its own validation gets translated again
+	auto const found = m_persist_blocks.find((u64(mode) << 32) | pc);
+	if ((found == m_persist_blocks.end()) || found->second.restored)
+		return false;
+	found->second.restored = true;
+
+	// rebuild the instructions, giving up if anything they refer to has gone
+	std::vector<uml::instruction> instructions;
+	u8 const *src = found->second.data.data();
+	u8 const *const end = src + found->second.data.size();
+	bool valid = true;
+	while (valid && (src < end))
+	{
+		u8 opcode, size, condition, numparams;
+		uml::parameter params[uml::instruction::MAX_PARAMS];
+		valid = get_u8(src, end, opcode) && get_u8(src, end, size) && get_u8(src, end, condition) && get_u8(src, end, numparams);
+		valid = valid && (opcode < uml::OP_MAX) && (numparams <= uml::instruction::MAX_PARAMS);
+		for (int pnum = 0; valid && (pnum < numparams); pnum++)
+		{
+			u8 type;
+			valid = get_u8(src, end, type);
+			if (!valid)
+				break;
+
+			switch (type)
+			{
+			case uml::parameter::PTYPE_MEMORY:
+				{
+					void *ptr;
+					valid = unpersist_pointer(src, end, ptr);
+					params[pnum] = uml::parameter::make_memory(ptr);
+				}
+				break;
+
+			case uml::parameter::PTYPE_CODE_HANDLE:
+				{
+					std::string name;
+					valid = get_string(src, end, name);
+					auto const handle = std::find_if(m_handlelist.begin(), m_handlelist.end(), [&name] (uml::code_handle const &h) { return name == h.string(); });
+					valid = valid && (handle != m_handlelist.end());
+					if (valid)
+						params[pnum] = uml::parameter(*handle);
+				}
+				break;
+
+			case uml::parameter::PTYPE_C_FUNCTION:
+				{
+					u64 offset;
+					valid = get_u64(src, end, offset);
+					params[pnum] = uml::parameter::make_raw(uml::parameter::PTYPE_C_FUNCTION, reinterpret_cast<uintptr_t>(&persist_anchor) + offset);
+				}
+				break;
+
+			case uml::parameter::PTYPE_NONE:
+			case uml::parameter::PTYPE_STRING:
+				valid = false;
+				break;
+
+			default:
+				{
+					u64 value;
+					valid = (type < uml::parameter::PTYPE_MAX) && get_u64(src, end, value);
+					params[pnum] = uml::parameter::make_raw(uml::parameter::parameter_type(type), value);
+				}
+				break;
+			}
+		}
+		if (valid)
+		{
+			instructions.emplace_back();
+			instructions.back().rebuild(uml::opcode_t(opcode), size, uml::condition_t(condition), numparams, params);
+		}
+	}
+	if (!valid || instructions.empty())
+	{
+		osd_printf_verbose("%s: discarding unusable DRC cache block for %X:%08X\n", m_device.tag(), mode, pc);
+		m_persist_blocks.erase(found);
+		return false;
+	}
+
+	// replay them through a block as though they had just been generated
+	m_persist_restoring = true;
+	try
+	{
+		drcuml_block &block(begin_block(instructions.size()));
+		for (uml::instruction const &inst : instructions)
+			block.append() = inst;
+		block.end();
+	}
+	catch (drcuml_block::abort_compilation &)
+	{
+		// out of cache space; let the CPU core deal with it
+		m_persist_restoring = false;
+		found->second.restored = false;
+		return false;
+	}
+	m_persist_restoring = false;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  persist_block - save a block that has just
+//  been generated for later runs
+//-------------------------------------------------
+
+void drcuml_state::persist_block(uml::instruction const *instlist, u32 numinst)
+{
+	if (!m_persist || m_persist_restoring)
+		return;
+
+	// blocks are found again by the first mode/PC they register; others are static code
+	uml::instruction const *const instend = instlist + numinst;
+	uml::instruction const *const hash = std::find_if(instlist, instend, [] (uml::instruction const &inst) { return inst.opcode() == uml::OP_HASH; });
+	if (hash == instend)
+		return;
+	if (!m_persist_loaded)
+		persist_load();
+
+	std::vector<u8> data;
+	data.reserve(numinst * 24);
+	for (uml::instruction const *inst = instlist; inst != instend; inst++)
+	{
+		// comments point at temporary strings, and are only there for the logs anyway
+		if (inst->opcode() == uml::OP_COMMENT)
+			continue;
+
+		put_u8(data, inst->opcode());
+		put_u8(data, inst->size());
+		put_u8(data, inst->condition());
+		put_u8(data, inst->numparams());
+		for (int pnum = 0; pnum < inst->numparams(); pnum++)
+		{
+			uml::parameter const &param(inst->param(pnum));
+			put_u8(data, param.type());
+			switch (param.type())
+			{
+			case uml::parameter::PTYPE_MEMORY:
+				if (!persist_pointer(data, param.memory()))
+					return;
+				break;
+
+			case uml::parameter::PTYPE_CODE_HANDLE:
+				put_string(data, param.handle().string());
+				break;
+
+			case uml::parameter::PTYPE_C_FUNCTION:
+				put_u64(data, reinterpret_cast<uintptr_t>(param.cfunc()) - reinterpret_cast<uintptr_t>(&persist_anchor));
+				break;
+
+			case uml::parameter::PTYPE_STRING:
+				return;
+
+			default:
+				put_u64(data, param.raw_value());
+				break;
+			}
+		}
+	}
+
+	// this translation is current, so don't replace it with an older one before the next reset
+	persistent_block &block(m_persist_blocks[(hash->param(0).immediate() << 32) | u32(hash->param(1).immediate())]);
+	block.data = std::move(data);
+	block.restored = true;
+	m_persist_dirty = true;
+}
+
+
+//-------------------------------------------------
+//  persist_key - build a string identifying
+//  everything the translated code depends on
+//-------------------------------------------------
+
+std::string drcuml_state::persist_key() const
+{
+	// any ROM or image in the system may hold code, so hash them all
+	running_machine &machine(m_device.machine());
+	util::sha1_creator hash;
+	for (device_t &device : device_enumerator(machine.root_device()))
+	{
+		for (rom_entry const *region = rom_first_region(device); region; region = rom_next_region(region))
+		{
+			for (rom_entry const *rom = rom_first_file(region); rom; rom = rom_next_file(rom))
+				hash.append(rom->hashdata().c_str(), rom->hashdata().length() + 1);
+		}
+	}
+	for (device_image_interface &image : image_interface_enumerator(machine.root_device()))
+	{
+		if (image.filename())
+		{
+			std::string const hashdata(image.hash().internal_string());
+			hash.append(image.filename(), strlen(image.filename()) + 1);
+			hash.append(hashdata.c_str(), hashdata.length() + 1);
+		}
+	}
+
+	// pointers to C functions are only meaningful within a single build
+	return util::string_format("%s|%s|%s|%s|%s|%X|%d|%d|%d|%s|%s",
+			emulator_info::get_build_version(),
+			persist_build_id(),
+			machine.system().name,
+			m_device.tag(),
+			m_device.shortname(),
+			m_flags,
+			m_modes,
+			m_addrbits,
+			m_ignorebits,
+			m_persist_config,
+			hash.finish().as_string());
+}
+
+
+//-------------------------------------------------
+//  persist_filename - return the name of the
+//  persistent cache file for this CPU
+//-------------------------------------------------
+
+std::string drcuml_state::persist_filename() const
+{
+	std::string tag(m_device.tag() + 1);
+	std::replace(tag.begin(), tag.end(), ':', '_');
+	return std::string(m_device.machine().basename()).append(PATH_SEPARATOR).append(tag).append(".drc");
+}
+
+
+//-------------------------------------------------
+//  persist_load - read blocks saved by an
+//  earlier run
+//-------------------------------------------------
+
+void drcuml_state::persist_load()
+{
+	// the key is fixed when first needed, since images are gone by the time it's saved
+	m_persist_loaded = true;
+	m_persist_key = persist_key();
+
+	emu_file file(m_device.machine().options().drc_cache_directory(), OPEN_FLAG_READ);
+	if (file.open(persist_filename()) != osd_file::error::NONE)
+		return;
+	std::vector<u8> data(file.size());
+	if (data.empty() || (file.read(&data[0], data.size()) != data.size()))
+		return;
+
+	// anything translated for a different build, system or configuration is useless
+	u8 const *src = &data[0];
+	u8 const *const end = src + data.size();
+	u32 version, count;
+	std::string key;
+	if ((data.size() < sizeof(PERSIST_MAGIC)) || memcmp(src, PERSIST_MAGIC, sizeof(PERSIST_MAGIC)))
+		return;
+	src += sizeof(PERSIST_MAGIC);
+	if (!get_u32(src, end, version) || (version != PERSIST_VERSION) || !get_string(src, end, key) || (key != m_persist_key) || !get_u32(src, end, count))
+	{
+		osd_printf_verbose("%s: ignoring stale DRC cache %s\n", m_device.tag(), persist_filename());
+		return;
+	}
+
+	// blocks are only parsed when they're needed
+	for (u32 blocknum = 0; blocknum < count; blocknum++)
+	{
+		u64 blockkey;
+		u32 length;
+		if (!get_u64(src, end, blockkey) || !get_u32(src, end, length) || ((end - src) < length))
+			break;
+		persistent_block &block(m_persist_blocks[blockkey]);
+		block.data.assign(src, src + length);
+		block.restored = false;
+		src += length;
+	}
+	osd_printf_verbose("%s: loaded %u blocks from DRC cache %s\n", m_device.tag(), unsigned(m_persist_blocks.size()), persist_filename());
+}
+
+
+//-------------------------------------------------
+//  persist_save - write all saved blocks out if
+//  there is anything new
+//-------------------------------------------------
+
+void drcuml_state::persist_save()
+{
+	if (!m_persist_dirty)
+		return;
+	m_persist_dirty = false;
+
+	std::vector<u8> data(std::begin(PERSIST_MAGIC), std::end(PERSIST_MAGIC));
+	put_u32(data, PERSIST_VERSION);
+	put_string(data, m_persist_key);
+	put_u32(data, m_persist_blocks.size());
+	for (auto const &entry : m_persist_blocks)
+	{
+		put_u64(data, entry.first);
+		put_u32(data, entry.second.data.size());
+		data.insert(data.end(), entry.second.data.begin(), entry.second.data.end());
+	}
+
+	emu_file file(m_device.machine().options().drc_cache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(persist_filename()) == osd_file::error::NONE)
+		file.write(&data[0], data.size());
+	else
+		osd_printf_warning("%s: unable to write DRC cache %s\n", m_device.tag(), persist_filename());
+}
+
+
+//-------------------------------------------------
+//  persist_pointer - save a memory pointer
+//  relative to something that will be found at
+//  the same place next time
+//-------------------------------------------------
+
+bool drcuml_state::persist_pointer(std::vector<u8> &data, void const *ptr) const
+{
+	drccodeptr const search(reinterpret_cast<drccodeptr>(const_cast<void *>(ptr)));
+
+	// symbols registered by the CPU core come first, provided the name finds the same one again
+	auto const symbol = std::find_if(m_symlist.begin(), m_symlist.end(), [search] (auto const &sym) { return sym.includes(search); });
+	if (symbol != m_symlist.end())
+	{
+		auto const named = std::find_if(m_symlist.begin(), m_symlist.end(), [&symbol] (auto const &sym) { return sym.name() == symbol->name(); });
+		if (named != symbol)
+			return false;
+		put_u8(data, PERSIST_RELOC_SYMBOL);
+		put_string(data, symbol->name());
+		put_u64(data, search - symbol->base());
+		return true;
+	}
+
+	// then memory regions and shares, which hold most code and data
+	memory_manager &memory(m_device.machine().memory());
+	for (auto const &region : memory.regions())
+	{
+		u8 const *const base(region.second->base());
+		if ((search >= base) && (search < (base + region.second->bytes())))
+		{
+			put_u8(data, PERSIST_RELOC_REGION);
+			put_string(data, region.first);
+			put_u64(data, search - base);
+			return true;
+		}
+	}
+	for (auto const &share : memory.shares())
+	{
+		u8 const *const base(reinterpret_cast<u8 const *>(share.second->ptr()));
+		if ((search >= base) && (search < (base + share.second->bytes())))
+		{
+			put_u8(data, PERSIST_RELOC_SHARE);
+			put_string(data, share.first);
+			put_u64(data, search - base);
+			return true;
+		}
+	}
+
+	// anything else may be somewhere different next time
+	return false;
+}
+
+
+//-------------------------------------------------
+//  unpersist_pointer - turn a saved memory
+//  pointer back into an address
+//-------------------------------------------------
+
+bool drcuml_state::unpersist_pointer(u8 const *&src, u8 const *end, void *&ptr) const
+{
+	u8 type;
+	std::string name;
+	u64 offset;
+	if (!get_u8(src, end, type) || !get_string(src, end, name) || !get_u64(src, end, offset))
+		return false;
+
+	memory_manager &memory(m_device.machine().memory());
+	switch (type)
+	{
+	case PERSIST_RELOC_SYMBOL:
+		{
+			auto const symbol = std::find_if(m_symlist.begin(), m_symlist.end(), [&name] (auto const &sym) { return sym.name() == name; });
+			if ((symbol == m_symlist.end()) || !symbol->includes(symbol->base() + offset))
+				return false;
+			ptr = symbol->base() + offset;
+		}
+		return true;
+
+	case PERSIST_RELOC_REGION:
+		{
+			auto const region = memory.regions().find(name);
+			if ((region == memory.regions().end()) || (offset >= region->second->bytes()))
+				return false;
+			ptr = region->second->base() + offset;
+		}
+		return true;
+
+	case PERSIST_RELOC_SHARE:
+		{
+			auto const share = memory.shares().find(name);
+			if ((share == memory.shares().end()) || (offset >= share->second->bytes()))
+				return false;
+			ptr = reinterpret_cast<u8 *>(share->second->ptr()) + offset;
+		}
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+
 //-------------------------------------------------
 //  log_vprintf - directly printf to the UML log
 //  if generated
@@ -340,6 +1148,13 @@ void drcuml_block::end()
 {
 	assert(m_inuse);
 
+	// keep a copy for later runs before optimization rewrites it
+	m_drcuml.persist_block(&m_inst[0], m_nextinst);
+
+	// count entries to the block; saved copies stay free of profiling code
+	if (m_drcuml.profiling())
+		m_drcuml.profile_block(m_inst, m_nextinst);
+
 	// optimize the resulting code first
 	optimize();
 
@@ -393,6 +1208,25 @@ uml::instruction &drcuml_block::append()
 //-------------------------------------------------
 
 void drcuml_block::optimize()
+{
+	drcuml_optimizer_stats &stats(m_drcuml.stats());
+	stats.blocks++;
+	stats.instructions += m_nextinst;
+
+	// flags and mapvars must be resolved first, since nothing can be simplified without them
+	optimize_flags(stats);
+	propagate_constants(stats);
+	eliminate_redundant_moves(stats);
+}
+
+
+//-------------------------------------------------
+//  optimize_flags - work out which flags each
+//  instruction really has to generate, resolve
+//  mapvars and simplify
+//-------------------------------------------------
+
+void drcuml_block::optimize_flags(drcuml_optimizer_stats &stats)
 {
 	u32 mapvar[uml::MAPVAR_COUNT] = { 0 };
 
@@ -417,6 +1251,8 @@ void drcuml_block::optimize()
 				remainingflags &= ~scan.modified_flags();
 		}
 		inst.set_flags(accumflags);
+		if (inst.output_flags() & ~accumflags)
+			stats.flags_removed++;
 
 		// track mapvars
 		if (inst.opcode() == uml::OP_MAPVAR)
@@ -434,6 +1270,159 @@ void drcuml_block::optimize()
 }
 
 
+//-------------------------------------------------
+//  propagate_constants - replace integer register
+//  operands with immediates where the value is
+//  known, and simplify what results
+//-------------------------------------------------
+
+void drcuml_block::propagate_constants(drcuml_optimizer_stats &stats)
+{
+	static constexpr u64 sizemask[] = { 0, 0xff, 0xffff, 0, 0xffffffff, 0, 0, 0, 0xffffffffffffffffU };
+
+	// values are only tracked for the size they were written at, since a 32-bit write leaves the upper half undefined
+	struct known_value { u64 value; int size; };
+	known_value known[uml::REG_I_COUNT] = { };
+
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction &inst(m_inst[instnum]);
+
+		// substitute anything known for inputs that can take an immediate
+		bool changed(false);
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			uml::parameter const &param(inst.param(pnum));
+			if (param.is_int_register() && inst.param_is_input(pnum) && !inst.param_is_output(pnum) && inst.param_allows(pnum, uml::parameter::PTYPE_IMMEDIATE))
+			{
+				known_value const &reg(known[param.ireg() - uml::REG_I0]);
+				int const size(inst.param_size(pnum));
+				if (reg.size >= size)
+				{
+					inst.set_immediate(pnum, reg.value & sizemask[size]);
+					stats.constants++;
+					changed = true;
+				}
+			}
+		}
+		if (changed)
+		{
+			uml::opcode_t const origop(inst.opcode());
+			inst.simplify();
+			if (inst.opcode() != origop)
+				stats.folded++;
+		}
+
+		// anything may have changed after a call or at an entry point
+		if (is_optimizer_barrier(inst))
+		{
+			for (known_value &reg : known)
+				reg.size = 0;
+			continue;
+		}
+
+		// forget registers that are written, then remember immediate moves
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+			if (inst.param(pnum).is_int_register() && inst.param_is_output(pnum))
+				known[inst.param(pnum).ireg() - uml::REG_I0].size = 0;
+		if ((inst.opcode() == uml::OP_MOV) && (inst.condition() == uml::COND_ALWAYS) && inst.param(0).is_int_register() && inst.param(1).is_immediate())
+			known[inst.param(0).ireg() - uml::REG_I0] = known_value{ inst.param(1).immediate() & sizemask[inst.size()], inst.size() };
+	}
+}
+
+
+//-------------------------------------------------
+//  eliminate_redundant_moves - remove loads and
+//  stores of memory-mapped CPU registers that
+//  are already in an integer register
+//-------------------------------------------------
+
+void drcuml_block::eliminate_redundant_moves(drcuml_optimizer_stats &stats)
+{
+	// each integer register may hold the same value as a location in memory
+	struct mirror { u8 const *base; int size; int written; };
+	mirror regs[uml::REG_I_COUNT] = { };
+
+	auto const forget = [&regs] (void const *base, int size)
+	{
+		u8 const *const start(reinterpret_cast<u8 const *>(base));
+		for (mirror &reg : regs)
+			if (reg.base && (!size || ((reg.base < (start + size)) && (start < (reg.base + reg.size)))))
+				reg.base = nullptr;
+	};
+
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction &inst(m_inst[instnum]);
+
+		// anything may have changed after a call or at an entry point
+		if (is_optimizer_barrier(inst))
+		{
+			for (mirror &reg : regs)
+				reg = mirror{ nullptr, 0, 0 };
+			continue;
+		}
+
+		// unconditional moves between registers and memory are what we're looking for
+		if ((inst.opcode() == uml::OP_MOV) && (inst.condition() == uml::COND_ALWAYS))
+		{
+			uml::parameter const &dst(inst.param(0));
+			uml::parameter const &src(inst.param(1));
+			if (dst.is_int_register() && src.is_memory())
+			{
+				mirror &reg(regs[dst.ireg() - uml::REG_I0]);
+				if ((reg.base == src.memory()) && (reg.size == inst.size()))
+				{
+					inst.nop();
+					stats.loads_removed++;
+				}
+				else
+				{
+					reg = mirror{ reinterpret_cast<u8 const *>(src.memory()), inst.size(), inst.size() };
+				}
+				continue;
+			}
+			else if (dst.is_memory() && src.is_int_register())
+			{
+				mirror &reg(regs[src.ireg() - uml::REG_I0]);
+				if ((reg.base == dst.memory()) && (reg.size == inst.size()))
+				{
+					inst.nop();
+					stats.stores_removed++;
+				}
+				else
+				{
+					// a 32-bit store only matches a reload if the register was last written at 32 bits
+					forget(dst.memory(), inst.size());
+					if (reg.written == inst.size())
+					{
+						reg.base = reinterpret_cast<u8 const *>(dst.memory());
+						reg.size = inst.size();
+					}
+				}
+				continue;
+			}
+		}
+
+		// anything that can reach memory other than through its operands invalidates everything
+		if (!accesses_memory_through_operands(inst.opcode()))
+			forget(nullptr, 0);
+
+		// forget registers and memory that are written
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			uml::parameter const &param(inst.param(pnum));
+			if (!inst.param_is_output(pnum))
+				continue;
+			if (param.is_int_register())
+				regs[param.ireg() - uml::REG_I0] = mirror{ nullptr, 0, (inst.condition() == uml::COND_ALWAYS) ? inst.param_size(pnum) : 0 };
+			else if (param.is_memory())
+				forget(param.memory(), inst.param_size(pnum));
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  disassemble - disassemble a block of
 //  instructions to the log
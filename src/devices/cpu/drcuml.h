@@ -17,7 +17,10 @@
 
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 
@@ -80,6 +83,19 @@ struct drcbe_info
 };
 
 
+// counts of what the UML optimizer has done, reported with -verbose
+struct drcuml_optimizer_stats
+{
+	u64                     blocks = 0;             // blocks optimized
+	u64                     instructions = 0;       // instructions seen
+	u64                     flags_removed = 0;      // instructions no longer generating unused flags
+	u64                     constants = 0;          // register operands replaced by known values
+	u64                     folded = 0;             // instructions simplified as a result
+	u64                     loads_removed = 0;      // redundant loads of mapped registers
+	u64                     stores_removed = 0;     // redundant stores of mapped registers
+};
+
+
 // a drcuml_block describes a basic block of instructions
 class drcuml_block
 {
@@ -113,6 +129,9 @@ public:
 private:
 	// internal helpers
 	void optimize();
+	void optimize_flags(drcuml_optimizer_stats &stats);
+	void propagate_constants(drcuml_optimizer_stats &stats);
+	void eliminate_redundant_moves(drcuml_optimizer_stats &stats);
 	void disassemble();
 	char const *get_comment_text(uml::instruction const &inst, std::string &comment);
 
@@ -137,6 +156,7 @@ public:
 	virtual int execute(uml::code_handle &entry) = 0;
 	virtual void generate(drcuml_block &block, uml::instruction const *instlist, u32 numinst) = 0;
 	virtual bool hash_exists(u32 mode, u32 pc) = 0;
+	virtual void hash_invalidate(u32 mode, u32 pc) = 0;
 	virtual void get_info(drcbe_info &info) = 0;
 	virtual bool logging() const { return false; }
 
@@ -168,7 +188,7 @@ public:
 
 	// reset the state
 	void reset();
-	int execute(uml::code_handle &entry) { return m_beintf->execute(entry); }
+	int execute(uml::code_handle &entry) { return m_profile_timing ? execute_profiled(entry) : m_beintf->execute(entry); }
 
 	// code generation
 	drcuml_block &begin_block(u32 maxinst);
@@ -181,6 +201,22 @@ public:
 	// handle management
 	uml::code_handle *handle_alloc(char const *name);
 
+	// optimizer statistics
+	drcuml_optimizer_stats &stats() { return m_stats; }
+
+	// fine-grained code invalidation
+	void track_code(u32 mode, u32 pc, offs_t start, offs_t end);
+	void invalidate_code(offs_t start, offs_t end);
+
+	// persistent translation cache
+	void set_persistent_config(std::string &&config);
+	bool restore_block(u32 mode, u32 pc);
+	void persist_block(uml::instruction const *instlist, u32 numinst);
+
+	// block profiling
+	bool profiling() const { return m_profile; }
+	void profile_block(std::vector<uml::instruction> &instlist, u32 &numinst);
+
 	// symbol management
 	void symbol_add(void *base, u32 length, char const *name);
 	char const *symbol_find(void *base, u32 *offset = nullptr);
@@ -220,6 +256,42 @@ private:
 		std::string m_name;     // name of the symbol
 	};
 
+	// a translated block saved for later runs
+	struct persistent_block
+	{
+		std::vector<u8>     data;       // serialized instructions
+		bool                restored;   // restored since the last reset
+	};
+
+	// profiling counters for one block entry point
+	struct profile_entry
+	{
+		drcuml_state *      owner;      // state the entry belongs to
+		u32                 mode;       // mode of the entry point
+		u32                 pc;         // PC of the entry point
+		u64                 hits;       // number of times entered
+		osd_ticks_t         ticks;      // host time until the next entry or exit
+	};
+
+	// granularity of code invalidation
+	static constexpr int CODE_PAGE_SHIFT = 12;
+
+	// statistics helpers
+	void report_stats();
+
+	// profiling helpers
+	int execute_profiled(uml::code_handle &entry);
+	void profile_report();
+	static void profile_enter(void *param);
+
+	// persistent cache helpers
+	std::string persist_key() const;
+	std::string persist_filename() const;
+	void persist_load();
+	void persist_save();
+	bool persist_pointer(std::vector<u8> &data, void const *ptr) const;
+	bool unpersist_pointer(u8 const *&src, u8 const *end, void *&ptr) const;
+
 	// internal state
 	device_t &                              m_device;           // CPU device we are associated with
 	drc_cache &                             m_cache;            // pointer to the codegen cache
@@ -228,6 +300,24 @@ private:
 	std::list<drcuml_block>                 m_blocklist;        // list of active blocks
 	std::list<uml::code_handle>             m_handlelist;       // list of active handles
 	std::list<symbol>                       m_symlist;          // list of symbols
+	u32 const                               m_flags;            // flags passed to the back-end
+	int const                               m_modes;            // number of modes
+	int const                               m_addrbits;         // address bits
+	int const                               m_ignorebits;       // ignored low address bits
+	bool const                              m_persist;          // persistent cache enabled
+	bool                                    m_persist_loaded;   // persistent cache has been read
+	bool                                    m_persist_dirty;    // new blocks need to be written
+	bool                                    m_persist_restoring; // replaying a saved block
+	std::string                             m_persist_config;   // core configuration for the key
+	std::string                             m_persist_key;      // key the saved blocks belong to
+	std::map<u64, persistent_block>         m_persist_blocks;   // saved blocks, keyed by mode and PC
+	drcuml_optimizer_stats                  m_stats;            // optimizer statistics
+	std::unordered_map<offs_t, std::vector<u64> > m_code_pages; // hash entries built from each page of code
+	bool const                              m_profile;          // counting block entries
+	bool const                              m_profile_timing;   // timing block entries
+	std::map<u64, profile_entry>            m_profile_blocks;   // counters, keyed by mode and PC
+	profile_entry *                         m_profile_current;  // entry being timed
+	osd_ticks_t                             m_profile_start;    // when the current entry was entered
 };
 
 
@@ -31,7 +31,7 @@
 #define UML_NOP(block)                                      do { using namespace uml; block.append().nop(); } while (0)
 #define UML_DEBUG(block, pc)                                do { using namespace uml; block.append().debug(pc); } while (0)
 #define UML_EXIT(block, param)                              do { using namespace uml; block.append().exit(param); } while (0)
-#define UML_EXITc(block, cond, param)                       do { using namespace uml; block.append().exit(param, cond); } while (0)
+#define UML_EXITc(block, cond, param)                       do { using namespace uml; block.append().exit(cond, param); } while (0)
 #define UML_HASHJMP(block, mode, pc, handle)                do { using namespace uml; block.append().hashjmp(mode, pc, handle); } while (0)
 #define UML_JMP(block, label)                               do { using namespace uml; block.append().jmp(label); } while (0)
 #define UML_JMPc(block, cond, label)                        do { using namespace uml; block.append().jmp(cond, label); } while (0)
@@ -186,4 +186,16 @@
 #define UML_ICOPYFD(block, dst, src)                        do { using namespace uml; block.append().icopyfd(dst, src); } while (0)
 
 
+/* ----- Vector Operations ----- */
+#define UML_VMOV(block, dst, src)                           do { using namespace uml; block.append().vmov(dst, src); } while (0)
+#define UML_VSHUF(block, dst, src, lanes)                   do { using namespace uml; block.append().vshuf(dst, src, lanes); } while (0)
+#define UML_VAND(block, dst, src1, src2)                    do { using namespace uml; block.append().vand(dst, src1, src2); } while (0)
+#define UML_VOR(block, dst, src1, src2)                     do { using namespace uml; block.append().vor(dst, src1, src2); } while (0)
+#define UML_VXOR(block, dst, src1, src2)                    do { using namespace uml; block.append().vxor(dst, src1, src2); } while (0)
+#define UML_VADD(block, dst, src1, src2)                    do { using namespace uml; block.append().vadd(dst, src1, src2); } while (0)
+#define UML_VSUB(block, dst, src1, src2)                    do { using namespace uml; block.append().vsub(dst, src1, src2); } while (0)
+#define UML_VADDS(block, dst, src1, src2)                   do { using namespace uml; block.append().vadds(dst, src1, src2); } while (0)
+#define UML_VSUBS(block, dst, src1, src2)                   do { using namespace uml; block.append().vsubs(dst, src1, src2); } while (0)
+
+
 #endif // MAME_CPU_DRCUMLSH_H
@@ -39,6 +39,12 @@ u32 dsp16_disassembler::opcode_alignment() const
 	return 1U;
 }
 
+u64 dsp16_disassembler::decode_mode() const
+{
+	// conditions are annotated from live flags
+	return m_host ? DECODE_MODE_LIVE : 0;
+}
+
 offs_t dsp16_disassembler::disassemble(std::ostream &stream, offs_t pc, const data_buffer &opcodes, const data_buffer &params)
 {
 	u8 length(1U);
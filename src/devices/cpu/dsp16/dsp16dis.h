@@ -37,6 +37,7 @@ public:
 	virtual u32 interface_flags() const override;
 	virtual u32 page_address_bits() const override;
 	virtual u32 opcode_alignment() const override;
+	virtual u64 decode_mode() const override;
 	virtual offs_t disassemble(std::ostream &stream, offs_t pc, data_buffer const &opcodes, data_buffer const &params) override;
 
 private:
@@ -391,6 +391,11 @@ u32 hyperstone_disassembler::opcode_alignment() const
 	return 2;
 }
 
+u64 hyperstone_disassembler::decode_mode() const
+{
+	return (u64(m_config->get_fp()) << 1) | (m_config->get_h() ? 1 : 0);
+}
+
 hyperstone_disassembler::hyperstone_disassembler(config *conf) : m_config(conf)
 {
 }
@@ -24,6 +24,11 @@ u32 g65816_disassembler::opcode_alignment() const
 	return 1;
 }
 
+u64 g65816_disassembler::decode_mode() const
+{
+	return (m_config->get_m_flag() ? 2 : 0) | (m_config->get_x_flag() ? 1 : 0);
+}
+
 u32 g65816_disassembler::interface_flags() const
 {
 	return PAGED;
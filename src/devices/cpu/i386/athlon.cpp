@@ -27,6 +27,7 @@ athlonxp_device::athlonxp_device(const machine_config &mconfig, const char *tag,
 void athlonxp_device::device_start()
 {
 	i386_common_init();
+	m_drc_fastmem = false;  // data goes through the split data space
 	register_state_i386_x87_xmm();
 	space(AS_DATA).specific(m_data);
 	space(AS_OPCODES).specific(m_opcodes);
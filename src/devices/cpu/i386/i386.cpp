@@ -28,6 +28,9 @@
 #include "debugger.h"
 #include "debug/debugcpu.h"
 #include "debug/express.h"
+#include "emuopts.h"
+
+#include <cfloat>
 
 /* seems to be defined on mingw-gcc */
 #undef i386
@@ -59,6 +62,23 @@ i386_device::i386_device(const machine_config &mconfig, device_type type, const
 	, m_dr_breakpoints{nullptr, nullptr, nullptr, nullptr}
 	, m_smiact(*this)
 	, m_ferr_handler(*this)
+	, m_isdrc(false)
+	, m_drc_cache_dirty(false)
+	, m_drc_fastmem(false)
+	, m_drc_mode(0)
+	, m_drc_nextpc(0)
+	, m_drc_exit(0)
+	, m_drc_addr(0)
+	, m_drc_data(0)
+	, m_drc_faulted(0)
+	, m_drc_fault(0)
+	, m_entry(nullptr)
+	, m_nocode(nullptr)
+	, m_out_of_cycles(nullptr)
+	, m_interrupt(nullptr)
+	, m_fault(nullptr)
+	, m_read{}
+	, m_write{}
 {
 	// 32 unified
 	set_vtlb_dynamic_entries(32);
@@ -1946,6 +1966,12 @@ void i386_device::i386_common_init()
 	m_smi = false;
 	m_debugger_temp = 0;
 	m_lock = false;
+	// the host path relies on operations rounding to their own type
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+	m_x87_host = !machine().options().precise_fpu();
+#else
+	m_x87_host = false;
+#endif
 
 	zero_state();
 
@@ -2023,7 +2049,27 @@ void i386_device::i386_common_init()
 	m_notifier = m_program->add_change_notifier([this](read_or_write mode)
 	{
 		dri_changed();
+		m_drc_cache_dirty = true;
 	});
+
+	/* set up the recompiler; only flat 32-bit protected mode code is translated */
+	/* it's still being validated, so it only runs with -drc_experimental */
+	m_isdrc = allow_drc() && machine().options().drc_experimental();
+	m_drc_fastmem = true;
+	m_drc_cache_dirty = true;
+	if (m_isdrc)
+	{
+		m_drc_cache = std::make_unique<drc_cache>(DRC_CACHE_SIZE);
+		m_drcuml = std::make_unique<drcuml_state>(*this, *m_drc_cache, 0, 4, 32, 0);
+		m_drcfe = std::make_unique<i386_frontend>(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, COMPILE_MAX_SEQUENCE);
+
+		/* add symbols for our stuff */
+		m_drcuml->symbol_add(&m_pc, sizeof(m_pc), "pc");
+		m_drcuml->symbol_add(&m_cycles, sizeof(m_cycles), "icount");
+		static const char *const regnames[8] = { "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi" };
+		for (int regnum = 0; regnum < 8; regnum++)
+			m_drcuml->symbol_add(&m_reg.d[regnum], sizeof(m_reg.d[regnum]), regnames[regnum]);
+	}
 }
 
 void i386_device::device_start()
@@ -2372,6 +2418,7 @@ void i386_device::zero_state()
 	m_eip = 0;
 	m_pc = 0;
 	m_prev_eip = 0;
+	m_drc_cache_dirty = true;
 	m_eflags = 0;
 	m_eflags_mask = 0;
 	m_CF = 0;
@@ -2721,98 +2768,105 @@ void i386_device::i386_set_a20_line(int state)
 	}
 	// TODO: how does A20M and the tlb interact
 	vtlb_flush_dynamic();
+	m_drc_cache_dirty = true;
 }
 
-void i386_device::execute_run()
+void i386_device::i386_run_instruction()
 {
-	int cycles = m_cycles;
-	m_base_cycles = cycles;
-	CHANGE_PC(m_eip);
-
-	if (m_halted)
-	{
-		m_tsc += cycles;
-		m_cycles = 0;
-		return;
-	}
+	i386_check_irq_line();
 
-	while( m_cycles > 0 )
+	// The LE and GE bits of DR7 aren't currently implemented because they could potentially require cycle-accurate emulation.
+	if((m_dr[7] & 0xff) != 0) // If all of the breakpoints are disabled, skip checking for instruction breakpoint hitting entirely.
+	for(int i = 0; i < 4; i++)
 	{
-		i386_check_irq_line();
-
-		// The LE and GE bits of DR7 aren't currently implemented because they could potentially require cycle-accurate emulation.
-		if((m_dr[7] & 0xff) != 0) // If all of the breakpoints are disabled, skip checking for instruction breakpoint hitting entirely.
-		for(int i = 0; i < 4; i++)
+		bool dri_enabled = (m_dr[7] & (1 << ((i << 1) + 1))) || (m_dr[7] & (1 << (i << 1))); // Check both local AND global enable bits for this breakpoint.
+		if(dri_enabled && !m_RF)
 		{
-			bool dri_enabled = (m_dr[7] & (1 << ((i << 1) + 1))) || (m_dr[7] & (1 << (i << 1))); // Check both local AND global enable bits for this breakpoint.
-			if(dri_enabled && !m_RF)
+			int breakpoint_type = (m_dr[7] >> (i << 2)) & 3;
+			int breakpoint_length = (m_dr[7] >> ((i << 2) + 2)) & 3;
+			if(breakpoint_type == 0)
 			{
-				int breakpoint_type = (m_dr[7] >> (i << 2)) & 3;
-				int breakpoint_length = (m_dr[7] >> ((i << 2) + 2)) & 3;
-				if(breakpoint_type == 0)
+				uint32_t phys_addr = 0;
+				uint32_t error;
+				phys_addr = (m_cr[0] & (1 << 31)) ? translate_address(m_CPL, TRANSLATE_FETCH, &m_dr[i], &error) : m_dr[i];
+				if(breakpoint_length != 0) // Not one byte in length? logerror it, I have no idea how this works on real processors.
+				{
+					logerror("i386: Breakpoint length not 1 byte on an instruction breakpoint\n");
+				}
+				if(m_pc == phys_addr)
 				{
-					uint32_t phys_addr = 0;
-					uint32_t error;
-					phys_addr = (m_cr[0] & (1 << 31)) ? translate_address(m_CPL, TRANSLATE_FETCH, &m_dr[i], &error) : m_dr[i];
-					if(breakpoint_length != 0) // Not one byte in length? logerror it, I have no idea how this works on real processors.
-					{
-						logerror("i386: Breakpoint length not 1 byte on an instruction breakpoint\n");
-					}
-					if(m_pc == phys_addr)
-					{
-						// The processor never automatically clears bits in DR6. It only sets them.
-						m_dr[6] |= 1 << i;
-						i386_trap(1,0,0);
-						break;
-					}
+					// The processor never automatically clears bits in DR6. It only sets them.
+					m_dr[6] |= 1 << i;
+					i386_trap(1,0,0);
+					break;
 				}
 			}
 		}
+	}
 
-		m_operand_size = m_sreg[CS].d;
-		m_xmm_operand_size = 0;
-		m_address_size = m_sreg[CS].d;
-		m_operand_prefix = 0;
-		m_address_prefix = 0;
+	m_operand_size = m_sreg[CS].d;
+	m_xmm_operand_size = 0;
+	m_address_size = m_sreg[CS].d;
+	m_operand_prefix = 0;
+	m_address_prefix = 0;
 
-		m_ext = 1;
-		int old_tf = m_TF;
+	m_ext = 1;
+	int old_tf = m_TF;
 
-		m_segment_prefix = 0;
-		m_prev_eip = m_eip;
+	m_segment_prefix = 0;
+	m_prev_eip = m_eip;
 
-		debugger_instruction_hook(m_pc);
+	debugger_instruction_hook(m_pc);
 
-		if(m_delayed_interrupt_enable != 0)
-		{
-			m_IF = 1;
-			m_delayed_interrupt_enable = 0;
-		}
+	if(m_delayed_interrupt_enable != 0)
+	{
+		m_IF = 1;
+		m_delayed_interrupt_enable = 0;
+	}
 #ifdef DEBUG_MISSING_OPCODE
-		m_opcode_bytes_length = 0;
-		m_opcode_pc = m_pc;
+	m_opcode_bytes_length = 0;
+	m_opcode_pc = m_pc;
 #endif
-		try
-		{
-			i386_decode_opcode();
-			if(m_TF && old_tf)
-			{
-				m_prev_eip = m_eip;
-				m_ext = 1;
-				m_dr[6] |= (1 << 14); //Set BS bit of DR6.
-				i386_trap(1,0,0);
-			}
-			if(m_lock && (m_opcode != 0xf0))
-				m_lock = false;
-		}
-		catch(uint64_t e)
+	try
+	{
+		i386_decode_opcode();
+		if(m_TF && old_tf)
 		{
+			m_prev_eip = m_eip;
 			m_ext = 1;
-			i386_trap_with_error(e&0xffffffff,0,0,e>>32);
+			m_dr[6] |= (1 << 14); //Set BS bit of DR6.
+			i386_trap(1,0,0);
 		}
-		if(m_RF && m_auto_clear_RF) m_RF = 0;
-		if(!m_auto_clear_RF) m_auto_clear_RF = true;
+		if(m_lock && (m_opcode != 0xf0))
+			m_lock = false;
+	}
+	catch(uint64_t e)
+	{
+		m_ext = 1;
+		i386_trap_with_error(e&0xffffffff,0,0,e>>32);
+	}
+	if(m_RF && m_auto_clear_RF) m_RF = 0;
+	if(!m_auto_clear_RF) m_auto_clear_RF = true;
+}
+
+void i386_device::execute_run()
+{
+	int cycles = m_cycles;
+	m_base_cycles = cycles;
+	CHANGE_PC(m_eip);
+
+	if (m_halted)
+	{
+		m_tsc += cycles;
+		m_cycles = 0;
+		return;
 	}
+
+	if (m_isdrc)
+		execute_drc();
+	else
+		while( m_cycles > 0 )
+			i386_run_instruction();
 	m_tsc += (cycles - m_cycles);
 }
 
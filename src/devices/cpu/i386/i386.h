@@ -15,6 +15,8 @@
 #include "divtlb.h"
 
 #include "i386dasm.h"
+#include "cpu/drcfe.h"
+#include "cpu/drcuml.h"
 
 #define INPUT_LINE_A20      1
 #define INPUT_LINE_SMI      2
@@ -25,8 +27,12 @@
 
 #define X86_NUM_CPUS        4
 
+class i386_frontend;
+
 class i386_device : public cpu_device, public device_vtlb_interface, public i386_disassembler::config
 {
+	friend class i386_frontend;
+
 public:
 	// construction/destruction
 	i386_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock);
@@ -41,6 +47,11 @@ public:
 	uint64_t debug_virttophys(int params, const uint64_t *param);
 	uint64_t debug_cacheflush(int params, const uint64_t *param);
 
+	void func_drc_interpret();
+	void func_drc_fault();
+	void func_drc_validate();
+	void func_drc_access(int size, bool write);
+
 protected:
 	i386_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock, int program_data_width, int program_addr_width, int io_data_width);
 
@@ -328,6 +339,7 @@ protected:
 	uint16_t m_x87_cs;
 	uint32_t m_x87_inst_ptr;
 	uint16_t m_x87_opcode;
+	bool m_x87_host;                // use host arithmetic at single and double precision when exceptions are masked
 
 	i386_modrm_func m_opcode_table_x87_d8[256];
 	i386_modrm_func m_opcode_table_x87_d9[256];
@@ -1360,6 +1372,7 @@ protected:
 	int x87_mf_fault();
 	inline void x87_write_cw(uint16_t cw);
 	void x87_reset();
+	bool x87_host_arith(int op, floatx80 a, floatx80 b, floatx80 &result);
 	floatx80 x87_add(floatx80 a, floatx80 b);
 	floatx80 x87_sub(floatx80 a, floatx80 b);
 	floatx80 x87_mul(floatx80 a, floatx80 b);
@@ -1517,7 +1530,66 @@ protected:
 	void build_opcode_table(uint32_t features);
 	void zero_state();
 	void i386_set_a20_line(int state);
+	void i386_run_instruction();
+
+	/* internal compiler state */
+	struct compiler_state
+	{
+		compiler_state &operator=(compiler_state &) = delete;
+
+		uint32_t cycles;                    /* accumulated cycles */
+		uint8_t mode;                       /* DRC_MODE_* for the block */
+		uml::code_label labelnum;           /* index for local labels */
+	};
 
+	/* core state */
+	std::unique_ptr<drc_cache> m_drc_cache;
+	std::unique_ptr<drcuml_state> m_drcuml;
+	std::unique_ptr<i386_frontend> m_drcfe;
+	bool m_isdrc;
+	bool m_drc_cache_dirty;
+	bool m_drc_fastmem;
+	uint32_t m_drc_mode;
+	uint32_t m_drc_nextpc;
+	uint32_t m_drc_exit;
+	uint32_t m_drc_addr;
+	uint32_t m_drc_data;
+	uint32_t m_drc_faulted;
+	uint64_t m_drc_fault;
+
+	/* subroutines */
+	uml::code_handle *m_entry;
+	uml::code_handle *m_nocode;
+	uml::code_handle *m_out_of_cycles;
+	uml::code_handle *m_interrupt;
+	uml::code_handle *m_fault;
+	uml::code_handle *m_read[3][4];
+	uml::code_handle *m_write[3][4];
+
+	uint32_t drc_compute_mode() const;
+	void execute_drc();
+	void code_flush_cache();
+	void code_compile_block(uint8_t mode, offs_t pc);
+	void static_generate_entry_point();
+	void static_generate_exit(uml::code_handle *&handleptr, const char *name, int result);
+	void static_generate_fault_handler();
+	void static_generate_memory_accessor(int mode, int size, bool iswrite, const char *name, uml::code_handle *&handleptr);
+	void generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param, bool allow_exception);
+	void generate_validate_tlb(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead);
+	void generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, bool seqhead);
+	void generate_interpret(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	bool generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	int generate_ea(drcuml_block &block, const opcode_desc *desc, int offset);
+	void generate_load_rm(drcuml_block &block, compiler_state &compiler, uint8_t modrm, int size, uml::parameter dst);
+	void generate_store_rm(drcuml_block &block, compiler_state &compiler, uint8_t modrm, int size, uml::parameter src);
+	void generate_push(drcuml_block &block, compiler_state &compiler, uml::parameter src);
+	void generate_alu(drcuml_block &block, int aluop);
+	void generate_alu_flags(drcuml_block &block, const opcode_desc *desc, int aluop, uint32_t written);
+	void generate_alu_store(drcuml_block &block, compiler_state &compiler, uint8_t modrm);
+	uml::condition_t generate_condition(drcuml_block &block, int cc);
+	void generate_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uml::parameter target);
+	void generate_conditional_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
 };
 
 
@@ -1664,6 +1736,30 @@ protected:
 };
 
 
+class i386_frontend : public drc_frontend
+{
+public:
+	// construction/destruction
+	i386_frontend(i386_device *i386, uint32_t window_start, uint32_t window_end, uint32_t max_sequence);
+
+protected:
+	// required overrides
+	virtual bool describe(opcode_desc &desc, const opcode_desc *prev) override;
+
+private:
+	// internal helpers
+	bool describe_native(opcode_desc &desc, uint8_t op, int op2, int modrm);
+	uint8_t fetch(opcode_desc &desc);
+	void skip_modrm(opcode_desc &desc, uint8_t modrm, bool addrsize16);
+
+	// internal state
+	i386_device *m_i386;
+	uint32_t m_fetch_length;
+	bool m_fetch_failed;
+	bool m_fetch_crossed;
+};
+
+
 DECLARE_DEVICE_TYPE(I386,        i386_device)
 DECLARE_DEVICE_TYPE(I386SX,      i386sx_device)
 DECLARE_DEVICE_TYPE(I486,        i486_device)
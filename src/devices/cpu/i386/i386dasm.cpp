@@ -2963,3 +2963,8 @@ u32 i386_disassembler::opcode_alignment() const
 {
 	return 1;
 }
+
+u64 i386_disassembler::decode_mode() const
+{
+	return m_config->get_mode();
+}
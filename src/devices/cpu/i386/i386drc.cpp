@@ -0,0 +1,1415 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    i386drc.cpp
+
+    Universal machine language-based i386 emulator.
+
+****************************************************************************
+
+    Only flat 32-bit protected mode code (CS, SS, DS and ES based at zero
+    with 4GB limits) is translated; real mode, V86 mode, segmented code,
+    single-stepping and code with debug breakpoints armed all run through
+    the interpreter one instruction at a time.
+
+    Within translated code, instructions the recompiler does not handle
+    itself (including all of x87, MMX and SSE) are handed to the
+    interpreter one at a time, so the translated code only has to get the
+    common integer instructions right.
+
+    All guest state stays in the device; nothing is cached in UML
+    registers across instructions.  Register usage inside a block:
+        I0-I4   scratch; the memory accessors trash I0-I3
+        I5      dynamic branch target
+        I6      effective address
+        I7-I9   operands held across memory accesses
+
+    Future improvements/changes:
+
+    * Keep the general registers in UML registers within a block
+
+    * Translate 16-bit operand size and segment override prefixes
+
+***************************************************************************/
+
+#include "emu.h"
+#include "debugger.h"
+#include "i386.h"
+#include "i386priv.h"
+#include "i386fe.h"
+#include "cpu/drcfe.h"
+#include "cpu/drcuml.h"
+#include "cpu/drcumlsh.h"
+
+
+/***************************************************************************
+    MACROS
+***************************************************************************/
+
+#define DRC_LOAD8(block, dst, var)          UML_LOAD(block, dst, &(var), 0, SIZE_BYTE, SCALE_x1)
+#define DRC_STORE8(block, var, src)         UML_STORE(block, &(var), 0, src, SIZE_BYTE, SCALE_x1)
+#define DRC_LOAD32(block, dst, var)         UML_LOAD(block, dst, &(var), 0, SIZE_DWORD, SCALE_x1)
+#define DRC_STORE32(block, var, src)        UML_STORE(block, &(var), 0, src, SIZE_DWORD, SCALE_x1)
+
+#define LOAD_GPR32(block, dst, reg)         UML_LOAD(block, dst, &m_reg.d[0], reg, SIZE_DWORD, SCALE_x4)
+#define STORE_GPR32(block, reg, src)        UML_STORE(block, &m_reg.d[0], reg, src, SIZE_DWORD, SCALE_x4)
+#define LOAD_GPR8(block, dst, reg)          UML_LOAD(block, dst, &m_reg.b[0], s_breg[reg], SIZE_BYTE, SCALE_x1)
+#define STORE_GPR8(block, reg, src)         UML_STORE(block, &m_reg.b[0], s_breg[reg], src, SIZE_BYTE, SCALE_x1)
+
+
+
+/***************************************************************************
+    FUNCTION PROTOTYPES
+***************************************************************************/
+
+static void cfunc_drc_interpret(void *param);
+static void cfunc_drc_fault(void *param);
+static void cfunc_drc_validate(void *param);
+
+
+
+/***************************************************************************
+    PRIVATE GLOBAL VARIABLES
+***************************************************************************/
+
+/* byte register index for each 8-bit register number */
+static const uint8_t s_breg[8] = { AL, CL, DL, BL, AH, CH, DH, BH };
+
+
+
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    alloc_handle - allocate a handle if not
+    already allocated
+-------------------------------------------------*/
+
+static inline void alloc_handle(drcuml_state &drcuml, uml::code_handle *&handleptr, const char *name)
+{
+	if (!handleptr)
+		handleptr = drcuml.handle_alloc(name);
+}
+
+
+/*-------------------------------------------------
+    opcode_imm32 - extract a little-endian 32-bit
+    value from the opcode bytes
+-------------------------------------------------*/
+
+static inline uint32_t opcode_imm32(const opcode_desc *desc, int offset)
+{
+	return desc->opptr.b[offset] | (desc->opptr.b[offset + 1] << 8) | (desc->opptr.b[offset + 2] << 16) | (uint32_t(desc->opptr.b[offset + 3]) << 24);
+}
+
+
+/*-------------------------------------------------
+    access_size - map a byte count to a UML
+    operand size
+-------------------------------------------------*/
+
+static inline uml::operand_size access_size(int size)
+{
+	return (size == 1) ? uml::SIZE_BYTE : (size == 2) ? uml::SIZE_WORD : uml::SIZE_DWORD;
+}
+
+
+/*-------------------------------------------------
+    access_index - map a byte count to an index
+    into the memory accessor tables
+-------------------------------------------------*/
+
+static inline int access_index(int size)
+{
+	return (size == 1) ? 0 : (size == 2) ? 1 : 2;
+}
+
+
+
+/***************************************************************************
+    CORE CALLBACKS
+***************************************************************************/
+
+/*-------------------------------------------------
+    drc_compute_mode - work out which kind of
+    code can run with the current state
+-------------------------------------------------*/
+
+uint32_t i386_device::drc_compute_mode() const
+{
+	auto const flat = [this] (int seg)
+	{
+		return m_sreg[seg].valid && m_sreg[seg].base == 0 && m_sreg[seg].limit == 0xffffffff;
+	};
+
+	// 32-bit protected mode with flat, writable data segments and a flat 32-bit code segment
+	if (!PROTECTED_MODE || V8086_MODE)
+		return DRC_MODE_INTERPRET;
+	if (!flat(CS) || !m_sreg[CS].d || (m_sreg[CS].flags & 0x18) != 0x18)
+		return DRC_MODE_INTERPRET;
+	if (!flat(SS) || !m_sreg[SS].d || (m_sreg[SS].flags & 0x1e) != 0x12)
+		return DRC_MODE_INTERPRET;
+	if (!flat(DS) || (m_sreg[DS].flags & 0x1e) != 0x12 || !flat(ES) || (m_sreg[ES].flags & 0x1e) != 0x12)
+		return DRC_MODE_INTERPRET;
+
+	// anything that needs checking between instructions
+	if (m_halted || m_TF || m_RF || (m_dr[7] & 0xff) || m_delayed_interrupt_enable || m_smm || m_smi || (m_irq_state && m_IF))
+		return DRC_MODE_INTERPRET;
+
+	return ((m_cr[0] & 0x80000000) ? DRC_MODE_PAGING : 0) | ((m_CPL == 3) ? DRC_MODE_USER : 0);
+}
+
+
+/*-------------------------------------------------
+    execute_drc - run translated code until out
+    of cycles
+-------------------------------------------------*/
+
+void i386_device::execute_drc()
+{
+	do
+	{
+		/* reset the cache if dirty */
+		if (m_drc_cache_dirty)
+		{
+			code_flush_cache();
+			m_drc_cache_dirty = false;
+		}
+
+		/* step through anything that can't be translated */
+		m_drc_mode = drc_compute_mode();
+		if (m_drc_mode & DRC_MODE_INTERPRET)
+		{
+			i386_run_instruction();
+			continue;
+		}
+
+		/* execute */
+		int const execute_result = m_drcuml->execute(*m_entry);
+
+		/* if we need to recompile, do it */
+		if (execute_result == EXECUTE_MISSING_CODE)
+			code_compile_block(m_drc_mode, m_pc);
+
+		/* translated code asked for this instruction to be interpreted */
+		else if (execute_result == EXECUTE_INTERPRET)
+			i386_run_instruction();
+	} while (m_cycles > 0 && !m_halted);
+}
+
+
+/*-------------------------------------------------
+    func_drc_interpret - run the instruction at
+    the current PC through the interpreter
+-------------------------------------------------*/
+
+void i386_device::func_drc_interpret()
+{
+	// faults are handled inside; anything escaping must not unwind through generated code
+	try
+	{
+		i386_run_instruction();
+	}
+	catch (uint64_t e)
+	{
+		logerror("i386: unhandled fault %d at %08X\n", int(e & 0xffffffff), m_pc);
+	}
+
+	// leave the translated code if it no longer describes what comes next
+	if (m_pc != m_drc_nextpc || m_halted || m_drc_cache_dirty || drc_compute_mode() != m_drc_mode)
+		m_drc_exit = EXECUTE_REDISPATCH;
+	else
+		m_drc_exit = 0;
+}
+
+static void cfunc_drc_interpret(void *param)
+{
+	((i386_device *)param)->func_drc_interpret();
+}
+
+
+/*-------------------------------------------------
+    func_drc_fault - raise a fault caught by a
+    memory access from translated code
+-------------------------------------------------*/
+
+void i386_device::func_drc_fault()
+{
+	m_prev_eip = m_eip;
+	m_ext = 1;
+	try
+	{
+		i386_trap_with_error(m_drc_fault & 0xffffffff, 0, 0, m_drc_fault >> 32);
+	}
+	catch (uint64_t e)
+	{
+		logerror("i386: unhandled fault %d at %08X\n", int(e & 0xffffffff), m_pc);
+	}
+}
+
+static void cfunc_drc_fault(void *param)
+{
+	((i386_device *)param)->func_drc_fault();
+}
+
+
+/*-------------------------------------------------
+    func_drc_access - slow path for memory
+    accesses from translated code; faults are
+    reported through m_drc_faulted
+-------------------------------------------------*/
+
+void i386_device::func_drc_access(int size, bool write)
+{
+	m_drc_faulted = 0;
+	try
+	{
+		if (write)
+		{
+			if (size == 1)
+				WRITE8(m_drc_addr, m_drc_data);
+			else if (size == 2)
+				WRITE16(m_drc_addr, m_drc_data);
+			else
+				WRITE32(m_drc_addr, m_drc_data);
+		}
+		else
+		{
+			if (size == 1)
+				m_drc_data = READ8(m_drc_addr);
+			else if (size == 2)
+				m_drc_data = READ16(m_drc_addr);
+			else
+				m_drc_data = READ32(m_drc_addr);
+		}
+	}
+	catch (uint64_t e)
+	{
+		m_drc_fault = e;
+		m_drc_faulted = 1;
+	}
+}
+
+template <int Size, bool Write>
+static void cfunc_drc_access(void *param)
+{
+	((i386_device *)param)->func_drc_access(Size, Write);
+}
+
+
+/*-------------------------------------------------
+    func_drc_validate - check that the page at
+    m_drc_addr still maps to physical address
+    m_drc_data
+-------------------------------------------------*/
+
+void i386_device::func_drc_validate()
+{
+	uint32_t address = m_drc_addr;
+	uint32_t error;
+
+	if (!translate_address(m_CPL, TRANSLATE_FETCH, &address, &error))
+		m_drc_exit = EXECUTE_INTERPRET;
+	else if ((address & m_a20_mask) != m_drc_data)
+		m_drc_exit = EXECUTE_MISSING_CODE;
+	else
+		m_drc_exit = 0;
+}
+
+static void cfunc_drc_validate(void *param)
+{
+	((i386_device *)param)->func_drc_validate();
+}
+
+
+
+/***************************************************************************
+    CACHE, BLOCK AND STATIC CODE MANAGEMENT
+***************************************************************************/
+
+/*-------------------------------------------------
+    code_flush_cache - flush the cache and
+    regenerate static code
+-------------------------------------------------*/
+
+void i386_device::code_flush_cache()
+{
+	/* empty the transient cache contents */
+	m_drcuml->reset();
+
+	try
+	{
+		/* generate the entry point and exit handlers */
+		static_generate_entry_point();
+		static_generate_exit(m_nocode, "nocode", EXECUTE_MISSING_CODE);
+		static_generate_exit(m_out_of_cycles, "out_of_cycles", EXECUTE_OUT_OF_CYCLES);
+		static_generate_exit(m_interrupt, "interrupt", EXECUTE_REDISPATCH);
+		static_generate_fault_handler();
+
+		/* add subroutines for memory accesses */
+		for (int mode = 0; mode < 4; mode++)
+		{
+			static_generate_memory_accessor(mode, 1, false, "read8",   m_read[0][mode]);
+			static_generate_memory_accessor(mode, 1, true,  "write8",  m_write[0][mode]);
+			static_generate_memory_accessor(mode, 2, false, "read16",  m_read[1][mode]);
+			static_generate_memory_accessor(mode, 2, true,  "write16", m_write[1][mode]);
+			static_generate_memory_accessor(mode, 4, false, "read32",  m_read[2][mode]);
+			static_generate_memory_accessor(mode, 4, true,  "write32", m_write[2][mode]);
+		}
+	}
+	catch (drcuml_block::abort_compilation &)
+	{
+		fatalerror("Unrecoverable error generating static code\n");
+	}
+}
+
+
+/*-------------------------------------------------
+    code_compile_block - compile a block of the
+    given mode at the specified pc
+-------------------------------------------------*/
+
+void i386_device::code_compile_block(uint8_t mode, offs_t pc)
+{
+	const opcode_desc *seqhead, *seqlast;
+	const opcode_desc *desclist;
+	bool override = false;
+
+	g_profiler.start(PROFILER_DRC_COMPILE);
+
+	/* get a description of this sequence */
+	desclist = m_drcfe->describe_code(pc);
+
+	/* if we get an error back, flush the cache and try again */
+	bool succeeded = false;
+	while (!succeeded)
+	{
+		try
+		{
+			compiler_state compiler = { 0, mode, 1 };
+
+			/* start the block */
+			drcuml_block &block(m_drcuml->begin_block(8192));
+
+			/* loop until we get through all instruction sequences */
+			for (seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
+			{
+				const opcode_desc *curdesc;
+				uint32_t nextpc;
+
+				/* add a code log entry */
+				if (m_drcuml->logging())
+					block.append_comment("-------------------------");                     // comment
+
+				/* determine the last instruction in this sequence */
+				for (seqlast = seqhead; seqlast != nullptr; seqlast = seqlast->next())
+					if (seqlast->flags & OPFLAG_END_SEQUENCE)
+						break;
+				assert(seqlast != nullptr);
+
+				/* if we don't have a hash for this mode/pc, or if we are overriding all, add one */
+				if (override || !m_drcuml->hash_exists(mode, seqhead->pc))
+				{
+					UML_HASH(block, mode, seqhead->pc);                                     // hash    mode,pc
+				}
+				/* if we already have a hash, and this is the first sequence, assume that we */
+				/* are recompiling due to being out of sync and allow future overrides */
+				else if (seqhead == desclist)
+				{
+					override = true;
+					UML_HASH(block, mode, seqhead->pc);                                     // hash    mode,pc
+				}
+
+				/* otherwise, redispatch to that fixed PC and skip the rest of the processing */
+				else
+				{
+					UML_HASHJMP(block, mode, seqhead->pc, *m_nocode);                       // hashjmp <mode>,seqhead->pc,nocode
+					continue;
+				}
+
+				/* a sequence may be entered from anywhere, so check its page mapping first */
+				if (mode & DRC_MODE_PAGING)
+					generate_validate_tlb(block, compiler, seqhead);
+
+				/* validate this code block if we're not pointing into ROM */
+				if (m_program->get_write_ptr(seqhead->physpc) != nullptr)
+					generate_checksum_block(block, compiler, seqhead);
+
+				/* iterate over instructions in the sequence and compile them */
+				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+					generate_sequence_instruction(block, compiler, curdesc, curdesc == seqhead);
+
+				/* branches have already left */
+				if (seqlast->flags & OPFLAG_IS_UNCONDITIONAL_BRANCH)
+					continue;
+
+				/* if we need to return to the start, do it */
+				if (seqlast->flags & OPFLAG_RETURN_TO_START)
+					nextpc = pc;
+
+				/* otherwise we just go to the next instruction */
+				else
+					nextpc = seqlast->pc + seqlast->length;
+
+				/* count off cycles and go there */
+				generate_update_cycles(block, compiler, nextpc, true);                    // <subtract cycles>
+				if (seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
+					UML_HASHJMP(block, mode, nextpc, *m_nocode);                            // hashjmp <mode>,nextpc,nocode
+			}
+
+			/* end the sequence */
+			block.end();
+			g_profiler.stop();
+			succeeded = true;
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			code_flush_cache();
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    static_generate_entry_point - generate a
+    static entry point
+-------------------------------------------------*/
+
+void i386_device::static_generate_entry_point()
+{
+	drcuml_block &block(m_drcuml->begin_block(20));
+
+	/* forward references */
+	alloc_handle(*m_drcuml, m_nocode, "nocode");
+
+	alloc_handle(*m_drcuml, m_entry, "entry");
+	UML_HANDLE(block, *m_entry);                                                    // handle  entry
+
+	/* generate a hash jump via the current mode and PC */
+	DRC_LOAD32(block, I0, m_drc_mode);                                              // load    i0,[drc_mode]
+	DRC_LOAD32(block, I1, m_pc);                                                    // load    i1,[pc]
+	UML_HASHJMP(block, I0, I1, *m_nocode);                                          // hashjmp i0,i1,nocode
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_exit - generate a handler
+    that records the PC passed to it and leaves
+    with the given result
+-------------------------------------------------*/
+
+void i386_device::static_generate_exit(uml::code_handle *&handleptr, const char *name, int result)
+{
+	/* begin generating */
+	drcuml_block &block(m_drcuml->begin_block(10));
+
+	alloc_handle(*m_drcuml, handleptr, name);
+	UML_HANDLE(block, *handleptr);                                                  // handle  name
+	UML_GETEXP(block, I0);                                                          // getexp  i0
+	DRC_STORE32(block, m_pc, I0);                                                   // store   [pc],i0
+	DRC_STORE32(block, m_eip, I0);                                                  // store   [eip],i0
+	UML_EXIT(block, result);                                                        // exit    result
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_fault_handler - generate the
+    handler for faults raised by the memory
+    accessors
+-------------------------------------------------*/
+
+void i386_device::static_generate_fault_handler()
+{
+	/* begin generating */
+	drcuml_block &block(m_drcuml->begin_block(20));
+
+	alloc_handle(*m_drcuml, m_fault, "fault");
+	UML_HANDLE(block, *m_fault);                                                    // handle  fault
+
+	/* recover the PC and charge the cycles used so far */
+	UML_RECOVER(block, I0, MAPVAR_PC);                                              // recover i0,PC
+	UML_RECOVER(block, I1, MAPVAR_CYCLES);                                          // recover i1,CYCLES
+	DRC_LOAD32(block, I2, m_cycles);                                                // load    i2,[cycles]
+	UML_SUB(block, I2, I2, I1);                                                     // sub     i2,i2,i1
+	DRC_STORE32(block, m_cycles, I2);                                               // store   [cycles],i2
+	DRC_STORE32(block, m_pc, I0);                                                   // store   [pc],i0
+	DRC_STORE32(block, m_eip, I0);                                                  // store   [eip],i0
+
+	/* take the fault and continue at the handler */
+	UML_CALLC(block, cfunc_drc_fault, this);                                        // callc   cfunc_drc_fault
+	UML_EXIT(block, EXECUTE_REDISPATCH);                                            // exit    EXECUTE_REDISPATCH
+
+	block.end();
+}
+
+
+/*------------------------------------------------------------------
+    static_generate_memory_accessor - generate a
+    read or write subroutine; the address is in
+    i0, write data in i1 and read data is
+    returned in i0; i0-i3 are trashed
+------------------------------------------------------------------*/
+
+void i386_device::static_generate_memory_accessor(int mode, int size, bool iswrite, const char *name, uml::code_handle *&handleptr)
+{
+	uml::code_label const slow = 1;
+	vtlb_entry const user = (mode & DRC_MODE_USER) ? (iswrite ? VTLB_USER_WRITE_ALLOWED : VTLB_USER_READ_ALLOWED) : (iswrite ? VTLB_WRITE_ALLOWED : VTLB_READ_ALLOWED);
+	vtlb_entry const need = VTLB_FLAG_VALID | user | (iswrite ? VTLB_FLAG_DIRTY : 0);
+	uml::c_function func;
+
+	switch (size)
+	{
+		case 1:     func = iswrite ? cfunc_drc_access<1, true> : cfunc_drc_access<1, false>;   break;
+		case 2:     func = iswrite ? cfunc_drc_access<2, true> : cfunc_drc_access<2, false>;   break;
+		default:    func = iswrite ? cfunc_drc_access<4, true> : cfunc_drc_access<4, false>;   break;
+	}
+
+	/* begin generating */
+	drcuml_block &block(m_drcuml->begin_block(64));
+
+	/* add a global entry for this */
+	alloc_handle(*m_drcuml, m_fault, "fault");
+	alloc_handle(*m_drcuml, handleptr, name);
+	UML_HANDLE(block, *handleptr);                                                  // handle  name
+
+	/* aligned accesses to pages already in the TLB go straight to the address space */
+	if (m_drc_fastmem)
+	{
+		if (size > 1)
+		{
+			UML_TEST(block, I0, size - 1);                                          // test    i0,size-1
+			UML_JMPc(block, COND_NZ, slow);                                         // jmp     slow,nz
+		}
+		if (mode & DRC_MODE_PAGING)
+		{
+			UML_SHR(block, I2, I0, 12);                                             // shr     i2,i0,12
+			UML_LOAD(block, I2, vtlb_table(), I2, SIZE_DWORD, SCALE_x4);           // load    i2,[vtlb],i2,dword
+			UML_AND(block, I3, I2, need);                                           // and     i3,i2,need
+			UML_CMP(block, I3, need);                                               // cmp     i3,need
+			UML_JMPc(block, COND_NE, slow);                                         // jmp     slow,ne
+			UML_ROLINS(block, I0, I2, 0, 0xfffff000);                               // rolins  i0,i2,0,0xfffff000
+		}
+		DRC_LOAD32(block, I2, m_a20_mask);                                          // load    i2,[a20_mask]
+		UML_AND(block, I0, I0, I2);                                                 // and     i0,i0,i2
+		if (iswrite)
+			UML_WRITE(block, I0, I1, access_size(size), SPACE_PROGRAM);             // write   i0,i1,program_size
+		else
+			UML_READ(block, I0, I0, access_size(size), SPACE_PROGRAM);              // read    i0,i0,program_size
+		UML_RET(block);                                                             // ret
+
+		UML_LABEL(block, slow);                                                     // slow:
+	}
+
+	/* everything else goes through the interpreter's accessors */
+	DRC_STORE32(block, m_drc_addr, I0);                                             // store   [drc_addr],i0
+	if (iswrite)
+		DRC_STORE32(block, m_drc_data, I1);                                         // store   [drc_data],i1
+	UML_CALLC(block, func, this);                                                   // callc   cfunc_drc_access
+	DRC_LOAD32(block, I2, m_drc_faulted);                                           // load    i2,[drc_faulted]
+	UML_TEST(block, I2, I2);                                                        // test    i2,i2
+	UML_EXHc(block, COND_NZ, *m_fault, 0);                                          // exh     fault,0,nz
+	if (!iswrite)
+		DRC_LOAD32(block, I0, m_drc_data);                                          // load    i0,[drc_data]
+	UML_RET(block);                                                                 // ret
+
+	block.end();
+}
+
+
+
+/***************************************************************************
+    CODE GENERATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    generate_update_cycles - generate code to
+    subtract cycles from the icount and leave if
+    out, or if an interrupt is pending
+-------------------------------------------------*/
+
+void i386_device::generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param, bool allow_exception)
+{
+	/* account for cycles */
+	if (compiler.cycles > 0)
+	{
+		DRC_LOAD32(block, I0, m_cycles);                                            // load    i0,[cycles]
+		UML_SUB(block, I0, I0, MAPVAR_CYCLES);                                      // sub     i0,i0,cycles
+		DRC_STORE32(block, m_cycles, I0);                                           // store   [cycles],i0
+		UML_MAPVAR(block, MAPVAR_CYCLES, 0);                                        // mapvar  cycles,0
+		if (allow_exception)
+		{
+			UML_CMP(block, I0, 0);                                                  // cmp     i0,0
+			UML_EXHc(block, COND_LE, *m_out_of_cycles, param);                      // exh     out_of_cycles,nextpc,le
+		}
+	}
+	compiler.cycles = 0;
+
+	/* leave so the interpreter can take a pending interrupt */
+	if (allow_exception)
+	{
+		DRC_LOAD8(block, I0, m_irq_state);                                          // load    i0,[irq_state]
+		UML_CMP(block, I0, 0);                                                      // cmp     i0,0
+		UML_SETc(block, COND_NE, I0);                                               // set     i0,ne
+		DRC_LOAD8(block, I1, m_IF);                                                 // load    i1,[IF]
+		UML_AND(block, I0, I0, I1);                                                 // and     i0,i0,i1
+		DRC_LOAD8(block, I1, m_smi);                                                // load    i1,[smi]
+		UML_OR(block, I0, I0, I1);                                                  // or      i0,i0,i1
+		UML_EXHc(block, COND_NZ, *m_interrupt, param);                              // exh     interrupt,nextpc,nz
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_validate_tlb - generate code to
+    check that the page holding an instruction
+    maps where it did when it was compiled
+-------------------------------------------------*/
+
+void i386_device::generate_validate_tlb(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	vtlb_entry const entry = vtlb_table()[desc->pc >> 12];
+	uml::code_label const ok = compiler.labelnum++;
+
+	/* a page that faulted at compile time is handed to the interpreter anyway */
+	if (!(entry & VTLB_FLAG_VALID))
+		return;
+
+	/* permission and dirty bits may change without affecting the code */
+	UML_LOAD(block, I0, vtlb_table(), desc->pc >> 12, SIZE_DWORD, SCALE_x4);        // load    i0,[vtlb],pc >> 12,dword
+	UML_AND(block, I0, I0, 0xfffff000 | VTLB_FLAG_VALID);                           // and     i0,i0,0xfffff000 | VALID
+	UML_CMP(block, I0, (entry & 0xfffff000) | VTLB_FLAG_VALID);                     // cmp     i0,entry
+	UML_JMPc(block, COND_E, ok);                                                    // jmp     ok,e
+
+	/* the entry is gone or different; look the page up again */
+	DRC_STORE32(block, m_drc_addr, desc->pc);                                       // store   [drc_addr],desc->pc
+	DRC_STORE32(block, m_drc_data, desc->physpc);                                   // store   [drc_data],desc->physpc
+	UML_CALLC(block, cfunc_drc_validate, this);                                     // callc   cfunc_drc_validate
+	DRC_LOAD32(block, I0, m_drc_exit);                                              // load    i0,[drc_exit]
+	UML_CMP(block, I0, 0);                                                          // cmp     i0,0
+	UML_JMPc(block, COND_E, ok);                                                    // jmp     ok,e
+
+	/* remapped or unmapped; charge the cycles used so far and leave */
+	if (compiler.cycles > 0)
+	{
+		DRC_LOAD32(block, I1, m_cycles);                                            // load    i1,[cycles]
+		UML_SUB(block, I1, I1, compiler.cycles);                                    // sub     i1,i1,cycles
+		DRC_STORE32(block, m_cycles, I1);                                           // store   [cycles],i1
+	}
+	DRC_STORE32(block, m_pc, desc->pc);                                             // store   [pc],desc->pc
+	DRC_STORE32(block, m_eip, desc->pc);                                            // store   [eip],desc->pc
+	UML_EXIT(block, I0);                                                            // exit    i0
+
+	UML_LABEL(block, ok);                                                           // ok:
+}
+
+
+/*-------------------------------------------------
+    generate_checksum_block - generate code to
+    validate the first instruction of a sequence
+-------------------------------------------------*/
+
+void i386_device::generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead)
+{
+	const uint8_t *base[16];
+	uint32_t sum = 0;
+
+	if (seqhead->flags & OPFLAG_VIRTUAL_NOOP)
+		return;
+
+	/* only the bytes on the first page are known to be at physpc */
+	int const length = std::min<int>(seqhead->length, 0x1000 - (seqhead->pc & 0xfff));
+	for (int i = 0; i < length; i++)
+	{
+		base[i] = (const uint8_t *)m_program->get_write_ptr((seqhead->physpc + i) & ~3);
+		if (base[i] == nullptr)
+			return;
+	}
+
+	if (m_drcuml->logging())
+		block.append_comment("[Validation for %08X]", seqhead->pc);                    // comment
+
+	for (int i = 0; i < length; i++)
+	{
+		UML_LOAD(block, (i == 0) ? I0 : I1, base[i], BYTE4_XOR_LE((seqhead->physpc + i) & 3), SIZE_BYTE, SCALE_x1);
+																					// load    i1,base,byte
+		if (i != 0)
+			UML_ADD(block, I0, I0, I1);                                             // add     i0,i0,i1
+		sum += seqhead->opptr.b[i];
+	}
+	UML_CMP(block, I0, sum);                                                        // cmp     i0,sum
+	UML_EXHc(block, COND_NE, *m_nocode, seqhead->pc);                               // exh     nocode,seqhead->pc,ne
+}
+
+
+/*-------------------------------------------------
+    generate_sequence_instruction - generate code
+    for a single instruction in a sequence
+-------------------------------------------------*/
+
+void i386_device::generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, bool seqhead)
+{
+	/* instructions that cross into a new page need that page checked too */
+	if (!seqhead && (compiler.mode & DRC_MODE_PAGING) && (desc->flags & OPFLAG_VALIDATE_TLB))
+		generate_validate_tlb(block, compiler, desc);
+
+	/* set the PC map variable */
+	UML_MAPVAR(block, MAPVAR_PC, desc->pc);                                         // mapvar  PC,desc->pc
+
+	/* accumulate total cycles */
+	compiler.cycles += desc->cycles;
+
+	/* update the icount map variable */
+	UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                              // mapvar  CYCLES,compiler.cycles
+
+	/* if we hit a compiler page fault, let the interpreter raise it */
+	if (desc->flags & OPFLAG_COMPILER_PAGE_FAULT)
+	{
+		generate_update_cycles(block, compiler, desc->pc, false);                   // <subtract cycles>
+		DRC_STORE32(block, m_pc, desc->pc);                                         // store   [pc],desc->pc
+		DRC_STORE32(block, m_eip, desc->pc);                                        // store   [eip],desc->pc
+		UML_EXIT(block, EXECUTE_INTERPRET);                                         // exit    EXECUTE_INTERPRET
+		return;
+	}
+
+	/* anything the recompiler doesn't handle goes to the interpreter */
+	if (desc->userflags & I386_UF_INTERPRET)
+	{
+		generate_interpret(block, compiler, desc);
+		return;
+	}
+
+	/* if we are debugging, call the debugger */
+	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) != 0)
+	{
+		DRC_STORE32(block, m_pc, desc->pc);                                         // store   [pc],desc->pc
+		DRC_STORE32(block, m_eip, desc->pc);                                        // store   [eip],desc->pc
+		UML_DEBUG(block, desc->pc);                                                 // debug   desc->pc
+	}
+
+	/* compile the instruction */
+	if (!generate_opcode(block, compiler, desc))
+		generate_interpret(block, compiler, desc);
+}
+
+
+/*-------------------------------------------------
+    generate_interpret - generate code to run a
+    single instruction through the interpreter
+-------------------------------------------------*/
+
+void i386_device::generate_interpret(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	uint32_t const nextpc = desc->pc + desc->length;
+
+	/* the interpreter charges its own cycles */
+	generate_update_cycles(block, compiler, desc->pc, false);                       // <subtract cycles>
+	DRC_STORE32(block, m_pc, desc->pc);                                             // store   [pc],desc->pc
+	DRC_STORE32(block, m_eip, desc->pc);                                            // store   [eip],desc->pc
+	DRC_STORE32(block, m_drc_nextpc, nextpc);                                       // store   [drc_nextpc],nextpc
+	UML_CALLC(block, cfunc_drc_interpret, this);                                    // callc   cfunc_drc_interpret
+
+	/* leave if it went somewhere else or changed the mode */
+	DRC_LOAD32(block, I0, m_drc_exit);                                              // load    i0,[drc_exit]
+	UML_TEST(block, I0, I0);                                                        // test    i0,i0
+	UML_EXITc(block, COND_NZ, I0);                                                  // exit    i0,nz
+	DRC_LOAD32(block, I0, m_cycles);                                                // load    i0,[cycles]
+	UML_CMP(block, I0, 0);                                                          // cmp     i0,0
+	UML_EXHc(block, COND_LE, *m_out_of_cycles, nextpc);                             // exh     out_of_cycles,nextpc,le
+}
+
+
+/*-------------------------------------------------
+    generate_ea - generate code to compute the
+    effective address of the ModRM operand at
+    offset into i6; returns the offset of the
+    byte following the ModRM operand
+-------------------------------------------------*/
+
+int i386_device::generate_ea(drcuml_block &block, const opcode_desc *desc, int offset)
+{
+	uint8_t const modrm = desc->opptr.b[offset++];
+	int const mod = modrm >> 6;
+	int base = modrm & 7;
+	int index = -1;
+	int scale = 0;
+	bool hasbase = true;
+	int32_t disp = 0;
+
+	if (base == 4)
+	{
+		uint8_t const sib = desc->opptr.b[offset++];
+		base = sib & 7;
+		index = (sib >> 3) & 7;
+		scale = sib >> 6;
+		if (index == 4)
+			index = -1;
+		if (base == 5 && mod == 0)
+			hasbase = false;
+	}
+	else if (base == 5 && mod == 0)
+		hasbase = false;
+
+	if (mod == 1)
+		disp = int8_t(desc->opptr.b[offset++]);
+	else if (mod == 2 || !hasbase)
+	{
+		disp = opcode_imm32(desc, offset);
+		offset += 4;
+	}
+
+	/* segments are flat, so the offset is the linear address */
+	if (hasbase)
+		LOAD_GPR32(block, I6, base);                                                // load    i6,[base]
+	else
+		UML_MOV(block, I6, disp);                                                   // mov     i6,disp
+	if (index >= 0)
+	{
+		LOAD_GPR32(block, I0, index);                                               // load    i0,[index]
+		if (scale != 0)
+			UML_SHL(block, I0, I0, scale);                                          // shl     i0,i0,scale
+		UML_ADD(block, I6, I6, I0);                                                 // add     i6,i6,i0
+	}
+	if (hasbase && disp != 0)
+		UML_ADD(block, I6, I6, disp);                                               // add     i6,i6,disp
+	return offset;
+}
+
+
+/*-------------------------------------------------
+    generate_load_rm - load the ModRM operand into
+    dst, reading memory at i6 if needed
+-------------------------------------------------*/
+
+void i386_device::generate_load_rm(drcuml_block &block, compiler_state &compiler, uint8_t modrm, int size, uml::parameter dst)
+{
+	if (modrm >= 0xc0)
+	{
+		if (size == 1)
+			LOAD_GPR8(block, dst, modrm & 7);                                       // load    dst,[rm8]
+		else
+		{
+			LOAD_GPR32(block, dst, modrm & 7);                                      // load    dst,[rm32]
+			if (size == 2)
+				UML_AND(block, dst, dst, 0xffff);                                   // and     dst,dst,0xffff
+		}
+	}
+	else
+	{
+		UML_MOV(block, I0, I6);                                                     // mov     i0,i6
+		UML_CALLH(block, *m_read[access_index(size)][compiler.mode & 3]);           // callh   read
+		if (dst != uml::I0)
+			UML_MOV(block, dst, I0);                                                // mov     dst,i0
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_store_rm - store src to the ModRM
+    operand, writing memory at i6 if needed
+-------------------------------------------------*/
+
+void i386_device::generate_store_rm(drcuml_block &block, compiler_state &compiler, uint8_t modrm, int size, uml::parameter src)
+{
+	if (modrm >= 0xc0)
+	{
+		if (size == 1)
+			STORE_GPR8(block, modrm & 7, src);                                      // store   [rm8],src
+		else
+			STORE_GPR32(block, modrm & 7, src);                                     // store   [rm32],src
+	}
+	else
+	{
+		UML_MOV(block, I1, src);                                                    // mov     i1,src
+		UML_MOV(block, I0, I6);                                                     // mov     i0,i6
+		UML_CALLH(block, *m_write[access_index(size)][compiler.mode & 3]);          // callh   write
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_push - push src onto the stack;
+    trashes i0-i3 and i8
+-------------------------------------------------*/
+
+void i386_device::generate_push(drcuml_block &block, compiler_state &compiler, uml::parameter src)
+{
+	/* write first so a fault leaves ESP alone */
+	LOAD_GPR32(block, I8, ESP);                                                     // load    i8,[esp]
+	UML_SUB(block, I8, I8, 4);                                                      // sub     i8,i8,4
+	UML_MOV(block, I1, src);                                                        // mov     i1,src
+	UML_MOV(block, I0, I8);                                                         // mov     i0,i8
+	UML_CALLH(block, *m_write[2][compiler.mode & 3]);                               // callh   write32
+	STORE_GPR32(block, ESP, I8);                                                    // store   [esp],i8
+}
+
+
+/*-------------------------------------------------
+    generate_alu - compute i0 = i1 <op> i2 for
+    group 1 operation aluop
+-------------------------------------------------*/
+
+void i386_device::generate_alu(drcuml_block &block, int aluop)
+{
+	switch (aluop)
+	{
+		case 0:     UML_ADD(block, I0, I1, I2);     break;                          // add     i0,i1,i2
+		case 1:     UML_OR(block, I0, I1, I2);      break;                          // or      i0,i1,i2
+		case 4:     UML_AND(block, I0, I1, I2);     break;                          // and     i0,i1,i2
+		case 5:
+		case 7:     UML_SUB(block, I0, I1, I2);     break;                          // sub     i0,i1,i2
+		case 6:     UML_XOR(block, I0, I1, I2);     break;                          // xor     i0,i1,i2
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_alu_flags - store the flags for
+    i0 = i1 <op> i2 that later code needs; only
+    flags in written are touched
+-------------------------------------------------*/
+
+void i386_device::generate_alu_flags(drcuml_block &block, const opcode_desc *desc, int aluop, uint32_t written)
+{
+	uint32_t const needed = desc->regreq[1] & written;
+	bool const logical = (aluop == 1 || aluop == 4 || aluop == 6);
+	bool const add = (aluop == 0);
+
+	if (needed & REGFLAG_CF)
+	{
+		if (logical)
+			DRC_STORE8(block, m_CF, 0);                                             // store   [CF],0
+		else
+		{
+			if (add)
+				UML_CMP(block, I0, I1);                                             // cmp     i0,i1
+			else
+				UML_CMP(block, I1, I2);                                             // cmp     i1,i2
+			UML_SETc(block, COND_B, I3);                                            // set     i3,b
+			DRC_STORE8(block, m_CF, I3);                                            // store   [CF],i3
+		}
+	}
+	if (needed & REGFLAG_OF)
+	{
+		if (logical)
+			DRC_STORE8(block, m_OF, 0);                                             // store   [OF],0
+		else
+		{
+			if (add)
+			{
+				UML_XOR(block, I3, I0, I1);                                         // xor     i3,i0,i1
+				UML_XOR(block, I4, I0, I2);                                         // xor     i4,i0,i2
+			}
+			else
+			{
+				UML_XOR(block, I3, I1, I2);                                         // xor     i3,i1,i2
+				UML_XOR(block, I4, I1, I0);                                         // xor     i4,i1,i0
+			}
+			UML_AND(block, I3, I3, I4);                                             // and     i3,i3,i4
+			UML_SHR(block, I3, I3, 31);                                             // shr     i3,i3,31
+			DRC_STORE8(block, m_OF, I3);                                            // store   [OF],i3
+		}
+	}
+	if (needed & REGFLAG_ZF)
+	{
+		UML_CMP(block, I0, 0);                                                      // cmp     i0,0
+		UML_SETc(block, COND_E, I3);                                                // set     i3,e
+		DRC_STORE8(block, m_ZF, I3);                                                // store   [ZF],i3
+	}
+	if (needed & REGFLAG_SF)
+	{
+		UML_SHR(block, I3, I0, 31);                                                 // shr     i3,i0,31
+		DRC_STORE8(block, m_SF, I3);                                                // store   [SF],i3
+	}
+	if (needed & REGFLAG_PF)
+	{
+		UML_AND(block, I3, I0, 0xff);                                               // and     i3,i0,0xff
+		UML_LOAD(block, I3, i386_parity_table, I3, SIZE_DWORD, SCALE_x4);           // load    i3,parity_table,i3,dword
+		DRC_STORE8(block, m_PF, I3);                                                // store   [PF],i3
+	}
+	if ((needed & REGFLAG_AF) && !logical)
+	{
+		UML_XOR(block, I3, I1, I2);                                                 // xor     i3,i1,i2
+		UML_XOR(block, I3, I3, I0);                                                 // xor     i3,i3,i0
+		UML_ROLAND(block, I3, I3, 32 - 4, 1);                                       // roland  i3,i3,32-4,1
+		DRC_STORE8(block, m_AF, I3);                                                // store   [AF],i3
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_condition - leave condition code cc
+    true or false in i0 and return the condition
+    under which it does not hold
+-------------------------------------------------*/
+
+uml::condition_t i386_device::generate_condition(drcuml_block &block, int cc)
+{
+	switch (cc >> 1)
+	{
+		case 0:     DRC_LOAD8(block, I0, m_OF);     break;                          // load    i0,[OF]
+		case 1:     DRC_LOAD8(block, I0, m_CF);     break;                          // load    i0,[CF]
+		case 2:     DRC_LOAD8(block, I0, m_ZF);     break;                          // load    i0,[ZF]
+		case 3:
+			DRC_LOAD8(block, I0, m_CF);                                             // load    i0,[CF]
+			DRC_LOAD8(block, I1, m_ZF);                                             // load    i1,[ZF]
+			UML_OR(block, I0, I0, I1);                                              // or      i0,i0,i1
+			break;
+		case 4:     DRC_LOAD8(block, I0, m_SF);     break;                          // load    i0,[SF]
+		case 5:     DRC_LOAD8(block, I0, m_PF);     break;                          // load    i0,[PF]
+		case 6:
+			DRC_LOAD8(block, I0, m_SF);                                             // load    i0,[SF]
+			DRC_LOAD8(block, I1, m_OF);                                             // load    i1,[OF]
+			UML_XOR(block, I0, I0, I1);                                             // xor     i0,i0,i1
+			break;
+		case 7:
+			DRC_LOAD8(block, I0, m_SF);                                             // load    i0,[SF]
+			DRC_LOAD8(block, I1, m_OF);                                             // load    i1,[OF]
+			UML_XOR(block, I0, I0, I1);                                             // xor     i0,i0,i1
+			DRC_LOAD8(block, I1, m_ZF);                                             // load    i1,[ZF]
+			UML_OR(block, I0, I0, I1);                                              // or      i0,i0,i1
+			break;
+	}
+	UML_TEST(block, I0, I0);                                                        // test    i0,i0
+
+	/* odd condition codes are the negated forms */
+	return (cc & 1) ? uml::COND_NZ : uml::COND_Z;
+}
+
+
+/*-------------------------------------------------
+    generate_branch - generate code to update the
+    cycle count and jump to a static or dynamic
+    target
+-------------------------------------------------*/
+
+void i386_device::generate_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uml::parameter target)
+{
+	generate_update_cycles(block, compiler, target, true);                          // <subtract cycles>
+	UML_HASHJMP(block, compiler.mode, target, *m_nocode);                           // hashjmp <mode>,target,nocode
+}
+
+
+/*-------------------------------------------------
+    generate_opcode - generate code for a native
+    instruction; returns false if it has to go to
+    the interpreter after all
+-------------------------------------------------*/
+
+bool i386_device::generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	uint8_t const op = desc->opptr.b[0];
+	uint8_t const modrm = desc->opptr.b[1];
+	int const reg = (modrm >> 3) & 7;
+	uint32_t const nextpc = desc->pc + desc->length;
+
+	/* two-byte opcodes */
+	if (op == 0x0f)
+	{
+		uint8_t const op2 = desc->opptr.b[1];
+		uint8_t const modrm2 = desc->opptr.b[2];
+
+		/* Jcc rel32 */
+		if (op2 >= 0x80 && op2 <= 0x8f)
+		{
+			uml::code_label const skip = compiler.labelnum++;
+			UML_JMPc(block, generate_condition(block, op2 & 0x0f), skip);           // jmp     skip,!cc
+			generate_conditional_branch(block, compiler, desc);
+			UML_LABEL(block, skip);                                                 // skip:
+			UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                      // mapvar  CYCLES,compiler.cycles
+			return true;
+		}
+
+		/* MOVZX/MOVSX r32,rm8/rm16 */
+		if (op2 == 0xb6 || op2 == 0xb7 || op2 == 0xbe || op2 == 0xbf)
+		{
+			int const size = (op2 & 1) ? 2 : 1;
+			if (modrm2 < 0xc0)
+				generate_ea(block, desc, 2);
+			generate_load_rm(block, compiler, modrm2, size, uml::I7);
+			if (op2 >= 0xbe)
+				UML_SEXT(block, I7, I7, access_size(size));                         // sext    i7,i7,size
+			STORE_GPR32(block, (modrm2 >> 3) & 7, I7);                              // store   [reg],i7
+			return true;
+		}
+		return false;
+	}
+
+	/* ALU rm32,r32 / r32,rm32 / eAX,imm32 */
+	if (op < 0x40 && ((op & 0x07) == 1 || (op & 0x07) == 3 || (op & 0x07) == 5))
+	{
+		int const aluop = op >> 3;
+		uint32_t const written = desc->regout[1];
+
+		/* ADC and SBB need the incoming carry */
+		if (aluop == 2 || aluop == 3)
+			return false;
+
+		if ((op & 0x07) == 5)
+		{
+			LOAD_GPR32(block, I1, EAX);                                             // load    i1,[eax]
+			UML_MOV(block, I2, opcode_imm32(desc, 1));                              // mov     i2,imm
+			generate_alu(block, aluop);
+			if (aluop != 7)
+				STORE_GPR32(block, EAX, I0);                                        // store   [eax],i0
+		}
+		else if ((op & 0x07) == 3)
+		{
+			if (modrm < 0xc0)
+				generate_ea(block, desc, 1);
+			generate_load_rm(block, compiler, modrm, 4, uml::I2);
+			LOAD_GPR32(block, I1, reg);                                             // load    i1,[reg]
+			generate_alu(block, aluop);
+			if (aluop != 7)
+				STORE_GPR32(block, reg, I0);                                        // store   [reg],i0
+		}
+		else
+		{
+			if (modrm < 0xc0)
+				generate_ea(block, desc, 1);
+			generate_load_rm(block, compiler, modrm, 4, uml::I7);
+			LOAD_GPR32(block, I8, reg);                                             // load    i8,[reg]
+			UML_MOV(block, I1, I7);                                                 // mov     i1,i7
+			UML_MOV(block, I2, I8);                                                 // mov     i2,i8
+			generate_alu(block, aluop);
+			if (aluop != 7)
+				generate_alu_store(block, compiler, modrm);
+		}
+		generate_alu_flags(block, desc, aluop, written);
+		return true;
+	}
+
+	/* INC/DEC r32 */
+	if (op >= 0x40 && op <= 0x4f)
+	{
+		int const aluop = (op < 0x48) ? 0 : 5;
+		LOAD_GPR32(block, I1, op & 7);                                              // load    i1,[reg]
+		UML_MOV(block, I2, 1);                                                      // mov     i2,1
+		generate_alu(block, aluop);
+		STORE_GPR32(block, op & 7, I0);                                             // store   [reg],i0
+		generate_alu_flags(block, desc, aluop, REGFLAG_ALLFLAGS & ~REGFLAG_CF);
+		return true;
+	}
+
+	/* PUSH r32 */
+	if (op >= 0x50 && op <= 0x57)
+	{
+		LOAD_GPR32(block, I7, op & 7);                                              // load    i7,[reg]
+		generate_push(block, compiler, uml::I7);
+		return true;
+	}
+
+	/* POP r32 */
+	if (op >= 0x58 && op <= 0x5f)
+	{
+		LOAD_GPR32(block, I8, ESP);                                                 // load    i8,[esp]
+		UML_MOV(block, I0, I8);                                                     // mov     i0,i8
+		UML_CALLH(block, *m_read[2][compiler.mode & 3]);                            // callh   read32
+		UML_ADD(block, I8, I8, 4);                                                  // add     i8,i8,4
+		STORE_GPR32(block, ESP, I8);                                                // store   [esp],i8
+		STORE_GPR32(block, op & 7, I0);                                             // store   [reg],i0
+		return true;
+	}
+
+	/* MOV r8,imm8 */
+	if (op >= 0xb0 && op <= 0xb7)
+	{
+		STORE_GPR8(block, op & 7, desc->opptr.b[1]);                                // store   [reg8],imm
+		return true;
+	}
+
+	/* MOV r32,imm32 */
+	if (op >= 0xb8 && op <= 0xbf)
+	{
+		STORE_GPR32(block, op & 7, opcode_imm32(desc, 1));                          // store   [reg],imm
+		return true;
+	}
+
+	/* Jcc rel8 */
+	if (op >= 0x70 && op <= 0x7f)
+	{
+		uml::code_label const skip = compiler.labelnum++;
+		UML_JMPc(block, generate_condition(block, op & 0x0f), skip);                // jmp     skip,!cc
+		generate_conditional_branch(block, compiler, desc);
+		UML_LABEL(block, skip);                                                     // skip:
+		UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                          // mapvar  CYCLES,compiler.cycles
+		return true;
+	}
+
+	switch (op)
+	{
+		case 0x81:  /* group 1 rm32,imm32 */
+		case 0x83:  /* group 1 rm32,imm8 */
+		{
+			if (reg == 2 || reg == 3)
+				return false;
+			int const offset = (modrm < 0xc0) ? generate_ea(block, desc, 1) : 2;
+			uint32_t const imm = (op == 0x81) ? opcode_imm32(desc, offset) : uint32_t(int8_t(desc->opptr.b[offset]));
+			generate_load_rm(block, compiler, modrm, 4, uml::I7);
+			UML_MOV(block, I1, I7);                                                 // mov     i1,i7
+			UML_MOV(block, I2, imm);                                                // mov     i2,imm
+			generate_alu(block, reg);
+			if (reg != 7)
+				generate_alu_store(block, compiler, modrm);
+			generate_alu_flags(block, desc, reg, desc->regout[1]);
+			return true;
+		}
+
+		case 0x85:  /* TEST rm32,r32 */
+			if (modrm < 0xc0)
+				generate_ea(block, desc, 1);
+			generate_load_rm(block, compiler, modrm, 4, uml::I2);
+			LOAD_GPR32(block, I1, reg);                                             // load    i1,[reg]
+			generate_alu(block, 4);
+			generate_alu_flags(block, desc, 4, desc->regout[1]);
+			return true;
+
+		case 0xa9:  /* TEST eAX,imm32 */
+			LOAD_GPR32(block, I1, EAX);                                             // load    i1,[eax]
+			UML_MOV(block, I2, opcode_imm32(desc, 1));                              // mov     i2,imm
+			generate_alu(block, 4);
+			generate_alu_flags(block, desc, 4, desc->regout[1]);
+			return true;
+
+		case 0x68:  /* PUSH imm32 */
+			generate_push(block, compiler, opcode_imm32(desc, 1));
+			return true;
+
+		case 0x6a:  /* PUSH imm8 */
+			generate_push(block, compiler, uint32_t(int8_t(desc->opptr.b[1])));
+			return true;
+
+		case 0x88:  /* MOV rm8,r8 */
+		case 0x89:  /* MOV rm32,r32 */
+		{
+			int const size = (op == 0x88) ? 1 : 4;
+			if (modrm < 0xc0)
+				generate_ea(block, desc, 1);
+			if (size == 1)
+				LOAD_GPR8(block, I7, reg);                                          // load    i7,[reg8]
+			else
+				LOAD_GPR32(block, I7, reg);                                         // load    i7,[reg]
+			generate_store_rm(block, compiler, modrm, size, uml::I7);
+			return true;
+		}
+
+		case 0x8a:  /* MOV r8,rm8 */
+		case 0x8b:  /* MOV r32,rm32 */
+			if (modrm < 0xc0)
+				generate_ea(block, desc, 1);
+			if (op == 0x8a)
+			{
+				generate_load_rm(block, compiler, modrm, 1, uml::I7);
+				STORE_GPR8(block, reg, I7);                                         // store   [reg8],i7
+			}
+			else
+			{
+				generate_load_rm(block, compiler, modrm, 4, uml::I7);
+				STORE_GPR32(block, reg, I7);                                        // store   [reg],i7
+			}
+			return true;
+
+		case 0xc6:  /* MOV rm8,imm8 */
+		case 0xc7:  /* MOV rm32,imm32 */
+		{
+			if (reg != 0)
+				return false;
+			int const offset = (modrm < 0xc0) ? generate_ea(block, desc, 1) : 2;
+			if (op == 0xc6)
+				generate_store_rm(block, compiler, modrm, 1, desc->opptr.b[offset]);
+			else
+				generate_store_rm(block, compiler, modrm, 4, opcode_imm32(desc, offset));
+			return true;
+		}
+
+		case 0x8d:  /* LEA r32,m */
+			generate_ea(block, desc, 1);
+			STORE_GPR32(block, reg, I6);                                            // store   [reg],i6
+			return true;
+
+		case 0x90:  /* NOP */
+			return true;
+
+		case 0xeb:  /* JMP rel8 */
+		case 0xe9:  /* JMP rel32 */
+			generate_branch(block, compiler, desc, desc->targetpc);
+			return true;
+
+		case 0xe8:  /* CALL rel32 */
+			generate_push(block, compiler, nextpc);
+			generate_branch(block, compiler, desc, desc->targetpc);
+			return true;
+
+		case 0xc2:  /* RET imm16 */
+		case 0xc3:  /* RET */
+		{
+			uint32_t const adjust = 4 + ((op == 0xc2) ? (desc->opptr.b[1] | (desc->opptr.b[2] << 8)) : 0);
+			LOAD_GPR32(block, I8, ESP);                                             // load    i8,[esp]
+			UML_MOV(block, I0, I8);                                                 // mov     i0,i8
+			UML_CALLH(block, *m_read[2][compiler.mode & 3]);                        // callh   read32
+			UML_MOV(block, I5, I0);                                                 // mov     i5,i0
+			UML_ADD(block, I8, I8, adjust);                                         // add     i8,i8,adjust
+			STORE_GPR32(block, ESP, I8);                                            // store   [esp],i8
+			generate_branch(block, compiler, desc, uml::I5);
+			return true;
+		}
+
+		case 0xff:  /* CALL/JMP rm32 */
+			if (reg != 2 && reg != 4)
+				return false;
+			if (modrm < 0xc0)
+				generate_ea(block, desc, 1);
+			generate_load_rm(block, compiler, modrm, 4, uml::I5);
+			if (reg == 2)
+				generate_push(block, compiler, nextpc);
+			generate_branch(block, compiler, desc, uml::I5);
+			return true;
+	}
+
+	return false;
+}
+
+
+/*-------------------------------------------------
+    generate_conditional_branch - generate the
+    taken path of a Jcc
+-------------------------------------------------*/
+
+void i386_device::generate_conditional_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	compiler_state compiler_temp(compiler);
+
+	/* taking the branch costs extra */
+	compiler_temp.cycles += desc->userdata0;
+	UML_MAPVAR(block, MAPVAR_CYCLES, compiler_temp.cycles);                         // mapvar  CYCLES,compiler_temp.cycles
+	generate_branch(block, compiler_temp, desc, desc->targetpc);
+	compiler.labelnum = compiler_temp.labelnum;
+}
+
+
+/*-------------------------------------------------
+    generate_alu_store - write the ALU result in
+    i0 back to a ModRM operand, leaving i0-i2 as
+    generate_alu_flags expects them; the operands
+    must be in i7 and i8
+-------------------------------------------------*/
+
+void i386_device::generate_alu_store(drcuml_block &block, compiler_state &compiler, uint8_t modrm)
+{
+	if (modrm >= 0xc0)
+		STORE_GPR32(block, modrm & 7, I0);                                          // store   [rm],i0
+	else
+	{
+		/* write before any flags change so a fault leaves them alone */
+		UML_MOV(block, I9, I0);                                                     // mov     i9,i0
+		generate_store_rm(block, compiler, modrm, 4, uml::I9);
+		UML_MOV(block, I0, I9);                                                     // mov     i0,i9
+		UML_MOV(block, I1, I7);                                                     // mov     i1,i7
+		UML_MOV(block, I2, I8);                                                     // mov     i2,i8
+	}
+}
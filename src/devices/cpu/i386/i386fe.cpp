@@ -0,0 +1,522 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    i386fe.cpp
+
+    Front-end for i386 recompiler
+
+    Only instructions without prefixes and with 32-bit operands in flat
+    protected mode are described as native; everything else is decoded
+    just far enough to find its length and is handed to the interpreter.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "i386.h"
+#include "i386priv.h"
+#include "i386fe.h"
+
+
+namespace {
+
+//-------------------------------------------------
+//  imm32 - extract a little-endian 32-bit value
+//  from the opcode bytes
+//-------------------------------------------------
+
+inline uint32_t imm32(const opcode_desc &desc, int offset)
+{
+	return desc.opptr.b[offset] | (desc.opptr.b[offset + 1] << 8) | (desc.opptr.b[offset + 2] << 16) | (uint32_t(desc.opptr.b[offset + 3]) << 24);
+}
+
+
+//-------------------------------------------------
+//  jcc_flags - flags read by condition code cc
+//-------------------------------------------------
+
+uint32_t jcc_flags(int cc)
+{
+	switch (cc >> 1)
+	{
+		case 0:     return REGFLAG_OF;
+		case 1:     return REGFLAG_CF;
+		case 2:     return REGFLAG_ZF;
+		case 3:     return REGFLAG_CF | REGFLAG_ZF;
+		case 4:     return REGFLAG_SF;
+		case 5:     return REGFLAG_PF;
+		case 6:     return REGFLAG_SF | REGFLAG_OF;
+		default:    return REGFLAG_ZF | REGFLAG_SF | REGFLAG_OF;
+	}
+}
+
+
+//-------------------------------------------------
+//  alu_flags - flags written by ALU operation
+//  aluop (the reg field of group 1)
+//-------------------------------------------------
+
+uint32_t alu_flags(int aluop)
+{
+	// OR, AND and XOR leave AF alone
+	return (aluop == 1 || aluop == 4 || aluop == 6) ? (REGFLAG_ALLFLAGS & ~REGFLAG_AF) : REGFLAG_ALLFLAGS;
+}
+
+} // anonymous namespace
+
+
+
+//**************************************************************************
+//  I386 FRONTEND
+//**************************************************************************
+
+//-------------------------------------------------
+//  i386_frontend - constructor
+//-------------------------------------------------
+
+i386_frontend::i386_frontend(i386_device *i386, uint32_t window_start, uint32_t window_end, uint32_t max_sequence)
+	: drc_frontend(*i386, window_start, window_end, max_sequence)
+	, m_i386(i386)
+	, m_fetch_length(0)
+	, m_fetch_failed(false)
+	, m_fetch_crossed(false)
+{
+}
+
+
+//-------------------------------------------------
+//  describe - build a description of a single
+//  instruction
+//-------------------------------------------------
+
+bool i386_frontend::describe(opcode_desc &desc, const opcode_desc *prev)
+{
+	uint32_t error;
+
+	// compute the physical PC
+	if (!m_i386->translate_address(m_i386->m_CPL, TRANSLATE_FETCH, &desc.physpc, &error))
+	{
+		// a page fault on the first byte; let the interpreter raise it
+		desc.flags |= OPFLAG_VALIDATE_TLB | OPFLAG_CAN_CAUSE_EXCEPTION | OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_VIRTUAL_NOOP | OPFLAG_END_SEQUENCE;
+		return true;
+	}
+	desc.physpc &= m_i386->m_a20_mask;
+
+	m_fetch_length = 0;
+	m_fetch_failed = false;
+	m_fetch_crossed = false;
+
+	// skip over any prefixes
+	bool prefixed = false;
+	bool opsize16 = false;
+	bool addrsize16 = false;
+	uint8_t op;
+	for (;;)
+	{
+		op = fetch(desc);
+		if (op == 0x26 || op == 0x2e || op == 0x36 || op == 0x3e || op == 0x64 || op == 0x65 || op == 0xf0 || op == 0xf2 || op == 0xf3)
+			prefixed = true;
+		else if (op == 0x66)
+			prefixed = opsize16 = true;
+		else if (op == 0x67)
+			prefixed = addrsize16 = true;
+		else
+			break;
+	}
+
+	// find the length of the rest of the instruction
+	int const immz = opsize16 ? 2 : 4;
+	int const addrbytes = addrsize16 ? 2 : 4;
+	int op2 = -1;
+	int modrm = -1;
+	int immsize = 0;
+	if (op == 0x0f)
+	{
+		op2 = fetch(desc);
+		if (op2 == 0x38 || op2 == 0x3a)
+		{
+			fetch(desc);
+			modrm = fetch(desc);
+			immsize = (op2 == 0x3a) ? 1 : 0;
+		}
+		else
+		{
+			if (!((op2 >= 0x05 && op2 <= 0x0b) || (op2 >= 0x30 && op2 <= 0x37) || op2 == 0x77 || (op2 >= 0x80 && op2 <= 0x8f) ||
+					(op2 >= 0xa0 && op2 <= 0xa2) || (op2 >= 0xa8 && op2 <= 0xaa) || op2 >= 0xc8))
+				modrm = fetch(desc);
+			if ((op2 >= 0x70 && op2 <= 0x73) || op2 == 0xa4 || op2 == 0xac || op2 == 0xba || op2 == 0xc2 || (op2 >= 0xc4 && op2 <= 0xc6) || op2 == 0x0f)
+				immsize = 1;
+			else if (op2 >= 0x80 && op2 <= 0x8f)
+				immsize = immz;
+		}
+	}
+	else
+	{
+		if ((op < 0x40 && (op & 0x07) < 4) || op == 0x62 || op == 0x63 || op == 0x69 || op == 0x6b || (op >= 0x80 && op <= 0x8f) ||
+				op == 0xc0 || op == 0xc1 || (op >= 0xc4 && op <= 0xc7) || (op >= 0xd0 && op <= 0xd3) || (op >= 0xd8 && op <= 0xdf) ||
+				op == 0xf6 || op == 0xf7 || op == 0xfe || op == 0xff)
+			modrm = fetch(desc);
+
+		if (op < 0x40 && (op & 0x07) == 4)
+			immsize = 1;
+		else if (op < 0x40 && (op & 0x07) == 5)
+			immsize = immz;
+		else switch (op)
+		{
+			case 0x6a: case 0x6b: case 0x80: case 0x82: case 0x83: case 0xa8: case 0xc0: case 0xc1:
+			case 0xc6: case 0xcd: case 0xd4: case 0xd5: case 0xeb:
+				immsize = 1;
+				break;
+
+			case 0x68: case 0x69: case 0x81: case 0xa9: case 0xc7: case 0xe8: case 0xe9:
+				immsize = immz;
+				break;
+
+			case 0x9a: case 0xea:
+				immsize = immz + 2;
+				break;
+
+			case 0xa0: case 0xa1: case 0xa2: case 0xa3:
+				immsize = addrbytes;
+				break;
+
+			case 0xc2: case 0xca:
+				immsize = 2;
+				break;
+
+			case 0xc8:
+				immsize = 3;
+				break;
+
+			case 0xf6: case 0xf7:
+				if (((modrm >> 3) & 7) < 2)
+					immsize = (op == 0xf6) ? 1 : immz;
+				break;
+
+			default:
+				if ((op >= 0x70 && op <= 0x7f) || (op >= 0xb0 && op <= 0xb7) || (op >= 0xe0 && op <= 0xe7))
+					immsize = 1;
+				else if (op >= 0xb8 && op <= 0xbf)
+					immsize = immz;
+				break;
+		}
+	}
+	if (modrm >= 0)
+		skip_modrm(desc, modrm, addrsize16);
+	while (immsize-- > 0)
+		fetch(desc);
+	desc.length = m_fetch_length;
+
+	// native if the whole instruction was fetched from one page and has no prefixes
+	if (!m_fetch_failed && !prefixed && !(m_fetch_crossed && (m_i386->m_cr[0] & 0x80000000)))
+	{
+		if (describe_native(desc, op, op2, modrm))
+			return true;
+
+		// the native describer may have started filling things in
+		desc.flags &= OPFLAG_VALIDATE_TLB | OPFLAG_CAN_CAUSE_EXCEPTION;
+		desc.targetpc = BRANCH_TARGET_DYNAMIC;
+		desc.cycles = 0;
+		desc.userdata0 = 0;
+		desc.regin[1] = desc.regout[1] = 0;
+	}
+
+	// everything else runs through the interpreter, which charges its own cycles
+	desc.userflags |= I386_UF_INTERPRET;
+	desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION;
+	desc.regin[1] |= REGFLAG_ALLFLAGS;
+
+	// stop after anything that may transfer control, change the paging setup or
+	// raise an interrupt, so translated code is revalidated before it runs again
+	if (m_fetch_failed || m_fetch_crossed || op == 0x0f || op == 0x07 || op == 0x17 || op == 0x1f || op == 0x8e || op == 0x9a || op == 0x9d ||
+			(op >= 0xca && op <= 0xcf) || (op >= 0xe0 && op <= 0xe7) || (op >= 0xea && op <= 0xef) || op == 0xf4 || op == 0xfa || op == 0xfb ||
+			(op == 0xff && ((modrm >> 3) & 7) != 0 && ((modrm >> 3) & 7) != 1 && ((modrm >> 3) & 7) != 6))
+		desc.flags |= OPFLAG_END_SEQUENCE;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  describe_native - describe an instruction the
+//  recompiler handles itself; returns false to
+//  fall back to the interpreter
+//-------------------------------------------------
+
+bool i386_frontend::describe_native(opcode_desc &desc, uint8_t op, int op2, int modrm)
+{
+	uint8_t const *const cycles = m_i386->m_cycle_table_pm;
+	bool const memop = modrm >= 0 && modrm < 0xc0;
+	int const reg = (modrm >> 3) & 7;
+
+	// every memory access may fault, and the fault handler needs the flags
+	if (memop)
+	{
+		desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION;
+		desc.regin[1] |= REGFLAG_ALLFLAGS;
+	}
+
+	// two-byte opcodes
+	if (op == 0x0f)
+	{
+		if (op2 >= 0x80 && op2 <= 0x8f)
+		{
+			// Jcc rel32
+			desc.regin[1] |= jcc_flags(op2 & 0x0f);
+			desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+			desc.targetpc = desc.pc + desc.length + imm32(desc, desc.length - 4);
+			desc.cycles = cycles[CYCLES_JCC_FULL_DISP_NOBRANCH];
+			desc.userdata0 = cycles[CYCLES_JCC_FULL_DISP] - cycles[CYCLES_JCC_FULL_DISP_NOBRANCH];
+			return true;
+		}
+		if (op2 == 0xb6 || op2 == 0xb7 || op2 == 0xbe || op2 == 0xbf)
+		{
+			// MOVZX/MOVSX r32,rm8/rm16
+			if (memop)
+				desc.flags |= OPFLAG_READS_MEMORY;
+			if (op2 < 0xb8)
+				desc.cycles = cycles[memop ? CYCLES_MOVZX_MEM_REG : CYCLES_MOVZX_REG_REG];
+			else
+				desc.cycles = cycles[memop ? CYCLES_MOVSX_MEM_REG : CYCLES_MOVSX_REG_REG];
+			return true;
+		}
+		return false;
+	}
+
+	// ALU ops in their rm32,r32 / r32,rm32 / eAX,imm32 forms; ADC and SBB are interpreted
+	if (op < 0x40 && ((op & 0x07) == 1 || (op & 0x07) == 3 || (op & 0x07) == 5))
+	{
+		int const aluop = op >> 3;
+		if (aluop == 2 || aluop == 3)
+			return false;
+		desc.regout[1] |= alu_flags(aluop);
+		if ((op & 0x07) == 5)
+			desc.cycles = cycles[(aluop == 7) ? CYCLES_CMP_IMM_ACC : CYCLES_ALU_IMM_ACC];
+		else if (!memop)
+			desc.cycles = cycles[(aluop == 7) ? CYCLES_CMP_REG_REG : CYCLES_ALU_REG_REG];
+		else if ((op & 0x07) == 1)
+		{
+			desc.flags |= OPFLAG_READS_MEMORY | ((aluop != 7) ? OPFLAG_WRITES_MEMORY : 0);
+			desc.cycles = cycles[(aluop == 7) ? CYCLES_CMP_REG_MEM : CYCLES_ALU_REG_MEM];
+		}
+		else
+		{
+			desc.flags |= OPFLAG_READS_MEMORY;
+			desc.cycles = cycles[(aluop == 7) ? CYCLES_CMP_MEM_REG : CYCLES_ALU_MEM_REG];
+		}
+		return true;
+	}
+
+	// INC/DEC r32
+	if (op >= 0x40 && op <= 0x4f)
+	{
+		desc.regout[1] |= REGFLAG_ALLFLAGS & ~REGFLAG_CF;
+		desc.cycles = cycles[(op < 0x48) ? CYCLES_INC_REG : CYCLES_DEC_REG];
+		return true;
+	}
+
+	// PUSH/POP r32
+	if (op >= 0x50 && op <= 0x5f)
+	{
+		desc.flags |= ((op < 0x58) ? OPFLAG_WRITES_MEMORY : OPFLAG_READS_MEMORY) | OPFLAG_CAN_CAUSE_EXCEPTION;
+		desc.regin[1] |= REGFLAG_ALLFLAGS;
+		desc.cycles = cycles[(op < 0x58) ? CYCLES_PUSH_REG_SHORT : CYCLES_POP_REG_SHORT];
+		return true;
+	}
+
+	// MOV r8,imm8 / MOV r32,imm32
+	if (op >= 0xb0 && op <= 0xbf)
+	{
+		desc.cycles = cycles[CYCLES_MOV_IMM_REG];
+		return true;
+	}
+
+	// Jcc rel8
+	if (op >= 0x70 && op <= 0x7f)
+	{
+		desc.regin[1] |= jcc_flags(op & 0x0f);
+		desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+		desc.targetpc = desc.pc + desc.length + int8_t(desc.opptr.b[desc.length - 1]);
+		desc.cycles = cycles[CYCLES_JCC_DISP8_NOBRANCH];
+		desc.userdata0 = cycles[CYCLES_JCC_DISP8] - cycles[CYCLES_JCC_DISP8_NOBRANCH];
+		return true;
+	}
+
+	switch (op)
+	{
+		case 0x81:  // group 1 rm32,imm32
+		case 0x83:  // group 1 rm32,imm8
+			if (reg == 2 || reg == 3)
+				return false;
+			desc.regout[1] |= alu_flags(reg);
+			if (memop)
+				desc.flags |= OPFLAG_READS_MEMORY | ((reg != 7) ? OPFLAG_WRITES_MEMORY : 0);
+			if (reg == 7)
+				desc.cycles = cycles[memop ? CYCLES_CMP_IMM_MEM : CYCLES_CMP_IMM_REG];
+			else
+				desc.cycles = cycles[memop ? CYCLES_ALU_IMM_MEM : CYCLES_ALU_IMM_REG];
+			return true;
+
+		case 0x85:  // TEST rm32,r32
+			desc.regout[1] |= REGFLAG_ALLFLAGS & ~REGFLAG_AF;
+			if (memop)
+				desc.flags |= OPFLAG_READS_MEMORY;
+			desc.cycles = cycles[memop ? CYCLES_TEST_REG_MEM : CYCLES_TEST_REG_REG];
+			return true;
+
+		case 0xa9:  // TEST eAX,imm32
+			desc.regout[1] |= REGFLAG_ALLFLAGS & ~REGFLAG_AF;
+			desc.cycles = cycles[CYCLES_TEST_IMM_ACC];
+			return true;
+
+		case 0x68:  // PUSH imm32
+		case 0x6a:  // PUSH imm8
+			desc.flags |= OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			desc.regin[1] |= REGFLAG_ALLFLAGS;
+			desc.cycles = cycles[CYCLES_PUSH_IMM];
+			return true;
+
+		case 0x88:  // MOV rm8,r8
+		case 0x89:  // MOV rm32,r32
+			if (memop)
+				desc.flags |= OPFLAG_WRITES_MEMORY;
+			desc.cycles = cycles[memop ? CYCLES_MOV_REG_MEM : CYCLES_MOV_REG_REG];
+			return true;
+
+		case 0x8a:  // MOV r8,rm8
+		case 0x8b:  // MOV r32,rm32
+			if (memop)
+				desc.flags |= OPFLAG_READS_MEMORY;
+			desc.cycles = cycles[memop ? CYCLES_MOV_MEM_REG : CYCLES_MOV_REG_REG];
+			return true;
+
+		case 0xc6:  // MOV rm8,imm8
+		case 0xc7:  // MOV rm32,imm32
+			if (reg != 0)
+				return false;
+			if (memop)
+				desc.flags |= OPFLAG_WRITES_MEMORY;
+			desc.cycles = cycles[memop ? CYCLES_MOV_IMM_MEM : CYCLES_MOV_IMM_REG];
+			return true;
+
+		case 0x8d:  // LEA r32,m
+			if (!memop)
+				return false;
+			desc.flags &= ~OPFLAG_CAN_CAUSE_EXCEPTION;
+			desc.regin[1] &= ~REGFLAG_ALLFLAGS;
+			desc.cycles = cycles[CYCLES_LEA];
+			return true;
+
+		case 0x90:  // NOP
+			desc.cycles = cycles[CYCLES_NOP];
+			return true;
+
+		case 0xeb:  // JMP rel8
+			desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			desc.targetpc = desc.pc + desc.length + int8_t(desc.opptr.b[desc.length - 1]);
+			desc.cycles = cycles[CYCLES_JMP_SHORT];
+			return true;
+
+		case 0xe9:  // JMP rel32
+			desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			desc.targetpc = desc.pc + desc.length + imm32(desc, desc.length - 4);
+			desc.cycles = cycles[CYCLES_JMP];
+			return true;
+
+		case 0xe8:  // CALL rel32
+			desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE | OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			desc.regin[1] |= REGFLAG_ALLFLAGS;
+			desc.targetpc = desc.pc + desc.length + imm32(desc, desc.length - 4);
+			desc.cycles = cycles[CYCLES_CALL];
+			return true;
+
+		case 0xc2:  // RET imm16
+		case 0xc3:  // RET
+			desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE | OPFLAG_READS_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			desc.regin[1] |= REGFLAG_ALLFLAGS;
+			desc.cycles = cycles[(op == 0xc2) ? CYCLES_RET_IMM : CYCLES_RET];
+			return true;
+
+		case 0xff:  // CALL/JMP rm32
+			if (reg == 2)
+			{
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE | OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+				desc.regin[1] |= REGFLAG_ALLFLAGS;
+				desc.cycles = cycles[memop ? CYCLES_CALL_MEM : CYCLES_CALL_REG];
+			}
+			else if (reg == 4)
+			{
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+				desc.cycles = cycles[memop ? CYCLES_JMP_MEM : CYCLES_JMP_REG];
+			}
+			else
+				return false;
+			if (memop)
+				desc.flags |= OPFLAG_READS_MEMORY;
+			return true;
+	}
+
+	return false;
+}
+
+
+//-------------------------------------------------
+//  fetch - fetch the next opcode byte, noting
+//  when the instruction runs onto another page
+//-------------------------------------------------
+
+uint8_t i386_frontend::fetch(opcode_desc &desc)
+{
+	// instructions are limited to 15 bytes; the interpreter raises the fault
+	if (m_fetch_failed || m_fetch_length >= 15)
+	{
+		m_fetch_failed = true;
+		return 0;
+	}
+
+	uint32_t address = desc.pc + m_fetch_length;
+	if ((address ^ desc.pc) & ~0xfff)
+	{
+		uint32_t error;
+		m_fetch_crossed = true;
+		if (!m_i386->translate_address(m_i386->m_CPL, TRANSLATE_FETCH, &address, &error))
+		{
+			m_fetch_failed = true;
+			return 0;
+		}
+	}
+	else
+		address = desc.physpc + m_fetch_length;
+
+	uint8_t const value = m_i386->mem_pr8(address & m_i386->m_a20_mask);
+	desc.opptr.b[m_fetch_length++] = value;
+	return value;
+}
+
+
+//-------------------------------------------------
+//  skip_modrm - fetch the SIB and displacement
+//  bytes that follow a ModRM byte
+//-------------------------------------------------
+
+void i386_frontend::skip_modrm(opcode_desc &desc, uint8_t modrm, bool addrsize16)
+{
+	int const mod = modrm >> 6;
+	int const rm = modrm & 7;
+	int disp = 0;
+
+	if (mod == 3)
+		return;
+	if (addrsize16)
+		disp = (mod == 1) ? 1 : (mod == 2 || (mod == 0 && rm == 6)) ? 2 : 0;
+	else
+	{
+		if (rm == 4 && (fetch(desc) & 7) == 5 && mod == 0)
+			disp = 4;
+		if (mod == 1)
+			disp = 1;
+		else if (mod == 2 || (mod == 0 && rm == 5))
+			disp = 4;
+	}
+	while (disp-- > 0)
+		fetch(desc);
+}
@@ -0,0 +1,33 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    i386fe.h
+
+    Front-end for i386 recompiler
+
+***************************************************************************/
+#ifndef MAME_CPU_I386_I386FE_H
+#define MAME_CPU_I386_I386FE_H
+
+#pragma once
+
+
+//**************************************************************************
+//  MACROS
+//**************************************************************************
+
+// register flags 1 (only the arithmetic flags are tracked)
+#define REGFLAG_CF                      (1 << 0)
+#define REGFLAG_PF                      (1 << 1)
+#define REGFLAG_AF                      (1 << 2)
+#define REGFLAG_ZF                      (1 << 3)
+#define REGFLAG_SF                      (1 << 4)
+#define REGFLAG_OF                      (1 << 5)
+#define REGFLAG_ALLFLAGS                (REGFLAG_CF | REGFLAG_PF | REGFLAG_AF | REGFLAG_ZF | REGFLAG_SF | REGFLAG_OF)
+
+// opcode_desc user flags
+#define I386_UF_INTERPRET               (1 << 0)    // instruction is handed to the interpreter
+
+
+#endif // MAME_CPU_I386_I386FE_H
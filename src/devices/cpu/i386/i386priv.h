@@ -335,6 +335,32 @@ extern int i386_parity_table[256];
 
 /***********************************************************************************/
 
+/* recompiler map variables */
+#define MAPVAR_PC                   uml::M0
+#define MAPVAR_CYCLES               uml::M1
+
+/* size of the execution code cache */
+#define DRC_CACHE_SIZE              (32 * 1024 * 1024)
+
+/* compilation boundaries -- how far back/forward does the analysis extend? */
+#define COMPILE_BACKWARDS_BYTES     128
+#define COMPILE_FORWARDS_BYTES      512
+#define COMPILE_MAX_SEQUENCE        64
+
+/* exit codes */
+#define EXECUTE_OUT_OF_CYCLES       0
+#define EXECUTE_MISSING_CODE        1
+#define EXECUTE_REDISPATCH          2
+#define EXECUTE_RESET_CACHE         3
+#define EXECUTE_INTERPRET           4
+
+/* code modes; blocks are hashed by paging and user/supervisor state */
+#define DRC_MODE_PAGING             1
+#define DRC_MODE_USER               2
+#define DRC_MODE_INTERPRET          4
+
+/***********************************************************************************/
+
 struct MODRM_TABLE {
 	struct {
 		int b;
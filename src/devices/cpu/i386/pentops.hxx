@@ -5,6 +5,13 @@
 extern flag float32_is_nan( float32 a ); // since its not defined in softfloat.h
 extern flag float64_is_nan( float64 a ); // since its not defined in softfloat.h
 
+#if (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(_M_X64))
+#include <emmintrin.h>
+#define I386_HOST_SSE   (1)
+#else
+#define I386_HOST_SSE   (0)
+#endif
+
 void i386_device::MMXPROLOG()
 {
 	//m_x87_sw &= ~(X87_SW_TOP_MASK << X87_SW_TOP_SHIFT); // top = 0
@@ -3500,22 +3507,92 @@ void i386_device::sse_xorpd_r128_rm128() // Opcode 66 0f 57
 	CYCLES(1);     // TODO: correct cycle count
 }
 
+/*
+    Packed single arithmetic goes straight to the host's SSE unit when it
+    has one.  The fallbacks give the same results a lane at a time: MINPS
+    and MAXPS return the second operand for unordered or equal inputs either way.
+*/
+
+static inline void sse_packed_add(float *d, const float *s)
+{
+#if I386_HOST_SSE
+	_mm_storeu_ps(d, _mm_add_ps(_mm_loadu_ps(d), _mm_loadu_ps(s)));
+#else
+	for (int i = 0; i < 4; i++)
+		d[i] = d[i] + s[i];
+#endif
+}
+
+static inline void sse_packed_sub(float *d, const float *s)
+{
+#if I386_HOST_SSE
+	_mm_storeu_ps(d, _mm_sub_ps(_mm_loadu_ps(d), _mm_loadu_ps(s)));
+#else
+	for (int i = 0; i < 4; i++)
+		d[i] = d[i] - s[i];
+#endif
+}
+
+static inline void sse_packed_mul(float *d, const float *s)
+{
+#if I386_HOST_SSE
+	_mm_storeu_ps(d, _mm_mul_ps(_mm_loadu_ps(d), _mm_loadu_ps(s)));
+#else
+	for (int i = 0; i < 4; i++)
+		d[i] = d[i] * s[i];
+#endif
+}
+
+static inline void sse_packed_div(float *d, const float *s)
+{
+#if I386_HOST_SSE
+	_mm_storeu_ps(d, _mm_div_ps(_mm_loadu_ps(d), _mm_loadu_ps(s)));
+#else
+	for (int i = 0; i < 4; i++)
+		d[i] = d[i] / s[i];
+#endif
+}
+
+static inline void sse_packed_min(float *d, const float *s)
+{
+#if I386_HOST_SSE
+	_mm_storeu_ps(d, _mm_min_ps(_mm_loadu_ps(d), _mm_loadu_ps(s)));
+#else
+	for (int i = 0; i < 4; i++)
+		d[i] = (d[i] < s[i]) ? d[i] : s[i];
+#endif
+}
+
+static inline void sse_packed_max(float *d, const float *s)
+{
+#if I386_HOST_SSE
+	_mm_storeu_ps(d, _mm_max_ps(_mm_loadu_ps(d), _mm_loadu_ps(s)));
+#else
+	for (int i = 0; i < 4; i++)
+		d[i] = (d[i] > s[i]) ? d[i] : s[i];
+#endif
+}
+
+static inline void sse_packed_sqrt(float *d, const float *s)
+{
+#if I386_HOST_SSE
+	_mm_storeu_ps(d, _mm_sqrt_ps(_mm_loadu_ps(s)));
+#else
+	for (int i = 0; i < 4; i++)
+		d[i] = sqrt(s[i]);
+#endif
+}
+
 void i386_device::sse_addps() // Opcode 0f 58
 {
 	uint8_t modrm = FETCH();
 	if( modrm >= 0xc0 ) {
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] + XMM(modrm & 0x7).f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] + XMM(modrm & 0x7).f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] + XMM(modrm & 0x7).f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] + XMM(modrm & 0x7).f[3];
+		sse_packed_add(XMM((modrm >> 3) & 0x7).f, XMM(modrm & 0x7).f);
 	} else {
 		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] + src.f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] + src.f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] + src.f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] + src.f[3];
+		sse_packed_add(XMM((modrm >> 3) & 0x7).f, src.f);
 	}
 	CYCLES(1);     // TODO: correct cycle count
 }
@@ -3524,18 +3601,12 @@ void i386_device::sse_sqrtps_r128_rm128() // Opcode 0f 51
 {
 	uint8_t modrm = FETCH();
 	if( modrm >= 0xc0 ) {
-		XMM((modrm >> 3) & 0x7).f[0] = sqrt(XMM(modrm & 0x7).f[0]);
-		XMM((modrm >> 3) & 0x7).f[1] = sqrt(XMM(modrm & 0x7).f[1]);
-		XMM((modrm >> 3) & 0x7).f[2] = sqrt(XMM(modrm & 0x7).f[2]);
-		XMM((modrm >> 3) & 0x7).f[3] = sqrt(XMM(modrm & 0x7).f[3]);
+		sse_packed_sqrt(XMM((modrm >> 3) & 0x7).f, XMM(modrm & 0x7).f);
 	} else {
 		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		XMM((modrm >> 3) & 0x7).f[0] = sqrt(src.f[0]);
-		XMM((modrm >> 3) & 0x7).f[1] = sqrt(src.f[1]);
-		XMM((modrm >> 3) & 0x7).f[2] = sqrt(src.f[2]);
-		XMM((modrm >> 3) & 0x7).f[3] = sqrt(src.f[3]);
+		sse_packed_sqrt(XMM((modrm >> 3) & 0x7).f, src.f);
 	}
 	CYCLES(1);     // TODO: correct cycle count
 }
@@ -3680,18 +3751,12 @@ void i386_device::sse_mulps() // Opcode 0f 59 ????
 {
 	uint8_t modrm = FETCH();
 	if( modrm >= 0xc0 ) {
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] * XMM(modrm & 0x7).f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] * XMM(modrm & 0x7).f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] * XMM(modrm & 0x7).f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] * XMM(modrm & 0x7).f[3];
+		sse_packed_mul(XMM((modrm >> 3) & 0x7).f, XMM(modrm & 0x7).f);
 	} else {
 		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] * src.f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] * src.f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] * src.f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] * src.f[3];
+		sse_packed_mul(XMM((modrm >> 3) & 0x7).f, src.f);
 	}
 	CYCLES(1);     // TODO: correct cycle count
 }
@@ -3700,18 +3765,12 @@ void i386_device::sse_subps() // Opcode 0f 5c
 {
 	uint8_t modrm = FETCH();
 	if( modrm >= 0xc0 ) {
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] - XMM(modrm & 0x7).f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] - XMM(modrm & 0x7).f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] - XMM(modrm & 0x7).f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] - XMM(modrm & 0x7).f[3];
+		sse_packed_sub(XMM((modrm >> 3) & 0x7).f, XMM(modrm & 0x7).f);
 	} else {
 		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] - src.f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] - src.f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] - src.f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] - src.f[3];
+		sse_packed_sub(XMM((modrm >> 3) & 0x7).f, src.f);
 	}
 	CYCLES(1);     // TODO: correct cycle count
 }
@@ -3746,18 +3805,12 @@ void i386_device::sse_minps() // Opcode 0f 5d
 {
 	uint8_t modrm = FETCH();
 	if( modrm >= 0xc0 ) {
-		XMM((modrm >> 3) & 0x7).f[0] = sse_min_single(XMM((modrm >> 3) & 0x7).f[0], XMM(modrm & 0x7).f[0]);
-		XMM((modrm >> 3) & 0x7).f[1] = sse_min_single(XMM((modrm >> 3) & 0x7).f[1], XMM(modrm & 0x7).f[1]);
-		XMM((modrm >> 3) & 0x7).f[2] = sse_min_single(XMM((modrm >> 3) & 0x7).f[2], XMM(modrm & 0x7).f[2]);
-		XMM((modrm >> 3) & 0x7).f[3] = sse_min_single(XMM((modrm >> 3) & 0x7).f[3], XMM(modrm & 0x7).f[3]);
+		sse_packed_min(XMM((modrm >> 3) & 0x7).f, XMM(modrm & 0x7).f);
 	} else {
 		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		XMM((modrm >> 3) & 0x7).f[0] = sse_min_single(XMM((modrm >> 3) & 0x7).f[0], src.f[0]);
-		XMM((modrm >> 3) & 0x7).f[1] = sse_min_single(XMM((modrm >> 3) & 0x7).f[1], src.f[1]);
-		XMM((modrm >> 3) & 0x7).f[2] = sse_min_single(XMM((modrm >> 3) & 0x7).f[2], src.f[2]);
-		XMM((modrm >> 3) & 0x7).f[3] = sse_min_single(XMM((modrm >> 3) & 0x7).f[3], src.f[3]);
+		sse_packed_min(XMM((modrm >> 3) & 0x7).f, src.f);
 	}
 	CYCLES(1);     // TODO: correct cycle count
 }
@@ -3766,18 +3819,12 @@ void i386_device::sse_divps() // Opcode 0f 5e
 {
 	uint8_t modrm = FETCH();
 	if( modrm >= 0xc0 ) {
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] / XMM(modrm & 0x7).f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] / XMM(modrm & 0x7).f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] / XMM(modrm & 0x7).f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] / XMM(modrm & 0x7).f[3];
+		sse_packed_div(XMM((modrm >> 3) & 0x7).f, XMM(modrm & 0x7).f);
 	} else {
 		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] / src.f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] / src.f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] / src.f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] / src.f[3];
+		sse_packed_div(XMM((modrm >> 3) & 0x7).f, src.f);
 	}
 	CYCLES(1);     // TODO: correct cycle count
 }
@@ -3812,18 +3859,12 @@ void i386_device::sse_maxps() // Opcode 0f 5f
 {
 	uint8_t modrm = FETCH();
 	if( modrm >= 0xc0 ) {
-		XMM((modrm >> 3) & 0x7).f[0] = sse_max_single(XMM((modrm >> 3) & 0x7).f[0], XMM(modrm & 0x7).f[0]);
-		XMM((modrm >> 3) & 0x7).f[1] = sse_max_single(XMM((modrm >> 3) & 0x7).f[1], XMM(modrm & 0x7).f[1]);
-		XMM((modrm >> 3) & 0x7).f[2] = sse_max_single(XMM((modrm >> 3) & 0x7).f[2], XMM(modrm & 0x7).f[2]);
-		XMM((modrm >> 3) & 0x7).f[3] = sse_max_single(XMM((modrm >> 3) & 0x7).f[3], XMM(modrm & 0x7).f[3]);
+		sse_packed_max(XMM((modrm >> 3) & 0x7).f, XMM(modrm & 0x7).f);
 	} else {
 		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		XMM((modrm >> 3) & 0x7).f[0] = sse_max_single(XMM((modrm >> 3) & 0x7).f[0], src.f[0]);
-		XMM((modrm >> 3) & 0x7).f[1] = sse_max_single(XMM((modrm >> 3) & 0x7).f[1], src.f[1]);
-		XMM((modrm >> 3) & 0x7).f[2] = sse_max_single(XMM((modrm >> 3) & 0x7).f[2], src.f[2]);
-		XMM((modrm >> 3) & 0x7).f[3] = sse_max_single(XMM((modrm >> 3) & 0x7).f[3], src.f[3]);
+		sse_packed_max(XMM((modrm >> 3) & 0x7).f, src.f);
 	}
 	CYCLES(1);     // TODO: correct cycle count
 }
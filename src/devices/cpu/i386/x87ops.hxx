@@ -229,10 +229,120 @@ void i386_device::x87_reset()
  *
  *************************************/
 
+/*
+    With -noprecise_fpu, the basic arithmetic runs on host floating point
+    when all exceptions are masked, rounding is to nearest, precision
+    control selects single or double, and the operands are exactly
+    representable at that precision.  Host operations then round the
+    same way as the softfloat path.  The operand exponents are limited so
+    that results and their rounding errors stay clear of overflow and
+    underflow, which lets the error be computed exactly to raise PE.
+*/
+
+enum
+{
+	X87_HOST_ADD,
+	X87_HOST_SUB,
+	X87_HOST_MUL,
+	X87_HOST_DIV,
+	X87_HOST_SQRT
+};
+
+// operand is normal with no mantissa bits below the given precision and
+// an unbiased exponent no larger than the given limit
+static inline bool x87_host_operand(floatx80 value, uint64_t low_mask, int range)
+{
+	int const exp = (value.high & 0x7fff) - 0x3fff;
+	return (exp >= -range) && (exp <= range) && (value.low & 0x8000000000000000U) && !(value.low & low_mask);
+}
+
+// compute on the host and return whether the result is exact
+template <typename T>
+static inline bool x87_host_compute(int op, T a, T b, T &result)
+{
+	switch (op)
+	{
+	case X87_HOST_SUB:
+		b = -b;
+		[[fallthrough]];
+	case X87_HOST_ADD:
+	{
+		result = a + b;
+		T const bv = result - a;
+		return ((a - (result - bv)) + (b - bv)) == T(0);
+	}
+	case X87_HOST_MUL:
+		result = a * b;
+		return std::fma(a, b, -result) == T(0);
+	case X87_HOST_DIV:
+		result = a / b;
+		return std::fma(result, b, -a) == T(0);
+	default:
+		result = std::sqrt(a);
+		return std::fma(result, result, -a) == T(0);
+	}
+}
+
+bool i386_device::x87_host_arith(int op, floatx80 a, floatx80 b, floatx80 &result)
+{
+	if (!m_x87_host || ((m_x87_cw & 0x3f) != 0x3f) || (X87_RC != X87_CW_RC_NEAREST))
+		return false;
+
+	bool exact;
+	switch ((m_x87_cw >> X87_CW_PC_SHIFT) & X87_CW_PC_MASK)
+	{
+	case X87_CW_PC_SINGLE:
+	{
+		if (!x87_host_operand(a, 0x000000ffffffffffU, 39) || !x87_host_operand(b, 0x000000ffffffffffU, 39))
+			return false;
+		float32 const a32 = floatx80_to_float32(a);
+		float32 const b32 = floatx80_to_float32(b);
+		float fa, fb, fresult;
+		memcpy(&fa, &a32, sizeof(fa));
+		memcpy(&fb, &b32, sizeof(fb));
+		exact = x87_host_compute(op, fa, fb, fresult);
+		if (!std::isnormal(fresult))
+			return false;
+		float32 result32;
+		memcpy(&result32, &fresult, sizeof(result32));
+		result = float32_to_floatx80(result32);
+		break;
+	}
+
+	case X87_CW_PC_DOUBLE:
+	{
+		if (!x87_host_operand(a, 0x00000000000007ffU, 458) || !x87_host_operand(b, 0x00000000000007ffU, 458))
+			return false;
+		float64 const a64 = floatx80_to_float64(a);
+		float64 const b64 = floatx80_to_float64(b);
+		double da, db, dresult;
+		memcpy(&da, &a64, sizeof(da));
+		memcpy(&db, &b64, sizeof(db));
+		exact = x87_host_compute(op, da, db, dresult);
+		if (!std::isnormal(dresult))
+			return false;
+		float64 result64;
+		memcpy(&result64, &dresult, sizeof(result64));
+		result = float64_to_floatx80(result64);
+		break;
+	}
+
+	default:
+		return false;
+	}
+
+	if (!exact)
+		float_exception_flags |= float_flag_inexact;
+	return true;
+}
+
 floatx80 i386_device::x87_add(floatx80 a, floatx80 b)
 {
 	floatx80 result = { 0 };
 
+	if (x87_host_arith(X87_HOST_ADD, a, b, result))
+		return result;
+
 	switch ((m_x87_cw >> X87_CW_PC_SHIFT) & X87_CW_PC_MASK)
 	{
 		case X87_CW_PC_SINGLE:
@@ -263,6 +373,9 @@ floatx80 i386_device::x87_sub(floatx80 a, floatx80 b)
 {
 	floatx80 result = { 0 };
 
+	if (x87_host_arith(X87_HOST_SUB, a, b, result))
+		return result;
+
 	switch ((m_x87_cw >> X87_CW_PC_SHIFT) & X87_CW_PC_MASK)
 	{
 		case X87_CW_PC_SINGLE:
@@ -293,6 +406,9 @@ floatx80 i386_device::x87_mul(floatx80 a, floatx80 b)
 {
 	floatx80 val = { 0 };
 
+	if (x87_host_arith(X87_HOST_MUL, a, b, val))
+		return val;
+
 	switch ((m_x87_cw >> X87_CW_PC_SHIFT) & X87_CW_PC_MASK)
 	{
 		case X87_CW_PC_SINGLE:
@@ -324,6 +440,9 @@ floatx80 i386_device::x87_div(floatx80 a, floatx80 b)
 {
 	floatx80 val = { 0 };
 
+	if (x87_host_arith(X87_HOST_DIV, a, b, val))
+		return val;
+
 	switch ((m_x87_cw >> X87_CW_PC_SHIFT) & X87_CW_PC_MASK)
 	{
 		case X87_CW_PC_SINGLE:
@@ -2349,7 +2468,8 @@ void i386_device::x87_fsqrt(uint8_t modrm)
 		}
 		else
 		{
-			result = floatx80_sqrt(value);
+			if (!x87_host_arith(X87_HOST_SQRT, value, value, result))
+				result = floatx80_sqrt(value);
 		}
 	}
 
@@ -308,6 +308,11 @@ u32 m7700_disassembler::opcode_alignment() const
 	return 1;
 }
 
+u64 m7700_disassembler::decode_mode() const
+{
+	return (m_config->get_m_flag() ? 2 : 0) | (m_config->get_x_flag() ? 1 : 0);
+}
+
 offs_t m7700_disassembler::disassemble(std::ostream &stream, offs_t pc, const data_buffer &opcodes, const data_buffer &params)
 {
 	unsigned int instruction;
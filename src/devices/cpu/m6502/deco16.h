@@ -30,7 +30,7 @@ protected:
 	virtual space_config_vector memory_space_config() const override;
 	virtual void device_start() override;
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	O(brk_16_imp);
 	O(ill_non);
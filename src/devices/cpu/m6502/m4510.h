@@ -56,7 +56,7 @@ protected:
 		return adr;
 	}
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	// 4510 opcodes
 	O(eom_imp);
@@ -26,6 +26,11 @@ public:
 
 	auto sync_cb() { return sync_w.bind(); }
 
+	// Run instructions that fit in the remaining timeslice without the
+	// per-cycle suspension checks.  Only for systems where nothing aborts
+	// the timeslice in the middle of an instruction.
+	void set_fast_dispatch(bool fast) { fast_dispatch = fast; }
+
 	devcb_write_line sync_w;
 
 protected:
@@ -123,6 +128,7 @@ protected:
 	int icount, bcount, count_before_instruction_step;
 	bool nmi_state, irq_state, apu_irq_state, v_state;
 	bool nmi_pending, irq_taken, sync, inhibit_interrupts;
+	bool fast_dispatch;
 
 	uint8_t read(uint16_t adr) { return mintf->read(adr); }
 	uint8_t read_9(uint16_t adr) { return mintf->read_9(adr); }
@@ -166,7 +172,7 @@ protected:
 	uint8_t do_rol(uint8_t v);
 	uint8_t do_asr(uint8_t v);
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	// NMOS 6502 opcodes
 	//   documented opcodes
@@ -82,6 +82,20 @@ FULL_NONE="""\
 %(ins)s
 """
 
+FAST_PROLOG="""\
+void %(device)s_device::%(opcode)s_fast()
+{
+"""
+
+FAST_EPILOG="""\
+}
+"""
+
+FAST_MEMORY="""\
+%(ins)s
+\ticount--;
+"""
+
 PARTIAL_PROLOG="""\
 void %(device)s_device::%(opcode)s_partial()
 {
@@ -120,6 +134,21 @@ def identify_line_type(ins):
     return "NONE"
 
 
+def fast_cycles(instructions):
+    """Number of bus cycles of an opcode that can run without timeslice
+    checks, or None when it loops or waits"""
+    cycles = 0
+    for ins in instructions:
+        if "for(" in ins or "while(" in ins:
+            return None
+        line_type = identify_line_type(ins)
+        if line_type == "EAT":
+            return None
+        if line_type == "MEMORY":
+            cycles += 1
+    return cycles
+
+
 def save_opcodes(f, device, opcodes):
     for name, instructions in opcodes:
         d = { "device": device,
@@ -142,6 +171,16 @@ def save_opcodes(f, device, opcodes):
                 emit(f, FULL_NONE %d)
         emit(f, FULL_EPILOG % d)
 
+        if fast_cycles(instructions) is not None:
+            emit(f, FAST_PROLOG % d)
+            for ins in instructions:
+                d["ins"] = ins
+                if identify_line_type(ins) == "MEMORY":
+                    emit(f, FAST_MEMORY % d)
+                else:
+                    emit(f, FULL_NONE % d)
+            emit(f, FAST_EPILOG % d)
+
         emit(f, PARTIAL_PROLOG % d)
         substate = 1
         for ins in instructions:
@@ -189,8 +228,13 @@ DISASM_EPILOG="""\
 };
 """
 
-def save_tables(f, device, states):
+def save_tables(f, device, opcodes, states):
     total_states = len(states)
+    fast = {}
+    for name, instructions in opcodes:
+        cycles = fast_cycles(instructions)
+        if cycles is not None:
+            fast[name] = cycles
 
     d = { "device": device,
           "disasm_count": total_states-1
@@ -199,7 +243,9 @@ def save_tables(f, device, states):
     emit(f, DO_EXEC_FULL_PROLOG % d)
     for n, state in enumerate(states):
         if state == ".": continue
-        if n < total_states - 1:
+        if n < total_states - 1 and state in fast:
+            emit(f, "\tcase 0x%02x: if(fast_dispatch && icount >= %d) %s_fast(); else %s_full(); break;" % (n, fast[state], state, state))
+        elif n < total_states - 1:
             emit(f, "\tcase 0x%02x: %s_full(); break;" % (n, state))
         else:
             emit(f, "\tcase %s: %s_full(); break;" % ("STATE_RESET", state))
@@ -246,7 +292,7 @@ def saves(fname, device, opcodes, states):
         sys.exit(1)
     save_opcodes(f, device, opcodes)
     emit(f, "\n")
-    save_tables(f, device, states)
+    save_tables(f, device, opcodes, states)
     f.close()
 
 
@@ -59,7 +59,7 @@ protected:
 	void init_port();
 	void update_port();
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	// 6510 undocumented instructions in a C64 context
 	// implementation follows what the test suites expect (usually an extra and)
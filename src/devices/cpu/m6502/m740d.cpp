@@ -20,3 +20,8 @@ u32 m740_disassembler::get_instruction_bank() const
 {
 	return conf->get_state_base();
 }
+
+u64 m740_disassembler::decode_mode() const
+{
+	return conf->get_state_base();
+}
@@ -26,6 +26,8 @@ public:
 	m740_disassembler(config *conf);
 	virtual ~m740_disassembler() = default;
 
+	virtual u64 decode_mode() const override;
+
 protected:
 	virtual u32 get_instruction_bank() const override;
 
@@ -43,7 +43,7 @@ private:
 	void do_add(u8 v);
 	u16 do_accumulate(u16 v, u16 w);
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	O(adc_ipx);
 	O(add_imm);
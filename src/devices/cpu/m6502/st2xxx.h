@@ -242,7 +242,7 @@ protected:
 	u8 bdiv_r();
 	void bdiv_w(u8 data);
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	O(brk_st_imp);
 	O(rti_st_imp);
@@ -20,7 +20,7 @@ public:
 	virtual void do_exec_full() override;
 	virtual void do_exec_partial() override;
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	// xaviv opcodes
 	O(callf_xa3);
@@ -78,6 +78,12 @@ static constexpr int CPU_TYPE_040    = (0x00000200);
 static constexpr int CPU_TYPE_SCC070 = (0x00000400);
 static constexpr int CPU_TYPE_FSCPU32  = (0x00000800);
 static constexpr int CPU_TYPE_COLDFIRE = (0x00001000);
+static constexpr int CPU_TYPE_ALL      = (0x00001fff);
+
+/* CPU type sets that opcode handlers are specialised for */
+static constexpr u32 CPU_TYPES_68000 = CPU_TYPE_000 | CPU_TYPE_008 | CPU_TYPE_010 | CPU_TYPE_SCC070;
+static constexpr u32 CPU_TYPES_68020 = CPU_TYPE_EC020 | CPU_TYPE_020 | CPU_TYPE_EC030 | CPU_TYPE_030 | CPU_TYPE_FSCPU32;
+static constexpr u32 CPU_TYPES_68040 = CPU_TYPE_EC040 | CPU_TYPE_LC040 | CPU_TYPE_040 | CPU_TYPE_COLDFIRE;
 
 /* Different ways to stop the CPU */
 static constexpr int STOP_LEVEL_STOP = 1;
@@ -213,6 +219,17 @@ inline u32 &REG_SP()          { return m_dar[15]; }
 /* These defines are dependant on the configuration defines in m68kconf.h */
 
 /* Disable certain comparisons if we're not using all CPU types */
+/* Checks taking a set of CPU types are resolved at compile time when every type in the set agrees */
+template <u32 Types, u32 Mask> inline u32 CPU_TYPE_MATCH() const
+{
+	if constexpr (!(Types & ~Mask))
+		return 1;
+	else if constexpr (!(Types & Mask))
+		return 0;
+	else
+		return m_cpu_type & Mask;
+}
+
 inline u32 CPU_TYPE_IS_COLDFIRE() const    { return ((m_cpu_type) & (CPU_TYPE_COLDFIRE)); }
 
 inline u32 CPU_TYPE_IS_040_PLUS() const    { return ((m_cpu_type) & (CPU_TYPE_040 | CPU_TYPE_EC040)); }
@@ -223,12 +240,12 @@ inline u32 CPU_TYPE_IS_020_PLUS() const    { return ((m_cpu_type) & (CPU_TYPE_02
 
 inline u32 CPU_TYPE_IS_020_VARIANT() const { return ((m_cpu_type) & (CPU_TYPE_EC020 | CPU_TYPE_020 | CPU_TYPE_FSCPU32)); }
 
-inline u32 CPU_TYPE_IS_EC020_PLUS() const  { return ((m_cpu_type) & (CPU_TYPE_EC020 | CPU_TYPE_020 | CPU_TYPE_030 | CPU_TYPE_EC030 | CPU_TYPE_040 | CPU_TYPE_EC040 | CPU_TYPE_FSCPU32 | CPU_TYPE_COLDFIRE)); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 CPU_TYPE_IS_EC020_PLUS() const  { return CPU_TYPE_MATCH<Types, CPU_TYPE_EC020 | CPU_TYPE_020 | CPU_TYPE_030 | CPU_TYPE_EC030 | CPU_TYPE_040 | CPU_TYPE_EC040 | CPU_TYPE_FSCPU32 | CPU_TYPE_COLDFIRE>(); }
 inline u32 CPU_TYPE_IS_EC020_LESS() const  { return ((m_cpu_type) & (CPU_TYPE_000 | CPU_TYPE_008 | CPU_TYPE_010 | CPU_TYPE_EC020)); }
 
 inline u32 CPU_TYPE_IS_010() const         { return ((m_cpu_type) == CPU_TYPE_010); }
 inline u32 CPU_TYPE_IS_010_PLUS() const    { return ((m_cpu_type) & (CPU_TYPE_010 | CPU_TYPE_EC020 | CPU_TYPE_020 | CPU_TYPE_EC030 | CPU_TYPE_030 | CPU_TYPE_040 | CPU_TYPE_EC040 | CPU_TYPE_FSCPU32 | CPU_TYPE_COLDFIRE)); }
-inline u32 CPU_TYPE_IS_010_LESS() const    { return ((m_cpu_type) & (CPU_TYPE_000 | CPU_TYPE_008 | CPU_TYPE_010 | CPU_TYPE_SCC070)); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 CPU_TYPE_IS_010_LESS() const    { return CPU_TYPE_MATCH<Types, CPU_TYPE_000 | CPU_TYPE_008 | CPU_TYPE_010 | CPU_TYPE_SCC070>(); }
 
 inline u32 CPU_TYPE_IS_000() const         { return ((m_cpu_type) == CPU_TYPE_000 || (m_cpu_type) == CPU_TYPE_008); }
 
@@ -272,9 +289,9 @@ inline u32 EA_AY_PD_32()  { return (AY()-=4); }                               /*
 inline u32 EA_AY_DI_8()   { return (AY()+MAKE_INT_16(m68ki_read_imm_16())); } /* displacement */
 inline u32 EA_AY_DI_16()  { return EA_AY_DI_8(); }
 inline u32 EA_AY_DI_32()  { return EA_AY_DI_8(); }
-inline u32 EA_AY_IX_8()   { return m68ki_get_ea_ix(AY()); }                   /* indirect + index */
-inline u32 EA_AY_IX_16()  { return EA_AY_IX_8(); }
-inline u32 EA_AY_IX_32()  { return EA_AY_IX_8(); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 EA_AY_IX_8()   { return m68ki_get_ea_ix<Types>(AY()); }                   /* indirect + index */
+template <u32 Types = CPU_TYPE_ALL> inline u32 EA_AY_IX_16()  { return EA_AY_IX_8<Types>(); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 EA_AY_IX_32()  { return EA_AY_IX_8<Types>(); }
 
 inline u32 EA_AX_AI_8()   { return AX(); }
 inline u32 EA_AX_AI_16()  { return EA_AX_AI_8(); }
@@ -288,9 +305,9 @@ inline u32 EA_AX_PD_32()  { return (AX()-=4); }
 inline u32 EA_AX_DI_8()   { return (AX()+MAKE_INT_16(m68ki_read_imm_16())); }
 inline u32 EA_AX_DI_16()  { return EA_AX_DI_8(); }
 inline u32 EA_AX_DI_32()  { return EA_AX_DI_8(); }
-inline u32 EA_AX_IX_8()   { return m68ki_get_ea_ix(AX()); }
-inline u32 EA_AX_IX_16()  { return EA_AX_IX_8(); }
-inline u32 EA_AX_IX_32()  { return EA_AX_IX_8(); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 EA_AX_IX_8()   { return m68ki_get_ea_ix<Types>(AX()); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 EA_AX_IX_16()  { return EA_AX_IX_8<Types>(); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 EA_AX_IX_32()  { return EA_AX_IX_8<Types>(); }
 
 inline u32 EA_A7_PI_8()   { return ((REG_A()[7]+=2)-2); }
 inline u32 EA_A7_PD_8()   { return (REG_A()[7]-=2); }
@@ -304,9 +321,9 @@ inline u32 EA_AL_32()     { return EA_AL_8(); }
 inline u32 EA_PCDI_8()    { return m68ki_get_ea_pcdi(); }                   /* pc indirect + displacement */
 inline u32 EA_PCDI_16()   { return EA_PCDI_8(); }
 inline u32 EA_PCDI_32()   { return EA_PCDI_8(); }
-inline u32 EA_PCIX_8()    { return m68ki_get_ea_pcix(); }                   /* pc indirect + index */
-inline u32 EA_PCIX_16()   { return EA_PCIX_8(); }
-inline u32 EA_PCIX_32()   { return EA_PCIX_8(); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 EA_PCIX_8()    { return m68ki_get_ea_pcix<Types>(); }                   /* pc indirect + index */
+template <u32 Types = CPU_TYPE_ALL> inline u32 EA_PCIX_16()   { return EA_PCIX_8<Types>(); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 EA_PCIX_32()   { return EA_PCIX_8<Types>(); }
 
 
 inline u32 OPER_I_8() { return m68ki_read_imm_8(); }
@@ -425,14 +442,14 @@ inline u32 m68ki_get_sr() const     { return (m_t1_flag         |
 
 /* Read from the current address space */
 inline u32 m68ki_read_8(u32 address)          { return m68ki_read_8_fc(address, m_s_flag | FUNCTION_CODE_USER_DATA); }
-inline u32 m68ki_read_16(u32 address)         { return m68ki_read_16_fc(address, m_s_flag | FUNCTION_CODE_USER_DATA); }
-inline u32 m68ki_read_32(u32 address)         { return m68ki_read_32_fc(address, m_s_flag | FUNCTION_CODE_USER_DATA); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 m68ki_read_16(u32 address)         { return m68ki_read_16_fc<Types>(address, m_s_flag | FUNCTION_CODE_USER_DATA); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 m68ki_read_32(u32 address)         { return m68ki_read_32_fc<Types>(address, m_s_flag | FUNCTION_CODE_USER_DATA); }
 
 /* Write to the current data space */
 inline void m68ki_write_8(u32 address, u32 value)      { m68ki_write_8_fc(address, m_s_flag | FUNCTION_CODE_USER_DATA, value); }
-inline void m68ki_write_16(u32 address, u32 value)     { m68ki_write_16_fc(address, m_s_flag | FUNCTION_CODE_USER_DATA, value); }
-inline void m68ki_write_32(u32 address, u32 value)     { m68ki_write_32_fc(address, m_s_flag | FUNCTION_CODE_USER_DATA, value); }
-inline void m68ki_write_32_pd(u32 address, u32 value)  { m68ki_write_32_pd_fc(address, m_s_flag | FUNCTION_CODE_USER_DATA, value); }
+template <u32 Types = CPU_TYPE_ALL> inline void m68ki_write_16(u32 address, u32 value)     { m68ki_write_16_fc<Types>(address, m_s_flag | FUNCTION_CODE_USER_DATA, value); }
+template <u32 Types = CPU_TYPE_ALL> inline void m68ki_write_32(u32 address, u32 value)     { m68ki_write_32_fc<Types>(address, m_s_flag | FUNCTION_CODE_USER_DATA, value); }
+template <u32 Types = CPU_TYPE_ALL> inline void m68ki_write_32_pd(u32 address, u32 value)  { m68ki_write_32_pd_fc<Types>(address, m_s_flag | FUNCTION_CODE_USER_DATA, value); }
 
 /* map read immediate 8 to read immediate 16 */
 inline u32 m68ki_read_imm_8()         { return MASK_OUT_ABOVE_8(m68ki_read_imm_16()); }
@@ -444,13 +461,13 @@ inline u32 m68ki_read_pcrel_32(u32 address)   { return m68k_read_pcrelative_32(a
 
 /* Read from the program space */
 inline u32 m68ki_read_program_8(u32 address)  { return m68ki_read_8_fc(address, m_s_flag | FUNCTION_CODE_USER_PROGRAM); }
-inline u32 m68ki_read_program_16(u32 address) { return m68ki_read_16_fc(address, m_s_flag | FUNCTION_CODE_USER_PROGRAM); }
-inline u32 m68ki_read_program_32(u32 address) { return m68ki_read_32_fc(address, m_s_flag | FUNCTION_CODE_USER_PROGRAM); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 m68ki_read_program_16(u32 address) { return m68ki_read_16_fc<Types>(address, m_s_flag | FUNCTION_CODE_USER_PROGRAM); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 m68ki_read_program_32(u32 address) { return m68ki_read_32_fc<Types>(address, m_s_flag | FUNCTION_CODE_USER_PROGRAM); }
 
 /* Read from the data space */
 inline u32 m68ki_read_data_8(u32 address)     { return m68ki_read_8_fc(address, m_s_flag | FUNCTION_CODE_USER_DATA); }
-inline u32 m68ki_read_data_16(u32 address)    { return m68ki_read_16_fc(address, m_s_flag | FUNCTION_CODE_USER_DATA); }
-inline u32 m68ki_read_data_32(u32 address)    { return m68ki_read_32_fc(address, m_s_flag | FUNCTION_CODE_USER_DATA); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 m68ki_read_data_16(u32 address)    { return m68ki_read_16_fc<Types>(address, m_s_flag | FUNCTION_CODE_USER_DATA); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 m68ki_read_data_32(u32 address)    { return m68ki_read_32_fc<Types>(address, m_s_flag | FUNCTION_CODE_USER_DATA); }
 
 
 
@@ -658,9 +675,10 @@ inline u32 m68ki_read_8_fc(u32 address, u32 fc)
 	m_mmu_tmp_sz = M68K_SZ_BYTE;
 	return m_read8(address);
 }
+template <u32 Types = CPU_TYPE_ALL>
 inline u32 m68ki_read_16_fc(u32 address, u32 fc)
 {
-	if (CPU_TYPE_IS_010_LESS())
+	if (CPU_TYPE_IS_010_LESS<Types>())
 	{
 		m68ki_check_address_error(address, MODE_READ, fc);
 	}
@@ -669,9 +687,10 @@ inline u32 m68ki_read_16_fc(u32 address, u32 fc)
 	m_mmu_tmp_sz = M68K_SZ_WORD;
 	return m_read16(address);
 }
+template <u32 Types = CPU_TYPE_ALL>
 inline u32 m68ki_read_32_fc(u32 address, u32 fc)
 {
-	if (CPU_TYPE_IS_010_LESS())
+	if (CPU_TYPE_IS_010_LESS<Types>())
 	{
 		m68ki_check_address_error(address, MODE_READ, fc);
 	}
@@ -688,9 +707,10 @@ inline void m68ki_write_8_fc(u32 address, u32 fc, u32 value)
 	m_mmu_tmp_sz = M68K_SZ_BYTE;
 	m_write8(address, value);
 }
+template <u32 Types = CPU_TYPE_ALL>
 inline void m68ki_write_16_fc(u32 address, u32 fc, u32 value)
 {
-	if (CPU_TYPE_IS_010_LESS())
+	if (CPU_TYPE_IS_010_LESS<Types>())
 	{
 		m68ki_check_address_error(address, MODE_WRITE, fc);
 	}
@@ -699,9 +719,10 @@ inline void m68ki_write_16_fc(u32 address, u32 fc, u32 value)
 	m_mmu_tmp_sz = M68K_SZ_WORD;
 	m_write16(address, value);
 }
+template <u32 Types = CPU_TYPE_ALL>
 inline void m68ki_write_32_fc(u32 address, u32 fc, u32 value)
 {
-	if (CPU_TYPE_IS_010_LESS())
+	if (CPU_TYPE_IS_010_LESS<Types>())
 	{
 		m68ki_check_address_error(address, MODE_WRITE, fc);
 	}
@@ -716,9 +737,10 @@ inline void m68ki_write_32_fc(u32 address, u32 fc, u32 value)
  * A real 68k first writes the high word to [address+2], and then writes the
  * low word to [address].
  */
+template <u32 Types = CPU_TYPE_ALL>
 inline void m68ki_write_32_pd_fc(u32 address, u32 fc, u32 value)
 {
-	if (CPU_TYPE_IS_010_LESS())
+	if (CPU_TYPE_IS_010_LESS<Types>())
 	{
 		m68ki_check_address_error(address, MODE_WRITE, fc);
 	}
@@ -742,9 +764,10 @@ inline u32 m68ki_get_ea_pcdi()
 }
 
 
+template <u32 Types = CPU_TYPE_ALL>
 inline u32 m68ki_get_ea_pcix()
 {
-	return m68ki_get_ea_ix(m_pc);
+	return m68ki_get_ea_ix<Types>(m_pc);
 }
 
 /* Indexed addressing modes are encoded as follows:
@@ -789,6 +812,7 @@ inline u32 m68ki_get_ea_pcix()
  * 1  011  mem indir with long outer
  * 1  100-111  reserved
  */
+template <u32 Types = CPU_TYPE_ALL>
 inline u32 m68ki_get_ea_ix(u32 An)
 {
 	/* An = base register */
@@ -797,7 +821,7 @@ inline u32 m68ki_get_ea_ix(u32 An)
 	u32 bd = 0;                        /* Base Displacement */
 	u32 od = 0;                        /* Outer Displacement */
 
-	if(CPU_TYPE_IS_010_LESS())
+	if(CPU_TYPE_IS_010_LESS<Types>())
 	{
 		/* Calculate index */
 		Xn = REG_DA()[extension>>12];     /* Xn */
@@ -816,7 +840,7 @@ inline u32 m68ki_get_ea_ix(u32 An)
 		if(!BIT_B(extension))           /* W/L */
 			Xn = MAKE_INT_16(Xn);
 		/* Add scale if proper CPU type */
-		if(CPU_TYPE_IS_EC020_PLUS())
+		if(CPU_TYPE_IS_EC020_PLUS<Types>())
 			Xn <<= (extension>>9) & 3;  /* SCALE */
 
 		/* Add base register and displacement and return */
@@ -854,89 +878,93 @@ inline u32 m68ki_get_ea_ix(u32 An)
 
 	/* Postindex */
 	if(BIT_2(extension))                /* I/IS:  0 = preindex, 1 = postindex */
-		return m68ki_read_32(An + bd) + Xn + od;
+		return m68ki_read_32<Types>(An + bd) + Xn + od;
 
 	/* Preindex */
-	return m68ki_read_32(An + bd + Xn) + od;
+	return m68ki_read_32<Types>(An + bd + Xn) + od;
 }
 
 
 /* Fetch operands */
 inline u32 OPER_AY_AI_8()  {u32 ea = EA_AY_AI_8();  return m68ki_read_8(ea); }
-inline u32 OPER_AY_AI_16() {u32 ea = EA_AY_AI_16(); return m68ki_read_16(ea);}
-inline u32 OPER_AY_AI_32() {u32 ea = EA_AY_AI_32(); return m68ki_read_32(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AY_AI_16() {u32 ea = EA_AY_AI_16(); return m68ki_read_16<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AY_AI_32() {u32 ea = EA_AY_AI_32(); return m68ki_read_32<Types>(ea);}
 inline u32 OPER_AY_PI_8()  {u32 ea = EA_AY_PI_8();  return m68ki_read_8(ea); }
-inline u32 OPER_AY_PI_16() {u32 ea = EA_AY_PI_16(); return m68ki_read_16(ea);}
-inline u32 OPER_AY_PI_32() {u32 ea = EA_AY_PI_32(); return m68ki_read_32(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AY_PI_16() {u32 ea = EA_AY_PI_16(); return m68ki_read_16<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AY_PI_32() {u32 ea = EA_AY_PI_32(); return m68ki_read_32<Types>(ea);}
 inline u32 OPER_AY_PD_8()  {u32 ea = EA_AY_PD_8();  return m68ki_read_8(ea); }
-inline u32 OPER_AY_PD_16() {u32 ea = EA_AY_PD_16(); return m68ki_read_16(ea);}
-inline u32 OPER_AY_PD_32() {u32 ea = EA_AY_PD_32(); return m68ki_read_32(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AY_PD_16() {u32 ea = EA_AY_PD_16(); return m68ki_read_16<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AY_PD_32() {u32 ea = EA_AY_PD_32(); return m68ki_read_32<Types>(ea);}
 inline u32 OPER_AY_DI_8()  {u32 ea = EA_AY_DI_8();  return m68ki_read_8(ea); }
-inline u32 OPER_AY_DI_16() {u32 ea = EA_AY_DI_16(); return m68ki_read_16(ea);}
-inline u32 OPER_AY_DI_32() {u32 ea = EA_AY_DI_32(); return m68ki_read_32(ea);}
-inline u32 OPER_AY_IX_8()  {u32 ea = EA_AY_IX_8();  return m68ki_read_8(ea); }
-inline u32 OPER_AY_IX_16() {u32 ea = EA_AY_IX_16(); return m68ki_read_16(ea);}
-inline u32 OPER_AY_IX_32() {u32 ea = EA_AY_IX_32(); return m68ki_read_32(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AY_DI_16() {u32 ea = EA_AY_DI_16(); return m68ki_read_16<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AY_DI_32() {u32 ea = EA_AY_DI_32(); return m68ki_read_32<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AY_IX_8()  {u32 ea = EA_AY_IX_8<Types>();  return m68ki_read_8(ea); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AY_IX_16() {u32 ea = EA_AY_IX_16<Types>(); return m68ki_read_16<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AY_IX_32() {u32 ea = EA_AY_IX_32<Types>(); return m68ki_read_32<Types>(ea);}
 
 inline u32 OPER_AX_AI_8()  {u32 ea = EA_AX_AI_8();  return m68ki_read_8(ea); }
-inline u32 OPER_AX_AI_16() {u32 ea = EA_AX_AI_16(); return m68ki_read_16(ea);}
-inline u32 OPER_AX_AI_32() {u32 ea = EA_AX_AI_32(); return m68ki_read_32(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AX_AI_16() {u32 ea = EA_AX_AI_16(); return m68ki_read_16<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AX_AI_32() {u32 ea = EA_AX_AI_32(); return m68ki_read_32<Types>(ea);}
 inline u32 OPER_AX_PI_8()  {u32 ea = EA_AX_PI_8();  return m68ki_read_8(ea); }
-inline u32 OPER_AX_PI_16() {u32 ea = EA_AX_PI_16(); return m68ki_read_16(ea);}
-inline u32 OPER_AX_PI_32() {u32 ea = EA_AX_PI_32(); return m68ki_read_32(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AX_PI_16() {u32 ea = EA_AX_PI_16(); return m68ki_read_16<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AX_PI_32() {u32 ea = EA_AX_PI_32(); return m68ki_read_32<Types>(ea);}
 inline u32 OPER_AX_PD_8()  {u32 ea = EA_AX_PD_8();  return m68ki_read_8(ea); }
-inline u32 OPER_AX_PD_16() {u32 ea = EA_AX_PD_16(); return m68ki_read_16(ea);}
-inline u32 OPER_AX_PD_32() {u32 ea = EA_AX_PD_32(); return m68ki_read_32(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AX_PD_16() {u32 ea = EA_AX_PD_16(); return m68ki_read_16<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AX_PD_32() {u32 ea = EA_AX_PD_32(); return m68ki_read_32<Types>(ea);}
 inline u32 OPER_AX_DI_8()  {u32 ea = EA_AX_DI_8();  return m68ki_read_8(ea); }
-inline u32 OPER_AX_DI_16() {u32 ea = EA_AX_DI_16(); return m68ki_read_16(ea);}
-inline u32 OPER_AX_DI_32() {u32 ea = EA_AX_DI_32(); return m68ki_read_32(ea);}
-inline u32 OPER_AX_IX_8()  {u32 ea = EA_AX_IX_8();  return m68ki_read_8(ea); }
-inline u32 OPER_AX_IX_16() {u32 ea = EA_AX_IX_16(); return m68ki_read_16(ea);}
-inline u32 OPER_AX_IX_32() {u32 ea = EA_AX_IX_32(); return m68ki_read_32(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AX_DI_16() {u32 ea = EA_AX_DI_16(); return m68ki_read_16<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AX_DI_32() {u32 ea = EA_AX_DI_32(); return m68ki_read_32<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AX_IX_8()  {u32 ea = EA_AX_IX_8<Types>();  return m68ki_read_8(ea); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AX_IX_16() {u32 ea = EA_AX_IX_16<Types>(); return m68ki_read_16<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AX_IX_32() {u32 ea = EA_AX_IX_32<Types>(); return m68ki_read_32<Types>(ea);}
 
 inline u32 OPER_A7_PI_8()  {u32 ea = EA_A7_PI_8();  return m68ki_read_8(ea); }
 inline u32 OPER_A7_PD_8()  {u32 ea = EA_A7_PD_8();  return m68ki_read_8(ea); }
 
 inline u32 OPER_AW_8()     {u32 ea = EA_AW_8();     return m68ki_read_8(ea); }
-inline u32 OPER_AW_16()    {u32 ea = EA_AW_16();    return m68ki_read_16(ea);}
-inline u32 OPER_AW_32()    {u32 ea = EA_AW_32();    return m68ki_read_32(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AW_16()    {u32 ea = EA_AW_16();    return m68ki_read_16<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AW_32()    {u32 ea = EA_AW_32();    return m68ki_read_32<Types>(ea);}
 inline u32 OPER_AL_8()     {u32 ea = EA_AL_8();     return m68ki_read_8(ea); }
-inline u32 OPER_AL_16()    {u32 ea = EA_AL_16();    return m68ki_read_16(ea);}
-inline u32 OPER_AL_32()    {u32 ea = EA_AL_32();    return m68ki_read_32(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AL_16()    {u32 ea = EA_AL_16();    return m68ki_read_16<Types>(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_AL_32()    {u32 ea = EA_AL_32();    return m68ki_read_32<Types>(ea);}
 inline u32 OPER_PCDI_8()   {u32 ea = EA_PCDI_8();   return m68ki_read_pcrel_8(ea); }
 inline u32 OPER_PCDI_16()  {u32 ea = EA_PCDI_16();  return m68ki_read_pcrel_16(ea);}
 inline u32 OPER_PCDI_32()  {u32 ea = EA_PCDI_32();  return m68ki_read_pcrel_32(ea);}
-inline u32 OPER_PCIX_8()   {u32 ea = EA_PCIX_8();   return m68ki_read_pcrel_8(ea); }
-inline u32 OPER_PCIX_16()  {u32 ea = EA_PCIX_16();  return m68ki_read_pcrel_16(ea);}
-inline u32 OPER_PCIX_32()  {u32 ea = EA_PCIX_32();  return m68ki_read_pcrel_32(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_PCIX_8()   {u32 ea = EA_PCIX_8<Types>();   return m68ki_read_pcrel_8(ea); }
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_PCIX_16()  {u32 ea = EA_PCIX_16<Types>();  return m68ki_read_pcrel_16(ea);}
+template <u32 Types = CPU_TYPE_ALL> inline u32 OPER_PCIX_32()  {u32 ea = EA_PCIX_32<Types>();  return m68ki_read_pcrel_32(ea);}
 
 
 
 /* ---------------------------- Stack Functions --------------------------- */
 
 /* Push/pull data from the stack */
+template <u32 Types = CPU_TYPE_ALL>
 inline void m68ki_push_16(u32 value)
 {
 	REG_SP() = MASK_OUT_ABOVE_32(REG_SP() - 2);
-	m68ki_write_16(REG_SP(), value);
+	m68ki_write_16<Types>(REG_SP(), value);
 }
 
+template <u32 Types = CPU_TYPE_ALL>
 inline void m68ki_push_32(u32 value)
 {
 	REG_SP() = MASK_OUT_ABOVE_32(REG_SP() - 4);
-	m68ki_write_32(REG_SP(), value);
+	m68ki_write_32<Types>(REG_SP(), value);
 }
 
+template <u32 Types = CPU_TYPE_ALL>
 inline u32 m68ki_pull_16()
 {
 	REG_SP() = MASK_OUT_ABOVE_32(REG_SP() + 2);
-	return m68ki_read_16(REG_SP()-2);
+	return m68ki_read_16<Types>(REG_SP()-2);
 }
 
+template <u32 Types = CPU_TYPE_ALL>
 inline u32 m68ki_pull_32()
 {
 	REG_SP() = MASK_OUT_ABOVE_32(REG_SP() + 4);
-	return m68ki_read_32(REG_SP()-4);
+	return m68ki_read_32<Types>(REG_SP()-4);
 }
 
 
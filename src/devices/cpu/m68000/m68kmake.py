@@ -7,6 +7,8 @@
 from __future__ import print_function
 import sys
 import copy
+import os
+import re
 
 CPU_000 = 0
 CPU_070 = 1
@@ -20,6 +22,10 @@ CPU_COUNT = 8
 
 cpu_names = '071234fc'
 
+# CPU families that handlers get specialised for, and the matching
+# CPU type set from m68kcpu.h passed as template parameter
+cpu_families = [ ('071', 'CPU_TYPES_68000'), ('23f', 'CPU_TYPES_68020'), ('4c', 'CPU_TYPES_68040') ]
+
 cc_table_up = [ "T", "F", "HI", "LS", "CC", "CS", "NE", "EQ", "VC", "VS", "PL", "MI", "GE", "LT", "GT", "LE" ]
 cc_table_dn = [ "t", "f", "hi", "ls", "cc", "cs", "ne", "eq", "vc", "vs", "pl", "mi", "ge", "lt", "gt", "le" ]
 
@@ -219,6 +225,36 @@ class OpcodeHandler:
             self.body = body
         else:
             self.body = op.body
+        self.types = None
+
+    def specialise(self, templated, handlers):
+        calls = [n for n in templated if re.search(r'\b%s\(' % n, self.body)]
+        if not calls:
+            handlers.append(self)
+            return
+        body = self.body
+        for n in calls:
+            body = re.sub(r'\b%s\(' % n, '%s<Types>(' % n, body)
+        self.body = body
+        for cpus, types in cpu_families:
+            h = copy.copy(self)
+            h.cycles = [self.cycles[i] if cpu_names[i] in cpus else None for i in range(0, CPU_COUNT)]
+            if all(c == None for c in h.cycles):
+                continue
+            h.types = types
+            handlers.append(h)
+
+def templated_names(path):
+    # Helpers in m68kcpu.h taking the CPU type set as template parameter
+    try:
+        f = open(path, 'r')
+    except Exception:
+        err = sys.exc_info()[1]
+        sys.stderr.write('cannot read file %s [%s]\n' % (path, err))
+        sys.exit(1)
+    names = re.findall(r'template <u32 Types = CPU_TYPE_ALL>\s*inline [\w ]+?\b(\w+)\(', f.read())
+    f.close()
+    return names
 
 class Info:
     def __init__(self, path):
@@ -240,15 +276,28 @@ class Info:
                 cur_opcode = Opcode(line)
                 self.opcodes.append(cur_opcode)
 
-        self.opcode_handlers = []
+        handlers = []
         for op in self.opcodes:
-            op.generate(self.opcode_handlers)
+            op.generate(handlers)
+
+        templated = templated_names(os.path.join(os.path.dirname(path), 'm68kcpu.h'))
+        self.opcode_handlers = []
+        for h in handlers:
+            h.specialise(templated, self.opcode_handlers)
+
+    def functions(self):
+        # Specialised handlers share one templated function
+        seen = set()
+        for h in self.opcode_handlers:
+            if h.function_name not in seen:
+                seen.add(h.function_name)
+                yield h
 
     def save_header(self, f):
         f.write("// Generated source, edits will be lost.  Run m68kmake.py instead\n")
         f.write("\n")
-        for h in self.opcode_handlers:
-            f.write('void %s();\n' % h.function_name)
+        for h in self.functions():
+            f.write('%svoid %s();\n' % ('' if h.types == None else 'template <u32 Types> ', h.function_name))
 
     def save_source(self, f):
         f.write("// Generated source, edits will be lost.  Run m68kmake.py instead\n")
@@ -256,8 +305,8 @@ class Info:
         f.write("#include \"emu.h\"\n")
         f.write("#include \"m68000.h\"\n")
         f.write("\n")
-        for h in self.opcode_handlers:
-            f.write('void m68000_base_device::%s()\n{\n%s}\n' % (h.function_name, h.body))
+        for h in self.functions():
+            f.write('%svoid m68000_base_device::%s()\n{\n%s}\n' % ('' if h.types == None else 'template <u32 Types>\n', h.function_name, h.body))
 
         order = list(range(len(self.opcode_handlers)))
         order.sort(key = lambda id: "%02d %04x %04x" % (self.opcode_handlers[id].bits, self.opcode_handlers[id].op_mask, self.opcode_handlers[id].op_value))
@@ -267,7 +316,7 @@ class Info:
         f.write("const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_table[] =\n{\n\n")
         for id in order:
             oh = self.opcode_handlers[id]
-            f.write("\t&m68000_base_device::%s,\n" % oh.function_name)
+            f.write("\t&m68000_base_device::%s%s,\n" % (oh.function_name, '' if oh.types == None else '<%s>' % oh.types))
             if oh.function_name == 'x4afc_illegal_' + cpu_names:
                 illegal_id = nid
             nid += 1
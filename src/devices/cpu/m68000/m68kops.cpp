@@ -282,10 +282,11 @@ void m68000_base_device::xd028_add_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd030_add_b_ix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_IX_8();
+	u32 src = OPER_AY_IX_8<Types>();
 	u32 dst = MASK_OUT_ABOVE_8(*r_dst);
 	u32 res = src + dst;
 
@@ -346,10 +347,11 @@ void m68000_base_device::xd03a_add_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd03b_add_b_pcix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_PCIX_8();
+	u32 src = OPER_PCIX_8<Types>();
 	u32 dst = MASK_OUT_ABOVE_8(*r_dst);
 	u32 res = src + dst;
 
@@ -410,10 +412,11 @@ void m68000_base_device::xd048_add_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd050_add_w_ai_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_AI_16();
+	u32 src = OPER_AY_AI_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = src + dst;
 
@@ -426,10 +429,11 @@ void m68000_base_device::xd050_add_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd058_add_w_pi_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_PI_16();
+	u32 src = OPER_AY_PI_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = src + dst;
 
@@ -442,10 +446,11 @@ void m68000_base_device::xd058_add_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd060_add_w_pd_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_PD_16();
+	u32 src = OPER_AY_PD_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = src + dst;
 
@@ -458,10 +463,11 @@ void m68000_base_device::xd060_add_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd068_add_w_di_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_DI_16();
+	u32 src = OPER_AY_DI_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = src + dst;
 
@@ -474,10 +480,11 @@ void m68000_base_device::xd068_add_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd070_add_w_ix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_IX_16();
+	u32 src = OPER_AY_IX_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = src + dst;
 
@@ -490,10 +497,11 @@ void m68000_base_device::xd070_add_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd078_add_w_aw_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AW_16();
+	u32 src = OPER_AW_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = src + dst;
 
@@ -506,10 +514,11 @@ void m68000_base_device::xd078_add_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd079_add_w_al_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AL_16();
+	u32 src = OPER_AL_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = src + dst;
 
@@ -538,10 +547,11 @@ void m68000_base_device::xd07a_add_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd07b_add_w_pcix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_PCIX_16();
+	u32 src = OPER_PCIX_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = src + dst;
 
@@ -602,10 +612,11 @@ void m68000_base_device::xd088_add_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd090_add_l_ai_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_AI_32();
+	u32 src = OPER_AY_AI_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = src + dst;
 
@@ -618,10 +629,11 @@ void m68000_base_device::xd090_add_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd098_add_l_pi_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_PI_32();
+	u32 src = OPER_AY_PI_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = src + dst;
 
@@ -634,10 +646,11 @@ void m68000_base_device::xd098_add_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0a0_add_l_pd_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_PD_32();
+	u32 src = OPER_AY_PD_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = src + dst;
 
@@ -650,10 +663,11 @@ void m68000_base_device::xd0a0_add_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0a8_add_l_di_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_DI_32();
+	u32 src = OPER_AY_DI_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = src + dst;
 
@@ -666,10 +680,11 @@ void m68000_base_device::xd0a8_add_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0b0_add_l_ix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_IX_32();
+	u32 src = OPER_AY_IX_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = src + dst;
 
@@ -682,10 +697,11 @@ void m68000_base_device::xd0b0_add_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0b8_add_l_aw_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AW_32();
+	u32 src = OPER_AW_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = src + dst;
 
@@ -698,10 +714,11 @@ void m68000_base_device::xd0b8_add_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0b9_add_l_al_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AL_32();
+	u32 src = OPER_AL_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = src + dst;
 
@@ -730,10 +747,11 @@ void m68000_base_device::xd0ba_add_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0bb_add_l_pcix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_PCIX_32();
+	u32 src = OPER_PCIX_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = src + dst;
 
@@ -858,9 +876,10 @@ void m68000_base_device::xd128_add_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd130_add_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 src = MASK_OUT_ABOVE_8(DX());
 	u32 dst = m68ki_read_8(ea);
 	u32 res = src + dst;
@@ -906,11 +925,12 @@ void m68000_base_device::xd139_add_b_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd150_add_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -918,15 +938,16 @@ void m68000_base_device::xd150_add_w_ai_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd158_add_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -934,15 +955,16 @@ void m68000_base_device::xd158_add_w_pi_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd160_add_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -950,15 +972,16 @@ void m68000_base_device::xd160_add_w_pd_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd168_add_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -966,15 +989,16 @@ void m68000_base_device::xd168_add_w_di_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd170_add_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
+	u32 ea = EA_AY_IX_16<Types>();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -982,15 +1006,16 @@ void m68000_base_device::xd170_add_w_ix_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd178_add_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -998,15 +1023,16 @@ void m68000_base_device::xd178_add_w_aw_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd179_add_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -1014,15 +1040,16 @@ void m68000_base_device::xd179_add_w_al_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd190_add_l_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_32();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1030,15 +1057,16 @@ void m68000_base_device::xd190_add_l_ai_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd198_add_l_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_32();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1046,15 +1074,16 @@ void m68000_base_device::xd198_add_l_pi_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1a0_add_l_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_32();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1062,15 +1091,16 @@ void m68000_base_device::xd1a0_add_l_pd_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1a8_add_l_di_071234fc()
 {
 	u32 ea = EA_AY_DI_32();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1078,15 +1108,16 @@ void m68000_base_device::xd1a8_add_l_di_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1b0_add_l_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_32();
+	u32 ea = EA_AY_IX_32<Types>();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1094,15 +1125,16 @@ void m68000_base_device::xd1b0_add_l_ix_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1b8_add_l_aw_071234fc()
 {
 	u32 ea = EA_AW_32();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1110,15 +1142,16 @@ void m68000_base_device::xd1b8_add_l_aw_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1b9_add_l_al_071234fc()
 {
 	u32 ea = EA_AL_32();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1126,7 +1159,7 @@ void m68000_base_device::xd1b9_add_l_al_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
@@ -1146,64 +1179,71 @@ void m68000_base_device::xd0c8_adda_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0d0_adda_w_ai_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AY_AI_16());
+	u32 src = MAKE_INT_16(OPER_AY_AI_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0d8_adda_w_pi_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AY_PI_16());
+	u32 src = MAKE_INT_16(OPER_AY_PI_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0e0_adda_w_pd_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AY_PD_16());
+	u32 src = MAKE_INT_16(OPER_AY_PD_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0e8_adda_w_di_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AY_DI_16());
+	u32 src = MAKE_INT_16(OPER_AY_DI_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0f0_adda_w_ix_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AY_IX_16());
+	u32 src = MAKE_INT_16(OPER_AY_IX_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0f8_adda_w_aw_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AW_16());
+	u32 src = MAKE_INT_16(OPER_AW_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0f9_adda_w_al_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AL_16());
+	u32 src = MAKE_INT_16(OPER_AL_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
@@ -1218,10 +1258,11 @@ void m68000_base_device::xd0fa_adda_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd0fb_adda_w_pcix_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_PCIX_16());
+	u32 src = MAKE_INT_16(OPER_PCIX_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
@@ -1252,64 +1293,71 @@ void m68000_base_device::xd1c8_adda_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1d0_adda_l_ai_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AY_AI_32();
+	u32 src = OPER_AY_AI_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1d8_adda_l_pi_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AY_PI_32();
+	u32 src = OPER_AY_PI_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1e0_adda_l_pd_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AY_PD_32();
+	u32 src = OPER_AY_PD_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1e8_adda_l_di_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AY_DI_32();
+	u32 src = OPER_AY_DI_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1f0_adda_l_ix_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AY_IX_32();
+	u32 src = OPER_AY_IX_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1f8_adda_l_aw_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AW_32();
+	u32 src = OPER_AW_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1f9_adda_l_al_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AL_32();
+	u32 src = OPER_AL_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
@@ -1324,10 +1372,11 @@ void m68000_base_device::xd1fa_adda_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd1fb_adda_l_pcix_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_PCIX_32();
+	u32 src = OPER_PCIX_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
 
@@ -1454,10 +1503,11 @@ void m68000_base_device::x0628_addi_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0630_addi_b_ix_071234fc()
 {
 	u32 src = OPER_I_8();
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 dst = m68ki_read_8(ea);
 	u32 res = src + dst;
 
@@ -1518,11 +1568,12 @@ void m68000_base_device::x0640_addi_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0650_addi_w_ai_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_AI_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -1530,15 +1581,16 @@ void m68000_base_device::x0650_addi_w_ai_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0658_addi_w_pi_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_PI_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -1546,15 +1598,16 @@ void m68000_base_device::x0658_addi_w_pi_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0660_addi_w_pd_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_PD_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -1562,15 +1615,16 @@ void m68000_base_device::x0660_addi_w_pd_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0668_addi_w_di_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_DI_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -1578,15 +1632,16 @@ void m68000_base_device::x0668_addi_w_di_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0670_addi_w_ix_071234fc()
 {
 	u32 src = OPER_I_16();
-	u32 ea = EA_AY_IX_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -1594,15 +1649,16 @@ void m68000_base_device::x0670_addi_w_ix_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0678_addi_w_aw_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AW_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -1610,15 +1666,16 @@ void m68000_base_device::x0678_addi_w_aw_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0679_addi_w_al_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AL_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -1626,7 +1683,7 @@ void m68000_base_device::x0679_addi_w_al_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
@@ -1646,11 +1703,12 @@ void m68000_base_device::x0680_addi_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0690_addi_l_ai_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_AI_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1658,15 +1716,16 @@ void m68000_base_device::x0690_addi_l_ai_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0698_addi_l_pi_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_PI_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1674,15 +1733,16 @@ void m68000_base_device::x0698_addi_l_pi_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x06a0_addi_l_pd_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_PD_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1690,15 +1750,16 @@ void m68000_base_device::x06a0_addi_l_pd_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x06a8_addi_l_di_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_DI_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1706,15 +1767,16 @@ void m68000_base_device::x06a8_addi_l_di_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x06b0_addi_l_ix_071234fc()
 {
 	u32 src = OPER_I_32();
-	u32 ea = EA_AY_IX_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1722,15 +1784,16 @@ void m68000_base_device::x06b0_addi_l_ix_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x06b8_addi_l_aw_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AW_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1738,15 +1801,16 @@ void m68000_base_device::x06b8_addi_l_aw_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x06b9_addi_l_al_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AL_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_32(res);
@@ -1754,7 +1818,7 @@ void m68000_base_device::x06b9_addi_l_al_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
@@ -1870,10 +1934,11 @@ void m68000_base_device::x5028_addq_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5030_addq_b_ix_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 dst = m68ki_read_8(ea);
 	u32 res = src + dst;
 
@@ -1942,11 +2007,12 @@ void m68000_base_device::x5048_addq_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5050_addq_w_ai_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_AI_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -1954,15 +2020,16 @@ void m68000_base_device::x5050_addq_w_ai_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5058_addq_w_pi_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_PI_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -1970,15 +2037,16 @@ void m68000_base_device::x5058_addq_w_pi_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5060_addq_w_pd_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_PD_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -1986,15 +2054,16 @@ void m68000_base_device::x5060_addq_w_pd_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5068_addq_w_di_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_DI_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -2002,15 +2071,16 @@ void m68000_base_device::x5068_addq_w_di_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5070_addq_w_ix_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
-	u32 ea = EA_AY_IX_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -2018,15 +2088,16 @@ void m68000_base_device::x5070_addq_w_ix_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5078_addq_w_aw_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AW_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -2034,15 +2105,16 @@ void m68000_base_device::x5078_addq_w_aw_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5079_addq_w_al_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AL_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst;
 
 	m_n_flag = NFLAG_16(res);
@@ -2050,7 +2122,7 @@ void m68000_base_device::x5079_addq_w_al_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
@@ -2078,11 +2150,12 @@ void m68000_base_device::x5088_addq_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5090_addq_l_ai_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_AI_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 
@@ -2091,15 +2164,16 @@ void m68000_base_device::x5090_addq_l_ai_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5098_addq_l_pi_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_PI_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 
@@ -2108,15 +2182,16 @@ void m68000_base_device::x5098_addq_l_pi_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x50a0_addq_l_pd_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_PD_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 
@@ -2125,15 +2200,16 @@ void m68000_base_device::x50a0_addq_l_pd_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x50a8_addq_l_di_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_DI_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 
@@ -2142,15 +2218,16 @@ void m68000_base_device::x50a8_addq_l_di_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x50b0_addq_l_ix_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
-	u32 ea = EA_AY_IX_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 
@@ -2159,15 +2236,16 @@ void m68000_base_device::x50b0_addq_l_ix_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x50b8_addq_l_aw_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AW_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 
@@ -2176,15 +2254,16 @@ void m68000_base_device::x50b8_addq_l_aw_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x50b9_addq_l_al_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AL_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst;
 
 
@@ -2193,7 +2272,7 @@ void m68000_base_device::x50b9_addq_l_al_071234fc()
 	m_x_flag = m_c_flag = CFLAG_ADD_32(src, dst, res);
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
@@ -2323,11 +2402,12 @@ void m68000_base_device::xd108_addx_b_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd148_addx_w_071234fc()
 {
-	u32 src = OPER_AY_PD_16();
+	u32 src = OPER_AY_PD_16<Types>();
 	u32 ea  = EA_AX_PD_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = src + dst + XFLAG_1();
 
 	m_n_flag = NFLAG_16(res);
@@ -2337,15 +2417,16 @@ void m68000_base_device::xd148_addx_w_071234fc()
 	res = MASK_OUT_ABOVE_16(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xd188_addx_l_071234fc()
 {
-	u32 src = OPER_AY_PD_32();
+	u32 src = OPER_AY_PD_32<Types>();
 	u32 ea  = EA_AX_PD_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = src + dst + XFLAG_1();
 
 	m_n_flag = NFLAG_32(res);
@@ -2355,7 +2436,7 @@ void m68000_base_device::xd188_addx_l_071234fc()
 	res = MASK_OUT_ABOVE_32(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
@@ -2429,9 +2510,10 @@ void m68000_base_device::xc028_and_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc030_and_b_ix_071234fc()
 {
-	m_not_z_flag = MASK_OUT_ABOVE_8(DX() &= (OPER_AY_IX_8() | 0xffffff00));
+	m_not_z_flag = MASK_OUT_ABOVE_8(DX() &= (OPER_AY_IX_8<Types>() | 0xffffff00));
 
 	m_n_flag = NFLAG_8(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2469,9 +2551,10 @@ void m68000_base_device::xc03a_and_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc03b_and_b_pcix_071234fc()
 {
-	m_not_z_flag = MASK_OUT_ABOVE_8(DX() &= (OPER_PCIX_8() | 0xffffff00));
+	m_not_z_flag = MASK_OUT_ABOVE_8(DX() &= (OPER_PCIX_8<Types>() | 0xffffff00));
 
 	m_n_flag = NFLAG_8(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2499,9 +2582,10 @@ void m68000_base_device::xc040_and_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc050_and_w_ai_071234fc()
 {
-	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AY_AI_16() | 0xffff0000));
+	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AY_AI_16<Types>() | 0xffff0000));
 
 	m_n_flag = NFLAG_16(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2509,9 +2593,10 @@ void m68000_base_device::xc050_and_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc058_and_w_pi_071234fc()
 {
-	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AY_PI_16() | 0xffff0000));
+	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AY_PI_16<Types>() | 0xffff0000));
 
 	m_n_flag = NFLAG_16(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2519,9 +2604,10 @@ void m68000_base_device::xc058_and_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc060_and_w_pd_071234fc()
 {
-	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AY_PD_16() | 0xffff0000));
+	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AY_PD_16<Types>() | 0xffff0000));
 
 	m_n_flag = NFLAG_16(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2529,9 +2615,10 @@ void m68000_base_device::xc060_and_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc068_and_w_di_071234fc()
 {
-	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AY_DI_16() | 0xffff0000));
+	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AY_DI_16<Types>() | 0xffff0000));
 
 	m_n_flag = NFLAG_16(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2539,9 +2626,10 @@ void m68000_base_device::xc068_and_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc070_and_w_ix_071234fc()
 {
-	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AY_IX_16() | 0xffff0000));
+	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AY_IX_16<Types>() | 0xffff0000));
 
 	m_n_flag = NFLAG_16(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2549,9 +2637,10 @@ void m68000_base_device::xc070_and_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc078_and_w_aw_071234fc()
 {
-	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AW_16() | 0xffff0000));
+	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AW_16<Types>() | 0xffff0000));
 
 	m_n_flag = NFLAG_16(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2559,9 +2648,10 @@ void m68000_base_device::xc078_and_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc079_and_w_al_071234fc()
 {
-	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AL_16() | 0xffff0000));
+	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_AL_16<Types>() | 0xffff0000));
 
 	m_n_flag = NFLAG_16(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2579,9 +2669,10 @@ void m68000_base_device::xc07a_and_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc07b_and_w_pcix_071234fc()
 {
-	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_PCIX_16() | 0xffff0000));
+	m_not_z_flag = MASK_OUT_ABOVE_16(DX() &= (OPER_PCIX_16<Types>() | 0xffff0000));
 
 	m_n_flag = NFLAG_16(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2609,9 +2700,10 @@ void m68000_base_device::xc080_and_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc090_and_l_ai_071234fc()
 {
-	m_not_z_flag = DX() &= OPER_AY_AI_32();
+	m_not_z_flag = DX() &= OPER_AY_AI_32<Types>();
 
 	m_n_flag = NFLAG_32(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2619,9 +2711,10 @@ void m68000_base_device::xc090_and_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc098_and_l_pi_071234fc()
 {
-	m_not_z_flag = DX() &= OPER_AY_PI_32();
+	m_not_z_flag = DX() &= OPER_AY_PI_32<Types>();
 
 	m_n_flag = NFLAG_32(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2629,9 +2722,10 @@ void m68000_base_device::xc098_and_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0a0_and_l_pd_071234fc()
 {
-	m_not_z_flag = DX() &= OPER_AY_PD_32();
+	m_not_z_flag = DX() &= OPER_AY_PD_32<Types>();
 
 	m_n_flag = NFLAG_32(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2639,9 +2733,10 @@ void m68000_base_device::xc0a0_and_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0a8_and_l_di_071234fc()
 {
-	m_not_z_flag = DX() &= OPER_AY_DI_32();
+	m_not_z_flag = DX() &= OPER_AY_DI_32<Types>();
 
 	m_n_flag = NFLAG_32(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2649,9 +2744,10 @@ void m68000_base_device::xc0a8_and_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0b0_and_l_ix_071234fc()
 {
-	m_not_z_flag = DX() &= OPER_AY_IX_32();
+	m_not_z_flag = DX() &= OPER_AY_IX_32<Types>();
 
 	m_n_flag = NFLAG_32(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2659,9 +2755,10 @@ void m68000_base_device::xc0b0_and_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0b8_and_l_aw_071234fc()
 {
-	m_not_z_flag = DX() &= OPER_AW_32();
+	m_not_z_flag = DX() &= OPER_AW_32<Types>();
 
 	m_n_flag = NFLAG_32(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2669,9 +2766,10 @@ void m68000_base_device::xc0b8_and_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0b9_and_l_al_071234fc()
 {
-	m_not_z_flag = DX() &= OPER_AL_32();
+	m_not_z_flag = DX() &= OPER_AL_32<Types>();
 
 	m_n_flag = NFLAG_32(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2689,9 +2787,10 @@ void m68000_base_device::xc0ba_and_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0bb_and_l_pcix_071234fc()
 {
-	m_not_z_flag = DX() &= OPER_PCIX_32();
+	m_not_z_flag = DX() &= OPER_PCIX_32<Types>();
 
 	m_n_flag = NFLAG_32(m_not_z_flag);
 	m_c_flag = CFLAG_CLEAR;
@@ -2793,9 +2892,10 @@ void m68000_base_device::xc128_and_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc130_and_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 res = DX() & m68ki_read_8(ea);
 
 	m_n_flag = NFLAG_8(res);
@@ -2835,199 +2935,213 @@ void m68000_base_device::xc139_and_b_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc150_and_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 res = DX() & m68ki_read_16(ea);
+	u32 res = DX() & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc158_and_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 res = DX() & m68ki_read_16(ea);
+	u32 res = DX() & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc160_and_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 res = DX() & m68ki_read_16(ea);
+	u32 res = DX() & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc168_and_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 res = DX() & m68ki_read_16(ea);
+	u32 res = DX() & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc170_and_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 res = DX() & m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 res = DX() & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc178_and_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 res = DX() & m68ki_read_16(ea);
+	u32 res = DX() & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc179_and_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 res = DX() & m68ki_read_16(ea);
+	u32 res = DX() & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc190_and_l_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_32();
-	u32 res = DX() & m68ki_read_32(ea);
+	u32 res = DX() & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc198_and_l_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_32();
-	u32 res = DX() & m68ki_read_32(ea);
+	u32 res = DX() & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1a0_and_l_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_32();
-	u32 res = DX() & m68ki_read_32(ea);
+	u32 res = DX() & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1a8_and_l_di_071234fc()
 {
 	u32 ea = EA_AY_DI_32();
-	u32 res = DX() & m68ki_read_32(ea);
+	u32 res = DX() & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1b0_and_l_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_32();
-	u32 res = DX() & m68ki_read_32(ea);
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 res = DX() & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1b8_and_l_aw_071234fc()
 {
 	u32 ea = EA_AW_32();
-	u32 res = DX() & m68ki_read_32(ea);
+	u32 res = DX() & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1b9_and_l_al_071234fc()
 {
 	u32 ea = EA_AL_32();
-	u32 res = DX() & m68ki_read_32(ea);
+	u32 res = DX() & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
@@ -3131,10 +3245,11 @@ void m68000_base_device::x0228_andi_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0230_andi_b_ix_071234fc()
 {
 	u32 src = OPER_I_8();
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 res = src & m68ki_read_8(ea);
 
 	m_n_flag = NFLAG_8(res);
@@ -3186,108 +3301,115 @@ void m68000_base_device::x0240_andi_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0250_andi_w_ai_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_AI_16();
-	u32 res = src & m68ki_read_16(ea);
+	u32 res = src & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0258_andi_w_pi_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_PI_16();
-	u32 res = src & m68ki_read_16(ea);
+	u32 res = src & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0260_andi_w_pd_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_PD_16();
-	u32 res = src & m68ki_read_16(ea);
+	u32 res = src & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0268_andi_w_di_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_DI_16();
-	u32 res = src & m68ki_read_16(ea);
+	u32 res = src & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0270_andi_w_ix_071234fc()
 {
 	u32 src = OPER_I_16();
-	u32 ea = EA_AY_IX_16();
-	u32 res = src & m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 res = src & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0278_andi_w_aw_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AW_16();
-	u32 res = src & m68ki_read_16(ea);
+	u32 res = src & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0279_andi_w_al_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AL_16();
-	u32 res = src & m68ki_read_16(ea);
+	u32 res = src & m68ki_read_16<Types>(ea);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
@@ -3301,108 +3423,115 @@ void m68000_base_device::x0280_andi_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0290_andi_l_ai_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_AI_32();
-	u32 res = src & m68ki_read_32(ea);
+	u32 res = src & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0298_andi_l_pi_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_PI_32();
-	u32 res = src & m68ki_read_32(ea);
+	u32 res = src & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x02a0_andi_l_pd_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_PD_32();
-	u32 res = src & m68ki_read_32(ea);
+	u32 res = src & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x02a8_andi_l_di_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_DI_32();
-	u32 res = src & m68ki_read_32(ea);
+	u32 res = src & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x02b0_andi_l_ix_071234fc()
 {
 	u32 src = OPER_I_32();
-	u32 ea = EA_AY_IX_32();
-	u32 res = src & m68ki_read_32(ea);
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 res = src & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x02b8_andi_l_aw_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AW_32();
-	u32 res = src & m68ki_read_32(ea);
+	u32 res = src & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x02b9_andi_l_al_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AL_32();
-	u32 res = src & m68ki_read_32(ea);
+	u32 res = src & m68ki_read_32<Types>(ea);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
 	m_c_flag = CFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
@@ -3628,16 +3757,17 @@ void m68000_base_device::xe0a0_asr_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe0d0_asr_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
 	if(GET_MSB_16(src))
 		res |= 0x8000;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -3646,16 +3776,17 @@ void m68000_base_device::xe0d0_asr_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe0d8_asr_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
 	if(GET_MSB_16(src))
 		res |= 0x8000;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -3664,16 +3795,17 @@ void m68000_base_device::xe0d8_asr_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe0e0_asr_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
 	if(GET_MSB_16(src))
 		res |= 0x8000;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -3682,16 +3814,17 @@ void m68000_base_device::xe0e0_asr_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe0e8_asr_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
 	if(GET_MSB_16(src))
 		res |= 0x8000;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -3700,16 +3833,17 @@ void m68000_base_device::xe0e8_asr_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe0f0_asr_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 src = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
 	if(GET_MSB_16(src))
 		res |= 0x8000;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -3718,16 +3852,17 @@ void m68000_base_device::xe0f0_asr_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe0f8_asr_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
 	if(GET_MSB_16(src))
 		res |= 0x8000;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -3736,16 +3871,17 @@ void m68000_base_device::xe0f8_asr_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe0f9_asr_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
 	if(GET_MSB_16(src))
 		res |= 0x8000;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -3914,13 +4050,14 @@ void m68000_base_device::xe1a0_asl_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe1d0_asl_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -3930,13 +4067,14 @@ void m68000_base_device::xe1d0_asl_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe1d8_asl_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -3946,13 +4084,14 @@ void m68000_base_device::xe1d8_asl_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe1e0_asl_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -3962,13 +4101,14 @@ void m68000_base_device::xe1e0_asl_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe1e8_asl_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -3978,13 +4118,14 @@ void m68000_base_device::xe1e8_asl_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe1f0_asl_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 src = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -3994,13 +4135,14 @@ void m68000_base_device::xe1f0_asl_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe1f8_asl_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -4010,13 +4152,14 @@ void m68000_base_device::xe1f8_asl_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe1f9_asl_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -4802,9 +4945,10 @@ void m68000_base_device::x0168_bchg_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0170_bchg_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 src = m68ki_read_8(ea);
 	u32 mask = 1 << (DX() & 7);
 
@@ -4911,10 +5055,11 @@ void m68000_base_device::x0868_bchg_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0870_bchg_b_ix_071234fc()
 {
 	u32 mask = 1 << (OPER_I_8() & 7);
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 src = m68ki_read_8(ea);
 
 	m_not_z_flag = src & mask;
@@ -5020,9 +5165,10 @@ void m68000_base_device::x01a8_bclr_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x01b0_bclr_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 src = m68ki_read_8(ea);
 	u32 mask = 1 << (DX() & 7);
 
@@ -5129,10 +5275,11 @@ void m68000_base_device::x08a8_bclr_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x08b0_bclr_b_ix_071234fc()
 {
 	u32 mask = 1 << (OPER_I_8() & 7);
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 src = m68ki_read_8(ea);
 
 	m_not_z_flag = src & mask;
@@ -5191,6 +5338,7 @@ void m68000_base_device::xeac0_bfchg_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xead0_bfchg_l_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5220,13 +5368,13 @@ void m68000_base_device::xead0_bfchg_l_ai_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long ^ mask_long);
+	m68ki_write_32<Types>(ea, data_long ^ mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -5237,6 +5385,7 @@ void m68000_base_device::xead0_bfchg_l_ai_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xeae8_bfchg_l_di_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5266,13 +5415,13 @@ void m68000_base_device::xeae8_bfchg_l_di_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long ^ mask_long);
+	m68ki_write_32<Types>(ea, data_long ^ mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -5283,6 +5432,7 @@ void m68000_base_device::xeae8_bfchg_l_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xeaf0_bfchg_l_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5293,7 +5443,7 @@ void m68000_base_device::xeaf0_bfchg_l_ix_234fc()
 	u32 mask_long;
 	u32 data_byte = 0;
 	u32 mask_byte = 0;
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 
 	if(BIT_B(word2))
 		offset = MAKE_INT_32(REG_D()[offset&7]);
@@ -5312,13 +5462,13 @@ void m68000_base_device::xeaf0_bfchg_l_ix_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long ^ mask_long);
+	m68ki_write_32<Types>(ea, data_long ^ mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -5329,6 +5479,7 @@ void m68000_base_device::xeaf0_bfchg_l_ix_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xeaf8_bfchg_l_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5358,13 +5509,13 @@ void m68000_base_device::xeaf8_bfchg_l_aw_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long ^ mask_long);
+	m68ki_write_32<Types>(ea, data_long ^ mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -5375,6 +5526,7 @@ void m68000_base_device::xeaf8_bfchg_l_aw_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xeaf9_bfchg_l_al_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5404,13 +5556,13 @@ void m68000_base_device::xeaf9_bfchg_l_al_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long ^ mask_long);
+	m68ki_write_32<Types>(ea, data_long ^ mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -5449,6 +5601,7 @@ void m68000_base_device::xecc0_bfclr_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xecd0_bfclr_l_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5478,13 +5631,13 @@ void m68000_base_device::xecd0_bfclr_l_ai_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long & ~mask_long);
+	m68ki_write_32<Types>(ea, data_long & ~mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -5495,6 +5648,7 @@ void m68000_base_device::xecd0_bfclr_l_ai_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xece8_bfclr_l_di_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5524,13 +5678,13 @@ void m68000_base_device::xece8_bfclr_l_di_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long & ~mask_long);
+	m68ki_write_32<Types>(ea, data_long & ~mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -5541,6 +5695,7 @@ void m68000_base_device::xece8_bfclr_l_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xecf0_bfclr_l_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5551,7 +5706,7 @@ void m68000_base_device::xecf0_bfclr_l_ix_234fc()
 	u32 mask_long;
 	u32 data_byte = 0;
 	u32 mask_byte = 0;
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 
 	if(BIT_B(word2))
 		offset = MAKE_INT_32(REG_D()[offset&7]);
@@ -5570,13 +5725,13 @@ void m68000_base_device::xecf0_bfclr_l_ix_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long & ~mask_long);
+	m68ki_write_32<Types>(ea, data_long & ~mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -5587,6 +5742,7 @@ void m68000_base_device::xecf0_bfclr_l_ix_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xecf8_bfclr_l_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5616,13 +5772,13 @@ void m68000_base_device::xecf8_bfclr_l_aw_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long & ~mask_long);
+	m68ki_write_32<Types>(ea, data_long & ~mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -5633,6 +5789,7 @@ void m68000_base_device::xecf8_bfclr_l_aw_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xecf9_bfclr_l_al_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5662,13 +5819,13 @@ void m68000_base_device::xecf9_bfclr_l_al_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long & ~mask_long);
+	m68ki_write_32<Types>(ea, data_long & ~mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -5706,6 +5863,7 @@ void m68000_base_device::xebc0_bfexts_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xebd0_bfexts_l_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5731,7 +5889,7 @@ void m68000_base_device::xebd0_bfexts_l_ai_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
@@ -5749,6 +5907,7 @@ void m68000_base_device::xebd0_bfexts_l_ai_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xebe8_bfexts_l_di_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5774,7 +5933,7 @@ void m68000_base_device::xebe8_bfexts_l_di_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
@@ -5792,13 +5951,14 @@ void m68000_base_device::xebe8_bfexts_l_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xebf0_bfexts_l_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
 	s32 offset = (word2>>6)&31;
 	u32 width = word2;
 	u32 data;
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 
 	if(BIT_B(word2))
 		offset = MAKE_INT_32(REG_D()[offset&7]);
@@ -5817,7 +5977,7 @@ void m68000_base_device::xebf0_bfexts_l_ix_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
@@ -5835,6 +5995,7 @@ void m68000_base_device::xebf0_bfexts_l_ix_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xebf8_bfexts_l_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5860,7 +6021,7 @@ void m68000_base_device::xebf8_bfexts_l_aw_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
@@ -5878,6 +6039,7 @@ void m68000_base_device::xebf8_bfexts_l_aw_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xebf9_bfexts_l_al_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5903,7 +6065,7 @@ void m68000_base_device::xebf9_bfexts_l_al_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
@@ -5921,6 +6083,7 @@ void m68000_base_device::xebf9_bfexts_l_al_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xebfa_bfexts_l_pcdi_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -5946,7 +6109,7 @@ void m68000_base_device::xebfa_bfexts_l_pcdi_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
@@ -5964,13 +6127,14 @@ void m68000_base_device::xebfa_bfexts_l_pcdi_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xebfb_bfexts_l_pcix_234fc()
 {
 	u32 word2 = OPER_I_16();
 	s32 offset = (word2>>6)&31;
 	u32 width = word2;
 	u32 data;
-	u32 ea = EA_PCIX_8();
+	u32 ea = EA_PCIX_8<Types>();
 
 	if(BIT_B(word2))
 		offset = MAKE_INT_32(REG_D()[offset&7]);
@@ -5989,7 +6153,7 @@ void m68000_base_device::xebfb_bfexts_l_pcix_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
@@ -6034,6 +6198,7 @@ void m68000_base_device::xe9c0_bfextu_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe9d0_bfextu_l_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6059,7 +6224,7 @@ void m68000_base_device::xe9d0_bfextu_l_ai_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
 	if((offset+width) > 32)
@@ -6076,6 +6241,7 @@ void m68000_base_device::xe9d0_bfextu_l_ai_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe9e8_bfextu_l_di_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6101,7 +6267,7 @@ void m68000_base_device::xe9e8_bfextu_l_di_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
 	if((offset+width) > 32)
@@ -6118,13 +6284,14 @@ void m68000_base_device::xe9e8_bfextu_l_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe9f0_bfextu_l_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
 	s32 offset = (word2>>6)&31;
 	u32 width = word2;
 	u32 data;
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 
 	if(BIT_B(word2))
 		offset = MAKE_INT_32(REG_D()[offset&7]);
@@ -6143,7 +6310,7 @@ void m68000_base_device::xe9f0_bfextu_l_ix_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
 	if((offset+width) > 32)
@@ -6160,6 +6327,7 @@ void m68000_base_device::xe9f0_bfextu_l_ix_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe9f8_bfextu_l_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6185,7 +6353,7 @@ void m68000_base_device::xe9f8_bfextu_l_aw_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
 	if((offset+width) > 32)
@@ -6202,6 +6370,7 @@ void m68000_base_device::xe9f8_bfextu_l_aw_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe9f9_bfextu_l_al_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6227,7 +6396,7 @@ void m68000_base_device::xe9f9_bfextu_l_al_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
 	if((offset+width) > 32)
@@ -6244,6 +6413,7 @@ void m68000_base_device::xe9f9_bfextu_l_al_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe9fa_bfextu_l_pcdi_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6269,7 +6439,7 @@ void m68000_base_device::xe9fa_bfextu_l_pcdi_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
 	if((offset+width) > 32)
@@ -6286,13 +6456,14 @@ void m68000_base_device::xe9fa_bfextu_l_pcdi_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe9fb_bfextu_l_pcix_234fc()
 {
 	u32 word2 = OPER_I_16();
 	s32 offset = (word2>>6)&31;
 	u32 width = word2;
 	u32 data;
-	u32 ea = EA_PCIX_8();
+	u32 ea = EA_PCIX_8<Types>();
 
 	if(BIT_B(word2))
 		offset = MAKE_INT_32(REG_D()[offset&7]);
@@ -6311,7 +6482,7 @@ void m68000_base_device::xe9fb_bfextu_l_pcix_234fc()
 	width = ((width-1) & 31) + 1;
 
 	data = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<offset);
 
 	if((offset+width) > 32)
@@ -6359,6 +6530,7 @@ void m68000_base_device::xedc0_bfffo_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xedd0_bfffo_l_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6383,7 +6555,7 @@ void m68000_base_device::xedd0_bfffo_l_ai_234fc()
 	}
 	width = ((width-1) & 31) + 1;
 
-	data = (offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+	data = (offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<local_offset);
 
 	if((local_offset+width) > 32)
@@ -6403,6 +6575,7 @@ void m68000_base_device::xedd0_bfffo_l_ai_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xede8_bfffo_l_di_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6427,7 +6600,7 @@ void m68000_base_device::xede8_bfffo_l_di_234fc()
 	}
 	width = ((width-1) & 31) + 1;
 
-	data = (offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+	data = (offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<local_offset);
 
 	if((local_offset+width) > 32)
@@ -6447,6 +6620,7 @@ void m68000_base_device::xede8_bfffo_l_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xedf0_bfffo_l_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6455,7 +6629,7 @@ void m68000_base_device::xedf0_bfffo_l_ix_234fc()
 	u32 width = word2;
 	u32 data;
 	u32 bit;
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 
 	if(BIT_B(word2))
 		offset = MAKE_INT_32(REG_D()[offset&7]);
@@ -6471,7 +6645,7 @@ void m68000_base_device::xedf0_bfffo_l_ix_234fc()
 	}
 	width = ((width-1) & 31) + 1;
 
-	data = (offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+	data = (offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<local_offset);
 
 	if((local_offset+width) > 32)
@@ -6491,6 +6665,7 @@ void m68000_base_device::xedf0_bfffo_l_ix_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xedf8_bfffo_l_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6515,7 +6690,7 @@ void m68000_base_device::xedf8_bfffo_l_aw_234fc()
 	}
 	width = ((width-1) & 31) + 1;
 
-	data = (offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+	data = (offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<local_offset);
 
 	if((local_offset+width) > 32)
@@ -6535,6 +6710,7 @@ void m68000_base_device::xedf8_bfffo_l_aw_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xedf9_bfffo_l_al_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6559,7 +6735,7 @@ void m68000_base_device::xedf9_bfffo_l_al_234fc()
 	}
 	width = ((width-1) & 31) + 1;
 
-	data = (offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+	data = (offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<local_offset);
 
 	if((local_offset+width) > 32)
@@ -6579,6 +6755,7 @@ void m68000_base_device::xedf9_bfffo_l_al_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xedfa_bfffo_l_pcdi_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6603,7 +6780,7 @@ void m68000_base_device::xedfa_bfffo_l_pcdi_234fc()
 	}
 	width = ((width-1) & 31) + 1;
 
-	data = (offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+	data = (offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<local_offset);
 
 	if((local_offset+width) > 32)
@@ -6623,6 +6800,7 @@ void m68000_base_device::xedfa_bfffo_l_pcdi_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xedfb_bfffo_l_pcix_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6631,7 +6809,7 @@ void m68000_base_device::xedfb_bfffo_l_pcix_234fc()
 	u32 width = word2;
 	u32 data;
 	u32 bit;
-	u32 ea = EA_PCIX_8();
+	u32 ea = EA_PCIX_8<Types>();
 
 	if(BIT_B(word2))
 		offset = MAKE_INT_32(REG_D()[offset&7]);
@@ -6647,7 +6825,7 @@ void m68000_base_device::xedfb_bfffo_l_pcix_234fc()
 	}
 	width = ((width-1) & 31) + 1;
 
-	data = (offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+	data = (offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	data = MASK_OUT_ABOVE_32(data<<local_offset);
 
 	if((local_offset+width) > 32)
@@ -6700,6 +6878,7 @@ void m68000_base_device::xefc0_bfins_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xefd0_bfins_l_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6740,16 +6919,16 @@ void m68000_base_device::xefd0_bfins_l_ai_234fc()
 	insert_long = insert_base >> offset;
 
 	data_long = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
 	if((width + offset) < 8) {
 		m68ki_write_8(ea, ((data_long & ~mask_long) | insert_long) >> 24);
 	} else if((width + offset) < 16) {
-		m68ki_write_16(ea, ((data_long & ~mask_long) | insert_long) >> 16);
+		m68ki_write_16<Types>(ea, ((data_long & ~mask_long) | insert_long) >> 16);
 	} else {
-		m68ki_write_32(ea, (data_long & ~mask_long) | insert_long);
+		m68ki_write_32<Types>(ea, (data_long & ~mask_long) | insert_long);
 	}
 
 	if((width + offset) > 32) {
@@ -6762,6 +6941,7 @@ void m68000_base_device::xefd0_bfins_l_ai_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xefe8_bfins_l_di_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6802,16 +6982,16 @@ void m68000_base_device::xefe8_bfins_l_di_234fc()
 	insert_long = insert_base >> offset;
 
 	data_long = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
 	if((width + offset) < 8) {
 		m68ki_write_8(ea, ((data_long & ~mask_long) | insert_long) >> 24);
 	} else if((width + offset) < 16) {
-		m68ki_write_16(ea, ((data_long & ~mask_long) | insert_long) >> 16);
+		m68ki_write_16<Types>(ea, ((data_long & ~mask_long) | insert_long) >> 16);
 	} else {
-		m68ki_write_32(ea, (data_long & ~mask_long) | insert_long);
+		m68ki_write_32<Types>(ea, (data_long & ~mask_long) | insert_long);
 	}
 
 	if((width + offset) > 32) {
@@ -6824,6 +7004,7 @@ void m68000_base_device::xefe8_bfins_l_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xeff0_bfins_l_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6837,7 +7018,7 @@ void m68000_base_device::xeff0_bfins_l_ix_234fc()
 	u32 mask_long;
 	u32 data_byte = 0;
 	u32 mask_byte = 0;
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 
 	if(BIT_B(word2))
 		offset = MAKE_INT_32(REG_D()[offset&7]);
@@ -6864,16 +7045,16 @@ void m68000_base_device::xeff0_bfins_l_ix_234fc()
 	insert_long = insert_base >> offset;
 
 	data_long = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
 	if((width + offset) < 8) {
 		m68ki_write_8(ea, ((data_long & ~mask_long) | insert_long) >> 24);
 	} else if((width + offset) < 16) {
-		m68ki_write_16(ea, ((data_long & ~mask_long) | insert_long) >> 16);
+		m68ki_write_16<Types>(ea, ((data_long & ~mask_long) | insert_long) >> 16);
 	} else {
-		m68ki_write_32(ea, (data_long & ~mask_long) | insert_long);
+		m68ki_write_32<Types>(ea, (data_long & ~mask_long) | insert_long);
 	}
 
 	if((width + offset) > 32) {
@@ -6886,6 +7067,7 @@ void m68000_base_device::xeff0_bfins_l_ix_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xeff8_bfins_l_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6926,16 +7108,16 @@ void m68000_base_device::xeff8_bfins_l_aw_234fc()
 	insert_long = insert_base >> offset;
 
 	data_long = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
 	if((width + offset) < 8) {
 		m68ki_write_8(ea, ((data_long & ~mask_long) | insert_long) >> 24);
 	} else if((width + offset) < 16) {
-		m68ki_write_16(ea, ((data_long & ~mask_long) | insert_long) >> 16);
+		m68ki_write_16<Types>(ea, ((data_long & ~mask_long) | insert_long) >> 16);
 	} else {
-		m68ki_write_32(ea, (data_long & ~mask_long) | insert_long);
+		m68ki_write_32<Types>(ea, (data_long & ~mask_long) | insert_long);
 	}
 
 	if((width + offset) > 32) {
@@ -6948,6 +7130,7 @@ void m68000_base_device::xeff8_bfins_l_aw_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xeff9_bfins_l_al_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -6988,16 +7171,16 @@ void m68000_base_device::xeff9_bfins_l_al_234fc()
 	insert_long = insert_base >> offset;
 
 	data_long = (offset+width) < 8 ? (m68ki_read_8(ea) << 24) :
-			(offset+width) < 16 ? (m68ki_read_16(ea) << 16) : m68ki_read_32(ea);
+			(offset+width) < 16 ? (m68ki_read_16<Types>(ea) << 16) : m68ki_read_32<Types>(ea);
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
 	if((width + offset) < 8) {
 		m68ki_write_8(ea, ((data_long & ~mask_long) | insert_long) >> 24);
 	} else if((width + offset) < 16) {
-		m68ki_write_16(ea, ((data_long & ~mask_long) | insert_long) >> 16);
+		m68ki_write_16<Types>(ea, ((data_long & ~mask_long) | insert_long) >> 16);
 	} else {
-		m68ki_write_32(ea, (data_long & ~mask_long) | insert_long);
+		m68ki_write_32<Types>(ea, (data_long & ~mask_long) | insert_long);
 	}
 
 	if((width + offset) > 32) {
@@ -7038,6 +7221,7 @@ void m68000_base_device::xeec0_bfset_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xeed0_bfset_l_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -7067,13 +7251,13 @@ void m68000_base_device::xeed0_bfset_l_ai_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long | mask_long);
+	m68ki_write_32<Types>(ea, data_long | mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -7084,6 +7268,7 @@ void m68000_base_device::xeed0_bfset_l_ai_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xeee8_bfset_l_di_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -7113,13 +7298,13 @@ void m68000_base_device::xeee8_bfset_l_di_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long | mask_long);
+	m68ki_write_32<Types>(ea, data_long | mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -7130,6 +7315,7 @@ void m68000_base_device::xeee8_bfset_l_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xeef0_bfset_l_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -7140,7 +7326,7 @@ void m68000_base_device::xeef0_bfset_l_ix_234fc()
 	u32 mask_long;
 	u32 data_byte = 0;
 	u32 mask_byte = 0;
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 
 	if(BIT_B(word2))
 		offset = MAKE_INT_32(REG_D()[offset&7]);
@@ -7159,13 +7345,13 @@ void m68000_base_device::xeef0_bfset_l_ix_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long | mask_long);
+	m68ki_write_32<Types>(ea, data_long | mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -7176,6 +7362,7 @@ void m68000_base_device::xeef0_bfset_l_ix_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xeef8_bfset_l_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -7205,13 +7392,13 @@ void m68000_base_device::xeef8_bfset_l_aw_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long | mask_long);
+	m68ki_write_32<Types>(ea, data_long | mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -7222,6 +7409,7 @@ void m68000_base_device::xeef8_bfset_l_aw_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xeef9_bfset_l_al_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -7251,13 +7439,13 @@ void m68000_base_device::xeef9_bfset_l_al_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = NFLAG_32(data_long << offset);
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
 	m_c_flag = CFLAG_CLEAR;
 
-	m68ki_write_32(ea, data_long | mask_long);
+	m68ki_write_32<Types>(ea, data_long | mask_long);
 
 	if((width + offset) > 32) {
 		mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
@@ -7294,6 +7482,7 @@ void m68000_base_device::xe8c0_bftst_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe8d0_bftst_l_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -7323,7 +7512,7 @@ void m68000_base_device::xe8d0_bftst_l_ai_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = ((data_long & (0x80000000 >> offset))<<offset)>>24;
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
@@ -7337,6 +7526,7 @@ void m68000_base_device::xe8d0_bftst_l_ai_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe8e8_bftst_l_di_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -7366,7 +7556,7 @@ void m68000_base_device::xe8e8_bftst_l_di_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = ((data_long & (0x80000000 >> offset))<<offset)>>24;
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
@@ -7380,6 +7570,7 @@ void m68000_base_device::xe8e8_bftst_l_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe8f0_bftst_l_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -7390,7 +7581,7 @@ void m68000_base_device::xe8f0_bftst_l_ix_234fc()
 	u32 mask_long;
 	u32 data_byte = 0;
 	u32 mask_byte = 0;
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 
 	if(BIT_B(word2))
 		offset = MAKE_INT_32(REG_D()[offset&7]);
@@ -7409,7 +7600,7 @@ void m68000_base_device::xe8f0_bftst_l_ix_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = ((data_long & (0x80000000 >> offset))<<offset)>>24;
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
@@ -7423,6 +7614,7 @@ void m68000_base_device::xe8f0_bftst_l_ix_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe8f8_bftst_l_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -7452,7 +7644,7 @@ void m68000_base_device::xe8f8_bftst_l_aw_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = ((data_long & (0x80000000 >> offset))<<offset)>>24;
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
@@ -7466,6 +7658,7 @@ void m68000_base_device::xe8f8_bftst_l_aw_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe8f9_bftst_l_al_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -7495,7 +7688,7 @@ void m68000_base_device::xe8f9_bftst_l_al_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = ((data_long & (0x80000000 >> offset))<<offset)>>24;
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
@@ -7509,6 +7702,7 @@ void m68000_base_device::xe8f9_bftst_l_al_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe8fa_bftst_l_pcdi_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -7538,7 +7732,7 @@ void m68000_base_device::xe8fa_bftst_l_pcdi_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = ((data_long & (0x80000000 >> offset))<<offset)>>24;
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
@@ -7552,6 +7746,7 @@ void m68000_base_device::xe8fa_bftst_l_pcdi_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe8fb_bftst_l_pcix_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -7562,7 +7757,7 @@ void m68000_base_device::xe8fb_bftst_l_pcix_234fc()
 	u32 mask_long;
 	u32 data_byte = 0;
 	u32 mask_byte = 0;
-	u32 ea = EA_PCIX_8();
+	u32 ea = EA_PCIX_8<Types>();
 
 	if(BIT_B(word2))
 		offset = MAKE_INT_32(REG_D()[offset&7]);
@@ -7581,7 +7776,7 @@ void m68000_base_device::xe8fb_bftst_l_pcix_234fc()
 	mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
 	mask_long = mask_base >> offset;
 
-	data_long = m68ki_read_32(ea);
+	data_long = m68ki_read_32<Types>(ea);
 	m_n_flag = ((data_long & (0x80000000 >> offset))<<offset)>>24;
 	m_not_z_flag = data_long & mask_long;
 	m_v_flag = VFLAG_CLEAR;
@@ -7709,9 +7904,10 @@ void m68000_base_device::x01e8_bset_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x01f0_bset_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 src = m68ki_read_8(ea);
 	u32 mask = 1 << (DX() & 7);
 
@@ -7818,10 +8014,11 @@ void m68000_base_device::x08e8_bset_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x08f0_bset_b_ix_071234fc()
 {
 	u32 mask = 1 << (OPER_I_8() & 7);
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 src = m68ki_read_8(ea);
 
 	m_not_z_flag = src & mask;
@@ -7851,29 +8048,32 @@ void m68000_base_device::x08f9_bset_b_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x6100_bsr_b_071234fc()
 {
 	m68ki_trace_t0();                  /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(m_pc);
+	m68ki_push_32<Types>(m_pc);
 	m68ki_branch_8(MASK_OUT_ABOVE_8(m_ir));
 
 
 }
+template <u32 Types>
 void m68000_base_device::x6100_bsr_w_071234fc()
 {
 	u32 offset = OPER_I_16();
 	m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(m_pc);
+	m68ki_push_32<Types>(m_pc);
 	m_pc -= 2;
 	m68ki_branch_16(offset);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x61ff_bsr_l_234fc()
 {
 	u32 offset = OPER_I_32();
 	m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(m_pc);
+	m68ki_push_32<Types>(m_pc);
 	m_pc -= 4;
 	m68ki_branch_32(offset);
 
@@ -7921,9 +8121,10 @@ void m68000_base_device::x0128_btst_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0130_btst_b_ix_071234fc()
 {
-	m_not_z_flag = OPER_AY_IX_8() & (1 << (DX() & 7));
+	m_not_z_flag = OPER_AY_IX_8<Types>() & (1 << (DX() & 7));
 
 
 }
@@ -7945,9 +8146,10 @@ void m68000_base_device::x013a_btst_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x013b_btst_b_pcix_071234fc()
 {
-	m_not_z_flag = OPER_PCIX_8() & (1 << (DX() & 7));
+	m_not_z_flag = OPER_PCIX_8<Types>() & (1 << (DX() & 7));
 
 
 }
@@ -8011,11 +8213,12 @@ void m68000_base_device::x0828_btst_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0830_btst_b_ix_071234fc()
 {
 	u32 bit = OPER_I_8() & 7;
 
-	m_not_z_flag = OPER_AY_IX_8() & (1 << bit);
+	m_not_z_flag = OPER_AY_IX_8<Types>() & (1 << bit);
 
 
 }
@@ -8043,11 +8246,12 @@ void m68000_base_device::x083a_btst_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x083b_btst_b_pcix_071234fc()
 {
 	u32 bit = OPER_I_8() & 7;
 
-	m_not_z_flag = OPER_PCIX_8() & (1 << bit);
+	m_not_z_flag = OPER_PCIX_8<Types>() & (1 << bit);
 
 
 }
@@ -8077,10 +8281,11 @@ void m68000_base_device::x06e8_callm_l_di_2f()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x06f0_callm_l_ix_2f()
 {
 	/* note: watch out for pcrelative modes */
-	u32 ea = EA_AY_IX_32();
+	u32 ea = EA_AY_IX_32<Types>();
 
 	m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 	m_pc += 2;
@@ -8129,10 +8334,11 @@ void m68000_base_device::x06fa_callm_l_pcdi_2f()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x06fb_callm_l_pcix_2f()
 {
 	/* note: watch out for pcrelative modes */
-	u32 ea = EA_PCIX_32();
+	u32 ea = EA_PCIX_32<Types>();
 
 	m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 	m_pc += 2;
@@ -8280,10 +8486,11 @@ void m68000_base_device::x0ae8_cas_b_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0af0_cas_b_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 dest = m68ki_read_8(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - MASK_OUT_ABOVE_8(*compare);
@@ -8349,11 +8556,12 @@ void m68000_base_device::x0af9_cas_b_al_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0cd0_cas_w_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
 	u32 ea = EA_AY_AI_16();
-	u32 dest = m68ki_read_16(ea);
+	u32 dest = m68ki_read_16<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - MASK_OUT_ABOVE_16(*compare);
 
@@ -8367,16 +8575,17 @@ void m68000_base_device::x0cd0_cas_w_ai_234fc()
 		*compare = MASK_OUT_BELOW_16(*compare) | dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
+		m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0cd8_cas_w_pi_234fc()
 {
 	u32 word2 = OPER_I_16();
 	u32 ea = EA_AY_PI_16();
-	u32 dest = m68ki_read_16(ea);
+	u32 dest = m68ki_read_16<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - MASK_OUT_ABOVE_16(*compare);
 
@@ -8390,16 +8599,17 @@ void m68000_base_device::x0cd8_cas_w_pi_234fc()
 		*compare = MASK_OUT_BELOW_16(*compare) | dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
+		m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ce0_cas_w_pd_234fc()
 {
 	u32 word2 = OPER_I_16();
 	u32 ea = EA_AY_PD_16();
-	u32 dest = m68ki_read_16(ea);
+	u32 dest = m68ki_read_16<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - MASK_OUT_ABOVE_16(*compare);
 
@@ -8413,16 +8623,17 @@ void m68000_base_device::x0ce0_cas_w_pd_234fc()
 		*compare = MASK_OUT_BELOW_16(*compare) | dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
+		m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ce8_cas_w_di_234fc()
 {
 	u32 word2 = OPER_I_16();
 	u32 ea = EA_AY_DI_16();
-	u32 dest = m68ki_read_16(ea);
+	u32 dest = m68ki_read_16<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - MASK_OUT_ABOVE_16(*compare);
 
@@ -8436,16 +8647,17 @@ void m68000_base_device::x0ce8_cas_w_di_234fc()
 		*compare = MASK_OUT_BELOW_16(*compare) | dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
+		m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0cf0_cas_w_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u32 ea = EA_AY_IX_16();
-	u32 dest = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 dest = m68ki_read_16<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - MASK_OUT_ABOVE_16(*compare);
 
@@ -8459,16 +8671,17 @@ void m68000_base_device::x0cf0_cas_w_ix_234fc()
 		*compare = MASK_OUT_BELOW_16(*compare) | dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
+		m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0cf8_cas_w_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
 	u32 ea = EA_AW_16();
-	u32 dest = m68ki_read_16(ea);
+	u32 dest = m68ki_read_16<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - MASK_OUT_ABOVE_16(*compare);
 
@@ -8482,16 +8695,17 @@ void m68000_base_device::x0cf8_cas_w_aw_234fc()
 		*compare = MASK_OUT_BELOW_16(*compare) | dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
+		m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0cf9_cas_w_al_234fc()
 {
 	u32 word2 = OPER_I_16();
 	u32 ea = EA_AL_16();
-	u32 dest = m68ki_read_16(ea);
+	u32 dest = m68ki_read_16<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - MASK_OUT_ABOVE_16(*compare);
 
@@ -8505,16 +8719,17 @@ void m68000_base_device::x0cf9_cas_w_al_234fc()
 		*compare = MASK_OUT_BELOW_16(*compare) | dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
+		m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_D()[(word2 >> 6) & 7]));
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ed0_cas_l_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
 	u32 ea = EA_AY_AI_32();
-	u32 dest = m68ki_read_32(ea);
+	u32 dest = m68ki_read_32<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - *compare;
 
@@ -8528,16 +8743,17 @@ void m68000_base_device::x0ed0_cas_l_ai_234fc()
 		*compare = dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_32(ea, REG_D()[(word2 >> 6) & 7]);
+		m68ki_write_32<Types>(ea, REG_D()[(word2 >> 6) & 7]);
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ed8_cas_l_pi_234fc()
 {
 	u32 word2 = OPER_I_16();
 	u32 ea = EA_AY_PI_32();
-	u32 dest = m68ki_read_32(ea);
+	u32 dest = m68ki_read_32<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - *compare;
 
@@ -8551,16 +8767,17 @@ void m68000_base_device::x0ed8_cas_l_pi_234fc()
 		*compare = dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_32(ea, REG_D()[(word2 >> 6) & 7]);
+		m68ki_write_32<Types>(ea, REG_D()[(word2 >> 6) & 7]);
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ee0_cas_l_pd_234fc()
 {
 	u32 word2 = OPER_I_16();
 	u32 ea = EA_AY_PD_32();
-	u32 dest = m68ki_read_32(ea);
+	u32 dest = m68ki_read_32<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - *compare;
 
@@ -8574,16 +8791,17 @@ void m68000_base_device::x0ee0_cas_l_pd_234fc()
 		*compare = dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_32(ea, REG_D()[(word2 >> 6) & 7]);
+		m68ki_write_32<Types>(ea, REG_D()[(word2 >> 6) & 7]);
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ee8_cas_l_di_234fc()
 {
 	u32 word2 = OPER_I_16();
 	u32 ea = EA_AY_DI_32();
-	u32 dest = m68ki_read_32(ea);
+	u32 dest = m68ki_read_32<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - *compare;
 
@@ -8597,16 +8815,17 @@ void m68000_base_device::x0ee8_cas_l_di_234fc()
 		*compare = dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_32(ea, REG_D()[(word2 >> 6) & 7]);
+		m68ki_write_32<Types>(ea, REG_D()[(word2 >> 6) & 7]);
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ef0_cas_l_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u32 ea = EA_AY_IX_32();
-	u32 dest = m68ki_read_32(ea);
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 dest = m68ki_read_32<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - *compare;
 
@@ -8620,16 +8839,17 @@ void m68000_base_device::x0ef0_cas_l_ix_234fc()
 		*compare = dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_32(ea, REG_D()[(word2 >> 6) & 7]);
+		m68ki_write_32<Types>(ea, REG_D()[(word2 >> 6) & 7]);
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ef8_cas_l_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
 	u32 ea = EA_AW_32();
-	u32 dest = m68ki_read_32(ea);
+	u32 dest = m68ki_read_32<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - *compare;
 
@@ -8643,16 +8863,17 @@ void m68000_base_device::x0ef8_cas_l_aw_234fc()
 		*compare = dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_32(ea, REG_D()[(word2 >> 6) & 7]);
+		m68ki_write_32<Types>(ea, REG_D()[(word2 >> 6) & 7]);
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ef9_cas_l_al_234fc()
 {
 	u32 word2 = OPER_I_16();
 	u32 ea = EA_AL_32();
-	u32 dest = m68ki_read_32(ea);
+	u32 dest = m68ki_read_32<Types>(ea);
 	u32* compare = &REG_D()[word2 & 7];
 	u32 res = dest - *compare;
 
@@ -8666,21 +8887,22 @@ void m68000_base_device::x0ef9_cas_l_al_234fc()
 		*compare = dest;
 	else {
 		m_icount -= 3;
-		m68ki_write_32(ea, REG_D()[(word2 >> 6) & 7]);
+		m68ki_write_32<Types>(ea, REG_D()[(word2 >> 6) & 7]);
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0cfc_cas2_w_234fc()
 {
 	u32 word2 = OPER_I_32();
 	u32* compare1 = &REG_D()[(word2 >> 16) & 7];
 	u32 ea1 = REG_DA()[(word2 >> 28) & 15];
-	u32 dest1 = m68ki_read_16(ea1);
+	u32 dest1 = m68ki_read_16<Types>(ea1);
 	u32 res1 = dest1 - MASK_OUT_ABOVE_16(*compare1);
 	u32* compare2 = &REG_D()[word2 & 7];
 	u32 ea2 = REG_DA()[(word2 >> 12) & 15];
-	u32 dest2 = m68ki_read_16(ea2);
+	u32 dest2 = m68ki_read_16<Types>(ea2);
 	u32 res2;
 
 	m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
@@ -8699,8 +8921,8 @@ void m68000_base_device::x0cfc_cas2_w_234fc()
 
 		if(COND_EQ()) {
 			m_icount -= 3;
-			m68ki_write_16(ea1, REG_D()[(word2 >> 22) & 7]);
-			m68ki_write_16(ea2, REG_D()[(word2 >> 6) & 7]);
+			m68ki_write_16<Types>(ea1, REG_D()[(word2 >> 22) & 7]);
+			m68ki_write_16<Types>(ea2, REG_D()[(word2 >> 6) & 7]);
 			goto done;
 		}
 	}
@@ -8710,16 +8932,17 @@ void m68000_base_device::x0cfc_cas2_w_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0efc_cas2_l_234fc()
 {
 	u32 word2 = OPER_I_32();
 	u32* compare1 = &REG_D()[(word2 >> 16) & 7];
 	u32 ea1 = REG_DA()[(word2 >> 28) & 15];
-	u32 dest1 = m68ki_read_32(ea1);
+	u32 dest1 = m68ki_read_32<Types>(ea1);
 	u32 res1 = dest1 - *compare1;
 	u32* compare2 = &REG_D()[word2 & 7];
 	u32 ea2 = REG_DA()[(word2 >> 12) & 15];
-	u32 dest2 = m68ki_read_32(ea2);
+	u32 dest2 = m68ki_read_32<Types>(ea2);
 	u32 res2;
 
 	m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
@@ -8738,8 +8961,8 @@ void m68000_base_device::x0efc_cas2_l_234fc()
 
 		if(COND_EQ()) {
 			m_icount -= 3;
-			m68ki_write_32(ea1, REG_D()[(word2 >> 22) & 7]);
-			m68ki_write_32(ea2, REG_D()[(word2 >> 6) & 7]);
+			m68ki_write_32<Types>(ea1, REG_D()[(word2 >> 22) & 7]);
+			m68ki_write_32<Types>(ea2, REG_D()[(word2 >> 6) & 7]);
 			goto done;
 		}
 	}
@@ -8766,10 +8989,11 @@ void m68000_base_device::x4180_chk_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4190_chk_w_ai_071234fc()
 {
 	s32 src = MAKE_INT_16(DX());
-	s32 bound = MAKE_INT_16(OPER_AY_AI_16());
+	s32 bound = MAKE_INT_16(OPER_AY_AI_16<Types>());
 
 	m_not_z_flag = ZFLAG_16(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -8782,10 +9006,11 @@ void m68000_base_device::x4190_chk_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4198_chk_w_pi_071234fc()
 {
 	s32 src = MAKE_INT_16(DX());
-	s32 bound = MAKE_INT_16(OPER_AY_PI_16());
+	s32 bound = MAKE_INT_16(OPER_AY_PI_16<Types>());
 
 	m_not_z_flag = ZFLAG_16(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -8798,10 +9023,11 @@ void m68000_base_device::x4198_chk_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x41a0_chk_w_pd_071234fc()
 {
 	s32 src = MAKE_INT_16(DX());
-	s32 bound = MAKE_INT_16(OPER_AY_PD_16());
+	s32 bound = MAKE_INT_16(OPER_AY_PD_16<Types>());
 
 	m_not_z_flag = ZFLAG_16(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -8814,10 +9040,11 @@ void m68000_base_device::x41a0_chk_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x41a8_chk_w_di_071234fc()
 {
 	s32 src = MAKE_INT_16(DX());
-	s32 bound = MAKE_INT_16(OPER_AY_DI_16());
+	s32 bound = MAKE_INT_16(OPER_AY_DI_16<Types>());
 
 	m_not_z_flag = ZFLAG_16(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -8830,10 +9057,11 @@ void m68000_base_device::x41a8_chk_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x41b0_chk_w_ix_071234fc()
 {
 	s32 src = MAKE_INT_16(DX());
-	s32 bound = MAKE_INT_16(OPER_AY_IX_16());
+	s32 bound = MAKE_INT_16(OPER_AY_IX_16<Types>());
 
 	m_not_z_flag = ZFLAG_16(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -8846,10 +9074,11 @@ void m68000_base_device::x41b0_chk_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x41b8_chk_w_aw_071234fc()
 {
 	s32 src = MAKE_INT_16(DX());
-	s32 bound = MAKE_INT_16(OPER_AW_16());
+	s32 bound = MAKE_INT_16(OPER_AW_16<Types>());
 
 	m_not_z_flag = ZFLAG_16(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -8862,10 +9091,11 @@ void m68000_base_device::x41b8_chk_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x41b9_chk_w_al_071234fc()
 {
 	s32 src = MAKE_INT_16(DX());
-	s32 bound = MAKE_INT_16(OPER_AL_16());
+	s32 bound = MAKE_INT_16(OPER_AL_16<Types>());
 
 	m_not_z_flag = ZFLAG_16(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -8894,10 +9124,11 @@ void m68000_base_device::x41ba_chk_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x41bb_chk_w_pcix_071234fc()
 {
 	s32 src = MAKE_INT_16(DX());
-	s32 bound = MAKE_INT_16(OPER_PCIX_16());
+	s32 bound = MAKE_INT_16(OPER_PCIX_16<Types>());
 
 	m_not_z_flag = ZFLAG_16(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -8942,10 +9173,11 @@ void m68000_base_device::x4100_chk_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4110_chk_l_ai_234fc()
 {
 	s32 src = MAKE_INT_32(DX());
-	s32 bound = MAKE_INT_32(OPER_AY_AI_32());
+	s32 bound = MAKE_INT_32(OPER_AY_AI_32<Types>());
 
 	m_not_z_flag = ZFLAG_32(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -8958,10 +9190,11 @@ void m68000_base_device::x4110_chk_l_ai_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4118_chk_l_pi_234fc()
 {
 	s32 src = MAKE_INT_32(DX());
-	s32 bound = MAKE_INT_32(OPER_AY_PI_32());
+	s32 bound = MAKE_INT_32(OPER_AY_PI_32<Types>());
 
 	m_not_z_flag = ZFLAG_32(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -8974,10 +9207,11 @@ void m68000_base_device::x4118_chk_l_pi_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4120_chk_l_pd_234fc()
 {
 	s32 src = MAKE_INT_32(DX());
-	s32 bound = MAKE_INT_32(OPER_AY_PD_32());
+	s32 bound = MAKE_INT_32(OPER_AY_PD_32<Types>());
 
 	m_not_z_flag = ZFLAG_32(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -8990,10 +9224,11 @@ void m68000_base_device::x4120_chk_l_pd_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4128_chk_l_di_234fc()
 {
 	s32 src = MAKE_INT_32(DX());
-	s32 bound = MAKE_INT_32(OPER_AY_DI_32());
+	s32 bound = MAKE_INT_32(OPER_AY_DI_32<Types>());
 
 	m_not_z_flag = ZFLAG_32(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -9006,10 +9241,11 @@ void m68000_base_device::x4128_chk_l_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4130_chk_l_ix_234fc()
 {
 	s32 src = MAKE_INT_32(DX());
-	s32 bound = MAKE_INT_32(OPER_AY_IX_32());
+	s32 bound = MAKE_INT_32(OPER_AY_IX_32<Types>());
 
 	m_not_z_flag = ZFLAG_32(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -9022,10 +9258,11 @@ void m68000_base_device::x4130_chk_l_ix_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4138_chk_l_aw_234fc()
 {
 	s32 src = MAKE_INT_32(DX());
-	s32 bound = MAKE_INT_32(OPER_AW_32());
+	s32 bound = MAKE_INT_32(OPER_AW_32<Types>());
 
 	m_not_z_flag = ZFLAG_32(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -9038,10 +9275,11 @@ void m68000_base_device::x4138_chk_l_aw_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4139_chk_l_al_234fc()
 {
 	s32 src = MAKE_INT_32(DX());
-	s32 bound = MAKE_INT_32(OPER_AL_32());
+	s32 bound = MAKE_INT_32(OPER_AL_32<Types>());
 
 	m_not_z_flag = ZFLAG_32(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -9070,10 +9308,11 @@ void m68000_base_device::x413a_chk_l_pcdi_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x413b_chk_l_pcix_234fc()
 {
 	s32 src = MAKE_INT_32(DX());
-	s32 bound = MAKE_INT_32(OPER_PCIX_32());
+	s32 bound = MAKE_INT_32(OPER_PCIX_32<Types>());
 
 	m_not_z_flag = ZFLAG_32(src); /* Undocumented */
 	m_v_flag = VFLAG_CLEAR;   /* Undocumented */
@@ -9130,6 +9369,7 @@ void m68000_base_device::x00fa_chk2cmp2_b_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x00fb_chk2cmp2_b_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -9137,7 +9377,7 @@ void m68000_base_device::x00fb_chk2cmp2_b_234fc()
 	if(!BIT_F(word2))
 		compare &= 0xff;
 
-	u32 ea = EA_PCIX_8();
+	u32 ea = EA_PCIX_8<Types>();
 	s32 lower_bound = m68ki_read_pcrel_8(ea);
 	s32 upper_bound = m68ki_read_pcrel_8(ea + 1);
 
@@ -9214,6 +9454,7 @@ void m68000_base_device::x00e8_chk2cmp2_b_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x00f0_chk2cmp2_b_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -9221,7 +9462,7 @@ void m68000_base_device::x00f0_chk2cmp2_b_ix_234fc()
 	if(!BIT_F(word2))
 		compare &= 0xff;
 
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	s32 lower_bound = m68ki_read_8(ea);
 	s32 upper_bound = m68ki_read_8(ea + 1);
 
@@ -9326,6 +9567,7 @@ void m68000_base_device::x02fa_chk2cmp2_w_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x02fb_chk2cmp2_w_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -9333,7 +9575,7 @@ void m68000_base_device::x02fb_chk2cmp2_w_234fc()
 	if(!BIT_F(word2))
 		compare &= 0xffff;
 
-	u32 ea = EA_PCIX_16();
+	u32 ea = EA_PCIX_16<Types>();
 	s32 lower_bound = m68ki_read_pcrel_16(ea);
 	s32 upper_bound = m68ki_read_pcrel_16(ea + 2);
 
@@ -9354,6 +9596,7 @@ void m68000_base_device::x02fb_chk2cmp2_w_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x02d0_chk2cmp2_w_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -9362,8 +9605,8 @@ void m68000_base_device::x02d0_chk2cmp2_w_ai_234fc()
 		compare &= 0xffff;
 
 	u32 ea = EA_AY_AI_16();
-	s32 lower_bound = m68ki_read_16(ea);
-	s32 upper_bound = m68ki_read_16(ea + 2);
+	s32 lower_bound = m68ki_read_16<Types>(ea);
+	s32 upper_bound = m68ki_read_16<Types>(ea + 2);
 
 	// for signed compare, the arithmetically smaller value is the lower bound
 	if (lower_bound & 0x8000) {
@@ -9382,6 +9625,7 @@ void m68000_base_device::x02d0_chk2cmp2_w_ai_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x02e8_chk2cmp2_w_di_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -9390,8 +9634,8 @@ void m68000_base_device::x02e8_chk2cmp2_w_di_234fc()
 		compare &= 0xffff;
 
 	u32 ea = EA_AY_DI_16();
-	s32 lower_bound = m68ki_read_16(ea);
-	s32 upper_bound = m68ki_read_16(ea + 2);
+	s32 lower_bound = m68ki_read_16<Types>(ea);
+	s32 upper_bound = m68ki_read_16<Types>(ea + 2);
 
 	// for signed compare, the arithmetically smaller value is the lower bound
 	if (lower_bound & 0x8000) {
@@ -9410,6 +9654,7 @@ void m68000_base_device::x02e8_chk2cmp2_w_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x02f0_chk2cmp2_w_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -9417,9 +9662,9 @@ void m68000_base_device::x02f0_chk2cmp2_w_ix_234fc()
 	if(!BIT_F(word2))
 		compare &= 0xffff;
 
-	u32 ea = EA_AY_IX_16();
-	s32 lower_bound = m68ki_read_16(ea);
-	s32 upper_bound = m68ki_read_16(ea + 2);
+	u32 ea = EA_AY_IX_16<Types>();
+	s32 lower_bound = m68ki_read_16<Types>(ea);
+	s32 upper_bound = m68ki_read_16<Types>(ea + 2);
 
 	// for signed compare, the arithmetically smaller value is the lower bound
 	if (lower_bound & 0x8000) {
@@ -9438,6 +9683,7 @@ void m68000_base_device::x02f0_chk2cmp2_w_ix_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x02f8_chk2cmp2_w_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -9446,8 +9692,8 @@ void m68000_base_device::x02f8_chk2cmp2_w_aw_234fc()
 		compare &= 0xffff;
 
 	u32 ea = EA_AW_16();
-	s32 lower_bound = m68ki_read_16(ea);
-	s32 upper_bound = m68ki_read_16(ea + 2);
+	s32 lower_bound = m68ki_read_16<Types>(ea);
+	s32 upper_bound = m68ki_read_16<Types>(ea + 2);
 
 	// for signed compare, the arithmetically smaller value is the lower bound
 	if (lower_bound & 0x8000) {
@@ -9466,6 +9712,7 @@ void m68000_base_device::x02f8_chk2cmp2_w_aw_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x02f9_chk2cmp2_w_al_234fc()
 {
 	u32 word2 = OPER_I_16();
@@ -9474,8 +9721,8 @@ void m68000_base_device::x02f9_chk2cmp2_w_al_234fc()
 		compare &= 0xffff;
 
 	u32 ea = EA_AL_16();
-	s32 lower_bound = m68ki_read_16(ea);
-	s32 upper_bound = m68ki_read_16(ea + 2);
+	s32 lower_bound = m68ki_read_16<Types>(ea);
+	s32 upper_bound = m68ki_read_16<Types>(ea + 2);
 
 	// for signed compare, the arithmetically smaller value is the lower bound
 	if (lower_bound & 0x8000) {
@@ -9517,11 +9764,12 @@ void m68000_base_device::x04fa_chk2cmp2_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x04fb_chk2cmp2_l_234fc()
 {
 	u32 word2 = OPER_I_16();
 	s64 compare = REG_DA()[(word2 >> 12) & 15];
-	u32 ea = EA_PCIX_32();
+	u32 ea = EA_PCIX_32<Types>();
 	s64 lower_bound = m68ki_read_pcrel_32(ea);
 	s64 upper_bound = m68ki_read_pcrel_32(ea + 4);
 
@@ -9540,13 +9788,14 @@ void m68000_base_device::x04fb_chk2cmp2_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x04d0_chk2cmp2_l_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
 	s64 compare = REG_DA()[(word2 >> 12) & 15];
 	u32 ea = EA_AY_AI_32();
-	s64 lower_bound = m68ki_read_32(ea);
-	s64 upper_bound = m68ki_read_32(ea + 4);
+	s64 lower_bound = m68ki_read_32<Types>(ea);
+	s64 upper_bound = m68ki_read_32<Types>(ea + 4);
 
 	// for signed compare, the arithmetically smaller value is the lower bound
 	if (lower_bound & 0x80000000) {
@@ -9563,13 +9812,14 @@ void m68000_base_device::x04d0_chk2cmp2_l_ai_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x04e8_chk2cmp2_l_di_234fc()
 {
 	u32 word2 = OPER_I_16();
 	s64 compare = REG_DA()[(word2 >> 12) & 15];
 	u32 ea = EA_AY_DI_32();
-	s64 lower_bound = m68ki_read_32(ea);
-	s64 upper_bound = m68ki_read_32(ea + 4);
+	s64 lower_bound = m68ki_read_32<Types>(ea);
+	s64 upper_bound = m68ki_read_32<Types>(ea + 4);
 
 	// for signed compare, the arithmetically smaller value is the lower bound
 	if (lower_bound & 0x80000000) {
@@ -9586,13 +9836,14 @@ void m68000_base_device::x04e8_chk2cmp2_l_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x04f0_chk2cmp2_l_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
 	s64 compare = REG_DA()[(word2 >> 12) & 15];
-	u32 ea = EA_AY_IX_32();
-	s64 lower_bound = m68ki_read_32(ea);
-	s64 upper_bound = m68ki_read_32(ea + 4);
+	u32 ea = EA_AY_IX_32<Types>();
+	s64 lower_bound = m68ki_read_32<Types>(ea);
+	s64 upper_bound = m68ki_read_32<Types>(ea + 4);
 
 	// for signed compare, the arithmetically smaller value is the lower bound
 	if (lower_bound & 0x80000000) {
@@ -9609,13 +9860,14 @@ void m68000_base_device::x04f0_chk2cmp2_l_ix_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x04f8_chk2cmp2_l_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
 	s64 compare = REG_DA()[(word2 >> 12) & 15];
 	u32 ea = EA_AW_32();
-	s64 lower_bound = m68ki_read_32(ea);
-	s64 upper_bound = m68ki_read_32(ea + 4);
+	s64 lower_bound = m68ki_read_32<Types>(ea);
+	s64 upper_bound = m68ki_read_32<Types>(ea + 4);
 
 	// for signed compare, the arithmetically smaller value is the lower bound
 	if (lower_bound & 0x80000000) {
@@ -9632,13 +9884,14 @@ void m68000_base_device::x04f8_chk2cmp2_l_aw_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x04f9_chk2cmp2_l_al_234fc()
 {
 	u32 word2 = OPER_I_16();
 	s64 compare = REG_DA()[(word2 >> 12) & 15];
 	u32 ea = EA_AL_32();
-	s64 lower_bound = m68ki_read_32(ea);
-	s64 upper_bound = m68ki_read_32(ea + 4);
+	s64 lower_bound = m68ki_read_32<Types>(ea);
+	s64 upper_bound = m68ki_read_32<Types>(ea + 4);
 
 	// for signed compare, the arithmetically smaller value is the lower bound
 	if (lower_bound & 0x80000000) {
@@ -9750,9 +10003,10 @@ void m68000_base_device::x4228_clr_b_di_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4230_clr_b_ix_0()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 
 	m68ki_read_8(ea);   /* the 68000 does a dummy read, the value is discarded */
 	m68ki_write_8(ea, 0);
@@ -9870,9 +10124,10 @@ void m68000_base_device::x4228_clr_b_di_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4230_clr_b_ix_71234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 
 	m68ki_write_8(ea, 0);
 
@@ -9920,13 +10175,14 @@ void m68000_base_device::x4240_clr_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4250_clr_w_ai_0()
 {
 	u32 ea = EA_AY_AI_16();
 
-	m68ki_read_16(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_read_16<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -9935,13 +10191,14 @@ void m68000_base_device::x4250_clr_w_ai_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4258_clr_w_pi_0()
 {
 	u32 ea = EA_AY_PI_16();
 
-	m68ki_read_16(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_read_16<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -9950,13 +10207,14 @@ void m68000_base_device::x4258_clr_w_pi_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4260_clr_w_pd_0()
 {
 	u32 ea = EA_AY_PD_16();
 
-	m68ki_read_16(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_read_16<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -9965,13 +10223,14 @@ void m68000_base_device::x4260_clr_w_pd_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4268_clr_w_di_0()
 {
 	u32 ea = EA_AY_DI_16();
 
-	m68ki_read_16(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_read_16<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -9980,13 +10239,14 @@ void m68000_base_device::x4268_clr_w_di_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4270_clr_w_ix_0()
 {
-	u32 ea = EA_AY_IX_16();
+	u32 ea = EA_AY_IX_16<Types>();
 
-	m68ki_read_16(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_read_16<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -9995,13 +10255,14 @@ void m68000_base_device::x4270_clr_w_ix_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4278_clr_w_aw_0()
 {
 	u32 ea = EA_AW_16();
 
-	m68ki_read_16(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_read_16<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10010,13 +10271,14 @@ void m68000_base_device::x4278_clr_w_aw_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4279_clr_w_al_0()
 {
 	u32 ea = EA_AL_16();
 
-	m68ki_read_16(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_read_16<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10025,11 +10287,12 @@ void m68000_base_device::x4279_clr_w_al_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4250_clr_w_ai_71234fc()
 {
 	u32 ea = EA_AY_AI_16();
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10038,11 +10301,12 @@ void m68000_base_device::x4250_clr_w_ai_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4258_clr_w_pi_71234fc()
 {
 	u32 ea = EA_AY_PI_16();
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10051,11 +10315,12 @@ void m68000_base_device::x4258_clr_w_pi_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4260_clr_w_pd_71234fc()
 {
 	u32 ea = EA_AY_PD_16();
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10064,11 +10329,12 @@ void m68000_base_device::x4260_clr_w_pd_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4268_clr_w_di_71234fc()
 {
 	u32 ea = EA_AY_DI_16();
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10077,11 +10343,12 @@ void m68000_base_device::x4268_clr_w_di_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4270_clr_w_ix_71234fc()
 {
-	u32 ea = EA_AY_IX_16();
+	u32 ea = EA_AY_IX_16<Types>();
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10090,11 +10357,12 @@ void m68000_base_device::x4270_clr_w_ix_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4278_clr_w_aw_71234fc()
 {
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10103,11 +10371,12 @@ void m68000_base_device::x4278_clr_w_aw_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4279_clr_w_al_71234fc()
 {
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, 0);
+	m68ki_write_16<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10127,12 +10396,13 @@ void m68000_base_device::x4280_clr_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4290_clr_l_ai_0()
 {
 	u32 ea = EA_AY_AI_32();
 
-	m68ki_read_32(ea);  /* the 68000 does a dummy read, the value is discarded */
-	m68ki_write_32(ea, 0);
+	m68ki_read_32<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10141,12 +10411,13 @@ void m68000_base_device::x4290_clr_l_ai_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4298_clr_l_pi_0()
 {
 	u32 ea = EA_AY_PI_32();
 
-	m68ki_read_32(ea);  /* the 68000 does a dummy read, the value is discarded */
-	m68ki_write_32(ea, 0);
+	m68ki_read_32<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10155,12 +10426,13 @@ void m68000_base_device::x4298_clr_l_pi_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42a0_clr_l_pd_0()
 {
 	u32 ea = EA_AY_PD_32();
 
-	m68ki_read_32(ea);  /* the 68000 does a dummy read, the value is discarded */
-	m68ki_write_32(ea, 0);
+	m68ki_read_32<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10169,12 +10441,13 @@ void m68000_base_device::x42a0_clr_l_pd_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42a8_clr_l_di_0()
 {
 	u32 ea = EA_AY_DI_32();
 
-	m68ki_read_32(ea);  /* the 68000 does a dummy read, the value is discarded */
-	m68ki_write_32(ea, 0);
+	m68ki_read_32<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10183,12 +10456,13 @@ void m68000_base_device::x42a8_clr_l_di_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42b0_clr_l_ix_0()
 {
-	u32 ea = EA_AY_IX_32();
+	u32 ea = EA_AY_IX_32<Types>();
 
-	m68ki_read_32(ea);  /* the 68000 does a dummy read, the value is discarded */
-	m68ki_write_32(ea, 0);
+	m68ki_read_32<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10197,12 +10471,13 @@ void m68000_base_device::x42b0_clr_l_ix_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42b8_clr_l_aw_0()
 {
 	u32 ea = EA_AW_32();
 
-	m68ki_read_32(ea);  /* the 68000 does a dummy read, the value is discarded */
-	m68ki_write_32(ea, 0);
+	m68ki_read_32<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10211,12 +10486,13 @@ void m68000_base_device::x42b8_clr_l_aw_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42b9_clr_l_al_0()
 {
 	u32 ea = EA_AL_32();
 
-	m68ki_read_32(ea);  /* the 68000 does a dummy read, the value is discarded */
-	m68ki_write_32(ea, 0);
+	m68ki_read_32<Types>(ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10225,11 +10501,12 @@ void m68000_base_device::x42b9_clr_l_al_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4290_clr_l_ai_71234fc()
 {
 	u32 ea = EA_AY_AI_32();
 
-	m68ki_write_32(ea, 0);
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10238,11 +10515,12 @@ void m68000_base_device::x4290_clr_l_ai_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4298_clr_l_pi_71234fc()
 {
 	u32 ea = EA_AY_PI_32();
 
-	m68ki_write_32(ea, 0);
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10251,11 +10529,12 @@ void m68000_base_device::x4298_clr_l_pi_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42a0_clr_l_pd_71234fc()
 {
 	u32 ea = EA_AY_PD_32();
 
-	m68ki_write_32(ea, 0);
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10264,11 +10543,12 @@ void m68000_base_device::x42a0_clr_l_pd_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42a8_clr_l_di_71234fc()
 {
 	u32 ea = EA_AY_DI_32();
 
-	m68ki_write_32(ea, 0);
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10277,11 +10557,12 @@ void m68000_base_device::x42a8_clr_l_di_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42b0_clr_l_ix_71234fc()
 {
-	u32 ea = EA_AY_IX_32();
+	u32 ea = EA_AY_IX_32<Types>();
 
-	m68ki_write_32(ea, 0);
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10290,11 +10571,12 @@ void m68000_base_device::x42b0_clr_l_ix_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42b8_clr_l_aw_71234fc()
 {
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, 0);
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10303,11 +10585,12 @@ void m68000_base_device::x42b8_clr_l_aw_71234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42b9_clr_l_al_71234fc()
 {
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, 0);
+	m68ki_write_32<Types>(ea, 0);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_v_flag = VFLAG_CLEAR;
@@ -10407,9 +10690,10 @@ void m68000_base_device::xb028_cmp_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb030_cmp_b_ix_071234fc()
 {
-	u32 src = OPER_AY_IX_8();
+	u32 src = OPER_AY_IX_8<Types>();
 	u32 dst = MASK_OUT_ABOVE_8(DX());
 	u32 res = dst - src;
 
@@ -10459,9 +10743,10 @@ void m68000_base_device::xb03a_cmp_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb03b_cmp_b_pcix_071234fc()
 {
-	u32 src = OPER_PCIX_8();
+	u32 src = OPER_PCIX_8<Types>();
 	u32 dst = MASK_OUT_ABOVE_8(DX());
 	u32 res = dst - src;
 
@@ -10511,9 +10796,10 @@ void m68000_base_device::xb048_cmp_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb050_cmp_w_ai_071234fc()
 {
-	u32 src = OPER_AY_AI_16();
+	u32 src = OPER_AY_AI_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(DX());
 	u32 res = dst - src;
 
@@ -10524,9 +10810,10 @@ void m68000_base_device::xb050_cmp_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb058_cmp_w_pi_071234fc()
 {
-	u32 src = OPER_AY_PI_16();
+	u32 src = OPER_AY_PI_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(DX());
 	u32 res = dst - src;
 
@@ -10537,9 +10824,10 @@ void m68000_base_device::xb058_cmp_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb060_cmp_w_pd_071234fc()
 {
-	u32 src = OPER_AY_PD_16();
+	u32 src = OPER_AY_PD_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(DX());
 	u32 res = dst - src;
 
@@ -10550,9 +10838,10 @@ void m68000_base_device::xb060_cmp_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb068_cmp_w_di_071234fc()
 {
-	u32 src = OPER_AY_DI_16();
+	u32 src = OPER_AY_DI_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(DX());
 	u32 res = dst - src;
 
@@ -10563,9 +10852,10 @@ void m68000_base_device::xb068_cmp_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb070_cmp_w_ix_071234fc()
 {
-	u32 src = OPER_AY_IX_16();
+	u32 src = OPER_AY_IX_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(DX());
 	u32 res = dst - src;
 
@@ -10576,9 +10866,10 @@ void m68000_base_device::xb070_cmp_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb078_cmp_w_aw_071234fc()
 {
-	u32 src = OPER_AW_16();
+	u32 src = OPER_AW_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(DX());
 	u32 res = dst - src;
 
@@ -10589,9 +10880,10 @@ void m68000_base_device::xb078_cmp_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb079_cmp_w_al_071234fc()
 {
-	u32 src = OPER_AL_16();
+	u32 src = OPER_AL_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(DX());
 	u32 res = dst - src;
 
@@ -10615,9 +10907,10 @@ void m68000_base_device::xb07a_cmp_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb07b_cmp_w_pcix_071234fc()
 {
-	u32 src = OPER_PCIX_16();
+	u32 src = OPER_PCIX_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(DX());
 	u32 res = dst - src;
 
@@ -10667,9 +10960,10 @@ void m68000_base_device::xb088_cmp_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb090_cmp_l_ai_071234fc()
 {
-	u32 src = OPER_AY_AI_32();
+	u32 src = OPER_AY_AI_32<Types>();
 	u32 dst = DX();
 	u32 res = dst - src;
 
@@ -10680,9 +10974,10 @@ void m68000_base_device::xb090_cmp_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb098_cmp_l_pi_071234fc()
 {
-	u32 src = OPER_AY_PI_32();
+	u32 src = OPER_AY_PI_32<Types>();
 	u32 dst = DX();
 	u32 res = dst - src;
 
@@ -10693,9 +10988,10 @@ void m68000_base_device::xb098_cmp_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0a0_cmp_l_pd_071234fc()
 {
-	u32 src = OPER_AY_PD_32();
+	u32 src = OPER_AY_PD_32<Types>();
 	u32 dst = DX();
 	u32 res = dst - src;
 
@@ -10706,9 +11002,10 @@ void m68000_base_device::xb0a0_cmp_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0a8_cmp_l_di_071234fc()
 {
-	u32 src = OPER_AY_DI_32();
+	u32 src = OPER_AY_DI_32<Types>();
 	u32 dst = DX();
 	u32 res = dst - src;
 
@@ -10719,9 +11016,10 @@ void m68000_base_device::xb0a8_cmp_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0b0_cmp_l_ix_071234fc()
 {
-	u32 src = OPER_AY_IX_32();
+	u32 src = OPER_AY_IX_32<Types>();
 	u32 dst = DX();
 	u32 res = dst - src;
 
@@ -10732,9 +11030,10 @@ void m68000_base_device::xb0b0_cmp_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0b8_cmp_l_aw_071234fc()
 {
-	u32 src = OPER_AW_32();
+	u32 src = OPER_AW_32<Types>();
 	u32 dst = DX();
 	u32 res = dst - src;
 
@@ -10745,9 +11044,10 @@ void m68000_base_device::xb0b8_cmp_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0b9_cmp_l_al_071234fc()
 {
-	u32 src = OPER_AL_32();
+	u32 src = OPER_AL_32<Types>();
 	u32 dst = DX();
 	u32 res = dst - src;
 
@@ -10771,9 +11071,10 @@ void m68000_base_device::xb0ba_cmp_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0bb_cmp_l_pcix_071234fc()
 {
-	u32 src = OPER_PCIX_32();
+	u32 src = OPER_PCIX_32<Types>();
 	u32 dst = DX();
 	u32 res = dst - src;
 
@@ -10823,9 +11124,10 @@ void m68000_base_device::xb0c8_cmpa_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0d0_cmpa_w_ai_071234fc()
 {
-	u32 src = MAKE_INT_16(OPER_AY_AI_16());
+	u32 src = MAKE_INT_16(OPER_AY_AI_16<Types>());
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -10836,9 +11138,10 @@ void m68000_base_device::xb0d0_cmpa_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0d8_cmpa_w_pi_071234fc()
 {
-	u32 src = MAKE_INT_16(OPER_AY_PI_16());
+	u32 src = MAKE_INT_16(OPER_AY_PI_16<Types>());
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -10849,9 +11152,10 @@ void m68000_base_device::xb0d8_cmpa_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0e0_cmpa_w_pd_071234fc()
 {
-	u32 src = MAKE_INT_16(OPER_AY_PD_16());
+	u32 src = MAKE_INT_16(OPER_AY_PD_16<Types>());
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -10862,9 +11166,10 @@ void m68000_base_device::xb0e0_cmpa_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0e8_cmpa_w_di_071234fc()
 {
-	u32 src = MAKE_INT_16(OPER_AY_DI_16());
+	u32 src = MAKE_INT_16(OPER_AY_DI_16<Types>());
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -10875,9 +11180,10 @@ void m68000_base_device::xb0e8_cmpa_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0f0_cmpa_w_ix_071234fc()
 {
-	u32 src = MAKE_INT_16(OPER_AY_IX_16());
+	u32 src = MAKE_INT_16(OPER_AY_IX_16<Types>());
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -10888,9 +11194,10 @@ void m68000_base_device::xb0f0_cmpa_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0f8_cmpa_w_aw_071234fc()
 {
-	u32 src = MAKE_INT_16(OPER_AW_16());
+	u32 src = MAKE_INT_16(OPER_AW_16<Types>());
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -10901,9 +11208,10 @@ void m68000_base_device::xb0f8_cmpa_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0f9_cmpa_w_al_071234fc()
 {
-	u32 src = MAKE_INT_16(OPER_AL_16());
+	u32 src = MAKE_INT_16(OPER_AL_16<Types>());
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -10927,9 +11235,10 @@ void m68000_base_device::xb0fa_cmpa_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb0fb_cmpa_w_pcix_071234fc()
 {
-	u32 src = MAKE_INT_16(OPER_PCIX_16());
+	u32 src = MAKE_INT_16(OPER_PCIX_16<Types>());
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -10979,9 +11288,10 @@ void m68000_base_device::xb1c8_cmpa_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1d0_cmpa_l_ai_071234fc()
 {
-	u32 src = OPER_AY_AI_32();
+	u32 src = OPER_AY_AI_32<Types>();
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -10992,9 +11302,10 @@ void m68000_base_device::xb1d0_cmpa_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1d8_cmpa_l_pi_071234fc()
 {
-	u32 src = OPER_AY_PI_32();
+	u32 src = OPER_AY_PI_32<Types>();
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -11005,9 +11316,10 @@ void m68000_base_device::xb1d8_cmpa_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1e0_cmpa_l_pd_071234fc()
 {
-	u32 src = OPER_AY_PD_32();
+	u32 src = OPER_AY_PD_32<Types>();
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -11018,9 +11330,10 @@ void m68000_base_device::xb1e0_cmpa_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1e8_cmpa_l_di_071234fc()
 {
-	u32 src = OPER_AY_DI_32();
+	u32 src = OPER_AY_DI_32<Types>();
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -11031,9 +11344,10 @@ void m68000_base_device::xb1e8_cmpa_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1f0_cmpa_l_ix_071234fc()
 {
-	u32 src = OPER_AY_IX_32();
+	u32 src = OPER_AY_IX_32<Types>();
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -11044,9 +11358,10 @@ void m68000_base_device::xb1f0_cmpa_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1f8_cmpa_l_aw_071234fc()
 {
-	u32 src = OPER_AW_32();
+	u32 src = OPER_AW_32<Types>();
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -11057,9 +11372,10 @@ void m68000_base_device::xb1f8_cmpa_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1f9_cmpa_l_al_071234fc()
 {
-	u32 src = OPER_AL_32();
+	u32 src = OPER_AL_32<Types>();
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -11083,9 +11399,10 @@ void m68000_base_device::xb1fa_cmpa_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1fb_cmpa_l_pcix_071234fc()
 {
-	u32 src = OPER_PCIX_32();
+	u32 src = OPER_PCIX_32<Types>();
 	u32 dst = AX();
 	u32 res = dst - src;
 
@@ -11200,10 +11517,11 @@ void m68000_base_device::x0c28_cmpi_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0c30_cmpi_b_ix_071234fc()
 {
 	u32 src = OPER_I_8();
-	u32 dst = OPER_AY_IX_8();
+	u32 dst = OPER_AY_IX_8<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_8(res);
@@ -11252,10 +11570,11 @@ void m68000_base_device::x0c3a_cmpi_b_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0c3b_cmpi_b_234fc()
 {
 	u32 src = OPER_I_8();
-	u32 dst = OPER_PCIX_8();
+	u32 dst = OPER_PCIX_8<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_8(res);
@@ -11278,10 +11597,11 @@ void m68000_base_device::x0c40_cmpi_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0c50_cmpi_w_ai_071234fc()
 {
 	u32 src = OPER_I_16();
-	u32 dst = OPER_AY_AI_16();
+	u32 dst = OPER_AY_AI_16<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -11291,10 +11611,11 @@ void m68000_base_device::x0c50_cmpi_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0c58_cmpi_w_pi_071234fc()
 {
 	u32 src = OPER_I_16();
-	u32 dst = OPER_AY_PI_16();
+	u32 dst = OPER_AY_PI_16<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -11304,10 +11625,11 @@ void m68000_base_device::x0c58_cmpi_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0c60_cmpi_w_pd_071234fc()
 {
 	u32 src = OPER_I_16();
-	u32 dst = OPER_AY_PD_16();
+	u32 dst = OPER_AY_PD_16<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -11317,10 +11639,11 @@ void m68000_base_device::x0c60_cmpi_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0c68_cmpi_w_di_071234fc()
 {
 	u32 src = OPER_I_16();
-	u32 dst = OPER_AY_DI_16();
+	u32 dst = OPER_AY_DI_16<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -11330,10 +11653,11 @@ void m68000_base_device::x0c68_cmpi_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0c70_cmpi_w_ix_071234fc()
 {
 	u32 src = OPER_I_16();
-	u32 dst = OPER_AY_IX_16();
+	u32 dst = OPER_AY_IX_16<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -11343,10 +11667,11 @@ void m68000_base_device::x0c70_cmpi_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0c78_cmpi_w_aw_071234fc()
 {
 	u32 src = OPER_I_16();
-	u32 dst = OPER_AW_16();
+	u32 dst = OPER_AW_16<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -11356,10 +11681,11 @@ void m68000_base_device::x0c78_cmpi_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0c79_cmpi_w_al_071234fc()
 {
 	u32 src = OPER_I_16();
-	u32 dst = OPER_AL_16();
+	u32 dst = OPER_AL_16<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -11382,10 +11708,11 @@ void m68000_base_device::x0c7a_cmpi_w_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0c7b_cmpi_w_234fc()
 {
 	u32 src = OPER_I_16();
-	u32 dst = OPER_PCIX_16();
+	u32 dst = OPER_PCIX_16<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -11411,10 +11738,11 @@ void m68000_base_device::x0c80_cmpi_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0c90_cmpi_l_ai_071234fc()
 {
 	u32 src = OPER_I_32();
-	u32 dst = OPER_AY_AI_32();
+	u32 dst = OPER_AY_AI_32<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -11424,10 +11752,11 @@ void m68000_base_device::x0c90_cmpi_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0c98_cmpi_l_pi_071234fc()
 {
 	u32 src = OPER_I_32();
-	u32 dst = OPER_AY_PI_32();
+	u32 dst = OPER_AY_PI_32<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -11437,10 +11766,11 @@ void m68000_base_device::x0c98_cmpi_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ca0_cmpi_l_pd_071234fc()
 {
 	u32 src = OPER_I_32();
-	u32 dst = OPER_AY_PD_32();
+	u32 dst = OPER_AY_PD_32<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -11450,10 +11780,11 @@ void m68000_base_device::x0ca0_cmpi_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ca8_cmpi_l_di_071234fc()
 {
 	u32 src = OPER_I_32();
-	u32 dst = OPER_AY_DI_32();
+	u32 dst = OPER_AY_DI_32<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -11463,10 +11794,11 @@ void m68000_base_device::x0ca8_cmpi_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0cb0_cmpi_l_ix_071234fc()
 {
 	u32 src = OPER_I_32();
-	u32 dst = OPER_AY_IX_32();
+	u32 dst = OPER_AY_IX_32<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -11476,10 +11808,11 @@ void m68000_base_device::x0cb0_cmpi_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0cb8_cmpi_l_aw_071234fc()
 {
 	u32 src = OPER_I_32();
-	u32 dst = OPER_AW_32();
+	u32 dst = OPER_AW_32<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -11489,10 +11822,11 @@ void m68000_base_device::x0cb8_cmpi_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0cb9_cmpi_l_al_071234fc()
 {
 	u32 src = OPER_I_32();
-	u32 dst = OPER_AL_32();
+	u32 dst = OPER_AL_32<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -11515,10 +11849,11 @@ void m68000_base_device::x0cba_cmpi_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0cbb_cmpi_l_234fc()
 {
 	u32 src = OPER_I_32();
-	u32 dst = OPER_PCIX_32();
+	u32 dst = OPER_PCIX_32<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -11580,10 +11915,11 @@ void m68000_base_device::xb108_cmpm_b_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb148_cmpm_w_071234fc()
 {
-	u32 src = OPER_AY_PI_16();
-	u32 dst = OPER_AX_PI_16();
+	u32 src = OPER_AY_PI_16<Types>();
+	u32 dst = OPER_AX_PI_16<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -11593,10 +11929,11 @@ void m68000_base_device::xb148_cmpm_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb188_cmpm_l_071234fc()
 {
-	u32 src = OPER_AY_PI_32();
-	u32 dst = OPER_AX_PI_32();
+	u32 src = OPER_AY_PI_32<Types>();
+	u32 dst = OPER_AX_PI_32<Types>();
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -12034,10 +12371,11 @@ void m68000_base_device::x81c0_divs_w_071234fc()
 	}
 
 }
+template <u32 Types>
 void m68000_base_device::x81d0_divs_w_ai_071234fc()
 {
 	u32* r_dst = &DX();
-	s32 src = MAKE_INT_16(OPER_AY_AI_16());
+	s32 src = MAKE_INT_16(OPER_AY_AI_16<Types>());
 	s32 quotient;
 	s32 remainder;
 
@@ -12066,10 +12404,11 @@ void m68000_base_device::x81d0_divs_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x81d8_divs_w_pi_071234fc()
 {
 	u32* r_dst = &DX();
-	s32 src = MAKE_INT_16(OPER_AY_PI_16());
+	s32 src = MAKE_INT_16(OPER_AY_PI_16<Types>());
 	s32 quotient;
 	s32 remainder;
 
@@ -12098,10 +12437,11 @@ void m68000_base_device::x81d8_divs_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x81e0_divs_w_pd_071234fc()
 {
 	u32* r_dst = &DX();
-	s32 src = MAKE_INT_16(OPER_AY_PD_16());
+	s32 src = MAKE_INT_16(OPER_AY_PD_16<Types>());
 	s32 quotient;
 	s32 remainder;
 
@@ -12130,10 +12470,11 @@ void m68000_base_device::x81e0_divs_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x81e8_divs_w_di_071234fc()
 {
 	u32* r_dst = &DX();
-	s32 src = MAKE_INT_16(OPER_AY_DI_16());
+	s32 src = MAKE_INT_16(OPER_AY_DI_16<Types>());
 	s32 quotient;
 	s32 remainder;
 
@@ -12162,10 +12503,11 @@ void m68000_base_device::x81e8_divs_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x81f0_divs_w_ix_071234fc()
 {
 	u32* r_dst = &DX();
-	s32 src = MAKE_INT_16(OPER_AY_IX_16());
+	s32 src = MAKE_INT_16(OPER_AY_IX_16<Types>());
 	s32 quotient;
 	s32 remainder;
 
@@ -12194,10 +12536,11 @@ void m68000_base_device::x81f0_divs_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x81f8_divs_w_aw_071234fc()
 {
 	u32* r_dst = &DX();
-	s32 src = MAKE_INT_16(OPER_AW_16());
+	s32 src = MAKE_INT_16(OPER_AW_16<Types>());
 	s32 quotient;
 	s32 remainder;
 
@@ -12226,10 +12569,11 @@ void m68000_base_device::x81f8_divs_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x81f9_divs_w_al_071234fc()
 {
 	u32* r_dst = &DX();
-	s32 src = MAKE_INT_16(OPER_AL_16());
+	s32 src = MAKE_INT_16(OPER_AL_16<Types>());
 	s32 quotient;
 	s32 remainder;
 
@@ -12290,10 +12634,11 @@ void m68000_base_device::x81fa_divs_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x81fb_divs_w_pcix_071234fc()
 {
 	u32* r_dst = &DX();
-	s32 src = MAKE_INT_16(OPER_PCIX_16());
+	s32 src = MAKE_INT_16(OPER_PCIX_16<Types>());
 	s32 quotient;
 	s32 remainder;
 
@@ -12377,10 +12722,11 @@ void m68000_base_device::x80c0_divu_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80d0_divu_w_ai_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_AI_16();
+	u32 src = OPER_AY_AI_16<Types>();
 
 	if(src != 0) {
 		m_c_flag = CFLAG_CLEAR;
@@ -12400,10 +12746,11 @@ void m68000_base_device::x80d0_divu_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80d8_divu_w_pi_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_PI_16();
+	u32 src = OPER_AY_PI_16<Types>();
 
 	if(src != 0) {
 		m_c_flag = CFLAG_CLEAR;
@@ -12423,10 +12770,11 @@ void m68000_base_device::x80d8_divu_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80e0_divu_w_pd_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_PD_16();
+	u32 src = OPER_AY_PD_16<Types>();
 
 	if(src != 0) {
 		m_c_flag = CFLAG_CLEAR;
@@ -12446,10 +12794,11 @@ void m68000_base_device::x80e0_divu_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80e8_divu_w_di_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_DI_16();
+	u32 src = OPER_AY_DI_16<Types>();
 
 	if(src != 0) {
 		m_c_flag = CFLAG_CLEAR;
@@ -12469,10 +12818,11 @@ void m68000_base_device::x80e8_divu_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80f0_divu_w_ix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_IX_16();
+	u32 src = OPER_AY_IX_16<Types>();
 
 	if(src != 0) {
 		m_c_flag = CFLAG_CLEAR;
@@ -12492,10 +12842,11 @@ void m68000_base_device::x80f0_divu_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80f8_divu_w_aw_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AW_16();
+	u32 src = OPER_AW_16<Types>();
 
 	if(src != 0) {
 		m_c_flag = CFLAG_CLEAR;
@@ -12515,10 +12866,11 @@ void m68000_base_device::x80f8_divu_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80f9_divu_w_al_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AL_16();
+	u32 src = OPER_AL_16<Types>();
 
 	if(src != 0) {
 		m_c_flag = CFLAG_CLEAR;
@@ -12561,10 +12913,11 @@ void m68000_base_device::x80fa_divu_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80fb_divu_w_pcix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_PCIX_16();
+	u32 src = OPER_PCIX_16<Types>();
 
 	if(src != 0) {
 		m_c_flag = CFLAG_CLEAR;
@@ -12661,10 +13014,11 @@ void m68000_base_device::x4c40_divl_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4c50_divl_l_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 divisor = OPER_AY_AI_32();
+	u64 divisor = OPER_AY_AI_32<Types>();
 	u64 dividend  = 0;
 	u64 quotient  = 0;
 	u64 remainder = 0;
@@ -12714,10 +13068,11 @@ void m68000_base_device::x4c50_divl_l_ai_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4c58_divl_l_pi_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 divisor = OPER_AY_PI_32();
+	u64 divisor = OPER_AY_PI_32<Types>();
 	u64 dividend  = 0;
 	u64 quotient  = 0;
 	u64 remainder = 0;
@@ -12767,10 +13122,11 @@ void m68000_base_device::x4c58_divl_l_pi_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4c60_divl_l_pd_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 divisor = OPER_AY_PD_32();
+	u64 divisor = OPER_AY_PD_32<Types>();
 	u64 dividend  = 0;
 	u64 quotient  = 0;
 	u64 remainder = 0;
@@ -12820,10 +13176,11 @@ void m68000_base_device::x4c60_divl_l_pd_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4c68_divl_l_di_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 divisor = OPER_AY_DI_32();
+	u64 divisor = OPER_AY_DI_32<Types>();
 	u64 dividend  = 0;
 	u64 quotient  = 0;
 	u64 remainder = 0;
@@ -12873,10 +13230,11 @@ void m68000_base_device::x4c68_divl_l_di_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4c70_divl_l_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 divisor = OPER_AY_IX_32();
+	u64 divisor = OPER_AY_IX_32<Types>();
 	u64 dividend  = 0;
 	u64 quotient  = 0;
 	u64 remainder = 0;
@@ -12926,10 +13284,11 @@ void m68000_base_device::x4c70_divl_l_ix_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4c78_divl_l_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 divisor = OPER_AW_32();
+	u64 divisor = OPER_AW_32<Types>();
 	u64 dividend  = 0;
 	u64 quotient  = 0;
 	u64 remainder = 0;
@@ -12979,10 +13338,11 @@ void m68000_base_device::x4c78_divl_l_aw_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4c79_divl_l_al_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 divisor = OPER_AL_32();
+	u64 divisor = OPER_AL_32<Types>();
 	u64 dividend  = 0;
 	u64 quotient  = 0;
 	u64 remainder = 0;
@@ -13085,10 +13445,11 @@ void m68000_base_device::x4c7a_divl_l_pcdi_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4c7b_divl_l_pcix_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 divisor = OPER_PCIX_32();
+	u64 divisor = OPER_PCIX_32<Types>();
 	u64 dividend  = 0;
 	u64 quotient  = 0;
 	u64 remainder = 0;
@@ -13286,9 +13647,10 @@ void m68000_base_device::xb128_eor_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb130_eor_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 res = MASK_OUT_ABOVE_8(DX() ^ m68ki_read_8(ea));
 
 	m68ki_write_8(ea, res);
@@ -13339,12 +13701,13 @@ void m68000_base_device::xb140_eor_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb150_eor_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13353,12 +13716,13 @@ void m68000_base_device::xb150_eor_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb158_eor_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13367,12 +13731,13 @@ void m68000_base_device::xb158_eor_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb160_eor_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13381,12 +13746,13 @@ void m68000_base_device::xb160_eor_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb168_eor_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13395,12 +13761,13 @@ void m68000_base_device::xb168_eor_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb170_eor_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16(ea));
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13409,12 +13776,13 @@ void m68000_base_device::xb170_eor_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb178_eor_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13423,12 +13791,13 @@ void m68000_base_device::xb178_eor_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb179_eor_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(DX() ^ m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13448,12 +13817,13 @@ void m68000_base_device::xb180_eor_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb190_eor_l_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_32();
-	u32 res = DX() ^ m68ki_read_32(ea);
+	u32 res = DX() ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13462,12 +13832,13 @@ void m68000_base_device::xb190_eor_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb198_eor_l_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_32();
-	u32 res = DX() ^ m68ki_read_32(ea);
+	u32 res = DX() ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13476,12 +13847,13 @@ void m68000_base_device::xb198_eor_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1a0_eor_l_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_32();
-	u32 res = DX() ^ m68ki_read_32(ea);
+	u32 res = DX() ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13490,12 +13862,13 @@ void m68000_base_device::xb1a0_eor_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1a8_eor_l_di_071234fc()
 {
 	u32 ea = EA_AY_DI_32();
-	u32 res = DX() ^ m68ki_read_32(ea);
+	u32 res = DX() ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13504,12 +13877,13 @@ void m68000_base_device::xb1a8_eor_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1b0_eor_l_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_32();
-	u32 res = DX() ^ m68ki_read_32(ea);
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 res = DX() ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13518,12 +13892,13 @@ void m68000_base_device::xb1b0_eor_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1b8_eor_l_aw_071234fc()
 {
 	u32 ea = EA_AW_32();
-	u32 res = DX() ^ m68ki_read_32(ea);
+	u32 res = DX() ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13532,12 +13907,13 @@ void m68000_base_device::xb1b8_eor_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xb1b9_eor_l_al_071234fc()
 {
 	u32 ea = EA_AL_32();
-	u32 res = DX() ^ m68ki_read_32(ea);
+	u32 res = DX() ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13647,10 +14023,11 @@ void m68000_base_device::x0a28_eori_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0a30_eori_b_ix_071234fc()
 {
 	u32 src = OPER_I_8();
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 res = src ^ m68ki_read_8(ea);
 
 	m68ki_write_8(ea, res);
@@ -13703,13 +14080,14 @@ void m68000_base_device::x0a40_eori_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0a50_eori_w_ai_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_AI_16();
-	u32 res = src ^ m68ki_read_16(ea);
+	u32 res = src ^ m68ki_read_16<Types>(ea);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13718,13 +14096,14 @@ void m68000_base_device::x0a50_eori_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0a58_eori_w_pi_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_PI_16();
-	u32 res = src ^ m68ki_read_16(ea);
+	u32 res = src ^ m68ki_read_16<Types>(ea);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13733,13 +14112,14 @@ void m68000_base_device::x0a58_eori_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0a60_eori_w_pd_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_PD_16();
-	u32 res = src ^ m68ki_read_16(ea);
+	u32 res = src ^ m68ki_read_16<Types>(ea);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13748,13 +14128,14 @@ void m68000_base_device::x0a60_eori_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0a68_eori_w_di_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_DI_16();
-	u32 res = src ^ m68ki_read_16(ea);
+	u32 res = src ^ m68ki_read_16<Types>(ea);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13763,13 +14144,14 @@ void m68000_base_device::x0a68_eori_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0a70_eori_w_ix_071234fc()
 {
 	u32 src = OPER_I_16();
-	u32 ea = EA_AY_IX_16();
-	u32 res = src ^ m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 res = src ^ m68ki_read_16<Types>(ea);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13778,13 +14160,14 @@ void m68000_base_device::x0a70_eori_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0a78_eori_w_aw_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AW_16();
-	u32 res = src ^ m68ki_read_16(ea);
+	u32 res = src ^ m68ki_read_16<Types>(ea);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13793,13 +14176,14 @@ void m68000_base_device::x0a78_eori_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0a79_eori_w_al_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AL_16();
-	u32 res = src ^ m68ki_read_16(ea);
+	u32 res = src ^ m68ki_read_16<Types>(ea);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -13819,13 +14203,14 @@ void m68000_base_device::x0a80_eori_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0a90_eori_l_ai_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_AI_32();
-	u32 res = src ^ m68ki_read_32(ea);
+	u32 res = src ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13834,13 +14219,14 @@ void m68000_base_device::x0a90_eori_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0a98_eori_l_pi_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_PI_32();
-	u32 res = src ^ m68ki_read_32(ea);
+	u32 res = src ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13849,13 +14235,14 @@ void m68000_base_device::x0a98_eori_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0aa0_eori_l_pd_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_PD_32();
-	u32 res = src ^ m68ki_read_32(ea);
+	u32 res = src ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13864,13 +14251,14 @@ void m68000_base_device::x0aa0_eori_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0aa8_eori_l_di_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_DI_32();
-	u32 res = src ^ m68ki_read_32(ea);
+	u32 res = src ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13879,13 +14267,14 @@ void m68000_base_device::x0aa8_eori_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ab0_eori_l_ix_071234fc()
 {
 	u32 src = OPER_I_32();
-	u32 ea = EA_AY_IX_32();
-	u32 res = src ^ m68ki_read_32(ea);
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 res = src ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13894,13 +14283,14 @@ void m68000_base_device::x0ab0_eori_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ab8_eori_l_aw_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AW_32();
-	u32 res = src ^ m68ki_read_32(ea);
+	u32 res = src ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -13909,13 +14299,14 @@ void m68000_base_device::x0ab8_eori_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ab9_eori_l_al_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AL_32();
-	u32 res = src ^ m68ki_read_32(ea);
+	u32 res = src ^ m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -14031,9 +14422,10 @@ void m68000_base_device::x4ee8_jmp_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ef0_jmp_l_ix_071234fc()
 {
-	m68ki_jump(EA_AY_IX_32());
+	m68ki_jump(EA_AY_IX_32<Types>());
 	m68ki_trace_t0();                  /* auto-disable (see m68kcpu.h) */
 
 
@@ -14059,72 +14451,80 @@ void m68000_base_device::x4efa_jmp_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4efb_jmp_l_pcix_071234fc()
 {
-	m68ki_jump(EA_PCIX_32());
+	m68ki_jump(EA_PCIX_32<Types>());
 	m68ki_trace_t0();                  /* auto-disable (see m68kcpu.h) */
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4e90_jsr_l_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_32();
 	m68ki_trace_t0();                  /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(m_pc);
+	m68ki_push_32<Types>(m_pc);
 	m68ki_jump(ea);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ea8_jsr_l_di_071234fc()
 {
 	u32 ea = EA_AY_DI_32();
 	m68ki_trace_t0();                  /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(m_pc);
+	m68ki_push_32<Types>(m_pc);
 	m68ki_jump(ea);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4eb0_jsr_l_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_32();
+	u32 ea = EA_AY_IX_32<Types>();
 	m68ki_trace_t0();                  /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(m_pc);
+	m68ki_push_32<Types>(m_pc);
 	m68ki_jump(ea);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4eb8_jsr_l_aw_071234fc()
 {
 	u32 ea = EA_AW_32();
 	m68ki_trace_t0();                  /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(m_pc);
+	m68ki_push_32<Types>(m_pc);
 	m68ki_jump(ea);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4eb9_jsr_l_al_071234fc()
 {
 	u32 ea = EA_AL_32();
 	m68ki_trace_t0();                  /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(m_pc);
+	m68ki_push_32<Types>(m_pc);
 	m68ki_jump(ea);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4eba_jsr_l_pcdi_071234fc()
 {
 	u32 ea = EA_PCDI_32();
 	m68ki_trace_t0();                  /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(m_pc);
+	m68ki_push_32<Types>(m_pc);
 	m68ki_jump(ea);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ebb_jsr_l_pcix_071234fc()
 {
-	u32 ea = EA_PCIX_32();
+	u32 ea = EA_PCIX_32<Types>();
 	m68ki_trace_t0();                  /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(m_pc);
+	m68ki_push_32<Types>(m_pc);
 	m68ki_jump(ea);
 
 
@@ -14141,9 +14541,10 @@ void m68000_base_device::x41e8_lea_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x41f0_lea_l_ix_071234fc()
 {
-	AX() = EA_AY_IX_32();
+	AX() = EA_AY_IX_32<Types>();
 
 
 }
@@ -14165,43 +14566,48 @@ void m68000_base_device::x41fa_lea_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x41fb_lea_l_pcix_071234fc()
 {
-	AX() = EA_PCIX_32();
+	AX() = EA_PCIX_32<Types>();
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4e57_link_w_071234fc()
 {
 	REG_A()[7] -= 4;
-	m68ki_write_32(REG_A()[7], REG_A()[7]);
+	m68ki_write_32<Types>(REG_A()[7], REG_A()[7]);
 	REG_A()[7] = MASK_OUT_ABOVE_32(REG_A()[7] + MAKE_INT_16(OPER_I_16()));
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4e50_link_w_071234fc()
 {
 	u32* r_dst = &AY();
 
-	m68ki_push_32(*r_dst);
+	m68ki_push_32<Types>(*r_dst);
 	*r_dst = REG_A()[7];
 	REG_A()[7] = MASK_OUT_ABOVE_32(REG_A()[7] + MAKE_INT_16(OPER_I_16()));
 
 
 }
+template <u32 Types>
 void m68000_base_device::x480f_link_l_234fc()
 {
 	REG_A()[7] -= 4;
-	m68ki_write_32(REG_A()[7], REG_A()[7]);
+	m68ki_write_32<Types>(REG_A()[7], REG_A()[7]);
 	REG_A()[7] = MASK_OUT_ABOVE_32(REG_A()[7] + OPER_I_32());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4808_link_l_234fc()
 {
 	u32* r_dst = &AY();
 
-	m68ki_push_32(*r_dst);
+	m68ki_push_32<Types>(*r_dst);
 	*r_dst = REG_A()[7];
 	REG_A()[7] = MASK_OUT_ABOVE_32(REG_A()[7] + OPER_I_32());
 
@@ -14362,13 +14768,14 @@ void m68000_base_device::xe0a8_lsr_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe2d0_lsr_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_not_z_flag = res;
@@ -14377,13 +14784,14 @@ void m68000_base_device::xe2d0_lsr_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe2d8_lsr_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_not_z_flag = res;
@@ -14392,13 +14800,14 @@ void m68000_base_device::xe2d8_lsr_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe2e0_lsr_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_not_z_flag = res;
@@ -14407,13 +14816,14 @@ void m68000_base_device::xe2e0_lsr_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe2e8_lsr_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_not_z_flag = res;
@@ -14422,13 +14832,14 @@ void m68000_base_device::xe2e8_lsr_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe2f0_lsr_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 src = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_not_z_flag = res;
@@ -14437,13 +14848,14 @@ void m68000_base_device::xe2f0_lsr_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe2f8_lsr_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_not_z_flag = res;
@@ -14452,13 +14864,14 @@ void m68000_base_device::xe2f8_lsr_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe2f9_lsr_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = src >> 1;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_CLEAR;
 	m_not_z_flag = res;
@@ -14622,13 +15035,14 @@ void m68000_base_device::xe1a8_lsl_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe3d0_lsl_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -14637,13 +15051,14 @@ void m68000_base_device::xe3d0_lsl_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe3d8_lsl_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -14652,13 +15067,14 @@ void m68000_base_device::xe3d8_lsl_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe3e0_lsl_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -14667,13 +15083,14 @@ void m68000_base_device::xe3e0_lsl_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe3e8_lsl_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -14682,13 +15099,14 @@ void m68000_base_device::xe3e8_lsl_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe3f0_lsl_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 src = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -14697,13 +15115,14 @@ void m68000_base_device::xe3f0_lsl_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe3f8_lsl_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -14712,13 +15131,14 @@ void m68000_base_device::xe3f8_lsl_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe3f9_lsl_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(src << 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -14825,9 +15245,10 @@ void m68000_base_device::x1028_move_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x1030_move_b_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_8();
+	u32 res = OPER_AY_IX_8<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
@@ -14881,9 +15302,10 @@ void m68000_base_device::x103a_move_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x103b_move_b_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_8();
+	u32 res = OPER_PCIX_8<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
@@ -15007,9 +15429,10 @@ void m68000_base_device::x10a8_move_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x10b0_move_b_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_8();
+	u32 res = OPER_AY_IX_8<Types>();
 	u32 ea = EA_AX_AI_8();
 
 	m68ki_write_8(ea, res);
@@ -15063,9 +15486,10 @@ void m68000_base_device::x10ba_move_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x10bb_move_b_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_8();
+	u32 res = OPER_PCIX_8<Types>();
 	u32 ea = EA_AX_AI_8();
 
 	m68ki_write_8(ea, res);
@@ -15203,9 +15627,10 @@ void m68000_base_device::x1ee8_move_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x1ef0_move_b_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_8();
+	u32 res = OPER_AY_IX_8<Types>();
 	u32 ea = EA_A7_PI_8();
 
 	m68ki_write_8(ea, res);
@@ -15259,9 +15684,10 @@ void m68000_base_device::x1efa_move_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x1efb_move_b_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_8();
+	u32 res = OPER_PCIX_8<Types>();
 	u32 ea = EA_A7_PI_8();
 
 	m68ki_write_8(ea, res);
@@ -15371,9 +15797,10 @@ void m68000_base_device::x10e8_move_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x10f0_move_b_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_8();
+	u32 res = OPER_AY_IX_8<Types>();
 	u32 ea = EA_AX_PI_8();
 
 	m68ki_write_8(ea, res);
@@ -15427,9 +15854,10 @@ void m68000_base_device::x10fa_move_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x10fb_move_b_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_8();
+	u32 res = OPER_PCIX_8<Types>();
 	u32 ea = EA_AX_PI_8();
 
 	m68ki_write_8(ea, res);
@@ -15567,9 +15995,10 @@ void m68000_base_device::x1f28_move_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x1f30_move_b_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_8();
+	u32 res = OPER_AY_IX_8<Types>();
 	u32 ea = EA_A7_PD_8();
 
 	m68ki_write_8(ea, res);
@@ -15623,9 +16052,10 @@ void m68000_base_device::x1f3a_move_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x1f3b_move_b_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_8();
+	u32 res = OPER_PCIX_8<Types>();
 	u32 ea = EA_A7_PD_8();
 
 	m68ki_write_8(ea, res);
@@ -15735,9 +16165,10 @@ void m68000_base_device::x1128_move_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x1130_move_b_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_8();
+	u32 res = OPER_AY_IX_8<Types>();
 	u32 ea = EA_AX_PD_8();
 
 	m68ki_write_8(ea, res);
@@ -15791,9 +16222,10 @@ void m68000_base_device::x113a_move_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x113b_move_b_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_8();
+	u32 res = OPER_PCIX_8<Types>();
 	u32 ea = EA_AX_PD_8();
 
 	m68ki_write_8(ea, res);
@@ -15917,9 +16349,10 @@ void m68000_base_device::x1168_move_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x1170_move_b_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_8();
+	u32 res = OPER_AY_IX_8<Types>();
 	u32 ea = EA_AX_DI_8();
 
 	m68ki_write_8(ea, res);
@@ -15973,9 +16406,10 @@ void m68000_base_device::x117a_move_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x117b_move_b_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_8();
+	u32 res = OPER_PCIX_8<Types>();
 	u32 ea = EA_AX_DI_8();
 
 	m68ki_write_8(ea, res);
@@ -16001,10 +16435,11 @@ void m68000_base_device::x117c_move_b_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x1180_move_b_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_8(DY());
-	u32 ea = EA_AX_IX_8();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16015,10 +16450,11 @@ void m68000_base_device::x1180_move_b_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x1190_move_b_ai_071234fc()
 {
 	u32 res = OPER_AY_AI_8();
-	u32 ea = EA_AX_IX_8();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16029,10 +16465,11 @@ void m68000_base_device::x1190_move_b_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x1198_move_b_pi_071234fc()
 {
 	u32 res = OPER_AY_PI_8();
-	u32 ea = EA_AX_IX_8();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16043,10 +16480,11 @@ void m68000_base_device::x1198_move_b_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x119f_move_b_pi7_071234fc()
 {
 	u32 res = OPER_A7_PI_8();
-	u32 ea = EA_AX_IX_8();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16057,10 +16495,11 @@ void m68000_base_device::x119f_move_b_pi7_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x11a0_move_b_pd_071234fc()
 {
 	u32 res = OPER_AY_PD_8();
-	u32 ea = EA_AX_IX_8();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16071,10 +16510,11 @@ void m68000_base_device::x11a0_move_b_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x11a7_move_b_pd7_071234fc()
 {
 	u32 res = OPER_A7_PD_8();
-	u32 ea = EA_AX_IX_8();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16085,10 +16525,11 @@ void m68000_base_device::x11a7_move_b_pd7_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x11a8_move_b_di_071234fc()
 {
 	u32 res = OPER_AY_DI_8();
-	u32 ea = EA_AX_IX_8();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16099,10 +16540,11 @@ void m68000_base_device::x11a8_move_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x11b0_move_b_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_8();
-	u32 ea = EA_AX_IX_8();
+	u32 res = OPER_AY_IX_8<Types>();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16113,10 +16555,11 @@ void m68000_base_device::x11b0_move_b_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x11b8_move_b_aw_071234fc()
 {
 	u32 res = OPER_AW_8();
-	u32 ea = EA_AX_IX_8();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16127,10 +16570,11 @@ void m68000_base_device::x11b8_move_b_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x11b9_move_b_al_071234fc()
 {
 	u32 res = OPER_AL_8();
-	u32 ea = EA_AX_IX_8();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16141,10 +16585,11 @@ void m68000_base_device::x11b9_move_b_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x11ba_move_b_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_8();
-	u32 ea = EA_AX_IX_8();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16155,10 +16600,11 @@ void m68000_base_device::x11ba_move_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x11bb_move_b_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_8();
-	u32 ea = EA_AX_IX_8();
+	u32 res = OPER_PCIX_8<Types>();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16169,10 +16615,11 @@ void m68000_base_device::x11bb_move_b_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x11bc_move_b_i_071234fc()
 {
 	u32 res = OPER_I_8();
-	u32 ea = EA_AX_IX_8();
+	u32 ea = EA_AX_IX_8<Types>();
 
 	m68ki_write_8(ea, res);
 
@@ -16281,9 +16728,10 @@ void m68000_base_device::x11e8_move_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x11f0_move_b_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_8();
+	u32 res = OPER_AY_IX_8<Types>();
 	u32 ea = EA_AW_8();
 
 	m68ki_write_8(ea, res);
@@ -16337,9 +16785,10 @@ void m68000_base_device::x11fa_move_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x11fb_move_b_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_8();
+	u32 res = OPER_PCIX_8<Types>();
 	u32 ea = EA_AW_8();
 
 	m68ki_write_8(ea, res);
@@ -16463,9 +16912,10 @@ void m68000_base_device::x13e8_move_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x13f0_move_b_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_8();
+	u32 res = OPER_AY_IX_8<Types>();
 	u32 ea = EA_AL_8();
 
 	m68ki_write_8(ea, res);
@@ -16519,9 +16969,10 @@ void m68000_base_device::x13fa_move_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x13fb_move_b_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_8();
+	u32 res = OPER_PCIX_8<Types>();
 	u32 ea = EA_AL_8();
 
 	m68ki_write_8(ea, res);
@@ -16575,9 +17026,10 @@ void m68000_base_device::x3008_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3010_move_w_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_16();
+	u32 res = OPER_AY_AI_16<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
@@ -16589,9 +17041,10 @@ void m68000_base_device::x3010_move_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3018_move_w_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_16();
+	u32 res = OPER_AY_PI_16<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
@@ -16603,9 +17056,10 @@ void m68000_base_device::x3018_move_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3020_move_w_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_16();
+	u32 res = OPER_AY_PD_16<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
@@ -16617,9 +17071,10 @@ void m68000_base_device::x3020_move_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3028_move_w_di_071234fc()
 {
-	u32 res = OPER_AY_DI_16();
+	u32 res = OPER_AY_DI_16<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
@@ -16631,9 +17086,10 @@ void m68000_base_device::x3028_move_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3030_move_w_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_16();
+	u32 res = OPER_AY_IX_16<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
@@ -16645,9 +17101,10 @@ void m68000_base_device::x3030_move_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3038_move_w_aw_071234fc()
 {
-	u32 res = OPER_AW_16();
+	u32 res = OPER_AW_16<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
@@ -16659,9 +17116,10 @@ void m68000_base_device::x3038_move_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3039_move_w_al_071234fc()
 {
-	u32 res = OPER_AL_16();
+	u32 res = OPER_AL_16<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
@@ -16687,9 +17145,10 @@ void m68000_base_device::x303a_move_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x303b_move_w_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_16();
+	u32 res = OPER_PCIX_16<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
@@ -16715,12 +17174,13 @@ void m68000_base_device::x303c_move_w_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3080_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(DY());
 	u32 ea = EA_AX_AI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16729,12 +17189,13 @@ void m68000_base_device::x3080_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3088_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(AY());
 	u32 ea = EA_AX_AI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16743,12 +17204,13 @@ void m68000_base_device::x3088_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3090_move_w_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_16();
+	u32 res = OPER_AY_AI_16<Types>();
 	u32 ea = EA_AX_AI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16757,12 +17219,13 @@ void m68000_base_device::x3090_move_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3098_move_w_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_16();
+	u32 res = OPER_AY_PI_16<Types>();
 	u32 ea = EA_AX_AI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16771,12 +17234,13 @@ void m68000_base_device::x3098_move_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30a0_move_w_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_16();
+	u32 res = OPER_AY_PD_16<Types>();
 	u32 ea = EA_AX_AI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16785,12 +17249,13 @@ void m68000_base_device::x30a0_move_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30a8_move_w_di_071234fc()
 {
-	u32 res = OPER_AY_DI_16();
+	u32 res = OPER_AY_DI_16<Types>();
 	u32 ea = EA_AX_AI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16799,12 +17264,13 @@ void m68000_base_device::x30a8_move_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30b0_move_w_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_16();
+	u32 res = OPER_AY_IX_16<Types>();
 	u32 ea = EA_AX_AI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16813,12 +17279,13 @@ void m68000_base_device::x30b0_move_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30b8_move_w_aw_071234fc()
 {
-	u32 res = OPER_AW_16();
+	u32 res = OPER_AW_16<Types>();
 	u32 ea = EA_AX_AI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16827,12 +17294,13 @@ void m68000_base_device::x30b8_move_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30b9_move_w_al_071234fc()
 {
-	u32 res = OPER_AL_16();
+	u32 res = OPER_AL_16<Types>();
 	u32 ea = EA_AX_AI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16841,12 +17309,13 @@ void m68000_base_device::x30b9_move_w_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30ba_move_w_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_16();
 	u32 ea = EA_AX_AI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16855,12 +17324,13 @@ void m68000_base_device::x30ba_move_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30bb_move_w_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_16();
+	u32 res = OPER_PCIX_16<Types>();
 	u32 ea = EA_AX_AI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16869,12 +17339,13 @@ void m68000_base_device::x30bb_move_w_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30bc_move_w_i_071234fc()
 {
 	u32 res = OPER_I_16();
 	u32 ea = EA_AX_AI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16883,12 +17354,13 @@ void m68000_base_device::x30bc_move_w_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30c0_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(DY());
 	u32 ea = EA_AX_PI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16897,12 +17369,13 @@ void m68000_base_device::x30c0_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30c8_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(AY());
 	u32 ea = EA_AX_PI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16911,12 +17384,13 @@ void m68000_base_device::x30c8_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30d0_move_w_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_16();
+	u32 res = OPER_AY_AI_16<Types>();
 	u32 ea = EA_AX_PI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16925,12 +17399,13 @@ void m68000_base_device::x30d0_move_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30d8_move_w_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_16();
+	u32 res = OPER_AY_PI_16<Types>();
 	u32 ea = EA_AX_PI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16939,12 +17414,13 @@ void m68000_base_device::x30d8_move_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30e0_move_w_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_16();
+	u32 res = OPER_AY_PD_16<Types>();
 	u32 ea = EA_AX_PI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16953,12 +17429,13 @@ void m68000_base_device::x30e0_move_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30e8_move_w_di_071234fc()
 {
-	u32 res = OPER_AY_DI_16();
+	u32 res = OPER_AY_DI_16<Types>();
 	u32 ea = EA_AX_PI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16967,12 +17444,13 @@ void m68000_base_device::x30e8_move_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30f0_move_w_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_16();
+	u32 res = OPER_AY_IX_16<Types>();
 	u32 ea = EA_AX_PI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16981,12 +17459,13 @@ void m68000_base_device::x30f0_move_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30f8_move_w_aw_071234fc()
 {
-	u32 res = OPER_AW_16();
+	u32 res = OPER_AW_16<Types>();
 	u32 ea = EA_AX_PI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -16995,12 +17474,13 @@ void m68000_base_device::x30f8_move_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30f9_move_w_al_071234fc()
 {
-	u32 res = OPER_AL_16();
+	u32 res = OPER_AL_16<Types>();
 	u32 ea = EA_AX_PI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17009,12 +17489,13 @@ void m68000_base_device::x30f9_move_w_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30fa_move_w_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_16();
 	u32 ea = EA_AX_PI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17023,12 +17504,13 @@ void m68000_base_device::x30fa_move_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30fb_move_w_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_16();
+	u32 res = OPER_PCIX_16<Types>();
 	u32 ea = EA_AX_PI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17037,12 +17519,13 @@ void m68000_base_device::x30fb_move_w_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x30fc_move_w_i_071234fc()
 {
 	u32 res = OPER_I_16();
 	u32 ea = EA_AX_PI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17051,12 +17534,13 @@ void m68000_base_device::x30fc_move_w_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3100_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(DY());
 	u32 ea = EA_AX_PD_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17065,12 +17549,13 @@ void m68000_base_device::x3100_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3108_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(AY());
 	u32 ea = EA_AX_PD_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17079,12 +17564,13 @@ void m68000_base_device::x3108_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3110_move_w_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_16();
+	u32 res = OPER_AY_AI_16<Types>();
 	u32 ea = EA_AX_PD_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17093,12 +17579,13 @@ void m68000_base_device::x3110_move_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3118_move_w_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_16();
+	u32 res = OPER_AY_PI_16<Types>();
 	u32 ea = EA_AX_PD_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17107,12 +17594,13 @@ void m68000_base_device::x3118_move_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3120_move_w_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_16();
+	u32 res = OPER_AY_PD_16<Types>();
 	u32 ea = EA_AX_PD_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17121,12 +17609,13 @@ void m68000_base_device::x3120_move_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3128_move_w_di_071234fc()
 {
-	u32 res = OPER_AY_DI_16();
+	u32 res = OPER_AY_DI_16<Types>();
 	u32 ea = EA_AX_PD_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17135,12 +17624,13 @@ void m68000_base_device::x3128_move_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3130_move_w_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_16();
+	u32 res = OPER_AY_IX_16<Types>();
 	u32 ea = EA_AX_PD_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17149,12 +17639,13 @@ void m68000_base_device::x3130_move_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3138_move_w_aw_071234fc()
 {
-	u32 res = OPER_AW_16();
+	u32 res = OPER_AW_16<Types>();
 	u32 ea = EA_AX_PD_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17163,12 +17654,13 @@ void m68000_base_device::x3138_move_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3139_move_w_al_071234fc()
 {
-	u32 res = OPER_AL_16();
+	u32 res = OPER_AL_16<Types>();
 	u32 ea = EA_AX_PD_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17177,12 +17669,13 @@ void m68000_base_device::x3139_move_w_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x313a_move_w_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_16();
 	u32 ea = EA_AX_PD_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17191,12 +17684,13 @@ void m68000_base_device::x313a_move_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x313b_move_w_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_16();
+	u32 res = OPER_PCIX_16<Types>();
 	u32 ea = EA_AX_PD_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17205,12 +17699,13 @@ void m68000_base_device::x313b_move_w_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x313c_move_w_i_071234fc()
 {
 	u32 res = OPER_I_16();
 	u32 ea = EA_AX_PD_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17219,12 +17714,13 @@ void m68000_base_device::x313c_move_w_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3140_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(DY());
 	u32 ea = EA_AX_DI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17233,12 +17729,13 @@ void m68000_base_device::x3140_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3148_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(AY());
 	u32 ea = EA_AX_DI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17247,12 +17744,13 @@ void m68000_base_device::x3148_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3150_move_w_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_16();
+	u32 res = OPER_AY_AI_16<Types>();
 	u32 ea = EA_AX_DI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17261,12 +17759,13 @@ void m68000_base_device::x3150_move_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3158_move_w_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_16();
+	u32 res = OPER_AY_PI_16<Types>();
 	u32 ea = EA_AX_DI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17275,12 +17774,13 @@ void m68000_base_device::x3158_move_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3160_move_w_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_16();
+	u32 res = OPER_AY_PD_16<Types>();
 	u32 ea = EA_AX_DI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17289,12 +17789,13 @@ void m68000_base_device::x3160_move_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3168_move_w_di_071234fc()
 {
-	u32 res = OPER_AY_DI_16();
+	u32 res = OPER_AY_DI_16<Types>();
 	u32 ea = EA_AX_DI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17303,12 +17804,13 @@ void m68000_base_device::x3168_move_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3170_move_w_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_16();
+	u32 res = OPER_AY_IX_16<Types>();
 	u32 ea = EA_AX_DI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17317,12 +17819,13 @@ void m68000_base_device::x3170_move_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3178_move_w_aw_071234fc()
 {
-	u32 res = OPER_AW_16();
+	u32 res = OPER_AW_16<Types>();
 	u32 ea = EA_AX_DI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17331,12 +17834,13 @@ void m68000_base_device::x3178_move_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3179_move_w_al_071234fc()
 {
-	u32 res = OPER_AL_16();
+	u32 res = OPER_AL_16<Types>();
 	u32 ea = EA_AX_DI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17345,12 +17849,13 @@ void m68000_base_device::x3179_move_w_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x317a_move_w_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_16();
 	u32 ea = EA_AX_DI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17359,12 +17864,13 @@ void m68000_base_device::x317a_move_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x317b_move_w_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_16();
+	u32 res = OPER_PCIX_16<Types>();
 	u32 ea = EA_AX_DI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17373,12 +17879,13 @@ void m68000_base_device::x317b_move_w_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x317c_move_w_i_071234fc()
 {
 	u32 res = OPER_I_16();
 	u32 ea = EA_AX_DI_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17387,12 +17894,13 @@ void m68000_base_device::x317c_move_w_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3180_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(DY());
-	u32 ea = EA_AX_IX_16();
+	u32 ea = EA_AX_IX_16<Types>();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17401,12 +17909,13 @@ void m68000_base_device::x3180_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3188_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(AY());
-	u32 ea = EA_AX_IX_16();
+	u32 ea = EA_AX_IX_16<Types>();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17415,12 +17924,13 @@ void m68000_base_device::x3188_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3190_move_w_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_16();
-	u32 ea = EA_AX_IX_16();
+	u32 res = OPER_AY_AI_16<Types>();
+	u32 ea = EA_AX_IX_16<Types>();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17429,12 +17939,13 @@ void m68000_base_device::x3190_move_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3198_move_w_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_16();
-	u32 ea = EA_AX_IX_16();
+	u32 res = OPER_AY_PI_16<Types>();
+	u32 ea = EA_AX_IX_16<Types>();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17443,12 +17954,13 @@ void m68000_base_device::x3198_move_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31a0_move_w_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_16();
-	u32 ea = EA_AX_IX_16();
+	u32 res = OPER_AY_PD_16<Types>();
+	u32 ea = EA_AX_IX_16<Types>();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17457,12 +17969,13 @@ void m68000_base_device::x31a0_move_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31a8_move_w_di_071234fc()
 {
-	u32 res = OPER_AY_DI_16();
-	u32 ea = EA_AX_IX_16();
+	u32 res = OPER_AY_DI_16<Types>();
+	u32 ea = EA_AX_IX_16<Types>();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17471,12 +17984,13 @@ void m68000_base_device::x31a8_move_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31b0_move_w_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_16();
-	u32 ea = EA_AX_IX_16();
+	u32 res = OPER_AY_IX_16<Types>();
+	u32 ea = EA_AX_IX_16<Types>();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17485,12 +17999,13 @@ void m68000_base_device::x31b0_move_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31b8_move_w_aw_071234fc()
 {
-	u32 res = OPER_AW_16();
-	u32 ea = EA_AX_IX_16();
+	u32 res = OPER_AW_16<Types>();
+	u32 ea = EA_AX_IX_16<Types>();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17499,12 +18014,13 @@ void m68000_base_device::x31b8_move_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31b9_move_w_al_071234fc()
 {
-	u32 res = OPER_AL_16();
-	u32 ea = EA_AX_IX_16();
+	u32 res = OPER_AL_16<Types>();
+	u32 ea = EA_AX_IX_16<Types>();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17513,12 +18029,13 @@ void m68000_base_device::x31b9_move_w_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31ba_move_w_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_16();
-	u32 ea = EA_AX_IX_16();
+	u32 ea = EA_AX_IX_16<Types>();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17527,12 +18044,13 @@ void m68000_base_device::x31ba_move_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31bb_move_w_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_16();
-	u32 ea = EA_AX_IX_16();
+	u32 res = OPER_PCIX_16<Types>();
+	u32 ea = EA_AX_IX_16<Types>();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17541,12 +18059,13 @@ void m68000_base_device::x31bb_move_w_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31bc_move_w_i_071234fc()
 {
 	u32 res = OPER_I_16();
-	u32 ea = EA_AX_IX_16();
+	u32 ea = EA_AX_IX_16<Types>();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17555,12 +18074,13 @@ void m68000_base_device::x31bc_move_w_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31c0_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(DY());
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17569,12 +18089,13 @@ void m68000_base_device::x31c0_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31c8_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(AY());
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17583,12 +18104,13 @@ void m68000_base_device::x31c8_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31d0_move_w_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_16();
+	u32 res = OPER_AY_AI_16<Types>();
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17597,12 +18119,13 @@ void m68000_base_device::x31d0_move_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31d8_move_w_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_16();
+	u32 res = OPER_AY_PI_16<Types>();
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17611,12 +18134,13 @@ void m68000_base_device::x31d8_move_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31e0_move_w_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_16();
+	u32 res = OPER_AY_PD_16<Types>();
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17625,12 +18149,13 @@ void m68000_base_device::x31e0_move_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31e8_move_w_di_071234fc()
 {
-	u32 res = OPER_AY_DI_16();
+	u32 res = OPER_AY_DI_16<Types>();
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17639,12 +18164,13 @@ void m68000_base_device::x31e8_move_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31f0_move_w_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_16();
+	u32 res = OPER_AY_IX_16<Types>();
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17653,12 +18179,13 @@ void m68000_base_device::x31f0_move_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31f8_move_w_aw_071234fc()
 {
-	u32 res = OPER_AW_16();
+	u32 res = OPER_AW_16<Types>();
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17667,12 +18194,13 @@ void m68000_base_device::x31f8_move_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31f9_move_w_al_071234fc()
 {
-	u32 res = OPER_AL_16();
+	u32 res = OPER_AL_16<Types>();
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17681,12 +18209,13 @@ void m68000_base_device::x31f9_move_w_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31fa_move_w_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_16();
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17695,12 +18224,13 @@ void m68000_base_device::x31fa_move_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31fb_move_w_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_16();
+	u32 res = OPER_PCIX_16<Types>();
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17709,12 +18239,13 @@ void m68000_base_device::x31fb_move_w_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x31fc_move_w_i_071234fc()
 {
 	u32 res = OPER_I_16();
 	u32 ea = EA_AW_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17723,12 +18254,13 @@ void m68000_base_device::x31fc_move_w_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x33c0_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(DY());
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17737,12 +18269,13 @@ void m68000_base_device::x33c0_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x33c8_move_w_071234fc()
 {
 	u32 res = MASK_OUT_ABOVE_16(AY());
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17751,12 +18284,13 @@ void m68000_base_device::x33c8_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x33d0_move_w_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_16();
+	u32 res = OPER_AY_AI_16<Types>();
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17765,12 +18299,13 @@ void m68000_base_device::x33d0_move_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x33d8_move_w_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_16();
+	u32 res = OPER_AY_PI_16<Types>();
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17779,12 +18314,13 @@ void m68000_base_device::x33d8_move_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x33e0_move_w_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_16();
+	u32 res = OPER_AY_PD_16<Types>();
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17793,12 +18329,13 @@ void m68000_base_device::x33e0_move_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x33e8_move_w_di_071234fc()
 {
-	u32 res = OPER_AY_DI_16();
+	u32 res = OPER_AY_DI_16<Types>();
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17807,12 +18344,13 @@ void m68000_base_device::x33e8_move_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x33f0_move_w_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_16();
+	u32 res = OPER_AY_IX_16<Types>();
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17821,12 +18359,13 @@ void m68000_base_device::x33f0_move_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x33f8_move_w_aw_071234fc()
 {
-	u32 res = OPER_AW_16();
+	u32 res = OPER_AW_16<Types>();
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17835,12 +18374,13 @@ void m68000_base_device::x33f8_move_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x33f9_move_w_al_071234fc()
 {
-	u32 res = OPER_AL_16();
+	u32 res = OPER_AL_16<Types>();
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17849,12 +18389,13 @@ void m68000_base_device::x33f9_move_w_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x33fa_move_w_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_16();
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17863,12 +18404,13 @@ void m68000_base_device::x33fa_move_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x33fb_move_w_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_16();
+	u32 res = OPER_PCIX_16<Types>();
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17877,12 +18419,13 @@ void m68000_base_device::x33fb_move_w_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x33fc_move_w_i_071234fc()
 {
 	u32 res = OPER_I_16();
 	u32 ea = EA_AL_16();
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -17919,9 +18462,10 @@ void m68000_base_device::x2008_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2010_move_l_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_32();
+	u32 res = OPER_AY_AI_32<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = res;
@@ -17933,9 +18477,10 @@ void m68000_base_device::x2010_move_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2018_move_l_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_32();
+	u32 res = OPER_AY_PI_32<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = res;
@@ -17947,9 +18492,10 @@ void m68000_base_device::x2018_move_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2020_move_l_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_32();
+	u32 res = OPER_AY_PD_32<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = res;
@@ -17961,9 +18507,10 @@ void m68000_base_device::x2020_move_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2028_move_l_di_071234fc()
 {
-	u32 res = OPER_AY_DI_32();
+	u32 res = OPER_AY_DI_32<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = res;
@@ -17975,9 +18522,10 @@ void m68000_base_device::x2028_move_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2030_move_l_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_32();
+	u32 res = OPER_AY_IX_32<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = res;
@@ -17989,9 +18537,10 @@ void m68000_base_device::x2030_move_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2038_move_l_aw_071234fc()
 {
-	u32 res = OPER_AW_32();
+	u32 res = OPER_AW_32<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = res;
@@ -18003,9 +18552,10 @@ void m68000_base_device::x2038_move_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2039_move_l_al_071234fc()
 {
-	u32 res = OPER_AL_32();
+	u32 res = OPER_AL_32<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = res;
@@ -18031,9 +18581,10 @@ void m68000_base_device::x203a_move_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x203b_move_l_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_32();
+	u32 res = OPER_PCIX_32<Types>();
 	u32* r_dst = &DX();
 
 	*r_dst = res;
@@ -18059,12 +18610,13 @@ void m68000_base_device::x203c_move_l_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2080_move_l_071234fc()
 {
 	u32 res = DY();
 	u32 ea = EA_AX_AI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18073,12 +18625,13 @@ void m68000_base_device::x2080_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2088_move_l_071234fc()
 {
 	u32 res = AY();
 	u32 ea = EA_AX_AI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18087,12 +18640,13 @@ void m68000_base_device::x2088_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2090_move_l_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_32();
+	u32 res = OPER_AY_AI_32<Types>();
 	u32 ea = EA_AX_AI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18101,12 +18655,13 @@ void m68000_base_device::x2090_move_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2098_move_l_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_32();
+	u32 res = OPER_AY_PI_32<Types>();
 	u32 ea = EA_AX_AI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18115,12 +18670,13 @@ void m68000_base_device::x2098_move_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20a0_move_l_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_32();
+	u32 res = OPER_AY_PD_32<Types>();
 	u32 ea = EA_AX_AI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18129,12 +18685,13 @@ void m68000_base_device::x20a0_move_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20a8_move_l_di_071234fc()
 {
-	u32 res = OPER_AY_DI_32();
+	u32 res = OPER_AY_DI_32<Types>();
 	u32 ea = EA_AX_AI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18143,12 +18700,13 @@ void m68000_base_device::x20a8_move_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20b0_move_l_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_32();
+	u32 res = OPER_AY_IX_32<Types>();
 	u32 ea = EA_AX_AI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18157,12 +18715,13 @@ void m68000_base_device::x20b0_move_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20b8_move_l_aw_071234fc()
 {
-	u32 res = OPER_AW_32();
+	u32 res = OPER_AW_32<Types>();
 	u32 ea = EA_AX_AI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18171,12 +18730,13 @@ void m68000_base_device::x20b8_move_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20b9_move_l_al_071234fc()
 {
-	u32 res = OPER_AL_32();
+	u32 res = OPER_AL_32<Types>();
 	u32 ea = EA_AX_AI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18185,12 +18745,13 @@ void m68000_base_device::x20b9_move_l_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20ba_move_l_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_32();
 	u32 ea = EA_AX_AI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18199,12 +18760,13 @@ void m68000_base_device::x20ba_move_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20bb_move_l_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_32();
+	u32 res = OPER_PCIX_32<Types>();
 	u32 ea = EA_AX_AI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18213,12 +18775,13 @@ void m68000_base_device::x20bb_move_l_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20bc_move_l_i_071234fc()
 {
 	u32 res = OPER_I_32();
 	u32 ea = EA_AX_AI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18227,12 +18790,13 @@ void m68000_base_device::x20bc_move_l_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20c0_move_l_071234fc()
 {
 	u32 res = DY();
 	u32 ea = EA_AX_PI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18241,12 +18805,13 @@ void m68000_base_device::x20c0_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20c8_move_l_071234fc()
 {
 	u32 res = AY();
 	u32 ea = EA_AX_PI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18255,12 +18820,13 @@ void m68000_base_device::x20c8_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20d0_move_l_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_32();
+	u32 res = OPER_AY_AI_32<Types>();
 	u32 ea = EA_AX_PI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18269,12 +18835,13 @@ void m68000_base_device::x20d0_move_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20d8_move_l_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_32();
+	u32 res = OPER_AY_PI_32<Types>();
 	u32 ea = EA_AX_PI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18283,12 +18850,13 @@ void m68000_base_device::x20d8_move_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20e0_move_l_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_32();
+	u32 res = OPER_AY_PD_32<Types>();
 	u32 ea = EA_AX_PI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18297,12 +18865,13 @@ void m68000_base_device::x20e0_move_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20e8_move_l_di_071234fc()
 {
-	u32 res = OPER_AY_DI_32();
+	u32 res = OPER_AY_DI_32<Types>();
 	u32 ea = EA_AX_PI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18311,12 +18880,13 @@ void m68000_base_device::x20e8_move_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20f0_move_l_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_32();
+	u32 res = OPER_AY_IX_32<Types>();
 	u32 ea = EA_AX_PI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18325,12 +18895,13 @@ void m68000_base_device::x20f0_move_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20f8_move_l_aw_071234fc()
 {
-	u32 res = OPER_AW_32();
+	u32 res = OPER_AW_32<Types>();
 	u32 ea = EA_AX_PI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18339,12 +18910,13 @@ void m68000_base_device::x20f8_move_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20f9_move_l_al_071234fc()
 {
-	u32 res = OPER_AL_32();
+	u32 res = OPER_AL_32<Types>();
 	u32 ea = EA_AX_PI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18353,12 +18925,13 @@ void m68000_base_device::x20f9_move_l_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20fa_move_l_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_32();
 	u32 ea = EA_AX_PI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18367,12 +18940,13 @@ void m68000_base_device::x20fa_move_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20fb_move_l_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_32();
+	u32 res = OPER_PCIX_32<Types>();
 	u32 ea = EA_AX_PI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18381,12 +18955,13 @@ void m68000_base_device::x20fb_move_l_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x20fc_move_l_i_071234fc()
 {
 	u32 res = OPER_I_32();
 	u32 ea = EA_AX_PI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18395,13 +18970,14 @@ void m68000_base_device::x20fc_move_l_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2100_move_l_071234fc()
 {
 	u32 res = DY();
 	u32 ea = EA_AX_PD_32();
 
-	m68ki_write_16(ea+2, res & 0xFFFF );
-	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
+	m68ki_write_16<Types>(ea+2, res & 0xFFFF );
+	m68ki_write_16<Types>(ea, (res >> 16) & 0xFFFF );
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18410,13 +18986,14 @@ void m68000_base_device::x2100_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2108_move_l_071234fc()
 {
 	u32 res = AY();
 	u32 ea = EA_AX_PD_32();
 
-	m68ki_write_16(ea+2, res & 0xFFFF );
-	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
+	m68ki_write_16<Types>(ea+2, res & 0xFFFF );
+	m68ki_write_16<Types>(ea, (res >> 16) & 0xFFFF );
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18425,13 +19002,14 @@ void m68000_base_device::x2108_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2110_move_l_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_32();
+	u32 res = OPER_AY_AI_32<Types>();
 	u32 ea = EA_AX_PD_32();
 
-	m68ki_write_16(ea+2, res & 0xFFFF );
-	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
+	m68ki_write_16<Types>(ea+2, res & 0xFFFF );
+	m68ki_write_16<Types>(ea, (res >> 16) & 0xFFFF );
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18440,13 +19018,14 @@ void m68000_base_device::x2110_move_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2118_move_l_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_32();
+	u32 res = OPER_AY_PI_32<Types>();
 	u32 ea = EA_AX_PD_32();
 
-	m68ki_write_16(ea+2, res & 0xFFFF );
-	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
+	m68ki_write_16<Types>(ea+2, res & 0xFFFF );
+	m68ki_write_16<Types>(ea, (res >> 16) & 0xFFFF );
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18455,13 +19034,14 @@ void m68000_base_device::x2118_move_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2120_move_l_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_32();
+	u32 res = OPER_AY_PD_32<Types>();
 	u32 ea = EA_AX_PD_32();
 
-	m68ki_write_16(ea+2, res & 0xFFFF );
-	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
+	m68ki_write_16<Types>(ea+2, res & 0xFFFF );
+	m68ki_write_16<Types>(ea, (res >> 16) & 0xFFFF );
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18470,13 +19050,14 @@ void m68000_base_device::x2120_move_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2128_move_l_di_071234fc()
 {
-	u32 res = OPER_AY_DI_32();
+	u32 res = OPER_AY_DI_32<Types>();
 	u32 ea = EA_AX_PD_32();
 
-	m68ki_write_16(ea+2, res & 0xFFFF );
-	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
+	m68ki_write_16<Types>(ea+2, res & 0xFFFF );
+	m68ki_write_16<Types>(ea, (res >> 16) & 0xFFFF );
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18485,13 +19066,14 @@ void m68000_base_device::x2128_move_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2130_move_l_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_32();
+	u32 res = OPER_AY_IX_32<Types>();
 	u32 ea = EA_AX_PD_32();
 
-	m68ki_write_16(ea+2, res & 0xFFFF );
-	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
+	m68ki_write_16<Types>(ea+2, res & 0xFFFF );
+	m68ki_write_16<Types>(ea, (res >> 16) & 0xFFFF );
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18500,13 +19082,14 @@ void m68000_base_device::x2130_move_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2138_move_l_aw_071234fc()
 {
-	u32 res = OPER_AW_32();
+	u32 res = OPER_AW_32<Types>();
 	u32 ea = EA_AX_PD_32();
 
-	m68ki_write_16(ea+2, res & 0xFFFF );
-	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
+	m68ki_write_16<Types>(ea+2, res & 0xFFFF );
+	m68ki_write_16<Types>(ea, (res >> 16) & 0xFFFF );
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18515,13 +19098,14 @@ void m68000_base_device::x2138_move_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2139_move_l_al_071234fc()
 {
-	u32 res = OPER_AL_32();
+	u32 res = OPER_AL_32<Types>();
 	u32 ea = EA_AX_PD_32();
 
-	m68ki_write_16(ea+2, res & 0xFFFF );
-	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
+	m68ki_write_16<Types>(ea+2, res & 0xFFFF );
+	m68ki_write_16<Types>(ea, (res >> 16) & 0xFFFF );
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18530,13 +19114,14 @@ void m68000_base_device::x2139_move_l_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x213a_move_l_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_32();
 	u32 ea = EA_AX_PD_32();
 
-	m68ki_write_16(ea+2, res & 0xFFFF );
-	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
+	m68ki_write_16<Types>(ea+2, res & 0xFFFF );
+	m68ki_write_16<Types>(ea, (res >> 16) & 0xFFFF );
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18545,13 +19130,14 @@ void m68000_base_device::x213a_move_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x213b_move_l_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_32();
+	u32 res = OPER_PCIX_32<Types>();
 	u32 ea = EA_AX_PD_32();
 
-	m68ki_write_16(ea+2, res & 0xFFFF );
-	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
+	m68ki_write_16<Types>(ea+2, res & 0xFFFF );
+	m68ki_write_16<Types>(ea, (res >> 16) & 0xFFFF );
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18560,13 +19146,14 @@ void m68000_base_device::x213b_move_l_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x213c_move_l_i_071234fc()
 {
 	u32 res = OPER_I_32();
 	u32 ea = EA_AX_PD_32();
 
-	m68ki_write_16(ea+2, res & 0xFFFF );
-	m68ki_write_16(ea, (res >> 16) & 0xFFFF );
+	m68ki_write_16<Types>(ea+2, res & 0xFFFF );
+	m68ki_write_16<Types>(ea, (res >> 16) & 0xFFFF );
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18575,12 +19162,13 @@ void m68000_base_device::x213c_move_l_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2140_move_l_071234fc()
 {
 	u32 res = DY();
 	u32 ea = EA_AX_DI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18589,12 +19177,13 @@ void m68000_base_device::x2140_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2148_move_l_071234fc()
 {
 	u32 res = AY();
 	u32 ea = EA_AX_DI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18603,12 +19192,13 @@ void m68000_base_device::x2148_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2150_move_l_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_32();
+	u32 res = OPER_AY_AI_32<Types>();
 	u32 ea = EA_AX_DI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18617,12 +19207,13 @@ void m68000_base_device::x2150_move_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2158_move_l_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_32();
+	u32 res = OPER_AY_PI_32<Types>();
 	u32 ea = EA_AX_DI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18631,12 +19222,13 @@ void m68000_base_device::x2158_move_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2160_move_l_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_32();
+	u32 res = OPER_AY_PD_32<Types>();
 	u32 ea = EA_AX_DI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18645,12 +19237,13 @@ void m68000_base_device::x2160_move_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2168_move_l_di_071234fc()
 {
-	u32 res = OPER_AY_DI_32();
+	u32 res = OPER_AY_DI_32<Types>();
 	u32 ea = EA_AX_DI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18659,12 +19252,13 @@ void m68000_base_device::x2168_move_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2170_move_l_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_32();
+	u32 res = OPER_AY_IX_32<Types>();
 	u32 ea = EA_AX_DI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18673,12 +19267,13 @@ void m68000_base_device::x2170_move_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2178_move_l_aw_071234fc()
 {
-	u32 res = OPER_AW_32();
+	u32 res = OPER_AW_32<Types>();
 	u32 ea = EA_AX_DI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18687,12 +19282,13 @@ void m68000_base_device::x2178_move_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2179_move_l_al_071234fc()
 {
-	u32 res = OPER_AL_32();
+	u32 res = OPER_AL_32<Types>();
 	u32 ea = EA_AX_DI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18701,12 +19297,13 @@ void m68000_base_device::x2179_move_l_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x217a_move_l_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_32();
 	u32 ea = EA_AX_DI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18715,12 +19312,13 @@ void m68000_base_device::x217a_move_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x217b_move_l_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_32();
+	u32 res = OPER_PCIX_32<Types>();
 	u32 ea = EA_AX_DI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18729,12 +19327,13 @@ void m68000_base_device::x217b_move_l_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x217c_move_l_i_071234fc()
 {
 	u32 res = OPER_I_32();
 	u32 ea = EA_AX_DI_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18743,12 +19342,13 @@ void m68000_base_device::x217c_move_l_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2180_move_l_071234fc()
 {
 	u32 res = DY();
-	u32 ea = EA_AX_IX_32();
+	u32 ea = EA_AX_IX_32<Types>();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18757,12 +19357,13 @@ void m68000_base_device::x2180_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2188_move_l_071234fc()
 {
 	u32 res = AY();
-	u32 ea = EA_AX_IX_32();
+	u32 ea = EA_AX_IX_32<Types>();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18771,12 +19372,13 @@ void m68000_base_device::x2188_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2190_move_l_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_32();
-	u32 ea = EA_AX_IX_32();
+	u32 res = OPER_AY_AI_32<Types>();
+	u32 ea = EA_AX_IX_32<Types>();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18785,12 +19387,13 @@ void m68000_base_device::x2190_move_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2198_move_l_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_32();
-	u32 ea = EA_AX_IX_32();
+	u32 res = OPER_AY_PI_32<Types>();
+	u32 ea = EA_AX_IX_32<Types>();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18799,12 +19402,13 @@ void m68000_base_device::x2198_move_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21a0_move_l_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_32();
-	u32 ea = EA_AX_IX_32();
+	u32 res = OPER_AY_PD_32<Types>();
+	u32 ea = EA_AX_IX_32<Types>();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18813,12 +19417,13 @@ void m68000_base_device::x21a0_move_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21a8_move_l_di_071234fc()
 {
-	u32 res = OPER_AY_DI_32();
-	u32 ea = EA_AX_IX_32();
+	u32 res = OPER_AY_DI_32<Types>();
+	u32 ea = EA_AX_IX_32<Types>();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18827,12 +19432,13 @@ void m68000_base_device::x21a8_move_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21b0_move_l_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_32();
-	u32 ea = EA_AX_IX_32();
+	u32 res = OPER_AY_IX_32<Types>();
+	u32 ea = EA_AX_IX_32<Types>();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18841,12 +19447,13 @@ void m68000_base_device::x21b0_move_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21b8_move_l_aw_071234fc()
 {
-	u32 res = OPER_AW_32();
-	u32 ea = EA_AX_IX_32();
+	u32 res = OPER_AW_32<Types>();
+	u32 ea = EA_AX_IX_32<Types>();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18855,12 +19462,13 @@ void m68000_base_device::x21b8_move_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21b9_move_l_al_071234fc()
 {
-	u32 res = OPER_AL_32();
-	u32 ea = EA_AX_IX_32();
+	u32 res = OPER_AL_32<Types>();
+	u32 ea = EA_AX_IX_32<Types>();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18869,12 +19477,13 @@ void m68000_base_device::x21b9_move_l_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21ba_move_l_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_32();
-	u32 ea = EA_AX_IX_32();
+	u32 ea = EA_AX_IX_32<Types>();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18883,12 +19492,13 @@ void m68000_base_device::x21ba_move_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21bb_move_l_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_32();
-	u32 ea = EA_AX_IX_32();
+	u32 res = OPER_PCIX_32<Types>();
+	u32 ea = EA_AX_IX_32<Types>();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18897,12 +19507,13 @@ void m68000_base_device::x21bb_move_l_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21bc_move_l_i_071234fc()
 {
 	u32 res = OPER_I_32();
-	u32 ea = EA_AX_IX_32();
+	u32 ea = EA_AX_IX_32<Types>();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18911,12 +19522,13 @@ void m68000_base_device::x21bc_move_l_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21c0_move_l_071234fc()
 {
 	u32 res = DY();
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18925,12 +19537,13 @@ void m68000_base_device::x21c0_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21c8_move_l_071234fc()
 {
 	u32 res = AY();
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18939,12 +19552,13 @@ void m68000_base_device::x21c8_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21d0_move_l_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_32();
+	u32 res = OPER_AY_AI_32<Types>();
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18953,12 +19567,13 @@ void m68000_base_device::x21d0_move_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21d8_move_l_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_32();
+	u32 res = OPER_AY_PI_32<Types>();
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18967,12 +19582,13 @@ void m68000_base_device::x21d8_move_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21e0_move_l_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_32();
+	u32 res = OPER_AY_PD_32<Types>();
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18981,12 +19597,13 @@ void m68000_base_device::x21e0_move_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21e8_move_l_di_071234fc()
 {
-	u32 res = OPER_AY_DI_32();
+	u32 res = OPER_AY_DI_32<Types>();
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -18995,12 +19612,13 @@ void m68000_base_device::x21e8_move_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21f0_move_l_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_32();
+	u32 res = OPER_AY_IX_32<Types>();
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19009,12 +19627,13 @@ void m68000_base_device::x21f0_move_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21f8_move_l_aw_071234fc()
 {
-	u32 res = OPER_AW_32();
+	u32 res = OPER_AW_32<Types>();
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19023,12 +19642,13 @@ void m68000_base_device::x21f8_move_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21f9_move_l_al_071234fc()
 {
-	u32 res = OPER_AL_32();
+	u32 res = OPER_AL_32<Types>();
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19037,12 +19657,13 @@ void m68000_base_device::x21f9_move_l_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21fa_move_l_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_32();
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19051,12 +19672,13 @@ void m68000_base_device::x21fa_move_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21fb_move_l_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_32();
+	u32 res = OPER_PCIX_32<Types>();
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19065,12 +19687,13 @@ void m68000_base_device::x21fb_move_l_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x21fc_move_l_i_071234fc()
 {
 	u32 res = OPER_I_32();
 	u32 ea = EA_AW_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19079,12 +19702,13 @@ void m68000_base_device::x21fc_move_l_i_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x23c0_move_l_071234fc()
 {
 	u32 res = DY();
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19093,12 +19717,13 @@ void m68000_base_device::x23c0_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x23c8_move_l_071234fc()
 {
 	u32 res = AY();
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19107,12 +19732,13 @@ void m68000_base_device::x23c8_move_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x23d0_move_l_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_32();
+	u32 res = OPER_AY_AI_32<Types>();
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19121,12 +19747,13 @@ void m68000_base_device::x23d0_move_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x23d8_move_l_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_32();
+	u32 res = OPER_AY_PI_32<Types>();
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19135,12 +19762,13 @@ void m68000_base_device::x23d8_move_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x23e0_move_l_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_32();
+	u32 res = OPER_AY_PD_32<Types>();
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19149,12 +19777,13 @@ void m68000_base_device::x23e0_move_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x23e8_move_l_di_071234fc()
 {
-	u32 res = OPER_AY_DI_32();
+	u32 res = OPER_AY_DI_32<Types>();
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19163,12 +19792,13 @@ void m68000_base_device::x23e8_move_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x23f0_move_l_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_32();
+	u32 res = OPER_AY_IX_32<Types>();
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19177,12 +19807,13 @@ void m68000_base_device::x23f0_move_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x23f8_move_l_aw_071234fc()
 {
-	u32 res = OPER_AW_32();
+	u32 res = OPER_AW_32<Types>();
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19191,12 +19822,13 @@ void m68000_base_device::x23f8_move_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x23f9_move_l_al_071234fc()
 {
-	u32 res = OPER_AL_32();
+	u32 res = OPER_AL_32<Types>();
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19205,12 +19837,13 @@ void m68000_base_device::x23f9_move_l_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x23fa_move_l_pcdi_071234fc()
 {
 	u32 res = OPER_PCDI_32();
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19219,12 +19852,13 @@ void m68000_base_device::x23fa_move_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x23fb_move_l_pcix_071234fc()
 {
-	u32 res = OPER_PCIX_32();
+	u32 res = OPER_PCIX_32<Types>();
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19233,12 +19867,13 @@ void m68000_base_device::x23fb_move_l_pcix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x23fc_move_l_i_071234fc()
 {
 	u32 res = OPER_I_32();
 	u32 ea = EA_AL_32();
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -19259,45 +19894,52 @@ void m68000_base_device::x3048_movea_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3050_movea_w_ai_071234fc()
 {
-	AX() = MAKE_INT_16(OPER_AY_AI_16());
+	AX() = MAKE_INT_16(OPER_AY_AI_16<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3058_movea_w_pi_071234fc()
 {
-	AX() = MAKE_INT_16(OPER_AY_PI_16());
+	AX() = MAKE_INT_16(OPER_AY_PI_16<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3060_movea_w_pd_071234fc()
 {
-	AX() = MAKE_INT_16(OPER_AY_PD_16());
+	AX() = MAKE_INT_16(OPER_AY_PD_16<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3068_movea_w_di_071234fc()
 {
-	AX() = MAKE_INT_16(OPER_AY_DI_16());
+	AX() = MAKE_INT_16(OPER_AY_DI_16<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3070_movea_w_ix_071234fc()
 {
-	AX() = MAKE_INT_16(OPER_AY_IX_16());
+	AX() = MAKE_INT_16(OPER_AY_IX_16<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3078_movea_w_aw_071234fc()
 {
-	AX() = MAKE_INT_16(OPER_AW_16());
+	AX() = MAKE_INT_16(OPER_AW_16<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x3079_movea_w_al_071234fc()
 {
-	AX() = MAKE_INT_16(OPER_AL_16());
+	AX() = MAKE_INT_16(OPER_AL_16<Types>());
 
 
 }
@@ -19307,9 +19949,10 @@ void m68000_base_device::x307a_movea_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x307b_movea_w_pcix_071234fc()
 {
-	AX() = MAKE_INT_16(OPER_PCIX_16());
+	AX() = MAKE_INT_16(OPER_PCIX_16<Types>());
 
 
 }
@@ -19331,45 +19974,52 @@ void m68000_base_device::x2048_movea_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2050_movea_l_ai_071234fc()
 {
-	AX() = OPER_AY_AI_32();
+	AX() = OPER_AY_AI_32<Types>();
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2058_movea_l_pi_071234fc()
 {
-	AX() = OPER_AY_PI_32();
+	AX() = OPER_AY_PI_32<Types>();
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2060_movea_l_pd_071234fc()
 {
-	AX() = OPER_AY_PD_32();
+	AX() = OPER_AY_PD_32<Types>();
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2068_movea_l_di_071234fc()
 {
-	AX() = OPER_AY_DI_32();
+	AX() = OPER_AY_DI_32<Types>();
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2070_movea_l_ix_071234fc()
 {
-	AX() = OPER_AY_IX_32();
+	AX() = OPER_AY_IX_32<Types>();
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2078_movea_l_aw_071234fc()
 {
-	AX() = OPER_AW_32();
+	AX() = OPER_AW_32<Types>();
 
 
 }
+template <u32 Types>
 void m68000_base_device::x2079_movea_l_al_071234fc()
 {
-	AX() = OPER_AL_32();
+	AX() = OPER_AL_32<Types>();
 
 
 }
@@ -19379,9 +20029,10 @@ void m68000_base_device::x207a_movea_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x207b_movea_l_pcix_071234fc()
 {
-	AX() = OPER_PCIX_32();
+	AX() = OPER_PCIX_32<Types>();
 
 
 }
@@ -19397,45 +20048,52 @@ void m68000_base_device::x42c0_move_w_1234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42d0_move_w_ai_1234fc()
 {
-	m68ki_write_16(EA_AY_AI_16(), m68ki_get_ccr());
+	m68ki_write_16<Types>(EA_AY_AI_16(), m68ki_get_ccr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42d8_move_w_pi_1234fc()
 {
-	m68ki_write_16(EA_AY_PI_16(), m68ki_get_ccr());
+	m68ki_write_16<Types>(EA_AY_PI_16(), m68ki_get_ccr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42e0_move_w_pd_1234fc()
 {
-	m68ki_write_16(EA_AY_PD_16(), m68ki_get_ccr());
+	m68ki_write_16<Types>(EA_AY_PD_16(), m68ki_get_ccr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42e8_move_w_di_1234fc()
 {
-	m68ki_write_16(EA_AY_DI_16(), m68ki_get_ccr());
+	m68ki_write_16<Types>(EA_AY_DI_16(), m68ki_get_ccr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42f0_move_w_ix_1234fc()
 {
-	m68ki_write_16(EA_AY_IX_16(), m68ki_get_ccr());
+	m68ki_write_16<Types>(EA_AY_IX_16<Types>(), m68ki_get_ccr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42f8_move_w_aw_1234fc()
 {
-	m68ki_write_16(EA_AW_16(), m68ki_get_ccr());
+	m68ki_write_16<Types>(EA_AW_16(), m68ki_get_ccr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x42f9_move_w_al_1234fc()
 {
-	m68ki_write_16(EA_AL_16(), m68ki_get_ccr());
+	m68ki_write_16<Types>(EA_AL_16(), m68ki_get_ccr());
 
 
 }
@@ -19445,45 +20103,52 @@ void m68000_base_device::x44c0_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44d0_move_w_ai_071234fc()
 {
-	m68ki_set_ccr(OPER_AY_AI_16());
+	m68ki_set_ccr(OPER_AY_AI_16<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44d8_move_w_pi_071234fc()
 {
-	m68ki_set_ccr(OPER_AY_PI_16());
+	m68ki_set_ccr(OPER_AY_PI_16<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44e0_move_w_pd_071234fc()
 {
-	m68ki_set_ccr(OPER_AY_PD_16());
+	m68ki_set_ccr(OPER_AY_PD_16<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44e8_move_w_di_071234fc()
 {
-	m68ki_set_ccr(OPER_AY_DI_16());
+	m68ki_set_ccr(OPER_AY_DI_16<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44f0_move_w_ix_071234fc()
 {
-	m68ki_set_ccr(OPER_AY_IX_16());
+	m68ki_set_ccr(OPER_AY_IX_16<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44f8_move_w_aw_071234fc()
 {
-	m68ki_set_ccr(OPER_AW_16());
+	m68ki_set_ccr(OPER_AW_16<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44f9_move_w_al_071234fc()
 {
-	m68ki_set_ccr(OPER_AL_16());
+	m68ki_set_ccr(OPER_AL_16<Types>());
 
 
 }
@@ -19493,9 +20158,10 @@ void m68000_base_device::x44fa_move_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44fb_move_w_pcix_071234fc()
 {
-	m68ki_set_ccr(OPER_PCIX_16());
+	m68ki_set_ccr(OPER_PCIX_16<Types>());
 
 
 }
@@ -19521,126 +20187,140 @@ void m68000_base_device::x40c0_move_w_1234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40d0_move_w_ai_07()
 {
 	u32 ea = EA_AY_AI_16();
-	m68ki_write_16(ea, m68ki_get_sr());
+	m68ki_write_16<Types>(ea, m68ki_get_sr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40d8_move_w_pi_07()
 {
 	u32 ea = EA_AY_PI_16();
-	m68ki_write_16(ea, m68ki_get_sr());
+	m68ki_write_16<Types>(ea, m68ki_get_sr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40e0_move_w_pd_07()
 {
 	u32 ea = EA_AY_PD_16();
-	m68ki_write_16(ea, m68ki_get_sr());
+	m68ki_write_16<Types>(ea, m68ki_get_sr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40e8_move_w_di_07()
 {
 	u32 ea = EA_AY_DI_16();
-	m68ki_write_16(ea, m68ki_get_sr());
+	m68ki_write_16<Types>(ea, m68ki_get_sr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40f0_move_w_ix_07()
 {
-	u32 ea = EA_AY_IX_16();
-	m68ki_write_16(ea, m68ki_get_sr());
+	u32 ea = EA_AY_IX_16<Types>();
+	m68ki_write_16<Types>(ea, m68ki_get_sr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40f8_move_w_aw_07()
 {
 	u32 ea = EA_AW_16();
-	m68ki_write_16(ea, m68ki_get_sr());
+	m68ki_write_16<Types>(ea, m68ki_get_sr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40f9_move_w_al_07()
 {
 	u32 ea = EA_AL_16();
-	m68ki_write_16(ea, m68ki_get_sr());
+	m68ki_write_16<Types>(ea, m68ki_get_sr());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40d0_move_w_ai_1234fc()
 {
 	if(m_s_flag) { /* NS990408 */
 		u32 ea = EA_AY_AI_16();
-		m68ki_write_16(ea, m68ki_get_sr());
+		m68ki_write_16<Types>(ea, m68ki_get_sr());
 	} else {
 		m68ki_exception_privilege_violation();
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40d8_move_w_pi_1234fc()
 {
 	if(m_s_flag) { /* NS990408 */
 		u32 ea = EA_AY_PI_16();
-		m68ki_write_16(ea, m68ki_get_sr());
+		m68ki_write_16<Types>(ea, m68ki_get_sr());
 	} else {
 		m68ki_exception_privilege_violation();
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40e0_move_w_pd_1234fc()
 {
 	if(m_s_flag) { /* NS990408 */
 		u32 ea = EA_AY_PD_16();
-		m68ki_write_16(ea, m68ki_get_sr());
+		m68ki_write_16<Types>(ea, m68ki_get_sr());
 	} else {
 		m68ki_exception_privilege_violation();
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40e8_move_w_di_1234fc()
 {
 	if(m_s_flag) { /* NS990408 */
 		u32 ea = EA_AY_DI_16();
-		m68ki_write_16(ea, m68ki_get_sr());
+		m68ki_write_16<Types>(ea, m68ki_get_sr());
 	} else {
 		m68ki_exception_privilege_violation();
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40f0_move_w_ix_1234fc()
 {
 	if(m_s_flag) { /* NS990408 */
-		u32 ea = EA_AY_IX_16();
-		m68ki_write_16(ea, m68ki_get_sr());
+		u32 ea = EA_AY_IX_16<Types>();
+		m68ki_write_16<Types>(ea, m68ki_get_sr());
 	} else {
 		m68ki_exception_privilege_violation();
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40f8_move_w_aw_1234fc()
 {
 	if(m_s_flag) { /* NS990408 */
 		u32 ea = EA_AW_16();
-		m68ki_write_16(ea, m68ki_get_sr());
+		m68ki_write_16<Types>(ea, m68ki_get_sr());
 	} else {
 		m68ki_exception_privilege_violation();
 	}
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40f9_move_w_al_1234fc()
 {
 	if(m_s_flag) { /* NS990408 */
 		u32 ea = EA_AL_16();
-		m68ki_write_16(ea, m68ki_get_sr());
+		m68ki_write_16<Types>(ea, m68ki_get_sr());
 	} else {
 		m68ki_exception_privilege_violation();
 	}
@@ -19657,10 +20337,11 @@ void m68000_base_device::x46c0_move_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46d0_move_w_ai_071234fc()
 {
 	if(m_s_flag) {
-		u32 new_sr = OPER_AY_AI_16();
+		u32 new_sr = OPER_AY_AI_16<Types>();
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 		m68ki_set_sr(new_sr);
 
@@ -19670,10 +20351,11 @@ void m68000_base_device::x46d0_move_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46d8_move_w_pi_071234fc()
 {
 	if(m_s_flag) {
-		u32 new_sr = OPER_AY_PI_16();
+		u32 new_sr = OPER_AY_PI_16<Types>();
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 		m68ki_set_sr(new_sr);
 
@@ -19683,10 +20365,11 @@ void m68000_base_device::x46d8_move_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46e0_move_w_pd_071234fc()
 {
 	if(m_s_flag) {
-		u32 new_sr = OPER_AY_PD_16();
+		u32 new_sr = OPER_AY_PD_16<Types>();
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 		m68ki_set_sr(new_sr);
 
@@ -19696,10 +20379,11 @@ void m68000_base_device::x46e0_move_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46e8_move_w_di_071234fc()
 {
 	if(m_s_flag) {
-		u32 new_sr = OPER_AY_DI_16();
+		u32 new_sr = OPER_AY_DI_16<Types>();
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 		m68ki_set_sr(new_sr);
 
@@ -19709,10 +20393,11 @@ void m68000_base_device::x46e8_move_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46f0_move_w_ix_071234fc()
 {
 	if(m_s_flag) {
-		u32 new_sr = OPER_AY_IX_16();
+		u32 new_sr = OPER_AY_IX_16<Types>();
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 		m68ki_set_sr(new_sr);
 
@@ -19722,10 +20407,11 @@ void m68000_base_device::x46f0_move_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46f8_move_w_aw_071234fc()
 {
 	if(m_s_flag) {
-		u32 new_sr = OPER_AW_16();
+		u32 new_sr = OPER_AW_16<Types>();
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 		m68ki_set_sr(new_sr);
 
@@ -19735,10 +20421,11 @@ void m68000_base_device::x46f8_move_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46f9_move_w_al_071234fc()
 {
 	if(m_s_flag) {
-		u32 new_sr = OPER_AL_16();
+		u32 new_sr = OPER_AL_16<Types>();
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 		m68ki_set_sr(new_sr);
 
@@ -19761,10 +20448,11 @@ void m68000_base_device::x46fa_move_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46fb_move_w_pcix_071234fc()
 {
 	if(m_s_flag) {
-		u32 new_sr = OPER_PCIX_16();
+		u32 new_sr = OPER_PCIX_16<Types>();
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 		m68ki_set_sr(new_sr);
 
@@ -20339,6 +21027,7 @@ void m68000_base_device::x4e7b_movec_l_c()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x48a0_movem_w_071234fc()
 {
 	u32 i = 0;
@@ -20349,7 +21038,7 @@ void m68000_base_device::x48a0_movem_w_071234fc()
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
 			ea -= 2;
-			m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA()[15-i]));
+			m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_DA()[15-i]));
 			count++;
 		}
 	AY() = ea;
@@ -20358,6 +21047,7 @@ void m68000_base_device::x48a0_movem_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4890_movem_w_ai_071234fc()
 {
 	u32 i = 0;
@@ -20367,7 +21057,7 @@ void m68000_base_device::x4890_movem_w_ai_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA()[i]));
+			m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_DA()[i]));
 			ea += 2;
 			count++;
 		}
@@ -20376,6 +21066,7 @@ void m68000_base_device::x4890_movem_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x48a8_movem_w_di_071234fc()
 {
 	u32 i = 0;
@@ -20385,7 +21076,7 @@ void m68000_base_device::x48a8_movem_w_di_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA()[i]));
+			m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_DA()[i]));
 			ea += 2;
 			count++;
 		}
@@ -20394,16 +21085,17 @@ void m68000_base_device::x48a8_movem_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x48b0_movem_w_ix_071234fc()
 {
 	u32 i = 0;
 	u32 register_list = OPER_I_16();
-	u32 ea = EA_AY_IX_16();
+	u32 ea = EA_AY_IX_16<Types>();
 	u32 count = 0;
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA()[i]));
+			m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_DA()[i]));
 			ea += 2;
 			count++;
 		}
@@ -20412,6 +21104,7 @@ void m68000_base_device::x48b0_movem_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x48b8_movem_w_aw_071234fc()
 {
 	u32 i = 0;
@@ -20421,7 +21114,7 @@ void m68000_base_device::x48b8_movem_w_aw_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA()[i]));
+			m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_DA()[i]));
 			ea += 2;
 			count++;
 		}
@@ -20430,6 +21123,7 @@ void m68000_base_device::x48b8_movem_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x48b9_movem_w_al_071234fc()
 {
 	u32 i = 0;
@@ -20439,7 +21133,7 @@ void m68000_base_device::x48b9_movem_w_al_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			m68ki_write_16(ea, MASK_OUT_ABOVE_16(REG_DA()[i]));
+			m68ki_write_16<Types>(ea, MASK_OUT_ABOVE_16(REG_DA()[i]));
 			ea += 2;
 			count++;
 		}
@@ -20448,6 +21142,7 @@ void m68000_base_device::x48b9_movem_w_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x48e0_movem_l_071234fc()
 {
 	u32 i = 0;
@@ -20458,8 +21153,8 @@ void m68000_base_device::x48e0_movem_l_071234fc()
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
 			ea -= 4;
-			m68ki_write_16(ea+2, REG_DA()[15-i] & 0xFFFF );
-			m68ki_write_16(ea, (REG_DA()[15-i] >> 16) & 0xFFFF );
+			m68ki_write_16<Types>(ea+2, REG_DA()[15-i] & 0xFFFF );
+			m68ki_write_16<Types>(ea, (REG_DA()[15-i] >> 16) & 0xFFFF );
 			count++;
 		}
 	AY() = ea;
@@ -20468,6 +21163,7 @@ void m68000_base_device::x48e0_movem_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x48d0_movem_l_ai_071234fc()
 {
 	u32 i = 0;
@@ -20477,7 +21173,7 @@ void m68000_base_device::x48d0_movem_l_ai_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			m68ki_write_32(ea, REG_DA()[i]);
+			m68ki_write_32<Types>(ea, REG_DA()[i]);
 			ea += 4;
 			count++;
 		}
@@ -20486,6 +21182,7 @@ void m68000_base_device::x48d0_movem_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x48e8_movem_l_di_071234fc()
 {
 	u32 i = 0;
@@ -20495,7 +21192,7 @@ void m68000_base_device::x48e8_movem_l_di_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			m68ki_write_32(ea, REG_DA()[i]);
+			m68ki_write_32<Types>(ea, REG_DA()[i]);
 			ea += 4;
 			count++;
 		}
@@ -20504,16 +21201,17 @@ void m68000_base_device::x48e8_movem_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x48f0_movem_l_ix_071234fc()
 {
 	u32 i = 0;
 	u32 register_list = OPER_I_16();
-	u32 ea = EA_AY_IX_32();
+	u32 ea = EA_AY_IX_32<Types>();
 	u32 count = 0;
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			m68ki_write_32(ea, REG_DA()[i]);
+			m68ki_write_32<Types>(ea, REG_DA()[i]);
 			ea += 4;
 			count++;
 		}
@@ -20522,6 +21220,7 @@ void m68000_base_device::x48f0_movem_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x48f8_movem_l_aw_071234fc()
 {
 	u32 i = 0;
@@ -20531,7 +21230,7 @@ void m68000_base_device::x48f8_movem_l_aw_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			m68ki_write_32(ea, REG_DA()[i]);
+			m68ki_write_32<Types>(ea, REG_DA()[i]);
 			ea += 4;
 			count++;
 		}
@@ -20540,6 +21239,7 @@ void m68000_base_device::x48f8_movem_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x48f9_movem_l_al_071234fc()
 {
 	u32 i = 0;
@@ -20549,7 +21249,7 @@ void m68000_base_device::x48f9_movem_l_al_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			m68ki_write_32(ea, REG_DA()[i]);
+			m68ki_write_32<Types>(ea, REG_DA()[i]);
 			ea += 4;
 			count++;
 		}
@@ -20558,6 +21258,7 @@ void m68000_base_device::x48f9_movem_l_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4c98_movem_w_071234fc()
 {
 	u32 i = 0;
@@ -20567,7 +21268,7 @@ void m68000_base_device::x4c98_movem_w_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			REG_DA()[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+			REG_DA()[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16<Types>(ea)));
 			ea += 2;
 			count++;
 		}
@@ -20595,11 +21296,12 @@ void m68000_base_device::x4cba_movem_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4cbb_movem_w_071234fc()
 {
 	u32 i = 0;
 	u32 register_list = OPER_I_16();
-	u32 ea = EA_PCIX_16();
+	u32 ea = EA_PCIX_16<Types>();
 	u32 count = 0;
 
 	for(; i < 16; i++)
@@ -20613,6 +21315,7 @@ void m68000_base_device::x4cbb_movem_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4c90_movem_w_ai_071234fc()
 {
 	u32 i = 0;
@@ -20622,7 +21325,7 @@ void m68000_base_device::x4c90_movem_w_ai_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			REG_DA()[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+			REG_DA()[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16<Types>(ea)));
 			ea += 2;
 			count++;
 		}
@@ -20631,6 +21334,7 @@ void m68000_base_device::x4c90_movem_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ca8_movem_w_di_071234fc()
 {
 	u32 i = 0;
@@ -20640,7 +21344,7 @@ void m68000_base_device::x4ca8_movem_w_di_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			REG_DA()[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+			REG_DA()[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16<Types>(ea)));
 			ea += 2;
 			count++;
 		}
@@ -20649,16 +21353,17 @@ void m68000_base_device::x4ca8_movem_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4cb0_movem_w_ix_071234fc()
 {
 	u32 i = 0;
 	u32 register_list = OPER_I_16();
-	u32 ea = EA_AY_IX_16();
+	u32 ea = EA_AY_IX_16<Types>();
 	u32 count = 0;
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			REG_DA()[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+			REG_DA()[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16<Types>(ea)));
 			ea += 2;
 			count++;
 		}
@@ -20667,6 +21372,7 @@ void m68000_base_device::x4cb0_movem_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4cb8_movem_w_aw_071234fc()
 {
 	u32 i = 0;
@@ -20676,7 +21382,7 @@ void m68000_base_device::x4cb8_movem_w_aw_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			REG_DA()[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+			REG_DA()[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16<Types>(ea)));
 			ea += 2;
 			count++;
 		}
@@ -20685,6 +21391,7 @@ void m68000_base_device::x4cb8_movem_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4cb9_movem_w_al_071234fc()
 {
 	u32 i = 0;
@@ -20694,7 +21401,7 @@ void m68000_base_device::x4cb9_movem_w_al_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			REG_DA()[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(ea)));
+			REG_DA()[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16<Types>(ea)));
 			ea += 2;
 			count++;
 		}
@@ -20703,6 +21410,7 @@ void m68000_base_device::x4cb9_movem_w_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4cd8_movem_l_071234fc()
 {
 	u32 i = 0;
@@ -20712,7 +21420,7 @@ void m68000_base_device::x4cd8_movem_l_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			REG_DA()[i] = m68ki_read_32(ea);
+			REG_DA()[i] = m68ki_read_32<Types>(ea);
 			ea += 4;
 			count++;
 		}
@@ -20740,11 +21448,12 @@ void m68000_base_device::x4cfa_movem_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4cfb_movem_l_071234fc()
 {
 	u32 i = 0;
 	u32 register_list = OPER_I_16();
-	u32 ea = EA_PCIX_32();
+	u32 ea = EA_PCIX_32<Types>();
 	u32 count = 0;
 
 	for(; i < 16; i++)
@@ -20758,6 +21467,7 @@ void m68000_base_device::x4cfb_movem_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4cd0_movem_l_ai_071234fc()
 {
 	u32 i = 0;
@@ -20767,7 +21477,7 @@ void m68000_base_device::x4cd0_movem_l_ai_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			REG_DA()[i] = m68ki_read_32(ea);
+			REG_DA()[i] = m68ki_read_32<Types>(ea);
 			ea += 4;
 			count++;
 		}
@@ -20776,6 +21486,7 @@ void m68000_base_device::x4cd0_movem_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ce8_movem_l_di_071234fc()
 {
 	u32 i = 0;
@@ -20785,7 +21496,7 @@ void m68000_base_device::x4ce8_movem_l_di_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			REG_DA()[i] = m68ki_read_32(ea);
+			REG_DA()[i] = m68ki_read_32<Types>(ea);
 			ea += 4;
 			count++;
 		}
@@ -20794,16 +21505,17 @@ void m68000_base_device::x4ce8_movem_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4cf0_movem_l_ix_071234fc()
 {
 	u32 i = 0;
 	u32 register_list = OPER_I_16();
-	u32 ea = EA_AY_IX_32();
+	u32 ea = EA_AY_IX_32<Types>();
 	u32 count = 0;
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			REG_DA()[i] = m68ki_read_32(ea);
+			REG_DA()[i] = m68ki_read_32<Types>(ea);
 			ea += 4;
 			count++;
 		}
@@ -20812,6 +21524,7 @@ void m68000_base_device::x4cf0_movem_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4cf8_movem_l_aw_071234fc()
 {
 	u32 i = 0;
@@ -20821,7 +21534,7 @@ void m68000_base_device::x4cf8_movem_l_aw_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			REG_DA()[i] = m68ki_read_32(ea);
+			REG_DA()[i] = m68ki_read_32<Types>(ea);
 			ea += 4;
 			count++;
 		}
@@ -20830,6 +21543,7 @@ void m68000_base_device::x4cf8_movem_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4cf9_movem_l_al_071234fc()
 {
 	u32 i = 0;
@@ -20839,7 +21553,7 @@ void m68000_base_device::x4cf9_movem_l_al_071234fc()
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i)) {
-			REG_DA()[i] = m68ki_read_32(ea);
+			REG_DA()[i] = m68ki_read_32<Types>(ea);
 			ea += 4;
 			count++;
 		}
@@ -21020,12 +21734,13 @@ void m68000_base_device::x0e28_moves_b_di_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e30_moves_b_ix_134fc()
 {
 	if(m_s_flag)
 	{
 		u32 word2 = OPER_I_16();
-		u32 ea = EA_AY_IX_8();
+		u32 ea = EA_AY_IX_8<Types>();
 
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {             /* Register to memory */
@@ -21230,12 +21945,13 @@ void m68000_base_device::x0e28_moves_b_di_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e30_moves_b_ix_2()
 {
 	if(m_s_flag)
 	{
 		u32 word2 = OPER_I_16();
-		u32 ea = EA_AY_IX_8();
+		u32 ea = EA_AY_IX_8<Types>();
 
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {             /* Register to memory */
@@ -21302,6 +22018,7 @@ void m68000_base_device::x0e39_moves_b_al_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e50_moves_w_ai_134fc()
 {
 	if(m_s_flag) {
@@ -21310,12 +22027,12 @@ void m68000_base_device::x0e50_moves_w_ai_134fc()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21323,6 +22040,7 @@ void m68000_base_device::x0e50_moves_w_ai_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e58_moves_w_pi_134fc()
 {
 	if(m_s_flag) {
@@ -21331,12 +22049,12 @@ void m68000_base_device::x0e58_moves_w_pi_134fc()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21344,6 +22062,7 @@ void m68000_base_device::x0e58_moves_w_pi_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e60_moves_w_pd_134fc()
 {
 	if(m_s_flag) {
@@ -21352,12 +22071,12 @@ void m68000_base_device::x0e60_moves_w_pd_134fc()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21365,6 +22084,7 @@ void m68000_base_device::x0e60_moves_w_pd_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e68_moves_w_di_134fc()
 {
 	if(m_s_flag) {
@@ -21373,12 +22093,12 @@ void m68000_base_device::x0e68_moves_w_di_134fc()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21386,20 +22106,21 @@ void m68000_base_device::x0e68_moves_w_di_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e70_moves_w_ix_134fc()
 {
 	if(m_s_flag) {
 		u32 word2 = OPER_I_16();
-		u32 ea = EA_AY_IX_16();
+		u32 ea = EA_AY_IX_16<Types>();
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21407,6 +22128,7 @@ void m68000_base_device::x0e70_moves_w_ix_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e78_moves_w_aw_134fc()
 {
 	if(m_s_flag) {
@@ -21415,12 +22137,12 @@ void m68000_base_device::x0e78_moves_w_aw_134fc()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21428,6 +22150,7 @@ void m68000_base_device::x0e78_moves_w_aw_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e79_moves_w_al_134fc()
 {
 	if(m_s_flag) {
@@ -21436,12 +22159,12 @@ void m68000_base_device::x0e79_moves_w_al_134fc()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21449,6 +22172,7 @@ void m68000_base_device::x0e79_moves_w_al_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e50_moves_w_ai_2()
 {
 	if(m_s_flag) {
@@ -21457,13 +22181,13 @@ void m68000_base_device::x0e50_moves_w_ai_2()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 			m_icount -= 2;
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21472,6 +22196,7 @@ void m68000_base_device::x0e50_moves_w_ai_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e58_moves_w_pi_2()
 {
 	if(m_s_flag) {
@@ -21480,13 +22205,13 @@ void m68000_base_device::x0e58_moves_w_pi_2()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 			m_icount -= 2;
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21495,6 +22220,7 @@ void m68000_base_device::x0e58_moves_w_pi_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e60_moves_w_pd_2()
 {
 	if(m_s_flag) {
@@ -21503,13 +22229,13 @@ void m68000_base_device::x0e60_moves_w_pd_2()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 			m_icount -= 2;
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21518,6 +22244,7 @@ void m68000_base_device::x0e60_moves_w_pd_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e68_moves_w_di_2()
 {
 	if(m_s_flag) {
@@ -21526,13 +22253,13 @@ void m68000_base_device::x0e68_moves_w_di_2()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 			m_icount -= 2;
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21541,21 +22268,22 @@ void m68000_base_device::x0e68_moves_w_di_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e70_moves_w_ix_2()
 {
 	if(m_s_flag) {
 		u32 word2 = OPER_I_16();
-		u32 ea = EA_AY_IX_16();
+		u32 ea = EA_AY_IX_16<Types>();
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 			m_icount -= 2;
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21564,6 +22292,7 @@ void m68000_base_device::x0e70_moves_w_ix_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e78_moves_w_aw_2()
 {
 	if(m_s_flag) {
@@ -21572,13 +22301,13 @@ void m68000_base_device::x0e78_moves_w_aw_2()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 			m_icount -= 2;
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21587,6 +22316,7 @@ void m68000_base_device::x0e78_moves_w_aw_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e79_moves_w_al_2()
 {
 	if(m_s_flag) {
@@ -21595,13 +22325,13 @@ void m68000_base_device::x0e79_moves_w_al_2()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_16_fc(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
+			m68ki_write_16_fc<Types>(ea, m_dfc, MASK_OUT_ABOVE_16(REG_DA()[(word2 >> 12) & 15]));
 		} else if(BIT_F(word2)) {    /* Memory to address register */
-			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, m_sfc));
+			REG_A()[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc<Types>(ea, m_sfc));
 			m_icount -= 2;
 		} else {
 			/* Memory to data register */
-			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, m_sfc);
+			REG_D()[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D()[(word2 >> 12) & 7]) | m68ki_read_16_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21610,6 +22340,7 @@ void m68000_base_device::x0e79_moves_w_al_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e90_moves_l_ai_134fc()
 {
 	if(m_s_flag) {
@@ -21618,10 +22349,10 @@ void m68000_base_device::x0e90_moves_l_ai_134fc()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21629,6 +22360,7 @@ void m68000_base_device::x0e90_moves_l_ai_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e98_moves_l_pi_134fc()
 {
 	if(m_s_flag) {
@@ -21637,10 +22369,10 @@ void m68000_base_device::x0e98_moves_l_pi_134fc()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21648,6 +22380,7 @@ void m68000_base_device::x0e98_moves_l_pi_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ea0_moves_l_pd_134fc()
 {
 	if(m_s_flag) {
@@ -21656,10 +22389,10 @@ void m68000_base_device::x0ea0_moves_l_pd_134fc()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21667,6 +22400,7 @@ void m68000_base_device::x0ea0_moves_l_pd_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ea8_moves_l_di_134fc()
 {
 	if(m_s_flag) {
@@ -21675,10 +22409,10 @@ void m68000_base_device::x0ea8_moves_l_di_134fc()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21686,18 +22420,19 @@ void m68000_base_device::x0ea8_moves_l_di_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0eb0_moves_l_ix_134fc()
 {
 	if(m_s_flag) {
 		u32 word2 = OPER_I_16();
-		u32 ea = EA_AY_IX_32();
+		u32 ea = EA_AY_IX_32<Types>();
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21705,6 +22440,7 @@ void m68000_base_device::x0eb0_moves_l_ix_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0eb8_moves_l_aw_134fc()
 {
 	if(m_s_flag) {
@@ -21713,10 +22449,10 @@ void m68000_base_device::x0eb8_moves_l_aw_134fc()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21724,6 +22460,7 @@ void m68000_base_device::x0eb8_moves_l_aw_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0eb9_moves_l_al_134fc()
 {
 	if(m_s_flag) {
@@ -21732,10 +22469,10 @@ void m68000_base_device::x0eb9_moves_l_al_134fc()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 		}
 	} else {
 		m68ki_exception_privilege_violation();
@@ -21743,6 +22480,7 @@ void m68000_base_device::x0eb9_moves_l_al_134fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e90_moves_l_ai_2()
 {
 	if(m_s_flag) {
@@ -21751,11 +22489,11 @@ void m68000_base_device::x0e90_moves_l_ai_2()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 			m_icount -= 2;
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21764,6 +22502,7 @@ void m68000_base_device::x0e90_moves_l_ai_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0e98_moves_l_pi_2()
 {
 	if(m_s_flag) {
@@ -21772,11 +22511,11 @@ void m68000_base_device::x0e98_moves_l_pi_2()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 			m_icount -= 2;
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21785,6 +22524,7 @@ void m68000_base_device::x0e98_moves_l_pi_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ea0_moves_l_pd_2()
 {
 	if(m_s_flag) {
@@ -21793,11 +22533,11 @@ void m68000_base_device::x0ea0_moves_l_pd_2()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 			m_icount -= 2;
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21806,6 +22546,7 @@ void m68000_base_device::x0ea0_moves_l_pd_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0ea8_moves_l_di_2()
 {
 	if(m_s_flag) {
@@ -21814,11 +22555,11 @@ void m68000_base_device::x0ea8_moves_l_di_2()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 			m_icount -= 2;
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21827,19 +22568,20 @@ void m68000_base_device::x0ea8_moves_l_di_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0eb0_moves_l_ix_2()
 {
 	if(m_s_flag) {
 		u32 word2 = OPER_I_16();
-		u32 ea = EA_AY_IX_32();
+		u32 ea = EA_AY_IX_32<Types>();
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 			m_icount -= 2;
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21848,6 +22590,7 @@ void m68000_base_device::x0eb0_moves_l_ix_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0eb8_moves_l_aw_2()
 {
 	if(m_s_flag) {
@@ -21856,11 +22599,11 @@ void m68000_base_device::x0eb8_moves_l_aw_2()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 			m_icount -= 2;
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21869,6 +22612,7 @@ void m68000_base_device::x0eb8_moves_l_aw_2()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0eb9_moves_l_al_2()
 {
 	if(m_s_flag) {
@@ -21877,11 +22621,11 @@ void m68000_base_device::x0eb9_moves_l_al_2()
 
 		m68ki_trace_t0();            /* auto-disable (see m68kcpu.h) */
 		if(BIT_B(word2)) {           /* Register to memory */
-			m68ki_write_32_fc(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
+			m68ki_write_32_fc<Types>(ea, m_dfc, REG_DA()[(word2 >> 12) & 15]);
 			m_icount -= 2;
 		} else {
 			/* Memory to register */
-			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, m_sfc);
+			REG_DA()[(word2 >> 12) & 15] = m68ki_read_32_fc<Types>(ea, m_sfc);
 			m_icount -= 2;
 		}
 	} else {
@@ -21901,15 +22645,16 @@ void m68000_base_device::x7000_moveq_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xf620_move16_l_4fc()
 {
 	u16 w2 = OPER_I_16();
 	int ax = m_ir & 7;
 	int ay = (w2 >> 12) & 7;
-	m68ki_write_32(REG_A()[ay],    m68ki_read_32(REG_A()[ax]));
-	m68ki_write_32(REG_A()[ay]+4,  m68ki_read_32(REG_A()[ax]+4));
-	m68ki_write_32(REG_A()[ay]+8,  m68ki_read_32(REG_A()[ax]+8));
-	m68ki_write_32(REG_A()[ay]+12, m68ki_read_32(REG_A()[ax]+12));
+	m68ki_write_32<Types>(REG_A()[ay],    m68ki_read_32<Types>(REG_A()[ax]));
+	m68ki_write_32<Types>(REG_A()[ay]+4,  m68ki_read_32<Types>(REG_A()[ax]+4));
+	m68ki_write_32<Types>(REG_A()[ay]+8,  m68ki_read_32<Types>(REG_A()[ax]+8));
+	m68ki_write_32<Types>(REG_A()[ay]+12, m68ki_read_32<Types>(REG_A()[ax]+12));
 
 	REG_A()[ax] += 16;
 	REG_A()[ay] += 16;
@@ -21930,10 +22675,11 @@ void m68000_base_device::xc1c0_muls_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1d0_muls_w_ai_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_AI_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_AI_16<Types>()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
 
 	*r_dst = res;
 
@@ -21944,10 +22690,11 @@ void m68000_base_device::xc1d0_muls_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1d8_muls_w_pi_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_PI_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_PI_16<Types>()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
 
 	*r_dst = res;
 
@@ -21958,10 +22705,11 @@ void m68000_base_device::xc1d8_muls_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1e0_muls_w_pd_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_PD_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_PD_16<Types>()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
 
 	*r_dst = res;
 
@@ -21972,10 +22720,11 @@ void m68000_base_device::xc1e0_muls_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1e8_muls_w_di_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_DI_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_DI_16<Types>()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
 
 	*r_dst = res;
 
@@ -21986,10 +22735,11 @@ void m68000_base_device::xc1e8_muls_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1f0_muls_w_ix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_IX_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_IX_16<Types>()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
 
 	*r_dst = res;
 
@@ -22000,10 +22750,11 @@ void m68000_base_device::xc1f0_muls_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1f8_muls_w_aw_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AW_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AW_16<Types>()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
 
 	*r_dst = res;
 
@@ -22014,10 +22765,11 @@ void m68000_base_device::xc1f8_muls_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1f9_muls_w_al_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AL_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AL_16<Types>()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
 
 	*r_dst = res;
 
@@ -22042,10 +22794,11 @@ void m68000_base_device::xc1fa_muls_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc1fb_muls_w_pcix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_PCIX_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+	u32 res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_PCIX_16<Types>()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
 
 	*r_dst = res;
 
@@ -22084,10 +22837,11 @@ void m68000_base_device::xc0c0_mulu_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0d0_mulu_w_ai_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = OPER_AY_AI_16() * MASK_OUT_ABOVE_16(*r_dst);
+	u32 res = OPER_AY_AI_16<Types>() * MASK_OUT_ABOVE_16(*r_dst);
 
 	*r_dst = res;
 
@@ -22098,10 +22852,11 @@ void m68000_base_device::xc0d0_mulu_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0d8_mulu_w_pi_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = OPER_AY_PI_16() * MASK_OUT_ABOVE_16(*r_dst);
+	u32 res = OPER_AY_PI_16<Types>() * MASK_OUT_ABOVE_16(*r_dst);
 
 	*r_dst = res;
 
@@ -22112,10 +22867,11 @@ void m68000_base_device::xc0d8_mulu_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0e0_mulu_w_pd_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = OPER_AY_PD_16() * MASK_OUT_ABOVE_16(*r_dst);
+	u32 res = OPER_AY_PD_16<Types>() * MASK_OUT_ABOVE_16(*r_dst);
 
 	*r_dst = res;
 
@@ -22126,10 +22882,11 @@ void m68000_base_device::xc0e0_mulu_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0e8_mulu_w_di_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = OPER_AY_DI_16() * MASK_OUT_ABOVE_16(*r_dst);
+	u32 res = OPER_AY_DI_16<Types>() * MASK_OUT_ABOVE_16(*r_dst);
 
 	*r_dst = res;
 
@@ -22140,10 +22897,11 @@ void m68000_base_device::xc0e8_mulu_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0f0_mulu_w_ix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = OPER_AY_IX_16() * MASK_OUT_ABOVE_16(*r_dst);
+	u32 res = OPER_AY_IX_16<Types>() * MASK_OUT_ABOVE_16(*r_dst);
 
 	*r_dst = res;
 
@@ -22154,10 +22912,11 @@ void m68000_base_device::xc0f0_mulu_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0f8_mulu_w_aw_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = OPER_AW_16() * MASK_OUT_ABOVE_16(*r_dst);
+	u32 res = OPER_AW_16<Types>() * MASK_OUT_ABOVE_16(*r_dst);
 
 	*r_dst = res;
 
@@ -22168,10 +22927,11 @@ void m68000_base_device::xc0f8_mulu_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0f9_mulu_w_al_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = OPER_AL_16() * MASK_OUT_ABOVE_16(*r_dst);
+	u32 res = OPER_AL_16<Types>() * MASK_OUT_ABOVE_16(*r_dst);
 
 	*r_dst = res;
 
@@ -22196,10 +22956,11 @@ void m68000_base_device::xc0fa_mulu_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xc0fb_mulu_w_pcix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 res = OPER_PCIX_16() * MASK_OUT_ABOVE_16(*r_dst);
+	u32 res = OPER_PCIX_16<Types>() * MASK_OUT_ABOVE_16(*r_dst);
 
 	*r_dst = res;
 
@@ -22268,10 +23029,11 @@ void m68000_base_device::x4c00_mull_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4c10_mull_l_ai_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 src = OPER_AY_AI_32();
+	u64 src = OPER_AY_AI_32<Types>();
 	u64 dst = REG_D()[(word2 >> 12) & 7];
 	u64 res;
 
@@ -22310,10 +23072,11 @@ void m68000_base_device::x4c10_mull_l_ai_234fc()
 	done: ;
 
 }
+template <u32 Types>
 void m68000_base_device::x4c18_mull_l_pi_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 src = OPER_AY_PI_32();
+	u64 src = OPER_AY_PI_32<Types>();
 	u64 dst = REG_D()[(word2 >> 12) & 7];
 	u64 res;
 
@@ -22352,10 +23115,11 @@ void m68000_base_device::x4c18_mull_l_pi_234fc()
 	done: ;
 
 }
+template <u32 Types>
 void m68000_base_device::x4c20_mull_l_pd_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 src = OPER_AY_PD_32();
+	u64 src = OPER_AY_PD_32<Types>();
 	u64 dst = REG_D()[(word2 >> 12) & 7];
 	u64 res;
 
@@ -22394,10 +23158,11 @@ void m68000_base_device::x4c20_mull_l_pd_234fc()
 	done: ;
 
 }
+template <u32 Types>
 void m68000_base_device::x4c28_mull_l_di_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 src = OPER_AY_DI_32();
+	u64 src = OPER_AY_DI_32<Types>();
 	u64 dst = REG_D()[(word2 >> 12) & 7];
 	u64 res;
 
@@ -22436,10 +23201,11 @@ void m68000_base_device::x4c28_mull_l_di_234fc()
 	done: ;
 
 }
+template <u32 Types>
 void m68000_base_device::x4c30_mull_l_ix_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 src = OPER_AY_IX_32();
+	u64 src = OPER_AY_IX_32<Types>();
 	u64 dst = REG_D()[(word2 >> 12) & 7];
 	u64 res;
 
@@ -22478,10 +23244,11 @@ void m68000_base_device::x4c30_mull_l_ix_234fc()
 	done: ;
 
 }
+template <u32 Types>
 void m68000_base_device::x4c38_mull_l_aw_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 src = OPER_AW_32();
+	u64 src = OPER_AW_32<Types>();
 	u64 dst = REG_D()[(word2 >> 12) & 7];
 	u64 res;
 
@@ -22520,10 +23287,11 @@ void m68000_base_device::x4c38_mull_l_aw_234fc()
 	done: ;
 
 }
+template <u32 Types>
 void m68000_base_device::x4c39_mull_l_al_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 src = OPER_AL_32();
+	u64 src = OPER_AL_32<Types>();
 	u64 dst = REG_D()[(word2 >> 12) & 7];
 	u64 res;
 
@@ -22604,10 +23372,11 @@ void m68000_base_device::x4c3a_mull_l_pcdi_234fc()
 	done: ;
 
 }
+template <u32 Types>
 void m68000_base_device::x4c3b_mull_l_pcix_234fc()
 {
 	u32 word2 = OPER_I_16();
-	u64 src = OPER_PCIX_32();
+	u64 src = OPER_PCIX_32<Types>();
 	u64 dst = REG_D()[(word2 >> 12) & 7];
 	u64 res;
 
@@ -22898,9 +23667,10 @@ void m68000_base_device::x4828_nbcd_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4830_nbcd_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 dst = m68ki_read_8(ea);
 	u32 res = -dst - XFLAG_1();
 
@@ -23092,9 +23862,10 @@ void m68000_base_device::x4428_neg_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4430_neg_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 src = m68ki_read_8(ea);
 	u32 res = 0 - src;
 
@@ -23151,10 +23922,11 @@ void m68000_base_device::x4440_neg_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4450_neg_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -23162,14 +23934,15 @@ void m68000_base_device::x4450_neg_w_ai_071234fc()
 	m_v_flag = (src & res)>>8;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4458_neg_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -23177,14 +23950,15 @@ void m68000_base_device::x4458_neg_w_pi_071234fc()
 	m_v_flag = (src & res)>>8;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4460_neg_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -23192,14 +23966,15 @@ void m68000_base_device::x4460_neg_w_pd_071234fc()
 	m_v_flag = (src & res)>>8;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4468_neg_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -23207,14 +23982,15 @@ void m68000_base_device::x4468_neg_w_di_071234fc()
 	m_v_flag = (src & res)>>8;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4470_neg_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 src = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -23222,14 +23998,15 @@ void m68000_base_device::x4470_neg_w_ix_071234fc()
 	m_v_flag = (src & res)>>8;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4478_neg_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -23237,14 +24014,15 @@ void m68000_base_device::x4478_neg_w_aw_071234fc()
 	m_v_flag = (src & res)>>8;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4479_neg_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -23252,7 +24030,7 @@ void m68000_base_device::x4479_neg_w_al_071234fc()
 	m_v_flag = (src & res)>>8;
 	m_not_z_flag = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
@@ -23270,10 +24048,11 @@ void m68000_base_device::x4480_neg_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4490_neg_l_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_32();
-	u32 src = m68ki_read_32(ea);
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -23281,14 +24060,15 @@ void m68000_base_device::x4490_neg_l_ai_071234fc()
 	m_v_flag = (src & res)>>24;
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4498_neg_l_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_32();
-	u32 src = m68ki_read_32(ea);
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -23296,14 +24076,15 @@ void m68000_base_device::x4498_neg_l_pi_071234fc()
 	m_v_flag = (src & res)>>24;
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44a0_neg_l_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_32();
-	u32 src = m68ki_read_32(ea);
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -23311,14 +24092,15 @@ void m68000_base_device::x44a0_neg_l_pd_071234fc()
 	m_v_flag = (src & res)>>24;
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44a8_neg_l_di_071234fc()
 {
 	u32 ea = EA_AY_DI_32();
-	u32 src = m68ki_read_32(ea);
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -23326,14 +24108,15 @@ void m68000_base_device::x44a8_neg_l_di_071234fc()
 	m_v_flag = (src & res)>>24;
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44b0_neg_l_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_32();
-	u32 src = m68ki_read_32(ea);
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -23341,14 +24124,15 @@ void m68000_base_device::x44b0_neg_l_ix_071234fc()
 	m_v_flag = (src & res)>>24;
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44b8_neg_l_aw_071234fc()
 {
 	u32 ea = EA_AW_32();
-	u32 src = m68ki_read_32(ea);
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -23356,14 +24140,15 @@ void m68000_base_device::x44b8_neg_l_aw_071234fc()
 	m_v_flag = (src & res)>>24;
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x44b9_neg_l_al_071234fc()
 {
 	u32 ea = EA_AL_32();
-	u32 src = m68ki_read_32(ea);
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -23371,7 +24156,7 @@ void m68000_base_device::x44b9_neg_l_al_071234fc()
 	m_v_flag = (src & res)>>24;
 	m_not_z_flag = MASK_OUT_ABOVE_32(res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
@@ -23493,9 +24278,10 @@ void m68000_base_device::x4028_negx_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4030_negx_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 src = m68ki_read_8(ea);
 	u32 res = 0 - src - XFLAG_1();
 
@@ -23560,10 +24346,11 @@ void m68000_base_device::x4040_negx_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4050_negx_w_ai_071234fc()
 {
 	u32 ea  = EA_AY_AI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_16(res);
@@ -23573,14 +24360,15 @@ void m68000_base_device::x4050_negx_w_ai_071234fc()
 	res = MASK_OUT_ABOVE_16(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4058_negx_w_pi_071234fc()
 {
 	u32 ea  = EA_AY_PI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_16(res);
@@ -23590,14 +24378,15 @@ void m68000_base_device::x4058_negx_w_pi_071234fc()
 	res = MASK_OUT_ABOVE_16(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4060_negx_w_pd_071234fc()
 {
 	u32 ea  = EA_AY_PD_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_16(res);
@@ -23607,14 +24396,15 @@ void m68000_base_device::x4060_negx_w_pd_071234fc()
 	res = MASK_OUT_ABOVE_16(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4068_negx_w_di_071234fc()
 {
 	u32 ea  = EA_AY_DI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_16(res);
@@ -23624,14 +24414,15 @@ void m68000_base_device::x4068_negx_w_di_071234fc()
 	res = MASK_OUT_ABOVE_16(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4070_negx_w_ix_071234fc()
 {
-	u32 ea  = EA_AY_IX_16();
-	u32 src = m68ki_read_16(ea);
+	u32 ea  = EA_AY_IX_16<Types>();
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_16(res);
@@ -23641,14 +24432,15 @@ void m68000_base_device::x4070_negx_w_ix_071234fc()
 	res = MASK_OUT_ABOVE_16(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4078_negx_w_aw_071234fc()
 {
 	u32 ea  = EA_AW_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_16(res);
@@ -23658,14 +24450,15 @@ void m68000_base_device::x4078_negx_w_aw_071234fc()
 	res = MASK_OUT_ABOVE_16(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4079_negx_w_al_071234fc()
 {
 	u32 ea  = EA_AL_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_16(res);
@@ -23675,7 +24468,7 @@ void m68000_base_device::x4079_negx_w_al_071234fc()
 	res = MASK_OUT_ABOVE_16(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
@@ -23695,10 +24488,11 @@ void m68000_base_device::x4080_negx_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4090_negx_l_ai_071234fc()
 {
 	u32 ea  = EA_AY_AI_32();
-	u32 src = m68ki_read_32(ea);
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_32(res);
@@ -23708,14 +24502,15 @@ void m68000_base_device::x4090_negx_l_ai_071234fc()
 	res = MASK_OUT_ABOVE_32(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4098_negx_l_pi_071234fc()
 {
 	u32 ea  = EA_AY_PI_32();
-	u32 src = m68ki_read_32(ea);
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_32(res);
@@ -23725,14 +24520,15 @@ void m68000_base_device::x4098_negx_l_pi_071234fc()
 	res = MASK_OUT_ABOVE_32(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40a0_negx_l_pd_071234fc()
 {
 	u32 ea  = EA_AY_PD_32();
-	u32 src = m68ki_read_32(ea);
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_32(res);
@@ -23742,14 +24538,15 @@ void m68000_base_device::x40a0_negx_l_pd_071234fc()
 	res = MASK_OUT_ABOVE_32(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40a8_negx_l_di_071234fc()
 {
 	u32 ea  = EA_AY_DI_32();
-	u32 src = m68ki_read_32(ea);
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_32(res);
@@ -23759,14 +24556,15 @@ void m68000_base_device::x40a8_negx_l_di_071234fc()
 	res = MASK_OUT_ABOVE_32(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40b0_negx_l_ix_071234fc()
 {
-	u32 ea  = EA_AY_IX_32();
-	u32 src = m68ki_read_32(ea);
+	u32 ea  = EA_AY_IX_32<Types>();
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_32(res);
@@ -23776,14 +24574,15 @@ void m68000_base_device::x40b0_negx_l_ix_071234fc()
 	res = MASK_OUT_ABOVE_32(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40b8_negx_l_aw_071234fc()
 {
 	u32 ea  = EA_AW_32();
-	u32 src = m68ki_read_32(ea);
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_32(res);
@@ -23793,14 +24592,15 @@ void m68000_base_device::x40b8_negx_l_aw_071234fc()
 	res = MASK_OUT_ABOVE_32(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x40b9_negx_l_al_071234fc()
 {
 	u32 ea  = EA_AL_32();
-	u32 src = m68ki_read_32(ea);
+	u32 src = m68ki_read_32<Types>(ea);
 	u32 res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_1();
 
 	m_n_flag = NFLAG_32(res);
@@ -23810,7 +24610,7 @@ void m68000_base_device::x40b9_negx_l_al_071234fc()
 	res = MASK_OUT_ABOVE_32(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
@@ -23918,9 +24718,10 @@ void m68000_base_device::x4628_not_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4630_not_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
 
 	m68ki_write_8(ea, res);
@@ -23974,12 +24775,13 @@ void m68000_base_device::x4640_not_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4650_not_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -23988,12 +24790,13 @@ void m68000_base_device::x4650_not_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4658_not_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24002,12 +24805,13 @@ void m68000_base_device::x4658_not_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4660_not_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24016,12 +24820,13 @@ void m68000_base_device::x4660_not_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4668_not_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24030,12 +24835,13 @@ void m68000_base_device::x4668_not_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4670_not_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24044,12 +24850,13 @@ void m68000_base_device::x4670_not_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4678_not_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24058,12 +24865,13 @@ void m68000_base_device::x4678_not_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4679_not_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(~m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24084,12 +24892,13 @@ void m68000_base_device::x4680_not_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4690_not_l_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_32();
-	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32<Types>(ea));
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24098,12 +24907,13 @@ void m68000_base_device::x4690_not_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4698_not_l_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_32();
-	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32<Types>(ea));
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24112,12 +24922,13 @@ void m68000_base_device::x4698_not_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46a0_not_l_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_32();
-	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32<Types>(ea));
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24126,12 +24937,13 @@ void m68000_base_device::x46a0_not_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46a8_not_l_di_071234fc()
 {
 	u32 ea = EA_AY_DI_32();
-	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32<Types>(ea));
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24140,12 +24952,13 @@ void m68000_base_device::x46a8_not_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46b0_not_l_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_32();
-	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32<Types>(ea));
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24154,12 +24967,13 @@ void m68000_base_device::x46b0_not_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46b8_not_l_aw_071234fc()
 {
 	u32 ea = EA_AW_32();
-	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32<Types>(ea));
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24168,12 +24982,13 @@ void m68000_base_device::x46b8_not_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x46b9_not_l_al_071234fc()
 {
 	u32 ea = EA_AL_32();
-	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
+	u32 res = MASK_OUT_ABOVE_32(~m68ki_read_32<Types>(ea));
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24259,9 +25074,10 @@ void m68000_base_device::x8028_or_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8030_or_b_ix_071234fc()
 {
-	u32 res = MASK_OUT_ABOVE_8((DX() |= OPER_AY_IX_8()));
+	u32 res = MASK_OUT_ABOVE_8((DX() |= OPER_AY_IX_8<Types>()));
 
 	m_n_flag = NFLAG_8(res);
 	m_not_z_flag = res;
@@ -24303,9 +25119,10 @@ void m68000_base_device::x803a_or_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x803b_or_b_pcix_071234fc()
 {
-	u32 res = MASK_OUT_ABOVE_8((DX() |= OPER_PCIX_8()));
+	u32 res = MASK_OUT_ABOVE_8((DX() |= OPER_PCIX_8<Types>()));
 
 	m_n_flag = NFLAG_8(res);
 	m_not_z_flag = res;
@@ -24336,9 +25153,10 @@ void m68000_base_device::x8040_or_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8050_or_w_ai_071234fc()
 {
-	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AY_AI_16()));
+	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AY_AI_16<Types>()));
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24347,9 +25165,10 @@ void m68000_base_device::x8050_or_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8058_or_w_pi_071234fc()
 {
-	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AY_PI_16()));
+	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AY_PI_16<Types>()));
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24358,9 +25177,10 @@ void m68000_base_device::x8058_or_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8060_or_w_pd_071234fc()
 {
-	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AY_PD_16()));
+	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AY_PD_16<Types>()));
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24369,9 +25189,10 @@ void m68000_base_device::x8060_or_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8068_or_w_di_071234fc()
 {
-	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AY_DI_16()));
+	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AY_DI_16<Types>()));
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24380,9 +25201,10 @@ void m68000_base_device::x8068_or_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8070_or_w_ix_071234fc()
 {
-	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AY_IX_16()));
+	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AY_IX_16<Types>()));
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24391,9 +25213,10 @@ void m68000_base_device::x8070_or_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8078_or_w_aw_071234fc()
 {
-	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AW_16()));
+	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AW_16<Types>()));
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24402,9 +25225,10 @@ void m68000_base_device::x8078_or_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8079_or_w_al_071234fc()
 {
-	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AL_16()));
+	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_AL_16<Types>()));
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24424,9 +25248,10 @@ void m68000_base_device::x807a_or_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x807b_or_w_pcix_071234fc()
 {
-	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_PCIX_16()));
+	u32 res = MASK_OUT_ABOVE_16((DX() |= OPER_PCIX_16<Types>()));
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24457,9 +25282,10 @@ void m68000_base_device::x8080_or_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8090_or_l_ai_071234fc()
 {
-	u32 res = DX() |= OPER_AY_AI_32();
+	u32 res = DX() |= OPER_AY_AI_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24468,9 +25294,10 @@ void m68000_base_device::x8090_or_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8098_or_l_pi_071234fc()
 {
-	u32 res = DX() |= OPER_AY_PI_32();
+	u32 res = DX() |= OPER_AY_PI_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24479,9 +25306,10 @@ void m68000_base_device::x8098_or_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80a0_or_l_pd_071234fc()
 {
-	u32 res = DX() |= OPER_AY_PD_32();
+	u32 res = DX() |= OPER_AY_PD_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24490,9 +25318,10 @@ void m68000_base_device::x80a0_or_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80a8_or_l_di_071234fc()
 {
-	u32 res = DX() |= OPER_AY_DI_32();
+	u32 res = DX() |= OPER_AY_DI_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24501,9 +25330,10 @@ void m68000_base_device::x80a8_or_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80b0_or_l_ix_071234fc()
 {
-	u32 res = DX() |= OPER_AY_IX_32();
+	u32 res = DX() |= OPER_AY_IX_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24512,9 +25342,10 @@ void m68000_base_device::x80b0_or_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80b8_or_l_aw_071234fc()
 {
-	u32 res = DX() |= OPER_AW_32();
+	u32 res = DX() |= OPER_AW_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24523,9 +25354,10 @@ void m68000_base_device::x80b8_or_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80b9_or_l_al_071234fc()
 {
-	u32 res = DX() |= OPER_AL_32();
+	u32 res = DX() |= OPER_AL_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24545,9 +25377,10 @@ void m68000_base_device::x80ba_or_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x80bb_or_l_pcix_071234fc()
 {
-	u32 res = DX() |= OPER_PCIX_32();
+	u32 res = DX() |= OPER_PCIX_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24651,9 +25484,10 @@ void m68000_base_device::x8128_or_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8130_or_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 res = MASK_OUT_ABOVE_8(DX() | m68ki_read_8(ea));
 
 	m68ki_write_8(ea, res);
@@ -24693,12 +25527,13 @@ void m68000_base_device::x8139_or_b_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8150_or_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24707,12 +25542,13 @@ void m68000_base_device::x8150_or_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8158_or_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24721,12 +25557,13 @@ void m68000_base_device::x8158_or_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8160_or_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24735,12 +25572,13 @@ void m68000_base_device::x8160_or_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8168_or_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24749,12 +25587,13 @@ void m68000_base_device::x8168_or_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8170_or_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16(ea));
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24763,12 +25602,13 @@ void m68000_base_device::x8170_or_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8178_or_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24777,12 +25617,13 @@ void m68000_base_device::x8178_or_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8179_or_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(DX() | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -24791,12 +25632,13 @@ void m68000_base_device::x8179_or_w_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8190_or_l_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_32();
-	u32 res = DX() | m68ki_read_32(ea);
+	u32 res = DX() | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24805,12 +25647,13 @@ void m68000_base_device::x8190_or_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x8198_or_l_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_32();
-	u32 res = DX() | m68ki_read_32(ea);
+	u32 res = DX() | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24819,12 +25662,13 @@ void m68000_base_device::x8198_or_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x81a0_or_l_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_32();
-	u32 res = DX() | m68ki_read_32(ea);
+	u32 res = DX() | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24833,12 +25677,13 @@ void m68000_base_device::x81a0_or_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x81a8_or_l_di_071234fc()
 {
 	u32 ea = EA_AY_DI_32();
-	u32 res = DX() | m68ki_read_32(ea);
+	u32 res = DX() | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24847,12 +25692,13 @@ void m68000_base_device::x81a8_or_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x81b0_or_l_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_32();
-	u32 res = DX() | m68ki_read_32(ea);
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 res = DX() | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24861,12 +25707,13 @@ void m68000_base_device::x81b0_or_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x81b8_or_l_aw_071234fc()
 {
 	u32 ea = EA_AW_32();
-	u32 res = DX() | m68ki_read_32(ea);
+	u32 res = DX() | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24875,12 +25722,13 @@ void m68000_base_device::x81b8_or_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x81b9_or_l_al_071234fc()
 {
 	u32 ea = EA_AL_32();
-	u32 res = DX() | m68ki_read_32(ea);
+	u32 res = DX() | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -24990,10 +25838,11 @@ void m68000_base_device::x0028_ori_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0030_ori_b_ix_071234fc()
 {
 	u32 src = OPER_I_8();
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 res = MASK_OUT_ABOVE_8(src | m68ki_read_8(ea));
 
 	m68ki_write_8(ea, res);
@@ -25046,13 +25895,14 @@ void m68000_base_device::x0040_ori_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0050_ori_w_ai_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_AI_16();
-	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25061,13 +25911,14 @@ void m68000_base_device::x0050_ori_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0058_ori_w_pi_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_PI_16();
-	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25076,13 +25927,14 @@ void m68000_base_device::x0058_ori_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0060_ori_w_pd_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_PD_16();
-	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25091,13 +25943,14 @@ void m68000_base_device::x0060_ori_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0068_ori_w_di_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_DI_16();
-	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25106,13 +25959,14 @@ void m68000_base_device::x0068_ori_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0070_ori_w_ix_071234fc()
 {
 	u32 src = OPER_I_16();
-	u32 ea = EA_AY_IX_16();
-	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25121,13 +25975,14 @@ void m68000_base_device::x0070_ori_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0078_ori_w_aw_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AW_16();
-	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25136,13 +25991,14 @@ void m68000_base_device::x0078_ori_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0079_ori_w_al_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AL_16();
-	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16(ea));
+	u32 res = MASK_OUT_ABOVE_16(src | m68ki_read_16<Types>(ea));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25162,13 +26018,14 @@ void m68000_base_device::x0080_ori_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0090_ori_l_ai_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_AI_32();
-	u32 res = src | m68ki_read_32(ea);
+	u32 res = src | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -25177,13 +26034,14 @@ void m68000_base_device::x0090_ori_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0098_ori_l_pi_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_PI_32();
-	u32 res = src | m68ki_read_32(ea);
+	u32 res = src | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -25192,13 +26050,14 @@ void m68000_base_device::x0098_ori_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x00a0_ori_l_pd_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_PD_32();
-	u32 res = src | m68ki_read_32(ea);
+	u32 res = src | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -25207,13 +26066,14 @@ void m68000_base_device::x00a0_ori_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x00a8_ori_l_di_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_DI_32();
-	u32 res = src | m68ki_read_32(ea);
+	u32 res = src | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -25222,13 +26082,14 @@ void m68000_base_device::x00a8_ori_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x00b0_ori_l_ix_071234fc()
 {
 	u32 src = OPER_I_32();
-	u32 ea = EA_AY_IX_32();
-	u32 res = src | m68ki_read_32(ea);
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 res = src | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -25237,13 +26098,14 @@ void m68000_base_device::x00b0_ori_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x00b8_ori_l_aw_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AW_32();
-	u32 res = src | m68ki_read_32(ea);
+	u32 res = src | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -25252,13 +26114,14 @@ void m68000_base_device::x00b8_ori_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x00b9_ori_l_al_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AL_32();
-	u32 res = src | m68ki_read_32(ea);
+	u32 res = src | m68ki_read_32<Types>(ea);
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -25341,59 +26204,66 @@ void m68000_base_device::x8148_pack_w_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4850_pea_l_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_32();
 
-	m68ki_push_32(ea);
+	m68ki_push_32<Types>(ea);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4868_pea_l_di_071234fc()
 {
 	u32 ea = EA_AY_DI_32();
 
-	m68ki_push_32(ea);
+	m68ki_push_32<Types>(ea);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4870_pea_l_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_32();
+	u32 ea = EA_AY_IX_32<Types>();
 
-	m68ki_push_32(ea);
+	m68ki_push_32<Types>(ea);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4878_pea_l_aw_071234fc()
 {
 	u32 ea = EA_AW_32();
 
-	m68ki_push_32(ea);
+	m68ki_push_32<Types>(ea);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4879_pea_l_al_071234fc()
 {
 	u32 ea = EA_AL_32();
 
-	m68ki_push_32(ea);
+	m68ki_push_32<Types>(ea);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x487a_pea_l_pcdi_071234fc()
 {
 	u32 ea = EA_PCDI_32();
 
-	m68ki_push_32(ea);
+	m68ki_push_32<Types>(ea);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x487b_pea_l_pcix_071234fc()
 {
-	u32 ea = EA_PCIX_32();
+	u32 ea = EA_PCIX_32<Types>();
 
-	m68ki_push_32(ea);
+	m68ki_push_32<Types>(ea);
 
 
 }
@@ -25588,13 +26458,14 @@ void m68000_base_device::xe0b8_ror_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe6d0_ror_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_16(src, 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25603,13 +26474,14 @@ void m68000_base_device::xe6d0_ror_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe6d8_ror_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_16(src, 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25618,13 +26490,14 @@ void m68000_base_device::xe6d8_ror_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe6e0_ror_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_16(src, 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25633,13 +26506,14 @@ void m68000_base_device::xe6e0_ror_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe6e8_ror_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_16(src, 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25648,13 +26522,14 @@ void m68000_base_device::xe6e8_ror_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe6f0_ror_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 src = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_16(src, 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25663,13 +26538,14 @@ void m68000_base_device::xe6f0_ror_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe6f8_ror_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_16(src, 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25678,13 +26554,14 @@ void m68000_base_device::xe6f8_ror_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe6f9_ror_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_16(src, 1);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25841,13 +26718,14 @@ void m68000_base_device::xe1b8_rol_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe7d0_rol_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25856,13 +26734,14 @@ void m68000_base_device::xe7d0_rol_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe7d8_rol_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25871,13 +26750,14 @@ void m68000_base_device::xe7d8_rol_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe7e0_rol_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25886,13 +26766,14 @@ void m68000_base_device::xe7e0_rol_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe7e8_rol_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25901,13 +26782,14 @@ void m68000_base_device::xe7e8_rol_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe7f0_rol_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 src = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25916,13 +26798,14 @@ void m68000_base_device::xe7f0_rol_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe7f8_rol_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -25931,13 +26814,14 @@ void m68000_base_device::xe7f8_rol_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe7f9_rol_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26098,16 +26982,17 @@ void m68000_base_device::xe0b0_roxr_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe4d0_roxr_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26115,16 +27000,17 @@ void m68000_base_device::xe4d0_roxr_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe4d8_roxr_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26132,16 +27018,17 @@ void m68000_base_device::xe4d8_roxr_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe4e0_roxr_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26149,16 +27036,17 @@ void m68000_base_device::xe4e0_roxr_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe4e8_roxr_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26166,16 +27054,17 @@ void m68000_base_device::xe4e8_roxr_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe4f0_roxr_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 src = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26183,16 +27072,17 @@ void m68000_base_device::xe4f0_roxr_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe4f8_roxr_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26200,16 +27090,17 @@ void m68000_base_device::xe4f8_roxr_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe4f9_roxr_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROR_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26369,16 +27260,17 @@ void m68000_base_device::xe1b0_roxl_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe5d0_roxl_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROL_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26386,16 +27278,17 @@ void m68000_base_device::xe5d0_roxl_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe5d8_roxl_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROL_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26403,16 +27296,17 @@ void m68000_base_device::xe5d8_roxl_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe5e0_roxl_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROL_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26420,16 +27314,17 @@ void m68000_base_device::xe5e0_roxl_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe5e8_roxl_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROL_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26437,16 +27332,17 @@ void m68000_base_device::xe5e8_roxl_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe5f0_roxl_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
-	u32 src = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROL_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26454,16 +27350,17 @@ void m68000_base_device::xe5f0_roxl_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe5f8_roxl_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROL_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26471,16 +27368,17 @@ void m68000_base_device::xe5f8_roxl_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::xe5f9_roxl_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
-	u32 src = m68ki_read_16(ea);
+	u32 src = m68ki_read_16<Types>(ea);
 	u32 res = ROL_17(src | (XFLAG_1() << 16), 1);
 
 	m_c_flag = m_x_flag = res >> 8;
 	res = MASK_OUT_ABOVE_16(res);
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -26488,9 +27386,10 @@ void m68000_base_device::xe5f9_roxl_w_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4e74_rtd_l_1234fc()
 {
-	u32 new_pc = m68ki_pull_32();
+	u32 new_pc = m68ki_pull_32<Types>();
 
 	m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 	REG_A()[7] = MASK_OUT_ABOVE_32(REG_A()[7] + MAKE_INT_16(OPER_I_16()));
@@ -26498,6 +27397,7 @@ void m68000_base_device::x4e74_rtd_l_1234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4e73_rte_l_0()
 {
 	if(m_s_flag) {
@@ -26508,8 +27408,8 @@ void m68000_base_device::x4e73_rte_l_0()
 			(m_rte_instr_callback)(1);
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 
-		new_sr = m68ki_pull_16();
-		new_pc = m68ki_pull_32();
+		new_sr = m68ki_pull_16<Types>();
+		new_pc = m68ki_pull_32<Types>();
 		m68ki_jump(new_pc);
 		m68ki_set_sr(new_sr);
 
@@ -26521,6 +27421,7 @@ void m68000_base_device::x4e73_rte_l_0()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4e73_rte_l_71()
 {
 	if(m_s_flag) {
@@ -26532,10 +27433,10 @@ void m68000_base_device::x4e73_rte_l_71()
 			(m_rte_instr_callback)(1);
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 
-		format_word = m68ki_read_16(REG_A()[7]+6) >> 12;
+		format_word = m68ki_read_16<Types>(REG_A()[7]+6) >> 12;
 		if(format_word == 0) {
-			new_sr = m68ki_pull_16();
-			new_pc = m68ki_pull_32();
+			new_sr = m68ki_pull_16<Types>();
+			new_pc = m68ki_pull_32<Types>();
 			m68ki_fake_pull_16();   /* format word */
 			m68ki_jump(new_pc);
 			m68ki_set_sr(new_sr);
@@ -26544,8 +27445,8 @@ void m68000_base_device::x4e73_rte_l_71()
 		} else {
 			if (format_word == 0x8) /* type 1000 stack frame */
 			{
-				new_sr = m68ki_pull_16();
-				new_pc = m68ki_pull_32();
+				new_sr = m68ki_pull_16<Types>();
+				new_pc = m68ki_pull_32<Types>();
 				m68ki_fake_pull_16();   /* format word */
 				m68ki_jump(new_pc);
 				m68ki_set_sr(new_sr);
@@ -26578,6 +27479,7 @@ void m68000_base_device::x4e73_rte_l_71()
 	}
 
 }
+template <u32 Types>
 void m68000_base_device::x4e73_rte_l_234fc()
 {
 	if(m_s_flag) {
@@ -26590,11 +27492,11 @@ void m68000_base_device::x4e73_rte_l_234fc()
 		m68ki_trace_t0();              /* auto-disable (see m68kcpu.h) */
 
 	rte_loop:
-		format_word = m68ki_read_16(REG_A()[7]+6) >> 12;
+		format_word = m68ki_read_16<Types>(REG_A()[7]+6) >> 12;
 		switch(format_word) {
 		case 0: /* Normal */
-			new_sr = m68ki_pull_16();
-			new_pc = m68ki_pull_32();
+			new_sr = m68ki_pull_16<Types>();
+			new_pc = m68ki_pull_32<Types>();
 			m68ki_fake_pull_16();   /* format word */
 			m68ki_jump(new_pc);
 			m68ki_set_sr(new_sr);
@@ -26603,15 +27505,15 @@ void m68000_base_device::x4e73_rte_l_234fc()
 			break;
 
 		case 1: /* Throwaway */
-			new_sr = m68ki_pull_16();
+			new_sr = m68ki_pull_16<Types>();
 			m68ki_fake_pull_32();   /* program counter */
 			m68ki_fake_pull_16();   /* format word */
 			m68ki_set_sr_noint(new_sr);
 			goto rte_loop;
 
 		case 2: /* Trap */
-			new_sr = m68ki_pull_16();
-			new_pc = m68ki_pull_32();
+			new_sr = m68ki_pull_16<Types>();
+			new_pc = m68ki_pull_32<Types>();
 			m68ki_fake_pull_16();   /* format word */
 			m68ki_fake_pull_32();   /* address */
 			m68ki_jump(new_pc);
@@ -26621,8 +27523,8 @@ void m68000_base_device::x4e73_rte_l_234fc()
 			break;
 
 		case 7: /* 68040 access error */
-			new_sr = m68ki_pull_16();
-			new_pc = m68ki_pull_32();
+			new_sr = m68ki_pull_16<Types>();
+			new_pc = m68ki_pull_32<Types>();
 			m68ki_fake_pull_16();   /* $06: format word */
 			m68ki_fake_pull_32();   /* $08: effective address */
 			m68ki_fake_pull_16();   /* $0c: special status word */
@@ -26646,8 +27548,8 @@ void m68000_base_device::x4e73_rte_l_234fc()
 			break;
 
 		case 0x0a: /* Bus Error at instruction boundary */
-			new_sr = m68ki_pull_16();
-			new_pc = m68ki_pull_32();
+			new_sr = m68ki_pull_16<Types>();
+			new_pc = m68ki_pull_32<Types>();
 			m68ki_fake_pull_16();   /* $06: format word */
 			m68ki_fake_pull_16();   /* $08: internal register */
 			m68ki_fake_pull_16();   /* $0a: special status word */
@@ -26665,8 +27567,8 @@ void m68000_base_device::x4e73_rte_l_234fc()
 			break;
 
 		case 0x0b: /* Bus Error - Instruction Execution in Progress */
-			new_sr = m68ki_pull_16();
-			new_pc = m68ki_pull_32();
+			new_sr = m68ki_pull_16<Types>();
+			new_pc = m68ki_pull_32<Types>();
 			m68ki_fake_pull_16();   /* $06: format word */
 			m68ki_fake_pull_16();   /* $08: internal register */
 			m68ki_fake_pull_16();   /* $0a: special status word */
@@ -26720,18 +27622,20 @@ void m68000_base_device::x06c0_rtm_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4e77_rtr_l_071234fc()
 {
 	m68ki_trace_t0();                  /* auto-disable (see m68kcpu.h) */
-	m68ki_set_ccr(m68ki_pull_16());
-	m68ki_jump(m68ki_pull_32());
+	m68ki_set_ccr(m68ki_pull_16<Types>());
+	m68ki_jump(m68ki_pull_32<Types>());
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4e75_rts_l_071234fc()
 {
 	m68ki_trace_t0();                  /* auto-disable (see m68kcpu.h) */
-	m68ki_jump(m68ki_pull_32());
+	m68ki_jump(m68ki_pull_32<Types>());
 
 
 }
@@ -26927,9 +27831,10 @@ void m68000_base_device::x50e8_st_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x50f0_st_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), 0xff);
+	m68ki_write_8(EA_AY_IX_8<Types>(), 0xff);
 
 
 }
@@ -26987,9 +27892,10 @@ void m68000_base_device::x51e8_sf_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x51f0_sf_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), 0);
 
 
 }
@@ -27209,9 +28115,10 @@ void m68000_base_device::x52e8_shi_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x52f0_shi_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_HI() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_HI() ? 0xff : 0);
 
 
 }
@@ -27263,9 +28170,10 @@ void m68000_base_device::x53e8_sls_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x53f0_sls_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_LS() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_LS() ? 0xff : 0);
 
 
 }
@@ -27317,9 +28225,10 @@ void m68000_base_device::x54e8_scc_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x54f0_scc_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_CC() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_CC() ? 0xff : 0);
 
 
 }
@@ -27371,9 +28280,10 @@ void m68000_base_device::x55e8_scs_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x55f0_scs_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_CS() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_CS() ? 0xff : 0);
 
 
 }
@@ -27425,9 +28335,10 @@ void m68000_base_device::x56e8_sne_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x56f0_sne_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_NE() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_NE() ? 0xff : 0);
 
 
 }
@@ -27479,9 +28390,10 @@ void m68000_base_device::x57e8_seq_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x57f0_seq_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_EQ() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_EQ() ? 0xff : 0);
 
 
 }
@@ -27533,9 +28445,10 @@ void m68000_base_device::x58e8_svc_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x58f0_svc_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_VC() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_VC() ? 0xff : 0);
 
 
 }
@@ -27587,9 +28500,10 @@ void m68000_base_device::x59e8_svs_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x59f0_svs_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_VS() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_VS() ? 0xff : 0);
 
 
 }
@@ -27641,9 +28555,10 @@ void m68000_base_device::x5ae8_spl_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5af0_spl_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_PL() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_PL() ? 0xff : 0);
 
 
 }
@@ -27695,9 +28610,10 @@ void m68000_base_device::x5be8_smi_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5bf0_smi_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_MI() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_MI() ? 0xff : 0);
 
 
 }
@@ -27749,9 +28665,10 @@ void m68000_base_device::x5ce8_sge_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5cf0_sge_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_GE() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_GE() ? 0xff : 0);
 
 
 }
@@ -27803,9 +28720,10 @@ void m68000_base_device::x5de8_slt_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5df0_slt_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_LT() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_LT() ? 0xff : 0);
 
 
 }
@@ -27857,9 +28775,10 @@ void m68000_base_device::x5ee8_sgt_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5ef0_sgt_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_GT() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_GT() ? 0xff : 0);
 
 
 }
@@ -27911,9 +28830,10 @@ void m68000_base_device::x5fe8_sle_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5ff0_sle_b_ix_071234fc()
 {
-	m68ki_write_8(EA_AY_IX_8(), COND_LE() ? 0xff : 0);
+	m68ki_write_8(EA_AY_IX_8<Types>(), COND_LE() ? 0xff : 0);
 
 
 }
@@ -28055,10 +28975,11 @@ void m68000_base_device::x9028_sub_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9030_sub_b_ix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_IX_8();
+	u32 src = OPER_AY_IX_8<Types>();
 	u32 dst = MASK_OUT_ABOVE_8(*r_dst);
 	u32 res = dst - src;
 
@@ -28119,10 +29040,11 @@ void m68000_base_device::x903a_sub_b_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x903b_sub_b_pcix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_PCIX_8();
+	u32 src = OPER_PCIX_8<Types>();
 	u32 dst = MASK_OUT_ABOVE_8(*r_dst);
 	u32 res = dst - src;
 
@@ -28183,10 +29105,11 @@ void m68000_base_device::x9048_sub_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9050_sub_w_ai_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_AI_16();
+	u32 src = OPER_AY_AI_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = dst - src;
 
@@ -28199,10 +29122,11 @@ void m68000_base_device::x9050_sub_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9058_sub_w_pi_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_PI_16();
+	u32 src = OPER_AY_PI_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = dst - src;
 
@@ -28215,10 +29139,11 @@ void m68000_base_device::x9058_sub_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9060_sub_w_pd_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_PD_16();
+	u32 src = OPER_AY_PD_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = dst - src;
 
@@ -28231,10 +29156,11 @@ void m68000_base_device::x9060_sub_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9068_sub_w_di_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_DI_16();
+	u32 src = OPER_AY_DI_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = dst - src;
 
@@ -28247,10 +29173,11 @@ void m68000_base_device::x9068_sub_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9070_sub_w_ix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_IX_16();
+	u32 src = OPER_AY_IX_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = dst - src;
 
@@ -28263,10 +29190,11 @@ void m68000_base_device::x9070_sub_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9078_sub_w_aw_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AW_16();
+	u32 src = OPER_AW_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = dst - src;
 
@@ -28279,10 +29207,11 @@ void m68000_base_device::x9078_sub_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9079_sub_w_al_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AL_16();
+	u32 src = OPER_AL_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = dst - src;
 
@@ -28311,10 +29240,11 @@ void m68000_base_device::x907a_sub_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x907b_sub_w_pcix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_PCIX_16();
+	u32 src = OPER_PCIX_16<Types>();
 	u32 dst = MASK_OUT_ABOVE_16(*r_dst);
 	u32 res = dst - src;
 
@@ -28375,10 +29305,11 @@ void m68000_base_device::x9088_sub_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9090_sub_l_ai_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_AI_32();
+	u32 src = OPER_AY_AI_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = dst - src;
 
@@ -28391,10 +29322,11 @@ void m68000_base_device::x9090_sub_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9098_sub_l_pi_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_PI_32();
+	u32 src = OPER_AY_PI_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = dst - src;
 
@@ -28407,10 +29339,11 @@ void m68000_base_device::x9098_sub_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90a0_sub_l_pd_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_PD_32();
+	u32 src = OPER_AY_PD_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = dst - src;
 
@@ -28423,10 +29356,11 @@ void m68000_base_device::x90a0_sub_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90a8_sub_l_di_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_DI_32();
+	u32 src = OPER_AY_DI_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = dst - src;
 
@@ -28439,10 +29373,11 @@ void m68000_base_device::x90a8_sub_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90b0_sub_l_ix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AY_IX_32();
+	u32 src = OPER_AY_IX_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = dst - src;
 
@@ -28455,10 +29390,11 @@ void m68000_base_device::x90b0_sub_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90b8_sub_l_aw_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AW_32();
+	u32 src = OPER_AW_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = dst - src;
 
@@ -28471,10 +29407,11 @@ void m68000_base_device::x90b8_sub_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90b9_sub_l_al_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_AL_32();
+	u32 src = OPER_AL_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = dst - src;
 
@@ -28503,10 +29440,11 @@ void m68000_base_device::x90ba_sub_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90bb_sub_l_pcix_071234fc()
 {
 	u32* r_dst = &DX();
-	u32 src = OPER_PCIX_32();
+	u32 src = OPER_PCIX_32<Types>();
 	u32 dst = *r_dst;
 	u32 res = dst - src;
 
@@ -28631,9 +29569,10 @@ void m68000_base_device::x9128_sub_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9130_sub_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 src = MASK_OUT_ABOVE_8(DX());
 	u32 dst = m68ki_read_8(ea);
 	u32 res = dst - src;
@@ -28679,11 +29618,12 @@ void m68000_base_device::x9139_sub_b_al_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9150_sub_w_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_16();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -28691,15 +29631,16 @@ void m68000_base_device::x9150_sub_w_ai_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9158_sub_w_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_16();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -28707,15 +29648,16 @@ void m68000_base_device::x9158_sub_w_pi_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9160_sub_w_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_16();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -28723,15 +29665,16 @@ void m68000_base_device::x9160_sub_w_pd_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9168_sub_w_di_071234fc()
 {
 	u32 ea = EA_AY_DI_16();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -28739,15 +29682,16 @@ void m68000_base_device::x9168_sub_w_di_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9170_sub_w_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_16();
+	u32 ea = EA_AY_IX_16<Types>();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -28755,15 +29699,16 @@ void m68000_base_device::x9170_sub_w_ix_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9178_sub_w_aw_071234fc()
 {
 	u32 ea = EA_AW_16();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -28771,15 +29716,16 @@ void m68000_base_device::x9178_sub_w_aw_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9179_sub_w_al_071234fc()
 {
 	u32 ea = EA_AL_16();
 	u32 src = MASK_OUT_ABOVE_16(DX());
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -28787,15 +29733,16 @@ void m68000_base_device::x9179_sub_w_al_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9190_sub_l_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_32();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -28803,15 +29750,16 @@ void m68000_base_device::x9190_sub_l_ai_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9198_sub_l_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_32();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -28819,15 +29767,16 @@ void m68000_base_device::x9198_sub_l_pi_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91a0_sub_l_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_32();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -28835,15 +29784,16 @@ void m68000_base_device::x91a0_sub_l_pd_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91a8_sub_l_di_071234fc()
 {
 	u32 ea = EA_AY_DI_32();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -28851,15 +29801,16 @@ void m68000_base_device::x91a8_sub_l_di_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91b0_sub_l_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_32();
+	u32 ea = EA_AY_IX_32<Types>();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -28867,15 +29818,16 @@ void m68000_base_device::x91b0_sub_l_ix_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91b8_sub_l_aw_071234fc()
 {
 	u32 ea = EA_AW_32();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -28883,15 +29835,16 @@ void m68000_base_device::x91b8_sub_l_aw_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91b9_sub_l_al_071234fc()
 {
 	u32 ea = EA_AL_32();
 	u32 src = DX();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -28899,7 +29852,7 @@ void m68000_base_device::x91b9_sub_l_al_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
@@ -28919,64 +29872,71 @@ void m68000_base_device::x90c8_suba_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90d0_suba_w_ai_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AY_AI_16());
+	u32 src = MAKE_INT_16(OPER_AY_AI_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90d8_suba_w_pi_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AY_PI_16());
+	u32 src = MAKE_INT_16(OPER_AY_PI_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90e0_suba_w_pd_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AY_PD_16());
+	u32 src = MAKE_INT_16(OPER_AY_PD_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90e8_suba_w_di_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AY_DI_16());
+	u32 src = MAKE_INT_16(OPER_AY_DI_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90f0_suba_w_ix_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AY_IX_16());
+	u32 src = MAKE_INT_16(OPER_AY_IX_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90f8_suba_w_aw_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AW_16());
+	u32 src = MAKE_INT_16(OPER_AW_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90f9_suba_w_al_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_AL_16());
+	u32 src = MAKE_INT_16(OPER_AL_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
@@ -28991,10 +29951,11 @@ void m68000_base_device::x90fa_suba_w_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x90fb_suba_w_pcix_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = MAKE_INT_16(OPER_PCIX_16());
+	u32 src = MAKE_INT_16(OPER_PCIX_16<Types>());
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
@@ -29025,64 +29986,71 @@ void m68000_base_device::x91c8_suba_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91d0_suba_l_ai_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AY_AI_32();
+	u32 src = OPER_AY_AI_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91d8_suba_l_pi_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AY_PI_32();
+	u32 src = OPER_AY_PI_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91e0_suba_l_pd_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AY_PD_32();
+	u32 src = OPER_AY_PD_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91e8_suba_l_di_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AY_DI_32();
+	u32 src = OPER_AY_DI_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91f0_suba_l_ix_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AY_IX_32();
+	u32 src = OPER_AY_IX_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91f8_suba_l_aw_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AW_32();
+	u32 src = OPER_AW_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91f9_suba_l_al_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_AL_32();
+	u32 src = OPER_AL_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
@@ -29097,10 +30065,11 @@ void m68000_base_device::x91fa_suba_l_pcdi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x91fb_suba_l_pcix_071234fc()
 {
 	u32* r_dst = &AX();
-	u32 src = OPER_PCIX_32();
+	u32 src = OPER_PCIX_32<Types>();
 
 	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
 
@@ -29227,10 +30196,11 @@ void m68000_base_device::x0428_subi_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0430_subi_b_ix_071234fc()
 {
 	u32 src = OPER_I_8();
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 dst = m68ki_read_8(ea);
 	u32 res = dst - src;
 
@@ -29291,11 +30261,12 @@ void m68000_base_device::x0440_subi_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0450_subi_w_ai_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_AI_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29303,15 +30274,16 @@ void m68000_base_device::x0450_subi_w_ai_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0458_subi_w_pi_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_PI_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29319,15 +30291,16 @@ void m68000_base_device::x0458_subi_w_pi_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0460_subi_w_pd_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_PD_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29335,15 +30308,16 @@ void m68000_base_device::x0460_subi_w_pd_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0468_subi_w_di_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AY_DI_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29351,15 +30325,16 @@ void m68000_base_device::x0468_subi_w_di_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0470_subi_w_ix_071234fc()
 {
 	u32 src = OPER_I_16();
-	u32 ea = EA_AY_IX_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29367,15 +30342,16 @@ void m68000_base_device::x0470_subi_w_ix_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0478_subi_w_aw_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AW_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29383,15 +30359,16 @@ void m68000_base_device::x0478_subi_w_aw_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0479_subi_w_al_071234fc()
 {
 	u32 src = OPER_I_16();
 	u32 ea = EA_AL_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29399,7 +30376,7 @@ void m68000_base_device::x0479_subi_w_al_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
@@ -29419,11 +30396,12 @@ void m68000_base_device::x0480_subi_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0490_subi_l_ai_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_AI_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29431,15 +30409,16 @@ void m68000_base_device::x0490_subi_l_ai_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x0498_subi_l_pi_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_PI_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29447,15 +30426,16 @@ void m68000_base_device::x0498_subi_l_pi_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x04a0_subi_l_pd_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_PD_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29463,15 +30443,16 @@ void m68000_base_device::x04a0_subi_l_pd_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x04a8_subi_l_di_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AY_DI_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29479,15 +30460,16 @@ void m68000_base_device::x04a8_subi_l_di_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x04b0_subi_l_ix_071234fc()
 {
 	u32 src = OPER_I_32();
-	u32 ea = EA_AY_IX_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29495,15 +30477,16 @@ void m68000_base_device::x04b0_subi_l_ix_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x04b8_subi_l_aw_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AW_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29511,15 +30494,16 @@ void m68000_base_device::x04b8_subi_l_aw_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x04b9_subi_l_al_071234fc()
 {
 	u32 src = OPER_I_32();
 	u32 ea = EA_AL_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29527,7 +30511,7 @@ void m68000_base_device::x04b9_subi_l_al_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
@@ -29643,10 +30627,11 @@ void m68000_base_device::x5128_subq_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5130_subq_b_ix_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 dst = m68ki_read_8(ea);
 	u32 res = dst - src;
 
@@ -29715,11 +30700,12 @@ void m68000_base_device::x5148_subq_w_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5150_subq_w_ai_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_AI_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29727,15 +30713,16 @@ void m68000_base_device::x5150_subq_w_ai_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5158_subq_w_pi_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_PI_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29743,15 +30730,16 @@ void m68000_base_device::x5158_subq_w_pi_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5160_subq_w_pd_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_PD_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29759,15 +30747,16 @@ void m68000_base_device::x5160_subq_w_pd_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5168_subq_w_di_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_DI_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29775,15 +30764,16 @@ void m68000_base_device::x5168_subq_w_di_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5170_subq_w_ix_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
-	u32 ea = EA_AY_IX_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 ea = EA_AY_IX_16<Types>();
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29791,15 +30781,16 @@ void m68000_base_device::x5170_subq_w_ix_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5178_subq_w_aw_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AW_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29807,15 +30798,16 @@ void m68000_base_device::x5178_subq_w_aw_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5179_subq_w_al_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AL_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_16(res);
@@ -29823,7 +30815,7 @@ void m68000_base_device::x5179_subq_w_al_071234fc()
 	m_x_flag = m_c_flag = CFLAG_16(res);
 	m_v_flag = VFLAG_SUB_16(src, dst, res);
 
-	m68ki_write_16(ea, m_not_z_flag);
+	m68ki_write_16<Types>(ea, m_not_z_flag);
 
 
 }
@@ -29851,11 +30843,12 @@ void m68000_base_device::x5188_subq_l_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5190_subq_l_ai_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_AI_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29863,15 +30856,16 @@ void m68000_base_device::x5190_subq_l_ai_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x5198_subq_l_pi_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_PI_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29879,15 +30873,16 @@ void m68000_base_device::x5198_subq_l_pi_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x51a0_subq_l_pd_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_PD_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29895,15 +30890,16 @@ void m68000_base_device::x51a0_subq_l_pd_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x51a8_subq_l_di_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AY_DI_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29911,15 +30907,16 @@ void m68000_base_device::x51a8_subq_l_di_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x51b0_subq_l_ix_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
-	u32 ea = EA_AY_IX_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 ea = EA_AY_IX_32<Types>();
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29927,15 +30924,16 @@ void m68000_base_device::x51b0_subq_l_ix_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x51b8_subq_l_aw_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AW_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29943,15 +30941,16 @@ void m68000_base_device::x51b8_subq_l_aw_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x51b9_subq_l_al_071234fc()
 {
 	u32 src = (((m_ir >> 9) - 1) & 7) + 1;
 	u32 ea = EA_AL_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src;
 
 	m_n_flag = NFLAG_32(res);
@@ -29959,7 +30958,7 @@ void m68000_base_device::x51b9_subq_l_al_071234fc()
 	m_x_flag = m_c_flag = CFLAG_SUB_32(src, dst, res);
 	m_v_flag = VFLAG_SUB_32(src, dst, res);
 
-	m68ki_write_32(ea, m_not_z_flag);
+	m68ki_write_32<Types>(ea, m_not_z_flag);
 
 
 }
@@ -30089,11 +31088,12 @@ void m68000_base_device::x9108_subx_b_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9148_subx_w_071234fc()
 {
-	u32 src = OPER_AY_PD_16();
+	u32 src = OPER_AY_PD_16<Types>();
 	u32 ea  = EA_AX_PD_16();
-	u32 dst = m68ki_read_16(ea);
+	u32 dst = m68ki_read_16<Types>(ea);
 	u32 res = dst - src - XFLAG_1();
 
 	m_n_flag = NFLAG_16(res);
@@ -30103,15 +31103,16 @@ void m68000_base_device::x9148_subx_w_071234fc()
 	res = MASK_OUT_ABOVE_16(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_16(ea, res);
+	m68ki_write_16<Types>(ea, res);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x9188_subx_l_071234fc()
 {
-	u32 src = OPER_AY_PD_32();
+	u32 src = OPER_AY_PD_32<Types>();
 	u32 ea  = EA_AX_PD_32();
-	u32 dst = m68ki_read_32(ea);
+	u32 dst = m68ki_read_32<Types>(ea);
 	u32 res = dst - src - XFLAG_1();
 
 	m_n_flag = NFLAG_32(res);
@@ -30121,7 +31122,7 @@ void m68000_base_device::x9188_subx_l_071234fc()
 	res = MASK_OUT_ABOVE_32(res);
 	m_not_z_flag |= res;
 
-	m68ki_write_32(ea, res);
+	m68ki_write_32<Types>(ea, res);
 
 
 }
@@ -30151,6 +31152,7 @@ void m68000_base_device::x4ac0_tas_b_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ad0_tas_b_ai_071234fc()
 {
 	u32 ea = EA_AY_AI_8();
@@ -30166,13 +31168,14 @@ void m68000_base_device::x4ad0_tas_b_ai_071234fc()
 	   bus implementation.
 	   In particular, the Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS
 	   to fail to write back in order to function properly. */
-	if (CPU_TYPE_IS_010_LESS() && !m_tas_write_callback.isnull())
+	if (CPU_TYPE_IS_010_LESS<Types>() && !m_tas_write_callback.isnull())
 		(m_tas_write_callback)(ea, dst | 0x80);
 	else
 		m68ki_write_8(ea, dst | 0x80);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ad8_tas_b_pi_071234fc()
 {
 	u32 ea = EA_AY_PI_8();
@@ -30188,13 +31191,14 @@ void m68000_base_device::x4ad8_tas_b_pi_071234fc()
 	   bus implementation.
 	   In particular, the Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS
 	   to fail to write back in order to function properly. */
-	if (CPU_TYPE_IS_010_LESS() && !m_tas_write_callback.isnull())
+	if (CPU_TYPE_IS_010_LESS<Types>() && !m_tas_write_callback.isnull())
 		(m_tas_write_callback)(ea, dst | 0x80);
 	else
 		m68ki_write_8(ea, dst | 0x80);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4adf_tas_b_pi7_071234fc()
 {
 	u32 ea = EA_A7_PI_8();
@@ -30210,13 +31214,14 @@ void m68000_base_device::x4adf_tas_b_pi7_071234fc()
 	   bus implementation.
 	   In particular, the Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS
 	   to fail to write back in order to function properly. */
-	if (CPU_TYPE_IS_010_LESS() && !m_tas_write_callback.isnull())
+	if (CPU_TYPE_IS_010_LESS<Types>() && !m_tas_write_callback.isnull())
 		(m_tas_write_callback)(ea, dst | 0x80);
 	else
 		m68ki_write_8(ea, dst | 0x80);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ae0_tas_b_pd_071234fc()
 {
 	u32 ea = EA_AY_PD_8();
@@ -30232,13 +31237,14 @@ void m68000_base_device::x4ae0_tas_b_pd_071234fc()
 	   bus implementation.
 	   In particular, the Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS
 	   to fail to write back in order to function properly. */
-	if (CPU_TYPE_IS_010_LESS() && !m_tas_write_callback.isnull())
+	if (CPU_TYPE_IS_010_LESS<Types>() && !m_tas_write_callback.isnull())
 		(m_tas_write_callback)(ea, dst | 0x80);
 	else
 		m68ki_write_8(ea, dst | 0x80);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ae7_tas_b_pd7_071234fc()
 {
 	u32 ea = EA_A7_PD_8();
@@ -30254,13 +31260,14 @@ void m68000_base_device::x4ae7_tas_b_pd7_071234fc()
 	   bus implementation.
 	   In particular, the Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS
 	   to fail to write back in order to function properly. */
-	if (CPU_TYPE_IS_010_LESS() && !m_tas_write_callback.isnull())
+	if (CPU_TYPE_IS_010_LESS<Types>() && !m_tas_write_callback.isnull())
 		(m_tas_write_callback)(ea, dst | 0x80);
 	else
 		m68ki_write_8(ea, dst | 0x80);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ae8_tas_b_di_071234fc()
 {
 	u32 ea = EA_AY_DI_8();
@@ -30276,16 +31283,17 @@ void m68000_base_device::x4ae8_tas_b_di_071234fc()
 	   bus implementation.
 	   In particular, the Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS
 	   to fail to write back in order to function properly. */
-	if (CPU_TYPE_IS_010_LESS() && !m_tas_write_callback.isnull())
+	if (CPU_TYPE_IS_010_LESS<Types>() && !m_tas_write_callback.isnull())
 		(m_tas_write_callback)(ea, dst | 0x80);
 	else
 		m68ki_write_8(ea, dst | 0x80);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4af0_tas_b_ix_071234fc()
 {
-	u32 ea = EA_AY_IX_8();
+	u32 ea = EA_AY_IX_8<Types>();
 	u32 dst = m68ki_read_8(ea);
 
 	m_not_z_flag = dst;
@@ -30298,13 +31306,14 @@ void m68000_base_device::x4af0_tas_b_ix_071234fc()
 	   bus implementation.
 	   In particular, the Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS
 	   to fail to write back in order to function properly. */
-	if (CPU_TYPE_IS_010_LESS() && !m_tas_write_callback.isnull())
+	if (CPU_TYPE_IS_010_LESS<Types>() && !m_tas_write_callback.isnull())
 		(m_tas_write_callback)(ea, dst | 0x80);
 	else
 		m68ki_write_8(ea, dst | 0x80);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4af8_tas_b_aw_071234fc()
 {
 	u32 ea = EA_AW_8();
@@ -30320,13 +31329,14 @@ void m68000_base_device::x4af8_tas_b_aw_071234fc()
 	   bus implementation.
 	   In particular, the Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS
 	   to fail to write back in order to function properly. */
-	if (CPU_TYPE_IS_010_LESS() && !m_tas_write_callback.isnull())
+	if (CPU_TYPE_IS_010_LESS<Types>() && !m_tas_write_callback.isnull())
 		(m_tas_write_callback)(ea, dst | 0x80);
 	else
 		m68ki_write_8(ea, dst | 0x80);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4af9_tas_b_al_071234fc()
 {
 	u32 ea = EA_AL_8();
@@ -30342,7 +31352,7 @@ void m68000_base_device::x4af9_tas_b_al_071234fc()
 	   bus implementation.
 	   In particular, the Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS
 	   to fail to write back in order to function properly. */
-	if (CPU_TYPE_IS_010_LESS() && !m_tas_write_callback.isnull())
+	if (CPU_TYPE_IS_010_LESS<Types>() && !m_tas_write_callback.isnull())
 		(m_tas_write_callback)(ea, dst | 0x80);
 	else
 		m68ki_write_8(ea, dst | 0x80);
@@ -30854,9 +31864,10 @@ void m68000_base_device::x4a28_tst_b_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4a30_tst_b_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_8();
+	u32 res = OPER_AY_IX_8<Types>();
 
 	m_n_flag = NFLAG_8(res);
 	m_not_z_flag = res;
@@ -30898,9 +31909,10 @@ void m68000_base_device::x4a3a_tst_b_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4a3b_tst_b_234fc()
 {
-	u32 res = OPER_PCIX_8();
+	u32 res = OPER_PCIX_8<Types>();
 
 	m_n_flag = NFLAG_8(res);
 	m_not_z_flag = res;
@@ -30942,9 +31954,10 @@ void m68000_base_device::x4a48_tst_w_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4a50_tst_w_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_16();
+	u32 res = OPER_AY_AI_16<Types>();
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -30953,9 +31966,10 @@ void m68000_base_device::x4a50_tst_w_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4a58_tst_w_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_16();
+	u32 res = OPER_AY_PI_16<Types>();
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -30964,9 +31978,10 @@ void m68000_base_device::x4a58_tst_w_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4a60_tst_w_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_16();
+	u32 res = OPER_AY_PD_16<Types>();
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -30975,9 +31990,10 @@ void m68000_base_device::x4a60_tst_w_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4a68_tst_w_di_071234fc()
 {
-	u32 res = OPER_AY_DI_16();
+	u32 res = OPER_AY_DI_16<Types>();
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -30986,9 +32002,10 @@ void m68000_base_device::x4a68_tst_w_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4a70_tst_w_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_16();
+	u32 res = OPER_AY_IX_16<Types>();
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -30997,9 +32014,10 @@ void m68000_base_device::x4a70_tst_w_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4a78_tst_w_aw_071234fc()
 {
-	u32 res = OPER_AW_16();
+	u32 res = OPER_AW_16<Types>();
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -31008,9 +32026,10 @@ void m68000_base_device::x4a78_tst_w_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4a79_tst_w_al_071234fc()
 {
-	u32 res = OPER_AL_16();
+	u32 res = OPER_AL_16<Types>();
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -31030,9 +32049,10 @@ void m68000_base_device::x4a7a_tst_w_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4a7b_tst_w_234fc()
 {
-	u32 res = OPER_PCIX_16();
+	u32 res = OPER_PCIX_16<Types>();
 
 	m_n_flag = NFLAG_16(res);
 	m_not_z_flag = res;
@@ -31074,9 +32094,10 @@ void m68000_base_device::x4a88_tst_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4a90_tst_l_ai_071234fc()
 {
-	u32 res = OPER_AY_AI_32();
+	u32 res = OPER_AY_AI_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -31085,9 +32106,10 @@ void m68000_base_device::x4a90_tst_l_ai_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4a98_tst_l_pi_071234fc()
 {
-	u32 res = OPER_AY_PI_32();
+	u32 res = OPER_AY_PI_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -31096,9 +32118,10 @@ void m68000_base_device::x4a98_tst_l_pi_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4aa0_tst_l_pd_071234fc()
 {
-	u32 res = OPER_AY_PD_32();
+	u32 res = OPER_AY_PD_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -31107,9 +32130,10 @@ void m68000_base_device::x4aa0_tst_l_pd_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4aa8_tst_l_di_071234fc()
 {
-	u32 res = OPER_AY_DI_32();
+	u32 res = OPER_AY_DI_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -31118,9 +32142,10 @@ void m68000_base_device::x4aa8_tst_l_di_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ab0_tst_l_ix_071234fc()
 {
-	u32 res = OPER_AY_IX_32();
+	u32 res = OPER_AY_IX_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -31129,9 +32154,10 @@ void m68000_base_device::x4ab0_tst_l_ix_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ab8_tst_l_aw_071234fc()
 {
-	u32 res = OPER_AW_32();
+	u32 res = OPER_AW_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -31140,9 +32166,10 @@ void m68000_base_device::x4ab8_tst_l_aw_071234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4ab9_tst_l_al_071234fc()
 {
-	u32 res = OPER_AL_32();
+	u32 res = OPER_AL_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -31162,9 +32189,10 @@ void m68000_base_device::x4aba_tst_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4abb_tst_l_234fc()
 {
-	u32 res = OPER_PCIX_32();
+	u32 res = OPER_PCIX_32<Types>();
 
 	m_n_flag = NFLAG_32(res);
 	m_not_z_flag = res;
@@ -31184,18 +32212,20 @@ void m68000_base_device::x4abc_tst_l_234fc()
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4e5f_unlk_l_071234fc()
 {
-	REG_A()[7] = m68ki_read_32(REG_A()[7]);
+	REG_A()[7] = m68ki_read_32<Types>(REG_A()[7]);
 
 
 }
+template <u32 Types>
 void m68000_base_device::x4e58_unlk_l_071234fc()
 {
 	u32* r_dst = &AY();
 
 	REG_A()[7] = *r_dst;
-	*r_dst = m68ki_pull_32();
+	*r_dst = m68ki_pull_32<Types>();
 
 
 }
@@ -31304,7 +32334,9 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::xf040_cpscc_l_23,
 	&m68000_base_device::xf000_pmmu_l_234fc,
 	&m68000_base_device::x6000_bra_b_071234fc,
-	&m68000_base_device::x6100_bsr_b_071234fc,
+	&m68000_base_device::x6100_bsr_b_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x6100_bsr_b_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x6100_bsr_b_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x6200_bhi_b_071234fc,
 	&m68000_base_device::x6300_bls_b_071234fc,
 	&m68000_base_device::x6400_bcc_b_071234fc,
@@ -31329,483 +32361,1086 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::x0118_btst_b_pi_071234fc,
 	&m68000_base_device::x0120_btst_b_pd_071234fc,
 	&m68000_base_device::x0128_btst_b_di_071234fc,
-	&m68000_base_device::x0130_btst_b_ix_071234fc,
+	&m68000_base_device::x0130_btst_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0130_btst_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0130_btst_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0140_bchg_l_071234fc,
 	&m68000_base_device::x0148_movep_l_071234fc,
 	&m68000_base_device::x0150_bchg_b_ai_071234fc,
 	&m68000_base_device::x0158_bchg_b_pi_071234fc,
 	&m68000_base_device::x0160_bchg_b_pd_071234fc,
 	&m68000_base_device::x0168_bchg_b_di_071234fc,
-	&m68000_base_device::x0170_bchg_b_ix_071234fc,
+	&m68000_base_device::x0170_bchg_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0170_bchg_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0170_bchg_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0180_bclr_l_071234fc,
 	&m68000_base_device::x0188_movep_w_071234fc,
 	&m68000_base_device::x0190_bclr_b_ai_071234fc,
 	&m68000_base_device::x0198_bclr_b_pi_071234fc,
 	&m68000_base_device::x01a0_bclr_b_pd_071234fc,
 	&m68000_base_device::x01a8_bclr_b_di_071234fc,
-	&m68000_base_device::x01b0_bclr_b_ix_071234fc,
+	&m68000_base_device::x01b0_bclr_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x01b0_bclr_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x01b0_bclr_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x01c0_bset_l_071234fc,
 	&m68000_base_device::x01c8_movep_l_071234fc,
 	&m68000_base_device::x01d0_bset_b_ai_071234fc,
 	&m68000_base_device::x01d8_bset_b_pi_071234fc,
 	&m68000_base_device::x01e0_bset_b_pd_071234fc,
 	&m68000_base_device::x01e8_bset_b_di_071234fc,
-	&m68000_base_device::x01f0_bset_b_ix_071234fc,
+	&m68000_base_device::x01f0_bset_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x01f0_bset_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x01f0_bset_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x1000_move_b_071234fc,
 	&m68000_base_device::x1010_move_b_ai_071234fc,
 	&m68000_base_device::x1018_move_b_pi_071234fc,
 	&m68000_base_device::x1020_move_b_pd_071234fc,
 	&m68000_base_device::x1028_move_b_di_071234fc,
-	&m68000_base_device::x1030_move_b_ix_071234fc,
+	&m68000_base_device::x1030_move_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x1030_move_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x1030_move_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x1080_move_b_071234fc,
 	&m68000_base_device::x1090_move_b_ai_071234fc,
 	&m68000_base_device::x1098_move_b_pi_071234fc,
 	&m68000_base_device::x10a0_move_b_pd_071234fc,
 	&m68000_base_device::x10a8_move_b_di_071234fc,
-	&m68000_base_device::x10b0_move_b_ix_071234fc,
+	&m68000_base_device::x10b0_move_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x10b0_move_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x10b0_move_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x10c0_move_b_071234fc,
 	&m68000_base_device::x10d0_move_b_ai_071234fc,
 	&m68000_base_device::x10d8_move_b_pi_071234fc,
 	&m68000_base_device::x10e0_move_b_pd_071234fc,
 	&m68000_base_device::x10e8_move_b_di_071234fc,
-	&m68000_base_device::x10f0_move_b_ix_071234fc,
+	&m68000_base_device::x10f0_move_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x10f0_move_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x10f0_move_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x1100_move_b_071234fc,
 	&m68000_base_device::x1110_move_b_ai_071234fc,
 	&m68000_base_device::x1118_move_b_pi_071234fc,
 	&m68000_base_device::x1120_move_b_pd_071234fc,
 	&m68000_base_device::x1128_move_b_di_071234fc,
-	&m68000_base_device::x1130_move_b_ix_071234fc,
+	&m68000_base_device::x1130_move_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x1130_move_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x1130_move_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x1140_move_b_071234fc,
 	&m68000_base_device::x1150_move_b_ai_071234fc,
 	&m68000_base_device::x1158_move_b_pi_071234fc,
 	&m68000_base_device::x1160_move_b_pd_071234fc,
 	&m68000_base_device::x1168_move_b_di_071234fc,
-	&m68000_base_device::x1170_move_b_ix_071234fc,
-	&m68000_base_device::x1180_move_b_071234fc,
-	&m68000_base_device::x1190_move_b_ai_071234fc,
-	&m68000_base_device::x1198_move_b_pi_071234fc,
-	&m68000_base_device::x11a0_move_b_pd_071234fc,
-	&m68000_base_device::x11a8_move_b_di_071234fc,
-	&m68000_base_device::x11b0_move_b_ix_071234fc,
+	&m68000_base_device::x1170_move_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x1170_move_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x1170_move_b_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x1180_move_b_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x1180_move_b_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x1180_move_b_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x1190_move_b_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x1190_move_b_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x1190_move_b_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x1198_move_b_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x1198_move_b_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x1198_move_b_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x11a0_move_b_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x11a0_move_b_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x11a0_move_b_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x11a8_move_b_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x11a8_move_b_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x11a8_move_b_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x11b0_move_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x11b0_move_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x11b0_move_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x2000_move_l_071234fc,
 	&m68000_base_device::x2008_move_l_071234fc,
-	&m68000_base_device::x2010_move_l_ai_071234fc,
-	&m68000_base_device::x2018_move_l_pi_071234fc,
-	&m68000_base_device::x2020_move_l_pd_071234fc,
-	&m68000_base_device::x2028_move_l_di_071234fc,
-	&m68000_base_device::x2030_move_l_ix_071234fc,
+	&m68000_base_device::x2010_move_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2010_move_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2010_move_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2018_move_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2018_move_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2018_move_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2020_move_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2020_move_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2020_move_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2028_move_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2028_move_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2028_move_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2030_move_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2030_move_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2030_move_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x2040_movea_l_071234fc,
 	&m68000_base_device::x2048_movea_l_071234fc,
-	&m68000_base_device::x2050_movea_l_ai_071234fc,
-	&m68000_base_device::x2058_movea_l_pi_071234fc,
-	&m68000_base_device::x2060_movea_l_pd_071234fc,
-	&m68000_base_device::x2068_movea_l_di_071234fc,
-	&m68000_base_device::x2070_movea_l_ix_071234fc,
-	&m68000_base_device::x2080_move_l_071234fc,
-	&m68000_base_device::x2088_move_l_071234fc,
-	&m68000_base_device::x2090_move_l_ai_071234fc,
-	&m68000_base_device::x2098_move_l_pi_071234fc,
-	&m68000_base_device::x20a0_move_l_pd_071234fc,
-	&m68000_base_device::x20a8_move_l_di_071234fc,
-	&m68000_base_device::x20b0_move_l_ix_071234fc,
-	&m68000_base_device::x20c0_move_l_071234fc,
-	&m68000_base_device::x20c8_move_l_071234fc,
-	&m68000_base_device::x20d0_move_l_ai_071234fc,
-	&m68000_base_device::x20d8_move_l_pi_071234fc,
-	&m68000_base_device::x20e0_move_l_pd_071234fc,
-	&m68000_base_device::x20e8_move_l_di_071234fc,
-	&m68000_base_device::x20f0_move_l_ix_071234fc,
-	&m68000_base_device::x2100_move_l_071234fc,
-	&m68000_base_device::x2108_move_l_071234fc,
-	&m68000_base_device::x2110_move_l_ai_071234fc,
-	&m68000_base_device::x2118_move_l_pi_071234fc,
-	&m68000_base_device::x2120_move_l_pd_071234fc,
-	&m68000_base_device::x2128_move_l_di_071234fc,
-	&m68000_base_device::x2130_move_l_ix_071234fc,
-	&m68000_base_device::x2140_move_l_071234fc,
-	&m68000_base_device::x2148_move_l_071234fc,
-	&m68000_base_device::x2150_move_l_ai_071234fc,
-	&m68000_base_device::x2158_move_l_pi_071234fc,
-	&m68000_base_device::x2160_move_l_pd_071234fc,
-	&m68000_base_device::x2168_move_l_di_071234fc,
-	&m68000_base_device::x2170_move_l_ix_071234fc,
-	&m68000_base_device::x2180_move_l_071234fc,
-	&m68000_base_device::x2188_move_l_071234fc,
-	&m68000_base_device::x2190_move_l_ai_071234fc,
-	&m68000_base_device::x2198_move_l_pi_071234fc,
-	&m68000_base_device::x21a0_move_l_pd_071234fc,
-	&m68000_base_device::x21a8_move_l_di_071234fc,
-	&m68000_base_device::x21b0_move_l_ix_071234fc,
+	&m68000_base_device::x2050_movea_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2050_movea_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2050_movea_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2058_movea_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2058_movea_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2058_movea_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2060_movea_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2060_movea_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2060_movea_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2068_movea_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2068_movea_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2068_movea_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2070_movea_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2070_movea_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2070_movea_l_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2080_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2080_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2080_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2088_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2088_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2088_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2090_move_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2090_move_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2090_move_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2098_move_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2098_move_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2098_move_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20a0_move_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20a0_move_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20a0_move_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20a8_move_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20a8_move_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20a8_move_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20b0_move_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20b0_move_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20b0_move_l_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20c0_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20c0_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20c0_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20c8_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20c8_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20c8_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20d0_move_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20d0_move_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20d0_move_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20d8_move_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20d8_move_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20d8_move_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20e0_move_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20e0_move_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20e0_move_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20e8_move_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20e8_move_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20e8_move_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20f0_move_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20f0_move_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20f0_move_l_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2100_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2100_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2100_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2108_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2108_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2108_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2110_move_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2110_move_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2110_move_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2118_move_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2118_move_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2118_move_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2120_move_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2120_move_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2120_move_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2128_move_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2128_move_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2128_move_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2130_move_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2130_move_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2130_move_l_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2140_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2140_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2140_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2148_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2148_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2148_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2150_move_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2150_move_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2150_move_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2158_move_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2158_move_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2158_move_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2160_move_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2160_move_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2160_move_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2168_move_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2168_move_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2168_move_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2170_move_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2170_move_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2170_move_l_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2180_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2180_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2180_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2188_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2188_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2188_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2190_move_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2190_move_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2190_move_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2198_move_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2198_move_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2198_move_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21a0_move_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21a0_move_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21a0_move_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21a8_move_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21a8_move_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21a8_move_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21b0_move_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21b0_move_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21b0_move_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x3000_move_w_071234fc,
 	&m68000_base_device::x3008_move_w_071234fc,
-	&m68000_base_device::x3010_move_w_ai_071234fc,
-	&m68000_base_device::x3018_move_w_pi_071234fc,
-	&m68000_base_device::x3020_move_w_pd_071234fc,
-	&m68000_base_device::x3028_move_w_di_071234fc,
-	&m68000_base_device::x3030_move_w_ix_071234fc,
+	&m68000_base_device::x3010_move_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3010_move_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3010_move_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3018_move_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3018_move_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3018_move_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3020_move_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3020_move_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3020_move_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3028_move_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3028_move_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3028_move_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3030_move_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3030_move_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3030_move_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x3040_movea_w_071234fc,
 	&m68000_base_device::x3048_movea_w_071234fc,
-	&m68000_base_device::x3050_movea_w_ai_071234fc,
-	&m68000_base_device::x3058_movea_w_pi_071234fc,
-	&m68000_base_device::x3060_movea_w_pd_071234fc,
-	&m68000_base_device::x3068_movea_w_di_071234fc,
-	&m68000_base_device::x3070_movea_w_ix_071234fc,
-	&m68000_base_device::x3080_move_w_071234fc,
-	&m68000_base_device::x3088_move_w_071234fc,
-	&m68000_base_device::x3090_move_w_ai_071234fc,
-	&m68000_base_device::x3098_move_w_pi_071234fc,
-	&m68000_base_device::x30a0_move_w_pd_071234fc,
-	&m68000_base_device::x30a8_move_w_di_071234fc,
-	&m68000_base_device::x30b0_move_w_ix_071234fc,
-	&m68000_base_device::x30c0_move_w_071234fc,
-	&m68000_base_device::x30c8_move_w_071234fc,
-	&m68000_base_device::x30d0_move_w_ai_071234fc,
-	&m68000_base_device::x30d8_move_w_pi_071234fc,
-	&m68000_base_device::x30e0_move_w_pd_071234fc,
-	&m68000_base_device::x30e8_move_w_di_071234fc,
-	&m68000_base_device::x30f0_move_w_ix_071234fc,
-	&m68000_base_device::x3100_move_w_071234fc,
-	&m68000_base_device::x3108_move_w_071234fc,
-	&m68000_base_device::x3110_move_w_ai_071234fc,
-	&m68000_base_device::x3118_move_w_pi_071234fc,
-	&m68000_base_device::x3120_move_w_pd_071234fc,
-	&m68000_base_device::x3128_move_w_di_071234fc,
-	&m68000_base_device::x3130_move_w_ix_071234fc,
-	&m68000_base_device::x3140_move_w_071234fc,
-	&m68000_base_device::x3148_move_w_071234fc,
-	&m68000_base_device::x3150_move_w_ai_071234fc,
-	&m68000_base_device::x3158_move_w_pi_071234fc,
-	&m68000_base_device::x3160_move_w_pd_071234fc,
-	&m68000_base_device::x3168_move_w_di_071234fc,
-	&m68000_base_device::x3170_move_w_ix_071234fc,
-	&m68000_base_device::x3180_move_w_071234fc,
-	&m68000_base_device::x3188_move_w_071234fc,
-	&m68000_base_device::x3190_move_w_ai_071234fc,
-	&m68000_base_device::x3198_move_w_pi_071234fc,
-	&m68000_base_device::x31a0_move_w_pd_071234fc,
-	&m68000_base_device::x31a8_move_w_di_071234fc,
-	&m68000_base_device::x31b0_move_w_ix_071234fc,
+	&m68000_base_device::x3050_movea_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3050_movea_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3050_movea_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3058_movea_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3058_movea_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3058_movea_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3060_movea_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3060_movea_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3060_movea_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3068_movea_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3068_movea_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3068_movea_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3070_movea_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3070_movea_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3070_movea_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3080_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3080_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3080_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3088_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3088_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3088_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3090_move_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3090_move_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3090_move_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3098_move_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3098_move_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3098_move_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30a0_move_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30a0_move_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30a0_move_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30a8_move_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30a8_move_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30a8_move_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30b0_move_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30b0_move_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30b0_move_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30c0_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30c0_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30c0_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30c8_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30c8_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30c8_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30d0_move_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30d0_move_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30d0_move_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30d8_move_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30d8_move_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30d8_move_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30e0_move_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30e0_move_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30e0_move_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30e8_move_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30e8_move_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30e8_move_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30f0_move_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30f0_move_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30f0_move_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3100_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3100_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3100_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3108_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3108_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3108_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3110_move_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3110_move_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3110_move_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3118_move_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3118_move_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3118_move_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3120_move_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3120_move_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3120_move_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3128_move_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3128_move_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3128_move_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3130_move_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3130_move_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3130_move_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3140_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3140_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3140_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3148_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3148_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3148_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3150_move_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3150_move_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3150_move_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3158_move_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3158_move_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3158_move_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3160_move_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3160_move_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3160_move_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3168_move_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3168_move_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3168_move_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3170_move_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3170_move_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3170_move_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3180_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3180_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3180_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3188_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3188_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3188_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3190_move_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3190_move_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3190_move_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3198_move_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3198_move_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3198_move_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31a0_move_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31a0_move_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31a0_move_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31a8_move_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31a8_move_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31a8_move_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31b0_move_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31b0_move_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31b0_move_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4100_chk_l_234fc,
-	&m68000_base_device::x4110_chk_l_ai_234fc,
-	&m68000_base_device::x4118_chk_l_pi_234fc,
-	&m68000_base_device::x4120_chk_l_pd_234fc,
-	&m68000_base_device::x4128_chk_l_di_234fc,
-	&m68000_base_device::x4130_chk_l_ix_234fc,
+	&m68000_base_device::x4110_chk_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4110_chk_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4118_chk_l_pi_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4118_chk_l_pi_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4120_chk_l_pd_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4120_chk_l_pd_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4128_chk_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4128_chk_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4130_chk_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4130_chk_l_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4180_chk_w_071234fc,
-	&m68000_base_device::x4190_chk_w_ai_071234fc,
-	&m68000_base_device::x4198_chk_w_pi_071234fc,
-	&m68000_base_device::x41a0_chk_w_pd_071234fc,
-	&m68000_base_device::x41a8_chk_w_di_071234fc,
-	&m68000_base_device::x41b0_chk_w_ix_071234fc,
+	&m68000_base_device::x4190_chk_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4190_chk_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4190_chk_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4198_chk_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4198_chk_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4198_chk_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x41a0_chk_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x41a0_chk_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x41a0_chk_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x41a8_chk_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x41a8_chk_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x41a8_chk_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x41b0_chk_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x41b0_chk_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x41b0_chk_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x41d0_lea_l_ai_071234fc,
 	&m68000_base_device::x41e8_lea_l_di_071234fc,
-	&m68000_base_device::x41f0_lea_l_ix_071234fc,
+	&m68000_base_device::x41f0_lea_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x41f0_lea_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x41f0_lea_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x5000_addq_b_071234fc,
 	&m68000_base_device::x5010_addq_b_ai_071234fc,
 	&m68000_base_device::x5018_addq_b_pi_071234fc,
 	&m68000_base_device::x5020_addq_b_pd_071234fc,
 	&m68000_base_device::x5028_addq_b_di_071234fc,
-	&m68000_base_device::x5030_addq_b_ix_071234fc,
+	&m68000_base_device::x5030_addq_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5030_addq_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5030_addq_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x5040_addq_w_071234fc,
 	&m68000_base_device::x5048_addq_w_071234fc,
-	&m68000_base_device::x5050_addq_w_ai_071234fc,
-	&m68000_base_device::x5058_addq_w_pi_071234fc,
-	&m68000_base_device::x5060_addq_w_pd_071234fc,
-	&m68000_base_device::x5068_addq_w_di_071234fc,
-	&m68000_base_device::x5070_addq_w_ix_071234fc,
+	&m68000_base_device::x5050_addq_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5050_addq_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5050_addq_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x5058_addq_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5058_addq_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5058_addq_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x5060_addq_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5060_addq_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5060_addq_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x5068_addq_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5068_addq_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5068_addq_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x5070_addq_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5070_addq_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5070_addq_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x5080_addq_l_071234fc,
 	&m68000_base_device::x5088_addq_l_071234fc,
-	&m68000_base_device::x5090_addq_l_ai_071234fc,
-	&m68000_base_device::x5098_addq_l_pi_071234fc,
-	&m68000_base_device::x50a0_addq_l_pd_071234fc,
-	&m68000_base_device::x50a8_addq_l_di_071234fc,
-	&m68000_base_device::x50b0_addq_l_ix_071234fc,
+	&m68000_base_device::x5090_addq_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5090_addq_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5090_addq_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x5098_addq_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5098_addq_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5098_addq_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x50a0_addq_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x50a0_addq_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x50a0_addq_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x50a8_addq_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x50a8_addq_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x50a8_addq_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x50b0_addq_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x50b0_addq_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x50b0_addq_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x5100_subq_b_071234fc,
 	&m68000_base_device::x5110_subq_b_ai_071234fc,
 	&m68000_base_device::x5118_subq_b_pi_071234fc,
 	&m68000_base_device::x5120_subq_b_pd_071234fc,
 	&m68000_base_device::x5128_subq_b_di_071234fc,
-	&m68000_base_device::x5130_subq_b_ix_071234fc,
+	&m68000_base_device::x5130_subq_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5130_subq_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5130_subq_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x5140_subq_w_071234fc,
 	&m68000_base_device::x5148_subq_w_071234fc,
-	&m68000_base_device::x5150_subq_w_ai_071234fc,
-	&m68000_base_device::x5158_subq_w_pi_071234fc,
-	&m68000_base_device::x5160_subq_w_pd_071234fc,
-	&m68000_base_device::x5168_subq_w_di_071234fc,
-	&m68000_base_device::x5170_subq_w_ix_071234fc,
+	&m68000_base_device::x5150_subq_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5150_subq_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5150_subq_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x5158_subq_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5158_subq_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5158_subq_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x5160_subq_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5160_subq_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5160_subq_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x5168_subq_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5168_subq_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5168_subq_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x5170_subq_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5170_subq_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5170_subq_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x5180_subq_l_071234fc,
 	&m68000_base_device::x5188_subq_l_071234fc,
-	&m68000_base_device::x5190_subq_l_ai_071234fc,
-	&m68000_base_device::x5198_subq_l_pi_071234fc,
-	&m68000_base_device::x51a0_subq_l_pd_071234fc,
-	&m68000_base_device::x51a8_subq_l_di_071234fc,
-	&m68000_base_device::x51b0_subq_l_ix_071234fc,
+	&m68000_base_device::x5190_subq_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5190_subq_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5190_subq_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x5198_subq_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5198_subq_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5198_subq_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x51a0_subq_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x51a0_subq_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x51a0_subq_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x51a8_subq_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x51a8_subq_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x51a8_subq_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x51b0_subq_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x51b0_subq_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x51b0_subq_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x8000_or_b_071234fc,
 	&m68000_base_device::x8010_or_b_ai_071234fc,
 	&m68000_base_device::x8018_or_b_pi_071234fc,
 	&m68000_base_device::x8020_or_b_pd_071234fc,
 	&m68000_base_device::x8028_or_b_di_071234fc,
-	&m68000_base_device::x8030_or_b_ix_071234fc,
+	&m68000_base_device::x8030_or_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8030_or_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8030_or_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x8040_or_w_071234fc,
-	&m68000_base_device::x8050_or_w_ai_071234fc,
-	&m68000_base_device::x8058_or_w_pi_071234fc,
-	&m68000_base_device::x8060_or_w_pd_071234fc,
-	&m68000_base_device::x8068_or_w_di_071234fc,
-	&m68000_base_device::x8070_or_w_ix_071234fc,
+	&m68000_base_device::x8050_or_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8050_or_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8050_or_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x8058_or_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8058_or_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8058_or_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x8060_or_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8060_or_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8060_or_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x8068_or_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8068_or_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8068_or_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x8070_or_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8070_or_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8070_or_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x8080_or_l_071234fc,
-	&m68000_base_device::x8090_or_l_ai_071234fc,
-	&m68000_base_device::x8098_or_l_pi_071234fc,
-	&m68000_base_device::x80a0_or_l_pd_071234fc,
-	&m68000_base_device::x80a8_or_l_di_071234fc,
-	&m68000_base_device::x80b0_or_l_ix_071234fc,
+	&m68000_base_device::x8090_or_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8090_or_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8090_or_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x8098_or_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8098_or_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8098_or_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x80a0_or_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80a0_or_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80a0_or_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x80a8_or_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80a8_or_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80a8_or_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x80b0_or_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80b0_or_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80b0_or_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x80c0_divu_w_071234fc,
-	&m68000_base_device::x80d0_divu_w_ai_071234fc,
-	&m68000_base_device::x80d8_divu_w_pi_071234fc,
-	&m68000_base_device::x80e0_divu_w_pd_071234fc,
-	&m68000_base_device::x80e8_divu_w_di_071234fc,
-	&m68000_base_device::x80f0_divu_w_ix_071234fc,
+	&m68000_base_device::x80d0_divu_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80d0_divu_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80d0_divu_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x80d8_divu_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80d8_divu_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80d8_divu_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x80e0_divu_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80e0_divu_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80e0_divu_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x80e8_divu_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80e8_divu_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80e8_divu_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x80f0_divu_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80f0_divu_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80f0_divu_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x8100_sbcd_b_071234fc,
 	&m68000_base_device::x8108_sbcd_b_071234fc,
 	&m68000_base_device::x8110_or_b_ai_071234fc,
 	&m68000_base_device::x8118_or_b_pi_071234fc,
 	&m68000_base_device::x8120_or_b_pd_071234fc,
 	&m68000_base_device::x8128_or_b_di_071234fc,
-	&m68000_base_device::x8130_or_b_ix_071234fc,
+	&m68000_base_device::x8130_or_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8130_or_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8130_or_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x8140_pack_w_234fc,
 	&m68000_base_device::x8148_pack_w_234fc,
-	&m68000_base_device::x8150_or_w_ai_071234fc,
-	&m68000_base_device::x8158_or_w_pi_071234fc,
-	&m68000_base_device::x8160_or_w_pd_071234fc,
-	&m68000_base_device::x8168_or_w_di_071234fc,
-	&m68000_base_device::x8170_or_w_ix_071234fc,
+	&m68000_base_device::x8150_or_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8150_or_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8150_or_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x8158_or_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8158_or_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8158_or_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x8160_or_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8160_or_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8160_or_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x8168_or_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8168_or_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8168_or_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x8170_or_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8170_or_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8170_or_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x8180_unpk_w_234fc,
 	&m68000_base_device::x8188_unpk_w_234fc,
-	&m68000_base_device::x8190_or_l_ai_071234fc,
-	&m68000_base_device::x8198_or_l_pi_071234fc,
-	&m68000_base_device::x81a0_or_l_pd_071234fc,
-	&m68000_base_device::x81a8_or_l_di_071234fc,
-	&m68000_base_device::x81b0_or_l_ix_071234fc,
+	&m68000_base_device::x8190_or_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8190_or_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8190_or_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x8198_or_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8198_or_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8198_or_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x81a0_or_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81a0_or_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81a0_or_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x81a8_or_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81a8_or_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81a8_or_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x81b0_or_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81b0_or_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81b0_or_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x81c0_divs_w_071234fc,
-	&m68000_base_device::x81d0_divs_w_ai_071234fc,
-	&m68000_base_device::x81d8_divs_w_pi_071234fc,
-	&m68000_base_device::x81e0_divs_w_pd_071234fc,
-	&m68000_base_device::x81e8_divs_w_di_071234fc,
-	&m68000_base_device::x81f0_divs_w_ix_071234fc,
+	&m68000_base_device::x81d0_divs_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81d0_divs_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81d0_divs_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x81d8_divs_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81d8_divs_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81d8_divs_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x81e0_divs_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81e0_divs_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81e0_divs_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x81e8_divs_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81e8_divs_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81e8_divs_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x81f0_divs_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81f0_divs_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81f0_divs_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x9000_sub_b_071234fc,
 	&m68000_base_device::x9010_sub_b_ai_071234fc,
 	&m68000_base_device::x9018_sub_b_pi_071234fc,
 	&m68000_base_device::x9020_sub_b_pd_071234fc,
 	&m68000_base_device::x9028_sub_b_di_071234fc,
-	&m68000_base_device::x9030_sub_b_ix_071234fc,
+	&m68000_base_device::x9030_sub_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9030_sub_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9030_sub_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x9040_sub_w_071234fc,
 	&m68000_base_device::x9048_sub_w_071234fc,
-	&m68000_base_device::x9050_sub_w_ai_071234fc,
-	&m68000_base_device::x9058_sub_w_pi_071234fc,
-	&m68000_base_device::x9060_sub_w_pd_071234fc,
-	&m68000_base_device::x9068_sub_w_di_071234fc,
-	&m68000_base_device::x9070_sub_w_ix_071234fc,
+	&m68000_base_device::x9050_sub_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9050_sub_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9050_sub_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9058_sub_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9058_sub_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9058_sub_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9060_sub_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9060_sub_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9060_sub_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9068_sub_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9068_sub_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9068_sub_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9070_sub_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9070_sub_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9070_sub_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x9080_sub_l_071234fc,
 	&m68000_base_device::x9088_sub_l_071234fc,
-	&m68000_base_device::x9090_sub_l_ai_071234fc,
-	&m68000_base_device::x9098_sub_l_pi_071234fc,
-	&m68000_base_device::x90a0_sub_l_pd_071234fc,
-	&m68000_base_device::x90a8_sub_l_di_071234fc,
-	&m68000_base_device::x90b0_sub_l_ix_071234fc,
+	&m68000_base_device::x9090_sub_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9090_sub_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9090_sub_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9098_sub_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9098_sub_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9098_sub_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x90a0_sub_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90a0_sub_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90a0_sub_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x90a8_sub_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90a8_sub_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90a8_sub_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x90b0_sub_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90b0_sub_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90b0_sub_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x90c0_suba_w_071234fc,
 	&m68000_base_device::x90c8_suba_w_071234fc,
-	&m68000_base_device::x90d0_suba_w_ai_071234fc,
-	&m68000_base_device::x90d8_suba_w_pi_071234fc,
-	&m68000_base_device::x90e0_suba_w_pd_071234fc,
-	&m68000_base_device::x90e8_suba_w_di_071234fc,
-	&m68000_base_device::x90f0_suba_w_ix_071234fc,
+	&m68000_base_device::x90d0_suba_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90d0_suba_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90d0_suba_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x90d8_suba_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90d8_suba_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90d8_suba_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x90e0_suba_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90e0_suba_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90e0_suba_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x90e8_suba_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90e8_suba_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90e8_suba_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x90f0_suba_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90f0_suba_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90f0_suba_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x9100_subx_b_071234fc,
 	&m68000_base_device::x9108_subx_b_071234fc,
 	&m68000_base_device::x9110_sub_b_ai_071234fc,
 	&m68000_base_device::x9118_sub_b_pi_071234fc,
 	&m68000_base_device::x9120_sub_b_pd_071234fc,
 	&m68000_base_device::x9128_sub_b_di_071234fc,
-	&m68000_base_device::x9130_sub_b_ix_071234fc,
+	&m68000_base_device::x9130_sub_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9130_sub_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9130_sub_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x9140_subx_w_071234fc,
-	&m68000_base_device::x9148_subx_w_071234fc,
-	&m68000_base_device::x9150_sub_w_ai_071234fc,
-	&m68000_base_device::x9158_sub_w_pi_071234fc,
-	&m68000_base_device::x9160_sub_w_pd_071234fc,
-	&m68000_base_device::x9168_sub_w_di_071234fc,
-	&m68000_base_device::x9170_sub_w_ix_071234fc,
+	&m68000_base_device::x9148_subx_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9148_subx_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9148_subx_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9150_sub_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9150_sub_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9150_sub_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9158_sub_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9158_sub_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9158_sub_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9160_sub_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9160_sub_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9160_sub_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9168_sub_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9168_sub_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9168_sub_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9170_sub_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9170_sub_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9170_sub_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x9180_subx_l_071234fc,
-	&m68000_base_device::x9188_subx_l_071234fc,
-	&m68000_base_device::x9190_sub_l_ai_071234fc,
-	&m68000_base_device::x9198_sub_l_pi_071234fc,
-	&m68000_base_device::x91a0_sub_l_pd_071234fc,
-	&m68000_base_device::x91a8_sub_l_di_071234fc,
-	&m68000_base_device::x91b0_sub_l_ix_071234fc,
+	&m68000_base_device::x9188_subx_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9188_subx_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9188_subx_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9190_sub_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9190_sub_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9190_sub_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9198_sub_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9198_sub_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9198_sub_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x91a0_sub_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91a0_sub_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91a0_sub_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x91a8_sub_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91a8_sub_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91a8_sub_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x91b0_sub_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91b0_sub_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91b0_sub_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x91c0_suba_l_071234fc,
 	&m68000_base_device::x91c8_suba_l_071234fc,
-	&m68000_base_device::x91d0_suba_l_ai_071234fc,
-	&m68000_base_device::x91d8_suba_l_pi_071234fc,
-	&m68000_base_device::x91e0_suba_l_pd_071234fc,
-	&m68000_base_device::x91e8_suba_l_di_071234fc,
-	&m68000_base_device::x91f0_suba_l_ix_071234fc,
+	&m68000_base_device::x91d0_suba_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91d0_suba_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91d0_suba_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x91d8_suba_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91d8_suba_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91d8_suba_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x91e0_suba_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91e0_suba_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91e0_suba_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x91e8_suba_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91e8_suba_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91e8_suba_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x91f0_suba_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91f0_suba_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91f0_suba_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb000_cmp_b_071234fc,
 	&m68000_base_device::xb010_cmp_b_ai_071234fc,
 	&m68000_base_device::xb018_cmp_b_pi_071234fc,
 	&m68000_base_device::xb020_cmp_b_pd_071234fc,
 	&m68000_base_device::xb028_cmp_b_di_071234fc,
-	&m68000_base_device::xb030_cmp_b_ix_071234fc,
+	&m68000_base_device::xb030_cmp_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb030_cmp_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb030_cmp_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb040_cmp_w_071234fc,
 	&m68000_base_device::xb048_cmp_w_071234fc,
-	&m68000_base_device::xb050_cmp_w_ai_071234fc,
-	&m68000_base_device::xb058_cmp_w_pi_071234fc,
-	&m68000_base_device::xb060_cmp_w_pd_071234fc,
-	&m68000_base_device::xb068_cmp_w_di_071234fc,
-	&m68000_base_device::xb070_cmp_w_ix_071234fc,
+	&m68000_base_device::xb050_cmp_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb050_cmp_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb050_cmp_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb058_cmp_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb058_cmp_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb058_cmp_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb060_cmp_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb060_cmp_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb060_cmp_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb068_cmp_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb068_cmp_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb068_cmp_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb070_cmp_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb070_cmp_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb070_cmp_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb080_cmp_l_071234fc,
 	&m68000_base_device::xb088_cmp_l_071234fc,
-	&m68000_base_device::xb090_cmp_l_ai_071234fc,
-	&m68000_base_device::xb098_cmp_l_pi_071234fc,
-	&m68000_base_device::xb0a0_cmp_l_pd_071234fc,
-	&m68000_base_device::xb0a8_cmp_l_di_071234fc,
-	&m68000_base_device::xb0b0_cmp_l_ix_071234fc,
+	&m68000_base_device::xb090_cmp_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb090_cmp_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb090_cmp_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb098_cmp_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb098_cmp_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb098_cmp_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb0a0_cmp_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0a0_cmp_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0a0_cmp_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb0a8_cmp_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0a8_cmp_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0a8_cmp_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb0b0_cmp_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0b0_cmp_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0b0_cmp_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb0c0_cmpa_w_071234fc,
 	&m68000_base_device::xb0c8_cmpa_w_071234fc,
-	&m68000_base_device::xb0d0_cmpa_w_ai_071234fc,
-	&m68000_base_device::xb0d8_cmpa_w_pi_071234fc,
-	&m68000_base_device::xb0e0_cmpa_w_pd_071234fc,
-	&m68000_base_device::xb0e8_cmpa_w_di_071234fc,
-	&m68000_base_device::xb0f0_cmpa_w_ix_071234fc,
+	&m68000_base_device::xb0d0_cmpa_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0d0_cmpa_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0d0_cmpa_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb0d8_cmpa_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0d8_cmpa_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0d8_cmpa_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb0e0_cmpa_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0e0_cmpa_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0e0_cmpa_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb0e8_cmpa_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0e8_cmpa_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0e8_cmpa_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb0f0_cmpa_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0f0_cmpa_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0f0_cmpa_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb100_eor_b_071234fc,
 	&m68000_base_device::xb108_cmpm_b_071234fc,
 	&m68000_base_device::xb110_eor_b_ai_071234fc,
 	&m68000_base_device::xb118_eor_b_pi_071234fc,
 	&m68000_base_device::xb120_eor_b_pd_071234fc,
 	&m68000_base_device::xb128_eor_b_di_071234fc,
-	&m68000_base_device::xb130_eor_b_ix_071234fc,
+	&m68000_base_device::xb130_eor_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb130_eor_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb130_eor_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb140_eor_w_071234fc,
-	&m68000_base_device::xb148_cmpm_w_071234fc,
-	&m68000_base_device::xb150_eor_w_ai_071234fc,
-	&m68000_base_device::xb158_eor_w_pi_071234fc,
-	&m68000_base_device::xb160_eor_w_pd_071234fc,
-	&m68000_base_device::xb168_eor_w_di_071234fc,
-	&m68000_base_device::xb170_eor_w_ix_071234fc,
+	&m68000_base_device::xb148_cmpm_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb148_cmpm_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb148_cmpm_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb150_eor_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb150_eor_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb150_eor_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb158_eor_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb158_eor_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb158_eor_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb160_eor_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb160_eor_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb160_eor_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb168_eor_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb168_eor_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb168_eor_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb170_eor_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb170_eor_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb170_eor_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb180_eor_l_071234fc,
-	&m68000_base_device::xb188_cmpm_l_071234fc,
-	&m68000_base_device::xb190_eor_l_ai_071234fc,
-	&m68000_base_device::xb198_eor_l_pi_071234fc,
-	&m68000_base_device::xb1a0_eor_l_pd_071234fc,
-	&m68000_base_device::xb1a8_eor_l_di_071234fc,
-	&m68000_base_device::xb1b0_eor_l_ix_071234fc,
+	&m68000_base_device::xb188_cmpm_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb188_cmpm_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb188_cmpm_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb190_eor_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb190_eor_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb190_eor_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb198_eor_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb198_eor_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb198_eor_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb1a0_eor_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1a0_eor_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1a0_eor_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb1a8_eor_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1a8_eor_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1a8_eor_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb1b0_eor_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1b0_eor_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1b0_eor_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb1c0_cmpa_l_071234fc,
 	&m68000_base_device::xb1c8_cmpa_l_071234fc,
-	&m68000_base_device::xb1d0_cmpa_l_ai_071234fc,
-	&m68000_base_device::xb1d8_cmpa_l_pi_071234fc,
-	&m68000_base_device::xb1e0_cmpa_l_pd_071234fc,
-	&m68000_base_device::xb1e8_cmpa_l_di_071234fc,
-	&m68000_base_device::xb1f0_cmpa_l_ix_071234fc,
+	&m68000_base_device::xb1d0_cmpa_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1d0_cmpa_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1d0_cmpa_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb1d8_cmpa_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1d8_cmpa_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1d8_cmpa_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb1e0_cmpa_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1e0_cmpa_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1e0_cmpa_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb1e8_cmpa_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1e8_cmpa_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1e8_cmpa_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb1f0_cmpa_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1f0_cmpa_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1f0_cmpa_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc000_and_b_071234fc,
 	&m68000_base_device::xc010_and_b_ai_071234fc,
 	&m68000_base_device::xc018_and_b_pi_071234fc,
 	&m68000_base_device::xc020_and_b_pd_071234fc,
 	&m68000_base_device::xc028_and_b_di_071234fc,
-	&m68000_base_device::xc030_and_b_ix_071234fc,
+	&m68000_base_device::xc030_and_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc030_and_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc030_and_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc040_and_w_071234fc,
-	&m68000_base_device::xc050_and_w_ai_071234fc,
-	&m68000_base_device::xc058_and_w_pi_071234fc,
-	&m68000_base_device::xc060_and_w_pd_071234fc,
-	&m68000_base_device::xc068_and_w_di_071234fc,
-	&m68000_base_device::xc070_and_w_ix_071234fc,
+	&m68000_base_device::xc050_and_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc050_and_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc050_and_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc058_and_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc058_and_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc058_and_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc060_and_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc060_and_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc060_and_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc068_and_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc068_and_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc068_and_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc070_and_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc070_and_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc070_and_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc080_and_l_071234fc,
-	&m68000_base_device::xc090_and_l_ai_071234fc,
-	&m68000_base_device::xc098_and_l_pi_071234fc,
-	&m68000_base_device::xc0a0_and_l_pd_071234fc,
-	&m68000_base_device::xc0a8_and_l_di_071234fc,
-	&m68000_base_device::xc0b0_and_l_ix_071234fc,
+	&m68000_base_device::xc090_and_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc090_and_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc090_and_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc098_and_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc098_and_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc098_and_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc0a0_and_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0a0_and_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0a0_and_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc0a8_and_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0a8_and_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0a8_and_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc0b0_and_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0b0_and_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0b0_and_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc0c0_mulu_w_071234fc,
-	&m68000_base_device::xc0d0_mulu_w_ai_071234fc,
-	&m68000_base_device::xc0d8_mulu_w_pi_071234fc,
-	&m68000_base_device::xc0e0_mulu_w_pd_071234fc,
-	&m68000_base_device::xc0e8_mulu_w_di_071234fc,
-	&m68000_base_device::xc0f0_mulu_w_ix_071234fc,
+	&m68000_base_device::xc0d0_mulu_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0d0_mulu_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0d0_mulu_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc0d8_mulu_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0d8_mulu_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0d8_mulu_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc0e0_mulu_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0e0_mulu_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0e0_mulu_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc0e8_mulu_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0e8_mulu_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0e8_mulu_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc0f0_mulu_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0f0_mulu_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0f0_mulu_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc100_abcd_b_071234fc,
 	&m68000_base_device::xc108_abcd_b_071234fc,
 	&m68000_base_device::xc110_and_b_ai_071234fc,
 	&m68000_base_device::xc118_and_b_pi_071234fc,
 	&m68000_base_device::xc120_and_b_pd_071234fc,
 	&m68000_base_device::xc128_and_b_di_071234fc,
-	&m68000_base_device::xc130_and_b_ix_071234fc,
+	&m68000_base_device::xc130_and_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc130_and_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc130_and_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc140_exg_l_071234fc,
 	&m68000_base_device::xc148_exg_l_071234fc,
-	&m68000_base_device::xc150_and_w_ai_071234fc,
-	&m68000_base_device::xc158_and_w_pi_071234fc,
-	&m68000_base_device::xc160_and_w_pd_071234fc,
-	&m68000_base_device::xc168_and_w_di_071234fc,
-	&m68000_base_device::xc170_and_w_ix_071234fc,
+	&m68000_base_device::xc150_and_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc150_and_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc150_and_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc158_and_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc158_and_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc158_and_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc160_and_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc160_and_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc160_and_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc168_and_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc168_and_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc168_and_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc170_and_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc170_and_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc170_and_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc188_exg_l_071234fc,
-	&m68000_base_device::xc190_and_l_ai_071234fc,
-	&m68000_base_device::xc198_and_l_pi_071234fc,
-	&m68000_base_device::xc1a0_and_l_pd_071234fc,
-	&m68000_base_device::xc1a8_and_l_di_071234fc,
-	&m68000_base_device::xc1b0_and_l_ix_071234fc,
+	&m68000_base_device::xc190_and_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc190_and_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc190_and_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc198_and_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc198_and_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc198_and_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc1a0_and_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1a0_and_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1a0_and_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc1a8_and_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1a8_and_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1a8_and_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc1b0_and_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1b0_and_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1b0_and_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc1c0_muls_w_071234fc,
-	&m68000_base_device::xc1d0_muls_w_ai_071234fc,
-	&m68000_base_device::xc1d8_muls_w_pi_071234fc,
-	&m68000_base_device::xc1e0_muls_w_pd_071234fc,
-	&m68000_base_device::xc1e8_muls_w_di_071234fc,
-	&m68000_base_device::xc1f0_muls_w_ix_071234fc,
+	&m68000_base_device::xc1d0_muls_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1d0_muls_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1d0_muls_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc1d8_muls_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1d8_muls_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1d8_muls_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc1e0_muls_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1e0_muls_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1e0_muls_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc1e8_muls_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1e8_muls_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1e8_muls_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc1f0_muls_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1f0_muls_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1f0_muls_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd000_add_b_071234fc,
 	&m68000_base_device::xd010_add_b_ai_071234fc,
 	&m68000_base_device::xd018_add_b_pi_071234fc,
 	&m68000_base_device::xd020_add_b_pd_071234fc,
 	&m68000_base_device::xd028_add_b_di_071234fc,
-	&m68000_base_device::xd030_add_b_ix_071234fc,
+	&m68000_base_device::xd030_add_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd030_add_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd030_add_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd040_add_w_071234fc,
 	&m68000_base_device::xd048_add_w_071234fc,
-	&m68000_base_device::xd050_add_w_ai_071234fc,
-	&m68000_base_device::xd058_add_w_pi_071234fc,
-	&m68000_base_device::xd060_add_w_pd_071234fc,
-	&m68000_base_device::xd068_add_w_di_071234fc,
-	&m68000_base_device::xd070_add_w_ix_071234fc,
+	&m68000_base_device::xd050_add_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd050_add_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd050_add_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd058_add_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd058_add_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd058_add_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd060_add_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd060_add_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd060_add_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd068_add_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd068_add_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd068_add_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd070_add_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd070_add_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd070_add_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd080_add_l_071234fc,
 	&m68000_base_device::xd088_add_l_071234fc,
-	&m68000_base_device::xd090_add_l_ai_071234fc,
-	&m68000_base_device::xd098_add_l_pi_071234fc,
-	&m68000_base_device::xd0a0_add_l_pd_071234fc,
-	&m68000_base_device::xd0a8_add_l_di_071234fc,
-	&m68000_base_device::xd0b0_add_l_ix_071234fc,
+	&m68000_base_device::xd090_add_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd090_add_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd090_add_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd098_add_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd098_add_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd098_add_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd0a0_add_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0a0_add_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0a0_add_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd0a8_add_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0a8_add_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0a8_add_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd0b0_add_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0b0_add_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0b0_add_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd0c0_adda_w_071234fc,
 	&m68000_base_device::xd0c8_adda_w_071234fc,
-	&m68000_base_device::xd0d0_adda_w_ai_071234fc,
-	&m68000_base_device::xd0d8_adda_w_pi_071234fc,
-	&m68000_base_device::xd0e0_adda_w_pd_071234fc,
-	&m68000_base_device::xd0e8_adda_w_di_071234fc,
-	&m68000_base_device::xd0f0_adda_w_ix_071234fc,
+	&m68000_base_device::xd0d0_adda_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0d0_adda_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0d0_adda_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd0d8_adda_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0d8_adda_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0d8_adda_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd0e0_adda_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0e0_adda_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0e0_adda_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd0e8_adda_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0e8_adda_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0e8_adda_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd0f0_adda_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0f0_adda_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0f0_adda_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd100_addx_b_071234fc,
 	&m68000_base_device::xd108_addx_b_071234fc,
 	&m68000_base_device::xd110_add_b_ai_071234fc,
 	&m68000_base_device::xd118_add_b_pi_071234fc,
 	&m68000_base_device::xd120_add_b_pd_071234fc,
 	&m68000_base_device::xd128_add_b_di_071234fc,
-	&m68000_base_device::xd130_add_b_ix_071234fc,
+	&m68000_base_device::xd130_add_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd130_add_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd130_add_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd140_addx_w_071234fc,
-	&m68000_base_device::xd148_addx_w_071234fc,
-	&m68000_base_device::xd150_add_w_ai_071234fc,
-	&m68000_base_device::xd158_add_w_pi_071234fc,
-	&m68000_base_device::xd160_add_w_pd_071234fc,
-	&m68000_base_device::xd168_add_w_di_071234fc,
-	&m68000_base_device::xd170_add_w_ix_071234fc,
+	&m68000_base_device::xd148_addx_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd148_addx_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd148_addx_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd150_add_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd150_add_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd150_add_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd158_add_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd158_add_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd158_add_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd160_add_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd160_add_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd160_add_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd168_add_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd168_add_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd168_add_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd170_add_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd170_add_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd170_add_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd180_addx_l_071234fc,
-	&m68000_base_device::xd188_addx_l_071234fc,
-	&m68000_base_device::xd190_add_l_ai_071234fc,
-	&m68000_base_device::xd198_add_l_pi_071234fc,
-	&m68000_base_device::xd1a0_add_l_pd_071234fc,
-	&m68000_base_device::xd1a8_add_l_di_071234fc,
-	&m68000_base_device::xd1b0_add_l_ix_071234fc,
+	&m68000_base_device::xd188_addx_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd188_addx_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd188_addx_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd190_add_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd190_add_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd190_add_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd198_add_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd198_add_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd198_add_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd1a0_add_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1a0_add_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1a0_add_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd1a8_add_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1a8_add_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1a8_add_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd1b0_add_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1b0_add_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1b0_add_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd1c0_adda_l_071234fc,
 	&m68000_base_device::xd1c8_adda_l_071234fc,
-	&m68000_base_device::xd1d0_adda_l_ai_071234fc,
-	&m68000_base_device::xd1d8_adda_l_pi_071234fc,
-	&m68000_base_device::xd1e0_adda_l_pd_071234fc,
-	&m68000_base_device::xd1e8_adda_l_di_071234fc,
-	&m68000_base_device::xd1f0_adda_l_ix_071234fc,
+	&m68000_base_device::xd1d0_adda_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1d0_adda_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1d0_adda_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd1d8_adda_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1d8_adda_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1d8_adda_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd1e0_adda_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1e0_adda_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1e0_adda_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd1e8_adda_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1e8_adda_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1e8_adda_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd1f0_adda_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1f0_adda_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1f0_adda_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xe000_asr_b_071234fc,
 	&m68000_base_device::xe008_lsr_b_071234fc,
 	&m68000_base_device::xe010_roxr_b_071234fc,
@@ -31864,7 +33499,9 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::x0138_btst_b_aw_071234fc,
 	&m68000_base_device::x0139_btst_b_al_071234fc,
 	&m68000_base_device::x013a_btst_b_pcdi_071234fc,
-	&m68000_base_device::x013b_btst_b_pcix_071234fc,
+	&m68000_base_device::x013b_btst_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x013b_btst_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x013b_btst_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x013c_btst_b_i_071234fc,
 	&m68000_base_device::x015f_bchg_b_pi7_071234fc,
 	&m68000_base_device::x0167_bchg_b_pd7_071234fc,
@@ -31883,164 +33520,359 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::x1038_move_b_aw_071234fc,
 	&m68000_base_device::x1039_move_b_al_071234fc,
 	&m68000_base_device::x103a_move_b_pcdi_071234fc,
-	&m68000_base_device::x103b_move_b_pcix_071234fc,
+	&m68000_base_device::x103b_move_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x103b_move_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x103b_move_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x103c_move_b_i_071234fc,
 	&m68000_base_device::x109f_move_b_pi7_071234fc,
 	&m68000_base_device::x10a7_move_b_pd7_071234fc,
 	&m68000_base_device::x10b8_move_b_aw_071234fc,
 	&m68000_base_device::x10b9_move_b_al_071234fc,
 	&m68000_base_device::x10ba_move_b_pcdi_071234fc,
-	&m68000_base_device::x10bb_move_b_pcix_071234fc,
+	&m68000_base_device::x10bb_move_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x10bb_move_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x10bb_move_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x10bc_move_b_i_071234fc,
 	&m68000_base_device::x10df_move_b_pi7_071234fc,
 	&m68000_base_device::x10e7_move_b_pd7_071234fc,
 	&m68000_base_device::x10f8_move_b_aw_071234fc,
 	&m68000_base_device::x10f9_move_b_al_071234fc,
 	&m68000_base_device::x10fa_move_b_pcdi_071234fc,
-	&m68000_base_device::x10fb_move_b_pcix_071234fc,
+	&m68000_base_device::x10fb_move_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x10fb_move_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x10fb_move_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x10fc_move_b_i_071234fc,
 	&m68000_base_device::x111f_move_b_pi7_071234fc,
 	&m68000_base_device::x1127_move_b_pd7_071234fc,
 	&m68000_base_device::x1138_move_b_aw_071234fc,
 	&m68000_base_device::x1139_move_b_al_071234fc,
 	&m68000_base_device::x113a_move_b_pcdi_071234fc,
-	&m68000_base_device::x113b_move_b_pcix_071234fc,
+	&m68000_base_device::x113b_move_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x113b_move_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x113b_move_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x113c_move_b_i_071234fc,
 	&m68000_base_device::x115f_move_b_pi7_071234fc,
 	&m68000_base_device::x1167_move_b_pd7_071234fc,
 	&m68000_base_device::x1178_move_b_aw_071234fc,
 	&m68000_base_device::x1179_move_b_al_071234fc,
 	&m68000_base_device::x117a_move_b_pcdi_071234fc,
-	&m68000_base_device::x117b_move_b_pcix_071234fc,
+	&m68000_base_device::x117b_move_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x117b_move_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x117b_move_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x117c_move_b_i_071234fc,
-	&m68000_base_device::x119f_move_b_pi7_071234fc,
-	&m68000_base_device::x11a7_move_b_pd7_071234fc,
-	&m68000_base_device::x11b8_move_b_aw_071234fc,
-	&m68000_base_device::x11b9_move_b_al_071234fc,
-	&m68000_base_device::x11ba_move_b_pcdi_071234fc,
-	&m68000_base_device::x11bb_move_b_pcix_071234fc,
-	&m68000_base_device::x11bc_move_b_i_071234fc,
-	&m68000_base_device::x2038_move_l_aw_071234fc,
-	&m68000_base_device::x2039_move_l_al_071234fc,
+	&m68000_base_device::x119f_move_b_pi7_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x119f_move_b_pi7_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x119f_move_b_pi7_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x11a7_move_b_pd7_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x11a7_move_b_pd7_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x11a7_move_b_pd7_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x11b8_move_b_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x11b8_move_b_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x11b8_move_b_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x11b9_move_b_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x11b9_move_b_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x11b9_move_b_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x11ba_move_b_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x11ba_move_b_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x11ba_move_b_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x11bb_move_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x11bb_move_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x11bb_move_b_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x11bc_move_b_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x11bc_move_b_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x11bc_move_b_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2038_move_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2038_move_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2038_move_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2039_move_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2039_move_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2039_move_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x203a_move_l_pcdi_071234fc,
-	&m68000_base_device::x203b_move_l_pcix_071234fc,
+	&m68000_base_device::x203b_move_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x203b_move_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x203b_move_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x203c_move_l_i_071234fc,
-	&m68000_base_device::x2078_movea_l_aw_071234fc,
-	&m68000_base_device::x2079_movea_l_al_071234fc,
+	&m68000_base_device::x2078_movea_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2078_movea_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2078_movea_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2079_movea_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2079_movea_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2079_movea_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x207a_movea_l_pcdi_071234fc,
-	&m68000_base_device::x207b_movea_l_pcix_071234fc,
+	&m68000_base_device::x207b_movea_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x207b_movea_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x207b_movea_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x207c_movea_l_i_071234fc,
-	&m68000_base_device::x20b8_move_l_aw_071234fc,
-	&m68000_base_device::x20b9_move_l_al_071234fc,
-	&m68000_base_device::x20ba_move_l_pcdi_071234fc,
-	&m68000_base_device::x20bb_move_l_pcix_071234fc,
-	&m68000_base_device::x20bc_move_l_i_071234fc,
-	&m68000_base_device::x20f8_move_l_aw_071234fc,
-	&m68000_base_device::x20f9_move_l_al_071234fc,
-	&m68000_base_device::x20fa_move_l_pcdi_071234fc,
-	&m68000_base_device::x20fb_move_l_pcix_071234fc,
-	&m68000_base_device::x20fc_move_l_i_071234fc,
-	&m68000_base_device::x2138_move_l_aw_071234fc,
-	&m68000_base_device::x2139_move_l_al_071234fc,
-	&m68000_base_device::x213a_move_l_pcdi_071234fc,
-	&m68000_base_device::x213b_move_l_pcix_071234fc,
-	&m68000_base_device::x213c_move_l_i_071234fc,
-	&m68000_base_device::x2178_move_l_aw_071234fc,
-	&m68000_base_device::x2179_move_l_al_071234fc,
-	&m68000_base_device::x217a_move_l_pcdi_071234fc,
-	&m68000_base_device::x217b_move_l_pcix_071234fc,
-	&m68000_base_device::x217c_move_l_i_071234fc,
-	&m68000_base_device::x21b8_move_l_aw_071234fc,
-	&m68000_base_device::x21b9_move_l_al_071234fc,
-	&m68000_base_device::x21ba_move_l_pcdi_071234fc,
-	&m68000_base_device::x21bb_move_l_pcix_071234fc,
-	&m68000_base_device::x21bc_move_l_i_071234fc,
-	&m68000_base_device::x3038_move_w_aw_071234fc,
-	&m68000_base_device::x3039_move_w_al_071234fc,
+	&m68000_base_device::x20b8_move_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20b8_move_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20b8_move_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20b9_move_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20b9_move_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20b9_move_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20ba_move_l_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20ba_move_l_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20ba_move_l_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20bb_move_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20bb_move_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20bb_move_l_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20bc_move_l_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20bc_move_l_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20bc_move_l_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20f8_move_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20f8_move_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20f8_move_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20f9_move_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20f9_move_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20f9_move_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20fa_move_l_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20fa_move_l_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20fa_move_l_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20fb_move_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20fb_move_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20fb_move_l_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x20fc_move_l_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x20fc_move_l_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x20fc_move_l_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2138_move_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2138_move_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2138_move_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2139_move_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2139_move_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2139_move_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x213a_move_l_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x213a_move_l_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x213a_move_l_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x213b_move_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x213b_move_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x213b_move_l_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x213c_move_l_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x213c_move_l_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x213c_move_l_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2178_move_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2178_move_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2178_move_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x2179_move_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x2179_move_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x2179_move_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x217a_move_l_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x217a_move_l_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x217a_move_l_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x217b_move_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x217b_move_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x217b_move_l_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x217c_move_l_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x217c_move_l_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x217c_move_l_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21b8_move_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21b8_move_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21b8_move_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21b9_move_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21b9_move_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21b9_move_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21ba_move_l_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21ba_move_l_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21ba_move_l_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21bb_move_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21bb_move_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21bb_move_l_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21bc_move_l_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21bc_move_l_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21bc_move_l_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3038_move_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3038_move_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3038_move_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3039_move_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3039_move_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3039_move_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x303a_move_w_pcdi_071234fc,
-	&m68000_base_device::x303b_move_w_pcix_071234fc,
+	&m68000_base_device::x303b_move_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x303b_move_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x303b_move_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x303c_move_w_i_071234fc,
-	&m68000_base_device::x3078_movea_w_aw_071234fc,
-	&m68000_base_device::x3079_movea_w_al_071234fc,
+	&m68000_base_device::x3078_movea_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3078_movea_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3078_movea_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3079_movea_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3079_movea_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3079_movea_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x307a_movea_w_pcdi_071234fc,
-	&m68000_base_device::x307b_movea_w_pcix_071234fc,
+	&m68000_base_device::x307b_movea_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x307b_movea_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x307b_movea_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x307c_movea_w_i_071234fc,
-	&m68000_base_device::x30b8_move_w_aw_071234fc,
-	&m68000_base_device::x30b9_move_w_al_071234fc,
-	&m68000_base_device::x30ba_move_w_pcdi_071234fc,
-	&m68000_base_device::x30bb_move_w_pcix_071234fc,
-	&m68000_base_device::x30bc_move_w_i_071234fc,
-	&m68000_base_device::x30f8_move_w_aw_071234fc,
-	&m68000_base_device::x30f9_move_w_al_071234fc,
-	&m68000_base_device::x30fa_move_w_pcdi_071234fc,
-	&m68000_base_device::x30fb_move_w_pcix_071234fc,
-	&m68000_base_device::x30fc_move_w_i_071234fc,
-	&m68000_base_device::x3138_move_w_aw_071234fc,
-	&m68000_base_device::x3139_move_w_al_071234fc,
-	&m68000_base_device::x313a_move_w_pcdi_071234fc,
-	&m68000_base_device::x313b_move_w_pcix_071234fc,
-	&m68000_base_device::x313c_move_w_i_071234fc,
-	&m68000_base_device::x3178_move_w_aw_071234fc,
-	&m68000_base_device::x3179_move_w_al_071234fc,
-	&m68000_base_device::x317a_move_w_pcdi_071234fc,
-	&m68000_base_device::x317b_move_w_pcix_071234fc,
-	&m68000_base_device::x317c_move_w_i_071234fc,
-	&m68000_base_device::x31b8_move_w_aw_071234fc,
-	&m68000_base_device::x31b9_move_w_al_071234fc,
-	&m68000_base_device::x31ba_move_w_pcdi_071234fc,
-	&m68000_base_device::x31bb_move_w_pcix_071234fc,
-	&m68000_base_device::x31bc_move_w_i_071234fc,
-	&m68000_base_device::x4138_chk_l_aw_234fc,
-	&m68000_base_device::x4139_chk_l_al_234fc,
+	&m68000_base_device::x30b8_move_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30b8_move_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30b8_move_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30b9_move_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30b9_move_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30b9_move_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30ba_move_w_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30ba_move_w_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30ba_move_w_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30bb_move_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30bb_move_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30bb_move_w_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30bc_move_w_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30bc_move_w_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30bc_move_w_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30f8_move_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30f8_move_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30f8_move_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30f9_move_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30f9_move_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30f9_move_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30fa_move_w_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30fa_move_w_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30fa_move_w_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30fb_move_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30fb_move_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30fb_move_w_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x30fc_move_w_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x30fc_move_w_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x30fc_move_w_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3138_move_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3138_move_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3138_move_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3139_move_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3139_move_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3139_move_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x313a_move_w_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x313a_move_w_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x313a_move_w_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x313b_move_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x313b_move_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x313b_move_w_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x313c_move_w_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x313c_move_w_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x313c_move_w_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3178_move_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3178_move_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3178_move_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x3179_move_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x3179_move_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x3179_move_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x317a_move_w_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x317a_move_w_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x317a_move_w_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x317b_move_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x317b_move_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x317b_move_w_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x317c_move_w_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x317c_move_w_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x317c_move_w_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31b8_move_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31b8_move_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31b8_move_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31b9_move_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31b9_move_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31b9_move_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31ba_move_w_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31ba_move_w_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31ba_move_w_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31bb_move_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31bb_move_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31bb_move_w_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31bc_move_w_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31bc_move_w_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31bc_move_w_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4138_chk_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4138_chk_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4139_chk_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4139_chk_l_al_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x413a_chk_l_pcdi_234fc,
-	&m68000_base_device::x413b_chk_l_pcix_234fc,
+	&m68000_base_device::x413b_chk_l_pcix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x413b_chk_l_pcix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x413c_chk_l_i_234fc,
-	&m68000_base_device::x41b8_chk_w_aw_071234fc,
-	&m68000_base_device::x41b9_chk_w_al_071234fc,
+	&m68000_base_device::x41b8_chk_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x41b8_chk_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x41b8_chk_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x41b9_chk_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x41b9_chk_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x41b9_chk_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x41ba_chk_w_pcdi_071234fc,
-	&m68000_base_device::x41bb_chk_w_pcix_071234fc,
+	&m68000_base_device::x41bb_chk_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x41bb_chk_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x41bb_chk_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x41bc_chk_w_i_071234fc,
 	&m68000_base_device::x41f8_lea_l_aw_071234fc,
 	&m68000_base_device::x41f9_lea_l_al_071234fc,
 	&m68000_base_device::x41fa_lea_l_pcdi_071234fc,
-	&m68000_base_device::x41fb_lea_l_pcix_071234fc,
+	&m68000_base_device::x41fb_lea_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x41fb_lea_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x41fb_lea_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x501f_addq_b_pi7_071234fc,
 	&m68000_base_device::x5027_addq_b_pd7_071234fc,
 	&m68000_base_device::x5038_addq_b_aw_071234fc,
 	&m68000_base_device::x5039_addq_b_al_071234fc,
-	&m68000_base_device::x5078_addq_w_aw_071234fc,
-	&m68000_base_device::x5079_addq_w_al_071234fc,
-	&m68000_base_device::x50b8_addq_l_aw_071234fc,
-	&m68000_base_device::x50b9_addq_l_al_071234fc,
+	&m68000_base_device::x5078_addq_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5078_addq_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5078_addq_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x5079_addq_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5079_addq_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5079_addq_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x50b8_addq_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x50b8_addq_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x50b8_addq_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x50b9_addq_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x50b9_addq_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x50b9_addq_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x511f_subq_b_pi7_071234fc,
 	&m68000_base_device::x5127_subq_b_pd7_071234fc,
 	&m68000_base_device::x5138_subq_b_aw_071234fc,
 	&m68000_base_device::x5139_subq_b_al_071234fc,
-	&m68000_base_device::x5178_subq_w_aw_071234fc,
-	&m68000_base_device::x5179_subq_w_al_071234fc,
-	&m68000_base_device::x51b8_subq_l_aw_071234fc,
-	&m68000_base_device::x51b9_subq_l_al_071234fc,
+	&m68000_base_device::x5178_subq_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5178_subq_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5178_subq_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x5179_subq_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5179_subq_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5179_subq_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x51b8_subq_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x51b8_subq_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x51b8_subq_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x51b9_subq_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x51b9_subq_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x51b9_subq_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x801f_or_b_pi7_071234fc,
 	&m68000_base_device::x8027_or_b_pd7_071234fc,
 	&m68000_base_device::x8038_or_b_aw_071234fc,
 	&m68000_base_device::x8039_or_b_al_071234fc,
 	&m68000_base_device::x803a_or_b_pcdi_071234fc,
-	&m68000_base_device::x803b_or_b_pcix_071234fc,
+	&m68000_base_device::x803b_or_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x803b_or_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x803b_or_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x803c_or_b_i_071234fc,
-	&m68000_base_device::x8078_or_w_aw_071234fc,
-	&m68000_base_device::x8079_or_w_al_071234fc,
+	&m68000_base_device::x8078_or_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8078_or_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8078_or_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x8079_or_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8079_or_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8079_or_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x807a_or_w_pcdi_071234fc,
-	&m68000_base_device::x807b_or_w_pcix_071234fc,
+	&m68000_base_device::x807b_or_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x807b_or_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x807b_or_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x807c_or_w_i_071234fc,
-	&m68000_base_device::x80b8_or_l_aw_071234fc,
-	&m68000_base_device::x80b9_or_l_al_071234fc,
+	&m68000_base_device::x80b8_or_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80b8_or_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80b8_or_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x80b9_or_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80b9_or_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80b9_or_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x80ba_or_l_pcdi_071234fc,
-	&m68000_base_device::x80bb_or_l_pcix_071234fc,
+	&m68000_base_device::x80bb_or_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80bb_or_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80bb_or_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x80bc_or_l_i_071234fc,
-	&m68000_base_device::x80f8_divu_w_aw_071234fc,
-	&m68000_base_device::x80f9_divu_w_al_071234fc,
+	&m68000_base_device::x80f8_divu_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80f8_divu_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80f8_divu_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x80f9_divu_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80f9_divu_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80f9_divu_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x80fa_divu_w_pcdi_071234fc,
-	&m68000_base_device::x80fb_divu_w_pcix_071234fc,
+	&m68000_base_device::x80fb_divu_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x80fb_divu_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x80fb_divu_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x80fc_divu_w_i_071234fc,
 	&m68000_base_device::x810f_sbcd_b_071234fc,
 	&m68000_base_device::x811f_or_b_pi7_071234fc,
@@ -32048,314 +33880,617 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::x8138_or_b_aw_071234fc,
 	&m68000_base_device::x8139_or_b_al_071234fc,
 	&m68000_base_device::x814f_pack_w_234fc,
-	&m68000_base_device::x8178_or_w_aw_071234fc,
-	&m68000_base_device::x8179_or_w_al_071234fc,
+	&m68000_base_device::x8178_or_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8178_or_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8178_or_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x8179_or_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x8179_or_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x8179_or_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x818f_unpk_w_234fc,
-	&m68000_base_device::x81b8_or_l_aw_071234fc,
-	&m68000_base_device::x81b9_or_l_al_071234fc,
-	&m68000_base_device::x81f8_divs_w_aw_071234fc,
-	&m68000_base_device::x81f9_divs_w_al_071234fc,
+	&m68000_base_device::x81b8_or_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81b8_or_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81b8_or_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x81b9_or_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81b9_or_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81b9_or_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x81f8_divs_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81f8_divs_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81f8_divs_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x81f9_divs_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81f9_divs_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81f9_divs_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x81fa_divs_w_pcdi_071234fc,
-	&m68000_base_device::x81fb_divs_w_pcix_071234fc,
+	&m68000_base_device::x81fb_divs_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x81fb_divs_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x81fb_divs_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x81fc_divs_w_i_071234fc,
 	&m68000_base_device::x901f_sub_b_pi7_071234fc,
 	&m68000_base_device::x9027_sub_b_pd7_071234fc,
 	&m68000_base_device::x9038_sub_b_aw_071234fc,
 	&m68000_base_device::x9039_sub_b_al_071234fc,
 	&m68000_base_device::x903a_sub_b_pcdi_071234fc,
-	&m68000_base_device::x903b_sub_b_pcix_071234fc,
+	&m68000_base_device::x903b_sub_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x903b_sub_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x903b_sub_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x903c_sub_b_i_071234fc,
-	&m68000_base_device::x9078_sub_w_aw_071234fc,
-	&m68000_base_device::x9079_sub_w_al_071234fc,
+	&m68000_base_device::x9078_sub_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9078_sub_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9078_sub_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9079_sub_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9079_sub_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9079_sub_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x907a_sub_w_pcdi_071234fc,
-	&m68000_base_device::x907b_sub_w_pcix_071234fc,
+	&m68000_base_device::x907b_sub_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x907b_sub_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x907b_sub_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x907c_sub_w_i_071234fc,
-	&m68000_base_device::x90b8_sub_l_aw_071234fc,
-	&m68000_base_device::x90b9_sub_l_al_071234fc,
+	&m68000_base_device::x90b8_sub_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90b8_sub_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90b8_sub_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x90b9_sub_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90b9_sub_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90b9_sub_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x90ba_sub_l_pcdi_071234fc,
-	&m68000_base_device::x90bb_sub_l_pcix_071234fc,
+	&m68000_base_device::x90bb_sub_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90bb_sub_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90bb_sub_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x90bc_sub_l_i_071234fc,
-	&m68000_base_device::x90f8_suba_w_aw_071234fc,
-	&m68000_base_device::x90f9_suba_w_al_071234fc,
+	&m68000_base_device::x90f8_suba_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90f8_suba_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90f8_suba_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x90f9_suba_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90f9_suba_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90f9_suba_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x90fa_suba_w_pcdi_071234fc,
-	&m68000_base_device::x90fb_suba_w_pcix_071234fc,
+	&m68000_base_device::x90fb_suba_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x90fb_suba_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x90fb_suba_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x90fc_suba_w_i_071234fc,
 	&m68000_base_device::x910f_subx_b_071234fc,
 	&m68000_base_device::x911f_sub_b_pi7_071234fc,
 	&m68000_base_device::x9127_sub_b_pd7_071234fc,
 	&m68000_base_device::x9138_sub_b_aw_071234fc,
 	&m68000_base_device::x9139_sub_b_al_071234fc,
-	&m68000_base_device::x9178_sub_w_aw_071234fc,
-	&m68000_base_device::x9179_sub_w_al_071234fc,
-	&m68000_base_device::x91b8_sub_l_aw_071234fc,
-	&m68000_base_device::x91b9_sub_l_al_071234fc,
-	&m68000_base_device::x91f8_suba_l_aw_071234fc,
-	&m68000_base_device::x91f9_suba_l_al_071234fc,
+	&m68000_base_device::x9178_sub_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9178_sub_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9178_sub_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x9179_sub_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x9179_sub_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x9179_sub_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x91b8_sub_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91b8_sub_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91b8_sub_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x91b9_sub_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91b9_sub_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91b9_sub_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x91f8_suba_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91f8_suba_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91f8_suba_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x91f9_suba_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91f9_suba_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91f9_suba_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x91fa_suba_l_pcdi_071234fc,
-	&m68000_base_device::x91fb_suba_l_pcix_071234fc,
+	&m68000_base_device::x91fb_suba_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x91fb_suba_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x91fb_suba_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x91fc_suba_l_i_071234fc,
 	&m68000_base_device::xb01f_cmp_b_pi7_071234fc,
 	&m68000_base_device::xb027_cmp_b_pd7_071234fc,
 	&m68000_base_device::xb038_cmp_b_aw_071234fc,
 	&m68000_base_device::xb039_cmp_b_al_071234fc,
 	&m68000_base_device::xb03a_cmp_b_pcdi_071234fc,
-	&m68000_base_device::xb03b_cmp_b_pcix_071234fc,
+	&m68000_base_device::xb03b_cmp_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb03b_cmp_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb03b_cmp_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb03c_cmp_b_i_071234fc,
-	&m68000_base_device::xb078_cmp_w_aw_071234fc,
-	&m68000_base_device::xb079_cmp_w_al_071234fc,
+	&m68000_base_device::xb078_cmp_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb078_cmp_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb078_cmp_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb079_cmp_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb079_cmp_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb079_cmp_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb07a_cmp_w_pcdi_071234fc,
-	&m68000_base_device::xb07b_cmp_w_pcix_071234fc,
+	&m68000_base_device::xb07b_cmp_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb07b_cmp_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb07b_cmp_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb07c_cmp_w_i_071234fc,
-	&m68000_base_device::xb0b8_cmp_l_aw_071234fc,
-	&m68000_base_device::xb0b9_cmp_l_al_071234fc,
+	&m68000_base_device::xb0b8_cmp_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0b8_cmp_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0b8_cmp_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb0b9_cmp_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0b9_cmp_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0b9_cmp_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb0ba_cmp_l_pcdi_071234fc,
-	&m68000_base_device::xb0bb_cmp_l_pcix_071234fc,
+	&m68000_base_device::xb0bb_cmp_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0bb_cmp_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0bb_cmp_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb0bc_cmp_l_i_071234fc,
-	&m68000_base_device::xb0f8_cmpa_w_aw_071234fc,
-	&m68000_base_device::xb0f9_cmpa_w_al_071234fc,
+	&m68000_base_device::xb0f8_cmpa_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0f8_cmpa_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0f8_cmpa_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb0f9_cmpa_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0f9_cmpa_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0f9_cmpa_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb0fa_cmpa_w_pcdi_071234fc,
-	&m68000_base_device::xb0fb_cmpa_w_pcix_071234fc,
+	&m68000_base_device::xb0fb_cmpa_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb0fb_cmpa_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb0fb_cmpa_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb0fc_cmpa_w_i_071234fc,
 	&m68000_base_device::xb10f_cmpm_b_071234fc,
 	&m68000_base_device::xb11f_eor_b_pi7_071234fc,
 	&m68000_base_device::xb127_eor_b_pd7_071234fc,
 	&m68000_base_device::xb138_eor_b_aw_071234fc,
 	&m68000_base_device::xb139_eor_b_al_071234fc,
-	&m68000_base_device::xb178_eor_w_aw_071234fc,
-	&m68000_base_device::xb179_eor_w_al_071234fc,
-	&m68000_base_device::xb1b8_eor_l_aw_071234fc,
-	&m68000_base_device::xb1b9_eor_l_al_071234fc,
-	&m68000_base_device::xb1f8_cmpa_l_aw_071234fc,
-	&m68000_base_device::xb1f9_cmpa_l_al_071234fc,
+	&m68000_base_device::xb178_eor_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb178_eor_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb178_eor_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb179_eor_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb179_eor_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb179_eor_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb1b8_eor_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1b8_eor_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1b8_eor_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb1b9_eor_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1b9_eor_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1b9_eor_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb1f8_cmpa_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1f8_cmpa_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1f8_cmpa_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xb1f9_cmpa_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1f9_cmpa_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1f9_cmpa_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb1fa_cmpa_l_pcdi_071234fc,
-	&m68000_base_device::xb1fb_cmpa_l_pcix_071234fc,
+	&m68000_base_device::xb1fb_cmpa_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xb1fb_cmpa_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xb1fb_cmpa_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xb1fc_cmpa_l_i_071234fc,
 	&m68000_base_device::xc01f_and_b_pi7_071234fc,
 	&m68000_base_device::xc027_and_b_pd7_071234fc,
 	&m68000_base_device::xc038_and_b_aw_071234fc,
 	&m68000_base_device::xc039_and_b_al_071234fc,
 	&m68000_base_device::xc03a_and_b_pcdi_071234fc,
-	&m68000_base_device::xc03b_and_b_pcix_071234fc,
+	&m68000_base_device::xc03b_and_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc03b_and_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc03b_and_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc03c_and_b_i_071234fc,
-	&m68000_base_device::xc078_and_w_aw_071234fc,
-	&m68000_base_device::xc079_and_w_al_071234fc,
+	&m68000_base_device::xc078_and_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc078_and_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc078_and_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc079_and_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc079_and_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc079_and_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc07a_and_w_pcdi_071234fc,
-	&m68000_base_device::xc07b_and_w_pcix_071234fc,
+	&m68000_base_device::xc07b_and_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc07b_and_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc07b_and_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc07c_and_w_i_071234fc,
-	&m68000_base_device::xc0b8_and_l_aw_071234fc,
-	&m68000_base_device::xc0b9_and_l_al_071234fc,
+	&m68000_base_device::xc0b8_and_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0b8_and_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0b8_and_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc0b9_and_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0b9_and_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0b9_and_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc0ba_and_l_pcdi_071234fc,
-	&m68000_base_device::xc0bb_and_l_pcix_071234fc,
+	&m68000_base_device::xc0bb_and_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0bb_and_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0bb_and_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc0bc_and_l_i_071234fc,
-	&m68000_base_device::xc0f8_mulu_w_aw_071234fc,
-	&m68000_base_device::xc0f9_mulu_w_al_071234fc,
+	&m68000_base_device::xc0f8_mulu_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0f8_mulu_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0f8_mulu_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc0f9_mulu_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0f9_mulu_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0f9_mulu_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc0fa_mulu_w_pcdi_071234fc,
-	&m68000_base_device::xc0fb_mulu_w_pcix_071234fc,
+	&m68000_base_device::xc0fb_mulu_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc0fb_mulu_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc0fb_mulu_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc0fc_mulu_w_i_071234fc,
 	&m68000_base_device::xc10f_abcd_b_071234fc,
 	&m68000_base_device::xc11f_and_b_pi7_071234fc,
 	&m68000_base_device::xc127_and_b_pd7_071234fc,
 	&m68000_base_device::xc138_and_b_aw_071234fc,
 	&m68000_base_device::xc139_and_b_al_071234fc,
-	&m68000_base_device::xc178_and_w_aw_071234fc,
-	&m68000_base_device::xc179_and_w_al_071234fc,
-	&m68000_base_device::xc1b8_and_l_aw_071234fc,
-	&m68000_base_device::xc1b9_and_l_al_071234fc,
-	&m68000_base_device::xc1f8_muls_w_aw_071234fc,
-	&m68000_base_device::xc1f9_muls_w_al_071234fc,
+	&m68000_base_device::xc178_and_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc178_and_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc178_and_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc179_and_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc179_and_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc179_and_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc1b8_and_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1b8_and_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1b8_and_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc1b9_and_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1b9_and_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1b9_and_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc1f8_muls_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1f8_muls_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1f8_muls_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xc1f9_muls_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1f9_muls_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1f9_muls_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc1fa_muls_w_pcdi_071234fc,
-	&m68000_base_device::xc1fb_muls_w_pcix_071234fc,
+	&m68000_base_device::xc1fb_muls_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xc1fb_muls_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xc1fb_muls_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xc1fc_muls_w_i_071234fc,
 	&m68000_base_device::xd01f_add_b_pi7_071234fc,
 	&m68000_base_device::xd027_add_b_pd7_071234fc,
 	&m68000_base_device::xd038_add_b_aw_071234fc,
 	&m68000_base_device::xd039_add_b_al_071234fc,
 	&m68000_base_device::xd03a_add_b_pcdi_071234fc,
-	&m68000_base_device::xd03b_add_b_pcix_071234fc,
+	&m68000_base_device::xd03b_add_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd03b_add_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd03b_add_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd03c_add_b_i_071234fc,
-	&m68000_base_device::xd078_add_w_aw_071234fc,
-	&m68000_base_device::xd079_add_w_al_071234fc,
+	&m68000_base_device::xd078_add_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd078_add_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd078_add_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd079_add_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd079_add_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd079_add_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd07a_add_w_pcdi_071234fc,
-	&m68000_base_device::xd07b_add_w_pcix_071234fc,
+	&m68000_base_device::xd07b_add_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd07b_add_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd07b_add_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd07c_add_w_i_071234fc,
-	&m68000_base_device::xd0b8_add_l_aw_071234fc,
-	&m68000_base_device::xd0b9_add_l_al_071234fc,
+	&m68000_base_device::xd0b8_add_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0b8_add_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0b8_add_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd0b9_add_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0b9_add_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0b9_add_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd0ba_add_l_pcdi_071234fc,
-	&m68000_base_device::xd0bb_add_l_pcix_071234fc,
+	&m68000_base_device::xd0bb_add_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0bb_add_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0bb_add_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd0bc_add_l_i_071234fc,
-	&m68000_base_device::xd0f8_adda_w_aw_071234fc,
-	&m68000_base_device::xd0f9_adda_w_al_071234fc,
+	&m68000_base_device::xd0f8_adda_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0f8_adda_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0f8_adda_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd0f9_adda_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0f9_adda_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0f9_adda_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd0fa_adda_w_pcdi_071234fc,
-	&m68000_base_device::xd0fb_adda_w_pcix_071234fc,
+	&m68000_base_device::xd0fb_adda_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd0fb_adda_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd0fb_adda_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd0fc_adda_w_i_071234fc,
 	&m68000_base_device::xd10f_addx_b_071234fc,
 	&m68000_base_device::xd11f_add_b_pi7_071234fc,
 	&m68000_base_device::xd127_add_b_pd7_071234fc,
 	&m68000_base_device::xd138_add_b_aw_071234fc,
 	&m68000_base_device::xd139_add_b_al_071234fc,
-	&m68000_base_device::xd178_add_w_aw_071234fc,
-	&m68000_base_device::xd179_add_w_al_071234fc,
-	&m68000_base_device::xd1b8_add_l_aw_071234fc,
-	&m68000_base_device::xd1b9_add_l_al_071234fc,
-	&m68000_base_device::xd1f8_adda_l_aw_071234fc,
-	&m68000_base_device::xd1f9_adda_l_al_071234fc,
+	&m68000_base_device::xd178_add_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd178_add_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd178_add_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd179_add_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd179_add_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd179_add_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd1b8_add_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1b8_add_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1b8_add_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd1b9_add_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1b9_add_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1b9_add_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd1f8_adda_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1f8_adda_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1f8_adda_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xd1f9_adda_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1f9_adda_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1f9_adda_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd1fa_adda_l_pcdi_071234fc,
-	&m68000_base_device::xd1fb_adda_l_pcix_071234fc,
+	&m68000_base_device::xd1fb_adda_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xd1fb_adda_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xd1fb_adda_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xd1fc_adda_l_i_071234fc,
 	&m68000_base_device::x0000_ori_b_071234fc,
 	&m68000_base_device::x0010_ori_b_ai_071234fc,
 	&m68000_base_device::x0018_ori_b_pi_071234fc,
 	&m68000_base_device::x0020_ori_b_pd_071234fc,
 	&m68000_base_device::x0028_ori_b_di_071234fc,
-	&m68000_base_device::x0030_ori_b_ix_071234fc,
+	&m68000_base_device::x0030_ori_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0030_ori_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0030_ori_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0040_ori_w_071234fc,
-	&m68000_base_device::x0050_ori_w_ai_071234fc,
-	&m68000_base_device::x0058_ori_w_pi_071234fc,
-	&m68000_base_device::x0060_ori_w_pd_071234fc,
-	&m68000_base_device::x0068_ori_w_di_071234fc,
-	&m68000_base_device::x0070_ori_w_ix_071234fc,
+	&m68000_base_device::x0050_ori_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0050_ori_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0050_ori_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0058_ori_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0058_ori_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0058_ori_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0060_ori_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0060_ori_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0060_ori_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0068_ori_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0068_ori_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0068_ori_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0070_ori_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0070_ori_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0070_ori_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0080_ori_l_071234fc,
-	&m68000_base_device::x0090_ori_l_ai_071234fc,
-	&m68000_base_device::x0098_ori_l_pi_071234fc,
-	&m68000_base_device::x00a0_ori_l_pd_071234fc,
-	&m68000_base_device::x00a8_ori_l_di_071234fc,
-	&m68000_base_device::x00b0_ori_l_ix_071234fc,
+	&m68000_base_device::x0090_ori_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0090_ori_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0090_ori_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0098_ori_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0098_ori_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0098_ori_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x00a0_ori_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x00a0_ori_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x00a0_ori_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x00a8_ori_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x00a8_ori_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x00a8_ori_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x00b0_ori_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x00b0_ori_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x00b0_ori_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x00d0_chk2cmp2_b_ai_234fc,
 	&m68000_base_device::x00e8_chk2cmp2_b_di_234fc,
-	&m68000_base_device::x00f0_chk2cmp2_b_ix_234fc,
+	&m68000_base_device::x00f0_chk2cmp2_b_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x00f0_chk2cmp2_b_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0200_andi_b_071234fc,
 	&m68000_base_device::x0210_andi_b_ai_071234fc,
 	&m68000_base_device::x0218_andi_b_pi_071234fc,
 	&m68000_base_device::x0220_andi_b_pd_071234fc,
 	&m68000_base_device::x0228_andi_b_di_071234fc,
-	&m68000_base_device::x0230_andi_b_ix_071234fc,
+	&m68000_base_device::x0230_andi_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0230_andi_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0230_andi_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0240_andi_w_071234fc,
-	&m68000_base_device::x0250_andi_w_ai_071234fc,
-	&m68000_base_device::x0258_andi_w_pi_071234fc,
-	&m68000_base_device::x0260_andi_w_pd_071234fc,
-	&m68000_base_device::x0268_andi_w_di_071234fc,
-	&m68000_base_device::x0270_andi_w_ix_071234fc,
+	&m68000_base_device::x0250_andi_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0250_andi_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0250_andi_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0258_andi_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0258_andi_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0258_andi_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0260_andi_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0260_andi_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0260_andi_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0268_andi_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0268_andi_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0268_andi_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0270_andi_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0270_andi_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0270_andi_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0280_andi_l_071234fc,
-	&m68000_base_device::x0290_andi_l_ai_071234fc,
-	&m68000_base_device::x0298_andi_l_pi_071234fc,
-	&m68000_base_device::x02a0_andi_l_pd_071234fc,
-	&m68000_base_device::x02a8_andi_l_di_071234fc,
-	&m68000_base_device::x02b0_andi_l_ix_071234fc,
-	&m68000_base_device::x02d0_chk2cmp2_w_ai_234fc,
-	&m68000_base_device::x02e8_chk2cmp2_w_di_234fc,
-	&m68000_base_device::x02f0_chk2cmp2_w_ix_234fc,
+	&m68000_base_device::x0290_andi_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0290_andi_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0290_andi_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0298_andi_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0298_andi_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0298_andi_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x02a0_andi_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x02a0_andi_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x02a0_andi_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x02a8_andi_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x02a8_andi_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x02a8_andi_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x02b0_andi_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x02b0_andi_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x02b0_andi_l_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x02d0_chk2cmp2_w_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x02d0_chk2cmp2_w_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x02e8_chk2cmp2_w_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x02e8_chk2cmp2_w_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x02f0_chk2cmp2_w_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x02f0_chk2cmp2_w_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0400_subi_b_071234fc,
 	&m68000_base_device::x0410_subi_b_ai_071234fc,
 	&m68000_base_device::x0418_subi_b_pi_071234fc,
 	&m68000_base_device::x0420_subi_b_pd_071234fc,
 	&m68000_base_device::x0428_subi_b_di_071234fc,
-	&m68000_base_device::x0430_subi_b_ix_071234fc,
+	&m68000_base_device::x0430_subi_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0430_subi_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0430_subi_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0440_subi_w_071234fc,
-	&m68000_base_device::x0450_subi_w_ai_071234fc,
-	&m68000_base_device::x0458_subi_w_pi_071234fc,
-	&m68000_base_device::x0460_subi_w_pd_071234fc,
-	&m68000_base_device::x0468_subi_w_di_071234fc,
-	&m68000_base_device::x0470_subi_w_ix_071234fc,
+	&m68000_base_device::x0450_subi_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0450_subi_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0450_subi_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0458_subi_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0458_subi_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0458_subi_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0460_subi_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0460_subi_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0460_subi_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0468_subi_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0468_subi_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0468_subi_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0470_subi_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0470_subi_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0470_subi_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0480_subi_l_071234fc,
-	&m68000_base_device::x0490_subi_l_ai_071234fc,
-	&m68000_base_device::x0498_subi_l_pi_071234fc,
-	&m68000_base_device::x04a0_subi_l_pd_071234fc,
-	&m68000_base_device::x04a8_subi_l_di_071234fc,
-	&m68000_base_device::x04b0_subi_l_ix_071234fc,
-	&m68000_base_device::x04d0_chk2cmp2_l_ai_234fc,
-	&m68000_base_device::x04e8_chk2cmp2_l_di_234fc,
-	&m68000_base_device::x04f0_chk2cmp2_l_ix_234fc,
+	&m68000_base_device::x0490_subi_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0490_subi_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0490_subi_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0498_subi_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0498_subi_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0498_subi_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x04a0_subi_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x04a0_subi_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x04a0_subi_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x04a8_subi_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x04a8_subi_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x04a8_subi_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x04b0_subi_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x04b0_subi_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x04b0_subi_l_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x04d0_chk2cmp2_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x04d0_chk2cmp2_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x04e8_chk2cmp2_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x04e8_chk2cmp2_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x04f0_chk2cmp2_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x04f0_chk2cmp2_l_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0600_addi_b_071234fc,
 	&m68000_base_device::x0610_addi_b_ai_071234fc,
 	&m68000_base_device::x0618_addi_b_pi_071234fc,
 	&m68000_base_device::x0620_addi_b_pd_071234fc,
 	&m68000_base_device::x0628_addi_b_di_071234fc,
-	&m68000_base_device::x0630_addi_b_ix_071234fc,
+	&m68000_base_device::x0630_addi_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0630_addi_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0630_addi_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0640_addi_w_071234fc,
-	&m68000_base_device::x0650_addi_w_ai_071234fc,
-	&m68000_base_device::x0658_addi_w_pi_071234fc,
-	&m68000_base_device::x0660_addi_w_pd_071234fc,
-	&m68000_base_device::x0668_addi_w_di_071234fc,
-	&m68000_base_device::x0670_addi_w_ix_071234fc,
+	&m68000_base_device::x0650_addi_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0650_addi_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0650_addi_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0658_addi_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0658_addi_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0658_addi_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0660_addi_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0660_addi_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0660_addi_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0668_addi_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0668_addi_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0668_addi_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0670_addi_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0670_addi_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0670_addi_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0680_addi_l_071234fc,
-	&m68000_base_device::x0690_addi_l_ai_071234fc,
-	&m68000_base_device::x0698_addi_l_pi_071234fc,
-	&m68000_base_device::x06a0_addi_l_pd_071234fc,
-	&m68000_base_device::x06a8_addi_l_di_071234fc,
-	&m68000_base_device::x06b0_addi_l_ix_071234fc,
+	&m68000_base_device::x0690_addi_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0690_addi_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0690_addi_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0698_addi_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0698_addi_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0698_addi_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x06a0_addi_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x06a0_addi_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x06a0_addi_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x06a8_addi_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x06a8_addi_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x06a8_addi_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x06b0_addi_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x06b0_addi_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x06b0_addi_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x06d0_callm_l_ai_2f,
 	&m68000_base_device::x06e8_callm_l_di_2f,
-	&m68000_base_device::x06f0_callm_l_ix_2f,
+	&m68000_base_device::x06f0_callm_l_ix_2f<CPU_TYPES_68020>,
 	&m68000_base_device::x0800_btst_l_071234fc,
 	&m68000_base_device::x0810_btst_b_ai_071234fc,
 	&m68000_base_device::x0818_btst_b_pi_071234fc,
 	&m68000_base_device::x0820_btst_b_pd_071234fc,
 	&m68000_base_device::x0828_btst_b_di_071234fc,
-	&m68000_base_device::x0830_btst_b_ix_071234fc,
+	&m68000_base_device::x0830_btst_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0830_btst_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0830_btst_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0840_bchg_l_071234fc,
 	&m68000_base_device::x0850_bchg_b_ai_071234fc,
 	&m68000_base_device::x0858_bchg_b_pi_071234fc,
 	&m68000_base_device::x0860_bchg_b_pd_071234fc,
 	&m68000_base_device::x0868_bchg_b_di_071234fc,
-	&m68000_base_device::x0870_bchg_b_ix_071234fc,
+	&m68000_base_device::x0870_bchg_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0870_bchg_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0870_bchg_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0880_bclr_l_071234fc,
 	&m68000_base_device::x0890_bclr_b_ai_071234fc,
 	&m68000_base_device::x0898_bclr_b_pi_071234fc,
 	&m68000_base_device::x08a0_bclr_b_pd_071234fc,
 	&m68000_base_device::x08a8_bclr_b_di_071234fc,
-	&m68000_base_device::x08b0_bclr_b_ix_071234fc,
+	&m68000_base_device::x08b0_bclr_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x08b0_bclr_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x08b0_bclr_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x08c0_bset_l_071234fc,
 	&m68000_base_device::x08d0_bset_b_ai_071234fc,
 	&m68000_base_device::x08d8_bset_b_pi_071234fc,
 	&m68000_base_device::x08e0_bset_b_pd_071234fc,
 	&m68000_base_device::x08e8_bset_b_di_071234fc,
-	&m68000_base_device::x08f0_bset_b_ix_071234fc,
+	&m68000_base_device::x08f0_bset_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x08f0_bset_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x08f0_bset_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0a00_eori_b_071234fc,
 	&m68000_base_device::x0a10_eori_b_ai_071234fc,
 	&m68000_base_device::x0a18_eori_b_pi_071234fc,
 	&m68000_base_device::x0a20_eori_b_pd_071234fc,
 	&m68000_base_device::x0a28_eori_b_di_071234fc,
-	&m68000_base_device::x0a30_eori_b_ix_071234fc,
+	&m68000_base_device::x0a30_eori_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0a30_eori_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0a30_eori_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0a40_eori_w_071234fc,
-	&m68000_base_device::x0a50_eori_w_ai_071234fc,
-	&m68000_base_device::x0a58_eori_w_pi_071234fc,
-	&m68000_base_device::x0a60_eori_w_pd_071234fc,
-	&m68000_base_device::x0a68_eori_w_di_071234fc,
-	&m68000_base_device::x0a70_eori_w_ix_071234fc,
+	&m68000_base_device::x0a50_eori_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0a50_eori_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0a50_eori_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0a58_eori_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0a58_eori_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0a58_eori_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0a60_eori_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0a60_eori_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0a60_eori_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0a68_eori_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0a68_eori_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0a68_eori_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0a70_eori_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0a70_eori_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0a70_eori_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0a80_eori_l_071234fc,
-	&m68000_base_device::x0a90_eori_l_ai_071234fc,
-	&m68000_base_device::x0a98_eori_l_pi_071234fc,
-	&m68000_base_device::x0aa0_eori_l_pd_071234fc,
-	&m68000_base_device::x0aa8_eori_l_di_071234fc,
-	&m68000_base_device::x0ab0_eori_l_ix_071234fc,
+	&m68000_base_device::x0a90_eori_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0a90_eori_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0a90_eori_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0a98_eori_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0a98_eori_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0a98_eori_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0aa0_eori_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0aa0_eori_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0aa0_eori_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0aa8_eori_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0aa8_eori_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0aa8_eori_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ab0_eori_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0ab0_eori_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ab0_eori_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0ad0_cas_b_ai_234fc,
 	&m68000_base_device::x0ad8_cas_b_pi_234fc,
 	&m68000_base_device::x0ae0_cas_b_pd_234fc,
 	&m68000_base_device::x0ae8_cas_b_di_234fc,
-	&m68000_base_device::x0af0_cas_b_ix_234fc,
+	&m68000_base_device::x0af0_cas_b_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0af0_cas_b_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0c00_cmpi_b_071234fc,
 	&m68000_base_device::x0c10_cmpi_b_ai_071234fc,
 	&m68000_base_device::x0c18_cmpi_b_pi_071234fc,
 	&m68000_base_device::x0c20_cmpi_b_pd_071234fc,
 	&m68000_base_device::x0c28_cmpi_b_di_071234fc,
-	&m68000_base_device::x0c30_cmpi_b_ix_071234fc,
+	&m68000_base_device::x0c30_cmpi_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0c30_cmpi_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0c30_cmpi_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0c40_cmpi_w_071234fc,
-	&m68000_base_device::x0c50_cmpi_w_ai_071234fc,
-	&m68000_base_device::x0c58_cmpi_w_pi_071234fc,
-	&m68000_base_device::x0c60_cmpi_w_pd_071234fc,
-	&m68000_base_device::x0c68_cmpi_w_di_071234fc,
-	&m68000_base_device::x0c70_cmpi_w_ix_071234fc,
+	&m68000_base_device::x0c50_cmpi_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0c50_cmpi_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0c50_cmpi_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0c58_cmpi_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0c58_cmpi_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0c58_cmpi_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0c60_cmpi_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0c60_cmpi_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0c60_cmpi_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0c68_cmpi_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0c68_cmpi_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0c68_cmpi_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0c70_cmpi_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0c70_cmpi_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0c70_cmpi_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0c80_cmpi_l_071234fc,
-	&m68000_base_device::x0c90_cmpi_l_ai_071234fc,
-	&m68000_base_device::x0c98_cmpi_l_pi_071234fc,
-	&m68000_base_device::x0ca0_cmpi_l_pd_071234fc,
-	&m68000_base_device::x0ca8_cmpi_l_di_071234fc,
-	&m68000_base_device::x0cb0_cmpi_l_ix_071234fc,
-	&m68000_base_device::x0cd0_cas_w_ai_234fc,
-	&m68000_base_device::x0cd8_cas_w_pi_234fc,
-	&m68000_base_device::x0ce0_cas_w_pd_234fc,
-	&m68000_base_device::x0ce8_cas_w_di_234fc,
-	&m68000_base_device::x0cf0_cas_w_ix_234fc,
+	&m68000_base_device::x0c90_cmpi_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0c90_cmpi_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0c90_cmpi_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0c98_cmpi_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0c98_cmpi_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0c98_cmpi_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ca0_cmpi_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0ca0_cmpi_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ca0_cmpi_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ca8_cmpi_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0ca8_cmpi_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ca8_cmpi_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0cb0_cmpi_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0cb0_cmpi_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0cb0_cmpi_l_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0cd0_cas_w_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0cd0_cas_w_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0cd8_cas_w_pi_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0cd8_cas_w_pi_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ce0_cas_w_pd_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ce0_cas_w_pd_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ce8_cas_w_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ce8_cas_w_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0cf0_cas_w_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0cf0_cas_w_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0e10_moves_b_ai_134fc,
 	&m68000_base_device::x0e10_moves_b_ai_2,
 	&m68000_base_device::x0e18_moves_b_pi_134fc,
@@ -32364,115 +34499,238 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::x0e20_moves_b_pd_2,
 	&m68000_base_device::x0e28_moves_b_di_134fc,
 	&m68000_base_device::x0e28_moves_b_di_2,
-	&m68000_base_device::x0e30_moves_b_ix_134fc,
-	&m68000_base_device::x0e30_moves_b_ix_2,
-	&m68000_base_device::x0e50_moves_w_ai_134fc,
-	&m68000_base_device::x0e50_moves_w_ai_2,
-	&m68000_base_device::x0e58_moves_w_pi_134fc,
-	&m68000_base_device::x0e58_moves_w_pi_2,
-	&m68000_base_device::x0e60_moves_w_pd_134fc,
-	&m68000_base_device::x0e60_moves_w_pd_2,
-	&m68000_base_device::x0e68_moves_w_di_134fc,
-	&m68000_base_device::x0e68_moves_w_di_2,
-	&m68000_base_device::x0e70_moves_w_ix_134fc,
-	&m68000_base_device::x0e70_moves_w_ix_2,
-	&m68000_base_device::x0e90_moves_l_ai_134fc,
-	&m68000_base_device::x0e90_moves_l_ai_2,
-	&m68000_base_device::x0e98_moves_l_pi_134fc,
-	&m68000_base_device::x0e98_moves_l_pi_2,
-	&m68000_base_device::x0ea0_moves_l_pd_134fc,
-	&m68000_base_device::x0ea0_moves_l_pd_2,
-	&m68000_base_device::x0ea8_moves_l_di_134fc,
-	&m68000_base_device::x0ea8_moves_l_di_2,
-	&m68000_base_device::x0eb0_moves_l_ix_134fc,
-	&m68000_base_device::x0eb0_moves_l_ix_2,
-	&m68000_base_device::x0ed0_cas_l_ai_234fc,
-	&m68000_base_device::x0ed8_cas_l_pi_234fc,
-	&m68000_base_device::x0ee0_cas_l_pd_234fc,
-	&m68000_base_device::x0ee8_cas_l_di_234fc,
-	&m68000_base_device::x0ef0_cas_l_ix_234fc,
+	&m68000_base_device::x0e30_moves_b_ix_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0e30_moves_b_ix_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0e30_moves_b_ix_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0e30_moves_b_ix_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0e50_moves_w_ai_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0e50_moves_w_ai_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0e50_moves_w_ai_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0e50_moves_w_ai_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0e58_moves_w_pi_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0e58_moves_w_pi_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0e58_moves_w_pi_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0e58_moves_w_pi_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0e60_moves_w_pd_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0e60_moves_w_pd_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0e60_moves_w_pd_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0e60_moves_w_pd_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0e68_moves_w_di_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0e68_moves_w_di_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0e68_moves_w_di_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0e68_moves_w_di_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0e70_moves_w_ix_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0e70_moves_w_ix_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0e70_moves_w_ix_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0e70_moves_w_ix_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0e90_moves_l_ai_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0e90_moves_l_ai_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0e90_moves_l_ai_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0e90_moves_l_ai_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0e98_moves_l_pi_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0e98_moves_l_pi_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0e98_moves_l_pi_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0e98_moves_l_pi_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0ea0_moves_l_pd_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0ea0_moves_l_pd_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ea0_moves_l_pd_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ea0_moves_l_pd_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0ea8_moves_l_di_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0ea8_moves_l_di_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ea8_moves_l_di_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ea8_moves_l_di_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0eb0_moves_l_ix_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0eb0_moves_l_ix_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0eb0_moves_l_ix_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0eb0_moves_l_ix_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0ed0_cas_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ed0_cas_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ed8_cas_l_pi_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ed8_cas_l_pi_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ee0_cas_l_pd_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ee0_cas_l_pd_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ee8_cas_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ee8_cas_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ef0_cas_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ef0_cas_l_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x11c0_move_b_071234fc,
 	&m68000_base_device::x11d0_move_b_ai_071234fc,
 	&m68000_base_device::x11d8_move_b_pi_071234fc,
 	&m68000_base_device::x11e0_move_b_pd_071234fc,
 	&m68000_base_device::x11e8_move_b_di_071234fc,
-	&m68000_base_device::x11f0_move_b_ix_071234fc,
+	&m68000_base_device::x11f0_move_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x11f0_move_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x11f0_move_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x13c0_move_b_071234fc,
 	&m68000_base_device::x13d0_move_b_ai_071234fc,
 	&m68000_base_device::x13d8_move_b_pi_071234fc,
 	&m68000_base_device::x13e0_move_b_pd_071234fc,
 	&m68000_base_device::x13e8_move_b_di_071234fc,
-	&m68000_base_device::x13f0_move_b_ix_071234fc,
+	&m68000_base_device::x13f0_move_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x13f0_move_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x13f0_move_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x1ec0_move_b_071234fc,
 	&m68000_base_device::x1ed0_move_b_ai_071234fc,
 	&m68000_base_device::x1ed8_move_b_pi_071234fc,
 	&m68000_base_device::x1ee0_move_b_pd_071234fc,
 	&m68000_base_device::x1ee8_move_b_di_071234fc,
-	&m68000_base_device::x1ef0_move_b_ix_071234fc,
+	&m68000_base_device::x1ef0_move_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x1ef0_move_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x1ef0_move_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x1f00_move_b_071234fc,
 	&m68000_base_device::x1f10_move_b_ai_071234fc,
 	&m68000_base_device::x1f18_move_b_pi_071234fc,
 	&m68000_base_device::x1f20_move_b_pd_071234fc,
 	&m68000_base_device::x1f28_move_b_di_071234fc,
-	&m68000_base_device::x1f30_move_b_ix_071234fc,
-	&m68000_base_device::x21c0_move_l_071234fc,
-	&m68000_base_device::x21c8_move_l_071234fc,
-	&m68000_base_device::x21d0_move_l_ai_071234fc,
-	&m68000_base_device::x21d8_move_l_pi_071234fc,
-	&m68000_base_device::x21e0_move_l_pd_071234fc,
-	&m68000_base_device::x21e8_move_l_di_071234fc,
-	&m68000_base_device::x21f0_move_l_ix_071234fc,
-	&m68000_base_device::x23c0_move_l_071234fc,
-	&m68000_base_device::x23c8_move_l_071234fc,
-	&m68000_base_device::x23d0_move_l_ai_071234fc,
-	&m68000_base_device::x23d8_move_l_pi_071234fc,
-	&m68000_base_device::x23e0_move_l_pd_071234fc,
-	&m68000_base_device::x23e8_move_l_di_071234fc,
-	&m68000_base_device::x23f0_move_l_ix_071234fc,
-	&m68000_base_device::x31c0_move_w_071234fc,
-	&m68000_base_device::x31c8_move_w_071234fc,
-	&m68000_base_device::x31d0_move_w_ai_071234fc,
-	&m68000_base_device::x31d8_move_w_pi_071234fc,
-	&m68000_base_device::x31e0_move_w_pd_071234fc,
-	&m68000_base_device::x31e8_move_w_di_071234fc,
-	&m68000_base_device::x31f0_move_w_ix_071234fc,
-	&m68000_base_device::x33c0_move_w_071234fc,
-	&m68000_base_device::x33c8_move_w_071234fc,
-	&m68000_base_device::x33d0_move_w_ai_071234fc,
-	&m68000_base_device::x33d8_move_w_pi_071234fc,
-	&m68000_base_device::x33e0_move_w_pd_071234fc,
-	&m68000_base_device::x33e8_move_w_di_071234fc,
-	&m68000_base_device::x33f0_move_w_ix_071234fc,
+	&m68000_base_device::x1f30_move_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x1f30_move_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x1f30_move_b_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21c0_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21c0_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21c0_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21c8_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21c8_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21c8_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21d0_move_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21d0_move_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21d0_move_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21d8_move_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21d8_move_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21d8_move_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21e0_move_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21e0_move_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21e0_move_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21e8_move_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21e8_move_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21e8_move_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21f0_move_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21f0_move_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21f0_move_l_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x23c0_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x23c0_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x23c0_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x23c8_move_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x23c8_move_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x23c8_move_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x23d0_move_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x23d0_move_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x23d0_move_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x23d8_move_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x23d8_move_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x23d8_move_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x23e0_move_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x23e0_move_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x23e0_move_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x23e8_move_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x23e8_move_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x23e8_move_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x23f0_move_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x23f0_move_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x23f0_move_l_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31c0_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31c0_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31c0_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31c8_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31c8_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31c8_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31d0_move_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31d0_move_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31d0_move_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31d8_move_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31d8_move_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31d8_move_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31e0_move_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31e0_move_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31e0_move_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31e8_move_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31e8_move_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31e8_move_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31f0_move_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31f0_move_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31f0_move_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x33c0_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x33c0_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x33c0_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x33c8_move_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x33c8_move_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x33c8_move_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x33d0_move_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x33d0_move_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x33d0_move_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x33d8_move_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x33d8_move_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x33d8_move_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x33e0_move_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x33e0_move_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x33e0_move_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x33e8_move_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x33e8_move_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x33e8_move_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x33f0_move_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x33f0_move_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x33f0_move_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4000_negx_b_071234fc,
 	&m68000_base_device::x4010_negx_b_ai_071234fc,
 	&m68000_base_device::x4018_negx_b_pi_071234fc,
 	&m68000_base_device::x4020_negx_b_pd_071234fc,
 	&m68000_base_device::x4028_negx_b_di_071234fc,
-	&m68000_base_device::x4030_negx_b_ix_071234fc,
+	&m68000_base_device::x4030_negx_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4030_negx_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4030_negx_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4040_negx_w_071234fc,
-	&m68000_base_device::x4050_negx_w_ai_071234fc,
-	&m68000_base_device::x4058_negx_w_pi_071234fc,
-	&m68000_base_device::x4060_negx_w_pd_071234fc,
-	&m68000_base_device::x4068_negx_w_di_071234fc,
-	&m68000_base_device::x4070_negx_w_ix_071234fc,
+	&m68000_base_device::x4050_negx_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4050_negx_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4050_negx_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4058_negx_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4058_negx_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4058_negx_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4060_negx_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4060_negx_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4060_negx_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4068_negx_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4068_negx_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4068_negx_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4070_negx_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4070_negx_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4070_negx_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4080_negx_l_071234fc,
-	&m68000_base_device::x4090_negx_l_ai_071234fc,
-	&m68000_base_device::x4098_negx_l_pi_071234fc,
-	&m68000_base_device::x40a0_negx_l_pd_071234fc,
-	&m68000_base_device::x40a8_negx_l_di_071234fc,
-	&m68000_base_device::x40b0_negx_l_ix_071234fc,
+	&m68000_base_device::x4090_negx_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4090_negx_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4090_negx_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4098_negx_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4098_negx_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4098_negx_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x40a0_negx_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x40a0_negx_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x40a0_negx_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x40a8_negx_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x40a8_negx_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x40a8_negx_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x40b0_negx_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x40b0_negx_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x40b0_negx_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x40c0_move_w_07,
 	&m68000_base_device::x40c0_move_w_1234fc,
-	&m68000_base_device::x40d0_move_w_ai_07,
-	&m68000_base_device::x40d0_move_w_ai_1234fc,
-	&m68000_base_device::x40d8_move_w_pi_07,
-	&m68000_base_device::x40d8_move_w_pi_1234fc,
-	&m68000_base_device::x40e0_move_w_pd_07,
-	&m68000_base_device::x40e0_move_w_pd_1234fc,
-	&m68000_base_device::x40e8_move_w_di_07,
-	&m68000_base_device::x40e8_move_w_di_1234fc,
-	&m68000_base_device::x40f0_move_w_ix_07,
-	&m68000_base_device::x40f0_move_w_ix_1234fc,
+	&m68000_base_device::x40d0_move_w_ai_07<CPU_TYPES_68000>,
+	&m68000_base_device::x40d0_move_w_ai_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x40d0_move_w_ai_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x40d0_move_w_ai_1234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x40d8_move_w_pi_07<CPU_TYPES_68000>,
+	&m68000_base_device::x40d8_move_w_pi_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x40d8_move_w_pi_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x40d8_move_w_pi_1234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x40e0_move_w_pd_07<CPU_TYPES_68000>,
+	&m68000_base_device::x40e0_move_w_pd_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x40e0_move_w_pd_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x40e0_move_w_pd_1234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x40e8_move_w_di_07<CPU_TYPES_68000>,
+	&m68000_base_device::x40e8_move_w_di_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x40e8_move_w_di_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x40e8_move_w_di_1234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x40f0_move_w_ix_07<CPU_TYPES_68000>,
+	&m68000_base_device::x40f0_move_w_ix_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x40f0_move_w_ix_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x40f0_move_w_ix_1234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4200_clr_b_071234fc,
 	&m68000_base_device::x4210_clr_b_ai_0,
 	&m68000_base_device::x4210_clr_b_ai_71234fc,
@@ -32482,276 +34740,499 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::x4220_clr_b_pd_71234fc,
 	&m68000_base_device::x4228_clr_b_di_0,
 	&m68000_base_device::x4228_clr_b_di_71234fc,
-	&m68000_base_device::x4230_clr_b_ix_0,
-	&m68000_base_device::x4230_clr_b_ix_71234fc,
+	&m68000_base_device::x4230_clr_b_ix_0<CPU_TYPES_68000>,
+	&m68000_base_device::x4230_clr_b_ix_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4230_clr_b_ix_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4230_clr_b_ix_71234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4240_clr_w_071234fc,
-	&m68000_base_device::x4250_clr_w_ai_0,
-	&m68000_base_device::x4250_clr_w_ai_71234fc,
-	&m68000_base_device::x4258_clr_w_pi_0,
-	&m68000_base_device::x4258_clr_w_pi_71234fc,
-	&m68000_base_device::x4260_clr_w_pd_0,
-	&m68000_base_device::x4260_clr_w_pd_71234fc,
-	&m68000_base_device::x4268_clr_w_di_0,
-	&m68000_base_device::x4268_clr_w_di_71234fc,
-	&m68000_base_device::x4270_clr_w_ix_0,
-	&m68000_base_device::x4270_clr_w_ix_71234fc,
+	&m68000_base_device::x4250_clr_w_ai_0<CPU_TYPES_68000>,
+	&m68000_base_device::x4250_clr_w_ai_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4250_clr_w_ai_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4250_clr_w_ai_71234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4258_clr_w_pi_0<CPU_TYPES_68000>,
+	&m68000_base_device::x4258_clr_w_pi_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4258_clr_w_pi_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4258_clr_w_pi_71234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4260_clr_w_pd_0<CPU_TYPES_68000>,
+	&m68000_base_device::x4260_clr_w_pd_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4260_clr_w_pd_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4260_clr_w_pd_71234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4268_clr_w_di_0<CPU_TYPES_68000>,
+	&m68000_base_device::x4268_clr_w_di_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4268_clr_w_di_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4268_clr_w_di_71234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4270_clr_w_ix_0<CPU_TYPES_68000>,
+	&m68000_base_device::x4270_clr_w_ix_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4270_clr_w_ix_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4270_clr_w_ix_71234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4280_clr_l_071234fc,
-	&m68000_base_device::x4290_clr_l_ai_0,
-	&m68000_base_device::x4290_clr_l_ai_71234fc,
-	&m68000_base_device::x4298_clr_l_pi_0,
-	&m68000_base_device::x4298_clr_l_pi_71234fc,
-	&m68000_base_device::x42a0_clr_l_pd_0,
-	&m68000_base_device::x42a0_clr_l_pd_71234fc,
-	&m68000_base_device::x42a8_clr_l_di_0,
-	&m68000_base_device::x42a8_clr_l_di_71234fc,
-	&m68000_base_device::x42b0_clr_l_ix_0,
-	&m68000_base_device::x42b0_clr_l_ix_71234fc,
+	&m68000_base_device::x4290_clr_l_ai_0<CPU_TYPES_68000>,
+	&m68000_base_device::x4290_clr_l_ai_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4290_clr_l_ai_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4290_clr_l_ai_71234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4298_clr_l_pi_0<CPU_TYPES_68000>,
+	&m68000_base_device::x4298_clr_l_pi_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4298_clr_l_pi_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4298_clr_l_pi_71234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x42a0_clr_l_pd_0<CPU_TYPES_68000>,
+	&m68000_base_device::x42a0_clr_l_pd_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x42a0_clr_l_pd_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x42a0_clr_l_pd_71234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x42a8_clr_l_di_0<CPU_TYPES_68000>,
+	&m68000_base_device::x42a8_clr_l_di_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x42a8_clr_l_di_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x42a8_clr_l_di_71234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x42b0_clr_l_ix_0<CPU_TYPES_68000>,
+	&m68000_base_device::x42b0_clr_l_ix_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x42b0_clr_l_ix_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x42b0_clr_l_ix_71234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x42c0_move_w_1234fc,
-	&m68000_base_device::x42d0_move_w_ai_1234fc,
-	&m68000_base_device::x42d8_move_w_pi_1234fc,
-	&m68000_base_device::x42e0_move_w_pd_1234fc,
-	&m68000_base_device::x42e8_move_w_di_1234fc,
-	&m68000_base_device::x42f0_move_w_ix_1234fc,
+	&m68000_base_device::x42d0_move_w_ai_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x42d0_move_w_ai_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x42d0_move_w_ai_1234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x42d8_move_w_pi_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x42d8_move_w_pi_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x42d8_move_w_pi_1234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x42e0_move_w_pd_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x42e0_move_w_pd_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x42e0_move_w_pd_1234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x42e8_move_w_di_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x42e8_move_w_di_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x42e8_move_w_di_1234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x42f0_move_w_ix_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x42f0_move_w_ix_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x42f0_move_w_ix_1234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4400_neg_b_071234fc,
 	&m68000_base_device::x4410_neg_b_ai_071234fc,
 	&m68000_base_device::x4418_neg_b_pi_071234fc,
 	&m68000_base_device::x4420_neg_b_pd_071234fc,
 	&m68000_base_device::x4428_neg_b_di_071234fc,
-	&m68000_base_device::x4430_neg_b_ix_071234fc,
+	&m68000_base_device::x4430_neg_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4430_neg_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4430_neg_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4440_neg_w_071234fc,
-	&m68000_base_device::x4450_neg_w_ai_071234fc,
-	&m68000_base_device::x4458_neg_w_pi_071234fc,
-	&m68000_base_device::x4460_neg_w_pd_071234fc,
-	&m68000_base_device::x4468_neg_w_di_071234fc,
-	&m68000_base_device::x4470_neg_w_ix_071234fc,
+	&m68000_base_device::x4450_neg_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4450_neg_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4450_neg_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4458_neg_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4458_neg_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4458_neg_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4460_neg_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4460_neg_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4460_neg_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4468_neg_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4468_neg_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4468_neg_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4470_neg_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4470_neg_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4470_neg_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4480_neg_l_071234fc,
-	&m68000_base_device::x4490_neg_l_ai_071234fc,
-	&m68000_base_device::x4498_neg_l_pi_071234fc,
-	&m68000_base_device::x44a0_neg_l_pd_071234fc,
-	&m68000_base_device::x44a8_neg_l_di_071234fc,
-	&m68000_base_device::x44b0_neg_l_ix_071234fc,
+	&m68000_base_device::x4490_neg_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4490_neg_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4490_neg_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4498_neg_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4498_neg_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4498_neg_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x44a0_neg_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44a0_neg_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44a0_neg_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x44a8_neg_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44a8_neg_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44a8_neg_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x44b0_neg_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44b0_neg_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44b0_neg_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x44c0_move_w_071234fc,
-	&m68000_base_device::x44d0_move_w_ai_071234fc,
-	&m68000_base_device::x44d8_move_w_pi_071234fc,
-	&m68000_base_device::x44e0_move_w_pd_071234fc,
-	&m68000_base_device::x44e8_move_w_di_071234fc,
-	&m68000_base_device::x44f0_move_w_ix_071234fc,
+	&m68000_base_device::x44d0_move_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44d0_move_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44d0_move_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x44d8_move_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44d8_move_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44d8_move_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x44e0_move_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44e0_move_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44e0_move_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x44e8_move_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44e8_move_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44e8_move_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x44f0_move_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44f0_move_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44f0_move_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4600_not_b_071234fc,
 	&m68000_base_device::x4610_not_b_ai_071234fc,
 	&m68000_base_device::x4618_not_b_pi_071234fc,
 	&m68000_base_device::x4620_not_b_pd_071234fc,
 	&m68000_base_device::x4628_not_b_di_071234fc,
-	&m68000_base_device::x4630_not_b_ix_071234fc,
+	&m68000_base_device::x4630_not_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4630_not_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4630_not_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4640_not_w_071234fc,
-	&m68000_base_device::x4650_not_w_ai_071234fc,
-	&m68000_base_device::x4658_not_w_pi_071234fc,
-	&m68000_base_device::x4660_not_w_pd_071234fc,
-	&m68000_base_device::x4668_not_w_di_071234fc,
-	&m68000_base_device::x4670_not_w_ix_071234fc,
+	&m68000_base_device::x4650_not_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4650_not_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4650_not_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4658_not_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4658_not_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4658_not_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4660_not_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4660_not_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4660_not_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4668_not_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4668_not_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4668_not_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4670_not_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4670_not_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4670_not_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4680_not_l_071234fc,
-	&m68000_base_device::x4690_not_l_ai_071234fc,
-	&m68000_base_device::x4698_not_l_pi_071234fc,
-	&m68000_base_device::x46a0_not_l_pd_071234fc,
-	&m68000_base_device::x46a8_not_l_di_071234fc,
-	&m68000_base_device::x46b0_not_l_ix_071234fc,
+	&m68000_base_device::x4690_not_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4690_not_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4690_not_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4698_not_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4698_not_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4698_not_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x46a0_not_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46a0_not_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46a0_not_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x46a8_not_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46a8_not_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46a8_not_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x46b0_not_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46b0_not_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46b0_not_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x46c0_move_w_071234fc,
-	&m68000_base_device::x46d0_move_w_ai_071234fc,
-	&m68000_base_device::x46d8_move_w_pi_071234fc,
-	&m68000_base_device::x46e0_move_w_pd_071234fc,
-	&m68000_base_device::x46e8_move_w_di_071234fc,
-	&m68000_base_device::x46f0_move_w_ix_071234fc,
+	&m68000_base_device::x46d0_move_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46d0_move_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46d0_move_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x46d8_move_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46d8_move_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46d8_move_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x46e0_move_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46e0_move_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46e0_move_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x46e8_move_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46e8_move_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46e8_move_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x46f0_move_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46f0_move_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46f0_move_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4800_nbcd_b_071234fc,
-	&m68000_base_device::x4808_link_l_234fc,
+	&m68000_base_device::x4808_link_l_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4808_link_l_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4810_nbcd_b_ai_071234fc,
 	&m68000_base_device::x4818_nbcd_b_pi_071234fc,
 	&m68000_base_device::x4820_nbcd_b_pd_071234fc,
 	&m68000_base_device::x4828_nbcd_b_di_071234fc,
-	&m68000_base_device::x4830_nbcd_b_ix_071234fc,
+	&m68000_base_device::x4830_nbcd_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4830_nbcd_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4830_nbcd_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4840_swap_l_071234fc,
 	&m68000_base_device::x4848_bkpt_1,
 	&m68000_base_device::x4848_bkpt_234fc,
-	&m68000_base_device::x4850_pea_l_ai_071234fc,
-	&m68000_base_device::x4868_pea_l_di_071234fc,
-	&m68000_base_device::x4870_pea_l_ix_071234fc,
+	&m68000_base_device::x4850_pea_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4850_pea_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4850_pea_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4868_pea_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4868_pea_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4868_pea_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4870_pea_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4870_pea_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4870_pea_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4880_ext_w_071234fc,
-	&m68000_base_device::x4890_movem_w_ai_071234fc,
-	&m68000_base_device::x48a0_movem_w_071234fc,
-	&m68000_base_device::x48a8_movem_w_di_071234fc,
-	&m68000_base_device::x48b0_movem_w_ix_071234fc,
+	&m68000_base_device::x4890_movem_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4890_movem_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4890_movem_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x48a0_movem_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x48a0_movem_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x48a0_movem_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x48a8_movem_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x48a8_movem_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x48a8_movem_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x48b0_movem_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x48b0_movem_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x48b0_movem_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x48c0_ext_l_071234fc,
-	&m68000_base_device::x48d0_movem_l_ai_071234fc,
-	&m68000_base_device::x48e0_movem_l_071234fc,
-	&m68000_base_device::x48e8_movem_l_di_071234fc,
-	&m68000_base_device::x48f0_movem_l_ix_071234fc,
+	&m68000_base_device::x48d0_movem_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x48d0_movem_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x48d0_movem_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x48e0_movem_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x48e0_movem_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x48e0_movem_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x48e8_movem_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x48e8_movem_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x48e8_movem_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x48f0_movem_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x48f0_movem_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x48f0_movem_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x49c0_extb_l_234fc,
 	&m68000_base_device::x4a00_tst_b_071234fc,
 	&m68000_base_device::x4a10_tst_b_ai_071234fc,
 	&m68000_base_device::x4a18_tst_b_pi_071234fc,
 	&m68000_base_device::x4a20_tst_b_pd_071234fc,
 	&m68000_base_device::x4a28_tst_b_di_071234fc,
-	&m68000_base_device::x4a30_tst_b_ix_071234fc,
+	&m68000_base_device::x4a30_tst_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4a30_tst_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4a30_tst_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4a40_tst_w_071234fc,
 	&m68000_base_device::x4a48_tst_w_234fc,
-	&m68000_base_device::x4a50_tst_w_ai_071234fc,
-	&m68000_base_device::x4a58_tst_w_pi_071234fc,
-	&m68000_base_device::x4a60_tst_w_pd_071234fc,
-	&m68000_base_device::x4a68_tst_w_di_071234fc,
-	&m68000_base_device::x4a70_tst_w_ix_071234fc,
+	&m68000_base_device::x4a50_tst_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4a50_tst_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4a50_tst_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4a58_tst_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4a58_tst_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4a58_tst_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4a60_tst_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4a60_tst_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4a60_tst_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4a68_tst_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4a68_tst_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4a68_tst_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4a70_tst_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4a70_tst_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4a70_tst_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4a80_tst_l_071234fc,
 	&m68000_base_device::x4a88_tst_l_234fc,
-	&m68000_base_device::x4a90_tst_l_ai_071234fc,
-	&m68000_base_device::x4a98_tst_l_pi_071234fc,
-	&m68000_base_device::x4aa0_tst_l_pd_071234fc,
-	&m68000_base_device::x4aa8_tst_l_di_071234fc,
-	&m68000_base_device::x4ab0_tst_l_ix_071234fc,
+	&m68000_base_device::x4a90_tst_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4a90_tst_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4a90_tst_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4a98_tst_l_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4a98_tst_l_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4a98_tst_l_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4aa0_tst_l_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4aa0_tst_l_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4aa0_tst_l_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4aa8_tst_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4aa8_tst_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4aa8_tst_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4ab0_tst_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ab0_tst_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ab0_tst_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4ac0_tas_b_071234fc,
-	&m68000_base_device::x4ad0_tas_b_ai_071234fc,
-	&m68000_base_device::x4ad8_tas_b_pi_071234fc,
-	&m68000_base_device::x4ae0_tas_b_pd_071234fc,
-	&m68000_base_device::x4ae8_tas_b_di_071234fc,
-	&m68000_base_device::x4af0_tas_b_ix_071234fc,
+	&m68000_base_device::x4ad0_tas_b_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ad0_tas_b_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ad0_tas_b_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4ad8_tas_b_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ad8_tas_b_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ad8_tas_b_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4ae0_tas_b_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ae0_tas_b_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ae0_tas_b_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4ae8_tas_b_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ae8_tas_b_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ae8_tas_b_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4af0_tas_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4af0_tas_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4af0_tas_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4c00_mull_l_234fc,
-	&m68000_base_device::x4c10_mull_l_ai_234fc,
-	&m68000_base_device::x4c18_mull_l_pi_234fc,
-	&m68000_base_device::x4c20_mull_l_pd_234fc,
-	&m68000_base_device::x4c28_mull_l_di_234fc,
-	&m68000_base_device::x4c30_mull_l_ix_234fc,
+	&m68000_base_device::x4c10_mull_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c10_mull_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4c18_mull_l_pi_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c18_mull_l_pi_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4c20_mull_l_pd_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c20_mull_l_pd_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4c28_mull_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c28_mull_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4c30_mull_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c30_mull_l_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4c40_divl_l_234fc,
-	&m68000_base_device::x4c50_divl_l_ai_234fc,
-	&m68000_base_device::x4c58_divl_l_pi_234fc,
-	&m68000_base_device::x4c60_divl_l_pd_234fc,
-	&m68000_base_device::x4c68_divl_l_di_234fc,
-	&m68000_base_device::x4c70_divl_l_ix_234fc,
-	&m68000_base_device::x4c90_movem_w_ai_071234fc,
-	&m68000_base_device::x4c98_movem_w_071234fc,
-	&m68000_base_device::x4ca8_movem_w_di_071234fc,
-	&m68000_base_device::x4cb0_movem_w_ix_071234fc,
-	&m68000_base_device::x4cd0_movem_l_ai_071234fc,
-	&m68000_base_device::x4cd8_movem_l_071234fc,
-	&m68000_base_device::x4ce8_movem_l_di_071234fc,
-	&m68000_base_device::x4cf0_movem_l_ix_071234fc,
-	&m68000_base_device::x4e50_link_w_071234fc,
-	&m68000_base_device::x4e58_unlk_l_071234fc,
+	&m68000_base_device::x4c50_divl_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c50_divl_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4c58_divl_l_pi_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c58_divl_l_pi_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4c60_divl_l_pd_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c60_divl_l_pd_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4c68_divl_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c68_divl_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4c70_divl_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c70_divl_l_ix_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4c90_movem_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4c90_movem_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c90_movem_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4c98_movem_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4c98_movem_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c98_movem_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4ca8_movem_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ca8_movem_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ca8_movem_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4cb0_movem_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4cb0_movem_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4cb0_movem_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4cd0_movem_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4cd0_movem_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4cd0_movem_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4cd8_movem_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4cd8_movem_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4cd8_movem_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4ce8_movem_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ce8_movem_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ce8_movem_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4cf0_movem_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4cf0_movem_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4cf0_movem_l_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4e50_link_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4e50_link_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4e50_link_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4e58_unlk_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4e58_unlk_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4e58_unlk_l_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4e60_move_l_071234fc,
 	&m68000_base_device::x4e68_move_l_071234fc,
-	&m68000_base_device::x4e90_jsr_l_ai_071234fc,
-	&m68000_base_device::x4ea8_jsr_l_di_071234fc,
-	&m68000_base_device::x4eb0_jsr_l_ix_071234fc,
+	&m68000_base_device::x4e90_jsr_l_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4e90_jsr_l_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4e90_jsr_l_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4ea8_jsr_l_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ea8_jsr_l_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ea8_jsr_l_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4eb0_jsr_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4eb0_jsr_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4eb0_jsr_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4ed0_jmp_l_ai_071234fc,
 	&m68000_base_device::x4ee8_jmp_l_di_071234fc,
-	&m68000_base_device::x4ef0_jmp_l_ix_071234fc,
+	&m68000_base_device::x4ef0_jmp_l_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ef0_jmp_l_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ef0_jmp_l_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x50c0_st_b_071234fc,
 	&m68000_base_device::x50c8_dbt_w_071234fc,
 	&m68000_base_device::x50d0_st_b_ai_071234fc,
 	&m68000_base_device::x50d8_st_b_pi_071234fc,
 	&m68000_base_device::x50e0_st_b_pd_071234fc,
 	&m68000_base_device::x50e8_st_b_di_071234fc,
-	&m68000_base_device::x50f0_st_b_ix_071234fc,
+	&m68000_base_device::x50f0_st_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x50f0_st_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x50f0_st_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x51c0_sf_b_071234fc,
 	&m68000_base_device::x51c8_dbf_w_071234fc,
 	&m68000_base_device::x51d0_sf_b_ai_071234fc,
 	&m68000_base_device::x51d8_sf_b_pi_071234fc,
 	&m68000_base_device::x51e0_sf_b_pd_071234fc,
 	&m68000_base_device::x51e8_sf_b_di_071234fc,
-	&m68000_base_device::x51f0_sf_b_ix_071234fc,
+	&m68000_base_device::x51f0_sf_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x51f0_sf_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x51f0_sf_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x52c0_shi_b_071234fc,
 	&m68000_base_device::x52c8_dbhi_w_071234fc,
 	&m68000_base_device::x52d0_shi_b_ai_071234fc,
 	&m68000_base_device::x52d8_shi_b_pi_071234fc,
 	&m68000_base_device::x52e0_shi_b_pd_071234fc,
 	&m68000_base_device::x52e8_shi_b_di_071234fc,
-	&m68000_base_device::x52f0_shi_b_ix_071234fc,
+	&m68000_base_device::x52f0_shi_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x52f0_shi_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x52f0_shi_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x53c0_sls_b_071234fc,
 	&m68000_base_device::x53c8_dbls_w_071234fc,
 	&m68000_base_device::x53d0_sls_b_ai_071234fc,
 	&m68000_base_device::x53d8_sls_b_pi_071234fc,
 	&m68000_base_device::x53e0_sls_b_pd_071234fc,
 	&m68000_base_device::x53e8_sls_b_di_071234fc,
-	&m68000_base_device::x53f0_sls_b_ix_071234fc,
+	&m68000_base_device::x53f0_sls_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x53f0_sls_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x53f0_sls_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x54c0_scc_b_071234fc,
 	&m68000_base_device::x54c8_dbcc_w_071234fc,
 	&m68000_base_device::x54d0_scc_b_ai_071234fc,
 	&m68000_base_device::x54d8_scc_b_pi_071234fc,
 	&m68000_base_device::x54e0_scc_b_pd_071234fc,
 	&m68000_base_device::x54e8_scc_b_di_071234fc,
-	&m68000_base_device::x54f0_scc_b_ix_071234fc,
+	&m68000_base_device::x54f0_scc_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x54f0_scc_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x54f0_scc_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x55c0_scs_b_071234fc,
 	&m68000_base_device::x55c8_dbcs_w_071234fc,
 	&m68000_base_device::x55d0_scs_b_ai_071234fc,
 	&m68000_base_device::x55d8_scs_b_pi_071234fc,
 	&m68000_base_device::x55e0_scs_b_pd_071234fc,
 	&m68000_base_device::x55e8_scs_b_di_071234fc,
-	&m68000_base_device::x55f0_scs_b_ix_071234fc,
+	&m68000_base_device::x55f0_scs_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x55f0_scs_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x55f0_scs_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x56c0_sne_b_071234fc,
 	&m68000_base_device::x56c8_dbne_w_071234fc,
 	&m68000_base_device::x56d0_sne_b_ai_071234fc,
 	&m68000_base_device::x56d8_sne_b_pi_071234fc,
 	&m68000_base_device::x56e0_sne_b_pd_071234fc,
 	&m68000_base_device::x56e8_sne_b_di_071234fc,
-	&m68000_base_device::x56f0_sne_b_ix_071234fc,
+	&m68000_base_device::x56f0_sne_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x56f0_sne_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x56f0_sne_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x57c0_seq_b_071234fc,
 	&m68000_base_device::x57c8_dbeq_w_071234fc,
 	&m68000_base_device::x57d0_seq_b_ai_071234fc,
 	&m68000_base_device::x57d8_seq_b_pi_071234fc,
 	&m68000_base_device::x57e0_seq_b_pd_071234fc,
 	&m68000_base_device::x57e8_seq_b_di_071234fc,
-	&m68000_base_device::x57f0_seq_b_ix_071234fc,
+	&m68000_base_device::x57f0_seq_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x57f0_seq_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x57f0_seq_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x58c0_svc_b_071234fc,
 	&m68000_base_device::x58c8_dbvc_w_071234fc,
 	&m68000_base_device::x58d0_svc_b_ai_071234fc,
 	&m68000_base_device::x58d8_svc_b_pi_071234fc,
 	&m68000_base_device::x58e0_svc_b_pd_071234fc,
 	&m68000_base_device::x58e8_svc_b_di_071234fc,
-	&m68000_base_device::x58f0_svc_b_ix_071234fc,
+	&m68000_base_device::x58f0_svc_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x58f0_svc_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x58f0_svc_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x59c0_svs_b_071234fc,
 	&m68000_base_device::x59c8_dbvs_w_071234fc,
 	&m68000_base_device::x59d0_svs_b_ai_071234fc,
 	&m68000_base_device::x59d8_svs_b_pi_071234fc,
 	&m68000_base_device::x59e0_svs_b_pd_071234fc,
 	&m68000_base_device::x59e8_svs_b_di_071234fc,
-	&m68000_base_device::x59f0_svs_b_ix_071234fc,
+	&m68000_base_device::x59f0_svs_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x59f0_svs_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x59f0_svs_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x5ac0_spl_b_071234fc,
 	&m68000_base_device::x5ac8_dbpl_w_071234fc,
 	&m68000_base_device::x5ad0_spl_b_ai_071234fc,
 	&m68000_base_device::x5ad8_spl_b_pi_071234fc,
 	&m68000_base_device::x5ae0_spl_b_pd_071234fc,
 	&m68000_base_device::x5ae8_spl_b_di_071234fc,
-	&m68000_base_device::x5af0_spl_b_ix_071234fc,
+	&m68000_base_device::x5af0_spl_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5af0_spl_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5af0_spl_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x5bc0_smi_b_071234fc,
 	&m68000_base_device::x5bc8_dbmi_w_071234fc,
 	&m68000_base_device::x5bd0_smi_b_ai_071234fc,
 	&m68000_base_device::x5bd8_smi_b_pi_071234fc,
 	&m68000_base_device::x5be0_smi_b_pd_071234fc,
 	&m68000_base_device::x5be8_smi_b_di_071234fc,
-	&m68000_base_device::x5bf0_smi_b_ix_071234fc,
+	&m68000_base_device::x5bf0_smi_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5bf0_smi_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5bf0_smi_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x5cc0_sge_b_071234fc,
 	&m68000_base_device::x5cc8_dbge_w_071234fc,
 	&m68000_base_device::x5cd0_sge_b_ai_071234fc,
 	&m68000_base_device::x5cd8_sge_b_pi_071234fc,
 	&m68000_base_device::x5ce0_sge_b_pd_071234fc,
 	&m68000_base_device::x5ce8_sge_b_di_071234fc,
-	&m68000_base_device::x5cf0_sge_b_ix_071234fc,
+	&m68000_base_device::x5cf0_sge_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5cf0_sge_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5cf0_sge_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x5dc0_slt_b_071234fc,
 	&m68000_base_device::x5dc8_dblt_w_071234fc,
 	&m68000_base_device::x5dd0_slt_b_ai_071234fc,
 	&m68000_base_device::x5dd8_slt_b_pi_071234fc,
 	&m68000_base_device::x5de0_slt_b_pd_071234fc,
 	&m68000_base_device::x5de8_slt_b_di_071234fc,
-	&m68000_base_device::x5df0_slt_b_ix_071234fc,
+	&m68000_base_device::x5df0_slt_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5df0_slt_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5df0_slt_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x5ec0_sgt_b_071234fc,
 	&m68000_base_device::x5ec8_dbgt_w_071234fc,
 	&m68000_base_device::x5ed0_sgt_b_ai_071234fc,
 	&m68000_base_device::x5ed8_sgt_b_pi_071234fc,
 	&m68000_base_device::x5ee0_sgt_b_pd_071234fc,
 	&m68000_base_device::x5ee8_sgt_b_di_071234fc,
-	&m68000_base_device::x5ef0_sgt_b_ix_071234fc,
+	&m68000_base_device::x5ef0_sgt_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5ef0_sgt_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5ef0_sgt_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x5fc0_sle_b_071234fc,
 	&m68000_base_device::x5fc8_dble_w_071234fc,
 	&m68000_base_device::x5fd0_sle_b_ai_071234fc,
 	&m68000_base_device::x5fd8_sle_b_pi_071234fc,
 	&m68000_base_device::x5fe0_sle_b_pd_071234fc,
 	&m68000_base_device::x5fe8_sle_b_di_071234fc,
-	&m68000_base_device::x5ff0_sle_b_ix_071234fc,
+	&m68000_base_device::x5ff0_sle_b_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x5ff0_sle_b_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x5ff0_sle_b_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x8f08_sbcd_b_071234fc,
 	&m68000_base_device::x8f48_pack_w_234fc,
 	&m68000_base_device::x8f88_unpk_w_234fc,
@@ -32759,140 +35240,286 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::xbf08_cmpm_b_071234fc,
 	&m68000_base_device::xcf08_abcd_b_071234fc,
 	&m68000_base_device::xdf08_addx_b_071234fc,
-	&m68000_base_device::xe0d0_asr_w_ai_071234fc,
-	&m68000_base_device::xe0d8_asr_w_pi_071234fc,
-	&m68000_base_device::xe0e0_asr_w_pd_071234fc,
-	&m68000_base_device::xe0e8_asr_w_di_071234fc,
-	&m68000_base_device::xe0f0_asr_w_ix_071234fc,
-	&m68000_base_device::xe1d0_asl_w_ai_071234fc,
-	&m68000_base_device::xe1d8_asl_w_pi_071234fc,
-	&m68000_base_device::xe1e0_asl_w_pd_071234fc,
-	&m68000_base_device::xe1e8_asl_w_di_071234fc,
-	&m68000_base_device::xe1f0_asl_w_ix_071234fc,
-	&m68000_base_device::xe2d0_lsr_w_ai_071234fc,
-	&m68000_base_device::xe2d8_lsr_w_pi_071234fc,
-	&m68000_base_device::xe2e0_lsr_w_pd_071234fc,
-	&m68000_base_device::xe2e8_lsr_w_di_071234fc,
-	&m68000_base_device::xe2f0_lsr_w_ix_071234fc,
-	&m68000_base_device::xe3d0_lsl_w_ai_071234fc,
-	&m68000_base_device::xe3d8_lsl_w_pi_071234fc,
-	&m68000_base_device::xe3e0_lsl_w_pd_071234fc,
-	&m68000_base_device::xe3e8_lsl_w_di_071234fc,
-	&m68000_base_device::xe3f0_lsl_w_ix_071234fc,
-	&m68000_base_device::xe4d0_roxr_w_ai_071234fc,
-	&m68000_base_device::xe4d8_roxr_w_pi_071234fc,
-	&m68000_base_device::xe4e0_roxr_w_pd_071234fc,
-	&m68000_base_device::xe4e8_roxr_w_di_071234fc,
-	&m68000_base_device::xe4f0_roxr_w_ix_071234fc,
-	&m68000_base_device::xe5d0_roxl_w_ai_071234fc,
-	&m68000_base_device::xe5d8_roxl_w_pi_071234fc,
-	&m68000_base_device::xe5e0_roxl_w_pd_071234fc,
-	&m68000_base_device::xe5e8_roxl_w_di_071234fc,
-	&m68000_base_device::xe5f0_roxl_w_ix_071234fc,
-	&m68000_base_device::xe6d0_ror_w_ai_071234fc,
-	&m68000_base_device::xe6d8_ror_w_pi_071234fc,
-	&m68000_base_device::xe6e0_ror_w_pd_071234fc,
-	&m68000_base_device::xe6e8_ror_w_di_071234fc,
-	&m68000_base_device::xe6f0_ror_w_ix_071234fc,
-	&m68000_base_device::xe7d0_rol_w_ai_071234fc,
-	&m68000_base_device::xe7d8_rol_w_pi_071234fc,
-	&m68000_base_device::xe7e0_rol_w_pd_071234fc,
-	&m68000_base_device::xe7e8_rol_w_di_071234fc,
-	&m68000_base_device::xe7f0_rol_w_ix_071234fc,
+	&m68000_base_device::xe0d0_asr_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe0d0_asr_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe0d0_asr_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe0d8_asr_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe0d8_asr_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe0d8_asr_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe0e0_asr_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe0e0_asr_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe0e0_asr_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe0e8_asr_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe0e8_asr_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe0e8_asr_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe0f0_asr_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe0f0_asr_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe0f0_asr_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe1d0_asl_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe1d0_asl_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe1d0_asl_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe1d8_asl_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe1d8_asl_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe1d8_asl_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe1e0_asl_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe1e0_asl_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe1e0_asl_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe1e8_asl_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe1e8_asl_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe1e8_asl_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe1f0_asl_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe1f0_asl_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe1f0_asl_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe2d0_lsr_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe2d0_lsr_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe2d0_lsr_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe2d8_lsr_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe2d8_lsr_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe2d8_lsr_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe2e0_lsr_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe2e0_lsr_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe2e0_lsr_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe2e8_lsr_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe2e8_lsr_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe2e8_lsr_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe2f0_lsr_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe2f0_lsr_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe2f0_lsr_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe3d0_lsl_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe3d0_lsl_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe3d0_lsl_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe3d8_lsl_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe3d8_lsl_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe3d8_lsl_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe3e0_lsl_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe3e0_lsl_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe3e0_lsl_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe3e8_lsl_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe3e8_lsl_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe3e8_lsl_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe3f0_lsl_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe3f0_lsl_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe3f0_lsl_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe4d0_roxr_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe4d0_roxr_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe4d0_roxr_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe4d8_roxr_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe4d8_roxr_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe4d8_roxr_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe4e0_roxr_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe4e0_roxr_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe4e0_roxr_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe4e8_roxr_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe4e8_roxr_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe4e8_roxr_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe4f0_roxr_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe4f0_roxr_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe4f0_roxr_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe5d0_roxl_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe5d0_roxl_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe5d0_roxl_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe5d8_roxl_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe5d8_roxl_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe5d8_roxl_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe5e0_roxl_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe5e0_roxl_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe5e0_roxl_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe5e8_roxl_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe5e8_roxl_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe5e8_roxl_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe5f0_roxl_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe5f0_roxl_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe5f0_roxl_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe6d0_ror_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe6d0_ror_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe6d0_ror_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe6d8_ror_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe6d8_ror_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe6d8_ror_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe6e0_ror_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe6e0_ror_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe6e0_ror_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe6e8_ror_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe6e8_ror_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe6e8_ror_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe6f0_ror_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe6f0_ror_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe6f0_ror_w_ix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe7d0_rol_w_ai_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe7d0_rol_w_ai_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe7d0_rol_w_ai_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe7d8_rol_w_pi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe7d8_rol_w_pi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe7d8_rol_w_pi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe7e0_rol_w_pd_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe7e0_rol_w_pd_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe7e0_rol_w_pd_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe7e8_rol_w_di_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe7e8_rol_w_di_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe7e8_rol_w_di_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe7f0_rol_w_ix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe7f0_rol_w_ix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe7f0_rol_w_ix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xe8c0_bftst_l_234fc,
-	&m68000_base_device::xe8d0_bftst_l_ai_234fc,
-	&m68000_base_device::xe8e8_bftst_l_di_234fc,
-	&m68000_base_device::xe8f0_bftst_l_ix_234fc,
+	&m68000_base_device::xe8d0_bftst_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe8d0_bftst_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe8e8_bftst_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe8e8_bftst_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe8f0_bftst_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe8f0_bftst_l_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xe9c0_bfextu_l_234fc,
-	&m68000_base_device::xe9d0_bfextu_l_ai_234fc,
-	&m68000_base_device::xe9e8_bfextu_l_di_234fc,
-	&m68000_base_device::xe9f0_bfextu_l_ix_234fc,
+	&m68000_base_device::xe9d0_bfextu_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe9d0_bfextu_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe9e8_bfextu_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe9e8_bfextu_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe9f0_bfextu_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe9f0_bfextu_l_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xeac0_bfchg_l_234fc,
-	&m68000_base_device::xead0_bfchg_l_ai_234fc,
-	&m68000_base_device::xeae8_bfchg_l_di_234fc,
-	&m68000_base_device::xeaf0_bfchg_l_ix_234fc,
+	&m68000_base_device::xead0_bfchg_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xead0_bfchg_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xeae8_bfchg_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xeae8_bfchg_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xeaf0_bfchg_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xeaf0_bfchg_l_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xebc0_bfexts_l_234fc,
-	&m68000_base_device::xebd0_bfexts_l_ai_234fc,
-	&m68000_base_device::xebe8_bfexts_l_di_234fc,
-	&m68000_base_device::xebf0_bfexts_l_ix_234fc,
+	&m68000_base_device::xebd0_bfexts_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xebd0_bfexts_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xebe8_bfexts_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xebe8_bfexts_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xebf0_bfexts_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xebf0_bfexts_l_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xecc0_bfclr_l_234fc,
-	&m68000_base_device::xecd0_bfclr_l_ai_234fc,
-	&m68000_base_device::xece8_bfclr_l_di_234fc,
-	&m68000_base_device::xecf0_bfclr_l_ix_234fc,
+	&m68000_base_device::xecd0_bfclr_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xecd0_bfclr_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xece8_bfclr_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xece8_bfclr_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xecf0_bfclr_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xecf0_bfclr_l_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xedc0_bfffo_l_234fc,
-	&m68000_base_device::xedd0_bfffo_l_ai_234fc,
-	&m68000_base_device::xede8_bfffo_l_di_234fc,
-	&m68000_base_device::xedf0_bfffo_l_ix_234fc,
+	&m68000_base_device::xedd0_bfffo_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xedd0_bfffo_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xede8_bfffo_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xede8_bfffo_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xedf0_bfffo_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xedf0_bfffo_l_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xeec0_bfset_l_234fc,
-	&m68000_base_device::xeed0_bfset_l_ai_234fc,
-	&m68000_base_device::xeee8_bfset_l_di_234fc,
-	&m68000_base_device::xeef0_bfset_l_ix_234fc,
+	&m68000_base_device::xeed0_bfset_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xeed0_bfset_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xeee8_bfset_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xeee8_bfset_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xeef0_bfset_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xeef0_bfset_l_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xefc0_bfins_l_234fc,
-	&m68000_base_device::xefd0_bfins_l_ai_234fc,
-	&m68000_base_device::xefe8_bfins_l_di_234fc,
-	&m68000_base_device::xeff0_bfins_l_ix_234fc,
+	&m68000_base_device::xefd0_bfins_l_ai_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xefd0_bfins_l_ai_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xefe8_bfins_l_di_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xefe8_bfins_l_di_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xeff0_bfins_l_ix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xeff0_bfins_l_ix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::xf278_ftrapcc_l_23,
 	&m68000_base_device::xf510_pflushan_l_4fc,
 	&m68000_base_device::xf518_pflusha_l_4fc,
-	&m68000_base_device::xf620_move16_l_4fc,
+	&m68000_base_device::xf620_move16_l_4fc<CPU_TYPES_68020>,
+	&m68000_base_device::xf620_move16_l_4fc<CPU_TYPES_68040>,
 	&m68000_base_device::x001f_ori_b_pi7_071234fc,
 	&m68000_base_device::x0027_ori_b_pd7_071234fc,
 	&m68000_base_device::x0038_ori_b_aw_071234fc,
 	&m68000_base_device::x0039_ori_b_al_071234fc,
 	&m68000_base_device::x003c_ori_w_071234fc,
-	&m68000_base_device::x0078_ori_w_aw_071234fc,
-	&m68000_base_device::x0079_ori_w_al_071234fc,
+	&m68000_base_device::x0078_ori_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0078_ori_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0078_ori_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0079_ori_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0079_ori_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0079_ori_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x007c_ori_w_071234fc,
-	&m68000_base_device::x00b8_ori_l_aw_071234fc,
-	&m68000_base_device::x00b9_ori_l_al_071234fc,
+	&m68000_base_device::x00b8_ori_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x00b8_ori_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x00b8_ori_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x00b9_ori_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x00b9_ori_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x00b9_ori_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x00f8_chk2cmp2_b_aw_234fc,
 	&m68000_base_device::x00f9_chk2cmp2_b_al_234fc,
 	&m68000_base_device::x00fa_chk2cmp2_b_234fc,
-	&m68000_base_device::x00fb_chk2cmp2_b_234fc,
+	&m68000_base_device::x00fb_chk2cmp2_b_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x00fb_chk2cmp2_b_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x021f_andi_b_pi7_071234fc,
 	&m68000_base_device::x0227_andi_b_pd7_071234fc,
 	&m68000_base_device::x0238_andi_b_aw_071234fc,
 	&m68000_base_device::x0239_andi_b_al_071234fc,
 	&m68000_base_device::x023c_andi_w_071234fc,
-	&m68000_base_device::x0278_andi_w_aw_071234fc,
-	&m68000_base_device::x0279_andi_w_al_071234fc,
+	&m68000_base_device::x0278_andi_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0278_andi_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0278_andi_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0279_andi_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0279_andi_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0279_andi_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x027c_andi_w_071234fc,
-	&m68000_base_device::x02b8_andi_l_aw_071234fc,
-	&m68000_base_device::x02b9_andi_l_al_071234fc,
-	&m68000_base_device::x02f8_chk2cmp2_w_aw_234fc,
-	&m68000_base_device::x02f9_chk2cmp2_w_al_234fc,
+	&m68000_base_device::x02b8_andi_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x02b8_andi_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x02b8_andi_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x02b9_andi_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x02b9_andi_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x02b9_andi_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x02f8_chk2cmp2_w_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x02f8_chk2cmp2_w_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x02f9_chk2cmp2_w_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x02f9_chk2cmp2_w_al_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x02fa_chk2cmp2_w_234fc,
-	&m68000_base_device::x02fb_chk2cmp2_w_234fc,
+	&m68000_base_device::x02fb_chk2cmp2_w_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x02fb_chk2cmp2_w_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x041f_subi_b_pi7_071234fc,
 	&m68000_base_device::x0427_subi_b_pd7_071234fc,
 	&m68000_base_device::x0438_subi_b_aw_071234fc,
 	&m68000_base_device::x0439_subi_b_al_071234fc,
-	&m68000_base_device::x0478_subi_w_aw_071234fc,
-	&m68000_base_device::x0479_subi_w_al_071234fc,
-	&m68000_base_device::x04b8_subi_l_aw_071234fc,
-	&m68000_base_device::x04b9_subi_l_al_071234fc,
-	&m68000_base_device::x04f8_chk2cmp2_l_aw_234fc,
-	&m68000_base_device::x04f9_chk2cmp2_l_al_234fc,
+	&m68000_base_device::x0478_subi_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0478_subi_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0478_subi_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0479_subi_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0479_subi_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0479_subi_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x04b8_subi_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x04b8_subi_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x04b8_subi_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x04b9_subi_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x04b9_subi_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x04b9_subi_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x04f8_chk2cmp2_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x04f8_chk2cmp2_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x04f9_chk2cmp2_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x04f9_chk2cmp2_l_al_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x04fa_chk2cmp2_l_234fc,
-	&m68000_base_device::x04fb_chk2cmp2_l_234fc,
+	&m68000_base_device::x04fb_chk2cmp2_l_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x04fb_chk2cmp2_l_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x061f_addi_b_pi7_071234fc,
 	&m68000_base_device::x0627_addi_b_pd7_071234fc,
 	&m68000_base_device::x0638_addi_b_aw_071234fc,
 	&m68000_base_device::x0639_addi_b_al_071234fc,
-	&m68000_base_device::x0678_addi_w_aw_071234fc,
-	&m68000_base_device::x0679_addi_w_al_071234fc,
-	&m68000_base_device::x06b8_addi_l_aw_071234fc,
-	&m68000_base_device::x06b9_addi_l_al_071234fc,
+	&m68000_base_device::x0678_addi_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0678_addi_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0678_addi_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0679_addi_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0679_addi_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0679_addi_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x06b8_addi_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x06b8_addi_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x06b8_addi_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x06b9_addi_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x06b9_addi_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x06b9_addi_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x06f8_callm_l_aw_2f,
 	&m68000_base_device::x06f9_callm_l_al_2f,
 	&m68000_base_device::x06fa_callm_l_pcdi_2f,
-	&m68000_base_device::x06fb_callm_l_pcix_2f,
+	&m68000_base_device::x06fb_callm_l_pcix_2f<CPU_TYPES_68020>,
 	&m68000_base_device::x081f_btst_b_pi7_071234fc,
 	&m68000_base_device::x0827_btst_b_pd7_071234fc,
 	&m68000_base_device::x0838_btst_b_aw_071234fc,
 	&m68000_base_device::x0839_btst_b_al_071234fc,
 	&m68000_base_device::x083a_btst_b_pcdi_071234fc,
-	&m68000_base_device::x083b_btst_b_pcix_071234fc,
+	&m68000_base_device::x083b_btst_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x083b_btst_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x083b_btst_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x085f_bchg_b_pi7_071234fc,
 	&m68000_base_device::x0867_bchg_b_pd7_071234fc,
 	&m68000_base_device::x0878_bchg_b_aw_071234fc,
@@ -32910,11 +35537,19 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::x0a38_eori_b_aw_071234fc,
 	&m68000_base_device::x0a39_eori_b_al_071234fc,
 	&m68000_base_device::x0a3c_eori_w_071234fc,
-	&m68000_base_device::x0a78_eori_w_aw_071234fc,
-	&m68000_base_device::x0a79_eori_w_al_071234fc,
+	&m68000_base_device::x0a78_eori_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0a78_eori_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0a78_eori_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0a79_eori_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0a79_eori_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0a79_eori_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0a7c_eori_w_071234fc,
-	&m68000_base_device::x0ab8_eori_l_aw_071234fc,
-	&m68000_base_device::x0ab9_eori_l_al_071234fc,
+	&m68000_base_device::x0ab8_eori_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0ab8_eori_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ab8_eori_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ab9_eori_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0ab9_eori_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ab9_eori_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0adf_cas_b_pi7_234fc,
 	&m68000_base_device::x0ae7_cas_b_pd7_234fc,
 	&m68000_base_device::x0af8_cas_b_aw_234fc,
@@ -32924,18 +35559,32 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::x0c38_cmpi_b_aw_071234fc,
 	&m68000_base_device::x0c39_cmpi_b_al_071234fc,
 	&m68000_base_device::x0c3a_cmpi_b_234fc,
-	&m68000_base_device::x0c3b_cmpi_b_234fc,
-	&m68000_base_device::x0c78_cmpi_w_aw_071234fc,
-	&m68000_base_device::x0c79_cmpi_w_al_071234fc,
+	&m68000_base_device::x0c3b_cmpi_b_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0c3b_cmpi_b_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0c78_cmpi_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0c78_cmpi_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0c78_cmpi_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0c79_cmpi_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0c79_cmpi_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0c79_cmpi_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0c7a_cmpi_w_234fc,
-	&m68000_base_device::x0c7b_cmpi_w_234fc,
-	&m68000_base_device::x0cb8_cmpi_l_aw_071234fc,
-	&m68000_base_device::x0cb9_cmpi_l_al_071234fc,
+	&m68000_base_device::x0c7b_cmpi_w_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0c7b_cmpi_w_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0cb8_cmpi_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0cb8_cmpi_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0cb8_cmpi_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0cb9_cmpi_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0cb9_cmpi_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0cb9_cmpi_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0cba_cmpi_l_234fc,
-	&m68000_base_device::x0cbb_cmpi_l_234fc,
-	&m68000_base_device::x0cf8_cas_w_aw_234fc,
-	&m68000_base_device::x0cf9_cas_w_al_234fc,
-	&m68000_base_device::x0cfc_cas2_w_234fc,
+	&m68000_base_device::x0cbb_cmpi_l_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0cbb_cmpi_l_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0cf8_cas_w_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0cf8_cas_w_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0cf9_cas_w_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0cf9_cas_w_al_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0cfc_cas2_w_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0cfc_cas2_w_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x0e1f_moves_b_pi7_134fc,
 	&m68000_base_device::x0e1f_moves_b_pi7_2,
 	&m68000_base_device::x0e27_moves_b_pd7_134fc,
@@ -32944,77 +35593,148 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::x0e38_moves_b_aw_2,
 	&m68000_base_device::x0e39_moves_b_al_134fc,
 	&m68000_base_device::x0e39_moves_b_al_2,
-	&m68000_base_device::x0e78_moves_w_aw_134fc,
-	&m68000_base_device::x0e78_moves_w_aw_2,
-	&m68000_base_device::x0e79_moves_w_al_134fc,
-	&m68000_base_device::x0e79_moves_w_al_2,
-	&m68000_base_device::x0eb8_moves_l_aw_134fc,
-	&m68000_base_device::x0eb8_moves_l_aw_2,
-	&m68000_base_device::x0eb9_moves_l_al_134fc,
-	&m68000_base_device::x0eb9_moves_l_al_2,
-	&m68000_base_device::x0ef8_cas_l_aw_234fc,
-	&m68000_base_device::x0ef9_cas_l_al_234fc,
-	&m68000_base_device::x0efc_cas2_l_234fc,
+	&m68000_base_device::x0e78_moves_w_aw_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0e78_moves_w_aw_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0e78_moves_w_aw_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0e78_moves_w_aw_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0e79_moves_w_al_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0e79_moves_w_al_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0e79_moves_w_al_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0e79_moves_w_al_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0eb8_moves_l_aw_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0eb8_moves_l_aw_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0eb8_moves_l_aw_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0eb8_moves_l_aw_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0eb9_moves_l_al_134fc<CPU_TYPES_68000>,
+	&m68000_base_device::x0eb9_moves_l_al_134fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0eb9_moves_l_al_134fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0eb9_moves_l_al_2<CPU_TYPES_68020>,
+	&m68000_base_device::x0ef8_cas_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ef8_cas_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0ef9_cas_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0ef9_cas_l_al_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x0efc_cas2_l_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x0efc_cas2_l_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x11df_move_b_pi7_071234fc,
 	&m68000_base_device::x11e7_move_b_pd7_071234fc,
 	&m68000_base_device::x11f8_move_b_aw_071234fc,
 	&m68000_base_device::x11f9_move_b_al_071234fc,
 	&m68000_base_device::x11fa_move_b_pcdi_071234fc,
-	&m68000_base_device::x11fb_move_b_pcix_071234fc,
+	&m68000_base_device::x11fb_move_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x11fb_move_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x11fb_move_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x11fc_move_b_i_071234fc,
 	&m68000_base_device::x13df_move_b_pi7_071234fc,
 	&m68000_base_device::x13e7_move_b_pd7_071234fc,
 	&m68000_base_device::x13f8_move_b_aw_071234fc,
 	&m68000_base_device::x13f9_move_b_al_071234fc,
 	&m68000_base_device::x13fa_move_b_pcdi_071234fc,
-	&m68000_base_device::x13fb_move_b_pcix_071234fc,
+	&m68000_base_device::x13fb_move_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x13fb_move_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x13fb_move_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x13fc_move_b_i_071234fc,
 	&m68000_base_device::x1edf_move_b_pi7_071234fc,
 	&m68000_base_device::x1ee7_move_b_pd7_071234fc,
 	&m68000_base_device::x1ef8_move_b_aw_071234fc,
 	&m68000_base_device::x1ef9_move_b_al_071234fc,
 	&m68000_base_device::x1efa_move_b_pcdi_071234fc,
-	&m68000_base_device::x1efb_move_b_pcix_071234fc,
+	&m68000_base_device::x1efb_move_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x1efb_move_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x1efb_move_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x1efc_move_b_i_071234fc,
 	&m68000_base_device::x1f1f_move_b_pi7_071234fc,
 	&m68000_base_device::x1f27_move_b_pd7_071234fc,
 	&m68000_base_device::x1f38_move_b_aw_071234fc,
 	&m68000_base_device::x1f39_move_b_al_071234fc,
 	&m68000_base_device::x1f3a_move_b_pcdi_071234fc,
-	&m68000_base_device::x1f3b_move_b_pcix_071234fc,
+	&m68000_base_device::x1f3b_move_b_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x1f3b_move_b_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x1f3b_move_b_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x1f3c_move_b_i_071234fc,
-	&m68000_base_device::x21f8_move_l_aw_071234fc,
-	&m68000_base_device::x21f9_move_l_al_071234fc,
-	&m68000_base_device::x21fa_move_l_pcdi_071234fc,
-	&m68000_base_device::x21fb_move_l_pcix_071234fc,
-	&m68000_base_device::x21fc_move_l_i_071234fc,
-	&m68000_base_device::x23f8_move_l_aw_071234fc,
-	&m68000_base_device::x23f9_move_l_al_071234fc,
-	&m68000_base_device::x23fa_move_l_pcdi_071234fc,
-	&m68000_base_device::x23fb_move_l_pcix_071234fc,
-	&m68000_base_device::x23fc_move_l_i_071234fc,
-	&m68000_base_device::x31f8_move_w_aw_071234fc,
-	&m68000_base_device::x31f9_move_w_al_071234fc,
-	&m68000_base_device::x31fa_move_w_pcdi_071234fc,
-	&m68000_base_device::x31fb_move_w_pcix_071234fc,
-	&m68000_base_device::x31fc_move_w_i_071234fc,
-	&m68000_base_device::x33f8_move_w_aw_071234fc,
-	&m68000_base_device::x33f9_move_w_al_071234fc,
-	&m68000_base_device::x33fa_move_w_pcdi_071234fc,
-	&m68000_base_device::x33fb_move_w_pcix_071234fc,
-	&m68000_base_device::x33fc_move_w_i_071234fc,
+	&m68000_base_device::x21f8_move_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21f8_move_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21f8_move_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21f9_move_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21f9_move_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21f9_move_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21fa_move_l_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21fa_move_l_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21fa_move_l_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21fb_move_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21fb_move_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21fb_move_l_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x21fc_move_l_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x21fc_move_l_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x21fc_move_l_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x23f8_move_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x23f8_move_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x23f8_move_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x23f9_move_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x23f9_move_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x23f9_move_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x23fa_move_l_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x23fa_move_l_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x23fa_move_l_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x23fb_move_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x23fb_move_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x23fb_move_l_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x23fc_move_l_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x23fc_move_l_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x23fc_move_l_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31f8_move_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31f8_move_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31f8_move_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31f9_move_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31f9_move_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31f9_move_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31fa_move_w_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31fa_move_w_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31fa_move_w_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31fb_move_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31fb_move_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31fb_move_w_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x31fc_move_w_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x31fc_move_w_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x31fc_move_w_i_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x33f8_move_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x33f8_move_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x33f8_move_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x33f9_move_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x33f9_move_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x33f9_move_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x33fa_move_w_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x33fa_move_w_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x33fa_move_w_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x33fb_move_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x33fb_move_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x33fb_move_w_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x33fc_move_w_i_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x33fc_move_w_i_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x33fc_move_w_i_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x401f_negx_b_pi7_071234fc,
 	&m68000_base_device::x4027_negx_b_pd7_071234fc,
 	&m68000_base_device::x4038_negx_b_aw_071234fc,
 	&m68000_base_device::x4039_negx_b_al_071234fc,
-	&m68000_base_device::x4078_negx_w_aw_071234fc,
-	&m68000_base_device::x4079_negx_w_al_071234fc,
-	&m68000_base_device::x40b8_negx_l_aw_071234fc,
-	&m68000_base_device::x40b9_negx_l_al_071234fc,
-	&m68000_base_device::x40f8_move_w_aw_07,
-	&m68000_base_device::x40f8_move_w_aw_1234fc,
-	&m68000_base_device::x40f9_move_w_al_07,
-	&m68000_base_device::x40f9_move_w_al_1234fc,
+	&m68000_base_device::x4078_negx_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4078_negx_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4078_negx_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4079_negx_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4079_negx_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4079_negx_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x40b8_negx_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x40b8_negx_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x40b8_negx_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x40b9_negx_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x40b9_negx_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x40b9_negx_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x40f8_move_w_aw_07<CPU_TYPES_68000>,
+	&m68000_base_device::x40f8_move_w_aw_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x40f8_move_w_aw_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x40f8_move_w_aw_1234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x40f9_move_w_al_07<CPU_TYPES_68000>,
+	&m68000_base_device::x40f9_move_w_al_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x40f9_move_w_al_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x40f9_move_w_al_1234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x421f_clr_b_pi7_0,
 	&m68000_base_device::x421f_clr_b_pi7_71234fc,
 	&m68000_base_device::x4227_clr_b_pd7_0,
@@ -33023,107 +35743,212 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::x4238_clr_b_aw_71234fc,
 	&m68000_base_device::x4239_clr_b_al_0,
 	&m68000_base_device::x4239_clr_b_al_71234fc,
-	&m68000_base_device::x4278_clr_w_aw_0,
-	&m68000_base_device::x4278_clr_w_aw_71234fc,
-	&m68000_base_device::x4279_clr_w_al_0,
-	&m68000_base_device::x4279_clr_w_al_71234fc,
-	&m68000_base_device::x42b8_clr_l_aw_0,
-	&m68000_base_device::x42b8_clr_l_aw_71234fc,
-	&m68000_base_device::x42b9_clr_l_al_0,
-	&m68000_base_device::x42b9_clr_l_al_71234fc,
-	&m68000_base_device::x42f8_move_w_aw_1234fc,
-	&m68000_base_device::x42f9_move_w_al_1234fc,
+	&m68000_base_device::x4278_clr_w_aw_0<CPU_TYPES_68000>,
+	&m68000_base_device::x4278_clr_w_aw_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4278_clr_w_aw_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4278_clr_w_aw_71234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4279_clr_w_al_0<CPU_TYPES_68000>,
+	&m68000_base_device::x4279_clr_w_al_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4279_clr_w_al_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4279_clr_w_al_71234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x42b8_clr_l_aw_0<CPU_TYPES_68000>,
+	&m68000_base_device::x42b8_clr_l_aw_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x42b8_clr_l_aw_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x42b8_clr_l_aw_71234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x42b9_clr_l_al_0<CPU_TYPES_68000>,
+	&m68000_base_device::x42b9_clr_l_al_71234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x42b9_clr_l_al_71234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x42b9_clr_l_al_71234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x42f8_move_w_aw_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x42f8_move_w_aw_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x42f8_move_w_aw_1234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x42f9_move_w_al_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x42f9_move_w_al_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x42f9_move_w_al_1234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x441f_neg_b_pi7_071234fc,
 	&m68000_base_device::x4427_neg_b_pd7_071234fc,
 	&m68000_base_device::x4438_neg_b_aw_071234fc,
 	&m68000_base_device::x4439_neg_b_al_071234fc,
-	&m68000_base_device::x4478_neg_w_aw_071234fc,
-	&m68000_base_device::x4479_neg_w_al_071234fc,
-	&m68000_base_device::x44b8_neg_l_aw_071234fc,
-	&m68000_base_device::x44b9_neg_l_al_071234fc,
-	&m68000_base_device::x44f8_move_w_aw_071234fc,
-	&m68000_base_device::x44f9_move_w_al_071234fc,
+	&m68000_base_device::x4478_neg_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4478_neg_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4478_neg_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4479_neg_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4479_neg_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4479_neg_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x44b8_neg_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44b8_neg_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44b8_neg_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x44b9_neg_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44b9_neg_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44b9_neg_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x44f8_move_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44f8_move_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44f8_move_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x44f9_move_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44f9_move_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44f9_move_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x44fa_move_w_pcdi_071234fc,
-	&m68000_base_device::x44fb_move_w_pcix_071234fc,
+	&m68000_base_device::x44fb_move_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x44fb_move_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x44fb_move_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x44fc_move_w_i_071234fc,
 	&m68000_base_device::x461f_not_b_pi7_071234fc,
 	&m68000_base_device::x4627_not_b_pd7_071234fc,
 	&m68000_base_device::x4638_not_b_aw_071234fc,
 	&m68000_base_device::x4639_not_b_al_071234fc,
-	&m68000_base_device::x4678_not_w_aw_071234fc,
-	&m68000_base_device::x4679_not_w_al_071234fc,
-	&m68000_base_device::x46b8_not_l_aw_071234fc,
-	&m68000_base_device::x46b9_not_l_al_071234fc,
-	&m68000_base_device::x46f8_move_w_aw_071234fc,
-	&m68000_base_device::x46f9_move_w_al_071234fc,
+	&m68000_base_device::x4678_not_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4678_not_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4678_not_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4679_not_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4679_not_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4679_not_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x46b8_not_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46b8_not_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46b8_not_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x46b9_not_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46b9_not_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46b9_not_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x46f8_move_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46f8_move_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46f8_move_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x46f9_move_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46f9_move_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46f9_move_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x46fa_move_w_pcdi_071234fc,
-	&m68000_base_device::x46fb_move_w_pcix_071234fc,
+	&m68000_base_device::x46fb_move_w_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x46fb_move_w_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x46fb_move_w_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x46fc_move_w_i_071234fc,
-	&m68000_base_device::x480f_link_l_234fc,
+	&m68000_base_device::x480f_link_l_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x480f_link_l_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x481f_nbcd_b_pi7_071234fc,
 	&m68000_base_device::x4827_nbcd_b_pd7_071234fc,
 	&m68000_base_device::x4838_nbcd_b_aw_071234fc,
 	&m68000_base_device::x4839_nbcd_b_al_071234fc,
-	&m68000_base_device::x4878_pea_l_aw_071234fc,
-	&m68000_base_device::x4879_pea_l_al_071234fc,
-	&m68000_base_device::x487a_pea_l_pcdi_071234fc,
-	&m68000_base_device::x487b_pea_l_pcix_071234fc,
-	&m68000_base_device::x48b8_movem_w_aw_071234fc,
-	&m68000_base_device::x48b9_movem_w_al_071234fc,
-	&m68000_base_device::x48f8_movem_l_aw_071234fc,
-	&m68000_base_device::x48f9_movem_l_al_071234fc,
+	&m68000_base_device::x4878_pea_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4878_pea_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4878_pea_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4879_pea_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4879_pea_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4879_pea_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x487a_pea_l_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x487a_pea_l_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x487a_pea_l_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x487b_pea_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x487b_pea_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x487b_pea_l_pcix_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x48b8_movem_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x48b8_movem_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x48b8_movem_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x48b9_movem_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x48b9_movem_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x48b9_movem_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x48f8_movem_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x48f8_movem_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x48f8_movem_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x48f9_movem_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x48f9_movem_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x48f9_movem_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4a1f_tst_b_pi7_071234fc,
 	&m68000_base_device::x4a27_tst_b_pd7_071234fc,
 	&m68000_base_device::x4a38_tst_b_aw_071234fc,
 	&m68000_base_device::x4a39_tst_b_al_071234fc,
 	&m68000_base_device::x4a3a_tst_b_234fc,
-	&m68000_base_device::x4a3b_tst_b_234fc,
+	&m68000_base_device::x4a3b_tst_b_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4a3b_tst_b_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4a3c_tst_b_234fc,
-	&m68000_base_device::x4a78_tst_w_aw_071234fc,
-	&m68000_base_device::x4a79_tst_w_al_071234fc,
+	&m68000_base_device::x4a78_tst_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4a78_tst_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4a78_tst_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4a79_tst_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4a79_tst_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4a79_tst_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4a7a_tst_w_234fc,
-	&m68000_base_device::x4a7b_tst_w_234fc,
+	&m68000_base_device::x4a7b_tst_w_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4a7b_tst_w_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4a7c_tst_w_234fc,
-	&m68000_base_device::x4ab8_tst_l_aw_071234fc,
-	&m68000_base_device::x4ab9_tst_l_al_071234fc,
+	&m68000_base_device::x4ab8_tst_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ab8_tst_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ab8_tst_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4ab9_tst_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ab9_tst_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ab9_tst_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4aba_tst_l_234fc,
-	&m68000_base_device::x4abb_tst_l_234fc,
+	&m68000_base_device::x4abb_tst_l_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4abb_tst_l_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4abc_tst_l_234fc,
-	&m68000_base_device::x4adf_tas_b_pi7_071234fc,
-	&m68000_base_device::x4ae7_tas_b_pd7_071234fc,
-	&m68000_base_device::x4af8_tas_b_aw_071234fc,
-	&m68000_base_device::x4af9_tas_b_al_071234fc,
+	&m68000_base_device::x4adf_tas_b_pi7_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4adf_tas_b_pi7_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4adf_tas_b_pi7_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4ae7_tas_b_pd7_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ae7_tas_b_pd7_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ae7_tas_b_pd7_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4af8_tas_b_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4af8_tas_b_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4af8_tas_b_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4af9_tas_b_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4af9_tas_b_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4af9_tas_b_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4afc_illegal_071234fc,
-	&m68000_base_device::x4c38_mull_l_aw_234fc,
-	&m68000_base_device::x4c39_mull_l_al_234fc,
+	&m68000_base_device::x4c38_mull_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c38_mull_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4c39_mull_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c39_mull_l_al_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4c3a_mull_l_pcdi_234fc,
-	&m68000_base_device::x4c3b_mull_l_pcix_234fc,
+	&m68000_base_device::x4c3b_mull_l_pcix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c3b_mull_l_pcix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4c3c_mull_l_i_234fc,
-	&m68000_base_device::x4c78_divl_l_aw_234fc,
-	&m68000_base_device::x4c79_divl_l_al_234fc,
+	&m68000_base_device::x4c78_divl_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c78_divl_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4c79_divl_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c79_divl_l_al_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4c7a_divl_l_pcdi_234fc,
-	&m68000_base_device::x4c7b_divl_l_pcix_234fc,
+	&m68000_base_device::x4c7b_divl_l_pcix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4c7b_divl_l_pcix_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4c7c_divl_l_i_234fc,
-	&m68000_base_device::x4cb8_movem_w_aw_071234fc,
-	&m68000_base_device::x4cb9_movem_w_al_071234fc,
+	&m68000_base_device::x4cb8_movem_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4cb8_movem_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4cb8_movem_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4cb9_movem_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4cb9_movem_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4cb9_movem_w_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4cba_movem_w_071234fc,
-	&m68000_base_device::x4cbb_movem_w_071234fc,
-	&m68000_base_device::x4cf8_movem_l_aw_071234fc,
-	&m68000_base_device::x4cf9_movem_l_al_071234fc,
+	&m68000_base_device::x4cbb_movem_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4cbb_movem_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4cbb_movem_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4cf8_movem_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4cf8_movem_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4cf8_movem_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4cf9_movem_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4cf9_movem_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4cf9_movem_l_al_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4cfa_movem_l_071234fc,
-	&m68000_base_device::x4cfb_movem_l_071234fc,
-	&m68000_base_device::x4e57_link_w_071234fc,
-	&m68000_base_device::x4e5f_unlk_l_071234fc,
+	&m68000_base_device::x4cfb_movem_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4cfb_movem_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4cfb_movem_l_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4e57_link_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4e57_link_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4e57_link_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4e5f_unlk_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4e5f_unlk_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4e5f_unlk_l_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4e70_reset_071234fc,
 	&m68000_base_device::x4e71_nop_071234fc,
 	&m68000_base_device::x4e72_stop_071234fc,
-	&m68000_base_device::x4e73_rte_l_0,
-	&m68000_base_device::x4e73_rte_l_71,
-	&m68000_base_device::x4e73_rte_l_234fc,
-	&m68000_base_device::x4e74_rtd_l_1234fc,
-	&m68000_base_device::x4e75_rts_l_071234fc,
+	&m68000_base_device::x4e73_rte_l_0<CPU_TYPES_68000>,
+	&m68000_base_device::x4e73_rte_l_71<CPU_TYPES_68000>,
+	&m68000_base_device::x4e73_rte_l_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4e73_rte_l_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4e74_rtd_l_1234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4e74_rtd_l_1234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4e74_rtd_l_1234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4e75_rts_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4e75_rts_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4e75_rts_l_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4e76_trapv_071234fc,
-	&m68000_base_device::x4e77_rtr_l_071234fc,
+	&m68000_base_device::x4e77_rtr_l_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4e77_rtr_l_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4e77_rtr_l_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4e7a_movec_l_1,
 	&m68000_base_device::x4e7a_movec_l_23f,
 	&m68000_base_device::x4e7a_movec_l_4,
@@ -33133,14 +35958,24 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::x4e7b_movec_l_3,
 	&m68000_base_device::x4e7b_movec_l_4,
 	&m68000_base_device::x4e7b_movec_l_c,
-	&m68000_base_device::x4eb8_jsr_l_aw_071234fc,
-	&m68000_base_device::x4eb9_jsr_l_al_071234fc,
-	&m68000_base_device::x4eba_jsr_l_pcdi_071234fc,
-	&m68000_base_device::x4ebb_jsr_l_pcix_071234fc,
+	&m68000_base_device::x4eb8_jsr_l_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4eb8_jsr_l_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4eb8_jsr_l_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4eb9_jsr_l_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4eb9_jsr_l_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4eb9_jsr_l_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4eba_jsr_l_pcdi_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4eba_jsr_l_pcdi_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4eba_jsr_l_pcdi_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x4ebb_jsr_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4ebb_jsr_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4ebb_jsr_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x4ef8_jmp_l_aw_071234fc,
 	&m68000_base_device::x4ef9_jmp_l_al_071234fc,
 	&m68000_base_device::x4efa_jmp_l_pcdi_071234fc,
-	&m68000_base_device::x4efb_jmp_l_pcix_071234fc,
+	&m68000_base_device::x4efb_jmp_l_pcix_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x4efb_jmp_l_pcix_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x4efb_jmp_l_pcix_071234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x50df_st_b_pi7_071234fc,
 	&m68000_base_device::x50e7_st_b_pd7_071234fc,
 	&m68000_base_device::x50f8_st_b_aw_071234fc,
@@ -33255,8 +36090,11 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::x5ffc_traple_234fc,
 	&m68000_base_device::x6000_bra_w_071234fc,
 	&m68000_base_device::x60ff_bra_l_234fc,
-	&m68000_base_device::x6100_bsr_w_071234fc,
-	&m68000_base_device::x61ff_bsr_l_234fc,
+	&m68000_base_device::x6100_bsr_w_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::x6100_bsr_w_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x6100_bsr_w_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::x61ff_bsr_l_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::x61ff_bsr_l_234fc<CPU_TYPES_68040>,
 	&m68000_base_device::x6200_bhi_w_071234fc,
 	&m68000_base_device::x62ff_bhi_l_071,
 	&m68000_base_device::x62ff_bhi_l_234fc,
@@ -33306,49 +36144,105 @@ const m68000_base_device::opcode_handler_ptr m68000_base_device::m68k_handler_ta
 	&m68000_base_device::xbf0f_cmpm_b_071234fc,
 	&m68000_base_device::xcf0f_abcd_b_071234fc,
 	&m68000_base_device::xdf0f_addx_b_071234fc,
-	&m68000_base_device::xe0f8_asr_w_aw_071234fc,
-	&m68000_base_device::xe0f9_asr_w_al_071234fc,
-	&m68000_base_device::xe1f8_asl_w_aw_071234fc,
-	&m68000_base_device::xe1f9_asl_w_al_071234fc,
-	&m68000_base_device::xe2f8_lsr_w_aw_071234fc,
-	&m68000_base_device::xe2f9_lsr_w_al_071234fc,
-	&m68000_base_device::xe3f8_lsl_w_aw_071234fc,
-	&m68000_base_device::xe3f9_lsl_w_al_071234fc,
-	&m68000_base_device::xe4f8_roxr_w_aw_071234fc,
-	&m68000_base_device::xe4f9_roxr_w_al_071234fc,
-	&m68000_base_device::xe5f8_roxl_w_aw_071234fc,
-	&m68000_base_device::xe5f9_roxl_w_al_071234fc,
-	&m68000_base_device::xe6f8_ror_w_aw_071234fc,
-	&m68000_base_device::xe6f9_ror_w_al_071234fc,
-	&m68000_base_device::xe7f8_rol_w_aw_071234fc,
-	&m68000_base_device::xe7f9_rol_w_al_071234fc,
-	&m68000_base_device::xe8f8_bftst_l_aw_234fc,
-	&m68000_base_device::xe8f9_bftst_l_al_234fc,
-	&m68000_base_device::xe8fa_bftst_l_pcdi_234fc,
-	&m68000_base_device::xe8fb_bftst_l_pcix_234fc,
-	&m68000_base_device::xe9f8_bfextu_l_aw_234fc,
-	&m68000_base_device::xe9f9_bfextu_l_al_234fc,
-	&m68000_base_device::xe9fa_bfextu_l_pcdi_234fc,
-	&m68000_base_device::xe9fb_bfextu_l_pcix_234fc,
-	&m68000_base_device::xeaf8_bfchg_l_aw_234fc,
-	&m68000_base_device::xeaf9_bfchg_l_al_234fc,
-	&m68000_base_device::xebf8_bfexts_l_aw_234fc,
-	&m68000_base_device::xebf9_bfexts_l_al_234fc,
-	&m68000_base_device::xebfa_bfexts_l_pcdi_234fc,
-	&m68000_base_device::xebfb_bfexts_l_pcix_234fc,
-	&m68000_base_device::xecf8_bfclr_l_aw_234fc,
-	&m68000_base_device::xecf9_bfclr_l_al_234fc,
-	&m68000_base_device::xedf8_bfffo_l_aw_234fc,
-	&m68000_base_device::xedf9_bfffo_l_al_234fc,
-	&m68000_base_device::xedfa_bfffo_l_pcdi_234fc,
-	&m68000_base_device::xedfb_bfffo_l_pcix_234fc,
-	&m68000_base_device::xeef8_bfset_l_aw_234fc,
-	&m68000_base_device::xeef9_bfset_l_al_234fc,
-	&m68000_base_device::xeff8_bfins_l_aw_234fc,
-	&m68000_base_device::xeff9_bfins_l_al_234fc,
+	&m68000_base_device::xe0f8_asr_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe0f8_asr_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe0f8_asr_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe0f9_asr_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe0f9_asr_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe0f9_asr_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe1f8_asl_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe1f8_asl_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe1f8_asl_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe1f9_asl_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe1f9_asl_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe1f9_asl_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe2f8_lsr_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe2f8_lsr_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe2f8_lsr_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe2f9_lsr_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe2f9_lsr_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe2f9_lsr_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe3f8_lsl_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe3f8_lsl_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe3f8_lsl_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe3f9_lsl_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe3f9_lsl_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe3f9_lsl_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe4f8_roxr_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe4f8_roxr_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe4f8_roxr_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe4f9_roxr_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe4f9_roxr_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe4f9_roxr_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe5f8_roxl_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe5f8_roxl_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe5f8_roxl_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe5f9_roxl_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe5f9_roxl_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe5f9_roxl_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe6f8_ror_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe6f8_ror_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe6f8_ror_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe6f9_ror_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe6f9_ror_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe6f9_ror_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe7f8_rol_w_aw_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe7f8_rol_w_aw_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe7f8_rol_w_aw_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe7f9_rol_w_al_071234fc<CPU_TYPES_68000>,
+	&m68000_base_device::xe7f9_rol_w_al_071234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe7f9_rol_w_al_071234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe8f8_bftst_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe8f8_bftst_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe8f9_bftst_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe8f9_bftst_l_al_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe8fa_bftst_l_pcdi_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe8fa_bftst_l_pcdi_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe8fb_bftst_l_pcix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe8fb_bftst_l_pcix_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe9f8_bfextu_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe9f8_bfextu_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe9f9_bfextu_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe9f9_bfextu_l_al_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe9fa_bfextu_l_pcdi_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe9fa_bfextu_l_pcdi_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xe9fb_bfextu_l_pcix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xe9fb_bfextu_l_pcix_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xeaf8_bfchg_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xeaf8_bfchg_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xeaf9_bfchg_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xeaf9_bfchg_l_al_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xebf8_bfexts_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xebf8_bfexts_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xebf9_bfexts_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xebf9_bfexts_l_al_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xebfa_bfexts_l_pcdi_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xebfa_bfexts_l_pcdi_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xebfb_bfexts_l_pcix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xebfb_bfexts_l_pcix_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xecf8_bfclr_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xecf8_bfclr_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xecf9_bfclr_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xecf9_bfclr_l_al_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xedf8_bfffo_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xedf8_bfffo_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xedf9_bfffo_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xedf9_bfffo_l_al_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xedfa_bfffo_l_pcdi_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xedfa_bfffo_l_pcdi_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xedfb_bfffo_l_pcix_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xedfb_bfffo_l_pcix_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xeef8_bfset_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xeef8_bfset_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xeef9_bfset_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xeef9_bfset_l_al_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xeff8_bfins_l_aw_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xeff8_bfins_l_aw_234fc<CPU_TYPES_68040>,
+	&m68000_base_device::xeff9_bfins_l_al_234fc<CPU_TYPES_68020>,
+	&m68000_base_device::xeff9_bfins_l_al_234fc<CPU_TYPES_68040>,
 };
 
-const u16 m68000_base_device::m68k_state_illegal = 1797;
+const u16 m68000_base_device::m68k_state_illegal = 3563;
 
 const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_table[] =
 {
@@ -33361,7 +36255,9 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0xf040, 0xf1c0, {255, 255, 255,   4,   4, 255, 255, 255}},
 	{ 0xf000, 0xfe00, {255, 255, 255,   8,   8,   8,   8,   8}},
 	{ 0x6000, 0xff00, { 10,  13,  10,  10,  10,  10,  10,  10}},
-	{ 0x6100, 0xff00, { 18,  17,  18,   7,   7,   7,   7,   7}},
+	{ 0x6100, 0xff00, { 18,  17,  18, 255, 255, 255, 255, 255}},
+	{ 0x6100, 0xff00, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x6100, 0xff00, {255, 255, 255, 255, 255,   7, 255,   7}},
 	{ 0x6200, 0xff00, { 10,  13,  10,   6,   6,   6,   6,   6}},
 	{ 0x6300, 0xff00, { 10,  13,  10,   6,   6,   6,   6,   6}},
 	{ 0x6400, 0xff00, { 10,  13,  10,   6,   6,   6,   6,   6}},
@@ -33386,483 +36282,1086 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x0118, 0xf1f8, {  8,  11,   8,   8,   8,   8,   8,   4}},
 	{ 0x0120, 0xf1f8, { 10,  13,  10,   9,   9,   9,   9,   4}},
 	{ 0x0128, 0xf1f8, { 12,  15,  12,   9,   9,   9,   9,   4}},
-	{ 0x0130, 0xf1f8, { 14,  17,  14,  11,  11,  11,  11,   4}},
+	{ 0x0130, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x0130, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0130, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0140, 0xf1f8, {  8,  10,   8,   4,   4,   4,   4,   4}},
 	{ 0x0148, 0xf1f8, { 24,  36,  24,  18,  18,  18,  18,  18}},
 	{ 0x0150, 0xf1f8, { 12,  18,  12,   8,   8,   8,   8,   4}},
 	{ 0x0158, 0xf1f8, { 12,  18,  12,   8,   8,   8,   8,   4}},
 	{ 0x0160, 0xf1f8, { 14,  20,  14,   9,   9,   9,   9,   4}},
 	{ 0x0168, 0xf1f8, { 16,  22,  16,   9,   9,   9,   9,   4}},
-	{ 0x0170, 0xf1f8, { 18,  24,  18,  11,  11,  11,  11,   4}},
+	{ 0x0170, 0xf1f8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x0170, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0170, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0180, 0xf1f8, { 10,  10,  10,   4,   4,   4,   4,   4}},
 	{ 0x0188, 0xf1f8, { 16,  25,  16,  11,  11,  11,  11,  11}},
 	{ 0x0190, 0xf1f8, { 12,  18,  14,   8,   8,   8,   8,   4}},
 	{ 0x0198, 0xf1f8, { 12,  18,  14,   8,   8,   8,   8,   4}},
 	{ 0x01a0, 0xf1f8, { 14,  20,  16,   9,   9,   9,   9,   4}},
 	{ 0x01a8, 0xf1f8, { 16,  22,  18,   9,   9,   9,   9,   4}},
-	{ 0x01b0, 0xf1f8, { 18,  24,  20,  11,  11,  11,  11,   4}},
+	{ 0x01b0, 0xf1f8, { 18,  24,  20, 255, 255, 255, 255, 255}},
+	{ 0x01b0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x01b0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x01c0, 0xf1f8, {  8,  10,   8,   4,   4,   4,   4,   4}},
 	{ 0x01c8, 0xf1f8, { 24,  39,  24,  17,  17,  17,  17,  17}},
 	{ 0x01d0, 0xf1f8, { 12,  18,  12,   8,   8,   8,   8,   4}},
 	{ 0x01d8, 0xf1f8, { 12,  18,  12,   8,   8,   8,   8,   4}},
 	{ 0x01e0, 0xf1f8, { 14,  20,  14,   9,   9,   9,   9,   4}},
 	{ 0x01e8, 0xf1f8, { 16,  22,  16,   9,   9,   9,   9,   4}},
-	{ 0x01f0, 0xf1f8, { 18,  24,  18,  11,  11,  11,  11,   4}},
+	{ 0x01f0, 0xf1f8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x01f0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x01f0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x1000, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x1010, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0x1018, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0x1020, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0x1028, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x1030, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x1030, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x1030, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x1030, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x1080, 0xf1f8, {  8,  11,   8,   4,   4,   4,   4,   4}},
 	{ 0x1090, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x1098, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x10a0, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x10a8, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x10b0, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x10b0, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x10b0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x10b0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x10c0, 0xf1f8, {  8,  11,   8,   4,   4,   4,   4,   4}},
 	{ 0x10d0, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x10d8, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x10e0, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x10e8, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x10f0, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x10f0, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x10f0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x10f0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x1100, 0xf1f8, {  8,  14,   8,   5,   5,   5,   5,   5}},
 	{ 0x1110, 0xf1f8, { 12,  18,  12,   9,   9,   9,   9,   5}},
 	{ 0x1118, 0xf1f8, { 12,  18,  12,   9,   9,   9,   9,   5}},
 	{ 0x1120, 0xf1f8, { 14,  20,  14,  10,  10,  10,  10,   5}},
 	{ 0x1128, 0xf1f8, { 16,  22,  16,  10,  10,  10,  10,   5}},
-	{ 0x1130, 0xf1f8, { 18,  24,  18,  12,  12,  12,  12,   5}},
+	{ 0x1130, 0xf1f8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x1130, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x1130, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   5}},
 	{ 0x1140, 0xf1f8, { 12,  18,  12,   5,   5,   5,   5,   5}},
 	{ 0x1150, 0xf1f8, { 16,  22,  16,   9,   9,   9,   9,   5}},
 	{ 0x1158, 0xf1f8, { 16,  22,  16,   9,   9,   9,   9,   5}},
 	{ 0x1160, 0xf1f8, { 18,  24,  18,  10,  10,  10,  10,   5}},
 	{ 0x1168, 0xf1f8, { 20,  26,  20,  10,  10,  10,  10,   5}},
-	{ 0x1170, 0xf1f8, { 22,  28,  22,  12,  12,  12,  12,   5}},
-	{ 0x1180, 0xf1f8, { 14,  21,  14,   7,   7,   7,   7,   7}},
-	{ 0x1190, 0xf1f8, { 18,  25,  18,  11,  11,  11,  11,   7}},
-	{ 0x1198, 0xf1f8, { 18,  25,  18,  11,  11,  11,  11,   7}},
-	{ 0x11a0, 0xf1f8, { 20,  27,  20,  12,  12,  12,  12,   7}},
-	{ 0x11a8, 0xf1f8, { 22,  29,  22,  12,  12,  12,  12,   7}},
-	{ 0x11b0, 0xf1f8, { 24,  31,  24,  14,  14,  14,  14,   7}},
+	{ 0x1170, 0xf1f8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x1170, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x1170, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0x1180, 0xf1f8, { 14,  21,  14, 255, 255, 255, 255, 255}},
+	{ 0x1180, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x1180, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   7}},
+	{ 0x1190, 0xf1f8, { 18,  25,  18, 255, 255, 255, 255, 255}},
+	{ 0x1190, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x1190, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x1198, 0xf1f8, { 18,  25,  18, 255, 255, 255, 255, 255}},
+	{ 0x1198, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x1198, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x11a0, 0xf1f8, { 20,  27,  20, 255, 255, 255, 255, 255}},
+	{ 0x11a0, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x11a0, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0x11a8, 0xf1f8, { 22,  29,  22, 255, 255, 255, 255, 255}},
+	{ 0x11a8, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x11a8, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0x11b0, 0xf1f8, { 24,  31,  24, 255, 255, 255, 255, 255}},
+	{ 0x11b0, 0xf1f8, {255, 255, 255,  14,  14, 255,  14, 255}},
+	{ 0x11b0, 0xf1f8, {255, 255, 255, 255, 255,  14, 255,   7}},
 	{ 0x2000, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x2008, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0x2010, 0xf1f8, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x2018, 0xf1f8, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x2020, 0xf1f8, { 14,  17,  14,   7,   7,   7,   7,   2}},
-	{ 0x2028, 0xf1f8, { 16,  19,  16,   7,   7,   7,   7,   2}},
-	{ 0x2030, 0xf1f8, { 18,  21,  18,   9,   9,   9,   9,   2}},
+	{ 0x2010, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x2010, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x2010, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x2018, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x2018, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x2018, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x2020, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x2020, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x2020, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x2028, 0xf1f8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x2028, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x2028, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x2030, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x2030, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x2030, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x2040, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x2048, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0x2050, 0xf1f8, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x2058, 0xf1f8, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x2060, 0xf1f8, { 14,  17,  14,   7,   7,   7,   7,   2}},
-	{ 0x2068, 0xf1f8, { 16,  19,  16,   7,   7,   7,   7,   2}},
-	{ 0x2070, 0xf1f8, { 18,  21,  18,   9,   9,   9,   9,   2}},
-	{ 0x2080, 0xf1f8, { 12,  15,  12,   4,   4,   4,   4,   4}},
-	{ 0x2088, 0xf1f8, { 12,  15,  12,   4,   4,   4,   4,   4}},
-	{ 0x2090, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x2098, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x20a0, 0xf1f8, { 22,  25,  22,   9,   9,   9,   9,   4}},
-	{ 0x20a8, 0xf1f8, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0x20b0, 0xf1f8, { 26,  29,  26,  11,  11,  11,  11,   4}},
-	{ 0x20c0, 0xf1f8, { 12,  15,  12,   4,   4,   4,   4,   4}},
-	{ 0x20c8, 0xf1f8, { 12,  15,  12,   4,   4,   4,   4,   4}},
-	{ 0x20d0, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x20d8, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x20e0, 0xf1f8, { 22,  25,  22,   9,   9,   9,   9,   4}},
-	{ 0x20e8, 0xf1f8, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0x20f0, 0xf1f8, { 26,  29,  26,  11,  11,  11,  11,   4}},
-	{ 0x2100, 0xf1f8, { 12,  18,  14,   5,   5,   5,   5,   5}},
-	{ 0x2108, 0xf1f8, { 12,  18,  14,   5,   5,   5,   5,   5}},
-	{ 0x2110, 0xf1f8, { 20,  26,  22,   9,   9,   9,   9,   5}},
-	{ 0x2118, 0xf1f8, { 20,  26,  22,   9,   9,   9,   9,   5}},
-	{ 0x2120, 0xf1f8, { 22,  28,  24,  10,  10,  10,  10,   5}},
-	{ 0x2128, 0xf1f8, { 24,  30,  26,  10,  10,  10,  10,   5}},
-	{ 0x2130, 0xf1f8, { 26,  32,  28,  12,  12,  12,  12,   5}},
-	{ 0x2140, 0xf1f8, { 16,  22,  16,   5,   5,   5,   5,   5}},
-	{ 0x2148, 0xf1f8, { 16,  22,  16,   5,   5,   5,   5,   5}},
-	{ 0x2150, 0xf1f8, { 24,  30,  24,   9,   9,   9,   9,   5}},
-	{ 0x2158, 0xf1f8, { 24,  30,  24,   9,   9,   9,   9,   5}},
-	{ 0x2160, 0xf1f8, { 26,  32,  26,  10,  10,  10,  10,   5}},
-	{ 0x2168, 0xf1f8, { 28,  34,  28,  10,  10,  10,  10,   5}},
-	{ 0x2170, 0xf1f8, { 30,  36,  30,  12,  12,  12,  12,   5}},
-	{ 0x2180, 0xf1f8, { 18,  25,  18,   7,   7,   7,   7,   7}},
-	{ 0x2188, 0xf1f8, { 18,  25,  18,   7,   7,   7,   7,   7}},
-	{ 0x2190, 0xf1f8, { 26,  33,  26,  11,  11,  11,  11,   7}},
-	{ 0x2198, 0xf1f8, { 26,  33,  26,  11,  11,  11,  11,   7}},
-	{ 0x21a0, 0xf1f8, { 28,  35,  28,  12,  12,  12,  12,   7}},
-	{ 0x21a8, 0xf1f8, { 30,  37,  30,  12,  12,  12,  12,   7}},
-	{ 0x21b0, 0xf1f8, { 32,  39,  32,  14,  14,  14,  14,   7}},
+	{ 0x2050, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x2050, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x2050, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x2058, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x2058, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x2058, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x2060, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x2060, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x2060, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x2068, 0xf1f8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x2068, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x2068, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x2070, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x2070, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x2070, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
+	{ 0x2080, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x2080, 0xf1f8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x2080, 0xf1f8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x2088, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x2088, 0xf1f8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x2088, 0xf1f8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x2090, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x2090, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x2090, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x2098, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x2098, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x2098, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x20a0, 0xf1f8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x20a0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x20a0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x20a8, 0xf1f8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x20a8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x20a8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x20b0, 0xf1f8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x20b0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x20b0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x20c0, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x20c0, 0xf1f8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x20c0, 0xf1f8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x20c8, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x20c8, 0xf1f8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x20c8, 0xf1f8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x20d0, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x20d0, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x20d0, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x20d8, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x20d8, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x20d8, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x20e0, 0xf1f8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x20e0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x20e0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x20e8, 0xf1f8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x20e8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x20e8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x20f0, 0xf1f8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x20f0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x20f0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x2100, 0xf1f8, { 12,  18,  14, 255, 255, 255, 255, 255}},
+	{ 0x2100, 0xf1f8, {255, 255, 255,   5,   5, 255,   5, 255}},
+	{ 0x2100, 0xf1f8, {255, 255, 255, 255, 255,   5, 255,   5}},
+	{ 0x2108, 0xf1f8, { 12,  18,  14, 255, 255, 255, 255, 255}},
+	{ 0x2108, 0xf1f8, {255, 255, 255,   5,   5, 255,   5, 255}},
+	{ 0x2108, 0xf1f8, {255, 255, 255, 255, 255,   5, 255,   5}},
+	{ 0x2110, 0xf1f8, { 20,  26,  22, 255, 255, 255, 255, 255}},
+	{ 0x2110, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x2110, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x2118, 0xf1f8, { 20,  26,  22, 255, 255, 255, 255, 255}},
+	{ 0x2118, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x2118, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x2120, 0xf1f8, { 22,  28,  24, 255, 255, 255, 255, 255}},
+	{ 0x2120, 0xf1f8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x2120, 0xf1f8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x2128, 0xf1f8, { 24,  30,  26, 255, 255, 255, 255, 255}},
+	{ 0x2128, 0xf1f8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x2128, 0xf1f8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x2130, 0xf1f8, { 26,  32,  28, 255, 255, 255, 255, 255}},
+	{ 0x2130, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x2130, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0x2140, 0xf1f8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x2140, 0xf1f8, {255, 255, 255,   5,   5, 255,   5, 255}},
+	{ 0x2140, 0xf1f8, {255, 255, 255, 255, 255,   5, 255,   5}},
+	{ 0x2148, 0xf1f8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x2148, 0xf1f8, {255, 255, 255,   5,   5, 255,   5, 255}},
+	{ 0x2148, 0xf1f8, {255, 255, 255, 255, 255,   5, 255,   5}},
+	{ 0x2150, 0xf1f8, { 24,  30,  24, 255, 255, 255, 255, 255}},
+	{ 0x2150, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x2150, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x2158, 0xf1f8, { 24,  30,  24, 255, 255, 255, 255, 255}},
+	{ 0x2158, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x2158, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x2160, 0xf1f8, { 26,  32,  26, 255, 255, 255, 255, 255}},
+	{ 0x2160, 0xf1f8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x2160, 0xf1f8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x2168, 0xf1f8, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x2168, 0xf1f8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x2168, 0xf1f8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x2170, 0xf1f8, { 30,  36,  30, 255, 255, 255, 255, 255}},
+	{ 0x2170, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x2170, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0x2180, 0xf1f8, { 18,  25,  18, 255, 255, 255, 255, 255}},
+	{ 0x2180, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x2180, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   7}},
+	{ 0x2188, 0xf1f8, { 18,  25,  18, 255, 255, 255, 255, 255}},
+	{ 0x2188, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x2188, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   7}},
+	{ 0x2190, 0xf1f8, { 26,  33,  26, 255, 255, 255, 255, 255}},
+	{ 0x2190, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x2190, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x2198, 0xf1f8, { 26,  33,  26, 255, 255, 255, 255, 255}},
+	{ 0x2198, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x2198, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x21a0, 0xf1f8, { 28,  35,  28, 255, 255, 255, 255, 255}},
+	{ 0x21a0, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x21a0, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0x21a8, 0xf1f8, { 30,  37,  30, 255, 255, 255, 255, 255}},
+	{ 0x21a8, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x21a8, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0x21b0, 0xf1f8, { 32,  39,  32, 255, 255, 255, 255, 255}},
+	{ 0x21b0, 0xf1f8, {255, 255, 255,  14,  14, 255,  14, 255}},
+	{ 0x21b0, 0xf1f8, {255, 255, 255, 255, 255,  14, 255,   7}},
 	{ 0x3000, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x3008, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0x3010, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0x3018, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0x3020, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
-	{ 0x3028, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x3030, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x3010, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x3010, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x3010, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x3018, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x3018, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x3018, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x3020, 0xf1f8, { 10,  13,  10, 255, 255, 255, 255, 255}},
+	{ 0x3020, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x3020, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x3028, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x3028, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x3028, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x3030, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x3030, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x3030, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x3040, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x3048, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0x3050, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0x3058, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0x3060, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
-	{ 0x3068, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x3070, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
-	{ 0x3080, 0xf1f8, {  8,  11,   8,   4,   4,   4,   4,   4}},
-	{ 0x3088, 0xf1f8, {  8,  11,   8,   4,   4,   4,   4,   4}},
-	{ 0x3090, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x3098, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x30a0, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
-	{ 0x30a8, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x30b0, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
-	{ 0x30c0, 0xf1f8, {  8,  11,   8,   4,   4,   4,   4,   4}},
-	{ 0x30c8, 0xf1f8, {  8,  11,   8,   4,   4,   4,   4,   4}},
-	{ 0x30d0, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x30d8, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x30e0, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
-	{ 0x30e8, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x30f0, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
-	{ 0x3100, 0xf1f8, {  8,  14,   8,   5,   5,   5,   5,   5}},
-	{ 0x3108, 0xf1f8, {  8,  14,   8,   5,   5,   5,   5,   5}},
-	{ 0x3110, 0xf1f8, { 12,  18,  12,   9,   9,   9,   9,   5}},
-	{ 0x3118, 0xf1f8, { 12,  18,  12,   9,   9,   9,   9,   5}},
-	{ 0x3120, 0xf1f8, { 14,  20,  14,  10,  10,  10,  10,   5}},
-	{ 0x3128, 0xf1f8, { 16,  22,  16,  10,  10,  10,  10,   5}},
-	{ 0x3130, 0xf1f8, { 18,  24,  18,  12,  12,  12,  12,   5}},
-	{ 0x3140, 0xf1f8, { 12,  18,  12,   5,   5,   5,   5,   5}},
-	{ 0x3148, 0xf1f8, { 12,  18,  12,   5,   5,   5,   5,   5}},
-	{ 0x3150, 0xf1f8, { 16,  22,  16,   9,   9,   9,   9,   5}},
-	{ 0x3158, 0xf1f8, { 16,  22,  16,   9,   9,   9,   9,   5}},
-	{ 0x3160, 0xf1f8, { 18,  24,  18,  10,  10,  10,  10,   5}},
-	{ 0x3168, 0xf1f8, { 20,  26,  20,  10,  10,  10,  10,   5}},
-	{ 0x3170, 0xf1f8, { 22,  28,  22,  12,  12,  12,  12,   5}},
-	{ 0x3180, 0xf1f8, { 14,  21,  14,   7,   7,   7,   7,   7}},
-	{ 0x3188, 0xf1f8, { 14,  21,  14,   7,   7,   7,   7,   7}},
-	{ 0x3190, 0xf1f8, { 18,  25,  18,  11,  11,  11,  11,   7}},
-	{ 0x3198, 0xf1f8, { 18,  25,  18,  11,  11,  11,  11,   7}},
-	{ 0x31a0, 0xf1f8, { 20,  27,  20,  12,  12,  12,  12,   7}},
-	{ 0x31a8, 0xf1f8, { 22,  29,  22,  12,  12,  12,  12,   7}},
-	{ 0x31b0, 0xf1f8, { 24,  31,  24,  14,  14,  14,  14,   7}},
+	{ 0x3050, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x3050, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x3050, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x3058, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x3058, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x3058, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x3060, 0xf1f8, { 10,  13,  10, 255, 255, 255, 255, 255}},
+	{ 0x3060, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x3060, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x3068, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x3068, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x3068, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x3070, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x3070, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x3070, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
+	{ 0x3080, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x3080, 0xf1f8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x3080, 0xf1f8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x3088, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x3088, 0xf1f8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x3088, 0xf1f8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x3090, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x3090, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x3090, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x3098, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x3098, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x3098, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x30a0, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x30a0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x30a0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x30a8, 0xf1f8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x30a8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x30a8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x30b0, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x30b0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x30b0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x30c0, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x30c0, 0xf1f8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x30c0, 0xf1f8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x30c8, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x30c8, 0xf1f8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x30c8, 0xf1f8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x30d0, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x30d0, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x30d0, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x30d8, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x30d8, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x30d8, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x30e0, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x30e0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x30e0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x30e8, 0xf1f8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x30e8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x30e8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x30f0, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x30f0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x30f0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x3100, 0xf1f8, {  8,  14,   8, 255, 255, 255, 255, 255}},
+	{ 0x3100, 0xf1f8, {255, 255, 255,   5,   5, 255,   5, 255}},
+	{ 0x3100, 0xf1f8, {255, 255, 255, 255, 255,   5, 255,   5}},
+	{ 0x3108, 0xf1f8, {  8,  14,   8, 255, 255, 255, 255, 255}},
+	{ 0x3108, 0xf1f8, {255, 255, 255,   5,   5, 255,   5, 255}},
+	{ 0x3108, 0xf1f8, {255, 255, 255, 255, 255,   5, 255,   5}},
+	{ 0x3110, 0xf1f8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0x3110, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x3110, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x3118, 0xf1f8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0x3118, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x3118, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x3120, 0xf1f8, { 14,  20,  14, 255, 255, 255, 255, 255}},
+	{ 0x3120, 0xf1f8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x3120, 0xf1f8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x3128, 0xf1f8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x3128, 0xf1f8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x3128, 0xf1f8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x3130, 0xf1f8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x3130, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x3130, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0x3140, 0xf1f8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0x3140, 0xf1f8, {255, 255, 255,   5,   5, 255,   5, 255}},
+	{ 0x3140, 0xf1f8, {255, 255, 255, 255, 255,   5, 255,   5}},
+	{ 0x3148, 0xf1f8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0x3148, 0xf1f8, {255, 255, 255,   5,   5, 255,   5, 255}},
+	{ 0x3148, 0xf1f8, {255, 255, 255, 255, 255,   5, 255,   5}},
+	{ 0x3150, 0xf1f8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x3150, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x3150, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x3158, 0xf1f8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x3158, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x3158, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x3160, 0xf1f8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x3160, 0xf1f8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x3160, 0xf1f8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x3168, 0xf1f8, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x3168, 0xf1f8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x3168, 0xf1f8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x3170, 0xf1f8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x3170, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x3170, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0x3180, 0xf1f8, { 14,  21,  14, 255, 255, 255, 255, 255}},
+	{ 0x3180, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x3180, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   7}},
+	{ 0x3188, 0xf1f8, { 14,  21,  14, 255, 255, 255, 255, 255}},
+	{ 0x3188, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x3188, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   7}},
+	{ 0x3190, 0xf1f8, { 18,  25,  18, 255, 255, 255, 255, 255}},
+	{ 0x3190, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x3190, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x3198, 0xf1f8, { 18,  25,  18, 255, 255, 255, 255, 255}},
+	{ 0x3198, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x3198, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x31a0, 0xf1f8, { 20,  27,  20, 255, 255, 255, 255, 255}},
+	{ 0x31a0, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x31a0, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0x31a8, 0xf1f8, { 22,  29,  22, 255, 255, 255, 255, 255}},
+	{ 0x31a8, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x31a8, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0x31b0, 0xf1f8, { 24,  31,  24, 255, 255, 255, 255, 255}},
+	{ 0x31b0, 0xf1f8, {255, 255, 255,  14,  14, 255,  14, 255}},
+	{ 0x31b0, 0xf1f8, {255, 255, 255, 255, 255,  14, 255,   7}},
 	{ 0x4100, 0xf1f8, {255, 255, 255,   8,   8,   8,   8,   8}},
-	{ 0x4110, 0xf1f8, {255, 255, 255,  12,  12,  12,  12,   8}},
-	{ 0x4118, 0xf1f8, {255, 255, 255,  12,  12,  12,  12,   8}},
-	{ 0x4120, 0xf1f8, {255, 255, 255,  13,  13,  13,  13,   8}},
-	{ 0x4128, 0xf1f8, {255, 255, 255,  13,  13,  13,  13,   8}},
-	{ 0x4130, 0xf1f8, {255, 255, 255,  15,  15,  15,  15,   8}},
+	{ 0x4110, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4110, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x4118, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4118, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x4120, 0xf1f8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x4120, 0xf1f8, {255, 255, 255, 255, 255,  13, 255,   8}},
+	{ 0x4128, 0xf1f8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x4128, 0xf1f8, {255, 255, 255, 255, 255,  13, 255,   8}},
+	{ 0x4130, 0xf1f8, {255, 255, 255,  15,  15, 255,  15, 255}},
+	{ 0x4130, 0xf1f8, {255, 255, 255, 255, 255,  15, 255,   8}},
 	{ 0x4180, 0xf1f8, { 10,  19,   8,   8,   8,   8,   8,   8}},
-	{ 0x4190, 0xf1f8, { 14,  23,  12,  12,  12,  12,  12,   8}},
-	{ 0x4198, 0xf1f8, { 14,  23,  12,  12,  12,  12,  12,   8}},
-	{ 0x41a0, 0xf1f8, { 16,  25,  14,  13,  13,  13,  13,   8}},
-	{ 0x41a8, 0xf1f8, { 18,  27,  16,  13,  13,  13,  13,   8}},
-	{ 0x41b0, 0xf1f8, { 20,  29,  18,  15,  15,  15,  15,   8}},
+	{ 0x4190, 0xf1f8, { 14,  23,  12, 255, 255, 255, 255, 255}},
+	{ 0x4190, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4190, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x4198, 0xf1f8, { 14,  23,  12, 255, 255, 255, 255, 255}},
+	{ 0x4198, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4198, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x41a0, 0xf1f8, { 16,  25,  14, 255, 255, 255, 255, 255}},
+	{ 0x41a0, 0xf1f8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x41a0, 0xf1f8, {255, 255, 255, 255, 255,  13, 255,   8}},
+	{ 0x41a8, 0xf1f8, { 18,  27,  16, 255, 255, 255, 255, 255}},
+	{ 0x41a8, 0xf1f8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x41a8, 0xf1f8, {255, 255, 255, 255, 255,  13, 255,   8}},
+	{ 0x41b0, 0xf1f8, { 20,  29,  18, 255, 255, 255, 255, 255}},
+	{ 0x41b0, 0xf1f8, {255, 255, 255,  15,  15, 255,  15, 255}},
+	{ 0x41b0, 0xf1f8, {255, 255, 255, 255, 255,  15, 255,   8}},
 	{ 0x41d0, 0xf1f8, {  4,  11,   4,   6,   6,   6,   6,   2}},
 	{ 0x41e8, 0xf1f8, {  8,  15,   8,   7,   7,   7,   7,   2}},
-	{ 0x41f0, 0xf1f8, { 12,  19,  12,   9,   9,   9,   9,   2}},
+	{ 0x41f0, 0xf1f8, { 12,  19,  12, 255, 255, 255, 255, 255}},
+	{ 0x41f0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x41f0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x5000, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x5010, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x5018, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x5020, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x5028, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x5030, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x5030, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x5030, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x5030, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x5040, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x5048, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0x5050, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x5058, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x5060, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
-	{ 0x5068, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x5070, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x5050, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x5050, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x5050, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x5058, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x5058, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x5058, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x5060, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x5060, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x5060, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x5068, 0xf1f8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x5068, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x5068, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x5070, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x5070, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x5070, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x5080, 0xf1f8, {  8,   7,   8,   2,   2,   2,   2,   2}},
 	{ 0x5088, 0xf1f8, {  8,   7,   8,   2,   2,   2,   2,   2}},
-	{ 0x5090, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x5098, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x50a0, 0xf1f8, { 22,  25,  22,   9,   9,   9,   9,   4}},
-	{ 0x50a8, 0xf1f8, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0x50b0, 0xf1f8, { 26,  29,  26,  11,  11,  11,  11,   4}},
+	{ 0x5090, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x5090, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x5090, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x5098, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x5098, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x5098, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x50a0, 0xf1f8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x50a0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x50a0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x50a8, 0xf1f8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x50a8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x50a8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x50b0, 0xf1f8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x50b0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x50b0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x5100, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x5110, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x5118, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x5120, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x5128, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x5130, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x5130, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x5130, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x5130, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x5140, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x5148, 0xf1f8, {  8,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0x5150, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x5158, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x5160, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
-	{ 0x5168, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x5170, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x5150, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x5150, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x5150, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x5158, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x5158, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x5158, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x5160, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x5160, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x5160, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x5168, 0xf1f8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x5168, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x5168, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x5170, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x5170, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x5170, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x5180, 0xf1f8, {  8,   7,   8,   2,   2,   2,   2,   2}},
 	{ 0x5188, 0xf1f8, {  8,   7,   8,   2,   2,   2,   2,   2}},
-	{ 0x5190, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x5198, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x51a0, 0xf1f8, { 22,  25,  22,   9,   9,   9,   9,   4}},
-	{ 0x51a8, 0xf1f8, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0x51b0, 0xf1f8, { 26,  29,  26,  11,  11,  11,  11,   4}},
+	{ 0x5190, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x5190, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x5190, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x5198, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x5198, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x5198, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x51a0, 0xf1f8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x51a0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x51a0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x51a8, 0xf1f8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x51a8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x51a8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x51b0, 0xf1f8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x51b0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x51b0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x8000, 0xf1f8, {  4,   4,   4,   2,   2,   2,   2,   2}},
 	{ 0x8010, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0x8018, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0x8020, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0x8028, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x8030, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x8030, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x8030, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x8030, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x8040, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0x8050, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0x8058, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0x8060, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
-	{ 0x8068, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x8070, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x8050, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x8050, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x8050, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x8058, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x8058, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x8058, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x8060, 0xf1f8, { 10,  13,  10, 255, 255, 255, 255, 255}},
+	{ 0x8060, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x8060, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x8068, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x8068, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x8068, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x8070, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x8070, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x8070, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x8080, 0xf1f8, {  8,   7,   6,   2,   2,   2,   2,   2}},
-	{ 0x8090, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0x8098, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0x80a0, 0xf1f8, { 16,  17,  16,   7,   7,   7,   7,   2}},
-	{ 0x80a8, 0xf1f8, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0x80b0, 0xf1f8, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0x8090, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0x8090, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x8090, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x8098, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0x8098, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x8098, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x80a0, 0xf1f8, { 16,  17,  16, 255, 255, 255, 255, 255}},
+	{ 0x80a0, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x80a0, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x80a8, 0xf1f8, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0x80a8, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x80a8, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x80b0, 0xf1f8, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0x80b0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x80b0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x80c0, 0xf1f8, {140, 130, 108,  44,  44,  44,  44,  44}},
-	{ 0x80d0, 0xf1f8, {144, 134, 112,  48,  48,  48,  48,  44}},
-	{ 0x80d8, 0xf1f8, {144, 134, 112,  48,  48,  48,  48,  44}},
-	{ 0x80e0, 0xf1f8, {146, 136, 114,  49,  49,  49,  49,  44}},
-	{ 0x80e8, 0xf1f8, {148, 138, 116,  49,  49,  49,  49,  44}},
-	{ 0x80f0, 0xf1f8, {150, 140, 118,  51,  51,  51,  51,  44}},
+	{ 0x80d0, 0xf1f8, {144, 134, 112, 255, 255, 255, 255, 255}},
+	{ 0x80d0, 0xf1f8, {255, 255, 255,  48,  48, 255,  48, 255}},
+	{ 0x80d0, 0xf1f8, {255, 255, 255, 255, 255,  48, 255,  44}},
+	{ 0x80d8, 0xf1f8, {144, 134, 112, 255, 255, 255, 255, 255}},
+	{ 0x80d8, 0xf1f8, {255, 255, 255,  48,  48, 255,  48, 255}},
+	{ 0x80d8, 0xf1f8, {255, 255, 255, 255, 255,  48, 255,  44}},
+	{ 0x80e0, 0xf1f8, {146, 136, 114, 255, 255, 255, 255, 255}},
+	{ 0x80e0, 0xf1f8, {255, 255, 255,  49,  49, 255,  49, 255}},
+	{ 0x80e0, 0xf1f8, {255, 255, 255, 255, 255,  49, 255,  44}},
+	{ 0x80e8, 0xf1f8, {148, 138, 116, 255, 255, 255, 255, 255}},
+	{ 0x80e8, 0xf1f8, {255, 255, 255,  49,  49, 255,  49, 255}},
+	{ 0x80e8, 0xf1f8, {255, 255, 255, 255, 255,  49, 255,  44}},
+	{ 0x80f0, 0xf1f8, {150, 140, 118, 255, 255, 255, 255, 255}},
+	{ 0x80f0, 0xf1f8, {255, 255, 255,  51,  51, 255,  51, 255}},
+	{ 0x80f0, 0xf1f8, {255, 255, 255, 255, 255,  51, 255,  44}},
 	{ 0x8100, 0xf1f8, {  6,  10,   6,   4,   4,   4,   4,   4}},
 	{ 0x8108, 0xf1f8, { 18,  31,  18,  16,  16,  16,  16,  16}},
 	{ 0x8110, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x8118, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x8120, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x8128, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x8130, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x8130, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x8130, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x8130, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x8140, 0xf1f8, {255, 255, 255,   6,   6,   6,   6,   6}},
 	{ 0x8148, 0xf1f8, {255, 255, 255,  13,  13,  13,  13,  13}},
-	{ 0x8150, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x8158, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x8160, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
-	{ 0x8168, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x8170, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x8150, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x8150, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x8150, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x8158, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x8158, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x8158, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x8160, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x8160, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x8160, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x8168, 0xf1f8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x8168, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x8168, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x8170, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x8170, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x8170, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x8180, 0xf1f8, {255, 255, 255,   8,   8,   8,   8,   8}},
 	{ 0x8188, 0xf1f8, {255, 255, 255,  13,  13,  13,  13,  13}},
-	{ 0x8190, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x8198, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x81a0, 0xf1f8, { 22,  25,  22,   9,   9,   9,   9,   4}},
-	{ 0x81a8, 0xf1f8, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0x81b0, 0xf1f8, { 26,  29,  26,  11,  11,  11,  11,   4}},
+	{ 0x8190, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x8190, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x8190, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x8198, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x8198, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x8198, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x81a0, 0xf1f8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x81a0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x81a0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x81a8, 0xf1f8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x81a8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x81a8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x81b0, 0xf1f8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x81b0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x81b0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x81c0, 0xf1f8, {158, 169, 122,  56,  56,  56,  56,  56}},
-	{ 0x81d0, 0xf1f8, {162, 173, 126,  60,  60,  60,  60,  56}},
-	{ 0x81d8, 0xf1f8, {162, 173, 126,  60,  60,  60,  60,  56}},
-	{ 0x81e0, 0xf1f8, {164, 175, 128,  61,  61,  61,  61,  56}},
-	{ 0x81e8, 0xf1f8, {166, 177, 130,  61,  61,  61,  61,  56}},
-	{ 0x81f0, 0xf1f8, {168, 179, 132,  63,  63,  63,  63,  56}},
+	{ 0x81d0, 0xf1f8, {162, 173, 126, 255, 255, 255, 255, 255}},
+	{ 0x81d0, 0xf1f8, {255, 255, 255,  60,  60, 255,  60, 255}},
+	{ 0x81d0, 0xf1f8, {255, 255, 255, 255, 255,  60, 255,  56}},
+	{ 0x81d8, 0xf1f8, {162, 173, 126, 255, 255, 255, 255, 255}},
+	{ 0x81d8, 0xf1f8, {255, 255, 255,  60,  60, 255,  60, 255}},
+	{ 0x81d8, 0xf1f8, {255, 255, 255, 255, 255,  60, 255,  56}},
+	{ 0x81e0, 0xf1f8, {164, 175, 128, 255, 255, 255, 255, 255}},
+	{ 0x81e0, 0xf1f8, {255, 255, 255,  61,  61, 255,  61, 255}},
+	{ 0x81e0, 0xf1f8, {255, 255, 255, 255, 255,  61, 255,  56}},
+	{ 0x81e8, 0xf1f8, {166, 177, 130, 255, 255, 255, 255, 255}},
+	{ 0x81e8, 0xf1f8, {255, 255, 255,  61,  61, 255,  61, 255}},
+	{ 0x81e8, 0xf1f8, {255, 255, 255, 255, 255,  61, 255,  56}},
+	{ 0x81f0, 0xf1f8, {168, 179, 132, 255, 255, 255, 255, 255}},
+	{ 0x81f0, 0xf1f8, {255, 255, 255,  63,  63, 255,  63, 255}},
+	{ 0x81f0, 0xf1f8, {255, 255, 255, 255, 255,  63, 255,  56}},
 	{ 0x9000, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x9010, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0x9018, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0x9020, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0x9028, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x9030, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x9030, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x9030, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x9030, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x9040, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x9048, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0x9050, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0x9058, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0x9060, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
-	{ 0x9068, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x9070, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x9050, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x9050, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x9050, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x9058, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x9058, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x9058, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x9060, 0xf1f8, { 10,  13,  10, 255, 255, 255, 255, 255}},
+	{ 0x9060, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x9060, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x9068, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x9068, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x9068, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x9070, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x9070, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x9070, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x9080, 0xf1f8, {  8,   7,   6,   2,   2,   2,   2,   2}},
 	{ 0x9088, 0xf1f8, {  8,   7,   6,   2,   2,   2,   2,   2}},
-	{ 0x9090, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0x9098, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0x90a0, 0xf1f8, { 16,  17,  16,   7,   7,   7,   7,   2}},
-	{ 0x90a8, 0xf1f8, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0x90b0, 0xf1f8, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0x9090, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0x9090, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x9090, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x9098, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0x9098, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x9098, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x90a0, 0xf1f8, { 16,  17,  16, 255, 255, 255, 255, 255}},
+	{ 0x90a0, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x90a0, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x90a8, 0xf1f8, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0x90a8, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x90a8, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x90b0, 0xf1f8, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0x90b0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x90b0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x90c0, 0xf1f8, {  8,   7,   8,   2,   2,   2,   2,   2}},
 	{ 0x90c8, 0xf1f8, {  8,   7,   8,   2,   2,   2,   2,   2}},
-	{ 0x90d0, 0xf1f8, { 12,  11,  12,   6,   6,   6,   6,   2}},
-	{ 0x90d8, 0xf1f8, { 12,  11,  12,   6,   6,   6,   6,   2}},
-	{ 0x90e0, 0xf1f8, { 14,  13,  14,   7,   7,   7,   7,   2}},
-	{ 0x90e8, 0xf1f8, { 16,  15,  16,   7,   7,   7,   7,   2}},
-	{ 0x90f0, 0xf1f8, { 18,  17,  18,   9,   9,   9,   9,   2}},
+	{ 0x90d0, 0xf1f8, { 12,  11,  12, 255, 255, 255, 255, 255}},
+	{ 0x90d0, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x90d0, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x90d8, 0xf1f8, { 12,  11,  12, 255, 255, 255, 255, 255}},
+	{ 0x90d8, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x90d8, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x90e0, 0xf1f8, { 14,  13,  14, 255, 255, 255, 255, 255}},
+	{ 0x90e0, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x90e0, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x90e8, 0xf1f8, { 16,  15,  16, 255, 255, 255, 255, 255}},
+	{ 0x90e8, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x90e8, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x90f0, 0xf1f8, { 18,  17,  18, 255, 255, 255, 255, 255}},
+	{ 0x90f0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x90f0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x9100, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x9108, 0xf1f8, { 18,  28,  18,  12,  12,  12,  12,  12}},
 	{ 0x9110, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x9118, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x9120, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x9128, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x9130, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x9130, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x9130, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x9130, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x9140, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0x9148, 0xf1f8, { 18,  28,  18,  12,  12,  12,  12,  12}},
-	{ 0x9150, 0xf1f8, { 12,  19,  12,   8,   8,   8,   8,   4}},
-	{ 0x9158, 0xf1f8, { 12,  19,  12,   8,   8,   8,   8,   4}},
-	{ 0x9160, 0xf1f8, { 14,  21,  14,   9,   9,   9,   9,   4}},
-	{ 0x9168, 0xf1f8, { 16,  23,  16,   9,   9,   9,   9,   4}},
-	{ 0x9170, 0xf1f8, { 18,  25,  18,  11,  11,  11,  11,   4}},
+	{ 0x9148, 0xf1f8, { 18,  28,  18, 255, 255, 255, 255, 255}},
+	{ 0x9148, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x9148, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,  12}},
+	{ 0x9150, 0xf1f8, { 12,  19,  12, 255, 255, 255, 255, 255}},
+	{ 0x9150, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x9150, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x9158, 0xf1f8, { 12,  19,  12, 255, 255, 255, 255, 255}},
+	{ 0x9158, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x9158, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x9160, 0xf1f8, { 14,  21,  14, 255, 255, 255, 255, 255}},
+	{ 0x9160, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x9160, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x9168, 0xf1f8, { 16,  23,  16, 255, 255, 255, 255, 255}},
+	{ 0x9168, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x9168, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x9170, 0xf1f8, { 18,  25,  18, 255, 255, 255, 255, 255}},
+	{ 0x9170, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x9170, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x9180, 0xf1f8, {  8,   7,   6,   2,   2,   2,   2,   2}},
-	{ 0x9188, 0xf1f8, { 30,  40,  30,  12,  12,  12,  12,  12}},
-	{ 0x9190, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x9198, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x91a0, 0xf1f8, { 22,  25,  22,   9,   9,   9,   9,   4}},
-	{ 0x91a8, 0xf1f8, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0x91b0, 0xf1f8, { 26,  29,  26,  11,  11,  11,  11,   4}},
+	{ 0x9188, 0xf1f8, { 30,  40,  30, 255, 255, 255, 255, 255}},
+	{ 0x9188, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x9188, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,  12}},
+	{ 0x9190, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x9190, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x9190, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x9198, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x9198, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x9198, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x91a0, 0xf1f8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x91a0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x91a0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x91a8, 0xf1f8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x91a8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x91a8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x91b0, 0xf1f8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x91b0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x91b0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x91c0, 0xf1f8, {  8,   9,   6,   2,   2,   2,   2,   2}},
 	{ 0x91c8, 0xf1f8, {  8,   9,   6,   2,   2,   2,   2,   2}},
-	{ 0x91d0, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0x91d8, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0x91e0, 0xf1f8, { 16,  17,  16,   7,   7,   7,   7,   2}},
-	{ 0x91e8, 0xf1f8, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0x91f0, 0xf1f8, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0x91d0, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0x91d0, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x91d0, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x91d8, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0x91d8, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x91d8, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x91e0, 0xf1f8, { 16,  17,  16, 255, 255, 255, 255, 255}},
+	{ 0x91e0, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x91e0, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x91e8, 0xf1f8, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0x91e8, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x91e8, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x91f0, 0xf1f8, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0x91f0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x91f0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xb000, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0xb010, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0xb018, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0xb020, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0xb028, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0xb030, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0xb030, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xb030, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb030, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xb040, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0xb048, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0xb050, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0xb058, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0xb060, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
-	{ 0xb068, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0xb070, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0xb050, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0xb050, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xb050, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xb058, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0xb058, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xb058, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xb060, 0xf1f8, { 10,  13,  10, 255, 255, 255, 255, 255}},
+	{ 0xb060, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xb060, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xb068, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0xb068, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xb068, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xb070, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xb070, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb070, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xb080, 0xf1f8, {  6,   7,   6,   2,   2,   2,   2,   2}},
 	{ 0xb088, 0xf1f8, {  6,   7,   6,   2,   2,   2,   2,   2}},
-	{ 0xb090, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0xb098, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0xb0a0, 0xf1f8, { 16,  17,  16,   7,   7,   7,   7,   2}},
-	{ 0xb0a8, 0xf1f8, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0xb0b0, 0xf1f8, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0xb090, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0xb090, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xb090, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xb098, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0xb098, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xb098, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xb0a0, 0xf1f8, { 16,  17,  16, 255, 255, 255, 255, 255}},
+	{ 0xb0a0, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xb0a0, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xb0a8, 0xf1f8, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0xb0a8, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xb0a8, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xb0b0, 0xf1f8, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0xb0b0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb0b0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xb0c0, 0xf1f8, {  6,   7,   6,   4,   4,   4,   4,   4}},
 	{ 0xb0c8, 0xf1f8, {  6,   7,   6,   4,   4,   4,   4,   4}},
-	{ 0xb0d0, 0xf1f8, { 10,  11,  10,   8,   8,   8,   8,   4}},
-	{ 0xb0d8, 0xf1f8, { 10,  11,  10,   8,   8,   8,   8,   4}},
-	{ 0xb0e0, 0xf1f8, { 12,  13,  12,   9,   9,   9,   9,   4}},
-	{ 0xb0e8, 0xf1f8, { 14,  15,  14,   9,   9,   9,   9,   4}},
-	{ 0xb0f0, 0xf1f8, { 16,  17,  16,  11,  11,  11,  11,   4}},
+	{ 0xb0d0, 0xf1f8, { 10,  11,  10, 255, 255, 255, 255, 255}},
+	{ 0xb0d0, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb0d0, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb0d8, 0xf1f8, { 10,  11,  10, 255, 255, 255, 255, 255}},
+	{ 0xb0d8, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb0d8, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb0e0, 0xf1f8, { 12,  13,  12, 255, 255, 255, 255, 255}},
+	{ 0xb0e0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb0e0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xb0e8, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0xb0e8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb0e8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xb0f0, 0xf1f8, { 16,  17,  16, 255, 255, 255, 255, 255}},
+	{ 0xb0f0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xb0f0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xb100, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0xb108, 0xf1f8, { 12,  18,  12,   9,   9,   9,   9,   9}},
 	{ 0xb110, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0xb118, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0xb120, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0xb128, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0xb130, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0xb130, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0xb130, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xb130, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xb140, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0xb148, 0xf1f8, { 12,  18,  12,   9,   9,   9,   9,   9}},
-	{ 0xb150, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0xb158, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0xb160, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
-	{ 0xb168, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0xb170, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0xb148, 0xf1f8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xb148, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb148, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   9}},
+	{ 0xb150, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0xb150, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb150, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb158, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0xb158, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb158, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb160, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xb160, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb160, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xb168, 0xf1f8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0xb168, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb168, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xb170, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0xb170, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xb170, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xb180, 0xf1f8, {  8,   7,   6,   2,   2,   2,   2,   2}},
-	{ 0xb188, 0xf1f8, { 20,  26,  20,   9,   9,   9,   9,   9}},
-	{ 0xb190, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0xb198, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0xb1a0, 0xf1f8, { 22,  25,  22,   9,   9,   9,   9,   4}},
-	{ 0xb1a8, 0xf1f8, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0xb1b0, 0xf1f8, { 26,  29,  26,  11,  11,  11,  11,   4}},
+	{ 0xb188, 0xf1f8, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0xb188, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb188, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   9}},
+	{ 0xb190, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0xb190, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb190, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb198, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0xb198, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb198, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb1a0, 0xf1f8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0xb1a0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb1a0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xb1a8, 0xf1f8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0xb1a8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb1a8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xb1b0, 0xf1f8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0xb1b0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xb1b0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xb1c0, 0xf1f8, {  6,   7,   6,   4,   4,   4,   4,   4}},
 	{ 0xb1c8, 0xf1f8, {  6,   7,   6,   4,   4,   4,   4,   4}},
-	{ 0xb1d0, 0xf1f8, { 14,  15,  14,   8,   8,   8,   8,   4}},
-	{ 0xb1d8, 0xf1f8, { 14,  15,  14,   8,   8,   8,   8,   4}},
-	{ 0xb1e0, 0xf1f8, { 16,  17,  16,   9,   9,   9,   9,   4}},
-	{ 0xb1e8, 0xf1f8, { 18,  19,  18,   9,   9,   9,   9,   4}},
-	{ 0xb1f0, 0xf1f8, { 20,  21,  20,  11,  11,  11,  11,   4}},
+	{ 0xb1d0, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0xb1d0, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb1d0, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb1d8, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0xb1d8, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb1d8, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb1e0, 0xf1f8, { 16,  17,  16, 255, 255, 255, 255, 255}},
+	{ 0xb1e0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb1e0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xb1e8, 0xf1f8, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0xb1e8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb1e8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xb1f0, 0xf1f8, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0xb1f0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xb1f0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xc000, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0xc010, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0xc018, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0xc020, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0xc028, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0xc030, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0xc030, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xc030, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xc030, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xc040, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0xc050, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0xc058, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0xc060, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
-	{ 0xc068, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0xc070, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0xc050, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0xc050, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xc050, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xc058, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0xc058, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xc058, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xc060, 0xf1f8, { 10,  13,  10, 255, 255, 255, 255, 255}},
+	{ 0xc060, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xc060, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xc068, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0xc068, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xc068, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xc070, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xc070, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xc070, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xc080, 0xf1f8, {  8,   7,   6,   2,   2,   2,   2,   2}},
-	{ 0xc090, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0xc098, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0xc0a0, 0xf1f8, { 16,  17,  16,   7,   7,   7,   7,   2}},
-	{ 0xc0a8, 0xf1f8, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0xc0b0, 0xf1f8, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0xc090, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0xc090, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xc090, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xc098, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0xc098, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xc098, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xc0a0, 0xf1f8, { 16,  17,  16, 255, 255, 255, 255, 255}},
+	{ 0xc0a0, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xc0a0, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xc0a8, 0xf1f8, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0xc0a8, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xc0a8, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xc0b0, 0xf1f8, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0xc0b0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xc0b0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xc0c0, 0xf1f8, { 54,  76,  30,  27,  27,  27,  27,  27}},
-	{ 0xc0d0, 0xf1f8, { 58,  80,  34,  31,  31,  31,  31,  27}},
-	{ 0xc0d8, 0xf1f8, { 58,  80,  34,  31,  31,  31,  31,  27}},
-	{ 0xc0e0, 0xf1f8, { 60,  82,  36,  32,  32,  32,  32,  27}},
-	{ 0xc0e8, 0xf1f8, { 62,  84,  38,  32,  32,  32,  32,  27}},
-	{ 0xc0f0, 0xf1f8, { 64,  86,  40,  34,  34,  34,  34,  27}},
+	{ 0xc0d0, 0xf1f8, { 58,  80,  34, 255, 255, 255, 255, 255}},
+	{ 0xc0d0, 0xf1f8, {255, 255, 255,  31,  31, 255,  31, 255}},
+	{ 0xc0d0, 0xf1f8, {255, 255, 255, 255, 255,  31, 255,  27}},
+	{ 0xc0d8, 0xf1f8, { 58,  80,  34, 255, 255, 255, 255, 255}},
+	{ 0xc0d8, 0xf1f8, {255, 255, 255,  31,  31, 255,  31, 255}},
+	{ 0xc0d8, 0xf1f8, {255, 255, 255, 255, 255,  31, 255,  27}},
+	{ 0xc0e0, 0xf1f8, { 60,  82,  36, 255, 255, 255, 255, 255}},
+	{ 0xc0e0, 0xf1f8, {255, 255, 255,  32,  32, 255,  32, 255}},
+	{ 0xc0e0, 0xf1f8, {255, 255, 255, 255, 255,  32, 255,  27}},
+	{ 0xc0e8, 0xf1f8, { 62,  84,  38, 255, 255, 255, 255, 255}},
+	{ 0xc0e8, 0xf1f8, {255, 255, 255,  32,  32, 255,  32, 255}},
+	{ 0xc0e8, 0xf1f8, {255, 255, 255, 255, 255,  32, 255,  27}},
+	{ 0xc0f0, 0xf1f8, { 64,  86,  40, 255, 255, 255, 255, 255}},
+	{ 0xc0f0, 0xf1f8, {255, 255, 255,  34,  34, 255,  34, 255}},
+	{ 0xc0f0, 0xf1f8, {255, 255, 255, 255, 255,  34, 255,  27}},
 	{ 0xc100, 0xf1f8, {  6,  10,   6,   4,   4,   4,   4,   4}},
 	{ 0xc108, 0xf1f8, { 18,  31,  18,  16,  16,  16,  16,  16}},
 	{ 0xc110, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0xc118, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0xc120, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0xc128, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0xc130, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0xc130, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0xc130, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xc130, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xc140, 0xf1f8, {  6,  13,   6,   2,   2,   2,   2,   2}},
 	{ 0xc148, 0xf1f8, {  6,  13,   6,   2,   2,   2,   2,   2}},
-	{ 0xc150, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0xc158, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0xc160, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
-	{ 0xc168, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0xc170, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0xc150, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0xc150, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xc150, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xc158, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0xc158, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xc158, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xc160, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xc160, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xc160, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xc168, 0xf1f8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0xc168, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xc168, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xc170, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0xc170, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xc170, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xc188, 0xf1f8, {  6,  13,   6,   2,   2,   2,   2,   2}},
-	{ 0xc190, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0xc198, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0xc1a0, 0xf1f8, { 22,  25,  22,   9,   9,   9,   9,   4}},
-	{ 0xc1a8, 0xf1f8, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0xc1b0, 0xf1f8, { 26,  29,  26,  11,  11,  11,  11,   4}},
+	{ 0xc190, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0xc190, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xc190, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xc198, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0xc198, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xc198, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xc1a0, 0xf1f8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0xc1a0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xc1a0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xc1a8, 0xf1f8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0xc1a8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xc1a8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xc1b0, 0xf1f8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0xc1b0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xc1b0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xc1c0, 0xf1f8, { 54,  76,  32,  27,  27,  27,  27,  27}},
-	{ 0xc1d0, 0xf1f8, { 58,  80,  36,  31,  31,  31,  31,  27}},
-	{ 0xc1d8, 0xf1f8, { 58,  80,  36,  31,  31,  31,  31,  27}},
-	{ 0xc1e0, 0xf1f8, { 60,  82,  38,  32,  32,  32,  32,  27}},
-	{ 0xc1e8, 0xf1f8, { 62,  84,  40,  32,  32,  32,  32,  27}},
-	{ 0xc1f0, 0xf1f8, { 64,  86,  42,  34,  34,  34,  34,  27}},
+	{ 0xc1d0, 0xf1f8, { 58,  80,  36, 255, 255, 255, 255, 255}},
+	{ 0xc1d0, 0xf1f8, {255, 255, 255,  31,  31, 255,  31, 255}},
+	{ 0xc1d0, 0xf1f8, {255, 255, 255, 255, 255,  31, 255,  27}},
+	{ 0xc1d8, 0xf1f8, { 58,  80,  36, 255, 255, 255, 255, 255}},
+	{ 0xc1d8, 0xf1f8, {255, 255, 255,  31,  31, 255,  31, 255}},
+	{ 0xc1d8, 0xf1f8, {255, 255, 255, 255, 255,  31, 255,  27}},
+	{ 0xc1e0, 0xf1f8, { 60,  82,  38, 255, 255, 255, 255, 255}},
+	{ 0xc1e0, 0xf1f8, {255, 255, 255,  32,  32, 255,  32, 255}},
+	{ 0xc1e0, 0xf1f8, {255, 255, 255, 255, 255,  32, 255,  27}},
+	{ 0xc1e8, 0xf1f8, { 62,  84,  40, 255, 255, 255, 255, 255}},
+	{ 0xc1e8, 0xf1f8, {255, 255, 255,  32,  32, 255,  32, 255}},
+	{ 0xc1e8, 0xf1f8, {255, 255, 255, 255, 255,  32, 255,  27}},
+	{ 0xc1f0, 0xf1f8, { 64,  86,  42, 255, 255, 255, 255, 255}},
+	{ 0xc1f0, 0xf1f8, {255, 255, 255,  34,  34, 255,  34, 255}},
+	{ 0xc1f0, 0xf1f8, {255, 255, 255, 255, 255,  34, 255,  27}},
 	{ 0xd000, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0xd010, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0xd018, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0xd020, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0xd028, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0xd030, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0xd030, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xd030, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd030, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xd040, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0xd048, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0xd050, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0xd058, 0xf1f8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0xd060, 0xf1f8, { 10,  13,  10,   7,   7,   7,   7,   2}},
-	{ 0xd068, 0xf1f8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0xd070, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0xd050, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0xd050, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd050, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xd058, 0xf1f8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0xd058, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd058, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xd060, 0xf1f8, { 10,  13,  10, 255, 255, 255, 255, 255}},
+	{ 0xd060, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xd060, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xd068, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0xd068, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xd068, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xd070, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xd070, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd070, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xd080, 0xf1f8, {  8,   7,   6,   2,   2,   2,   2,   2}},
 	{ 0xd088, 0xf1f8, {  8,   7,   6,   2,   2,   2,   2,   2}},
-	{ 0xd090, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0xd098, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0xd0a0, 0xf1f8, { 16,  17,  16,   7,   7,   7,   7,   2}},
-	{ 0xd0a8, 0xf1f8, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0xd0b0, 0xf1f8, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0xd090, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0xd090, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd090, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xd098, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0xd098, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd098, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xd0a0, 0xf1f8, { 16,  17,  16, 255, 255, 255, 255, 255}},
+	{ 0xd0a0, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xd0a0, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xd0a8, 0xf1f8, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0xd0a8, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xd0a8, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xd0b0, 0xf1f8, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0xd0b0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd0b0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xd0c0, 0xf1f8, {  8,   7,   8,   2,   2,   2,   2,   2}},
 	{ 0xd0c8, 0xf1f8, {  8,   7,   8,   2,   2,   2,   2,   2}},
-	{ 0xd0d0, 0xf1f8, { 12,  11,  12,   6,   6,   6,   6,   2}},
-	{ 0xd0d8, 0xf1f8, { 12,  11,  12,   6,   6,   6,   6,   2}},
-	{ 0xd0e0, 0xf1f8, { 14,  13,  14,   7,   7,   7,   7,   2}},
-	{ 0xd0e8, 0xf1f8, { 16,  15,  16,   7,   7,   7,   7,   2}},
-	{ 0xd0f0, 0xf1f8, { 18,  17,  18,   9,   9,   9,   9,   2}},
+	{ 0xd0d0, 0xf1f8, { 12,  11,  12, 255, 255, 255, 255, 255}},
+	{ 0xd0d0, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd0d0, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xd0d8, 0xf1f8, { 12,  11,  12, 255, 255, 255, 255, 255}},
+	{ 0xd0d8, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd0d8, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xd0e0, 0xf1f8, { 14,  13,  14, 255, 255, 255, 255, 255}},
+	{ 0xd0e0, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xd0e0, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xd0e8, 0xf1f8, { 16,  15,  16, 255, 255, 255, 255, 255}},
+	{ 0xd0e8, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xd0e8, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xd0f0, 0xf1f8, { 18,  17,  18, 255, 255, 255, 255, 255}},
+	{ 0xd0f0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd0f0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xd100, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0xd108, 0xf1f8, { 18,  28,  18,  12,  12,  12,  12,  12}},
 	{ 0xd110, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0xd118, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0xd120, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0xd128, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0xd130, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0xd130, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0xd130, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xd130, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xd140, 0xf1f8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0xd148, 0xf1f8, { 18,  28,  18,  12,  12,  12,  12,  12}},
-	{ 0xd150, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0xd158, 0xf1f8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0xd160, 0xf1f8, { 14,  17,  14,   9,   9,   9,   9,   4}},
-	{ 0xd168, 0xf1f8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0xd170, 0xf1f8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0xd148, 0xf1f8, { 18,  28,  18, 255, 255, 255, 255, 255}},
+	{ 0xd148, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0xd148, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,  12}},
+	{ 0xd150, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0xd150, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xd150, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xd158, 0xf1f8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0xd158, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xd158, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xd160, 0xf1f8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xd160, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd160, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xd168, 0xf1f8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0xd168, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd168, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xd170, 0xf1f8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0xd170, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xd170, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xd180, 0xf1f8, {  8,   7,   6,   2,   2,   2,   2,   2}},
-	{ 0xd188, 0xf1f8, { 30,  40,  30,  12,  12,  12,  12,  12}},
-	{ 0xd190, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0xd198, 0xf1f8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0xd1a0, 0xf1f8, { 22,  25,  22,   9,   9,   9,   9,   4}},
-	{ 0xd1a8, 0xf1f8, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0xd1b0, 0xf1f8, { 26,  29,  26,  11,  11,  11,  11,   4}},
+	{ 0xd188, 0xf1f8, { 30,  40,  30, 255, 255, 255, 255, 255}},
+	{ 0xd188, 0xf1f8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0xd188, 0xf1f8, {255, 255, 255, 255, 255,  12, 255,  12}},
+	{ 0xd190, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0xd190, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xd190, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xd198, 0xf1f8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0xd198, 0xf1f8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xd198, 0xf1f8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xd1a0, 0xf1f8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0xd1a0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd1a0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xd1a8, 0xf1f8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0xd1a8, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd1a8, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0xd1b0, 0xf1f8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0xd1b0, 0xf1f8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xd1b0, 0xf1f8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xd1c0, 0xf1f8, {  8,   9,   6,   2,   2,   2,   2,   2}},
 	{ 0xd1c8, 0xf1f8, {  8,   9,   6,   2,   2,   2,   2,   2}},
-	{ 0xd1d0, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0xd1d8, 0xf1f8, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0xd1e0, 0xf1f8, { 16,  17,  16,   7,   7,   7,   7,   2}},
-	{ 0xd1e8, 0xf1f8, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0xd1f0, 0xf1f8, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0xd1d0, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0xd1d0, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd1d0, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xd1d8, 0xf1f8, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0xd1d8, 0xf1f8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd1d8, 0xf1f8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xd1e0, 0xf1f8, { 16,  17,  16, 255, 255, 255, 255, 255}},
+	{ 0xd1e0, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xd1e0, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xd1e8, 0xf1f8, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0xd1e8, 0xf1f8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0xd1e8, 0xf1f8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0xd1f0, 0xf1f8, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0xd1f0, 0xf1f8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd1f0, 0xf1f8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xe000, 0xf1f8, {  6,  13,   6,   6,   6,   6,   6,   6}},
 	{ 0xe008, 0xf1f8, {  6,  13,   6,   4,   4,   4,   4,   4}},
 	{ 0xe010, 0xf1f8, {  6,  13,   6,  12,  12,  12,  12,  12}},
@@ -33921,7 +37420,9 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x0138, 0xf1ff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x0139, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x013a, 0xf1ff, { 12,  15,  12,   9,   9,   9,   9,   4}},
-	{ 0x013b, 0xf1ff, { 14,  17,  14,  11,  11,  11,  11,   4}},
+	{ 0x013b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x013b, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x013b, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x013c, 0xf1ff, {  8,  11,   8,   6,   6,   6,   6,   4}},
 	{ 0x015f, 0xf1ff, { 12,  18,  12,   8,   8,   8,   8,   4}},
 	{ 0x0167, 0xf1ff, { 14,  20,  14,   9,   9,   9,   9,   4}},
@@ -33940,164 +37441,359 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x1038, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
 	{ 0x1039, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
 	{ 0x103a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x103b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x103b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x103b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x103b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x103c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
 	{ 0x109f, 0xf1ff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x10a7, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x10b8, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x10b9, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
 	{ 0x10ba, 0xf1ff, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x10bb, 0xf1ff, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x10bb, 0xf1ff, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x10bb, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x10bb, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x10bc, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   4}},
 	{ 0x10df, 0xf1ff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x10e7, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x10f8, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x10f9, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
 	{ 0x10fa, 0xf1ff, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x10fb, 0xf1ff, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x10fb, 0xf1ff, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x10fb, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x10fb, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x10fc, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   4}},
 	{ 0x111f, 0xf1ff, { 12,  18,  12,   9,   9,   9,   9,   5}},
 	{ 0x1127, 0xf1ff, { 14,  20,  14,  10,  10,  10,  10,   5}},
 	{ 0x1138, 0xf1ff, { 16,  22,  16,   9,   9,   9,   9,   5}},
 	{ 0x1139, 0xf1ff, { 20,  26,  20,   9,   9,   9,   9,   5}},
 	{ 0x113a, 0xf1ff, { 16,  22,  16,  10,  10,  10,  10,   5}},
-	{ 0x113b, 0xf1ff, { 18,  24,  18,  12,  12,  12,  12,   5}},
+	{ 0x113b, 0xf1ff, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x113b, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x113b, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   5}},
 	{ 0x113c, 0xf1ff, { 12,  18,  12,   7,   7,   7,   7,   5}},
 	{ 0x115f, 0xf1ff, { 16,  22,  16,   9,   9,   9,   9,   5}},
 	{ 0x1167, 0xf1ff, { 18,  24,  18,  10,  10,  10,  10,   5}},
 	{ 0x1178, 0xf1ff, { 20,  26,  20,   9,   9,   9,   9,   5}},
 	{ 0x1179, 0xf1ff, { 24,  30,  24,   9,   9,   9,   9,   5}},
 	{ 0x117a, 0xf1ff, { 20,  26,  20,  10,  10,  10,  10,   5}},
-	{ 0x117b, 0xf1ff, { 22,  28,  22,  12,  12,  12,  12,   5}},
+	{ 0x117b, 0xf1ff, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x117b, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x117b, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   5}},
 	{ 0x117c, 0xf1ff, { 16,  22,  16,   7,   7,   7,   7,   5}},
-	{ 0x119f, 0xf1ff, { 18,  25,  18,  11,  11,  11,  11,   7}},
-	{ 0x11a7, 0xf1ff, { 20,  27,  20,  12,  12,  12,  12,   7}},
-	{ 0x11b8, 0xf1ff, { 22,  29,  22,  11,  11,  11,  11,   7}},
-	{ 0x11b9, 0xf1ff, { 26,  33,  26,  11,  11,  11,  11,   7}},
-	{ 0x11ba, 0xf1ff, { 22,  29,  22,  12,  12,  12,  12,   7}},
-	{ 0x11bb, 0xf1ff, { 24,  31,  24,  14,  14,  14,  14,   7}},
-	{ 0x11bc, 0xf1ff, { 18,  25,  18,   9,   9,   9,   9,   7}},
-	{ 0x2038, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
-	{ 0x2039, 0xf1ff, { 20,  23,  20,   6,   6,   6,   6,   2}},
+	{ 0x119f, 0xf1ff, { 18,  25,  18, 255, 255, 255, 255, 255}},
+	{ 0x119f, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x119f, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x11a7, 0xf1ff, { 20,  27,  20, 255, 255, 255, 255, 255}},
+	{ 0x11a7, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x11a7, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0x11b8, 0xf1ff, { 22,  29,  22, 255, 255, 255, 255, 255}},
+	{ 0x11b8, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x11b8, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x11b9, 0xf1ff, { 26,  33,  26, 255, 255, 255, 255, 255}},
+	{ 0x11b9, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x11b9, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x11ba, 0xf1ff, { 22,  29,  22, 255, 255, 255, 255, 255}},
+	{ 0x11ba, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x11ba, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0x11bb, 0xf1ff, { 24,  31,  24, 255, 255, 255, 255, 255}},
+	{ 0x11bb, 0xf1ff, {255, 255, 255,  14,  14, 255,  14, 255}},
+	{ 0x11bb, 0xf1ff, {255, 255, 255, 255, 255,  14, 255,   7}},
+	{ 0x11bc, 0xf1ff, { 18,  25,  18, 255, 255, 255, 255, 255}},
+	{ 0x11bc, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x11bc, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   7}},
+	{ 0x2038, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x2038, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x2038, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x2039, 0xf1ff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x2039, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x2039, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x203a, 0xf1ff, { 16,  19,  16,   7,   7,   7,   7,   2}},
-	{ 0x203b, 0xf1ff, { 18,  21,  18,   9,   9,   9,   9,   2}},
+	{ 0x203b, 0xf1ff, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x203b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x203b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x203c, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x2078, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
-	{ 0x2079, 0xf1ff, { 20,  23,  20,   6,   6,   6,   6,   2}},
+	{ 0x2078, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x2078, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x2078, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x2079, 0xf1ff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x2079, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x2079, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x207a, 0xf1ff, { 16,  19,  16,   7,   7,   7,   7,   2}},
-	{ 0x207b, 0xf1ff, { 18,  21,  18,   9,   9,   9,   9,   2}},
+	{ 0x207b, 0xf1ff, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x207b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x207b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x207c, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x20b8, 0xf1ff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x20b9, 0xf1ff, { 28,  31,  28,   8,   8,   8,   8,   4}},
-	{ 0x20ba, 0xf1ff, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0x20bb, 0xf1ff, { 26,  29,  26,  11,  11,  11,  11,   4}},
-	{ 0x20bc, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x20f8, 0xf1ff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x20f9, 0xf1ff, { 28,  31,  28,   8,   8,   8,   8,   4}},
-	{ 0x20fa, 0xf1ff, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0x20fb, 0xf1ff, { 26,  29,  26,  11,  11,  11,  11,   4}},
-	{ 0x20fc, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x2138, 0xf1ff, { 24,  30,  26,   9,   9,   9,   9,   5}},
-	{ 0x2139, 0xf1ff, { 28,  34,  30,   9,   9,   9,   9,   5}},
-	{ 0x213a, 0xf1ff, { 24,  30,  26,  10,  10,  10,  10,   5}},
-	{ 0x213b, 0xf1ff, { 26,  32,  28,  12,  12,  12,  12,   5}},
-	{ 0x213c, 0xf1ff, { 20,  26,  22,   9,   9,   9,   9,   5}},
-	{ 0x2178, 0xf1ff, { 28,  34,  28,   9,   9,   9,   9,   5}},
-	{ 0x2179, 0xf1ff, { 32,  38,  32,   9,   9,   9,   9,   5}},
-	{ 0x217a, 0xf1ff, { 28,  34,  28,  10,  10,  10,  10,   5}},
-	{ 0x217b, 0xf1ff, { 30,  36,  30,  12,  12,  12,  12,   5}},
-	{ 0x217c, 0xf1ff, { 24,  30,  24,   9,   9,   9,   9,   5}},
-	{ 0x21b8, 0xf1ff, { 30,  37,  30,  11,  11,  11,  11,   7}},
-	{ 0x21b9, 0xf1ff, { 34,  41,  34,  11,  11,  11,  11,   7}},
-	{ 0x21ba, 0xf1ff, { 30,  37,  30,  12,  12,  12,  12,   7}},
-	{ 0x21bb, 0xf1ff, { 32,  39,  32,  14,  14,  14,  14,   7}},
-	{ 0x21bc, 0xf1ff, { 26,  33,  26,  11,  11,  11,  11,   7}},
-	{ 0x3038, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x3039, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
+	{ 0x20b8, 0xf1ff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x20b8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x20b8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x20b9, 0xf1ff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x20b9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x20b9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x20ba, 0xf1ff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x20ba, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x20ba, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x20bb, 0xf1ff, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x20bb, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x20bb, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x20bc, 0xf1ff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x20bc, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x20bc, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x20f8, 0xf1ff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x20f8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x20f8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x20f9, 0xf1ff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x20f9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x20f9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x20fa, 0xf1ff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x20fa, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x20fa, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x20fb, 0xf1ff, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x20fb, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x20fb, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x20fc, 0xf1ff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x20fc, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x20fc, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x2138, 0xf1ff, { 24,  30,  26, 255, 255, 255, 255, 255}},
+	{ 0x2138, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x2138, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x2139, 0xf1ff, { 28,  34,  30, 255, 255, 255, 255, 255}},
+	{ 0x2139, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x2139, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x213a, 0xf1ff, { 24,  30,  26, 255, 255, 255, 255, 255}},
+	{ 0x213a, 0xf1ff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x213a, 0xf1ff, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x213b, 0xf1ff, { 26,  32,  28, 255, 255, 255, 255, 255}},
+	{ 0x213b, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x213b, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0x213c, 0xf1ff, { 20,  26,  22, 255, 255, 255, 255, 255}},
+	{ 0x213c, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x213c, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x2178, 0xf1ff, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x2178, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x2178, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x2179, 0xf1ff, { 32,  38,  32, 255, 255, 255, 255, 255}},
+	{ 0x2179, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x2179, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x217a, 0xf1ff, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x217a, 0xf1ff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x217a, 0xf1ff, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x217b, 0xf1ff, { 30,  36,  30, 255, 255, 255, 255, 255}},
+	{ 0x217b, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x217b, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0x217c, 0xf1ff, { 24,  30,  24, 255, 255, 255, 255, 255}},
+	{ 0x217c, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x217c, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x21b8, 0xf1ff, { 30,  37,  30, 255, 255, 255, 255, 255}},
+	{ 0x21b8, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x21b8, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x21b9, 0xf1ff, { 34,  41,  34, 255, 255, 255, 255, 255}},
+	{ 0x21b9, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x21b9, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x21ba, 0xf1ff, { 30,  37,  30, 255, 255, 255, 255, 255}},
+	{ 0x21ba, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x21ba, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0x21bb, 0xf1ff, { 32,  39,  32, 255, 255, 255, 255, 255}},
+	{ 0x21bb, 0xf1ff, {255, 255, 255,  14,  14, 255,  14, 255}},
+	{ 0x21bb, 0xf1ff, {255, 255, 255, 255, 255,  14, 255,   7}},
+	{ 0x21bc, 0xf1ff, { 26,  33,  26, 255, 255, 255, 255, 255}},
+	{ 0x21bc, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x21bc, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x3038, 0xf1ff, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x3038, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x3038, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x3039, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x3039, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x3039, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x303a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x303b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x303b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x303b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x303b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x303c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
-	{ 0x3078, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x3079, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
+	{ 0x3078, 0xf1ff, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x3078, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x3078, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x3079, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x3079, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x3079, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x307a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x307b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x307b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x307b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x307b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x307c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
-	{ 0x30b8, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0x30b9, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x30ba, 0xf1ff, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x30bb, 0xf1ff, { 18,  21,  18,  11,  11,  11,  11,   4}},
-	{ 0x30bc, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   4}},
-	{ 0x30f8, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0x30f9, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x30fa, 0xf1ff, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x30fb, 0xf1ff, { 18,  21,  18,  11,  11,  11,  11,   4}},
-	{ 0x30fc, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   4}},
-	{ 0x3138, 0xf1ff, { 16,  22,  16,   9,   9,   9,   9,   5}},
-	{ 0x3139, 0xf1ff, { 20,  26,  20,   9,   9,   9,   9,   5}},
-	{ 0x313a, 0xf1ff, { 16,  22,  16,  10,  10,  10,  10,   5}},
-	{ 0x313b, 0xf1ff, { 18,  24,  18,  12,  12,  12,  12,   5}},
-	{ 0x313c, 0xf1ff, { 12,  18,  12,   7,   7,   7,   7,   5}},
-	{ 0x3178, 0xf1ff, { 20,  26,  20,   9,   9,   9,   9,   5}},
-	{ 0x3179, 0xf1ff, { 24,  30,  24,   9,   9,   9,   9,   5}},
-	{ 0x317a, 0xf1ff, { 20,  26,  20,  10,  10,  10,  10,   5}},
-	{ 0x317b, 0xf1ff, { 22,  28,  22,  12,  12,  12,  12,   5}},
-	{ 0x317c, 0xf1ff, { 16,  22,  16,   7,   7,   7,   7,   5}},
-	{ 0x31b8, 0xf1ff, { 22,  29,  22,  11,  11,  11,  11,   7}},
-	{ 0x31b9, 0xf1ff, { 26,  33,  26,  11,  11,  11,  11,   7}},
-	{ 0x31ba, 0xf1ff, { 22,  29,  22,  12,  12,  12,  12,   7}},
-	{ 0x31bb, 0xf1ff, { 24,  31,  24,  14,  14,  14,  14,   7}},
-	{ 0x31bc, 0xf1ff, { 18,  25,  18,   9,   9,   9,   9,   7}},
-	{ 0x4138, 0xf1ff, {255, 255, 255,  12,  12,  12,  12,   8}},
-	{ 0x4139, 0xf1ff, {255, 255, 255,  12,  12,  12,  12,   8}},
+	{ 0x30b8, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x30b8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x30b8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x30b9, 0xf1ff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x30b9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x30b9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x30ba, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x30ba, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x30ba, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x30bb, 0xf1ff, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x30bb, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x30bb, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x30bc, 0xf1ff, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x30bc, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x30bc, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   4}},
+	{ 0x30f8, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x30f8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x30f8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x30f9, 0xf1ff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x30f9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x30f9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x30fa, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x30fa, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x30fa, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x30fb, 0xf1ff, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x30fb, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x30fb, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x30fc, 0xf1ff, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x30fc, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x30fc, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   4}},
+	{ 0x3138, 0xf1ff, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x3138, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x3138, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x3139, 0xf1ff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x3139, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x3139, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x313a, 0xf1ff, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x313a, 0xf1ff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x313a, 0xf1ff, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x313b, 0xf1ff, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x313b, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x313b, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0x313c, 0xf1ff, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0x313c, 0xf1ff, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x313c, 0xf1ff, {255, 255, 255, 255, 255,   7, 255,   5}},
+	{ 0x3178, 0xf1ff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x3178, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x3178, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x3179, 0xf1ff, { 24,  30,  24, 255, 255, 255, 255, 255}},
+	{ 0x3179, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x3179, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x317a, 0xf1ff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x317a, 0xf1ff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x317a, 0xf1ff, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x317b, 0xf1ff, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x317b, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x317b, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0x317c, 0xf1ff, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x317c, 0xf1ff, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x317c, 0xf1ff, {255, 255, 255, 255, 255,   7, 255,   5}},
+	{ 0x31b8, 0xf1ff, { 22,  29,  22, 255, 255, 255, 255, 255}},
+	{ 0x31b8, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x31b8, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x31b9, 0xf1ff, { 26,  33,  26, 255, 255, 255, 255, 255}},
+	{ 0x31b9, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x31b9, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0x31ba, 0xf1ff, { 22,  29,  22, 255, 255, 255, 255, 255}},
+	{ 0x31ba, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x31ba, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0x31bb, 0xf1ff, { 24,  31,  24, 255, 255, 255, 255, 255}},
+	{ 0x31bb, 0xf1ff, {255, 255, 255,  14,  14, 255,  14, 255}},
+	{ 0x31bb, 0xf1ff, {255, 255, 255, 255, 255,  14, 255,   7}},
+	{ 0x31bc, 0xf1ff, { 18,  25,  18, 255, 255, 255, 255, 255}},
+	{ 0x31bc, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x31bc, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   7}},
+	{ 0x4138, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4138, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x4139, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4139, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   8}},
 	{ 0x413a, 0xf1ff, {255, 255, 255,  13,  13,  13,  13,   8}},
-	{ 0x413b, 0xf1ff, {255, 255, 255,  15,  15,  15,  15,   8}},
+	{ 0x413b, 0xf1ff, {255, 255, 255,  15,  15, 255,  15, 255}},
+	{ 0x413b, 0xf1ff, {255, 255, 255, 255, 255,  15, 255,   8}},
 	{ 0x413c, 0xf1ff, {255, 255, 255,  12,  12,  12,  12,   8}},
-	{ 0x41b8, 0xf1ff, { 18,  27,  16,  12,  12,  12,  12,   8}},
-	{ 0x41b9, 0xf1ff, { 22,  31,  20,  12,  12,  12,  12,   8}},
+	{ 0x41b8, 0xf1ff, { 18,  27,  16, 255, 255, 255, 255, 255}},
+	{ 0x41b8, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x41b8, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x41b9, 0xf1ff, { 22,  31,  20, 255, 255, 255, 255, 255}},
+	{ 0x41b9, 0xf1ff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x41b9, 0xf1ff, {255, 255, 255, 255, 255,  12, 255,   8}},
 	{ 0x41ba, 0xf1ff, { 18,  27,  16,  13,  13,  13,  13,   8}},
-	{ 0x41bb, 0xf1ff, { 20,  29,  18,  15,  15,  15,  15,   8}},
+	{ 0x41bb, 0xf1ff, { 20,  29,  18, 255, 255, 255, 255, 255}},
+	{ 0x41bb, 0xf1ff, {255, 255, 255,  15,  15, 255,  15, 255}},
+	{ 0x41bb, 0xf1ff, {255, 255, 255, 255, 255,  15, 255,   8}},
 	{ 0x41bc, 0xf1ff, { 14,  23,  12,  10,  10,  10,  10,   8}},
 	{ 0x41f8, 0xf1ff, {  8,  15,   8,   6,   6,   6,   6,   2}},
 	{ 0x41f9, 0xf1ff, { 12,  19,  12,   6,   6,   6,   6,   2}},
 	{ 0x41fa, 0xf1ff, {  8,  15,   8,   7,   7,   7,   7,   2}},
-	{ 0x41fb, 0xf1ff, { 12,  19,  12,   9,   9,   9,   9,   2}},
+	{ 0x41fb, 0xf1ff, { 12,  19,  12, 255, 255, 255, 255, 255}},
+	{ 0x41fb, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x41fb, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x501f, 0xf1ff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x5027, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x5038, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x5039, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x5078, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0x5079, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x50b8, 0xf1ff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x50b9, 0xf1ff, { 28,  31,  28,   8,   8,   8,   8,   4}},
+	{ 0x5078, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x5078, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x5078, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x5079, 0xf1ff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x5079, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x5079, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x50b8, 0xf1ff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x50b8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x50b8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x50b9, 0xf1ff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x50b9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x50b9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x511f, 0xf1ff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x5127, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x5138, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x5139, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x5178, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0x5179, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x51b8, 0xf1ff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x51b9, 0xf1ff, { 28,  31,  28,   8,   8,   8,   8,   4}},
+	{ 0x5178, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x5178, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x5178, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x5179, 0xf1ff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x5179, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x5179, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x51b8, 0xf1ff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x51b8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x51b8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x51b9, 0xf1ff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x51b9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x51b9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x801f, 0xf1ff, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0x8027, 0xf1ff, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0x8038, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
 	{ 0x8039, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
 	{ 0x803a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x803b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x803b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x803b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x803b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x803c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
-	{ 0x8078, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x8079, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
+	{ 0x8078, 0xf1ff, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x8078, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x8078, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x8079, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x8079, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x8079, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x807a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x807b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x807b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x807b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x807b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x807c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
-	{ 0x80b8, 0xf1ff, { 18,  19,  18,   6,   6,   6,   6,   2}},
-	{ 0x80b9, 0xf1ff, { 22,  23,  22,   6,   6,   6,   6,   2}},
+	{ 0x80b8, 0xf1ff, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0x80b8, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x80b8, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x80b9, 0xf1ff, { 22,  23,  22, 255, 255, 255, 255, 255}},
+	{ 0x80b9, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x80b9, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x80ba, 0xf1ff, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0x80bb, 0xf1ff, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0x80bb, 0xf1ff, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0x80bb, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x80bb, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x80bc, 0xf1ff, { 16,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0x80f8, 0xf1ff, {148, 138, 116,  48,  48,  48,  48,  44}},
-	{ 0x80f9, 0xf1ff, {152, 142, 120,  48,  48,  48,  48,  44}},
+	{ 0x80f8, 0xf1ff, {148, 138, 116, 255, 255, 255, 255, 255}},
+	{ 0x80f8, 0xf1ff, {255, 255, 255,  48,  48, 255,  48, 255}},
+	{ 0x80f8, 0xf1ff, {255, 255, 255, 255, 255,  48, 255,  44}},
+	{ 0x80f9, 0xf1ff, {152, 142, 120, 255, 255, 255, 255, 255}},
+	{ 0x80f9, 0xf1ff, {255, 255, 255,  48,  48, 255,  48, 255}},
+	{ 0x80f9, 0xf1ff, {255, 255, 255, 255, 255,  48, 255,  44}},
 	{ 0x80fa, 0xf1ff, {148, 138, 116,  49,  49,  49,  49,  44}},
-	{ 0x80fb, 0xf1ff, {150, 140, 118,  51,  51,  51,  51,  44}},
+	{ 0x80fb, 0xf1ff, {150, 140, 118, 255, 255, 255, 255, 255}},
+	{ 0x80fb, 0xf1ff, {255, 255, 255,  51,  51, 255,  51, 255}},
+	{ 0x80fb, 0xf1ff, {255, 255, 255, 255, 255,  51, 255,  44}},
 	{ 0x80fc, 0xf1ff, {144, 134, 112,  46,  46,  46,  46,  44}},
 	{ 0x810f, 0xf1ff, { 18,  31,  18,  16,  16,  16,  16,  16}},
 	{ 0x811f, 0xf1ff, { 12,  15,  12,   8,   8,   8,   8,   4}},
@@ -34105,241 +37801,486 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x8138, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x8139, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
 	{ 0x814f, 0xf1ff, {255, 255, 255,  13,  13,  13,  13,  13}},
-	{ 0x8178, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0x8179, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
+	{ 0x8178, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x8178, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x8178, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x8179, 0xf1ff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x8179, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x8179, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x818f, 0xf1ff, {255, 255, 255,  13,  13,  13,  13,  13}},
-	{ 0x81b8, 0xf1ff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x81b9, 0xf1ff, { 28,  31,  28,   8,   8,   8,   8,   4}},
-	{ 0x81f8, 0xf1ff, {166, 177, 130,  60,  60,  60,  60,  56}},
-	{ 0x81f9, 0xf1ff, {170, 181, 134,  60,  60,  60,  60,  56}},
+	{ 0x81b8, 0xf1ff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x81b8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x81b8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x81b9, 0xf1ff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x81b9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x81b9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x81f8, 0xf1ff, {166, 177, 130, 255, 255, 255, 255, 255}},
+	{ 0x81f8, 0xf1ff, {255, 255, 255,  60,  60, 255,  60, 255}},
+	{ 0x81f8, 0xf1ff, {255, 255, 255, 255, 255,  60, 255,  56}},
+	{ 0x81f9, 0xf1ff, {170, 181, 134, 255, 255, 255, 255, 255}},
+	{ 0x81f9, 0xf1ff, {255, 255, 255,  60,  60, 255,  60, 255}},
+	{ 0x81f9, 0xf1ff, {255, 255, 255, 255, 255,  60, 255,  56}},
 	{ 0x81fa, 0xf1ff, {166, 177, 130,  61,  61,  61,  61,  56}},
-	{ 0x81fb, 0xf1ff, {168, 179, 132,  63,  63,  63,  63,  56}},
+	{ 0x81fb, 0xf1ff, {168, 179, 132, 255, 255, 255, 255, 255}},
+	{ 0x81fb, 0xf1ff, {255, 255, 255,  63,  63, 255,  63, 255}},
+	{ 0x81fb, 0xf1ff, {255, 255, 255, 255, 255,  63, 255,  56}},
 	{ 0x81fc, 0xf1ff, {162, 173, 126,  58,  58,  58,  58,  56}},
 	{ 0x901f, 0xf1ff, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0x9027, 0xf1ff, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0x9038, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
 	{ 0x9039, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
 	{ 0x903a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x903b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x903b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x903b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x903b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x903c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
-	{ 0x9078, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x9079, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
+	{ 0x9078, 0xf1ff, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x9078, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x9078, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x9079, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x9079, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x9079, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x907a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x907b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x907b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x907b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x907b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x907c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
-	{ 0x90b8, 0xf1ff, { 18,  19,  18,   6,   6,   6,   6,   2}},
-	{ 0x90b9, 0xf1ff, { 22,  23,  22,   6,   6,   6,   6,   2}},
+	{ 0x90b8, 0xf1ff, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0x90b8, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x90b8, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x90b9, 0xf1ff, { 22,  23,  22, 255, 255, 255, 255, 255}},
+	{ 0x90b9, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x90b9, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x90ba, 0xf1ff, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0x90bb, 0xf1ff, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0x90bb, 0xf1ff, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0x90bb, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x90bb, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x90bc, 0xf1ff, { 16,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0x90f8, 0xf1ff, { 16,  15,  16,   6,   6,   6,   6,   2}},
-	{ 0x90f9, 0xf1ff, { 20,  19,  20,   6,   6,   6,   6,   2}},
+	{ 0x90f8, 0xf1ff, { 16,  15,  16, 255, 255, 255, 255, 255}},
+	{ 0x90f8, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x90f8, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x90f9, 0xf1ff, { 20,  19,  20, 255, 255, 255, 255, 255}},
+	{ 0x90f9, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x90f9, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x90fa, 0xf1ff, { 16,  15,  16,   7,   7,   7,   7,   2}},
-	{ 0x90fb, 0xf1ff, { 18,  17,  18,   9,   9,   9,   9,   2}},
+	{ 0x90fb, 0xf1ff, { 18,  17,  18, 255, 255, 255, 255, 255}},
+	{ 0x90fb, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x90fb, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x90fc, 0xf1ff, { 12,  11,  12,   4,   4,   4,   4,   2}},
 	{ 0x910f, 0xf1ff, { 18,  28,  18,  12,  12,  12,  12,  12}},
 	{ 0x911f, 0xf1ff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x9127, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x9138, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x9139, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x9178, 0xf1ff, { 16,  23,  16,   8,   8,   8,   8,   4}},
-	{ 0x9179, 0xf1ff, { 20,  27,  20,   8,   8,   8,   8,   4}},
-	{ 0x91b8, 0xf1ff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x91b9, 0xf1ff, { 28,  31,  28,   8,   8,   8,   8,   4}},
-	{ 0x91f8, 0xf1ff, { 18,  19,  18,   6,   6,   6,   6,   2}},
-	{ 0x91f9, 0xf1ff, { 22,  23,  22,   6,   6,   6,   6,   2}},
+	{ 0x9178, 0xf1ff, { 16,  23,  16, 255, 255, 255, 255, 255}},
+	{ 0x9178, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x9178, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x9179, 0xf1ff, { 20,  27,  20, 255, 255, 255, 255, 255}},
+	{ 0x9179, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x9179, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x91b8, 0xf1ff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x91b8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x91b8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x91b9, 0xf1ff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x91b9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x91b9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x91f8, 0xf1ff, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0x91f8, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x91f8, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x91f9, 0xf1ff, { 22,  23,  22, 255, 255, 255, 255, 255}},
+	{ 0x91f9, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x91f9, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x91fa, 0xf1ff, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0x91fb, 0xf1ff, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0x91fb, 0xf1ff, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0x91fb, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x91fb, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x91fc, 0xf1ff, { 16,  17,  14,   6,   6,   6,   6,   2}},
 	{ 0xb01f, 0xf1ff, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0xb027, 0xf1ff, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0xb038, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
 	{ 0xb039, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
 	{ 0xb03a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0xb03b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0xb03b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xb03b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb03b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xb03c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
-	{ 0xb078, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0xb079, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
+	{ 0xb078, 0xf1ff, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0xb078, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xb078, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xb079, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0xb079, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xb079, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0xb07a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0xb07b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0xb07b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xb07b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb07b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xb07c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
-	{ 0xb0b8, 0xf1ff, { 18,  19,  18,   6,   6,   6,   6,   2}},
-	{ 0xb0b9, 0xf1ff, { 22,  23,  22,   6,   6,   6,   6,   2}},
+	{ 0xb0b8, 0xf1ff, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0xb0b8, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xb0b8, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xb0b9, 0xf1ff, { 22,  23,  22, 255, 255, 255, 255, 255}},
+	{ 0xb0b9, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xb0b9, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0xb0ba, 0xf1ff, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0xb0bb, 0xf1ff, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0xb0bb, 0xf1ff, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0xb0bb, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xb0bb, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xb0bc, 0xf1ff, { 14,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0xb0f8, 0xf1ff, { 14,  15,  14,   8,   8,   8,   8,   4}},
-	{ 0xb0f9, 0xf1ff, { 18,  19,  18,   8,   8,   8,   8,   4}},
+	{ 0xb0f8, 0xf1ff, { 14,  15,  14, 255, 255, 255, 255, 255}},
+	{ 0xb0f8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb0f8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb0f9, 0xf1ff, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0xb0f9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb0f9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0xb0fa, 0xf1ff, { 14,  15,  14,   9,   9,   9,   9,   4}},
-	{ 0xb0fb, 0xf1ff, { 16,  17,  16,  11,  11,  11,  11,   4}},
+	{ 0xb0fb, 0xf1ff, { 16,  17,  16, 255, 255, 255, 255, 255}},
+	{ 0xb0fb, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xb0fb, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xb0fc, 0xf1ff, { 10,  11,  10,   6,   6,   6,   6,   4}},
 	{ 0xb10f, 0xf1ff, { 12,  18,  12,   9,   9,   9,   9,   9}},
 	{ 0xb11f, 0xf1ff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0xb127, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0xb138, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0xb139, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0xb178, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0xb179, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0xb1b8, 0xf1ff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0xb1b9, 0xf1ff, { 28,  31,  28,   8,   8,   8,   8,   4}},
-	{ 0xb1f8, 0xf1ff, { 18,  19,  18,   8,   8,   8,   8,   4}},
-	{ 0xb1f9, 0xf1ff, { 22,  23,  22,   8,   8,   8,   8,   4}},
+	{ 0xb178, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0xb178, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb178, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb179, 0xf1ff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0xb179, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb179, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb1b8, 0xf1ff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0xb1b8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb1b8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb1b9, 0xf1ff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0xb1b9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb1b9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb1f8, 0xf1ff, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0xb1f8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb1f8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xb1f9, 0xf1ff, { 22,  23,  22, 255, 255, 255, 255, 255}},
+	{ 0xb1f9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xb1f9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0xb1fa, 0xf1ff, { 18,  19,  18,   9,   9,   9,   9,   4}},
-	{ 0xb1fb, 0xf1ff, { 20,  21,  20,  11,  11,  11,  11,   4}},
+	{ 0xb1fb, 0xf1ff, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0xb1fb, 0xf1ff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xb1fb, 0xf1ff, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0xb1fc, 0xf1ff, { 14,  15,  14,   8,   8,   8,   8,   4}},
 	{ 0xc01f, 0xf1ff, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0xc027, 0xf1ff, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0xc038, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
 	{ 0xc039, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
 	{ 0xc03a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0xc03b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0xc03b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xc03b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xc03b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xc03c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
-	{ 0xc078, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0xc079, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
+	{ 0xc078, 0xf1ff, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0xc078, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xc078, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xc079, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0xc079, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xc079, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0xc07a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0xc07b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0xc07b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xc07b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xc07b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xc07c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
-	{ 0xc0b8, 0xf1ff, { 18,  19,  18,   6,   6,   6,   6,   2}},
-	{ 0xc0b9, 0xf1ff, { 22,  23,  22,   6,   6,   6,   6,   2}},
+	{ 0xc0b8, 0xf1ff, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0xc0b8, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xc0b8, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xc0b9, 0xf1ff, { 22,  23,  22, 255, 255, 255, 255, 255}},
+	{ 0xc0b9, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xc0b9, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0xc0ba, 0xf1ff, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0xc0bb, 0xf1ff, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0xc0bb, 0xf1ff, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0xc0bb, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xc0bb, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xc0bc, 0xf1ff, { 16,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0xc0f8, 0xf1ff, { 62,  84,  38,  31,  31,  31,  31,  27}},
-	{ 0xc0f9, 0xf1ff, { 66,  88,  42,  31,  31,  31,  31,  27}},
+	{ 0xc0f8, 0xf1ff, { 62,  84,  38, 255, 255, 255, 255, 255}},
+	{ 0xc0f8, 0xf1ff, {255, 255, 255,  31,  31, 255,  31, 255}},
+	{ 0xc0f8, 0xf1ff, {255, 255, 255, 255, 255,  31, 255,  27}},
+	{ 0xc0f9, 0xf1ff, { 66,  88,  42, 255, 255, 255, 255, 255}},
+	{ 0xc0f9, 0xf1ff, {255, 255, 255,  31,  31, 255,  31, 255}},
+	{ 0xc0f9, 0xf1ff, {255, 255, 255, 255, 255,  31, 255,  27}},
 	{ 0xc0fa, 0xf1ff, { 62,  84,  38,  32,  32,  32,  32,  27}},
-	{ 0xc0fb, 0xf1ff, { 64,  86,  40,  34,  34,  34,  34,  27}},
+	{ 0xc0fb, 0xf1ff, { 64,  86,  40, 255, 255, 255, 255, 255}},
+	{ 0xc0fb, 0xf1ff, {255, 255, 255,  34,  34, 255,  34, 255}},
+	{ 0xc0fb, 0xf1ff, {255, 255, 255, 255, 255,  34, 255,  27}},
 	{ 0xc0fc, 0xf1ff, { 58,  80,  34,  29,  29,  29,  29,  27}},
 	{ 0xc10f, 0xf1ff, { 18,  31,  18,  16,  16,  16,  16,  16}},
 	{ 0xc11f, 0xf1ff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0xc127, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0xc138, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0xc139, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0xc178, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0xc179, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0xc1b8, 0xf1ff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0xc1b9, 0xf1ff, { 28,  31,  28,   8,   8,   8,   8,   4}},
-	{ 0xc1f8, 0xf1ff, { 62,  84,  40,  31,  31,  31,  31,  27}},
-	{ 0xc1f9, 0xf1ff, { 66,  88,  44,  31,  31,  31,  31,  27}},
+	{ 0xc178, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0xc178, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xc178, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xc179, 0xf1ff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0xc179, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xc179, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xc1b8, 0xf1ff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0xc1b8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xc1b8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xc1b9, 0xf1ff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0xc1b9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xc1b9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xc1f8, 0xf1ff, { 62,  84,  40, 255, 255, 255, 255, 255}},
+	{ 0xc1f8, 0xf1ff, {255, 255, 255,  31,  31, 255,  31, 255}},
+	{ 0xc1f8, 0xf1ff, {255, 255, 255, 255, 255,  31, 255,  27}},
+	{ 0xc1f9, 0xf1ff, { 66,  88,  44, 255, 255, 255, 255, 255}},
+	{ 0xc1f9, 0xf1ff, {255, 255, 255,  31,  31, 255,  31, 255}},
+	{ 0xc1f9, 0xf1ff, {255, 255, 255, 255, 255,  31, 255,  27}},
 	{ 0xc1fa, 0xf1ff, { 62,  84,  40,  32,  32,  32,  32,  27}},
-	{ 0xc1fb, 0xf1ff, { 64,  86,  42,  34,  34,  34,  34,  27}},
+	{ 0xc1fb, 0xf1ff, { 64,  86,  42, 255, 255, 255, 255, 255}},
+	{ 0xc1fb, 0xf1ff, {255, 255, 255,  34,  34, 255,  34, 255}},
+	{ 0xc1fb, 0xf1ff, {255, 255, 255, 255, 255,  34, 255,  27}},
 	{ 0xc1fc, 0xf1ff, { 58,  80,  36,  29,  29,  29,  29,  27}},
 	{ 0xd01f, 0xf1ff, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0xd027, 0xf1ff, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0xd038, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
 	{ 0xd039, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
 	{ 0xd03a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0xd03b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0xd03b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xd03b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd03b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xd03c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
-	{ 0xd078, 0xf1ff, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0xd079, 0xf1ff, { 16,  19,  16,   6,   6,   6,   6,   2}},
+	{ 0xd078, 0xf1ff, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0xd078, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd078, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xd079, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0xd079, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd079, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0xd07a, 0xf1ff, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0xd07b, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0xd07b, 0xf1ff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0xd07b, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd07b, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xd07c, 0xf1ff, {  8,  11,   8,   4,   4,   4,   4,   2}},
-	{ 0xd0b8, 0xf1ff, { 18,  19,  18,   6,   6,   6,   6,   2}},
-	{ 0xd0b9, 0xf1ff, { 22,  23,  22,   6,   6,   6,   6,   2}},
+	{ 0xd0b8, 0xf1ff, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0xd0b8, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd0b8, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xd0b9, 0xf1ff, { 22,  23,  22, 255, 255, 255, 255, 255}},
+	{ 0xd0b9, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd0b9, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0xd0ba, 0xf1ff, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0xd0bb, 0xf1ff, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0xd0bb, 0xf1ff, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0xd0bb, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd0bb, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xd0bc, 0xf1ff, { 16,  15,  14,   6,   6,   6,   6,   2}},
-	{ 0xd0f8, 0xf1ff, { 16,  15,  16,   6,   6,   6,   6,   2}},
-	{ 0xd0f9, 0xf1ff, { 20,  19,  20,   6,   6,   6,   6,   2}},
+	{ 0xd0f8, 0xf1ff, { 16,  15,  16, 255, 255, 255, 255, 255}},
+	{ 0xd0f8, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd0f8, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xd0f9, 0xf1ff, { 20,  19,  20, 255, 255, 255, 255, 255}},
+	{ 0xd0f9, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd0f9, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0xd0fa, 0xf1ff, { 16,  15,  16,   7,   7,   7,   7,   2}},
-	{ 0xd0fb, 0xf1ff, { 18,  17,  18,   9,   9,   9,   9,   2}},
+	{ 0xd0fb, 0xf1ff, { 18,  17,  18, 255, 255, 255, 255, 255}},
+	{ 0xd0fb, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd0fb, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xd0fc, 0xf1ff, { 12,  11,  12,   4,   4,   4,   4,   2}},
 	{ 0xd10f, 0xf1ff, { 18,  28,  18,  12,  12,  12,  12,  12}},
 	{ 0xd11f, 0xf1ff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0xd127, 0xf1ff, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0xd138, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0xd139, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0xd178, 0xf1ff, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0xd179, 0xf1ff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0xd1b8, 0xf1ff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0xd1b9, 0xf1ff, { 28,  31,  28,   8,   8,   8,   8,   4}},
-	{ 0xd1f8, 0xf1ff, { 18,  19,  18,   6,   6,   6,   6,   2}},
-	{ 0xd1f9, 0xf1ff, { 22,  23,  22,   6,   6,   6,   6,   2}},
+	{ 0xd178, 0xf1ff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0xd178, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xd178, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xd179, 0xf1ff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0xd179, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xd179, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xd1b8, 0xf1ff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0xd1b8, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xd1b8, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xd1b9, 0xf1ff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0xd1b9, 0xf1ff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0xd1b9, 0xf1ff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0xd1f8, 0xf1ff, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0xd1f8, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd1f8, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0xd1f9, 0xf1ff, { 22,  23,  22, 255, 255, 255, 255, 255}},
+	{ 0xd1f9, 0xf1ff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0xd1f9, 0xf1ff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0xd1fa, 0xf1ff, { 18,  19,  18,   7,   7,   7,   7,   2}},
-	{ 0xd1fb, 0xf1ff, { 20,  21,  20,   9,   9,   9,   9,   2}},
+	{ 0xd1fb, 0xf1ff, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0xd1fb, 0xf1ff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xd1fb, 0xf1ff, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0xd1fc, 0xf1ff, { 16,  17,  14,   6,   6,   6,   6,   2}},
 	{ 0x0000, 0xfff8, {  8,  14,   8,   2,   2,   2,   2,   2}},
 	{ 0x0010, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0018, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0020, 0xfff8, { 18,  24,  18,   9,   9,   9,   9,   4}},
 	{ 0x0028, 0xfff8, { 20,  26,  20,   9,   9,   9,   9,   4}},
-	{ 0x0030, 0xfff8, { 22,  28,  22,  11,  11,  11,  11,   4}},
+	{ 0x0030, 0xfff8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x0030, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0030, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0040, 0xfff8, {  8,  14,   8,   2,   2,   2,   2,   2}},
-	{ 0x0050, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
-	{ 0x0058, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
-	{ 0x0060, 0xfff8, { 18,  24,  18,   9,   9,   9,   9,   4}},
-	{ 0x0068, 0xfff8, { 20,  26,  20,   9,   9,   9,   9,   4}},
-	{ 0x0070, 0xfff8, { 22,  28,  22,  11,  11,  11,  11,   4}},
+	{ 0x0050, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x0050, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0050, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0058, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x0058, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0058, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0060, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x0060, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0060, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x0068, 0xfff8, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0068, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0068, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x0070, 0xfff8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x0070, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0070, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0080, 0xfff8, { 16,  18,  14,   2,   2,   2,   2,   2}},
-	{ 0x0090, 0xfff8, { 28,  34,  28,   8,   8,   8,   8,   4}},
-	{ 0x0098, 0xfff8, { 28,  34,  28,   8,   8,   8,   8,   4}},
-	{ 0x00a0, 0xfff8, { 30,  36,  30,   9,   9,   9,   9,   4}},
-	{ 0x00a8, 0xfff8, { 32,  38,  32,   9,   9,   9,   9,   4}},
-	{ 0x00b0, 0xfff8, { 34,  40,  34,  11,  11,  11,  11,   4}},
+	{ 0x0090, 0xfff8, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x0090, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0090, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0098, 0xfff8, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x0098, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0098, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x00a0, 0xfff8, { 30,  36,  30, 255, 255, 255, 255, 255}},
+	{ 0x00a0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x00a0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x00a8, 0xfff8, { 32,  38,  32, 255, 255, 255, 255, 255}},
+	{ 0x00a8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x00a8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x00b0, 0xfff8, { 34,  40,  34, 255, 255, 255, 255, 255}},
+	{ 0x00b0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x00b0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x00d0, 0xfff8, {255, 255, 255,  22,  22,  22,  22,  18}},
 	{ 0x00e8, 0xfff8, {255, 255, 255,  23,  23,  23,  23,  18}},
-	{ 0x00f0, 0xfff8, {255, 255, 255,  25,  25,  25,  25,  18}},
+	{ 0x00f0, 0xfff8, {255, 255, 255,  25,  25, 255,  25, 255}},
+	{ 0x00f0, 0xfff8, {255, 255, 255, 255, 255,  25, 255,  18}},
 	{ 0x0200, 0xfff8, {  8,  14,   8,   2,   2,   2,   2,   2}},
 	{ 0x0210, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0218, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0220, 0xfff8, { 18,  24,  18,   9,   9,   9,   9,   4}},
 	{ 0x0228, 0xfff8, { 20,  26,  20,   9,   9,   9,   9,   4}},
-	{ 0x0230, 0xfff8, { 22,  28,  22,  11,  11,  11,  11,   4}},
+	{ 0x0230, 0xfff8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x0230, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0230, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0240, 0xfff8, {  8,  14,   8,   2,   2,   2,   2,   2}},
-	{ 0x0250, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
-	{ 0x0258, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
-	{ 0x0260, 0xfff8, { 18,  24,  18,   9,   9,   9,   9,   4}},
-	{ 0x0268, 0xfff8, { 20,  26,  20,   9,   9,   9,   9,   4}},
-	{ 0x0270, 0xfff8, { 22,  28,  22,  11,  11,  11,  11,   4}},
+	{ 0x0250, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x0250, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0250, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0258, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x0258, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0258, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0260, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x0260, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0260, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x0268, 0xfff8, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0268, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0268, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x0270, 0xfff8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x0270, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0270, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0280, 0xfff8, { 14,  18,  14,   2,   2,   2,   2,   2}},
-	{ 0x0290, 0xfff8, { 28,  34,  28,   8,   8,   8,   8,   4}},
-	{ 0x0298, 0xfff8, { 28,  34,  28,   8,   8,   8,   8,   4}},
-	{ 0x02a0, 0xfff8, { 30,  36,  30,   9,   9,   9,   9,   4}},
-	{ 0x02a8, 0xfff8, { 32,  38,  32,   9,   9,   9,   9,   4}},
-	{ 0x02b0, 0xfff8, { 34,  40,  34,  11,  11,  11,  11,   4}},
-	{ 0x02d0, 0xfff8, {255, 255, 255,  22,  22,  22,  22,  18}},
-	{ 0x02e8, 0xfff8, {255, 255, 255,  23,  23,  23,  23,  18}},
-	{ 0x02f0, 0xfff8, {255, 255, 255,  25,  25,  25,  25,  18}},
+	{ 0x0290, 0xfff8, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x0290, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0290, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0298, 0xfff8, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x0298, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0298, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x02a0, 0xfff8, { 30,  36,  30, 255, 255, 255, 255, 255}},
+	{ 0x02a0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x02a0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x02a8, 0xfff8, { 32,  38,  32, 255, 255, 255, 255, 255}},
+	{ 0x02a8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x02a8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x02b0, 0xfff8, { 34,  40,  34, 255, 255, 255, 255, 255}},
+	{ 0x02b0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x02b0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x02d0, 0xfff8, {255, 255, 255,  22,  22, 255,  22, 255}},
+	{ 0x02d0, 0xfff8, {255, 255, 255, 255, 255,  22, 255,  18}},
+	{ 0x02e8, 0xfff8, {255, 255, 255,  23,  23, 255,  23, 255}},
+	{ 0x02e8, 0xfff8, {255, 255, 255, 255, 255,  23, 255,  18}},
+	{ 0x02f0, 0xfff8, {255, 255, 255,  25,  25, 255,  25, 255}},
+	{ 0x02f0, 0xfff8, {255, 255, 255, 255, 255,  25, 255,  18}},
 	{ 0x0400, 0xfff8, {  8,  14,   8,   2,   2,   2,   2,   2}},
 	{ 0x0410, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0418, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0420, 0xfff8, { 18,  24,  18,   9,   9,   9,   9,   4}},
 	{ 0x0428, 0xfff8, { 20,  26,  20,   9,   9,   9,   9,   4}},
-	{ 0x0430, 0xfff8, { 22,  28,  22,  11,  11,  11,  11,   4}},
+	{ 0x0430, 0xfff8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x0430, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0430, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0440, 0xfff8, {  8,  14,   8,   2,   2,   2,   2,   2}},
-	{ 0x0450, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
-	{ 0x0458, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
-	{ 0x0460, 0xfff8, { 18,  24,  18,   9,   9,   9,   9,   4}},
-	{ 0x0468, 0xfff8, { 20,  26,  20,   9,   9,   9,   9,   4}},
-	{ 0x0470, 0xfff8, { 22,  28,  22,  11,  11,  11,  11,   4}},
+	{ 0x0450, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x0450, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0450, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0458, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x0458, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0458, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0460, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x0460, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0460, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x0468, 0xfff8, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0468, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0468, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x0470, 0xfff8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x0470, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0470, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0480, 0xfff8, { 16,  18,  14,   2,   2,   2,   2,   2}},
-	{ 0x0490, 0xfff8, { 28,  34,  28,   8,   8,   8,   8,   4}},
-	{ 0x0498, 0xfff8, { 28,  34,  28,   8,   8,   8,   8,   4}},
-	{ 0x04a0, 0xfff8, { 30,  36,  30,   9,   9,   9,   9,   4}},
-	{ 0x04a8, 0xfff8, { 32,  38,  32,   9,   9,   9,   9,   4}},
-	{ 0x04b0, 0xfff8, { 34,  40,  34,  11,  11,  11,  11,   4}},
-	{ 0x04d0, 0xfff8, {255, 255, 255,  22,  22,  22,  22,  18}},
-	{ 0x04e8, 0xfff8, {255, 255, 255,  23,  23,  23,  23,  18}},
-	{ 0x04f0, 0xfff8, {255, 255, 255,  25,  25,  25,  25,  18}},
+	{ 0x0490, 0xfff8, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x0490, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0490, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0498, 0xfff8, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x0498, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0498, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x04a0, 0xfff8, { 30,  36,  30, 255, 255, 255, 255, 255}},
+	{ 0x04a0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x04a0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x04a8, 0xfff8, { 32,  38,  32, 255, 255, 255, 255, 255}},
+	{ 0x04a8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x04a8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x04b0, 0xfff8, { 34,  40,  34, 255, 255, 255, 255, 255}},
+	{ 0x04b0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x04b0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x04d0, 0xfff8, {255, 255, 255,  22,  22, 255,  22, 255}},
+	{ 0x04d0, 0xfff8, {255, 255, 255, 255, 255,  22, 255,  18}},
+	{ 0x04e8, 0xfff8, {255, 255, 255,  23,  23, 255,  23, 255}},
+	{ 0x04e8, 0xfff8, {255, 255, 255, 255, 255,  23, 255,  18}},
+	{ 0x04f0, 0xfff8, {255, 255, 255,  25,  25, 255,  25, 255}},
+	{ 0x04f0, 0xfff8, {255, 255, 255, 255, 255,  25, 255,  18}},
 	{ 0x0600, 0xfff8, {  8,  14,   8,   2,   2,   2,   2,   2}},
 	{ 0x0610, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0618, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0620, 0xfff8, { 18,  24,  18,   9,   9,   9,   9,   4}},
 	{ 0x0628, 0xfff8, { 20,  26,  20,   9,   9,   9,   9,   4}},
-	{ 0x0630, 0xfff8, { 22,  28,  22,  11,  11,  11,  11,   4}},
+	{ 0x0630, 0xfff8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x0630, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0630, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0640, 0xfff8, {  8,  14,   8,   2,   2,   2,   2,   2}},
-	{ 0x0650, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
-	{ 0x0658, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
-	{ 0x0660, 0xfff8, { 18,  24,  18,   9,   9,   9,   9,   4}},
-	{ 0x0668, 0xfff8, { 20,  26,  20,   9,   9,   9,   9,   4}},
-	{ 0x0670, 0xfff8, { 22,  28,  22,  11,  11,  11,  11,   4}},
+	{ 0x0650, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x0650, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0650, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0658, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x0658, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0658, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0660, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x0660, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0660, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x0668, 0xfff8, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0668, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0668, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x0670, 0xfff8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x0670, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0670, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0680, 0xfff8, { 16,  18,  14,   2,   2,   2,   2,   2}},
-	{ 0x0690, 0xfff8, { 28,  34,  28,   8,   8,   8,   8,   4}},
-	{ 0x0698, 0xfff8, { 28,  34,  28,   8,   8,   8,   8,   4}},
-	{ 0x06a0, 0xfff8, { 30,  36,  30,   9,   9,   9,   9,   4}},
-	{ 0x06a8, 0xfff8, { 32,  38,  32,   9,   9,   9,   9,   4}},
-	{ 0x06b0, 0xfff8, { 34,  40,  34,  11,  11,  11,  11,   4}},
+	{ 0x0690, 0xfff8, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x0690, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0690, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0698, 0xfff8, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x0698, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0698, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x06a0, 0xfff8, { 30,  36,  30, 255, 255, 255, 255, 255}},
+	{ 0x06a0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x06a0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x06a8, 0xfff8, { 32,  38,  32, 255, 255, 255, 255, 255}},
+	{ 0x06a8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x06a8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x06b0, 0xfff8, { 34,  40,  34, 255, 255, 255, 255, 255}},
+	{ 0x06b0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x06b0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x06d0, 0xfff8, {255, 255, 255,  64, 255, 255,  64, 255}},
 	{ 0x06e8, 0xfff8, {255, 255, 255,  65, 255, 255,  65, 255}},
 	{ 0x06f0, 0xfff8, {255, 255, 255,  67, 255, 255,  67, 255}},
@@ -34348,71 +38289,129 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x0818, 0xfff8, { 12,  18,  12,   8,   8,   8,   8,   4}},
 	{ 0x0820, 0xfff8, { 14,  20,  14,   9,   9,   9,   9,   4}},
 	{ 0x0828, 0xfff8, { 16,  22,  16,   9,   9,   9,   9,   4}},
-	{ 0x0830, 0xfff8, { 18,  24,  18,  11,  11,  11,  11,   4}},
+	{ 0x0830, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x0830, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0830, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0840, 0xfff8, { 12,  17,  12,   4,   4,   4,   4,   4}},
 	{ 0x0850, 0xfff8, { 16,  25,  16,   8,   8,   8,   8,   4}},
 	{ 0x0858, 0xfff8, { 16,  25,  16,   8,   8,   8,   8,   4}},
 	{ 0x0860, 0xfff8, { 18,  27,  18,   9,   9,   9,   9,   4}},
 	{ 0x0868, 0xfff8, { 20,  29,  20,   9,   9,   9,   9,   4}},
-	{ 0x0870, 0xfff8, { 22,  31,  22,  11,  11,  11,  11,   4}},
+	{ 0x0870, 0xfff8, { 22,  31,  22, 255, 255, 255, 255, 255}},
+	{ 0x0870, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0870, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0880, 0xfff8, { 14,  17,  14,   4,   4,   4,   4,   4}},
 	{ 0x0890, 0xfff8, { 16,  25,  16,   8,   8,   8,   8,   4}},
 	{ 0x0898, 0xfff8, { 16,  25,  16,   8,   8,   8,   8,   4}},
 	{ 0x08a0, 0xfff8, { 18,  27,  18,   9,   9,   9,   9,   4}},
 	{ 0x08a8, 0xfff8, { 20,  29,  20,   9,   9,   9,   9,   4}},
-	{ 0x08b0, 0xfff8, { 22,  31,  22,  11,  11,  11,  11,   4}},
+	{ 0x08b0, 0xfff8, { 22,  31,  22, 255, 255, 255, 255, 255}},
+	{ 0x08b0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x08b0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x08c0, 0xfff8, { 12,  17,  12,   4,   4,   4,   4,   4}},
 	{ 0x08d0, 0xfff8, { 16,  25,  16,   8,   8,   8,   8,   4}},
 	{ 0x08d8, 0xfff8, { 16,  25,  16,   8,   8,   8,   8,   4}},
 	{ 0x08e0, 0xfff8, { 18,  27,  18,   9,   9,   9,   9,   4}},
 	{ 0x08e8, 0xfff8, { 20,  29,  20,   9,   9,   9,   9,   4}},
-	{ 0x08f0, 0xfff8, { 22,  31,  22,  11,  11,  11,  11,   4}},
+	{ 0x08f0, 0xfff8, { 22,  31,  22, 255, 255, 255, 255, 255}},
+	{ 0x08f0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x08f0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0a00, 0xfff8, {  8,  14,   8,   2,   2,   2,   2,   2}},
 	{ 0x0a10, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0a18, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0a20, 0xfff8, { 18,  24,  18,   9,   9,   9,   9,   4}},
 	{ 0x0a28, 0xfff8, { 20,  26,  20,   9,   9,   9,   9,   4}},
-	{ 0x0a30, 0xfff8, { 22,  28,  22,  11,  11,  11,  11,   4}},
+	{ 0x0a30, 0xfff8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x0a30, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0a30, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0a40, 0xfff8, {  8,  14,   8,   2,   2,   2,   2,   2}},
-	{ 0x0a50, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
-	{ 0x0a58, 0xfff8, { 16,  22,  16,   8,   8,   8,   8,   4}},
-	{ 0x0a60, 0xfff8, { 18,  24,  18,   9,   9,   9,   9,   4}},
-	{ 0x0a68, 0xfff8, { 20,  26,  20,   9,   9,   9,   9,   4}},
-	{ 0x0a70, 0xfff8, { 22,  28,  22,  11,  11,  11,  11,   4}},
+	{ 0x0a50, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x0a50, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0a50, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0a58, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x0a58, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0a58, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0a60, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x0a60, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0a60, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x0a68, 0xfff8, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0a68, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0a68, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x0a70, 0xfff8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x0a70, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0a70, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0a80, 0xfff8, { 16,  18,  14,   2,   2,   2,   2,   2}},
-	{ 0x0a90, 0xfff8, { 28,  34,  28,   8,   8,   8,   8,   4}},
-	{ 0x0a98, 0xfff8, { 28,  34,  28,   8,   8,   8,   8,   4}},
-	{ 0x0aa0, 0xfff8, { 30,  36,  30,   9,   9,   9,   9,   4}},
-	{ 0x0aa8, 0xfff8, { 32,  38,  32,   9,   9,   9,   9,   4}},
-	{ 0x0ab0, 0xfff8, { 34,  40,  34,  11,  11,  11,  11,   4}},
+	{ 0x0a90, 0xfff8, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x0a90, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0a90, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0a98, 0xfff8, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x0a98, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0a98, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0aa0, 0xfff8, { 30,  36,  30, 255, 255, 255, 255, 255}},
+	{ 0x0aa0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0aa0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x0aa8, 0xfff8, { 32,  38,  32, 255, 255, 255, 255, 255}},
+	{ 0x0aa8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0aa8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x0ab0, 0xfff8, { 34,  40,  34, 255, 255, 255, 255, 255}},
+	{ 0x0ab0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x0ab0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x0ad0, 0xfff8, {255, 255, 255,  16,  16,  16,  16,  12}},
 	{ 0x0ad8, 0xfff8, {255, 255, 255,  16,  16,  16,  16,  12}},
 	{ 0x0ae0, 0xfff8, {255, 255, 255,  17,  17,  17,  17,  12}},
 	{ 0x0ae8, 0xfff8, {255, 255, 255,  17,  17,  17,  17,  12}},
-	{ 0x0af0, 0xfff8, {255, 255, 255,  19,  19,  19,  19,  12}},
+	{ 0x0af0, 0xfff8, {255, 255, 255,  19,  19, 255,  19, 255}},
+	{ 0x0af0, 0xfff8, {255, 255, 255, 255, 255,  19, 255,  12}},
 	{ 0x0c00, 0xfff8, {  8,  14,   8,   2,   2,   2,   2,   2}},
 	{ 0x0c10, 0xfff8, { 12,  18,  12,   6,   6,   6,   6,   2}},
 	{ 0x0c18, 0xfff8, { 12,  18,  12,   6,   6,   6,   6,   2}},
 	{ 0x0c20, 0xfff8, { 14,  20,  14,   7,   7,   7,   7,   2}},
 	{ 0x0c28, 0xfff8, { 16,  22,  16,   7,   7,   7,   7,   2}},
-	{ 0x0c30, 0xfff8, { 18,  24,  18,   9,   9,   9,   9,   2}},
+	{ 0x0c30, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x0c30, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0c30, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x0c40, 0xfff8, {  8,  14,   8,   2,   2,   2,   2,   2}},
-	{ 0x0c50, 0xfff8, { 12,  18,  12,   6,   6,   6,   6,   2}},
-	{ 0x0c58, 0xfff8, { 12,  18,  12,   6,   6,   6,   6,   2}},
-	{ 0x0c60, 0xfff8, { 14,  20,  14,   7,   7,   7,   7,   2}},
-	{ 0x0c68, 0xfff8, { 16,  22,  16,   7,   7,   7,   7,   2}},
-	{ 0x0c70, 0xfff8, { 18,  24,  18,   9,   9,   9,   9,   2}},
+	{ 0x0c50, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0x0c50, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x0c50, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x0c58, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0x0c58, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x0c58, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x0c60, 0xfff8, { 14,  20,  14, 255, 255, 255, 255, 255}},
+	{ 0x0c60, 0xfff8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x0c60, 0xfff8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x0c68, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x0c68, 0xfff8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x0c68, 0xfff8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x0c70, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x0c70, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0c70, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x0c80, 0xfff8, { 14,  18,  12,   2,   2,   2,   2,   2}},
-	{ 0x0c90, 0xfff8, { 20,  26,  20,   6,   6,   6,   6,   2}},
-	{ 0x0c98, 0xfff8, { 20,  26,  20,   6,   6,   6,   6,   2}},
-	{ 0x0ca0, 0xfff8, { 22,  28,  22,   7,   7,   7,   7,   2}},
-	{ 0x0ca8, 0xfff8, { 24,  30,  24,   7,   7,   7,   7,   2}},
-	{ 0x0cb0, 0xfff8, { 26,  32,  26,   9,   9,   9,   9,   2}},
-	{ 0x0cd0, 0xfff8, {255, 255, 255,  16,  16,  16,  16,  12}},
-	{ 0x0cd8, 0xfff8, {255, 255, 255,  16,  16,  16,  16,  12}},
-	{ 0x0ce0, 0xfff8, {255, 255, 255,  17,  17,  17,  17,  12}},
-	{ 0x0ce8, 0xfff8, {255, 255, 255,  17,  17,  17,  17,  12}},
-	{ 0x0cf0, 0xfff8, {255, 255, 255,  19,  19,  19,  19,  12}},
+	{ 0x0c90, 0xfff8, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0c90, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x0c90, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x0c98, 0xfff8, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0c98, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x0c98, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x0ca0, 0xfff8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x0ca0, 0xfff8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x0ca0, 0xfff8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x0ca8, 0xfff8, { 24,  30,  24, 255, 255, 255, 255, 255}},
+	{ 0x0ca8, 0xfff8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x0ca8, 0xfff8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x0cb0, 0xfff8, { 26,  32,  26, 255, 255, 255, 255, 255}},
+	{ 0x0cb0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0cb0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   2}},
+	{ 0x0cd0, 0xfff8, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x0cd0, 0xfff8, {255, 255, 255, 255, 255,  16, 255,  12}},
+	{ 0x0cd8, 0xfff8, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x0cd8, 0xfff8, {255, 255, 255, 255, 255,  16, 255,  12}},
+	{ 0x0ce0, 0xfff8, {255, 255, 255,  17,  17, 255,  17, 255}},
+	{ 0x0ce0, 0xfff8, {255, 255, 255, 255, 255,  17, 255,  12}},
+	{ 0x0ce8, 0xfff8, {255, 255, 255,  17,  17, 255,  17, 255}},
+	{ 0x0ce8, 0xfff8, {255, 255, 255, 255, 255,  17, 255,  12}},
+	{ 0x0cf0, 0xfff8, {255, 255, 255,  19,  19, 255,  19, 255}},
+	{ 0x0cf0, 0xfff8, {255, 255, 255, 255, 255,  19, 255,  12}},
 	{ 0x0e10, 0xfff8, {255, 255,  18, 255,   9,   9,   9,   5}},
 	{ 0x0e10, 0xfff8, {255, 255, 255,   9, 255, 255, 255, 255}},
 	{ 0x0e18, 0xfff8, {255, 255,  18, 255,   9,   9,   9,   5}},
@@ -34421,115 +38420,238 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x0e20, 0xfff8, {255, 255, 255,  10, 255, 255, 255, 255}},
 	{ 0x0e28, 0xfff8, {255, 255,  26, 255,  10,  10,  10,   5}},
 	{ 0x0e28, 0xfff8, {255, 255, 255,  10, 255, 255, 255, 255}},
-	{ 0x0e30, 0xfff8, {255, 255,  30, 255,  12,  12,  12,   5}},
+	{ 0x0e30, 0xfff8, {255, 255,  30, 255, 255, 255, 255, 255}},
+	{ 0x0e30, 0xfff8, {255, 255, 255, 255,  12, 255,  12, 255}},
+	{ 0x0e30, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   5}},
 	{ 0x0e30, 0xfff8, {255, 255, 255,  12, 255, 255, 255, 255}},
-	{ 0x0e50, 0xfff8, {255, 255,  18, 255,   9,   9,   9,   5}},
+	{ 0x0e50, 0xfff8, {255, 255,  18, 255, 255, 255, 255, 255}},
+	{ 0x0e50, 0xfff8, {255, 255, 255, 255,   9, 255,   9, 255}},
+	{ 0x0e50, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
 	{ 0x0e50, 0xfff8, {255, 255, 255,   9, 255, 255, 255, 255}},
-	{ 0x0e58, 0xfff8, {255, 255,  18, 255,   9,   9,   9,   5}},
+	{ 0x0e58, 0xfff8, {255, 255,  18, 255, 255, 255, 255, 255}},
+	{ 0x0e58, 0xfff8, {255, 255, 255, 255,   9, 255,   9, 255}},
+	{ 0x0e58, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
 	{ 0x0e58, 0xfff8, {255, 255, 255,   9, 255, 255, 255, 255}},
-	{ 0x0e60, 0xfff8, {255, 255,  20, 255,  10,  10,  10,   5}},
+	{ 0x0e60, 0xfff8, {255, 255,  20, 255, 255, 255, 255, 255}},
+	{ 0x0e60, 0xfff8, {255, 255, 255, 255,  10, 255,  10, 255}},
+	{ 0x0e60, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
 	{ 0x0e60, 0xfff8, {255, 255, 255,  10, 255, 255, 255, 255}},
-	{ 0x0e68, 0xfff8, {255, 255,  26, 255,  10,  10,  10,   5}},
+	{ 0x0e68, 0xfff8, {255, 255,  26, 255, 255, 255, 255, 255}},
+	{ 0x0e68, 0xfff8, {255, 255, 255, 255,  10, 255,  10, 255}},
+	{ 0x0e68, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
 	{ 0x0e68, 0xfff8, {255, 255, 255,  10, 255, 255, 255, 255}},
-	{ 0x0e70, 0xfff8, {255, 255,  30, 255,  12,  12,  12,   5}},
+	{ 0x0e70, 0xfff8, {255, 255,  30, 255, 255, 255, 255, 255}},
+	{ 0x0e70, 0xfff8, {255, 255, 255, 255,  12, 255,  12, 255}},
+	{ 0x0e70, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   5}},
 	{ 0x0e70, 0xfff8, {255, 255, 255,  12, 255, 255, 255, 255}},
-	{ 0x0e90, 0xfff8, {255, 255,  22, 255,   9,   9,   9,   5}},
+	{ 0x0e90, 0xfff8, {255, 255,  22, 255, 255, 255, 255, 255}},
+	{ 0x0e90, 0xfff8, {255, 255, 255, 255,   9, 255,   9, 255}},
+	{ 0x0e90, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
 	{ 0x0e90, 0xfff8, {255, 255, 255,   9, 255, 255, 255, 255}},
-	{ 0x0e98, 0xfff8, {255, 255,  22, 255,   9,   9,   9,   5}},
+	{ 0x0e98, 0xfff8, {255, 255,  22, 255, 255, 255, 255, 255}},
+	{ 0x0e98, 0xfff8, {255, 255, 255, 255,   9, 255,   9, 255}},
+	{ 0x0e98, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
 	{ 0x0e98, 0xfff8, {255, 255, 255,   9, 255, 255, 255, 255}},
-	{ 0x0ea0, 0xfff8, {255, 255,  28, 255,  10,  10,  10,   5}},
+	{ 0x0ea0, 0xfff8, {255, 255,  28, 255, 255, 255, 255, 255}},
+	{ 0x0ea0, 0xfff8, {255, 255, 255, 255,  10, 255,  10, 255}},
+	{ 0x0ea0, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
 	{ 0x0ea0, 0xfff8, {255, 255, 255,  10, 255, 255, 255, 255}},
-	{ 0x0ea8, 0xfff8, {255, 255,  32, 255,  10,  10,  10,   5}},
+	{ 0x0ea8, 0xfff8, {255, 255,  32, 255, 255, 255, 255, 255}},
+	{ 0x0ea8, 0xfff8, {255, 255, 255, 255,  10, 255,  10, 255}},
+	{ 0x0ea8, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
 	{ 0x0ea8, 0xfff8, {255, 255, 255,  10, 255, 255, 255, 255}},
-	{ 0x0eb0, 0xfff8, {255, 255,  36, 255,  12,  12,  12,   5}},
+	{ 0x0eb0, 0xfff8, {255, 255,  36, 255, 255, 255, 255, 255}},
+	{ 0x0eb0, 0xfff8, {255, 255, 255, 255,  12, 255,  12, 255}},
+	{ 0x0eb0, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   5}},
 	{ 0x0eb0, 0xfff8, {255, 255, 255,  12, 255, 255, 255, 255}},
-	{ 0x0ed0, 0xfff8, {255, 255, 255,  16,  16,  16,  16,  12}},
-	{ 0x0ed8, 0xfff8, {255, 255, 255,  16,  16,  16,  16,  12}},
-	{ 0x0ee0, 0xfff8, {255, 255, 255,  17,  17,  17,  17,  12}},
-	{ 0x0ee8, 0xfff8, {255, 255, 255,  17,  17,  17,  17,  12}},
-	{ 0x0ef0, 0xfff8, {255, 255, 255,  19,  19,  19,  19,  12}},
+	{ 0x0ed0, 0xfff8, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x0ed0, 0xfff8, {255, 255, 255, 255, 255,  16, 255,  12}},
+	{ 0x0ed8, 0xfff8, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x0ed8, 0xfff8, {255, 255, 255, 255, 255,  16, 255,  12}},
+	{ 0x0ee0, 0xfff8, {255, 255, 255,  17,  17, 255,  17, 255}},
+	{ 0x0ee0, 0xfff8, {255, 255, 255, 255, 255,  17, 255,  12}},
+	{ 0x0ee8, 0xfff8, {255, 255, 255,  17,  17, 255,  17, 255}},
+	{ 0x0ee8, 0xfff8, {255, 255, 255, 255, 255,  17, 255,  12}},
+	{ 0x0ef0, 0xfff8, {255, 255, 255,  19,  19, 255,  19, 255}},
+	{ 0x0ef0, 0xfff8, {255, 255, 255, 255, 255,  19, 255,  12}},
 	{ 0x11c0, 0xfff8, { 12,  15,  12,   4,   4,   4,   4,   4}},
 	{ 0x11d0, 0xfff8, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x11d8, 0xfff8, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x11e0, 0xfff8, { 18,  21,  18,   9,   9,   9,   9,   4}},
 	{ 0x11e8, 0xfff8, { 20,  23,  20,   9,   9,   9,   9,   4}},
-	{ 0x11f0, 0xfff8, { 22,  25,  22,  11,  11,  11,  11,   4}},
+	{ 0x11f0, 0xfff8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x11f0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x11f0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x13c0, 0xfff8, { 16,  19,  16,   6,   6,   6,   6,   6}},
 	{ 0x13d0, 0xfff8, { 20,  23,  20,  10,  10,  10,  10,   6}},
 	{ 0x13d8, 0xfff8, { 20,  23,  20,  10,  10,  10,  10,   6}},
 	{ 0x13e0, 0xfff8, { 22,  25,  22,  11,  11,  11,  11,   6}},
 	{ 0x13e8, 0xfff8, { 24,  27,  24,  11,  11,  11,  11,   6}},
-	{ 0x13f0, 0xfff8, { 26,  29,  26,  13,  13,  13,  13,   6}},
+	{ 0x13f0, 0xfff8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x13f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x13f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x1ec0, 0xfff8, {  8,  11,   8,   4,   4,   4,   4,   4}},
 	{ 0x1ed0, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x1ed8, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x1ee0, 0xfff8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x1ee8, 0xfff8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x1ef0, 0xfff8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x1ef0, 0xfff8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x1ef0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x1ef0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x1f00, 0xfff8, {  8,  14,   8,   5,   5,   5,   5,   5}},
 	{ 0x1f10, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   5}},
 	{ 0x1f18, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   5}},
 	{ 0x1f20, 0xfff8, { 14,  20,  14,  10,  10,  10,  10,   5}},
 	{ 0x1f28, 0xfff8, { 16,  22,  16,  10,  10,  10,  10,   5}},
-	{ 0x1f30, 0xfff8, { 18,  24,  18,  12,  12,  12,  12,   5}},
-	{ 0x21c0, 0xfff8, { 16,  19,  16,   4,   4,   4,   4,   4}},
-	{ 0x21c8, 0xfff8, { 16,  19,  16,   4,   4,   4,   4,   4}},
-	{ 0x21d0, 0xfff8, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x21d8, 0xfff8, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x21e0, 0xfff8, { 26,  29,  26,   9,   9,   9,   9,   4}},
-	{ 0x21e8, 0xfff8, { 28,  31,  28,   9,   9,   9,   9,   4}},
-	{ 0x21f0, 0xfff8, { 30,  33,  30,  11,  11,  11,  11,   4}},
-	{ 0x23c0, 0xfff8, { 20,  23,  20,   6,   6,   6,   6,   6}},
-	{ 0x23c8, 0xfff8, { 20,  23,  20,   6,   6,   6,   6,   6}},
-	{ 0x23d0, 0xfff8, { 28,  31,  28,  10,  10,  10,  10,   6}},
-	{ 0x23d8, 0xfff8, { 28,  31,  28,  10,  10,  10,  10,   6}},
-	{ 0x23e0, 0xfff8, { 30,  33,  30,  11,  11,  11,  11,   6}},
-	{ 0x23e8, 0xfff8, { 32,  35,  32,  11,  11,  11,  11,   6}},
-	{ 0x23f0, 0xfff8, { 34,  37,  34,  13,  13,  13,  13,   6}},
-	{ 0x31c0, 0xfff8, { 12,  15,  12,   4,   4,   4,   4,   4}},
-	{ 0x31c8, 0xfff8, { 12,  15,  12,   4,   4,   4,   4,   4}},
-	{ 0x31d0, 0xfff8, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0x31d8, 0xfff8, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0x31e0, 0xfff8, { 18,  21,  18,   9,   9,   9,   9,   4}},
-	{ 0x31e8, 0xfff8, { 20,  23,  20,   9,   9,   9,   9,   4}},
-	{ 0x31f0, 0xfff8, { 22,  25,  22,  11,  11,  11,  11,   4}},
-	{ 0x33c0, 0xfff8, { 16,  19,  16,   6,   6,   6,   6,   6}},
-	{ 0x33c8, 0xfff8, { 16,  19,  16,   6,   6,   6,   6,   6}},
-	{ 0x33d0, 0xfff8, { 20,  23,  20,  10,  10,  10,  10,   6}},
-	{ 0x33d8, 0xfff8, { 20,  23,  20,  10,  10,  10,  10,   6}},
-	{ 0x33e0, 0xfff8, { 22,  25,  22,  11,  11,  11,  11,   6}},
-	{ 0x33e8, 0xfff8, { 24,  27,  24,  11,  11,  11,  11,   6}},
-	{ 0x33f0, 0xfff8, { 26,  29,  26,  13,  13,  13,  13,   6}},
+	{ 0x1f30, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x1f30, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x1f30, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0x21c0, 0xfff8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x21c0, 0xfff8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x21c0, 0xfff8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x21c8, 0xfff8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x21c8, 0xfff8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x21c8, 0xfff8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x21d0, 0xfff8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x21d0, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x21d0, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x21d8, 0xfff8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x21d8, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x21d8, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x21e0, 0xfff8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x21e0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x21e0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x21e8, 0xfff8, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x21e8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x21e8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x21f0, 0xfff8, { 30,  33,  30, 255, 255, 255, 255, 255}},
+	{ 0x21f0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x21f0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x23c0, 0xfff8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x23c0, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x23c0, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   6}},
+	{ 0x23c8, 0xfff8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x23c8, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x23c8, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   6}},
+	{ 0x23d0, 0xfff8, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x23d0, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x23d0, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0x23d8, 0xfff8, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x23d8, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x23d8, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0x23e0, 0xfff8, { 30,  33,  30, 255, 255, 255, 255, 255}},
+	{ 0x23e0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x23e0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   6}},
+	{ 0x23e8, 0xfff8, { 32,  35,  32, 255, 255, 255, 255, 255}},
+	{ 0x23e8, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x23e8, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   6}},
+	{ 0x23f0, 0xfff8, { 34,  37,  34, 255, 255, 255, 255, 255}},
+	{ 0x23f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x23f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
+	{ 0x31c0, 0xfff8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x31c0, 0xfff8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x31c0, 0xfff8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x31c8, 0xfff8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x31c8, 0xfff8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x31c8, 0xfff8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x31d0, 0xfff8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x31d0, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x31d0, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x31d8, 0xfff8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x31d8, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x31d8, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x31e0, 0xfff8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x31e0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x31e0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x31e8, 0xfff8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x31e8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x31e8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x31f0, 0xfff8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x31f0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x31f0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x33c0, 0xfff8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x33c0, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x33c0, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   6}},
+	{ 0x33c8, 0xfff8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x33c8, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x33c8, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   6}},
+	{ 0x33d0, 0xfff8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x33d0, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x33d0, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0x33d8, 0xfff8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x33d8, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x33d8, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0x33e0, 0xfff8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x33e0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x33e0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   6}},
+	{ 0x33e8, 0xfff8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x33e8, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x33e8, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   6}},
+	{ 0x33f0, 0xfff8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x33f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x33f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x4000, 0xfff8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x4010, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x4018, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x4020, 0xfff8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x4028, 0xfff8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x4030, 0xfff8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x4030, 0xfff8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x4030, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x4030, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x4040, 0xfff8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0x4050, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x4058, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x4060, 0xfff8, { 14,  17,  14,   9,   9,   9,   9,   4}},
-	{ 0x4068, 0xfff8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x4070, 0xfff8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x4050, 0xfff8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x4050, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4050, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x4058, 0xfff8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x4058, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4058, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x4060, 0xfff8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x4060, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4060, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x4068, 0xfff8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x4068, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4068, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x4070, 0xfff8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x4070, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x4070, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x4080, 0xfff8, {  6,   7,   6,   2,   2,   2,   2,   2}},
-	{ 0x4090, 0xfff8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x4098, 0xfff8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x40a0, 0xfff8, { 22,  25,  22,   9,   9,   9,   9,   4}},
-	{ 0x40a8, 0xfff8, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0x40b0, 0xfff8, { 26,  29,  26,  11,  11,  11,  11,   4}},
+	{ 0x4090, 0xfff8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x4090, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4090, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x4098, 0xfff8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x4098, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4098, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x40a0, 0xfff8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x40a0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x40a0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x40a8, 0xfff8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x40a8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x40a8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x40b0, 0xfff8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x40b0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x40b0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x40c0, 0xfff8, {  6,   7, 255, 255, 255, 255, 255, 255}},
 	{ 0x40c0, 0xfff8, {255, 255,   4,   8,   8,   8,   8,   8}},
 	{ 0x40d0, 0xfff8, { 12,  15, 255, 255, 255, 255, 255, 255}},
-	{ 0x40d0, 0xfff8, {255, 255,  12,  12,  12,  12,  12,   8}},
+	{ 0x40d0, 0xfff8, {255, 255,  12, 255, 255, 255, 255, 255}},
+	{ 0x40d0, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x40d0, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   8}},
 	{ 0x40d8, 0xfff8, { 12,  15, 255, 255, 255, 255, 255, 255}},
-	{ 0x40d8, 0xfff8, {255, 255,  12,  12,  12,  12,  12,   8}},
+	{ 0x40d8, 0xfff8, {255, 255,  12, 255, 255, 255, 255, 255}},
+	{ 0x40d8, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x40d8, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   8}},
 	{ 0x40e0, 0xfff8, { 14,  17, 255, 255, 255, 255, 255, 255}},
-	{ 0x40e0, 0xfff8, {255, 255,  14,  13,  13,  13,  13,   8}},
+	{ 0x40e0, 0xfff8, {255, 255,  14, 255, 255, 255, 255, 255}},
+	{ 0x40e0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x40e0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   8}},
 	{ 0x40e8, 0xfff8, { 16,  19, 255, 255, 255, 255, 255, 255}},
-	{ 0x40e8, 0xfff8, {255, 255,  16,  13,  13,  13,  13,   8}},
+	{ 0x40e8, 0xfff8, {255, 255,  16, 255, 255, 255, 255, 255}},
+	{ 0x40e8, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x40e8, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   8}},
 	{ 0x40f0, 0xfff8, { 18,  21, 255, 255, 255, 255, 255, 255}},
-	{ 0x40f0, 0xfff8, {255, 255,  18,  15,  15,  15,  15,   8}},
+	{ 0x40f0, 0xfff8, {255, 255,  18, 255, 255, 255, 255, 255}},
+	{ 0x40f0, 0xfff8, {255, 255, 255,  15,  15, 255,  15, 255}},
+	{ 0x40f0, 0xfff8, {255, 255, 255, 255, 255,  15, 255,   8}},
 	{ 0x4200, 0xfff8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x4210, 0xfff8, { 12, 255, 255, 255, 255, 255, 255, 255}},
 	{ 0x4210, 0xfff8, {255,  15,   8,   8,   8,   8,   8,   4}},
@@ -34540,275 +38662,498 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x4228, 0xfff8, { 16, 255, 255, 255, 255, 255, 255, 255}},
 	{ 0x4228, 0xfff8, {255,  19,  12,   9,   9,   9,   9,   4}},
 	{ 0x4230, 0xfff8, { 18, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x4230, 0xfff8, {255,  21,  14,  11,  11,  11,  11,   4}},
+	{ 0x4230, 0xfff8, {255,  21,  14, 255, 255, 255, 255, 255}},
+	{ 0x4230, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x4230, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x4240, 0xfff8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x4250, 0xfff8, { 12, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x4250, 0xfff8, {255,  15,   8,   8,   8,   8,   8,   4}},
+	{ 0x4250, 0xfff8, {255,  15,   8, 255, 255, 255, 255, 255}},
+	{ 0x4250, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4250, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x4258, 0xfff8, { 12, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x4258, 0xfff8, {255,  15,   8,   8,   8,   8,   8,   4}},
+	{ 0x4258, 0xfff8, {255,  15,   8, 255, 255, 255, 255, 255}},
+	{ 0x4258, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4258, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x4260, 0xfff8, { 14, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x4260, 0xfff8, {255,  17,  10,   9,   9,   9,   9,   4}},
+	{ 0x4260, 0xfff8, {255,  17,  10, 255, 255, 255, 255, 255}},
+	{ 0x4260, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4260, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
 	{ 0x4268, 0xfff8, { 16, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x4268, 0xfff8, {255,  19,  12,   9,   9,   9,   9,   4}},
+	{ 0x4268, 0xfff8, {255,  19,  12, 255, 255, 255, 255, 255}},
+	{ 0x4268, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4268, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
 	{ 0x4270, 0xfff8, { 18, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x4270, 0xfff8, {255,  21,  14,  11,  11,  11,  11,   4}},
+	{ 0x4270, 0xfff8, {255,  21,  14, 255, 255, 255, 255, 255}},
+	{ 0x4270, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x4270, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x4280, 0xfff8, {  6,   7,   6,   2,   2,   2,   2,   2}},
 	{ 0x4290, 0xfff8, { 20, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x4290, 0xfff8, {255,  23,  12,   8,   8,   8,   8,   4}},
+	{ 0x4290, 0xfff8, {255,  23,  12, 255, 255, 255, 255, 255}},
+	{ 0x4290, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4290, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x4298, 0xfff8, { 20, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x4298, 0xfff8, {255,  23,  12,   8,   8,   8,   8,   4}},
+	{ 0x4298, 0xfff8, {255,  23,  12, 255, 255, 255, 255, 255}},
+	{ 0x4298, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4298, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x42a0, 0xfff8, { 22, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x42a0, 0xfff8, {255,  25,  14,   9,   9,   9,   9,   4}},
+	{ 0x42a0, 0xfff8, {255,  25,  14, 255, 255, 255, 255, 255}},
+	{ 0x42a0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x42a0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
 	{ 0x42a8, 0xfff8, { 24, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x42a8, 0xfff8, {255,  27,  16,   9,   9,   9,   9,   4}},
+	{ 0x42a8, 0xfff8, {255,  27,  16, 255, 255, 255, 255, 255}},
+	{ 0x42a8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x42a8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
 	{ 0x42b0, 0xfff8, { 26, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x42b0, 0xfff8, {255,  29,  20,  11,  11,  11,  11,   4}},
+	{ 0x42b0, 0xfff8, {255,  29,  20, 255, 255, 255, 255, 255}},
+	{ 0x42b0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x42b0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x42c0, 0xfff8, {255, 255,   4,   4,   4,   4,   4,   4}},
-	{ 0x42d0, 0xfff8, {255, 255,  12,   8,   8,   8,   8,   4}},
-	{ 0x42d8, 0xfff8, {255, 255,  12,   8,   8,   8,   8,   4}},
-	{ 0x42e0, 0xfff8, {255, 255,  14,   9,   9,   9,   9,   4}},
-	{ 0x42e8, 0xfff8, {255, 255,  16,   9,   9,   9,   9,   4}},
-	{ 0x42f0, 0xfff8, {255, 255,  18,  11,  11,  11,  11,   4}},
+	{ 0x42d0, 0xfff8, {255, 255,  12, 255, 255, 255, 255, 255}},
+	{ 0x42d0, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x42d0, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x42d8, 0xfff8, {255, 255,  12, 255, 255, 255, 255, 255}},
+	{ 0x42d8, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x42d8, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x42e0, 0xfff8, {255, 255,  14, 255, 255, 255, 255, 255}},
+	{ 0x42e0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x42e0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x42e8, 0xfff8, {255, 255,  16, 255, 255, 255, 255, 255}},
+	{ 0x42e8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x42e8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x42f0, 0xfff8, {255, 255,  18, 255, 255, 255, 255, 255}},
+	{ 0x42f0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x42f0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x4400, 0xfff8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x4410, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x4418, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x4420, 0xfff8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x4428, 0xfff8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x4430, 0xfff8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x4430, 0xfff8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x4430, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x4430, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x4440, 0xfff8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0x4450, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x4458, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x4460, 0xfff8, { 14,  17,  14,   9,   9,   9,   9,   4}},
-	{ 0x4468, 0xfff8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x4470, 0xfff8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x4450, 0xfff8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x4450, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4450, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x4458, 0xfff8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x4458, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4458, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x4460, 0xfff8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x4460, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4460, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x4468, 0xfff8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x4468, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4468, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x4470, 0xfff8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x4470, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x4470, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x4480, 0xfff8, {  6,   7,   6,   2,   2,   2,   2,   2}},
-	{ 0x4490, 0xfff8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x4498, 0xfff8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x44a0, 0xfff8, { 22,  25,  22,   9,   9,   9,   9,   4}},
-	{ 0x44a8, 0xfff8, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0x44b0, 0xfff8, { 26,  29,  26,  11,  11,  11,  11,   4}},
+	{ 0x4490, 0xfff8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x4490, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4490, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x4498, 0xfff8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x4498, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4498, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x44a0, 0xfff8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x44a0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x44a0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x44a8, 0xfff8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x44a8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x44a8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x44b0, 0xfff8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x44b0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x44b0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x44c0, 0xfff8, { 12,  10,  12,   4,   4,   4,   4,   4}},
-	{ 0x44d0, 0xfff8, { 16,  14,  16,   8,   8,   8,   8,   4}},
-	{ 0x44d8, 0xfff8, { 16,  14,  16,   8,   8,   8,   8,   4}},
-	{ 0x44e0, 0xfff8, { 18,  16,  18,   9,   9,   9,   9,   4}},
-	{ 0x44e8, 0xfff8, { 20,  18,  20,   9,   9,   9,   9,   4}},
-	{ 0x44f0, 0xfff8, { 22,  20,  22,  11,  11,  11,  11,   4}},
+	{ 0x44d0, 0xfff8, { 16,  14,  16, 255, 255, 255, 255, 255}},
+	{ 0x44d0, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x44d0, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x44d8, 0xfff8, { 16,  14,  16, 255, 255, 255, 255, 255}},
+	{ 0x44d8, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x44d8, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x44e0, 0xfff8, { 18,  16,  18, 255, 255, 255, 255, 255}},
+	{ 0x44e0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x44e0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x44e8, 0xfff8, { 20,  18,  20, 255, 255, 255, 255, 255}},
+	{ 0x44e8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x44e8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x44f0, 0xfff8, { 22,  20,  22, 255, 255, 255, 255, 255}},
+	{ 0x44f0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x44f0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x4600, 0xfff8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x4610, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x4618, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x4620, 0xfff8, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x4628, 0xfff8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x4630, 0xfff8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x4630, 0xfff8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x4630, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x4630, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x4640, 0xfff8, {  4,   7,   4,   2,   2,   2,   2,   2}},
-	{ 0x4650, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x4658, 0xfff8, { 12,  15,  12,   8,   8,   8,   8,   4}},
-	{ 0x4660, 0xfff8, { 14,  17,  14,   9,   9,   9,   9,   4}},
-	{ 0x4668, 0xfff8, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x4670, 0xfff8, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x4650, 0xfff8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x4650, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4650, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x4658, 0xfff8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x4658, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4658, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x4660, 0xfff8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x4660, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4660, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x4668, 0xfff8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x4668, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4668, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x4670, 0xfff8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x4670, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x4670, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x4680, 0xfff8, {  6,   7,   6,   2,   2,   2,   2,   2}},
-	{ 0x4690, 0xfff8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x4698, 0xfff8, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x46a0, 0xfff8, { 22,  25,  22,   9,   9,   9,   9,   4}},
-	{ 0x46a8, 0xfff8, { 24,  27,  24,   9,   9,   9,   9,   4}},
-	{ 0x46b0, 0xfff8, { 26,  29,  26,  11,  11,  11,  11,   4}},
+	{ 0x4690, 0xfff8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x4690, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4690, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x4698, 0xfff8, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x4698, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4698, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x46a0, 0xfff8, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x46a0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x46a0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x46a8, 0xfff8, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x46a8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x46a8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x46b0, 0xfff8, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x46b0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x46b0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x46c0, 0xfff8, { 12,  10,  12,   8,   8,   8,   8,   8}},
-	{ 0x46d0, 0xfff8, { 16,  14,  16,  12,  12,  12,  12,   8}},
-	{ 0x46d8, 0xfff8, { 16,  14,  16,  12,  12,  12,  12,   8}},
-	{ 0x46e0, 0xfff8, { 18,  16,  18,  13,  13,  13,  13,   8}},
-	{ 0x46e8, 0xfff8, { 20,  18,  20,  13,  13,  13,  13,   8}},
-	{ 0x46f0, 0xfff8, { 22,  20,  22,  15,  15,  15,  15,   8}},
+	{ 0x46d0, 0xfff8, { 16,  14,  16, 255, 255, 255, 255, 255}},
+	{ 0x46d0, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x46d0, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x46d8, 0xfff8, { 16,  14,  16, 255, 255, 255, 255, 255}},
+	{ 0x46d8, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x46d8, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x46e0, 0xfff8, { 18,  16,  18, 255, 255, 255, 255, 255}},
+	{ 0x46e0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x46e0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   8}},
+	{ 0x46e8, 0xfff8, { 20,  18,  20, 255, 255, 255, 255, 255}},
+	{ 0x46e8, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x46e8, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   8}},
+	{ 0x46f0, 0xfff8, { 22,  20,  22, 255, 255, 255, 255, 255}},
+	{ 0x46f0, 0xfff8, {255, 255, 255,  15,  15, 255,  15, 255}},
+	{ 0x46f0, 0xfff8, {255, 255, 255, 255, 255,  15, 255,   8}},
 	{ 0x4800, 0xfff8, {  6,  10,   6,   6,   6,   6,   6,   6}},
-	{ 0x4808, 0xfff8, {255, 255, 255,   6,   6,   6,   6,   6}},
+	{ 0x4808, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x4808, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   6}},
 	{ 0x4810, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x4818, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x4820, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x4828, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x4830, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x4830, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x4830, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x4830, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x4840, 0xfff8, {  4,   7,   4,   4,   4,   4,   4,   4}},
 	{ 0x4848, 0xfff8, {255, 255,  10, 255, 255, 255, 255, 255}},
 	{ 0x4848, 0xfff8, {255, 255, 255,  10,  10,  10,  10,  10}},
-	{ 0x4850, 0xfff8, { 12,  24,  12,   9,   9,   9,   9,   5}},
-	{ 0x4868, 0xfff8, { 16,  28,  16,  10,  10,  10,  10,   5}},
-	{ 0x4870, 0xfff8, { 20,  32,  20,  12,  12,  12,  12,   5}},
+	{ 0x4850, 0xfff8, { 12,  24,  12, 255, 255, 255, 255, 255}},
+	{ 0x4850, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4850, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x4868, 0xfff8, { 16,  28,  16, 255, 255, 255, 255, 255}},
+	{ 0x4868, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x4868, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x4870, 0xfff8, { 20,  32,  20, 255, 255, 255, 255, 255}},
+	{ 0x4870, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4870, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   5}},
 	{ 0x4880, 0xfff8, {  4,   7,   4,   4,   4,   4,   4,   4}},
-	{ 0x4890, 0xfff8, {  8,  23,   8,   8,   8,   8,   8,   4}},
-	{ 0x48a0, 0xfff8, {  8,  23,   8,   4,   4,   4,   4,   4}},
-	{ 0x48a8, 0xfff8, { 12,  27,  12,   9,   9,   9,   9,   4}},
-	{ 0x48b0, 0xfff8, { 14,  29,  14,  11,  11,  11,  11,   4}},
+	{ 0x4890, 0xfff8, {  8,  23,   8, 255, 255, 255, 255, 255}},
+	{ 0x4890, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4890, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x48a0, 0xfff8, {  8,  23,   8, 255, 255, 255, 255, 255}},
+	{ 0x48a0, 0xfff8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x48a0, 0xfff8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x48a8, 0xfff8, { 12,  27,  12, 255, 255, 255, 255, 255}},
+	{ 0x48a8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x48a8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x48b0, 0xfff8, { 14,  29,  14, 255, 255, 255, 255, 255}},
+	{ 0x48b0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x48b0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x48c0, 0xfff8, {  4,   7,   4,   4,   4,   4,   4,   4}},
-	{ 0x48d0, 0xfff8, {  8,  23,   8,   8,   8,   8,   8,   4}},
-	{ 0x48e0, 0xfff8, {  8,  23,   8,   4,   4,   4,   4,   4}},
-	{ 0x48e8, 0xfff8, { 12,  27,  12,   9,   9,   9,   9,   4}},
-	{ 0x48f0, 0xfff8, { 14,  29,  14,  11,  11,  11,  11,   4}},
+	{ 0x48d0, 0xfff8, {  8,  23,   8, 255, 255, 255, 255, 255}},
+	{ 0x48d0, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x48d0, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x48e0, 0xfff8, {  8,  23,   8, 255, 255, 255, 255, 255}},
+	{ 0x48e0, 0xfff8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x48e0, 0xfff8, {255, 255, 255, 255, 255,   4, 255,   4}},
+	{ 0x48e8, 0xfff8, { 12,  27,  12, 255, 255, 255, 255, 255}},
+	{ 0x48e8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x48e8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x48f0, 0xfff8, { 14,  29,  14, 255, 255, 255, 255, 255}},
+	{ 0x48f0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x48f0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x49c0, 0xfff8, {255, 255, 255,   4,   4,   4,   4,   4}},
 	{ 0x4a00, 0xfff8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x4a10, 0xfff8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0x4a18, 0xfff8, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0x4a20, 0xfff8, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0x4a28, 0xfff8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x4a30, 0xfff8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x4a30, 0xfff8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x4a30, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4a30, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x4a40, 0xfff8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x4a48, 0xfff8, {255, 255, 255,   2,   2,   2,   2,   2}},
-	{ 0x4a50, 0xfff8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0x4a58, 0xfff8, {  8,  11,   8,   6,   6,   6,   6,   2}},
-	{ 0x4a60, 0xfff8, { 10,  13,  10,   7,   7,   7,   7,   2}},
-	{ 0x4a68, 0xfff8, { 12,  15,  12,   7,   7,   7,   7,   2}},
-	{ 0x4a70, 0xfff8, { 14,  17,  14,   9,   9,   9,   9,   2}},
+	{ 0x4a50, 0xfff8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x4a50, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x4a50, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x4a58, 0xfff8, {  8,  11,   8, 255, 255, 255, 255, 255}},
+	{ 0x4a58, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x4a58, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x4a60, 0xfff8, { 10,  13,  10, 255, 255, 255, 255, 255}},
+	{ 0x4a60, 0xfff8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x4a60, 0xfff8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x4a68, 0xfff8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x4a68, 0xfff8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x4a68, 0xfff8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x4a70, 0xfff8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x4a70, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4a70, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x4a80, 0xfff8, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x4a88, 0xfff8, {255, 255, 255,   2,   2,   2,   2,   2}},
-	{ 0x4a90, 0xfff8, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x4a98, 0xfff8, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x4aa0, 0xfff8, { 14,  17,  14,   7,   7,   7,   7,   2}},
-	{ 0x4aa8, 0xfff8, { 16,  19,  16,   7,   7,   7,   7,   2}},
-	{ 0x4ab0, 0xfff8, { 18,  21,  18,   9,   9,   9,   9,   2}},
+	{ 0x4a90, 0xfff8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x4a90, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x4a90, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x4a98, 0xfff8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x4a98, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x4a98, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x4aa0, 0xfff8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x4aa0, 0xfff8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x4aa0, 0xfff8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x4aa8, 0xfff8, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x4aa8, 0xfff8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x4aa8, 0xfff8, {255, 255, 255, 255, 255,   7, 255,   2}},
+	{ 0x4ab0, 0xfff8, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x4ab0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4ab0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   2}},
 	{ 0x4ac0, 0xfff8, {  4,  10,   4,   4,   4,   4,   4,   4}},
-	{ 0x4ad0, 0xfff8, { 18,  19,  18,  16,  16,  16,  16,  12}},
-	{ 0x4ad8, 0xfff8, { 18,  19,  18,  16,  16,  16,  16,  12}},
-	{ 0x4ae0, 0xfff8, { 20,  21,  20,  17,  17,  17,  17,  12}},
-	{ 0x4ae8, 0xfff8, { 22,  23,  22,  17,  17,  17,  17,  12}},
-	{ 0x4af0, 0xfff8, { 24,  25,  24,  19,  19,  19,  19,  12}},
+	{ 0x4ad0, 0xfff8, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0x4ad0, 0xfff8, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x4ad0, 0xfff8, {255, 255, 255, 255, 255,  16, 255,  12}},
+	{ 0x4ad8, 0xfff8, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0x4ad8, 0xfff8, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x4ad8, 0xfff8, {255, 255, 255, 255, 255,  16, 255,  12}},
+	{ 0x4ae0, 0xfff8, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0x4ae0, 0xfff8, {255, 255, 255,  17,  17, 255,  17, 255}},
+	{ 0x4ae0, 0xfff8, {255, 255, 255, 255, 255,  17, 255,  12}},
+	{ 0x4ae8, 0xfff8, { 22,  23,  22, 255, 255, 255, 255, 255}},
+	{ 0x4ae8, 0xfff8, {255, 255, 255,  17,  17, 255,  17, 255}},
+	{ 0x4ae8, 0xfff8, {255, 255, 255, 255, 255,  17, 255,  12}},
+	{ 0x4af0, 0xfff8, { 24,  25,  24, 255, 255, 255, 255, 255}},
+	{ 0x4af0, 0xfff8, {255, 255, 255,  19,  19, 255,  19, 255}},
+	{ 0x4af0, 0xfff8, {255, 255, 255, 255, 255,  19, 255,  12}},
 	{ 0x4c00, 0xfff8, {255, 255, 255,  43,  43,  43,  43,  43}},
-	{ 0x4c10, 0xfff8, {255, 255, 255,  47,  47,  47,  47,  43}},
-	{ 0x4c18, 0xfff8, {255, 255, 255,  47,  47,  47,  47,  43}},
-	{ 0x4c20, 0xfff8, {255, 255, 255,  48,  48,  48,  48,  43}},
-	{ 0x4c28, 0xfff8, {255, 255, 255,  48,  48,  48,  48,  43}},
-	{ 0x4c30, 0xfff8, {255, 255, 255,  50,  50,  50,  50,  43}},
+	{ 0x4c10, 0xfff8, {255, 255, 255,  47,  47, 255,  47, 255}},
+	{ 0x4c10, 0xfff8, {255, 255, 255, 255, 255,  47, 255,  43}},
+	{ 0x4c18, 0xfff8, {255, 255, 255,  47,  47, 255,  47, 255}},
+	{ 0x4c18, 0xfff8, {255, 255, 255, 255, 255,  47, 255,  43}},
+	{ 0x4c20, 0xfff8, {255, 255, 255,  48,  48, 255,  48, 255}},
+	{ 0x4c20, 0xfff8, {255, 255, 255, 255, 255,  48, 255,  43}},
+	{ 0x4c28, 0xfff8, {255, 255, 255,  48,  48, 255,  48, 255}},
+	{ 0x4c28, 0xfff8, {255, 255, 255, 255, 255,  48, 255,  43}},
+	{ 0x4c30, 0xfff8, {255, 255, 255,  50,  50, 255,  50, 255}},
+	{ 0x4c30, 0xfff8, {255, 255, 255, 255, 255,  50, 255,  43}},
 	{ 0x4c40, 0xfff8, {255, 255, 255,  84,  84,  84,  84,  84}},
-	{ 0x4c50, 0xfff8, {255, 255, 255,  88,  88,  88,  88,  84}},
-	{ 0x4c58, 0xfff8, {255, 255, 255,  88,  88,  88,  88,  84}},
-	{ 0x4c60, 0xfff8, {255, 255, 255,  89,  89,  89,  89,  84}},
-	{ 0x4c68, 0xfff8, {255, 255, 255,  89,  89,  89,  89,  84}},
-	{ 0x4c70, 0xfff8, {255, 255, 255,  91,  91,  91,  91,  84}},
-	{ 0x4c90, 0xfff8, { 12,  26,  12,  12,  12,  12,  12,   8}},
-	{ 0x4c98, 0xfff8, { 12,  26,  12,   8,   8,   8,   8,   8}},
-	{ 0x4ca8, 0xfff8, { 16,  30,  16,  13,  13,  13,  13,   8}},
-	{ 0x4cb0, 0xfff8, { 18,  32,  18,  15,  15,  15,  15,   8}},
-	{ 0x4cd0, 0xfff8, { 12,  26,  12,  12,  12,  12,  12,   8}},
-	{ 0x4cd8, 0xfff8, { 12,  26,  12,   8,   8,   8,   8,   8}},
-	{ 0x4ce8, 0xfff8, { 16,  30,  16,  13,  13,  13,  13,   8}},
-	{ 0x4cf0, 0xfff8, { 18,  32,  18,  15,  15,  15,  15,   8}},
-	{ 0x4e50, 0xfff8, { 16,  25,  16,   5,   5,   5,   5,   5}},
-	{ 0x4e58, 0xfff8, { 12,  15,  12,   6,   6,   6,   6,   6}},
+	{ 0x4c50, 0xfff8, {255, 255, 255,  88,  88, 255,  88, 255}},
+	{ 0x4c50, 0xfff8, {255, 255, 255, 255, 255,  88, 255,  84}},
+	{ 0x4c58, 0xfff8, {255, 255, 255,  88,  88, 255,  88, 255}},
+	{ 0x4c58, 0xfff8, {255, 255, 255, 255, 255,  88, 255,  84}},
+	{ 0x4c60, 0xfff8, {255, 255, 255,  89,  89, 255,  89, 255}},
+	{ 0x4c60, 0xfff8, {255, 255, 255, 255, 255,  89, 255,  84}},
+	{ 0x4c68, 0xfff8, {255, 255, 255,  89,  89, 255,  89, 255}},
+	{ 0x4c68, 0xfff8, {255, 255, 255, 255, 255,  89, 255,  84}},
+	{ 0x4c70, 0xfff8, {255, 255, 255,  91,  91, 255,  91, 255}},
+	{ 0x4c70, 0xfff8, {255, 255, 255, 255, 255,  91, 255,  84}},
+	{ 0x4c90, 0xfff8, { 12,  26,  12, 255, 255, 255, 255, 255}},
+	{ 0x4c90, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4c90, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x4c98, 0xfff8, { 12,  26,  12, 255, 255, 255, 255, 255}},
+	{ 0x4c98, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4c98, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   8}},
+	{ 0x4ca8, 0xfff8, { 16,  30,  16, 255, 255, 255, 255, 255}},
+	{ 0x4ca8, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x4ca8, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   8}},
+	{ 0x4cb0, 0xfff8, { 18,  32,  18, 255, 255, 255, 255, 255}},
+	{ 0x4cb0, 0xfff8, {255, 255, 255,  15,  15, 255,  15, 255}},
+	{ 0x4cb0, 0xfff8, {255, 255, 255, 255, 255,  15, 255,   8}},
+	{ 0x4cd0, 0xfff8, { 12,  26,  12, 255, 255, 255, 255, 255}},
+	{ 0x4cd0, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4cd0, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x4cd8, 0xfff8, { 12,  26,  12, 255, 255, 255, 255, 255}},
+	{ 0x4cd8, 0xfff8, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4cd8, 0xfff8, {255, 255, 255, 255, 255,   8, 255,   8}},
+	{ 0x4ce8, 0xfff8, { 16,  30,  16, 255, 255, 255, 255, 255}},
+	{ 0x4ce8, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x4ce8, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   8}},
+	{ 0x4cf0, 0xfff8, { 18,  32,  18, 255, 255, 255, 255, 255}},
+	{ 0x4cf0, 0xfff8, {255, 255, 255,  15,  15, 255,  15, 255}},
+	{ 0x4cf0, 0xfff8, {255, 255, 255, 255, 255,  15, 255,   8}},
+	{ 0x4e50, 0xfff8, { 16,  25,  16, 255, 255, 255, 255, 255}},
+	{ 0x4e50, 0xfff8, {255, 255, 255,   5,   5, 255,   5, 255}},
+	{ 0x4e50, 0xfff8, {255, 255, 255, 255, 255,   5, 255,   5}},
+	{ 0x4e58, 0xfff8, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x4e58, 0xfff8, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x4e58, 0xfff8, {255, 255, 255, 255, 255,   6, 255,   6}},
 	{ 0x4e60, 0xfff8, {  4,   7,   6,   2,   2,   2,   2,   2}},
 	{ 0x4e68, 0xfff8, {  4,   7,   6,   2,   2,   2,   2,   2}},
-	{ 0x4e90, 0xfff8, { 16,  22,  16,   4,   4,   4,   4,   0}},
-	{ 0x4ea8, 0xfff8, { 18,  24,  18,   5,   5,   5,   5,   0}},
-	{ 0x4eb0, 0xfff8, { 22,  28,  22,   7,   7,   7,   7,   0}},
+	{ 0x4e90, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x4e90, 0xfff8, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x4e90, 0xfff8, {255, 255, 255, 255, 255,   4, 255,   0}},
+	{ 0x4ea8, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x4ea8, 0xfff8, {255, 255, 255,   5,   5, 255,   5, 255}},
+	{ 0x4ea8, 0xfff8, {255, 255, 255, 255, 255,   5, 255,   0}},
+	{ 0x4eb0, 0xfff8, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x4eb0, 0xfff8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x4eb0, 0xfff8, {255, 255, 255, 255, 255,   7, 255,   0}},
 	{ 0x4ed0, 0xfff8, {  8,  11,   8,   4,   4,   4,   4,   0}},
 	{ 0x4ee8, 0xfff8, { 10,  13,  10,   5,   5,   5,   5,   0}},
-	{ 0x4ef0, 0xfff8, { 14,  17,  14,   7,   7,   7,   7,   0}},
+	{ 0x4ef0, 0xfff8, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x4ef0, 0xfff8, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x4ef0, 0xfff8, {255, 255, 255, 255, 255,   7, 255,   0}},
 	{ 0x50c0, 0xfff8, {  6,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x50c8, 0xfff8, { 12,  14,  12,   6,   6,   6,   6,   6}},
 	{ 0x50d0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x50d8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x50e0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x50e8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x50f0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x50f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x50f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x50f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x51c0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x51c8, 0xfff8, { 12,  14,  10,   6,   4,   4,   4,   4}},
 	{ 0x51d0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x51d8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x51e0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x51e8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x51f0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x51f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x51f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x51f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x52c0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x52c8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x52d0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x52d8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x52e0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x52e8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x52f0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x52f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x52f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x52f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x53c0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x53c8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x53d0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x53d8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x53e0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x53e8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x53f0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x53f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x53f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x53f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x54c0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x54c8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x54d0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x54d8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x54e0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x54e8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x54f0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x54f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x54f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x54f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x55c0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x55c8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x55d0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x55d8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x55e0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x55e8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x55f0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x55f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x55f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x55f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x56c0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x56c8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x56d0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x56d8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x56e0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x56e8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x56f0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x56f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x56f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x56f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x57c0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x57c8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x57d0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x57d8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x57e0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x57e8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x57f0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x57f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x57f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x57f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x58c0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x58c8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x58d0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x58d8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x58e0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x58e8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x58f0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x58f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x58f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x58f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x59c0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x59c8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x59d0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x59d8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x59e0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x59e8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x59f0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x59f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x59f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x59f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x5ac0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x5ac8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x5ad0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x5ad8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x5ae0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x5ae8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x5af0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x5af0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x5af0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x5af0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x5bc0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x5bc8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x5bd0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x5bd8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x5be0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x5be8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x5bf0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x5bf0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x5bf0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x5bf0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x5cc0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x5cc8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x5cd0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x5cd8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x5ce0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x5ce8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x5cf0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x5cf0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x5cf0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x5cf0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x5dc0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x5dc8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x5dd0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x5dd8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x5de0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x5de8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x5df0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x5df0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x5df0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x5df0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x5ec0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x5ec8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x5ed0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x5ed8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x5ee0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x5ee8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x5ef0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x5ef0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x5ef0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x5ef0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x5fc0, 0xfff8, {  4,  13,   4,   4,   4,   4,   4,   4}},
 	{ 0x5fc8, 0xfff8, { 12,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x5fd0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x5fd8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x5fe0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x5fe8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0x5ff0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
+	{ 0x5ff0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x5ff0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x5ff0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x8f08, 0xfff8, { 18,  31,  18,  16,  16,  16,  16,  16}},
 	{ 0x8f48, 0xfff8, {255, 255, 255,  13,  13,  13,  13,  13}},
 	{ 0x8f88, 0xfff8, {255, 255, 255,  13,  13,  13,  13,  13}},
@@ -34816,130 +39161,274 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0xbf08, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   9}},
 	{ 0xcf08, 0xfff8, { 18,  31,  18,  16,  16,  16,  16,  16}},
 	{ 0xdf08, 0xfff8, { 18,  28,  18,  12,  12,  12,  12,  12}},
-	{ 0xe0d0, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   5}},
-	{ 0xe0d8, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   5}},
-	{ 0xe0e0, 0xfff8, { 14,  20,  14,  10,  10,  10,  10,   5}},
-	{ 0xe0e8, 0xfff8, { 16,  22,  16,  10,  10,  10,  10,   5}},
-	{ 0xe0f0, 0xfff8, { 18,  24,  18,  12,  12,  12,  12,   5}},
-	{ 0xe1d0, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
-	{ 0xe1d8, 0xfff8, { 12,  18,  12,  10,  10,  10,  10,   6}},
-	{ 0xe1e0, 0xfff8, { 14,  20,  14,  11,  11,  11,  11,   6}},
-	{ 0xe1e8, 0xfff8, { 16,  22,  16,  11,  11,  11,  11,   6}},
-	{ 0xe1f0, 0xfff8, { 18,  24,  18,  13,  13,  13,  13,   6}},
-	{ 0xe2d0, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   5}},
-	{ 0xe2d8, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   5}},
-	{ 0xe2e0, 0xfff8, { 14,  20,  14,  10,  10,  10,  10,   5}},
-	{ 0xe2e8, 0xfff8, { 16,  22,  16,  10,  10,  10,  10,   5}},
-	{ 0xe2f0, 0xfff8, { 18,  24,  18,  12,  12,  12,  12,   5}},
-	{ 0xe3d0, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   5}},
-	{ 0xe3d8, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   5}},
-	{ 0xe3e0, 0xfff8, { 14,  20,  14,  10,  10,  10,  10,   5}},
-	{ 0xe3e8, 0xfff8, { 16,  22,  16,  10,  10,  10,  10,   5}},
-	{ 0xe3f0, 0xfff8, { 18,  24,  18,  12,  12,  12,  12,   5}},
-	{ 0xe4d0, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   5}},
-	{ 0xe4d8, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   5}},
-	{ 0xe4e0, 0xfff8, { 14,  20,  14,  10,  10,  10,  10,   5}},
-	{ 0xe4e8, 0xfff8, { 16,  22,  16,  10,  10,  10,  10,   5}},
-	{ 0xe4f0, 0xfff8, { 18,  24,  18,  12,  12,  12,  12,   5}},
-	{ 0xe5d0, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   5}},
-	{ 0xe5d8, 0xfff8, { 12,  18,  12,   9,   9,   9,   9,   5}},
-	{ 0xe5e0, 0xfff8, { 14,  20,  14,  10,  10,  10,  10,   5}},
-	{ 0xe5e8, 0xfff8, { 16,  22,  16,  10,  10,  10,  10,   5}},
-	{ 0xe5f0, 0xfff8, { 18,  24,  18,  12,  12,  12,  12,   5}},
-	{ 0xe6d0, 0xfff8, { 12,  18,  12,  11,  11,  11,  11,   7}},
-	{ 0xe6d8, 0xfff8, { 12,  18,  12,  11,  11,  11,  11,   7}},
-	{ 0xe6e0, 0xfff8, { 14,  20,  14,  12,  12,  12,  12,   7}},
-	{ 0xe6e8, 0xfff8, { 16,  22,  16,  12,  12,  12,  12,   7}},
-	{ 0xe6f0, 0xfff8, { 18,  24,  18,  14,  14,  14,  14,   7}},
-	{ 0xe7d0, 0xfff8, { 12,  18,  12,  11,  11,  11,  11,   7}},
-	{ 0xe7d8, 0xfff8, { 12,  18,  12,  11,  11,  11,  11,   7}},
-	{ 0xe7e0, 0xfff8, { 14,  20,  14,  12,  12,  12,  12,   7}},
-	{ 0xe7e8, 0xfff8, { 16,  22,  16,  12,  12,  12,  12,   7}},
-	{ 0xe7f0, 0xfff8, { 18,  24,  18,  14,  14,  14,  14,   7}},
+	{ 0xe0d0, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe0d0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe0d0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe0d8, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe0d8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe0d8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe0e0, 0xfff8, { 14,  20,  14, 255, 255, 255, 255, 255}},
+	{ 0xe0e0, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe0e0, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0xe0e8, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe0e8, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe0e8, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0xe0f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0xe0f0, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0xe0f0, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0xe1d0, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe1d0, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe1d0, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0xe1d8, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe1d8, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe1d8, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0xe1e0, 0xfff8, { 14,  20,  14, 255, 255, 255, 255, 255}},
+	{ 0xe1e0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xe1e0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   6}},
+	{ 0xe1e8, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe1e8, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xe1e8, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   6}},
+	{ 0xe1f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0xe1f0, 0xfff8, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0xe1f0, 0xfff8, {255, 255, 255, 255, 255,  13, 255,   6}},
+	{ 0xe2d0, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe2d0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe2d0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe2d8, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe2d8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe2d8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe2e0, 0xfff8, { 14,  20,  14, 255, 255, 255, 255, 255}},
+	{ 0xe2e0, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe2e0, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0xe2e8, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe2e8, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe2e8, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0xe2f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0xe2f0, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0xe2f0, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0xe3d0, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe3d0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe3d0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe3d8, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe3d8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe3d8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe3e0, 0xfff8, { 14,  20,  14, 255, 255, 255, 255, 255}},
+	{ 0xe3e0, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe3e0, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0xe3e8, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe3e8, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe3e8, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0xe3f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0xe3f0, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0xe3f0, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0xe4d0, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe4d0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe4d0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe4d8, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe4d8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe4d8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe4e0, 0xfff8, { 14,  20,  14, 255, 255, 255, 255, 255}},
+	{ 0xe4e0, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe4e0, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0xe4e8, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe4e8, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe4e8, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0xe4f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0xe4f0, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0xe4f0, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0xe5d0, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe5d0, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe5d0, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe5d8, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe5d8, 0xfff8, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe5d8, 0xfff8, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe5e0, 0xfff8, { 14,  20,  14, 255, 255, 255, 255, 255}},
+	{ 0xe5e0, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe5e0, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0xe5e8, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe5e8, 0xfff8, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe5e8, 0xfff8, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0xe5f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0xe5f0, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0xe5f0, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0xe6d0, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe6d0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xe6d0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0xe6d8, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe6d8, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xe6d8, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0xe6e0, 0xfff8, { 14,  20,  14, 255, 255, 255, 255, 255}},
+	{ 0xe6e0, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0xe6e0, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0xe6e8, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe6e8, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0xe6e8, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0xe6f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0xe6f0, 0xfff8, {255, 255, 255,  14,  14, 255,  14, 255}},
+	{ 0xe6f0, 0xfff8, {255, 255, 255, 255, 255,  14, 255,   7}},
+	{ 0xe7d0, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe7d0, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xe7d0, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0xe7d8, 0xfff8, { 12,  18,  12, 255, 255, 255, 255, 255}},
+	{ 0xe7d8, 0xfff8, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xe7d8, 0xfff8, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0xe7e0, 0xfff8, { 14,  20,  14, 255, 255, 255, 255, 255}},
+	{ 0xe7e0, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0xe7e0, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0xe7e8, 0xfff8, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe7e8, 0xfff8, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0xe7e8, 0xfff8, {255, 255, 255, 255, 255,  12, 255,   7}},
+	{ 0xe7f0, 0xfff8, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0xe7f0, 0xfff8, {255, 255, 255,  14,  14, 255,  14, 255}},
+	{ 0xe7f0, 0xfff8, {255, 255, 255, 255, 255,  14, 255,   7}},
 	{ 0xe8c0, 0xfff8, {255, 255, 255,   6,   6,   6,   6,   6}},
-	{ 0xe8d0, 0xfff8, {255, 255, 255,  17,  17,  17,  17,  13}},
-	{ 0xe8e8, 0xfff8, {255, 255, 255,  18,  18,  18,  18,  13}},
-	{ 0xe8f0, 0xfff8, {255, 255, 255,  20,  20,  20,  20,  13}},
+	{ 0xe8d0, 0xfff8, {255, 255, 255,  17,  17, 255,  17, 255}},
+	{ 0xe8d0, 0xfff8, {255, 255, 255, 255, 255,  17, 255,  13}},
+	{ 0xe8e8, 0xfff8, {255, 255, 255,  18,  18, 255,  18, 255}},
+	{ 0xe8e8, 0xfff8, {255, 255, 255, 255, 255,  18, 255,  13}},
+	{ 0xe8f0, 0xfff8, {255, 255, 255,  20,  20, 255,  20, 255}},
+	{ 0xe8f0, 0xfff8, {255, 255, 255, 255, 255,  20, 255,  13}},
 	{ 0xe9c0, 0xfff8, {255, 255, 255,   8,   8,   8,   8,   8}},
-	{ 0xe9d0, 0xfff8, {255, 255, 255,  19,  19,  19,  19,  15}},
-	{ 0xe9e8, 0xfff8, {255, 255, 255,  20,  20,  20,  20,  15}},
-	{ 0xe9f0, 0xfff8, {255, 255, 255,  22,  22,  22,  22,  15}},
+	{ 0xe9d0, 0xfff8, {255, 255, 255,  19,  19, 255,  19, 255}},
+	{ 0xe9d0, 0xfff8, {255, 255, 255, 255, 255,  19, 255,  15}},
+	{ 0xe9e8, 0xfff8, {255, 255, 255,  20,  20, 255,  20, 255}},
+	{ 0xe9e8, 0xfff8, {255, 255, 255, 255, 255,  20, 255,  15}},
+	{ 0xe9f0, 0xfff8, {255, 255, 255,  22,  22, 255,  22, 255}},
+	{ 0xe9f0, 0xfff8, {255, 255, 255, 255, 255,  22, 255,  15}},
 	{ 0xeac0, 0xfff8, {255, 255, 255,  12,  12,  12,  12,  12}},
-	{ 0xead0, 0xfff8, {255, 255, 255,  24,  24,  24,  24,  20}},
-	{ 0xeae8, 0xfff8, {255, 255, 255,  25,  25,  25,  25,  20}},
-	{ 0xeaf0, 0xfff8, {255, 255, 255,  27,  27,  27,  27,  20}},
+	{ 0xead0, 0xfff8, {255, 255, 255,  24,  24, 255,  24, 255}},
+	{ 0xead0, 0xfff8, {255, 255, 255, 255, 255,  24, 255,  20}},
+	{ 0xeae8, 0xfff8, {255, 255, 255,  25,  25, 255,  25, 255}},
+	{ 0xeae8, 0xfff8, {255, 255, 255, 255, 255,  25, 255,  20}},
+	{ 0xeaf0, 0xfff8, {255, 255, 255,  27,  27, 255,  27, 255}},
+	{ 0xeaf0, 0xfff8, {255, 255, 255, 255, 255,  27, 255,  20}},
 	{ 0xebc0, 0xfff8, {255, 255, 255,   8,   8,   8,   8,   8}},
-	{ 0xebd0, 0xfff8, {255, 255, 255,  19,  19,  19,  19,  15}},
-	{ 0xebe8, 0xfff8, {255, 255, 255,  20,  20,  20,  20,  15}},
-	{ 0xebf0, 0xfff8, {255, 255, 255,  22,  22,  22,  22,  15}},
+	{ 0xebd0, 0xfff8, {255, 255, 255,  19,  19, 255,  19, 255}},
+	{ 0xebd0, 0xfff8, {255, 255, 255, 255, 255,  19, 255,  15}},
+	{ 0xebe8, 0xfff8, {255, 255, 255,  20,  20, 255,  20, 255}},
+	{ 0xebe8, 0xfff8, {255, 255, 255, 255, 255,  20, 255,  15}},
+	{ 0xebf0, 0xfff8, {255, 255, 255,  22,  22, 255,  22, 255}},
+	{ 0xebf0, 0xfff8, {255, 255, 255, 255, 255,  22, 255,  15}},
 	{ 0xecc0, 0xfff8, {255, 255, 255,  12,  12,  12,  12,  12}},
-	{ 0xecd0, 0xfff8, {255, 255, 255,  24,  24,  24,  24,  20}},
-	{ 0xece8, 0xfff8, {255, 255, 255,  25,  25,  25,  25,  20}},
-	{ 0xecf0, 0xfff8, {255, 255, 255,  27,  27,  27,  27,  20}},
+	{ 0xecd0, 0xfff8, {255, 255, 255,  24,  24, 255,  24, 255}},
+	{ 0xecd0, 0xfff8, {255, 255, 255, 255, 255,  24, 255,  20}},
+	{ 0xece8, 0xfff8, {255, 255, 255,  25,  25, 255,  25, 255}},
+	{ 0xece8, 0xfff8, {255, 255, 255, 255, 255,  25, 255,  20}},
+	{ 0xecf0, 0xfff8, {255, 255, 255,  27,  27, 255,  27, 255}},
+	{ 0xecf0, 0xfff8, {255, 255, 255, 255, 255,  27, 255,  20}},
 	{ 0xedc0, 0xfff8, {255, 255, 255,  18,  18,  18,  18,  18}},
-	{ 0xedd0, 0xfff8, {255, 255, 255,  32,  32,  32,  32,  28}},
-	{ 0xede8, 0xfff8, {255, 255, 255,  33,  33,  33,  33,  28}},
-	{ 0xedf0, 0xfff8, {255, 255, 255,  35,  35,  35,  35,  28}},
+	{ 0xedd0, 0xfff8, {255, 255, 255,  32,  32, 255,  32, 255}},
+	{ 0xedd0, 0xfff8, {255, 255, 255, 255, 255,  32, 255,  28}},
+	{ 0xede8, 0xfff8, {255, 255, 255,  33,  33, 255,  33, 255}},
+	{ 0xede8, 0xfff8, {255, 255, 255, 255, 255,  33, 255,  28}},
+	{ 0xedf0, 0xfff8, {255, 255, 255,  35,  35, 255,  35, 255}},
+	{ 0xedf0, 0xfff8, {255, 255, 255, 255, 255,  35, 255,  28}},
 	{ 0xeec0, 0xfff8, {255, 255, 255,  12,  12,  12,  12,  12}},
-	{ 0xeed0, 0xfff8, {255, 255, 255,  24,  24,  24,  24,  20}},
-	{ 0xeee8, 0xfff8, {255, 255, 255,  25,  25,  25,  25,  20}},
-	{ 0xeef0, 0xfff8, {255, 255, 255,  27,  27,  27,  27,  20}},
+	{ 0xeed0, 0xfff8, {255, 255, 255,  24,  24, 255,  24, 255}},
+	{ 0xeed0, 0xfff8, {255, 255, 255, 255, 255,  24, 255,  20}},
+	{ 0xeee8, 0xfff8, {255, 255, 255,  25,  25, 255,  25, 255}},
+	{ 0xeee8, 0xfff8, {255, 255, 255, 255, 255,  25, 255,  20}},
+	{ 0xeef0, 0xfff8, {255, 255, 255,  27,  27, 255,  27, 255}},
+	{ 0xeef0, 0xfff8, {255, 255, 255, 255, 255,  27, 255,  20}},
 	{ 0xefc0, 0xfff8, {255, 255, 255,  10,  10,  10,  10,  10}},
-	{ 0xefd0, 0xfff8, {255, 255, 255,  21,  21,  21,  21,  17}},
-	{ 0xefe8, 0xfff8, {255, 255, 255,  22,  22,  22,  22,  17}},
-	{ 0xeff0, 0xfff8, {255, 255, 255,  24,  24,  24,  24,  17}},
+	{ 0xefd0, 0xfff8, {255, 255, 255,  21,  21, 255,  21, 255}},
+	{ 0xefd0, 0xfff8, {255, 255, 255, 255, 255,  21, 255,  17}},
+	{ 0xefe8, 0xfff8, {255, 255, 255,  22,  22, 255,  22, 255}},
+	{ 0xefe8, 0xfff8, {255, 255, 255, 255, 255,  22, 255,  17}},
+	{ 0xeff0, 0xfff8, {255, 255, 255,  24,  24, 255,  24, 255}},
+	{ 0xeff0, 0xfff8, {255, 255, 255, 255, 255,  24, 255,  17}},
 	{ 0xf278, 0xfff8, {255, 255, 255,   4,   4, 255, 255, 255}},
 	{ 0xf510, 0xfff8, {255, 255, 255, 255, 255,   4,   4,   4}},
 	{ 0xf518, 0xfff8, {255, 255, 255, 255, 255,   4,   4,   4}},
-	{ 0xf620, 0xfff8, {255, 255, 255, 255, 255,   4,   4,   4}},
+	{ 0xf620, 0xfff8, {255, 255, 255, 255, 255, 255,   4, 255}},
+	{ 0xf620, 0xfff8, {255, 255, 255, 255, 255,   4, 255,   4}},
 	{ 0x001f, 0xffff, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0027, 0xffff, { 18,  24,  18,   9,   9,   9,   9,   4}},
 	{ 0x0038, 0xffff, { 20,  26,  20,   8,   8,   8,   8,   4}},
 	{ 0x0039, 0xffff, { 24,  30,  24,   8,   8,   8,   8,   4}},
 	{ 0x003c, 0xffff, { 20,  14,  16,  12,  12,  12,  12,  12}},
-	{ 0x0078, 0xffff, { 20,  26,  20,   8,   8,   8,   8,   4}},
-	{ 0x0079, 0xffff, { 24,  30,  24,   8,   8,   8,   8,   4}},
+	{ 0x0078, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0078, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0078, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0079, 0xffff, { 24,  30,  24, 255, 255, 255, 255, 255}},
+	{ 0x0079, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0079, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x007c, 0xffff, { 20,  14,  16,  12,  12,  12,  12,  12}},
-	{ 0x00b8, 0xffff, { 32,  38,  32,   8,   8,   8,   8,   4}},
-	{ 0x00b9, 0xffff, { 36,  42,  36,   8,   8,   8,   8,   4}},
+	{ 0x00b8, 0xffff, { 32,  38,  32, 255, 255, 255, 255, 255}},
+	{ 0x00b8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x00b8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x00b9, 0xffff, { 36,  42,  36, 255, 255, 255, 255, 255}},
+	{ 0x00b9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x00b9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x00f8, 0xffff, {255, 255, 255,  22,  22,  22,  22,  18}},
 	{ 0x00f9, 0xffff, {255, 255, 255,  22,  22,  22,  22,  18}},
 	{ 0x00fa, 0xffff, {255, 255, 255,  23,  23,  23,  23,  23}},
-	{ 0x00fb, 0xffff, {255, 255, 255,  23,  23,  23,  23,  23}},
+	{ 0x00fb, 0xffff, {255, 255, 255,  23,  23, 255,  23, 255}},
+	{ 0x00fb, 0xffff, {255, 255, 255, 255, 255,  23, 255,  23}},
 	{ 0x021f, 0xffff, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0227, 0xffff, { 18,  24,  18,   9,   9,   9,   9,   4}},
 	{ 0x0238, 0xffff, { 20,  26,  20,   8,   8,   8,   8,   4}},
 	{ 0x0239, 0xffff, { 24,  30,  24,   8,   8,   8,   8,   4}},
 	{ 0x023c, 0xffff, { 20,  14,  16,  12,  12,  12,  12,  12}},
-	{ 0x0278, 0xffff, { 20,  26,  20,   8,   8,   8,   8,   4}},
-	{ 0x0279, 0xffff, { 24,  30,  24,   8,   8,   8,   8,   4}},
+	{ 0x0278, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0278, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0278, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0279, 0xffff, { 24,  30,  24, 255, 255, 255, 255, 255}},
+	{ 0x0279, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0279, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x027c, 0xffff, { 20,  14,  16,  12,  12,  12,  12,  12}},
-	{ 0x02b8, 0xffff, { 32,  38,  32,   8,   8,   8,   8,   4}},
-	{ 0x02b9, 0xffff, { 36,  42,  36,   8,   8,   8,   8,   4}},
-	{ 0x02f8, 0xffff, {255, 255, 255,  22,  22,  22,  22,  18}},
-	{ 0x02f9, 0xffff, {255, 255, 255,  22,  22,  22,  22,  18}},
+	{ 0x02b8, 0xffff, { 32,  38,  32, 255, 255, 255, 255, 255}},
+	{ 0x02b8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x02b8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x02b9, 0xffff, { 36,  42,  36, 255, 255, 255, 255, 255}},
+	{ 0x02b9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x02b9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x02f8, 0xffff, {255, 255, 255,  22,  22, 255,  22, 255}},
+	{ 0x02f8, 0xffff, {255, 255, 255, 255, 255,  22, 255,  18}},
+	{ 0x02f9, 0xffff, {255, 255, 255,  22,  22, 255,  22, 255}},
+	{ 0x02f9, 0xffff, {255, 255, 255, 255, 255,  22, 255,  18}},
 	{ 0x02fa, 0xffff, {255, 255, 255,  23,  23,  23,  23,  23}},
-	{ 0x02fb, 0xffff, {255, 255, 255,  23,  23,  23,  23,  23}},
+	{ 0x02fb, 0xffff, {255, 255, 255,  23,  23, 255,  23, 255}},
+	{ 0x02fb, 0xffff, {255, 255, 255, 255, 255,  23, 255,  23}},
 	{ 0x041f, 0xffff, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0427, 0xffff, { 18,  24,  18,   9,   9,   9,   9,   4}},
 	{ 0x0438, 0xffff, { 20,  26,  20,   8,   8,   8,   8,   4}},
 	{ 0x0439, 0xffff, { 24,  30,  24,   8,   8,   8,   8,   4}},
-	{ 0x0478, 0xffff, { 20,  26,  20,   8,   8,   8,   8,   4}},
-	{ 0x0479, 0xffff, { 24,  30,  24,   8,   8,   8,   8,   4}},
-	{ 0x04b8, 0xffff, { 32,  38,  32,   8,   8,   8,   8,   4}},
-	{ 0x04b9, 0xffff, { 36,  42,  36,   8,   8,   8,   8,   4}},
-	{ 0x04f8, 0xffff, {255, 255, 255,  22,  22,  22,  22,  18}},
-	{ 0x04f9, 0xffff, {255, 255, 255,  22,  22,  22,  22,  18}},
+	{ 0x0478, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0478, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0478, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0479, 0xffff, { 24,  30,  24, 255, 255, 255, 255, 255}},
+	{ 0x0479, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0479, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x04b8, 0xffff, { 32,  38,  32, 255, 255, 255, 255, 255}},
+	{ 0x04b8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x04b8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x04b9, 0xffff, { 36,  42,  36, 255, 255, 255, 255, 255}},
+	{ 0x04b9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x04b9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x04f8, 0xffff, {255, 255, 255,  22,  22, 255,  22, 255}},
+	{ 0x04f8, 0xffff, {255, 255, 255, 255, 255,  22, 255,  18}},
+	{ 0x04f9, 0xffff, {255, 255, 255,  22,  22, 255,  22, 255}},
+	{ 0x04f9, 0xffff, {255, 255, 255, 255, 255,  22, 255,  18}},
 	{ 0x04fa, 0xffff, {255, 255, 255,  23,  23,  23,  23,  23}},
-	{ 0x04fb, 0xffff, {255, 255, 255,  23,  23,  23,  23,  23}},
+	{ 0x04fb, 0xffff, {255, 255, 255,  23,  23, 255,  23, 255}},
+	{ 0x04fb, 0xffff, {255, 255, 255, 255, 255,  23, 255,  23}},
 	{ 0x061f, 0xffff, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0627, 0xffff, { 18,  24,  18,   9,   9,   9,   9,   4}},
 	{ 0x0638, 0xffff, { 20,  26,  20,   8,   8,   8,   8,   4}},
 	{ 0x0639, 0xffff, { 24,  30,  24,   8,   8,   8,   8,   4}},
-	{ 0x0678, 0xffff, { 20,  26,  20,   8,   8,   8,   8,   4}},
-	{ 0x0679, 0xffff, { 24,  30,  24,   8,   8,   8,   8,   4}},
-	{ 0x06b8, 0xffff, { 32,  38,  32,   8,   8,   8,   8,   4}},
-	{ 0x06b9, 0xffff, { 36,  42,  36,   8,   8,   8,   8,   4}},
+	{ 0x0678, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0678, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0678, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0679, 0xffff, { 24,  30,  24, 255, 255, 255, 255, 255}},
+	{ 0x0679, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0679, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x06b8, 0xffff, { 32,  38,  32, 255, 255, 255, 255, 255}},
+	{ 0x06b8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x06b8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x06b9, 0xffff, { 36,  42,  36, 255, 255, 255, 255, 255}},
+	{ 0x06b9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x06b9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x06f8, 0xffff, {255, 255, 255,  64, 255, 255,  64, 255}},
 	{ 0x06f9, 0xffff, {255, 255, 255,  64, 255, 255,  64, 255}},
 	{ 0x06fa, 0xffff, {255, 255, 255,  65, 255, 255,  65, 255}},
@@ -34949,7 +39438,9 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x0838, 0xffff, { 16,  22,  16,   8,   8,   8,   8,   4}},
 	{ 0x0839, 0xffff, { 20,  26,  20,   8,   8,   8,   8,   4}},
 	{ 0x083a, 0xffff, { 16,  22,  16,   9,   9,   9,   9,   4}},
-	{ 0x083b, 0xffff, { 18,  24,  18,  11,  11,  11,  11,   4}},
+	{ 0x083b, 0xffff, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x083b, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x083b, 0xffff, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x085f, 0xffff, { 16,  25,  16,   8,   8,   8,   8,   4}},
 	{ 0x0867, 0xffff, { 18,  27,  18,   9,   9,   9,   9,   4}},
 	{ 0x0878, 0xffff, { 20,  29,  20,   8,   8,   8,   8,   4}},
@@ -34967,11 +39458,19 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x0a38, 0xffff, { 20,  26,  20,   8,   8,   8,   8,   4}},
 	{ 0x0a39, 0xffff, { 24,  30,  24,   8,   8,   8,   8,   4}},
 	{ 0x0a3c, 0xffff, { 20,  14,  16,  12,  12,  12,  12,  12}},
-	{ 0x0a78, 0xffff, { 20,  26,  20,   8,   8,   8,   8,   4}},
-	{ 0x0a79, 0xffff, { 24,  30,  24,   8,   8,   8,   8,   4}},
+	{ 0x0a78, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0a78, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0a78, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0a79, 0xffff, { 24,  30,  24, 255, 255, 255, 255, 255}},
+	{ 0x0a79, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0a79, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x0a7c, 0xffff, { 20,  14,  16,  12,  12,  12,  12,  12}},
-	{ 0x0ab8, 0xffff, { 32,  38,  32,   8,   8,   8,   8,   4}},
-	{ 0x0ab9, 0xffff, { 36,  42,  36,   8,   8,   8,   8,   4}},
+	{ 0x0ab8, 0xffff, { 32,  38,  32, 255, 255, 255, 255, 255}},
+	{ 0x0ab8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0ab8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x0ab9, 0xffff, { 36,  42,  36, 255, 255, 255, 255, 255}},
+	{ 0x0ab9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x0ab9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x0adf, 0xffff, {255, 255, 255,  16,  16,  16,  16,  12}},
 	{ 0x0ae7, 0xffff, {255, 255, 255,  17,  17,  17,  17,  12}},
 	{ 0x0af8, 0xffff, {255, 255, 255,  16,  16,  16,  16,  12}},
@@ -34981,18 +39480,32 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x0c38, 0xffff, { 16,  22,  16,   6,   6,   6,   6,   2}},
 	{ 0x0c39, 0xffff, { 20,  26,  20,   6,   6,   6,   6,   2}},
 	{ 0x0c3a, 0xffff, {255, 255, 255,   7,   7,   7,   7,   7}},
-	{ 0x0c3b, 0xffff, {255, 255, 255,   9,   9,   9,   9,   9}},
-	{ 0x0c78, 0xffff, { 16,  22,  16,   6,   6,   6,   6,   2}},
-	{ 0x0c79, 0xffff, { 20,  26,  20,   6,   6,   6,   6,   2}},
+	{ 0x0c3b, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0c3b, 0xffff, {255, 255, 255, 255, 255,   9, 255,   9}},
+	{ 0x0c78, 0xffff, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0x0c78, 0xffff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x0c78, 0xffff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x0c79, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x0c79, 0xffff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x0c79, 0xffff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x0c7a, 0xffff, {255, 255, 255,   7,   7,   7,   7,   7}},
-	{ 0x0c7b, 0xffff, {255, 255, 255,   9,   9,   9,   9,   9}},
-	{ 0x0cb8, 0xffff, { 24,  30,  24,   6,   6,   6,   6,   2}},
-	{ 0x0cb9, 0xffff, { 28,  34,  28,   6,   6,   6,   6,   2}},
+	{ 0x0c7b, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0c7b, 0xffff, {255, 255, 255, 255, 255,   9, 255,   9}},
+	{ 0x0cb8, 0xffff, { 24,  30,  24, 255, 255, 255, 255, 255}},
+	{ 0x0cb8, 0xffff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x0cb8, 0xffff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x0cb9, 0xffff, { 28,  34,  28, 255, 255, 255, 255, 255}},
+	{ 0x0cb9, 0xffff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x0cb9, 0xffff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x0cba, 0xffff, {255, 255, 255,   7,   7,   7,   7,   7}},
-	{ 0x0cbb, 0xffff, {255, 255, 255,   9,   9,   9,   9,   9}},
-	{ 0x0cf8, 0xffff, {255, 255, 255,  16,  16,  16,  16,  12}},
-	{ 0x0cf9, 0xffff, {255, 255, 255,  16,  16,  16,  16,  12}},
-	{ 0x0cfc, 0xffff, {255, 255, 255,  12,  12,  12,  12,  12}},
+	{ 0x0cbb, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x0cbb, 0xffff, {255, 255, 255, 255, 255,   9, 255,   9}},
+	{ 0x0cf8, 0xffff, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x0cf8, 0xffff, {255, 255, 255, 255, 255,  16, 255,  12}},
+	{ 0x0cf9, 0xffff, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x0cf9, 0xffff, {255, 255, 255, 255, 255,  16, 255,  12}},
+	{ 0x0cfc, 0xffff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x0cfc, 0xffff, {255, 255, 255, 255, 255,  12, 255,  12}},
 	{ 0x0e1f, 0xffff, {255, 255,  18, 255,   9,   9,   9,   5}},
 	{ 0x0e1f, 0xffff, {255, 255, 255,   9, 255, 255, 255, 255}},
 	{ 0x0e27, 0xffff, {255, 255,  20, 255,  10,  10,  10,   5}},
@@ -35001,77 +39514,148 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x0e38, 0xffff, {255, 255, 255,   9, 255, 255, 255, 255}},
 	{ 0x0e39, 0xffff, {255, 255,  30, 255,   9,   9,   9,   5}},
 	{ 0x0e39, 0xffff, {255, 255, 255,   9, 255, 255, 255, 255}},
-	{ 0x0e78, 0xffff, {255, 255,  26, 255,   9,   9,   9,   5}},
+	{ 0x0e78, 0xffff, {255, 255,  26, 255, 255, 255, 255, 255}},
+	{ 0x0e78, 0xffff, {255, 255, 255, 255,   9, 255,   9, 255}},
+	{ 0x0e78, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
 	{ 0x0e78, 0xffff, {255, 255, 255,   9, 255, 255, 255, 255}},
-	{ 0x0e79, 0xffff, {255, 255,  30, 255,   9,   9,   9,   5}},
+	{ 0x0e79, 0xffff, {255, 255,  30, 255, 255, 255, 255, 255}},
+	{ 0x0e79, 0xffff, {255, 255, 255, 255,   9, 255,   9, 255}},
+	{ 0x0e79, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
 	{ 0x0e79, 0xffff, {255, 255, 255,   9, 255, 255, 255, 255}},
-	{ 0x0eb8, 0xffff, {255, 255,  32, 255,   9,   9,   9,   5}},
+	{ 0x0eb8, 0xffff, {255, 255,  32, 255, 255, 255, 255, 255}},
+	{ 0x0eb8, 0xffff, {255, 255, 255, 255,   9, 255,   9, 255}},
+	{ 0x0eb8, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
 	{ 0x0eb8, 0xffff, {255, 255, 255,   9, 255, 255, 255, 255}},
-	{ 0x0eb9, 0xffff, {255, 255,  36, 255,   9,   9,   9,   5}},
+	{ 0x0eb9, 0xffff, {255, 255,  36, 255, 255, 255, 255, 255}},
+	{ 0x0eb9, 0xffff, {255, 255, 255, 255,   9, 255,   9, 255}},
+	{ 0x0eb9, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
 	{ 0x0eb9, 0xffff, {255, 255, 255,   9, 255, 255, 255, 255}},
-	{ 0x0ef8, 0xffff, {255, 255, 255,  16,  16,  16,  16,  12}},
-	{ 0x0ef9, 0xffff, {255, 255, 255,  16,  16,  16,  16,  12}},
-	{ 0x0efc, 0xffff, {255, 255, 255,  12,  12,  12,  12,  12}},
+	{ 0x0ef8, 0xffff, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x0ef8, 0xffff, {255, 255, 255, 255, 255,  16, 255,  12}},
+	{ 0x0ef9, 0xffff, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x0ef9, 0xffff, {255, 255, 255, 255, 255,  16, 255,  12}},
+	{ 0x0efc, 0xffff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x0efc, 0xffff, {255, 255, 255, 255, 255,  12, 255,  12}},
 	{ 0x11df, 0xffff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x11e7, 0xffff, { 18,  21,  18,   9,   9,   9,   9,   4}},
 	{ 0x11f8, 0xffff, { 20,  23,  20,   8,   8,   8,   8,   4}},
 	{ 0x11f9, 0xffff, { 24,  27,  24,   8,   8,   8,   8,   4}},
 	{ 0x11fa, 0xffff, { 20,  23,  20,   9,   9,   9,   9,   4}},
-	{ 0x11fb, 0xffff, { 22,  25,  22,  11,  11,  11,  11,   4}},
+	{ 0x11fb, 0xffff, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x11fb, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x11fb, 0xffff, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x11fc, 0xffff, { 16,  19,  16,   6,   6,   6,   6,   4}},
 	{ 0x13df, 0xffff, { 20,  23,  20,  10,  10,  10,  10,   6}},
 	{ 0x13e7, 0xffff, { 22,  25,  22,  11,  11,  11,  11,   6}},
 	{ 0x13f8, 0xffff, { 24,  27,  24,  10,  10,  10,  10,   6}},
 	{ 0x13f9, 0xffff, { 28,  31,  28,  10,  10,  10,  10,   6}},
 	{ 0x13fa, 0xffff, { 24,  27,  24,  11,  11,  11,  11,   6}},
-	{ 0x13fb, 0xffff, { 26,  29,  26,  13,  13,  13,  13,   6}},
+	{ 0x13fb, 0xffff, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x13fb, 0xffff, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x13fb, 0xffff, {255, 255, 255, 255, 255,  13, 255,   6}},
 	{ 0x13fc, 0xffff, { 20,  23,  20,   8,   8,   8,   8,   6}},
 	{ 0x1edf, 0xffff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x1ee7, 0xffff, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x1ef8, 0xffff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x1ef9, 0xffff, { 20,  23,  20,   8,   8,   8,   8,   4}},
 	{ 0x1efa, 0xffff, { 16,  19,  16,   9,   9,   9,   9,   4}},
-	{ 0x1efb, 0xffff, { 18,  21,  18,  11,  11,  11,  11,   4}},
+	{ 0x1efb, 0xffff, { 18,  21,  18, 255, 255, 255, 255, 255}},
+	{ 0x1efb, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x1efb, 0xffff, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x1efc, 0xffff, { 12,  15,  12,   6,   6,   6,   6,   4}},
 	{ 0x1f1f, 0xffff, { 12,  18,  12,   9,   9,   9,   9,   5}},
 	{ 0x1f27, 0xffff, { 14,  20,  14,  10,  10,  10,  10,   5}},
 	{ 0x1f38, 0xffff, { 16,  22,  16,   9,   9,   9,   9,   5}},
 	{ 0x1f39, 0xffff, { 20,  26,  20,   9,   9,   9,   9,   5}},
 	{ 0x1f3a, 0xffff, { 16,  22,  16,  10,  10,  10,  10,   5}},
-	{ 0x1f3b, 0xffff, { 18,  24,  18,  12,  12,  12,  12,   5}},
+	{ 0x1f3b, 0xffff, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x1f3b, 0xffff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x1f3b, 0xffff, {255, 255, 255, 255, 255,  12, 255,   5}},
 	{ 0x1f3c, 0xffff, { 12,  18,  12,   7,   7,   7,   7,   5}},
-	{ 0x21f8, 0xffff, { 28,  31,  28,   8,   8,   8,   8,   4}},
-	{ 0x21f9, 0xffff, { 32,  35,  32,   8,   8,   8,   8,   4}},
-	{ 0x21fa, 0xffff, { 28,  31,  28,   9,   9,   9,   9,   4}},
-	{ 0x21fb, 0xffff, { 30,  33,  30,  11,  11,  11,  11,   4}},
-	{ 0x21fc, 0xffff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x23f8, 0xffff, { 32,  35,  32,  10,  10,  10,  10,   6}},
-	{ 0x23f9, 0xffff, { 36,  39,  36,  10,  10,  10,  10,   6}},
-	{ 0x23fa, 0xffff, { 32,  35,  32,  11,  11,  11,  11,   6}},
-	{ 0x23fb, 0xffff, { 34,  37,  34,  13,  13,  13,  13,   6}},
-	{ 0x23fc, 0xffff, { 28,  31,  28,  10,  10,  10,  10,   6}},
-	{ 0x31f8, 0xffff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x31f9, 0xffff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x31fa, 0xffff, { 20,  23,  20,   9,   9,   9,   9,   4}},
-	{ 0x31fb, 0xffff, { 22,  25,  22,  11,  11,  11,  11,   4}},
-	{ 0x31fc, 0xffff, { 16,  19,  16,   6,   6,   6,   6,   4}},
-	{ 0x33f8, 0xffff, { 24,  27,  24,  10,  10,  10,  10,   6}},
-	{ 0x33f9, 0xffff, { 28,  31,  28,  10,  10,  10,  10,   6}},
-	{ 0x33fa, 0xffff, { 24,  27,  24,  11,  11,  11,  11,   6}},
-	{ 0x33fb, 0xffff, { 26,  29,  26,  13,  13,  13,  13,   6}},
-	{ 0x33fc, 0xffff, { 20,  23,  20,   8,   8,   8,   8,   6}},
+	{ 0x21f8, 0xffff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x21f8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x21f8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x21f9, 0xffff, { 32,  35,  32, 255, 255, 255, 255, 255}},
+	{ 0x21f9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x21f9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x21fa, 0xffff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x21fa, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x21fa, 0xffff, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x21fb, 0xffff, { 30,  33,  30, 255, 255, 255, 255, 255}},
+	{ 0x21fb, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x21fb, 0xffff, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x21fc, 0xffff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x21fc, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x21fc, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x23f8, 0xffff, { 32,  35,  32, 255, 255, 255, 255, 255}},
+	{ 0x23f8, 0xffff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x23f8, 0xffff, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0x23f9, 0xffff, { 36,  39,  36, 255, 255, 255, 255, 255}},
+	{ 0x23f9, 0xffff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x23f9, 0xffff, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0x23fa, 0xffff, { 32,  35,  32, 255, 255, 255, 255, 255}},
+	{ 0x23fa, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x23fa, 0xffff, {255, 255, 255, 255, 255,  11, 255,   6}},
+	{ 0x23fb, 0xffff, { 34,  37,  34, 255, 255, 255, 255, 255}},
+	{ 0x23fb, 0xffff, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x23fb, 0xffff, {255, 255, 255, 255, 255,  13, 255,   6}},
+	{ 0x23fc, 0xffff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x23fc, 0xffff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x23fc, 0xffff, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0x31f8, 0xffff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x31f8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x31f8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x31f9, 0xffff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x31f9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x31f9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x31fa, 0xffff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x31fa, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x31fa, 0xffff, {255, 255, 255, 255, 255,   9, 255,   4}},
+	{ 0x31fb, 0xffff, { 22,  25,  22, 255, 255, 255, 255, 255}},
+	{ 0x31fb, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x31fb, 0xffff, {255, 255, 255, 255, 255,  11, 255,   4}},
+	{ 0x31fc, 0xffff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x31fc, 0xffff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x31fc, 0xffff, {255, 255, 255, 255, 255,   6, 255,   4}},
+	{ 0x33f8, 0xffff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x33f8, 0xffff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x33f8, 0xffff, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0x33f9, 0xffff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x33f9, 0xffff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x33f9, 0xffff, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0x33fa, 0xffff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x33fa, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x33fa, 0xffff, {255, 255, 255, 255, 255,  11, 255,   6}},
+	{ 0x33fb, 0xffff, { 26,  29,  26, 255, 255, 255, 255, 255}},
+	{ 0x33fb, 0xffff, {255, 255, 255,  13,  13, 255,  13, 255}},
+	{ 0x33fb, 0xffff, {255, 255, 255, 255, 255,  13, 255,   6}},
+	{ 0x33fc, 0xffff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x33fc, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x33fc, 0xffff, {255, 255, 255, 255, 255,   8, 255,   6}},
 	{ 0x401f, 0xffff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x4027, 0xffff, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x4038, 0xffff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x4039, 0xffff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x4078, 0xffff, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0x4079, 0xffff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x40b8, 0xffff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x40b9, 0xffff, { 28,  31,  28,   8,   8,   8,   8,   4}},
+	{ 0x4078, 0xffff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x4078, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4078, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x4079, 0xffff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x4079, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4079, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x40b8, 0xffff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x40b8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x40b8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x40b9, 0xffff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x40b9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x40b9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x40f8, 0xffff, { 16,  19, 255, 255, 255, 255, 255, 255}},
-	{ 0x40f8, 0xffff, {255, 255,  16,  12,  12,  12,  12,   8}},
+	{ 0x40f8, 0xffff, {255, 255,  16, 255, 255, 255, 255, 255}},
+	{ 0x40f8, 0xffff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x40f8, 0xffff, {255, 255, 255, 255, 255,  12, 255,   8}},
 	{ 0x40f9, 0xffff, { 20,  23, 255, 255, 255, 255, 255, 255}},
-	{ 0x40f9, 0xffff, {255, 255,  20,  12,  12,  12,  12,   8}},
+	{ 0x40f9, 0xffff, {255, 255,  20, 255, 255, 255, 255, 255}},
+	{ 0x40f9, 0xffff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x40f9, 0xffff, {255, 255, 255, 255, 255,  12, 255,   8}},
 	{ 0x421f, 0xffff, { 12, 255, 255, 255, 255, 255, 255, 255}},
 	{ 0x421f, 0xffff, {255,  15,   8,   8,   8,   8,   8,   4}},
 	{ 0x4227, 0xffff, { 14, 255, 255, 255, 255, 255, 255, 255}},
@@ -35081,106 +39665,211 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x4239, 0xffff, { 20, 255, 255, 255, 255, 255, 255, 255}},
 	{ 0x4239, 0xffff, {255,  23,  14,   8,   8,   8,   8,   4}},
 	{ 0x4278, 0xffff, { 16, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x4278, 0xffff, {255,  19,  12,   8,   8,   8,   8,   4}},
+	{ 0x4278, 0xffff, {255,  19,  12, 255, 255, 255, 255, 255}},
+	{ 0x4278, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4278, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x4279, 0xffff, { 20, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x4279, 0xffff, {255,  23,  14,   8,   8,   8,   8,   4}},
+	{ 0x4279, 0xffff, {255,  23,  14, 255, 255, 255, 255, 255}},
+	{ 0x4279, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4279, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x42b8, 0xffff, { 24, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x42b8, 0xffff, {255,  27,  16,   8,   8,   8,   8,   4}},
+	{ 0x42b8, 0xffff, {255,  27,  16, 255, 255, 255, 255, 255}},
+	{ 0x42b8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x42b8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x42b9, 0xffff, { 28, 255, 255, 255, 255, 255, 255, 255}},
-	{ 0x42b9, 0xffff, {255,  31,  20,   8,   8,   8,   8,   4}},
-	{ 0x42f8, 0xffff, {255, 255,  16,   8,   8,   8,   8,   4}},
-	{ 0x42f9, 0xffff, {255, 255,  20,   8,   8,   8,   8,   4}},
+	{ 0x42b9, 0xffff, {255,  31,  20, 255, 255, 255, 255, 255}},
+	{ 0x42b9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x42b9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x42f8, 0xffff, {255, 255,  16, 255, 255, 255, 255, 255}},
+	{ 0x42f8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x42f8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x42f9, 0xffff, {255, 255,  20, 255, 255, 255, 255, 255}},
+	{ 0x42f9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x42f9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x441f, 0xffff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x4427, 0xffff, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x4438, 0xffff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x4439, 0xffff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x4478, 0xffff, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0x4479, 0xffff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x44b8, 0xffff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x44b9, 0xffff, { 28,  31,  28,   8,   8,   8,   8,   4}},
-	{ 0x44f8, 0xffff, { 20,  18,  20,   8,   8,   8,   8,   4}},
-	{ 0x44f9, 0xffff, { 24,  22,  24,   8,   8,   8,   8,   4}},
+	{ 0x4478, 0xffff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x4478, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4478, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x4479, 0xffff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x4479, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4479, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x44b8, 0xffff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x44b8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x44b8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x44b9, 0xffff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x44b9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x44b9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x44f8, 0xffff, { 20,  18,  20, 255, 255, 255, 255, 255}},
+	{ 0x44f8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x44f8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x44f9, 0xffff, { 24,  22,  24, 255, 255, 255, 255, 255}},
+	{ 0x44f9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x44f9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x44fa, 0xffff, { 20,  18,  20,   9,   9,   9,   9,   4}},
-	{ 0x44fb, 0xffff, { 22,  20,  22,  11,  11,  11,  11,   4}},
+	{ 0x44fb, 0xffff, { 22,  20,  22, 255, 255, 255, 255, 255}},
+	{ 0x44fb, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x44fb, 0xffff, {255, 255, 255, 255, 255,  11, 255,   4}},
 	{ 0x44fc, 0xffff, { 16,  14,  16,   6,   6,   6,   6,   4}},
 	{ 0x461f, 0xffff, { 12,  15,  12,   8,   8,   8,   8,   4}},
 	{ 0x4627, 0xffff, { 14,  17,  14,   9,   9,   9,   9,   4}},
 	{ 0x4638, 0xffff, { 16,  19,  16,   8,   8,   8,   8,   4}},
 	{ 0x4639, 0xffff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x4678, 0xffff, { 16,  19,  16,   8,   8,   8,   8,   4}},
-	{ 0x4679, 0xffff, { 20,  23,  20,   8,   8,   8,   8,   4}},
-	{ 0x46b8, 0xffff, { 24,  27,  24,   8,   8,   8,   8,   4}},
-	{ 0x46b9, 0xffff, { 28,  31,  28,   8,   8,   8,   8,   4}},
-	{ 0x46f8, 0xffff, { 20,  18,  20,  12,  12,  12,  12,   8}},
-	{ 0x46f9, 0xffff, { 24,  22,  24,  12,  12,  12,  12,   8}},
+	{ 0x4678, 0xffff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x4678, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4678, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x4679, 0xffff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x4679, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x4679, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x46b8, 0xffff, { 24,  27,  24, 255, 255, 255, 255, 255}},
+	{ 0x46b8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x46b8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x46b9, 0xffff, { 28,  31,  28, 255, 255, 255, 255, 255}},
+	{ 0x46b9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x46b9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x46f8, 0xffff, { 20,  18,  20, 255, 255, 255, 255, 255}},
+	{ 0x46f8, 0xffff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x46f8, 0xffff, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x46f9, 0xffff, { 24,  22,  24, 255, 255, 255, 255, 255}},
+	{ 0x46f9, 0xffff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x46f9, 0xffff, {255, 255, 255, 255, 255,  12, 255,   8}},
 	{ 0x46fa, 0xffff, { 20,  18,  20,  13,  13,  13,  13,   8}},
-	{ 0x46fb, 0xffff, { 22,  20,  22,  15,  15,  15,  15,   8}},
+	{ 0x46fb, 0xffff, { 22,  20,  22, 255, 255, 255, 255, 255}},
+	{ 0x46fb, 0xffff, {255, 255, 255,  15,  15, 255,  15, 255}},
+	{ 0x46fb, 0xffff, {255, 255, 255, 255, 255,  15, 255,   8}},
 	{ 0x46fc, 0xffff, { 16,  14,  16,  10,  10,  10,  10,   8}},
-	{ 0x480f, 0xffff, {255, 255, 255,   6,   6,   6,   6,   6}},
+	{ 0x480f, 0xffff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x480f, 0xffff, {255, 255, 255, 255, 255,   6, 255,   6}},
 	{ 0x481f, 0xffff, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x4827, 0xffff, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x4838, 0xffff, { 16,  22,  16,  10,  10,  10,  10,   6}},
 	{ 0x4839, 0xffff, { 20,  26,  20,  10,  10,  10,  10,   6}},
-	{ 0x4878, 0xffff, { 16,  28,  16,   9,   9,   9,   9,   5}},
-	{ 0x4879, 0xffff, { 20,  32,  20,   9,   9,   9,   9,   5}},
-	{ 0x487a, 0xffff, { 16,  28,  16,  10,  10,  10,  10,   5}},
-	{ 0x487b, 0xffff, { 20,  32,  20,  12,  12,  12,  12,   5}},
-	{ 0x48b8, 0xffff, { 12,  27,  12,   8,   8,   8,   8,   4}},
-	{ 0x48b9, 0xffff, { 16,  31,  16,   8,   8,   8,   8,   4}},
-	{ 0x48f8, 0xffff, { 12,  27,  12,   8,   8,   8,   8,   4}},
-	{ 0x48f9, 0xffff, { 16,  31,  16,   8,   8,   8,   8,   4}},
+	{ 0x4878, 0xffff, { 16,  28,  16, 255, 255, 255, 255, 255}},
+	{ 0x4878, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4878, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x4879, 0xffff, { 20,  32,  20, 255, 255, 255, 255, 255}},
+	{ 0x4879, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4879, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0x487a, 0xffff, { 16,  28,  16, 255, 255, 255, 255, 255}},
+	{ 0x487a, 0xffff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x487a, 0xffff, {255, 255, 255, 255, 255,  10, 255,   5}},
+	{ 0x487b, 0xffff, { 20,  32,  20, 255, 255, 255, 255, 255}},
+	{ 0x487b, 0xffff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x487b, 0xffff, {255, 255, 255, 255, 255,  12, 255,   5}},
+	{ 0x48b8, 0xffff, { 12,  27,  12, 255, 255, 255, 255, 255}},
+	{ 0x48b8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x48b8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x48b9, 0xffff, { 16,  31,  16, 255, 255, 255, 255, 255}},
+	{ 0x48b9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x48b9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x48f8, 0xffff, { 12,  27,  12, 255, 255, 255, 255, 255}},
+	{ 0x48f8, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x48f8, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
+	{ 0x48f9, 0xffff, { 16,  31,  16, 255, 255, 255, 255, 255}},
+	{ 0x48f9, 0xffff, {255, 255, 255,   8,   8, 255,   8, 255}},
+	{ 0x48f9, 0xffff, {255, 255, 255, 255, 255,   8, 255,   4}},
 	{ 0x4a1f, 0xffff, {  8,  11,   8,   6,   6,   6,   6,   2}},
 	{ 0x4a27, 0xffff, { 10,  13,  10,   7,   7,   7,   7,   2}},
 	{ 0x4a38, 0xffff, { 12,  15,  12,   6,   6,   6,   6,   2}},
 	{ 0x4a39, 0xffff, { 16,  19,  16,   6,   6,   6,   6,   2}},
 	{ 0x4a3a, 0xffff, {255, 255, 255,   7,   7,   7,   7,   7}},
-	{ 0x4a3b, 0xffff, {255, 255, 255,   9,   9,   9,   9,   9}},
+	{ 0x4a3b, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4a3b, 0xffff, {255, 255, 255, 255, 255,   9, 255,   9}},
 	{ 0x4a3c, 0xffff, {255, 255, 255,   6,   6,   6,   6,   6}},
-	{ 0x4a78, 0xffff, { 12,  15,  12,   6,   6,   6,   6,   2}},
-	{ 0x4a79, 0xffff, { 16,  19,  16,   6,   6,   6,   6,   2}},
+	{ 0x4a78, 0xffff, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x4a78, 0xffff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x4a78, 0xffff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x4a79, 0xffff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x4a79, 0xffff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x4a79, 0xffff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x4a7a, 0xffff, {255, 255, 255,   7,   7,   7,   7,   7}},
-	{ 0x4a7b, 0xffff, {255, 255, 255,   9,   9,   9,   9,   9}},
+	{ 0x4a7b, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4a7b, 0xffff, {255, 255, 255, 255, 255,   9, 255,   9}},
 	{ 0x4a7c, 0xffff, {255, 255, 255,   6,   6,   6,   6,   6}},
-	{ 0x4ab8, 0xffff, { 16,  19,  16,   6,   6,   6,   6,   2}},
-	{ 0x4ab9, 0xffff, { 20,  23,  20,   6,   6,   6,   6,   2}},
+	{ 0x4ab8, 0xffff, { 16,  19,  16, 255, 255, 255, 255, 255}},
+	{ 0x4ab8, 0xffff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x4ab8, 0xffff, {255, 255, 255, 255, 255,   6, 255,   2}},
+	{ 0x4ab9, 0xffff, { 20,  23,  20, 255, 255, 255, 255, 255}},
+	{ 0x4ab9, 0xffff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x4ab9, 0xffff, {255, 255, 255, 255, 255,   6, 255,   2}},
 	{ 0x4aba, 0xffff, {255, 255, 255,   7,   7,   7,   7,   7}},
-	{ 0x4abb, 0xffff, {255, 255, 255,   9,   9,   9,   9,   9}},
+	{ 0x4abb, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0x4abb, 0xffff, {255, 255, 255, 255, 255,   9, 255,   9}},
 	{ 0x4abc, 0xffff, {255, 255, 255,   6,   6,   6,   6,   6}},
-	{ 0x4adf, 0xffff, { 18,  19,  18,  16,  16,  16,  16,  12}},
-	{ 0x4ae7, 0xffff, { 20,  21,  20,  17,  17,  17,  17,  12}},
-	{ 0x4af8, 0xffff, { 22,  23,  22,  16,  16,  16,  16,  12}},
-	{ 0x4af9, 0xffff, { 26,  27,  26,  16,  16,  16,  16,  12}},
+	{ 0x4adf, 0xffff, { 18,  19,  18, 255, 255, 255, 255, 255}},
+	{ 0x4adf, 0xffff, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x4adf, 0xffff, {255, 255, 255, 255, 255,  16, 255,  12}},
+	{ 0x4ae7, 0xffff, { 20,  21,  20, 255, 255, 255, 255, 255}},
+	{ 0x4ae7, 0xffff, {255, 255, 255,  17,  17, 255,  17, 255}},
+	{ 0x4ae7, 0xffff, {255, 255, 255, 255, 255,  17, 255,  12}},
+	{ 0x4af8, 0xffff, { 22,  23,  22, 255, 255, 255, 255, 255}},
+	{ 0x4af8, 0xffff, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x4af8, 0xffff, {255, 255, 255, 255, 255,  16, 255,  12}},
+	{ 0x4af9, 0xffff, { 26,  27,  26, 255, 255, 255, 255, 255}},
+	{ 0x4af9, 0xffff, {255, 255, 255,  16,  16, 255,  16, 255}},
+	{ 0x4af9, 0xffff, {255, 255, 255, 255, 255,  16, 255,  12}},
 	{ 0x4afc, 0xffff, {  4,   4,   4,   4,   4,   4,   4,   4}},
-	{ 0x4c38, 0xffff, {255, 255, 255,  47,  47,  47,  47,  43}},
-	{ 0x4c39, 0xffff, {255, 255, 255,  47,  47,  47,  47,  43}},
+	{ 0x4c38, 0xffff, {255, 255, 255,  47,  47, 255,  47, 255}},
+	{ 0x4c38, 0xffff, {255, 255, 255, 255, 255,  47, 255,  43}},
+	{ 0x4c39, 0xffff, {255, 255, 255,  47,  47, 255,  47, 255}},
+	{ 0x4c39, 0xffff, {255, 255, 255, 255, 255,  47, 255,  43}},
 	{ 0x4c3a, 0xffff, {255, 255, 255,  48,  48,  48,  48,  43}},
-	{ 0x4c3b, 0xffff, {255, 255, 255,  50,  50,  50,  50,  43}},
+	{ 0x4c3b, 0xffff, {255, 255, 255,  50,  50, 255,  50, 255}},
+	{ 0x4c3b, 0xffff, {255, 255, 255, 255, 255,  50, 255,  43}},
 	{ 0x4c3c, 0xffff, {255, 255, 255,  47,  47,  47,  47,  43}},
-	{ 0x4c78, 0xffff, {255, 255, 255,  88,  88,  88,  88,  84}},
-	{ 0x4c79, 0xffff, {255, 255, 255,  88,  88,  88,  88,  84}},
+	{ 0x4c78, 0xffff, {255, 255, 255,  88,  88, 255,  88, 255}},
+	{ 0x4c78, 0xffff, {255, 255, 255, 255, 255,  88, 255,  84}},
+	{ 0x4c79, 0xffff, {255, 255, 255,  88,  88, 255,  88, 255}},
+	{ 0x4c79, 0xffff, {255, 255, 255, 255, 255,  88, 255,  84}},
 	{ 0x4c7a, 0xffff, {255, 255, 255,  89,  89,  89,  89,  84}},
-	{ 0x4c7b, 0xffff, {255, 255, 255,  91,  91,  91,  91,  84}},
+	{ 0x4c7b, 0xffff, {255, 255, 255,  91,  91, 255,  91, 255}},
+	{ 0x4c7b, 0xffff, {255, 255, 255, 255, 255,  91, 255,  84}},
 	{ 0x4c7c, 0xffff, {255, 255, 255,  88,  88,  88,  88,  84}},
-	{ 0x4cb8, 0xffff, { 16,  30,  16,  12,  12,  12,  12,   8}},
-	{ 0x4cb9, 0xffff, { 20,  34,  20,  12,  12,  12,  12,   8}},
+	{ 0x4cb8, 0xffff, { 16,  30,  16, 255, 255, 255, 255, 255}},
+	{ 0x4cb8, 0xffff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4cb8, 0xffff, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x4cb9, 0xffff, { 20,  34,  20, 255, 255, 255, 255, 255}},
+	{ 0x4cb9, 0xffff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4cb9, 0xffff, {255, 255, 255, 255, 255,  12, 255,   8}},
 	{ 0x4cba, 0xffff, { 16,  30,  16,   9,   9,   9,   9,   9}},
-	{ 0x4cbb, 0xffff, { 18,  33,  18,  11,  11,  11,  11,  11}},
-	{ 0x4cf8, 0xffff, { 16,  30,  16,  12,  12,  12,  12,   8}},
-	{ 0x4cf9, 0xffff, { 20,  34,  20,  12,  12,  12,  12,   8}},
+	{ 0x4cbb, 0xffff, { 18,  33,  18, 255, 255, 255, 255, 255}},
+	{ 0x4cbb, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x4cbb, 0xffff, {255, 255, 255, 255, 255,  11, 255,  11}},
+	{ 0x4cf8, 0xffff, { 16,  30,  16, 255, 255, 255, 255, 255}},
+	{ 0x4cf8, 0xffff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4cf8, 0xffff, {255, 255, 255, 255, 255,  12, 255,   8}},
+	{ 0x4cf9, 0xffff, { 20,  34,  20, 255, 255, 255, 255, 255}},
+	{ 0x4cf9, 0xffff, {255, 255, 255,  12,  12, 255,  12, 255}},
+	{ 0x4cf9, 0xffff, {255, 255, 255, 255, 255,  12, 255,   8}},
 	{ 0x4cfa, 0xffff, { 16,  30,  16,   9,   9,   9,   9,   9}},
-	{ 0x4cfb, 0xffff, { 18,  33,  18,  11,  11,  11,  11,  11}},
-	{ 0x4e57, 0xffff, { 16,  25,  16,   5,   5,   5,   5,   5}},
-	{ 0x4e5f, 0xffff, { 12,  15,  12,   6,   6,   6,   6,   6}},
+	{ 0x4cfb, 0xffff, { 18,  33,  18, 255, 255, 255, 255, 255}},
+	{ 0x4cfb, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0x4cfb, 0xffff, {255, 255, 255, 255, 255,  11, 255,  11}},
+	{ 0x4e57, 0xffff, { 16,  25,  16, 255, 255, 255, 255, 255}},
+	{ 0x4e57, 0xffff, {255, 255, 255,   5,   5, 255,   5, 255}},
+	{ 0x4e57, 0xffff, {255, 255, 255, 255, 255,   5, 255,   5}},
+	{ 0x4e5f, 0xffff, { 12,  15,  12, 255, 255, 255, 255, 255}},
+	{ 0x4e5f, 0xffff, {255, 255, 255,   6,   6, 255,   6, 255}},
+	{ 0x4e5f, 0xffff, {255, 255, 255, 255, 255,   6, 255,   6}},
 	{ 0x4e70, 0xffff, {  0,   0,   0,   0,   0,   0,   0,   0}},
 	{ 0x4e71, 0xffff, {  4,   7,   4,   2,   2,   2,   2,   2}},
 	{ 0x4e72, 0xffff, {  4,  13,   4,   8,   8,   8,   8,   8}},
 	{ 0x4e73, 0xffff, { 20, 255, 255, 255, 255, 255, 255, 255}},
 	{ 0x4e73, 0xffff, {255,  39,  24, 255, 255, 255, 255, 255}},
-	{ 0x4e73, 0xffff, {255, 255, 255,  20,  20,  20,  20,  20}},
-	{ 0x4e74, 0xffff, {255, 255,  16,  10,  10,  10,  10,  10}},
-	{ 0x4e75, 0xffff, { 16,  15,  16,  10,  10,  10,  10,  10}},
+	{ 0x4e73, 0xffff, {255, 255, 255,  20,  20, 255,  20, 255}},
+	{ 0x4e73, 0xffff, {255, 255, 255, 255, 255,  20, 255,  20}},
+	{ 0x4e74, 0xffff, {255, 255,  16, 255, 255, 255, 255, 255}},
+	{ 0x4e74, 0xffff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x4e74, 0xffff, {255, 255, 255, 255, 255,  10, 255,  10}},
+	{ 0x4e75, 0xffff, { 16,  15,  16, 255, 255, 255, 255, 255}},
+	{ 0x4e75, 0xffff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0x4e75, 0xffff, {255, 255, 255, 255, 255,  10, 255,  10}},
 	{ 0x4e76, 0xffff, {  4,  10,   4,   4,   4,   4,   4,   4}},
-	{ 0x4e77, 0xffff, { 20,  22,  20,  14,  14,  14,  14,  14}},
+	{ 0x4e77, 0xffff, { 20,  22,  20, 255, 255, 255, 255, 255}},
+	{ 0x4e77, 0xffff, {255, 255, 255,  14,  14, 255,  14, 255}},
+	{ 0x4e77, 0xffff, {255, 255, 255, 255, 255,  14, 255,  14}},
 	{ 0x4e7a, 0xffff, {255, 255,  12, 255, 255, 255, 255, 255}},
 	{ 0x4e7a, 0xffff, {255, 255, 255,   6,   6, 255,   6, 255}},
 	{ 0x4e7a, 0xffff, {255, 255, 255, 255, 255,   6, 255, 255}},
@@ -35190,14 +39879,24 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x4e7b, 0xffff, {255, 255, 255, 255,  12, 255, 255, 255}},
 	{ 0x4e7b, 0xffff, {255, 255, 255, 255, 255,  12, 255, 255}},
 	{ 0x4e7b, 0xffff, {255, 255, 255, 255, 255, 255, 255,  12}},
-	{ 0x4eb8, 0xffff, { 18,  24,  18,   4,   4,   4,   4,   0}},
-	{ 0x4eb9, 0xffff, { 20,  26,  20,   4,   4,   4,   4,   0}},
-	{ 0x4eba, 0xffff, { 18,  24,  18,   5,   5,   5,   5,   0}},
-	{ 0x4ebb, 0xffff, { 22,  28,  22,   7,   7,   7,   7,   0}},
+	{ 0x4eb8, 0xffff, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x4eb8, 0xffff, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x4eb8, 0xffff, {255, 255, 255, 255, 255,   4, 255,   0}},
+	{ 0x4eb9, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0x4eb9, 0xffff, {255, 255, 255,   4,   4, 255,   4, 255}},
+	{ 0x4eb9, 0xffff, {255, 255, 255, 255, 255,   4, 255,   0}},
+	{ 0x4eba, 0xffff, { 18,  24,  18, 255, 255, 255, 255, 255}},
+	{ 0x4eba, 0xffff, {255, 255, 255,   5,   5, 255,   5, 255}},
+	{ 0x4eba, 0xffff, {255, 255, 255, 255, 255,   5, 255,   0}},
+	{ 0x4ebb, 0xffff, { 22,  28,  22, 255, 255, 255, 255, 255}},
+	{ 0x4ebb, 0xffff, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x4ebb, 0xffff, {255, 255, 255, 255, 255,   7, 255,   0}},
 	{ 0x4ef8, 0xffff, { 10,  13,  10,   4,   4,   4,   4,   0}},
 	{ 0x4ef9, 0xffff, { 12,  15,  12,   4,   4,   4,   4,   0}},
 	{ 0x4efa, 0xffff, { 10,  13,  10,   5,   5,   5,   5,   0}},
-	{ 0x4efb, 0xffff, { 14,  17,  14,   7,   7,   7,   7,   0}},
+	{ 0x4efb, 0xffff, { 14,  17,  14, 255, 255, 255, 255, 255}},
+	{ 0x4efb, 0xffff, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x4efb, 0xffff, {255, 255, 255, 255, 255,   7, 255,   0}},
 	{ 0x50df, 0xffff, { 12,  18,  12,  10,  10,  10,  10,   6}},
 	{ 0x50e7, 0xffff, { 14,  20,  14,  11,  11,  11,  11,   6}},
 	{ 0x50f8, 0xffff, { 16,  22,  16,  10,  10,  10,  10,   6}},
@@ -35312,8 +40011,11 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0x5ffc, 0xffff, {255, 255, 255,   4,   4,   4,   4,   4}},
 	{ 0x6000, 0xffff, { 10,  14,  10,  10,  10,  10,  10,  10}},
 	{ 0x60ff, 0xffff, {255, 255, 255,  10,  10,  10,  10,  10}},
-	{ 0x6100, 0xffff, { 18,  22,  18,   7,   7,   7,   7,   7}},
-	{ 0x61ff, 0xffff, {255, 255, 255,   7,   7,   7,   7,   7}},
+	{ 0x6100, 0xffff, { 18,  22,  18, 255, 255, 255, 255, 255}},
+	{ 0x6100, 0xffff, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x6100, 0xffff, {255, 255, 255, 255, 255,   7, 255,   7}},
+	{ 0x61ff, 0xffff, {255, 255, 255,   7,   7, 255,   7, 255}},
+	{ 0x61ff, 0xffff, {255, 255, 255, 255, 255,   7, 255,   7}},
 	{ 0x6200, 0xffff, { 10,  14,  10,   6,   6,   6,   6,   6}},
 	{ 0x62ff, 0xffff, { 10,  13,  10, 255, 255, 255, 255, 255}},
 	{ 0x62ff, 0xffff, {255, 255, 255,   6,   6,   6,   6,   6}},
@@ -35363,45 +40065,101 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0xbf0f, 0xffff, { 12,  18,  12,   9,   9,   9,   9,   9}},
 	{ 0xcf0f, 0xffff, { 18,  31,  18,  16,  16,  16,  16,  16}},
 	{ 0xdf0f, 0xffff, { 18,  28,  18,  12,  12,  12,  12,  12}},
-	{ 0xe0f8, 0xffff, { 16,  22,  16,   9,   9,   9,   9,   5}},
-	{ 0xe0f9, 0xffff, { 20,  26,  20,   9,   9,   9,   9,   5}},
-	{ 0xe1f8, 0xffff, { 16,  22,  16,  10,  10,  10,  10,   6}},
-	{ 0xe1f9, 0xffff, { 20,  26,  20,  10,  10,  10,  10,   6}},
-	{ 0xe2f8, 0xffff, { 16,  22,  16,   9,   9,   9,   9,   5}},
-	{ 0xe2f9, 0xffff, { 20,  26,  20,   9,   9,   9,   9,   5}},
-	{ 0xe3f8, 0xffff, { 16,  22,  16,   9,   9,   9,   9,   5}},
-	{ 0xe3f9, 0xffff, { 20,  26,  20,   9,   9,   9,   9,   5}},
-	{ 0xe4f8, 0xffff, { 16,  22,  16,   9,   9,   9,   9,   5}},
-	{ 0xe4f9, 0xffff, { 20,  26,  20,   9,   9,   9,   9,   5}},
-	{ 0xe5f8, 0xffff, { 16,  22,  16,   9,   9,   9,   9,   5}},
-	{ 0xe5f9, 0xffff, { 20,  26,  20,   9,   9,   9,   9,   5}},
-	{ 0xe6f8, 0xffff, { 16,  22,  16,  11,  11,  11,  11,   7}},
-	{ 0xe6f9, 0xffff, { 20,  26,  20,  11,  11,  11,  11,   7}},
-	{ 0xe7f8, 0xffff, { 16,  22,  16,  11,  11,  11,  11,   7}},
-	{ 0xe7f9, 0xffff, { 20,  26,  20,  11,  11,  11,  11,   7}},
-	{ 0xe8f8, 0xffff, {255, 255, 255,  17,  17,  17,  17,  13}},
-	{ 0xe8f9, 0xffff, {255, 255, 255,  17,  17,  17,  17,  13}},
-	{ 0xe8fa, 0xffff, {255, 255, 255,  18,  18,  18,  18,  13}},
-	{ 0xe8fb, 0xffff, {255, 255, 255,  20,  20,  20,  20,  13}},
-	{ 0xe9f8, 0xffff, {255, 255, 255,  19,  19,  19,  19,  15}},
-	{ 0xe9f9, 0xffff, {255, 255, 255,  19,  19,  19,  19,  15}},
-	{ 0xe9fa, 0xffff, {255, 255, 255,  20,  20,  20,  20,  15}},
-	{ 0xe9fb, 0xffff, {255, 255, 255,  22,  22,  22,  22,  15}},
-	{ 0xeaf8, 0xffff, {255, 255, 255,  24,  24,  24,  24,  20}},
-	{ 0xeaf9, 0xffff, {255, 255, 255,  24,  24,  24,  24,  20}},
-	{ 0xebf8, 0xffff, {255, 255, 255,  19,  19,  19,  19,  15}},
-	{ 0xebf9, 0xffff, {255, 255, 255,  19,  19,  19,  19,  15}},
-	{ 0xebfa, 0xffff, {255, 255, 255,  20,  20,  20,  20,  15}},
-	{ 0xebfb, 0xffff, {255, 255, 255,  22,  22,  22,  22,  15}},
-	{ 0xecf8, 0xffff, {255, 255, 255,  24,  24,  24,  24,  20}},
-	{ 0xecf9, 0xffff, {255, 255, 255,  24,  24,  24,  24,  20}},
-	{ 0xedf8, 0xffff, {255, 255, 255,  32,  32,  32,  32,  28}},
-	{ 0xedf9, 0xffff, {255, 255, 255,  32,  32,  32,  32,  28}},
-	{ 0xedfa, 0xffff, {255, 255, 255,  33,  33,  33,  33,  28}},
-	{ 0xedfb, 0xffff, {255, 255, 255,  35,  35,  35,  35,  28}},
-	{ 0xeef8, 0xffff, {255, 255, 255,  24,  24,  24,  24,  20}},
-	{ 0xeef9, 0xffff, {255, 255, 255,  24,  24,  24,  24,  20}},
-	{ 0xeff8, 0xffff, {255, 255, 255,  21,  21,  21,  21,  17}},
-	{ 0xeff9, 0xffff, {255, 255, 255,  21,  21,  21,  21,  17}},
+	{ 0xe0f8, 0xffff, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe0f8, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe0f8, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe0f9, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0xe0f9, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe0f9, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe1f8, 0xffff, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe1f8, 0xffff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe1f8, 0xffff, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0xe1f9, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0xe1f9, 0xffff, {255, 255, 255,  10,  10, 255,  10, 255}},
+	{ 0xe1f9, 0xffff, {255, 255, 255, 255, 255,  10, 255,   6}},
+	{ 0xe2f8, 0xffff, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe2f8, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe2f8, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe2f9, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0xe2f9, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe2f9, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe3f8, 0xffff, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe3f8, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe3f8, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe3f9, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0xe3f9, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe3f9, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe4f8, 0xffff, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe4f8, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe4f8, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe4f9, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0xe4f9, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe4f9, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe5f8, 0xffff, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe5f8, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe5f8, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe5f9, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0xe5f9, 0xffff, {255, 255, 255,   9,   9, 255,   9, 255}},
+	{ 0xe5f9, 0xffff, {255, 255, 255, 255, 255,   9, 255,   5}},
+	{ 0xe6f8, 0xffff, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe6f8, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xe6f8, 0xffff, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0xe6f9, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0xe6f9, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xe6f9, 0xffff, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0xe7f8, 0xffff, { 16,  22,  16, 255, 255, 255, 255, 255}},
+	{ 0xe7f8, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xe7f8, 0xffff, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0xe7f9, 0xffff, { 20,  26,  20, 255, 255, 255, 255, 255}},
+	{ 0xe7f9, 0xffff, {255, 255, 255,  11,  11, 255,  11, 255}},
+	{ 0xe7f9, 0xffff, {255, 255, 255, 255, 255,  11, 255,   7}},
+	{ 0xe8f8, 0xffff, {255, 255, 255,  17,  17, 255,  17, 255}},
+	{ 0xe8f8, 0xffff, {255, 255, 255, 255, 255,  17, 255,  13}},
+	{ 0xe8f9, 0xffff, {255, 255, 255,  17,  17, 255,  17, 255}},
+	{ 0xe8f9, 0xffff, {255, 255, 255, 255, 255,  17, 255,  13}},
+	{ 0xe8fa, 0xffff, {255, 255, 255,  18,  18, 255,  18, 255}},
+	{ 0xe8fa, 0xffff, {255, 255, 255, 255, 255,  18, 255,  13}},
+	{ 0xe8fb, 0xffff, {255, 255, 255,  20,  20, 255,  20, 255}},
+	{ 0xe8fb, 0xffff, {255, 255, 255, 255, 255,  20, 255,  13}},
+	{ 0xe9f8, 0xffff, {255, 255, 255,  19,  19, 255,  19, 255}},
+	{ 0xe9f8, 0xffff, {255, 255, 255, 255, 255,  19, 255,  15}},
+	{ 0xe9f9, 0xffff, {255, 255, 255,  19,  19, 255,  19, 255}},
+	{ 0xe9f9, 0xffff, {255, 255, 255, 255, 255,  19, 255,  15}},
+	{ 0xe9fa, 0xffff, {255, 255, 255,  20,  20, 255,  20, 255}},
+	{ 0xe9fa, 0xffff, {255, 255, 255, 255, 255,  20, 255,  15}},
+	{ 0xe9fb, 0xffff, {255, 255, 255,  22,  22, 255,  22, 255}},
+	{ 0xe9fb, 0xffff, {255, 255, 255, 255, 255,  22, 255,  15}},
+	{ 0xeaf8, 0xffff, {255, 255, 255,  24,  24, 255,  24, 255}},
+	{ 0xeaf8, 0xffff, {255, 255, 255, 255, 255,  24, 255,  20}},
+	{ 0xeaf9, 0xffff, {255, 255, 255,  24,  24, 255,  24, 255}},
+	{ 0xeaf9, 0xffff, {255, 255, 255, 255, 255,  24, 255,  20}},
+	{ 0xebf8, 0xffff, {255, 255, 255,  19,  19, 255,  19, 255}},
+	{ 0xebf8, 0xffff, {255, 255, 255, 255, 255,  19, 255,  15}},
+	{ 0xebf9, 0xffff, {255, 255, 255,  19,  19, 255,  19, 255}},
+	{ 0xebf9, 0xffff, {255, 255, 255, 255, 255,  19, 255,  15}},
+	{ 0xebfa, 0xffff, {255, 255, 255,  20,  20, 255,  20, 255}},
+	{ 0xebfa, 0xffff, {255, 255, 255, 255, 255,  20, 255,  15}},
+	{ 0xebfb, 0xffff, {255, 255, 255,  22,  22, 255,  22, 255}},
+	{ 0xebfb, 0xffff, {255, 255, 255, 255, 255,  22, 255,  15}},
+	{ 0xecf8, 0xffff, {255, 255, 255,  24,  24, 255,  24, 255}},
+	{ 0xecf8, 0xffff, {255, 255, 255, 255, 255,  24, 255,  20}},
+	{ 0xecf9, 0xffff, {255, 255, 255,  24,  24, 255,  24, 255}},
+	{ 0xecf9, 0xffff, {255, 255, 255, 255, 255,  24, 255,  20}},
+	{ 0xedf8, 0xffff, {255, 255, 255,  32,  32, 255,  32, 255}},
+	{ 0xedf8, 0xffff, {255, 255, 255, 255, 255,  32, 255,  28}},
+	{ 0xedf9, 0xffff, {255, 255, 255,  32,  32, 255,  32, 255}},
+	{ 0xedf9, 0xffff, {255, 255, 255, 255, 255,  32, 255,  28}},
+	{ 0xedfa, 0xffff, {255, 255, 255,  33,  33, 255,  33, 255}},
+	{ 0xedfa, 0xffff, {255, 255, 255, 255, 255,  33, 255,  28}},
+	{ 0xedfb, 0xffff, {255, 255, 255,  35,  35, 255,  35, 255}},
+	{ 0xedfb, 0xffff, {255, 255, 255, 255, 255,  35, 255,  28}},
+	{ 0xeef8, 0xffff, {255, 255, 255,  24,  24, 255,  24, 255}},
+	{ 0xeef8, 0xffff, {255, 255, 255, 255, 255,  24, 255,  20}},
+	{ 0xeef9, 0xffff, {255, 255, 255,  24,  24, 255,  24, 255}},
+	{ 0xeef9, 0xffff, {255, 255, 255, 255, 255,  24, 255,  20}},
+	{ 0xeff8, 0xffff, {255, 255, 255,  21,  21, 255,  21, 255}},
+	{ 0xeff8, 0xffff, {255, 255, 255, 255, 255,  21, 255,  17}},
+	{ 0xeff9, 0xffff, {255, 255, 255,  21,  21, 255,  21, 255}},
+	{ 0xeff9, 0xffff, {255, 255, 255, 255, 255,  21, 255,  17}},
 	{ 0, 0, {0, 0, 0, 0, 0}}
 };
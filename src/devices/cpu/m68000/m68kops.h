@@ -16,35 +16,35 @@ void xd01f_add_b_pi7_071234fc();
 void xd020_add_b_pd_071234fc();
 void xd027_add_b_pd7_071234fc();
 void xd028_add_b_di_071234fc();
-void xd030_add_b_ix_071234fc();
+template <u32 Types> void xd030_add_b_ix_071234fc();
 void xd038_add_b_aw_071234fc();
 void xd039_add_b_al_071234fc();
 void xd03a_add_b_pcdi_071234fc();
-void xd03b_add_b_pcix_071234fc();
+template <u32 Types> void xd03b_add_b_pcix_071234fc();
 void xd03c_add_b_i_071234fc();
 void xd040_add_w_071234fc();
 void xd048_add_w_071234fc();
-void xd050_add_w_ai_071234fc();
-void xd058_add_w_pi_071234fc();
-void xd060_add_w_pd_071234fc();
-void xd068_add_w_di_071234fc();
-void xd070_add_w_ix_071234fc();
-void xd078_add_w_aw_071234fc();
-void xd079_add_w_al_071234fc();
+template <u32 Types> void xd050_add_w_ai_071234fc();
+template <u32 Types> void xd058_add_w_pi_071234fc();
+template <u32 Types> void xd060_add_w_pd_071234fc();
+template <u32 Types> void xd068_add_w_di_071234fc();
+template <u32 Types> void xd070_add_w_ix_071234fc();
+template <u32 Types> void xd078_add_w_aw_071234fc();
+template <u32 Types> void xd079_add_w_al_071234fc();
 void xd07a_add_w_pcdi_071234fc();
-void xd07b_add_w_pcix_071234fc();
+template <u32 Types> void xd07b_add_w_pcix_071234fc();
 void xd07c_add_w_i_071234fc();
 void xd080_add_l_071234fc();
 void xd088_add_l_071234fc();
-void xd090_add_l_ai_071234fc();
-void xd098_add_l_pi_071234fc();
-void xd0a0_add_l_pd_071234fc();
-void xd0a8_add_l_di_071234fc();
-void xd0b0_add_l_ix_071234fc();
-void xd0b8_add_l_aw_071234fc();
-void xd0b9_add_l_al_071234fc();
+template <u32 Types> void xd090_add_l_ai_071234fc();
+template <u32 Types> void xd098_add_l_pi_071234fc();
+template <u32 Types> void xd0a0_add_l_pd_071234fc();
+template <u32 Types> void xd0a8_add_l_di_071234fc();
+template <u32 Types> void xd0b0_add_l_ix_071234fc();
+template <u32 Types> void xd0b8_add_l_aw_071234fc();
+template <u32 Types> void xd0b9_add_l_al_071234fc();
 void xd0ba_add_l_pcdi_071234fc();
-void xd0bb_add_l_pcix_071234fc();
+template <u32 Types> void xd0bb_add_l_pcix_071234fc();
 void xd0bc_add_l_i_071234fc();
 void xd110_add_b_ai_071234fc();
 void xd118_add_b_pi_071234fc();
@@ -52,46 +52,46 @@ void xd11f_add_b_pi7_071234fc();
 void xd120_add_b_pd_071234fc();
 void xd127_add_b_pd7_071234fc();
 void xd128_add_b_di_071234fc();
-void xd130_add_b_ix_071234fc();
+template <u32 Types> void xd130_add_b_ix_071234fc();
 void xd138_add_b_aw_071234fc();
 void xd139_add_b_al_071234fc();
-void xd150_add_w_ai_071234fc();
-void xd158_add_w_pi_071234fc();
-void xd160_add_w_pd_071234fc();
-void xd168_add_w_di_071234fc();
-void xd170_add_w_ix_071234fc();
-void xd178_add_w_aw_071234fc();
-void xd179_add_w_al_071234fc();
-void xd190_add_l_ai_071234fc();
-void xd198_add_l_pi_071234fc();
-void xd1a0_add_l_pd_071234fc();
-void xd1a8_add_l_di_071234fc();
-void xd1b0_add_l_ix_071234fc();
-void xd1b8_add_l_aw_071234fc();
-void xd1b9_add_l_al_071234fc();
+template <u32 Types> void xd150_add_w_ai_071234fc();
+template <u32 Types> void xd158_add_w_pi_071234fc();
+template <u32 Types> void xd160_add_w_pd_071234fc();
+template <u32 Types> void xd168_add_w_di_071234fc();
+template <u32 Types> void xd170_add_w_ix_071234fc();
+template <u32 Types> void xd178_add_w_aw_071234fc();
+template <u32 Types> void xd179_add_w_al_071234fc();
+template <u32 Types> void xd190_add_l_ai_071234fc();
+template <u32 Types> void xd198_add_l_pi_071234fc();
+template <u32 Types> void xd1a0_add_l_pd_071234fc();
+template <u32 Types> void xd1a8_add_l_di_071234fc();
+template <u32 Types> void xd1b0_add_l_ix_071234fc();
+template <u32 Types> void xd1b8_add_l_aw_071234fc();
+template <u32 Types> void xd1b9_add_l_al_071234fc();
 void xd0c0_adda_w_071234fc();
 void xd0c8_adda_w_071234fc();
-void xd0d0_adda_w_ai_071234fc();
-void xd0d8_adda_w_pi_071234fc();
-void xd0e0_adda_w_pd_071234fc();
-void xd0e8_adda_w_di_071234fc();
-void xd0f0_adda_w_ix_071234fc();
-void xd0f8_adda_w_aw_071234fc();
-void xd0f9_adda_w_al_071234fc();
+template <u32 Types> void xd0d0_adda_w_ai_071234fc();
+template <u32 Types> void xd0d8_adda_w_pi_071234fc();
+template <u32 Types> void xd0e0_adda_w_pd_071234fc();
+template <u32 Types> void xd0e8_adda_w_di_071234fc();
+template <u32 Types> void xd0f0_adda_w_ix_071234fc();
+template <u32 Types> void xd0f8_adda_w_aw_071234fc();
+template <u32 Types> void xd0f9_adda_w_al_071234fc();
 void xd0fa_adda_w_pcdi_071234fc();
-void xd0fb_adda_w_pcix_071234fc();
+template <u32 Types> void xd0fb_adda_w_pcix_071234fc();
 void xd0fc_adda_w_i_071234fc();
 void xd1c0_adda_l_071234fc();
 void xd1c8_adda_l_071234fc();
-void xd1d0_adda_l_ai_071234fc();
-void xd1d8_adda_l_pi_071234fc();
-void xd1e0_adda_l_pd_071234fc();
-void xd1e8_adda_l_di_071234fc();
-void xd1f0_adda_l_ix_071234fc();
-void xd1f8_adda_l_aw_071234fc();
-void xd1f9_adda_l_al_071234fc();
+template <u32 Types> void xd1d0_adda_l_ai_071234fc();
+template <u32 Types> void xd1d8_adda_l_pi_071234fc();
+template <u32 Types> void xd1e0_adda_l_pd_071234fc();
+template <u32 Types> void xd1e8_adda_l_di_071234fc();
+template <u32 Types> void xd1f0_adda_l_ix_071234fc();
+template <u32 Types> void xd1f8_adda_l_aw_071234fc();
+template <u32 Types> void xd1f9_adda_l_al_071234fc();
 void xd1fa_adda_l_pcdi_071234fc();
-void xd1fb_adda_l_pcix_071234fc();
+template <u32 Types> void xd1fb_adda_l_pcix_071234fc();
 void xd1fc_adda_l_i_071234fc();
 void x0600_addi_b_071234fc();
 void x0610_addi_b_ai_071234fc();
@@ -100,25 +100,25 @@ void x061f_addi_b_pi7_071234fc();
 void x0620_addi_b_pd_071234fc();
 void x0627_addi_b_pd7_071234fc();
 void x0628_addi_b_di_071234fc();
-void x0630_addi_b_ix_071234fc();
+template <u32 Types> void x0630_addi_b_ix_071234fc();
 void x0638_addi_b_aw_071234fc();
 void x0639_addi_b_al_071234fc();
 void x0640_addi_w_071234fc();
-void x0650_addi_w_ai_071234fc();
-void x0658_addi_w_pi_071234fc();
-void x0660_addi_w_pd_071234fc();
-void x0668_addi_w_di_071234fc();
-void x0670_addi_w_ix_071234fc();
-void x0678_addi_w_aw_071234fc();
-void x0679_addi_w_al_071234fc();
+template <u32 Types> void x0650_addi_w_ai_071234fc();
+template <u32 Types> void x0658_addi_w_pi_071234fc();
+template <u32 Types> void x0660_addi_w_pd_071234fc();
+template <u32 Types> void x0668_addi_w_di_071234fc();
+template <u32 Types> void x0670_addi_w_ix_071234fc();
+template <u32 Types> void x0678_addi_w_aw_071234fc();
+template <u32 Types> void x0679_addi_w_al_071234fc();
 void x0680_addi_l_071234fc();
-void x0690_addi_l_ai_071234fc();
-void x0698_addi_l_pi_071234fc();
-void x06a0_addi_l_pd_071234fc();
-void x06a8_addi_l_di_071234fc();
-void x06b0_addi_l_ix_071234fc();
-void x06b8_addi_l_aw_071234fc();
-void x06b9_addi_l_al_071234fc();
+template <u32 Types> void x0690_addi_l_ai_071234fc();
+template <u32 Types> void x0698_addi_l_pi_071234fc();
+template <u32 Types> void x06a0_addi_l_pd_071234fc();
+template <u32 Types> void x06a8_addi_l_di_071234fc();
+template <u32 Types> void x06b0_addi_l_ix_071234fc();
+template <u32 Types> void x06b8_addi_l_aw_071234fc();
+template <u32 Types> void x06b9_addi_l_al_071234fc();
 void x5000_addq_b_071234fc();
 void x5010_addq_b_ai_071234fc();
 void x5018_addq_b_pi_071234fc();
@@ -126,27 +126,27 @@ void x501f_addq_b_pi7_071234fc();
 void x5020_addq_b_pd_071234fc();
 void x5027_addq_b_pd7_071234fc();
 void x5028_addq_b_di_071234fc();
-void x5030_addq_b_ix_071234fc();
+template <u32 Types> void x5030_addq_b_ix_071234fc();
 void x5038_addq_b_aw_071234fc();
 void x5039_addq_b_al_071234fc();
 void x5040_addq_w_071234fc();
 void x5048_addq_w_071234fc();
-void x5050_addq_w_ai_071234fc();
-void x5058_addq_w_pi_071234fc();
-void x5060_addq_w_pd_071234fc();
-void x5068_addq_w_di_071234fc();
-void x5070_addq_w_ix_071234fc();
-void x5078_addq_w_aw_071234fc();
-void x5079_addq_w_al_071234fc();
+template <u32 Types> void x5050_addq_w_ai_071234fc();
+template <u32 Types> void x5058_addq_w_pi_071234fc();
+template <u32 Types> void x5060_addq_w_pd_071234fc();
+template <u32 Types> void x5068_addq_w_di_071234fc();
+template <u32 Types> void x5070_addq_w_ix_071234fc();
+template <u32 Types> void x5078_addq_w_aw_071234fc();
+template <u32 Types> void x5079_addq_w_al_071234fc();
 void x5080_addq_l_071234fc();
 void x5088_addq_l_071234fc();
-void x5090_addq_l_ai_071234fc();
-void x5098_addq_l_pi_071234fc();
-void x50a0_addq_l_pd_071234fc();
-void x50a8_addq_l_di_071234fc();
-void x50b0_addq_l_ix_071234fc();
-void x50b8_addq_l_aw_071234fc();
-void x50b9_addq_l_al_071234fc();
+template <u32 Types> void x5090_addq_l_ai_071234fc();
+template <u32 Types> void x5098_addq_l_pi_071234fc();
+template <u32 Types> void x50a0_addq_l_pd_071234fc();
+template <u32 Types> void x50a8_addq_l_di_071234fc();
+template <u32 Types> void x50b0_addq_l_ix_071234fc();
+template <u32 Types> void x50b8_addq_l_aw_071234fc();
+template <u32 Types> void x50b9_addq_l_al_071234fc();
 void xd100_addx_b_071234fc();
 void xd140_addx_w_071234fc();
 void xd180_addx_l_071234fc();
@@ -154,8 +154,8 @@ void xdf08_addx_b_071234fc();
 void xd10f_addx_b_071234fc();
 void xdf0f_addx_b_071234fc();
 void xd108_addx_b_071234fc();
-void xd148_addx_w_071234fc();
-void xd188_addx_l_071234fc();
+template <u32 Types> void xd148_addx_w_071234fc();
+template <u32 Types> void xd188_addx_l_071234fc();
 void xc000_and_b_071234fc();
 void xc010_and_b_ai_071234fc();
 void xc018_and_b_pi_071234fc();
@@ -163,33 +163,33 @@ void xc01f_and_b_pi7_071234fc();
 void xc020_and_b_pd_071234fc();
 void xc027_and_b_pd7_071234fc();
 void xc028_and_b_di_071234fc();
-void xc030_and_b_ix_071234fc();
+template <u32 Types> void xc030_and_b_ix_071234fc();
 void xc038_and_b_aw_071234fc();
 void xc039_and_b_al_071234fc();
 void xc03a_and_b_pcdi_071234fc();
-void xc03b_and_b_pcix_071234fc();
+template <u32 Types> void xc03b_and_b_pcix_071234fc();
 void xc03c_and_b_i_071234fc();
 void xc040_and_w_071234fc();
-void xc050_and_w_ai_071234fc();
-void xc058_and_w_pi_071234fc();
-void xc060_and_w_pd_071234fc();
-void xc068_and_w_di_071234fc();
-void xc070_and_w_ix_071234fc();
-void xc078_and_w_aw_071234fc();
-void xc079_and_w_al_071234fc();
+template <u32 Types> void xc050_and_w_ai_071234fc();
+template <u32 Types> void xc058_and_w_pi_071234fc();
+template <u32 Types> void xc060_and_w_pd_071234fc();
+template <u32 Types> void xc068_and_w_di_071234fc();
+template <u32 Types> void xc070_and_w_ix_071234fc();
+template <u32 Types> void xc078_and_w_aw_071234fc();
+template <u32 Types> void xc079_and_w_al_071234fc();
 void xc07a_and_w_pcdi_071234fc();
-void xc07b_and_w_pcix_071234fc();
+template <u32 Types> void xc07b_and_w_pcix_071234fc();
 void xc07c_and_w_i_071234fc();
 void xc080_and_l_071234fc();
-void xc090_and_l_ai_071234fc();
-void xc098_and_l_pi_071234fc();
-void xc0a0_and_l_pd_071234fc();
-void xc0a8_and_l_di_071234fc();
-void xc0b0_and_l_ix_071234fc();
-void xc0b8_and_l_aw_071234fc();
-void xc0b9_and_l_al_071234fc();
+template <u32 Types> void xc090_and_l_ai_071234fc();
+template <u32 Types> void xc098_and_l_pi_071234fc();
+template <u32 Types> void xc0a0_and_l_pd_071234fc();
+template <u32 Types> void xc0a8_and_l_di_071234fc();
+template <u32 Types> void xc0b0_and_l_ix_071234fc();
+template <u32 Types> void xc0b8_and_l_aw_071234fc();
+template <u32 Types> void xc0b9_and_l_al_071234fc();
 void xc0ba_and_l_pcdi_071234fc();
-void xc0bb_and_l_pcix_071234fc();
+template <u32 Types> void xc0bb_and_l_pcix_071234fc();
 void xc0bc_and_l_i_071234fc();
 void xc110_and_b_ai_071234fc();
 void xc118_and_b_pi_071234fc();
@@ -197,23 +197,23 @@ void xc11f_and_b_pi7_071234fc();
 void xc120_and_b_pd_071234fc();
 void xc127_and_b_pd7_071234fc();
 void xc128_and_b_di_071234fc();
-void xc130_and_b_ix_071234fc();
+template <u32 Types> void xc130_and_b_ix_071234fc();
 void xc138_and_b_aw_071234fc();
 void xc139_and_b_al_071234fc();
-void xc150_and_w_ai_071234fc();
-void xc158_and_w_pi_071234fc();
-void xc160_and_w_pd_071234fc();
-void xc168_and_w_di_071234fc();
-void xc170_and_w_ix_071234fc();
-void xc178_and_w_aw_071234fc();
-void xc179_and_w_al_071234fc();
-void xc190_and_l_ai_071234fc();
-void xc198_and_l_pi_071234fc();
-void xc1a0_and_l_pd_071234fc();
-void xc1a8_and_l_di_071234fc();
-void xc1b0_and_l_ix_071234fc();
-void xc1b8_and_l_aw_071234fc();
-void xc1b9_and_l_al_071234fc();
+template <u32 Types> void xc150_and_w_ai_071234fc();
+template <u32 Types> void xc158_and_w_pi_071234fc();
+template <u32 Types> void xc160_and_w_pd_071234fc();
+template <u32 Types> void xc168_and_w_di_071234fc();
+template <u32 Types> void xc170_and_w_ix_071234fc();
+template <u32 Types> void xc178_and_w_aw_071234fc();
+template <u32 Types> void xc179_and_w_al_071234fc();
+template <u32 Types> void xc190_and_l_ai_071234fc();
+template <u32 Types> void xc198_and_l_pi_071234fc();
+template <u32 Types> void xc1a0_and_l_pd_071234fc();
+template <u32 Types> void xc1a8_and_l_di_071234fc();
+template <u32 Types> void xc1b0_and_l_ix_071234fc();
+template <u32 Types> void xc1b8_and_l_aw_071234fc();
+template <u32 Types> void xc1b9_and_l_al_071234fc();
 void x0200_andi_b_071234fc();
 void x0210_andi_b_ai_071234fc();
 void x0218_andi_b_pi_071234fc();
@@ -221,25 +221,25 @@ void x021f_andi_b_pi7_071234fc();
 void x0220_andi_b_pd_071234fc();
 void x0227_andi_b_pd7_071234fc();
 void x0228_andi_b_di_071234fc();
-void x0230_andi_b_ix_071234fc();
+template <u32 Types> void x0230_andi_b_ix_071234fc();
 void x0238_andi_b_aw_071234fc();
 void x0239_andi_b_al_071234fc();
 void x0240_andi_w_071234fc();
-void x0250_andi_w_ai_071234fc();
-void x0258_andi_w_pi_071234fc();
-void x0260_andi_w_pd_071234fc();
-void x0268_andi_w_di_071234fc();
-void x0270_andi_w_ix_071234fc();
-void x0278_andi_w_aw_071234fc();
-void x0279_andi_w_al_071234fc();
+template <u32 Types> void x0250_andi_w_ai_071234fc();
+template <u32 Types> void x0258_andi_w_pi_071234fc();
+template <u32 Types> void x0260_andi_w_pd_071234fc();
+template <u32 Types> void x0268_andi_w_di_071234fc();
+template <u32 Types> void x0270_andi_w_ix_071234fc();
+template <u32 Types> void x0278_andi_w_aw_071234fc();
+template <u32 Types> void x0279_andi_w_al_071234fc();
 void x0280_andi_l_071234fc();
-void x0290_andi_l_ai_071234fc();
-void x0298_andi_l_pi_071234fc();
-void x02a0_andi_l_pd_071234fc();
-void x02a8_andi_l_di_071234fc();
-void x02b0_andi_l_ix_071234fc();
-void x02b8_andi_l_aw_071234fc();
-void x02b9_andi_l_al_071234fc();
+template <u32 Types> void x0290_andi_l_ai_071234fc();
+template <u32 Types> void x0298_andi_l_pi_071234fc();
+template <u32 Types> void x02a0_andi_l_pd_071234fc();
+template <u32 Types> void x02a8_andi_l_di_071234fc();
+template <u32 Types> void x02b0_andi_l_ix_071234fc();
+template <u32 Types> void x02b8_andi_l_aw_071234fc();
+template <u32 Types> void x02b9_andi_l_al_071234fc();
 void x023c_andi_w_071234fc();
 void x027c_andi_w_071234fc();
 void xe000_asr_b_071234fc();
@@ -248,26 +248,26 @@ void xe080_asr_l_071234fc();
 void xe020_asr_b_071234fc();
 void xe060_asr_w_071234fc();
 void xe0a0_asr_l_071234fc();
-void xe0d0_asr_w_ai_071234fc();
-void xe0d8_asr_w_pi_071234fc();
-void xe0e0_asr_w_pd_071234fc();
-void xe0e8_asr_w_di_071234fc();
-void xe0f0_asr_w_ix_071234fc();
-void xe0f8_asr_w_aw_071234fc();
-void xe0f9_asr_w_al_071234fc();
+template <u32 Types> void xe0d0_asr_w_ai_071234fc();
+template <u32 Types> void xe0d8_asr_w_pi_071234fc();
+template <u32 Types> void xe0e0_asr_w_pd_071234fc();
+template <u32 Types> void xe0e8_asr_w_di_071234fc();
+template <u32 Types> void xe0f0_asr_w_ix_071234fc();
+template <u32 Types> void xe0f8_asr_w_aw_071234fc();
+template <u32 Types> void xe0f9_asr_w_al_071234fc();
 void xe100_asl_b_071234fc();
 void xe140_asl_w_071234fc();
 void xe180_asl_l_071234fc();
 void xe120_asl_b_071234fc();
 void xe160_asl_w_071234fc();
 void xe1a0_asl_l_071234fc();
-void xe1d0_asl_w_ai_071234fc();
-void xe1d8_asl_w_pi_071234fc();
-void xe1e0_asl_w_pd_071234fc();
-void xe1e8_asl_w_di_071234fc();
-void xe1f0_asl_w_ix_071234fc();
-void xe1f8_asl_w_aw_071234fc();
-void xe1f9_asl_w_al_071234fc();
+template <u32 Types> void xe1d0_asl_w_ai_071234fc();
+template <u32 Types> void xe1d8_asl_w_pi_071234fc();
+template <u32 Types> void xe1e0_asl_w_pd_071234fc();
+template <u32 Types> void xe1e8_asl_w_di_071234fc();
+template <u32 Types> void xe1f0_asl_w_ix_071234fc();
+template <u32 Types> void xe1f8_asl_w_aw_071234fc();
+template <u32 Types> void xe1f9_asl_w_al_071234fc();
 void x6200_bhi_b_071234fc();
 void x6300_bls_b_071234fc();
 void x6400_bcc_b_071234fc();
@@ -331,7 +331,7 @@ void x015f_bchg_b_pi7_071234fc();
 void x0160_bchg_b_pd_071234fc();
 void x0167_bchg_b_pd7_071234fc();
 void x0168_bchg_b_di_071234fc();
-void x0170_bchg_b_ix_071234fc();
+template <u32 Types> void x0170_bchg_b_ix_071234fc();
 void x0178_bchg_b_aw_071234fc();
 void x0179_bchg_b_al_071234fc();
 void x0840_bchg_l_071234fc();
@@ -341,7 +341,7 @@ void x085f_bchg_b_pi7_071234fc();
 void x0860_bchg_b_pd_071234fc();
 void x0867_bchg_b_pd7_071234fc();
 void x0868_bchg_b_di_071234fc();
-void x0870_bchg_b_ix_071234fc();
+template <u32 Types> void x0870_bchg_b_ix_071234fc();
 void x0878_bchg_b_aw_071234fc();
 void x0879_bchg_b_al_071234fc();
 void x0180_bclr_l_071234fc();
@@ -351,7 +351,7 @@ void x019f_bclr_b_pi7_071234fc();
 void x01a0_bclr_b_pd_071234fc();
 void x01a7_bclr_b_pd7_071234fc();
 void x01a8_bclr_b_di_071234fc();
-void x01b0_bclr_b_ix_071234fc();
+template <u32 Types> void x01b0_bclr_b_ix_071234fc();
 void x01b8_bclr_b_aw_071234fc();
 void x01b9_bclr_b_al_071234fc();
 void x0880_bclr_l_071234fc();
@@ -361,65 +361,65 @@ void x089f_bclr_b_pi7_071234fc();
 void x08a0_bclr_b_pd_071234fc();
 void x08a7_bclr_b_pd7_071234fc();
 void x08a8_bclr_b_di_071234fc();
-void x08b0_bclr_b_ix_071234fc();
+template <u32 Types> void x08b0_bclr_b_ix_071234fc();
 void x08b8_bclr_b_aw_071234fc();
 void x08b9_bclr_b_al_071234fc();
 void xeac0_bfchg_l_234fc();
-void xead0_bfchg_l_ai_234fc();
-void xeae8_bfchg_l_di_234fc();
-void xeaf0_bfchg_l_ix_234fc();
-void xeaf8_bfchg_l_aw_234fc();
-void xeaf9_bfchg_l_al_234fc();
+template <u32 Types> void xead0_bfchg_l_ai_234fc();
+template <u32 Types> void xeae8_bfchg_l_di_234fc();
+template <u32 Types> void xeaf0_bfchg_l_ix_234fc();
+template <u32 Types> void xeaf8_bfchg_l_aw_234fc();
+template <u32 Types> void xeaf9_bfchg_l_al_234fc();
 void xecc0_bfclr_l_234fc();
-void xecd0_bfclr_l_ai_234fc();
-void xece8_bfclr_l_di_234fc();
-void xecf0_bfclr_l_ix_234fc();
-void xecf8_bfclr_l_aw_234fc();
-void xecf9_bfclr_l_al_234fc();
+template <u32 Types> void xecd0_bfclr_l_ai_234fc();
+template <u32 Types> void xece8_bfclr_l_di_234fc();
+template <u32 Types> void xecf0_bfclr_l_ix_234fc();
+template <u32 Types> void xecf8_bfclr_l_aw_234fc();
+template <u32 Types> void xecf9_bfclr_l_al_234fc();
 void xebc0_bfexts_l_234fc();
-void xebd0_bfexts_l_ai_234fc();
-void xebe8_bfexts_l_di_234fc();
-void xebf0_bfexts_l_ix_234fc();
-void xebf8_bfexts_l_aw_234fc();
-void xebf9_bfexts_l_al_234fc();
-void xebfa_bfexts_l_pcdi_234fc();
-void xebfb_bfexts_l_pcix_234fc();
+template <u32 Types> void xebd0_bfexts_l_ai_234fc();
+template <u32 Types> void xebe8_bfexts_l_di_234fc();
+template <u32 Types> void xebf0_bfexts_l_ix_234fc();
+template <u32 Types> void xebf8_bfexts_l_aw_234fc();
+template <u32 Types> void xebf9_bfexts_l_al_234fc();
+template <u32 Types> void xebfa_bfexts_l_pcdi_234fc();
+template <u32 Types> void xebfb_bfexts_l_pcix_234fc();
 void xe9c0_bfextu_l_234fc();
-void xe9d0_bfextu_l_ai_234fc();
-void xe9e8_bfextu_l_di_234fc();
-void xe9f0_bfextu_l_ix_234fc();
-void xe9f8_bfextu_l_aw_234fc();
-void xe9f9_bfextu_l_al_234fc();
-void xe9fa_bfextu_l_pcdi_234fc();
-void xe9fb_bfextu_l_pcix_234fc();
+template <u32 Types> void xe9d0_bfextu_l_ai_234fc();
+template <u32 Types> void xe9e8_bfextu_l_di_234fc();
+template <u32 Types> void xe9f0_bfextu_l_ix_234fc();
+template <u32 Types> void xe9f8_bfextu_l_aw_234fc();
+template <u32 Types> void xe9f9_bfextu_l_al_234fc();
+template <u32 Types> void xe9fa_bfextu_l_pcdi_234fc();
+template <u32 Types> void xe9fb_bfextu_l_pcix_234fc();
 void xedc0_bfffo_l_234fc();
-void xedd0_bfffo_l_ai_234fc();
-void xede8_bfffo_l_di_234fc();
-void xedf0_bfffo_l_ix_234fc();
-void xedf8_bfffo_l_aw_234fc();
-void xedf9_bfffo_l_al_234fc();
-void xedfa_bfffo_l_pcdi_234fc();
-void xedfb_bfffo_l_pcix_234fc();
+template <u32 Types> void xedd0_bfffo_l_ai_234fc();
+template <u32 Types> void xede8_bfffo_l_di_234fc();
+template <u32 Types> void xedf0_bfffo_l_ix_234fc();
+template <u32 Types> void xedf8_bfffo_l_aw_234fc();
+template <u32 Types> void xedf9_bfffo_l_al_234fc();
+template <u32 Types> void xedfa_bfffo_l_pcdi_234fc();
+template <u32 Types> void xedfb_bfffo_l_pcix_234fc();
 void xefc0_bfins_l_234fc();
-void xefd0_bfins_l_ai_234fc();
-void xefe8_bfins_l_di_234fc();
-void xeff0_bfins_l_ix_234fc();
-void xeff8_bfins_l_aw_234fc();
-void xeff9_bfins_l_al_234fc();
+template <u32 Types> void xefd0_bfins_l_ai_234fc();
+template <u32 Types> void xefe8_bfins_l_di_234fc();
+template <u32 Types> void xeff0_bfins_l_ix_234fc();
+template <u32 Types> void xeff8_bfins_l_aw_234fc();
+template <u32 Types> void xeff9_bfins_l_al_234fc();
 void xeec0_bfset_l_234fc();
-void xeed0_bfset_l_ai_234fc();
-void xeee8_bfset_l_di_234fc();
-void xeef0_bfset_l_ix_234fc();
-void xeef8_bfset_l_aw_234fc();
-void xeef9_bfset_l_al_234fc();
+template <u32 Types> void xeed0_bfset_l_ai_234fc();
+template <u32 Types> void xeee8_bfset_l_di_234fc();
+template <u32 Types> void xeef0_bfset_l_ix_234fc();
+template <u32 Types> void xeef8_bfset_l_aw_234fc();
+template <u32 Types> void xeef9_bfset_l_al_234fc();
 void xe8c0_bftst_l_234fc();
-void xe8d0_bftst_l_ai_234fc();
-void xe8e8_bftst_l_di_234fc();
-void xe8f0_bftst_l_ix_234fc();
-void xe8f8_bftst_l_aw_234fc();
-void xe8f9_bftst_l_al_234fc();
-void xe8fa_bftst_l_pcdi_234fc();
-void xe8fb_bftst_l_pcix_234fc();
+template <u32 Types> void xe8d0_bftst_l_ai_234fc();
+template <u32 Types> void xe8e8_bftst_l_di_234fc();
+template <u32 Types> void xe8f0_bftst_l_ix_234fc();
+template <u32 Types> void xe8f8_bftst_l_aw_234fc();
+template <u32 Types> void xe8f9_bftst_l_al_234fc();
+template <u32 Types> void xe8fa_bftst_l_pcdi_234fc();
+template <u32 Types> void xe8fb_bftst_l_pcix_234fc();
 void x4848_bkpt_1();
 void x4848_bkpt_234fc();
 void x6000_bra_b_071234fc();
@@ -432,7 +432,7 @@ void x01df_bset_b_pi7_071234fc();
 void x01e0_bset_b_pd_071234fc();
 void x01e7_bset_b_pd7_071234fc();
 void x01e8_bset_b_di_071234fc();
-void x01f0_bset_b_ix_071234fc();
+template <u32 Types> void x01f0_bset_b_ix_071234fc();
 void x01f8_bset_b_aw_071234fc();
 void x01f9_bset_b_al_071234fc();
 void x08c0_bset_l_071234fc();
@@ -442,12 +442,12 @@ void x08df_bset_b_pi7_071234fc();
 void x08e0_bset_b_pd_071234fc();
 void x08e7_bset_b_pd7_071234fc();
 void x08e8_bset_b_di_071234fc();
-void x08f0_bset_b_ix_071234fc();
+template <u32 Types> void x08f0_bset_b_ix_071234fc();
 void x08f8_bset_b_aw_071234fc();
 void x08f9_bset_b_al_071234fc();
-void x6100_bsr_b_071234fc();
-void x6100_bsr_w_071234fc();
-void x61ff_bsr_l_234fc();
+template <u32 Types> void x6100_bsr_b_071234fc();
+template <u32 Types> void x6100_bsr_w_071234fc();
+template <u32 Types> void x61ff_bsr_l_234fc();
 void x0100_btst_l_071234fc();
 void x0110_btst_b_ai_071234fc();
 void x0118_btst_b_pi_071234fc();
@@ -455,11 +455,11 @@ void x011f_btst_b_pi7_071234fc();
 void x0120_btst_b_pd_071234fc();
 void x0127_btst_b_pd7_071234fc();
 void x0128_btst_b_di_071234fc();
-void x0130_btst_b_ix_071234fc();
+template <u32 Types> void x0130_btst_b_ix_071234fc();
 void x0138_btst_b_aw_071234fc();
 void x0139_btst_b_al_071234fc();
 void x013a_btst_b_pcdi_071234fc();
-void x013b_btst_b_pcix_071234fc();
+template <u32 Types> void x013b_btst_b_pcix_071234fc();
 void x013c_btst_b_i_071234fc();
 void x0800_btst_l_071234fc();
 void x0810_btst_b_ai_071234fc();
@@ -468,86 +468,86 @@ void x081f_btst_b_pi7_071234fc();
 void x0820_btst_b_pd_071234fc();
 void x0827_btst_b_pd7_071234fc();
 void x0828_btst_b_di_071234fc();
-void x0830_btst_b_ix_071234fc();
+template <u32 Types> void x0830_btst_b_ix_071234fc();
 void x0838_btst_b_aw_071234fc();
 void x0839_btst_b_al_071234fc();
 void x083a_btst_b_pcdi_071234fc();
-void x083b_btst_b_pcix_071234fc();
+template <u32 Types> void x083b_btst_b_pcix_071234fc();
 void x06d0_callm_l_ai_2f();
 void x06e8_callm_l_di_2f();
-void x06f0_callm_l_ix_2f();
+template <u32 Types> void x06f0_callm_l_ix_2f();
 void x06f8_callm_l_aw_2f();
 void x06f9_callm_l_al_2f();
 void x06fa_callm_l_pcdi_2f();
-void x06fb_callm_l_pcix_2f();
+template <u32 Types> void x06fb_callm_l_pcix_2f();
 void x0ad0_cas_b_ai_234fc();
 void x0ad8_cas_b_pi_234fc();
 void x0adf_cas_b_pi7_234fc();
 void x0ae0_cas_b_pd_234fc();
 void x0ae7_cas_b_pd7_234fc();
 void x0ae8_cas_b_di_234fc();
-void x0af0_cas_b_ix_234fc();
+template <u32 Types> void x0af0_cas_b_ix_234fc();
 void x0af8_cas_b_aw_234fc();
 void x0af9_cas_b_al_234fc();
-void x0cd0_cas_w_ai_234fc();
-void x0cd8_cas_w_pi_234fc();
-void x0ce0_cas_w_pd_234fc();
-void x0ce8_cas_w_di_234fc();
-void x0cf0_cas_w_ix_234fc();
-void x0cf8_cas_w_aw_234fc();
-void x0cf9_cas_w_al_234fc();
-void x0ed0_cas_l_ai_234fc();
-void x0ed8_cas_l_pi_234fc();
-void x0ee0_cas_l_pd_234fc();
-void x0ee8_cas_l_di_234fc();
-void x0ef0_cas_l_ix_234fc();
-void x0ef8_cas_l_aw_234fc();
-void x0ef9_cas_l_al_234fc();
-void x0cfc_cas2_w_234fc();
-void x0efc_cas2_l_234fc();
+template <u32 Types> void x0cd0_cas_w_ai_234fc();
+template <u32 Types> void x0cd8_cas_w_pi_234fc();
+template <u32 Types> void x0ce0_cas_w_pd_234fc();
+template <u32 Types> void x0ce8_cas_w_di_234fc();
+template <u32 Types> void x0cf0_cas_w_ix_234fc();
+template <u32 Types> void x0cf8_cas_w_aw_234fc();
+template <u32 Types> void x0cf9_cas_w_al_234fc();
+template <u32 Types> void x0ed0_cas_l_ai_234fc();
+template <u32 Types> void x0ed8_cas_l_pi_234fc();
+template <u32 Types> void x0ee0_cas_l_pd_234fc();
+template <u32 Types> void x0ee8_cas_l_di_234fc();
+template <u32 Types> void x0ef0_cas_l_ix_234fc();
+template <u32 Types> void x0ef8_cas_l_aw_234fc();
+template <u32 Types> void x0ef9_cas_l_al_234fc();
+template <u32 Types> void x0cfc_cas2_w_234fc();
+template <u32 Types> void x0efc_cas2_l_234fc();
 void x4180_chk_w_071234fc();
-void x4190_chk_w_ai_071234fc();
-void x4198_chk_w_pi_071234fc();
-void x41a0_chk_w_pd_071234fc();
-void x41a8_chk_w_di_071234fc();
-void x41b0_chk_w_ix_071234fc();
-void x41b8_chk_w_aw_071234fc();
-void x41b9_chk_w_al_071234fc();
+template <u32 Types> void x4190_chk_w_ai_071234fc();
+template <u32 Types> void x4198_chk_w_pi_071234fc();
+template <u32 Types> void x41a0_chk_w_pd_071234fc();
+template <u32 Types> void x41a8_chk_w_di_071234fc();
+template <u32 Types> void x41b0_chk_w_ix_071234fc();
+template <u32 Types> void x41b8_chk_w_aw_071234fc();
+template <u32 Types> void x41b9_chk_w_al_071234fc();
 void x41ba_chk_w_pcdi_071234fc();
-void x41bb_chk_w_pcix_071234fc();
+template <u32 Types> void x41bb_chk_w_pcix_071234fc();
 void x41bc_chk_w_i_071234fc();
 void x4100_chk_l_234fc();
-void x4110_chk_l_ai_234fc();
-void x4118_chk_l_pi_234fc();
-void x4120_chk_l_pd_234fc();
-void x4128_chk_l_di_234fc();
-void x4130_chk_l_ix_234fc();
-void x4138_chk_l_aw_234fc();
-void x4139_chk_l_al_234fc();
+template <u32 Types> void x4110_chk_l_ai_234fc();
+template <u32 Types> void x4118_chk_l_pi_234fc();
+template <u32 Types> void x4120_chk_l_pd_234fc();
+template <u32 Types> void x4128_chk_l_di_234fc();
+template <u32 Types> void x4130_chk_l_ix_234fc();
+template <u32 Types> void x4138_chk_l_aw_234fc();
+template <u32 Types> void x4139_chk_l_al_234fc();
 void x413a_chk_l_pcdi_234fc();
-void x413b_chk_l_pcix_234fc();
+template <u32 Types> void x413b_chk_l_pcix_234fc();
 void x413c_chk_l_i_234fc();
 void x00fa_chk2cmp2_b_234fc();
-void x00fb_chk2cmp2_b_234fc();
+template <u32 Types> void x00fb_chk2cmp2_b_234fc();
 void x00d0_chk2cmp2_b_ai_234fc();
 void x00e8_chk2cmp2_b_di_234fc();
-void x00f0_chk2cmp2_b_ix_234fc();
+template <u32 Types> void x00f0_chk2cmp2_b_ix_234fc();
 void x00f8_chk2cmp2_b_aw_234fc();
 void x00f9_chk2cmp2_b_al_234fc();
 void x02fa_chk2cmp2_w_234fc();
-void x02fb_chk2cmp2_w_234fc();
-void x02d0_chk2cmp2_w_ai_234fc();
-void x02e8_chk2cmp2_w_di_234fc();
-void x02f0_chk2cmp2_w_ix_234fc();
-void x02f8_chk2cmp2_w_aw_234fc();
-void x02f9_chk2cmp2_w_al_234fc();
+template <u32 Types> void x02fb_chk2cmp2_w_234fc();
+template <u32 Types> void x02d0_chk2cmp2_w_ai_234fc();
+template <u32 Types> void x02e8_chk2cmp2_w_di_234fc();
+template <u32 Types> void x02f0_chk2cmp2_w_ix_234fc();
+template <u32 Types> void x02f8_chk2cmp2_w_aw_234fc();
+template <u32 Types> void x02f9_chk2cmp2_w_al_234fc();
 void x04fa_chk2cmp2_l_234fc();
-void x04fb_chk2cmp2_l_234fc();
-void x04d0_chk2cmp2_l_ai_234fc();
-void x04e8_chk2cmp2_l_di_234fc();
-void x04f0_chk2cmp2_l_ix_234fc();
-void x04f8_chk2cmp2_l_aw_234fc();
-void x04f9_chk2cmp2_l_al_234fc();
+template <u32 Types> void x04fb_chk2cmp2_l_234fc();
+template <u32 Types> void x04d0_chk2cmp2_l_ai_234fc();
+template <u32 Types> void x04e8_chk2cmp2_l_di_234fc();
+template <u32 Types> void x04f0_chk2cmp2_l_ix_234fc();
+template <u32 Types> void x04f8_chk2cmp2_l_aw_234fc();
+template <u32 Types> void x04f9_chk2cmp2_l_al_234fc();
 void x4200_clr_b_071234fc();
 void x4210_clr_b_ai_0();
 void x4218_clr_b_pi_0();
@@ -555,7 +555,7 @@ void x421f_clr_b_pi7_0();
 void x4220_clr_b_pd_0();
 void x4227_clr_b_pd7_0();
 void x4228_clr_b_di_0();
-void x4230_clr_b_ix_0();
+template <u32 Types> void x4230_clr_b_ix_0();
 void x4238_clr_b_aw_0();
 void x4239_clr_b_al_0();
 void x4210_clr_b_ai_71234fc();
@@ -564,39 +564,39 @@ void x421f_clr_b_pi7_71234fc();
 void x4220_clr_b_pd_71234fc();
 void x4227_clr_b_pd7_71234fc();
 void x4228_clr_b_di_71234fc();
-void x4230_clr_b_ix_71234fc();
+template <u32 Types> void x4230_clr_b_ix_71234fc();
 void x4238_clr_b_aw_71234fc();
 void x4239_clr_b_al_71234fc();
 void x4240_clr_w_071234fc();
-void x4250_clr_w_ai_0();
-void x4258_clr_w_pi_0();
-void x4260_clr_w_pd_0();
-void x4268_clr_w_di_0();
-void x4270_clr_w_ix_0();
-void x4278_clr_w_aw_0();
-void x4279_clr_w_al_0();
-void x4250_clr_w_ai_71234fc();
-void x4258_clr_w_pi_71234fc();
-void x4260_clr_w_pd_71234fc();
-void x4268_clr_w_di_71234fc();
-void x4270_clr_w_ix_71234fc();
-void x4278_clr_w_aw_71234fc();
-void x4279_clr_w_al_71234fc();
+template <u32 Types> void x4250_clr_w_ai_0();
+template <u32 Types> void x4258_clr_w_pi_0();
+template <u32 Types> void x4260_clr_w_pd_0();
+template <u32 Types> void x4268_clr_w_di_0();
+template <u32 Types> void x4270_clr_w_ix_0();
+template <u32 Types> void x4278_clr_w_aw_0();
+template <u32 Types> void x4279_clr_w_al_0();
+template <u32 Types> void x4250_clr_w_ai_71234fc();
+template <u32 Types> void x4258_clr_w_pi_71234fc();
+template <u32 Types> void x4260_clr_w_pd_71234fc();
+template <u32 Types> void x4268_clr_w_di_71234fc();
+template <u32 Types> void x4270_clr_w_ix_71234fc();
+template <u32 Types> void x4278_clr_w_aw_71234fc();
+template <u32 Types> void x4279_clr_w_al_71234fc();
 void x4280_clr_l_071234fc();
-void x4290_clr_l_ai_0();
-void x4298_clr_l_pi_0();
-void x42a0_clr_l_pd_0();
-void x42a8_clr_l_di_0();
-void x42b0_clr_l_ix_0();
-void x42b8_clr_l_aw_0();
-void x42b9_clr_l_al_0();
-void x4290_clr_l_ai_71234fc();
-void x4298_clr_l_pi_71234fc();
-void x42a0_clr_l_pd_71234fc();
-void x42a8_clr_l_di_71234fc();
-void x42b0_clr_l_ix_71234fc();
-void x42b8_clr_l_aw_71234fc();
-void x42b9_clr_l_al_71234fc();
+template <u32 Types> void x4290_clr_l_ai_0();
+template <u32 Types> void x4298_clr_l_pi_0();
+template <u32 Types> void x42a0_clr_l_pd_0();
+template <u32 Types> void x42a8_clr_l_di_0();
+template <u32 Types> void x42b0_clr_l_ix_0();
+template <u32 Types> void x42b8_clr_l_aw_0();
+template <u32 Types> void x42b9_clr_l_al_0();
+template <u32 Types> void x4290_clr_l_ai_71234fc();
+template <u32 Types> void x4298_clr_l_pi_71234fc();
+template <u32 Types> void x42a0_clr_l_pd_71234fc();
+template <u32 Types> void x42a8_clr_l_di_71234fc();
+template <u32 Types> void x42b0_clr_l_ix_71234fc();
+template <u32 Types> void x42b8_clr_l_aw_71234fc();
+template <u32 Types> void x42b9_clr_l_al_71234fc();
 void xb000_cmp_b_071234fc();
 void xb010_cmp_b_ai_071234fc();
 void xb018_cmp_b_pi_071234fc();
@@ -604,59 +604,59 @@ void xb01f_cmp_b_pi7_071234fc();
 void xb020_cmp_b_pd_071234fc();
 void xb027_cmp_b_pd7_071234fc();
 void xb028_cmp_b_di_071234fc();
-void xb030_cmp_b_ix_071234fc();
+template <u32 Types> void xb030_cmp_b_ix_071234fc();
 void xb038_cmp_b_aw_071234fc();
 void xb039_cmp_b_al_071234fc();
 void xb03a_cmp_b_pcdi_071234fc();
-void xb03b_cmp_b_pcix_071234fc();
+template <u32 Types> void xb03b_cmp_b_pcix_071234fc();
 void xb03c_cmp_b_i_071234fc();
 void xb040_cmp_w_071234fc();
 void xb048_cmp_w_071234fc();
-void xb050_cmp_w_ai_071234fc();
-void xb058_cmp_w_pi_071234fc();
-void xb060_cmp_w_pd_071234fc();
-void xb068_cmp_w_di_071234fc();
-void xb070_cmp_w_ix_071234fc();
-void xb078_cmp_w_aw_071234fc();
-void xb079_cmp_w_al_071234fc();
+template <u32 Types> void xb050_cmp_w_ai_071234fc();
+template <u32 Types> void xb058_cmp_w_pi_071234fc();
+template <u32 Types> void xb060_cmp_w_pd_071234fc();
+template <u32 Types> void xb068_cmp_w_di_071234fc();
+template <u32 Types> void xb070_cmp_w_ix_071234fc();
+template <u32 Types> void xb078_cmp_w_aw_071234fc();
+template <u32 Types> void xb079_cmp_w_al_071234fc();
 void xb07a_cmp_w_pcdi_071234fc();
-void xb07b_cmp_w_pcix_071234fc();
+template <u32 Types> void xb07b_cmp_w_pcix_071234fc();
 void xb07c_cmp_w_i_071234fc();
 void xb080_cmp_l_071234fc();
 void xb088_cmp_l_071234fc();
-void xb090_cmp_l_ai_071234fc();
-void xb098_cmp_l_pi_071234fc();
-void xb0a0_cmp_l_pd_071234fc();
-void xb0a8_cmp_l_di_071234fc();
-void xb0b0_cmp_l_ix_071234fc();
-void xb0b8_cmp_l_aw_071234fc();
-void xb0b9_cmp_l_al_071234fc();
+template <u32 Types> void xb090_cmp_l_ai_071234fc();
+template <u32 Types> void xb098_cmp_l_pi_071234fc();
+template <u32 Types> void xb0a0_cmp_l_pd_071234fc();
+template <u32 Types> void xb0a8_cmp_l_di_071234fc();
+template <u32 Types> void xb0b0_cmp_l_ix_071234fc();
+template <u32 Types> void xb0b8_cmp_l_aw_071234fc();
+template <u32 Types> void xb0b9_cmp_l_al_071234fc();
 void xb0ba_cmp_l_pcdi_071234fc();
-void xb0bb_cmp_l_pcix_071234fc();
+template <u32 Types> void xb0bb_cmp_l_pcix_071234fc();
 void xb0bc_cmp_l_i_071234fc();
 void xb0c0_cmpa_w_071234fc();
 void xb0c8_cmpa_w_071234fc();
-void xb0d0_cmpa_w_ai_071234fc();
-void xb0d8_cmpa_w_pi_071234fc();
-void xb0e0_cmpa_w_pd_071234fc();
-void xb0e8_cmpa_w_di_071234fc();
-void xb0f0_cmpa_w_ix_071234fc();
-void xb0f8_cmpa_w_aw_071234fc();
-void xb0f9_cmpa_w_al_071234fc();
+template <u32 Types> void xb0d0_cmpa_w_ai_071234fc();
+template <u32 Types> void xb0d8_cmpa_w_pi_071234fc();
+template <u32 Types> void xb0e0_cmpa_w_pd_071234fc();
+template <u32 Types> void xb0e8_cmpa_w_di_071234fc();
+template <u32 Types> void xb0f0_cmpa_w_ix_071234fc();
+template <u32 Types> void xb0f8_cmpa_w_aw_071234fc();
+template <u32 Types> void xb0f9_cmpa_w_al_071234fc();
 void xb0fa_cmpa_w_pcdi_071234fc();
-void xb0fb_cmpa_w_pcix_071234fc();
+template <u32 Types> void xb0fb_cmpa_w_pcix_071234fc();
 void xb0fc_cmpa_w_i_071234fc();
 void xb1c0_cmpa_l_071234fc();
 void xb1c8_cmpa_l_071234fc();
-void xb1d0_cmpa_l_ai_071234fc();
-void xb1d8_cmpa_l_pi_071234fc();
-void xb1e0_cmpa_l_pd_071234fc();
-void xb1e8_cmpa_l_di_071234fc();
-void xb1f0_cmpa_l_ix_071234fc();
-void xb1f8_cmpa_l_aw_071234fc();
-void xb1f9_cmpa_l_al_071234fc();
+template <u32 Types> void xb1d0_cmpa_l_ai_071234fc();
+template <u32 Types> void xb1d8_cmpa_l_pi_071234fc();
+template <u32 Types> void xb1e0_cmpa_l_pd_071234fc();
+template <u32 Types> void xb1e8_cmpa_l_di_071234fc();
+template <u32 Types> void xb1f0_cmpa_l_ix_071234fc();
+template <u32 Types> void xb1f8_cmpa_l_aw_071234fc();
+template <u32 Types> void xb1f9_cmpa_l_al_071234fc();
 void xb1fa_cmpa_l_pcdi_071234fc();
-void xb1fb_cmpa_l_pcix_071234fc();
+template <u32 Types> void xb1fb_cmpa_l_pcix_071234fc();
 void xb1fc_cmpa_l_i_071234fc();
 void x0c00_cmpi_b_071234fc();
 void x0c10_cmpi_b_ai_071234fc();
@@ -665,37 +665,37 @@ void x0c1f_cmpi_b_pi7_071234fc();
 void x0c20_cmpi_b_pd_071234fc();
 void x0c27_cmpi_b_pd7_071234fc();
 void x0c28_cmpi_b_di_071234fc();
-void x0c30_cmpi_b_ix_071234fc();
+template <u32 Types> void x0c30_cmpi_b_ix_071234fc();
 void x0c38_cmpi_b_aw_071234fc();
 void x0c39_cmpi_b_al_071234fc();
 void x0c3a_cmpi_b_234fc();
-void x0c3b_cmpi_b_234fc();
+template <u32 Types> void x0c3b_cmpi_b_234fc();
 void x0c40_cmpi_w_071234fc();
-void x0c50_cmpi_w_ai_071234fc();
-void x0c58_cmpi_w_pi_071234fc();
-void x0c60_cmpi_w_pd_071234fc();
-void x0c68_cmpi_w_di_071234fc();
-void x0c70_cmpi_w_ix_071234fc();
-void x0c78_cmpi_w_aw_071234fc();
-void x0c79_cmpi_w_al_071234fc();
+template <u32 Types> void x0c50_cmpi_w_ai_071234fc();
+template <u32 Types> void x0c58_cmpi_w_pi_071234fc();
+template <u32 Types> void x0c60_cmpi_w_pd_071234fc();
+template <u32 Types> void x0c68_cmpi_w_di_071234fc();
+template <u32 Types> void x0c70_cmpi_w_ix_071234fc();
+template <u32 Types> void x0c78_cmpi_w_aw_071234fc();
+template <u32 Types> void x0c79_cmpi_w_al_071234fc();
 void x0c7a_cmpi_w_234fc();
-void x0c7b_cmpi_w_234fc();
+template <u32 Types> void x0c7b_cmpi_w_234fc();
 void x0c80_cmpi_l_071234fc();
-void x0c90_cmpi_l_ai_071234fc();
-void x0c98_cmpi_l_pi_071234fc();
-void x0ca0_cmpi_l_pd_071234fc();
-void x0ca8_cmpi_l_di_071234fc();
-void x0cb0_cmpi_l_ix_071234fc();
-void x0cb8_cmpi_l_aw_071234fc();
-void x0cb9_cmpi_l_al_071234fc();
+template <u32 Types> void x0c90_cmpi_l_ai_071234fc();
+template <u32 Types> void x0c98_cmpi_l_pi_071234fc();
+template <u32 Types> void x0ca0_cmpi_l_pd_071234fc();
+template <u32 Types> void x0ca8_cmpi_l_di_071234fc();
+template <u32 Types> void x0cb0_cmpi_l_ix_071234fc();
+template <u32 Types> void x0cb8_cmpi_l_aw_071234fc();
+template <u32 Types> void x0cb9_cmpi_l_al_071234fc();
 void x0cba_cmpi_l_234fc();
-void x0cbb_cmpi_l_234fc();
+template <u32 Types> void x0cbb_cmpi_l_234fc();
 void xbf08_cmpm_b_071234fc();
 void xb10f_cmpm_b_071234fc();
 void xbf0f_cmpm_b_071234fc();
 void xb108_cmpm_b_071234fc();
-void xb148_cmpm_w_071234fc();
-void xb188_cmpm_l_071234fc();
+template <u32 Types> void xb148_cmpm_w_071234fc();
+template <u32 Types> void xb188_cmpm_l_071234fc();
 void xf080_cpbcc_l_23();
 void xf048_cpdbcc_l_23();
 void xf000_cpgen_l_23();
@@ -719,37 +719,37 @@ void x5dc8_dblt_w_071234fc();
 void x5ec8_dbgt_w_071234fc();
 void x5fc8_dble_w_071234fc();
 void x81c0_divs_w_071234fc();
-void x81d0_divs_w_ai_071234fc();
-void x81d8_divs_w_pi_071234fc();
-void x81e0_divs_w_pd_071234fc();
-void x81e8_divs_w_di_071234fc();
-void x81f0_divs_w_ix_071234fc();
-void x81f8_divs_w_aw_071234fc();
-void x81f9_divs_w_al_071234fc();
+template <u32 Types> void x81d0_divs_w_ai_071234fc();
+template <u32 Types> void x81d8_divs_w_pi_071234fc();
+template <u32 Types> void x81e0_divs_w_pd_071234fc();
+template <u32 Types> void x81e8_divs_w_di_071234fc();
+template <u32 Types> void x81f0_divs_w_ix_071234fc();
+template <u32 Types> void x81f8_divs_w_aw_071234fc();
+template <u32 Types> void x81f9_divs_w_al_071234fc();
 void x81fa_divs_w_pcdi_071234fc();
-void x81fb_divs_w_pcix_071234fc();
+template <u32 Types> void x81fb_divs_w_pcix_071234fc();
 void x81fc_divs_w_i_071234fc();
 void x80c0_divu_w_071234fc();
-void x80d0_divu_w_ai_071234fc();
-void x80d8_divu_w_pi_071234fc();
-void x80e0_divu_w_pd_071234fc();
-void x80e8_divu_w_di_071234fc();
-void x80f0_divu_w_ix_071234fc();
-void x80f8_divu_w_aw_071234fc();
-void x80f9_divu_w_al_071234fc();
+template <u32 Types> void x80d0_divu_w_ai_071234fc();
+template <u32 Types> void x80d8_divu_w_pi_071234fc();
+template <u32 Types> void x80e0_divu_w_pd_071234fc();
+template <u32 Types> void x80e8_divu_w_di_071234fc();
+template <u32 Types> void x80f0_divu_w_ix_071234fc();
+template <u32 Types> void x80f8_divu_w_aw_071234fc();
+template <u32 Types> void x80f9_divu_w_al_071234fc();
 void x80fa_divu_w_pcdi_071234fc();
-void x80fb_divu_w_pcix_071234fc();
+template <u32 Types> void x80fb_divu_w_pcix_071234fc();
 void x80fc_divu_w_i_071234fc();
 void x4c40_divl_l_234fc();
-void x4c50_divl_l_ai_234fc();
-void x4c58_divl_l_pi_234fc();
-void x4c60_divl_l_pd_234fc();
-void x4c68_divl_l_di_234fc();
-void x4c70_divl_l_ix_234fc();
-void x4c78_divl_l_aw_234fc();
-void x4c79_divl_l_al_234fc();
+template <u32 Types> void x4c50_divl_l_ai_234fc();
+template <u32 Types> void x4c58_divl_l_pi_234fc();
+template <u32 Types> void x4c60_divl_l_pd_234fc();
+template <u32 Types> void x4c68_divl_l_di_234fc();
+template <u32 Types> void x4c70_divl_l_ix_234fc();
+template <u32 Types> void x4c78_divl_l_aw_234fc();
+template <u32 Types> void x4c79_divl_l_al_234fc();
 void x4c7a_divl_l_pcdi_234fc();
-void x4c7b_divl_l_pcix_234fc();
+template <u32 Types> void x4c7b_divl_l_pcix_234fc();
 void x4c7c_divl_l_i_234fc();
 void xb100_eor_b_071234fc();
 void xb110_eor_b_ai_071234fc();
@@ -758,25 +758,25 @@ void xb11f_eor_b_pi7_071234fc();
 void xb120_eor_b_pd_071234fc();
 void xb127_eor_b_pd7_071234fc();
 void xb128_eor_b_di_071234fc();
-void xb130_eor_b_ix_071234fc();
+template <u32 Types> void xb130_eor_b_ix_071234fc();
 void xb138_eor_b_aw_071234fc();
 void xb139_eor_b_al_071234fc();
 void xb140_eor_w_071234fc();
-void xb150_eor_w_ai_071234fc();
-void xb158_eor_w_pi_071234fc();
-void xb160_eor_w_pd_071234fc();
-void xb168_eor_w_di_071234fc();
-void xb170_eor_w_ix_071234fc();
-void xb178_eor_w_aw_071234fc();
-void xb179_eor_w_al_071234fc();
+template <u32 Types> void xb150_eor_w_ai_071234fc();
+template <u32 Types> void xb158_eor_w_pi_071234fc();
+template <u32 Types> void xb160_eor_w_pd_071234fc();
+template <u32 Types> void xb168_eor_w_di_071234fc();
+template <u32 Types> void xb170_eor_w_ix_071234fc();
+template <u32 Types> void xb178_eor_w_aw_071234fc();
+template <u32 Types> void xb179_eor_w_al_071234fc();
 void xb180_eor_l_071234fc();
-void xb190_eor_l_ai_071234fc();
-void xb198_eor_l_pi_071234fc();
-void xb1a0_eor_l_pd_071234fc();
-void xb1a8_eor_l_di_071234fc();
-void xb1b0_eor_l_ix_071234fc();
-void xb1b8_eor_l_aw_071234fc();
-void xb1b9_eor_l_al_071234fc();
+template <u32 Types> void xb190_eor_l_ai_071234fc();
+template <u32 Types> void xb198_eor_l_pi_071234fc();
+template <u32 Types> void xb1a0_eor_l_pd_071234fc();
+template <u32 Types> void xb1a8_eor_l_di_071234fc();
+template <u32 Types> void xb1b0_eor_l_ix_071234fc();
+template <u32 Types> void xb1b8_eor_l_aw_071234fc();
+template <u32 Types> void xb1b9_eor_l_al_071234fc();
 void x0a00_eori_b_071234fc();
 void x0a10_eori_b_ai_071234fc();
 void x0a18_eori_b_pi_071234fc();
@@ -784,25 +784,25 @@ void x0a1f_eori_b_pi7_071234fc();
 void x0a20_eori_b_pd_071234fc();
 void x0a27_eori_b_pd7_071234fc();
 void x0a28_eori_b_di_071234fc();
-void x0a30_eori_b_ix_071234fc();
+template <u32 Types> void x0a30_eori_b_ix_071234fc();
 void x0a38_eori_b_aw_071234fc();
 void x0a39_eori_b_al_071234fc();
 void x0a40_eori_w_071234fc();
-void x0a50_eori_w_ai_071234fc();
-void x0a58_eori_w_pi_071234fc();
-void x0a60_eori_w_pd_071234fc();
-void x0a68_eori_w_di_071234fc();
-void x0a70_eori_w_ix_071234fc();
-void x0a78_eori_w_aw_071234fc();
-void x0a79_eori_w_al_071234fc();
+template <u32 Types> void x0a50_eori_w_ai_071234fc();
+template <u32 Types> void x0a58_eori_w_pi_071234fc();
+template <u32 Types> void x0a60_eori_w_pd_071234fc();
+template <u32 Types> void x0a68_eori_w_di_071234fc();
+template <u32 Types> void x0a70_eori_w_ix_071234fc();
+template <u32 Types> void x0a78_eori_w_aw_071234fc();
+template <u32 Types> void x0a79_eori_w_al_071234fc();
 void x0a80_eori_l_071234fc();
-void x0a90_eori_l_ai_071234fc();
-void x0a98_eori_l_pi_071234fc();
-void x0aa0_eori_l_pd_071234fc();
-void x0aa8_eori_l_di_071234fc();
-void x0ab0_eori_l_ix_071234fc();
-void x0ab8_eori_l_aw_071234fc();
-void x0ab9_eori_l_al_071234fc();
+template <u32 Types> void x0a90_eori_l_ai_071234fc();
+template <u32 Types> void x0a98_eori_l_pi_071234fc();
+template <u32 Types> void x0aa0_eori_l_pd_071234fc();
+template <u32 Types> void x0aa8_eori_l_di_071234fc();
+template <u32 Types> void x0ab0_eori_l_ix_071234fc();
+template <u32 Types> void x0ab8_eori_l_aw_071234fc();
+template <u32 Types> void x0ab9_eori_l_al_071234fc();
 void x0a3c_eori_w_071234fc();
 void x0a7c_eori_w_071234fc();
 void xc140_exg_l_071234fc();
@@ -814,55 +814,55 @@ void x49c0_extb_l_234fc();
 void x4afc_illegal_071234fc();
 void x4ed0_jmp_l_ai_071234fc();
 void x4ee8_jmp_l_di_071234fc();
-void x4ef0_jmp_l_ix_071234fc();
+template <u32 Types> void x4ef0_jmp_l_ix_071234fc();
 void x4ef8_jmp_l_aw_071234fc();
 void x4ef9_jmp_l_al_071234fc();
 void x4efa_jmp_l_pcdi_071234fc();
-void x4efb_jmp_l_pcix_071234fc();
-void x4e90_jsr_l_ai_071234fc();
-void x4ea8_jsr_l_di_071234fc();
-void x4eb0_jsr_l_ix_071234fc();
-void x4eb8_jsr_l_aw_071234fc();
-void x4eb9_jsr_l_al_071234fc();
-void x4eba_jsr_l_pcdi_071234fc();
-void x4ebb_jsr_l_pcix_071234fc();
+template <u32 Types> void x4efb_jmp_l_pcix_071234fc();
+template <u32 Types> void x4e90_jsr_l_ai_071234fc();
+template <u32 Types> void x4ea8_jsr_l_di_071234fc();
+template <u32 Types> void x4eb0_jsr_l_ix_071234fc();
+template <u32 Types> void x4eb8_jsr_l_aw_071234fc();
+template <u32 Types> void x4eb9_jsr_l_al_071234fc();
+template <u32 Types> void x4eba_jsr_l_pcdi_071234fc();
+template <u32 Types> void x4ebb_jsr_l_pcix_071234fc();
 void x41d0_lea_l_ai_071234fc();
 void x41e8_lea_l_di_071234fc();
-void x41f0_lea_l_ix_071234fc();
+template <u32 Types> void x41f0_lea_l_ix_071234fc();
 void x41f8_lea_l_aw_071234fc();
 void x41f9_lea_l_al_071234fc();
 void x41fa_lea_l_pcdi_071234fc();
-void x41fb_lea_l_pcix_071234fc();
-void x4e57_link_w_071234fc();
-void x4e50_link_w_071234fc();
-void x480f_link_l_234fc();
-void x4808_link_l_234fc();
+template <u32 Types> void x41fb_lea_l_pcix_071234fc();
+template <u32 Types> void x4e57_link_w_071234fc();
+template <u32 Types> void x4e50_link_w_071234fc();
+template <u32 Types> void x480f_link_l_234fc();
+template <u32 Types> void x4808_link_l_234fc();
 void xe008_lsr_b_071234fc();
 void xe048_lsr_w_071234fc();
 void xe088_lsr_l_071234fc();
 void xe028_lsr_b_071234fc();
 void xe068_lsr_w_071234fc();
 void xe0a8_lsr_l_071234fc();
-void xe2d0_lsr_w_ai_071234fc();
-void xe2d8_lsr_w_pi_071234fc();
-void xe2e0_lsr_w_pd_071234fc();
-void xe2e8_lsr_w_di_071234fc();
-void xe2f0_lsr_w_ix_071234fc();
-void xe2f8_lsr_w_aw_071234fc();
-void xe2f9_lsr_w_al_071234fc();
+template <u32 Types> void xe2d0_lsr_w_ai_071234fc();
+template <u32 Types> void xe2d8_lsr_w_pi_071234fc();
+template <u32 Types> void xe2e0_lsr_w_pd_071234fc();
+template <u32 Types> void xe2e8_lsr_w_di_071234fc();
+template <u32 Types> void xe2f0_lsr_w_ix_071234fc();
+template <u32 Types> void xe2f8_lsr_w_aw_071234fc();
+template <u32 Types> void xe2f9_lsr_w_al_071234fc();
 void xe108_lsl_b_071234fc();
 void xe148_lsl_w_071234fc();
 void xe188_lsl_l_071234fc();
 void xe128_lsl_b_071234fc();
 void xe168_lsl_w_071234fc();
 void xe1a8_lsl_l_071234fc();
-void xe3d0_lsl_w_ai_071234fc();
-void xe3d8_lsl_w_pi_071234fc();
-void xe3e0_lsl_w_pd_071234fc();
-void xe3e8_lsl_w_di_071234fc();
-void xe3f0_lsl_w_ix_071234fc();
-void xe3f8_lsl_w_aw_071234fc();
-void xe3f9_lsl_w_al_071234fc();
+template <u32 Types> void xe3d0_lsl_w_ai_071234fc();
+template <u32 Types> void xe3d8_lsl_w_pi_071234fc();
+template <u32 Types> void xe3e0_lsl_w_pd_071234fc();
+template <u32 Types> void xe3e8_lsl_w_di_071234fc();
+template <u32 Types> void xe3f0_lsl_w_ix_071234fc();
+template <u32 Types> void xe3f8_lsl_w_aw_071234fc();
+template <u32 Types> void xe3f9_lsl_w_al_071234fc();
 void x1000_move_b_071234fc();
 void x1010_move_b_ai_071234fc();
 void x1018_move_b_pi_071234fc();
@@ -870,11 +870,11 @@ void x101f_move_b_pi7_071234fc();
 void x1020_move_b_pd_071234fc();
 void x1027_move_b_pd7_071234fc();
 void x1028_move_b_di_071234fc();
-void x1030_move_b_ix_071234fc();
+template <u32 Types> void x1030_move_b_ix_071234fc();
 void x1038_move_b_aw_071234fc();
 void x1039_move_b_al_071234fc();
 void x103a_move_b_pcdi_071234fc();
-void x103b_move_b_pcix_071234fc();
+template <u32 Types> void x103b_move_b_pcix_071234fc();
 void x103c_move_b_i_071234fc();
 void x1080_move_b_071234fc();
 void x1090_move_b_ai_071234fc();
@@ -883,11 +883,11 @@ void x109f_move_b_pi7_071234fc();
 void x10a0_move_b_pd_071234fc();
 void x10a7_move_b_pd7_071234fc();
 void x10a8_move_b_di_071234fc();
-void x10b0_move_b_ix_071234fc();
+template <u32 Types> void x10b0_move_b_ix_071234fc();
 void x10b8_move_b_aw_071234fc();
 void x10b9_move_b_al_071234fc();
 void x10ba_move_b_pcdi_071234fc();
-void x10bb_move_b_pcix_071234fc();
+template <u32 Types> void x10bb_move_b_pcix_071234fc();
 void x10bc_move_b_i_071234fc();
 void x1ec0_move_b_071234fc();
 void x10c0_move_b_071234fc();
@@ -897,11 +897,11 @@ void x1edf_move_b_pi7_071234fc();
 void x1ee0_move_b_pd_071234fc();
 void x1ee7_move_b_pd7_071234fc();
 void x1ee8_move_b_di_071234fc();
-void x1ef0_move_b_ix_071234fc();
+template <u32 Types> void x1ef0_move_b_ix_071234fc();
 void x1ef8_move_b_aw_071234fc();
 void x1ef9_move_b_al_071234fc();
 void x1efa_move_b_pcdi_071234fc();
-void x1efb_move_b_pcix_071234fc();
+template <u32 Types> void x1efb_move_b_pcix_071234fc();
 void x1efc_move_b_i_071234fc();
 void x10d0_move_b_ai_071234fc();
 void x10d8_move_b_pi_071234fc();
@@ -909,11 +909,11 @@ void x10df_move_b_pi7_071234fc();
 void x10e0_move_b_pd_071234fc();
 void x10e7_move_b_pd7_071234fc();
 void x10e8_move_b_di_071234fc();
-void x10f0_move_b_ix_071234fc();
+template <u32 Types> void x10f0_move_b_ix_071234fc();
 void x10f8_move_b_aw_071234fc();
 void x10f9_move_b_al_071234fc();
 void x10fa_move_b_pcdi_071234fc();
-void x10fb_move_b_pcix_071234fc();
+template <u32 Types> void x10fb_move_b_pcix_071234fc();
 void x10fc_move_b_i_071234fc();
 void x1f00_move_b_071234fc();
 void x1100_move_b_071234fc();
@@ -923,11 +923,11 @@ void x1f1f_move_b_pi7_071234fc();
 void x1f20_move_b_pd_071234fc();
 void x1f27_move_b_pd7_071234fc();
 void x1f28_move_b_di_071234fc();
-void x1f30_move_b_ix_071234fc();
+template <u32 Types> void x1f30_move_b_ix_071234fc();
 void x1f38_move_b_aw_071234fc();
 void x1f39_move_b_al_071234fc();
 void x1f3a_move_b_pcdi_071234fc();
-void x1f3b_move_b_pcix_071234fc();
+template <u32 Types> void x1f3b_move_b_pcix_071234fc();
 void x1f3c_move_b_i_071234fc();
 void x1110_move_b_ai_071234fc();
 void x1118_move_b_pi_071234fc();
@@ -935,11 +935,11 @@ void x111f_move_b_pi7_071234fc();
 void x1120_move_b_pd_071234fc();
 void x1127_move_b_pd7_071234fc();
 void x1128_move_b_di_071234fc();
-void x1130_move_b_ix_071234fc();
+template <u32 Types> void x1130_move_b_ix_071234fc();
 void x1138_move_b_aw_071234fc();
 void x1139_move_b_al_071234fc();
 void x113a_move_b_pcdi_071234fc();
-void x113b_move_b_pcix_071234fc();
+template <u32 Types> void x113b_move_b_pcix_071234fc();
 void x113c_move_b_i_071234fc();
 void x1140_move_b_071234fc();
 void x1150_move_b_ai_071234fc();
@@ -948,25 +948,25 @@ void x115f_move_b_pi7_071234fc();
 void x1160_move_b_pd_071234fc();
 void x1167_move_b_pd7_071234fc();
 void x1168_move_b_di_071234fc();
-void x1170_move_b_ix_071234fc();
+template <u32 Types> void x1170_move_b_ix_071234fc();
 void x1178_move_b_aw_071234fc();
 void x1179_move_b_al_071234fc();
 void x117a_move_b_pcdi_071234fc();
-void x117b_move_b_pcix_071234fc();
+template <u32 Types> void x117b_move_b_pcix_071234fc();
 void x117c_move_b_i_071234fc();
-void x1180_move_b_071234fc();
-void x1190_move_b_ai_071234fc();
-void x1198_move_b_pi_071234fc();
-void x119f_move_b_pi7_071234fc();
-void x11a0_move_b_pd_071234fc();
-void x11a7_move_b_pd7_071234fc();
-void x11a8_move_b_di_071234fc();
-void x11b0_move_b_ix_071234fc();
-void x11b8_move_b_aw_071234fc();
-void x11b9_move_b_al_071234fc();
-void x11ba_move_b_pcdi_071234fc();
-void x11bb_move_b_pcix_071234fc();
-void x11bc_move_b_i_071234fc();
+template <u32 Types> void x1180_move_b_071234fc();
+template <u32 Types> void x1190_move_b_ai_071234fc();
+template <u32 Types> void x1198_move_b_pi_071234fc();
+template <u32 Types> void x119f_move_b_pi7_071234fc();
+template <u32 Types> void x11a0_move_b_pd_071234fc();
+template <u32 Types> void x11a7_move_b_pd7_071234fc();
+template <u32 Types> void x11a8_move_b_di_071234fc();
+template <u32 Types> void x11b0_move_b_ix_071234fc();
+template <u32 Types> void x11b8_move_b_aw_071234fc();
+template <u32 Types> void x11b9_move_b_al_071234fc();
+template <u32 Types> void x11ba_move_b_pcdi_071234fc();
+template <u32 Types> void x11bb_move_b_pcix_071234fc();
+template <u32 Types> void x11bc_move_b_i_071234fc();
 void x11c0_move_b_071234fc();
 void x11d0_move_b_ai_071234fc();
 void x11d8_move_b_pi_071234fc();
@@ -974,11 +974,11 @@ void x11df_move_b_pi7_071234fc();
 void x11e0_move_b_pd_071234fc();
 void x11e7_move_b_pd7_071234fc();
 void x11e8_move_b_di_071234fc();
-void x11f0_move_b_ix_071234fc();
+template <u32 Types> void x11f0_move_b_ix_071234fc();
 void x11f8_move_b_aw_071234fc();
 void x11f9_move_b_al_071234fc();
 void x11fa_move_b_pcdi_071234fc();
-void x11fb_move_b_pcix_071234fc();
+template <u32 Types> void x11fb_move_b_pcix_071234fc();
 void x11fc_move_b_i_071234fc();
 void x13c0_move_b_071234fc();
 void x13d0_move_b_ai_071234fc();
@@ -987,273 +987,273 @@ void x13df_move_b_pi7_071234fc();
 void x13e0_move_b_pd_071234fc();
 void x13e7_move_b_pd7_071234fc();
 void x13e8_move_b_di_071234fc();
-void x13f0_move_b_ix_071234fc();
+template <u32 Types> void x13f0_move_b_ix_071234fc();
 void x13f8_move_b_aw_071234fc();
 void x13f9_move_b_al_071234fc();
 void x13fa_move_b_pcdi_071234fc();
-void x13fb_move_b_pcix_071234fc();
+template <u32 Types> void x13fb_move_b_pcix_071234fc();
 void x13fc_move_b_i_071234fc();
 void x3000_move_w_071234fc();
 void x3008_move_w_071234fc();
-void x3010_move_w_ai_071234fc();
-void x3018_move_w_pi_071234fc();
-void x3020_move_w_pd_071234fc();
-void x3028_move_w_di_071234fc();
-void x3030_move_w_ix_071234fc();
-void x3038_move_w_aw_071234fc();
-void x3039_move_w_al_071234fc();
+template <u32 Types> void x3010_move_w_ai_071234fc();
+template <u32 Types> void x3018_move_w_pi_071234fc();
+template <u32 Types> void x3020_move_w_pd_071234fc();
+template <u32 Types> void x3028_move_w_di_071234fc();
+template <u32 Types> void x3030_move_w_ix_071234fc();
+template <u32 Types> void x3038_move_w_aw_071234fc();
+template <u32 Types> void x3039_move_w_al_071234fc();
 void x303a_move_w_pcdi_071234fc();
-void x303b_move_w_pcix_071234fc();
+template <u32 Types> void x303b_move_w_pcix_071234fc();
 void x303c_move_w_i_071234fc();
-void x3080_move_w_071234fc();
-void x3088_move_w_071234fc();
-void x3090_move_w_ai_071234fc();
-void x3098_move_w_pi_071234fc();
-void x30a0_move_w_pd_071234fc();
-void x30a8_move_w_di_071234fc();
-void x30b0_move_w_ix_071234fc();
-void x30b8_move_w_aw_071234fc();
-void x30b9_move_w_al_071234fc();
-void x30ba_move_w_pcdi_071234fc();
-void x30bb_move_w_pcix_071234fc();
-void x30bc_move_w_i_071234fc();
-void x30c0_move_w_071234fc();
-void x30c8_move_w_071234fc();
-void x30d0_move_w_ai_071234fc();
-void x30d8_move_w_pi_071234fc();
-void x30e0_move_w_pd_071234fc();
-void x30e8_move_w_di_071234fc();
-void x30f0_move_w_ix_071234fc();
-void x30f8_move_w_aw_071234fc();
-void x30f9_move_w_al_071234fc();
-void x30fa_move_w_pcdi_071234fc();
-void x30fb_move_w_pcix_071234fc();
-void x30fc_move_w_i_071234fc();
-void x3100_move_w_071234fc();
-void x3108_move_w_071234fc();
-void x3110_move_w_ai_071234fc();
-void x3118_move_w_pi_071234fc();
-void x3120_move_w_pd_071234fc();
-void x3128_move_w_di_071234fc();
-void x3130_move_w_ix_071234fc();
-void x3138_move_w_aw_071234fc();
-void x3139_move_w_al_071234fc();
-void x313a_move_w_pcdi_071234fc();
-void x313b_move_w_pcix_071234fc();
-void x313c_move_w_i_071234fc();
-void x3140_move_w_071234fc();
-void x3148_move_w_071234fc();
-void x3150_move_w_ai_071234fc();
-void x3158_move_w_pi_071234fc();
-void x3160_move_w_pd_071234fc();
-void x3168_move_w_di_071234fc();
-void x3170_move_w_ix_071234fc();
-void x3178_move_w_aw_071234fc();
-void x3179_move_w_al_071234fc();
-void x317a_move_w_pcdi_071234fc();
-void x317b_move_w_pcix_071234fc();
-void x317c_move_w_i_071234fc();
-void x3180_move_w_071234fc();
-void x3188_move_w_071234fc();
-void x3190_move_w_ai_071234fc();
-void x3198_move_w_pi_071234fc();
-void x31a0_move_w_pd_071234fc();
-void x31a8_move_w_di_071234fc();
-void x31b0_move_w_ix_071234fc();
-void x31b8_move_w_aw_071234fc();
-void x31b9_move_w_al_071234fc();
-void x31ba_move_w_pcdi_071234fc();
-void x31bb_move_w_pcix_071234fc();
-void x31bc_move_w_i_071234fc();
-void x31c0_move_w_071234fc();
-void x31c8_move_w_071234fc();
-void x31d0_move_w_ai_071234fc();
-void x31d8_move_w_pi_071234fc();
-void x31e0_move_w_pd_071234fc();
-void x31e8_move_w_di_071234fc();
-void x31f0_move_w_ix_071234fc();
-void x31f8_move_w_aw_071234fc();
-void x31f9_move_w_al_071234fc();
-void x31fa_move_w_pcdi_071234fc();
-void x31fb_move_w_pcix_071234fc();
-void x31fc_move_w_i_071234fc();
-void x33c0_move_w_071234fc();
-void x33c8_move_w_071234fc();
-void x33d0_move_w_ai_071234fc();
-void x33d8_move_w_pi_071234fc();
-void x33e0_move_w_pd_071234fc();
-void x33e8_move_w_di_071234fc();
-void x33f0_move_w_ix_071234fc();
-void x33f8_move_w_aw_071234fc();
-void x33f9_move_w_al_071234fc();
-void x33fa_move_w_pcdi_071234fc();
-void x33fb_move_w_pcix_071234fc();
-void x33fc_move_w_i_071234fc();
+template <u32 Types> void x3080_move_w_071234fc();
+template <u32 Types> void x3088_move_w_071234fc();
+template <u32 Types> void x3090_move_w_ai_071234fc();
+template <u32 Types> void x3098_move_w_pi_071234fc();
+template <u32 Types> void x30a0_move_w_pd_071234fc();
+template <u32 Types> void x30a8_move_w_di_071234fc();
+template <u32 Types> void x30b0_move_w_ix_071234fc();
+template <u32 Types> void x30b8_move_w_aw_071234fc();
+template <u32 Types> void x30b9_move_w_al_071234fc();
+template <u32 Types> void x30ba_move_w_pcdi_071234fc();
+template <u32 Types> void x30bb_move_w_pcix_071234fc();
+template <u32 Types> void x30bc_move_w_i_071234fc();
+template <u32 Types> void x30c0_move_w_071234fc();
+template <u32 Types> void x30c8_move_w_071234fc();
+template <u32 Types> void x30d0_move_w_ai_071234fc();
+template <u32 Types> void x30d8_move_w_pi_071234fc();
+template <u32 Types> void x30e0_move_w_pd_071234fc();
+template <u32 Types> void x30e8_move_w_di_071234fc();
+template <u32 Types> void x30f0_move_w_ix_071234fc();
+template <u32 Types> void x30f8_move_w_aw_071234fc();
+template <u32 Types> void x30f9_move_w_al_071234fc();
+template <u32 Types> void x30fa_move_w_pcdi_071234fc();
+template <u32 Types> void x30fb_move_w_pcix_071234fc();
+template <u32 Types> void x30fc_move_w_i_071234fc();
+template <u32 Types> void x3100_move_w_071234fc();
+template <u32 Types> void x3108_move_w_071234fc();
+template <u32 Types> void x3110_move_w_ai_071234fc();
+template <u32 Types> void x3118_move_w_pi_071234fc();
+template <u32 Types> void x3120_move_w_pd_071234fc();
+template <u32 Types> void x3128_move_w_di_071234fc();
+template <u32 Types> void x3130_move_w_ix_071234fc();
+template <u32 Types> void x3138_move_w_aw_071234fc();
+template <u32 Types> void x3139_move_w_al_071234fc();
+template <u32 Types> void x313a_move_w_pcdi_071234fc();
+template <u32 Types> void x313b_move_w_pcix_071234fc();
+template <u32 Types> void x313c_move_w_i_071234fc();
+template <u32 Types> void x3140_move_w_071234fc();
+template <u32 Types> void x3148_move_w_071234fc();
+template <u32 Types> void x3150_move_w_ai_071234fc();
+template <u32 Types> void x3158_move_w_pi_071234fc();
+template <u32 Types> void x3160_move_w_pd_071234fc();
+template <u32 Types> void x3168_move_w_di_071234fc();
+template <u32 Types> void x3170_move_w_ix_071234fc();
+template <u32 Types> void x3178_move_w_aw_071234fc();
+template <u32 Types> void x3179_move_w_al_071234fc();
+template <u32 Types> void x317a_move_w_pcdi_071234fc();
+template <u32 Types> void x317b_move_w_pcix_071234fc();
+template <u32 Types> void x317c_move_w_i_071234fc();
+template <u32 Types> void x3180_move_w_071234fc();
+template <u32 Types> void x3188_move_w_071234fc();
+template <u32 Types> void x3190_move_w_ai_071234fc();
+template <u32 Types> void x3198_move_w_pi_071234fc();
+template <u32 Types> void x31a0_move_w_pd_071234fc();
+template <u32 Types> void x31a8_move_w_di_071234fc();
+template <u32 Types> void x31b0_move_w_ix_071234fc();
+template <u32 Types> void x31b8_move_w_aw_071234fc();
+template <u32 Types> void x31b9_move_w_al_071234fc();
+template <u32 Types> void x31ba_move_w_pcdi_071234fc();
+template <u32 Types> void x31bb_move_w_pcix_071234fc();
+template <u32 Types> void x31bc_move_w_i_071234fc();
+template <u32 Types> void x31c0_move_w_071234fc();
+template <u32 Types> void x31c8_move_w_071234fc();
+template <u32 Types> void x31d0_move_w_ai_071234fc();
+template <u32 Types> void x31d8_move_w_pi_071234fc();
+template <u32 Types> void x31e0_move_w_pd_071234fc();
+template <u32 Types> void x31e8_move_w_di_071234fc();
+template <u32 Types> void x31f0_move_w_ix_071234fc();
+template <u32 Types> void x31f8_move_w_aw_071234fc();
+template <u32 Types> void x31f9_move_w_al_071234fc();
+template <u32 Types> void x31fa_move_w_pcdi_071234fc();
+template <u32 Types> void x31fb_move_w_pcix_071234fc();
+template <u32 Types> void x31fc_move_w_i_071234fc();
+template <u32 Types> void x33c0_move_w_071234fc();
+template <u32 Types> void x33c8_move_w_071234fc();
+template <u32 Types> void x33d0_move_w_ai_071234fc();
+template <u32 Types> void x33d8_move_w_pi_071234fc();
+template <u32 Types> void x33e0_move_w_pd_071234fc();
+template <u32 Types> void x33e8_move_w_di_071234fc();
+template <u32 Types> void x33f0_move_w_ix_071234fc();
+template <u32 Types> void x33f8_move_w_aw_071234fc();
+template <u32 Types> void x33f9_move_w_al_071234fc();
+template <u32 Types> void x33fa_move_w_pcdi_071234fc();
+template <u32 Types> void x33fb_move_w_pcix_071234fc();
+template <u32 Types> void x33fc_move_w_i_071234fc();
 void x2000_move_l_071234fc();
 void x2008_move_l_071234fc();
-void x2010_move_l_ai_071234fc();
-void x2018_move_l_pi_071234fc();
-void x2020_move_l_pd_071234fc();
-void x2028_move_l_di_071234fc();
-void x2030_move_l_ix_071234fc();
-void x2038_move_l_aw_071234fc();
-void x2039_move_l_al_071234fc();
+template <u32 Types> void x2010_move_l_ai_071234fc();
+template <u32 Types> void x2018_move_l_pi_071234fc();
+template <u32 Types> void x2020_move_l_pd_071234fc();
+template <u32 Types> void x2028_move_l_di_071234fc();
+template <u32 Types> void x2030_move_l_ix_071234fc();
+template <u32 Types> void x2038_move_l_aw_071234fc();
+template <u32 Types> void x2039_move_l_al_071234fc();
 void x203a_move_l_pcdi_071234fc();
-void x203b_move_l_pcix_071234fc();
+template <u32 Types> void x203b_move_l_pcix_071234fc();
 void x203c_move_l_i_071234fc();
-void x2080_move_l_071234fc();
-void x2088_move_l_071234fc();
-void x2090_move_l_ai_071234fc();
-void x2098_move_l_pi_071234fc();
-void x20a0_move_l_pd_071234fc();
-void x20a8_move_l_di_071234fc();
-void x20b0_move_l_ix_071234fc();
-void x20b8_move_l_aw_071234fc();
-void x20b9_move_l_al_071234fc();
-void x20ba_move_l_pcdi_071234fc();
-void x20bb_move_l_pcix_071234fc();
-void x20bc_move_l_i_071234fc();
-void x20c0_move_l_071234fc();
-void x20c8_move_l_071234fc();
-void x20d0_move_l_ai_071234fc();
-void x20d8_move_l_pi_071234fc();
-void x20e0_move_l_pd_071234fc();
-void x20e8_move_l_di_071234fc();
-void x20f0_move_l_ix_071234fc();
-void x20f8_move_l_aw_071234fc();
-void x20f9_move_l_al_071234fc();
-void x20fa_move_l_pcdi_071234fc();
-void x20fb_move_l_pcix_071234fc();
-void x20fc_move_l_i_071234fc();
-void x2100_move_l_071234fc();
-void x2108_move_l_071234fc();
-void x2110_move_l_ai_071234fc();
-void x2118_move_l_pi_071234fc();
-void x2120_move_l_pd_071234fc();
-void x2128_move_l_di_071234fc();
-void x2130_move_l_ix_071234fc();
-void x2138_move_l_aw_071234fc();
-void x2139_move_l_al_071234fc();
-void x213a_move_l_pcdi_071234fc();
-void x213b_move_l_pcix_071234fc();
-void x213c_move_l_i_071234fc();
-void x2140_move_l_071234fc();
-void x2148_move_l_071234fc();
-void x2150_move_l_ai_071234fc();
-void x2158_move_l_pi_071234fc();
-void x2160_move_l_pd_071234fc();
-void x2168_move_l_di_071234fc();
-void x2170_move_l_ix_071234fc();
-void x2178_move_l_aw_071234fc();
-void x2179_move_l_al_071234fc();
-void x217a_move_l_pcdi_071234fc();
-void x217b_move_l_pcix_071234fc();
-void x217c_move_l_i_071234fc();
-void x2180_move_l_071234fc();
-void x2188_move_l_071234fc();
-void x2190_move_l_ai_071234fc();
-void x2198_move_l_pi_071234fc();
-void x21a0_move_l_pd_071234fc();
-void x21a8_move_l_di_071234fc();
-void x21b0_move_l_ix_071234fc();
-void x21b8_move_l_aw_071234fc();
-void x21b9_move_l_al_071234fc();
-void x21ba_move_l_pcdi_071234fc();
-void x21bb_move_l_pcix_071234fc();
-void x21bc_move_l_i_071234fc();
-void x21c0_move_l_071234fc();
-void x21c8_move_l_071234fc();
-void x21d0_move_l_ai_071234fc();
-void x21d8_move_l_pi_071234fc();
-void x21e0_move_l_pd_071234fc();
-void x21e8_move_l_di_071234fc();
-void x21f0_move_l_ix_071234fc();
-void x21f8_move_l_aw_071234fc();
-void x21f9_move_l_al_071234fc();
-void x21fa_move_l_pcdi_071234fc();
-void x21fb_move_l_pcix_071234fc();
-void x21fc_move_l_i_071234fc();
-void x23c0_move_l_071234fc();
-void x23c8_move_l_071234fc();
-void x23d0_move_l_ai_071234fc();
-void x23d8_move_l_pi_071234fc();
-void x23e0_move_l_pd_071234fc();
-void x23e8_move_l_di_071234fc();
-void x23f0_move_l_ix_071234fc();
-void x23f8_move_l_aw_071234fc();
-void x23f9_move_l_al_071234fc();
-void x23fa_move_l_pcdi_071234fc();
-void x23fb_move_l_pcix_071234fc();
-void x23fc_move_l_i_071234fc();
+template <u32 Types> void x2080_move_l_071234fc();
+template <u32 Types> void x2088_move_l_071234fc();
+template <u32 Types> void x2090_move_l_ai_071234fc();
+template <u32 Types> void x2098_move_l_pi_071234fc();
+template <u32 Types> void x20a0_move_l_pd_071234fc();
+template <u32 Types> void x20a8_move_l_di_071234fc();
+template <u32 Types> void x20b0_move_l_ix_071234fc();
+template <u32 Types> void x20b8_move_l_aw_071234fc();
+template <u32 Types> void x20b9_move_l_al_071234fc();
+template <u32 Types> void x20ba_move_l_pcdi_071234fc();
+template <u32 Types> void x20bb_move_l_pcix_071234fc();
+template <u32 Types> void x20bc_move_l_i_071234fc();
+template <u32 Types> void x20c0_move_l_071234fc();
+template <u32 Types> void x20c8_move_l_071234fc();
+template <u32 Types> void x20d0_move_l_ai_071234fc();
+template <u32 Types> void x20d8_move_l_pi_071234fc();
+template <u32 Types> void x20e0_move_l_pd_071234fc();
+template <u32 Types> void x20e8_move_l_di_071234fc();
+template <u32 Types> void x20f0_move_l_ix_071234fc();
+template <u32 Types> void x20f8_move_l_aw_071234fc();
+template <u32 Types> void x20f9_move_l_al_071234fc();
+template <u32 Types> void x20fa_move_l_pcdi_071234fc();
+template <u32 Types> void x20fb_move_l_pcix_071234fc();
+template <u32 Types> void x20fc_move_l_i_071234fc();
+template <u32 Types> void x2100_move_l_071234fc();
+template <u32 Types> void x2108_move_l_071234fc();
+template <u32 Types> void x2110_move_l_ai_071234fc();
+template <u32 Types> void x2118_move_l_pi_071234fc();
+template <u32 Types> void x2120_move_l_pd_071234fc();
+template <u32 Types> void x2128_move_l_di_071234fc();
+template <u32 Types> void x2130_move_l_ix_071234fc();
+template <u32 Types> void x2138_move_l_aw_071234fc();
+template <u32 Types> void x2139_move_l_al_071234fc();
+template <u32 Types> void x213a_move_l_pcdi_071234fc();
+template <u32 Types> void x213b_move_l_pcix_071234fc();
+template <u32 Types> void x213c_move_l_i_071234fc();
+template <u32 Types> void x2140_move_l_071234fc();
+template <u32 Types> void x2148_move_l_071234fc();
+template <u32 Types> void x2150_move_l_ai_071234fc();
+template <u32 Types> void x2158_move_l_pi_071234fc();
+template <u32 Types> void x2160_move_l_pd_071234fc();
+template <u32 Types> void x2168_move_l_di_071234fc();
+template <u32 Types> void x2170_move_l_ix_071234fc();
+template <u32 Types> void x2178_move_l_aw_071234fc();
+template <u32 Types> void x2179_move_l_al_071234fc();
+template <u32 Types> void x217a_move_l_pcdi_071234fc();
+template <u32 Types> void x217b_move_l_pcix_071234fc();
+template <u32 Types> void x217c_move_l_i_071234fc();
+template <u32 Types> void x2180_move_l_071234fc();
+template <u32 Types> void x2188_move_l_071234fc();
+template <u32 Types> void x2190_move_l_ai_071234fc();
+template <u32 Types> void x2198_move_l_pi_071234fc();
+template <u32 Types> void x21a0_move_l_pd_071234fc();
+template <u32 Types> void x21a8_move_l_di_071234fc();
+template <u32 Types> void x21b0_move_l_ix_071234fc();
+template <u32 Types> void x21b8_move_l_aw_071234fc();
+template <u32 Types> void x21b9_move_l_al_071234fc();
+template <u32 Types> void x21ba_move_l_pcdi_071234fc();
+template <u32 Types> void x21bb_move_l_pcix_071234fc();
+template <u32 Types> void x21bc_move_l_i_071234fc();
+template <u32 Types> void x21c0_move_l_071234fc();
+template <u32 Types> void x21c8_move_l_071234fc();
+template <u32 Types> void x21d0_move_l_ai_071234fc();
+template <u32 Types> void x21d8_move_l_pi_071234fc();
+template <u32 Types> void x21e0_move_l_pd_071234fc();
+template <u32 Types> void x21e8_move_l_di_071234fc();
+template <u32 Types> void x21f0_move_l_ix_071234fc();
+template <u32 Types> void x21f8_move_l_aw_071234fc();
+template <u32 Types> void x21f9_move_l_al_071234fc();
+template <u32 Types> void x21fa_move_l_pcdi_071234fc();
+template <u32 Types> void x21fb_move_l_pcix_071234fc();
+template <u32 Types> void x21fc_move_l_i_071234fc();
+template <u32 Types> void x23c0_move_l_071234fc();
+template <u32 Types> void x23c8_move_l_071234fc();
+template <u32 Types> void x23d0_move_l_ai_071234fc();
+template <u32 Types> void x23d8_move_l_pi_071234fc();
+template <u32 Types> void x23e0_move_l_pd_071234fc();
+template <u32 Types> void x23e8_move_l_di_071234fc();
+template <u32 Types> void x23f0_move_l_ix_071234fc();
+template <u32 Types> void x23f8_move_l_aw_071234fc();
+template <u32 Types> void x23f9_move_l_al_071234fc();
+template <u32 Types> void x23fa_move_l_pcdi_071234fc();
+template <u32 Types> void x23fb_move_l_pcix_071234fc();
+template <u32 Types> void x23fc_move_l_i_071234fc();
 void x3040_movea_w_071234fc();
 void x3048_movea_w_071234fc();
-void x3050_movea_w_ai_071234fc();
-void x3058_movea_w_pi_071234fc();
-void x3060_movea_w_pd_071234fc();
-void x3068_movea_w_di_071234fc();
-void x3070_movea_w_ix_071234fc();
-void x3078_movea_w_aw_071234fc();
-void x3079_movea_w_al_071234fc();
+template <u32 Types> void x3050_movea_w_ai_071234fc();
+template <u32 Types> void x3058_movea_w_pi_071234fc();
+template <u32 Types> void x3060_movea_w_pd_071234fc();
+template <u32 Types> void x3068_movea_w_di_071234fc();
+template <u32 Types> void x3070_movea_w_ix_071234fc();
+template <u32 Types> void x3078_movea_w_aw_071234fc();
+template <u32 Types> void x3079_movea_w_al_071234fc();
 void x307a_movea_w_pcdi_071234fc();
-void x307b_movea_w_pcix_071234fc();
+template <u32 Types> void x307b_movea_w_pcix_071234fc();
 void x307c_movea_w_i_071234fc();
 void x2040_movea_l_071234fc();
 void x2048_movea_l_071234fc();
-void x2050_movea_l_ai_071234fc();
-void x2058_movea_l_pi_071234fc();
-void x2060_movea_l_pd_071234fc();
-void x2068_movea_l_di_071234fc();
-void x2070_movea_l_ix_071234fc();
-void x2078_movea_l_aw_071234fc();
-void x2079_movea_l_al_071234fc();
+template <u32 Types> void x2050_movea_l_ai_071234fc();
+template <u32 Types> void x2058_movea_l_pi_071234fc();
+template <u32 Types> void x2060_movea_l_pd_071234fc();
+template <u32 Types> void x2068_movea_l_di_071234fc();
+template <u32 Types> void x2070_movea_l_ix_071234fc();
+template <u32 Types> void x2078_movea_l_aw_071234fc();
+template <u32 Types> void x2079_movea_l_al_071234fc();
 void x207a_movea_l_pcdi_071234fc();
-void x207b_movea_l_pcix_071234fc();
+template <u32 Types> void x207b_movea_l_pcix_071234fc();
 void x207c_movea_l_i_071234fc();
 void x42c0_move_w_1234fc();
-void x42d0_move_w_ai_1234fc();
-void x42d8_move_w_pi_1234fc();
-void x42e0_move_w_pd_1234fc();
-void x42e8_move_w_di_1234fc();
-void x42f0_move_w_ix_1234fc();
-void x42f8_move_w_aw_1234fc();
-void x42f9_move_w_al_1234fc();
+template <u32 Types> void x42d0_move_w_ai_1234fc();
+template <u32 Types> void x42d8_move_w_pi_1234fc();
+template <u32 Types> void x42e0_move_w_pd_1234fc();
+template <u32 Types> void x42e8_move_w_di_1234fc();
+template <u32 Types> void x42f0_move_w_ix_1234fc();
+template <u32 Types> void x42f8_move_w_aw_1234fc();
+template <u32 Types> void x42f9_move_w_al_1234fc();
 void x44c0_move_w_071234fc();
-void x44d0_move_w_ai_071234fc();
-void x44d8_move_w_pi_071234fc();
-void x44e0_move_w_pd_071234fc();
-void x44e8_move_w_di_071234fc();
-void x44f0_move_w_ix_071234fc();
-void x44f8_move_w_aw_071234fc();
-void x44f9_move_w_al_071234fc();
+template <u32 Types> void x44d0_move_w_ai_071234fc();
+template <u32 Types> void x44d8_move_w_pi_071234fc();
+template <u32 Types> void x44e0_move_w_pd_071234fc();
+template <u32 Types> void x44e8_move_w_di_071234fc();
+template <u32 Types> void x44f0_move_w_ix_071234fc();
+template <u32 Types> void x44f8_move_w_aw_071234fc();
+template <u32 Types> void x44f9_move_w_al_071234fc();
 void x44fa_move_w_pcdi_071234fc();
-void x44fb_move_w_pcix_071234fc();
+template <u32 Types> void x44fb_move_w_pcix_071234fc();
 void x44fc_move_w_i_071234fc();
 void x40c0_move_w_07();
 void x40c0_move_w_1234fc();
-void x40d0_move_w_ai_07();
-void x40d8_move_w_pi_07();
-void x40e0_move_w_pd_07();
-void x40e8_move_w_di_07();
-void x40f0_move_w_ix_07();
-void x40f8_move_w_aw_07();
-void x40f9_move_w_al_07();
-void x40d0_move_w_ai_1234fc();
-void x40d8_move_w_pi_1234fc();
-void x40e0_move_w_pd_1234fc();
-void x40e8_move_w_di_1234fc();
-void x40f0_move_w_ix_1234fc();
-void x40f8_move_w_aw_1234fc();
-void x40f9_move_w_al_1234fc();
+template <u32 Types> void x40d0_move_w_ai_07();
+template <u32 Types> void x40d8_move_w_pi_07();
+template <u32 Types> void x40e0_move_w_pd_07();
+template <u32 Types> void x40e8_move_w_di_07();
+template <u32 Types> void x40f0_move_w_ix_07();
+template <u32 Types> void x40f8_move_w_aw_07();
+template <u32 Types> void x40f9_move_w_al_07();
+template <u32 Types> void x40d0_move_w_ai_1234fc();
+template <u32 Types> void x40d8_move_w_pi_1234fc();
+template <u32 Types> void x40e0_move_w_pd_1234fc();
+template <u32 Types> void x40e8_move_w_di_1234fc();
+template <u32 Types> void x40f0_move_w_ix_1234fc();
+template <u32 Types> void x40f8_move_w_aw_1234fc();
+template <u32 Types> void x40f9_move_w_al_1234fc();
 void x46c0_move_w_071234fc();
-void x46d0_move_w_ai_071234fc();
-void x46d8_move_w_pi_071234fc();
-void x46e0_move_w_pd_071234fc();
-void x46e8_move_w_di_071234fc();
-void x46f0_move_w_ix_071234fc();
-void x46f8_move_w_aw_071234fc();
-void x46f9_move_w_al_071234fc();
+template <u32 Types> void x46d0_move_w_ai_071234fc();
+template <u32 Types> void x46d8_move_w_pi_071234fc();
+template <u32 Types> void x46e0_move_w_pd_071234fc();
+template <u32 Types> void x46e8_move_w_di_071234fc();
+template <u32 Types> void x46f0_move_w_ix_071234fc();
+template <u32 Types> void x46f8_move_w_aw_071234fc();
+template <u32 Types> void x46f9_move_w_al_071234fc();
 void x46fa_move_w_pcdi_071234fc();
-void x46fb_move_w_pcix_071234fc();
+template <u32 Types> void x46fb_move_w_pcix_071234fc();
 void x46fc_move_w_i_071234fc();
 void x4e68_move_l_071234fc();
 void x4e60_move_l_071234fc();
@@ -1266,34 +1266,34 @@ void x4e7b_movec_l_2f();
 void x4e7b_movec_l_3();
 void x4e7b_movec_l_4();
 void x4e7b_movec_l_c();
-void x48a0_movem_w_071234fc();
-void x4890_movem_w_ai_071234fc();
-void x48a8_movem_w_di_071234fc();
-void x48b0_movem_w_ix_071234fc();
-void x48b8_movem_w_aw_071234fc();
-void x48b9_movem_w_al_071234fc();
-void x48e0_movem_l_071234fc();
-void x48d0_movem_l_ai_071234fc();
-void x48e8_movem_l_di_071234fc();
-void x48f0_movem_l_ix_071234fc();
-void x48f8_movem_l_aw_071234fc();
-void x48f9_movem_l_al_071234fc();
-void x4c98_movem_w_071234fc();
+template <u32 Types> void x48a0_movem_w_071234fc();
+template <u32 Types> void x4890_movem_w_ai_071234fc();
+template <u32 Types> void x48a8_movem_w_di_071234fc();
+template <u32 Types> void x48b0_movem_w_ix_071234fc();
+template <u32 Types> void x48b8_movem_w_aw_071234fc();
+template <u32 Types> void x48b9_movem_w_al_071234fc();
+template <u32 Types> void x48e0_movem_l_071234fc();
+template <u32 Types> void x48d0_movem_l_ai_071234fc();
+template <u32 Types> void x48e8_movem_l_di_071234fc();
+template <u32 Types> void x48f0_movem_l_ix_071234fc();
+template <u32 Types> void x48f8_movem_l_aw_071234fc();
+template <u32 Types> void x48f9_movem_l_al_071234fc();
+template <u32 Types> void x4c98_movem_w_071234fc();
 void x4cba_movem_w_071234fc();
-void x4cbb_movem_w_071234fc();
-void x4c90_movem_w_ai_071234fc();
-void x4ca8_movem_w_di_071234fc();
-void x4cb0_movem_w_ix_071234fc();
-void x4cb8_movem_w_aw_071234fc();
-void x4cb9_movem_w_al_071234fc();
-void x4cd8_movem_l_071234fc();
+template <u32 Types> void x4cbb_movem_w_071234fc();
+template <u32 Types> void x4c90_movem_w_ai_071234fc();
+template <u32 Types> void x4ca8_movem_w_di_071234fc();
+template <u32 Types> void x4cb0_movem_w_ix_071234fc();
+template <u32 Types> void x4cb8_movem_w_aw_071234fc();
+template <u32 Types> void x4cb9_movem_w_al_071234fc();
+template <u32 Types> void x4cd8_movem_l_071234fc();
 void x4cfa_movem_l_071234fc();
-void x4cfb_movem_l_071234fc();
-void x4cd0_movem_l_ai_071234fc();
-void x4ce8_movem_l_di_071234fc();
-void x4cf0_movem_l_ix_071234fc();
-void x4cf8_movem_l_aw_071234fc();
-void x4cf9_movem_l_al_071234fc();
+template <u32 Types> void x4cfb_movem_l_071234fc();
+template <u32 Types> void x4cd0_movem_l_ai_071234fc();
+template <u32 Types> void x4ce8_movem_l_di_071234fc();
+template <u32 Types> void x4cf0_movem_l_ix_071234fc();
+template <u32 Types> void x4cf8_movem_l_aw_071234fc();
+template <u32 Types> void x4cf9_movem_l_al_071234fc();
 void x0188_movep_w_071234fc();
 void x01c8_movep_l_071234fc();
 void x0108_movep_w_071234fc();
@@ -1304,7 +1304,7 @@ void x0e1f_moves_b_pi7_134fc();
 void x0e20_moves_b_pd_134fc();
 void x0e27_moves_b_pd7_134fc();
 void x0e28_moves_b_di_134fc();
-void x0e30_moves_b_ix_134fc();
+template <u32 Types> void x0e30_moves_b_ix_134fc();
 void x0e38_moves_b_aw_134fc();
 void x0e39_moves_b_al_134fc();
 void x0e10_moves_b_ai_2();
@@ -1313,71 +1313,71 @@ void x0e1f_moves_b_pi7_2();
 void x0e20_moves_b_pd_2();
 void x0e27_moves_b_pd7_2();
 void x0e28_moves_b_di_2();
-void x0e30_moves_b_ix_2();
+template <u32 Types> void x0e30_moves_b_ix_2();
 void x0e38_moves_b_aw_2();
 void x0e39_moves_b_al_2();
-void x0e50_moves_w_ai_134fc();
-void x0e58_moves_w_pi_134fc();
-void x0e60_moves_w_pd_134fc();
-void x0e68_moves_w_di_134fc();
-void x0e70_moves_w_ix_134fc();
-void x0e78_moves_w_aw_134fc();
-void x0e79_moves_w_al_134fc();
-void x0e50_moves_w_ai_2();
-void x0e58_moves_w_pi_2();
-void x0e60_moves_w_pd_2();
-void x0e68_moves_w_di_2();
-void x0e70_moves_w_ix_2();
-void x0e78_moves_w_aw_2();
-void x0e79_moves_w_al_2();
-void x0e90_moves_l_ai_134fc();
-void x0e98_moves_l_pi_134fc();
-void x0ea0_moves_l_pd_134fc();
-void x0ea8_moves_l_di_134fc();
-void x0eb0_moves_l_ix_134fc();
-void x0eb8_moves_l_aw_134fc();
-void x0eb9_moves_l_al_134fc();
-void x0e90_moves_l_ai_2();
-void x0e98_moves_l_pi_2();
-void x0ea0_moves_l_pd_2();
-void x0ea8_moves_l_di_2();
-void x0eb0_moves_l_ix_2();
-void x0eb8_moves_l_aw_2();
-void x0eb9_moves_l_al_2();
+template <u32 Types> void x0e50_moves_w_ai_134fc();
+template <u32 Types> void x0e58_moves_w_pi_134fc();
+template <u32 Types> void x0e60_moves_w_pd_134fc();
+template <u32 Types> void x0e68_moves_w_di_134fc();
+template <u32 Types> void x0e70_moves_w_ix_134fc();
+template <u32 Types> void x0e78_moves_w_aw_134fc();
+template <u32 Types> void x0e79_moves_w_al_134fc();
+template <u32 Types> void x0e50_moves_w_ai_2();
+template <u32 Types> void x0e58_moves_w_pi_2();
+template <u32 Types> void x0e60_moves_w_pd_2();
+template <u32 Types> void x0e68_moves_w_di_2();
+template <u32 Types> void x0e70_moves_w_ix_2();
+template <u32 Types> void x0e78_moves_w_aw_2();
+template <u32 Types> void x0e79_moves_w_al_2();
+template <u32 Types> void x0e90_moves_l_ai_134fc();
+template <u32 Types> void x0e98_moves_l_pi_134fc();
+template <u32 Types> void x0ea0_moves_l_pd_134fc();
+template <u32 Types> void x0ea8_moves_l_di_134fc();
+template <u32 Types> void x0eb0_moves_l_ix_134fc();
+template <u32 Types> void x0eb8_moves_l_aw_134fc();
+template <u32 Types> void x0eb9_moves_l_al_134fc();
+template <u32 Types> void x0e90_moves_l_ai_2();
+template <u32 Types> void x0e98_moves_l_pi_2();
+template <u32 Types> void x0ea0_moves_l_pd_2();
+template <u32 Types> void x0ea8_moves_l_di_2();
+template <u32 Types> void x0eb0_moves_l_ix_2();
+template <u32 Types> void x0eb8_moves_l_aw_2();
+template <u32 Types> void x0eb9_moves_l_al_2();
 void x7000_moveq_l_071234fc();
-void xf620_move16_l_4fc();
+template <u32 Types> void xf620_move16_l_4fc();
 void xc1c0_muls_w_071234fc();
-void xc1d0_muls_w_ai_071234fc();
-void xc1d8_muls_w_pi_071234fc();
-void xc1e0_muls_w_pd_071234fc();
-void xc1e8_muls_w_di_071234fc();
-void xc1f0_muls_w_ix_071234fc();
-void xc1f8_muls_w_aw_071234fc();
-void xc1f9_muls_w_al_071234fc();
+template <u32 Types> void xc1d0_muls_w_ai_071234fc();
+template <u32 Types> void xc1d8_muls_w_pi_071234fc();
+template <u32 Types> void xc1e0_muls_w_pd_071234fc();
+template <u32 Types> void xc1e8_muls_w_di_071234fc();
+template <u32 Types> void xc1f0_muls_w_ix_071234fc();
+template <u32 Types> void xc1f8_muls_w_aw_071234fc();
+template <u32 Types> void xc1f9_muls_w_al_071234fc();
 void xc1fa_muls_w_pcdi_071234fc();
-void xc1fb_muls_w_pcix_071234fc();
+template <u32 Types> void xc1fb_muls_w_pcix_071234fc();
 void xc1fc_muls_w_i_071234fc();
 void xc0c0_mulu_w_071234fc();
-void xc0d0_mulu_w_ai_071234fc();
-void xc0d8_mulu_w_pi_071234fc();
-void xc0e0_mulu_w_pd_071234fc();
-void xc0e8_mulu_w_di_071234fc();
-void xc0f0_mulu_w_ix_071234fc();
-void xc0f8_mulu_w_aw_071234fc();
-void xc0f9_mulu_w_al_071234fc();
+template <u32 Types> void xc0d0_mulu_w_ai_071234fc();
+template <u32 Types> void xc0d8_mulu_w_pi_071234fc();
+template <u32 Types> void xc0e0_mulu_w_pd_071234fc();
+template <u32 Types> void xc0e8_mulu_w_di_071234fc();
+template <u32 Types> void xc0f0_mulu_w_ix_071234fc();
+template <u32 Types> void xc0f8_mulu_w_aw_071234fc();
+template <u32 Types> void xc0f9_mulu_w_al_071234fc();
 void xc0fa_mulu_w_pcdi_071234fc();
-void xc0fb_mulu_w_pcix_071234fc();
+template <u32 Types> void xc0fb_mulu_w_pcix_071234fc();
 void xc0fc_mulu_w_i_071234fc();
 void x4c00_mull_l_234fc();
-void x4c10_mull_l_ai_234fc();
-void x4c18_mull_l_pi_234fc();
-void x4c20_mull_l_pd_234fc();
-void x4c28_mull_l_di_234fc();
-void x4c30_mull_l_ix_234fc();
-void x4c38_mull_l_aw_234fc();
-void x4c39_mull_l_al_234fc();
+template <u32 Types> void x4c10_mull_l_ai_234fc();
+template <u32 Types> void x4c18_mull_l_pi_234fc();
+template <u32 Types> void x4c20_mull_l_pd_234fc();
+template <u32 Types> void x4c28_mull_l_di_234fc();
+template <u32 Types> void x4c30_mull_l_ix_234fc();
+template <u32 Types> void x4c38_mull_l_aw_234fc();
+template <u32 Types> void x4c39_mull_l_al_234fc();
 void x4c3a_mull_l_pcdi_234fc();
-void x4c3b_mull_l_pcix_234fc();
+template <u32 Types> void x4c3b_mull_l_pcix_234fc();
 void x4c3c_mull_l_i_234fc();
 void x4800_nbcd_b_071234fc();
 void x4810_nbcd_b_ai_071234fc();
@@ -1386,7 +1386,7 @@ void x481f_nbcd_b_pi7_071234fc();
 void x4820_nbcd_b_pd_071234fc();
 void x4827_nbcd_b_pd7_071234fc();
 void x4828_nbcd_b_di_071234fc();
-void x4830_nbcd_b_ix_071234fc();
+template <u32 Types> void x4830_nbcd_b_ix_071234fc();
 void x4838_nbcd_b_aw_071234fc();
 void x4839_nbcd_b_al_071234fc();
 void x4400_neg_b_071234fc();
@@ -1396,25 +1396,25 @@ void x441f_neg_b_pi7_071234fc();
 void x4420_neg_b_pd_071234fc();
 void x4427_neg_b_pd7_071234fc();
 void x4428_neg_b_di_071234fc();
-void x4430_neg_b_ix_071234fc();
+template <u32 Types> void x4430_neg_b_ix_071234fc();
 void x4438_neg_b_aw_071234fc();
 void x4439_neg_b_al_071234fc();
 void x4440_neg_w_071234fc();
-void x4450_neg_w_ai_071234fc();
-void x4458_neg_w_pi_071234fc();
-void x4460_neg_w_pd_071234fc();
-void x4468_neg_w_di_071234fc();
-void x4470_neg_w_ix_071234fc();
-void x4478_neg_w_aw_071234fc();
-void x4479_neg_w_al_071234fc();
+template <u32 Types> void x4450_neg_w_ai_071234fc();
+template <u32 Types> void x4458_neg_w_pi_071234fc();
+template <u32 Types> void x4460_neg_w_pd_071234fc();
+template <u32 Types> void x4468_neg_w_di_071234fc();
+template <u32 Types> void x4470_neg_w_ix_071234fc();
+template <u32 Types> void x4478_neg_w_aw_071234fc();
+template <u32 Types> void x4479_neg_w_al_071234fc();
 void x4480_neg_l_071234fc();
-void x4490_neg_l_ai_071234fc();
-void x4498_neg_l_pi_071234fc();
-void x44a0_neg_l_pd_071234fc();
-void x44a8_neg_l_di_071234fc();
-void x44b0_neg_l_ix_071234fc();
-void x44b8_neg_l_aw_071234fc();
-void x44b9_neg_l_al_071234fc();
+template <u32 Types> void x4490_neg_l_ai_071234fc();
+template <u32 Types> void x4498_neg_l_pi_071234fc();
+template <u32 Types> void x44a0_neg_l_pd_071234fc();
+template <u32 Types> void x44a8_neg_l_di_071234fc();
+template <u32 Types> void x44b0_neg_l_ix_071234fc();
+template <u32 Types> void x44b8_neg_l_aw_071234fc();
+template <u32 Types> void x44b9_neg_l_al_071234fc();
 void x4000_negx_b_071234fc();
 void x4010_negx_b_ai_071234fc();
 void x4018_negx_b_pi_071234fc();
@@ -1422,25 +1422,25 @@ void x401f_negx_b_pi7_071234fc();
 void x4020_negx_b_pd_071234fc();
 void x4027_negx_b_pd7_071234fc();
 void x4028_negx_b_di_071234fc();
-void x4030_negx_b_ix_071234fc();
+template <u32 Types> void x4030_negx_b_ix_071234fc();
 void x4038_negx_b_aw_071234fc();
 void x4039_negx_b_al_071234fc();
 void x4040_negx_w_071234fc();
-void x4050_negx_w_ai_071234fc();
-void x4058_negx_w_pi_071234fc();
-void x4060_negx_w_pd_071234fc();
-void x4068_negx_w_di_071234fc();
-void x4070_negx_w_ix_071234fc();
-void x4078_negx_w_aw_071234fc();
-void x4079_negx_w_al_071234fc();
+template <u32 Types> void x4050_negx_w_ai_071234fc();
+template <u32 Types> void x4058_negx_w_pi_071234fc();
+template <u32 Types> void x4060_negx_w_pd_071234fc();
+template <u32 Types> void x4068_negx_w_di_071234fc();
+template <u32 Types> void x4070_negx_w_ix_071234fc();
+template <u32 Types> void x4078_negx_w_aw_071234fc();
+template <u32 Types> void x4079_negx_w_al_071234fc();
 void x4080_negx_l_071234fc();
-void x4090_negx_l_ai_071234fc();
-void x4098_negx_l_pi_071234fc();
-void x40a0_negx_l_pd_071234fc();
-void x40a8_negx_l_di_071234fc();
-void x40b0_negx_l_ix_071234fc();
-void x40b8_negx_l_aw_071234fc();
-void x40b9_negx_l_al_071234fc();
+template <u32 Types> void x4090_negx_l_ai_071234fc();
+template <u32 Types> void x4098_negx_l_pi_071234fc();
+template <u32 Types> void x40a0_negx_l_pd_071234fc();
+template <u32 Types> void x40a8_negx_l_di_071234fc();
+template <u32 Types> void x40b0_negx_l_ix_071234fc();
+template <u32 Types> void x40b8_negx_l_aw_071234fc();
+template <u32 Types> void x40b9_negx_l_al_071234fc();
 void x4e71_nop_071234fc();
 void x4600_not_b_071234fc();
 void x4610_not_b_ai_071234fc();
@@ -1449,25 +1449,25 @@ void x461f_not_b_pi7_071234fc();
 void x4620_not_b_pd_071234fc();
 void x4627_not_b_pd7_071234fc();
 void x4628_not_b_di_071234fc();
-void x4630_not_b_ix_071234fc();
+template <u32 Types> void x4630_not_b_ix_071234fc();
 void x4638_not_b_aw_071234fc();
 void x4639_not_b_al_071234fc();
 void x4640_not_w_071234fc();
-void x4650_not_w_ai_071234fc();
-void x4658_not_w_pi_071234fc();
-void x4660_not_w_pd_071234fc();
-void x4668_not_w_di_071234fc();
-void x4670_not_w_ix_071234fc();
-void x4678_not_w_aw_071234fc();
-void x4679_not_w_al_071234fc();
+template <u32 Types> void x4650_not_w_ai_071234fc();
+template <u32 Types> void x4658_not_w_pi_071234fc();
+template <u32 Types> void x4660_not_w_pd_071234fc();
+template <u32 Types> void x4668_not_w_di_071234fc();
+template <u32 Types> void x4670_not_w_ix_071234fc();
+template <u32 Types> void x4678_not_w_aw_071234fc();
+template <u32 Types> void x4679_not_w_al_071234fc();
 void x4680_not_l_071234fc();
-void x4690_not_l_ai_071234fc();
-void x4698_not_l_pi_071234fc();
-void x46a0_not_l_pd_071234fc();
-void x46a8_not_l_di_071234fc();
-void x46b0_not_l_ix_071234fc();
-void x46b8_not_l_aw_071234fc();
-void x46b9_not_l_al_071234fc();
+template <u32 Types> void x4690_not_l_ai_071234fc();
+template <u32 Types> void x4698_not_l_pi_071234fc();
+template <u32 Types> void x46a0_not_l_pd_071234fc();
+template <u32 Types> void x46a8_not_l_di_071234fc();
+template <u32 Types> void x46b0_not_l_ix_071234fc();
+template <u32 Types> void x46b8_not_l_aw_071234fc();
+template <u32 Types> void x46b9_not_l_al_071234fc();
 void x8000_or_b_071234fc();
 void x8010_or_b_ai_071234fc();
 void x8018_or_b_pi_071234fc();
@@ -1475,33 +1475,33 @@ void x801f_or_b_pi7_071234fc();
 void x8020_or_b_pd_071234fc();
 void x8027_or_b_pd7_071234fc();
 void x8028_or_b_di_071234fc();
-void x8030_or_b_ix_071234fc();
+template <u32 Types> void x8030_or_b_ix_071234fc();
 void x8038_or_b_aw_071234fc();
 void x8039_or_b_al_071234fc();
 void x803a_or_b_pcdi_071234fc();
-void x803b_or_b_pcix_071234fc();
+template <u32 Types> void x803b_or_b_pcix_071234fc();
 void x803c_or_b_i_071234fc();
 void x8040_or_w_071234fc();
-void x8050_or_w_ai_071234fc();
-void x8058_or_w_pi_071234fc();
-void x8060_or_w_pd_071234fc();
-void x8068_or_w_di_071234fc();
-void x8070_or_w_ix_071234fc();
-void x8078_or_w_aw_071234fc();
-void x8079_or_w_al_071234fc();
+template <u32 Types> void x8050_or_w_ai_071234fc();
+template <u32 Types> void x8058_or_w_pi_071234fc();
+template <u32 Types> void x8060_or_w_pd_071234fc();
+template <u32 Types> void x8068_or_w_di_071234fc();
+template <u32 Types> void x8070_or_w_ix_071234fc();
+template <u32 Types> void x8078_or_w_aw_071234fc();
+template <u32 Types> void x8079_or_w_al_071234fc();
 void x807a_or_w_pcdi_071234fc();
-void x807b_or_w_pcix_071234fc();
+template <u32 Types> void x807b_or_w_pcix_071234fc();
 void x807c_or_w_i_071234fc();
 void x8080_or_l_071234fc();
-void x8090_or_l_ai_071234fc();
-void x8098_or_l_pi_071234fc();
-void x80a0_or_l_pd_071234fc();
-void x80a8_or_l_di_071234fc();
-void x80b0_or_l_ix_071234fc();
-void x80b8_or_l_aw_071234fc();
-void x80b9_or_l_al_071234fc();
+template <u32 Types> void x8090_or_l_ai_071234fc();
+template <u32 Types> void x8098_or_l_pi_071234fc();
+template <u32 Types> void x80a0_or_l_pd_071234fc();
+template <u32 Types> void x80a8_or_l_di_071234fc();
+template <u32 Types> void x80b0_or_l_ix_071234fc();
+template <u32 Types> void x80b8_or_l_aw_071234fc();
+template <u32 Types> void x80b9_or_l_al_071234fc();
 void x80ba_or_l_pcdi_071234fc();
-void x80bb_or_l_pcix_071234fc();
+template <u32 Types> void x80bb_or_l_pcix_071234fc();
 void x80bc_or_l_i_071234fc();
 void x8110_or_b_ai_071234fc();
 void x8118_or_b_pi_071234fc();
@@ -1509,23 +1509,23 @@ void x811f_or_b_pi7_071234fc();
 void x8120_or_b_pd_071234fc();
 void x8127_or_b_pd7_071234fc();
 void x8128_or_b_di_071234fc();
-void x8130_or_b_ix_071234fc();
+template <u32 Types> void x8130_or_b_ix_071234fc();
 void x8138_or_b_aw_071234fc();
 void x8139_or_b_al_071234fc();
-void x8150_or_w_ai_071234fc();
-void x8158_or_w_pi_071234fc();
-void x8160_or_w_pd_071234fc();
-void x8168_or_w_di_071234fc();
-void x8170_or_w_ix_071234fc();
-void x8178_or_w_aw_071234fc();
-void x8179_or_w_al_071234fc();
-void x8190_or_l_ai_071234fc();
-void x8198_or_l_pi_071234fc();
-void x81a0_or_l_pd_071234fc();
-void x81a8_or_l_di_071234fc();
-void x81b0_or_l_ix_071234fc();
-void x81b8_or_l_aw_071234fc();
-void x81b9_or_l_al_071234fc();
+template <u32 Types> void x8150_or_w_ai_071234fc();
+template <u32 Types> void x8158_or_w_pi_071234fc();
+template <u32 Types> void x8160_or_w_pd_071234fc();
+template <u32 Types> void x8168_or_w_di_071234fc();
+template <u32 Types> void x8170_or_w_ix_071234fc();
+template <u32 Types> void x8178_or_w_aw_071234fc();
+template <u32 Types> void x8179_or_w_al_071234fc();
+template <u32 Types> void x8190_or_l_ai_071234fc();
+template <u32 Types> void x8198_or_l_pi_071234fc();
+template <u32 Types> void x81a0_or_l_pd_071234fc();
+template <u32 Types> void x81a8_or_l_di_071234fc();
+template <u32 Types> void x81b0_or_l_ix_071234fc();
+template <u32 Types> void x81b8_or_l_aw_071234fc();
+template <u32 Types> void x81b9_or_l_al_071234fc();
 void x0000_ori_b_071234fc();
 void x0010_ori_b_ai_071234fc();
 void x0018_ori_b_pi_071234fc();
@@ -1533,25 +1533,25 @@ void x001f_ori_b_pi7_071234fc();
 void x0020_ori_b_pd_071234fc();
 void x0027_ori_b_pd7_071234fc();
 void x0028_ori_b_di_071234fc();
-void x0030_ori_b_ix_071234fc();
+template <u32 Types> void x0030_ori_b_ix_071234fc();
 void x0038_ori_b_aw_071234fc();
 void x0039_ori_b_al_071234fc();
 void x0040_ori_w_071234fc();
-void x0050_ori_w_ai_071234fc();
-void x0058_ori_w_pi_071234fc();
-void x0060_ori_w_pd_071234fc();
-void x0068_ori_w_di_071234fc();
-void x0070_ori_w_ix_071234fc();
-void x0078_ori_w_aw_071234fc();
-void x0079_ori_w_al_071234fc();
+template <u32 Types> void x0050_ori_w_ai_071234fc();
+template <u32 Types> void x0058_ori_w_pi_071234fc();
+template <u32 Types> void x0060_ori_w_pd_071234fc();
+template <u32 Types> void x0068_ori_w_di_071234fc();
+template <u32 Types> void x0070_ori_w_ix_071234fc();
+template <u32 Types> void x0078_ori_w_aw_071234fc();
+template <u32 Types> void x0079_ori_w_al_071234fc();
 void x0080_ori_l_071234fc();
-void x0090_ori_l_ai_071234fc();
-void x0098_ori_l_pi_071234fc();
-void x00a0_ori_l_pd_071234fc();
-void x00a8_ori_l_di_071234fc();
-void x00b0_ori_l_ix_071234fc();
-void x00b8_ori_l_aw_071234fc();
-void x00b9_ori_l_al_071234fc();
+template <u32 Types> void x0090_ori_l_ai_071234fc();
+template <u32 Types> void x0098_ori_l_pi_071234fc();
+template <u32 Types> void x00a0_ori_l_pd_071234fc();
+template <u32 Types> void x00a8_ori_l_di_071234fc();
+template <u32 Types> void x00b0_ori_l_ix_071234fc();
+template <u32 Types> void x00b8_ori_l_aw_071234fc();
+template <u32 Types> void x00b9_ori_l_al_071234fc();
 void x003c_ori_w_071234fc();
 void x007c_ori_w_071234fc();
 void x8140_pack_w_234fc();
@@ -1559,13 +1559,13 @@ void x8f48_pack_w_234fc();
 void x814f_pack_w_234fc();
 void x8f4f_pack_w_234fc();
 void x8148_pack_w_234fc();
-void x4850_pea_l_ai_071234fc();
-void x4868_pea_l_di_071234fc();
-void x4870_pea_l_ix_071234fc();
-void x4878_pea_l_aw_071234fc();
-void x4879_pea_l_al_071234fc();
-void x487a_pea_l_pcdi_071234fc();
-void x487b_pea_l_pcix_071234fc();
+template <u32 Types> void x4850_pea_l_ai_071234fc();
+template <u32 Types> void x4868_pea_l_di_071234fc();
+template <u32 Types> void x4870_pea_l_ix_071234fc();
+template <u32 Types> void x4878_pea_l_aw_071234fc();
+template <u32 Types> void x4879_pea_l_al_071234fc();
+template <u32 Types> void x487a_pea_l_pcdi_071234fc();
+template <u32 Types> void x487b_pea_l_pcix_071234fc();
 void xf518_pflusha_l_4fc();
 void xf510_pflushan_l_4fc();
 void xf000_pmmu_l_234fc();
@@ -1577,59 +1577,59 @@ void xe098_ror_l_071234fc();
 void xe038_ror_b_071234fc();
 void xe078_ror_w_071234fc();
 void xe0b8_ror_l_071234fc();
-void xe6d0_ror_w_ai_071234fc();
-void xe6d8_ror_w_pi_071234fc();
-void xe6e0_ror_w_pd_071234fc();
-void xe6e8_ror_w_di_071234fc();
-void xe6f0_ror_w_ix_071234fc();
-void xe6f8_ror_w_aw_071234fc();
-void xe6f9_ror_w_al_071234fc();
+template <u32 Types> void xe6d0_ror_w_ai_071234fc();
+template <u32 Types> void xe6d8_ror_w_pi_071234fc();
+template <u32 Types> void xe6e0_ror_w_pd_071234fc();
+template <u32 Types> void xe6e8_ror_w_di_071234fc();
+template <u32 Types> void xe6f0_ror_w_ix_071234fc();
+template <u32 Types> void xe6f8_ror_w_aw_071234fc();
+template <u32 Types> void xe6f9_ror_w_al_071234fc();
 void xe118_rol_b_071234fc();
 void xe158_rol_w_071234fc();
 void xe198_rol_l_071234fc();
 void xe138_rol_b_071234fc();
 void xe178_rol_w_071234fc();
 void xe1b8_rol_l_071234fc();
-void xe7d0_rol_w_ai_071234fc();
-void xe7d8_rol_w_pi_071234fc();
-void xe7e0_rol_w_pd_071234fc();
-void xe7e8_rol_w_di_071234fc();
-void xe7f0_rol_w_ix_071234fc();
-void xe7f8_rol_w_aw_071234fc();
-void xe7f9_rol_w_al_071234fc();
+template <u32 Types> void xe7d0_rol_w_ai_071234fc();
+template <u32 Types> void xe7d8_rol_w_pi_071234fc();
+template <u32 Types> void xe7e0_rol_w_pd_071234fc();
+template <u32 Types> void xe7e8_rol_w_di_071234fc();
+template <u32 Types> void xe7f0_rol_w_ix_071234fc();
+template <u32 Types> void xe7f8_rol_w_aw_071234fc();
+template <u32 Types> void xe7f9_rol_w_al_071234fc();
 void xe010_roxr_b_071234fc();
 void xe050_roxr_w_071234fc();
 void xe090_roxr_l_071234fc();
 void xe030_roxr_b_071234fc();
 void xe070_roxr_w_071234fc();
 void xe0b0_roxr_l_071234fc();
-void xe4d0_roxr_w_ai_071234fc();
-void xe4d8_roxr_w_pi_071234fc();
-void xe4e0_roxr_w_pd_071234fc();
-void xe4e8_roxr_w_di_071234fc();
-void xe4f0_roxr_w_ix_071234fc();
-void xe4f8_roxr_w_aw_071234fc();
-void xe4f9_roxr_w_al_071234fc();
+template <u32 Types> void xe4d0_roxr_w_ai_071234fc();
+template <u32 Types> void xe4d8_roxr_w_pi_071234fc();
+template <u32 Types> void xe4e0_roxr_w_pd_071234fc();
+template <u32 Types> void xe4e8_roxr_w_di_071234fc();
+template <u32 Types> void xe4f0_roxr_w_ix_071234fc();
+template <u32 Types> void xe4f8_roxr_w_aw_071234fc();
+template <u32 Types> void xe4f9_roxr_w_al_071234fc();
 void xe110_roxl_b_071234fc();
 void xe150_roxl_w_071234fc();
 void xe190_roxl_l_071234fc();
 void xe130_roxl_b_071234fc();
 void xe170_roxl_w_071234fc();
 void xe1b0_roxl_l_071234fc();
-void xe5d0_roxl_w_ai_071234fc();
-void xe5d8_roxl_w_pi_071234fc();
-void xe5e0_roxl_w_pd_071234fc();
-void xe5e8_roxl_w_di_071234fc();
-void xe5f0_roxl_w_ix_071234fc();
-void xe5f8_roxl_w_aw_071234fc();
-void xe5f9_roxl_w_al_071234fc();
-void x4e74_rtd_l_1234fc();
-void x4e73_rte_l_0();
-void x4e73_rte_l_71();
-void x4e73_rte_l_234fc();
+template <u32 Types> void xe5d0_roxl_w_ai_071234fc();
+template <u32 Types> void xe5d8_roxl_w_pi_071234fc();
+template <u32 Types> void xe5e0_roxl_w_pd_071234fc();
+template <u32 Types> void xe5e8_roxl_w_di_071234fc();
+template <u32 Types> void xe5f0_roxl_w_ix_071234fc();
+template <u32 Types> void xe5f8_roxl_w_aw_071234fc();
+template <u32 Types> void xe5f9_roxl_w_al_071234fc();
+template <u32 Types> void x4e74_rtd_l_1234fc();
+template <u32 Types> void x4e73_rte_l_0();
+template <u32 Types> void x4e73_rte_l_71();
+template <u32 Types> void x4e73_rte_l_234fc();
 void x06c0_rtm_l_234fc();
-void x4e77_rtr_l_071234fc();
-void x4e75_rts_l_071234fc();
+template <u32 Types> void x4e77_rtr_l_071234fc();
+template <u32 Types> void x4e75_rts_l_071234fc();
 void x8100_sbcd_b_071234fc();
 void x8f08_sbcd_b_071234fc();
 void x810f_sbcd_b_071234fc();
@@ -1642,7 +1642,7 @@ void x50df_st_b_pi7_071234fc();
 void x50e0_st_b_pd_071234fc();
 void x50e7_st_b_pd7_071234fc();
 void x50e8_st_b_di_071234fc();
-void x50f0_st_b_ix_071234fc();
+template <u32 Types> void x50f0_st_b_ix_071234fc();
 void x50f8_st_b_aw_071234fc();
 void x50f9_st_b_al_071234fc();
 void x51c0_sf_b_071234fc();
@@ -1652,7 +1652,7 @@ void x51df_sf_b_pi7_071234fc();
 void x51e0_sf_b_pd_071234fc();
 void x51e7_sf_b_pd7_071234fc();
 void x51e8_sf_b_di_071234fc();
-void x51f0_sf_b_ix_071234fc();
+template <u32 Types> void x51f0_sf_b_ix_071234fc();
 void x51f8_sf_b_aw_071234fc();
 void x51f9_sf_b_al_071234fc();
 void x52c0_shi_b_071234fc();
@@ -1675,7 +1675,7 @@ void x52df_shi_b_pi7_071234fc();
 void x52e0_shi_b_pd_071234fc();
 void x52e7_shi_b_pd7_071234fc();
 void x52e8_shi_b_di_071234fc();
-void x52f0_shi_b_ix_071234fc();
+template <u32 Types> void x52f0_shi_b_ix_071234fc();
 void x52f8_shi_b_aw_071234fc();
 void x52f9_shi_b_al_071234fc();
 void x53d0_sls_b_ai_071234fc();
@@ -1684,7 +1684,7 @@ void x53df_sls_b_pi7_071234fc();
 void x53e0_sls_b_pd_071234fc();
 void x53e7_sls_b_pd7_071234fc();
 void x53e8_sls_b_di_071234fc();
-void x53f0_sls_b_ix_071234fc();
+template <u32 Types> void x53f0_sls_b_ix_071234fc();
 void x53f8_sls_b_aw_071234fc();
 void x53f9_sls_b_al_071234fc();
 void x54d0_scc_b_ai_071234fc();
@@ -1693,7 +1693,7 @@ void x54df_scc_b_pi7_071234fc();
 void x54e0_scc_b_pd_071234fc();
 void x54e7_scc_b_pd7_071234fc();
 void x54e8_scc_b_di_071234fc();
-void x54f0_scc_b_ix_071234fc();
+template <u32 Types> void x54f0_scc_b_ix_071234fc();
 void x54f8_scc_b_aw_071234fc();
 void x54f9_scc_b_al_071234fc();
 void x55d0_scs_b_ai_071234fc();
@@ -1702,7 +1702,7 @@ void x55df_scs_b_pi7_071234fc();
 void x55e0_scs_b_pd_071234fc();
 void x55e7_scs_b_pd7_071234fc();
 void x55e8_scs_b_di_071234fc();
-void x55f0_scs_b_ix_071234fc();
+template <u32 Types> void x55f0_scs_b_ix_071234fc();
 void x55f8_scs_b_aw_071234fc();
 void x55f9_scs_b_al_071234fc();
 void x56d0_sne_b_ai_071234fc();
@@ -1711,7 +1711,7 @@ void x56df_sne_b_pi7_071234fc();
 void x56e0_sne_b_pd_071234fc();
 void x56e7_sne_b_pd7_071234fc();
 void x56e8_sne_b_di_071234fc();
-void x56f0_sne_b_ix_071234fc();
+template <u32 Types> void x56f0_sne_b_ix_071234fc();
 void x56f8_sne_b_aw_071234fc();
 void x56f9_sne_b_al_071234fc();
 void x57d0_seq_b_ai_071234fc();
@@ -1720,7 +1720,7 @@ void x57df_seq_b_pi7_071234fc();
 void x57e0_seq_b_pd_071234fc();
 void x57e7_seq_b_pd7_071234fc();
 void x57e8_seq_b_di_071234fc();
-void x57f0_seq_b_ix_071234fc();
+template <u32 Types> void x57f0_seq_b_ix_071234fc();
 void x57f8_seq_b_aw_071234fc();
 void x57f9_seq_b_al_071234fc();
 void x58d0_svc_b_ai_071234fc();
@@ -1729,7 +1729,7 @@ void x58df_svc_b_pi7_071234fc();
 void x58e0_svc_b_pd_071234fc();
 void x58e7_svc_b_pd7_071234fc();
 void x58e8_svc_b_di_071234fc();
-void x58f0_svc_b_ix_071234fc();
+template <u32 Types> void x58f0_svc_b_ix_071234fc();
 void x58f8_svc_b_aw_071234fc();
 void x58f9_svc_b_al_071234fc();
 void x59d0_svs_b_ai_071234fc();
@@ -1738,7 +1738,7 @@ void x59df_svs_b_pi7_071234fc();
 void x59e0_svs_b_pd_071234fc();
 void x59e7_svs_b_pd7_071234fc();
 void x59e8_svs_b_di_071234fc();
-void x59f0_svs_b_ix_071234fc();
+template <u32 Types> void x59f0_svs_b_ix_071234fc();
 void x59f8_svs_b_aw_071234fc();
 void x59f9_svs_b_al_071234fc();
 void x5ad0_spl_b_ai_071234fc();
@@ -1747,7 +1747,7 @@ void x5adf_spl_b_pi7_071234fc();
 void x5ae0_spl_b_pd_071234fc();
 void x5ae7_spl_b_pd7_071234fc();
 void x5ae8_spl_b_di_071234fc();
-void x5af0_spl_b_ix_071234fc();
+template <u32 Types> void x5af0_spl_b_ix_071234fc();
 void x5af8_spl_b_aw_071234fc();
 void x5af9_spl_b_al_071234fc();
 void x5bd0_smi_b_ai_071234fc();
@@ -1756,7 +1756,7 @@ void x5bdf_smi_b_pi7_071234fc();
 void x5be0_smi_b_pd_071234fc();
 void x5be7_smi_b_pd7_071234fc();
 void x5be8_smi_b_di_071234fc();
-void x5bf0_smi_b_ix_071234fc();
+template <u32 Types> void x5bf0_smi_b_ix_071234fc();
 void x5bf8_smi_b_aw_071234fc();
 void x5bf9_smi_b_al_071234fc();
 void x5cd0_sge_b_ai_071234fc();
@@ -1765,7 +1765,7 @@ void x5cdf_sge_b_pi7_071234fc();
 void x5ce0_sge_b_pd_071234fc();
 void x5ce7_sge_b_pd7_071234fc();
 void x5ce8_sge_b_di_071234fc();
-void x5cf0_sge_b_ix_071234fc();
+template <u32 Types> void x5cf0_sge_b_ix_071234fc();
 void x5cf8_sge_b_aw_071234fc();
 void x5cf9_sge_b_al_071234fc();
 void x5dd0_slt_b_ai_071234fc();
@@ -1774,7 +1774,7 @@ void x5ddf_slt_b_pi7_071234fc();
 void x5de0_slt_b_pd_071234fc();
 void x5de7_slt_b_pd7_071234fc();
 void x5de8_slt_b_di_071234fc();
-void x5df0_slt_b_ix_071234fc();
+template <u32 Types> void x5df0_slt_b_ix_071234fc();
 void x5df8_slt_b_aw_071234fc();
 void x5df9_slt_b_al_071234fc();
 void x5ed0_sgt_b_ai_071234fc();
@@ -1783,7 +1783,7 @@ void x5edf_sgt_b_pi7_071234fc();
 void x5ee0_sgt_b_pd_071234fc();
 void x5ee7_sgt_b_pd7_071234fc();
 void x5ee8_sgt_b_di_071234fc();
-void x5ef0_sgt_b_ix_071234fc();
+template <u32 Types> void x5ef0_sgt_b_ix_071234fc();
 void x5ef8_sgt_b_aw_071234fc();
 void x5ef9_sgt_b_al_071234fc();
 void x5fd0_sle_b_ai_071234fc();
@@ -1792,7 +1792,7 @@ void x5fdf_sle_b_pi7_071234fc();
 void x5fe0_sle_b_pd_071234fc();
 void x5fe7_sle_b_pd7_071234fc();
 void x5fe8_sle_b_di_071234fc();
-void x5ff0_sle_b_ix_071234fc();
+template <u32 Types> void x5ff0_sle_b_ix_071234fc();
 void x5ff8_sle_b_aw_071234fc();
 void x5ff9_sle_b_al_071234fc();
 void x4e72_stop_071234fc();
@@ -1803,35 +1803,35 @@ void x901f_sub_b_pi7_071234fc();
 void x9020_sub_b_pd_071234fc();
 void x9027_sub_b_pd7_071234fc();
 void x9028_sub_b_di_071234fc();
-void x9030_sub_b_ix_071234fc();
+template <u32 Types> void x9030_sub_b_ix_071234fc();
 void x9038_sub_b_aw_071234fc();
 void x9039_sub_b_al_071234fc();
 void x903a_sub_b_pcdi_071234fc();
-void x903b_sub_b_pcix_071234fc();
+template <u32 Types> void x903b_sub_b_pcix_071234fc();
 void x903c_sub_b_i_071234fc();
 void x9040_sub_w_071234fc();
 void x9048_sub_w_071234fc();
-void x9050_sub_w_ai_071234fc();
-void x9058_sub_w_pi_071234fc();
-void x9060_sub_w_pd_071234fc();
-void x9068_sub_w_di_071234fc();
-void x9070_sub_w_ix_071234fc();
-void x9078_sub_w_aw_071234fc();
-void x9079_sub_w_al_071234fc();
+template <u32 Types> void x9050_sub_w_ai_071234fc();
+template <u32 Types> void x9058_sub_w_pi_071234fc();
+template <u32 Types> void x9060_sub_w_pd_071234fc();
+template <u32 Types> void x9068_sub_w_di_071234fc();
+template <u32 Types> void x9070_sub_w_ix_071234fc();
+template <u32 Types> void x9078_sub_w_aw_071234fc();
+template <u32 Types> void x9079_sub_w_al_071234fc();
 void x907a_sub_w_pcdi_071234fc();
-void x907b_sub_w_pcix_071234fc();
+template <u32 Types> void x907b_sub_w_pcix_071234fc();
 void x907c_sub_w_i_071234fc();
 void x9080_sub_l_071234fc();
 void x9088_sub_l_071234fc();
-void x9090_sub_l_ai_071234fc();
-void x9098_sub_l_pi_071234fc();
-void x90a0_sub_l_pd_071234fc();
-void x90a8_sub_l_di_071234fc();
-void x90b0_sub_l_ix_071234fc();
-void x90b8_sub_l_aw_071234fc();
-void x90b9_sub_l_al_071234fc();
+template <u32 Types> void x9090_sub_l_ai_071234fc();
+template <u32 Types> void x9098_sub_l_pi_071234fc();
+template <u32 Types> void x90a0_sub_l_pd_071234fc();
+template <u32 Types> void x90a8_sub_l_di_071234fc();
+template <u32 Types> void x90b0_sub_l_ix_071234fc();
+template <u32 Types> void x90b8_sub_l_aw_071234fc();
+template <u32 Types> void x90b9_sub_l_al_071234fc();
 void x90ba_sub_l_pcdi_071234fc();
-void x90bb_sub_l_pcix_071234fc();
+template <u32 Types> void x90bb_sub_l_pcix_071234fc();
 void x90bc_sub_l_i_071234fc();
 void x9110_sub_b_ai_071234fc();
 void x9118_sub_b_pi_071234fc();
@@ -1839,46 +1839,46 @@ void x911f_sub_b_pi7_071234fc();
 void x9120_sub_b_pd_071234fc();
 void x9127_sub_b_pd7_071234fc();
 void x9128_sub_b_di_071234fc();
-void x9130_sub_b_ix_071234fc();
+template <u32 Types> void x9130_sub_b_ix_071234fc();
 void x9138_sub_b_aw_071234fc();
 void x9139_sub_b_al_071234fc();
-void x9150_sub_w_ai_071234fc();
-void x9158_sub_w_pi_071234fc();
-void x9160_sub_w_pd_071234fc();
-void x9168_sub_w_di_071234fc();
-void x9170_sub_w_ix_071234fc();
-void x9178_sub_w_aw_071234fc();
-void x9179_sub_w_al_071234fc();
-void x9190_sub_l_ai_071234fc();
-void x9198_sub_l_pi_071234fc();
-void x91a0_sub_l_pd_071234fc();
-void x91a8_sub_l_di_071234fc();
-void x91b0_sub_l_ix_071234fc();
-void x91b8_sub_l_aw_071234fc();
-void x91b9_sub_l_al_071234fc();
+template <u32 Types> void x9150_sub_w_ai_071234fc();
+template <u32 Types> void x9158_sub_w_pi_071234fc();
+template <u32 Types> void x9160_sub_w_pd_071234fc();
+template <u32 Types> void x9168_sub_w_di_071234fc();
+template <u32 Types> void x9170_sub_w_ix_071234fc();
+template <u32 Types> void x9178_sub_w_aw_071234fc();
+template <u32 Types> void x9179_sub_w_al_071234fc();
+template <u32 Types> void x9190_sub_l_ai_071234fc();
+template <u32 Types> void x9198_sub_l_pi_071234fc();
+template <u32 Types> void x91a0_sub_l_pd_071234fc();
+template <u32 Types> void x91a8_sub_l_di_071234fc();
+template <u32 Types> void x91b0_sub_l_ix_071234fc();
+template <u32 Types> void x91b8_sub_l_aw_071234fc();
+template <u32 Types> void x91b9_sub_l_al_071234fc();
 void x90c0_suba_w_071234fc();
 void x90c8_suba_w_071234fc();
-void x90d0_suba_w_ai_071234fc();
-void x90d8_suba_w_pi_071234fc();
-void x90e0_suba_w_pd_071234fc();
-void x90e8_suba_w_di_071234fc();
-void x90f0_suba_w_ix_071234fc();
-void x90f8_suba_w_aw_071234fc();
-void x90f9_suba_w_al_071234fc();
+template <u32 Types> void x90d0_suba_w_ai_071234fc();
+template <u32 Types> void x90d8_suba_w_pi_071234fc();
+template <u32 Types> void x90e0_suba_w_pd_071234fc();
+template <u32 Types> void x90e8_suba_w_di_071234fc();
+template <u32 Types> void x90f0_suba_w_ix_071234fc();
+template <u32 Types> void x90f8_suba_w_aw_071234fc();
+template <u32 Types> void x90f9_suba_w_al_071234fc();
 void x90fa_suba_w_pcdi_071234fc();
-void x90fb_suba_w_pcix_071234fc();
+template <u32 Types> void x90fb_suba_w_pcix_071234fc();
 void x90fc_suba_w_i_071234fc();
 void x91c0_suba_l_071234fc();
 void x91c8_suba_l_071234fc();
-void x91d0_suba_l_ai_071234fc();
-void x91d8_suba_l_pi_071234fc();
-void x91e0_suba_l_pd_071234fc();
-void x91e8_suba_l_di_071234fc();
-void x91f0_suba_l_ix_071234fc();
-void x91f8_suba_l_aw_071234fc();
-void x91f9_suba_l_al_071234fc();
+template <u32 Types> void x91d0_suba_l_ai_071234fc();
+template <u32 Types> void x91d8_suba_l_pi_071234fc();
+template <u32 Types> void x91e0_suba_l_pd_071234fc();
+template <u32 Types> void x91e8_suba_l_di_071234fc();
+template <u32 Types> void x91f0_suba_l_ix_071234fc();
+template <u32 Types> void x91f8_suba_l_aw_071234fc();
+template <u32 Types> void x91f9_suba_l_al_071234fc();
 void x91fa_suba_l_pcdi_071234fc();
-void x91fb_suba_l_pcix_071234fc();
+template <u32 Types> void x91fb_suba_l_pcix_071234fc();
 void x91fc_suba_l_i_071234fc();
 void x0400_subi_b_071234fc();
 void x0410_subi_b_ai_071234fc();
@@ -1887,25 +1887,25 @@ void x041f_subi_b_pi7_071234fc();
 void x0420_subi_b_pd_071234fc();
 void x0427_subi_b_pd7_071234fc();
 void x0428_subi_b_di_071234fc();
-void x0430_subi_b_ix_071234fc();
+template <u32 Types> void x0430_subi_b_ix_071234fc();
 void x0438_subi_b_aw_071234fc();
 void x0439_subi_b_al_071234fc();
 void x0440_subi_w_071234fc();
-void x0450_subi_w_ai_071234fc();
-void x0458_subi_w_pi_071234fc();
-void x0460_subi_w_pd_071234fc();
-void x0468_subi_w_di_071234fc();
-void x0470_subi_w_ix_071234fc();
-void x0478_subi_w_aw_071234fc();
-void x0479_subi_w_al_071234fc();
+template <u32 Types> void x0450_subi_w_ai_071234fc();
+template <u32 Types> void x0458_subi_w_pi_071234fc();
+template <u32 Types> void x0460_subi_w_pd_071234fc();
+template <u32 Types> void x0468_subi_w_di_071234fc();
+template <u32 Types> void x0470_subi_w_ix_071234fc();
+template <u32 Types> void x0478_subi_w_aw_071234fc();
+template <u32 Types> void x0479_subi_w_al_071234fc();
 void x0480_subi_l_071234fc();
-void x0490_subi_l_ai_071234fc();
-void x0498_subi_l_pi_071234fc();
-void x04a0_subi_l_pd_071234fc();
-void x04a8_subi_l_di_071234fc();
-void x04b0_subi_l_ix_071234fc();
-void x04b8_subi_l_aw_071234fc();
-void x04b9_subi_l_al_071234fc();
+template <u32 Types> void x0490_subi_l_ai_071234fc();
+template <u32 Types> void x0498_subi_l_pi_071234fc();
+template <u32 Types> void x04a0_subi_l_pd_071234fc();
+template <u32 Types> void x04a8_subi_l_di_071234fc();
+template <u32 Types> void x04b0_subi_l_ix_071234fc();
+template <u32 Types> void x04b8_subi_l_aw_071234fc();
+template <u32 Types> void x04b9_subi_l_al_071234fc();
 void x5100_subq_b_071234fc();
 void x5110_subq_b_ai_071234fc();
 void x5118_subq_b_pi_071234fc();
@@ -1913,27 +1913,27 @@ void x511f_subq_b_pi7_071234fc();
 void x5120_subq_b_pd_071234fc();
 void x5127_subq_b_pd7_071234fc();
 void x5128_subq_b_di_071234fc();
-void x5130_subq_b_ix_071234fc();
+template <u32 Types> void x5130_subq_b_ix_071234fc();
 void x5138_subq_b_aw_071234fc();
 void x5139_subq_b_al_071234fc();
 void x5140_subq_w_071234fc();
 void x5148_subq_w_071234fc();
-void x5150_subq_w_ai_071234fc();
-void x5158_subq_w_pi_071234fc();
-void x5160_subq_w_pd_071234fc();
-void x5168_subq_w_di_071234fc();
-void x5170_subq_w_ix_071234fc();
-void x5178_subq_w_aw_071234fc();
-void x5179_subq_w_al_071234fc();
+template <u32 Types> void x5150_subq_w_ai_071234fc();
+template <u32 Types> void x5158_subq_w_pi_071234fc();
+template <u32 Types> void x5160_subq_w_pd_071234fc();
+template <u32 Types> void x5168_subq_w_di_071234fc();
+template <u32 Types> void x5170_subq_w_ix_071234fc();
+template <u32 Types> void x5178_subq_w_aw_071234fc();
+template <u32 Types> void x5179_subq_w_al_071234fc();
 void x5180_subq_l_071234fc();
 void x5188_subq_l_071234fc();
-void x5190_subq_l_ai_071234fc();
-void x5198_subq_l_pi_071234fc();
-void x51a0_subq_l_pd_071234fc();
-void x51a8_subq_l_di_071234fc();
-void x51b0_subq_l_ix_071234fc();
-void x51b8_subq_l_aw_071234fc();
-void x51b9_subq_l_al_071234fc();
+template <u32 Types> void x5190_subq_l_ai_071234fc();
+template <u32 Types> void x5198_subq_l_pi_071234fc();
+template <u32 Types> void x51a0_subq_l_pd_071234fc();
+template <u32 Types> void x51a8_subq_l_di_071234fc();
+template <u32 Types> void x51b0_subq_l_ix_071234fc();
+template <u32 Types> void x51b8_subq_l_aw_071234fc();
+template <u32 Types> void x51b9_subq_l_al_071234fc();
 void x9100_subx_b_071234fc();
 void x9140_subx_w_071234fc();
 void x9180_subx_l_071234fc();
@@ -1941,19 +1941,19 @@ void x9f08_subx_b_071234fc();
 void x910f_subx_b_071234fc();
 void x9f0f_subx_b_071234fc();
 void x9108_subx_b_071234fc();
-void x9148_subx_w_071234fc();
-void x9188_subx_l_071234fc();
+template <u32 Types> void x9148_subx_w_071234fc();
+template <u32 Types> void x9188_subx_l_071234fc();
 void x4840_swap_l_071234fc();
 void x4ac0_tas_b_071234fc();
-void x4ad0_tas_b_ai_071234fc();
-void x4ad8_tas_b_pi_071234fc();
-void x4adf_tas_b_pi7_071234fc();
-void x4ae0_tas_b_pd_071234fc();
-void x4ae7_tas_b_pd7_071234fc();
-void x4ae8_tas_b_di_071234fc();
-void x4af0_tas_b_ix_071234fc();
-void x4af8_tas_b_aw_071234fc();
-void x4af9_tas_b_al_071234fc();
+template <u32 Types> void x4ad0_tas_b_ai_071234fc();
+template <u32 Types> void x4ad8_tas_b_pi_071234fc();
+template <u32 Types> void x4adf_tas_b_pi7_071234fc();
+template <u32 Types> void x4ae0_tas_b_pd_071234fc();
+template <u32 Types> void x4ae7_tas_b_pd7_071234fc();
+template <u32 Types> void x4ae8_tas_b_di_071234fc();
+template <u32 Types> void x4af0_tas_b_ix_071234fc();
+template <u32 Types> void x4af8_tas_b_aw_071234fc();
+template <u32 Types> void x4af9_tas_b_al_071234fc();
 void x4e40_trap_071234fc();
 void x50fc_trapt_234fc();
 void x50fa_trapt_w_234fc();
@@ -2011,38 +2011,38 @@ void x4a1f_tst_b_pi7_071234fc();
 void x4a20_tst_b_pd_071234fc();
 void x4a27_tst_b_pd7_071234fc();
 void x4a28_tst_b_di_071234fc();
-void x4a30_tst_b_ix_071234fc();
+template <u32 Types> void x4a30_tst_b_ix_071234fc();
 void x4a38_tst_b_aw_071234fc();
 void x4a39_tst_b_al_071234fc();
 void x4a3a_tst_b_234fc();
-void x4a3b_tst_b_234fc();
+template <u32 Types> void x4a3b_tst_b_234fc();
 void x4a3c_tst_b_234fc();
 void x4a40_tst_w_071234fc();
 void x4a48_tst_w_234fc();
-void x4a50_tst_w_ai_071234fc();
-void x4a58_tst_w_pi_071234fc();
-void x4a60_tst_w_pd_071234fc();
-void x4a68_tst_w_di_071234fc();
-void x4a70_tst_w_ix_071234fc();
-void x4a78_tst_w_aw_071234fc();
-void x4a79_tst_w_al_071234fc();
+template <u32 Types> void x4a50_tst_w_ai_071234fc();
+template <u32 Types> void x4a58_tst_w_pi_071234fc();
+template <u32 Types> void x4a60_tst_w_pd_071234fc();
+template <u32 Types> void x4a68_tst_w_di_071234fc();
+template <u32 Types> void x4a70_tst_w_ix_071234fc();
+template <u32 Types> void x4a78_tst_w_aw_071234fc();
+template <u32 Types> void x4a79_tst_w_al_071234fc();
 void x4a7a_tst_w_234fc();
-void x4a7b_tst_w_234fc();
+template <u32 Types> void x4a7b_tst_w_234fc();
 void x4a7c_tst_w_234fc();
 void x4a80_tst_l_071234fc();
 void x4a88_tst_l_234fc();
-void x4a90_tst_l_ai_071234fc();
-void x4a98_tst_l_pi_071234fc();
-void x4aa0_tst_l_pd_071234fc();
-void x4aa8_tst_l_di_071234fc();
-void x4ab0_tst_l_ix_071234fc();
-void x4ab8_tst_l_aw_071234fc();
-void x4ab9_tst_l_al_071234fc();
+template <u32 Types> void x4a90_tst_l_ai_071234fc();
+template <u32 Types> void x4a98_tst_l_pi_071234fc();
+template <u32 Types> void x4aa0_tst_l_pd_071234fc();
+template <u32 Types> void x4aa8_tst_l_di_071234fc();
+template <u32 Types> void x4ab0_tst_l_ix_071234fc();
+template <u32 Types> void x4ab8_tst_l_aw_071234fc();
+template <u32 Types> void x4ab9_tst_l_al_071234fc();
 void x4aba_tst_l_234fc();
-void x4abb_tst_l_234fc();
+template <u32 Types> void x4abb_tst_l_234fc();
 void x4abc_tst_l_234fc();
-void x4e5f_unlk_l_071234fc();
-void x4e58_unlk_l_071234fc();
+template <u32 Types> void x4e5f_unlk_l_071234fc();
+template <u32 Types> void x4e58_unlk_l_071234fc();
 void x8180_unpk_w_234fc();
 void x8f88_unpk_w_234fc();
 void x818f_unpk_w_234fc();
@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
 #include "mips3.h"
 #include "mips3com.h"
 #include "mips3dsm.h"
@@ -386,6 +387,10 @@ void r5900le_device::check_irqs()
 void mips3_device::device_start()
 {
 	m_isdrc = allow_drc();
+	m_drc_cold_blocks = m_isdrc ? std::clamp(machine().options().drc_cold_blocks(), 0, 255) : 0;
+	m_drc_validate = m_isdrc && machine().options().drc_validate() && !(machine().debug_flags & DEBUG_FLAG_ENABLED);
+	m_validate_running = false;
+	m_validate_pending = false;
 
 	/* allocate the implementation-specific state from the full cache */
 	m_core = (internal_mips3_state *)m_drc_cache.alloc_near(sizeof(internal_mips3_state));
@@ -431,6 +436,27 @@ void mips3_device::device_start()
 	/* set up the endianness */
 	m_program->accessors(m_memory);
 
+	/* validation replays go through accessors that only touch RAM and ROM */
+	if (m_drc_validate)
+	{
+		m_validate_saved = std::make_unique<internal_mips3_state>();
+		m_validate_expected = std::make_unique<internal_mips3_state>();
+		m_validate_memory.read_byte = &validate_read<u8>;
+		m_validate_memory.read_word = &validate_read<u16>;
+		m_validate_memory.read_word_masked = &validate_read_masked<u16>;
+		m_validate_memory.read_dword = &validate_read<u32>;
+		m_validate_memory.read_dword_masked = &validate_read_masked<u32>;
+		m_validate_memory.read_qword = &validate_read<u64>;
+		m_validate_memory.read_qword_masked = &validate_read_masked<u64>;
+		m_validate_memory.write_byte = &validate_write<u8>;
+		m_validate_memory.write_word = &validate_write<u16>;
+		m_validate_memory.write_word_masked = &validate_write_masked<u16>;
+		m_validate_memory.write_dword = &validate_write<u32>;
+		m_validate_memory.write_dword_masked = &validate_write_masked<u32>;
+		m_validate_memory.write_qword = &validate_write<u64>;
+		m_validate_memory.write_qword_masked = &validate_write_masked<u64>;
+	}
+
 	/* allocate a timer for the compare interrupt */
 	m_compare_int_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(mips3_device::compare_int_callback), this));
 
@@ -480,6 +506,7 @@ void mips3_device::device_start()
 	m_drcuml->symbol_add(&m_core->arg1, sizeof(m_core->arg1), "arg1");
 	m_drcuml->symbol_add(&m_core->numcycles, sizeof(m_core->numcycles), "numcycles");
 	m_drcuml->symbol_add(&m_fpmode, sizeof(m_fpmode), "fpmode");
+	m_drcuml->symbol_add(m_core, sizeof(*m_core), "core");
 
 	/* initialize the front-end helper */
 	m_drcfe = std::make_unique<mips3_frontend>(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE);
@@ -1173,6 +1200,85 @@ std::unique_ptr<util::disasm_interface> r5900le_device::create_disassembler()
 
 
 
+/***************************************************************************
+    VALIDATION REPLAY
+***************************************************************************/
+
+/*-------------------------------------------------
+    validate_abandon - give up on a validation
+    replay if one is running; used for anything
+    the replay mustn't do or can't reproduce
+-------------------------------------------------*/
+
+void mips3_device::validate_abandon()
+{
+	if (m_validate_running)
+		throw validate_abort();
+}
+
+
+/*-------------------------------------------------
+    validate_read/validate_write - accessors for
+    validation replays: anything other than RAM
+    or ROM abandons the replay, and RAM writes are
+    recorded so they can be undone afterwards
+-------------------------------------------------*/
+
+template <typename T>
+T mips3_device::validate_read(address_space &space, offs_t address)
+{
+	return validate_read_masked<T>(space, address, ~T(0));
+}
+
+template <typename T>
+T mips3_device::validate_read_masked(address_space &space, offs_t address, T mask)
+{
+	if (space.get_read_ptr(address & ~offs_t(sizeof(T) - 1)) == nullptr)
+		throw validate_abort();
+
+	data_accessors const &memory = downcast<mips3_device &>(space.device()).m_validate_memory;
+	if constexpr (sizeof(T) == 1)
+		return (*memory.read_byte)(space, address);
+	else if constexpr (sizeof(T) == 2)
+		return (*memory.read_word_masked)(space, address, mask);
+	else if constexpr (sizeof(T) == 4)
+		return (*memory.read_dword_masked)(space, address, mask);
+	else
+		return (*memory.read_qword_masked)(space, address, mask);
+}
+
+template <typename T>
+void mips3_device::validate_write(address_space &space, offs_t address, T data)
+{
+	validate_write_masked<T>(space, address, data, ~T(0));
+}
+
+template <typename T>
+void mips3_device::validate_write_masked(address_space &space, offs_t address, T data, T mask)
+{
+	auto *const ptr = reinterpret_cast<uint8_t *>(space.get_write_ptr(address & ~offs_t(sizeof(T) - 1)));
+	if (ptr == nullptr)
+		throw validate_abort();
+
+	mips3_device &cpu = downcast<mips3_device &>(space.device());
+	validate_undo &undo = cpu.m_validate_undo.emplace_back();
+	undo.ptr = ptr;
+	undo.size = sizeof(T);
+	memcpy(undo.data, ptr, sizeof(T));
+
+	data_accessors const &memory = cpu.m_validate_memory;
+	if constexpr (sizeof(T) == 1)
+		(*memory.write_byte)(space, address, data);
+	else if constexpr (sizeof(T) == 2)
+		(*memory.write_word_masked)(space, address, data, mask);
+	else if constexpr (sizeof(T) == 4)
+		(*memory.write_dword_masked)(space, address, data, mask);
+	else
+		(*memory.write_qword_masked)(space, address, data, mask);
+}
+
+
+
 /***************************************************************************
     TLB HANDLING
 ***************************************************************************/
@@ -1684,6 +1790,10 @@ inline bool r5900le_device::RQUAD(offs_t address, uint64_t *result_hi, uint64_t
 
 uint64_t mips3_device::get_cop0_reg(int idx)
 {
+	/* these depend on timing, which the recompiler doesn't reproduce exactly */
+	if (idx == COP0_Count || idx == COP0_Random)
+		validate_abandon();
+
 	if (idx == COP0_Count)
 	{
 		/* it doesn't really take 250 cycles to read this register, but it helps speed */
@@ -5065,10 +5175,16 @@ void mips3_device::execute_run()
 			/* run as much as we can */
 			execute_result = m_drcuml->execute(*m_entry);
 
-			/* if we need to recompile, do it */
+			/* anything can happen before translated code runs again, so don't compare across this */
+			m_validate_pending = false;
+
+			/* if we need to recompile, do it unless the code is still cold */
 			if (execute_result == EXECUTE_MISSING_CODE)
 			{
-				code_compile_block(m_core->mode, m_core->pc);
+				if (!code_interpret_cold(m_core->mode, m_core->pc))
+					code_compile_block(m_core->mode, m_core->pc);
+				else if (m_core->icount <= 0)
+					execute_result = EXECUTE_OUT_OF_CYCLES;
 			}
 			else if (execute_result == EXECUTE_UNMAPPED_CODE)
 			{
@@ -5095,6 +5211,21 @@ void mips3_device::execute_run()
 	check_irqs();
 
 	/* core execution loop */
+	execute_interpreter(0);
+
+	m_core->icount -= m_interrupt_cycles;
+	m_interrupt_cycles = 0;
+}
+
+
+/*-------------------------------------------------
+    execute_interpreter - interpret until out of
+    cycles, or if maxinst is non-zero, until the
+    end of the current block
+-------------------------------------------------*/
+
+void mips3_device::execute_interpreter(int maxinst)
+{
 	do
 	{
 		uint32_t op;
@@ -5296,6 +5427,10 @@ void mips3_device::execute_run()
 		bool had_delay = m_delayslot;
 #endif
 
+		/* a delay slot ends a block */
+		if (maxinst != 0 && (m_delayslot || --maxinst == 0))
+			maxinst = -1;
+
 		/* Clear this flag once instruction execution is finished, will interfere with interrupt exceptions otherwise */
 		m_delayslot = false;
 		m_core->icount--;
@@ -5316,10 +5451,7 @@ void mips3_device::execute_run()
 			elf_loaded = true;
 		}
 #endif
-	} while (m_core->icount > 0 || m_nextpc != ~0);
-
-	m_core->icount -= m_interrupt_cycles;
-	m_interrupt_cycles = 0;
+	} while ((m_core->icount > 0 && maxinst >= 0) || m_nextpc != ~0);
 }
 
 
@@ -20,6 +20,8 @@ MIPS III/IV emulator.
 #include "cpu/drcuml.h"
 #include "ps2vu.h"
 
+#include <unordered_map>
+
 #define ENABLE_O2_DPRINTF       (0)
 
 DECLARE_DEVICE_TYPE(R4000BE, r4000be_device)
@@ -516,6 +518,36 @@ protected:
 	}               m_hotspot[MIPS3_MAX_HOTSPOTS];
 	bool            m_isdrc;
 
+	/* cold code */
+	int             m_drc_cold_blocks;          /* times to interpret a block before translating it */
+	std::unordered_map<uint64_t, int> m_cold_misses; /* times each untranslated block has been reached */
+
+	/* lockstep validation against the interpreter */
+	struct validate_undo
+	{
+		uint8_t *       ptr;                        /* RAM written by the interpreter */
+		uint8_t         size;                       /* number of bytes written */
+		uint8_t         data[8];                    /* previous contents */
+	};
+	struct validate_abort { };                      /* thrown to give up on a replay */
+
+	bool            m_drc_validate;             /* check each translated block against the interpreter */
+	bool            m_validate_running;         /* the interpreter is replaying a translated block */
+	bool            m_validate_pending;         /* m_validate_expected holds the state the next block should see */
+	uint32_t        m_validate_block;           /* start of the block m_validate_expected came from */
+	std::unique_ptr<internal_mips3_state> m_validate_saved;     /* state before the replay */
+	std::unique_ptr<internal_mips3_state> m_validate_expected;  /* state the replay finished with */
+	data_accessors  m_validate_memory;          /* accessors swapped into m_memory for the replay */
+	std::vector<validate_undo> m_validate_undo; /* RAM writes to undo after the replay */
+
+	void execute_interpreter(int maxinst);
+	bool code_interpret_cold(uint8_t mode, offs_t pc);
+	void validate_abandon();
+	bool validate_compare();
+	template <typename T> static T validate_read(address_space &space, offs_t address);
+	template <typename T> static T validate_read_masked(address_space &space, offs_t address, T mask);
+	template <typename T> static void validate_write(address_space &space, offs_t address, T data);
+	template <typename T> static void validate_write_masked(address_space &space, offs_t address, T data, T mask);
 	void generate_exception(int exception, int backup);
 	void generate_tlb_exception(int exception, offs_t address);
 	virtual void check_irqs();
@@ -602,6 +634,7 @@ public:
 	void func_printf_probe();
 	void func_debug_break();
 	void func_unimplemented();
+	void func_validate_block();
 private:
 	/* internal compiler state */
 	struct compiler_state
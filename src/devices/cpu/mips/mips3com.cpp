@@ -70,6 +70,9 @@ void mips3_device::execute_set_input(int inputnum, int state)
 
 void mips3_device::mips3com_update_cycle_counting()
 {
+	/* a validation replay must not move the compare timer */
+	validate_abandon();
+
 	/* modify the timer to go off */
 	if (m_core->compare_armed)
 	{
@@ -96,6 +99,9 @@ void mips3_device::mips3com_asid_changed()
 {
 	int tlbindex;
 
+	/* a validation replay must not touch the TLB */
+	validate_abandon();
+
 	/* iterate over all non-global TLB entries and remap them */
 	for (tlbindex = 0; tlbindex < m_tlbentries; tlbindex++)
 		if (!tlb_entry_is_global(&m_tlb[tlbindex]))
@@ -131,6 +137,8 @@ void mips3_device::mips3com_tlbr()
 
 void mips3_device::mips3com_tlbwi()
 {
+	validate_abandon();
+
 	/* use the common handler and write based off the COP0 Index register */
 	tlb_write_common(m_core->cpr[0][COP0_Index] & 0x3f);
 }
@@ -154,6 +162,8 @@ uint32_t mips3_device::generate_tlb_index()
 
 void mips3_device::mips3com_tlbwr()
 {
+	validate_abandon();
+
 	uint32_t wired = m_core->cpr[0][COP0_Wired] & 0x3f;
 	uint32_t unwired = m_tlbentries - wired;
 	uint32_t tlbindex = m_tlbentries - 1;
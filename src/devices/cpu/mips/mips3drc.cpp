@@ -74,6 +74,7 @@ static void cfunc_printf_exception(void *param);
 static void cfunc_get_cycles(void *param);
 static void cfunc_printf_probe(void *param);
 static void cfunc_debug_break(void *param);
+static void cfunc_validate_block(void *param);
 
 
 /***************************************************************************
@@ -221,8 +222,12 @@ void mips3_device::code_flush_cache()
 {
 	int mode;
 
+	/* translations depend on the options, fast RAM setup and this core's build as well as the code */
+	m_drcuml->set_persistent_config(util::string_format("%X|%u|%u|%s %s", m_drcoptions, m_fastram_select, m_hotspot_select, __DATE__, __TIME__));
+
 	/* empty the transient cache contents */
 	m_drcuml->reset();
+	m_cold_misses.clear();
 
 	try
 	{
@@ -274,6 +279,23 @@ void mips3_device::code_flush_cache()
 }
 
 
+/*-------------------------------------------------
+    code_interpret_cold - interpret one block at
+    the specified pc instead of compiling it, if
+    it has not been reached often enough yet
+-------------------------------------------------*/
+
+bool mips3_device::code_interpret_cold(uint8_t mode, offs_t pc)
+{
+	/* code that only ever runs a few times is not worth translating */
+	if (m_drc_cold_blocks == 0 || ++m_cold_misses[(uint64_t(mode) << 32) | pc] > m_drc_cold_blocks)
+		return false;
+
+	execute_interpreter(COMPILE_MAX_SEQUENCE);
+	return true;
+}
+
+
 /*-------------------------------------------------
     code_compile_block - compile a block of the
     given mode at the specified pc
@@ -288,6 +310,13 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 
 	g_profiler.start(PROFILER_DRC_COMPILE);
 
+	/* reuse a translation saved by an earlier run if there is one; those aren't set up for validation */
+	if (!m_drc_validate && m_drcuml->restore_block(mode, pc))
+	{
+		g_profiler.stop();
+		return;
+	}
+
 	/* get a description of this sequence */
 	desclist = m_drcfe->describe_code(pc);
 	if (m_drcuml->logging() || m_drcuml->logging_native())
@@ -349,6 +378,15 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
 				}
 
+				/* check the previous block and replay this one in the interpreter */
+				if (m_drc_validate)
+				{
+					UML_MOV(block, mem(&m_core->pc), seqhead->pc);                          // mov     [pc],seqhead->pc
+					UML_MOV(block, mem(&m_core->arg0), seqlast->pc + (seqlast->skipslots + 1) * 4);
+																							// mov     [arg0],<end of sequence>
+					UML_CALLC(block, cfunc_validate_block, this);                           // callc   cfunc_validate_block
+				}
+
 				/* iterate over instructions in the sequence and compile them */
 				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
 				{
@@ -561,6 +599,138 @@ static void cfunc_unimplemented(void *param)
 }
 
 
+/*-------------------------------------------------
+    cfunc_validate_block - check the state left
+    by the previous translated block against the
+    interpreter's replay of it, then replay the
+    block that is about to run
+-------------------------------------------------*/
+
+void mips3_device::func_validate_block()
+{
+	uint32_t const startpc = m_core->pc;
+	uint32_t const endpc = m_core->arg0;
+
+	/* report the first block that disagrees, then stop checking */
+	if (m_validate_pending && !validate_compare())
+		m_drc_validate = false;
+	m_validate_pending = false;
+	if (!m_drc_validate)
+		return;
+
+	/* save everything the interpreter can change */
+	*m_validate_saved = *m_core;
+	uint32_t const ppc = m_ppc;
+	uint32_t const nextpc = m_nextpc;
+	bool const delayslot = m_delayslot;
+	uint32_t const ll_value = m_ll_value;
+	uint64_t const lld_value = m_lld_value;
+	int const interrupt_cycles = m_interrupt_cycles;
+	uint32_t const fastram_select = m_fastram_select;
+
+	/* replay until control leaves the block, which is where the translated code will call back */
+	bool completed = false;
+	m_validate_running = true;
+	m_fastram_select = 0;
+	std::swap(m_memory, m_validate_memory);
+	try
+	{
+		for (int count = 0; (count < COMPILE_MAX_SEQUENCE * 2) && !completed; count++)
+		{
+			execute_interpreter(1);
+			completed = (m_core->pc <= startpc) || (m_core->pc >= endpc);
+		}
+	}
+	catch (validate_abort const &)
+	{
+		completed = false;
+	}
+	std::swap(m_memory, m_validate_memory);
+	m_fastram_select = fastram_select;
+	m_validate_running = false;
+
+	/* keep the result and put everything back */
+	if (completed)
+	{
+		*m_validate_expected = *m_core;
+		m_validate_block = startpc;
+		m_validate_pending = true;
+	}
+	for (auto undo = m_validate_undo.rbegin(); undo != m_validate_undo.rend(); ++undo)
+		memcpy(undo->ptr, undo->data, undo->size);
+	m_validate_undo.clear();
+	*m_core = *m_validate_saved;
+	m_ppc = ppc;
+	m_nextpc = nextpc;
+	m_delayslot = delayslot;
+	m_ll_value = ll_value;
+	m_lld_value = lld_value;
+	m_interrupt_cycles = interrupt_cycles;
+}
+
+static void cfunc_validate_block(void *param)
+{
+	((mips3_device *)param)->func_validate_block();
+}
+
+
+/*-------------------------------------------------
+    validate_compare - compare the state at the
+    start of a block with the replay of the
+    previous one, and report any differences
+-------------------------------------------------*/
+
+bool mips3_device::validate_compare()
+{
+	internal_mips3_state const &drc = *m_core;
+	internal_mips3_state const &interp = *m_validate_expected;
+
+	/* the recompiled code takes interrupts between blocks, which the replay never does */
+	if (drc.pc != interp.pc && (drc.cpr[0][COP0_Status] & SR_EXL) && !(interp.cpr[0][COP0_Status] & SR_EXL))
+		return true;
+
+	std::vector<std::string> diffs;
+	auto const check = [&diffs] (std::string const &name, uint64_t drcval, uint64_t interpval)
+	{
+		if (drcval != interpval)
+			diffs.emplace_back(util::string_format("  %-8s recompiler %016X, interpreter %016X\n", name, drcval, interpval));
+	};
+
+	check("pc", drc.pc, interp.pc);
+	check("mode", drc.mode, interp.mode);
+	for (int regnum = 1; regnum < 32; regnum++)
+		check(util::string_format("r%d", regnum), drc.r[regnum], interp.r[regnum]);
+	check("lo", drc.r[REG_LO], interp.r[REG_LO]);
+	check("hi", drc.r[REG_HI], interp.r[REG_HI]);
+	for (int regnum = 0; regnum < 35; regnum++)
+		check(util::string_format("rh%d", regnum), drc.rh[regnum], interp.rh[regnum]);
+
+	/* Count and Random follow the cycle counter, and external interrupts can arrive at any time */
+	for (int regnum = 0; regnum < 32; regnum++)
+	{
+		uint64_t const mask = (regnum == COP0_Cause) ? ~uint64_t(0xfc00) : ~uint64_t(0);
+		if (regnum != COP0_Count && regnum != COP0_Random)
+			check(util::string_format("cop0r%d", regnum), drc.cpr[0][regnum] & mask, interp.cpr[0][regnum] & mask);
+	}
+	for (int regnum = 0; regnum < 32; regnum++)
+	{
+		check(util::string_format("f%d", regnum), drc.cpr[1][regnum], interp.cpr[1][regnum]);
+		check(util::string_format("fcr%d", regnum), drc.ccr[1][regnum], interp.ccr[1][regnum]);
+		check(util::string_format("cop2r%d", regnum), drc.cpr[2][regnum], interp.cpr[2][regnum]);
+		check(util::string_format("cop2c%d", regnum), drc.ccr[2][regnum], interp.ccr[2][regnum]);
+	}
+	check("llbit", drc.llbit, interp.llbit);
+
+	if (diffs.empty())
+		return true;
+
+	osd_printf_error("%s: translated block at %08X does not match the interpreter:\n", tag(), m_validate_block);
+	for (std::string const &line : diffs)
+		osd_printf_error("%s", line);
+	return false;
+}
+
+
 /***************************************************************************
     STATIC CODEGEN
 ***************************************************************************/
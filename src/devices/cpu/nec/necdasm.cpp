@@ -1761,3 +1761,8 @@ u32 nec_disassembler::opcode_alignment() const
 	return 1;
 }
 
+u64 nec_disassembler::decode_mode() const
+{
+	return m_config->get_mode();
+}
+
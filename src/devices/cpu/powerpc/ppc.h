@@ -209,6 +209,7 @@ public:
 	virtual ~ppc_device() override;
 
 	void set_cache_dirty() { m_cache_dirty = true; }
+	void invalidate_code(offs_t start, offs_t length);
 	void set_bus_frequency(uint32_t bus_frequency) { c_bus_frequency = bus_frequency; }
 	void set_bus_frequency(const XTAL &xtal) { set_bus_frequency(xtal.value()); }
 
@@ -648,6 +649,7 @@ protected:
 	uint32_t compute_spr(uint32_t spr);
 	void code_flush_cache();
 	void code_compile_block(uint8_t mode, offs_t pc);
+	void code_track_block(uint8_t mode, const opcode_desc *desclist);
 	void static_generate_entry_point();
 	void static_generate_nocode_handler();
 	void static_generate_out_of_cycles();
@@ -307,6 +307,9 @@ void ppc_device::ppcdrc_add_hotspot(offs_t pc, uint32_t opcode, uint32_t cycles)
 
 void ppc_device::code_flush_cache()
 {
+	/* translations depend on the options, fast RAM setup and this core's build as well as the code */
+	m_drcuml->set_persistent_config(util::string_format("%X|%u|%u|%s %s", m_drcoptions, m_fastram_select, m_hotspot_select, __DATE__, __TIME__));
+
 	/* empty the transient cache contents */
 	m_drcuml->reset();
 
@@ -385,6 +388,14 @@ void ppc_device::code_compile_block(uint8_t mode, offs_t pc)
 
 	g_profiler.start(PROFILER_DRC_COMPILE);
 
+	/* reuse a translation saved by an earlier run if there is one */
+	if (m_drcuml->restore_block(mode, pc))
+	{
+		code_track_block(mode, m_drcfe->describe_code(pc));
+		g_profiler.stop();
+		return;
+	}
+
 	/* get a description of this sequence */
 	desclist = m_drcfe->describe_code(pc);
 	if (m_drcuml->logging() || m_drcuml->logging_native())
@@ -467,6 +478,7 @@ void ppc_device::code_compile_block(uint8_t mode, offs_t pc)
 
 			/* end the sequence */
 			block.end();
+			code_track_block(mode, desclist);
 			g_profiler.stop();
 			succeeded = true;
 		}
@@ -480,6 +492,51 @@ void ppc_device::code_compile_block(uint8_t mode, offs_t pc)
 
 
 
+/*-------------------------------------------------
+    code_track_block - remember the physical
+    memory a block was built from, so a write
+    there only drops that block
+-------------------------------------------------*/
+
+void ppc_device::code_track_block(uint8_t mode, const opcode_desc *desclist)
+{
+	/* collect contiguous runs of physical addresses; pages may be mapped anywhere */
+	std::vector<std::pair<offs_t, offs_t> > runs;
+	for (const opcode_desc *desc = desclist; desc != nullptr; desc = desc->next())
+	{
+		if (!runs.empty() && desc->physpc == runs.back().second + 1)
+			runs.back().second = desc->physpc + desc->length - 1;
+		else
+			runs.emplace_back(desc->physpc, desc->physpc + desc->length - 1);
+	}
+
+	/* every sequence head may have a hash entry pointing into the block */
+	bool seqstart = true;
+	for (const opcode_desc *desc = desclist; desc != nullptr; desc = desc->next())
+	{
+		if (seqstart)
+			for (auto const &run : runs)
+				m_drcuml->track_code(mode, desc->pc, run.first, run.second);
+		seqstart = (desc->flags & OPFLAG_END_SEQUENCE) != 0;
+	}
+}
+
+
+/*-------------------------------------------------
+    invalidate_code - drop any translated code
+    built from a range of physical memory, for
+    use when it is overwritten behind the CPU's
+    back
+-------------------------------------------------*/
+
+void ppc_device::invalidate_code(offs_t start, offs_t length)
+{
+	if (length != 0 && !m_cache_dirty)
+		m_drcuml->invalidate_code(start, start + length - 1);
+}
+
+
+
 /***************************************************************************
     C FUNCTION CALLBACKS
 ***************************************************************************/
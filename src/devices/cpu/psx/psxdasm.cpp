@@ -180,6 +180,12 @@ u32 psxcpu_disassembler::opcode_alignment() const
 	return 4;
 }
 
+u64 psxcpu_disassembler::decode_mode() const
+{
+	// the current PC gets delay slot annotations from live registers
+	return m_config ? DECODE_MODE_LIVE : 0;
+}
+
 offs_t psxcpu_disassembler::disassemble(std::ostream &stream, offs_t pc, const data_buffer &opcodes, const data_buffer &params)
 {
 	uint32_t op;
@@ -709,6 +709,8 @@ rsp_device::cop2::cop2(rsp_device &rsp, running_machine &machine)
 	m_div_in = 0;
 #endif
 	m_rspcop2_state = (internal_rspcop2_state *)rsp.m_cache.alloc_near(sizeof(internal_rspcop2_state));
+	memset(&m_rspcop2_state->vtemp, 0, sizeof(m_rspcop2_state->vtemp));
+	memset(&m_rspcop2_state->vones, 0xff, sizeof(m_rspcop2_state->vones));
 }
 
 rsp_device::cop2::~cop2()
@@ -179,6 +179,8 @@ protected:
 	struct internal_rspcop2_state
 	{
 		uint32_t      op;
+		VECTOR_REG    vtemp;              // shuffled operand for packed vector ops
+		VECTOR_REG    vones;              // all ones, for the inverting logical ops
 	};
 
 	internal_rspcop2_state *m_rspcop2_state;
@@ -2918,6 +2918,47 @@ void rsp_device::cop2_drc::vrsqh()
 }
 
 
+/*-------------------------------------------------
+    generate_vector_logic - generate packed code
+    for VAND, VNAND, VOR, VNOR, VXOR and VNXOR
+-------------------------------------------------*/
+
+void rsp_device::cop2_drc::generate_vector_logic(drcuml_block &block, uint32_t op)
+{
+	const int vdreg = VDREG;
+	const int vs1reg = VS1REG;
+	const int vs2reg = VS2REG;
+	const int el = EL;
+
+	uint32_t lanes = 0;
+	for (int i = 0; i < 8; i++)
+		lanes |= VEC_EL_2(el, i) << (i * 4);
+
+	UML_VSHUF(block, mem(&m_rspcop2_state->vtemp), mem(&m_v[vs2reg]), lanes);           // vshuf   [vtemp],vs2,el
+	switch (op & 0x3e)
+	{
+		case 0x28:
+			UML_VAND(block, mem(&m_v[vdreg]), mem(&m_v[vs1reg]), mem(&m_rspcop2_state->vtemp));    // vand    vd,vs1,[vtemp]
+			break;
+		case 0x2a:
+			UML_VOR(block, mem(&m_v[vdreg]), mem(&m_v[vs1reg]), mem(&m_rspcop2_state->vtemp));     // vor     vd,vs1,[vtemp]
+			break;
+		case 0x2c:
+			UML_VXOR(block, mem(&m_v[vdreg]), mem(&m_v[vs1reg]), mem(&m_rspcop2_state->vtemp));    // vxor    vd,vs1,[vtemp]
+			break;
+	}
+	if (op & 1)
+		UML_VXOR(block, mem(&m_v[vdreg]), mem(&m_v[vdreg]), mem(&m_rspcop2_state->vones));     // vxor    vd,vd,[vones]
+
+	// the low accumulator slice takes a copy of the result
+	for (int i = 0; i < 8; i++)
+	{
+		UML_LOAD(block, I0, &m_v[vdreg], i, SIZE_WORD, SCALE_x2);                       // load    i0,vd,i,word_x2
+		UML_STORE(block, &m_accum[0], i * 4 + 1, I0, SIZE_WORD, SCALE_x2);              // store   accum,i*4+1,i0,word_x2
+	}
+}
+
+
 /*-------------------------------------------------
     generate_vector_opcode - generate code for a
     vector opcode
@@ -3085,35 +3126,19 @@ bool rsp_device::cop2_drc::generate_vector_opcode(drcuml_block &block, rsp_devic
 			return true;
 
 		case 0x28:      /* VAND */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vand, this);
-			return true;
-
 		case 0x29:      /* VNAND */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vnand, this);
-			return true;
-
 		case 0x2a:      /* VOR */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vor, this);
-			return true;
-
 		case 0x2b:      /* VNOR */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vnor, this);
-			return true;
-
 		case 0x2c:      /* VXOR */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vxor, this);
-			return true;
-
 		case 0x2d:      /* VNXOR */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vnxor, this);
+			generate_vector_logic(block, op);
 			return true;
 
+
+
+
+
+
 		case 0x30:      /* VRCP */
 			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
 			UML_CALLC(block, &cop2_drc::cfunc_vrcp, this);
@@ -551,6 +551,11 @@ u32 s2650_disassembler::opcode_alignment() const
 	return 1;
 }
 
+u64 s2650_disassembler::decode_mode() const
+{
+	return m_config->get_z80_mnemonics_mode() ? 1 : 0;
+}
+
 u32 s2650_disassembler::interface_flags() const
 {
 	return PAGED;
@@ -26,6 +26,7 @@ public:
 	virtual ~s2650_disassembler() = default;
 
 	virtual u32 opcode_alignment() const override;
+	virtual u64 decode_mode() const override;
 	virtual u32 interface_flags() const override;
 	virtual u32 page_address_bits() const override;
 	virtual offs_t disassemble(std::ostream &stream, offs_t pc, const data_buffer &opcodes, const data_buffer &params) override;
@@ -1095,6 +1095,11 @@ u32 saturn_disassembler::opcode_alignment() const
 	return 1;
 }
 
+u64 saturn_disassembler::decode_mode() const
+{
+	return m_config->get_nonstandard_mnemonics_mode() ? 1 : 0;
+}
+
 offs_t saturn_disassembler::disassemble(std::ostream &stream, offs_t pc, const data_buffer &opcodes, const data_buffer &params)
 {
 	int adr=0;
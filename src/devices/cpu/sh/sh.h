@@ -160,6 +160,7 @@ public:
 		uint32_t  m_fpscr;
 		uint32_t  m_fpul;
 		uint32_t  m_dbr;
+		uint32_t  m_remap_temp;        // scratch for the DRC UTLB remap fast path
 
 		int     m_frt_input;
 		int     m_fpu_sz;
@@ -171,6 +171,8 @@ void sh4_base_device::LDTLB(const uint16_t opcode)
 	// these come from PTEA
 	m_utlb[replace].TC = (m_m[PTEA] & 0x00000008) >> 3;
 	m_utlb[replace].SA = (m_m[PTEA] & 0x00000007) >> 0;
+
+	sh4_rebuild_remap();
 }
 
 #if 0
@@ -1646,6 +1648,8 @@ void sh4_base_device::device_reset()
 	m_SH4_TCNT1 = 0xffffffff;
 	m_SH4_TCOR2 = 0xffffffff;
 	m_SH4_TCNT2 = 0xffffffff;
+
+	sh4_rebuild_remap();
 }
 
 inline void sh34_base_device::execute_one_0000(const uint16_t opcode)
@@ -2026,6 +2030,9 @@ void sh4_base_device::device_start()
 		save_item(NAME(m_utlb[i].SA), i);
 		save_item(NAME(m_utlb[i].TC), i);
 	}
+
+	sh4_rebuild_remap();
+	machine().save().register_postload(save_prepost_delegate(FUNC(sh4_base_device::sh4_rebuild_remap), this));
 }
 
 
@@ -2036,6 +2043,9 @@ void sh34_base_device::device_start()
 
 	sh_common_execution::device_start();
 
+	for (int i = 0; i < 0x200; i++)
+		m_utlb_remap[i] = i << 20;
+
 	for (int i = 0; i < 3; i++)
 	{
 		m_timer[i] = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(sh34_base_device::sh4_timer_callback), this));
@@ -2724,9 +2734,24 @@ void sh34_base_device::static_generate_memory_accessor(int size, int iswrite, co
 	UML_CMP(block, I0, 0xe0000000);
 	UML_JMPc(block, COND_AE, label);
 
+	if (m_mmuhack == 2)
+	{
+		// P0 goes through the precomputed UTLB remap table, which is identity while the MMU is off
+		uint32_t p1 = label + 1;
+		UML_CMP(block, I0, 0x80000000);                                             // cmp     i0,0x80000000
+		UML_JMPc(block, COND_AE, p1);                                               // jae     p1
+		UML_AND(block, mem(&m_sh2_state->m_remap_temp), I0, 0x000fffff);            // and     [remap_temp],i0,0x000fffff
+		UML_ROLAND(block, I0, I0, 12, 0x1ff);                                       // roland  i0,i0,12,0x1ff
+		UML_LOAD(block, I0, m_utlb_remap, I0, SIZE_DWORD, SCALE_x4);                // load    i0,utlb_remap,i0,dword_x4
+		UML_OR(block, I0, I0, mem(&m_sh2_state->m_remap_temp));                     // or      i0,i0,[remap_temp]
+		UML_JMP(block, label);                                                      // jmp     label
+		UML_LABEL(block, p1);                                                       // p1:
+	}
+
 	UML_AND(block, I0, I0, SH34_AM);     // and r0, r0, #AM (0x1fffffff)
 
 	UML_LABEL(block, label++);              // label:
+	label++;
 
 	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
 	{
@@ -3856,15 +3881,19 @@ bool sh34_base_device::generate_group_15_op1111_0x13_FCNVDS(drcuml_block &block,
 	return true;
 }
 
-void sh34_base_device::func_FIPR() { FIPR(m_sh2_state->arg0); }
-static void cfunc_FIPR(void *param) { ((sh34_base_device *)param)->func_FIPR(); };
-
 bool sh34_base_device::generate_group_15_op1111_0x13_FIPR(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	save_fast_iregs(block);
-	UML_MOV(block, mem(&m_sh2_state->arg0), desc->opptr.w[0]);
-	UML_CALLC(block, cfunc_FIPR, this);
-	load_fast_iregs(block);
+	const uint32_t n = Rn & 12;
+	const uint32_t m = (Rn & 3) << 2;
+
+	// accumulate left to right like the interpreter so results stay bit-exact
+	UML_FSMUL(block, F0, FPS32(n), FPS32(m));
+	for (int a = 1; a < 4; a++)
+	{
+		UML_FSMUL(block, F1, FPS32(n + a), FPS32(m + a));
+		UML_FSADD(block, F0, F0, F1);
+	}
+	UML_FSMOV(block, FPS32(n + 3), F0);
 	return true;
 }
 
@@ -3923,15 +3952,23 @@ bool sh34_base_device::generate_group_15_op1111_0x13_op1111_0xf13_FRCHG(drcuml_b
 	return true;
 }
 
-void sh34_base_device::func_FTRV() { FTRV(m_sh2_state->arg0); }
-static void cfunc_FTRV(void *param) { ((sh34_base_device *)param)->func_FTRV(); };
-
 bool sh34_base_device::generate_group_15_op1111_0x13_op1111_0xf13_FTRV(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	save_fast_iregs(block);
-	UML_MOV(block, mem(&m_sh2_state->arg0), desc->opptr.w[0]);
-	UML_CALLC(block, cfunc_FTRV, this);
-	load_fast_iregs(block);
+	const uml::parameter sums[4] = { uml::F2, uml::F3, uml::F4, uml::F5 };
+	const uint32_t n = Rn & 12;
+
+	// all four sums are formed before any of FVn is overwritten; starting from 0 keeps -0 products matching the interpreter
+	for (int i = 0; i < 4; i++)
+	{
+		UML_FSFRINT(block, sums[i], 0, SIZE_DWORD);
+		for (int j = 0; j < 4; j++)
+		{
+			UML_FSMUL(block, F1, mem(&m_sh2_state->m_xf[(j << 2) + i]), FPS32(n + j));
+			UML_FSADD(block, sums[i], sums[i], F1);
+		}
+	}
+	for (int i = 0; i < 4; i++)
+		UML_FSMOV(block, FPS32(n + i), sums[i]);
 	return true;
 }
 
@@ -231,11 +231,9 @@ public:
 	void func_FMAC();
 	void func_FABS();
 	void func_FLDS();
-	void func_FTRV();
 	void func_FSTS();
 	void func_FSSCA();
 	void func_FCNVSD();
-	void func_FIPR();
 	void func_FSRRA();
 	void func_FSQRT();
 	void func_FCNVDS();
@@ -380,6 +378,9 @@ protected:
 	/* This MMU simulation is good for the simple remap used on Naomi GD-ROM SQ access *ONLY* */
 	uint8_t m_sh4_mmu_enabled;
 
+	// precomputed get_remap results at 1MB granularity, identity while the MMU is off
+	uint32_t m_utlb_remap[0x200];
+
 	// sh3 internal
 	uint32_t  m_sh3internal_upper[0x3000/4];
 	uint32_t  m_sh3internal_lower[0x1000];
@@ -715,6 +716,7 @@ public:
 	virtual uint32_t get_remap(uint32_t address) override;
 	virtual uint32_t sh4_getsqremap(uint32_t address) override;
 	sh4_utlb m_utlb[64];
+	void sh4_rebuild_remap();
 
 	void sh4_internal_map(address_map &map);
 protected:
@@ -793,6 +793,7 @@ void sh4_base_device::sh4_internal_w(offs_t offset, uint32_t data, uint32_t mem_
 			m_sh4_mmu_enabled = 0;
 		}
 
+		sh4_rebuild_remap();
 		break;
 
 		// Memory refresh
@@ -1279,23 +1280,26 @@ uint32_t sh4_base_device::get_remap(uint32_t address)
 		return address;
 
 	// is this the correct way around?
-	int i;
-	uint32_t topaddr = address&0xfff00000;
+	return (address & 0x000fffff) | m_utlb_remap[(address >> 20) & 0x1ff];
+}
+
+void sh4_base_device::sh4_rebuild_remap()
+{
+	for (int i = 0; i < 0x200; i++)
+		m_utlb_remap[i] = i << 20;
 
-	for (i=0;i<64;i++)
+	if (!m_sh4_mmu_enabled || (m_mmuhack != 2))
+		return;
+
+	// walk backwards so the lowest matching entry wins, as a linear search would
+	for (int i = 63; i >= 0; i--)
 	{
 		if (m_utlb[i].V)
 		{
 			uint32_t topcmp = (m_utlb[i].PPN << 10) & 0xfff00000;
-			if (topcmp == topaddr)
-				return (address & 0x000fffff) | ((m_utlb[i].VPN << 10) & 0xfff00000);
+			m_utlb_remap[topcmp >> 20] = (m_utlb[i].VPN << 10) & 0xfff00000;
 		}
 	}
-
-	//printf("address not in UTLB? %08x\n", address);
-
-
-	return address;
 }
 
 uint32_t sh34_base_device::sh4_getsqremap(uint32_t address)
@@ -1358,6 +1362,8 @@ void sh4_base_device::sh4_utlb_address_array_w(offs_t offset, uint64_t data)
 		// associative mode
 		fatalerror("SH4MMU: associative mode writes unsupported\n");
 	}
+
+	sh4_rebuild_remap();
 }
 
 uint64_t sh4_base_device::sh4_utlb_address_array_r(offs_t offset)
@@ -1408,6 +1414,8 @@ void sh4_base_device::sh4_utlb_data_array1_w(offs_t offset, uint64_t data)
 	m_utlb[i].D =   (data & 0x00000004) >> 2;
 	m_utlb[i].SH =  (data & 0x00000002) >> 1;
 	m_utlb[i].WT =  (data & 0x00000001) >> 0;
+
+	sh4_rebuild_remap();
 }
 
 
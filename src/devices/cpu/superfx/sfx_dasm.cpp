@@ -12,6 +12,11 @@ u32 superfx_disassembler::opcode_alignment() const
 	return 1;
 }
 
+u64 superfx_disassembler::decode_mode() const
+{
+	return m_config->get_alt();
+}
+
 offs_t superfx_disassembler::disassemble(std::ostream &stream, offs_t pc, const data_buffer &opcodes, const data_buffer &params)
 {
 	uint8_t  op = opcodes.r8(pc);
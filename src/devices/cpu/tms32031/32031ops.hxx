@@ -97,6 +97,35 @@ inline void tms3203x_device::execute_one()
 }
 
 
+inline void tms3203x_device::execute_cached()
+{
+	uint32_t op = m_loop_op[m_pc - m_loop_start];
+	m_icount -= 2;  // 2 clocks per cycle
+	m_pc++;
+#if (TMS_3203X_LOG_OPCODE_USAGE)
+	m_hits[op >> 21]++;
+#endif
+	(this->*s_tms32031ops[op >> 21])(op);
+}
+
+
+// RPTS and RPTB fetch a short loop body once, rather than on every iteration;
+// code that rewrites its own loop body while the loop runs isn't supported
+void tms3203x_device::cache_loop_body()
+{
+	uint32_t const length = IREG(TMR_RE) - IREG(TMR_RS) + 1;
+
+	m_loop_length = 0;
+	if (length > LOOP_CACHE_WORDS)
+		return;
+
+	m_loop_start = IREG(TMR_RS);
+	for (uint32_t i = 0; i < length; i++)
+		m_loop_op[i] = ROPCODE(m_loop_start + i);
+	m_loop_length = length;
+}
+
+
 void tms3203x_device::update_special(int dreg)
 {
 	if (dreg == TMR_BK)
@@ -2697,6 +2726,7 @@ void tms3203x_device::rpts_reg(uint32_t op)
 	IREG(TMR_ST) |= RMFLAG;
 	m_icount -= 3*2;
 	m_delayed = true;
+	cache_loop_body();
 }
 
 void tms3203x_device::rpts_dir(uint32_t op)
@@ -2707,6 +2737,7 @@ void tms3203x_device::rpts_dir(uint32_t op)
 	IREG(TMR_ST) |= RMFLAG;
 	m_icount -= 3*2;
 	m_delayed = true;
+	cache_loop_body();
 }
 
 void tms3203x_device::rpts_ind(uint32_t op)
@@ -2717,6 +2748,7 @@ void tms3203x_device::rpts_ind(uint32_t op)
 	IREG(TMR_ST) |= RMFLAG;
 	m_icount -= 3*2;
 	m_delayed = true;
+	cache_loop_body();
 }
 
 void tms3203x_device::rpts_imm(uint32_t op)
@@ -2727,6 +2759,7 @@ void tms3203x_device::rpts_imm(uint32_t op)
 	IREG(TMR_ST) |= RMFLAG;
 	m_icount -= 3*2;
 	m_delayed = true;
+	cache_loop_body();
 }
 
 /*-----------------------------------------------------*/
@@ -5539,6 +5572,7 @@ void tms3203x_device::rptb_imm(uint32_t op)
 	IREG(TMR_RE) = op & 0xffffff;
 	IREG(TMR_ST) |= RMFLAG;
 	m_icount -= 3*2;
+	cache_loop_body();
 }
 
 /*-----------------------------------------------------*/
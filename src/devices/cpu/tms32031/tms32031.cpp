@@ -522,6 +522,9 @@ void tms3203x_device::device_start()
 	save_item(NAME(m_is_idling));
 	save_item(NAME(m_mcbl_mode));
 	save_item(NAME(m_hold_state));
+	save_item(NAME(m_loop_start));
+	save_item(NAME(m_loop_length));
+	save_item(NAME(m_loop_op));
 
 	// register our state for the debugger
 	state_add(TMS3203X_PC,      "PC",        m_pc);
@@ -589,6 +592,8 @@ void tms3203x_device::device_reset()
 
 	// reset internal stuff
 	m_delayed = m_irq_pending = m_is_idling = false;
+	m_loop_start = 0;
+	m_loop_length = 0;
 }
 
 
@@ -931,6 +936,7 @@ void tms3203x_device::execute_run()
 				else
 				{
 					IREG(TMR_ST) &= ~RMFLAG;
+					m_loop_length = 0;
 					if (m_delayed)
 					{
 						m_delayed = false;
@@ -944,7 +950,11 @@ void tms3203x_device::execute_run()
 				continue;
 			}
 
-			execute_one();
+			// inside a short repeat loop the opcodes are already fetched
+			if ((IREG(TMR_ST) & RMFLAG) && (m_pc - m_loop_start) < m_loop_length)
+				execute_cached();
+			else
+				execute_one();
 		}
 	}
 
@@ -963,6 +973,7 @@ void tms3203x_device::execute_run()
 				else
 				{
 					IREG(TMR_ST) &= ~RMFLAG;
+					m_loop_length = 0;
 					if (m_delayed)
 					{
 						m_delayed = false;
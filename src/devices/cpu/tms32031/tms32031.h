@@ -183,6 +183,8 @@ protected:
 	// misc helpers
 	void check_irqs();
 	void execute_one();
+	void execute_cached();
+	void cache_loop_body();
 	void update_special(int dreg);
 	bool condition(int which);
 
@@ -767,6 +769,12 @@ protected:
 	bool                m_is_idling;
 	int                 m_icount;
 
+	// body of the current repeat loop, fetched once when the loop starts
+	static constexpr uint32_t LOOP_CACHE_WORDS = 64;
+	uint32_t            m_loop_start;
+	uint32_t            m_loop_length;      // 0 if the loop is too long to cache
+	uint32_t            m_loop_op[LOOP_CACHE_WORDS];
+
 	uint32_t            m_iotemp;
 	memory_access<24, 2, -2, ENDIANNESS_LITTLE>::cache m_cache;
 	memory_access<24, 2, -2, ENDIANNESS_LITTLE>::specific m_program;
@@ -243,6 +243,24 @@ uint16_t tms340x0_device::dummy_shiftreg_r(offs_t offset)
 	return m_shiftreg[0];
 }
 
+/* Return a pointer to a run of words if they are all plain RAM, or nullptr to go through the handlers */
+uint16_t *tms340x0_device::direct_vram(uint32_t wordaddr, int words)
+{
+	if (!m_direct_vram || words <= 0)
+		return nullptr;
+
+	address_space &program = space(AS_PROGRAM);
+	uint8_t *const first = (uint8_t *)program.get_write_ptr(wordaddr << 4);
+	if (first == nullptr || program.get_read_ptr(wordaddr << 4) != first)
+		return nullptr;
+
+	/* the whole run has to sit in the same block; mirrors and split banks fall back */
+	uint8_t *const last = (uint8_t *)program.get_write_ptr((wordaddr + words - 1) << 4);
+	if (last != first + (words - 1) * 2)
+		return nullptr;
+	return (uint16_t *)first;
+}
+
 
 
 /* Pixel operations */
@@ -1033,79 +1051,100 @@ void FUNCTION_NAME(tms340x0_device::pixblt)(int src_is_linear, int dst_is_linear
 			uint8_t dstbit = daddr & 15;
 			uint32_t srcword, dstword = 0;
 
-			/* fetch the initial source word */
-			srcword = (this->*word_read)(srcwordaddr++ << 4);
-			readwrites++;
-
-			/* fetch the initial dest word */
-			if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY || (daddr & 0x0f) != 0)
+			/* aligned replacing copies between plain RAM rows are done in bulk, with the same bus cycle count */
+			int const rowwords = (dx * BITS_PER_PIXEL) >> 4;
+			uint16_t *srcrow = nullptr, *dstrow = nullptr;
+			if (!PIXEL_OP_REQUIRES_SOURCE && !TRANSPARENCY && srcbit == 0 && dstbit == 0 && ((dx * BITS_PER_PIXEL) & 15) == 0 && word_write == &tms340x0_device::memory_w)
 			{
-				dstword = (this->*word_read)(dstwordaddr << 4);
-				readwrites++;
+				srcrow = direct_vram(srcwordaddr, rowwords);
+				dstrow = srcrow ? direct_vram(dstwordaddr, rowwords) : nullptr;
+
+				/* the word-at-a-time loop smears a row copied forwards onto itself; leave that to it */
+				if (dstrow > srcrow + 1 && dstrow < srcrow + rowwords)
+					dstrow = nullptr;
 			}
 
-			/* loop over pixels */
-			for (x = 0; x < dx; x++)
+			if (dstrow != nullptr)
+			{
+				memmove(dstrow, srcrow, rowwords * 2);
+				readwrites += rowwords * 2;
+			}
+			else
 			{
-				uint32_t dstmask;
-				uint32_t pixel;
+				/* fetch the initial source word */
+				srcword = (this->*word_read)(srcwordaddr++ << 4);
+				readwrites++;
 
-				/* fetch more words if necessary */
-				if (srcbit + BITS_PER_PIXEL > 16)
+				/* fetch the initial dest word */
+				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY || (daddr & 0x0f) != 0)
 				{
-					srcword |= (this->*word_read)(srcwordaddr++ << 4) << 16;
+					dstword = (this->*word_read)(dstwordaddr << 4);
 					readwrites++;
 				}
 
-				/* extract pixel from source */
-				pixel = (srcword >> srcbit) & PIXEL_MASK;
-				srcbit += BITS_PER_PIXEL;
-				if (srcbit > 16)
+				/* loop over pixels */
+				for (x = 0; x < dx; x++)
 				{
-					srcbit -= 16;
-					srcword >>= 16;
-				}
+					uint32_t dstmask;
+					uint32_t pixel;
 
-				/* fetch additional destination word if necessary */
-				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
-					if (dstbit + BITS_PER_PIXEL > 16)
+					/* fetch more words if necessary */
+					if (srcbit + BITS_PER_PIXEL > 16)
 					{
-						dstword |= (this->*word_read)((dstwordaddr + 1) << 4) << 16;
+						srcword |= (this->*word_read)(srcwordaddr++ << 4) << 16;
 						readwrites++;
 					}
 
-				/* apply pixel operations */
-				pixel <<= dstbit;
-				dstmask = PIXEL_MASK << dstbit;
-				PIXEL_OP(dstword, dstmask, pixel);
-				if (!TRANSPARENCY || pixel != 0)
-					dstword = (dstword & ~dstmask) | pixel;
+					/* extract pixel from source */
+					pixel = (srcword >> srcbit) & PIXEL_MASK;
+					srcbit += BITS_PER_PIXEL;
+					if (srcbit > 16)
+					{
+						srcbit -= 16;
+						srcword >>= 16;
+					}
 
-				/* flush destination words */
-				dstbit += BITS_PER_PIXEL;
-				if (dstbit > 16)
-				{
-					(this->*word_write)(dstwordaddr++ << 4, dstword);
-					readwrites++;
-					dstbit -= 16;
-					dstword >>= 16;
+					/* fetch additional destination word if necessary */
+					if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
+						if (dstbit + BITS_PER_PIXEL > 16)
+						{
+							dstword |= (this->*word_read)((dstwordaddr + 1) << 4) << 16;
+							readwrites++;
+						}
+
+					/* apply pixel operations */
+					pixel <<= dstbit;
+					dstmask = PIXEL_MASK << dstbit;
+					PIXEL_OP(dstword, dstmask, pixel);
+					if (!TRANSPARENCY || pixel != 0)
+						dstword = (dstword & ~dstmask) | pixel;
+
+					/* flush destination words */
+					dstbit += BITS_PER_PIXEL;
+					if (dstbit > 16)
+					{
+						(this->*word_write)(dstwordaddr++ << 4, dstword);
+						readwrites++;
+						dstbit -= 16;
+						dstword >>= 16;
+					}
 				}
-			}
 
-			/* flush any remaining words */
-			if (dstbit > 0)
-			{
-				/* if we're right-partial, read and mask the remaining bits */
-				if (dstbit != 16)
+				/* flush any remaining words */
+				if (dstbit > 0)
 				{
-					uint16_t origdst = (this->*word_read)(dstwordaddr << 4);
-					uint16_t mask = 0xffff << dstbit;
-					dstword = (dstword & ~mask) | (origdst & mask);
+					/* if we're right-partial, read and mask the remaining bits */
+					if (dstbit != 16)
+					{
+						uint16_t origdst = (this->*word_read)(dstwordaddr << 4);
+						uint16_t mask = 0xffff << dstbit;
+						dstword = (dstword & ~mask) | (origdst & mask);
+						readwrites++;
+					}
+
+					(this->*word_write)(dstwordaddr++ << 4, dstword);
 					readwrites++;
 				}
-
-				(this->*word_write)(dstwordaddr++ << 4, dstword);
-				readwrites++;
 			}
 
 
@@ -1899,31 +1938,47 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 				(this->*word_write)(dwordaddr++ << 4, dstword);
 			}
 
-			/* loop over full words */
-			for (words = 0; words < full_words; words++)
-			{
-				/* fetch the destination word (if necessary) */
-				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
-					dstword = (this->*word_read)(dwordaddr << 4);
-				else
-					dstword = 0;
-				dstmask = PIXEL_MASK;
+			/* full words in plain RAM are processed in place */
+			uint16_t *const direct = (word_write == &tms340x0_device::memory_w) ? direct_vram(dwordaddr, full_words) : nullptr;
 
-				/* loop over partials */
-				for (x = 0; x < PIXELS_PER_WORD; x++)
+			/* a plain fill doesn't depend on the destination, so every full word is the same */
+			if (direct != nullptr && !PIXEL_OP_REQUIRES_SOURCE && !TRANSPARENCY)
+			{
+				std::fill_n(direct, full_words, uint16_t(COLOR1()));
+				dwordaddr += full_words;
+			}
+			else
+			{
+				/* loop over full words */
+				for (words = 0; words < full_words; words++)
 				{
-					/* process the pixel */
-					pixel = COLOR1() & dstmask;
-					PIXEL_OP(dstword, dstmask, pixel);
-					if (!TRANSPARENCY || pixel != 0)
-						dstword = (dstword & ~dstmask) | pixel;
+					/* fetch the destination word (if necessary) */
+					if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
+						dstword = (direct != nullptr) ? direct[words] : (this->*word_read)(dwordaddr << 4);
+					else
+						dstword = 0;
+					dstmask = PIXEL_MASK;
 
-					/* update the destination */
-					dstmask = dstmask << BITS_PER_PIXEL;
-				}
+					/* loop over partials */
+					for (x = 0; x < PIXELS_PER_WORD; x++)
+					{
+						/* process the pixel */
+						pixel = COLOR1() & dstmask;
+						PIXEL_OP(dstword, dstmask, pixel);
+						if (!TRANSPARENCY || pixel != 0)
+							dstword = (dstword & ~dstmask) | pixel;
+
+						/* update the destination */
+						dstmask = dstmask << BITS_PER_PIXEL;
+					}
 
-				/* write the result */
-				(this->*word_write)(dwordaddr++ << 4, dstword);
+					/* write the result */
+					if (direct != nullptr)
+						direct[words] = dstword;
+					else
+						(this->*word_write)(dwordaddr << 4, dstword);
+					dwordaddr++;
+				}
 			}
 
 			/* handle the right partial word */
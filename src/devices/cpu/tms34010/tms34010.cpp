@@ -721,6 +721,9 @@ void tms340x0_device::device_start()
 
 	m_external_host_access = false;
 
+	/* rows are accessed as native 16-bit words, so a 32-bit bus needs a little-endian host; debugger watchpoints need the handlers */
+	m_direct_vram = ((m_program_config.data_width() == 16) || (ENDIANNESS_NATIVE == ENDIANNESS_LITTLE)) && !(machine().debug_flags & DEBUG_FLAG_ENABLED);
+
 	/* set up the state table */
 	{
 		state_add(TMS34010_PC,     "PC",        m_pc);
@@ -318,6 +318,7 @@ protected:
 	uint8_t            m_hblank_stable;
 	uint8_t            m_external_host_access;
 	uint8_t            m_executing;
+	bool             m_direct_vram;  /* FILL and PIXBLT may work on plain RAM rows in place */
 
 	uint32_t  m_pixclock;                           /* the pixel clock (0 means don't adjust screen size) */
 	int     m_pixperclock;                        /* pixels per clock */
@@ -899,6 +900,7 @@ protected:
 	void shiftreg_w(offs_t offset, uint16_t data);
 	uint16_t shiftreg_r(offs_t offset);
 	uint16_t dummy_shiftreg_r(offs_t offset);
+	uint16_t *direct_vram(uint32_t wordaddr, int words);
 	uint32_t pixel_op00(uint32_t dstpix, uint32_t mask, uint32_t srcpix);
 	uint32_t pixel_op01(uint32_t dstpix, uint32_t mask, uint32_t srcpix);
 	uint32_t pixel_op02(uint32_t dstpix, uint32_t mask, uint32_t srcpix);
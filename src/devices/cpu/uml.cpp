@@ -215,6 +215,17 @@ opcode_info const instruction::s_opcode_info_table[OP_MAX] =
 	OPINFO2(FRSQRT,  "f#rsqrt",  4|8, false, NONE, NONE, ALL,  PINFO(OUT, OP, FRM), PINFO(IN, OP, FANY))
 	OPINFO2(FCOPYI,  "f#copyi",  4|8, false, NONE, NONE, NONE, PINFO(OUT, OP, FRM), PINFO(IN, OP, IRM))
 	OPINFO2(ICOPYF,  "icopyf#",  4|8, false, NONE, NONE, NONE, PINFO(OUT, OP, IRM), PINFO(IN, OP, FRM))
+
+	// Vector Operations
+	OPINFO2(VMOV,    "vmov",     4,   false, NONE, NONE, NONE, PINFO(OUT, OP, MEM), PINFO(IN, OP, MEM))
+	OPINFO3(VSHUF,   "vshuf",    4,   false, NONE, NONE, NONE, PINFO(OUT, OP, MEM), PINFO(IN, OP, MEM), PINFO(IN, OP, IMM))
+	OPINFO3(VAND,    "vand",     4,   false, NONE, NONE, NONE, PINFO(OUT, OP, MEM), PINFO(IN, OP, MEM), PINFO(IN, OP, MEM))
+	OPINFO3(VOR,     "vor",      4,   false, NONE, NONE, NONE, PINFO(OUT, OP, MEM), PINFO(IN, OP, MEM), PINFO(IN, OP, MEM))
+	OPINFO3(VXOR,    "vxor",     4,   false, NONE, NONE, NONE, PINFO(OUT, OP, MEM), PINFO(IN, OP, MEM), PINFO(IN, OP, MEM))
+	OPINFO3(VADD,    "vadd",     4,   false, NONE, NONE, NONE, PINFO(OUT, OP, MEM), PINFO(IN, OP, MEM), PINFO(IN, OP, MEM))
+	OPINFO3(VSUB,    "vsub",     4,   false, NONE, NONE, NONE, PINFO(OUT, OP, MEM), PINFO(IN, OP, MEM), PINFO(IN, OP, MEM))
+	OPINFO3(VADDS,   "vadds",    4,   false, NONE, NONE, NONE, PINFO(OUT, OP, MEM), PINFO(IN, OP, MEM), PINFO(IN, OP, MEM))
+	OPINFO3(VSUBS,   "vsubs",    4,   false, NONE, NONE, NONE, PINFO(OUT, OP, MEM), PINFO(IN, OP, MEM), PINFO(IN, OP, MEM))
 };
 
 
@@ -388,6 +399,29 @@ void uml::instruction::configure(opcode_t op, u8 size, parameter p0, parameter p
 }
 
 
+//-------------------------------------------------
+//  rebuild - configure an opcode from fields
+//  saved from an earlier instance
+//-------------------------------------------------
+
+void uml::instruction::rebuild(opcode_t op, u8 size, condition_t condition, u8 numparams, parameter const *params)
+{
+	assert(numparams <= MAX_PARAMS);
+
+	// fill in the instruction
+	m_opcode = opcode_t(u8(op));
+	m_size = size;
+	m_condition = condition;
+	m_flags = 0;
+	m_numparams = numparams;
+	for (int pnum = 0; pnum < numparams; pnum++)
+		m_param[pnum] = params[pnum];
+
+	// validate
+	validate();
+}
+
+
 //-------------------------------------------------
 //  simplify - simplify instructions that have
 //  immediate values we can evaluate at compile
@@ -836,6 +870,64 @@ u8 uml::instruction::modified_flags() const
 }
 
 
+//-------------------------------------------------
+//  param_is_input - return true if an instruction
+//  reads the given parameter
+//-------------------------------------------------
+
+bool uml::instruction::param_is_input(int index) const
+{
+	assert(index < m_numparams);
+	return s_opcode_info_table[m_opcode].param[index].output & PIO_IN;
+}
+
+
+//-------------------------------------------------
+//  param_is_output - return true if an
+//  instruction writes the given parameter
+//-------------------------------------------------
+
+bool uml::instruction::param_is_output(int index) const
+{
+	assert(index < m_numparams);
+	return s_opcode_info_table[m_opcode].param[index].output & PIO_OUT;
+}
+
+
+//-------------------------------------------------
+//  param_allows - return true if the given
+//  parameter may be of the given type
+//-------------------------------------------------
+
+bool uml::instruction::param_allows(int index, parameter::parameter_type type) const
+{
+	assert(index < m_numparams);
+	return s_opcode_info_table[m_opcode].param[index].typemask & (1 << type);
+}
+
+
+//-------------------------------------------------
+//  param_size - return the size in bytes of the
+//  given parameter
+//-------------------------------------------------
+
+int uml::instruction::param_size(int index) const
+{
+	assert(index < m_numparams);
+	switch (s_opcode_info_table[m_opcode].param[index].size)
+	{
+		case PSIZE_4:   return 4;
+		case PSIZE_8:   return 8;
+		case PSIZE_P1:  return 1 << m_param[0].size();
+		case PSIZE_P2:  return 1 << m_param[1].size();
+		case PSIZE_P3:  return 1 << m_param[2].size();
+		case PSIZE_P4:  return 1 << m_param[3].size();
+		default:
+		case PSIZE_OP:  return m_size;
+	}
+}
+
+
 //-------------------------------------------------
 //  disasm - disassemble an instruction to the
 //  given buffer
@@ -221,6 +221,17 @@ namespace uml
 		OP_FCOPYI,                  // FCOPYI  dst,src
 		OP_ICOPYF,                  // ICOPYF  dst,src
 
+		// vector operations on eight 16-bit lanes in memory
+		OP_VMOV,                    // VMOV    dst,src
+		OP_VSHUF,                   // VSHUF   dst,src,lanes
+		OP_VAND,                    // VAND    dst,src1,src2
+		OP_VOR,                     // VOR     dst,src1,src2
+		OP_VXOR,                    // VXOR    dst,src1,src2
+		OP_VADD,                    // VADD    dst,src1,src2
+		OP_VSUB,                    // VSUB    dst,src1,src2
+		OP_VADDS,                   // VADDS   dst,src1,src2
+		OP_VSUBS,                   // VSUBS   dst,src1,src2
+
 		OP_MAX
 	};
 
@@ -358,6 +369,10 @@ namespace uml
 		// other queries
 		constexpr bool is_immediate_value(u64 value) const { return (m_type == PTYPE_IMMEDIATE) && (m_value == value); }
 
+		// raw access for saving and reloading translated blocks
+		constexpr parameter_value raw_value() const { return m_value; }
+		static constexpr parameter make_raw(parameter_type type, parameter_value value) { return parameter(type, value); }
+
 	private:
 		// private constructor
 		constexpr parameter(parameter_type type, parameter_value value) : m_type(type), m_value(value) { }
@@ -405,13 +420,19 @@ namespace uml
 		// setters
 		void set_flags(u8 flags) { m_flags = flags; }
 		void set_mapvar(int paramnum, u32 value) { assert(paramnum < m_numparams); assert(m_param[paramnum].is_mapvar()); m_param[paramnum] = value; }
+		void set_immediate(int paramnum, u64 value) { assert(paramnum < m_numparams); assert(param_allows(paramnum, parameter::PTYPE_IMMEDIATE)); m_param[paramnum] = value; }
 
 		// misc
 		std::string disasm(drcuml_state *drcuml = nullptr) const;
 		u8 input_flags() const;
 		u8 output_flags() const;
 		u8 modified_flags() const;
+		bool param_is_input(int index) const;
+		bool param_is_output(int index) const;
+		bool param_allows(int index, parameter::parameter_type type) const;
+		int param_size(int index) const;
 		void simplify();
+		void rebuild(opcode_t op, u8 size, condition_t cond, u8 numparams, parameter const *params);
 
 		// compile-time opcodes
 		void handle(code_handle &hand) { configure(OP_HANDLE, 4, hand); }
@@ -571,6 +592,17 @@ namespace uml
 		void fdcopyi(parameter dst, parameter src) { configure(OP_FCOPYI, 8, dst, src); }
 		void icopyfd(parameter dst, parameter src) { configure(OP_ICOPYF, 8, dst, src); }
 
+		// 128-bit vector operations; lanes holds a 4-bit source lane index for each destination lane
+		void vmov(parameter dst, parameter src) { configure(OP_VMOV, 4, dst, src); }
+		void vshuf(parameter dst, parameter src, u32 lanes) { configure(OP_VSHUF, 4, dst, src, lanes); }
+		void vand(parameter dst, parameter src1, parameter src2) { configure(OP_VAND, 4, dst, src1, src2); }
+		void vor(parameter dst, parameter src1, parameter src2) { configure(OP_VOR, 4, dst, src1, src2); }
+		void vxor(parameter dst, parameter src1, parameter src2) { configure(OP_VXOR, 4, dst, src1, src2); }
+		void vadd(parameter dst, parameter src1, parameter src2) { configure(OP_VADD, 4, dst, src1, src2); }
+		void vsub(parameter dst, parameter src1, parameter src2) { configure(OP_VSUB, 4, dst, src1, src2); }
+		void vadds(parameter dst, parameter src1, parameter src2) { configure(OP_VADDS, 4, dst, src1, src2); }
+		void vsubs(parameter dst, parameter src1, parameter src2) { configure(OP_VSUBS, 4, dst, src1, src2); }
+
 		// constants
 		static constexpr int MAX_PARAMS = 4;
 
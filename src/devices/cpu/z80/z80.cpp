@@ -3497,6 +3497,12 @@ void nsc800_device::device_reset()
 
 void z80_device::execute_run()
 {
+	if (m_batched_execution)
+	{
+		execute_batched();
+		return;
+	}
+
 	do
 	{
 		if (m_wait_state)
@@ -3528,6 +3534,52 @@ void z80_device::execute_run()
 	} while (m_icount > 0);
 }
 
+/****************************************************************************
+ * Execute 'cycles' T-states, only sampling WAIT and interrupts at the end
+ * of each straight-line run.  A run ends on any instruction that does not
+ * fall through to the next one (jumps, calls, returns, repeated block
+ * instructions) and on HALT.  Interrupts accepted at a run boundary are
+ * therefore taken at most one run late, which is only acceptable for
+ * systems that declared it with set_batched_execution().
+ ****************************************************************************/
+
+void z80_device::execute_batched()
+{
+	do
+	{
+		if (m_wait_state)
+		{
+			// stalled
+			m_icount = 0;
+			return;
+		}
+
+		check_interrupts();
+
+		do
+		{
+			m_after_ei = false;
+			m_after_ldair = false;
+
+			PRVPC = PCD;
+			debugger_instruction_hook(PCD);
+
+			m_r++;
+			uint8_t opcode = rop();
+
+			// when in HALT state, the fetched opcode is not dispatched (aka a NOP)
+			if (m_halt)
+			{
+				PC--;
+				opcode = 0;
+			}
+			EXEC(op,opcode);
+
+			// instructions are 1-4 bytes long, anything else is a taken branch
+		} while (m_icount > 0 && !m_halt && uint16_t(PC - PRVPC - 1) < 4);
+	} while (m_icount > 0);
+}
+
 void z80_device::check_interrupts()
 {
 	if (m_nmi_pending)
@@ -3700,7 +3752,8 @@ z80_device::z80_device(const machine_config &mconfig, device_type type, const ch
 	m_io_config("io", ENDIANNESS_LITTLE, 8, 16, 0),
 	m_irqack_cb(*this),
 	m_refresh_cb(*this),
-	m_halt_cb(*this)
+	m_halt_cb(*this),
+	m_batched_execution(false)
 {
 }
 
@@ -40,6 +40,10 @@ public:
 	auto refresh_cb() { return m_refresh_cb.bind(); }
 	auto halt_cb() { return m_halt_cb.bind(); }
 
+	// the system never asserts WAIT and nothing needs to observe the CPU
+	// mid-instruction, so straight-line runs may be executed as a batch
+	void set_batched_execution(bool batched) { m_batched_execution = batched; }
+
 protected:
 	z80_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
 
@@ -56,6 +60,8 @@ protected:
 	virtual void execute_run() override;
 	virtual void execute_set_input(int inputnum, int state) override;
 
+	void execute_batched();
+
 	// device_memory_interface overrides
 	virtual space_config_vector memory_space_config() const override;
 
@@ -277,6 +283,7 @@ protected:
 	uint32_t          m_ea;
 
 	int             m_icount;
+	bool            m_batched_execution;  // straight-line runs are executed without WAIT/interrupt checks
 	uint8_t           m_rtemp;
 	const uint8_t *   m_cc_op;
 	const uint8_t *   m_cc_cb;
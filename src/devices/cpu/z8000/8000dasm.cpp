@@ -575,6 +575,11 @@ u32 z8000_disassembler::opcode_alignment() const
 	return 2;
 }
 
+u64 z8000_disassembler::decode_mode() const
+{
+	return m_config->get_segmented_mode() ? 1 : 0;
+}
+
 offs_t z8000_disassembler::disassemble(std::ostream &stream, offs_t pc, const data_buffer &opcodes, const data_buffer &params)
 {
 	u8 n[16];   /* opcode nibbles */
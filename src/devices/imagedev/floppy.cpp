@@ -571,6 +571,8 @@ image_init_result floppy_image_device::call_load()
 	}
 
 	image = std::make_unique<floppy_image>(tracks, sides, form_factor);
+	// formats live as long as the device, so tracks can be built on first access
+	image->set_deferred_load(true);
 	if (!best_format->load(&io, form_factor, variants, image.get())) {
 		seterror(IMAGE_ERROR_UNSUPPORTED, "Incompatible image format or corrupted data");
 		image.reset();
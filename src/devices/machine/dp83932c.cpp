@@ -68,6 +68,7 @@ dp83932c_device::dp83932c_device(machine_config const &mconfig, char const *tag,
 	: device_t(mconfig, DP83932C, tag, owner, clock)
 	, device_network_interface(mconfig, *this, 10.0f)
 	, m_bus(*this, finder_base::DUMMY_TAG, 0)
+	, m_dma(nullptr)
 	, m_out_int(*this)
 	, m_int_state(false)
 {
@@ -82,6 +83,9 @@ void dp83932c_device::device_start()
 {
 	m_out_int.resolve();
 
+	// descriptors and buffers are fetched through a cache of the bus
+	m_dma = &m_bus->cache_handle();
+
 	m_command = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(dp83932c_device::command), this));
 
 	save_item(NAME(m_int_state));
@@ -149,7 +153,7 @@ int dp83932c_device::recv_start_cb(u8 *buf, int length)
 	if (m_reg[CRDA] & 1)
 	{
 		// re-read the previous descriptor link field
-		m_reg[CRDA] = m_bus->read_word(EA(m_reg[URDA], m_reg[LLFA]));
+		m_reg[CRDA] = m_dma->read_word(EA(m_reg[URDA], m_reg[LLFA]));
 		if (m_reg[CRDA] & 1)
 		{
 			logerror("no receive descriptor available\n");
@@ -169,7 +173,7 @@ int dp83932c_device::recv_start_cb(u8 *buf, int length)
 	// TODO: check for buffer overflow
 	offs_t const rba = EA(m_reg[CRBA1], m_reg[CRBA0]);
 	for (unsigned i = 0; i < length; i++)
-		m_bus->write_byte(rba + i, buf[i]);
+		m_dma->write_byte(rba + i, buf[i]);
 
 	// update remaining buffer word count
 	u32 const rbwc = ((u32(m_reg[RBWC1]) << 16) | m_reg[RBWC0]) - (length + 1) / 2;
@@ -182,19 +186,19 @@ int dp83932c_device::recv_start_cb(u8 *buf, int length)
 	// write status to rda
 	// TODO: don't write the rda if rba limit exceeded (buffer overflow)
 	offs_t const rda = EA(m_reg[URDA], m_reg[CRDA]);
-	m_bus->write_word(rda + 0 * width, m_reg[RCR]);
-	m_bus->write_word(rda + 1 * width, length);
-	m_bus->write_word(rda + 2 * width, m_reg[CRBA0]);
-	m_bus->write_word(rda + 3 * width, m_reg[CRBA1]);
-	m_bus->write_word(rda + 4 * width, m_reg[RSC]);
+	m_dma->write_word(rda + 0 * width, m_reg[RCR]);
+	m_dma->write_word(rda + 1 * width, length);
+	m_dma->write_word(rda + 2 * width, m_reg[CRBA0]);
+	m_dma->write_word(rda + 3 * width, m_reg[CRBA1]);
+	m_dma->write_word(rda + 4 * width, m_reg[RSC]);
 	m_reg[LLFA] = m_reg[CRDA] + 5 * width;
-	m_reg[CRDA] = m_bus->read_word(rda + 5 * width);
+	m_reg[CRDA] = m_dma->read_word(rda + 5 * width);
 
 	// check for end of list
 	if (m_reg[CRDA] & 1)
 		m_reg[ISR] |= ISR_RDE;
 	else
-		m_bus->write_word(rda + 6 * width, 0);
+		m_dma->write_word(rda + 6 * width, 0);
 
 	// handle buffer exhaustion
 	if (rbwc < m_reg[EOBC])
@@ -349,9 +353,9 @@ void dp83932c_device::transmit()
 
 	// read control information from tda and load registers
 	u16 const tcr = m_reg[TCR];
-	m_reg[TCR] = m_bus->read_word(tda + word++ * width) & TCR_TPC;
-	m_reg[TPS] = m_bus->read_word(tda + word++ * width);
-	m_reg[TFC] = m_bus->read_word(tda + word++ * width);
+	m_reg[TCR] = m_dma->read_word(tda + word++ * width) & TCR_TPC;
+	m_reg[TPS] = m_dma->read_word(tda + word++ * width);
+	m_reg[TFC] = m_dma->read_word(tda + word++ * width);
 
 	// check for programmable interrupt
 	if ((m_reg[TCR] & TCR_PINT) && !(tcr & TCR_PINT))
@@ -365,15 +369,15 @@ void dp83932c_device::transmit()
 	for (unsigned fragment = 0; fragment < m_reg[TFC]; fragment++)
 	{
 		// read fragment address and size
-		m_reg[TSA0] = m_bus->read_word(tda + word++ * width);
-		m_reg[TSA1] = m_bus->read_word(tda + word++ * width);
-		m_reg[TFS] = m_bus->read_word(tda + word++ * width);
+		m_reg[TSA0] = m_dma->read_word(tda + word++ * width);
+		m_reg[TSA1] = m_dma->read_word(tda + word++ * width);
+		m_reg[TFS] = m_dma->read_word(tda + word++ * width);
 
 		offs_t const tsa = EA(m_reg[TSA1], m_reg[TSA0]);
 
 		// FIXME: word/dword transfers (allow unaligned)
 		for (unsigned byte = 0; byte < m_reg[TFS]; byte++)
-			buf[length++] = m_bus->read_byte(tsa + byte);
+			buf[length++] = m_dma->read_byte(tsa + byte);
 	}
 
 	// append fcs if not inhibited
@@ -407,13 +411,13 @@ void dp83932c_device::send_complete_cb(int result)
 	}
 
 	// write descriptor status
-	m_bus->write_word(EA(m_reg[UTDA], m_reg[TTDA]), m_reg[TCR] & TCR_TPS);
+	m_dma->write_word(EA(m_reg[UTDA], m_reg[TTDA]), m_reg[TCR] & TCR_TPS);
 
 	// check for halt
 	if (!(m_reg[CR] & CR_HTX))
 	{
 		// load next descriptor address
-		m_reg[CTDA] = m_bus->read_word(EA(m_reg[UTDA], m_reg[CTDA]));
+		m_reg[CTDA] = m_dma->read_word(EA(m_reg[UTDA], m_reg[CTDA]));
 
 		// check for end of list
 		if (m_reg[CTDA] & 1)
@@ -440,10 +444,10 @@ void dp83932c_device::read_rra(bool command)
 
 	offs_t const rrp = EA(m_reg[URRA], m_reg[RRP]);
 
-	m_reg[CRBA0] = m_bus->read_word(rrp + 0 * width);
-	m_reg[CRBA1] = m_bus->read_word(rrp + 1 * width);
-	m_reg[RBWC0] = m_bus->read_word(rrp + 2 * width);
-	m_reg[RBWC1] = m_bus->read_word(rrp + 3 * width);
+	m_reg[CRBA0] = m_dma->read_word(rrp + 0 * width);
+	m_reg[CRBA1] = m_dma->read_word(rrp + 1 * width);
+	m_reg[RBWC0] = m_dma->read_word(rrp + 2 * width);
+	m_reg[RBWC1] = m_dma->read_word(rrp + 3 * width);
 
 	LOG("read_rra crba 0x%08x rbwc 0x%08x\n",
 		EA(m_reg[CRBA1], m_reg[CRBA0]), EA(m_reg[RBWC1], m_reg[RBWC0]));
@@ -472,10 +476,10 @@ void dp83932c_device::load_cam()
 	{
 		offs_t const cdp = EA(m_reg[URRA], m_reg[CDP]);
 
-		u16 const cep = m_bus->read_word(cdp + 0 * width) & 0xf;
-		u16 const cap0 = m_bus->read_word(cdp + 1 * width);
-		u16 const cap1 = m_bus->read_word(cdp + 2 * width);
-		u16 const cap2 = m_bus->read_word(cdp + 3 * width);
+		u16 const cep = m_dma->read_word(cdp + 0 * width) & 0xf;
+		u16 const cap0 = m_dma->read_word(cdp + 1 * width);
+		u16 const cap1 = m_dma->read_word(cdp + 2 * width);
+		u16 const cap2 = m_dma->read_word(cdp + 3 * width);
 
 		// FIXME: documented byte/word order doesn't match emulation
 
@@ -491,7 +495,7 @@ void dp83932c_device::load_cam()
 	}
 
 	// read cam enable
-	m_reg[CE] = m_bus->read_word(EA(m_reg[URRA], m_reg[CDP]));
+	m_reg[CE] = m_dma->read_word(EA(m_reg[URRA], m_reg[CDP]));
 	LOG("load_cam enable 0x%04x\n", m_reg[CE]);
 
 	m_reg[CR] &= ~CR_LCAM;
@@ -200,6 +200,7 @@ protected:
 
 private:
 	required_address_space m_bus;
+	memory_access_handle *m_dma;
 	devcb_write_line m_out_int;
 
 	emu_timer *m_command;
@@ -17,6 +17,8 @@
 #include "netlist/nl_parser.h"
 #include "netlist/nl_interface.h"
 
+#include "netlist/solver/nld_solver.h"
+
 #include "netlist/plib/palloc.h"
 #include "netlist/plib/pmempool.h"
 #include "netlist/plib/pdynlib.h"
@@ -26,7 +28,9 @@
 #include "romload.h"
 #include "emuopts.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <memory>
 #include <string>
 #include <utility>
@@ -70,6 +74,14 @@ DEFINE_DEVICE_TYPE(NETLIST_STREAM_OUTPUT, netlist_mame_stream_output_device, "nl
 
 extern const plib::dynlib_static_sym nl_static_solver_syms[];
 
+#if defined(_WIN32)
+static constexpr char NL_SOLVER_LIB_EXT[] = ".dll";
+#elif defined(__APPLE__)
+static constexpr char NL_SOLVER_LIB_EXT[] = ".dylib";
+#else
+static constexpr char NL_SOLVER_LIB_EXT[] = ".so";
+#endif
+
 static netlist::netlist_time_ext nltime_from_attotime(attotime t)
 {
 	netlist::netlist_time_ext nlmtime = netlist::netlist_time_ext::from_sec(t.seconds());
@@ -1036,7 +1048,24 @@ void netlist_mame_device::device_start_common()
 {
 	m_netlist = std::make_unique<netlist_mame_t>(*this, "netlist");
 
-	m_netlist->set_static_solver_lib(std::make_unique<plib::dynlib_static>(nl_static_solver_syms));
+	// solvers built into MAME come first, then any built for this netlist by an earlier run
+	auto solver_libs = std::make_unique<plib::dynlib_chain>();
+	solver_libs->add(std::make_unique<plib::dynlib_static>(nl_static_solver_syms));
+	m_solver_lib_name.clear();
+	if (*machine().options().netlist_cache_directory())
+	{
+		m_solver_lib_name = std::string("nl_") + machine().system().name + tag();
+		std::replace(m_solver_lib_name.begin(), m_solver_lib_name.end(), ':', '_');
+
+		emu_file file(machine().options().netlist_cache_directory(), OPEN_FLAG_READ);
+		if (file.open(m_solver_lib_name + NL_SOLVER_LIB_EXT) == osd_file::error::NONE)
+		{
+			pstring const path(file.fullpath());
+			file.close();
+			solver_libs->add(std::make_unique<plib::dynlib>(path));
+		}
+	}
+	m_netlist->set_static_solver_lib(std::move(solver_libs));
 
 	if (!machine().options().verbose())
 	{
@@ -1088,6 +1117,68 @@ void netlist_mame_device::device_reset()
 		netlist().free_setup_resources();
 		netlist().exec().reset();
 		m_device_reset_called = true;
+
+		if (!m_solver_lib_name.empty())
+			build_solver_library();
+	}
+}
+
+
+//-------------------------------------------------
+//  build_solver_library - if any solver has no
+//  specialised code yet, generate it and build
+//  a library for the next run to load
+//-------------------------------------------------
+
+void netlist_mame_device::build_solver_library()
+{
+	netlist::devices::nld_solver *const solver = netlist().exec().solver();
+	if (!solver)
+		return;
+
+	auto const code = solver->create_solver_code(netlist::solver::CXX_EXTERNAL_C);
+	bool const missing = std::any_of(
+			code.begin(),
+			code.end(),
+			[this] (auto const &entry) { return !netlist().static_solver_lib().getsym<void *>(entry.first); });
+	if (!missing)
+		return;
+
+	// write every solver, so the new library replaces the old one
+	emu_file file(machine().options().netlist_cache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(m_solver_lib_name + ".cpp") != osd_file::error::NONE)
+	{
+		osd_printf_warning("%s: Unable to write netlist solver code\n", tag());
+		return;
+	}
+	file.printf("// static solvers for %s %s\n\n", machine().system().name, tag());
+	for (auto const &entry : code)
+		file.puts(putf8string(entry.second).c_str());
+	std::string const source(file.fullpath());
+	file.close();
+
+	// build in the background; it's only needed by the next run
+	std::string const library(source.substr(0, source.length() - 4) + NL_SOLVER_LIB_EXT);
+	std::string const command(util::string_format("%s -o \"%s\" \"%s\"", machine().options().netlist_compiler(), library, source));
+	osd_printf_verbose("%s: Building netlist solvers: %s\n", tag(), command);
+	m_solver_build = std::async(std::launch::async, [command] () { std::system(command.c_str()); });
+}
+
+void netlist_mame_device::print_profile()
+{
+	if (!m_netlist || !netlist().exec().stats_enabled())
+		return;
+
+	auto const profile(netlist().exec().profile());
+	double const total(profile.empty() ? 0.0 : double(profile[0].m_seconds));
+	osd_printf_info("Netlist profile for %s:\n", tag());
+	osd_printf_info("%-6s %-40s %12s %10s %6s\n", "kind", "name", "calls", "seconds", "%");
+	for (auto const &entry : profile)
+	{
+		osd_printf_info("%-6s %-40s %12u %10.4f %6.2f\n",
+				putf8string(entry.m_kind).c_str(), putf8string(entry.m_name).c_str(),
+				entry.m_calls, double(entry.m_seconds),
+				(total > 0.0) ? double(entry.m_seconds) * 100.0 / total : 0.0);
 	}
 }
 
@@ -1095,7 +1186,10 @@ void netlist_mame_device::device_stop()
 {
 	LOGDEVCALLS("device_stop\n");
 	if (m_netlist)
+	{
+		print_profile();
 		netlist().exec().stop();
+	}
 #if NETLIST_CREATE_CSV
 	if (m_csv_file != nullptr)
 	{
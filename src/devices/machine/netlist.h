@@ -13,6 +13,7 @@
 
 #include <functional>
 #include <deque>
+#include <future>
 
 #include "../../lib/netlist/nltypes.h"
 
@@ -80,6 +81,9 @@ public:
 	netlist::setup_t &setup();
 	netlist_mame_t &netlist() noexcept { return *m_netlist; }
 
+	// write where time went so far; needs NL_STATS=1 in the environment
+	void print_profile();
+
 	static void register_memregion_source(netlist::nlparse_t &parser, device_t &dev, const char *name);
 
 protected:
@@ -107,12 +111,16 @@ protected:
 private:
 
 	void common_dev_start(netlist::netlist_state_t *lnetlist) const;
+	void build_solver_library();
 
 	std::unique_ptr<netlist_mame_t> m_netlist;
 
 	func_type m_setup_func;
 	bool m_device_reset_called;
 
+	std::string m_solver_lib_name;      // base name of the cached solver library, if enabled
+	std::future<void> m_solver_build;   // compiler run for solvers the library lacks
+
 #if NETLIST_CREATE_CSV
 	static constexpr int MAX_BUFFER_ENTRIES = 1000;
 
@@ -56,6 +56,47 @@ void AICADSP::init()
 	memset(this,0,sizeof(*this));
 	RBL = (8 * 1024); // Initial RBL is 0
 	Stopped = true;
+	Dirty = true;
+}
+
+void AICADSP::decode()
+{
+	// pull the fields out of each 64-bit step once rather than on every sample
+	for (int step = 0; step < 128; ++step)
+	{
+		const u16 *IPtr = MPRO + step * 8;
+		instruction &op = Program[step];
+
+		op.TRA   = (IPtr[0] >>  9) & 0x7F;
+		op.TWT   = (IPtr[0] >>  8) & 0x01;
+		op.TWA   = (IPtr[0] >>  1) & 0x7F;
+
+		op.XSEL  = (IPtr[2] >> 15) & 0x01;
+		op.YSEL  = (IPtr[2] >> 13) & 0x03;
+		op.IRA   = (IPtr[2] >>  7) & 0x3F;
+		op.IWT   = (IPtr[2] >>  6) & 0x01;
+		op.IWA   = (IPtr[2] >>  1) & 0x1F;
+
+		op.TABLE = (IPtr[4] >> 15) & 0x01;
+		op.MWT   = (IPtr[4] >> 14) & 0x01;
+		op.MRD   = (IPtr[4] >> 13) & 0x01;
+		op.EWT   = (IPtr[4] >> 12) & 0x01;
+		op.EWA   = (IPtr[4] >>  8) & 0x0F;
+		op.ADRL  = (IPtr[4] >>  7) & 0x01;
+		op.FRCL  = (IPtr[4] >>  6) & 0x01;
+		op.SHIFT = (IPtr[4] >>  4) & 0x03;
+		op.YRL   = (IPtr[4] >>  3) & 0x01;
+		op.NEGB  = (IPtr[4] >>  2) & 0x01;
+		op.ZERO  = (IPtr[4] >>  1) & 0x01;
+		op.BSEL  = (IPtr[4] >>  0) & 0x01;
+
+		op.NOFL  = (IPtr[6] >> 15) & 1;        //????
+
+		op.MASA  = (IPtr[6] >>  9) & 0x1f;  //???
+		op.ADREB = (IPtr[6] >>  8) & 0x1;
+		op.NXADR = (IPtr[6] >>  7) & 0x1;
+	}
+	Dirty = false;
 }
 
 void AICADSP::step()
@@ -69,6 +110,9 @@ void AICADSP::step()
 	if (Stopped)
 		return;
 
+	if (Dirty)
+		decode();
+
 	std::fill(std::begin(EFREG), std::end(EFREG), 0);
 #if 0
 	int dump=0;
@@ -78,40 +122,37 @@ void AICADSP::step()
 #endif
 	for (int step = 0; step < /*128*/LastStep; ++step)
 	{
-		u16 *IPtr=MPRO+step*8;
-
-//      if (IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-//          break;
-
-		const u32 TRA   = (IPtr[0] >>  9) & 0x7F;
-		const u32 TWT   = (IPtr[0] >>  8) & 0x01;
-		const u32 TWA   = (IPtr[0] >>  1) & 0x7F;
-
-		const u32 XSEL  = (IPtr[2] >> 15) & 0x01;
-		const u32 YSEL  = (IPtr[2] >> 13) & 0x03;
-		const u32 IRA   = (IPtr[2] >>  7) & 0x3F;
-		const u32 IWT   = (IPtr[2] >>  6) & 0x01;
-		const u32 IWA   = (IPtr[2] >>  1) & 0x1F;
-
-		const u32 TABLE = (IPtr[4] >> 15) & 0x01;
-		const u32 MWT   = (IPtr[4] >> 14) & 0x01;
-		const u32 MRD   = (IPtr[4] >> 13) & 0x01;
-		const u32 EWT   = (IPtr[4] >> 12) & 0x01;
-		const u32 EWA   = (IPtr[4] >>  8) & 0x0F;
-		const u32 ADRL  = (IPtr[4] >>  7) & 0x01;
-		const u32 FRCL  = (IPtr[4] >>  6) & 0x01;
-		const u32 SHIFT = (IPtr[4] >>  4) & 0x03;
-		const u32 YRL   = (IPtr[4] >>  3) & 0x01;
-		const u32 NEGB  = (IPtr[4] >>  2) & 0x01;
-		const u32 ZERO  = (IPtr[4] >>  1) & 0x01;
-		const u32 BSEL  = (IPtr[4] >>  0) & 0x01;
-
-		const u32 NOFL  = (IPtr[6] >> 15) & 1;        //????
+		const instruction &op = Program[step];
+
+		const u32 TRA   = op.TRA;
+		const u32 TWT   = op.TWT;
+		const u32 TWA   = op.TWA;
+
+		const u32 XSEL  = op.XSEL;
+		const u32 YSEL  = op.YSEL;
+		const u32 IRA   = op.IRA;
+		const u32 IWT   = op.IWT;
+		const u32 IWA   = op.IWA;
+
+		const u32 TABLE = op.TABLE;
+		const u32 MWT   = op.MWT;
+		const u32 MRD   = op.MRD;
+		const u32 EWT   = op.EWT;
+		const u32 EWA   = op.EWA;
+		const u32 ADRL  = op.ADRL;
+		const u32 FRCL  = op.FRCL;
+		const u32 SHIFT = op.SHIFT;
+		const u32 YRL   = op.YRL;
+		const u32 NEGB  = op.NEGB;
+		const u32 ZERO  = op.ZERO;
+		const u32 BSEL  = op.BSEL;
+
+		const u32 NOFL  = op.NOFL;
 		const u32 COEF  = step;
 
-		const u32 MASA  = (IPtr[6] >>  9) & 0x1f;  //???
-		const u32 ADREB = (IPtr[6] >>  8) & 0x1;
-		const u32 NXADR = (IPtr[6] >>  7) & 0x1;
+		const u32 MASA  = op.MASA;
+		const u32 ADREB = op.ADREB;
+		const u32 NXADR = op.NXADR;
 
 		//operations are done at 24 bit precision
 #if 0
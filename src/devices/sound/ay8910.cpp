@@ -1341,6 +1341,10 @@ void ay8910_device::device_start()
 
 void ay8910_device::ay8910_reset_ym()
 {
+	/* apply anything queued before the reset */
+	if (m_channel->deferring_writes())
+		m_channel->update();
+
 	m_active = false;
 	m_register_latch = 0;
 	m_rng = 1;
@@ -1403,13 +1407,21 @@ void ay8910_device::ay8910_write_ym(int addr, u8 data)
 		{
 			const u8 register_latch = m_register_latch + get_register_bank();
 			/* Data port */
-			if (m_register_latch == AY_EASHAPE || m_regs[register_latch] != data)
+			if (m_channel->deferring_writes() && register_latch < AY_EASHAPE && register_latch != AY_ENABLE)
 			{
-				/* update the output buffer before changing the register */
-				m_channel->update();
+				/* periods and volumes only affect the output, so they can wait for the next update */
+				m_channel->timed_write([this, register_latch, data] () { ay8910_write_reg(register_latch, data); });
 			}
+			else
+			{
+				if (m_channel->deferring_writes() || m_register_latch == AY_EASHAPE || m_regs[register_latch] != data)
+				{
+					/* update the output buffer before changing the register */
+					m_channel->update();
+				}
 
-			ay8910_write_reg(register_latch, data);
+				ay8910_write_reg(register_latch, data);
+			}
 		}
 	}
 	else
@@ -1440,6 +1452,10 @@ u8 ay8910_device::ay8910_read_ym()
 	/* There are no state dependent register in the AY8910! */
 	/* m_channel->update(); */
 
+	/* but queued writes must land before the registers are read back */
+	if (m_channel->deferring_writes())
+		m_channel->update();
+
 	switch (r)
 	{
 	case AY_PORTA:
@@ -139,21 +139,22 @@ void dac_device_base::sound_stream_update(sound_stream &stream, std::vector<read
 	// constant lo, streaming hi
 	if (!BIT(m_specified_inputs_mask, DAC_INPUT_RANGE_LO))
 	{
-		for (int sampindex = 0; sampindex < out.samples(); sampindex++)
-			out.put(sampindex, m_range_min + m_curval * (hi.get(sampindex) - m_range_min));
+		out.copy(hi);
+		out.scale(m_curval, m_range_min * (1.0f - m_curval));
 	}
 
 	// constant hi, streaming lo
 	else if (!BIT(m_specified_inputs_mask, DAC_INPUT_RANGE_HI))
 	{
-		for (int sampindex = 0; sampindex < out.samples(); sampindex++)
-			out.put(sampindex, lo.get(sampindex) + m_curval * (m_range_max - lo.get(sampindex)));
+		out.copy(lo);
+		out.scale(1.0f - m_curval, m_curval * m_range_max);
 	}
 
 	// both streams provided
 	else
 	{
-		for (int sampindex = 0; sampindex < out.samples(); sampindex++)
-			out.put(sampindex, lo.get(sampindex) + m_curval * (hi.get(sampindex) - lo.get(sampindex)));
+		out.copy(lo);
+		out.scale(1.0f - m_curval);
+		out.add(read_stream_view(hi).apply_gain(m_curval));
 	}
 }
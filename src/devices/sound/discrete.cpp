@@ -120,6 +120,14 @@ public:
 	//const linked_list_entry *list;
 	discrete_device::node_step_list_t        step_list;
 
+	/* flat evaluation schedule, step_list with the step functions resolved */
+	struct scheduled_step
+	{
+		discrete_step_interface::step_func  func;
+		discrete_step_interface *           node;
+	};
+	std::vector<scheduled_step>  schedule;
+
 	/* list of source nodes */
 	std::vector<input_buffer> source_list;      /* discrete_source_node */
 
@@ -184,10 +192,10 @@ inline void discrete_task::step_nodes()
 
 	if (EXPECTED(!m_device.profiling()))
 	{
-		for (discrete_step_interface *entry : step_list)
+		for (const scheduled_step &entry : schedule)
 		{
 			/* Now step the node */
-			entry->step();
+			entry.func(*entry.node);
 		}
 	}
 	else
@@ -761,7 +769,13 @@ void discrete_device::init_nodes(const sound_block_list_t &block_list)
 			if (task == nullptr)
 				fatalerror("init_nodes() - found node outside of task: %s\n", node.module_name());
 			else
+			{
 				task->step_list.push_back(step);
+				if (step->step_call)
+					task->schedule.push_back({ step->step_call, step });
+				else
+					task->schedule.push_back({ [] (discrete_step_interface &intf) { intf.step(); }, step });
+			}
 		}
 
 		if (USE_DISCRETE_TASKS &&  block.type == DSO_TASK_END)
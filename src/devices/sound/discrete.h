@@ -4143,11 +4143,15 @@ struct discrete_block
 class discrete_step_interface
 {
 public:
+	/* non-virtual entry point into a node's step(), filled in by the node factory */
+	typedef void (*step_func)(discrete_step_interface &);
+
 	virtual ~discrete_step_interface() { }
 
 	virtual void step() = 0;
 	osd_ticks_t         run_time;
 	discrete_base_node *    self;
+	step_func           step_call = nullptr;
 };
 
 class discrete_input_interface
@@ -4410,11 +4414,17 @@ class discrete_node_factory
 public:
 	static std::unique_ptr<discrete_base_node> create(discrete_device &pdev, const discrete_block &block)
 	{
-		std::unique_ptr<discrete_base_node> r = make_unique_clear<C>();
+		std::unique_ptr<C> r = make_unique_clear<C>();
 
 		r->init(&pdev, &block);
+		if constexpr (std::is_base_of_v<discrete_step_interface, C>)
+			r->step_call = &step;
 		return r;
 	}
+
+private:
+	/* qualified call: the compiler can inline C::step() here rather than going through the vtable */
+	static void step(discrete_step_interface &intf) { static_cast<C &>(intf).C::step(); }
 };
 
 /*************************************
@@ -683,15 +683,29 @@ void multipcm_device::dump_sample(slot_t &slot)
 
 void multipcm_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
 {
-	for (int32_t i = 0; i < outputs[0].samples(); ++i)
+	for (int32_t base = 0; base < outputs[0].samples(); base += mixer_t::BLOCK_SAMPLES)
 	{
-		int32_t smpl = 0;
-		int32_t smpr = 0;
+		int32_t const samples = std::min<int32_t>(outputs[0].samples() - base, mixer_t::BLOCK_SAMPLES);
+		m_mixer.reset(samples);
+
+		// render each slot across the whole block, then accumulate it
 		for (int32_t sl = 0; sl < 28; ++sl)
 		{
 			slot_t &slot = m_slots[sl];
-			if (slot.m_playing)
+			if (!slot.m_playing)
+				continue;
+
+			s32 *const voice = m_mixer.voice();
+			s32 *const left = m_mixer.gain(0);
+			s32 *const right = m_mixer.gain(1);
+			for (int32_t i = 0; i < samples; ++i)
 			{
+				if (!slot.m_playing)
+				{
+					voice[i] = left[i] = right[i] = 0;
+					continue;
+				}
+
 				uint32_t vol = (slot.m_total_level >> TL_SHIFT) | (slot.m_pan << 7);
 				uint32_t spos = slot.m_offset >> TL_SHIFT;
 				uint32_t step = slot.m_step;
@@ -734,7 +748,7 @@ void multipcm_device::sound_stream_update(sound_stream &stream, std::vector<read
 					csample = (int16_t)(read_byte(slot.m_base + spos) << 8);
 				}
 
-				int32_t sample = (csample * fpart + slot.m_prev_sample * ((1 << TL_SHIFT) - fpart)) >> TL_SHIFT;
+				int32_t sample = pcm_interpolate_linear<TL_SHIFT>(slot.m_prev_sample, csample, fpart);
 
 				if (slot.m_regs[6] & 7) // Vibrato enabled
 				{
@@ -764,15 +778,15 @@ void multipcm_device::sound_stream_update(sound_stream &stream, std::vector<read
 					sample >>= TL_SHIFT;
 				}
 
-				sample = (sample * envelope_generator_update(slot)) >> 10;
-
-				smpl += (m_left_pan_table[vol] * sample) >> TL_SHIFT;
-				smpr += (m_right_pan_table[vol] * sample) >> TL_SHIFT;
+				voice[i] = (sample * envelope_generator_update(slot)) >> 10;
+				left[i] = m_left_pan_table[vol];
+				right[i] = m_right_pan_table[vol];
 			}
+			m_mixer.mix(TL_SHIFT);
 		}
 
-		outputs[0].put_int_clamp(i, smpl, 32768);
-		outputs[1].put_int_clamp(i, smpr, 32768);
+		m_mixer.output(outputs[0], 0, base, 32768);
+		m_mixer.output(outputs[1], 1, base, 32768);
 	}
 }
 
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "dirom.h"
+#include "pcmvoice.h"
 
 #define MULTIPCM_LOG_SAMPLES    0
 
@@ -99,9 +100,12 @@ private:
 		uint8_t m_format;
 	};
 
+	typedef pcm_voice_mixer<2> mixer_t;
+
 	// internal state
 	sound_stream *m_stream;
 	std::unique_ptr<slot_t[]> m_slots;
+	mixer_t m_mixer;
 	uint32_t m_cur_slot;
 	uint32_t m_address;
 	float m_rate;
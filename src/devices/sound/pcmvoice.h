@@ -0,0 +1,85 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    pcmvoice.h
+
+    Shared helpers for sample playback chips that render their voices a
+    block at a time.
+
+    A chip renders each active voice into the mixer's voice buffer along
+    with one gain per output channel per sample, then calls mix() to
+    accumulate it.  Keeping the per-voice state machine in a tight inner
+    loop and the accumulation in plain array loops lets the compiler
+    vectorise the latter.
+
+***************************************************************************/
+
+#ifndef MAME_SOUND_PCMVOICE_H
+#define MAME_SOUND_PCMVOICE_H
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+
+
+// ======================> pcm_interpolate_linear
+
+// interpolate between two samples; frac runs from 0 to (1 << Shift) - 1
+template <int Shift>
+constexpr s32 pcm_interpolate_linear(s32 prev, s32 next, s32 frac)
+{
+	return (next * frac + prev * ((1 << Shift) - frac)) >> Shift;
+}
+
+
+// ======================> pcm_voice_mixer
+
+template <int Channels, int BlockSamples = 256>
+class pcm_voice_mixer
+{
+public:
+	static constexpr int BLOCK_SAMPLES = BlockSamples;
+
+	// start a new block of the given number of samples
+	void reset(int samples)
+	{
+		m_samples = samples;
+		for (auto &acc : m_accum)
+			std::fill_n(acc.begin(), samples, 0);
+	}
+
+	// buffers a voice renders into
+	s32 *voice() { return m_voice.data(); }
+	s32 *gain(int channel) { return m_gain[channel].data(); }
+
+	// accumulate the rendered voice: accum += (voice * gain) >> shift
+	void mix(int shift)
+	{
+		s32 const *const src = m_voice.data();
+		for (int ch = 0; ch < Channels; ch++)
+		{
+			s32 *const dest = m_accum[ch].data();
+			s32 const *const gain = m_gain[ch].data();
+			for (int i = 0; i < m_samples; i++)
+				dest[i] += (src[i] * gain[i]) >> shift;
+		}
+	}
+
+	// write the accumulated block to a stream starting at the given sample
+	void output(write_stream_view &dest, int channel, int start, s32 max)
+	{
+		s32 const *const src = m_accum[channel].data();
+		for (int i = 0; i < m_samples; i++)
+			dest.put_int_clamp(start + i, src[i], max);
+	}
+
+private:
+	int m_samples = 0;
+	std::array<s32, BlockSamples> m_voice;
+	std::array<std::array<s32, BlockSamples>, Channels> m_gain;
+	std::array<std::array<s32, BlockSamples>, Channels> m_accum;
+};
+
+#endif // MAME_SOUND_PCMVOICE_H
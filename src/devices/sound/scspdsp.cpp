@@ -63,6 +63,48 @@ void SCSPDSP::Init()
 	std::memset(this, 0, sizeof(*this));
 	RBL = (8*1024); // Initial RBL is 0
 	Stopped = true;
+	Dirty = true;
+}
+
+void SCSPDSP::Decode()
+{
+	// pull the fields out of each 64-bit step once rather than on every sample
+	for (int step = 0; step < 128; ++step)
+	{
+		u16 const *const IPtr = MPRO + (step * 4);
+		Instruction &op = Program[step];
+
+		op.TRA   = (IPtr[0] >>  8) & 0x7F;
+		op.TWT   = (IPtr[0] >>  7) & 0x01;
+		op.TWA   = (IPtr[0] >>  0) & 0x7F;
+
+		op.XSEL  = (IPtr[1] >> 15) & 0x01;
+		op.YSEL  = (IPtr[1] >> 13) & 0x03;
+		op.IRA   = (IPtr[1] >>  6) & 0x3F;
+		op.IWT   = (IPtr[1] >>  5) & 0x01;
+		op.IWA   = (IPtr[1] >>  0) & 0x1F;
+
+		op.TABLE = (IPtr[2] >> 15) & 0x01;
+		op.MWT   = (IPtr[2] >> 14) & 0x01;
+		op.MRD   = (IPtr[2] >> 13) & 0x01;
+		op.EWT   = (IPtr[2] >> 12) & 0x01;
+		op.EWA   = (IPtr[2] >>  8) & 0x0F;
+		op.ADRL  = (IPtr[2] >>  7) & 0x01;
+		op.FRCL  = (IPtr[2] >>  6) & 0x01;
+		op.SHIFT = (IPtr[2] >>  4) & 0x03;
+		op.YRL   = (IPtr[2] >>  3) & 0x01;
+		op.NEGB  = (IPtr[2] >>  2) & 0x01;
+		op.ZERO  = (IPtr[2] >>  1) & 0x01;
+		op.BSEL  = (IPtr[2] >>  0) & 0x01;
+
+		op.NOFL  = (IPtr[3] >> 15) & 0x01;  //????
+		op.COEF  = (IPtr[3] >>  9) & 0x3f;
+
+		op.MASA  = (IPtr[3] >>  2) & 0x1f;  //???
+		op.ADREB = (IPtr[3] >>  1) & 0x01;
+		op.NXADR = (IPtr[3] >>  0) & 0x01;
+	}
+	Dirty = false;
 }
 
 void SCSPDSP::Step()
@@ -70,6 +112,9 @@ void SCSPDSP::Step()
 	if (Stopped)
 		return;
 
+	if (Dirty)
+		Decode();
+
 	std::fill(std::begin(EFREG), std::end(EFREG), 0);
 
 #if 0
@@ -87,40 +132,37 @@ void SCSPDSP::Step()
 
 	for (int step = 0; step < /*128*/LastStep; ++step)
 	{
-		u16 *const IPtr = MPRO + (step * 4);
-
-		//if (!IPtr[0] && !IPtr[1] && !IPtr[2] && !IPtr[3])
-			//break;
-
-		u32 const TRA   = (IPtr[0] >>  8) & 0x7F;
-		u32 const TWT   = (IPtr[0] >>  7) & 0x01;
-		u32 const TWA   = (IPtr[0] >>  0) & 0x7F;
-
-		u32 const XSEL  = (IPtr[1] >> 15) & 0x01;
-		u32 const YSEL  = (IPtr[1] >> 13) & 0x03;
-		u32 const IRA   = (IPtr[1] >>  6) & 0x3F;
-		u32 const IWT   = (IPtr[1] >>  5) & 0x01;
-		u32 const IWA   = (IPtr[1] >>  0) & 0x1F;
-
-		u32 const TABLE = (IPtr[2] >> 15) & 0x01;
-		u32 const MWT   = (IPtr[2] >> 14) & 0x01;
-		u32 const MRD   = (IPtr[2] >> 13) & 0x01;
-		u32 const EWT   = (IPtr[2] >> 12) & 0x01;
-		u32 const EWA   = (IPtr[2] >>  8) & 0x0F;
-		u32 const ADRL  = (IPtr[2] >>  7) & 0x01;
-		u32 const FRCL  = (IPtr[2] >>  6) & 0x01;
-		u32 const SHIFT = (IPtr[2] >>  4) & 0x03;
-		u32 const YRL   = (IPtr[2] >>  3) & 0x01;
-		u32 const NEGB  = (IPtr[2] >>  2) & 0x01;
-		u32 const ZERO  = (IPtr[2] >>  1) & 0x01;
-		u32 const BSEL  = (IPtr[2] >>  0) & 0x01;
-
-		u32 const NOFL  = (IPtr[3] >> 15) & 0x01;  //????
-		u32 const COEF  = (IPtr[3] >>  9) & 0x3f;
-
-		u32 const MASA  = (IPtr[3] >>  2) & 0x1f;  //???
-		u32 const ADREB = (IPtr[3] >>  1) & 0x01;
-		u32 const NXADR = (IPtr[3] >>  0) & 0x01;
+		Instruction const &op = Program[step];
+
+		u32 const TRA   = op.TRA;
+		u32 const TWT   = op.TWT;
+		u32 const TWA   = op.TWA;
+
+		u32 const XSEL  = op.XSEL;
+		u32 const YSEL  = op.YSEL;
+		u32 const IRA   = op.IRA;
+		u32 const IWT   = op.IWT;
+		u32 const IWA   = op.IWA;
+
+		u32 const TABLE = op.TABLE;
+		u32 const MWT   = op.MWT;
+		u32 const MRD   = op.MRD;
+		u32 const EWT   = op.EWT;
+		u32 const EWA   = op.EWA;
+		u32 const ADRL  = op.ADRL;
+		u32 const FRCL  = op.FRCL;
+		u32 const SHIFT = op.SHIFT;
+		u32 const YRL   = op.YRL;
+		u32 const NEGB  = op.NEGB;
+		u32 const ZERO  = op.ZERO;
+		u32 const BSEL  = op.BSEL;
+
+		u32 const NOFL  = op.NOFL;
+		u32 const COEF  = op.COEF;
+
+		u32 const MASA  = op.MASA;
+		u32 const ADREB = op.ADREB;
+		u32 const NXADR = op.NXADR;
 
 		//operations are done at 24 bit precision
 #if 0
@@ -306,21 +306,29 @@ void sn76496_base_device::device_timer(emu_timer &timer, device_timer_id id, int
 
 void sn76496_base_device::write(u8 data)
 {
-	int n, r, c;
+	// latch the register now so following data bytes go to the right place
+	int const r = (data & 0x80) ? ((data & 0x70) >> 4) : m_last_register;
+	m_last_register = r;
 
-	// update the output buffer before changing the registers
-	m_sound->update();
+	// update the output buffer before changing the registers, or queue the change for the next update
+	m_sound->timed_write([this, r, data] () { write_register(r, data); });
+
+	m_ready_state = false;
+	m_ready_handler(CLEAR_LINE);
+	m_ready_timer->adjust(attotime::from_hz(clock()/(4*m_clock_divider)));
+}
+
+void sn76496_base_device::write_register(int r, u8 data)
+{
+	int n, c;
 
 	if (data & 0x80)
 	{
-		r = (data & 0x70) >> 4;
-		m_last_register = r;
 		if (((m_ncr_style_psg) && (r == 6)) && ((data&0x04) != (m_register[6]&0x04))) m_RNG = m_feedback_mask; // NCR-style PSG resets the LFSR only on a mode write which actually changes the state of bit 2 of register 6
 		m_register[r] = (m_register[r] & 0x3f0) | (data & 0x0f);
 	}
 	else
 	{
-		r = m_last_register;
 		//if ((m_ncr_style_psg) && ((r & 1) || (r == 6))) return; // NCR-style PSG ignores writes to regs 1, 3, 5, 6 and 7 with bit 7 clear; this behavior is not verified on hardware yet, uncomment it once verified.
 	}
 
@@ -358,10 +366,6 @@ void sn76496_base_device::write(u8 data)
 			}
 			break;
 	}
-
-	m_ready_state = false;
-	m_ready_handler(CLEAR_LINE);
-	m_ready_timer->adjust(attotime::from_hz(clock()/(4*m_clock_divider)));
 }
 
 inline bool sn76496_base_device::in_noise_mode()
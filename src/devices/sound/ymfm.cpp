@@ -2087,10 +2087,11 @@ void ymopll_registers::log_keyon(u32 choffs, u32 opoffs)
 //-------------------------------------------------
 
 template<class RegisterType>
-ymfm_operator<RegisterType>::ymfm_operator(ymfm_engine_base<RegisterType> &owner, u32 opoffs) :
+ymfm_operator<RegisterType>::ymfm_operator(ymfm_engine_base<RegisterType> &owner, u32 opoffs, u32 &phase, u32 &phase_step) :
 	m_choffs(0),
 	m_opoffs(opoffs),
-	m_phase(0),
+	m_phase(phase),
+	m_phase_step(phase_step),
 	m_env_attenuation(0x3ff),
 	m_env_state(YMFM_ENV_RELEASE),
 	m_ssg_inverted(false),
@@ -2099,6 +2100,8 @@ ymfm_operator<RegisterType>::ymfm_operator(ymfm_engine_base<RegisterType> &owner
 	m_regs(owner.regs()),
 	m_owner(owner)
 {
+	m_phase = 0;
+	m_phase_step = 0;
 }
 
 
@@ -2465,8 +2468,8 @@ void ymfm_operator<RegisterType>::clock_phase(s32 lfo_raw_pm)
 	if (phase_step == ymfm_opdata_cache::PHASE_STEP_DYNAMIC)
 		phase_step = m_regs.compute_phase_step(m_choffs, m_opoffs, m_cache, lfo_raw_pm);
 
-	// finally apply the step to the current phase value
-	m_phase += phase_step;
+	// the engine applies the step to all the operators' phases at once
+	m_phase_step = phase_step;
 }
 
 
@@ -2885,7 +2888,7 @@ ymfm_engine_base<RegisterType>::ymfm_engine_base(device_t &device) :
 
 	// create the operators
 	for (int opnum = 0; opnum < OPERATORS; opnum++)
-		m_operator[opnum] = std::make_unique<ymfm_operator<RegisterType>>(*this, RegisterType::operator_offset(opnum));
+		m_operator[opnum] = std::make_unique<ymfm_operator<RegisterType>>(*this, RegisterType::operator_offset(opnum), m_phase[opnum], m_phase_step[opnum]);
 
 	// do the initial operator assignment
 	assign_operators();
@@ -2991,11 +2994,17 @@ u32 ymfm_engine_base<RegisterType>::clock(u32 chanmask)
 	// clock the noise generator
 	s32 lfo_raw_pm = m_regs.clock_noise_and_lfo();
 
-	// now update the state of all the channels and operators
+	// now update the state of all the channels and operators; operators that
+	// aren't clocked leave their step at 0
+	std::fill_n(m_phase_step, OPERATORS, 0);
 	for (int chnum = 0; chnum < CHANNELS; chnum++)
 		if (BIT(chanmask, chnum))
 			m_channel[chnum]->clock(m_env_counter, lfo_raw_pm);
 
+	// then step every phase in one flat pass, which vectorises
+	for (int opnum = 0; opnum < OPERATORS; opnum++)
+		m_phase[opnum] += m_phase_step[opnum];
+
 	// return the envelope counter as it is used to clock ADPCM-A
 	return m_env_counter;
 }
@@ -1109,8 +1109,8 @@ class ymfm_operator
 	static constexpr u32 ENV_QUIET = 0x200;
 
 public:
-	// constructor
-	ymfm_operator(ymfm_engine_base<RegisterType> &owner, u32 opoffs);
+	// constructor; the phase and its step live in the engine's arrays
+	ymfm_operator(ymfm_engine_base<RegisterType> &owner, u32 opoffs, u32 &phase, u32 &phase_step);
 
 	// register for save states
 	void save(device_t &device, u32 index);
@@ -1161,7 +1161,8 @@ private:
 	// internal state
 	u32 m_choffs;                    // channel offset in registers
 	u32 m_opoffs;                    // operator offset in registers
-	u32 m_phase;                     // current phase value (10.10 format)
+	u32 &m_phase;                    // current phase value (10.10 format)
+	u32 &m_phase_step;               // phase step to apply on this clock
 	u16 m_env_attenuation;           // computed envelope attenuation (4.6 format)
 	ymfm_envelope_state m_env_state; // current envelope state
 	u8 m_ssg_inverted;               // non-zero if the output should be inverted (bit 0)
@@ -1370,6 +1371,8 @@ protected:
 	RegisterType m_regs;             // register accessor
 	std::unique_ptr<ymfm_channel<RegisterType>> m_channel[CHANNELS]; // channel pointers
 	std::unique_ptr<ymfm_operator<RegisterType>> m_operator[OPERATORS]; // operator pointers
+	u32 m_phase[OPERATORS];          // operator phases, kept together so they step in one pass
+	u32 m_phase_step[OPERATORS];     // operator phase steps for the current clock
 };
 
 
@@ -13,6 +13,7 @@ epic12_device::epic12_device(const machine_config &mconfig, const char *tag, dev
 	, device_video_interface(mconfig, *this)
 	, m_ram16(nullptr), m_gfx_size(0), m_bitmaps(nullptr), m_use_ram(nullptr)
 	, m_main_ramsize(0), m_main_rammask(0), m_ram16_copy(nullptr), m_work_queue(nullptr)
+	, m_band_queue(nullptr), m_blit_band_count(0), m_blit_splittable(false)
 	, m_maincpu(*this, finder_base::DUMMY_TAG)
 	, m_port_r_cb(*this)
 {
@@ -58,6 +59,10 @@ void epic12_device::device_start()
 
 	m_ram16_copy = std::make_unique<u16[]>(m_main_ramsize / 2);
 
+	m_band_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	for (blit_band &band : m_blit_bands)
+		band.device = this;
+
 	m_blitter_delay_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(epic12_device::blitter_delay_callback),this));
 	m_blitter_delay_timer->adjust(attotime::never);
 
@@ -111,6 +116,12 @@ void epic12_device::device_reset()
 	m_blitter_busy = 0;
 }
 
+void epic12_device::device_stop()
+{
+	if (m_band_queue)
+		osd_work_queue_free(m_band_queue);
+}
+
 // todo, get these into the device class without ruining performance
 u8 epic12_device::colrtable[0x20][0x40];
 u8 epic12_device::colrtable_rev[0x20][0x40];
@@ -177,6 +188,9 @@ inline void epic12_device::gfx_upload_shadow_copy(address_space &space, offs_t *
 			COPY_NEXT_WORD(space, addr);
 		}
 	}
+
+	// uploads aren't clipped, so keep lists containing them in one piece
+	m_blit_splittable = false;
 }
 
 inline void epic12_device::gfx_upload(offs_t *addr)
@@ -217,7 +231,7 @@ inline void epic12_device::gfx_upload(offs_t *addr)
 	}
 }
 
-#define draw_params m_bitmaps.get(), &m_clip, &m_bitmaps->pix(0,0),src_x,src_y, x,y, dimx,dimy, flipy, s_alpha, d_alpha, &tint_clr
+#define draw_params m_bitmaps.get(), &clip, &m_bitmaps->pix(0,0),src_x,src_y, x,y, dimx,dimy, flipy, s_alpha, d_alpha, &tint_clr
 
 
 const epic12_device::blitfunction epic12_device::f0_ti1_tr1_blit_funcs[64] =
@@ -358,9 +372,9 @@ inline void epic12_device::gfx_draw_shadow_copy(address_space &space, offs_t *ad
 	COPY_NEXT_WORD(space, addr);
 	COPY_NEXT_WORD(space, addr);
 	COPY_NEXT_WORD(space, addr);
-	COPY_NEXT_WORD(space, addr);
+	const u16 src_y = COPY_NEXT_WORD(space, addr);
 	COPY_NEXT_WORD(space, addr); // const u16 dst_x_start = COPY_NEXT_WORD(space, addr);
-	COPY_NEXT_WORD(space, addr); // const u16 dst_y_start = COPY_NEXT_WORD(space, addr);
+	const u16 dst_y_start = COPY_NEXT_WORD(space, addr);
 	const u16 w = COPY_NEXT_WORD(space, addr);
 	const u16 h = COPY_NEXT_WORD(space, addr);
 	COPY_NEXT_WORD(space, addr);
@@ -368,10 +382,20 @@ inline void epic12_device::gfx_draw_shadow_copy(address_space &space, offs_t *ad
 
 	// todo, calcualte clipping.
 	blit_delay += w * h;
+
+	// note the VRAM rows this reads and writes, so the list can be split into bands when they don't overlap
+	const int y = (dst_y_start & 0x7fff) - (dst_y_start & 0x8000);
+	const int dimy = (h & 0x0fff) + 1;
+	for (int i = 0; i < dimy; i++)
+	{
+		m_blit_rows_read[(src_y + i) & 0x0fff] = true;
+		if (y + i >= m_clip.min_y && y + i <= std::min(m_clip.max_y, 0x0fff))
+			m_blit_rows_written[y + i] = true;
+	}
 }
 
 
-inline void epic12_device::gfx_draw(offs_t *addr)
+inline void epic12_device::gfx_draw(offs_t *addr, const rectangle &clip)
 {
 	clr_t tint_clr;
 	bool tinted = false;
@@ -620,10 +644,11 @@ void epic12_device::gfx_create_shadow_copy(address_space &space)
 }
 
 
-void epic12_device::gfx_exec(void)
+void epic12_device::gfx_exec(const rectangle &band)
 {
 	offs_t addr = m_gfx_addr_shadowcopy & 0x1fffffff;
-	m_clip.set(m_gfx_scroll_1_x_shadowcopy, m_gfx_scroll_1_x_shadowcopy + 320 - 1, m_gfx_scroll_1_y_shadowcopy, m_gfx_scroll_1_y_shadowcopy + 240 - 1);
+	rectangle clip(m_gfx_scroll_1_x_shadowcopy, m_gfx_scroll_1_x_shadowcopy + 320 - 1, m_gfx_scroll_1_y_shadowcopy, m_gfx_scroll_1_y_shadowcopy + 240 - 1);
+	clip &= band;
 
 //  logerror("GFX EXEC: %08X\n", addr);
 
@@ -640,9 +665,10 @@ void epic12_device::gfx_exec(void)
 
 			case 0xc000:
 				if (READ_NEXT_WORD(&addr)) // cliptype
-					m_clip.set(m_gfx_scroll_1_x_shadowcopy, m_gfx_scroll_1_x_shadowcopy + 320 - 1, m_gfx_scroll_1_y_shadowcopy, m_gfx_scroll_1_y_shadowcopy + 240 - 1);
+					clip.set(m_gfx_scroll_1_x_shadowcopy, m_gfx_scroll_1_x_shadowcopy + 320 - 1, m_gfx_scroll_1_y_shadowcopy, m_gfx_scroll_1_y_shadowcopy + 240 - 1);
 				else
-					m_clip.set(0, 0x2000 - 1, 0, 0x1000 - 1);
+					clip.set(0, 0x2000 - 1, 0, 0x1000 - 1);
+				clip &= band;
 				break;
 
 			case 0x2000:
@@ -652,7 +678,7 @@ void epic12_device::gfx_exec(void)
 
 			case 0x1000:
 				addr -= 2;
-				gfx_draw(&addr);
+				gfx_draw(&addr, clip);
 				break;
 
 			default:
@@ -666,7 +692,7 @@ void epic12_device::gfx_exec(void)
 void epic12_device::gfx_exec_unsafe(void)
 {
 	offs_t addr = m_gfx_addr & 0x1fffffff;
-	m_clip.set(m_gfx_scroll_1_x, m_gfx_scroll_1_x + 320 - 1, m_gfx_scroll_1_y, m_gfx_scroll_1_y + 240 - 1);
+	rectangle clip(m_gfx_scroll_1_x, m_gfx_scroll_1_x + 320 - 1, m_gfx_scroll_1_y, m_gfx_scroll_1_y + 240 - 1);
 
 //  logerror("GFX EXEC: %08X\n", addr);
 
@@ -683,9 +709,9 @@ void epic12_device::gfx_exec_unsafe(void)
 
 			case 0xc000:
 				if (READ_NEXT_WORD(&addr)) // cliptype
-					m_clip.set(m_gfx_scroll_1_x, m_gfx_scroll_1_x + 320 - 1, m_gfx_scroll_1_y, m_gfx_scroll_1_y + 240 - 1);
+					clip.set(m_gfx_scroll_1_x, m_gfx_scroll_1_x + 320 - 1, m_gfx_scroll_1_y, m_gfx_scroll_1_y + 240 - 1);
 				else
-					m_clip.set(0, 0x2000 - 1, 0, 0x1000 - 1);
+					clip.set(0, 0x2000 - 1, 0, 0x1000 - 1);
 				break;
 
 			case 0x2000:
@@ -695,7 +721,7 @@ void epic12_device::gfx_exec_unsafe(void)
 
 			case 0x1000:
 				addr -= 2;
-				gfx_draw(&addr);
+				gfx_draw(&addr, clip);
 				break;
 
 			default:
@@ -706,11 +732,33 @@ void epic12_device::gfx_exec_unsafe(void)
 }
 
 
+void epic12_device::gfx_exec_bands()
+{
+	// the blits clip against their band's rows, so the bands write disjoint parts of VRAM
+	if (m_blit_band_count > 1)
+		osd_work_item_queue_multiple(m_band_queue, blit_band_callback, m_blit_band_count - 1, &m_blit_bands[1], sizeof(m_blit_bands[1]), WORK_ITEM_FLAG_AUTO_RELEASE);
+
+	gfx_exec(m_blit_bands[0].rows);
+
+	if (m_blit_band_count > 1)
+		osd_work_queue_wait(m_band_queue, osd_ticks_per_second() * 100);
+}
+
+
+void *epic12_device::blit_band_callback(void *param, int threadid)
+{
+	blit_band const *band = reinterpret_cast<blit_band const *>(param);
+
+	band->device->gfx_exec(band->rows);
+	return nullptr;
+}
+
+
 void *epic12_device::blit_request_callback(void *param, int threadid)
 {
 	epic12_device *object = reinterpret_cast<epic12_device *>(param);
 
-	object->gfx_exec();
+	object->gfx_exec_bands();
 	return nullptr;
 }
 
@@ -759,20 +807,47 @@ void epic12_device::gfx_exec_w(address_space &space, offs_t offset, u32 data, u3
 				osd_work_item_release(m_blitter_request);
 			}
 
+			// latch the registers first, the rows noted while copying the list are clipped the way the blit will be
+			m_gfx_addr_shadowcopy = m_gfx_addr;
+			m_gfx_scroll_0_x_shadowcopy = m_gfx_scroll_0_x;
+			m_gfx_scroll_0_y_shadowcopy = m_gfx_scroll_0_y;
+			m_gfx_scroll_1_x_shadowcopy = m_gfx_scroll_1_x;
+			m_gfx_scroll_1_y_shadowcopy = m_gfx_scroll_1_y;
+
 			blit_delay = 0;
+			m_blit_splittable = true;
+			m_blit_rows_read.reset();
+			m_blit_rows_written.reset();
 			gfx_create_shadow_copy(space); // create a copy of the blit list so we can safely thread it.
 
+			// split the destination rows into bands if no draw reads what another writes
+			if (m_blit_splittable && (m_blit_rows_read & m_blit_rows_written).none() && m_blit_rows_written.any())
+			{
+				int first = 0, last = 0x0fff;
+				while (!m_blit_rows_written[first])
+					first++;
+				while (!m_blit_rows_written[last])
+					last--;
+
+				const int rows = (last - first + BLIT_BANDS) / BLIT_BANDS;
+				m_blit_band_count = 0;
+				for (int y = first; y <= last; y += rows)
+					m_blit_bands[m_blit_band_count++].rows.set(0, 0x2000 - 1, y, std::min(y + rows - 1, last));
+				m_blit_bands[0].rows.min_y = 0;
+				m_blit_bands[m_blit_band_count - 1].rows.max_y = 0x1000 - 1;
+			}
+			else
+			{
+				m_blit_band_count = 1;
+				m_blit_bands[0].rows.set(0, 0x2000 - 1, 0, 0x1000 - 1);
+			}
+
 			if (blit_delay)
 			{
 				m_blitter_busy = 1;
 				m_blitter_delay_timer->adjust(attotime::from_nsec(blit_delay*8)); // NOT accurate timing (currently ignored anyway)
 			}
 
-			m_gfx_addr_shadowcopy = m_gfx_addr;
-			m_gfx_scroll_0_x_shadowcopy = m_gfx_scroll_0_x;
-			m_gfx_scroll_0_y_shadowcopy = m_gfx_scroll_0_y;
-			m_gfx_scroll_1_x_shadowcopy = m_gfx_scroll_1_x;
-			m_gfx_scroll_1_y_shadowcopy = m_gfx_scroll_1_y;
 			m_blitter_request = osd_work_item_queue(m_work_queue, blit_request_callback, (void*)this, 0);
 			//g_profiler.stop();
 		}
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <bitset>
+
 #define DEBUG_VRAM_VIEWER 0 // VRAM viewer for debug
 
 class epic12_device : public device_t, public device_video_interface
@@ -64,8 +66,10 @@ public:
 	inline u16 COPY_NEXT_WORD(address_space &space, offs_t *addr);
 	inline void gfx_draw_shadow_copy(address_space &space, offs_t *addr);
 	inline void gfx_upload(offs_t *addr);
-	inline void gfx_draw(offs_t *addr);
-	void gfx_exec(void);
+	inline void gfx_draw(offs_t *addr, const rectangle &clip);
+	void gfx_exec(const rectangle &band);
+	void gfx_exec_bands();
+	static void *blit_band_callback(void *param, int threadid);
 	u32 gfx_ready_r();
 	void gfx_exec_w(address_space &space, offs_t offset, u32 data, u32 mem_mask = ~0);
 
@@ -792,6 +796,13 @@ protected:
 	};
 
 	// convert separate r,g,b biases (0..80..ff) to clr_t (-1f..0..1f)
+	// colrtable[x][y] without the lookup, for the row loops in epic12in.hxx;
+	// the multiply and shift matches x * y / 0x1f exactly for all x < 0x20, y < 0x40
+	static constexpr u32 mul_div31(u32 x, u32 y)
+	{
+		return std::min<u32>((x * y * 2115) >> 16, 0x1f);
+	}
+
 	void tint_to_clr(u8 r, u8 g, u8 b, clr_t *clr)
 	{
 		clr->r  =   r>>2;
@@ -811,12 +822,30 @@ protected:
 
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_stop() override;
 
 	TIMER_CALLBACK_MEMBER(blitter_delay_callback);
 
 	osd_work_queue *m_work_queue;
 	osd_work_item *m_blitter_request;
 
+	// thread safe mode splits a blit list into bands of destination rows
+	// when no draw in it reads rows that another one writes
+	static constexpr int BLIT_BANDS = 8;
+
+	struct blit_band
+	{
+		epic12_device *device;
+		rectangle rows;
+	};
+
+	osd_work_queue *m_band_queue;
+	blit_band m_blit_bands[BLIT_BANDS];
+	int m_blit_band_count;
+	bool m_blit_splittable;
+	std::bitset<0x1000> m_blit_rows_read;
+	std::bitset<0x1000> m_blit_rows_written;
+
 	// blit timing
 	emu_timer *m_blitter_delay_timer;
 	int m_blitter_busy;
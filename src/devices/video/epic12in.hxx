@@ -2,10 +2,22 @@
 // copyright-holders:David Haywood
 /* blitter function */
 
+// the unblended modes and the common +alpha/+alpha blend are plain arithmetic on
+// each pixel, so they get row loops the compiler can vectorise; the rest go
+// through the lookup tables a pixel at a time
+#if BLENDED == 0
+#define ROW_KERNEL 1
+#elif _SMODE == 0 && _DMODE == 0
+#define ROW_KERNEL 1
+#else
+#define ROW_KERNEL 0
+#endif
+
 void epic12_device::FUNCNAME(BLIT_PARAMS)
 {
 	int yf;
 
+#if ROW_KERNEL == 0
 #if REALLY_SIMPLE == 0
 	colour_t s_clr;
 #endif
@@ -38,6 +50,7 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 #else
 	u32 pen;
 #endif
+#endif // ROW_KERNEL == 0
 	u32 *bmp;
 
 #if FLIPX == 1
@@ -89,7 +102,7 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 		//printf("delay is now %d\n", blit_delay);
 	}
 
-#if BLENDED == 1
+#if BLENDED == 1 && ROW_KERNEL == 0
 #if _SMODE == 0
 #if _DMODE == 0
 	const u8* salpha_table = colrtable[s_alpha];
@@ -124,7 +137,41 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 			gfx2 += (src_x + startx);
 		#endif
 
-#if 1
+#if ROW_KERNEL == 1
+		const int width = dimx - startx;
+		for (int x = 0; x < width; x++)
+		{
+#if FLIPX == 1
+			const u32 spen = gfx2[-x];
+#else
+			const u32 spen = gfx2[x];
+#endif
+#if BLENDED == 0 && TINT == 0
+			const u32 result = spen & 0x20f8f8f8;
+#else
+			u32 r = (spen >> (16 + 3)) & 0x1f;
+			u32 g = (spen >> (8 + 3)) & 0x1f;
+			u32 b = (spen >> 3) & 0x1f;
+#if TINT == 1
+			r = mul_div31(r, tint_clr->r);
+			g = mul_div31(g, tint_clr->g);
+			b = mul_div31(b, tint_clr->b);
+#endif
+#if BLENDED == 1
+			const u32 dpen = bmp[x];
+			r = std::min<u32>(mul_div31(s_alpha, r) + mul_div31(d_alpha, (dpen >> (16 + 3)) & 0x1f), 0x1f);
+			g = std::min<u32>(mul_div31(s_alpha, g) + mul_div31(d_alpha, (dpen >> (8 + 3)) & 0x1f), 0x1f);
+			b = std::min<u32>(mul_div31(s_alpha, b) + mul_div31(d_alpha, (dpen >> 3) & 0x1f), 0x1f);
+#endif
+			const u32 result = (r << (16 + 3)) | (g << (8 + 3)) | (b << 3) | (spen & 0x20000000);
+#endif
+#if TRANSPARENT == 1
+			bmp[x] = (spen & 0x20000000) ? result : bmp[x];
+#else
+			bmp[x] = result;
+#endif
+		}
+#elif 1
 		const u32* end = bmp + (dimx - startx);
 #else
 		// maybe we can do some SSE type optimizations on larger blocks? right now this just results in more code and slower compiling tho.
@@ -150,14 +197,18 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 			bigblocks--;
 		}
 #endif
+#if ROW_KERNEL == 0
 		while (bmp < end)
 		{
 			#include "epic12pixel.hxx"
 		}
+#endif
 
 	}
 
 //  g_profiler.stop();
 }
 
+#undef ROW_KERNEL
+
 #undef LOOP_INCREMENTS
@@ -64,6 +64,7 @@ public:
 	static constexpr uint8_t FLAG_INCLUDE_BOTTOM_EDGE = 0x01;
 	static constexpr uint8_t FLAG_INCLUDE_RIGHT_EDGE  = 0x02;
 	static constexpr uint8_t FLAG_NO_WORK_QUEUE       = 0x04;
+	static constexpr uint8_t FLAG_BIN_TILES           = 0x08;  // split work into TILE_WIDTH-wide columns as well as scanline buckets
 
 	// each vertex has an X/Y coordinate and a set of parameters
 	struct vertex_t
@@ -136,6 +137,9 @@ private:
 	static constexpr int CACHE_LINE_SIZE      = 64;          // this is a general guess
 	static constexpr int TOTAL_BUCKETS        = (512 / SCANLINES_PER_BUCKET);
 	static constexpr int UNITS_PER_POLY       = (100 / SCANLINES_PER_BUCKET);
+	static constexpr int TILE_SHIFT           = 6;
+	static constexpr int TILE_WIDTH           = 1 << TILE_SHIFT;
+	static constexpr int TILE_COLUMNS         = (2048 / TILE_WIDTH);
 
 	// polygon_info describes a single polygon, which includes the poly_params
 	struct polygon_info
@@ -239,9 +243,26 @@ private:
 	// internal helpers
 	polygon_info &polygon_alloc(int minx, int maxx, int miny, int maxy, render_delegate callback)
 	{
+		// a polygon that was too big to bin must finish before binned work can follow it
+		if (m_tile_barrier)
+		{
+			if (m_queue != nullptr)
+				osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
+			m_tile_barrier = false;
+		}
+
 		// wait for space in the polygon and unit arrays
+		int units = (maxy - miny) / SCANLINES_PER_BUCKET + 2;
+		if (m_flags & FLAG_BIN_TILES)
+			units *= (maxx - minx) / TILE_WIDTH + 2;
 		m_polygon.wait_for_space();
-		m_unit.wait_for_space((maxy - miny) / SCANLINES_PER_BUCKET + 2);
+		m_unit.wait_for_space(std::min(units, m_unit.allocated() - 1));
+
+#if KEEP_POLY_STATISTICS
+		// note when the first work of a new batch arrives
+		if (m_unit.count() == 0)
+			m_batch_start = osd_ticks();
+#endif
 
 		// return and initialize the next one
 		polygon_info &polygon = m_polygon.next();
@@ -252,6 +273,8 @@ private:
 	}
 
 	static void *work_item_callback(void *param, int threadid);
+	void bin_units_into_tiles(uint32_t startunit, int paramcount);
+	static void clip_extent_to_tile(extent_t &dest, const extent_t &src, int32_t left, int32_t right, int paramcount);
 	void presave() { wait("pre-save"); }
 
 	// queue management
@@ -269,6 +292,8 @@ private:
 
 	// buckets
 	uint16_t              m_unit_bucket[TOTAL_BUCKETS]; // buckets for tracking unit usage
+	uint16_t              m_tile_bucket[TOTAL_BUCKETS * TILE_COLUMNS]; // buckets for tracking unit usage when binning into tiles
+	bool                  m_tile_barrier;             // last polygon was too big to bin; wait before the next
 
 	// statistics
 	uint32_t              m_tiles;                    // number of tiles queued
@@ -278,6 +303,12 @@ private:
 #if KEEP_POLY_STATISTICS
 	uint32_t              m_conflicts[WORK_MAX_THREADS]; // number of conflicts found, per thread
 	uint32_t              m_resolved[WORK_MAX_THREADS];   // number of conflicts resolved, per thread
+	uint32_t              m_units_run[WORK_MAX_THREADS];  // number of work units run, per thread
+	uint32_t              m_scanlines_run[WORK_MAX_THREADS]; // number of scanlines run, per thread
+	osd_ticks_t           m_busy_ticks[WORK_MAX_THREADS]; // time spent in render callbacks, per thread
+	osd_ticks_t           m_batch_start;              // time the current batch's first unit was allocated
+	osd_ticks_t           m_batch_ticks;              // total time from first unit to wait() completion
+	osd_ticks_t           m_wait_ticks;               // total time the caller was blocked in wait()
 #endif
 };
 
@@ -309,6 +340,7 @@ poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::poly_manager(running_ma
 	, m_object(machine, *this)
 	, m_unit(machine, *this)
 	, m_flags(flags)
+	, m_tile_barrier(false)
 	, m_tiles(0)
 	, m_triangles(0)
 	, m_quads(0)
@@ -317,6 +349,10 @@ poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::poly_manager(running_ma
 #if KEEP_POLY_STATISTICS
 	memset(m_conflicts, 0, sizeof(m_conflicts));
 	memset(m_resolved, 0, sizeof(m_resolved));
+	memset(m_units_run, 0, sizeof(m_units_run));
+	memset(m_scanlines_run, 0, sizeof(m_scanlines_run));
+	memset(m_busy_ticks, 0, sizeof(m_busy_ticks));
+	m_batch_start = m_batch_ticks = m_wait_ticks = 0;
 #endif
 
 	// create the work queue
@@ -324,6 +360,7 @@ poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::poly_manager(running_ma
 		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
 
 	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+	memset(m_tile_bucket, 0xff, sizeof(m_tile_bucket));
 
 	// request a pre-save callback for synchronization
 	machine.save().register_presave(save_prepost_delegate(FUNC(poly_manager::presave), this));
@@ -359,6 +396,16 @@ poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::~poly_manager()
 	printf("Units:       %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_unit.max(), m_unit.allocated(), m_unit.waits(), m_unit.itemsize(), m_unit.allocated() * m_unit.itemsize());
 	printf("Polygons:    %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_polygon.max(), m_polygon.allocated(), m_polygon.waits(), m_polygon.itemsize(), m_polygon.allocated() * m_polygon.itemsize());
 	printf("Object data: %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_object.max(), m_object.allocated(), m_object.waits(), m_object.itemsize(), m_object.allocated() * m_object.itemsize());
+
+	// output per-thread load; idle time is the part of each batch a thread spent not rendering
+	if (m_batch_ticks != 0)
+	{
+		printf("Batches:     %.3f ms total, %.3f ms blocked in wait()\n", double(m_batch_ticks) * 1000.0 / double(osd_ticks_per_second()), double(m_wait_ticks) * 1000.0 / double(osd_ticks_per_second()));
+		for (int i = 0; i < WORK_MAX_THREADS; i++)
+			if (m_units_run[i] != 0)
+				printf("Thread %2d:   %6d units, %8d scanlines, %5.1f%% busy, %5.1f%% idle\n", i, m_units_run[i], m_scanlines_run[i],
+						100.0 * double(m_busy_ticks[i]) / double(m_batch_ticks), 100.0 * (1.0 - double(m_busy_ticks[i]) / double(m_batch_ticks)));
+	}
 }
 #endif
 
@@ -375,6 +422,9 @@ poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::~poly_manager()
 template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
 void *poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::work_item_callback(void *param, int threadid)
 {
+	static util::scope_profiler::scope_id const s_scope = util::scope_profiler::register_scope("poly render");
+	util::profile_scope scope(s_scope);
+
 	while (1)
 	{
 		work_unit &unit = *(work_unit *)param;
@@ -410,10 +460,21 @@ void *poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::work_item_callbac
 			}
 		}
 
+#if KEEP_POLY_STATISTICS
+		osd_ticks_t const start = osd_ticks();
+#endif
+
 		// iterate over extents
 		for (int curscan = 0; curscan < count; curscan++)
 			polygon.m_callback(unit.scanline + curscan, unit.extent[curscan], *polygon.m_object, threadid);
 
+#if KEEP_POLY_STATISTICS
+		// track how much of the time this thread spent doing real work
+		polygon.m_owner->m_units_run[threadid]++;
+		polygon.m_owner->m_scanlines_run[threadid] += count;
+		polygon.m_owner->m_busy_ticks[threadid] += osd_ticks() - start;
+#endif
+
 		// set our count to 0 and re-fetch the original count value
 		do
 		{
@@ -430,6 +491,125 @@ void *poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::work_item_callbac
 }
 
 
+//-------------------------------------------------
+//  bin_units_into_tiles - split the full-width
+//  units queued for a polygon into one unit per
+//  tile column, each chained behind the previous
+//  work in its tile
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::bin_units_into_tiles(uint32_t startunit, int paramcount)
+{
+	uint32_t const endunit = m_unit.count();
+
+	// find the range of tile columns each unit covers
+	auto const columns = [] (const work_unit &unit)
+	{
+		int32_t minx = INT_MAX, maxx = INT_MIN;
+		int const count = unit.count_next & 0xffff;
+		for (int extnum = 0; extnum < count; extnum++)
+			if (unit.extent[extnum].startx < unit.extent[extnum].stopx)
+			{
+				minx = std::min<int32_t>(minx, unit.extent[extnum].startx);
+				maxx = std::max<int32_t>(maxx, unit.extent[extnum].stopx);
+			}
+		if (minx > maxx)
+			return std::make_pair(0, 0);
+		return std::make_pair(minx >> TILE_SHIFT, (maxx - 1) >> TILE_SHIFT);
+	};
+
+	uint32_t extra = 0;
+	for (uint32_t unitnum = startunit; unitnum < endunit; unitnum++)
+	{
+		auto const [first, last] = columns(m_unit[unitnum]);
+		extra += last - first;
+	}
+
+	// if the split units won't fit, run this polygon full width instead; once
+	// the queue has drained nothing can overlap it, and the next polygon waits
+	// for it before binning again
+	if (endunit + extra >= uint32_t(m_unit.allocated()))
+	{
+		if (m_queue != nullptr)
+			osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
+		for (uint32_t unitnum = startunit; unitnum < endunit; unitnum++)
+			m_unit[unitnum].previtem = 0xffff;
+		m_tile_barrier = true;
+		return;
+	}
+
+	for (uint32_t unitnum = startunit; unitnum < endunit; unitnum++)
+	{
+		work_unit &unit = m_unit[unitnum];
+		auto const [first, last] = columns(unit);
+		uint32_t const row = ((uint32_t)unit.scanline / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		int const count = unit.count_next & 0xffff;
+
+		// the outermost columns keep anything beyond them so nothing is lost to clipping
+		for (int col = last; col > first; col--)
+		{
+			uint32_t const tileindex = m_unit.count();
+			work_unit &tile = m_unit.next();
+			tile.polygon = unit.polygon;
+			tile.count_next = count;
+			tile.scanline = unit.scanline;
+			for (int extnum = 0; extnum < count; extnum++)
+				clip_extent_to_tile(tile.extent[extnum], unit.extent[extnum], col << TILE_SHIFT, (col == last) ? INT_MAX : ((col + 1) << TILE_SHIFT), paramcount);
+
+			uint16_t &bucket = m_tile_bucket[row * TILE_COLUMNS + (uint32_t(col) % TILE_COLUMNS)];
+			tile.previtem = bucket;
+			bucket = tileindex;
+		}
+
+		// the original unit becomes the first column
+		if (last > first)
+			for (int extnum = 0; extnum < count; extnum++)
+				clip_extent_to_tile(unit.extent[extnum], unit.extent[extnum], INT_MIN, (first + 1) << TILE_SHIFT, paramcount);
+
+		uint16_t &bucket = m_tile_bucket[row * TILE_COLUMNS + (uint32_t(first) % TILE_COLUMNS)];
+		unit.previtem = bucket;
+		bucket = unitnum;
+	}
+}
+
+
+//-------------------------------------------------
+//  clip_extent_to_tile - clip an extent to a tile
+//  column, advancing its parameters to match the
+//  new starting point
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::clip_extent_to_tile(extent_t &dest, const extent_t &src, int32_t left, int32_t right, int paramcount)
+{
+	int32_t const srcstart = src.startx;
+	int32_t const srcstop = src.stopx;
+
+	// empty or reversed extents only stay with the column that keeps the left side
+	if (srcstart >= srcstop)
+	{
+		if (&dest != &src)
+		{
+			dest.startx = dest.stopx = srcstart;
+			dest.userdata = src.userdata;
+		}
+		return;
+	}
+
+	int32_t const startx = std::max(srcstart, left);
+	int32_t const stopx = std::max(startx, std::min(srcstop, right));
+	for (int paramnum = 0; paramnum < paramcount; paramnum++)
+	{
+		dest.param[paramnum].start = src.param[paramnum].start + src.param[paramnum].dpdx * BaseType(startx - srcstart);
+		dest.param[paramnum].dpdx = src.param[paramnum].dpdx;
+	}
+	dest.startx = startx;
+	dest.stopx = stopx;
+	dest.userdata = src.userdata;
+}
+
+
 //-------------------------------------------------
 //  wait - stall until all work is complete
 //-------------------------------------------------
@@ -442,6 +622,9 @@ void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::wait(const char *d
 	// remember the start time if we're logging
 	if (POLY_LOG_WAITS)
 		time = get_profile_ticks();
+#if KEEP_POLY_STATISTICS
+	osd_ticks_t const wait_start = osd_ticks();
+#endif
 
 	// wait for all pending work items to complete
 	if (m_queue != nullptr)
@@ -460,10 +643,20 @@ void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::wait(const char *d
 			machine().logerror("Poly:Waited %d cycles for %s\n", (int)time, debug_reason);
 	}
 
+#if KEEP_POLY_STATISTICS
+	// accumulate the time this batch took from first submission and how much of it we blocked
+	osd_ticks_t const wait_end = osd_ticks();
+	m_wait_ticks += wait_end - wait_start;
+	if (m_unit.count() != 0)
+		m_batch_ticks += wait_end - m_batch_start;
+#endif
+
 	// reset the state
 	m_polygon.reset();
 	m_unit.reset();
 	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+	memset(m_tile_bucket, 0xff, sizeof(m_tile_bucket));
+	m_tile_barrier = false;
 
 	// we need to preserve the last object data that was supplied
 	if (m_object.count() > 0)
@@ -611,6 +804,8 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_tile(co
 	}
 
 	// enqueue the work items
+	if (m_flags & FLAG_BIN_TILES)
+		bin_units_into_tiles(startunit, paramcount);
 	if (m_queue != nullptr)
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
 
@@ -799,6 +994,8 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_triangl
 	}
 
 	// enqueue the work items
+	if (m_flags & FLAG_BIN_TILES)
+		bin_units_into_tiles(startunit, paramcount);
 	if (m_queue != nullptr)
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
 
@@ -915,6 +1112,8 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_triangl
 	}
 
 	// enqueue the work items
+	if (m_flags & FLAG_BIN_TILES)
+		bin_units_into_tiles(startunit, MaxParams);
 	if (m_queue != nullptr)
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
 
@@ -1114,6 +1313,8 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_polygon
 	}
 
 	// enqueue the work items
+	if (m_flags & FLAG_BIN_TILES)
+		bin_units_into_tiles(startunit, paramcount);
 	if (m_queue != nullptr)
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
 
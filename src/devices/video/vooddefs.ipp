@@ -2897,7 +2897,11 @@ inline rgbaint_t ATTR_FORCE_INLINE voodoo_device::tmu_state::genTexture(int32_t
 		t *= smax + 1;
 
 		/* fetch texel data */
-		if (TEXMODE_FORMAT(TEXMODE) < 8)
+		if (texcache_data)
+		{
+			result.set(texcache_data[texcache_lodoffset[ilod] + t + s]);
+		}
+		else if (TEXMODE_FORMAT(TEXMODE) < 8)
 		{
 			texel0 = *(uint8_t *)&ram[(texbase + t + s) & mask];
 			result.set((LOOKUP)[texel0]);
@@ -2974,7 +2978,15 @@ inline rgbaint_t ATTR_FORCE_INLINE voodoo_device::tmu_state::genTexture(int32_t
 		t1 *= smax + 1;
 
 		/* fetch texel data */
-		if (TEXMODE_FORMAT(TEXMODE) < 8)
+		if (texcache_data)
+		{
+			const rgb_t *const decoded = &texcache_data[texcache_lodoffset[ilod]];
+			texel0 = decoded[t + s];
+			texel1 = decoded[t + s1];
+			texel2 = decoded[t1 + s];
+			texel3 = decoded[t1 + s1];
+		}
+		else if (TEXMODE_FORMAT(TEXMODE) < 8)
 		{
 			texel0 = *(uint8_t *)&ram[(texbase + t + s) & mask];
 			texel1 = *(uint8_t *)&ram[(texbase + t + s1) & mask];
@@ -1095,6 +1095,11 @@ void voodoo_device::tmu_state::init(uint8_t vdt, tmu_shared_state &share, voodoo
 	regdirty = false;
 	bilinear_mask = (vdt >= TYPE_VOODOO_2) ? 0xff : 0xf0;
 
+	/* Voodoo 1/2 texture RAM is only written through texture_w, so decoded textures can be cached */
+	texcache_enable = (vdt <= TYPE_VOODOO_2);
+	if (texcache_enable)
+		texcache = std::make_unique<texcache_entry[]>(TEXCACHE_ENTRIES);
+
 	/* mark the NCC tables dirty and configure their registers */
 	ncc[0].dirty = ncc[1].dirty = true;
 	ncc[0].reg = &reg[nccTable+0];
@@ -1146,6 +1151,7 @@ void voodoo_device::voodoo_postload()
 		tm.regdirty = true;
 		for (tmu_state::ncc_table &ncc : tm.ncc)
 			ncc.dirty = true;
+		tm.texcache_flush();
 	}
 
 	/* recompute video memory to get the FBI FIFO base recomputed */
@@ -1938,6 +1944,7 @@ void voodoo_device::tmu_state::recompute_texture_params()
 
 	/* no longer dirty */
 	regdirty = false;
+	texcache_dirty = true;
 
 	/* check for separate RGBA filtering */
 	if (TEXDETAIL_SEPARATE_RGBA_FILTER(reg[tDetail].u))
@@ -1945,6 +1952,198 @@ void voodoo_device::tmu_state::recompute_texture_params()
 }
 
 
+/*-------------------------------------------------
+    texcache_select - point texcache_data at the
+    decoded form of the current texture, decoding
+    it into the least recently used entry if it
+    isn't cached; called only once pending work
+    has finished
+-------------------------------------------------*/
+
+void voodoo_device::tmu_state::texcache_select()
+{
+	texcache_dirty = false;
+	texcache_data = nullptr;
+	if (!texcache_enable || lookup == nullptr)
+		return;
+
+	/* the highest LOD sampled must be one we decode */
+	int32_t const lodtop = lodmax >> 8;
+	if (lodtop > 8 || (lodtop == 8 && !(lodmask & 0x100)))
+		return;
+
+	uint8_t const format = TEXMODE_FORMAT(reg[textureMode].u);
+	uint8_t const lodlo = lodmin >> 8;
+	bool const dynamic = (lookup == palette || lookup == palettea || lookup == ncc[0].texel || lookup == ncc[1].texel);
+	uint32_t const serial = dynamic ? lookup_serial : 0;
+
+	/* look for a match, tracking the best entry to replace */
+	texcache_entry *found = nullptr;
+	texcache_entry *victim = &texcache[0];
+	for (int i = 0; i < TEXCACHE_ENTRIES && !found; i++)
+	{
+		texcache_entry &entry = texcache[i];
+		if (!entry.valid)
+		{
+			if (victim->valid)
+				victim = &entry;
+		}
+		else if (entry.format == format && entry.lodlo == lodlo && entry.wmask == wmask && entry.hmask == hmask &&
+				entry.lodmask == lodmask && entry.lookup == lookup && entry.lookup_serial == serial &&
+				!memcmp(&entry.lodoffset[lodlo], &lodoffset[lodlo], (9 - lodlo) * sizeof(lodoffset[0])))
+		{
+			found = &entry;
+		}
+		else if (victim->valid && entry.lastuse < victim->lastuse)
+		{
+			victim = &entry;
+		}
+	}
+
+	if (!found)
+	{
+		found = victim;
+		texcache_decode(*found, format, lodlo);
+		found->lookup_serial = serial;
+	}
+
+	found->lastuse = ++texcache_clock;
+	texcache_data = found->data.data();
+	memcpy(texcache_lodoffset, found->dataoffset, sizeof(texcache_lodoffset));
+}
+
+
+/*-------------------------------------------------
+    texcache_decode - decode all LODs of the
+    current texture from lodlo upwards into the
+    given entry
+-------------------------------------------------*/
+
+void voodoo_device::tmu_state::texcache_decode(texcache_entry &entry, uint8_t format, uint8_t lodlo)
+{
+	uint32_t const bpp = (format < 8) ? 1 : 2;
+
+	entry.valid = true;
+	entry.format = format;
+	entry.lodlo = lodlo;
+	entry.wmask = wmask;
+	entry.hmask = hmask;
+	entry.lodmask = lodmask;
+	entry.lookup = lookup;
+	memcpy(entry.lodoffset, lodoffset, sizeof(entry.lodoffset));
+
+	/* lay out the LODs and work out which part of texture RAM they cover */
+	uint32_t total = 0;
+	entry.rangelo = ~0U;
+	entry.rangehi = 0;
+	for (int lod = 0; lod <= 8; lod++)
+	{
+		entry.dataoffset[lod] = total;
+		if (lod >= lodlo && ((lodmask >> lod) & 1))
+		{
+			uint32_t const texels = ((wmask >> lod) + 1) * ((hmask >> lod) + 1);
+			uint32_t const start = lodoffset[lod];
+			uint32_t const end = start + texels * bpp - 1;
+			if (end > mask)
+			{
+				entry.rangelo = 0;
+				entry.rangehi = mask;
+			}
+			else
+			{
+				entry.rangelo = std::min(entry.rangelo, start);
+				entry.rangehi = std::max(entry.rangehi, end);
+			}
+			total += texels;
+		}
+	}
+	entry.data.resize(total);
+
+	/* decode each LOD exactly as genTexture would fetch it */
+	for (int lod = lodlo; lod <= 8; lod++)
+	{
+		if (!((lodmask >> lod) & 1))
+			continue;
+		uint32_t const texels = ((wmask >> lod) + 1) * ((hmask >> lod) + 1);
+		uint32_t const base = lodoffset[lod];
+		rgb_t *const dest = &entry.data[entry.dataoffset[lod]];
+		if (format < 8)
+		{
+			for (uint32_t i = 0; i < texels; i++)
+				dest[i] = lookup[ram[(base + i) & mask]];
+		}
+		else if (format >= 10 && format <= 12)
+		{
+			for (uint32_t i = 0; i < texels; i++)
+				dest[i] = lookup[*(uint16_t *)&ram[(base + 2 * i) & mask]];
+		}
+		else
+		{
+			for (uint32_t i = 0; i < texels; i++)
+			{
+				uint32_t const texel = *(uint16_t *)&ram[(base + 2 * i) & mask];
+				dest[i] = (lookup[texel & 0xff] & 0xffffff) | ((texel & 0xff00) << 16);
+			}
+		}
+	}
+
+	texcache_rangelo = std::min(texcache_rangelo, entry.rangelo);
+	texcache_rangehi = std::max(texcache_rangehi, entry.rangehi);
+}
+
+
+/*-------------------------------------------------
+    texcache_invalidate - drop any decoded
+    textures covering the given range of texture
+    RAM
+-------------------------------------------------*/
+
+void voodoo_device::tmu_state::texcache_invalidate(uint32_t start, uint32_t end)
+{
+	if (!texcache_enable || end < texcache_rangelo || start > texcache_rangehi)
+		return;
+
+	texcache_rangelo = ~0U;
+	texcache_rangehi = 0;
+	for (int i = 0; i < TEXCACHE_ENTRIES; i++)
+	{
+		texcache_entry &entry = texcache[i];
+		if (!entry.valid)
+			continue;
+		if (end >= entry.rangelo && start <= entry.rangehi)
+		{
+			entry.valid = false;
+			if (texcache_data == entry.data.data())
+			{
+				texcache_data = nullptr;
+				texcache_dirty = true;
+			}
+		}
+		else
+		{
+			texcache_rangelo = std::min(texcache_rangelo, entry.rangelo);
+			texcache_rangehi = std::max(texcache_rangehi, entry.rangehi);
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    texcache_flush - drop all decoded textures
+-------------------------------------------------*/
+
+void voodoo_device::tmu_state::texcache_flush()
+{
+	if (texcache_enable)
+		for (int i = 0; i < TEXCACHE_ENTRIES; i++)
+			texcache[i].valid = false;
+	texcache_rangelo = ~0U;
+	texcache_rangehi = 0;
+	texcache_data = nullptr;
+	texcache_dirty = true;
+}
+
+
 inline int32_t voodoo_device::tmu_state::prepare()
 {
 	int64_t texdx, texdy;
@@ -1953,6 +2152,8 @@ inline int32_t voodoo_device::tmu_state::prepare()
 	/* if the texture parameters are dirty, update them */
 	if (regdirty)
 		recompute_texture_params();
+	if (texcache_dirty)
+		texcache_select();
 
 	/* compute (ds^2 + dt^2) in both X and Y as 28.36 numbers */
 	texdx = int64_t(dsdx >> 14) * int64_t(dsdx >> 14) + int64_t(dtdx >> 14) * int64_t(dtdx >> 14);
@@ -3010,24 +3211,33 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 
 		/* mask off invalid bits for different cards */
 		case fbzColorPath:
-			poly_wait(vd->poly, vd->regnames[regnum]);
 			if (vd->vd_type < TYPE_VOODOO_2)
 				data &= 0x0fffffff;
-			if (chips & 1) vd->reg[fbzColorPath].u = data;
+			if ((chips & 1) && vd->reg[fbzColorPath].u != data)
+			{
+				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->reg[fbzColorPath].u = data;
+			}
 			break;
 
 		case fbzMode:
-			poly_wait(vd->poly, vd->regnames[regnum]);
 			if (vd->vd_type < TYPE_VOODOO_2)
 				data &= 0x001fffff;
-			if (chips & 1) vd->reg[fbzMode].u = data;
+			if ((chips & 1) && vd->reg[fbzMode].u != data)
+			{
+				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->reg[fbzMode].u = data;
+			}
 			break;
 
 		case fogMode:
-			poly_wait(vd->poly, vd->regnames[regnum]);
 			if (vd->vd_type < TYPE_VOODOO_2)
 				data &= 0x0000003f;
-			if (chips & 1) vd->reg[fogMode].u = data;
+			if ((chips & 1) && vd->reg[fogMode].u != data)
+			{
+				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->reg[fogMode].u = data;
+			}
 			break;
 
 		/* triangle drawing */
@@ -3349,8 +3559,8 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 		case nccTable+10:
 		case nccTable+11:
 			poly_wait(vd->poly, vd->regnames[regnum]);
-			if (chips & 2) vd->tmu[0].ncc[0].write(regnum - nccTable, data);
-			if (chips & 4) vd->tmu[1].ncc[0].write(regnum - nccTable, data);
+			if (chips & 2) { vd->tmu[0].ncc[0].write(regnum - nccTable, data); vd->tmu[0].texcache_lookup_changed(); }
+			if (chips & 4) { vd->tmu[1].ncc[0].write(regnum - nccTable, data); vd->tmu[1].texcache_lookup_changed(); }
 			break;
 
 		case nccTable+12:
@@ -3366,8 +3576,8 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 		case nccTable+22:
 		case nccTable+23:
 			poly_wait(vd->poly, vd->regnames[regnum]);
-			if (chips & 2) vd->tmu[0].ncc[1].write(regnum - (nccTable+12), data);
-			if (chips & 4) vd->tmu[1].ncc[1].write(regnum - (nccTable+12), data);
+			if (chips & 2) { vd->tmu[0].ncc[1].write(regnum - (nccTable+12), data); vd->tmu[0].texcache_lookup_changed(); }
+			if (chips & 4) { vd->tmu[1].ncc[1].write(regnum - (nccTable+12), data); vd->tmu[1].texcache_lookup_changed(); }
 			break;
 
 		/* fogTable entries are processed and expanded immediately */
@@ -3447,6 +3657,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 			goto default_case;
 
 		/* these registers are referenced in the renderer; we must wait for pending work before changing */
+		/* them, but rewriting the current value (as most drivers do per triangle) needn't stall the CPU */
 		case chromaRange:
 		case chromaKey:
 		case alphaMode:
@@ -3457,7 +3668,11 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 		case color0:
 		case clipLowYHighY:
 		case clipLeftRight:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			if (((chips & 1) && vd->reg[0x000 + regnum].u != data) ||
+				((chips & 2) && vd->reg[0x100 + regnum].u != data) ||
+				((chips & 4) && vd->reg[0x200 + regnum].u != data) ||
+				((chips & 8) && vd->reg[0x300 + regnum].u != data))
+				poly_wait(vd->poly, vd->regnames[regnum]);
 			[[fallthrough]];
 		/* by default, just feed the data to the chips */
 		default:
@@ -4057,6 +4272,7 @@ int32_t voodoo_device::texture_w(voodoo_device *vd, offs_t offset, uint32_t data
 		dest[BYTE4_XOR_LE(tbaseaddr + 1)] = (data >> 8) & 0xff;
 		dest[BYTE4_XOR_LE(tbaseaddr + 2)] = (data >> 16) & 0xff;
 		dest[BYTE4_XOR_LE(tbaseaddr + 3)] = (data >> 24) & 0xff;
+		t->texcache_invalidate(tbaseaddr & ~3, (tbaseaddr + 3) | 3);
 	}
 
 	/* 16-bit texture case */
@@ -4096,6 +4312,8 @@ int32_t voodoo_device::texture_w(voodoo_device *vd, offs_t offset, uint32_t data
 		tbaseaddr >>= 1;
 		dest[BYTE_XOR_LE(tbaseaddr + 0)] = (data >> 0) & 0xffff;
 		dest[BYTE_XOR_LE(tbaseaddr + 1)] = (data >> 16) & 0xffff;
+		tbaseaddr <<= 1;
+		t->texcache_invalidate(tbaseaddr & ~3, (tbaseaddr + 3) | 3);
 	}
 
 	return 0;
@@ -6395,8 +6613,8 @@ voodoo_device::raster_info *voodoo_device::find_rasterizer(voodoo_device *vd, in
 			return info;
 		}
 
-	/* generate a new one using the generic entry */
-	curinfo.callback = (texcount == 0) ? raster_generic_0tmu : (texcount == 1) ? raster_generic_1tmu : raster_generic_2tmu;
+	/* generate a new one using the semi-generic entry matching the key enables */
+	curinfo.callback = s_semigeneric_rasterizers[std::min(texcount, 2)][semigeneric_index(vd)];
 	curinfo.is_generic = true;
 	curinfo.display = 0;
 	curinfo.polys = 0;
@@ -6628,3 +6846,58 @@ RASTERIZER(generic_1tmu, 1, vd->reg[fbzColorPath].u, vd->reg[fbzMode].u, vd->reg
 
 RASTERIZER(generic_2tmu, 2, vd->reg[fbzColorPath].u, vd->reg[fbzMode].u, vd->reg[alphaMode].u,
 			vd->reg[fogMode].u, vd->tmu[0].reg[textureMode].u, vd->tmu[1].reg[textureMode].u)
+
+
+/*-------------------------------------------------
+    semigeneric_Ntmu_X - generic rasterizers with
+    the depth buffer, alpha test, alpha blend and
+    fog enables fixed, so the compiler can drop
+    the unused stages from the pixel loop
+-------------------------------------------------*/
+
+#define SEMIGENERIC_FBZMODE(bits)   ((vd->reg[fbzMode].u & ~0x10) | (((bits) & 1) << 4))
+#define SEMIGENERIC_ALPHAMODE(bits) ((vd->reg[alphaMode].u & ~0x11) | (((bits) >> 1) & 1) | ((((bits) >> 2) & 1) << 4))
+#define SEMIGENERIC_FOGMODE(bits)   ((vd->reg[fogMode].u & ~0x01) | (((bits) >> 3) & 1))
+
+#define SEMIGENERIC_RASTERIZER(tmus, bits) \
+	RASTERIZER(semigeneric_##tmus##tmu_##bits, tmus, vd->reg[fbzColorPath].u, SEMIGENERIC_FBZMODE(bits), SEMIGENERIC_ALPHAMODE(bits), \
+			SEMIGENERIC_FOGMODE(bits), (tmus >= 1) ? vd->tmu[0].reg[textureMode].u : 0, (tmus >= 2) ? vd->tmu[1].reg[textureMode].u : 0)
+
+#define SEMIGENERIC_RASTERIZERS(tmus) \
+	SEMIGENERIC_RASTERIZER(tmus, 0)  SEMIGENERIC_RASTERIZER(tmus, 1)  SEMIGENERIC_RASTERIZER(tmus, 2)  SEMIGENERIC_RASTERIZER(tmus, 3) \
+	SEMIGENERIC_RASTERIZER(tmus, 4)  SEMIGENERIC_RASTERIZER(tmus, 5)  SEMIGENERIC_RASTERIZER(tmus, 6)  SEMIGENERIC_RASTERIZER(tmus, 7) \
+	SEMIGENERIC_RASTERIZER(tmus, 8)  SEMIGENERIC_RASTERIZER(tmus, 9)  SEMIGENERIC_RASTERIZER(tmus, 10) SEMIGENERIC_RASTERIZER(tmus, 11) \
+	SEMIGENERIC_RASTERIZER(tmus, 12) SEMIGENERIC_RASTERIZER(tmus, 13) SEMIGENERIC_RASTERIZER(tmus, 14) SEMIGENERIC_RASTERIZER(tmus, 15)
+
+SEMIGENERIC_RASTERIZERS(0)
+SEMIGENERIC_RASTERIZERS(1)
+SEMIGENERIC_RASTERIZERS(2)
+
+#define SEMIGENERIC_ENTRIES(tmus) \
+	{ \
+		raster_semigeneric_##tmus##tmu_0,  raster_semigeneric_##tmus##tmu_1,  raster_semigeneric_##tmus##tmu_2,  raster_semigeneric_##tmus##tmu_3, \
+		raster_semigeneric_##tmus##tmu_4,  raster_semigeneric_##tmus##tmu_5,  raster_semigeneric_##tmus##tmu_6,  raster_semigeneric_##tmus##tmu_7, \
+		raster_semigeneric_##tmus##tmu_8,  raster_semigeneric_##tmus##tmu_9,  raster_semigeneric_##tmus##tmu_10, raster_semigeneric_##tmus##tmu_11, \
+		raster_semigeneric_##tmus##tmu_12, raster_semigeneric_##tmus##tmu_13, raster_semigeneric_##tmus##tmu_14, raster_semigeneric_##tmus##tmu_15 \
+	}
+
+const poly_draw_scanline_func voodoo_device::s_semigeneric_rasterizers[3][16] =
+{
+	SEMIGENERIC_ENTRIES(0),
+	SEMIGENERIC_ENTRIES(1),
+	SEMIGENERIC_ENTRIES(2)
+};
+
+
+/*-------------------------------------------------
+    semigeneric_index - pick the semi-generic
+    variant for the current register state
+-------------------------------------------------*/
+
+int voodoo_device::semigeneric_index(voodoo_device *vd)
+{
+	return (FBZMODE_ENABLE_DEPTHBUF(vd->reg[fbzMode].u) ? 1 : 0) |
+			(ALPHAMODE_ALPHATEST(vd->reg[alphaMode].u) ? 2 : 0) |
+			(ALPHAMODE_ALPHABLEND(vd->reg[alphaMode].u) ? 4 : 0) |
+			(FOGMODE_ENABLE_FOG(vd->reg[fogMode].u) ? 8 : 0);
+}
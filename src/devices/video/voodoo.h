@@ -1086,6 +1086,42 @@ protected:
 
 		rgb_t               palette[256];           // palette lookup table
 		rgb_t               palettea[256];          // palette+alpha lookup table
+
+		// decoded texture cache; only used when texture RAM is private to the
+		// TMU, so every write to it goes through texture_w
+		struct texcache_entry
+		{
+			bool                valid = false;          // does this entry hold a decoded texture?
+			uint8_t             format = 0;             // texture format
+			uint8_t             lodlo = 0;              // lowest LOD decoded
+			uint32_t            wmask = 0, hmask = 0;   // LOD 0 width/height masks
+			uint32_t            lodmask = 0;            // mask of available LODs
+			uint32_t            lodoffset[9];           // texture RAM offset of each LOD
+			const rgb_t *       lookup = nullptr;       // lookup the texels were decoded through
+			uint32_t            lookup_serial = 0;      // lookup_serial at decode time
+			uint32_t            rangelo = 0, rangehi = 0; // range of texture RAM covered
+			uint64_t            lastuse = 0;            // LRU stamp
+			uint32_t            dataoffset[9];          // offset of each LOD within data
+			std::vector<rgb_t>  data;                   // decoded ARGB texels
+		};
+
+		static constexpr int TEXCACHE_ENTRIES = 64;
+
+		void texcache_select();
+		void texcache_decode(texcache_entry &entry, uint8_t format, uint8_t lodlo);
+		void texcache_invalidate(uint32_t start, uint32_t end);
+		void texcache_flush();
+		void texcache_lookup_changed() { lookup_serial++; texcache_dirty = true; }
+
+		bool                texcache_enable = false; // true if the decoded texture cache is in use
+		bool                texcache_dirty = true;  // true if the current texture must be looked up again
+		uint32_t            lookup_serial = 0;      // bumped whenever a palette or NCC table changes
+		uint64_t            texcache_clock = 0;     // LRU clock
+		uint32_t            texcache_rangelo = ~0U; // union of the ranges covered by all entries
+		uint32_t            texcache_rangehi = 0;
+		const rgb_t *       texcache_data = nullptr; // decoded texels for the current texture, or nullptr
+		uint32_t            texcache_lodoffset[9];  // offset of each LOD within texcache_data
+		std::unique_ptr<texcache_entry[]> texcache; // cache entries
 	};
 
 
@@ -1298,6 +1334,25 @@ protected:
 	RASTERIZER_HEADER(fbzcp##_##alpha##_##fog##_##fbz##_##tex0##_##tex1)
 #include "voodoo_rast.ipp"
 
+	// semi-generic rasterizers: specialised on the depth buffer, alpha test,
+	// alpha blend and fog enables, with everything else read from registers
+#define SEMIGENERIC_HEADERS(tmus) \
+	RASTERIZER_HEADER(semigeneric_##tmus##tmu_0)  RASTERIZER_HEADER(semigeneric_##tmus##tmu_1) \
+	RASTERIZER_HEADER(semigeneric_##tmus##tmu_2)  RASTERIZER_HEADER(semigeneric_##tmus##tmu_3) \
+	RASTERIZER_HEADER(semigeneric_##tmus##tmu_4)  RASTERIZER_HEADER(semigeneric_##tmus##tmu_5) \
+	RASTERIZER_HEADER(semigeneric_##tmus##tmu_6)  RASTERIZER_HEADER(semigeneric_##tmus##tmu_7) \
+	RASTERIZER_HEADER(semigeneric_##tmus##tmu_8)  RASTERIZER_HEADER(semigeneric_##tmus##tmu_9) \
+	RASTERIZER_HEADER(semigeneric_##tmus##tmu_10) RASTERIZER_HEADER(semigeneric_##tmus##tmu_11) \
+	RASTERIZER_HEADER(semigeneric_##tmus##tmu_12) RASTERIZER_HEADER(semigeneric_##tmus##tmu_13) \
+	RASTERIZER_HEADER(semigeneric_##tmus##tmu_14) RASTERIZER_HEADER(semigeneric_##tmus##tmu_15)
+	SEMIGENERIC_HEADERS(0)
+	SEMIGENERIC_HEADERS(1)
+	SEMIGENERIC_HEADERS(2)
+#undef SEMIGENERIC_HEADERS
+
+	static const poly_draw_scanline_func s_semigeneric_rasterizers[3][16];
+	static int semigeneric_index(voodoo_device *vd);
+
 #undef RASTERIZER_ENTRY
 
 	static bool chromaKeyTest(voodoo_device *vd, stats_block *stats, uint32_t fbzModeReg, rgbaint_t rgaIntColor);
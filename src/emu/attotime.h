@@ -374,4 +374,53 @@ inline attotime attotime::from_double(double _time)
 }
 
 
+
+//**************************************************************************
+//  SCHEDULER TICKS
+//**************************************************************************
+
+/**
+ * A single integer count of attoseconds, so the scheduler can order and
+ * compare times with one operation instead of normalizing seconds and
+ * attoseconds separately.  All "never" values collapse to
+ * @ref ATTOTICK_NEVER.  Where the compiler has no 128-bit integer type,
+ * this falls back to attotime itself.
+ */
+#if defined(__SIZEOF_INT128__)
+typedef __int128 attotick_t;
+
+constexpr attotick_t ATTOTICK_NEVER = attotick_t(ATTOTIME_MAX_SECONDS) * ATTOSECONDS_PER_SECOND;
+
+/** Convert an attotime to ticks */
+inline constexpr attotick_t attotime_to_tick(const attotime &time) noexcept
+{
+	return time.is_never() ? ATTOTICK_NEVER : (attotick_t(time.seconds()) * ATTOSECONDS_PER_SECOND) + time.attoseconds();
+}
+
+/** Convert ticks back to an attotime */
+inline attotime tick_to_attotime(attotick_t tick) noexcept
+{
+	if (tick >= ATTOTICK_NEVER)
+		return attotime::never;
+
+	// keep the attoseconds positive for negative times
+	seconds_t secs = seconds_t(tick / ATTOSECONDS_PER_SECOND);
+	attoseconds_t attos = attoseconds_t(tick % ATTOSECONDS_PER_SECOND);
+	if (attos < 0)
+	{
+		attos += ATTOSECONDS_PER_SECOND;
+		secs--;
+	}
+	return attotime(secs, attos);
+}
+#else
+typedef attotime attotick_t;
+
+constexpr attotick_t ATTOTICK_NEVER(ATTOTIME_MAX_SECONDS, 0);
+
+inline constexpr attotick_t attotime_to_tick(const attotime &time) noexcept { return time.is_never() ? ATTOTICK_NEVER : time; }
+inline attotime tick_to_attotime(const attotick_t &tick) noexcept { return tick.is_never() ? attotime::never : tick; }
+#endif
+
+
 #endif // MAME_EMU_ATTOTIME_H
@@ -1481,6 +1481,11 @@ u32 debug_disasm_buffer::disassemble_info(offs_t pc) const
 	return m_dintf.disassemble(out, pc, m_buf_opcodes, m_buf_params.active() ? m_buf_params : m_buf_opcodes);
 }
 
+u64 debug_disasm_buffer::decode_mode() const
+{
+	return m_dintf.decode_mode();
+}
+
 std::string debug_disasm_buffer::pc_to_string(offs_t pc) const
 {
 	return m_pc_to_string(pc);
@@ -15,6 +15,7 @@ public:
 
 	void disassemble(offs_t pc, std::string &instruction, offs_t &next_pc, offs_t &size, u32 &info) const;
 	u32 disassemble_info(offs_t pc) const;
+	u64 decode_mode() const;
 	std::string pc_to_string(offs_t pc) const;
 	std::string data_to_string(offs_t pc, offs_t size, bool opcode) const;
 	void data_get(offs_t pc, offs_t size, bool opcode, std::vector<u8> &data) const;
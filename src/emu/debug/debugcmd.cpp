@@ -34,6 +34,11 @@
 
 const size_t debugger_commands::MAX_GLOBALS = 1000;
 
+// searches read memory in blocks of this many bytes, translating each
+// aligned chunk once rather than every access
+const u32 debugger_commands::MEMORY_BLOCK_SIZE = 0x10000;
+const u32 debugger_commands::MEMORY_BLOCK_CHUNK = 0x100;
+
 /***************************************************************************
     FUNCTIONS
 ***************************************************************************/
@@ -109,6 +114,129 @@ u64 debugger_commands::cheat_read_extended(const cheat_system *cheatsys, address
 	return cheat_sign_extend(cheatsys, cheat_byte_swap(cheatsys, value));
 }
 
+
+/*-------------------------------------------------
+    cheat_read_block - read a cheat value through
+    a block of memory, refilling it as needed;
+    returns false if the address isn't valid
+-------------------------------------------------*/
+
+bool debugger_commands::cheat_read_block(const cheat_system *cheatsys, address_space &space, memory_block &block, offs_t address, bool writable, u64 &value)
+{
+	address &= space.logaddrmask();
+
+	// refill the block if the value isn't entirely within it
+	offs_t delta = address - block.start;
+	if (space.addr_shift() == 0 && (block.length < cheatsys->width || delta > block.length - cheatsys->width))
+	{
+		u32 const length = std::min<u64>(MEMORY_BLOCK_SIZE, u64(space.logaddrmask()) - address + 1);
+		if (length >= cheatsys->width)
+		{
+			read_memory_block(space, address, length, block, writable);
+			delta = 0;
+		}
+	}
+
+	// fall back to reading through the space for what the block can't hold
+	if (space.addr_shift() != 0 || block.length < cheatsys->width || delta > block.length - cheatsys->width)
+	{
+		if (writable && !cheat_address_is_valid(space, address))
+			return false;
+		value = cheat_read_extended(cheatsys, space, address);
+		return true;
+	}
+
+	u8 const flags = block.valid[delta];
+	if (writable && !(flags & 2))
+		return false;
+
+	value = space.unmap();
+	if (flags & 1)
+	{
+		value = 0;
+		for (int i = 0; i < cheatsys->width; i++)
+			value |= u64(block.data[delta + i]) << (8 * ((space.endianness() == ENDIANNESS_LITTLE) ? i : (cheatsys->width - 1 - i)));
+	}
+	value = cheat_sign_extend(cheatsys, cheat_byte_swap(cheatsys, value));
+	return true;
+}
+
+
+/*-------------------------------------------------
+    read_memory_block - read a block of bytes from
+    a byte-addressed space through the debug
+    translation, one aligned chunk at a time,
+    copying straight from the backing memory where
+    the chunk maps linearly onto it
+-------------------------------------------------*/
+
+void debugger_commands::read_memory_block(address_space &space, offs_t address, u32 length, memory_block &block, bool writable)
+{
+	device_memory_interface &memory = space.device().memory();
+	offs_t const unitmask = (space.data_width() / 8) - 1;
+	bool const direct = (unitmask == 0) || (space.endianness() == ENDIANNESS_NATIVE);
+	auto const byte_ptr = [unitmask] (void *base, offs_t addr) { return base ? reinterpret_cast<u8 *>(base) + (addr & unitmask) : nullptr; };
+	auto dis = space.device().machine().disable_side_effects();
+
+	block.start = address;
+	block.length = length;
+	block.data.resize(length);
+	block.valid.resize(length);
+
+	for (u32 pos = 0; pos < length; )
+	{
+		u32 const chunk = std::min<u32>(MEMORY_BLOCK_CHUNK - ((address + pos) & (MEMORY_BLOCK_CHUNK - 1)), length - pos);
+		offs_t const first = (address + pos) & space.logaddrmask();
+		offs_t tfirst = first;
+		offs_t tlast = (first + chunk - 1) & space.logaddrmask();
+		u8 *const dest = &block.data[pos];
+		u8 *const valid = &block.valid[pos];
+
+		if (memory.translate(space.spacenum(), TRANSLATE_READ_DEBUG, tfirst) && memory.translate(space.spacenum(), TRANSLATE_READ_DEBUG, tlast) && (tlast - tfirst == chunk - 1))
+		{
+			// the whole chunk translates linearly; copy it straight from the
+			// backing memory only if every unit in it maps onto the same
+			// array, so handlers installed over part of it are still called
+			u8 const *const base = direct ? byte_ptr(space.get_read_ptr(tfirst), tfirst) : nullptr;
+			bool linear = base != nullptr;
+			for (u32 i = unitmask + 1 - (tfirst & unitmask); linear && (i < chunk); i += unitmask + 1)
+				linear = byte_ptr(space.get_read_ptr(tfirst + i), tfirst + i) == base + i;
+			if (linear)
+				std::copy_n(base, chunk, dest);
+			else
+				for (u32 i = 0; i < chunk; i++)
+					dest[i] = space.read_byte(tfirst + i);
+
+			// writability is a property of each unit
+			for (u32 i = 0; i < chunk; )
+			{
+				u32 const count = std::min<u32>(unitmask + 1 - ((tfirst + i) & unitmask), chunk - i);
+				std::fill_n(valid + i, count, (writable && space.get_write_ptr(tfirst + i)) ? 3 : 1);
+				i += count;
+			}
+		}
+		else
+		{
+			// something is mapped part way through; go a byte at a time
+			for (u32 i = 0; i < chunk; i++)
+			{
+				offs_t taddr = (first + i) & space.logaddrmask();
+				if (memory.translate(space.spacenum(), TRANSLATE_READ_DEBUG, taddr))
+				{
+					dest[i] = space.read_byte(taddr);
+					valid[i] = (writable && space.get_write_ptr(taddr)) ? 3 : 1;
+				}
+				else
+				{
+					dest[i] = space.unmap();
+					valid[i] = 0;
+				}
+			}
+		}
+		pos += chunk;
+	}
+}
+
 debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu, debugger_console& console)
 	: m_machine(machine)
 	, m_console(console)
@@ -170,6 +298,9 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("over",      CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_over, this, _1, _2));
 	m_console.register_command("o",         CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_over, this, _1, _2));
 	m_console.register_command("out" ,      CMDFLAG_NONE, 0, 0, 0, std::bind(&debugger_commands::execute_out, this, _1, _2));
+	m_console.register_command("stepback",  CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_stepback, this, _1, _2));
+	m_console.register_command("sb",        CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_stepback, this, _1, _2));
+	m_console.register_command("snapinterval", CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_snapinterval, this, _1, _2));
 	m_console.register_command("go",        CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_go, this, _1, _2));
 	m_console.register_command("g",         CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_go, this, _1, _2));
 	m_console.register_command("gvblank",   CMDFLAG_NONE, 0, 0, 0, std::bind(&debugger_commands::execute_go_vblank, this, _1, _2));
@@ -226,6 +357,9 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("rplist",    CMDFLAG_NONE, 0, 0, 0, std::bind(&debugger_commands::execute_rplist, this, _1, _2));
 
 	m_console.register_command("hotspot",   CMDFLAG_NONE, 0, 0, 3, std::bind(&debugger_commands::execute_hotspot, this, _1, _2));
+	m_console.register_command("profile",   CMDFLAG_NONE, 0, 0, 2, std::bind(&debugger_commands::execute_profile, this, _1, _2));
+	m_console.register_command("proflist",  CMDFLAG_NONE, 0, 0, 2, std::bind(&debugger_commands::execute_proflist, this, _1, _2));
+	m_console.register_command("profsave",  CMDFLAG_NONE, 0, 1, 2, std::bind(&debugger_commands::execute_profsave, this, _1, _2));
 
 	m_console.register_command("statesave", CMDFLAG_NONE, 0, 1, 1, std::bind(&debugger_commands::execute_statesave, this, _1, _2));
 	m_console.register_command("ss",        CMDFLAG_NONE, 0, 1, 1, std::bind(&debugger_commands::execute_statesave, this, _1, _2));
@@ -944,6 +1078,46 @@ void debugger_commands::execute_step(int ref, const std::vector<std::string> &pa
 }
 
 
+/*-------------------------------------------------
+    execute_stepback - execute the stepback
+    command
+-------------------------------------------------*/
+
+void debugger_commands::execute_stepback(int ref, const std::vector<std::string> &params)
+{
+	/* if we have a parameter, use it */
+	u64 steps = 1;
+	if (params.size() > 0 && !validate_number_parameter(params[0], steps))
+		return;
+
+	if (!m_console.get_visible_cpu()->debug()->step_back(steps))
+		m_console.printf("No rewind state to step back from.  Rewind must be enabled and a step taken first.\n");
+}
+
+
+/*-------------------------------------------------
+    execute_snapinterval - execute the
+    snapinterval command
+-------------------------------------------------*/
+
+void debugger_commands::execute_snapinterval(int ref, const std::vector<std::string> &params)
+{
+	debugger_cpu &debugcpu = m_machine.debugger().cpu();
+	if (params.size() > 0)
+	{
+		u64 interval;
+		if (!validate_number_parameter(params[0], interval))
+			return;
+		debugcpu.set_snapshot_interval(interval);
+	}
+
+	if (debugcpu.snapshot_interval() != 0)
+		m_console.printf("Rewind states are saved at most every %d instructions\n", (int)debugcpu.snapshot_interval());
+	else
+		m_console.printf("Rewind states are saved at every step\n");
+}
+
+
 /*-------------------------------------------------
     execute_over - execute the over command
 -------------------------------------------------*/
@@ -1908,6 +2082,155 @@ void debugger_commands::execute_hotspot(int ref, const std::vector<std::string>
 }
 
 
+/*-------------------------------------------------
+    execute_profile - execute the profile command
+-------------------------------------------------*/
+
+void debugger_commands::execute_profile(int ref, const std::vector<std::string> &params)
+{
+	/* "off" or no params stops the profiler on every CPU, keeping the samples */
+	if (params.empty() || !core_stricmp(params[0].c_str(), "off"))
+	{
+		for (device_execute_interface &exec : execute_interface_enumerator(m_machine.root_device()))
+			if (exec.device().debug()->profiling())
+			{
+				exec.device().debug()->profile_stop();
+				m_console.printf("Stopped profiling CPU '%s' after %d samples\n", exec.device().tag(), (int)exec.device().debug()->profile_total());
+			}
+		m_machine.debug_view().update_all(DVT_PROFILE);
+		return;
+	}
+
+	/* extract parameters */
+	u64 interval;
+	if (!validate_number_parameter(params[0], interval))
+		return;
+	device_t *device = nullptr;
+	if (params.size() > 1 && !validate_cpu_parameter(params[1].c_str(), device))
+		return;
+
+	/* start on the given CPU, or on all of them */
+	for (device_execute_interface &exec : execute_interface_enumerator(m_machine.root_device()))
+		if (!device || &exec.device() == device)
+		{
+			exec.device().debug()->profile_start(interval);
+			if (interval)
+				m_console.printf("Now profiling CPU '%s' every %d cycles\n", exec.device().tag(), (int)interval);
+		}
+	m_machine.debug_view().update_all(DVT_PROFILE);
+}
+
+
+/*-------------------------------------------------
+    profile_sorted - gather a CPU's profile
+    samples, most frequent first
+-------------------------------------------------*/
+
+static std::vector<std::pair<offs_t, u64> > profile_sorted(device_debug &debug)
+{
+	std::vector<std::pair<offs_t, u64> > result(debug.profile_samples().begin(), debug.profile_samples().end());
+	std::sort(result.begin(), result.end(), [] (const auto &a, const auto &b) { return (a.second != b.second) ? (a.second > b.second) : (a.first < b.first); });
+	return result;
+}
+
+
+/*-------------------------------------------------
+    execute_proflist - execute the proflist
+    command
+-------------------------------------------------*/
+
+void debugger_commands::execute_proflist(int ref, const std::vector<std::string> &params)
+{
+	/* extract parameters */
+	device_t *device = nullptr;
+	if (!params.empty() && !validate_cpu_parameter(params[0].c_str(), device))
+		return;
+	u64 count = 16;
+	if (params.size() > 1 && !validate_number_parameter(params[1], count))
+		return;
+
+	bool printed = false;
+	for (device_execute_interface &exec : execute_interface_enumerator(m_machine.root_device()))
+	{
+		device_debug &debug = *exec.device().debug();
+		if ((device && &exec.device() != device) || debug.profile_total() == 0)
+			continue;
+
+		/* list the busiest PCs with their disassembly */
+		m_console.printf("CPU '%s': %d samples at %d PCs\n", exec.device().tag(), (int)debug.profile_total(), (int)debug.profile_samples().size());
+		std::unique_ptr<debug_disasm_buffer> buffer;
+		device_disasm_interface *dasmintf;
+		if (exec.device().interface(dasmintf))
+			buffer = std::make_unique<debug_disasm_buffer>(exec.device());
+
+		auto const samples = profile_sorted(debug);
+		for (size_t index = 0; index < samples.size() && index < count; index++)
+		{
+			std::string instruction;
+			if (buffer)
+			{
+				offs_t next_offset, size;
+				u32 info;
+				buffer->disassemble(samples[index].first, instruction, next_offset, size, info);
+			}
+			m_console.printf("  %0*X %10d %5.1f%%  %s\n",
+					debug.logaddrchars(), samples[index].first,
+					(int)samples[index].second,
+					100.0 * double(samples[index].second) / double(debug.profile_total()),
+					instruction);
+		}
+		printed = true;
+	}
+
+	if (!printed)
+		m_console.printf("No profile samples\n");
+}
+
+
+/*-------------------------------------------------
+    execute_profsave - execute the profsave
+    command
+-------------------------------------------------*/
+
+void debugger_commands::execute_profsave(int ref, const std::vector<std::string> &params)
+{
+	std::string filename = params[0];
+
+	/* replace macros */
+	strreplace(filename, "{game}", m_machine.basename());
+
+	/* validate parameters */
+	device_t *device = nullptr;
+	if (params.size() > 1 && !validate_cpu_parameter(params[1].c_str(), device))
+		return;
+
+	/* write folded stacks, one "cpu;pc count" line per PC, as read by flame graph tools */
+	std::ofstream f(filename);
+	if (!f)
+	{
+		m_console.printf("Error opening file '%s'\n", params[0]);
+		return;
+	}
+	int lines = 0;
+	for (device_execute_interface &exec : execute_interface_enumerator(m_machine.root_device()))
+	{
+		device_debug &debug = *exec.device().debug();
+		if (device && &exec.device() != device)
+			continue;
+		for (auto const &sample : profile_sorted(debug))
+		{
+			util::stream_format(f, "%s;%0*X %d\n", exec.device().tag(), debug.logaddrchars(), sample.first, sample.second);
+			lines++;
+		}
+	}
+	if (!f)
+	{
+		m_console.printf("Error writing file '%s'\n", params[0]);
+		return;
+	}
+	m_console.printf("Saved %d profile entries to %s\n", lines, filename);
+}
+
 /*-------------------------------------------------
     execute_statesave - execute the statesave command
 -------------------------------------------------*/
@@ -1947,12 +2270,16 @@ void debugger_commands::execute_rewind(int ref, const std::vector<std::string> &
 {
 	bool success = m_machine.rewind_step();
 	if (success)
+	{
+		m_machine.debugger().cpu().snapshot_loaded();
+
 		// clear all PC & memory tracks
 		for (device_t &device : device_enumerator(m_machine.root_device()))
 		{
 			device.debug()->track_pc_data_clear();
 			device.debug()->track_mem_data_clear();
 		}
+	}
 	else
 		m_console.printf("Rewind error occured.  See error.log for details.\n");
 }
@@ -2680,12 +3007,18 @@ void debugger_commands::execute_cheatinit(int ref, const std::vector<std::string
 		region_count++;
 	}
 
-	/* determine the writable extent of each region in total */
+	/* gather the writable addresses of each region, reading memory in bulk */
+	std::vector<cheat_map> found;
+	memory_block block;
 	for (i = 0; i < region_count; i++)
 		if (!cheat_region[i].disabled)
 			for (curaddr = cheat_region[i].offset; curaddr <= cheat_region[i].endoffset; curaddr += m_cheat.width)
-				if (cheat_address_is_valid(*space, curaddr))
-					real_length++;
+			{
+				u64 value;
+				if (cheat_read_block(&m_cheat, *space, block, curaddr, true, value))
+					found.push_back(cheat_map{ curaddr, value, value, 1, 0 });
+			}
+	real_length = found.size();
 
 	if (real_length == 0)
 	{
@@ -2717,18 +3050,8 @@ void debugger_commands::execute_cheatinit(int ref, const std::vector<std::string
 	}
 
 	/* initialize cheatmap in the selected space */
-	for (i = 0; i < region_count; i++)
-		if (!cheat_region[i].disabled)
-			for (curaddr = cheat_region[i].offset; curaddr <= cheat_region[i].endoffset; curaddr += m_cheat.width)
-				if (cheat_address_is_valid(*space, curaddr))
-				{
-					m_cheat.cheatmap[active_cheat].previous_value = cheat_read_extended(&m_cheat, *space, curaddr);
-					m_cheat.cheatmap[active_cheat].first_value = m_cheat.cheatmap[active_cheat].previous_value;
-					m_cheat.cheatmap[active_cheat].offset = curaddr;
-					m_cheat.cheatmap[active_cheat].state = 1;
-					m_cheat.cheatmap[active_cheat].undo = 0;
-					active_cheat++;
-				}
+	std::copy(found.begin(), found.end(), m_cheat.cheatmap.begin() + active_cheat);
+	active_cheat += real_length;
 
 	/* give a detailed init message to avoid searches being mistakingly carried out on the wrong CPU */
 	device_t *cpu = nullptr;
@@ -2809,11 +3132,13 @@ void debugger_commands::execute_cheatnext(int ref, const std::vector<std::string
 
 	m_cheat.undo++;
 
-	/* execute the search */
+	/* execute the search, reading memory in bulk */
+	memory_block block;
 	for (cheatindex = 0; cheatindex < m_cheat.cheatmap.size(); cheatindex += 1)
 		if (m_cheat.cheatmap[cheatindex].state == 1)
 		{
-			u64 cheat_value = cheat_read_extended(&m_cheat, *space, m_cheat.cheatmap[cheatindex].offset);
+			u64 cheat_value;
+			cheat_read_block(&m_cheat, *space, block, m_cheat.cheatmap[cheatindex].offset, false, cheat_value);
 			u64 comp_byte = (ref == 0) ? m_cheat.cheatmap[cheatindex].previous_value : m_cheat.cheatmap[cheatindex].first_value;
 			u8 disable_byte = false;
 
@@ -2963,11 +3288,14 @@ void debugger_commands::execute_cheatlist(int ref, const std::vector<std::string
 
 	/* write the cheat list */
 	util::ovectorstream output;
+	memory_block block;
 	for (cheatindex = 0; cheatindex < m_cheat.cheatmap.size(); cheatindex += 1)
 	{
 		if (m_cheat.cheatmap[cheatindex].state == 1)
 		{
-			u64 value = cheat_byte_swap(&m_cheat, cheat_read_extended(&m_cheat, *space, m_cheat.cheatmap[cheatindex].offset)) & sizemask;
+			u64 value;
+			cheat_read_block(&m_cheat, *space, block, m_cheat.cheatmap[cheatindex].offset, false, value);
+			value = cheat_byte_swap(&m_cheat, value) & sizemask;
 			offs_t address = space->byte_to_address(m_cheat.cheatmap[cheatindex].offset);
 
 			if (!params.empty())
@@ -3096,7 +3424,72 @@ void debugger_commands::execute_find(int ref, const std::vector<std::string> &pa
 		}
 	}
 
-	/* now search */
+	/* byte-addressed spaces are searched a block at a time */
+	if (space->addr_shift() == 0)
+	{
+		/* lay the data out as bytes in the space's order, masking out wildcards */
+		std::vector<u8> pattern, care;
+		for (int j = 0; j < data_count; j++)
+		{
+			int const size = data_size[j] & 0x0f;
+			for (int k = 0; k < size; k++)
+			{
+				int const shift = 8 * ((space->endianness() == ENDIANNESS_LITTLE) ? k : (size - 1 - k));
+				pattern.push_back(u8(data_to_find[j] >> shift));
+				care.push_back((data_size[j] & 0x10) ? 0 : 1);
+			}
+		}
+		u32 const patlen = pattern.size();
+		u32 const key = std::find(care.begin(), care.end(), 1) - care.begin();
+		u32 const step = data_size[0];
+
+		memory_block block;
+		for (u64 i = offset; i <= endoffset; )
+		{
+			/* read enough for a block's worth of candidates */
+			u64 const count = std::min<u64>((endoffset - i) / step + 1, MEMORY_BLOCK_SIZE / step);
+			u32 const last = (count - 1) * step;
+			read_memory_block(*space, i, last + patlen, block, false);
+
+			u8 const *const data = &block.data[0];
+			u8 const *const valid = &block.valid[0];
+			for (u32 c = 0; c <= last; )
+			{
+				/* skip straight to the next occurrence of the first byte that must match */
+				if (key < patlen)
+				{
+					void const *const hit = memchr(data + c + key, pattern[key], last - c + 1);
+					if (!hit)
+						break;
+					u32 const at = u32(reinterpret_cast<u8 const *>(hit) - data) - key;
+					c = at + (step - (at % step)) % step;
+					if (c > last)
+						break;
+					if (c != at)
+						continue;
+				}
+
+				bool match = true;
+				for (u32 j = 0; j < patlen && match; j++)
+					if (care[j])
+						match = valid[c + j] && (data[c + j] == pattern[j]);
+
+				if (match)
+				{
+					found++;
+					m_console.printf("Found at %0*X\n", space->addrchars(), u32(i + c));
+				}
+				c += step;
+			}
+			i += count * step;
+		}
+
+		if (found == 0)
+			m_console.printf("Not found\n");
+		return;
+	}
+
+	/* otherwise, search an item at a time */
 	device_memory_interface &memory = space->device().memory();
 	auto dis = space->device().machine().disable_side_effects();
 	for (u64 i = offset; i <= endoffset; i += data_size[0])
@@ -3376,6 +3769,7 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 	const char *action = nullptr;
 	bool detect_loops = true;
 	bool logerror = false;
+	bool binary = false;
 	device_t *cpu;
 	FILE *f = nullptr;
 	const char *mode;
@@ -3399,6 +3793,8 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 				detect_loops = false;
 			else if (!core_stricmp(flag.c_str(), "logerror"))
 				logerror = true;
+			else if (!core_stricmp(flag.c_str(), "binary"))
+				binary = true;
 			else
 			{
 				m_console.printf("Invalid flag '%s'\n", flag);
@@ -3408,16 +3804,21 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 	}
 	if (!debug_command_parameter_command(action = (params.size() > 3) ? params[3].c_str() : nullptr))
 		return;
+	if (binary && (trace_over || logerror || action != nullptr))
+	{
+		m_console.printf("Binary traces can't trace over, include logerror output or run an action\n");
+		return;
+	}
 
 	/* open the file */
 	if (core_stricmp(filename.c_str(), "off") != 0)
 	{
-		mode = "w";
+		mode = binary ? "wb" : "w";
 
 		/* opening for append? */
 		if ((filename[0] == '>') && (filename[1] == '>'))
 		{
-			mode = "a";
+			mode = binary ? "ab" : "a";
 			filename = filename.substr(2);
 		}
 
@@ -3430,7 +3831,7 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 	}
 
 	/* do it */
-	cpu->debug()->trace(f, trace_over, detect_loops, logerror, action);
+	cpu->debug()->trace(f, trace_over, detect_loops, logerror, action, binary);
 	if (f)
 		m_console.printf("Tracing CPU '%s' to file %s\n", cpu->tag(), filename);
 	else
@@ -76,6 +76,17 @@ private:
 		u8          disabled;
 	};
 
+
+	// a window of memory read in bulk for searching; valid holds 1 for
+	// each byte that translated, plus 2 if it is also directly writable
+	struct memory_block
+	{
+		offs_t          start = 0;
+		u32             length = 0;
+		std::vector<u8> data;
+		std::vector<u8> valid;
+	};
+
 	bool debug_command_parameter_expression(const std::string &param, parsed_expression &result);
 	bool debug_command_parameter_command(const char *param);
 
@@ -83,6 +94,9 @@ private:
 	u64 cheat_sign_extend(const cheat_system *cheatsys, u64 value);
 	u64 cheat_byte_swap(const cheat_system *cheatsys, u64 value);
 	u64 cheat_read_extended(const cheat_system *cheatsys, address_space &space, offs_t address);
+	bool cheat_read_block(const cheat_system *cheatsys, address_space &space, memory_block &block, offs_t address, bool writable, u64 &value);
+
+	void read_memory_block(address_space &space, offs_t address, u32 length, memory_block &block, bool writable);
 
 	u64 execute_min(int params, const u64 *param);
 	u64 execute_max(int params, const u64 *param);
@@ -113,6 +127,8 @@ private:
 	void execute_step(int ref, const std::vector<std::string> &params);
 	void execute_over(int ref, const std::vector<std::string> &params);
 	void execute_out(int ref, const std::vector<std::string> &params);
+	void execute_stepback(int ref, const std::vector<std::string> &params);
+	void execute_snapinterval(int ref, const std::vector<std::string> &params);
 	void execute_go(int ref, const std::vector<std::string> &params);
 	void execute_go_vblank(int ref, const std::vector<std::string> &params);
 	void execute_go_interrupt(int ref, const std::vector<std::string> &params);
@@ -144,6 +160,9 @@ private:
 	void execute_rpdisenable(int ref, const std::vector<std::string> &params);
 	void execute_rplist(int ref, const std::vector<std::string> &params);
 	void execute_hotspot(int ref, const std::vector<std::string> &params);
+	void execute_profile(int ref, const std::vector<std::string> &params);
+	void execute_proflist(int ref, const std::vector<std::string> &params);
+	void execute_profsave(int ref, const std::vector<std::string> &params);
 	void execute_statesave(int ref, const std::vector<std::string> &params);
 	void execute_stateload(int ref, const std::vector<std::string> &params);
 	void execute_rewind(int ref, const std::vector<std::string> &params);
@@ -187,6 +206,8 @@ private:
 	cheat_system m_cheat;
 
 	static const size_t MAX_GLOBALS;
+	static const u32 MEMORY_BLOCK_SIZE;
+	static const u32 MEMORY_BLOCK_CHUNK;
 };
 
 #endif // MAME_EMU_DEBUG_DEBUGCMD_H
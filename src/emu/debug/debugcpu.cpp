@@ -51,6 +51,7 @@ debugger_cpu::debugger_cpu(running_machine &machine)
 	, m_wpsize(0)
 	, m_last_periodic_update_time(0)
 	, m_comments_loaded(false)
+	, m_snapshot_interval(100000)
 {
 	m_tempvar = make_unique_clear<u64[]>(NUM_TEMP_VARIABLES);
 
@@ -281,6 +282,76 @@ void debugger_cpu::reset_transient_flags()
 }
 
 
+//-------------------------------------------------
+//  snapshot_capture - capture a rewind state
+//  along with the instruction count of every CPU;
+//  unless periodic, skipped if the newest one is
+//  less than an interval behind the given CPU
+//-------------------------------------------------
+
+void debugger_cpu::snapshot_capture(device_debug &debug, bool periodic)
+{
+	rewinder &rewind = *m_machine.save().rewind();
+	if (!periodic && m_snapshot_interval != 0 && rewind.enabled())
+	{
+		auto const current = m_snapshots.find(rewind.current_serial());
+		if (current != m_snapshots.end())
+			for (auto const &count : current->second)
+				if (count.first == &debug && debug.instruction_count() - count.second < m_snapshot_interval)
+					return;
+	}
+
+	if (!m_machine.rewind_capture())
+		return;
+
+	// forget the snapshots whose states have been dropped
+	for (auto it = m_snapshots.begin(); it != m_snapshots.end(); )
+		it = rewind.contains(it->first) ? std::next(it) : m_snapshots.erase(it);
+
+	auto &counts = m_snapshots[rewind.current_serial()];
+	for (device_execute_interface &exec : execute_interface_enumerator(m_machine.root_device()))
+		counts.emplace_back(exec.device().debug(), exec.device().debug()->instruction_count());
+}
+
+
+//-------------------------------------------------
+//  snapshot_restore - load the newest snapshot
+//  taken no later than the given instruction of
+//  a CPU, returns true on success
+//-------------------------------------------------
+
+bool debugger_cpu::snapshot_restore(device_debug &debug, u64 target)
+{
+	rewinder &rewind = *m_machine.save().rewind();
+	u64 serial = 0;
+	for (auto const &snapshot : m_snapshots)
+		if (rewind.contains(snapshot.first))
+			for (auto const &count : snapshot.second)
+				if (count.first == &debug && count.second <= target)
+					serial = snapshot.first;
+
+	if (serial == 0 || !rewind.seek(serial))
+		return false;
+	snapshot_loaded();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  snapshot_loaded - put back the instruction
+//  counts after the current rewind state has been
+//  loaded
+//-------------------------------------------------
+
+void debugger_cpu::snapshot_loaded()
+{
+	auto const current = m_snapshots.find(m_machine.save().rewind()->current_serial());
+	if (current != m_snapshots.end())
+		for (auto const &count : current->second)
+			count.first->set_instruction_count(count.second);
+}
+
+
 //**************************************************************************
 //  EXECUTION HOOKS
 //**************************************************************************
@@ -426,7 +497,10 @@ device_debug::device_debug(device_t &device)
 	, m_instrhook(nullptr)
 	, m_stepaddr(0)
 	, m_stepsleft(0)
+	, m_instructions(0)
+	, m_snapshot_next(0)
 	, m_stopaddr(0)
+	, m_stopcount(0)
 	, m_stoptime(attotime::zero)
 	, m_stopirq(0)
 	, m_stopexception(0)
@@ -440,6 +514,9 @@ device_debug::device_debug(device_t &device)
 	, m_triggered_watchpoint(nullptr)
 	, m_trace(nullptr)
 	, m_hotspot_threshhold(0)
+	, m_profile_interval(0)
+	, m_profile_next(0)
+	, m_profile_total(0)
 	, m_track_pc_set()
 	, m_track_pc(false)
 	, m_comment_set()
@@ -723,11 +800,28 @@ void device_debug::instruction_hook(offs_t curpc)
 
 	// update the history
 	m_pc_history[m_pc_history_index++ % HISTORY_SIZE] = curpc;
+	m_instructions++;
+
+	// take a periodic snapshot to step back to
+	if (m_snapshot_next != 0 && m_instructions >= m_snapshot_next && !debugcpu.is_stopped())
+	{
+		debugcpu.snapshot_capture(*this, true);
+		arm_snapshots();
+	}
 
 	// update total cycles
 	m_last_total_cycles = m_total_cycles;
 	m_total_cycles = m_exec->total_cycles();
 
+	// take a profile sample for every interval that ended within this instruction
+	if (m_profile_interval != 0 && m_total_cycles >= m_profile_next)
+	{
+		u64 const samples = (m_total_cycles - m_profile_next) / m_profile_interval + 1;
+		m_profile_samples[curpc] += samples;
+		m_profile_total += samples;
+		m_profile_next += samples * m_profile_interval;
+	}
+
 	// are we tracking our recent pc visits?
 	if (m_track_pc)
 	{
@@ -767,8 +861,15 @@ void device_debug::instruction_hook(offs_t curpc)
 		}
 	}
 
+	// when replaying, stop at the target instruction and ignore breakpoints on the way
+	if ((m_flags & DEBUG_FLAG_STOP_COUNT) != 0)
+	{
+		if (!debugcpu.is_stopped() && m_instructions >= m_stopcount)
+			debugcpu.set_execution_stopped();
+	}
+
 	// handle breakpoints
-	if (!debugcpu.is_stopped() && (m_flags & (DEBUG_FLAG_STOP_TIME | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP)) != 0)
+	else if (!debugcpu.is_stopped() && (m_flags & (DEBUG_FLAG_STOP_TIME | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP)) != 0)
 	{
 		// see if we hit a target time
 		if ((m_flags & DEBUG_FLAG_STOP_TIME) != 0 && machine.time() >= m_stoptime)
@@ -922,7 +1023,8 @@ void device_debug::single_step(int numsteps)
 {
 	assert(m_exec != nullptr);
 
-	m_device.machine().rewind_capture();
+	m_device.machine().debugger().cpu().snapshot_capture(*this, false);
+	arm_snapshots();
 	m_stepsleft = numsteps;
 	m_stepaddr = ~0;
 	m_flags |= DEBUG_FLAG_STEPPING;
@@ -939,7 +1041,8 @@ void device_debug::single_step_over(int numsteps)
 {
 	assert(m_exec != nullptr);
 
-	m_device.machine().rewind_capture();
+	m_device.machine().debugger().cpu().snapshot_capture(*this, false);
+	arm_snapshots();
 	m_stepsleft = numsteps;
 	m_stepaddr = ~0;
 	m_flags |= DEBUG_FLAG_STEPPING_OVER;
@@ -956,7 +1059,8 @@ void device_debug::single_step_out()
 {
 	assert(m_exec != nullptr);
 
-	m_device.machine().rewind_capture();
+	m_device.machine().debugger().cpu().snapshot_capture(*this, false);
+	arm_snapshots();
 	m_stepsleft = 100;
 	m_stepaddr = ~0;
 	m_flags |= DEBUG_FLAG_STEPPING_OUT;
@@ -964,6 +1068,45 @@ void device_debug::single_step_out()
 }
 
 
+//-------------------------------------------------
+//  step_back - go back the requested number of
+//  instructions by loading the newest snapshot
+//  before them and replaying from it
+//-------------------------------------------------
+
+bool device_debug::step_back(u64 numsteps)
+{
+	assert(m_exec != nullptr);
+
+	debugger_cpu &debugcpu = m_device.machine().debugger().cpu();
+	u64 const target = (numsteps < m_instructions) ? (m_instructions - numsteps) : 0;
+	if (!debugcpu.snapshot_restore(*this, target))
+		return false;
+
+	// the snapshot may be the target itself, otherwise run forward to it
+	if (m_instructions < target)
+	{
+		m_stopcount = target;
+		m_snapshot_next = 0;
+		m_flags |= DEBUG_FLAG_STOP_COUNT;
+		debugcpu.set_execution_running();
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  arm_snapshots - schedule the next periodic
+//  snapshot while this device runs
+//-------------------------------------------------
+
+void device_debug::arm_snapshots()
+{
+	u64 const interval = m_device.machine().debugger().cpu().snapshot_interval();
+	m_snapshot_next = (interval != 0 && m_device.machine().save().rewind()->enabled()) ? (m_instructions + interval) : 0;
+}
+
+
 //-------------------------------------------------
 //  go - execute the device until it hits the given
 //  address
@@ -974,6 +1117,7 @@ void device_debug::go(offs_t targetpc)
 	assert(m_exec != nullptr);
 
 	m_device.machine().rewind_invalidate();
+	arm_snapshots();
 	m_stopaddr = targetpc;
 	m_flags |= DEBUG_FLAG_STOP_PC;
 	m_device.machine().debugger().cpu().set_execution_running();
@@ -989,6 +1133,7 @@ void device_debug::go_vblank()
 	assert(m_exec != nullptr);
 
 	m_device.machine().rewind_invalidate();
+	arm_snapshots();
 	m_flags |= DEBUG_FLAG_STOP_VBLANK;
 	m_device.machine().debugger().cpu().go_vblank();
 }
@@ -1004,6 +1149,7 @@ void device_debug::go_interrupt(int irqline)
 	assert(m_exec != nullptr);
 
 	m_device.machine().rewind_invalidate();
+	arm_snapshots();
 	m_stopirq = irqline;
 	m_flags |= DEBUG_FLAG_STOP_INTERRUPT;
 	m_device.machine().debugger().cpu().set_execution_running();
@@ -1024,6 +1170,7 @@ void device_debug::go_exception(int exception, const char *condition)
 	assert(m_exec != nullptr);
 
 	m_device.machine().rewind_invalidate();
+	arm_snapshots();
 	m_stopexception = exception;
 	m_exception_condition = std::make_unique<parsed_expression>(*m_symtable, condition);
 	m_flags |= DEBUG_FLAG_STOP_EXCEPTION;
@@ -1041,6 +1188,7 @@ void device_debug::go_milliseconds(u64 milliseconds)
 	assert(m_exec != nullptr);
 
 	m_device.machine().rewind_invalidate();
+	arm_snapshots();
 	m_stoptime = m_device.machine().time() + attotime::from_msec(milliseconds);
 	m_flags |= DEBUG_FLAG_STOP_TIME;
 	m_device.machine().debugger().cpu().set_execution_running();
@@ -1056,6 +1204,7 @@ void device_debug::go_privilege(const char *condition)
 {
 	assert(m_exec != nullptr);
 	m_device.machine().rewind_invalidate();
+	arm_snapshots();
 	m_privilege_condition = std::make_unique<parsed_expression>(*m_symtable, condition);
 	m_flags |= DEBUG_FLAG_STOP_PRIVILEGE;
 	m_device.machine().debugger().cpu().set_execution_running();
@@ -1371,6 +1520,20 @@ void device_debug::hotspot_track(int numspots, int threshhold)
 }
 
 
+//-------------------------------------------------
+//  profile_start - start sampling the PC every
+//  interval cycles, discarding earlier samples
+//-------------------------------------------------
+
+void device_debug::profile_start(u64 interval)
+{
+	profile_clear();
+	m_profile_interval = m_exec ? interval : 0;
+	if (m_profile_interval != 0)
+		m_profile_next = m_exec->total_cycles() + m_profile_interval;
+}
+
+
 //-------------------------------------------------
 //  history_pc - return an entry from the PC
 //  history
@@ -1554,14 +1717,14 @@ u32 device_debug::compute_opcode_crc32(offs_t pc) const
 //  trace - trace execution of a given device
 //-------------------------------------------------
 
-void device_debug::trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action)
+void device_debug::trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary)
 {
 	// delete any existing tracers
 	m_trace = nullptr;
 
 	// if we have a new file, make a new tracer
 	if (file != nullptr)
-		m_trace = std::make_unique<tracer>(*this, *file, trace_over, detect_loops, logerror, action);
+		m_trace = std::make_unique<tracer>(*this, *file, trace_over, detect_loops, logerror, action, binary);
 }
 
 
@@ -1606,11 +1769,11 @@ void device_debug::compute_debug_flags()
 
 	// if we're tracking history, or we're hooked, or stepping, or stopping at a breakpoint
 	// make sure we call the hook
-	if ((m_flags & (DEBUG_FLAG_HISTORY | DEBUG_FLAG_HOOKED | DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP)) != 0)
+	if ((m_flags & (DEBUG_FLAG_HISTORY | DEBUG_FLAG_HOOKED | DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP | DEBUG_FLAG_STOP_COUNT)) != 0)
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
 
-	// also call if we are tracing
-	if (m_trace != nullptr)
+	// also call if we are tracing or profiling
+	if (m_trace != nullptr || m_profile_interval != 0)
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
 
 	// if we are stopping at a particular time and that time is within the current timeslice, we need to be called
@@ -1808,7 +1971,7 @@ void device_debug::hotspot_check(address_space &space, offs_t address)
 //  tracer - constructor
 //-------------------------------------------------
 
-device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action)
+device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary)
 	: m_debug(debug)
 	, m_file(file)
 	, m_action((action != nullptr) ? action : "")
@@ -1818,8 +1981,16 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, b
 	, m_nextdex(0)
 	, m_trace_over(trace_over)
 	, m_trace_over_target(~0)
+	, m_binary(binary)
 {
 	memset(m_history, 0, sizeof(m_history));
+
+	// binary traces start with a magic number
+	if (m_binary)
+	{
+		m_binary_pcs.reserve(TRACE_BINARY_PCS);
+		fwrite("MAMETRC1", 1, 8, &m_file);
+	}
 }
 
 
@@ -1829,6 +2000,10 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, b
 
 device_debug::tracer::~tracer()
 {
+	// write out any buffered binary records
+	if (m_binary)
+		write_binary();
+
 	// make sure we close the file if we can
 	fclose(&m_file);
 }
@@ -1841,6 +2016,15 @@ device_debug::tracer::~tracer()
 
 void device_debug::tracer::update(offs_t pc)
 {
+	// binary traces just collect the PC; everything else is done offline
+	if (m_binary)
+	{
+		m_binary_pcs.push_back(pc);
+		if (m_binary_pcs.size() == TRACE_BINARY_PCS)
+			write_binary();
+		return;
+	}
+
 	// are we in trace over mode and in a subroutine?
 	if (m_trace_over && m_trace_over_target != ~0)
 	{
@@ -1909,6 +2093,10 @@ void device_debug::tracer::update(offs_t pc)
 
 void device_debug::tracer::vprintf(const char *format, va_list va)
 {
+	// text would corrupt a binary trace
+	if (m_binary)
+		return;
+
 	// pass through to the file
 	vfprintf(&m_file, format, va);
 	fflush(&m_file);
@@ -1922,6 +2110,69 @@ void device_debug::tracer::vprintf(const char *format, va_list va)
 
 void device_debug::tracer::flush()
 {
+	if (m_binary)
+		write_binary();
+	fflush(&m_file);
+}
+
+
+//-------------------------------------------------
+//  write_binary - write the collected PCs to a
+//  binary trace, preceded by the opcode bytes of
+//  any PC whose bytes differ from the ones last
+//  written for it
+//
+//  All values are little-endian.  After the
+//  "MAMETRC1" magic, the file holds records of:
+//    'C', u32 pc, u8 length, length opcode bytes
+//    'P', u32 count, count u32 PCs
+//  A 'C' record replaces any earlier one for the
+//  same PC, as after a bank switch or overlay
+//  load.  Opcode bytes are read when the record
+//  is written, so code modified while the PCs are
+//  buffered shows its later contents.
+//-------------------------------------------------
+
+void device_debug::tracer::write_binary()
+{
+	if (m_binary_pcs.empty())
+		return;
+
+	std::vector<u8> out;
+	out.reserve(5 + m_binary_pcs.size() * 4);
+	auto const put32 = [&out] (u32 value) { out.insert(out.end(), { u8(value), u8(value >> 8), u8(value >> 16), u8(value >> 24) }); };
+
+	debug_disasm_buffer buffer(m_debug.device());
+	std::vector<u8> opbuf;
+	for (offs_t pc : m_binary_pcs)
+	{
+		// the same bytes at the same PC are the same instruction
+		std::vector<u8> &written = m_binary_written[pc];
+		if (!written.empty())
+		{
+			buffer.data_get(pc, written.size(), true, opbuf);
+			if (opbuf == written)
+				continue;
+		}
+
+		opbuf.clear();
+		u32 const dasmresult = buffer.disassemble_info(pc);
+		buffer.data_get(pc, dasmresult & util::disasm_interface::LENGTHMASK, true, opbuf);
+		opbuf.resize(std::min<std::size_t>(opbuf.size(), 255));
+		written = opbuf;
+		out.push_back('C');
+		put32(pc);
+		out.push_back(u8(opbuf.size()));
+		out.insert(out.end(), opbuf.begin(), opbuf.end());
+	}
+
+	out.push_back('P');
+	put32(m_binary_pcs.size());
+	for (offs_t pc : m_binary_pcs)
+		put32(pc);
+	m_binary_pcs.clear();
+
+	fwrite(&out[0], 1, out.size(), &m_file);
 	fflush(&m_file);
 }
 
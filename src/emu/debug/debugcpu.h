@@ -13,7 +13,9 @@
 
 #pragma once
 
+#include <map>
 #include <set>
+#include <unordered_map>
 
 
 //**************************************************************************
@@ -74,6 +76,11 @@ public:
 	void single_step_over(int numsteps = 1);
 	void single_step_out();
 
+	// stepping back by replaying from a snapshot
+	bool step_back(u64 numsteps = 1);
+	u64 instruction_count() const { return m_instructions; }
+	void set_instruction_count(u64 count) { m_instructions = count; }
+
 	// execution
 	void go(offs_t targetpc = ~0);
 	void go_vblank();
@@ -122,6 +129,15 @@ public:
 	bool hotspot_tracking_enabled() const { return !m_hotspots.empty(); }
 	void hotspot_track(int numspots, int threshhold);
 
+	// sampling profiler
+	bool profiling() const { return m_profile_interval != 0; }
+	u64 profile_interval() const { return m_profile_interval; }
+	void profile_start(u64 interval);
+	void profile_stop() { m_profile_interval = 0; }
+	void profile_clear() { m_profile_samples.clear(); m_profile_total = 0; }
+	const std::unordered_map<offs_t, u64> &profile_samples() const { return m_profile_samples; }
+	u64 profile_total() const { return m_profile_total; }
+
 	// comments
 	void comment_add(offs_t address, const char *comment, rgb_t color);
 	bool comment_remove(offs_t addr);
@@ -149,7 +165,7 @@ public:
 	void track_mem_data_clear() { m_track_mem_set.clear(); }
 
 	// tracing
-	void trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action);
+	void trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary = false);
 	void trace_printf(const char *fmt, ...) ATTR_PRINTF(2,3);
 	void trace_flush() { if (m_trace != nullptr) m_trace->flush(); }
 
@@ -164,6 +180,7 @@ private:
 	void halt_on_next_instruction_impl(util::format_argument_pack<std::ostream> &&args);
 
 	// internal helpers
+	void arm_snapshots();
 	void prepare_for_step_overout(offs_t pc);
 	void errorlog_write_line(const char *line);
 
@@ -190,9 +207,12 @@ private:
 	// stepping information
 	offs_t                  m_stepaddr;                 // step target address for DEBUG_FLAG_STEPPING_OVER
 	int                     m_stepsleft;                // number of steps left until done
+	u64                     m_instructions;             // number of instructions hooked so far
+	u64                     m_snapshot_next;            // instruction count of the next periodic snapshot, 0 if none
 
 	// execution information
 	offs_t                  m_stopaddr;                 // stop address for DEBUG_FLAG_STOP_PC
+	u64                     m_stopcount;                // stop instruction count for DEBUG_FLAG_STOP_COUNT
 	attotime                m_stoptime;                 // stop time for DEBUG_FLAG_STOP_TIME
 	int                     m_stopirq;                  // stop IRQ number for DEBUG_FLAG_STOP_INTERRUPT
 	int                     m_stopexception;            // stop exception number for DEBUG_FLAG_STOP_EXCEPTION
@@ -218,7 +238,7 @@ private:
 	class tracer
 	{
 	public:
-		tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action);
+		tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary);
 		~tracer();
 
 		void update(offs_t pc);
@@ -228,6 +248,9 @@ private:
 
 	private:
 		static const int TRACE_LOOPS = 64;
+		static const int TRACE_BINARY_PCS = 65536;
+
+		void write_binary();
 
 		device_debug &      m_debug;                    // reference to our owner
 		FILE &              m_file;                     // tracing file for this CPU
@@ -241,6 +264,9 @@ private:
 		offs_t              m_trace_over_target;        // target for tracing over
 														//    (0 = not tracing over,
 														//    ~0 = not currently tracing over)
+		bool                m_binary;                   // true if we're writing a binary trace
+		std::vector<offs_t> m_binary_pcs;               // PCs not yet written to a binary trace
+		std::unordered_map<offs_t, std::vector<u8>> m_binary_written; // opcode bytes last written for each PC
 	};
 	std::unique_ptr<tracer>                m_trace;                    // tracer state
 
@@ -255,6 +281,12 @@ private:
 	std::vector<hotspot_entry> m_hotspots;              // hotspot list
 	int                     m_hotspot_threshhold;       // threshhold for the number of hits to print
 
+	// sampling profiler
+	u64                     m_profile_interval;         // cycles between samples, 0 if not profiling
+	u64                     m_profile_next;             // total cycle count of the next sample
+	u64                     m_profile_total;            // number of samples taken
+	std::unordered_map<offs_t, u64> m_profile_samples;  // samples taken at each PC
+
 	std::vector<memory_passthrough_handler *> m_phr;    // passthrough handler reference for each space, read mode
 	std::vector<memory_passthrough_handler *> m_phw;    // passthrough handler reference for each space, write mode
 	std::vector<int>        m_notifiers;                // notifiers for each space
@@ -337,12 +369,13 @@ private:
 	static constexpr u32 DEBUG_FLAG_SUSPENDED       = 0x00004000;       // CPU currently suspended
 	static constexpr u32 DEBUG_FLAG_LIVE_BP         = 0x00010000;       // there are live breakpoints for this CPU
 	static constexpr u32 DEBUG_FLAG_STOP_PRIVILEGE  = 0x00020000;       // run until execution level changes
+	static constexpr u32 DEBUG_FLAG_STOP_COUNT      = 0x00040000;       // replaying up to instruction m_stopcount
 
 	static constexpr u32 DEBUG_FLAG_STEPPING_ANY    = DEBUG_FLAG_STEPPING | DEBUG_FLAG_STEPPING_OVER | DEBUG_FLAG_STEPPING_OUT;
 	static constexpr u32 DEBUG_FLAG_TRACING_ANY     = DEBUG_FLAG_TRACING | DEBUG_FLAG_TRACING_OVER;
 	static constexpr u32 DEBUG_FLAG_TRANSIENT       = DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC |
 			DEBUG_FLAG_STOP_INTERRUPT | DEBUG_FLAG_STOP_EXCEPTION | DEBUG_FLAG_STOP_VBLANK |
-			DEBUG_FLAG_STOP_TIME | DEBUG_FLAG_STOP_PRIVILEGE;
+			DEBUG_FLAG_STOP_TIME | DEBUG_FLAG_STOP_PRIVILEGE | DEBUG_FLAG_STOP_COUNT;
 };
 
 //**************************************************************************
@@ -411,6 +444,14 @@ public:
 	void ensure_comments_loaded();
 	void reset_transient_flags();
 
+	// snapshots for stepping back; one is taken at most every interval instructions
+	// of the CPU being run, or at every step if the interval is 0
+	u64 snapshot_interval() const { return m_snapshot_interval; }
+	void set_snapshot_interval(u64 interval) { m_snapshot_interval = interval; }
+	void snapshot_capture(device_debug &debug, bool periodic);
+	bool snapshot_restore(device_debug &debug, u64 target);
+	void snapshot_loaded();
+
 private:
 	static const size_t NUM_TEMP_VARIABLES;
 
@@ -443,6 +484,9 @@ private:
 	osd_ticks_t m_last_periodic_update_time;
 
 	bool        m_comments_loaded;
+
+	u64         m_snapshot_interval;
+	std::map<u64, std::vector<std::pair<device_debug *, u64> > > m_snapshots; // rewind serial -> instruction count of each CPU
 };
 
 #endif // MAME_EMU_DEBUG_DEBUGCPU_H
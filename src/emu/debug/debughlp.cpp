@@ -147,6 +147,8 @@ static const help_item static_help_list[] =
 		"  s[tep] [<count>=1] -- single steps for <count> instructions (F11)\n"
 		"  o[ver] [<count>=1] -- single steps over <count> instructions (F10)\n"
 		"  out -- single steps until the current subroutine/exception handler is exited (Shift-F11)\n"
+		"  stepback[sb] [<count>=1] -- steps back <count> instructions by replaying from a rewind state\n"
+		"  snapinterval [<instructions>] -- sets how many instructions apart rewind states are saved\n"
 		"  g[o] [<address>] -- resumes execution, sets temp breakpoint at <address> (F5)\n"
 		"  ge[x] [<exception>[,<condition>]] -- resumes execution, setting temp breakpoint if <exception> is raised\n"
 		"  gi[nt] [<irqline>] -- resumes execution, setting temp breakpoint if <irqline> is taken (F7)\n"
@@ -189,6 +191,9 @@ static const help_item static_help_list[] =
 		"  wpenable [<wpnum>] -- enables a given watchpoint or all if no <wpnum> specified\n"
 		"  wplist -- lists all the watchpoints\n"
 		"  hotspot [<CPU>,[<depth>[,<hits>]]] -- attempt to find hotspots\n"
+		"  profile [<interval>[,<CPU>]|off] -- sample the PC of one or all CPUs every <interval> cycles\n"
+		"  proflist [<CPU>[,<count>]] -- lists the most frequently sampled PCs\n"
+		"  profsave <filename>[,<CPU>] -- saves the profile samples as folded stacks\n"
 	},
 	{
 		"registerpoints",
@@ -483,7 +488,8 @@ static const help_item static_help_list[] =
 		"\n"
 		"The rewind command loads the most recent RAM-based state.  Rewind states, when enabled, are "
 		"saved when \"step\", \"over\", or \"out\" command gets executed, storing the machine state as "
-		"of the moment before actually stepping.  Consecutively loading rewind states can work like "
+		"of the moment before actually stepping, and periodically while the machine runs; see "
+		"\"snapinterval\".  Consecutively loading rewind states can work like "
 		"reverse execution.  Depending on which steps forward were taken previously, the behavior can "
 		"be similar to GDB's \"reverse-stepi\" or \"reverse-next\".  All output for this command is "
 		"currently echoed into the running machine window.  Previous memory and PC tracking statistics "
@@ -761,6 +767,43 @@ static const help_item static_help_list[] =
 		"step 4\n"
 		"  Steps forward four instructions on the current CPU.\n"
 	},
+	{
+		"stepback",
+		"\n"
+		"  stepback[sb] [<count>=1]\n"
+		"\n"
+		"The stepback command goes back <count> instructions in the currently executing CPU. It loads "
+		"the newest rewind state saved before the target instruction and runs the machine forward "
+		"from there until the CPU reaches it, ignoring breakpoints on the way. Emulation is "
+		"deterministic, so this reproduces the original execution without every instruction having "
+		"to be recorded. Rewind must be enabled with the -rewind option, and states are only "
+		"available as far back as the rewind capacity allows.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"sb\n"
+		"  Steps back one instruction on the current CPU.\n"
+		"\n"
+		"stepback 1000\n"
+		"  Steps back one thousand instructions on the current CPU.\n"
+	},
+	{
+		"snapinterval",
+		"\n"
+		"  snapinterval [<instructions>]\n"
+		"\n"
+		"The snapinterval command sets how often rewind states are saved for the rewind and stepback "
+		"commands, as a number of instructions of the CPU being run, and shows the setting. A state "
+		"is then saved when stepping only if the last one is at least that far behind, and also "
+		"periodically while the machine runs. Longer intervals use less memory and time, and make "
+		"stepping back replay further. An interval of 0 saves a state at every step and none while "
+		"running. The default is 100000.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"snapinterval 10000\n"
+		"  Saves a rewind state every 10000 instructions.\n"
+	},
 	{
 		"over",
 		"\n"
@@ -933,7 +976,7 @@ static const help_item static_help_list[] =
 	{
 		"trace",
 		"\n"
-		"  trace {<filename>|OFF}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  trace {<filename>|OFF}[,<CPU>[,[noloop|logerror|binary][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing of the execution of the specified <CPU>. If <CPU> is omitted, "
 		"the currently active CPU is specified. When enabling tracing, specify the filename in the "
@@ -941,7 +984,10 @@ static const help_item static_help_list[] =
 		"<detectloops> should be either true or false. If 'noloop' is omitted, the trace "
 		"will have loops detected and condensed to a single line. If 'noloop' is specified, the trace "
 		"will contain every opcode as it is executed. If 'logerror' is specified, logerror output "
-		"will augment the trace.  If you "
+		"will augment the trace. If 'binary' is specified, only the PC and opcode bytes of each "
+		"instruction are recorded, in a compact binary form that is much faster to write; use "
+		"'unidasm <filename> -trace -arch <architecture>' to disassemble it. Loops are not "
+		"condensed in binary traces.  If you "
 		"wish to log additional information on each trace, you can append an <action> parameter which "
 		"is a command that is executed before each trace is logged. Generally, this is used to include "
 		"a 'tracelog' command. Note that you may need to embed the action within braces { } in order "
@@ -965,6 +1011,9 @@ static const help_item static_help_list[] =
 		"trace starswep.tr,0,logerror|noloop\n"
 		"  Begin tracing the execution of CPU #0, logging output (along with logerror output) to starswep.tr, with loop detection disabled.\n"
 		"\n"
+		"trace starswep.trb,0,binary\n"
+		"  Begin tracing the execution of CPU #0, recording a binary trace to starswep.trb.\n"
+		"\n"
 		"trace >>pigskin.tr\n"
 		"  Begin tracing the currently active CPU, appending log output to pigskin.tr.\n"
 		"\n"
@@ -1244,6 +1293,60 @@ static const help_item static_help_list[] =
 		"  Looks for hotspots on CPU 1 using a search buffer of 64 entries, reporting any entries which "
 		"end up with 1000 or more hits.\n"
 	},
+	{
+		"profile",
+		"\n"
+		"  profile [<interval>[,<CPU>]|off]\n"
+		"\n"
+		"The profile command starts a sampling profiler that records the PC every <interval> cycles "
+		"of the given <CPU>, or of every CPU if no <CPU> is specified. Samples are counted per PC, "
+		"and any previous samples for the CPU are discarded. An <interval> of 0 stops profiling the "
+		"CPU; profile off, or profile with no parameters, stops profiling on all CPUs while keeping "
+		"the samples. The samples can be listed with proflist, saved with profsave, or seen in the "
+		"profile view.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"profile 1000\n"
+		"  Samples the PC of every CPU once every 1000 cycles.\n"
+		"\n"
+		"profile 100,1\n"
+		"  Samples the PC of CPU 1 once every 100 cycles.\n"
+		"\n"
+		"profile off\n"
+		"  Stops profiling all CPUs.\n"
+	},
+	{
+		"proflist",
+		"\n"
+		"  proflist [<CPU>[,<count>]]\n"
+		"\n"
+		"The proflist command lists the <count> most frequently sampled PCs, which defaults to 16, "
+		"with their share of the samples and their disassembly. If <CPU> is specified only that "
+		"CPU's samples are listed, otherwise those of every CPU that has samples.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"proflist\n"
+		"  Lists the 16 most frequently sampled PCs of each CPU.\n"
+		"\n"
+		"proflist 0,40\n"
+		"  Lists the 40 most frequently sampled PCs of CPU 0.\n"
+	},
+	{
+		"profsave",
+		"\n"
+		"  profsave <filename>[,<CPU>]\n"
+		"\n"
+		"The profsave command saves the profile samples of the given <CPU>, or of every CPU, to "
+		"<filename> as folded stacks: one line per PC holding the CPU tag and the PC separated by "
+		"a semicolon, followed by the sample count. This is the input format of flame graph tools.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"profsave {game}.folded\n"
+		"  Saves the samples of every CPU to <game>.folded.\n"
+	},
 	{
 		"rpset",
 		"\n"
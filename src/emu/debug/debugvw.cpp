@@ -17,6 +17,8 @@
 #include "dvmemory.h"
 #include "dvbpoints.h"
 #include "dvwpoints.h"
+#include "dvprofile.h"
+#include "dvheatmap.h"
 #include "debugcpu.h"
 #include "debugger.h"
 #include <cctype>
@@ -362,6 +364,12 @@ debug_view *debug_view_manager::alloc_view(debug_view_type type, debug_view_osd_
 		case DVT_WATCH_POINTS:
 			return append(new debug_view_watchpoints(machine(), osdupdate, osdprivate));
 
+		case DVT_PROFILE:
+			return append(new debug_view_profile(machine(), osdupdate, osdprivate));
+
+		case DVT_HEATMAP:
+			return append(new debug_view_heatmap(machine(), osdupdate, osdprivate));
+
 		default:
 			fatalerror("Attempt to create invalid debug view type %d\n", type);
 	}
@@ -34,7 +34,9 @@ enum debug_view_type
 	DVT_MEMORY,
 	DVT_LOG,
 	DVT_BREAK_POINTS,
-	DVT_WATCH_POINTS
+	DVT_WATCH_POINTS,
+	DVT_PROFILE,
+	DVT_HEATMAP
 };
 
 
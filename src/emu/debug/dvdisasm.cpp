@@ -45,7 +45,8 @@ debug_view_disasm::debug_view_disasm(running_machine &machine, debug_view_osd_up
 		m_backwards_steps(3),
 		m_dasm_width(DEFAULT_DASM_WIDTH),
 		m_previous_pc(1),
-		m_expression(machine)
+		m_expression(machine),
+		m_cache_mode(0)
 {
 	// fail if no available sources
 	enumerate_sources();
@@ -218,18 +219,58 @@ void debug_view_disasm::view_click(const int button, const debug_view_xy& pos)
 	end_update();
 }
 
+//-------------------------------------------------
+//  add_line - append the instruction at an
+//  address, disassembling it only if the bytes
+//  there changed since it was last seen
+//-------------------------------------------------
+
+offs_t debug_view_disasm::add_line(debug_disasm_buffer &buffer, offs_t address)
+{
+	auto found = m_cache.find(address);
+	if(found != m_cache.end()) {
+		dasm_cache_entry &entry = found->second;
+		buffer.data_get(address, entry.m_size, true, m_cache_check);
+		if(m_cache_check == entry.m_opcodes) {
+			buffer.data_get(address, entry.m_size, false, m_cache_check);
+			if(m_cache_check == entry.m_params) {
+				dasm_line &line = m_dasm.emplace_back(address, entry.m_size, entry.m_dasm);
+				line.m_tadr = entry.m_tadr;
+				line.m_topcodes = entry.m_topcodes;
+				line.m_tparams = entry.m_tparams;
+				return entry.m_next_address;
+			}
+		}
+		m_cache.erase(found);
+	}
+
+	// keep the cache bounded when scrolling through large spaces
+	if(m_cache.size() >= DASM_CACHE_LIMIT)
+		m_cache.clear();
+
+	dasm_cache_entry entry;
+	u32 info;
+	buffer.disassemble(address, entry.m_dasm, entry.m_next_address, entry.m_size, info);
+	buffer.data_get(address, entry.m_size, true, entry.m_opcodes);
+	buffer.data_get(address, entry.m_size, false, entry.m_params);
+	entry.m_tadr = buffer.pc_to_string(address);
+	entry.m_topcodes = buffer.data_to_string(address, entry.m_size, true);
+	entry.m_tparams = buffer.data_to_string(address, entry.m_size, false);
+
+	dasm_line &line = m_dasm.emplace_back(address, entry.m_size, entry.m_dasm);
+	line.m_tadr = entry.m_tadr;
+	line.m_topcodes = entry.m_topcodes;
+	line.m_tparams = entry.m_tparams;
+	offs_t const next_address = entry.m_next_address;
+	m_cache.emplace(address, std::move(entry));
+	return next_address;
+}
+
 void debug_view_disasm::generate_from_address(debug_disasm_buffer &buffer, offs_t address)
 {
 	m_dasm.clear();
-	for(int i=0; i != m_total.y; i++) {
-		std::string dasm;
-		offs_t size;
-		offs_t next_address;
-		u32 info;
-		buffer.disassemble(address, dasm, next_address, size, info);
-		m_dasm.emplace_back(address, size, dasm);
-		address = next_address;
-	}
+	for(int i=0; i != m_total.y; i++)
+		address = add_line(buffer, address);
 }
 
 bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
@@ -256,12 +297,7 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 	if(intf.interface_flags() & util::disasm_interface::NONLINEAR_PC) {
 		offs_t lpc = intf.pc_real_to_linear(pc);
 		while(intf.pc_real_to_linear(address) < lpc) {
-			std::string dasm;
-			offs_t size;
-			offs_t next_address;
-			u32 info;
-			buffer.disassemble(address, dasm, next_address, size, info);
-			m_dasm.emplace_back(address, size, dasm);
+			offs_t next_address = add_line(buffer, address);
 			if(intf.pc_real_to_linear(address) > intf.pc_real_to_linear(next_address))
 				return false;
 			address = next_address;
@@ -269,12 +305,7 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 
 	} else {
 		while(address < pc) {
-			std::string dasm;
-			offs_t size;
-			offs_t next_address;
-			u32 info;
-			buffer.disassemble(address, dasm, next_address, size, info);
-			m_dasm.emplace_back(address, size, dasm);
+			offs_t next_address = add_line(buffer, address);
 			if(address > next_address)
 				return false;
 			address = next_address;
@@ -287,15 +318,8 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 	if(m_dasm.size() > m_backwards_steps)
 		m_dasm.erase(m_dasm.begin(), m_dasm.begin() + (m_dasm.size() - m_backwards_steps));
 
-	while(m_dasm.size() < m_total.y) {
-		std::string dasm;
-		offs_t size;
-		offs_t next_address;
-		u32 info;
-		buffer.disassemble(address, dasm, next_address, size, info);
-		m_dasm.emplace_back(address, size, dasm);
-		address = next_address;
-	}
+	while(m_dasm.size() < m_total.y)
+		address = add_line(buffer, address);
 	return true;
 }
 
@@ -309,6 +333,14 @@ int debug_view_disasm::address_position(offs_t pc) const
 
 void debug_view_disasm::generate_dasm(debug_disasm_buffer &buffer, offs_t pc)
 {
+	// the same bytes decode differently in another mode (x86 16/32-bit, ARM/Thumb,
+	// 65816 M/X), and some disassemblers annotate lines from live CPU state
+	const u64 mode = buffer.decode_mode();
+	if(mode != m_cache_mode || mode == util::disasm_interface::DECODE_MODE_LIVE) {
+		m_cache.clear();
+		m_cache_mode = mode;
+	}
+
 	bool pc_changed = pc != m_previous_pc;
 	m_previous_pc = pc;
 	if(strcmp(m_expression.string(), "curpc")) {
@@ -346,15 +378,11 @@ void debug_view_disasm::generate_dasm(debug_disasm_buffer &buffer, offs_t pc)
 	generate_from_address(buffer, pc);
 }
 
-void debug_view_disasm::complete_information(const debug_view_disasm_source &source, debug_disasm_buffer &buffer, offs_t pc)
+void debug_view_disasm::complete_information(const debug_view_disasm_source &source, offs_t pc)
 {
 	for(auto &dasm : m_dasm) {
 		offs_t adr = dasm.m_address;
 
-		dasm.m_tadr = buffer.pc_to_string(adr);
-		dasm.m_topcodes = buffer.data_to_string(adr, dasm.m_size, true);
-		dasm.m_tparams  = buffer.data_to_string(adr, dasm.m_size, false);
-
 		dasm.m_is_pc = adr == pc;
 
 		dasm.m_is_bp = source.device()->debug()->breakpoint_find(adr) != nullptr;
@@ -379,7 +407,7 @@ void debug_view_disasm::view_update()
 
 	generate_dasm(buffer, pc);
 
-	complete_information(source, buffer, pc);
+	complete_information(source, pc);
 	redraw();
 }
 
@@ -569,5 +597,6 @@ void debug_view_disasm::set_source(const debug_view_source &source)
 	if(&source != m_source) {
 		debug_view::set_source(source);
 		m_dasm.clear();
+		m_cache.clear();
 	}
 }
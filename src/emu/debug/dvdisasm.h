@@ -18,6 +18,8 @@
 
 #include "vecstream.h"
 
+#include <unordered_map>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -109,12 +111,26 @@ private:
 		dasm_line(offs_t address, offs_t size, std::string dasm) : m_address(address), m_size(size), m_dasm(dasm), m_is_pc(false), m_is_bp(false), m_is_visited(false) {}
 	};
 
+	// A disassembled instruction with the bytes it was made from, reused
+	// for as long as memory at its address holds the same bytes.
+	struct dasm_cache_entry {
+		std::vector<u8> m_opcodes;              // opcode bytes
+		std::vector<u8> m_params;               // parameter bytes, when they come from elsewhere
+		offs_t m_size;                          // size of the instruction
+		offs_t m_next_address;                  // address of the following instruction
+		std::string m_tadr;                     // instruction address as a string
+		std::string m_dasm;                     // disassembly
+		std::string m_topcodes;                 // textual representation of opcode/default values
+		std::string m_tparams;                  // textual representation of parameter values
+	};
+
 	// internal helpers
+	offs_t add_line(debug_disasm_buffer &buffer, offs_t address);
 	void generate_from_address(debug_disasm_buffer &buffer, offs_t address);
 	bool generate_with_pc(debug_disasm_buffer &buffer, offs_t pc);
 	int address_position(offs_t pc) const;
 	void generate_dasm(debug_disasm_buffer &buffer, offs_t pc);
-	void complete_information(const debug_view_disasm_source &source, debug_disasm_buffer &buffer, offs_t pc);
+	void complete_information(const debug_view_disasm_source &source, offs_t pc);
 
 	void enumerate_sources();
 	void print(int row, std::string text, int start, int end, u8 attrib);
@@ -127,11 +143,15 @@ private:
 	offs_t                 m_previous_pc;          // previous pc, to detect whether it changed
 	debug_view_expression  m_expression;           // expression-related information
 	std::vector<dasm_line> m_dasm;                 // disassembled instructions
+	std::unordered_map<offs_t, dasm_cache_entry> m_cache; // disassembly by address
+	std::vector<u8>        m_cache_check;          // scratch buffer for validating cache entries
+	u64                    m_cache_mode;           // decode mode the cached lines were disassembled in
 
 	// constants
 	static constexpr int DEFAULT_DASM_LINES = 1000;
 	static constexpr int DEFAULT_DASM_WIDTH = 50;
 	static constexpr int DASM_MAX_BYTES = 16;
+	static constexpr size_t DASM_CACHE_LIMIT = 16 * DEFAULT_DASM_LINES;
 };
 
 #endif // MAME_EMU_DEBUG_DVDISASM_H
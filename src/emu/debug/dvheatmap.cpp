@@ -0,0 +1,259 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/*********************************************************************
+
+    dvheatmap.cpp
+
+    Memory access heatmap debugger view.
+
+    Each address space source is divided into pages; reads and writes
+    are counted by taps over the whole space while the view exists, and
+    execution comes from the CPU's sampling profiler when it is running.
+    Every page shows one digit per kind of access, on a log scale
+    relative to the busiest page.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "dvheatmap.h"
+#include "debugcpu.h"
+
+#include <cmath>
+
+
+//**************************************************************************
+//  DEBUG VIEW HEATMAP
+//**************************************************************************
+
+//-------------------------------------------------
+//  debug_view_heatmap - constructor
+//-------------------------------------------------
+
+debug_view_heatmap::debug_view_heatmap(running_machine &machine, debug_view_osd_update_func osdupdate, void *osdprivate)
+	: debug_view(machine, DVT_HEATMAP, osdupdate, osdprivate)
+	, m_phr(nullptr)
+	, m_phw(nullptr)
+	, m_page_shift(8)
+{
+	// fail if no available sources
+	enumerate_sources();
+	if (m_source_list.empty())
+		throw std::bad_alloc();
+}
+
+
+//-------------------------------------------------
+//  ~debug_view_heatmap - destructor
+//-------------------------------------------------
+
+debug_view_heatmap::~debug_view_heatmap()
+{
+	remove_taps();
+}
+
+
+//-------------------------------------------------
+//  enumerate_sources - enumerate all possible
+//  sources for a heatmap view
+//-------------------------------------------------
+
+void debug_view_heatmap::enumerate_sources()
+{
+	// start with an empty list
+	m_source_list.clear();
+
+	// add all the devices' address spaces
+	for (device_memory_interface &memintf : memory_interface_enumerator(machine().root_device()))
+	{
+		for (int spacenum = 0; spacenum < memintf.max_space_count(); ++spacenum)
+		{
+			if (memintf.has_space(spacenum))
+			{
+				address_space &space(memintf.space(spacenum));
+				m_source_list.emplace_back(
+						std::make_unique<debug_view_memory_source>(
+							util::string_format("%s '%s' %s space accesses", memintf.device().name(), memintf.device().tag(), space.name()),
+							space));
+			}
+		}
+	}
+
+	// reset the source to a known good entry
+	if (!m_source_list.empty())
+		set_source(*m_source_list[0]);
+}
+
+
+//-------------------------------------------------
+//  view_notify - handle notification of updates
+//  to the source
+//-------------------------------------------------
+
+void debug_view_heatmap::view_notify(debug_view_notification type)
+{
+	if (type == VIEW_NOTIFY_SOURCE_CHANGED)
+	{
+		remove_taps();
+		install_taps();
+	}
+}
+
+
+//-------------------------------------------------
+//  clear - forget the reads and writes counted so
+//  far; the profiler keeps its own samples
+//-------------------------------------------------
+
+void debug_view_heatmap::clear()
+{
+	begin_update();
+	std::fill(m_reads.begin(), m_reads.end(), 0);
+	std::fill(m_writes.begin(), m_writes.end(), 0);
+	std::fill(m_previous.begin(), m_previous.end(), 0);
+	m_update_pending = true;
+	end_update();
+}
+
+
+//-------------------------------------------------
+//  install_taps - size the pages for the current
+//  source and start counting its accesses
+//-------------------------------------------------
+
+void debug_view_heatmap::install_taps()
+{
+	auto const &source = downcast<const debug_view_memory_source &>(*m_source);
+	address_space &space = *source.space();
+
+	// keep the number of pages manageable for wide spaces
+	m_page_shift = std::max(8, space.addr_width() - 16);
+	size_t const pages = (size_t(space.addrmask()) >> m_page_shift) + 1;
+	m_reads.assign(pages, 0);
+	m_writes.assign(pages, 0);
+	m_execs.assign(pages, 0);
+	m_previous.assign(pages, 0);
+
+	switch (space.data_width())
+	{
+	case  8: install_taps<u8>(space);  break;
+	case 16: install_taps<u16>(space); break;
+	case 32: install_taps<u32>(space); break;
+	case 64: install_taps<u64>(space); break;
+	}
+}
+
+template <typename T>
+void debug_view_heatmap::install_taps(address_space &space)
+{
+	// the debugger's own accesses aren't counted
+	m_phr = space.install_read_tap(0, space.addrmask(), "heatmap",
+			[this] (offs_t offset, T &data, T mem_mask)
+			{
+				if (!machine().side_effects_disabled())
+					count(m_reads, offset);
+			}, m_phr);
+	m_phw = space.install_write_tap(0, space.addrmask(), "heatmap",
+			[this] (offs_t offset, T &data, T mem_mask)
+			{
+				if (!machine().side_effects_disabled())
+					count(m_writes, offset);
+			}, m_phw);
+}
+
+
+//-------------------------------------------------
+//  remove_taps - stop counting accesses
+//-------------------------------------------------
+
+void debug_view_heatmap::remove_taps()
+{
+	// the handlers belong to the space, so a new source needs new ones
+	if (m_phr)
+		m_phr->remove();
+	if (m_phw)
+		m_phw->remove();
+	m_phr = m_phw = nullptr;
+}
+
+
+//-------------------------------------------------
+//  count - count an access to a page, saturating
+//-------------------------------------------------
+
+void debug_view_heatmap::count(std::vector<u32> &counts, offs_t address)
+{
+	u32 &page = counts[address >> m_page_shift];
+	page += (page != ~u32(0));
+}
+
+
+//-------------------------------------------------
+//  view_update - update the contents of the
+//  heatmap view
+//-------------------------------------------------
+
+void debug_view_heatmap::view_update()
+{
+	auto const &source = downcast<const debug_view_memory_source &>(*m_source);
+	address_space &space = *source.space();
+
+	// gather the profiler's samples into pages
+	std::fill(m_execs.begin(), m_execs.end(), 0);
+	device_debug *const debug = source.device()->debug();
+	if (debug && (space.spacenum() == AS_PROGRAM))
+		for (const auto &sample : debug->profile_samples())
+			m_execs[(sample.first & space.addrmask()) >> m_page_shift] += sample.second;
+
+	// find the busiest page of each kind
+	u32 const maxread = *std::max_element(m_reads.begin(), m_reads.end());
+	u32 const maxwrite = *std::max_element(m_writes.begin(), m_writes.end());
+	u32 const maxexec = *std::max_element(m_execs.begin(), m_execs.end());
+	auto const level = [] (u32 count, u32 max) -> char
+	{
+		if (count == 0)
+			return '.';
+		if (max <= 1)
+			return '9';
+		return '1' + int(8.0 * std::log2(double(count)) / std::log2(double(max)));
+	};
+
+	// set the view region so the scroll bars update
+	int const addrchars = space.addrchars();
+	m_total.x = addrchars + 2 + PAGES_PER_ROW * 4;
+	m_total.y = (m_reads.size() + PAGES_PER_ROW - 1) / PAGES_PER_ROW;
+
+	// draw
+	debug_view_char *dest = &m_viewdata[0];
+	std::string line;
+	std::vector<u8> attribs;
+	for (int row = 0; row < m_visible.y; row++)
+	{
+		size_t const first = size_t(row + m_topleft.y) * PAGES_PER_ROW;
+		line.clear();
+		attribs.clear();
+		if (first < m_reads.size())
+		{
+			line = util::string_format("%0*X  ", addrchars, offs_t(first << m_page_shift));
+			attribs.assign(line.length(), DCA_ANCILLARY);
+			for (size_t page = first; (page < first + PAGES_PER_ROW) && (page < m_reads.size()); page++)
+			{
+				// pages touched since the last update are highlighted
+				u32 const total = m_reads[page] + m_writes[page] + m_execs[page];
+				u8 const attrib = !total ? DCA_DISABLED : (total != m_previous[page]) ? DCA_CHANGED : DCA_NORMAL;
+				m_previous[page] = total;
+
+				line += level(m_reads[page], maxread);
+				line += level(m_writes[page], maxwrite);
+				line += level(m_execs[page], maxexec);
+				line += ' ';
+				attribs.insert(attribs.end(), 4, attrib);
+			}
+		}
+
+		for (u32 i = m_topleft.x; i < (m_topleft.x + m_visible.x); i++, dest++)
+		{
+			dest->byte = (i < line.length()) ? line[i] : ' ';
+			dest->attrib = (i < attribs.size()) ? attribs[i] : DCA_NORMAL;
+		}
+	}
+}
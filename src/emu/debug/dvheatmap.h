@@ -0,0 +1,65 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/*********************************************************************
+
+    dvheatmap.h
+
+    Memory access heatmap debugger view.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_DEBUG_DVHEATMAP_H
+#define MAME_EMU_DEBUG_DVHEATMAP_H
+
+#pragma once
+
+#include "debugvw.h"
+#include "dvmemory.h"
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// debug view counting the accesses to each page of an address space
+class debug_view_heatmap : public debug_view
+{
+	friend class debug_view_manager;
+
+	// construction/destruction
+	debug_view_heatmap(running_machine &machine, debug_view_osd_update_func osdupdate, void *osdprivate);
+	virtual ~debug_view_heatmap();
+
+public:
+	// getters
+	offs_t page_size() const { return offs_t(1) << m_page_shift; }
+
+	// operations
+	void clear();
+
+protected:
+	// view overrides
+	virtual void view_notify(debug_view_notification type) override;
+	virtual void view_update() override;
+
+private:
+	static constexpr int PAGES_PER_ROW = 16;
+
+	// internal helpers
+	void enumerate_sources();
+	void install_taps();
+	void remove_taps();
+	template <typename T> void install_taps(address_space &space);
+	void count(std::vector<u32> &counts, offs_t address);
+
+	// internal state
+	memory_passthrough_handler *m_phr;          // read tap over the whole space
+	memory_passthrough_handler *m_phw;          // write tap over the whole space
+	int                 m_page_shift;           // address bits per page
+	std::vector<u32>    m_reads;                // reads of each page
+	std::vector<u32>    m_writes;               // writes to each page
+	std::vector<u32>    m_execs;                // profiler samples in each page
+	std::vector<u32>    m_previous;             // total accesses of each page at the last update
+};
+
+#endif // MAME_EMU_DEBUG_DVHEATMAP_H
@@ -0,0 +1,187 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/*********************************************************************
+
+    dvprofile.cpp
+
+    Sampling profiler debugger view.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "debugger.h"
+#include "dvprofile.h"
+#include "debugbuf.h"
+
+#include <algorithm>
+
+
+//**************************************************************************
+//  DEBUG VIEW PROFILE
+//**************************************************************************
+
+static const int tableBreaks[] = { 24, 42, 54, 62, 110 };
+
+
+//-------------------------------------------------
+//  debug_view_profile - constructor
+//-------------------------------------------------
+
+debug_view_profile::debug_view_profile(running_machine &machine, debug_view_osd_update_func osdupdate, void *osdprivate)
+	: debug_view(machine, DVT_PROFILE, osdupdate, osdprivate)
+{
+	// fail if no available sources
+	enumerate_sources();
+	if (m_source_list.empty())
+		throw std::bad_alloc();
+}
+
+
+//-------------------------------------------------
+//  ~debug_view_profile - destructor
+//-------------------------------------------------
+
+debug_view_profile::~debug_view_profile()
+{
+}
+
+
+//-------------------------------------------------
+//  enumerate_sources - enumerate all possible
+//  sources for a profile view
+//-------------------------------------------------
+
+void debug_view_profile::enumerate_sources()
+{
+	// start with an empty list
+	m_source_list.clear();
+
+	// iterate over devices that execute
+	for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+	{
+		m_source_list.emplace_back(
+				std::make_unique<debug_view_source>(
+					util::string_format("%s '%s'", exec.device().name(), exec.device().tag()),
+					&exec.device()));
+	}
+
+	// reset the source to a known good entry
+	if (!m_source_list.empty())
+		set_source(*m_source_list[0]);
+}
+
+
+//-------------------------------------------------
+//  gather_samples - collect the samples of every
+//  CPU, most frequent share first
+//-------------------------------------------------
+
+void debug_view_profile::gather_samples()
+{
+	m_buffer.resize(0);
+	for (auto &source : m_source_list)
+	{
+		device_debug &debug = *source->device()->debug();
+		for (const auto &sample : debug.profile_samples())
+			m_buffer.push_back(profile_entry{ source->device(), sample.first, sample.second, debug.profile_total() });
+	}
+
+	// compare shares by cross-multiplying, so CPUs with different totals sort together
+	std::sort(m_buffer.begin(), m_buffer.end(), [] (const profile_entry &a, const profile_entry &b)
+			{
+				double const ashare = double(a.m_count) * double(b.m_total);
+				double const bshare = double(b.m_count) * double(a.m_total);
+				if (ashare != bshare)
+					return ashare > bshare;
+				return (a.m_device != b.m_device) ? (strcmp(a.m_device->tag(), b.m_device->tag()) < 0) : (a.m_pc < b.m_pc);
+			});
+}
+
+
+//-------------------------------------------------
+//  view_update - update the contents of the
+//  profile view
+//-------------------------------------------------
+
+void debug_view_profile::view_update()
+{
+	// gather the samples of all the CPUs
+	gather_samples();
+
+	// set the view region so the scroll bars update
+	m_total.x = tableBreaks[std::size(tableBreaks) - 1];
+	m_total.y = m_buffer.size() + 1;
+	if (m_total.y < 10)
+		m_total.y = 10;
+
+	// draw
+	debug_view_char *dest = &m_viewdata[0];
+	std::string line;
+	auto const pad = [&line] (int len) { if (line.length() < len) line.append(len - line.length(), ' '); };
+
+	// header
+	if (m_visible.y > 0)
+	{
+		line = "CPU";
+		pad(tableBreaks[0]);
+		line += "Address";
+		pad(tableBreaks[1]);
+		line += "Samples";
+		pad(tableBreaks[2]);
+		line += "Share";
+		pad(tableBreaks[3]);
+		line += "Instruction";
+		pad(tableBreaks[4]);
+
+		for (u32 i = m_topleft.x; i < (m_topleft.x + m_visible.x); i++, dest++)
+		{
+			dest->byte = (i < line.length()) ? line[i] : ' ';
+			dest->attrib = DCA_ANCILLARY;
+		}
+	}
+
+	for (int row = 1; row < m_visible.y; row++)
+	{
+		int const index = row + m_topleft.y - 1;
+		if ((index < m_buffer.size()) && (index >= 0))
+		{
+			profile_entry const &entry = m_buffer[index];
+
+			// only the visible rows are disassembled
+			std::string instruction;
+			device_disasm_interface *dasmintf;
+			if (entry.m_device->interface(dasmintf))
+			{
+				offs_t next_pc, size;
+				u32 info;
+				debug_disasm_buffer(*entry.m_device).disassemble(entry.m_pc, instruction, next_pc, size, info);
+			}
+
+			line = entry.m_device->tag();
+			pad(tableBreaks[0]);
+			line += util::string_format("%0*X", entry.m_device->debug()->logaddrchars(), entry.m_pc);
+			pad(tableBreaks[1]);
+			line += util::string_format("%d", entry.m_count);
+			pad(tableBreaks[2]);
+			line += util::string_format("%5.1f%%", 100.0 * double(entry.m_count) / double(entry.m_total));
+			pad(tableBreaks[3]);
+			line += instruction;
+			pad(tableBreaks[4]);
+
+			for (u32 i = m_topleft.x; i < (m_topleft.x + m_visible.x); i++, dest++)
+			{
+				dest->byte = (i < line.length()) ? line[i] : ' ';
+				dest->attrib = DCA_NORMAL;
+			}
+		}
+		else
+		{
+			// fill the remaining vertical space
+			for (u32 i = m_topleft.x; i < (m_topleft.x + m_visible.x); i++, dest++)
+			{
+				dest->byte = ' ';
+				dest->attrib = DCA_NORMAL;
+			}
+		}
+	}
+}
@@ -0,0 +1,55 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/*********************************************************************
+
+    dvprofile.h
+
+    Sampling profiler debugger view.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_DEBUG_DVPROFILE_H
+#define MAME_EMU_DEBUG_DVPROFILE_H
+
+#pragma once
+
+#include "debugvw.h"
+#include "debugcpu.h"
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// debug view for the sampling profiler
+class debug_view_profile : public debug_view
+{
+	friend class debug_view_manager;
+
+	// construction/destruction
+	debug_view_profile(running_machine &machine, debug_view_osd_update_func osdupdate, void *osdprivate);
+	virtual ~debug_view_profile();
+
+protected:
+	// view overrides
+	virtual void view_update() override;
+
+private:
+	// a sampled PC of one CPU
+	struct profile_entry
+	{
+		device_t *  m_device;
+		offs_t      m_pc;
+		u64         m_count;
+		u64         m_total;
+	};
+
+	// internal helpers
+	void enumerate_sources();
+	void gather_samples();
+
+	// internal state
+	std::vector<profile_entry> m_buffer;
+};
+
+#endif // MAME_EMU_DEBUG_DVPROFILE_H
@@ -97,7 +97,14 @@ enum
 	TVL_ASSIGNBOR,
 	TVL_COMMA,
 	TVL_MEMORYAT,
-	TVL_EXECUTEFUNC
+	TVL_EXECUTEFUNC,
+
+	// push and store operations, used only by the compiled form
+	TVL_PUSHNUMBER,
+	TVL_PUSHSYMBOL,
+	TVL_STORESYMBOL,
+	TVL_STOREMEMORY,
+	TVL_NOP
 };
 
 
@@ -539,6 +546,46 @@ void symbol_table::write_memory(address_space &space, offs_t address, u64 data,
 }
 
 
+//-------------------------------------------------
+//  memory_space - return the address space a
+//  logical or physical memory access refers to,
+//  or nullptr for other kinds of access
+//-------------------------------------------------
+
+address_space *symbol_table::memory_space(const char *name, expression_space spacenum)
+{
+	device_memory_interface *memory = m_memintf;
+	int index;
+	switch (spacenum)
+	{
+	case EXPSPACE_PROGRAM_LOGICAL:
+	case EXPSPACE_DATA_LOGICAL:
+	case EXPSPACE_IO_LOGICAL:
+	case EXPSPACE_SPACE3_LOGICAL:
+		index = AS_PROGRAM + (spacenum - EXPSPACE_PROGRAM_LOGICAL);
+		break;
+
+	case EXPSPACE_PROGRAM_PHYSICAL:
+	case EXPSPACE_DATA_PHYSICAL:
+	case EXPSPACE_IO_PHYSICAL:
+	case EXPSPACE_SPACE3_PHYSICAL:
+		index = AS_PROGRAM + (spacenum - EXPSPACE_PROGRAM_PHYSICAL);
+		break;
+
+	default:
+		return nullptr;
+	}
+
+	if (name != nullptr)
+	{
+		device_t *device = expression_get_device(name);
+		if (device != nullptr)
+			device->interface(memory);
+	}
+	return (memory != nullptr && memory->has_space(index)) ? &memory->space(index) : nullptr;
+}
+
+
 //-------------------------------------------------
 //  expression_get_device - return a device
 //  based on a case insensitive tag search
@@ -1089,7 +1136,10 @@ parsed_expression::parsed_expression(const parsed_expression &src)
 
 void parsed_expression::parse(const char *expression)
 {
-	// copy the string and reset our parsing state
+	// copy the string and reset our parsing state; the compiled form refers
+	// to the token list, so drop it first in case parsing throws
+	m_compiled.clear();
+	m_compiled_stack.clear();
 	m_original_string.assign(expression);
 	m_tokenlist.clear();
 	m_stringlist.clear();
@@ -1099,6 +1149,9 @@ void parsed_expression::parse(const char *expression)
 
 	// convert the infix order to postfix order
 	infix_to_postfix();
+
+	// flatten it for fast execution
+	compile();
 }
 
 
@@ -1111,6 +1164,7 @@ void parsed_expression::copy(const parsed_expression &src)
 	m_symtable = src.m_symtable;
 	m_default_base = src.m_default_base;
 	m_original_string.assign(src.m_original_string);
+	m_compiled.clear();
 	if (!m_original_string.empty())
 		parse_string_into_tokens();
 }
@@ -2181,6 +2235,258 @@ u64 parsed_expression::execute_tokens()
 
 
 
+//-------------------------------------------------
+//  compile - flatten the postfix sequence into
+//  a list of operations on a plain value stack;
+//  plain assignments to symbols and memory are
+//  compiled too, but other expressions with side
+//  effects, or that would fail, are left to
+//  execute_tokens
+//-------------------------------------------------
+
+void parsed_expression::compile()
+{
+	m_compiled.clear();
+	m_compiled_stack.clear();
+
+	// track the stack at compile time; function symbols are kept as markers
+	// so that the parameter count of each call is known up front, and
+	// offsets are kept to report errors where execute_tokens would; values
+	// that could be assigned to remember the operation that produced them
+	struct entry { function_symbol_entry *function; int offset; int lval = -1; };
+	std::vector<entry> stack;
+	std::vector<compiled_op> ops;
+	std::size_t maxdepth = 0;
+	entry t1, t2;
+	auto const pop_rval = [&stack] (entry &e) { if (stack.empty() || stack.back().function) return false; e = stack.back(); stack.pop_back(); return true; };
+
+	for (parse_token &token : m_tokenlist)
+	{
+		compiled_op op = { 0, token.offset(), 0, nullptr, nullptr, nullptr };
+		if (token.is_number())
+		{
+			op.m_op = TVL_PUSHNUMBER;
+			op.m_value = token.value();
+			stack.push_back({ nullptr, token.offset() });
+		}
+		else if (token.is_symbol() && token.symbol().is_function())
+		{
+			stack.push_back({ downcast<function_symbol_entry *>(&token.symbol()), token.offset() });
+			continue;
+		}
+		else if (token.is_symbol())
+		{
+			op.m_op = TVL_PUSHSYMBOL;
+			op.m_symbol = &token.symbol();
+			stack.push_back({ nullptr, token.offset(), token.symbol().is_lval() ? int(ops.size()) : -1 });
+		}
+		else if (!token.is_operator())
+			return;
+		else
+		{
+			op.m_op = token.optype();
+			switch (op.m_op)
+			{
+				case TVL_COMPLEMENT:
+				case TVL_NOT:
+				case TVL_UPLUS:
+				case TVL_UMINUS:
+					if (!pop_rval(t1))
+						return;
+					stack.push_back({ nullptr, t1.offset });
+					break;
+
+				case TVL_MEMORYAT:
+					if (!pop_rval(t1))
+						return;
+					op.m_token = &token;
+					op.m_space = m_symtable.get().memory_space(token.memory_source(), token.memory_space());
+					stack.push_back({ nullptr, t1.offset, int(ops.size()) });
+					break;
+
+				case TVL_COMMA:
+					if (token.is_function_separator())
+						continue;
+					if (!pop_rval(t2) || !pop_rval(t1))
+						return;
+					stack.push_back({ nullptr, t2.offset });
+					break;
+
+				// the target of an assignment is written rather than read, so
+				// the operation that produced it no longer pushes or reads
+				case TVL_ASSIGN:
+				{
+					if (!pop_rval(t2) || !pop_rval(t1) || t1.lval < 0)
+						return;
+					compiled_op &target = ops[t1.lval];
+					if (target.m_op == TVL_PUSHSYMBOL)
+					{
+						op.m_op = TVL_STORESYMBOL;
+						op.m_symbol = target.m_symbol;
+					}
+					else
+					{
+						op.m_op = TVL_STOREMEMORY;
+						op.m_token = target.m_token;
+						op.m_space = target.m_space;
+					}
+					target.m_op = TVL_NOP;
+					stack.push_back({ nullptr, t2.offset });
+					break;
+				}
+
+				case TVL_MULTIPLY:
+				case TVL_DIVIDE:
+				case TVL_MODULO:
+				case TVL_ADD:
+				case TVL_SUBTRACT:
+				case TVL_LSHIFT:
+				case TVL_RSHIFT:
+				case TVL_LESS:
+				case TVL_LESSOREQUAL:
+				case TVL_GREATER:
+				case TVL_GREATEROREQUAL:
+				case TVL_EQUAL:
+				case TVL_NOTEQUAL:
+				case TVL_BAND:
+				case TVL_BXOR:
+				case TVL_BOR:
+				case TVL_LAND:
+				case TVL_LOR:
+					if (!pop_rval(t2) || !pop_rval(t1))
+						return;
+					// division by zero is reported at the divisor
+					if (op.m_op == TVL_DIVIDE || op.m_op == TVL_MODULO)
+						op.m_offset = t2.offset;
+					stack.push_back({ nullptr, std::min(t1.offset, t2.offset) });
+					break;
+
+				case TVL_EXECUTEFUNC:
+				{
+					int paramcount = 0;
+					while (!stack.empty() && !stack.back().function)
+					{
+						stack.pop_back();
+						paramcount++;
+					}
+					if (stack.empty() || paramcount >= MAX_FUNCTION_PARAMS)
+						return;
+					function_symbol_entry *const function = stack.back().function;
+					if (paramcount < function->minparams() || paramcount > function->maxparams())
+						return;
+					stack.back() = { nullptr, token.offset() };
+					op.m_symbol = function;
+					op.m_value = paramcount;
+					break;
+				}
+
+				// assignments and increments write to lvals
+				default:
+					return;
+			}
+		}
+		maxdepth = std::max(maxdepth, stack.size());
+		ops.push_back(op);
+	}
+
+	// exactly one value must be left
+	if (stack.size() != 1 || stack.back().function)
+		return;
+
+	m_compiled = std::move(ops);
+	m_compiled_stack.resize(maxdepth);
+}
+
+
+//-------------------------------------------------
+//  execute_compiled - execute the compiled form
+//  of the postfix sequence
+//-------------------------------------------------
+
+u64 parsed_expression::execute_compiled()
+{
+	u64 *const base = &m_compiled_stack[0];
+	u64 *sp = base;
+
+	for (const compiled_op &op : m_compiled)
+	{
+		switch (op.m_op)
+		{
+			case TVL_PUSHNUMBER:        *sp++ = op.m_value;                         break;
+			case TVL_PUSHSYMBOL:        *sp++ = op.m_symbol->value();               break;
+
+			case TVL_COMPLEMENT:        sp[-1] = !sp[-1];                           break;
+			case TVL_NOT:               sp[-1] = ~sp[-1];                           break;
+			case TVL_UPLUS:                                                         break;
+			case TVL_UMINUS:            sp[-1] = -sp[-1];                           break;
+
+			case TVL_MULTIPLY:          sp--; sp[-1] = sp[-1] * sp[0];              break;
+			case TVL_ADD:               sp--; sp[-1] = sp[-1] + sp[0];              break;
+			case TVL_SUBTRACT:          sp--; sp[-1] = sp[-1] - sp[0];              break;
+			case TVL_LSHIFT:            sp--; sp[-1] = sp[-1] << sp[0];             break;
+			case TVL_RSHIFT:            sp--; sp[-1] = sp[-1] >> sp[0];             break;
+			case TVL_LESS:              sp--; sp[-1] = sp[-1] < sp[0];              break;
+			case TVL_LESSOREQUAL:       sp--; sp[-1] = sp[-1] <= sp[0];             break;
+			case TVL_GREATER:           sp--; sp[-1] = sp[-1] > sp[0];              break;
+			case TVL_GREATEROREQUAL:    sp--; sp[-1] = sp[-1] >= sp[0];             break;
+			case TVL_EQUAL:             sp--; sp[-1] = sp[-1] == sp[0];             break;
+			case TVL_NOTEQUAL:          sp--; sp[-1] = sp[-1] != sp[0];             break;
+			case TVL_BAND:              sp--; sp[-1] = sp[-1] & sp[0];              break;
+			case TVL_BXOR:              sp--; sp[-1] = sp[-1] ^ sp[0];              break;
+			case TVL_BOR:               sp--; sp[-1] = sp[-1] | sp[0];              break;
+			case TVL_LAND:              sp--; sp[-1] = sp[-1] && sp[0];             break;
+			case TVL_LOR:               sp--; sp[-1] = sp[-1] || sp[0];             break;
+			case TVL_COMMA:             sp--; sp[-1] = sp[0];                       break;
+
+			case TVL_DIVIDE:
+			case TVL_MODULO:
+				sp--;
+				if (sp[0] == 0)
+					throw expression_error(expression_error::DIVIDE_BY_ZERO, op.m_offset);
+				sp[-1] = (op.m_op == TVL_DIVIDE) ? (sp[-1] / sp[0]) : (sp[-1] % sp[0]);
+				break;
+
+			case TVL_NOP:
+				break;
+
+			case TVL_MEMORYAT:
+				if (op.m_space)
+				{
+					auto dis = op.m_space->manager().machine().disable_side_effects(op.m_token->memory_side_effects());
+					sp[-1] = m_symtable.get().read_memory(*op.m_space, u32(sp[-1]), 1 << op.m_token->memory_size(), op.m_token->memory_space() < EXPSPACE_PROGRAM_PHYSICAL);
+				}
+				else
+					sp[-1] = m_symtable.get().memory_value(op.m_token->memory_source(), op.m_token->memory_space(), offs_t(sp[-1]), 1 << op.m_token->memory_size(), op.m_token->memory_side_effects());
+				break;
+
+			case TVL_STORESYMBOL:
+				op.m_symbol->set_value(sp[-1]);
+				break;
+
+			case TVL_STOREMEMORY:
+				sp--;
+				if (op.m_space)
+				{
+					auto dis = op.m_space->manager().machine().disable_side_effects(op.m_token->memory_side_effects());
+					m_symtable.get().write_memory(*op.m_space, u32(sp[-1]), sp[0], 1 << op.m_token->memory_size(), op.m_token->memory_space() < EXPSPACE_PROGRAM_PHYSICAL);
+				}
+				else
+					m_symtable.get().set_memory_value(op.m_token->memory_source(), op.m_token->memory_space(), offs_t(sp[-1]), 1 << op.m_token->memory_size(), sp[0], op.m_token->memory_side_effects());
+				sp[-1] = sp[0];
+				break;
+
+			case TVL_EXECUTEFUNC:
+				sp -= op.m_value;
+				*sp = downcast<function_symbol_entry *>(op.m_symbol)->execute(int(op.m_value), sp);
+				sp++;
+				break;
+		}
+	}
+	return base[0];
+}
+
+
+
 //**************************************************************************
 //  PARSE TOKEN
 //**************************************************************************
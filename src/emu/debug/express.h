@@ -19,6 +19,7 @@
 #include <functional>
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 
 
@@ -196,6 +197,7 @@ public:
 	void set_memory_value(const char *name, expression_space space, u32 offset, int size, u64 value, bool disable_se);
 	u64 read_memory(address_space &space, offs_t address, int size, bool apply_translation);
 	void write_memory(address_space &space, offs_t address, u64 data, int size, bool apply_translation);
+	address_space *memory_space(const char *name, expression_space space);
 
 private:
 	// memory helpers
@@ -242,7 +244,7 @@ public:
 
 	// execution
 	void parse(const char *string);
-	u64 execute() { return execute_tokens(); }
+	u64 execute() { return m_compiled.empty() ? execute_tokens() : execute_compiled(); }
 
 private:
 	// a single token
@@ -304,6 +306,7 @@ private:
 		expression_space memory_space() const { assert(m_type == OPERATOR || m_type == MEMORY); return expression_space((m_flags & TIN_MEMORY_SPACE_MASK) >> TIN_MEMORY_SPACE_SHIFT); }
 		int memory_size() const { assert(m_type == OPERATOR || m_type == MEMORY); return (m_flags & TIN_MEMORY_SIZE_MASK) >> TIN_MEMORY_SIZE_SHIFT; }
 		bool memory_side_effects() const { assert(m_type == OPERATOR || m_type == MEMORY); return (m_flags & TIN_SIDE_EFFECT_MASK) >> TIN_SIDE_EFFECT_SHIFT; }
+		const char *memory_source() const { assert(m_type == OPERATOR || m_type == MEMORY); return m_string; }
 
 		// setters
 		parse_token &set_offset(int offset) { m_offset = offset; return *this; }
@@ -337,6 +340,17 @@ private:
 		symbol_entry *          m_symbol;           // symbol pointer
 	};
 
+	// a single step of the compiled form of the postfix sequence
+	struct compiled_op
+	{
+		u8                  m_op;               // operator type, or one of the push operations
+		int                 m_offset;           // offset within the string
+		u64                 m_value;            // number to push, or function parameter count
+		symbol_entry *      m_symbol;           // symbol to read or write, or function to call
+		const parse_token * m_token;            // memory operator
+		address_space *     m_space;            // address space of the memory operator, if resolved
+	};
+
 	// internal helpers
 	void copy(const parsed_expression &src);
 	void print_tokens();
@@ -358,6 +372,8 @@ private:
 	void pop_token_rval(parse_token &token);
 	u64 execute_tokens();
 	void execute_function(parse_token &token);
+	void compile();
+	u64 execute_compiled();
 
 	// constants
 	static const int MAX_FUNCTION_PARAMS = 16;
@@ -369,6 +385,8 @@ private:
 	std::list<parse_token> m_tokenlist;                 // token list
 	std::list<std::string> m_stringlist;                // string list
 	std::deque<parse_token> m_token_stack;              // token stack (used during execution)
+	std::vector<compiled_op> m_compiled;                // compiled form of the token list (empty if not compilable)
+	std::vector<u64>    m_compiled_stack;               // value stack for the compiled form
 };
 
 #endif // MAME_EMU_DEBUG_EXPRESS_H
@@ -10,8 +10,11 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
 #include "screen.h"
 
+#include "debug/debugbuf.h"
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -46,14 +49,18 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	: device_interface(device, "execute")
 	, m_scheduler(nullptr)
 	, m_disabled(false)
+	, m_execution_domain(0)
 	, m_vblank_interrupt(device)
 	, m_vblank_interrupt_screen(nullptr)
 	, m_timed_interrupt(device)
 	, m_timed_interrupt_period(attotime::zero)
 	, m_nextexec(nullptr)
+	, m_exec_index(0)
+	, m_exec_class(0)
 	, m_driver_irq(device)
 	, m_timedint_timer(nullptr)
 	, m_profiler(PROFILER_IDLE)
+	, m_profile_scope(0)
 	, m_icountptr(nullptr)
 	, m_cycles_running(0)
 	, m_cycles_stolen(0)
@@ -68,8 +75,22 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	, m_divshift(0)
 	, m_cycles_per_second(0)
 	, m_attoseconds_per_cycle(0)
+	, m_idle_detect(false)
+	, m_idle_phase(idle_phase::WATCHING)
+	, m_idle_state(nullptr)
+	, m_idle_pc(0)
+	, m_idle_samples(0)
+	, m_idle_samples_needed(IDLE_MIN_SAMPLES)
+	, m_idle_side_effects(false)
+	, m_idle_poll_count(0)
+	, m_idle_current(0)
+	, m_profile_ticks(0)
+	, m_profile_cycles(0)
+	, m_profile_eaten(0)
+	, m_profile_timeslices(0)
 {
 	memset(&m_localtime, 0, sizeof(m_localtime));
+	memset(m_profile_perf, 0, sizeof(m_profile_perf));
 
 	// configure the fast accessor
 	assert(!device.interfaces().m_execute);
@@ -237,6 +258,343 @@ u64 device_execute_interface::total_cycles() const noexcept
 }
 
 
+//-------------------------------------------------
+//  opcode_stats - return the instructions counted
+//  by the instruction hook grouped by mnemonic,
+//  or by PC if there's no disassembler
+//-------------------------------------------------
+
+std::vector<std::pair<std::string, u64> > device_execute_interface::opcode_stats()
+{
+	std::map<std::string, u64> totals;
+	device_disasm_interface *dasm;
+	if (!m_opcode_counts.empty() && device().interface(dasm))
+	{
+		// the mnemonic is everything up to the first space, so operands and addressing modes are merged
+		debug_disasm_buffer buffer(device());
+		for (auto const &count : m_opcode_counts)
+		{
+			std::string text;
+			offs_t next_pc, size;
+			u32 info;
+			buffer.disassemble(count.first, text, next_pc, size, info);
+			totals[text.substr(0, text.find(' '))] += count.second;
+		}
+	}
+	else
+	{
+		for (auto const &count : m_opcode_counts)
+			totals[util::string_format("%X", count.first)] += count.second;
+	}
+
+	std::vector<std::pair<std::string, u64> > result(totals.begin(), totals.end());
+	std::stable_sort(
+			result.begin(),
+			result.end(),
+			[] (auto const &a, auto const &b) { return a.second > b.second; });
+	return result;
+}
+
+
+//-------------------------------------------------
+//  set_idle_detection - enable or disable idle
+//  loop detection for this device
+//-------------------------------------------------
+
+void device_execute_interface::set_idle_detection(bool enable)
+{
+	if (!enable && m_idle_phase == idle_phase::VERIFYING)
+		idle_remove_taps();
+	m_idle_detect = enable;
+	idle_set_phase(idle_phase::WATCHING);
+	m_idle_samples = 0;
+	m_idle_samples_needed = IDLE_MIN_SAMPLES;
+}
+
+
+//-------------------------------------------------
+//  idle_skip - called by the scheduler before a
+//  timeslice; returns true if the device is still
+//  waiting in an idle loop and its cycles should
+//  be eaten rather than executed
+//-------------------------------------------------
+
+bool device_execute_interface::idle_skip()
+{
+	if (m_idle_phase != idle_phase::SKIPPING)
+		return false;
+
+	// any change to the polled memory wakes us up
+	for (u32 index = 0; index < m_idle_poll_count; index++)
+	{
+		idle_poll const &poll = m_idle_polls[index];
+		if ((idle_read_unit(poll.m_ptr, poll.m_bytes) & poll.m_mask) != poll.m_snapshot)
+		{
+			idle_set_phase(idle_phase::WATCHING);
+			m_idle_samples = 0;
+			return false;
+		}
+	}
+
+	m_idle_loops[m_idle_current].m_skipped++;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  idle_set_phase - change detection phase,
+//  keeping the scheduler's count of skipping
+//  devices up to date
+//-------------------------------------------------
+
+void device_execute_interface::idle_set_phase(idle_phase phase)
+{
+	if ((phase == idle_phase::SKIPPING) != (m_idle_phase == idle_phase::SKIPPING))
+	{
+		if (phase == idle_phase::SKIPPING)
+			device().machine().scheduler().m_idle_skipping++;
+		else
+			device().machine().scheduler().m_idle_skipping--;
+	}
+	m_idle_phase = phase;
+}
+
+
+//-------------------------------------------------
+//  idle_timer_fired - called by the scheduler for
+//  each device timer that fires while a device is
+//  skipping; on-chip peripherals raise their
+//  interrupts from timers, without going through
+//  an input line
+//-------------------------------------------------
+
+void device_execute_interface::idle_timer_fired(const device_t &owner)
+{
+	if (m_idle_phase == idle_phase::SKIPPING && std::find(m_idle_owned.begin(), m_idle_owned.end(), &owner) != m_idle_owned.end())
+	{
+		idle_set_phase(idle_phase::WATCHING);
+		m_idle_samples = 0;
+	}
+}
+
+
+//-------------------------------------------------
+//  idle_sample - called by the scheduler after a
+//  timeslice has executed
+//-------------------------------------------------
+
+void device_execute_interface::idle_sample()
+{
+	if (m_idle_state == nullptr)
+		return;
+
+	if (m_idle_phase == idle_phase::VERIFYING)
+	{
+		idle_finish_verify();
+		return;
+	}
+
+	// keep counting while the PC stays close to where it was
+	offs_t const pc = m_idle_state->pcbase();
+	if ((pc - m_idle_pc + IDLE_PC_WINDOW) <= (IDLE_PC_WINDOW * 2))
+	{
+		if (++m_idle_samples >= m_idle_samples_needed)
+			idle_start_verify();
+	}
+	else
+	{
+		m_idle_pc = pc;
+		m_idle_samples = 0;
+	}
+}
+
+
+//-------------------------------------------------
+//  idle_start_verify - tap every address space to
+//  see what the next timeslice actually does
+//-------------------------------------------------
+
+void device_execute_interface::idle_start_verify()
+{
+	device_memory_interface *memory;
+	if (!device().interface(memory))
+		return;
+
+	idle_set_phase(idle_phase::VERIFYING);
+	m_idle_side_effects = false;
+	m_idle_poll_count = 0;
+	for (int spacenum = 0; spacenum < memory->max_space_count(); spacenum++)
+	{
+		if (!memory->has_space(spacenum))
+			continue;
+
+		address_space &space = memory->space(spacenum);
+		bool const program = (spacenum == AS_PROGRAM);
+		switch (space.data_width())
+		{
+		case 8:  idle_install_taps<u8>(space, program);  break;
+		case 16: idle_install_taps<u16>(space, program); break;
+		case 32: idle_install_taps<u32>(space, program); break;
+		case 64: idle_install_taps<u64>(space, program); break;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  idle_install_taps - install read and write
+//  taps covering an entire address space
+//-------------------------------------------------
+
+template <typename T>
+void device_execute_interface::idle_install_taps(address_space &space, bool program)
+{
+	memory_passthrough_handler *const taps = space.install_read_tap(
+			0, space.addrmask(), "idle_detect",
+			[this, &space, program] (offs_t offset, T &data, T mem_mask) { idle_tap_read(space, program, offset, data, mem_mask, sizeof(T)); });
+	space.install_write_tap(
+			0, space.addrmask(), "idle_detect",
+			[this] (offs_t offset, T &data, T mem_mask) { m_idle_side_effects = true; },
+			taps);
+	m_idle_taps.push_back(taps);
+}
+
+
+//-------------------------------------------------
+//  idle_tap_read - note a read made while
+//  verifying a candidate idle loop
+//-------------------------------------------------
+
+void device_execute_interface::idle_tap_read(address_space &space, bool program, offs_t address, u64 data, u64 mem_mask, u8 bytes)
+{
+	if (m_idle_side_effects)
+		return;
+
+	// anything outside program space may be I/O with side effects
+	if (!program)
+	{
+		m_idle_side_effects = true;
+		return;
+	}
+
+	// only plain memory is safe to poll without running the code; opcode fetches
+	// are polled too, so a variable that happens to sit next to the code is still seen
+	const void *const ptr = space.get_read_ptr(address);
+	if (ptr == nullptr)
+	{
+		m_idle_side_effects = true;
+		return;
+	}
+
+	for (u32 index = 0; index < m_idle_poll_count; index++)
+	{
+		idle_poll &poll = m_idle_polls[index];
+		if (poll.m_address == address)
+		{
+			// a changing value means the loop is making progress; other lanes of the unit are added
+			if ((poll.m_data ^ data) & mem_mask & poll.m_mask)
+				m_idle_side_effects = true;
+			poll.m_data |= data & mem_mask & ~poll.m_mask;
+			poll.m_mask |= mem_mask;
+			return;
+		}
+	}
+
+	if (m_idle_poll_count == IDLE_MAX_POLLS)
+	{
+		m_idle_side_effects = true;
+		return;
+	}
+
+	idle_poll &poll = m_idle_polls[m_idle_poll_count++];
+	poll.m_address = address;
+	poll.m_ptr = ptr;
+	poll.m_mask = mem_mask;
+	poll.m_data = data & mem_mask;
+	poll.m_bytes = bytes;
+}
+
+
+//-------------------------------------------------
+//  idle_read_unit - read a bus unit of memory
+//  the way the address space stores it
+//-------------------------------------------------
+
+u64 device_execute_interface::idle_read_unit(const void *ptr, u8 bytes)
+{
+	switch (bytes)
+	{
+	case 1:  return *reinterpret_cast<const u8 *>(ptr);
+	case 2:  return *reinterpret_cast<const u16 *>(ptr);
+	case 4:  return *reinterpret_cast<const u32 *>(ptr);
+	default: return *reinterpret_cast<const u64 *>(ptr);
+	}
+}
+
+
+//-------------------------------------------------
+//  idle_finish_verify - decide whether the
+//  verified timeslice was an idle loop
+//-------------------------------------------------
+
+void device_execute_interface::idle_finish_verify()
+{
+	idle_remove_taps();
+
+	// the loop must have stayed put, polled some RAM, and done nothing else
+	offs_t const pc = m_idle_state->pcbase();
+	if (m_idle_side_effects || m_idle_poll_count == 0 || (pc - m_idle_pc + IDLE_PC_WINDOW) > (IDLE_PC_WINDOW * 2))
+	{
+		// back off so we don't keep tapping a busy loop
+		idle_set_phase(idle_phase::WATCHING);
+		m_idle_samples = 0;
+		m_idle_samples_needed = std::min(m_idle_samples_needed * 2, IDLE_MAX_SAMPLES);
+		return;
+	}
+
+	for (u32 index = 0; index < m_idle_poll_count; index++)
+		m_idle_polls[index].m_snapshot = idle_read_unit(m_idle_polls[index].m_ptr, m_idle_polls[index].m_bytes) & m_idle_polls[index].m_mask;
+
+	// timers belonging to the device or its on-chip peripherals wake it
+	if (m_idle_owned.empty())
+	{
+		for (device_t &owned : device_enumerator(device()))
+			m_idle_owned.push_back(&owned);
+	}
+
+	// note this loop for the report
+	auto const found = std::find_if(m_idle_loops.begin(), m_idle_loops.end(), [this] (idle_loop const &loop) { return loop.m_pc == m_idle_pc; });
+	if (found == m_idle_loops.end())
+	{
+		device().logerror("Idle loop detected at PC %X polling %u location(s) starting at %X\n", m_idle_pc, m_idle_poll_count, m_idle_polls[0].m_address);
+		m_idle_loops.push_back(idle_loop{ m_idle_pc, 0, 0 });
+		m_idle_current = m_idle_loops.size() - 1;
+	}
+	else
+	{
+		m_idle_current = found - m_idle_loops.begin();
+	}
+	m_idle_loops[m_idle_current].m_detections++;
+
+	idle_set_phase(idle_phase::SKIPPING);
+	m_idle_samples = 0;
+	m_idle_samples_needed = IDLE_MIN_SAMPLES;
+}
+
+
+//-------------------------------------------------
+//  idle_remove_taps - remove the taps installed
+//  for verification
+//-------------------------------------------------
+
+void device_execute_interface::idle_remove_taps()
+{
+	for (memory_passthrough_handler *taps : m_idle_taps)
+		taps->remove();
+	m_idle_taps.clear();
+}
+
+
 //-------------------------------------------------
 //  execute_clocks_to_cycles - convert the number
 //  of clocks to cycles, rounding down if necessary
@@ -361,6 +719,11 @@ void device_execute_interface::interface_validity_check(validity_checker &valid)
 		osd_printf_error("Timed interrupt handler specified with 0 period\n");
 	else if (m_timed_interrupt.isnull() && m_timed_interrupt_period != attotime::zero)
 		osd_printf_error("No timer interrupt handler specified, but has a non-0 period given\n");
+
+	// sound streams are only ever updated from the main domain
+	device_sound_interface const *sound;
+	if (m_execution_domain != 0 && device().interface(sound))
+		osd_printf_error("Sound device placed in execution domain %d, but must stay in the main domain\n", m_execution_domain);
 }
 
 
@@ -382,8 +745,14 @@ void device_execute_interface::interface_pre_start()
 	int const index = device_enumerator(device().machine().root_device()).indexof(*this);
 	m_suspend = SUSPEND_REASON_RESET;
 	m_profiler = profile_type(index + PROFILER_DEVICE_FIRST);
+	m_profile_scope = util::scope_profiler::register_scope(device().tag());
 	m_inttrigger = index + TRIGGER_INT;
 
+	// look for idle loops in CPUs if requested
+	device().interface(m_idle_state);
+	if (device().machine().options().idle_detect() && m_idle_state != nullptr)
+		m_idle_detect = true;
+
 	// allocate timers if we need them
 	if (m_timed_interrupt_period != attotime::zero)
 		m_timedint_timer = m_scheduler->timer_alloc(timer_expired_delegate(FUNC(device_execute_interface::trigger_periodic_interrupt), this));
@@ -431,6 +800,10 @@ void device_execute_interface::interface_pre_reset()
 	// reset the total number of cycles
 	m_totalcycles = 0;
 
+	// start looking for idle loops afresh
+	if (m_idle_detect)
+		set_idle_detection(true);
+
 	// enable all devices (except for disabled and unclocked devices)
 	if (disabled())
 		suspend(SUSPEND_REASON_DISABLE, true);
@@ -470,6 +843,22 @@ void device_execute_interface::interface_post_reset()
 }
 
 
+//-------------------------------------------------
+//  interface_pre_stop - work to be done before
+//  the device is stopped
+//-------------------------------------------------
+
+void device_execute_interface::interface_pre_stop()
+{
+	if (m_idle_phase == idle_phase::VERIFYING)
+		idle_remove_taps();
+
+	// report the idle loops we found
+	for (idle_loop const &loop : m_idle_loops)
+		osd_printf_verbose("%s: idle loop at PC %X detected %u times, %u timeslices skipped\n", device().tag(), loop.m_pc, loop.m_detections, loop.m_skipped);
+}
+
+
 //-------------------------------------------------
 //  interface_clock_changed - recomputes clock
 //  information for this device
@@ -770,7 +1159,10 @@ if (TEMPLOG) printf(" (%d,%d)\n", m_curstate, m_curvector);
 
 			// generate a trigger to unsuspend any devices waiting on the interrupt
 			if (m_curstate != CLEAR_LINE)
+			{
 				m_execute->signal_interrupt_trigger();
+				m_execute->idle_wake();
+			}
 		}
 	}
 
@@ -103,6 +103,7 @@ public:
 
 	// configuration access
 	bool disabled() const { return m_disabled; }
+	int execution_domain() const { return m_execution_domain; }
 	u64 clocks_to_cycles(u64 clocks) const { return execute_clocks_to_cycles(clocks); }
 	u64 cycles_to_clocks(u64 cycles) const { return execute_cycles_to_clocks(cycles); }
 	u32 min_cycles() const { return execute_min_cycles(); }
@@ -116,6 +117,13 @@ public:
 	// inline configuration helpers
 	void set_disable() { m_disabled = true; }
 
+	// devices in different execution domains may be run concurrently on
+	// separate threads within a timeslice; they must only interact through
+	// timers (e.g. synchronize() or synchronised input lines) and shared RAM;
+	// sound streams aren't synchronised, so sound devices and anything that
+	// writes to them must stay in the main domain (0)
+	void set_execution_domain(int domain) { m_execution_domain = domain; }
+
 	template <typename... T> void set_vblank_int(const char *tag, T &&... args)
 	{
 		m_vblank_interrupt.set(std::forward<T>(args)...);
@@ -186,6 +194,24 @@ public:
 	attotime local_time() const noexcept;
 	u64 total_cycles() const noexcept;
 
+	// idle loop detection; a device spinning on unchanging RAM with no other
+	// side effects has its cycles eaten until the RAM changes, an interrupt
+	// arrives, or a timer belonging to it or its on-chip peripherals fires
+	void set_idle_detection(bool enable);
+	bool idle_detection() const { return m_idle_detect; }
+	u32 idle_loops_detected() const { return m_idle_loops.size(); }
+
+	// profiling statistics, gathered by the scheduler when -device_profile is enabled
+	osd_ticks_t profile_ticks() const { return m_profile_ticks; }
+	u64 profile_cycles() const { return m_profile_cycles; }
+	u64 profile_eaten() const { return m_profile_eaten; }
+	u64 profile_timeslices() const { return m_profile_timeslices; }
+	u64 profile_perf(osd_perf_counter counter) const { return m_profile_perf[counter]; }
+
+	// executed instructions by mnemonic, most frequent first, counted by the instruction hook when -opcodestats is enabled
+	std::vector<std::pair<std::string, u64> > opcode_stats();
+	void reset_opcode_stats() { m_opcode_counts.clear(); }
+
 	// required operation overrides
 	void run() { execute_run(); }
 
@@ -216,6 +242,7 @@ protected:
 	virtual void interface_post_start() override;
 	virtual void interface_pre_reset() override;
 	virtual void interface_post_reset() override;
+	virtual void interface_pre_stop() override;
 	virtual void interface_clock_changed() override;
 
 	// for use by devcpu for now...
@@ -228,8 +255,14 @@ protected:
 	bool debugger_enabled() const { return bool(device().machine().debug_flags & DEBUG_FLAG_ENABLED); }
 	void debugger_instruction_hook(offs_t curpc)
 	{
-		if (device().machine().debug_flags & DEBUG_FLAG_CALL_HOOK)
-			device().debug()->instruction_hook(curpc);
+		int const flags = device().machine().debug_flags;
+		if (flags & (DEBUG_FLAG_CALL_HOOK | DEBUG_FLAG_OPCODE_STATS))
+		{
+			if (flags & DEBUG_FLAG_OPCODE_STATS)
+				m_opcode_counts[curpc]++;
+			if (flags & DEBUG_FLAG_CALL_HOOK)
+				device().debug()->instruction_hook(curpc);
+		}
 	}
 	void debugger_exception_hook(int exception)
 	{
@@ -272,6 +305,47 @@ private:
 		TIMER_CALLBACK_MEMBER(empty_event_queue);
 	};
 
+	// idle loop detection state
+	enum class idle_phase : u8
+	{
+		WATCHING,       // sampling the PC after each timeslice
+		VERIFYING,      // watching memory accesses for a timeslice
+		SKIPPING        // eating cycles until the polled memory changes
+	};
+	static constexpr offs_t IDLE_PC_WINDOW = 32;            // how far the PC may wander while looping
+	static constexpr u32 IDLE_MAX_POLLS = 16;               // most distinct locations a loop may read, code included
+	static constexpr u32 IDLE_MIN_SAMPLES = 8;              // timeslices spent in the window before verifying
+	static constexpr u32 IDLE_MAX_SAMPLES = 1024;           // backoff limit after failed verifications
+
+	struct idle_poll
+	{
+		offs_t          m_address;          // address of the bus unit being polled
+		const void *    m_ptr;              // direct pointer to the memory behind it
+		u64             m_mask;             // lanes of the unit actually read
+		u64             m_data;             // masked value seen while verifying
+		u64             m_snapshot;         // masked memory contents when skipping began
+		u8              m_bytes;            // width of the bus unit
+	};
+
+	struct idle_loop
+	{
+		offs_t          m_pc;               // PC the loop was detected at
+		u32             m_detections;       // times it was detected
+		u64             m_skipped;          // timeslices skipped in it
+	};
+
+	bool idle_skip();
+	void idle_sample();
+	void idle_set_phase(idle_phase phase);
+	void idle_wake() { if (m_idle_phase == idle_phase::SKIPPING) idle_set_phase(idle_phase::WATCHING); }
+	void idle_timer_fired(const device_t &owner);
+	void idle_start_verify();
+	void idle_finish_verify();
+	void idle_remove_taps();
+	template <typename T> void idle_install_taps(address_space &space, bool program);
+	void idle_tap_read(address_space &space, bool program, offs_t address, u64 data, u64 mem_mask, u8 bytes);
+	static u64 idle_read_unit(const void *ptr, u8 bytes);
+
 	// internal debugger hooks
 	void debugger_start_cpu_hook(const attotime &endtime)
 	{
@@ -289,6 +363,7 @@ private:
 
 	// configuration
 	bool                    m_disabled;                 // disabled from executing?
+	int                     m_execution_domain;         // domain for concurrent execution (0 = default)
 	device_interrupt_delegate m_vblank_interrupt;       // for interrupts tied to VBLANK
 	const char *            m_vblank_interrupt_screen;  // the screen that causes the VBLANK interrupt
 	device_interrupt_delegate m_timed_interrupt;        // for interrupts not tied to VBLANK
@@ -296,6 +371,8 @@ private:
 
 	// execution lists
 	device_execute_interface *m_nextexec;               // pointer to the next device to execute, in order
+	u32                     m_exec_index;               // position among all executing devices
+	u8                      m_exec_class;               // how the scheduler has this device listed
 
 	// input states and IRQ callbacks
 	device_irq_acknowledge_delegate m_driver_irq;       // driver-specific IRQ callback
@@ -304,6 +381,7 @@ private:
 
 	// cycle counting and executing
 	profile_type            m_profiler;                 // profiler tag
+	util::scope_profiler::scope_id m_profile_scope;     // scope on the host timeline
 	int *                   m_icountptr;                // pointer to the icount
 	int                     m_cycles_running;           // number of cycles we are executing
 	int                     m_cycles_stolen;            // number of cycles we artificially stole
@@ -324,6 +402,29 @@ private:
 	u32                     m_cycles_per_second;        // cycles per second, adjusted for multipliers
 	attoseconds_t           m_attoseconds_per_cycle;    // attoseconds per adjusted clock cycle
 
+	// idle loop detection
+	bool                    m_idle_detect;              // true if we are looking for idle loops
+	idle_phase              m_idle_phase;               // current detection phase
+	device_state_interface *m_idle_state;               // state interface used to read the PC
+	offs_t                  m_idle_pc;                  // PC at the start of the current window
+	u32                     m_idle_samples;             // consecutive timeslices ending in the window
+	u32                     m_idle_samples_needed;      // timeslices needed before verifying
+	bool                    m_idle_side_effects;        // true if the verified timeslice did anything but poll RAM
+	idle_poll               m_idle_polls[IDLE_MAX_POLLS]; // locations polled by the loop
+	u32                     m_idle_poll_count;          // number of valid entries in m_idle_polls
+	u32                     m_idle_current;             // index of the loop being skipped in m_idle_loops
+	std::vector<memory_passthrough_handler *> m_idle_taps; // taps installed while verifying
+	std::vector<idle_loop>  m_idle_loops;               // loops detected so far
+	std::vector<const device_t *> m_idle_owned;         // the device and its subdevices, whose timers wake it
+
+	// profiling
+	osd_ticks_t             m_profile_ticks;            // host time spent executing since the last sample
+	u64                     m_profile_cycles;           // cycles executed since the last sample
+	u64                     m_profile_eaten;            // cycles eaten while suspended since the last sample
+	u64                     m_profile_timeslices;       // timeslices entered since the last sample
+	u64                     m_profile_perf[OSD_PERF_COUNTER_COUNT]; // host hardware events since the last sample, with -perf_counters
+	std::unordered_map<offs_t, u64> m_opcode_counts;    // times each PC was executed, for -opcodestats
+
 	// callbacks
 	TIMER_CALLBACK_MEMBER(timed_trigger_callback) { trigger(param); }
 
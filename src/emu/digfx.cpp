@@ -98,6 +98,27 @@ void device_gfx_interface::interface_post_start()
 }
 
 
+//-------------------------------------------------
+//  interface_post_stop - report how well the
+//  decoded tile caches performed
+//-------------------------------------------------
+
+void device_gfx_interface::interface_post_stop()
+{
+	for (int curgfx = 0; curgfx < MAX_GFX_ELEMENTS; curgfx++)
+	{
+		gfx_element *const gfx = m_gfx[curgfx].get();
+		if (gfx && gfx->cached())
+		{
+			u64 const total = gfx->cache_hits() + gfx->cache_misses();
+			osd_printf_verbose("%s: gfx[%d] decoded tile cache: %u hits, %u misses (%.1f%% hit rate)\n",
+					device().tag(), curgfx, gfx->cache_hits(), gfx->cache_misses(),
+					total ? 100.0 * double(gfx->cache_hits()) / double(total) : 0.0);
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  decode_gfx - parse gfx decode info and
 //  create gfx elements
@@ -114,6 +135,9 @@ void device_gfx_interface::decode_gfx(const gfx_decode_entry *gfxdecodeinfo)
 	std::vector<u32> extxoffs(0);
 	std::vector<u32> extyoffs(0);
 
+	// per-set limit on decoded data in bytes, if any
+	u32 const cache_limit = u32(std::clamp(device().mconfig().options().gfx_cache_size(), 0, 4095)) << 20;
+
 	// loop over all elements
 	for (u8 curgfx = 0; curgfx < MAX_GFX_ELEMENTS && gfxdecodeinfo[curgfx].gfxlayout != nullptr; curgfx++)
 	{
@@ -264,6 +288,10 @@ void device_gfx_interface::decode_gfx(const gfx_decode_entry *gfxdecodeinfo)
 
 		// allocate the graphics
 		m_gfx[curgfx] = std::make_unique<gfx_element>(m_palette, glcopy, (region_base != nullptr) ? region_base + gfx.start : nullptr, xormask, gfx.total_color_codes, gfx.color_codes_start);
+
+		// optionally cap the memory used by decoded tiles
+		if (cache_limit)
+			m_gfx[curgfx]->set_cache_limit(cache_limit);
 	}
 
 	m_decoded = true;
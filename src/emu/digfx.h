@@ -185,6 +185,7 @@ protected:
 	virtual void interface_validity_check(validity_checker &valid) const override;
 	virtual void interface_pre_start() override;
 	virtual void interface_post_start() override;
+	virtual void interface_post_stop() override;
 
 private:
 	optional_device<device_palette_interface> m_palette; // configured tag for palette device
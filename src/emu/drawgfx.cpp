@@ -94,6 +94,9 @@ gfx_element::gfx_element(device_palette_interface *palette, u8 *base, u16 width,
 		m_srcdata(base),
 		m_dirtyseq(1),
 		m_gfxdata(base),
+		m_cache_limit(0),
+		m_cache_hits(0),
+		m_cache_misses(0),
 		m_layout_is_raw(true),
 		m_layout_planes(0),
 		m_layout_xormask(0),
@@ -119,6 +122,9 @@ gfx_element::gfx_element(device_palette_interface *palette, const gfx_layout &gl
 		m_srcdata(nullptr),
 		m_dirtyseq(1),
 		m_gfxdata(nullptr),
+		m_cache_limit(0),
+		m_cache_hits(0),
+		m_cache_misses(0),
 		m_layout_is_raw(false),
 		m_layout_planes(0),
 		m_layout_xormask(xormask),
@@ -157,6 +163,7 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 		m_layout_xoffset.clear();
 		m_layout_yoffset.clear();
 		m_gfxdata_allocated.clear();
+		m_cache.reset();
 
 		// modulos are determined for us by the layout
 		m_line_modulo = gl.yoffs(0) / 8;
@@ -185,15 +192,15 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 		// we get to pick our own modulos
 		m_line_modulo = m_origwidth;
 		m_char_modulo = m_line_modulo * m_origheight;
-
-		// allocate memory for the data
-		m_gfxdata_allocated.resize(m_total_elements * m_char_modulo);
-		m_gfxdata = &m_gfxdata_allocated[0];
 	}
 
 	// mark everything dirty
 	m_dirty.resize(m_total_elements);
-	memset(&m_dirty[0], 1, m_total_elements);
+	memset(&m_dirty[0], DIRTY_SOURCE, m_total_elements);
+
+	// allocate memory for the data
+	if (!m_layout_is_raw)
+		allocate_data();
 
 	// allocate a pen usage array for entries with 32 pens or less
 	if (m_color_depth <= 32)
@@ -228,7 +235,7 @@ void gfx_element::set_raw_layout(const u8 *srcdata, u32 width, u32 height, u32 t
 void gfx_element::set_source(const u8 *source)
 {
 	m_srcdata = source;
-	memset(&m_dirty[0], 1, elements());
+	memset(&m_dirty[0], DIRTY_SOURCE, elements());
 	if (m_layout_is_raw) m_gfxdata = const_cast<u8 *>(source);
 }
 
@@ -245,22 +252,16 @@ void gfx_element::set_source_and_total(const u8 *source, u32 total)
 
 	// mark everything dirty
 	m_dirty.resize(m_total_elements);
-	memset(&m_dirty[0], 1, m_total_elements);
+	memset(&m_dirty[0], DIRTY_SOURCE, m_total_elements);
 
 	// allocate a pen usage array for entries with 32 pens or less
 	if (m_color_depth <= 32)
 		m_pen_usage.resize(m_total_elements);
 
 	if (m_layout_is_raw)
-	{
 		m_gfxdata = const_cast<u8 *>(source);
-	}
 	else
-	{
-		// allocate memory for the data
-		m_gfxdata_allocated.resize(m_total_elements * m_char_modulo);
-		m_gfxdata = &m_gfxdata_allocated[0];
-	}
+		allocate_data();
 }
 
 
@@ -282,6 +283,100 @@ void gfx_element::set_source_clip(u32 xoffs, u32 width, u32 yoffs, u32 height)
 }
 
 
+//-------------------------------------------------
+//  set_cache_limit - cap the memory used for
+//  decoded data; least recently used elements are
+//  dropped and decoded again on their next use
+//-------------------------------------------------
+
+void gfx_element::set_cache_limit(u32 max_bytes)
+{
+	m_cache_limit = max_bytes;
+	if (!m_layout_is_raw)
+	{
+		memset(&m_dirty[0], DIRTY_SOURCE, m_total_elements);
+		allocate_data();
+	}
+}
+
+
+//-------------------------------------------------
+//  allocate_data - allocate storage for decoded
+//  elements, either all of them or as many as the
+//  cache limit allows; expects everything to have
+//  been marked dirty
+//-------------------------------------------------
+
+void gfx_element::allocate_data()
+{
+	u32 const slots = m_cache_limit ? std::max(m_cache_limit / std::max<u32>(m_char_modulo, 1), MIN_CACHE_ELEMENTS) : 0;
+	if (slots && slots < m_total_elements)
+	{
+		m_cache = std::make_unique<util::lru_cache_map<u32, u32> >(slots);
+		m_gfxdata_allocated.resize(slots * m_char_modulo);
+	}
+	else
+	{
+		m_cache.reset();
+		m_gfxdata_allocated.resize(m_total_elements * m_char_modulo);
+	}
+	m_gfxdata_allocated.shrink_to_fit();
+	m_gfxdata = &m_gfxdata_allocated[0];
+}
+
+
+//-------------------------------------------------
+//  cached_data - return decoded data for an
+//  element when the decoded data is capped
+//-------------------------------------------------
+
+const u8 *gfx_element::cached_data(u32 code)
+{
+	if (m_dirty[code])
+	{
+		m_cache_misses++;
+		decode(code);
+	}
+	else
+	{
+		m_cache_hits++;
+	}
+	return m_gfxdata + cache_slot(code) * m_char_modulo;
+}
+
+
+//-------------------------------------------------
+//  cache_slot - find the slot holding an element,
+//  claiming the least recently used one if it
+//  isn't resident
+//-------------------------------------------------
+
+u32 gfx_element::cache_slot(u32 code)
+{
+	// find also makes this the most recently used element
+	auto const found = m_cache->find(code);
+	if (found != m_cache->end())
+		return found->second;
+
+	u32 slot;
+	if (m_cache->size() < m_cache->max_size())
+	{
+		slot = m_cache->size();
+	}
+	else
+	{
+		// evict the least recently used element; its pen usage stays valid
+		auto const lru = m_cache->begin();
+		slot = lru->second;
+		if (m_dirty[lru->first] == 0)
+			m_dirty[lru->first] = DIRTY_EVICTED;
+		m_cache->erase(lru);
+	}
+	m_cache->emplace(code, slot);
+	return slot;
+}
+
+
 //-------------------------------------------------
 //  decode - decode a single character
 //-------------------------------------------------
@@ -292,7 +387,7 @@ void gfx_element::decode(u32 code)
 	if (!m_layout_is_raw)
 	{
 		// zap the data to 0
-		u8 *decode_base = m_gfxdata + code * m_char_modulo;
+		u8 *decode_base = m_gfxdata + (m_cache ? cache_slot(code) : code) * m_char_modulo;
 		memset(decode_base, 0, m_char_modulo);
 
 		// iterate over planes
@@ -318,10 +413,10 @@ void gfx_element::decode(u32 code)
 	}
 
 	// (re)compute pen usage
-	if (code < m_pen_usage.size())
+	if (code < m_pen_usage.size() && m_dirty[code] == DIRTY_SOURCE)
 	{
 		// iterate over data, creating a bitmask of live pens
-		const u8 *dp = m_gfxdata + code * m_char_modulo;
+		const u8 *dp = m_gfxdata + (m_cache ? cache_slot(code) : code) * m_char_modulo;
 		u32 usage = 0;
 		for (int y = 0; y < m_origheight; y++)
 		{
@@ -354,7 +449,7 @@ void gfx_element::opaque(bitmap_ind16 &dest, const rectangle &cliprect,
 {
 	color = colorbase() + granularity() * (color % colors());
 	code %= elements();
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_OPAQUE(destp, srcp); });
+	drawgfx_row_core(dest, cliprect, code, flipx, flipy, destx, desty, nullptr, [color](auto step, u16 *destp, u8 *, const u8 *srcp, s32 count) { drawgfx_row_rebase_opaque<decltype(step)::value>(destp, srcp, count, color); });
 }
 
 void gfx_element::opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -362,7 +457,7 @@ void gfx_element::opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
 {
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
 	code %= elements();
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_OPAQUE(destp, srcp); });
+	drawgfx_row_core(dest, cliprect, code, flipx, flipy, destx, desty, nullptr, [paldata](auto step, u32 *destp, u8 *, const u8 *srcp, s32 count) { drawgfx_row_remap_opaque<decltype(step)::value>(destp, srcp, count, paldata); });
 }
 
 
@@ -395,7 +490,7 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_row_core(dest, cliprect, code, flipx, flipy, destx, desty, nullptr, [trans_pen, color](auto step, u16 *destp, u8 *, const u8 *srcp, s32 count) { drawgfx_row_rebase_transpen<decltype(step)::value>(destp, srcp, count, color, trans_pen); });
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -422,7 +517,7 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); });
+	drawgfx_row_core(dest, cliprect, code, flipx, flipy, destx, desty, nullptr, [trans_pen, paldata](auto step, u32 *destp, u8 *, const u8 *srcp, s32 count) { drawgfx_row_remap_transpen<decltype(step)::value>(destp, srcp, count, paldata, trans_pen); });
 }
 
 
@@ -936,7 +1031,7 @@ void gfx_element::prio_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_row_core(dest, cliprect, code, flipx, flipy, destx, desty, &priority, [pmask, trans_pen, color](auto step, u16 *destp, u8 *pri, const u8 *srcp, s32 count) { drawgfx_row_rebase_transpen_priority<decltype(step)::value>(destp, pri, srcp, count, color, pmask, trans_pen); });
 }
 
 void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -966,7 +1061,7 @@ void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, paldata](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_row_core(dest, cliprect, code, flipx, flipy, destx, desty, &priority, [pmask, trans_pen, paldata](auto step, u32 *destp, u8 *pri, const u8 *srcp, s32 count) { drawgfx_row_remap_transpen_priority<decltype(step)::value>(destp, pri, srcp, count, paldata, pmask, trans_pen); });
 }
 
 
@@ -120,6 +120,8 @@
 #ifndef MAME_EMU_DRAWGFX_H
 #define MAME_EMU_DRAWGFX_H
 
+#include "lrucache.h"
+
 
 /***************************************************************************
     CONSTANTS
@@ -167,6 +169,10 @@ public:
 	u32 rowbytes() const { return m_line_modulo; }
 	bool has_pen_usage() const { return !m_pen_usage.empty(); }
 	bool has_palette() const { return m_palette; }
+	bool cached() const { return bool(m_cache); }
+	u64 cache_hits() const { return m_cache_hits; }
+	u64 cache_misses() const { return m_cache_misses; }
+	size_t memory_bytes() const { return m_gfxdata_allocated.capacity() + m_dirty.capacity() + m_pen_usage.capacity() * sizeof(u32); }
 
 	// used by tilemaps
 	u32 dirtyseq() const { return m_dirtyseq; }
@@ -182,6 +188,7 @@ public:
 	void set_colorbase(u16 colorbase) { m_color_base = colorbase; }
 	void set_granularity(u16 granularity) { m_color_granularity = granularity; }
 	void set_source_clip(u32 xoffs, u32 width, u32 yoffs, u32 height);
+	void set_cache_limit(u32 max_bytes);
 
 	// operations
 	void mark_dirty(u32 code) { if (code < elements()) { m_dirty[code] = 1; m_dirtyseq++; } }
@@ -190,6 +197,7 @@ public:
 	const u8 *get_data(u32 code)
 	{
 		assert(code < elements());
+		if (m_cache) return cached_data(code) + m_starty * m_line_modulo + m_startx;
 		if (code < m_dirty.size() && m_dirty[code]) decode(code);
 		return m_gfxdata + code * m_char_modulo + m_starty * m_line_modulo + m_startx;
 	}
@@ -197,7 +205,7 @@ public:
 	u32 pen_usage(u32 code)
 	{
 		assert(code < m_pen_usage.size());
-		if (m_dirty[code]) decode(code);
+		if (m_dirty[code] == DIRTY_SOURCE) decode(code);
 		return m_pen_usage[code];
 	}
 
@@ -205,6 +213,7 @@ public:
 
 	// core drawgfx implementation
 	template <typename BitmapType, typename FunctionClass> void drawgfx_core(BitmapType &dest, const rectangle &cliprect, u32 code, int flipx, int flipy, s32 destx, s32 desty, FunctionClass pixel_op);
+	template <typename BitmapType, typename RowFunction> void drawgfx_row_core(BitmapType &dest, const rectangle &cliprect, u32 code, int flipx, int flipy, s32 destx, s32 desty, bitmap_ind8 *priority, RowFunction row_op);
 
 	// specific drawgfx implementations for each transparency type
 	void opaque(bitmap_ind16 &dest, const rectangle &cliprect, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty);
@@ -280,8 +289,19 @@ public:
 	void alphatable(bitmap_rgb32 &dest, const rectangle &cliprect, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty, int fixedalpha, u8 *alphatable);
 
 private:
+	// values for m_dirty; evicted elements still have valid pen usage
+	static constexpr u8 DIRTY_SOURCE = 1;
+	static constexpr u8 DIRTY_EVICTED = 2;
+
+	// never keep fewer decoded elements than this, so callers can safely
+	// hold on to a handful of get_data() pointers at once
+	static constexpr u32 MIN_CACHE_ELEMENTS = 256;
+
 	// internal helpers
+	void allocate_data();
 	void decode(u32 code);
+	const u8 *cached_data(u32 code);
+	u32 cache_slot(u32 code);
 
 	// internal state
 	device_palette_interface *m_palette;    // palette used for drawing (optional when used as a pure decoder)
@@ -310,6 +330,11 @@ private:
 	std::vector<u8> m_dirty;                // dirty array for detecting chars that need decoding
 	std::vector<u32>  m_pen_usage;      // bitmask of pens that are used (pens 0-31 only)
 
+	u32             m_cache_limit;          // maximum bytes of decoded data, or 0 for no limit
+	std::unique_ptr<util::lru_cache_map<u32, u32> > m_cache; // element to decoded slot, when limited
+	u64             m_cache_hits;           // get_data() calls served from the cache
+	u64             m_cache_misses;         // get_data() calls that had to decode
+
 	bool            m_layout_is_raw;        // raw layout?
 	u8              m_layout_planes;        // bit planes in the layout
 	u32             m_layout_xormask;       // xor mask applied to each bit offset
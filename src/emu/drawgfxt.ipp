@@ -700,6 +700,171 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 
 
 
+/***************************************************************************
+    ROW DRAWGFX CORE
+***************************************************************************/
+
+/*
+    Same as the basic core, but hands whole clipped rows to a row function
+    instead of calling a pixel operation per pixel:
+
+        row_op(step, destptr, priptr, srcptr, count)
+
+    step is std::integral_constant<int, 1> for unflipped rows and
+    std::integral_constant<int, -1> for flipped ones, so the row function
+    can index the source with a compile-time stride. priptr is nullptr when
+    no priority bitmap is given. Row functions written as plain selects
+    (see the drawgfx_row_ helpers below) are vectorised by the compiler.
+*/
+
+template <typename BitmapType, typename RowFunction>
+inline void gfx_element::drawgfx_row_core(BitmapType &dest, const rectangle &cliprect, u32 code, int flipx, int flipy, s32 destx, s32 desty, bitmap_ind8 *priority, RowFunction row_op)
+{
+	g_profiler.start(PROFILER_DRAWGFX);
+	do {
+		assert(dest.valid());
+		assert(!priority || priority->valid());
+		assert(dest.cliprect().contains(cliprect));
+		assert(code < elements());
+
+		// ignore empty/invalid cliprects
+		if (cliprect.empty())
+			break;
+
+		// compute final pixel in X and exit if we are entirely clipped
+		s32 destendx = destx + width() - 1;
+		if (destx > cliprect.right() || destendx < cliprect.left())
+			break;
+
+		// apply left clip
+		s32 srcx = 0;
+		if (destx < cliprect.left())
+		{
+			srcx = cliprect.left() - destx;
+			destx = cliprect.left();
+		}
+
+		// apply right clip
+		if (destendx > cliprect.right())
+			destendx = cliprect.right();
+
+		// compute final pixel in Y and exit if we are entirely clipped
+		s32 destendy = desty + height() - 1;
+		if (desty > cliprect.bottom() || destendy < cliprect.top())
+			break;
+
+		// apply top clip
+		s32 srcy = 0;
+		if (desty < cliprect.top())
+		{
+			srcy = cliprect.top() - desty;
+			desty = cliprect.top();
+		}
+
+		// apply bottom clip
+		if (destendy > cliprect.bottom())
+			destendy = cliprect.bottom();
+
+		// apply X flipping
+		if (flipx)
+			srcx = width() - 1 - srcx;
+
+		// apply Y flipping
+		s32 dy = rowbytes();
+		if (flipy)
+		{
+			srcy = height() - 1 - srcy;
+			dy = -dy;
+		}
+
+		// fetch the source data and point to the first source pixel of the row
+		const u8 *srcdata = get_data(code) + srcy * rowbytes() + srcx;
+		s32 const count = destendx + 1 - destx;
+
+		// iterate over rows, picking the source direction once
+		for (s32 cury = desty; cury <= destendy; cury++)
+		{
+			auto *destptr = &dest.pix(cury, destx);
+			u8 *priptr = priority ? &priority->pix(cury, destx) : nullptr;
+			if (!flipx)
+				row_op(std::integral_constant<int, 1>(), destptr, priptr, srcdata, count);
+			else
+				row_op(std::integral_constant<int, -1>(), destptr, priptr, srcdata, count);
+			srcdata += dy;
+		}
+	} while (0);
+	g_profiler.stop();
+}
+
+
+/*-------------------------------------------------
+    drawgfx_row_* - row functions for the common
+    opaque and transpen cases; each is the select
+    form of the matching PIXEL_OP_ so that the
+    loop body has no branches
+-------------------------------------------------*/
+
+template <int Step>
+inline void drawgfx_row_rebase_opaque(u16 *dest, const u8 *src, s32 count, u32 color)
+{
+	for (s32 i = 0; i < count; i++)
+		dest[i] = color + src[i * Step];
+}
+
+template <int Step>
+inline void drawgfx_row_remap_opaque(u32 *dest, const u8 *src, s32 count, const pen_t *paldata)
+{
+	for (s32 i = 0; i < count; i++)
+		dest[i] = paldata[src[i * Step]];
+}
+
+template <int Step>
+inline void drawgfx_row_rebase_transpen(u16 *dest, const u8 *src, s32 count, u32 color, u32 trans_pen)
+{
+	for (s32 i = 0; i < count; i++)
+	{
+		u32 const srcdata = src[i * Step];
+		dest[i] = (srcdata != trans_pen) ? u16(color + srcdata) : dest[i];
+	}
+}
+
+template <int Step>
+inline void drawgfx_row_remap_transpen(u32 *dest, const u8 *src, s32 count, const pen_t *paldata, u32 trans_pen)
+{
+	for (s32 i = 0; i < count; i++)
+	{
+		u32 const srcdata = src[i * Step];
+		dest[i] = (srcdata != trans_pen) ? u32(paldata[srcdata]) : dest[i];
+	}
+}
+
+template <int Step>
+inline void drawgfx_row_rebase_transpen_priority(u16 *dest, u8 *pri, const u8 *src, s32 count, u32 color, u32 pmask, u32 trans_pen)
+{
+	for (s32 i = 0; i < count; i++)
+	{
+		u32 const srcdata = src[i * Step];
+		bool const opaque = srcdata != trans_pen;
+		bool const visible = ((1 << (pri[i] & 0x1f)) & pmask) == 0;
+		dest[i] = (opaque && visible) ? u16(color + srcdata) : dest[i];
+		pri[i] = opaque ? u8(31) : pri[i];
+	}
+}
+
+template <int Step>
+inline void drawgfx_row_remap_transpen_priority(u32 *dest, u8 *pri, const u8 *src, s32 count, const pen_t *paldata, u32 pmask, u32 trans_pen)
+{
+	for (s32 i = 0; i < count; i++)
+	{
+		u32 const srcdata = src[i * Step];
+		bool const opaque = srcdata != trans_pen;
+		bool const visible = ((1 << (pri[i] & 0x1f)) & pmask) == 0;
+		dest[i] = (opaque && visible) ? u32(paldata[srcdata]) : dest[i];
+		pri[i] = opaque ? u8(31) : pri[i];
+	}
+}
+
+
 /***************************************************************************
     BASIC DRAWGFXZOOM CORE
 ***************************************************************************/
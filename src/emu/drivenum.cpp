@@ -44,12 +44,82 @@ int driver_list::find(const char *name)
 	if (!name)
 		return -1;
 
-	// binary search to find it
-	game_driver const *const *const begin = s_drivers_sorted;
-	game_driver const *const *const end = begin + s_driver_count;
-	auto const cmp = [] (game_driver const *driver, char const *name) { return core_stricmp(driver->name, name) < 0; };
-	game_driver const *const *const result = std::lower_bound(begin, end, name, cmp);
-	return ((result == end) || core_stricmp((*result)->name, name)) ? -1 : std::distance(begin, result);
+	return index_table().find(name);
+}
+
+
+//-------------------------------------------------
+//  index_table - get the name index, building it
+//  the first time it's needed
+//-------------------------------------------------
+
+driver_list::name_index const &driver_list::index_table()
+{
+	static name_index const index;
+	return index;
+}
+
+
+//-------------------------------------------------
+//  name_index - build an open-addressed hash of
+//  driver short names, then resolve every
+//  driver's parent and compatible system once
+//-------------------------------------------------
+
+driver_list::name_index::name_index()
+{
+	// keep the table at most half full so probe sequences stay short
+	u32 size = 16;
+	while (size < (s_driver_count * 2))
+		size <<= 1;
+	m_table.resize(size, -1);
+	m_mask = size - 1;
+	for (std::size_t index = 0; index < s_driver_count; index++)
+	{
+		u32 slot = hash(s_drivers_sorted[index]->name) & m_mask;
+		while (m_table[slot] >= 0)
+			slot = (slot + 1) & m_mask;
+		m_table[slot] = index;
+	}
+
+	m_clone.resize(s_driver_count);
+	m_compatible.resize(s_driver_count);
+	for (std::size_t index = 0; index < s_driver_count; index++)
+	{
+		m_clone[index] = find(s_drivers_sorted[index]->parent);
+		m_compatible[index] = find(s_drivers_sorted[index]->compatible_with);
+	}
+}
+
+
+//-------------------------------------------------
+//  find - look up a driver name in the hash
+//-------------------------------------------------
+
+int driver_list::name_index::find(const char *name) const
+{
+	if (!name)
+		return -1;
+
+	for (u32 slot = hash(name) & m_mask; m_table[slot] >= 0; slot = (slot + 1) & m_mask)
+	{
+		if (!core_stricmp(s_drivers_sorted[m_table[slot]]->name, name))
+			return m_table[slot];
+	}
+	return -1;
+}
+
+
+//-------------------------------------------------
+//  hash - case-insensitive FNV-1a hash of a name
+//-------------------------------------------------
+
+u32 driver_list::name_index::hash(const char *name)
+{
+	u32 result = 2166136261U;
+	for ( ; *name; name++)
+		result = (result ^ u8(tolower(u8(*name)))) * 16777619U;
+	return result;
 }
 
 
@@ -141,6 +211,15 @@ std::size_t driver_enumerator::filter(const char *filterstring)
 	// reset the count
 	exclude_all();
 
+	// a plain name can only match one driver
+	if (filterstring && !core_iswildstr(filterstring))
+	{
+		int const index = find(filterstring);
+		if ((index >= 0) && matches(filterstring, s_drivers_sorted[index]->name))
+			include(index);
+		return m_filtered_count;
+	}
+
 	// match name against each driver in the list
 	for (std::size_t index = 0; index < s_driver_count; index++)
 		if (matches(filterstring, s_drivers_sorted[index]->name))
@@ -160,10 +239,10 @@ std::size_t driver_enumerator::filter(const game_driver &driver)
 	// reset the count
 	exclude_all();
 
-	// match name against each driver in the list
-	for (std::size_t index = 0; index < s_driver_count; index++)
-		if (s_drivers_sorted[index] == &driver)
-			include(index);
+	// look the driver up by name
+	int const index = find(driver);
+	if ((index >= 0) && (s_drivers_sorted[index] == &driver))
+		include(index);
 
 	return m_filtered_count;
 }
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <vector>
 
 
 //**************************************************************************
@@ -48,9 +49,9 @@ public:
 
 	// any item by index
 	static const game_driver &driver(std::size_t index) { assert(index < total()); return *s_drivers_sorted[index]; }
-	static int clone(std::size_t index) { return find(driver(index).parent); }
-	static int non_bios_clone(std::size_t index) { int const result = find(driver(index).parent); return ((result >= 0) && !(driver(result).flags & MACHINE_IS_BIOS_ROOT)) ? result : -1; }
-	static int compatible_with(std::size_t index) { return find(driver(index).compatible_with); }
+	static int clone(std::size_t index) { assert(index < total()); return index_table().clone(index); }
+	static int non_bios_clone(std::size_t index) { int const result = clone(index); return ((result >= 0) && !(driver(result).flags & MACHINE_IS_BIOS_ROOT)) ? result : -1; }
+	static int compatible_with(std::size_t index) { assert(index < total()); return index_table().compatible_with(index); }
 
 	// any item by driver
 	static int clone(const game_driver &driver) { int const index = find(driver); assert(index >= 0); return clone(index); }
@@ -67,6 +68,28 @@ public:
 protected:
 	static std::size_t const            s_driver_count;
 	static game_driver const * const    s_drivers_sorted[];
+
+private:
+	// hash of short names and parent/compatible indices, built on first use
+	class name_index
+	{
+	public:
+		name_index();
+
+		int find(const char *name) const;
+		int clone(std::size_t index) const { return m_clone[index]; }
+		int compatible_with(std::size_t index) const { return m_compatible[index]; }
+
+	private:
+		static u32 hash(const char *name);
+
+		std::vector<int>    m_table;
+		u32                 m_mask;
+		std::vector<int>    m_clone;
+		std::vector<int>    m_compatible;
+	};
+
+	static name_index const &index_table();
 };
 
 
@@ -14,6 +14,9 @@
 #include "emuopts.h"
 #include "debug/debugcpu.h"
 
+#include "osdcore.h"
+#include "osdfile.h"
+
 #include "emumem_mud.h"
 #include "emumem_hea.h"
 #include "emumem_hem.h"
@@ -326,20 +329,139 @@ void memory_manager::initialize()
 }
 
 
+//-------------------------------------------------
+//  write_map_report - write the decode tree
+//  statistics for every address space
+//-------------------------------------------------
+
+void memory_manager::write_map_report(const char *filename) const
+{
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(filename) != osd_file::error::NONE)
+	{
+		osd_printf_warning("Unable to open memory map report file %s\n", filename);
+		return;
+	}
+
+	for (device_memory_interface &memory : memory_interface_enumerator(machine().root_device()))
+		for (int spacenum = 0; spacenum != memory.max_space_count(); spacenum++)
+			if (memory.has_space(spacenum))
+			{
+				file.puts(memory.space(spacenum).map_report());
+				file.puts("\n");
+			}
+}
+
+
 //-------------------------------------------------
 //  allocate_memory - allocate some ram and register it for saving
 //-------------------------------------------------
 
 void *memory_manager::allocate_memory(device_t &dev, int spacenum, std::string name, u8 width, size_t bytes)
 {
-	void *const ptr = m_datablocks.emplace_back(malloc(bytes)).get();
-	memset(ptr, 0, bytes);
+	void *ptr;
+	if (auto large = large_alloc(bytes))
+		ptr = m_largeblocks.emplace_back(std::move(large))->get();
+	else
+	{
+		ptr = m_datablocks.emplace_back(malloc(bytes)).get();
+		memset(ptr, 0, bytes);
+	}
 	machine().save().save_memory(&dev, "memory", dev.tag(), spacenum, name.c_str(), ptr, width/8, u32(bytes) / (width/8));
 	return ptr;
 }
 
 
 
+//-------------------------------------------------
+//  dirty_track - start recording which pages of
+//  a block of RAM get written through the memory
+//  system
+//-------------------------------------------------
+
+memory_dirty_tracker &memory_manager::dirty_track(void *base, size_t bytes, u32 page_bytes)
+{
+	if (memory_dirty_tracker *const existing = dirty_tracker(base))
+	{
+		if (existing->base() == base && existing->bytes() == bytes && existing->page_bytes() >= page_bytes)
+			return *existing;
+		fatalerror("dirty_track called on a block overlapping an already tracked one\n");
+	}
+
+	memory_dirty_tracker &tracker = *m_dirty_trackers.emplace_back(std::make_unique<memory_dirty_tracker>(base, bytes, page_bytes));
+	dirty_refresh();
+	return tracker;
+}
+
+
+//-------------------------------------------------
+//  dirty_untrack - stop tracking a block and give
+//  its handlers back their direct paths
+//-------------------------------------------------
+
+void memory_manager::dirty_untrack(memory_dirty_tracker &tracker)
+{
+	for (auto i = m_dirty_trackers.begin(); i != m_dirty_trackers.end(); ++i)
+		if (i->get() == &tracker)
+		{
+			m_dirty_trackers.erase(i);
+			dirty_refresh();
+			return;
+		}
+	fatalerror("dirty_untrack called with an unknown tracker\n");
+}
+
+
+//-------------------------------------------------
+//  dirty_tracker - find the tracker covering a
+//  host address, if any
+//-------------------------------------------------
+
+memory_dirty_tracker *memory_manager::dirty_tracker(const void *ptr) const
+{
+	for (auto const &tracker : m_dirty_trackers)
+		if (tracker->covers(ptr))
+			return tracker.get();
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  dirty_refresh - reattach the trackers in every
+//  address space
+//-------------------------------------------------
+
+void memory_manager::dirty_refresh()
+{
+	for (device_memory_interface &memory : memory_interface_enumerator(machine().root_device()))
+		for (int spacenum = 0; spacenum != memory.max_space_count(); spacenum++)
+			if (memory.has_space(spacenum))
+				memory.space(spacenum).dirty_refresh();
+}
+
+
+//-------------------------------------------------
+//  large_alloc - allocate a zero-filled block
+//  from the OSD large page allocator if it is at
+//  least -largepages megabytes, or return null
+//  to let the caller use the ordinary heap
+//-------------------------------------------------
+
+std::unique_ptr<osd::large_memory_allocation> memory_manager::large_alloc(size_t bytes)
+{
+	int const threshold = machine().options().large_pages();
+	if (threshold <= 0 || bytes < (size_t(threshold) << 20))
+		return nullptr;
+
+	auto block = std::make_unique<osd::large_memory_allocation>(bytes);
+	if (!*block)
+		return nullptr;
+	if (!block->large_pages())
+		osd_printf_verbose("Large pages unavailable for %u byte block, using ordinary pages\n", u32(bytes));
+	return block;
+}
+
+
 //-------------------------------------------------
 //  region_alloc - allocates memory for a region
 //-------------------------------------------------
@@ -355,6 +477,20 @@ memory_region *memory_manager::region_alloc(std::string name, u32 length, u8 wid
 }
 
 
+//-------------------------------------------------
+//  region_alloc - makes a region out of a file
+//  mapping, taking ownership of it
+//-------------------------------------------------
+
+memory_region *memory_manager::region_alloc(std::string name, std::unique_ptr<osd::file_mapping> &&mapping, u8 width, endianness_t endian)
+{
+	if (m_regionlist.find(name) != m_regionlist.end())
+		fatalerror("region_alloc called with duplicate region name \"%s\"\n", name);
+
+	return m_regionlist.emplace(name, std::make_unique<memory_region>(machine(), name, std::move(mapping), width, endian)).first->second.get();
+}
+
+
 //-------------------------------------------------
 //  region_find - find a region by name
 //-------------------------------------------------
@@ -1053,6 +1189,77 @@ void memory_bank::configure_entries(int startentry, int numentries, void *base,
 //  MEMORY REGIONS
 //**************************************************************************
 
+//-------------------------------------------------
+//  memory_dirty_tracker - constructor
+//-------------------------------------------------
+
+memory_dirty_tracker::memory_dirty_tracker(void *base, size_t bytes, u32 page_bytes)
+	: m_base(reinterpret_cast<u8 *>(base)),
+		m_bytes(bytes),
+		m_page_shift(0)
+{
+	// round the page size up to a power of two
+	while ((u32(1) << m_page_shift) < std::max<u32>(page_bytes, 1))
+		m_page_shift++;
+	m_page_count = u32((bytes + (size_t(1) << m_page_shift) - 1) >> m_page_shift);
+	m_bitmap.resize((m_page_count + 63) / 64, 0);
+}
+
+
+//-------------------------------------------------
+//  mark_all - mark every page dirty
+//-------------------------------------------------
+
+void memory_dirty_tracker::mark_all()
+{
+	std::fill(m_bitmap.begin(), m_bitmap.end(), ~u64(0));
+	if (m_page_count & 63)
+		m_bitmap.back() = make_bitmask<u64>(m_page_count & 63);
+}
+
+
+//-------------------------------------------------
+//  clear - forget every recorded write
+//-------------------------------------------------
+
+void memory_dirty_tracker::clear()
+{
+	std::fill(m_bitmap.begin(), m_bitmap.end(), 0);
+}
+
+
+//-------------------------------------------------
+//  any - is any page dirty?
+//-------------------------------------------------
+
+bool memory_dirty_tracker::any() const
+{
+	for (u64 word : m_bitmap)
+		if (word)
+			return true;
+	return false;
+}
+
+
+//-------------------------------------------------
+//  dirty_pages - list the dirty page numbers
+//-------------------------------------------------
+
+std::vector<u32> memory_dirty_tracker::dirty_pages() const
+{
+	std::vector<u32> result;
+	for (u32 page = 0; page < m_page_count; page++)
+	{
+		// skip clean runs of 64 pages at a time
+		if (!m_bitmap[page >> 6])
+			page |= 63;
+		else if (BIT(m_bitmap[page >> 6], page & 63))
+			result.push_back(page);
+	}
+	return result;
+}
+
+
 //-------------------------------------------------
 //  memory_region - constructor
 //-------------------------------------------------
@@ -1060,12 +1267,39 @@ void memory_bank::configure_entries(int startentry, int numentries, void *base,
 memory_region::memory_region(running_machine &machine, std::string name, u32 length, u8 width, endianness_t endian)
 	: m_machine(machine),
 		m_name(std::move(name)),
-		m_buffer(length),
+		m_large(machine.memory().large_alloc(length)),
+		m_base(nullptr),
+		m_length(length),
 		m_endianness(endian),
 		m_bitwidth(width * 8),
 		m_bytewidth(width)
 {
 	assert(width == 1 || width == 2 || width == 4 || width == 8);
+
+	if (m_large)
+		m_base = reinterpret_cast<u8 *>(m_large->get());
+	else if (length)
+	{
+		m_buffer.resize(length);
+		m_base = &m_buffer[0];
+	}
+}
+
+memory_region::memory_region(running_machine &machine, std::string name, std::unique_ptr<osd::file_mapping> &&mapping, u8 width, endianness_t endian)
+	: m_machine(machine),
+		m_name(std::move(name)),
+		m_mapping(std::move(mapping)),
+		m_base(reinterpret_cast<u8 *>(m_mapping->get())),
+		m_length(u32(m_mapping->size())),
+		m_endianness(endian),
+		m_bitwidth(width * 8),
+		m_bytewidth(width)
+{
+	assert(width == 1 || width == 2 || width == 4 || width == 8);
+}
+
+memory_region::~memory_region()
+{
 }
 
 std::string memory_share::compare(u8 width, size_t bytes, endianness_t endianness) const
@@ -28,6 +28,8 @@ using u32 = std::uint32_t;
 using s64 = std::int64_t;
 using u64 = std::uint64_t;
 
+namespace osd { class large_memory_allocation; class file_mapping; }
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -90,6 +92,7 @@ struct memory_entry {
 	offs_t start, end;
 	class handler_entry *entry;
 	std::vector<memory_entry_context> context;
+	int depth = 0;                              // number of dispatch levels above the handler
 };
 
 
@@ -488,6 +491,8 @@ public:
 	static constexpr u32 F_UNITS       = 0x00000002; // handler that merges/splits an access among multiple handlers (unitmask support)
 	static constexpr u32 F_PASSTHROUGH = 0x00000004; // handler that passes through the request to another handler
 	static constexpr u32 F_VIEW        = 0x00000008; // handler for a view (kinda like dispatch except not entirely)
+	static constexpr u32 F_MEMORY      = 0x00000010; // handler that reads/writes a fixed block of memory (non-banked rom or ram)
+	static constexpr u32 F_DIRTY       = 0x00000020; // memory handler whose writes are recorded by a dirty page tracker
 
 	// Start/end of range flags
 	static constexpr u8 START = 1;
@@ -501,6 +506,8 @@ public:
 		void propagate();
 		void check();
 
+		const std::unordered_set<const handler_entry *> &entries() const { return seen; }
+
 	private:
 		std::unordered_map<const handler_entry *, u32> refcounts;
 		std::unordered_set<const handler_entry *> seen;
@@ -518,6 +525,8 @@ public:
 	inline bool is_view() const { return m_flags & F_VIEW; }
 	inline bool is_units() const { return m_flags & F_UNITS; }
 	inline bool is_passthrough() const { return m_flags & F_PASSTHROUGH; }
+	inline bool is_memory() const { return m_flags & F_MEMORY; }
+	inline bool is_dirty_tracked() const { return m_flags & F_DIRTY; }
 
 	virtual void dump_map(std::vector<memory_entry> &map) const;
 
@@ -708,17 +717,41 @@ class memory_passthrough_handler
 	template<int Width, int AddrShift, endianness_t Endian> friend class handler_entry_read_passthrough;
 	template<int Width, int AddrShift, endianness_t Endian> friend class handler_entry_write_passthrough;
 
+	template<int Level, int Width, int AddrShift, endianness_t Endian> friend class address_space_specific;
+
 public:
-	memory_passthrough_handler(address_space &space) : m_space(space) {}
+	memory_passthrough_handler(address_space &space) : m_space(space), m_enabled(true), m_mode(0), m_addrstart(~offs_t(0)), m_addrend(0) {}
 
 	inline void remove();
 
+	// disabling takes the taps out of the decode tree entirely; they
+	// are kept here and put back when enabled again
+	inline void enable(bool state = true);
+	void disable() { enable(false); }
+	bool enabled() const { return m_enabled; }
+
 private:
 	address_space &m_space;
 	std::unordered_set<handler_entry *> m_handlers;
+	std::vector<std::function<void ()>> m_installs;
+	bool m_enabled;
+
+	// span covered by the taps, so adding or removing them only has to
+	// flush the lookups cached for those pages
+	u32 m_mode;
+	offs_t m_addrstart;
+	offs_t m_addrend;
 
 	void add_handler(handler_entry *handler) { m_handlers.insert(handler); }
 	void remove_handler(handler_entry *handler) { m_handlers.erase(m_handlers.find(handler)); }
+
+	void add_install(std::function<void ()> install) { m_installs.emplace_back(std::move(install)); if(m_enabled) m_installs.back()(); }
+	void add_range(read_or_write mode, offs_t addrstart, offs_t addrend) {
+		m_mode |= u32(mode);
+		m_addrstart = std::min(m_addrstart, addrstart);
+		m_addrend = std::max(m_addrend, addrend);
+	}
+	inline void remove_taps();
 };
 
 // =====================-> Forward declaration for address_space
@@ -1006,6 +1039,29 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void dispatch
 }
 
 
+// ======================> Direct memory pointers
+
+// Returns the host pointer for the native word at start if the range
+// [start, end] is served by a plain memory handler laid out linearly
+// over the whole range, nullptr otherwise
+
+template<int Width, int AddrShift, typename Handler> typename emu::detail::handler_entry_size<Width>::uX *direct_memory_pointer(const Handler *handler, offs_t start, offs_t end)
+{
+	using NativeType = typename emu::detail::handler_entry_size<Width>::uX;
+	static constexpr int NativeShift = Width + AddrShift;
+	if(NativeShift < 0 || !handler || !handler->is_memory() || handler->is_dirty_tracked())
+		return nullptr;
+
+	// mirrors wrap the handler's address mask, so check both ends line up
+	static constexpr u32 NativeMask = NativeShift >= 0 ? make_bitmask<u32>(NativeShift) : 0;
+	NativeType *const first = static_cast<NativeType *>(handler->get_ptr(start & ~NativeMask));
+	NativeType *const last = static_cast<NativeType *>(handler->get_ptr(end & ~NativeMask));
+	if(last - first != std::ptrdiff_t((end - start) >> (NativeShift >= 0 ? NativeShift : 0)))
+		return nullptr;
+	return first;
+}
+
+
 // ======================> memory_access_specific
 
 // memory_access_specific does uncached but faster accesses by shortcutting the address_space virtual call
@@ -1026,59 +1082,186 @@ public:
 		: m_space(nullptr),
 		  m_addrmask(0),
 		  m_dispatch_read(nullptr),
-		  m_dispatch_write(nullptr)
+		  m_dispatch_write(nullptr),
+		  m_root_read(nullptr),
+		  m_root_write(nullptr)
 	{
+		direct_flush(m_direct_read);
+		direct_flush(m_direct_write);
 	}
 
 	inline address_space &space() const {
 		return *m_space;
 	}
 
-	u8 read_byte(offs_t address) { return Width == 0 ? read_native(address & ~NATIVE_MASK) : memory_read_generic<Width, AddrShift, Endian, 0, true>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, 0xff); }
-	u16 read_word(offs_t address) { return Width == 1 ? read_native(address & ~NATIVE_MASK) : memory_read_generic<Width, AddrShift, Endian, 1, true>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, 0xffff); }
-	u16 read_word(offs_t address, u16 mask) { return memory_read_generic<Width, AddrShift, Endian, 1, true>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, mask); }
-	u16 read_word_unaligned(offs_t address) { return memory_read_generic<Width, AddrShift, Endian, 1, false>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, 0xffff); }
-	u16 read_word_unaligned(offs_t address, u16 mask) { return memory_read_generic<Width, AddrShift, Endian, 1, false>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, mask); }
-	u32 read_dword(offs_t address) { return Width == 2 ? read_native(address & ~NATIVE_MASK) : memory_read_generic<Width, AddrShift, Endian, 2, true>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, 0xffffffff); }
-	u32 read_dword(offs_t address, u32 mask) { return memory_read_generic<Width, AddrShift, Endian, 2, true>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, mask); }
-	u32 read_dword_unaligned(offs_t address) { return memory_read_generic<Width, AddrShift, Endian, 2, false>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, 0xffffffff); }
-	u32 read_dword_unaligned(offs_t address, u32 mask) { return memory_read_generic<Width, AddrShift, Endian, 2, false>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, mask); }
-	u64 read_qword(offs_t address) { return Width == 3 ? read_native(address & ~NATIVE_MASK) : memory_read_generic<Width, AddrShift, Endian, 3, true>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, 0xffffffffffffffffU); }
-	u64 read_qword(offs_t address, u64 mask) { return memory_read_generic<Width, AddrShift, Endian, 3, true>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, mask); }
-	u64 read_qword_unaligned(offs_t address) { return memory_read_generic<Width, AddrShift, Endian, 3, false>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, 0xffffffffffffffffU); }
-	u64 read_qword_unaligned(offs_t address, u64 mask) { return memory_read_generic<Width, AddrShift, Endian, 3, false>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, mask); }
-
-	void write_byte(offs_t address, u8 data) { if (Width == 0) write_native(address & ~NATIVE_MASK, data); else memory_write_generic<Width, AddrShift, Endian, 0, true>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, 0xff); }
-	void write_word(offs_t address, u16 data) { if (Width == 1) write_native(address & ~NATIVE_MASK, data); else memory_write_generic<Width, AddrShift, Endian, 1, true>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, 0xffff); }
-	void write_word(offs_t address, u16 data, u16 mask) { memory_write_generic<Width, AddrShift, Endian, 1, true>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, mask); }
-	void write_word_unaligned(offs_t address, u16 data) { memory_write_generic<Width, AddrShift, Endian, 1, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, 0xffff); }
-	void write_word_unaligned(offs_t address, u16 data, u16 mask) { memory_write_generic<Width, AddrShift, Endian, 1, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, mask); }
-	void write_dword(offs_t address, u32 data) { if (Width == 2) write_native(address & ~NATIVE_MASK, data); else memory_write_generic<Width, AddrShift, Endian, 2, true>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, 0xffffffff); }
-	void write_dword(offs_t address, u32 data, u32 mask) { memory_write_generic<Width, AddrShift, Endian, 2, true>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, mask); }
-	void write_dword_unaligned(offs_t address, u32 data) { memory_write_generic<Width, AddrShift, Endian, 2, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, 0xffffffff); }
-	void write_dword_unaligned(offs_t address, u32 data, u32 mask) { memory_write_generic<Width, AddrShift, Endian, 2, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, mask); }
-	void write_qword(offs_t address, u64 data) { if (Width == 3) write_native(address & ~NATIVE_MASK, data); else memory_write_generic<Width, AddrShift, Endian, 3, true>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, 0xffffffffffffffffU); }
-	void write_qword(offs_t address, u64 data, u64 mask) { memory_write_generic<Width, AddrShift, Endian, 3, true>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, mask); }
-	void write_qword_unaligned(offs_t address, u64 data) { memory_write_generic<Width, AddrShift, Endian, 3, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, 0xffffffffffffffffU); }
-	void write_qword_unaligned(offs_t address, u64 data, u64 mask) { memory_write_generic<Width, AddrShift, Endian, 3, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, mask); }
+	u8 read_byte(offs_t address) { return Width == 0 ? read_native(address & ~NATIVE_MASK) : read_split<0, true>(address, 0xff); }
+	u16 read_word(offs_t address) { return Width == 1 ? read_native(address & ~NATIVE_MASK) : read_split<1, true>(address, 0xffff); }
+	u16 read_word(offs_t address, u16 mask) { return read_split<1, true>(address, mask); }
+	u16 read_word_unaligned(offs_t address) { return read_split<1, false>(address, 0xffff); }
+	u16 read_word_unaligned(offs_t address, u16 mask) { return read_split<1, false>(address, mask); }
+	u32 read_dword(offs_t address) { return Width == 2 ? read_native(address & ~NATIVE_MASK) : read_split<2, true>(address, 0xffffffff); }
+	u32 read_dword(offs_t address, u32 mask) { return read_split<2, true>(address, mask); }
+	u32 read_dword_unaligned(offs_t address) { return read_split<2, false>(address, 0xffffffff); }
+	u32 read_dword_unaligned(offs_t address, u32 mask) { return read_split<2, false>(address, mask); }
+	u64 read_qword(offs_t address) { return Width == 3 ? read_native(address & ~NATIVE_MASK) : read_split<3, true>(address, 0xffffffffffffffffU); }
+	u64 read_qword(offs_t address, u64 mask) { return read_split<3, true>(address, mask); }
+	u64 read_qword_unaligned(offs_t address) { return read_split<3, false>(address, 0xffffffffffffffffU); }
+	u64 read_qword_unaligned(offs_t address, u64 mask) { return read_split<3, false>(address, mask); }
+
+	void write_byte(offs_t address, u8 data) { if (Width == 0) write_native(address & ~NATIVE_MASK, data); else write_split<0, true>(address, data, 0xff); }
+	void write_word(offs_t address, u16 data) { if (Width == 1) write_native(address & ~NATIVE_MASK, data); else write_split<1, true>(address, data, 0xffff); }
+	void write_word(offs_t address, u16 data, u16 mask) { write_split<1, true>(address, data, mask); }
+	void write_word_unaligned(offs_t address, u16 data) { write_split<1, false>(address, data, 0xffff); }
+	void write_word_unaligned(offs_t address, u16 data, u16 mask) { write_split<1, false>(address, data, mask); }
+	void write_dword(offs_t address, u32 data) { if (Width == 2) write_native(address & ~NATIVE_MASK, data); else write_split<2, true>(address, data, 0xffffffff); }
+	void write_dword(offs_t address, u32 data, u32 mask) { write_split<2, true>(address, data, mask); }
+	void write_dword_unaligned(offs_t address, u32 data) { write_split<2, false>(address, data, 0xffffffff); }
+	void write_dword_unaligned(offs_t address, u32 data, u32 mask) { write_split<2, false>(address, data, mask); }
+	void write_qword(offs_t address, u64 data) { if (Width == 3) write_native(address & ~NATIVE_MASK, data); else write_split<3, true>(address, data, 0xffffffffffffffffU); }
+	void write_qword(offs_t address, u64 data, u64 mask) { write_split<3, true>(address, data, mask); }
+	void write_qword_unaligned(offs_t address, u64 data) { write_split<3, false>(address, data, 0xffffffffffffffffU); }
+	void write_qword_unaligned(offs_t address, u64 data, u64 mask) { write_split<3, false>(address, data, mask); }
 
 private:
 	address_space *             m_space;
 
 	offs_t                      m_addrmask;                // address mask
 
+	// Direct pointer table, a small direct-mapped software tlb
+	// caching the host address of pages backed by plain memory
+	static constexpr bool DIRECT_ENABLED = Width + AddrShift >= 0;
+	static constexpr int DIRECT_NATIVE_SHIFT = Width + AddrShift >= 0 ? Width + AddrShift : 0;
+	static constexpr int DIRECT_PAGE_BITS = 10;
+	static constexpr offs_t DIRECT_PAGE_MASK = make_bitmask<offs_t>(DIRECT_PAGE_BITS);
+	static constexpr u32 DIRECT_ENTRIES = 256;
+	static constexpr offs_t DIRECT_INVALID = ~offs_t(0);
+
+	struct direct_entry {
+		offs_t page;                            // page number, DIRECT_INVALID if unused
+		NativeType *base;                       // host pointer of the page, nullptr if not plain memory
+	};
+
 	const handler_entry_read<Width, AddrShift, Endian> *const *m_dispatch_read;
 	const handler_entry_write<Width, AddrShift, Endian> *const *m_dispatch_write;
+	const handler_entry_read<Width, AddrShift, Endian> *m_root_read;
+	const handler_entry_write<Width, AddrShift, Endian> *m_root_write;
+
+	direct_entry m_direct_read[DIRECT_ENTRIES];
+	direct_entry m_direct_write[DIRECT_ENTRIES];
 
 	NativeType read_native(offs_t address, NativeType mask = ~NativeType(0)) {
-		return dispatch_read<Level, Width, AddrShift, Endian>(offs_t(-1), address & m_addrmask, mask, m_dispatch_read);;
+		address &= m_addrmask;
+		if(DIRECT_ENABLED) {
+			direct_entry &entry = m_direct_read[(address >> DIRECT_PAGE_BITS) & (DIRECT_ENTRIES - 1)];
+			if(entry.page != address >> DIRECT_PAGE_BITS)
+				direct_fill_read(entry, address);
+			if(entry.base)
+				return entry.base[(address & DIRECT_PAGE_MASK) >> DIRECT_NATIVE_SHIFT];
+		}
+		return dispatch_read<Level, Width, AddrShift, Endian>(offs_t(-1), address, mask, m_dispatch_read);
 	}
 
 	void write_native(offs_t address, NativeType data, NativeType mask = ~NativeType(0)) {
-		dispatch_write<Level, Width, AddrShift, Endian>(offs_t(-1), address & m_addrmask, data, mask, m_dispatch_write);;
+		address &= m_addrmask;
+		if(DIRECT_ENABLED) {
+			direct_entry &entry = m_direct_write[(address >> DIRECT_PAGE_BITS) & (DIRECT_ENTRIES - 1)];
+			if(entry.page != address >> DIRECT_PAGE_BITS)
+				direct_fill_write(entry, address);
+			if(entry.base) {
+				NativeType &slot = entry.base[(address & DIRECT_PAGE_MASK) >> DIRECT_NATIVE_SHIFT];
+				slot = (slot & ~mask) | (data & mask);
+				return;
+			}
+		}
+		dispatch_write<Level, Width, AddrShift, Endian>(offs_t(-1), address, data, mask, m_dispatch_write);
+	}
+
+	static void direct_flush(direct_entry *table) {
+		for(u32 i = 0; i != DIRECT_ENTRIES; i++)
+			table[i] = direct_entry{ DIRECT_INVALID, nullptr };
+	}
+
+	static void direct_flush(direct_entry *table, offs_t addrstart, offs_t addrend) {
+		offs_t const first = addrstart >> DIRECT_PAGE_BITS;
+		offs_t const last = addrend >> DIRECT_PAGE_BITS;
+		if(last - first >= DIRECT_ENTRIES - 1)
+			direct_flush(table);
+		else
+			for(offs_t page = first; page <= last; page++) {
+				direct_entry &entry = table[page & (DIRECT_ENTRIES - 1)];
+				if(entry.page == page)
+					entry = direct_entry{ DIRECT_INVALID, nullptr };
+			}
+	}
+
+	void direct_fill_read(direct_entry &entry, offs_t address);
+	void direct_fill_write(direct_entry &entry, offs_t address);
+
+	// Accesses of any size or alignment that stay inside one page of
+	// plain memory are done as a single host load or store; that needs
+	// a byte-addressed space whose bytes sit in host order
+	static constexpr bool DIRECT_SPAN = DIRECT_ENABLED && AddrShift == 0 && (Endian == ENDIANNESS_NATIVE || Width == 0);
+
+	template<int TargetWidth> static offs_t direct_span_align(offs_t address, bool aligned) {
+		// aligned accesses ignore the low bits the generic path ignores
+		return aligned ? address & ~make_bitmask<offs_t>(TargetWidth < Width ? TargetWidth : Width) : address;
+	}
+
+	template<typename T> static T direct_span_swap(T value) {
+		if constexpr(sizeof(T) == 2)
+			return swapendian_int16(value);
+		else if constexpr(sizeof(T) == 4)
+			return swapendian_int32(value);
+		else if constexpr(sizeof(T) == 8)
+			return swapendian_int64(value);
+		else
+			return value;
+	}
+
+	template<int TargetWidth, bool Aligned> typename handler_entry_size<TargetWidth>::uX read_split(offs_t address, typename handler_entry_size<TargetWidth>::uX mask) {
+		using TargetType = typename handler_entry_size<TargetWidth>::uX;
+		if(DIRECT_SPAN) {
+			offs_t const start = direct_span_align<TargetWidth>(address, Aligned) & m_addrmask;
+			if((start & DIRECT_PAGE_MASK) <= DIRECT_PAGE_MASK + 1 - sizeof(TargetType)) {
+				direct_entry &entry = m_direct_read[(start >> DIRECT_PAGE_BITS) & (DIRECT_ENTRIES - 1)];
+				if(entry.page != start >> DIRECT_PAGE_BITS)
+					direct_fill_read(entry, start);
+				if(entry.base) {
+					TargetType value;
+					memcpy(&value, reinterpret_cast<const u8 *>(entry.base) + (start & DIRECT_PAGE_MASK), sizeof(value));
+					return (Endian != ENDIANNESS_NATIVE) ? direct_span_swap(value) : value;
+				}
+			}
+		}
+		return memory_read_generic<Width, AddrShift, Endian, TargetWidth, Aligned>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, mask);
 	}
 
-	void set(address_space *space, std::pair<const void *, const void *> rw);
+	template<int TargetWidth, bool Aligned> void write_split(offs_t address, typename handler_entry_size<TargetWidth>::uX data, typename handler_entry_size<TargetWidth>::uX mask) {
+		using TargetType = typename handler_entry_size<TargetWidth>::uX;
+		if(DIRECT_SPAN) {
+			offs_t const start = direct_span_align<TargetWidth>(address, Aligned) & m_addrmask;
+			if((start & DIRECT_PAGE_MASK) <= DIRECT_PAGE_MASK + 1 - sizeof(TargetType)) {
+				direct_entry &entry = m_direct_write[(start >> DIRECT_PAGE_BITS) & (DIRECT_ENTRIES - 1)];
+				if(entry.page != start >> DIRECT_PAGE_BITS)
+					direct_fill_write(entry, start);
+				if(entry.base) {
+					u8 *const dest = reinterpret_cast<u8 *>(entry.base) + (start & DIRECT_PAGE_MASK);
+					TargetType value;
+					if(Endian != ENDIANNESS_NATIVE) {
+						data = direct_span_swap(data);
+						mask = direct_span_swap(mask);
+					}
+					memcpy(&value, dest, sizeof(value));
+					value = (value & ~mask) | (data & mask);
+					memcpy(dest, &value, sizeof(value));
+					return;
+				}
+			}
+		}
+		memory_write_generic<Width, AddrShift, Endian, TargetWidth, Aligned>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, mask);
+	}
+
+	void set(address_space *space, std::pair<const void *, const void *> rw, std::pair<const void *, const void *> root);
 };
 
 
@@ -1105,6 +1288,8 @@ public:
 		  m_addrend_w(0),
 		  m_cache_r(nullptr),
 		  m_cache_w(nullptr),
+		  m_direct_r(nullptr),
+		  m_direct_w(nullptr),
 		  m_root_read(nullptr),
 		  m_root_write(nullptr)
 	{
@@ -1117,12 +1302,14 @@ public:
 		if(address >= m_addrstart_r && address <= m_addrend_r)
 			return;
 		m_root_read->lookup(address, m_addrstart_r, m_addrend_r, m_cache_r);
+		m_direct_r = direct_memory_pointer<Width, AddrShift>(m_cache_r, m_addrstart_r, m_addrend_r);
 	}
 
 	void check_address_w(offs_t address) {
 		if(address >= m_addrstart_w && address <= m_addrend_w)
 			return;
 		m_root_write->lookup(address, m_addrstart_w, m_addrend_w, m_cache_w);
+		m_direct_w = direct_memory_pointer<Width, AddrShift>(m_cache_w, m_addrstart_w, m_addrend_w);
 	}
 
 	// accessor methods
@@ -1175,6 +1362,8 @@ private:
 	offs_t                      m_addrend_w;               // maximum valid address for writing
 	handler_entry_read <Width, AddrShift, Endian> *m_cache_r;  // read cache
 	handler_entry_write<Width, AddrShift, Endian> *m_cache_w;  // write cache
+	NativeType *m_direct_r;                                     // host pointer for the read cache range if plain memory
+	NativeType *m_direct_w;                                     // host pointer for the write cache range if plain memory
 
 	handler_entry_read <Width, AddrShift, Endian> *m_root_read;  // decode tree roots
 	handler_entry_write<Width, AddrShift, Endian> *m_root_write;
@@ -1199,6 +1388,75 @@ template<int HighBits, int Width, int AddrShift, endianness_t Endian> struct mem
 
 
 
+// ======================> memory_access_handle
+
+// accessor for a space whose geometry is only known at runtime, such as the
+// bus a DMA controller or video fetcher was configured to work on; wraps a
+// cache or specific, so it follows remaps the same way, at the cost of a
+// virtual call per access instead of a full decode tree walk
+class memory_access_handle
+{
+public:
+	virtual ~memory_access_handle() = default;
+
+	address_space &space() const { return m_space; }
+
+	virtual u8 read_byte(offs_t address) = 0;
+	virtual u16 read_word(offs_t address) = 0;
+	virtual u16 read_word(offs_t address, u16 mask) = 0;
+	virtual u32 read_dword(offs_t address) = 0;
+	virtual u32 read_dword(offs_t address, u32 mask) = 0;
+	virtual u64 read_qword(offs_t address) = 0;
+	virtual u64 read_qword(offs_t address, u64 mask) = 0;
+
+	virtual void write_byte(offs_t address, u8 data) = 0;
+	virtual void write_word(offs_t address, u16 data) = 0;
+	virtual void write_word(offs_t address, u16 data, u16 mask) = 0;
+	virtual void write_dword(offs_t address, u32 data) = 0;
+	virtual void write_dword(offs_t address, u32 data, u32 mask) = 0;
+	virtual void write_qword(offs_t address, u64 data) = 0;
+	virtual void write_qword(offs_t address, u64 data, u64 mask) = 0;
+
+protected:
+	memory_access_handle(address_space &space) : m_space(space) { }
+
+private:
+	address_space &m_space;
+};
+
+namespace emu::detail {
+
+template<typename Access> class memory_access_handle_impl : public memory_access_handle
+{
+public:
+	memory_access_handle_impl(address_space &space) : memory_access_handle(space) { }
+
+	Access &access() { return m_access; }
+
+	u8 read_byte(offs_t address) override { return m_access.read_byte(address); }
+	u16 read_word(offs_t address) override { return m_access.read_word(address); }
+	u16 read_word(offs_t address, u16 mask) override { return m_access.read_word(address, mask); }
+	u32 read_dword(offs_t address) override { return m_access.read_dword(address); }
+	u32 read_dword(offs_t address, u32 mask) override { return m_access.read_dword(address, mask); }
+	u64 read_qword(offs_t address) override { return m_access.read_qword(address); }
+	u64 read_qword(offs_t address, u64 mask) override { return m_access.read_qword(address, mask); }
+
+	void write_byte(offs_t address, u8 data) override { m_access.write_byte(address, data); }
+	void write_word(offs_t address, u16 data) override { m_access.write_word(address, data); }
+	void write_word(offs_t address, u16 data, u16 mask) override { m_access.write_word(address, data, mask); }
+	void write_dword(offs_t address, u32 data) override { m_access.write_dword(address, data); }
+	void write_dword(offs_t address, u32 data, u32 mask) override { m_access.write_dword(address, data, mask); }
+	void write_qword(offs_t address, u64 data) override { m_access.write_qword(address, data); }
+	void write_qword(offs_t address, u64 data, u64 mask) override { m_access.write_qword(address, data, mask); }
+
+private:
+	Access m_access;
+};
+
+} // namespace emu::detail
+
+
+
 // ======================> address_space_config
 
 // describes an address space and provides basic functions to map addresses to bytes
@@ -1546,6 +1804,11 @@ class address_space : public address_space_installer
 		int m_id;
 	};
 
+	struct lookup_notifier_t {
+		std::function<void (read_or_write, offs_t, offs_t)> m_notifier;
+		int m_id;
+	};
+
 protected:
 	// construction/destruction
 	address_space(memory_manager &manager, device_memory_interface &memory, int spacenum);
@@ -1554,6 +1817,7 @@ public:
 	virtual ~address_space();
 
 	// getters
+	memory_manager &manager() const { return m_manager; }
 	device_t &device() const { return m_device; }
 	const char *name() const { return m_name; }
 	int spacenum() const { return m_spacenum; }
@@ -1582,12 +1846,24 @@ public:
 			fatalerror("Requesting spefific() with endianness %s while the config says %s\n",
 					   endianness_names[Endian], endianness_names[m_config.endianness()]);
 
-		v.set(this, get_specific_info());
+		v.set(this, get_specific_info(), get_cache_info());
 	}
 
+	// persistent accessors owned by the space, for devices that can't name
+	// the cache/specific type at compile time; each call makes a new one
+	virtual memory_access_handle &cache_handle() = 0;
+	virtual memory_access_handle &specific_handle() = 0;
+
+	// change notifiers are not told about taps: a tap sits on top of the
+	// handlers already there, so nothing installed elsewhere needs redoing
 	int add_change_notifier(std::function<void (read_or_write)> n);
 	void remove_change_notifier(int id);
 
+	// lookup notifiers are also told about decode changes that don't alter
+	// the handler tree itself (view switches, taps), with the affected range
+	int add_lookup_notifier(std::function<void (read_or_write, offs_t, offs_t)> n);
+	void remove_lookup_notifier(int id);
+
 	void invalidate_caches(read_or_write mode) {
 		if(u32(mode) & ~m_in_notification) {
 			u32 old = m_in_notification;
@@ -1596,6 +1872,12 @@ public:
 				n.m_notifier(mode);
 			m_in_notification = old;
 		}
+		invalidate_lookups(mode, 0, m_addrmask);
+	}
+
+	void invalidate_lookups(read_or_write mode, offs_t addrstart, offs_t addrend) {
+		for(const auto &n : m_lookup_notifiers)
+			n.m_notifier(mode, addrstart, addrend);
 	}
 
 	virtual void validate_reference_counts() const = 0;
@@ -1609,6 +1891,11 @@ public:
 	// debug helpers
 	virtual std::string get_handler_string(read_or_write readorwrite, offs_t byteaddress) const = 0;
 	virtual void dump_maps(std::vector<memory_entry> &read_map, std::vector<memory_entry> &write_map) const = 0;
+	std::string map_report() const;
+
+	// reattach dirty trackers to every plain memory write handler of the
+	// space, views included, and drop the direct paths that would bypass them
+	virtual void dirty_refresh() = 0;
 	bool log_unmap() const { return m_log_unmap; }
 	void set_log_unmap(bool log) { m_log_unmap = log; }
 
@@ -1647,6 +1934,12 @@ public:
 	virtual void write_qword_unaligned(offs_t address, u64 data) = 0;
 	virtual void write_qword_unaligned(offs_t address, u64 data, u64 mask) = 0;
 
+	// block accessors, transferring count native-width words (host order)
+	// from consecutive addresses; plain memory ranges are copied directly
+	// and other handlers are resolved once per range, then called per word
+	virtual void read_block(offs_t address, void *buffer, u32 count) = 0;
+	virtual void write_block(offs_t address, const void *buffer, u32 count) = 0;
+
 	// setup
 	void prepare_map();
 	void prepare_device_map(address_map &map);
@@ -1682,8 +1975,10 @@ protected:
 	handler_entry           *m_nop_w;
 
 	std::vector<std::unique_ptr<memory_passthrough_handler>> m_mphs;
+	std::vector<std::unique_ptr<memory_access_handle>> m_handles;
 
 	std::vector<notifier_t> m_notifiers;        // notifier list for address map change
+	std::vector<lookup_notifier_t> m_lookup_notifiers; // notifier list for cached lookups (accessors)
 	int                     m_notifier_id;      // next notifier id
 	u32                     m_in_notification;  // notification(s) currently being done
 };
@@ -1724,6 +2019,51 @@ private:
 };
 
 
+// ======================> memory_dirty_tracker
+
+// a bitmap of the pages of a block of RAM that were written through the
+// memory system since it was last cleared; direct pointer writes (CPU cores
+// keeping their own pointers, DRC code, drivers poking a share) aren't seen
+class memory_dirty_tracker
+{
+	DISABLE_COPYING(memory_dirty_tracker);
+public:
+	// construction/destruction
+	memory_dirty_tracker(void *base, size_t bytes, u32 page_bytes);
+
+	// getters
+	void *base() const { return m_base; }
+	size_t bytes() const { return m_bytes; }
+	u32 page_bytes() const { return 1 << m_page_shift; }
+	u32 page_count() const { return m_page_count; }
+	bool covers(const void *ptr) const { return size_t(reinterpret_cast<const u8 *>(ptr) - m_base) < m_bytes; }
+
+	// recording
+	void mark(const void *ptr) {
+		size_t const offset = reinterpret_cast<const u8 *>(ptr) - m_base;
+		if(offset < m_bytes) {
+			size_t const page = offset >> m_page_shift;
+			m_bitmap[page >> 6] |= u64(1) << (page & 63);
+		}
+	}
+	void mark_all();
+	void clear();
+
+	// queries
+	bool is_dirty(u32 page) const { return page < m_page_count && BIT(m_bitmap[page >> 6], page & 63); }
+	bool any() const;
+	std::vector<u32> dirty_pages() const;
+	const std::vector<u64> &bitmap() const { return m_bitmap; }
+
+private:
+	u8 *                    m_base;                 // start of the tracked block
+	size_t                  m_bytes;                // size of the tracked block
+	u32                     m_page_shift;           // log2 of the page size
+	u32                     m_page_count;           // number of pages
+	std::vector<u64>        m_bitmap;               // one bit per page
+};
+
+
 // ======================> memory_share
 
 // a memory share contains information about shared memory region
@@ -1771,12 +2111,14 @@ class memory_region
 public:
 	// construction/destruction
 	memory_region(running_machine &machine, std::string name, u32 length, u8 width, endianness_t endian);
+	memory_region(running_machine &machine, std::string name, std::unique_ptr<osd::file_mapping> &&mapping, u8 width, endianness_t endian);
+	~memory_region();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
-	u8 *base() { return (m_buffer.size() > 0) ? &m_buffer[0] : nullptr; }
-	u8 *end() { return base() + m_buffer.size(); }
-	u32 bytes() const { return m_buffer.size(); }
+	u8 *base() { return m_base; }
+	u8 *end() { return base() + m_length; }
+	u32 bytes() const { return m_length; }
 	const std::string &name() const { return m_name; }
 
 	// flag expansion
@@ -1785,7 +2127,7 @@ public:
 	u8 bytewidth() const { return m_bytewidth; }
 
 	// data access
-	u8 &as_u8(offs_t offset = 0) { return m_buffer[offset]; }
+	u8 &as_u8(offs_t offset = 0) { return m_base[offset]; }
 	u16 &as_u16(offs_t offset = 0) { return reinterpret_cast<u16 *>(base())[offset]; }
 	u32 &as_u32(offs_t offset = 0) { return reinterpret_cast<u32 *>(base())[offset]; }
 	u64 &as_u64(offs_t offset = 0) { return reinterpret_cast<u64 *>(base())[offset]; }
@@ -1795,6 +2137,10 @@ private:
 	running_machine &       m_machine;
 	std::string             m_name;
 	std::vector<u8>         m_buffer;
+	std::unique_ptr<osd::large_memory_allocation> m_large;
+	std::unique_ptr<osd::file_mapping> m_mapping;
+	u8 *                    m_base;
+	u32                     m_length;
 	endianness_t            m_endianness;
 	u8                      m_bitwidth;
 	u8                      m_bytewidth;
@@ -1862,6 +2208,7 @@ private:
 	const address_space_config *                    m_config;
 	offs_t                                          m_addrstart;
 	offs_t                                          m_addrend;
+	offs_t                                          m_addrmirror;
 	address_space *                                 m_space;
 	handler_entry *                                 m_handler_read;
 	handler_entry *                                 m_handler_write;
@@ -1874,6 +2221,7 @@ private:
 	void make_subdispatch(std::string context);
 	int id_to_slot(int id) const;
 	void register_state();
+	void invalidate_lookups();
 };
 
 
@@ -1893,6 +2241,9 @@ public:
 	// initialize the memory spaces from the memory maps of the devices
 	void initialize();
 
+	// write the decode tree statistics of every address space to a file
+	void write_map_report(const char *filename) const;
+
 	// getters
 	running_machine &machine() const { return m_machine; }
 
@@ -1914,9 +2265,19 @@ public:
 
 	// regions
 	memory_region *region_alloc(std::string name, u32 length, u8 width, endianness_t endian);
+	memory_region *region_alloc(std::string name, std::unique_ptr<osd::file_mapping> &&mapping, u8 width, endianness_t endian);
 	memory_region *region_find(std::string name);
 	void region_free(std::string name);
 
+	// dirty page tracking of RAM written through the memory system
+	memory_dirty_tracker &dirty_track(void *base, size_t bytes, u32 page_bytes = 4096);
+	memory_dirty_tracker &dirty_track(memory_share &share, u32 page_bytes = 4096) { return dirty_track(share.ptr(), share.bytes(), page_bytes); }
+	void dirty_untrack(memory_dirty_tracker &tracker);
+	memory_dirty_tracker *dirty_tracker(const void *ptr) const;
+
+	// large blocks, backed by huge pages when -largepages allows it
+	std::unique_ptr<osd::large_memory_allocation> large_alloc(size_t bytes);
+
 private:
 	struct stdlib_deleter { void operator()(void *p) const { free(p); } };
 
@@ -1924,6 +2285,8 @@ private:
 	running_machine &           m_machine;              // reference to the machine
 
 	std::vector<std::unique_ptr<void, stdlib_deleter>>               m_datablocks;           // list of memory blocks to free on exit
+	std::vector<std::unique_ptr<osd::large_memory_allocation>>       m_largeblocks;          // list of large-page blocks to free on exit
+	std::vector<std::unique_ptr<memory_dirty_tracker>>               m_dirty_trackers;       // list of dirty page trackers
 	std::unordered_map<std::string, std::unique_ptr<memory_bank>>    m_banklist;             // map of banks
 	std::unordered_map<std::string, std::unique_ptr<memory_share>>   m_sharelist;            // map of shares
 	std::unordered_map<std::string, std::unique_ptr<memory_region>>  m_regionlist;           // map of memory regions
@@ -1931,6 +2294,9 @@ private:
 	// Allocate the address spaces
 	void allocate(device_memory_interface &memory);
 
+	// Reattach the dirty trackers in every address space
+	void dirty_refresh();
+
 	// Allocate some ram and register it for saving
 	void *allocate_memory(device_t &dev, int spacenum, std::string name, u8 width, size_t bytes);
 };
@@ -2003,6 +2369,8 @@ read_native(offs_t address, typename emu::detail::handler_entry_size<Width>::uX
 {
 	address &= m_addrmask;
 	check_address_r(address);
+	if(m_direct_r)
+		return m_direct_r[(address - m_addrstart_r) >> (Width + AddrShift >= 0 ? Width + AddrShift : 0)];
 	return m_cache_r->read(address, mask);
 }
 
@@ -2012,23 +2380,93 @@ write_native(offs_t address, typename emu::detail::handler_entry_size<Width>::uX
 {
 	address &= m_addrmask;
 	check_address_w(address);
+	if(m_direct_w) {
+		NativeType &slot = m_direct_w[(address - m_addrstart_w) >> (Width + AddrShift >= 0 ? Width + AddrShift : 0)];
+		slot = (slot & ~mask) | (data & mask);
+		return;
+	}
 	m_cache_w->write(address, data, mask);
 }
 
-void memory_passthrough_handler::remove()
+void memory_passthrough_handler::remove_taps()
 {
 	m_space.remove_passthrough(m_handlers);
+	if(m_mode)
+		m_space.invalidate_lookups(read_or_write(m_mode), m_addrstart, m_addrend);
+}
+
+void memory_passthrough_handler::remove()
+{
+	remove_taps();
+	m_installs.clear();
+	m_enabled = true;
+	m_mode = 0;
+	m_addrstart = ~offs_t(0);
+	m_addrend = 0;
+}
+
+void memory_passthrough_handler::enable(bool state)
+{
+	if(state == m_enabled)
+		return;
+	m_enabled = state;
+	if(state)
+		for(const auto &install : m_installs)
+			install();
+	else
+		remove_taps();
 }
 
 
 template<int Level, int Width, int AddrShift, endianness_t Endian>
 void emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
-set(address_space *space, std::pair<const void *, const void *> rw)
+set(address_space *space, std::pair<const void *, const void *> rw, std::pair<const void *, const void *> root)
 {
 	m_space = space;
 	m_addrmask = space->addrmask();
+
+	space->add_lookup_notifier([this](read_or_write mode, offs_t addrstart, offs_t addrend) {
+								   if(u32(mode) & u32(read_or_write::READ))
+									   direct_flush(m_direct_read, addrstart, addrend);
+								   if(u32(mode) & u32(read_or_write::WRITE))
+									   direct_flush(m_direct_write, addrstart, addrend);
+							   });
 	m_dispatch_read  = (const handler_entry_read <Width, AddrShift, Endian> *const *)(rw.first);
 	m_dispatch_write = (const handler_entry_write<Width, AddrShift, Endian> *const *)(rw.second);
+	m_root_read  = (const handler_entry_read <Width, AddrShift, Endian> *)(root.first);
+	m_root_write = (const handler_entry_write<Width, AddrShift, Endian> *)(root.second);
+
+	direct_flush(m_direct_read);
+	direct_flush(m_direct_write);
+}
+
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+void emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+direct_fill_read(direct_entry &entry, offs_t address)
+{
+	// the page only goes direct if a single memory handler covers all of it
+	offs_t const pagestart = address & ~DIRECT_PAGE_MASK;
+	offs_t const pageend = pagestart | DIRECT_PAGE_MASK;
+	offs_t start, end;
+	handler_entry_read<Width, AddrShift, Endian> *handler;
+	m_root_read->lookup(address, start, end, handler);
+	entry.page = address >> DIRECT_PAGE_BITS;
+	entry.base = (start <= pagestart && end >= pageend) ? direct_memory_pointer<Width, AddrShift>(handler, pagestart, pageend) : nullptr;
+}
+
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+void emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+direct_fill_write(direct_entry &entry, offs_t address)
+{
+	offs_t const pagestart = address & ~DIRECT_PAGE_MASK;
+	offs_t const pageend = pagestart | DIRECT_PAGE_MASK;
+	offs_t start, end;
+	handler_entry_write<Width, AddrShift, Endian> *handler;
+	m_root_write->lookup(address, start, end, handler);
+	entry.page = address >> DIRECT_PAGE_BITS;
+	entry.base = (start <= pagestart && end >= pageend) ? direct_memory_pointer<Width, AddrShift>(handler, pagestart, pageend) : nullptr;
 }
 
 
@@ -2039,16 +2477,18 @@ set(address_space *space, std::pair<void *, void *> rw)
 	m_space = space;
 	m_addrmask = space->addrmask();
 
-	space->add_change_notifier([this](read_or_write mode) {
-								   if(u32(mode) & u32(read_or_write::READ)) {
+	space->add_lookup_notifier([this](read_or_write mode, offs_t addrstart, offs_t addrend) {
+								   if((u32(mode) & u32(read_or_write::READ)) && m_addrstart_r <= addrend && m_addrend_r >= addrstart) {
 									   m_addrend_r = 0;
 									   m_addrstart_r = 1;
 									   m_cache_r = nullptr;
+									   m_direct_r = nullptr;
 								   }
-								   if(u32(mode) & u32(read_or_write::WRITE)) {
+								   if((u32(mode) & u32(read_or_write::WRITE)) && m_addrstart_w <= addrend && m_addrend_w >= addrstart) {
 									   m_addrend_w = 0;
 									   m_addrstart_w = 1;
 									   m_cache_w = nullptr;
+									   m_direct_w = nullptr;
 								   }
 							   });
 	m_root_read  = (handler_entry_read <Width, AddrShift, Endian> *)(rw.first);
@@ -2058,9 +2498,11 @@ set(address_space *space, std::pair<void *, void *> rw)
 	m_addrstart_r = 1;
 	m_addrend_r = 0;
 	m_cache_r = nullptr;
+	m_direct_r = nullptr;
 	m_addrstart_w = 1;
 	m_addrend_w = 0;
 	m_cache_w = nullptr;
+	m_direct_w = nullptr;
 }
 
 template<int Width, int AddrShift, endianness_t Endian>
@@ -10,6 +10,7 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include <algorithm>
 #include <list>
 #include <map>
 #include "emuopts.h"
@@ -130,6 +131,7 @@ public:
 
 	std::string get_handler_string(read_or_write readorwrite, offs_t byteaddress) const override;
 	void dump_maps(std::vector<memory_entry> &read_map, std::vector<memory_entry> &write_map) const override;
+	void dirty_refresh() override;
 
 	void unmap_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, read_or_write readorwrite, bool quiet) override;
 	void install_ram_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, read_or_write readorwrite, void *baseptr) override;
@@ -386,9 +388,10 @@ public:
 	}
 
 	virtual void remove_passthrough(std::unordered_set<handler_entry *> &handlers) override {
-		invalidate_caches(read_or_write::READWRITE);
+		g_profiler.start(PROFILER_MEM_REMAP);
 		m_root_read->detach(handlers);
 		m_root_write->detach(handlers);
+		g_profiler.stop();
 	}
 
 	// generate accessor table
@@ -422,6 +425,73 @@ public:
 		return m_root_write->get_ptr(address);
 	}
 
+	// accessor handles for devices that only know the geometry at runtime
+	memory_access_handle &cache_handle() override
+	{
+		auto handle = std::make_unique<emu::detail::memory_access_handle_impl<emu::detail::memory_access_cache<Width, AddrShift, Endian>>>(*this);
+		cache(handle->access());
+		return *m_handles.emplace_back(std::move(handle));
+	}
+
+	memory_access_handle &specific_handle() override
+	{
+		auto handle = std::make_unique<emu::detail::memory_access_handle_impl<emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>>>(*this);
+		specific(handle->access());
+		return *m_handles.emplace_back(std::move(handle));
+	}
+
+	// block read, resolving the handler once per range and copying plain memory directly
+	void read_block(offs_t address, void *buffer, u32 count) override
+	{
+		constexpr offs_t step = NATIVE_STEP ? NATIVE_STEP : 1;
+		NativeType *dest = static_cast<NativeType *>(buffer);
+		address &= m_addrmask & ~NATIVE_MASK;
+		while (count)
+		{
+			offs_t start, end;
+			handler_entry_read<Width, AddrShift, Endian> *handler;
+			m_root_read->lookup(address, start, end, handler);
+
+			u32 const chunk = u32(std::min<u64>(count, u64(end - address) / step + 1));
+			NativeType const *const src = direct_memory_pointer<Width, AddrShift>(handler, address, address + (chunk - 1) * step);
+			if (src)
+				std::copy_n(src, chunk, dest);
+			else
+				for (u32 i = 0; i != chunk; i++)
+					dest[i] = handler->read(address + i * step, ~NativeType(0));
+
+			dest += chunk;
+			count -= chunk;
+			address = (address + chunk * step) & m_addrmask;
+		}
+	}
+
+	// block write, resolving the handler once per range and copying plain memory directly
+	void write_block(offs_t address, const void *buffer, u32 count) override
+	{
+		constexpr offs_t step = NATIVE_STEP ? NATIVE_STEP : 1;
+		NativeType const *src = static_cast<NativeType const *>(buffer);
+		address &= m_addrmask & ~NATIVE_MASK;
+		while (count)
+		{
+			offs_t start, end;
+			handler_entry_write<Width, AddrShift, Endian> *handler;
+			m_root_write->lookup(address, start, end, handler);
+
+			u32 const chunk = u32(std::min<u64>(count, u64(end - address) / step + 1));
+			NativeType *const dest = direct_memory_pointer<Width, AddrShift>(handler, address, address + (chunk - 1) * step);
+			if (dest)
+				std::copy_n(src, chunk, dest);
+			else
+				for (u32 i = 0; i != chunk; i++)
+					handler->write(address + i * step, src[i], ~NativeType(0));
+
+			src += chunk;
+			count -= chunk;
+			address = (address + chunk * step) & m_addrmask;
+		}
+	}
+
 	// native read
 	NativeType read_native(offs_t offset, NativeType mask)
 	{
@@ -552,6 +622,7 @@ private:
 			u64 nunitmask;
 			int ncswidth;
 			check_optimize_all("install_read_handler", 8 << AccessWidth, addrstart, addrend, addrmask, addrmirror, addrselect, unitmask, cswidth, nstart, nend, nmask, nmirror, nunitmask, ncswidth);
+			g_profiler.start(PROFILER_MEM_REMAP);
 
 			if constexpr (Width == AccessWidth) {
 				auto hand_r = new handler_entry_read_delegate<Width, AddrShift, Endian, READ>(this, handler_r);
@@ -565,6 +636,7 @@ private:
 				hand_r->unref();
 			}
 			invalidate_caches(read_or_write::READ);
+			g_profiler.stop();
 		}
 	}
 
@@ -585,6 +657,7 @@ private:
 			u64 nunitmask;
 			int ncswidth;
 			check_optimize_all("install_write_handler", 8 << AccessWidth, addrstart, addrend, addrmask, addrmirror, addrselect, unitmask, cswidth, nstart, nend, nmask, nmirror, nunitmask, ncswidth);
+			g_profiler.start(PROFILER_MEM_REMAP);
 
 			if constexpr (Width == AccessWidth) {
 				auto hand_w = new handler_entry_write_delegate<Width, AddrShift, Endian, WRITE>(this, handler_w);
@@ -598,6 +671,7 @@ private:
 				hand_w->unref();
 			}
 			invalidate_caches(read_or_write::WRITE);
+			g_profiler.stop();
 		}
 	}
 
@@ -619,6 +693,7 @@ private:
 			u64 nunitmask;
 			int ncswidth;
 			check_optimize_all("install_readwrite_handler", 8 << AccessWidth, addrstart, addrend, addrmask, addrmirror, addrselect, unitmask, cswidth, nstart, nend, nmask, nmirror, nunitmask, ncswidth);
+			g_profiler.start(PROFILER_MEM_REMAP);
 
 			if constexpr (Width == AccessWidth) {
 				auto hand_r = new handler_entry_read_delegate <Width, AddrShift, Endian, READ>(this, handler_r);
@@ -642,6 +717,7 @@ private:
 				hand_w->unref();
 			}
 			invalidate_caches(read_or_write::READWRITE);
+			g_profiler.stop();
 		}
 	}
 };
@@ -967,6 +1043,27 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 }
 
 
+//-------------------------------------------------
+//  dirty_refresh - give every plain memory write
+//  handler reachable from the root, inactive view
+//  slots included, the tracker covering its block
+//-------------------------------------------------
+
+template<int Level, int Width, int AddrShift, endianness_t Endian> void address_space_specific<Level, Width, AddrShift, Endian>::dirty_refresh()
+{
+	handler_entry::reflist refs;
+	refs.add(m_root_write);
+	refs.propagate();
+	for (const handler_entry *entry : refs.entries())
+		if (entry->is_memory())
+			if (auto *const hand_w = dynamic_cast<handler_entry_write_memory<Width, AddrShift, Endian> *>(const_cast<handler_entry *>(entry)))
+				hand_w->set_dirty_tracker(m_manager.dirty_tracker(hand_w->base()));
+
+	// the direct tables may hold pointers into blocks that are now tracked
+	invalidate_caches(read_or_write::WRITE);
+}
+
+
 //**************************************************************************
 //  DYNAMIC ADDRESS SPACE MAPPING
 //**************************************************************************
@@ -985,6 +1082,7 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 
 	offs_t nstart, nend, nmask, nmirror;
 	check_optimize_mirror("unmap_generic", addrstart, addrend, addrmirror, nstart, nend, nmask, nmirror);
+	g_profiler.start(PROFILER_MEM_REMAP);
 
 	// read space
 	if (readorwrite == read_or_write::READ || readorwrite == read_or_write::READWRITE) {
@@ -1001,6 +1099,7 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 	}
 
 	invalidate_caches(readorwrite);
+	g_profiler.stop();
 }
 
 //-------------------------------------------------
@@ -1011,10 +1110,14 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 	offs_t nstart, nend, nmask, nmirror;
 	check_optimize_mirror("install_view", addrstart, addrend, addrmirror, nstart, nend, nmask, nmirror);
 
+	g_profiler.start(PROFILER_MEM_REMAP);
 	auto handlers = view.make_handlers(*this, addrstart, addrend);
+	view.m_addrmirror = nmirror;
 	m_root_read ->populate(nstart, nend, nmirror, static_cast<handler_entry_read <Width, AddrShift, Endian> *>(handlers.first));
 	m_root_write->populate(nstart, nend, nmirror, static_cast<handler_entry_write<Width, AddrShift, Endian> *>(handlers.second));
 	view.make_subdispatch(""); // Must be called after populate
+	invalidate_caches(read_or_write::READWRITE);
+	g_profiler.stop();
 }
 
 memory_passthrough_handler *address_space::make_mph()
@@ -1034,11 +1137,17 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> memory_passth
 	if (!mph)
 		mph = make_mph();
 
-	auto handler = new handler_entry_read_tap<Width, AddrShift, Endian>(this, *mph, name, tap);
-	m_root_read->populate_passthrough(nstart, nend, nmirror, handler);
-	handler->unref();
+	// the passthrough handler keeps the install so it can be redone after a disable
+	mph->add_install([this, nstart, nend, nmirror, name, tap, mph]() {
+		g_profiler.start(PROFILER_MEM_REMAP);
+		auto handler = new handler_entry_read_tap<Width, AddrShift, Endian>(this, *mph, name, tap);
+		m_root_read->populate_passthrough(nstart, nend, nmirror, handler);
+		handler->unref();
 
-	invalidate_caches(read_or_write::READ);
+		mph->add_range(read_or_write::READ, nstart, nend | nmirror);
+		invalidate_lookups(read_or_write::READ, nstart, nend | nmirror);
+		g_profiler.stop();
+	});
 
 	return mph;
 }
@@ -1054,11 +1163,16 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> memory_passth
 	if (!mph)
 		mph = make_mph();
 
-	auto handler = new handler_entry_write_tap<Width, AddrShift, Endian>(this, *mph, name, tap);
-	m_root_write->populate_passthrough(nstart, nend, nmirror, handler);
-	handler->unref();
+	mph->add_install([this, nstart, nend, nmirror, name, tap, mph]() {
+		g_profiler.start(PROFILER_MEM_REMAP);
+		auto handler = new handler_entry_write_tap<Width, AddrShift, Endian>(this, *mph, name, tap);
+		m_root_write->populate_passthrough(nstart, nend, nmirror, handler);
+		handler->unref();
 
-	invalidate_caches(read_or_write::WRITE);
+		mph->add_range(read_or_write::WRITE, nstart, nend | nmirror);
+		invalidate_lookups(read_or_write::WRITE, nstart, nend | nmirror);
+		g_profiler.stop();
+	});
 
 	return mph;
 }
@@ -1073,15 +1187,20 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> memory_passth
 	if (!mph)
 		mph = make_mph();
 
-	auto rhandler = new handler_entry_read_tap <Width, AddrShift, Endian>(this, *mph, name, tapr);
-	m_root_read ->populate_passthrough(nstart, nend, nmirror, rhandler);
-	rhandler->unref();
+	mph->add_install([this, nstart, nend, nmirror, name, tapr, tapw, mph]() {
+		g_profiler.start(PROFILER_MEM_REMAP);
+		auto rhandler = new handler_entry_read_tap <Width, AddrShift, Endian>(this, *mph, name, tapr);
+		m_root_read ->populate_passthrough(nstart, nend, nmirror, rhandler);
+		rhandler->unref();
 
-	auto whandler = new handler_entry_write_tap<Width, AddrShift, Endian>(this, *mph, name, tapw);
-	m_root_write->populate_passthrough(nstart, nend, nmirror, whandler);
-	whandler->unref();
+		auto whandler = new handler_entry_write_tap<Width, AddrShift, Endian>(this, *mph, name, tapw);
+		m_root_write->populate_passthrough(nstart, nend, nmirror, whandler);
+		whandler->unref();
 
-	invalidate_caches(read_or_write::READWRITE);
+		mph->add_range(read_or_write::READWRITE, nstart, nend | nmirror);
+		invalidate_lookups(read_or_write::READWRITE, nstart, nend | nmirror);
+		g_profiler.stop();
+	});
 
 	return mph;
 }
@@ -1120,6 +1239,7 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 
 	offs_t nstart, nend, nmask, nmirror;
 	check_optimize_mirror("install_readwrite_port", addrstart, addrend, addrmirror, nstart, nend, nmask, nmirror);
+	g_profiler.start(PROFILER_MEM_REMAP);
 
 	// read handler
 	if (rtag != "")
@@ -1147,6 +1267,7 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 	}
 
 	invalidate_caches(rtag != "" ? wtag != "" ? read_or_write::READWRITE : read_or_write::READ : read_or_write::WRITE);
+	g_profiler.stop();
 }
 
 
@@ -1164,6 +1285,7 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 
 	offs_t nstart, nend, nmask, nmirror;
 	check_optimize_mirror("install_bank_generic", addrstart, addrend, addrmirror, nstart, nend, nmask, nmirror);
+	g_profiler.start(PROFILER_MEM_REMAP);
 
 	// map the read bank
 	if (rbank != nullptr)
@@ -1182,6 +1304,7 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 	}
 
 	invalidate_caches(rbank ? wbank ? read_or_write::READWRITE : read_or_write::READ : read_or_write::WRITE);
+	g_profiler.stop();
 }
 
 
@@ -1200,6 +1323,7 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 
 	offs_t nstart, nend, nmask, nmirror;
 	check_optimize_mirror("install_ram_generic", addrstart, addrend, addrmirror, nstart, nend, nmask, nmirror);
+	g_profiler.start(PROFILER_MEM_REMAP);
 
 	// map for read
 	if (readorwrite == read_or_write::READ || readorwrite == read_or_write::READWRITE)
@@ -1218,6 +1342,7 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 	}
 
 	invalidate_caches(readorwrite);
+	g_profiler.stop();
 }
 
 //**************************************************************************
@@ -1240,3 +1365,83 @@ void address_space::remove_change_notifier(int id)
 		}
 	fatalerror("Unknown notifier id %d, double remove?\n", id);
 }
+
+int address_space::add_lookup_notifier(std::function<void (read_or_write, offs_t, offs_t)> n)
+{
+	int id = m_notifier_id++;
+	m_lookup_notifiers.emplace_back(lookup_notifier_t{ std::move(n), id });
+	return id;
+}
+
+void address_space::remove_lookup_notifier(int id)
+{
+	for(auto i = m_lookup_notifiers.begin(); i != m_lookup_notifiers.end(); i++)
+		if (i->m_id == id) {
+			m_lookup_notifiers.erase(i);
+			return;
+		}
+	fatalerror("Unknown lookup notifier id %d, double remove?\n", id);
+}
+
+
+//-------------------------------------------------
+//  map_report - describe how the decode trees of
+//  this space ended up, and which ranges can't
+//  take the fast paths
+//-------------------------------------------------
+
+std::string address_space::map_report() const
+{
+	static constexpr int MAX_SLOW_RANGES = 32;
+
+	std::vector<memory_entry> entries[2];
+	dump_maps(entries[0], entries[1]);
+
+	int const nc = m_config.is_octal() ? (m_config.addr_width() + 2) / 3 : (m_config.addr_width() + 3) / 4;
+	auto const range = [this, nc] (const memory_entry &entry)
+	{
+		return m_config.is_octal()
+				? util::string_format("%0*o-%0*o", nc, entry.start, nc, entry.end)
+				: util::string_format("%0*x-%0*x", nc, entry.start, nc, entry.end);
+	};
+
+	std::string result = util::string_format("device %s space %s (%d-bit data, %d-bit address)\n", m_device.tag(), m_name, data_width(), addr_width());
+	for (int mode = 0; mode != 2; mode++)
+	{
+		std::map<int, std::pair<u32, u64>> depths;
+		u32 memory = 0, units = 0, passthrough = 0, viewed = 0, slow = 0;
+		std::string slowlist;
+		for (const memory_entry &entry : entries[mode])
+		{
+			auto &depth = depths[entry.depth];
+			depth.first++;
+			depth.second += u64(entry.end - entry.start) + 1;
+			if (entry.entry->is_memory())
+				memory++;
+			if (entry.entry->is_units())
+				units++;
+			if (entry.entry->is_passthrough())
+				passthrough++;
+			if (!entry.context.empty())
+				viewed++;
+
+			// split accesses and taps always go the slow way, deep trees cost a lookup per level
+			char const *const reason = entry.entry->is_passthrough() ? "passthrough" : entry.entry->is_units() ? "units" : (entry.depth > 2) ? "deep" : nullptr;
+			if (reason && slow++ < MAX_SLOW_RANGES)
+				slowlist += util::string_format("    %s  %-11s depth %d  %s\n", range(entry), reason, entry.depth, entry.entry->name());
+		}
+
+		result += util::string_format("  %s: %u ranges, %u memory, %u units, %u passthrough, %u in views\n",
+				mode ? "write" : "read", u32(entries[mode].size()), memory, units, passthrough, viewed);
+		for (const auto &depth : depths)
+			result += util::string_format("    depth %d: %u ranges covering %u addresses\n", depth.first, depth.second.first, depth.second.second);
+		if (slow)
+		{
+			result += util::string_format("  %s slow paths:\n", mode ? "write" : "read");
+			result += slowlist;
+			if (slow > MAX_SLOW_RANGES)
+				result += util::string_format("    ... and %u more\n", slow - MAX_SLOW_RANGES);
+		}
+	}
+	return result;
+}
@@ -73,6 +73,7 @@ template<int HighBits, int Width, int AddrShift, endianness_t Endian> void handl
 
 template<int HighBits, int Width, int AddrShift, endianness_t Endian> void handler_entry_read_dispatch<HighBits, Width, AddrShift, Endian>::dump_map(std::vector<memory_entry> &map) const
 {
+	u32 const first = map.size();
 	if(m_view) {
 		for(u32 i = 0; i != m_dispatch_array.size(); i++) {
 			u32 j = map.size();
@@ -107,6 +108,10 @@ template<int HighBits, int Width, int AddrShift, endianness_t Endian> void handl
 			cur = map.back().end + 1;
 		} while(cur && !((cur ^ base) & UPMASK));
 	}
+
+	// every dispatch level the entries were found through costs one lookup
+	for(u32 k = first; k != map.size(); k++)
+		map[k].depth++;
 }
 
 template<int HighBits, int Width, int AddrShift, endianness_t Endian> typename emu::detail::handler_entry_size<Width>::uX handler_entry_read_dispatch<HighBits, Width, AddrShift, Endian>::read(offs_t offset, uX mem_mask) const
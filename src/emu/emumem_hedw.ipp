@@ -75,6 +75,7 @@ template<int HighBits, int Width, int AddrShift, endianness_t Endian> void handl
 
 template<int HighBits, int Width, int AddrShift, endianness_t Endian> void handler_entry_write_dispatch<HighBits, Width, AddrShift, Endian>::dump_map(std::vector<memory_entry> &map) const
 {
+	u32 const first = map.size();
 	if(m_view) {
 		for(u32 i = 0; i != m_dispatch_array.size(); i++) {
 			u32 j = map.size();
@@ -109,6 +110,10 @@ template<int HighBits, int Width, int AddrShift, endianness_t Endian> void handl
 			cur = map.back().end + 1;
 		} while(cur && !((cur ^ base) & UPMASK));
 	}
+
+	// every dispatch level the entries were found through costs one lookup
+	for(u32 k = first; k != map.size(); k++)
+		map[k].depth++;
 }
 
 template<int HighBits, int Width, int AddrShift, endianness_t Endian> void handler_entry_write_dispatch<HighBits, Width, AddrShift, Endian>::write(offs_t offset, uX data, uX mem_mask) const
@@ -25,16 +25,24 @@ template<int Width, int AddrShift, endianness_t Endian> void handler_entry_write
 {
 	offs_t off = ((offset - this->m_address_base) & this->m_address_mask) >> (Width + AddrShift);
 	m_base[off] = (m_base[off] & ~mem_mask) | (data & mem_mask);
+	if(m_dirty)
+		m_dirty->mark(m_base + off);
 }
 
 template<> void handler_entry_write_memory<0, 0, ENDIANNESS_LITTLE>::write(offs_t offset, u8 data, u8 mem_mask) const
 {
-	m_base[(offset - this->m_address_base) & this->m_address_mask] = data;
+	offs_t off = (offset - this->m_address_base) & this->m_address_mask;
+	m_base[off] = data;
+	if(m_dirty)
+		m_dirty->mark(m_base + off);
 }
 
 template<> void handler_entry_write_memory<0, 0, ENDIANNESS_BIG>::write(offs_t offset, u8 data, u8 mem_mask) const
 {
-	m_base[(offset - this->m_address_base) & this->m_address_mask] = data;
+	offs_t off = (offset - this->m_address_base) & this->m_address_mask;
+	m_base[off] = data;
+	if(m_dirty)
+		m_dirty->mark(m_base + off);
 }
 
 template<int Width, int AddrShift, endianness_t Endian> void *handler_entry_write_memory<Width, AddrShift, Endian>::get_ptr(offs_t offset) const
@@ -47,6 +55,16 @@ template<int Width, int AddrShift, endianness_t Endian> std::string handler_entr
 	return util::string_format("memory@%x", this->m_address_base);
 }
 
+template<int Width, int AddrShift, endianness_t Endian> void handler_entry_write_memory<Width, AddrShift, Endian>::set_dirty_tracker(memory_dirty_tracker *tracker)
+{
+	// tracked handlers must not be bypassed by the direct pointer paths
+	m_dirty = tracker;
+	if(tracker)
+		this->m_flags |= handler_entry::F_DIRTY;
+	else
+		this->m_flags &= ~handler_entry::F_DIRTY;
+}
+
 
 
 
@@ -14,7 +14,7 @@ template<int Width, int AddrShift, endianness_t Endian> class handler_entry_read
 public:
 	using uX = typename emu::detail::handler_entry_size<Width>::uX;
 
-	handler_entry_read_memory(address_space *space, void *base) : handler_entry_read_address<Width, AddrShift, Endian>(space, 0), m_base(reinterpret_cast<uX *>(base)) {}
+	handler_entry_read_memory(address_space *space, void *base) : handler_entry_read_address<Width, AddrShift, Endian>(space, handler_entry::F_MEMORY), m_base(reinterpret_cast<uX *>(base)) {}
 	~handler_entry_read_memory() = default;
 
 	uX read(offs_t offset, uX mem_mask) const override;
@@ -31,7 +31,7 @@ template<int Width, int AddrShift, endianness_t Endian> class handler_entry_writ
 public:
 	using uX = typename emu::detail::handler_entry_size<Width>::uX;
 
-	handler_entry_write_memory(address_space *space, void *base) : handler_entry_write_address<Width, AddrShift, Endian>(space, 0), m_base(reinterpret_cast<uX *>(base)) {}
+	handler_entry_write_memory(address_space *space, void *base) : handler_entry_write_address<Width, AddrShift, Endian>(space, handler_entry::F_MEMORY), m_base(reinterpret_cast<uX *>(base)), m_dirty(nullptr) { set_dirty_tracker(space->manager().dirty_tracker(base)); }
 	~handler_entry_write_memory() = default;
 
 	void write(offs_t offset, uX data, uX mem_mask) const override;
@@ -39,8 +39,12 @@ public:
 
 	std::string name() const override;
 
+	void *base() const { return m_base; }
+	void set_dirty_tracker(memory_dirty_tracker *tracker);
+
 private:
 	uX *m_base;
+	memory_dirty_tracker *m_dirty;
 };
 
 
@@ -10,7 +10,8 @@ template<int Width, int AddrShift, endianness_t Endian> typename emu::detail::ha
 	this->ref();
 
 	uX data = this->m_next->read(offset, mem_mask);
-	m_tap(offset, data, mem_mask);
+	for(const auto &tap : m_taps)
+		tap(offset, data, mem_mask);
 
 	this->unref();
 	return data;
@@ -23,7 +24,14 @@ template<int Width, int AddrShift, endianness_t Endian> std::string handler_entr
 
 template<int Width, int AddrShift, endianness_t Endian> handler_entry_read_tap<Width, AddrShift, Endian> *handler_entry_read_tap<Width, AddrShift, Endian>::instantiate(handler_entry_read<Width, AddrShift, Endian> *next) const
 {
-	return new handler_entry_read_tap<Width, AddrShift, Endian>(this->m_space, this->m_mph, next, m_name, m_tap);
+	// the older taps see read data first, as they would if stacked
+	auto const tap = next->is_passthrough() ? dynamic_cast<handler_entry_read_tap<Width, AddrShift, Endian> *>(next) : nullptr;
+	if(tap && &tap->m_mph == &this->m_mph) {
+		tap_list taps(tap->m_taps);
+		taps.insert(taps.end(), m_taps.begin(), m_taps.end());
+		return new handler_entry_read_tap<Width, AddrShift, Endian>(this->m_space, this->m_mph, tap->m_next, m_name + ") (" + tap->m_name, std::move(taps));
+	}
+	return new handler_entry_read_tap<Width, AddrShift, Endian>(this->m_space, this->m_mph, next, m_name, m_taps);
 }
 
 
@@ -31,7 +39,8 @@ template<int Width, int AddrShift, endianness_t Endian> void handler_entry_write
 {
 	this->ref();
 
-	m_tap(offset, data, mem_mask);
+	for(const auto &tap : m_taps)
+		tap(offset, data, mem_mask);
 	this->m_next->write(offset, data, mem_mask);
 
 	this->unref();
@@ -45,7 +54,14 @@ template<int Width, int AddrShift, endianness_t Endian> std::string handler_entr
 
 template<int Width, int AddrShift, endianness_t Endian> handler_entry_write_tap<Width, AddrShift, Endian> *handler_entry_write_tap<Width, AddrShift, Endian>::instantiate(handler_entry_write<Width, AddrShift, Endian> *next) const
 {
-	return new handler_entry_write_tap<Width, AddrShift, Endian>(this->m_space, this->m_mph, next, m_name, m_tap);
+	// the newer taps see write data first, as they would if stacked
+	auto const tap = next->is_passthrough() ? dynamic_cast<handler_entry_write_tap<Width, AddrShift, Endian> *>(next) : nullptr;
+	if(tap && &tap->m_mph == &this->m_mph) {
+		tap_list taps(m_taps);
+		taps.insert(taps.end(), tap->m_taps.begin(), tap->m_taps.end());
+		return new handler_entry_write_tap<Width, AddrShift, Endian>(this->m_space, this->m_mph, tap->m_next, m_name + ") (" + tap->m_name, std::move(taps));
+	}
+	return new handler_entry_write_tap<Width, AddrShift, Endian>(this->m_space, this->m_mph, next, m_name, m_taps);
 }
 
 
@@ -9,12 +9,15 @@
 
 // handler which tap on a bus access and possibly change the data value through a std::function
 
+// taps installed with the same memory_passthrough_handler over a range it
+// already taps are merged into the existing handler rather than stacked
+
 template<int Width, int AddrShift, endianness_t Endian> class handler_entry_read_tap : public handler_entry_read_passthrough<Width, AddrShift, Endian>
 {
 public:
 	using uX = typename emu::detail::handler_entry_size<Width>::uX;
 
-	handler_entry_read_tap(address_space *space, memory_passthrough_handler &mph, std::string name, std::function<void (offs_t offset, uX &data, uX mem_mask)> tap) : handler_entry_read_passthrough<Width, AddrShift, Endian>(space, mph), m_name(name), m_tap(std::move(tap)) {}
+	handler_entry_read_tap(address_space *space, memory_passthrough_handler &mph, std::string name, std::function<void (offs_t offset, uX &data, uX mem_mask)> tap) : handler_entry_read_passthrough<Width, AddrShift, Endian>(space, mph), m_name(name), m_taps{ std::move(tap) } {}
 	~handler_entry_read_tap() = default;
 
 	uX read(offs_t offset, uX mem_mask) const override;
@@ -24,10 +27,12 @@ public:
 	handler_entry_read_tap<Width, AddrShift, Endian> *instantiate(handler_entry_read<Width, AddrShift, Endian> *next) const override;
 
 protected:
+	using tap_list = std::vector<std::function<void (offs_t offset, uX &data, uX mem_mask)>>;
+
 	std::string m_name;
-	std::function<void (offs_t offset, uX &data, uX mem_mask)> m_tap;
+	tap_list m_taps;    // taps of the same passthrough handler share one entry, in call order
 
-	handler_entry_read_tap(address_space *space, memory_passthrough_handler &mph, handler_entry_read<Width, AddrShift, Endian> *next, std::string name, std::function<void (offs_t offset, uX &data, uX mem_mask)> tap) : handler_entry_read_passthrough<Width, AddrShift, Endian>(space, mph, next), m_name(name), m_tap(tap) {}
+	handler_entry_read_tap(address_space *space, memory_passthrough_handler &mph, handler_entry_read<Width, AddrShift, Endian> *next, std::string name, tap_list taps) : handler_entry_read_passthrough<Width, AddrShift, Endian>(space, mph, next), m_name(name), m_taps(std::move(taps)) {}
 };
 
 template<int Width, int AddrShift, endianness_t Endian> class handler_entry_write_tap : public handler_entry_write_passthrough<Width, AddrShift, Endian>
@@ -35,7 +40,7 @@ template<int Width, int AddrShift, endianness_t Endian> class handler_entry_writ
 public:
 	using uX = typename emu::detail::handler_entry_size<Width>::uX;
 
-	handler_entry_write_tap(address_space *space, memory_passthrough_handler &mph, std::string name, std::function<void (offs_t offset, uX &data, uX mem_mask)> tap) : handler_entry_write_passthrough<Width, AddrShift, Endian>(space, mph), m_name(name), m_tap(std::move(tap)) {}
+	handler_entry_write_tap(address_space *space, memory_passthrough_handler &mph, std::string name, std::function<void (offs_t offset, uX &data, uX mem_mask)> tap) : handler_entry_write_passthrough<Width, AddrShift, Endian>(space, mph), m_name(name), m_taps{ std::move(tap) } {}
 	~handler_entry_write_tap() = default;
 
 	void write(offs_t offset, uX data, uX mem_mask) const override;
@@ -45,10 +50,12 @@ public:
 	handler_entry_write_tap<Width, AddrShift, Endian> *instantiate(handler_entry_write<Width, AddrShift, Endian> *next) const override;
 
 protected:
+	using tap_list = std::vector<std::function<void (offs_t offset, uX &data, uX mem_mask)>>;
+
 	std::string m_name;
-	std::function<void (offs_t offset, uX &data, uX mem_mask)> m_tap;
+	tap_list m_taps;    // taps of the same passthrough handler share one entry, in call order
 
-	handler_entry_write_tap(address_space *space, memory_passthrough_handler &mph, handler_entry_write<Width, AddrShift, Endian> *next, std::string name, std::function<void (offs_t offset, uX &data, uX mem_mask)> tap) : handler_entry_write_passthrough<Width, AddrShift, Endian>(space, mph, next), m_name(name), m_tap(tap) {}
+	handler_entry_write_tap(address_space *space, memory_passthrough_handler &mph, handler_entry_write<Width, AddrShift, Endian> *next, std::string name, tap_list taps) : handler_entry_write_passthrough<Width, AddrShift, Endian>(space, mph, next), m_name(name), m_taps(std::move(taps)) {}
 };
 
 #endif // MAME_EMU_EMUMEM_HET_H
@@ -636,7 +636,7 @@ std::string memory_view::memory_view_entry::key() const
 }
 
 
-memory_view::memory_view(device_t &device, std::string name) : m_device(device), m_name(name), m_config(nullptr), m_addrstart(0), m_addrend(0), m_space(nullptr), m_handler_read(nullptr), m_handler_write(nullptr), m_cur_id(-1), m_cur_slot(-1)
+memory_view::memory_view(device_t &device, std::string name) : m_device(device), m_name(name), m_config(nullptr), m_addrstart(0), m_addrend(0), m_addrmirror(0), m_space(nullptr), m_handler_read(nullptr), m_handler_write(nullptr), m_cur_id(-1), m_cur_slot(-1)
 {
 	device.view_register(this);
 }
@@ -653,15 +653,18 @@ void memory_view::register_state()
 {
 	m_device.machine().save().save_item(&m_device, "view", m_name.c_str(), 0, NAME(m_cur_slot));
 	m_device.machine().save().save_item(&m_device, "view", m_name.c_str(), 0, NAME(m_cur_id));
-	m_device.machine().save().register_postload(save_prepost_delegate(NAME([this]() { m_handler_read->select_a(m_cur_id); m_handler_write->select_a(m_cur_id); })));
+	m_device.machine().save().register_postload(save_prepost_delegate(NAME([this]() { m_handler_read->select_a(m_cur_id); m_handler_write->select_a(m_cur_id); invalidate_lookups(); })));
 }
 
 void memory_view::disable()
 {
 	m_cur_slot = -1;
 	m_cur_id = -1;
+	g_profiler.start(PROFILER_MEM_REMAP);
 	m_handler_read->select_a(-1);
 	m_handler_write->select_a(-1);
+	invalidate_lookups();
+	g_profiler.stop();
 }
 
 void memory_view::select(int slot)
@@ -669,11 +672,25 @@ void memory_view::select(int slot)
 	auto i = m_entry_mapping.find(slot);
 	if (i == m_entry_mapping.end())
 		fatalerror("memory_view %s: select of unknown slot %d", m_name, slot);
+	if (i->second == m_cur_id)
+		return;
 
+	// the entries' dispatch trees are built once, switching only swaps pointers
+	g_profiler.start(PROFILER_MEM_REMAP);
 	m_cur_slot = slot;
 	m_cur_id = i->second;
 	m_handler_read->select_a(m_cur_id);
 	m_handler_write->select_a(m_cur_id);
+	invalidate_lookups();
+	g_profiler.stop();
+}
+
+void memory_view::invalidate_lookups()
+{
+	// accessor caches and direct pointers may have looked through the old
+	// selection; the handler tree itself is unchanged so nothing else cares
+	if (m_space)
+		m_space->invalidate_lookups(read_or_write::READWRITE, m_addrstart & ~m_addrmirror, m_addrend | m_addrmirror);
 }
 
 int memory_view::id_to_slot(int id) const
@@ -59,6 +59,12 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SNAPSHOT_DIRECTORY,                         "snap",      OPTION_STRING,     "directory to save/load screenshots" },
 	{ OPTION_DIFF_DIRECTORY,                             "diff",      OPTION_STRING,     "directory to save hard drive image difference files" },
 	{ OPTION_COMMENT_DIRECTORY,                          "comments",  OPTION_STRING,     "directory to save debugger comments" },
+	{ OPTION_DRC_CACHE_DIRECTORY,                        "drc",       OPTION_STRING,     "directory to save translated DRC code for later runs" },
+	{ OPTION_ARCHIVE_INDEX_DIRECTORY,                    nullptr,     OPTION_STRING,     "optional directory to save ZIP archive directories in so later runs needn't read them" },
+	{ OPTION_HASH_CACHE_DIRECTORY,                       nullptr,     OPTION_STRING,     "optional directory to save verified ROM hashes in so later runs needn't hash unchanged files" },
+	{ OPTION_SOFTLIST_CACHE_DIRECTORY,                   nullptr,     OPTION_STRING,     "optional directory to save parsed software lists in so later runs needn't parse unchanged lists" },
+	{ OPTION_NETLIST_CACHE_DIRECTORY,                    nullptr,     OPTION_STRING,     "optional directory to generate and build specialised netlist solvers in for later runs" },
+	{ OPTION_SHARED_ROM_DIRECTORY,                       nullptr,     OPTION_STRING,     "optional directory, ideally on a RAM-backed file system, to publish loaded ROM regions in so other instances running the same system map them instead of loading their own copies" },
 
 	// state/playback options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE STATE/PLAYBACK OPTIONS" },
@@ -66,18 +72,25 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_AUTOSAVE,                                   "0",         OPTION_BOOLEAN,    "automatically restore state on start and save on exit for supported systems" },
 	{ OPTION_REWIND,                                     "0",         OPTION_BOOLEAN,    "enable rewind savestates" },
 	{ OPTION_REWIND_CAPACITY "(1-2048)",                 "100",       OPTION_INTEGER,    "rewind buffer size in megabytes" },
+	{ OPTION_STATE_COMPRESSION "(1-9)",                  "6",         OPTION_INTEGER,    "zlib compression level for saved states; lower is faster" },
 	{ OPTION_PLAYBACK ";pb",                             nullptr,     OPTION_STRING,     "playback an input file" },
+	{ OPTION_PLAYBACK_HASH,                              nullptr,     OPTION_STRING,     "verify playback: run it at full speed with no output, writing a hash of the machine state to this file periodically" },
+	{ OPTION_PLAYBACK_HASH_INTERVAL "(1-36000)",         "60",        OPTION_INTEGER,    "number of frames between state hashes written by -playback_hash" },
 	{ OPTION_RECORD ";rec",                              nullptr,     OPTION_STRING,     "record an input file" },
 	{ OPTION_RECORD_TIMECODE,                            "0",         OPTION_BOOLEAN,    "record an input timecode file (requires -record option)" },
 	{ OPTION_EXIT_AFTER_PLAYBACK,                        "0",         OPTION_BOOLEAN,    "close the program at the end of playback" },
 
 	{ OPTION_MNGWRITE,                                   nullptr,     OPTION_STRING,     "optional filename to write a MNG movie of the current session" },
 	{ OPTION_AVIWRITE,                                   nullptr,     OPTION_STRING,     "optional filename to write an AVI movie of the current session" },
-	{ OPTION_WAVWRITE,                                   nullptr,     OPTION_STRING,     "optional filename to write a WAV file of the current session" },
+	{ OPTION_ENCODERWRITE,                               nullptr,     OPTION_STRING,     "optional filename to write a movie of the current session through the external encoder" },
+	{ OPTION_ENCODER,                                    "ffmpeg -loglevel error -y -f rawvideo -pixel_format %p -video_size %wx%h -framerate %r -i - -c:v libx264 -preset veryfast -pix_fmt yuv420p %o", OPTION_STRING, "command line of the external movie encoder, fed raw 32-bit RGB frames on its standard input; %w/%h == frame size, %r == frame rate, %p == FFmpeg name of the pixel format, %o == quoted output filename" },
+	{ OPTION_SHMWRITE,                                   nullptr,     OPTION_STRING,     "optional filename to map as shared memory holding the latest frames and sound of the current session; use a path under /dev/shm on Linux" },
+	{ OPTION_WAVWRITE,                                   nullptr,     OPTION_STRING,     "optional filename to write a WAV file of the current session; a .flac extension writes FLAC instead" },
 	{ OPTION_SNAPNAME,                                   "%g/%i",     OPTION_STRING,     "override of the default snapshot/movie naming; %g == gamename, %i == index" },
 	{ OPTION_SNAPSIZE,                                   "auto",      OPTION_STRING,     "specify snapshot/movie resolution (<width>x<height>) or 'auto' to use minimal size " },
 	{ OPTION_SNAPVIEW,                                   "auto",      OPTION_STRING,     "snapshot/movie view - 'auto' for default, or 'native' for per-screen pixel-aspect views" },
 	{ OPTION_SNAPBILINEAR,                               "1",         OPTION_BOOLEAN,    "specify if the snapshot/movie should have bilinear filtering applied" },
+	{ OPTION_SNAPCOMPRESSION "(1-9)",                    "6",         OPTION_INTEGER,    "zlib compression level for PNG snapshots and MNG movies; lower is faster" },
 	{ OPTION_STATENAME,                                  "%g",        OPTION_STRING,     "override of the default state subfolder naming; %g == gamename" },
 	{ OPTION_BURNIN,                                     "0",         OPTION_BOOLEAN,    "create burn-in snapshots for each screen" },
 
@@ -86,11 +99,22 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_AUTOFRAMESKIP ";afs",                       "0",         OPTION_BOOLEAN,    "enable automatic frameskip adjustment to maintain emulation speed" },
 	{ OPTION_FRAMESKIP ";fs(0-10)",                      "0",         OPTION_INTEGER,    "set frameskip to fixed value, 0-10 (upper limit with autoframeskip)" },
 	{ OPTION_SECONDS_TO_RUN ";str",                      "0",         OPTION_INTEGER,    "number of emulated seconds to run before automatically exiting" },
+	{ OPTION_FRAMES_TO_RUN ";ftr",                       "0",         OPTION_INTEGER,    "number of emulated frames to run before automatically exiting" },
+	{ OPTION_COMPUTE_ONLY,                               "0",         OPTION_BOOLEAN,    "skip screen updates, sound mixing, UI and OSD updates until -seconds_to_run or -frames_to_run is reached" },
+	{ OPTION_FINAL_STATE,                                nullptr,     OPTION_STRING,     "name of a saved state to write when -seconds_to_run or -frames_to_run is reached" },
 	{ OPTION_THROTTLE,                                   "1",         OPTION_BOOLEAN,    "throttle emulation to keep system running in sync with real time" },
 	{ OPTION_SLEEP,                                      "1",         OPTION_BOOLEAN,    "enable sleeping, which gives time back to other applications when idle" },
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       OPTION_FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         OPTION_BOOLEAN,    "automatically adjust emulation speed to keep the emulated refresh rate slower than the host screen" },
 	{ OPTION_LOWLATENCY ";lolat",                        "0",         OPTION_BOOLEAN,    "draws new frame before throttling to reduce input latency" },
+	{ OPTION_FRAMEDELAY ";fd(0-9)",                      "0",         OPTION_INTEGER,    "wait this many tenths of a frame after each frame is shown before starting the next, so input is read closer to when it is displayed" },
+	{ OPTION_RUNAHEAD "(0-6)",                           "0",         OPTION_INTEGER,    "number of frames to run ahead of each frame and show instead, hiding that many frames of input latency; needs save state support" },
+	{ OPTION_ADAPTIVE_QUANTUM,                           "0",         OPTION_BOOLEAN,    "widen the scheduling quantum while devices are not interacting with each other" },
+	{ OPTION_IDLE_DETECT,                                "0",         OPTION_BOOLEAN,    "detect CPUs spinning in loops that poll unchanging RAM and skip their cycles" },
+	{ OPTION_LARGE_PAGES,                                "0",         OPTION_INTEGER,    "back RAM blocks and regions of at least this many megabytes with huge pages where the host allows (0 = never)" },
+	{ OPTION_MAP_ROMS,                                   "0",         OPTION_BOOLEAN,    "map regions loaded from a single uncompressed ROM file instead of reading them into memory" },
+	{ OPTION_GFX_CACHE_SIZE,                             "0",         OPTION_INTEGER,    "maximum megabytes of decoded tiles kept for each graphics set; least recently used tiles are decoded again when needed (0 = keep all)" },
+	{ OPTION_CHD_CACHE_SIZE "(0-4096)",                  "16",        OPTION_INTEGER,    "megabytes of decompressed hunks kept for each compressed disk CHD; least recently used hunks are decompressed again when needed (0 = none)" },
 
 	// render options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE RENDER OPTIONS" },
@@ -126,6 +150,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_GAMMA "(0.1-3.0)",                          "1.0",       OPTION_FLOAT,      "default game screen gamma correction" },
 	{ OPTION_PAUSE_BRIGHTNESS "(0.0-1.0)",               "0.65",      OPTION_FLOAT,      "amount to scale the screen brightness when paused" },
 	{ OPTION_EFFECT,                                     "none",      OPTION_STRING,     "name of a PNG file to use for visual effects, or 'none'" },
+	{ OPTION_RENDER_SCALE "(1-8)",                       "1",         OPTION_INTEGER,    "internal resolution multiplier for screens whose 3D renderer supports it" },
 
 	// vector options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE VECTOR OPTIONS" },
@@ -141,6 +166,11 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SAMPLES,                                    "1",         OPTION_BOOLEAN,    "enable the use of external samples if available" },
 	{ OPTION_VOLUME ";vol",                              "0",         OPTION_INTEGER,    "sound volume in decibels (-32 min, 0 max)" },
 	{ OPTION_SPEAKER_REPORT,                             "0",         OPTION_INTEGER,    "print report of speaker ouput maxima (0=none, or 1-4 for more detail)" },
+	{ OPTION_SOUND_THREADS,                              "0",         OPTION_BOOLEAN,    "update independent groups of sound streams concurrently on worker threads" },
+	{ OPTION_POLYPHASE_RESAMPLER,                        "0",         OPTION_BOOLEAN,    "convert between stream sample rates with a band-limited polyphase filter" },
+	{ OPTION_DEFER_SOUND_WRITES,                         "0",         OPTION_BOOLEAN,    "queue timestamped sound chip register writes and apply them when the stream is next updated" },
+	{ OPTION_SOUND_UPDATE_RATE "(50-1000)",              "50",        OPTION_INTEGER,    "number of times per second sound is mixed and handed to the OSD; higher values lower output latency" },
+	{ OPTION_SOUND_STATS,                                "0",         OPTION_BOOLEAN,    "show audio buffer underruns, overruns, fill level and stream update time on screen" },
 
 	// input options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE INPUT OPTIONS" },
@@ -160,6 +190,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_NATURAL_KEYBOARD ";nat",                    "0",         OPTION_BOOLEAN,    "specifies whether to use a natural keyboard or not" },
 	{ OPTION_JOYSTICK_CONTRADICTORY ";joy_contradictory","0",         OPTION_BOOLEAN,    "enable contradictory direction digital joystick input at the same time" },
 	{ OPTION_COIN_IMPULSE,                               "0",         OPTION_INTEGER,    "set coin impulse time (n<0 disable impulse, n==0 obey driver, 0<n set time n)" },
+	{ OPTION_INPUT_EVENTS,                               "0",         OPTION_BOOLEAN,    "apply button changes seen during a frame at the same spacing within the next frame, rather than all at its start" },
 
 	// input autoenable options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE INPUT AUTOMATIC ENABLE OPTIONS" },
@@ -181,6 +212,17 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_UPDATEINPAUSE,                              "0",         OPTION_BOOLEAN,    "keep calling video updates while in pause" },
 	{ OPTION_DEBUGSCRIPT,                                nullptr,     OPTION_STRING,     "script for debugger" },
 	{ OPTION_DEBUGLOG,                                   "0",         OPTION_BOOLEAN,    "write debug console output to debug.log" },
+	{ OPTION_DEVICE_PROFILE,                             nullptr,     OPTION_STRING,     "write per-device host time and cycle counts for every frame to a .csv or .json file" },
+	{ OPTION_PERF_COUNTERS,                              "0",         OPTION_BOOLEAN,    "read host cycles, instructions, cache misses and branch misses around profiler entries and -device_profile samples, where the host allows it" },
+	{ OPTION_SCHEDULER_TRACE,                            nullptr,     OPTION_STRING,     "write a binary trace of timeslices, device execution and timers for offline analysis" },
+	{ OPTION_PROFILE_TRACE,                              nullptr,     OPTION_STRING,     "write a timeline of device execution and profiled scopes on every thread to a file in Chromium trace-event JSON format on exit" },
+	{ OPTION_PROFILE_TRACE_EVENTS "(1-16777216)",        "65536",     OPTION_INTEGER,    "number of most recent scopes kept for each thread by -profile_trace" },
+	{ OPTION_MEMMAP_REPORT,                              nullptr,     OPTION_STRING,     "write dispatch depth and slow-path statistics for every address space to a file after startup" },
+	{ OPTION_OPCODE_STATS,                               nullptr,     OPTION_STRING,     "count the instructions executed by each CPU and write them by mnemonic to a file on exit" },
+	{ OPTION_STATE_REPORT,                               nullptr,     OPTION_STRING,     "time every save and load, and write the size and time of each saved item by device to a file on exit" },
+	{ OPTION_MEM_REPORT,                                 nullptr,     OPTION_STRING,     "sample the memory allocated by each device and subsystem every second, and write current and peak bytes to a file on exit" },
+	{ OPTION_BENCH_REPORT,                               nullptr,     OPTION_STRING,     "write emulated speed, host processor time, peak memory use and profiler figures to a file in JSON format on exit; use with -bench" },
+	{ OPTION_STARTUP_TIME,                               "0",         OPTION_BOOLEAN,    "display the time and peak memory usage of each phase of startup" },
 
 	// comm options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE COMM OPTIONS" },
@@ -189,6 +231,11 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_COMM_REMOTE_HOST,                           "127.0.0.1", OPTION_STRING,     "remote address to connect to" },
 	{ OPTION_COMM_REMOTE_PORT,                           "15112",     OPTION_STRING,     "remote port to connect to" },
 	{ OPTION_COMM_FRAME_SYNC,                            "0",         OPTION_BOOLEAN,    "sync frames" },
+	{ OPTION_NETPLAY,                                    nullptr,     OPTION_STRING,     "play with a peer running the same system, as host:port, exchanging inputs and rolling back when they arrive late" },
+	{ OPTION_NETPLAY_LISTEN,                             "0",         OPTION_BOOLEAN,    "wait for the -netplay peer to connect to this host:port instead of connecting to it" },
+	{ OPTION_NETPLAY_PLAYER "(1-8)",                     "2",         OPTION_INTEGER,    "player driven by the connecting -netplay peer; the listening peer drives all the others" },
+	{ OPTION_NETPLAY_DELAY "(0-10)",                     "0",         OPTION_INTEGER,    "frames of -netplay input delay, trading latency for fewer rollbacks" },
+	{ OPTION_NETPLAY_ROLLBACK "(1-30)",                  "8",         OPTION_INTEGER,    "most frames -netplay can roll back before waiting for the peer" },
 
 	// misc options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE MISC OPTIONS" },
@@ -196,6 +243,13 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DRC_USE_C,                                  "0",         OPTION_BOOLEAN,    "force DRC to use C backend" },
 	{ OPTION_DRC_LOG_UML,                                "0",         OPTION_BOOLEAN,    "write DRC UML disassembly log" },
 	{ OPTION_DRC_LOG_NATIVE,                             "0",         OPTION_BOOLEAN,    "write DRC native disassembly log" },
+	{ OPTION_DRC_CACHE,                                  "0",         OPTION_BOOLEAN,    "reuse translated DRC code saved by earlier runs" },
+	{ OPTION_DRC_COLD_BLOCKS "(0-255)",                  "0",         OPTION_INTEGER,    "number of times to interpret a block before translating it, on CPUs with an interpreter" },
+	{ OPTION_DRC_PROFILE "(0-2)",                        "0",         OPTION_INTEGER,    "write a DRC block profile on exit (1 = count block entries, 2 = also time them)" },
+	{ OPTION_DRC_VALIDATE,                               "0",         OPTION_BOOLEAN,    "check each translated DRC block against the interpreter and report the first difference, on CPUs with an interpreter" },
+	{ OPTION_DRC_EXPERIMENTAL,                           "0",         OPTION_BOOLEAN,    "also enable DRC CPU cores that are still being validated against their interpreters" },
+	{ OPTION_PRECISE_FPU,                                "1",         OPTION_BOOLEAN,    "use software floating point for all FPU operations; disable to let CPUs that support it use the host FPU where results are identical" },
+	{ OPTION_NETLIST_COMPILER,                           "c++ -O2 -shared -fPIC", OPTION_STRING, "command used to build netlist solvers in the netlist cache directory into a shared library" },
 	{ OPTION_BIOS,                                       nullptr,     OPTION_STRING,     "select the system BIOS to use" },
 	{ OPTION_CHEAT ";c",                                 "0",         OPTION_BOOLEAN,    "enable cheat subsystem" },
 	{ OPTION_SKIP_GAMEINFO,                              "0",         OPTION_BOOLEAN,    "skip displaying the system information screen at startup" },
@@ -47,23 +47,36 @@
 #define OPTION_SNAPSHOT_DIRECTORY   "snapshot_directory"
 #define OPTION_DIFF_DIRECTORY       "diff_directory"
 #define OPTION_COMMENT_DIRECTORY    "comment_directory"
+#define OPTION_DRC_CACHE_DIRECTORY  "drc_cache_directory"
+#define OPTION_ARCHIVE_INDEX_DIRECTORY "archive_index_directory"
+#define OPTION_HASH_CACHE_DIRECTORY "hash_cache_directory"
+#define OPTION_SOFTLIST_CACHE_DIRECTORY "softlist_cache_directory"
+#define OPTION_NETLIST_CACHE_DIRECTORY "netlist_cache_directory"
+#define OPTION_SHARED_ROM_DIRECTORY "shared_rom_directory"
 
 // core state/playback options
 #define OPTION_STATE                "state"
 #define OPTION_AUTOSAVE             "autosave"
 #define OPTION_REWIND               "rewind"
 #define OPTION_REWIND_CAPACITY      "rewind_capacity"
+#define OPTION_STATE_COMPRESSION    "state_compression"
 #define OPTION_PLAYBACK             "playback"
+#define OPTION_PLAYBACK_HASH        "playback_hash"
+#define OPTION_PLAYBACK_HASH_INTERVAL "playback_hash_interval"
 #define OPTION_RECORD               "record"
 #define OPTION_RECORD_TIMECODE      "record_timecode"
 #define OPTION_EXIT_AFTER_PLAYBACK  "exit_after_playback"
 #define OPTION_MNGWRITE             "mngwrite"
 #define OPTION_AVIWRITE             "aviwrite"
+#define OPTION_ENCODERWRITE         "encoderwrite"
+#define OPTION_ENCODER              "encoder"
+#define OPTION_SHMWRITE             "shmwrite"
 #define OPTION_WAVWRITE             "wavwrite"
 #define OPTION_SNAPNAME             "snapname"
 #define OPTION_SNAPSIZE             "snapsize"
 #define OPTION_SNAPVIEW             "snapview"
 #define OPTION_SNAPBILINEAR         "snapbilinear"
+#define OPTION_SNAPCOMPRESSION      "snapcompression"
 #define OPTION_STATENAME            "statename"
 #define OPTION_BURNIN               "burnin"
 
@@ -71,11 +84,22 @@
 #define OPTION_AUTOFRAMESKIP        "autoframeskip"
 #define OPTION_FRAMESKIP            "frameskip"
 #define OPTION_SECONDS_TO_RUN       "seconds_to_run"
+#define OPTION_FRAMES_TO_RUN        "frames_to_run"
+#define OPTION_COMPUTE_ONLY         "compute_only"
+#define OPTION_FINAL_STATE          "final_state"
 #define OPTION_THROTTLE             "throttle"
 #define OPTION_SLEEP                "sleep"
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
 #define OPTION_LOWLATENCY           "lowlatency"
+#define OPTION_FRAMEDELAY           "framedelay"
+#define OPTION_RUNAHEAD             "runahead"
+#define OPTION_ADAPTIVE_QUANTUM     "adaptive_quantum"
+#define OPTION_IDLE_DETECT          "idle_detect"
+#define OPTION_LARGE_PAGES          "largepages"
+#define OPTION_MAP_ROMS             "maproms"
+#define OPTION_GFX_CACHE_SIZE       "gfx_cache_size"
+#define OPTION_CHD_CACHE_SIZE       "chd_cache_size"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -107,6 +131,7 @@
 #define OPTION_GAMMA                "gamma"
 #define OPTION_PAUSE_BRIGHTNESS     "pause_brightness"
 #define OPTION_EFFECT               "effect"
+#define OPTION_RENDER_SCALE         "render_scale"
 
 // core vector options
 #define OPTION_BEAM_WIDTH_MIN       "beam_width_min"
@@ -120,6 +145,11 @@
 #define OPTION_SAMPLES              "samples"
 #define OPTION_VOLUME               "volume"
 #define OPTION_SPEAKER_REPORT       "speaker_report"
+#define OPTION_SOUND_THREADS        "sound_threads"
+#define OPTION_POLYPHASE_RESAMPLER  "polyphase_resampler"
+#define OPTION_DEFER_SOUND_WRITES   "defer_sound_writes"
+#define OPTION_SOUND_UPDATE_RATE    "sound_update_rate"
+#define OPTION_SOUND_STATS          "sound_stats"
 
 // core input options
 #define OPTION_COIN_LOCKOUT         "coin_lockout"
@@ -138,6 +168,7 @@
 #define OPTION_NATURAL_KEYBOARD     "natural"
 #define OPTION_JOYSTICK_CONTRADICTORY   "joystick_contradictory"
 #define OPTION_COIN_IMPULSE         "coin_impulse"
+#define OPTION_INPUT_EVENTS         "input_events"
 
 // input autoenable options
 #define OPTION_PADDLE_DEVICE        "paddle_device"
@@ -157,12 +188,30 @@
 #define OPTION_UPDATEINPAUSE        "update_in_pause"
 #define OPTION_DEBUGSCRIPT          "debugscript"
 #define OPTION_DEBUGLOG             "debuglog"
+#define OPTION_DEVICE_PROFILE       "device_profile"
+#define OPTION_PERF_COUNTERS        "perf_counters"
+#define OPTION_SCHEDULER_TRACE      "scheduler_trace"
+#define OPTION_PROFILE_TRACE        "profile_trace"
+#define OPTION_PROFILE_TRACE_EVENTS "profile_trace_events"
+#define OPTION_MEMMAP_REPORT        "memmapreport"
+#define OPTION_OPCODE_STATS         "opcodestats"
+#define OPTION_STATE_REPORT         "statereport"
+#define OPTION_MEM_REPORT           "memreport"
+#define OPTION_BENCH_REPORT         "benchreport"
+#define OPTION_STARTUP_TIME         "startuptime"
 
 // core misc options
 #define OPTION_DRC                  "drc"
 #define OPTION_DRC_USE_C            "drc_use_c"
 #define OPTION_DRC_LOG_UML          "drc_log_uml"
 #define OPTION_DRC_LOG_NATIVE       "drc_log_native"
+#define OPTION_DRC_CACHE            "drc_cache"
+#define OPTION_DRC_COLD_BLOCKS      "drc_cold_blocks"
+#define OPTION_DRC_PROFILE          "drc_profile"
+#define OPTION_DRC_VALIDATE         "drc_validate"
+#define OPTION_DRC_EXPERIMENTAL     "drc_experimental"
+#define OPTION_PRECISE_FPU          "precise_fpu"
+#define OPTION_NETLIST_COMPILER     "netlist_compiler"
 #define OPTION_BIOS                 "bios"
 #define OPTION_CHEAT                "cheat"
 #define OPTION_SKIP_GAMEINFO        "skip_gameinfo"
@@ -177,6 +226,11 @@
 #define OPTION_COMM_REMOTE_HOST     "comm_remotehost"
 #define OPTION_COMM_REMOTE_PORT     "comm_remoteport"
 #define OPTION_COMM_FRAME_SYNC      "comm_framesync"
+#define OPTION_NETPLAY              "netplay"
+#define OPTION_NETPLAY_LISTEN       "netplay_listen"
+#define OPTION_NETPLAY_PLAYER       "netplay_player"
+#define OPTION_NETPLAY_DELAY        "netplay_delay"
+#define OPTION_NETPLAY_ROLLBACK     "netplay_rollback"
 
 #define OPTION_CONFIRM_QUIT         "confirm_quit"
 #define OPTION_UI_MOUSE             "ui_mouse"
@@ -331,23 +385,36 @@ public:
 	const char *snapshot_directory() const { return value(OPTION_SNAPSHOT_DIRECTORY); }
 	const char *diff_directory() const { return value(OPTION_DIFF_DIRECTORY); }
 	const char *comment_directory() const { return value(OPTION_COMMENT_DIRECTORY); }
+	const char *drc_cache_directory() const { return value(OPTION_DRC_CACHE_DIRECTORY); }
+	const char *archive_index_directory() const { return value(OPTION_ARCHIVE_INDEX_DIRECTORY); }
+	const char *hash_cache_directory() const { return value(OPTION_HASH_CACHE_DIRECTORY); }
+	const char *softlist_cache_directory() const { return value(OPTION_SOFTLIST_CACHE_DIRECTORY); }
+	const char *netlist_cache_directory() const { return value(OPTION_NETLIST_CACHE_DIRECTORY); }
+	const char *shared_rom_directory() const { return value(OPTION_SHARED_ROM_DIRECTORY); }
 
 	// core state/playback options
 	const char *state() const { return value(OPTION_STATE); }
 	bool autosave() const { return bool_value(OPTION_AUTOSAVE); }
 	int rewind() const { return bool_value(OPTION_REWIND); }
 	int rewind_capacity() const { return int_value(OPTION_REWIND_CAPACITY); }
+	int state_compression() const { return int_value(OPTION_STATE_COMPRESSION); }
 	const char *playback() const { return value(OPTION_PLAYBACK); }
+	const char *playback_hash() const { return value(OPTION_PLAYBACK_HASH); }
+	int playback_hash_interval() const { return int_value(OPTION_PLAYBACK_HASH_INTERVAL); }
 	const char *record() const { return value(OPTION_RECORD); }
 	bool record_timecode() const { return bool_value(OPTION_RECORD_TIMECODE); }
 	bool exit_after_playback() const { return bool_value(OPTION_EXIT_AFTER_PLAYBACK); }
 	const char *mng_write() const { return value(OPTION_MNGWRITE); }
 	const char *avi_write() const { return value(OPTION_AVIWRITE); }
+	const char *encoder_write() const { return value(OPTION_ENCODERWRITE); }
+	const char *encoder() const { return value(OPTION_ENCODER); }
+	const char *shm_write() const { return value(OPTION_SHMWRITE); }
 	const char *wav_write() const { return value(OPTION_WAVWRITE); }
 	const char *snap_name() const { return value(OPTION_SNAPNAME); }
 	const char *snap_size() const { return value(OPTION_SNAPSIZE); }
 	const char *snap_view() const { return value(OPTION_SNAPVIEW); }
 	bool snap_bilinear() const { return bool_value(OPTION_SNAPBILINEAR); }
+	int snap_compression() const { return int_value(OPTION_SNAPCOMPRESSION); }
 	const char *state_name() const { return value(OPTION_STATENAME); }
 	bool burnin() const { return bool_value(OPTION_BURNIN); }
 
@@ -355,11 +422,22 @@ public:
 	bool auto_frameskip() const { return bool_value(OPTION_AUTOFRAMESKIP); }
 	int frameskip() const { return int_value(OPTION_FRAMESKIP); }
 	int seconds_to_run() const { return int_value(OPTION_SECONDS_TO_RUN); }
+	int frames_to_run() const { return int_value(OPTION_FRAMES_TO_RUN); }
+	bool compute_only() const { return bool_value(OPTION_COMPUTE_ONLY); }
+	const char *final_state() const { return value(OPTION_FINAL_STATE); }
 	bool throttle() const { return bool_value(OPTION_THROTTLE); }
 	bool sleep() const { return m_sleep; }
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
 	bool low_latency() const { return bool_value(OPTION_LOWLATENCY); }
+	int frame_delay() const { return int_value(OPTION_FRAMEDELAY); }
+	int runahead() const { return int_value(OPTION_RUNAHEAD); }
+	bool adaptive_quantum() const { return bool_value(OPTION_ADAPTIVE_QUANTUM); }
+	bool idle_detect() const { return bool_value(OPTION_IDLE_DETECT); }
+	int large_pages() const { return int_value(OPTION_LARGE_PAGES); }
+	bool map_roms() const { return bool_value(OPTION_MAP_ROMS); }
+	int gfx_cache_size() const { return int_value(OPTION_GFX_CACHE_SIZE); }
+	int chd_cache_size() const { return int_value(OPTION_CHD_CACHE_SIZE); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -391,6 +469,7 @@ public:
 	float gamma() const { return float_value(OPTION_GAMMA); }
 	float pause_brightness() const { return float_value(OPTION_PAUSE_BRIGHTNESS); }
 	const char *effect() const { return value(OPTION_EFFECT); }
+	int render_scale() const { return int_value(OPTION_RENDER_SCALE); }
 
 	// core vector options
 	float beam_width_min() const { return float_value(OPTION_BEAM_WIDTH_MIN); }
@@ -404,6 +483,11 @@ public:
 	bool samples() const { return bool_value(OPTION_SAMPLES); }
 	int volume() const { return int_value(OPTION_VOLUME); }
 	int speaker_report() const { return int_value(OPTION_SPEAKER_REPORT); }
+	bool sound_threads() const { return bool_value(OPTION_SOUND_THREADS); }
+	bool polyphase_resampler() const { return bool_value(OPTION_POLYPHASE_RESAMPLER); }
+	bool defer_sound_writes() const { return bool_value(OPTION_DEFER_SOUND_WRITES); }
+	int sound_update_rate() const { return int_value(OPTION_SOUND_UPDATE_RATE); }
+	bool sound_stats() const { return bool_value(OPTION_SOUND_STATS); }
 
 	// core input options
 	bool coin_lockout() const { return bool_value(OPTION_COIN_LOCKOUT); }
@@ -430,6 +514,7 @@ public:
 	bool natural_keyboard() const { return bool_value(OPTION_NATURAL_KEYBOARD); }
 	bool joystick_contradictory() const { return m_joystick_contradictory; }
 	int coin_impulse() const { return m_coin_impulse; }
+	bool input_events() const { return bool_value(OPTION_INPUT_EVENTS); }
 
 	// core debugging options
 	bool log() const { return bool_value(OPTION_LOG); }
@@ -439,12 +524,30 @@ public:
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
 	bool debuglog() const { return bool_value(OPTION_DEBUGLOG); }
+	const char *device_profile() const { return value(OPTION_DEVICE_PROFILE); }
+	bool perf_counters() const { return bool_value(OPTION_PERF_COUNTERS); }
+	const char *scheduler_trace() const { return value(OPTION_SCHEDULER_TRACE); }
+	const char *profile_trace() const { return value(OPTION_PROFILE_TRACE); }
+	int profile_trace_events() const { return int_value(OPTION_PROFILE_TRACE_EVENTS); }
+	const char *memmap_report() const { return value(OPTION_MEMMAP_REPORT); }
+	const char *opcode_stats() const { return value(OPTION_OPCODE_STATS); }
+	const char *state_report() const { return value(OPTION_STATE_REPORT); }
+	const char *mem_report() const { return value(OPTION_MEM_REPORT); }
+	const char *bench_report() const { return value(OPTION_BENCH_REPORT); }
+	bool startup_time() const { return bool_value(OPTION_STARTUP_TIME); }
 
 	// core misc options
 	bool drc() const { return bool_value(OPTION_DRC); }
 	bool drc_use_c() const { return bool_value(OPTION_DRC_USE_C); }
 	bool drc_log_uml() const { return bool_value(OPTION_DRC_LOG_UML); }
 	bool drc_log_native() const { return bool_value(OPTION_DRC_LOG_NATIVE); }
+	bool drc_cache() const { return bool_value(OPTION_DRC_CACHE); }
+	int drc_cold_blocks() const { return int_value(OPTION_DRC_COLD_BLOCKS); }
+	int drc_profile() const { return int_value(OPTION_DRC_PROFILE); }
+	bool drc_validate() const { return bool_value(OPTION_DRC_VALIDATE); }
+	bool drc_experimental() const { return bool_value(OPTION_DRC_EXPERIMENTAL); }
+	bool precise_fpu() const { return bool_value(OPTION_PRECISE_FPU); }
+	const char *netlist_compiler() const { return value(OPTION_NETLIST_COMPILER); }
 	const char *bios() const { return value(OPTION_BIOS); }
 	bool cheat() const { return bool_value(OPTION_CHEAT); }
 	bool skip_gameinfo() const { return bool_value(OPTION_SKIP_GAMEINFO); }
@@ -459,6 +562,11 @@ public:
 	const char *comm_remotehost() const { return value(OPTION_COMM_REMOTE_HOST); }
 	const char *comm_remoteport() const { return value(OPTION_COMM_REMOTE_PORT); }
 	bool comm_framesync() const { return bool_value(OPTION_COMM_FRAME_SYNC); }
+	const char *netplay() const { return value(OPTION_NETPLAY); }
+	bool netplay_listen() const { return bool_value(OPTION_NETPLAY_LISTEN); }
+	int netplay_player() const { return int_value(OPTION_NETPLAY_PLAYER); }
+	int netplay_delay() const { return int_value(OPTION_NETPLAY_DELAY); }
+	int netplay_rollback() const { return int_value(OPTION_NETPLAY_ROLLBACK); }
 
 
 	bool confirm_quit() const { return bool_value(OPTION_CONFIRM_QUIT); }
@@ -207,6 +207,7 @@ emu_file::emu_file(path_iterator &&searchpath, u32 openflags)
 emu_file::emu_file(u32 openflags, empty_t)
 	: m_filename()
 	, m_fullpath()
+	, m_archivepath()
 	, m_file()
 	, m_iterator()
 	, m_mediapaths()
@@ -215,6 +216,7 @@ emu_file::emu_file(u32 openflags, empty_t)
 	, m_openflags(openflags)
 	, m_zipfile(nullptr)
 	, m_ziplength(0)
+	, m_zippos(0)
 	, m_remove_on_close(false)
 	, m_restrict_to_mediapath(0)
 {
@@ -251,6 +253,17 @@ emu_file::operator util::core_file &()
 }
 
 
+//-------------------------------------------------
+//  is_read_in_place - true for a stored ZIP
+//  entry that is read straight from its archive
+//-------------------------------------------------
+
+bool emu_file::is_read_in_place() const
+{
+	return m_zipfile && m_zipfile->current_is_stored();
+}
+
+
 //-------------------------------------------------
 //  hash - returns the hash for a file
 //-------------------------------------------------
@@ -270,6 +283,23 @@ util::hash_collection &emu_file::hashes(std::string_view types)
 	if (needed.empty())
 		return m_hashes;
 
+	// a stored ZIP entry that hasn't been loaded is hashed from the archive
+	if (m_zipfile && m_zipfile->current_is_stored())
+	{
+		std::vector<u8> buffer(std::min<u64>(m_ziplength, 1024 * 1024));
+		m_hashes.begin(needed.c_str());
+		for (u64 offset = 0; offset < m_ziplength; )
+		{
+			u32 actual;
+			if ((m_zipfile->read_stored(offset, &buffer[0], buffer.size(), actual) != util::archive_file::error::NONE) || !actual)
+				break;
+			m_hashes.buffer(&buffer[0], actual);
+			offset += actual;
+		}
+		m_hashes.end();
+		return m_hashes;
+	}
+
 	// load the ZIP file if needed
 	if (compressed_file_ready())
 		return m_hashes;
@@ -420,6 +450,9 @@ void emu_file::close()
 {
 	// close files and free memory
 	m_zipfile.reset();
+	m_ziplength = 0;
+	m_zippos = 0;
+	m_archivepath.clear();
 	m_file.reset();
 
 	m_zipdata.clear();
@@ -434,6 +467,23 @@ void emu_file::close()
 }
 
 
+//-------------------------------------------------
+//  close_archive - stop reading a stored ZIP
+//  entry in place, so the archive can be reused;
+//  its length and the hashes computed so far are
+//  kept
+//-------------------------------------------------
+
+void emu_file::close_archive()
+{
+	if (m_zipfile && m_zipfile->current_is_stored())
+	{
+		m_zipfile.reset();
+		m_zippos = 0;
+	}
+}
+
+
 //-------------------------------------------------
 //  compress - enable/disable streaming file
 //  compression via zlib; level is 0 to disable
@@ -466,6 +516,16 @@ bool emu_file::compressed_file_ready()
 
 int emu_file::seek(s64 offset, int whence)
 {
+	// stored ZIP entries are read in place
+	if (m_zipfile && m_zipfile->current_is_stored())
+	{
+		s64 const base = (whence == SEEK_CUR) ? s64(m_zippos) : (whence == SEEK_END) ? s64(m_ziplength) : 0;
+		if ((base + offset) < 0)
+			return 1;
+		m_zippos = base + offset;
+		return 0;
+	}
+
 	// load the ZIP file now if we haven't yet
 	if (compressed_file_ready())
 		return 1;
@@ -484,6 +544,10 @@ int emu_file::seek(s64 offset, int whence)
 
 u64 emu_file::tell()
 {
+	// stored ZIP entries are read in place
+	if (m_zipfile && m_zipfile->current_is_stored())
+		return m_zippos;
+
 	// load the ZIP file now if we haven't yet
 	if (compressed_file_ready())
 		return 0;
@@ -502,6 +566,10 @@ u64 emu_file::tell()
 
 bool emu_file::eof()
 {
+	// stored ZIP entries are read in place
+	if (m_zipfile && m_zipfile->current_is_stored())
+		return m_zippos >= m_ziplength;
+
 	// load the ZIP file now if we haven't yet
 	if (compressed_file_ready())
 		return 0;
@@ -528,7 +596,8 @@ u64 emu_file::size()
 	if (m_file)
 		return m_file->size();
 
-	return 0;
+	// a stored ZIP entry whose archive was closed keeps its length
+	return m_ziplength;
 }
 
 
@@ -538,6 +607,16 @@ u64 emu_file::size()
 
 u32 emu_file::read(void *buffer, u32 length)
 {
+	// stored ZIP entries are read straight into the caller's buffer
+	if (m_zipfile && m_zipfile->current_is_stored())
+	{
+		u32 actual;
+		if (m_zipfile->read_stored(m_zippos, buffer, length, actual) != util::archive_file::error::NONE)
+			return 0;
+		m_zippos += actual;
+		return actual;
+	}
+
 	// load the ZIP file now if we haven't yet
 	if (compressed_file_ready())
 		return 0;
@@ -787,8 +866,13 @@ osd_file::error emu_file::attempt_zipped()
 				// build a hash with just the CRC
 				m_hashes.reset();
 				m_hashes.add_crc(m_zipfile->current_crc());
+				m_archivepath = m_fullpath + suffixes[i];
 				m_fullpath = savepath;
-				return (m_openflags & OPEN_FLAG_NO_PRELOAD) ? osd_file::error::NONE : load_zipped_file();
+
+				// stored entries are read in place, so there's nothing to preload
+				m_zippos = 0;
+				bool const preload = !(m_openflags & OPEN_FLAG_NO_PRELOAD) && !m_zipfile->current_is_stored();
+				return preload ? load_zipped_file() : osd_file::error::NONE;
 			}
 
 			// close up the archive file and try the next level
@@ -828,7 +912,12 @@ osd_file::error emu_file::load_zipped_file()
 		return osd_file::error::FAILURE;
 	}
 
+	// pick up where reading in place left off
+	if (m_zippos)
+		m_file->seek(m_zippos, SEEK_SET);
+
 	// close out the ZIP file
 	m_zipfile.reset();
+	m_zippos = 0;
 	return osd_file::error::NONE;
 }
@@ -144,9 +144,12 @@ public:
 
 	// getters
 	operator util::core_file &();
-	bool is_open() const { return bool(m_file); }
+	bool is_open() const { return m_file || m_zipfile; }
+	bool is_archived() const { return m_zipfile || !m_zipdata.empty(); }
+	bool is_read_in_place() const;
 	const char *filename() const { return m_filename.c_str(); }
 	const char *fullpath() const { return m_fullpath.c_str(); }
+	const char *archive_path() const { return m_archivepath.c_str(); }
 	u32 openflags() const { return m_openflags; }
 	util::hash_collection &hashes(std::string_view types);
 
@@ -165,6 +168,7 @@ public:
 	osd_file::error open_next();
 	osd_file::error open_ram(const void *data, u32 length);
 	void close();
+	void close_archive();
 
 	// control
 	osd_file::error compress(int compress);
@@ -222,6 +226,7 @@ private:
 	// internal state
 	std::string             m_filename;             // original filename provided
 	std::string             m_fullpath;             // full filename
+	std::string             m_archivepath;          // archive the file was found in, if any
 	util::core_file::ptr    m_file;                 // core file pointer
 	searchpath_vector       m_iterator;             // iterator for paths
 	searchpath_vector       m_mediapaths;           // media-path iterator
@@ -233,6 +238,7 @@ private:
 	std::unique_ptr<util::archive_file> m_zipfile;  // ZIP file pointer
 	std::vector<u8>         m_zipdata;              // ZIP file data
 	u64                     m_ziplength;            // ZIP file length
+	u64                     m_zippos;               // position in a stored ZIP entry read in place
 
 	bool                    m_remove_on_close;      // flag: remove the file when closing
 	int                     m_restrict_to_mediapath; // flag: restrict to paths inside the media-path
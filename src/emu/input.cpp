@@ -556,7 +556,10 @@ void input_seq::replace(input_code oldcode, input_code newcode) noexcept
 //  input_manager - constructor
 //-------------------------------------------------
 
-input_manager::input_manager(running_machine &machine) : m_machine(machine)
+input_manager::input_manager(running_machine &machine)
+	: m_machine(machine)
+	, m_events_enabled(false)
+	, m_event_time(0)
 {
 	// reset code memory
 	reset_memory();
@@ -586,6 +589,21 @@ input_manager::~input_manager()
 }
 
 
+//-------------------------------------------------
+//  clear_events - forget the events posted since
+//  the last frame
+//-------------------------------------------------
+
+void input_manager::clear_events()
+{
+	for (input_device_item *item : m_event_items)
+		item->clear_events();
+	m_event_items.clear();
+	m_event_times.clear();
+	m_event_time = 0;
+}
+
+
 //-------------------------------------------------
 //  code_value - return the value of a given
 //  input code
@@ -25,6 +25,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 
 //**************************************************************************
@@ -528,6 +529,16 @@ public:
 	// misc
 	bool map_device_to_controller(const devicemap_table_type *devicemap_table = nullptr);
 
+	// timestamped events
+	bool events_enabled() const { return m_events_enabled; }
+	void set_events_enabled(bool enabled) { m_events_enabled = enabled; if (!enabled) clear_events(); }
+	const std::vector<osd_ticks_t> &event_times() const { return m_event_times; }
+	osd_ticks_t event_time() const { return m_event_time; }
+	void set_event_time(osd_ticks_t time) { m_event_time = time; }
+	void event_item_added(input_device_item &item) { m_event_items.push_back(&item); }
+	void event_time_added(osd_ticks_t time) { m_event_times.push_back(time); }
+	void clear_events();
+
 private:
 	// internal helpers
 	void reset_memory();
@@ -536,6 +547,12 @@ private:
 	running_machine &   m_machine;
 	input_code          m_switch_memory[64];
 
+	// events posted by the OSD since the last frame
+	bool                m_events_enabled;       // whether the OSD's events are being collected
+	std::vector<input_device_item *> m_event_items; // items with posted events
+	std::vector<osd_ticks_t> m_event_times; // host times of all posted events
+	osd_ticks_t         m_event_time;           // host time items are being read at, or 0 for now
+
 	// classes
 	std::array<std::unique_ptr<input_class>, DEVICE_CLASS_MAXIMUM> m_class;
 };
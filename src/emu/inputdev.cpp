@@ -673,7 +673,8 @@ input_device_item::input_device_item(input_device &device, const char *name, voi
 		m_itemid(itemid),
 		m_itemclass(itemclass),
 		m_getstate(getstate),
-		m_current(0)
+		m_current(0),
+		m_event_base(0)
 {
 	const char *standard_token = manager().standard_token(itemid);
 	if (standard_token)
@@ -712,6 +713,54 @@ bool input_device_item::check_axis(input_item_modifier modifier, s32 memory)
 }
 
 
+//-------------------------------------------------
+//  post_event - record a change reported by the
+//  OSD with the host time it happened at; must be
+//  called before the state read by the item's
+//  callback is updated
+//-------------------------------------------------
+
+void input_device_item::post_event(s32 value, osd_ticks_t timestamp)
+{
+	input_manager &input = manager();
+	if (!input.events_enabled())
+		return;
+
+	if (m_events.empty())
+	{
+		// the last value read is the state the frame started with
+		m_event_base = m_current;
+		input.event_item_added(*this);
+	}
+	else if (timestamp < m_events.back().first)
+	{
+		// keep the history ordered if events arrive out of order
+		timestamp = m_events.back().first;
+	}
+
+	m_events.emplace_back(timestamp, value);
+	input.event_time_added(timestamp);
+}
+
+
+//-------------------------------------------------
+//  event_value - return the raw value the item
+//  had at the given host time
+//-------------------------------------------------
+
+s32 input_device_item::event_value(osd_ticks_t time) const
+{
+	s32 result = m_event_base;
+	for (auto const &event : m_events)
+	{
+		if (event.first > time)
+			break;
+		result = event.second;
+	}
+	return result;
+}
+
+
 //**************************************************************************
 //  INPUT DEVICE SWITCH ITEM
 //**************************************************************************
@@ -110,6 +110,11 @@ public:
 	s32 update_value();
 	bool check_axis(input_item_modifier modifier, s32 memory);
 
+	// timestamped events
+	void post_event(s32 value, osd_ticks_t timestamp);
+	s32 event_value(osd_ticks_t time) const;
+	void clear_events() { m_events.clear(); }
+
 	// readers
 	virtual s32 read_as_switch(input_item_modifier modifier) = 0;
 	virtual s32 read_as_relative(input_item_modifier modifier) = 0;
@@ -128,6 +133,10 @@ protected:
 
 	// live state
 	s32                     m_current;              // current raw value
+
+	// events posted since the last frame
+	std::vector<std::pair<osd_ticks_t, s32> > m_events; // host time and raw value of each change
+	s32                     m_event_base;           // raw value before the first change
 };
 
 
@@ -401,6 +410,12 @@ protected:
 inline input_manager &input_device_item::manager() const { return m_device.manager(); }
 inline running_machine &input_device_item::machine() const { return m_device.machine(); }
 inline input_code input_device_item::code() const { return input_code(m_device.devclass(), m_device.devindex(), m_itemclass, ITEM_MODIFIER_NONE, m_itemid); }
-inline s32 input_device_item::update_value() { return m_current = (*m_getstate)(m_device.internal(), m_internal); }
+inline s32 input_device_item::update_value()
+{
+	// while the input manager replays an earlier host time, items with events answer from their history
+	if (!m_events.empty() && manager().event_time())
+		return m_current = event_value(manager().event_time());
+	return m_current = (*m_getstate)(m_device.internal(), m_internal);
+}
 
 #endif  // MAME_EMU_INPUTDEV_H
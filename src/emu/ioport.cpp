@@ -92,6 +92,7 @@
 
 #include "emu.h"
 #include "emuopts.h"
+#include "network.h"
 #include "config.h"
 #include "xmlfile.h"
 #include "profiler.h"
@@ -1194,6 +1195,27 @@ void ioport_field::frame_update(ioport_value &result)
 }
 
 
+//-------------------------------------------------
+//  event_update - update a plain switch to its
+//  state at the host time being replayed; fields
+//  with per-frame processing keep their value
+//-------------------------------------------------
+
+void ioport_field::event_update(ioport_value &result)
+{
+	// analog, toggle, impulse, joystick and coin handling all count in frames
+	if (!enabled() || m_live->analog || m_live->lockout || m_live->toggle || m_live->joystick || m_impulse)
+		return;
+	if (m_type >= IPT_COIN1 && m_type <= IPT_COIN12)
+		return;
+
+	if (m_digital_value || machine().input().seq_pressed(seq()))
+		result |= m_mask;
+	else
+		result &= ~m_mask;
+}
+
+
 //-------------------------------------------------
 //  crosshair_read - compute the crosshair
 //  position
@@ -1497,6 +1519,19 @@ void ioport_port::frame_update()
 }
 
 
+//-------------------------------------------------
+//  event_update - re-evaluate the fields that can
+//  change part way through a frame at the host
+//  time the input manager is replaying
+//-------------------------------------------------
+
+void ioport_port::event_update(ioport_value &digital)
+{
+	for (ioport_field &field : fields())
+		field.event_update(digital);
+}
+
+
 //-------------------------------------------------
 //  collapse_fields - remove any fields that are
 //  wholly overlapped by other fields
@@ -1650,10 +1685,16 @@ ioport_manager::ioport_manager(running_machine &machine)
 		m_safe_to_read(false),
 		m_last_frame_time(attotime::zero),
 		m_last_delta_nsec(0),
+		m_input_events(false),
+		m_event_window_start(0),
+		m_event_next(0),
+		m_event_timer(nullptr),
 		m_record_file(machine.options().input_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS),
 		m_playback_file(machine.options().input_directory(), OPEN_FLAG_READ),
 		m_playback_accumulated_speed(0),
 		m_playback_accumulated_frames(0),
+		m_playback_hash_file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS),
+		m_playback_hash_interval(0),
 		m_timecode_file(machine.options().input_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS),
 		m_timecode_count(0),
 		m_timecode_last_time(attotime::zero)
@@ -1740,6 +1781,12 @@ time_t ioport_manager::initialize()
 	time_t basetime = playback_init();
 	record_init();
 	timecode_init();
+
+	// collect timestamped events from the OSD if they're to be applied within frames
+	m_input_events = machine().options().input_events();
+	m_event_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(ioport_manager::input_event_callback), this));
+	m_event_window_start = osd_ticks();
+	machine().input().set_events_enabled(m_input_events);
 	return basetime;
 }
 
@@ -1990,6 +2037,11 @@ void ioport_manager::frame_update()
 	m_last_delta_nsec = (curtime - m_last_frame_time).as_attoseconds() / ATTOSECONDS_PER_NANOSECOND;
 	m_last_frame_time = curtime;
 
+	// changes left over from the previous frame are superseded by this one
+	m_event_changes.clear();
+	m_event_next = 0;
+	m_event_timer->adjust(attotime::never);
+
 	// update the digital joysticks
 	for (digital_joystick &joystick : m_joystick_list)
 		joystick.frame_update();
@@ -2006,8 +2058,20 @@ void ioport_manager::frame_update()
 	{
 		port.second->frame_update();
 
-		// handle playback/record
+		// handle playback
 		playback_port(*port.second.get());
+	}
+
+	// with netplay, the inputs are the ones agreed on with the peer
+	machine().network().netplay_frame_update();
+
+	// spread the host events seen since the last frame over this one
+	if (m_input_events)
+		schedule_input_events(curtime);
+
+	for (auto &port : m_portlist)
+	{
+		// handle record
 		record_port(*port.second.get());
 
 		// call device line write handlers
@@ -2021,6 +2085,126 @@ void ioport_manager::frame_update()
 }
 
 
+//-------------------------------------------------
+//  speculative_frame_update - per-frame update
+//  for frames that are being run again; host
+//  inputs stay as they were, but netplay feeds
+//  in the ones agreed on with the peer
+//-------------------------------------------------
+
+void ioport_manager::speculative_frame_update()
+{
+	if (!machine().network().netplay_active())
+		return;
+
+	g_profiler.start(PROFILER_INPUT);
+
+	machine().network().netplay_frame_update();
+
+	// call device line write handlers
+	for (auto &port : m_portlist)
+	{
+		ioport_value newvalue = port.second->read();
+		for (dynamic_field &dynfield : port.second->live().writelist)
+			if (dynfield.field().type() != IPT_OUTPUT)
+				dynfield.write(newvalue);
+	}
+
+	g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  schedule_input_events - replay the events the
+//  OSD posted since the last frame and queue the
+//  port changes they cause, keeping their host
+//  spacing relative to the first one
+//-------------------------------------------------
+
+void ioport_manager::schedule_input_events(const attotime &curtime)
+{
+	input_manager &input = machine().input();
+	osd_ticks_t const window_start = m_event_window_start;
+	osd_ticks_t const window_end = m_event_window_start = osd_ticks();
+
+	// recorded, played back and netplay inputs have to stay frame-aligned
+	bool const usable = !m_record_file.is_open() && !m_playback_file.is_open() && !machine().network().netplay_active() && !machine().ui().is_menu_active();
+	m_event_times.assign(input.event_times().begin(), input.event_times().end());
+	if (!usable || m_event_times.empty() || m_last_delta_nsec == 0)
+	{
+		input.clear_events();
+		return;
+	}
+	std::sort(m_event_times.begin(), m_event_times.end());
+	m_event_times.erase(std::unique(m_event_times.begin(), m_event_times.end()), m_event_times.end());
+
+	// the state as of the first event applies at the start of the frame as before, and later
+	// events keep their host spacing from it, scaled to the length of the last frame
+	osd_ticks_t const first = m_event_times.front();
+	osd_ticks_t const span = std::max<osd_ticks_t>(window_end - std::min(window_start, first), m_event_times.back() - first + 1);
+	for (auto &port : m_portlist)
+	{
+		ioport_port &curport = *port.second;
+		ioport_value const latest = curport.live().digital;
+
+		input.set_event_time(first);
+		ioport_value previous = latest;
+		curport.event_update(previous);
+		curport.live().digital = previous;
+
+		for (auto it = std::next(m_event_times.begin()); m_event_times.end() != it; ++it)
+		{
+			input.set_event_time(*it);
+			ioport_value digital = latest;
+			curport.event_update(digital);
+			if (digital != previous)
+			{
+				s64 const offset = s64(double(*it - first) * double(m_last_delta_nsec) / double(span));
+				m_event_changes.push_back(input_event_change{ curtime + attotime::from_nsec(offset), &curport, digital });
+				previous = digital;
+			}
+		}
+
+		// whatever the replay misses still gets applied by the end of the frame
+		if (previous != latest)
+			m_event_changes.push_back(input_event_change{ curtime + attotime::from_nsec(m_last_delta_nsec), &curport, latest });
+	}
+	input.clear_events();
+
+	std::stable_sort(
+			m_event_changes.begin(),
+			m_event_changes.end(),
+			[] (input_event_change const &a, input_event_change const &b) { return a.time < b.time; });
+	if (!m_event_changes.empty())
+		m_event_timer->adjust(m_event_changes.front().time - curtime);
+}
+
+
+//-------------------------------------------------
+//  input_event_callback - apply the port changes
+//  that are due
+//-------------------------------------------------
+
+void ioport_manager::input_event_callback(void *ptr, s32 param)
+{
+	attotime const curtime = machine().time();
+	while ((m_event_changes.size() > m_event_next) && (m_event_changes[m_event_next].time <= curtime))
+	{
+		input_event_change const &change = m_event_changes[m_event_next++];
+		change.port->live().digital = change.digital;
+
+		// call device line write handlers
+		ioport_value newvalue = change.port->read();
+		for (dynamic_field &dynfield : change.port->live().writelist)
+			if (dynfield.field().type() != IPT_OUTPUT)
+				dynfield.write(newvalue);
+	}
+
+	if (m_event_changes.size() > m_event_next)
+		m_event_timer->adjust(m_event_changes[m_event_next].time - curtime);
+}
+
+
 //-------------------------------------------------
 //  frame_interpolate - interpolate between two
 //  values based on the time between frames
@@ -2588,6 +2772,21 @@ time_t ioport_manager::playback_init()
 
 	// enable compression
 	m_playback_file.compress(FCOMPRESS_MEDIUM);
+
+	// when verifying, nothing is shown or heard until the end of playback
+	const char *hashname = machine().options().playback_hash();
+	if (hashname[0] != 0)
+	{
+		if (m_playback_hash_file.open(hashname) != osd_file::error::NONE)
+			osd_printf_warning("Unable to open playback hash file %s\n", hashname);
+		else
+		{
+			m_playback_hash_interval = machine().options().playback_hash_interval();
+			m_playback_hash_file.printf("# %s, %s\n", machine().system().name, emulator_info::get_build_version());
+			machine().video().set_compute_only(true);
+			machine().video().set_throttled(false);
+		}
+	}
 	return basetime;
 }
 
@@ -2604,6 +2803,17 @@ void ioport_manager::playback_end(const char *message)
 		// close the file
 		m_playback_file.close();
 
+		// finish verifying and show where we ended up; at exit, the machine is already being torn down
+		if (m_playback_hash_file.is_open())
+		{
+			if (message != nullptr)
+				playback_hash();
+			m_playback_hash_file.close();
+			m_playback_state.clear();
+			machine().video().set_compute_only(false);
+			machine().video().set_throttled(machine().options().throttle());
+		}
+
 		// pop a message
 		if (message != nullptr)
 			machine().popmessage("Playback Ended\nReason: %s", message);
@@ -2646,10 +2856,39 @@ void ioport_manager::playback_frame(const attotime &curtime)
 		u32 curspeed;
 		m_playback_accumulated_speed += playback_read(curspeed);
 		m_playback_accumulated_frames++;
+
+		// checkpoint the state when verifying
+		if (m_playback_hash_file.is_open() && (m_playback_accumulated_frames % m_playback_hash_interval) == 0)
+			playback_hash();
 	}
 }
 
 
+//-------------------------------------------------
+//  playback_hash - write a hash of the machine
+//  state at this point of the playback, so runs
+//  of different builds can be compared line by
+//  line to find where they diverge
+//-------------------------------------------------
+
+void ioport_manager::playback_hash()
+{
+	if (m_playback_state.empty())
+		m_playback_state.resize(ram_state::get_size(machine().save()));
+
+	save_error const err = machine().save().write_buffer(&m_playback_state[0], m_playback_state.size());
+	if (err != STATERR_NONE)
+	{
+		m_playback_hash_file.printf("%u %s error %d\n", m_playback_accumulated_frames, machine().time().as_string(9), int(err));
+		return;
+	}
+
+	util::sha1_creator sha1;
+	sha1.append(&m_playback_state[0], m_playback_state.size());
+	m_playback_hash_file.printf("%u %s %s\n", m_playback_accumulated_frames, machine().time().as_string(9), sha1.finish().as_string());
+}
+
+
 //-------------------------------------------------
 //  playback_port - per-port callback for playback
 //-------------------------------------------------
@@ -1090,6 +1090,7 @@ public:
 	float crosshair_read();
 	void init_live_state(analog_field *analog);
 	void frame_update(ioport_value &result);
+	void event_update(ioport_value &result);
 	void reduce_mask(ioport_value bits_to_remove) { m_mask &= ~bits_to_remove; }
 
 	// user-controllable settings for a field
@@ -1223,6 +1224,7 @@ public:
 	ioport_field *field(ioport_value mask) const;
 	void collapse_fields(std::string &errorbuf);
 	void frame_update();
+	void event_update(ioport_value &digital);
 	void init_live_state();
 	void update_defvalue(bool flush_defaults);
 
@@ -1406,6 +1408,7 @@ public:
 	s32 frame_interpolate(s32 oldval, s32 newval);
 	ioport_type token_to_input_type(const char *string, int &player) const;
 	std::string input_type_to_token(ioport_type type, int player);
+	void speculative_frame_update();
 
 private:
 	// internal helpers
@@ -1414,6 +1417,8 @@ private:
 
 	void frame_update_callback();
 	void frame_update();
+	void schedule_input_events(const attotime &curtime);
+	void input_event_callback(void *ptr, s32 param);
 
 	ioport_port *port(const std::string &tag) const { auto search = m_portlist.find(tag); if (search != m_portlist.end()) return search->second.get(); else return nullptr; }
 	void exit();
@@ -1435,6 +1440,7 @@ private:
 	time_t playback_init();
 	void playback_end(const char *message = nullptr);
 	void playback_frame(const attotime &curtime);
+	void playback_hash();
 	void playback_port(ioport_port &port);
 
 	template<typename _Type> void record_write(_Type value);
@@ -1463,11 +1469,28 @@ private:
 	attotime                m_last_frame_time;      // time of the last frame callback
 	attoseconds_t           m_last_delta_nsec;      // nanoseconds that passed since the previous callback
 
+	// host input events spread over the frame
+	struct input_event_change
+	{
+		attotime        time;                       // when to apply the change
+		ioport_port *   port;                       // port whose digital state changes
+		ioport_value    digital;                    // new digital state
+	};
+	bool                    m_input_events;         // whether events are applied within the frame
+	osd_ticks_t             m_event_window_start;   // host time of the previous frame callback
+	std::vector<osd_ticks_t> m_event_times;         // distinct host times of this frame's events
+	std::vector<input_event_change> m_event_changes; // port changes still to be applied
+	unsigned                m_event_next;           // index of the next change to apply
+	emu_timer *             m_event_timer;          // timer that applies the changes
+
 	// playback/record information
 	emu_file                m_record_file;          // recording file (nullptr if not recording)
 	emu_file                m_playback_file;        // playback file (nullptr if not recording)
 	u64                     m_playback_accumulated_speed; // accumulated speed during playback
 	u32                     m_playback_accumulated_frames; // accumulated frames during playback
+	emu_file                m_playback_hash_file;   // state hashes written while verifying playback
+	u32                     m_playback_hash_interval; // frames between state hashes
+	std::vector<u8>         m_playback_state;       // buffer the state is hashed from
 	emu_file                m_timecode_file;        // timecode/frames playback file (nullptr if not recording)
 	int                     m_timecode_count;
 	attotime                m_timecode_last_time;
@@ -87,7 +87,9 @@
 #include "natkeyboard.h"
 #include "ui/uimain.h"
 #include "corestr.h"
+#include <algorithm>
 #include <ctime>
+#include <sstream>
 #include <rapidjson/writer.h>
 #include <rapidjson/stringbuffer.h>
 
@@ -97,6 +99,25 @@
 
 
 
+//-------------------------------------------------
+//  profile_work_item - add an OSD work item to
+//  the scope timeline
+//-------------------------------------------------
+
+static void profile_work_item(const char *thread, osd_ticks_t start, osd_ticks_t end)
+{
+	static util::scope_profiler::scope_id const s_scope = util::scope_profiler::register_scope("work item");
+	thread_local bool t_named = false;
+	if (thread && !t_named)
+	{
+		util::scope_profiler::set_thread_name(thread);
+		t_named = true;
+	}
+	util::scope_profiler::record(s_scope, start, end);
+}
+
+
+
 //**************************************************************************
 //  RUNNING MACHINE
 //**************************************************************************
@@ -128,6 +149,9 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 		m_saveload_schedule(saveload_schedule::NONE),
 		m_saveload_schedule_time(attotime::zero),
 		m_saveload_searchpath(nullptr),
+		m_saveload_writing(false),
+		m_memory_sample_frames(0),
+		m_bench_cpu_start(0.0),
 
 		m_save(*this),
 		m_memory(*this),
@@ -149,6 +173,8 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 	// fetch core options
 	if (options().debug())
 		debug_flags = (DEBUG_FLAG_ENABLED | DEBUG_FLAG_CALL_HOOK) | (DEBUG_FLAG_OSD_ENABLED);
+	if (*options().opcode_stats())
+		debug_flags |= DEBUG_FLAG_OPCODE_STATS;
 }
 
 
@@ -204,7 +230,10 @@ void running_machine::start()
 	m_ui_input = std::make_unique<ui_input_manager>(*this);
 
 	// init the osd layer
-	m_manager.osd().init(*this);
+	{
+		machine_manager::startup_phase phase(m_manager, "OSD init");
+		m_manager.osd().init(*this);
+	}
 
 	// create the video manager
 	m_video = std::make_unique<video_manager>(*this);
@@ -235,8 +264,15 @@ void running_machine::start()
 	// needs rom bases), and finally initialize CPUs (which needs
 	// complete address spaces).  These operations must proceed in this
 	// order
-	m_rom_load = std::make_unique<rom_load_manager>(*this);
-	m_memory.initialize();
+	util::archive_file::set_index_path(options().archive_index_directory());
+	{
+		machine_manager::startup_phase phase(m_manager, "ROM load");
+		m_rom_load = std::make_unique<rom_load_manager>(*this);
+	}
+	{
+		machine_manager::startup_phase phase(m_manager, "memory map");
+		m_memory.initialize();
+	}
 
 	// save the random seed or save states might be broken in drivers that use the rand() method
 	save().save_item(NAME(m_rand_seed));
@@ -246,6 +282,8 @@ void running_machine::start()
 	m_tilemap = std::make_unique<tilemap_manager>(*this);
 	m_crosshair = std::make_unique<crosshair_manager>(*this);
 	m_network = std::make_unique<network_manager>(*this);
+	if (m_network->netplay_base_time() != 0)
+		m_base_time = m_network->netplay_base_time();
 
 	// initialize the debugger
 	if ((debug_flags & DEBUG_FLAG_ENABLED) != 0)
@@ -260,13 +298,55 @@ void running_machine::start()
 	for (device_t &device : device_enumerator(root_device()))
 		device.resolve_post_map();
 
+	// hardware counters are charged to profiler entries and device profile samples when available
+	if (options().perf_counters())
+	{
+		if (osd_perf_counters_open())
+			g_profiler.enable_perf_counters(true);
+		else
+			osd_printf_warning("Hardware performance counters aren't available on this host\n");
+	}
+
+	// start writing per-device statistics and scheduler traces if requested
+	m_scheduler.open_device_profile();
+	m_scheduler.open_trace();
+
 	// register callbacks for the devices, then start them
 	add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&running_machine::reset_all_devices, this));
 	add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::stop_all_devices, this));
 	save().register_presave(save_prepost_delegate(FUNC(running_machine::presave_all_devices), this));
-	start_all_devices();
+	{
+		machine_manager::startup_phase phase(m_manager, "device start");
+		start_all_devices();
+	}
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
 
+	// devices may have installed handlers of their own, so report the decode trees now
+	if (*options().memmap_report())
+		m_memory.write_map_report(options().memmap_report());
+
+	// sample memory use from here on so the report has peak figures
+	if (*options().mem_report())
+	{
+		sample_memory();
+		add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&running_machine::memory_report_frame, this));
+	}
+
+	// benchmark figures only cover running, not startup; the profiler is a no-op unless built in
+	if (*options().bench_report())
+	{
+		m_bench_cpu_start = osd_get_process_cpu_time();
+		g_profiler.enable(true);
+	}
+
+	// the scope timeline runs in host time across all threads
+	if (*options().profile_trace())
+	{
+		util::scope_profiler::set_thread_name("main");
+		util::scope_profiler::start(options().profile_trace_events());
+		osd_work_set_profile_callback(&profile_work_item);
+	}
+
 	// save outputs created before start time
 	output().register_save();
 
@@ -284,6 +364,14 @@ void running_machine::start()
 	if (filename[0] != 0 && !m_video->is_recording())
 		m_video->begin_recording(filename, movie_recording::format::AVI);
 
+	filename = options().encoder_write();
+	if (filename[0] != 0 && !m_video->is_recording())
+		m_video->begin_recording(filename, movie_recording::format::ENCODER);
+
+	filename = options().shm_write();
+	if (filename[0] != 0 && !m_video->is_recording())
+		m_video->begin_recording(filename, movie_recording::format::SHARED);
+
 	// if we're coming in with a savegame request, process it now
 	const char *savegame = options().state();
 	if (savegame[0] != 0)
@@ -361,6 +449,7 @@ int running_machine::run(bool quiet)
 
 		// perform a soft reset -- this takes us to the running phase
 		soft_reset();
+		manager().startup_complete();
 
 		// handle initial load
 		if (m_saveload_schedule != saveload_schedule::NONE)
@@ -380,9 +469,17 @@ int running_machine::run(bool quiet)
 		{
 			g_profiler.start(PROFILER_EXTRA);
 
-			// execute CPUs if not paused
+			// execute CPUs if not paused, with netplay and run-ahead after each frame
 			if (!m_paused)
+			{
 				m_scheduler.timeslice();
+				if (m_video->take_frame_completed())
+				{
+					m_network->netplay_frame_completed();
+					if (m_video->runahead())
+						run_ahead();
+				}
+			}
 			// otherwise, just pump video updates through
 			else
 				m_video->frame_update();
@@ -390,10 +487,19 @@ int running_machine::run(bool quiet)
 			// handle save/load
 			if (m_saveload_schedule != saveload_schedule::NONE)
 				handle_saveload();
+			else if (m_saveload_writing && !m_save.write_pending())
+				report_async_save();
 
 			g_profiler.stop();
 		}
 		m_manager.http()->clear();
+		if (m_http_metrics)
+			m_manager.http()->remove_endpoint("/api/metrics");
+
+		// make sure a state being saved in the background is complete
+		m_saveload_writing = false;
+		if (m_save.finish_write(true) != STATERR_NONE)
+			osd_printf_error("Error: Unable to save state due to a write error.\n");
 
 		// and out via the exit phase
 		m_current_phase = machine_phase::EXIT;
@@ -943,15 +1049,19 @@ void running_machine::handle_saveload()
 		{
 			u32 const openflags = (m_saveload_schedule == saveload_schedule::LOAD) ? OPEN_FLAG_READ : (OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
 
+			// a previous save may still be on its way to the disk
+			if (m_saveload_writing)
+				report_async_save();
+
 			// open the file
-			emu_file file(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
-			auto const filerr = file.open(m_saveload_pending_file);
+			auto file = std::make_unique<emu_file>(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
+			auto const filerr = file->open(m_saveload_pending_file);
 			if (filerr == osd_file::error::NONE)
 			{
 				const char *const opnamed = (m_saveload_schedule == saveload_schedule::LOAD) ? "loaded" : "saved";
 
-				// read/write the save state
-				save_error saverr = (m_saveload_schedule == saveload_schedule::LOAD) ? m_save.read_file(file) : m_save.write_file(file);
+				// read the save state, or take a snapshot of it and leave compressing and writing to a work queue
+				save_error saverr = (m_saveload_schedule == saveload_schedule::LOAD) ? m_save.read_file(*file) : m_save.write_file_async(std::move(file));
 
 				// handle the result
 				switch (saverr)
@@ -973,7 +1083,10 @@ void running_machine::handle_saveload()
 					break;
 
 				case STATERR_NONE:
-					if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
+					// a save is only reported once it has made it to the disk
+					if (m_saveload_schedule == saveload_schedule::SAVE)
+						m_saveload_writing = true;
+					else if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
 						popmessage("State successfully %s.\nWarning: Save states are not officially supported for this machine.", opnamed);
 					else
 						popmessage("State successfully %s.", opnamed);
@@ -985,8 +1098,8 @@ void running_machine::handle_saveload()
 				}
 
 				// close and perhaps delete the file
-				if (saverr != STATERR_NONE && m_saveload_schedule == saveload_schedule::SAVE)
-					file.remove_on_close();
+				if (saverr != STATERR_NONE && m_saveload_schedule == saveload_schedule::SAVE && file)
+					file->remove_on_close();
 			}
 			else if (openflags == OPEN_FLAG_READ && filerr == osd_file::error::NOT_FOUND)
 			{
@@ -1007,6 +1120,54 @@ void running_machine::handle_saveload()
 }
 
 
+//-------------------------------------------------
+//  report_async_save - wait for the save being
+//  written in the background and report how it
+//  went
+//-------------------------------------------------
+
+void running_machine::report_async_save()
+{
+	m_saveload_writing = false;
+	if (m_save.finish_write(true) != STATERR_NONE)
+		popmessage("Error: Unable to save state due to a write error. Verify there is enough disk space.");
+	else if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
+		popmessage("State successfully saved.\nWarning: Save states are not officially supported for this machine.");
+	else
+		popmessage("State successfully saved.");
+}
+
+
+//-------------------------------------------------
+//  run_ahead - snapshot the machine, run the
+//  frames after the one just completed with the
+//  current inputs, showing only the last, then go
+//  back to the snapshot; that many frames of the
+//  system's own input lag are hidden
+//-------------------------------------------------
+
+void running_machine::run_ahead()
+{
+	// anonymous timers can't be saved, so don't run ahead of this frame
+	if (!m_scheduler.can_save())
+		return;
+
+	// the snapshot buffer is sized once and reused every frame
+	if (!m_runahead_state)
+		m_runahead_state = std::make_unique<ram_state>(m_save);
+	if (m_runahead_state->save() != STATERR_NONE)
+		return;
+
+	m_video->begin_speculation(m_video->runahead(), true);
+	while (m_video->speculating() && !m_hard_reset_pending && !m_exit_pending)
+		m_scheduler.timeslice();
+	m_video->end_speculation();
+
+	if (m_runahead_state->load() != STATERR_NONE)
+		logerror("Error restoring state after running ahead\n");
+}
+
+
 //-------------------------------------------------
 //  soft_reset - actually perform a soft-reset
 //  of the system
@@ -1112,9 +1273,308 @@ void running_machine::stop_all_devices()
 	if ((debug_flags & DEBUG_FLAG_ENABLED) != 0)
 		debugger().cpu().comment_save();
 
+	// disassembling and saving need the devices, so write the statistics before stopping anything
+	if (*options().opcode_stats())
+		write_opcode_stats(options().opcode_stats());
+	if (*options().state_report())
+		m_save.write_state_report(options().state_report());
+	if (*options().mem_report())
+		write_memory_report(options().mem_report());
+	if (*options().bench_report())
+		write_bench_report(options().bench_report());
+	if (*options().profile_trace())
+		write_profile_trace(options().profile_trace());
+
 	// iterate over devices and stop them
 	for (device_t &device : device_enumerator(root_device()))
 		device.stop();
+
+	if (options().perf_counters())
+	{
+		g_profiler.enable_perf_counters(false);
+		osd_perf_counters_close();
+	}
+}
+
+
+//-------------------------------------------------
+//  write_opcode_stats - write the executed
+//  instruction counts of every CPU by mnemonic
+//-------------------------------------------------
+
+void running_machine::write_opcode_stats(const char *filename)
+{
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(filename) != osd_file::error::NONE)
+	{
+		osd_printf_warning("Unable to open opcode statistics file %s\n", filename);
+		return;
+	}
+
+	for (device_execute_interface &exec : execute_interface_enumerator(root_device()))
+	{
+		std::vector<std::pair<std::string, u64> > const stats = exec.opcode_stats();
+		if (stats.empty())
+			continue;
+
+		u64 total = 0;
+		for (auto const &stat : stats)
+			total += stat.second;
+
+		file.printf("%s (%s): %u instructions\n", exec.device().tag(), exec.device().shortname(), total);
+		for (auto const &stat : stats)
+			file.printf("  %-16s %12u %6.2f%%\n", stat.first, stat.second, double(stat.second) * 100.0 / double(total));
+		file.puts("\n");
+	}
+}
+
+
+//-------------------------------------------------
+//  add_memory_reporter - register a function that
+//  returns the bytes a device has allocated for
+//  something the core can't see itself
+//-------------------------------------------------
+
+void running_machine::add_memory_reporter(device_t &owner, std::string &&category, std::function<size_t ()> &&bytes)
+{
+	m_memory_reporters.emplace_back(memory_reporter{ owner, std::move(category), std::move(bytes) });
+}
+
+
+//-------------------------------------------------
+//  sample_memory - measure the memory currently
+//  allocated by each device and subsystem, and
+//  update the peak figures
+//-------------------------------------------------
+
+void running_machine::sample_memory()
+{
+	for (auto &usage : m_memory_usage)
+		usage.second.current = 0;
+
+	const auto account = [this] (std::string const &owner, char const *category, size_t bytes)
+	{
+		if (bytes)
+			m_memory_usage[std::make_pair(owner, std::string(category))].current += bytes;
+	};
+
+	// regions and shares are named by tag; charge them to the closest device
+	const auto owner_of = [this] (std::string tag)
+	{
+		while (!root_device().subdevice(tag))
+		{
+			std::string::size_type const pos = tag.rfind(':');
+			if (pos == 0 || pos == std::string::npos)
+				return std::string(root_device().tag());
+			tag.resize(pos);
+		}
+		return tag;
+	};
+	for (auto const &region : m_memory.regions())
+		account(owner_of(region.first), "regions", region.second->bytes());
+	for (auto const &share : m_memory.shares())
+		account(owner_of(share.first), "shares", share.second->bytes());
+
+	for (device_gfx_interface &gfx : gfx_interface_enumerator(root_device()))
+		for (int i = 0; i < MAX_GFX_ELEMENTS; i++)
+			if (gfx.gfx(i))
+				account(gfx.device().tag(), "gfx elements", gfx.gfx(i)->memory_bytes());
+
+	for (int i = 0; i < m_tilemap->count(); i++)
+	{
+		tilemap_t const *const tmap = m_tilemap->find(i);
+		account(tmap->device() ? tmap->device()->tag() : root_device().tag(), "tilemaps", tmap->memory_bytes());
+	}
+
+	for (screen_device &screen : screen_device_enumerator(root_device()))
+		account(screen.tag(), "screen bitmaps", screen.bitmap_bytes());
+
+	for (auto const &stream : m_sound->streams())
+		account(stream->device().tag(), "sound buffers", stream->buffer_bytes());
+
+	size_t state_bytes = m_save.buffer_bytes();
+	if (m_runahead_state)
+		state_bytes += m_runahead_state->bytes();
+	account(root_device().tag(), "save states", state_bytes);
+
+	for (memory_reporter const &reporter : m_memory_reporters)
+		account(reporter.m_owner.tag(), reporter.m_category.c_str(), reporter.m_bytes());
+
+	for (auto &usage : m_memory_usage)
+		usage.second.peak = std::max(usage.second.peak, usage.second.current);
+}
+
+
+//-------------------------------------------------
+//  memory_report - describe the memory allocated
+//  by each device, largest first, followed by the
+//  totals for each kind of allocation
+//-------------------------------------------------
+
+std::string running_machine::memory_report()
+{
+	sample_memory();
+
+	struct group
+	{
+		std::string name;
+		size_t current = 0;
+		size_t peak = 0;
+		std::vector<std::pair<std::string const *, memory_usage_item const *> > items;
+	};
+	std::vector<group> owners;
+	std::map<std::string, group> categories;
+	std::map<std::string, size_t> lookup;
+	size_t total = 0;
+	for (auto const &usage : m_memory_usage)
+	{
+		auto const found = lookup.emplace(usage.first.first, owners.size());
+		if (found.second)
+			owners.emplace_back().name = usage.first.first;
+
+		group &g = owners[found.first->second];
+		g.current += usage.second.current;
+		g.peak += usage.second.peak;
+		g.items.emplace_back(&usage.first.second, &usage.second);
+
+		group &c = categories[usage.first.second];
+		c.current += usage.second.current;
+		c.peak += usage.second.peak;
+		total += usage.second.current;
+	}
+	std::sort(owners.begin(), owners.end(), [] (group const &a, group const &b) { return a.current > b.current; });
+
+	// the peaks are sampled separately, so a group's peak is the sum of its parts' peaks
+	std::ostringstream result;
+	util::stream_format(result, "Memory: %u bytes from %u owners\n\n", total, owners.size());
+	util::stream_format(result, "%-48s %14s %14s\n", "Owner/category", "bytes", "peak");
+	for (group const &g : owners)
+	{
+		util::stream_format(result, "%-48s %14u %14u\n", g.name, g.current, g.peak);
+		for (auto const &item : g.items)
+			util::stream_format(result, "  %-46s %14u %14u\n", *item.first, item.second->current, item.second->peak);
+	}
+	util::stream_format(result, "\n%-48s %14s %14s\n", "Category", "bytes", "peak");
+	for (auto const &c : categories)
+		util::stream_format(result, "%-48s %14u %14u\n", c.first, c.second.current, c.second.peak);
+	return std::move(result).str();
+}
+
+
+//-------------------------------------------------
+//  write_memory_report - write the memory report
+//  to a file
+//-------------------------------------------------
+
+void running_machine::write_memory_report(const char *filename)
+{
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(filename) != osd_file::error::NONE)
+	{
+		osd_printf_warning("Unable to open memory report file %s\n", filename);
+		return;
+	}
+
+	file.puts(memory_report());
+}
+
+
+//-------------------------------------------------
+//  bench_report - describe how fast the machine
+//  ran as a JSON object
+//-------------------------------------------------
+
+std::string running_machine::bench_report()
+{
+	double const emulated = m_video->overall_emulated_time().as_double();
+	double const real = m_video->overall_real_time();
+
+	rapidjson::StringBuffer s;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+	writer.StartObject();
+	writer.Key("system");
+	writer.String(system().name);
+	writer.Key("build");
+	writer.String(emulator_info::get_build_version());
+	writer.Key("emulated_seconds");
+	writer.Double(emulated);
+	writer.Key("real_seconds");
+	writer.Double(real);
+	writer.Key("speed_percent");
+	writer.Double((real > 0.0) ? (100.0 * emulated / real) : 0.0);
+	writer.Key("host_cpu_seconds");
+	writer.Double(osd_get_process_cpu_time() - m_bench_cpu_start);
+	writer.Key("peak_rss_bytes");
+	writer.Uint64(osd_get_peak_memory_usage());
+	writer.Key("profiler");
+	writer.StartObject();
+	g_profiler.overall(
+			*this,
+			[&writer] (const char *name, double percent)
+			{
+				writer.Key(name);
+				writer.Double(percent);
+			});
+	writer.EndObject();
+	writer.EndObject();
+	return std::string(s.GetString(), s.GetSize());
+}
+
+
+//-------------------------------------------------
+//  write_bench_report - write the benchmark
+//  report to a file
+//-------------------------------------------------
+
+void running_machine::write_bench_report(const char *filename)
+{
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(filename) != osd_file::error::NONE)
+	{
+		osd_printf_warning("Unable to open benchmark report file %s\n", filename);
+		return;
+	}
+
+	file.puts(bench_report());
+	file.puts("\n");
+}
+
+
+//-------------------------------------------------
+//  write_profile_trace - stop recording scopes
+//  and write the timeline to a file
+//-------------------------------------------------
+
+void running_machine::write_profile_trace(const char *filename)
+{
+	osd_work_set_profile_callback(nullptr);
+	util::scope_profiler::stop();
+
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(filename) != osd_file::error::NONE)
+	{
+		osd_printf_warning("Unable to open profile trace file %s\n", filename);
+		return;
+	}
+
+	std::ostringstream trace;
+	util::scope_profiler::write_json(trace);
+	file.puts(trace.str());
+}
+
+
+//-------------------------------------------------
+//  memory_report_frame - sample memory use about
+//  once a second
+//-------------------------------------------------
+
+void running_machine::memory_report_frame()
+{
+	if (m_memory_sample_frames-- == 0)
+	{
+		m_memory_sample_frames = 60;
+		sample_memory();
+	}
 }
 
 
@@ -1264,9 +1724,202 @@ running_machine::logerror_callback_item::logerror_callback_item(logerror_callbac
 {
 }
 
+//-------------------------------------------------
+//  http_metrics - per-frame performance figures,
+//  gathered on the emulation thread and read by
+//  the HTTP server thread
+//-------------------------------------------------
+
+class running_machine::http_metrics
+{
+public:
+	http_metrics(running_machine &machine);
+
+	void frame_update();
+	std::string prometheus_text();
+
+	void add_connection(http_manager::websocket_connection_ptr connection);
+	void remove_connection(http_manager::websocket_connection_ptr connection);
+
+private:
+	struct device_figures
+	{
+		device_execute_interface *  exec;
+		std::string                 tag;                // copied, the server may ask after the machine is gone
+		u64                         total_cycles = 0;   // cycles run since start
+		u64                         frame_cycles = 0;   // cycles run in the last frame
+	};
+
+	std::string json_text() const;
+
+	running_machine &                                   m_machine;
+	std::string const                                   m_system;           // copied like the device tags
+	osd_ticks_t                                         m_last_ticks;       // when the last frame ended
+
+	std::mutex                                          m_mutex;            // guards everything below
+	u64                                                 m_frames;           // frames emulated
+	u64                                                 m_skipped_frames;   // frames not drawn
+	double                                              m_frame_seconds;    // real time taken by the last frame
+	double                                              m_speed_percent;    // most recent emulation speed
+	attotime                                            m_emulated_time;    // emulated time at the end of the last frame
+	sound_manager::statistics                           m_sound;            // audio pipeline figures
+	std::vector<device_figures>                         m_devices;          // executing devices
+	std::vector<http_manager::websocket_connection_ptr> m_connections;      // clients receiving every frame
+};
+
+
+running_machine::http_metrics::http_metrics(running_machine &machine)
+	: m_machine(machine)
+	, m_system(machine.basename())
+	, m_last_ticks(osd_ticks())
+	, m_frames(0)
+	, m_skipped_frames(0)
+	, m_frame_seconds(0.0)
+	, m_speed_percent(0.0)
+{
+	for (device_execute_interface &exec : execute_interface_enumerator(machine.root_device()))
+		m_devices.push_back(device_figures{ &exec, exec.device().tag() });
+}
+
+
+void running_machine::http_metrics::frame_update()
+{
+	osd_ticks_t const ticks = osd_ticks();
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	m_frames++;
+	if (m_machine.video().skip_this_frame())
+		m_skipped_frames++;
+	m_frame_seconds = double(ticks - m_last_ticks) / double(osd_ticks_per_second());
+	m_last_ticks = ticks;
+	m_speed_percent = m_machine.video().speed_percent() * 100.0;
+	m_emulated_time = m_machine.time();
+	m_sound = m_machine.sound().stats();
+	for (device_figures &device : m_devices)
+	{
+		u64 const cycles = device.exec->total_cycles();
+		device.frame_cycles = cycles - device.total_cycles;
+		device.total_cycles = cycles;
+	}
+
+	// only build the message when someone is listening
+	if (!m_connections.empty())
+	{
+		// send without holding the lock, the server thread takes it to add and remove connections
+		std::string const text = json_text();
+		std::vector<http_manager::websocket_connection_ptr> const connections(m_connections);
+		lock.unlock();
+		for (auto &connection : connections)
+			connection->send_message(text, 1);
+	}
+}
+
+
+std::string running_machine::http_metrics::json_text() const
+{
+	rapidjson::StringBuffer s;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+	writer.StartObject();
+	writer.Key("frame");
+	writer.Uint64(m_frames);
+	writer.Key("skipped_frames");
+	writer.Uint64(m_skipped_frames);
+	writer.Key("frame_seconds");
+	writer.Double(m_frame_seconds);
+	writer.Key("speed_percent");
+	writer.Double(m_speed_percent);
+	writer.Key("emulated_seconds");
+	writer.Double(m_emulated_time.as_double());
+	writer.Key("audio_buffer_fill");
+	writer.Double(m_sound.buffer_fill);
+	writer.Key("audio_underflows");
+	writer.Uint(m_sound.underflows);
+	writer.Key("audio_overflows");
+	writer.Uint(m_sound.overflows);
+	writer.Key("devices");
+	writer.StartObject();
+	for (device_figures const &device : m_devices)
+	{
+		writer.Key(device.tag.c_str());
+		writer.StartObject();
+		writer.Key("cycles");
+		writer.Uint64(device.total_cycles);
+		writer.Key("frame_cycles");
+		writer.Uint64(device.frame_cycles);
+		writer.EndObject();
+	}
+	writer.EndObject();
+	writer.EndObject();
+	return s.GetString();
+}
+
+
+std::string running_machine::http_metrics::prometheus_text()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	std::ostringstream text;
+	text.imbue(std::locale::classic());
+	std::string const &system = m_system;
+	auto const metric = [&text, &system] (const char *name, const char *type, const char *help, auto value)
+	{
+		util::stream_format(text, "# HELP mame_%s %s\n# TYPE mame_%s %s\nmame_%s{system=\"%s\"} %s\n", name, help, name, type, name, system, value);
+	};
+
+	metric("frames_total", "counter", "Frames emulated.", m_frames);
+	metric("skipped_frames_total", "counter", "Frames emulated without being drawn.", m_skipped_frames);
+	metric("frame_seconds", "gauge", "Real time taken by the last frame.", m_frame_seconds);
+	metric("speed_ratio", "gauge", "Emulation speed relative to real time.", m_speed_percent / 100.0);
+	metric("emulated_seconds", "gauge", "Emulated time since the machine started.", m_emulated_time.as_double());
+	if (m_sound.buffer_fill >= 0.0f)
+		metric("audio_buffer_fill_ratio", "gauge", "Fill level of the host audio buffer.", m_sound.buffer_fill);
+	metric("audio_underflows", "gauge", "Host audio buffer underruns in the last second.", m_sound.underflows);
+	metric("audio_overflows", "gauge", "Host audio buffer overruns in the last second.", m_sound.overflows);
+
+	text << "# HELP mame_device_cycles_total Cycles run by each executing device.\n# TYPE mame_device_cycles_total counter\n";
+	for (device_figures const &device : m_devices)
+		util::stream_format(text, "mame_device_cycles_total{system=\"%s\",device=\"%s\"} %u\n", system, device.tag, device.total_cycles);
+	text << "# HELP mame_device_frame_cycles Cycles run by each executing device in the last frame.\n# TYPE mame_device_frame_cycles gauge\n";
+	for (device_figures const &device : m_devices)
+		util::stream_format(text, "mame_device_frame_cycles{system=\"%s\",device=\"%s\"} %u\n", system, device.tag, device.frame_cycles);
+	return std::move(text).str();
+}
+
+
+void running_machine::http_metrics::add_connection(http_manager::websocket_connection_ptr connection)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_connections.emplace_back(std::move(connection));
+}
+
+
+void running_machine::http_metrics::remove_connection(http_manager::websocket_connection_ptr connection)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_connections.erase(std::remove(m_connections.begin(), m_connections.end(), connection), m_connections.end());
+}
+
+
 void running_machine::export_http_api()
 {
 	if (m_manager.http()->is_active()) {
+		// the handlers keep the figures alive, as the server may outlive this machine
+		m_http_metrics = std::make_shared<http_metrics>(*this);
+		add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&http_metrics::frame_update, m_http_metrics.get()));
+
+		std::shared_ptr<http_metrics> metrics(m_http_metrics);
+		m_manager.http()->add_http_handler("/metrics", [metrics] (http_manager::http_request_ptr request, http_manager::http_response_ptr response)
+		{
+			response->set_status(200);
+			response->set_content_type("text/plain; version=0.0.4");
+			response->set_body(metrics->prometheus_text());
+		});
+		m_manager.http()->remove_endpoint("/api/metrics");
+		m_manager.http()->add_endpoint("/api/metrics",
+				[metrics] (http_manager::websocket_connection_ptr connection) { metrics->add_connection(std::move(connection)); },
+				nullptr,
+				[metrics] (http_manager::websocket_connection_ptr connection, int status, const std::string &reason) { metrics->remove_connection(std::move(connection)); },
+				[metrics] (http_manager::websocket_connection_ptr connection, const std::error_code &error_code) { metrics->remove_connection(std::move(connection)); });
+
 		m_manager.http()->add_http_handler("/api/machine", [this](http_manager::http_request_ptr request, http_manager::http_response_ptr response)
 		{
 			rapidjson::StringBuffer s;
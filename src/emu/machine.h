@@ -51,6 +51,7 @@ enum machine_notification
 // debug flags
 constexpr int DEBUG_FLAG_ENABLED        = 0x00000001;       // debugging is enabled
 constexpr int DEBUG_FLAG_CALL_HOOK      = 0x00000002;       // CPU cores must call instruction hook
+constexpr int DEBUG_FLAG_OPCODE_STATS   = 0x00000004;       // instruction hook counts executed opcodes
 constexpr int DEBUG_FLAG_WPR_PROGRAM    = 0x00000010;       // watchpoints are enabled for PROGRAM memory reads
 constexpr int DEBUG_FLAG_WPR_DATA       = 0x00000020;       // watchpoints are enabled for DATA memory reads
 constexpr int DEBUG_FLAG_WPR_IO         = 0x00000040;       // watchpoints are enabled for IO memory reads
@@ -235,6 +236,17 @@ public:
 	bool rewind_step();
 	void rewind_invalidate();
 
+	// memory accounting
+	void add_memory_reporter(device_t &owner, std::string &&category, std::function<size_t ()> &&bytes);
+	void sample_memory();
+	std::string memory_report();
+	std::string bench_report();
+	template <typename T> void memory_usage(T &&callback) const
+	{
+		for (auto const &usage : m_memory_usage)
+			callback(usage.first.first, usage.first.second, usage.second.current, usage.second.peak);
+	}
+
 	// scheduled operations
 	void schedule_exit();
 	void schedule_hard_reset();
@@ -299,6 +311,8 @@ private:
 	void start();
 	void set_saveload_filename(std::string &&filename);
 	void handle_saveload();
+	void report_async_save();
+	void run_ahead();
 	void soft_reset(void *ptr = nullptr, s32 param = 0);
 	std::string nvram_filename(device_t &device) const;
 	void nvram_load();
@@ -313,6 +327,11 @@ private:
 	void start_all_devices();
 	void reset_all_devices();
 	void stop_all_devices();
+	void write_opcode_stats(const char *filename);
+	void write_memory_report(const char *filename);
+	void write_bench_report(const char *filename);
+	void write_profile_trace(const char *filename);
+	void memory_report_frame();
 	void presave_all_devices();
 	void postload_all_devices();
 
@@ -366,6 +385,29 @@ private:
 	attotime                m_saveload_schedule_time;
 	std::string             m_saveload_pending_file;
 	const char *            m_saveload_searchpath;
+	bool                    m_saveload_writing;     // a save is still being written in the background
+	std::unique_ptr<ram_state> m_runahead_state;    // state to return to after running ahead
+
+	// memory accounting
+	struct memory_reporter
+	{
+		device_t &                  m_owner;        // device the memory belongs to
+		std::string                 m_category;     // what the memory is used for
+		std::function<size_t ()>    m_bytes;        // returns the bytes currently allocated
+	};
+	struct memory_usage_item
+	{
+		size_t                      current = 0;    // bytes at the last sample
+		size_t                      peak = 0;       // most bytes seen at any sample
+	};
+	std::vector<memory_reporter> m_memory_reporters; // reporters registered by devices
+	std::map<std::pair<std::string, std::string>, memory_usage_item> m_memory_usage; // usage by owner tag and category
+	u32                     m_memory_sample_frames; // frames until the next sample
+	double                  m_bench_cpu_start;      // host processor time used before the machine started running
+
+	// figures served to monitoring clients by the HTTP server
+	class http_metrics;
+	std::shared_ptr<http_metrics> m_http_metrics;
 
 	// notifier callbacks
 	struct notifier_callback_item
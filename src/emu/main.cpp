@@ -14,7 +14,10 @@
 machine_manager::machine_manager(emu_options& options, osd_interface& osd)
   : m_osd(osd),
 	m_options(options),
-	m_machine(nullptr)
+	m_machine(nullptr),
+	m_startup_begin(osd_ticks()),
+	m_startup_depth(0),
+	m_startup_done(false)
 {
 }
 
@@ -23,3 +26,85 @@ void machine_manager::start_http_server()
 	m_http = std::make_unique<http_manager>(options().http(), options().http_port(), options().http_root());
 }
 
+
+
+//-------------------------------------------------
+//  startup_phase - start timing a phase of
+//  startup; nothing is recorded once the first
+//  machine is running
+//-------------------------------------------------
+
+machine_manager::startup_phase::startup_phase(machine_manager &manager, const char *name)
+	: m_manager(manager)
+	, m_index(-1)
+	, m_start(0)
+{
+	if (manager.m_startup_done)
+		return;
+
+	auto const found = std::find_if(
+			manager.m_startup_phases.begin(),
+			manager.m_startup_phases.end(),
+			[name] (startup_entry const &entry) { return !strcmp(entry.name, name); });
+	if (manager.m_startup_phases.end() != found)
+	{
+		m_index = found - manager.m_startup_phases.begin();
+	}
+	else
+	{
+		m_index = manager.m_startup_phases.size();
+		manager.m_startup_phases.push_back(startup_entry{ name, manager.m_startup_depth, 0U, 0, 0U });
+	}
+	++manager.m_startup_depth;
+	m_start = osd_ticks();
+}
+
+
+void machine_manager::startup_phase::stop()
+{
+	if (0 > m_index)
+		return;
+
+	startup_entry &entry(m_manager.m_startup_phases[m_index]);
+	entry.ticks += osd_ticks() - m_start;
+	++entry.count;
+	entry.peak_memory = osd_get_peak_memory_usage();
+	--m_manager.m_startup_depth;
+	m_index = -1;
+}
+
+
+//-------------------------------------------------
+//  startup_complete - stop recording startup
+//  phases and print them if requested
+//-------------------------------------------------
+
+void machine_manager::startup_complete()
+{
+	if (m_startup_done)
+		return;
+	m_startup_done = true;
+
+	if (!m_options.startup_time())
+		return;
+
+	double const tps = double(osd_ticks_per_second());
+	osd_printf_info("Startup time:\n");
+	osd_printf_info("%-30s %5s %12s %14s\n", "PHASE", "COUNT", "TIME (ms)", "PEAK RSS (MiB)");
+	for (startup_entry const &entry : m_startup_phases)
+	{
+		std::string const name = std::string(entry.depth * 2, ' ') + entry.name;
+		osd_printf_info(
+				"%-30s %5u %12.3f %14.1f\n",
+				name,
+				entry.count,
+				double(entry.ticks) * 1000.0 / tps,
+				double(entry.peak_memory) / double(1U << 20));
+	}
+	osd_printf_info(
+			"%-30s %5s %12.3f %14.1f\n",
+			"total",
+			"",
+			double(osd_ticks() - m_startup_begin) * 1000.0 / tps,
+			double(osd_get_peak_memory_usage()) / double(1U << 20));
+}
@@ -71,6 +71,22 @@ protected:
 	// construction/destruction
 	machine_manager(emu_options& options, osd_interface& osd);
 public:
+	// times one phase of startup for -startuptime; phases with the same name
+	// accumulate, and nested phases are also counted in the enclosing phase
+	class startup_phase
+	{
+	public:
+		startup_phase(machine_manager &manager, const char *name);
+		~startup_phase() { stop(); }
+
+		void stop();
+
+	private:
+		machine_manager &   m_manager;
+		int                 m_index;
+		osd_ticks_t         m_start;
+	};
+
 	virtual ~machine_manager() { }
 
 	osd_interface &osd() const { return m_osd; }
@@ -91,11 +107,28 @@ public:
 	http_manager *http() { return m_http.get(); }
 	void start_http_server();
 
+	void startup_complete();
+
 protected:
 	osd_interface &               m_osd;                  // reference to OSD system
 	emu_options &                 m_options;              // reference to options
 	running_machine *             m_machine;
 	std::unique_ptr<http_manager> m_http;
+
+private:
+	struct startup_entry
+	{
+		const char *    name;
+		int             depth;
+		unsigned        count;
+		osd_ticks_t     ticks;
+		std::uint64_t   peak_memory;
+	};
+
+	std::vector<startup_entry>    m_startup_phases;       // startup phases in the order they began
+	osd_ticks_t                   m_startup_begin;        // when the manager was created
+	int                           m_startup_depth;        // number of phases currently open
+	bool                          m_startup_done;         // whether the first machine has started
 };
 
 #endif // MAME_EMU_MAIN_H
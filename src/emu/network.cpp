@@ -13,8 +13,22 @@
 #include "emu.h"
 #include "network.h"
 #include "config.h"
+#include "emuopts.h"
 #include "xmlfile.h"
 
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// first word of the greeting both sides of a netplay connection send
+static constexpr u32 NETPLAY_MAGIC = 0x4c504e4d; // 'MNPL'
+
+// how long to wait for a netplay peer before giving up, in seconds
+static constexpr int NETPLAY_CONNECT_TIMEOUT = 60;
+static constexpr int NETPLAY_FRAME_TIMEOUT = 10;
+
+
 //**************************************************************************
 //  NETWORK MANAGER
 //**************************************************************************
@@ -25,10 +39,29 @@
 
 network_manager::network_manager(running_machine &machine)
 	: m_machine(machine)
+	, m_netplay_base_time(0)
+	, m_netplay_delay(0)
+	, m_netplay_rollback(0)
+	, m_netplay_frame(0)
+	, m_netplay_received(0)
+	, m_netplay_rollback_from(0)
+	, m_netplay_replay_frame(0)
 {
 	machine.configuration().config_register("network", config_load_delegate(&network_manager::config_load, this), config_save_delegate(&network_manager::config_save, this));
+
+	// rolling back would stop at the same breakpoints over and over
+	if (machine.options().netplay()[0] != 0)
+	{
+		if (machine.debug_flags & DEBUG_FLAG_ENABLED)
+			osd_printf_warning("Warning: -netplay ignored with the debugger\n");
+		else if (!(machine.system().flags & MACHINE_SUPPORTS_SAVE))
+			osd_printf_warning("Warning: -netplay ignored for systems without save state support\n");
+		else
+			netplay_start();
+	}
 }
 
+
 //-------------------------------------------------
 //  config_load - read and apply data from the
 //  configuration file
@@ -89,3 +122,361 @@ void network_manager::config_save(config_type cfg_type, util::xml::data_node *pa
 		}
 	}
 }
+
+
+//**************************************************************************
+//  NETPLAY
+//**************************************************************************
+
+/*
+    Two instances of the same system exchange the digital inputs of their
+    players over a TCP connection, one message per frame.  The connecting
+    side drives the fields of one player; the listening side drives the
+    rest.  Neither waits for the other's inputs: a frame whose inputs from
+    the peer haven't arrived yet runs with the ones from the last frame
+    that has, and a snapshot is taken after every frame.  When the real
+    inputs turn out different, the machine goes back to the snapshot from
+    before the first wrong guess and runs the frames since again, unseen
+    and unheard.  The inputs for a frame take effect where ioport would
+    have applied them, at the end of the frame before, so both sides and
+    every rerun see them at the same point.
+*/
+
+//-------------------------------------------------
+//  netplay_start - connect to the peer and agree
+//  on the ports, players and base time
+//-------------------------------------------------
+
+void network_manager::netplay_start()
+{
+	emu_options &options = machine().options();
+	bool const listen = options.netplay_listen();
+	std::string const address = std::string("socket.") + options.netplay();
+
+	osd_printf_info(listen ? "Waiting for netplay peer on %s\n" : "Connecting to netplay peer at %s\n", options.netplay());
+	u64 filesize;
+	if (osd_file::open(address, listen ? OPEN_FLAG_CREATE : 0, m_netplay_socket, filesize) != osd_file::error::NONE)
+		throw emu_fatalerror("Unable to open netplay connection %s\n", options.netplay());
+
+	// a listening socket accepts the connection when read
+	osd_ticks_t const deadline = osd_ticks() + osd_ticks_per_second() * NETPLAY_CONNECT_TIMEOUT;
+	if (listen)
+	{
+		u8 dummy;
+		u32 actual;
+		while (m_netplay_socket->read(&dummy, 0, 0, actual) != osd_file::error::NONE)
+		{
+			if (osd_ticks() >= deadline)
+				throw emu_fatalerror("No netplay peer connected to %s\n", options.netplay());
+			osd_sleep(osd_ticks_per_second() / 100);
+		}
+	}
+
+	// the ports go out in the order of the port list, which is the same on both sides
+	for (auto &port : machine().ioport().ports())
+		m_netplay_ports.emplace_back(port.second.get());
+
+	// greet the peer: the listening side picks the base time, the connecting side the player
+	u64 const base = listen ? u64(::time(nullptr)) : 0;
+	u32 hello[5] = { NETPLAY_MAGIC, u32(m_netplay_ports.size()), listen ? 0 : u32(options.netplay_player()), u32(base), u32(base >> 32) };
+	for (u32 &word : hello)
+		word = little_endianize_int32(word);
+	if (!netplay_send(hello, sizeof(hello)))
+		throw emu_fatalerror("Unable to greet netplay peer\n");
+
+	// wait for the peer's greeting
+	while (m_netplay_buffer.size() < sizeof(hello))
+	{
+		if (!netplay_read())
+			throw emu_fatalerror("Netplay peer disconnected\n");
+		if (osd_ticks() >= deadline)
+			throw emu_fatalerror("Netplay peer didn't answer\n");
+		osd_sleep(osd_ticks_per_second() / 100);
+	}
+	memcpy(hello, &m_netplay_buffer[0], sizeof(hello));
+	m_netplay_buffer.erase(m_netplay_buffer.begin(), m_netplay_buffer.begin() + sizeof(hello));
+	for (u32 &word : hello)
+		word = little_endianize_int32(word);
+	if (hello[0] != NETPLAY_MAGIC || hello[1] != m_netplay_ports.size())
+		throw emu_fatalerror("Netplay peer is not running the same system\n");
+	m_netplay_base_time = time_t(listen ? base : (hello[3] | (u64(hello[4]) << 32)));
+
+	// work out which digital bits of each port come from the peer
+	int const player = (listen ? hello[2] : options.netplay_player()) - 1;
+	for (ioport_port *port : m_netplay_ports)
+	{
+		ioport_value client = 0;
+		for (ioport_field &field : port->fields())
+			if (!field.is_analog() && field.player() == player)
+				client |= field.mask();
+		m_netplay_remote_mask.emplace_back(listen ? client : ~client);
+	}
+
+	// nobody presses anything during the input delay at the start
+	m_netplay_delay = options.netplay_delay();
+	m_netplay_rollback = options.netplay_rollback();
+	m_netplay_inputs.resize(NETPLAY_HISTORY);
+	for (netplay_inputs &inputs : m_netplay_inputs)
+	{
+		inputs.local.resize(m_netplay_ports.size(), 0);
+		inputs.remote.resize(m_netplay_ports.size(), 0);
+	}
+	m_netplay_states.resize(m_netplay_rollback + 2);
+	m_netplay_received = m_netplay_delay;
+
+	osd_printf_info("Netplay connected, controlling %s\n", listen ? string_format("all but player %d", player + 1) : string_format("player %d", player + 1));
+}
+
+
+//-------------------------------------------------
+//  netplay_end - drop the connection and carry
+//  on alone
+//-------------------------------------------------
+
+void network_manager::netplay_end(const char *message)
+{
+	osd_printf_warning("%s\n", message);
+	machine().popmessage("%s", message);
+
+	m_netplay_socket.reset();
+	m_netplay_rollback_from = 0;
+	m_netplay_states.clear();
+}
+
+
+//-------------------------------------------------
+//  netplay_send - send a message to the peer
+//-------------------------------------------------
+
+bool network_manager::netplay_send(const void *data, u32 length)
+{
+	const u8 *ptr = reinterpret_cast<const u8 *>(data);
+	while (length != 0)
+	{
+		u32 actual;
+		if (m_netplay_socket->write(ptr, 0, length, actual) != osd_file::error::NONE)
+			return false;
+		ptr += actual;
+		length -= actual;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  netplay_read - append whatever the peer has
+//  sent to the receive buffer without waiting;
+//  false if the connection is gone
+//-------------------------------------------------
+
+bool network_manager::netplay_read()
+{
+	while (true)
+	{
+		u8 chunk[4096];
+		u32 actual;
+		osd_file::error const err = m_netplay_socket->read(chunk, 0, sizeof(chunk), actual);
+
+		// nothing more waiting
+		if (err == osd_file::error::FAILURE)
+			return true;
+		if (err != osd_file::error::NONE || actual == 0)
+			return false;
+		m_netplay_buffer.insert(m_netplay_buffer.end(), chunk, chunk + actual);
+	}
+}
+
+
+//-------------------------------------------------
+//  netplay_receive - take in the peer's inputs
+//  for the frames that have arrived, noting the
+//  earliest one we guessed wrong; false if the
+//  connection had to be dropped
+//-------------------------------------------------
+
+bool network_manager::netplay_receive()
+{
+	if (!netplay_read())
+	{
+		netplay_end("Netplay peer disconnected");
+		return false;
+	}
+
+	size_t const size = (m_netplay_ports.size() + 1) * sizeof(u32);
+	size_t offset = 0;
+	auto const word = [this, &offset] (size_t index) { u32 value; memcpy(&value, &m_netplay_buffer[offset + index * sizeof(u32)], sizeof(u32)); return little_endianize_int32(value); };
+	for ( ; offset + size <= m_netplay_buffer.size(); offset += size)
+	{
+		u32 const frame = word(0);
+		if (frame != m_netplay_received + 1)
+		{
+			netplay_end("Netplay peer sent inputs out of order");
+			return false;
+		}
+
+		// a frame we've already run with a guess needs running again if the guess was wrong
+		std::vector<ioport_value> &remote = m_netplay_inputs[frame % NETPLAY_HISTORY].remote;
+		for (size_t i = 0; i < remote.size(); i++)
+		{
+			ioport_value const value = word(i + 1) & m_netplay_remote_mask[i];
+			if (frame <= m_netplay_frame && value != remote[i] && (m_netplay_rollback_from == 0 || frame < m_netplay_rollback_from))
+				m_netplay_rollback_from = frame;
+			remote[i] = value;
+		}
+		m_netplay_received = frame;
+	}
+	m_netplay_buffer.erase(m_netplay_buffer.begin(), m_netplay_buffer.begin() + offset);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  netplay_apply - set the ports to the inputs
+//  of both sides for a frame
+//-------------------------------------------------
+
+void network_manager::netplay_apply(u32 frame)
+{
+	netplay_inputs &inputs = m_netplay_inputs[frame % NETPLAY_HISTORY];
+
+	// past the last inputs from the peer, guess it's still holding the same controls
+	if (frame > m_netplay_received)
+		inputs.remote = m_netplay_inputs[m_netplay_received % NETPLAY_HISTORY].remote;
+
+	for (size_t i = 0; i < m_netplay_ports.size(); i++)
+		m_netplay_ports[i]->live().digital = (inputs.local[i] & ~m_netplay_remote_mask[i]) | inputs.remote[i];
+}
+
+
+//-------------------------------------------------
+//  netplay_save - snapshot the machine once the
+//  inputs for a frame are in place
+//-------------------------------------------------
+
+void network_manager::netplay_save(u32 frame)
+{
+	// anonymous timers can't be saved; a rollback goes further back instead
+	if (!machine().scheduler().can_save())
+		return;
+
+	netplay_snapshot &snapshot = m_netplay_states[frame % m_netplay_states.size()];
+	if (!snapshot.state)
+		snapshot.state = std::make_unique<ram_state>(machine().save());
+	snapshot.frame = frame;
+	snapshot.state->save();
+}
+
+
+//-------------------------------------------------
+//  netplay_frame_update - called once the local
+//  inputs for the next frame are known; swaps in
+//  the inputs agreed on with the peer
+//-------------------------------------------------
+
+void network_manager::netplay_frame_update()
+{
+	if (!m_netplay_socket)
+		return;
+
+	// while rolling back, feed in the inputs from the history
+	if (m_netplay_replay_frame != 0)
+	{
+		netplay_apply(++m_netplay_replay_frame);
+		return;
+	}
+
+	// nothing is pressed on either side before the first frame
+	if (machine().phase() != machine_phase::RUNNING)
+	{
+		for (ioport_port *port : m_netplay_ports)
+			port->live().digital = 0;
+		return;
+	}
+
+	// send our inputs, which take effect after the input delay
+	u32 const frame = m_netplay_frame + 1;
+	std::vector<ioport_value> &local = m_netplay_inputs[(frame + m_netplay_delay) % NETPLAY_HISTORY].local;
+	std::vector<u32> message(m_netplay_ports.size() + 1);
+	message[0] = little_endianize_int32(frame + m_netplay_delay);
+	for (size_t i = 0; i < m_netplay_ports.size(); i++)
+	{
+		local[i] = m_netplay_ports[i]->live().digital & ~m_netplay_remote_mask[i];
+		message[i + 1] = little_endianize_int32(local[i]);
+	}
+	if (!netplay_send(&message[0], message.size() * sizeof(u32)))
+	{
+		netplay_end("Netplay peer disconnected");
+		return;
+	}
+
+	// wait for the peer if it's too far behind to roll back to, and for its first inputs
+	osd_ticks_t const deadline = osd_ticks() + osd_ticks_per_second() * NETPLAY_FRAME_TIMEOUT;
+	bool connected = netplay_receive();
+	while (connected && (m_netplay_received == 0 || s32(frame - m_netplay_received) > s32(m_netplay_rollback)))
+	{
+		if (osd_ticks() >= deadline)
+		{
+			netplay_end("Netplay peer stopped responding");
+			return;
+		}
+		osd_sleep(osd_ticks_per_second() / 1000);
+		connected = netplay_receive();
+	}
+
+	if (connected)
+	{
+		netplay_apply(frame);
+		m_netplay_frame = frame;
+	}
+}
+
+
+//-------------------------------------------------
+//  netplay_frame_completed - called between
+//  timeslices after a frame; rolls back if the
+//  peer's inputs turned out different from what
+//  was guessed, and snapshots the machine
+//-------------------------------------------------
+
+void network_manager::netplay_frame_completed()
+{
+	if (!m_netplay_socket)
+		return;
+
+	if (m_netplay_rollback_from != 0)
+	{
+		// find the latest snapshot from before the first wrong guess
+		netplay_snapshot *base = nullptr;
+		for (netplay_snapshot &snapshot : m_netplay_states)
+		{
+			if (snapshot.state && snapshot.state->m_valid && snapshot.frame < m_netplay_rollback_from && (m_netplay_frame - snapshot.frame) < NETPLAY_HISTORY)
+				if (!base || snapshot.frame > base->frame)
+					base = &snapshot;
+		}
+		m_netplay_rollback_from = 0;
+		if (!base || base->state->load() != STATERR_NONE)
+		{
+			netplay_end("Netplay lost sync: no state to roll back to");
+			return;
+		}
+
+		// run the frames since again with the inputs known now, taking new snapshots along the way
+		video_manager &video = machine().video();
+		m_netplay_replay_frame = base->frame;
+		netplay_apply(m_netplay_replay_frame);
+		video.begin_speculation(m_netplay_frame - m_netplay_replay_frame, false);
+		while (video.speculating() && !machine().exit_pending() && !machine().hard_reset_pending())
+		{
+			u32 const frame = m_netplay_replay_frame;
+			machine().scheduler().timeslice();
+			if (m_netplay_replay_frame != frame)
+				netplay_save(m_netplay_replay_frame);
+		}
+		video.end_speculation();
+		m_netplay_replay_frame = 0;
+	}
+	else
+	{
+		netplay_save(m_netplay_frame);
+	}
+}
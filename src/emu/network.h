@@ -22,12 +22,60 @@ public:
 
 	// getters
 	running_machine &machine() const { return m_machine; }
+
+	// netplay
+	bool netplay_active() const { return bool(m_netplay_socket); }
+	time_t netplay_base_time() const { return m_netplay_base_time; }
+	void netplay_frame_update();
+	void netplay_frame_completed();
+
 private:
+	// frames of input history kept; enough for the largest rollback and delay on both sides
+	static constexpr u32 NETPLAY_HISTORY = 128;
+
 	void config_load(config_type cfg_type, util::xml::data_node const *parentnode);
 	void config_save(config_type cfg_type, util::xml::data_node *parentnode);
 
+	// netplay helpers
+	void netplay_start();
+	void netplay_end(const char *message);
+	bool netplay_send(const void *data, u32 length);
+	bool netplay_read();
+	bool netplay_receive();
+	void netplay_apply(u32 frame);
+	void netplay_save(u32 frame);
+
+	// inputs for one frame, one value per port
+	struct netplay_inputs
+	{
+		std::vector<ioport_value> local;            // our own inputs
+		std::vector<ioport_value> remote;           // the peer's inputs, or the prediction used for them
+	};
+
+	// a snapshot taken once the inputs for a frame were applied
+	struct netplay_snapshot
+	{
+		std::unique_ptr<ram_state> state;
+		u32 frame = 0;
+	};
+
 	// internal state
 	running_machine &   m_machine;                  // reference to our machine
+
+	// netplay
+	osd_file::ptr       m_netplay_socket;           // connection to the peer
+	std::vector<u8>     m_netplay_buffer;           // partially received messages
+	std::vector<ioport_port *> m_netplay_ports;     // ports exchanged, in the same order on both sides
+	std::vector<ioport_value> m_netplay_remote_mask; // digital bits the peer drives
+	time_t              m_netplay_base_time;        // base time agreed on with the peer, 0 if none
+	u32                 m_netplay_delay;            // frames of input delay
+	u32                 m_netplay_rollback;         // most frames we may get ahead of the peer's inputs
+	u32                 m_netplay_frame;            // last frame whose inputs were applied
+	u32                 m_netplay_received;         // last frame the peer's inputs have arrived for
+	u32                 m_netplay_rollback_from;    // earliest frame run with a wrong prediction, 0 if none
+	u32                 m_netplay_replay_frame;     // frame being run again during a rollback, 0 if not rolling back
+	std::vector<netplay_inputs> m_netplay_inputs;   // input history, indexed by frame modulo NETPLAY_HISTORY
+	std::vector<netplay_snapshot> m_netplay_states; // snapshots, indexed by frame modulo their count
 };
 
 #endif // MAME_EMU_NETWORK_H
@@ -19,6 +19,11 @@
 
     the profiler handles a FILO list so calls may be nested.
 
+    With -perf_counters, host cycles, instructions, last-level cache
+    misses and branch mispredictions are charged to entries as well, and
+    each line of the text shows instructions per cycle followed by cache
+    and branch misses per thousand instructions.
+
 ***************************************************************************/
 
 #include "emu.h"
@@ -52,6 +57,38 @@ profiler_state g_profiler;
 
 #define TEXT_UPDATE_TIME        0.5
 
+static const profile_string s_names[] =
+{
+	{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
+	{ PROFILER_MEM_REMAP,        "Memory Remapping" },
+	{ PROFILER_MEMREAD,          "Memory Read" },
+	{ PROFILER_MEMWRITE,         "Memory Write" },
+	{ PROFILER_VIDEO,            "Video Update" },
+	{ PROFILER_DRAWGFX,          "drawgfx" },
+	{ PROFILER_COPYBITMAP,       "copybitmap" },
+	{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
+	{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
+	{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
+	{ PROFILER_BLIT,             "OSD Blitting" },
+	{ PROFILER_SOUND,            "Sound Generation" },
+	{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
+	{ PROFILER_INPUT,            "Input Processing" },
+	{ PROFILER_MOVIE_REC,        "Movie Recording" },
+	{ PROFILER_LOGERROR,         "Error Logging" },
+	{ PROFILER_LUA,              "LUA" },
+	{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
+	{ PROFILER_USER1,            "User 1" },
+	{ PROFILER_USER2,            "User 2" },
+	{ PROFILER_USER3,            "User 3" },
+	{ PROFILER_USER4,            "User 4" },
+	{ PROFILER_USER5,            "User 5" },
+	{ PROFILER_USER6,            "User 6" },
+	{ PROFILER_USER7,            "User 7" },
+	{ PROFILER_USER8,            "User 8" },
+	{ PROFILER_PROFILER,         "Profiler" },
+	{ PROFILER_IDLE,             "Idle" }
+};
+
 
 
 //**************************************************************************
@@ -80,6 +117,10 @@ real_profiler_state::real_profiler_state()
 {
 	memset(m_filo, 0, sizeof(m_filo));
 	memset(m_data, 0, sizeof(m_data));
+	memset(m_overall, 0, sizeof(m_overall));
+	m_perf_counters = false;
+	memset(m_perf_last, 0, sizeof(m_perf_last));
+	memset(m_perf_data, 0, sizeof(m_perf_data));
 	reset(false);
 }
 
@@ -101,6 +142,10 @@ void real_profiler_state::reset(bool enabled)
 		// set up dummy entry
 		m_filoptr->start = 0;
 		m_filoptr->type = PROFILER_TOTAL;
+
+		// don't charge counts from while we were disabled to anything
+		if (m_perf_counters && !osd_perf_counters_read(m_perf_last))
+			m_perf_counters = false;
 	}
 	else
 	{
@@ -111,6 +156,40 @@ void real_profiler_state::reset(bool enabled)
 
 
 
+//-------------------------------------------------
+//  enable_perf_counters - charge host hardware
+//  event counts to profiler entries as well as
+//  time; the counters must already be open on
+//  this thread
+//-------------------------------------------------
+
+void real_profiler_state::enable_perf_counters(bool state)
+{
+	m_perf_counters = state && osd_perf_counters_read(m_perf_last);
+	memset(m_perf_data, 0, sizeof(m_perf_data));
+}
+
+
+
+//-------------------------------------------------
+//  sample_perf_counters - charge the hardware
+//  events since the last sample to a type
+//-------------------------------------------------
+
+void real_profiler_state::sample_perf_counters(int type)
+{
+	u64 current[OSD_PERF_COUNTER_COUNT];
+	if (!osd_perf_counters_read(current))
+		return;
+	for (int counter = 0; counter < OSD_PERF_COUNTER_COUNT; counter++)
+	{
+		m_perf_data[type][counter] += current[counter] - m_perf_last[counter];
+		m_perf_last[counter] = current[counter];
+	}
+}
+
+
+
 //-------------------------------------------------
 //  text - return the current text in an std::string
 //-------------------------------------------------
@@ -141,38 +220,6 @@ const char *real_profiler_state::text(running_machine &machine)
 
 void real_profiler_state::update_text(running_machine &machine)
 {
-	static const profile_string names[] =
-	{
-		{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
-		{ PROFILER_MEM_REMAP,        "Memory Remapping" },
-		{ PROFILER_MEMREAD,          "Memory Read" },
-		{ PROFILER_MEMWRITE,         "Memory Write" },
-		{ PROFILER_VIDEO,            "Video Update" },
-		{ PROFILER_DRAWGFX,          "drawgfx" },
-		{ PROFILER_COPYBITMAP,       "copybitmap" },
-		{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
-		{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
-		{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
-		{ PROFILER_BLIT,             "OSD Blitting" },
-		{ PROFILER_SOUND,            "Sound Generation" },
-		{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
-		{ PROFILER_INPUT,            "Input Processing" },
-		{ PROFILER_MOVIE_REC,        "Movie Recording" },
-		{ PROFILER_LOGERROR,         "Error Logging" },
-		{ PROFILER_LUA,              "LUA" },
-		{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
-		{ PROFILER_USER1,            "User 1" },
-		{ PROFILER_USER2,            "User 2" },
-		{ PROFILER_USER3,            "User 3" },
-		{ PROFILER_USER4,            "User 4" },
-		{ PROFILER_USER5,            "User 5" },
-		{ PROFILER_USER6,            "User 6" },
-		{ PROFILER_USER7,            "User 7" },
-		{ PROFILER_USER8,            "User 8" },
-		{ PROFILER_PROFILER,         "Profiler" },
-		{ PROFILER_IDLE,             "Idle" }
-	};
-
 	// compute the total time for all bits, not including profiler or idle
 	u64 computed = 0;
 	profile_type curtype;
@@ -214,19 +261,78 @@ void real_profiler_state::update_text(running_machine &machine)
 			if (curtype >= PROFILER_DEVICE_FIRST && curtype <= PROFILER_DEVICE_MAX)
 				util::stream_format(stream, "'%s'", iter.byindex(curtype - PROFILER_DEVICE_FIRST)->tag());
 			else
-				for (auto & name : names)
+				for (auto & name : s_names)
 					if (name.type == curtype)
 					{
 						stream << name.string;
 						break;
 					}
 
+			// and host instructions per cycle with cache and branch misses per thousand instructions
+			u64 const *const perf = m_perf_data[curtype];
+			if (m_perf_counters && perf[OSD_PERF_CYCLES] && perf[OSD_PERF_INSTRUCTIONS])
+			{
+				double const kinst = double(perf[OSD_PERF_INSTRUCTIONS]) / 1000.0;
+				util::stream_format(stream, " %.2f IPC %.1f LLC %.1f BR",
+						double(perf[OSD_PERF_INSTRUCTIONS]) / double(perf[OSD_PERF_CYCLES]),
+						double(perf[OSD_PERF_CACHE_MISSES]) / kinst,
+						double(perf[OSD_PERF_BRANCH_MISSES]) / kinst);
+			}
+
 			// followed by a carriage return
 			stream << '\n';
 		}
 	}
 
-	// reset data set to 0
+	// fold into the overall figures and reset data set to 0
+	for (curtype = PROFILER_DEVICE_FIRST; curtype <= PROFILER_TOTAL; ++curtype)
+		m_overall[curtype] += m_data[curtype];
 	memset(m_data, 0, sizeof(m_data));
+	memset(m_perf_data, 0, sizeof(m_perf_data));
+
+	// finish with the frame time distribution
+	stream << machine.video().frame_time_text();
 	m_text = stream.str();
 }
+
+
+
+//-------------------------------------------------
+//  overall - report the share of time spent in
+//  each type since the profiler was first enabled
+//-------------------------------------------------
+
+void real_profiler_state::overall(running_machine &machine, std::function<void (const char *name, double percent)> const &callback)
+{
+	// profile ticks needn't be in any known unit, so only proportions mean anything
+	osd_ticks_t total = 0;
+	for (profile_type curtype = PROFILER_DEVICE_FIRST; curtype < PROFILER_TOTAL; ++curtype)
+		total += m_overall[curtype] + m_data[curtype];
+	if (total == 0)
+		return;
+
+	device_enumerator iter(machine.root_device());
+	for (profile_type curtype = PROFILER_DEVICE_FIRST; curtype < PROFILER_TOTAL; ++curtype)
+	{
+		osd_ticks_t const ticks = m_overall[curtype] + m_data[curtype];
+		if (ticks == 0)
+			continue;
+
+		double const percent = double(ticks) * 100.0 / double(total);
+		if (curtype >= PROFILER_DEVICE_FIRST && curtype <= PROFILER_DEVICE_MAX)
+		{
+			device_t *const device = iter.byindex(curtype - PROFILER_DEVICE_FIRST);
+			if (device)
+				callback(device->tag(), percent);
+		}
+		else
+		{
+			for (auto & name : s_names)
+				if (name.type == curtype)
+				{
+					callback(name.string, percent);
+					break;
+				}
+		}
+	}
+}
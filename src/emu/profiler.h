@@ -19,6 +19,11 @@
 
     the profiler handles a FILO list so calls may be nested.
 
+    For a host-time timeline across threads, including osd_work_queue
+    workers, use util::profile_scope from scopeprof.h; scopes are
+    registered by name at any time and written as Chromium trace-event
+    JSON with -profile_trace.
+
 ***************************************************************************/
 
 #ifndef MAME_EMU_PROFILER_H
@@ -26,6 +31,10 @@
 
 #pragma once
 
+#include "scopeprof.h"
+
+#include <functional>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -92,6 +101,7 @@ public:
 		return m_filoptr != nullptr;
 	}
 	const char *text(running_machine &machine);
+	void overall(running_machine &machine, std::function<void (const char *name, double percent)> const &callback);
 
 	// enable/disable
 	void enable(bool state = true)
@@ -101,6 +111,7 @@ public:
 			reset(state);
 		}
 	}
+	void enable_perf_counters(bool state = true);
 
 	// start/stop
 	void start(profile_type type) { if (enabled()) real_start(type); }
@@ -109,6 +120,7 @@ public:
 private:
 	void reset(bool enabled);
 	void update_text(running_machine &machine);
+	void sample_perf_counters(int type);
 
 	//-------------------------------------------------
 	//  real_start - mark the beginning of a
@@ -125,6 +137,8 @@ private:
 
 		// update previous entry
 		m_data[m_filoptr->type] += curticks - m_filoptr->start;
+		if (UNEXPECTED(m_perf_counters))
+			sample_perf_counters(m_filoptr->type);
 
 		// move to next entry
 		m_filoptr++;
@@ -148,6 +162,8 @@ private:
 
 		// account for the time taken
 		m_data[m_filoptr->type] += curticks - m_filoptr->start;
+		if (UNEXPECTED(m_perf_counters))
+			sample_perf_counters(m_filoptr->type);
 
 		// move back an entry
 		m_filoptr--;
@@ -169,6 +185,10 @@ private:
 	attotime            m_text_time;                // profiler text last update
 	filo_entry          m_filo[32];                 // array of FILO entries
 	osd_ticks_t         m_data[PROFILER_TOTAL + 1]; // array of data
+	osd_ticks_t         m_overall[PROFILER_TOTAL + 1]; // data accumulated since starting
+	bool                m_perf_counters;            // true if reading hardware counters
+	u64                 m_perf_last[OSD_PERF_COUNTER_COUNT]; // hardware counts at the last sample
+	u64                 m_perf_data[PROFILER_TOTAL + 1][OSD_PERF_COUNTER_COUNT]; // hardware counts by type
 };
 
 
@@ -183,9 +203,11 @@ public:
 	// getters
 	bool enabled() const { return false; }
 	const char *text(running_machine &machine) { return ""; }
+	void overall(running_machine &machine, std::function<void (const char *name, double percent)> const &callback) { }
 
 	// enable/disable
 	void enable(bool state = true) { }
+	void enable_perf_counters(bool state = true) { }
 
 	// start/stop
 	void start(profile_type type) { }
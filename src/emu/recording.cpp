@@ -9,13 +9,50 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include "emuopts.h"
 #include "screen.h"
 #include "aviio.h"
 #include "png.h"
 
+#include "osdfile.h"
+
+#include <csignal>
+#include <cstdio>
+
+#if defined(_WIN32)
+#define popen _popen
+#define pclose _pclose
+#define POPEN_WRITE "wb"
+#else
+#define POPEN_WRITE "w"
+#endif
+
 
 namespace
 {
+	// quote a string so the shell passes it to the command as a single argument
+	std::string shell_quote(std::string_view str)
+	{
+		std::string result;
+#if defined(_WIN32)
+		// double quotes can't appear in a Windows path, so there's nothing to escape
+		result.append("\"").append(str).append("\"");
+#else
+		// nothing is special within single quotes, and a single quote is closed, escaped and reopened
+		result.push_back('\'');
+		for (char const ch : str)
+		{
+			if (ch == '\'')
+				result.append("'\\''");
+			else
+				result.push_back(ch);
+		}
+		result.push_back('\'');
+#endif
+		return result;
+	}
+
+
 	class avi_movie_recording : public movie_recording
 	{
 	public:
@@ -24,11 +61,13 @@ namespace
 		{
 		}
 
+		~avi_movie_recording();
+
 		bool initialize(running_machine &machine, std::unique_ptr<emu_file> &&file, int32_t width, int32_t height);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
 
 	private:
 		avi_file::ptr m_avi_file; // handle to the open movie file
@@ -41,15 +80,98 @@ namespace
 		mng_movie_recording(screen_device *screen, std::map<std::string, std::string> &&info_fields);
 		~mng_movie_recording();
 
-		bool initialize(std::unique_ptr<emu_file> &&file, bitmap_t &snap_bitmap);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
+		bool initialize(std::unique_ptr<emu_file> &&file, bitmap_t &snap_bitmap, int compression);
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
 
 	private:
 		std::unique_ptr<emu_file> m_mng_file; // handle to the open movie file
 		std::map<std::string, std::string> m_info_fields;
+		int m_compression;                    // zlib level for each frame
+	};
+
+
+	class encoder_movie_recording : public movie_recording
+	{
+	public:
+		encoder_movie_recording(screen_device *screen)
+			: movie_recording(screen)
+			, m_pipe(nullptr)
+			, m_width(0)
+			, m_height(0)
+#if !defined(_WIN32)
+			, m_old_sigpipe(SIG_DFL)
+#endif
+		{
+		}
+
+		~encoder_movie_recording();
+
+		bool initialize(std::string_view command, std::unique_ptr<emu_file> &&file, int32_t width, int32_t height);
+
+	protected:
+		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
+
+	private:
+		FILE *m_pipe;       // standard input of the encoder process
+		int32_t m_width;    // frame size the encoder was told about
+		int32_t m_height;
+#if !defined(_WIN32)
+		void (*m_old_sigpipe)(int); // SIGPIPE handler to put back when done
+#endif
+	};
+
+	// shared memory layout: this header, then FRAME_SLOTS frames of
+	// frame_bytes each, then a ring of interleaved stereo s16 samples;
+	// a frame slot is valid while its slot_frame entry reads the same
+	// number before and after copying it
+	struct shared_movie_header
+	{
+		static constexpr u32 FRAME_SLOTS = 4;
+
+		char                    magic[8];                   // "MAMESHM" and a terminating zero
+		u32                     version;                    // layout version, currently 1
+		u32                     header_size;                // offset of the first frame slot
+		u32                     width;                      // frame size in pixels, as 32-bit xRGB
+		u32                     height;
+		u32                     pitch;                      // bytes per frame row
+		u32                     frame_slots;                // number of frame slots
+		u64                     frame_bytes;                // size of each frame slot
+		u64                     frame_period;               // movie frame period in attoseconds
+		u32                     sample_rate;                // sound samples per second per channel
+		u32                     sound_samples;              // size of the sound ring in stereo samples
+		u64                     sound_offset;               // offset of the sound ring
+		std::atomic<u64>        frame_count;                // frames published so far; the latest is in slot frame_count % frame_slots
+		std::atomic<u64>        sound_count;                // stereo samples published so far; the next goes to sound_count % sound_samples
+		std::atomic<u64>        slot_frame[FRAME_SLOTS];    // number of the frame in each slot, 0 while it is being written
+	};
+
+	static_assert(std::atomic<u64>::is_always_lock_free, "shared memory counters must be lock-free");
+
+
+	class shared_movie_recording : public movie_recording
+	{
+	public:
+		shared_movie_recording(screen_device *screen)
+			: movie_recording(screen)
+			, m_header(nullptr)
+		{
+		}
+
+		~shared_movie_recording();
+
+		bool initialize(std::unique_ptr<emu_file> &&file, int32_t width, int32_t height, int sample_rate);
+
+	protected:
+		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
+
+	private:
+		std::unique_ptr<osd::shared_mapping> m_mapping; // view of the shared file
+		shared_movie_header *m_header;      // header at the start of the view
 	};
 };
 
@@ -67,7 +189,17 @@ movie_recording::movie_recording(screen_device *screen)
 	, m_frame_period(attotime::zero)
 	, m_next_frame_time(attotime::zero)
 	, m_frame(0)
+	, m_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO))
+	, m_next_video(0)
+	, m_next_sound(0)
+	, m_pending_frames(0)
+	, m_dropped_frames(0)
+	, m_error(false)
 {
+	for (chunk &c : m_video_chunks)
+		c.owner = this;
+	for (chunk &c : m_sound_chunks)
+		c.owner = this;
 }
 
 
@@ -77,32 +209,168 @@ movie_recording::movie_recording(screen_device *screen)
 
 movie_recording::~movie_recording()
 {
+	finish_writes();
+	if (m_queue != nullptr)
+		osd_work_queue_free(m_queue);
 }
 
 
 //-------------------------------------------------
-//  movie_recording::append_video_frame
+//  movie_recording::append_video_frame - queue a
+//  copy of the frame for the encoder, once for
+//  each movie frame up to curtime
 //-------------------------------------------------
 
 bool movie_recording::append_video_frame(bitmap_rgb32 &bitmap, attotime curtime)
 {
+	if (m_error)
+		return false;
+
+	// count the movie frames due by now
+	int frames = 0;
+	while (next_frame_time() <= curtime)
+	{
+		frames++;
+		set_next_frame_time(next_frame_time() + frame_period());
+	}
+	if (frames == 0)
+		return true;
+
+	// if the encoder is still busy with every frame buffer, drop this one; the next one fills in for it
+	chunk &c = m_video_chunks[m_next_video];
+	if (c.item != nullptr && !osd_work_item_wait(c.item, 0))
+	{
+		m_pending_frames += frames;
+		m_dropped_frames += frames;
+		return true;
+	}
+	retire(c);
+	m_next_video = (m_next_video + 1) % VIDEO_CHUNKS;
+
+	g_profiler.start(PROFILER_MOVIE_REC);
+
 	// identify the palette
 	bool has_palette = screen() && screen()->has_palette();
 	const rgb_t *palette = has_palette ? screen()->palette().palette()->entry_list_adjusted() : nullptr;
 	int palette_entries = has_palette ? screen()->palette().entries() : 0;
 
-	// keep appending frames until we're at curtime
-	while (next_frame_time() <= curtime)
+	// copy everything the encoder needs
+	if (c.bitmap.width() != bitmap.width() || c.bitmap.height() != bitmap.height())
+		c.bitmap.allocate(bitmap.width(), bitmap.height());
+	copybitmap(c.bitmap, bitmap, 0, 0, 0, 0, bitmap.cliprect());
+	c.palette.assign(palette, palette + palette_entries);
+	c.frames = frames + m_pending_frames;
+	m_pending_frames = 0;
+	queue(c);
+
+	g_profiler.stop();
+	return !m_error;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::add_sound_to_recording -
+//  queue interleaved stereo samples for the
+//  encoder
+//-------------------------------------------------
+
+bool movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+{
+	if (m_error)
+		return false;
+	if (numsamples == 0)
+		return true;
+
+	chunk &c = m_sound_chunks[m_next_sound];
+	m_next_sound = (m_next_sound + 1) % SOUND_CHUNKS;
+	retire(c);
+	c.sound.assign(sound, sound + numsamples * 2);
+	c.frames = 0;
+	queue(c);
+	return !m_error;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::finish_writes - wait for
+//  everything queued to be written
+//-------------------------------------------------
+
+void movie_recording::finish_writes()
+{
+	for (chunk &c : m_video_chunks)
+		retire(c);
+	for (chunk &c : m_sound_chunks)
+		retire(c);
+
+	if (m_dropped_frames != 0)
 	{
-		// append this bitmap as a single frame
-		if (!append_single_video_frame(bitmap, palette, palette_entries))
-			return false;
-		m_frame++;
+		osd_printf_info("Movie recording dropped %u of %u frames to keep up\n", m_dropped_frames, m_frame + m_pending_frames);
+		m_dropped_frames = 0;
+	}
+}
 
-		// advance time
-		set_next_frame_time(next_frame_time() + frame_period());
+
+//-------------------------------------------------
+//  movie_recording::retire - wait for a chunk's
+//  previous write to finish
+//-------------------------------------------------
+
+void movie_recording::retire(chunk &c)
+{
+	if (c.item != nullptr)
+	{
+		osd_work_item_wait(c.item, osd_ticks_per_second() * 100);
+		osd_work_item_release(c.item);
+		c.item = nullptr;
 	}
-	return true;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::queue - hand a chunk to the
+//  encoder thread, or write it now if there is
+//  none
+//-------------------------------------------------
+
+void movie_recording::queue(chunk &c)
+{
+	if (m_queue != nullptr)
+		c.item = osd_work_item_queue(m_queue, &movie_recording::write_chunk, &c, 0);
+	if (c.item == nullptr)
+		write(c);
+}
+
+
+//-------------------------------------------------
+//  movie_recording::write - encode and write a
+//  chunk
+//-------------------------------------------------
+
+void movie_recording::write(chunk &c)
+{
+	// after a failure, nothing more goes to the file
+	if (m_error)
+		return;
+
+	if (c.frames == 0)
+	{
+		if (!append_sound_samples(&c.sound[0], c.sound.size() / 2))
+			m_error = true;
+	}
+	else
+	{
+		for (int i = 0; i < c.frames && !m_error; i++, m_frame++)
+			if (!append_single_video_frame(c.bitmap, c.palette.empty() ? nullptr : &c.palette[0], c.palette.size()))
+				m_error = true;
+	}
+}
+
+void *movie_recording::write_chunk(void *param, int threadid)
+{
+	chunk &c = *reinterpret_cast<chunk *>(param);
+	c.owner->write(c);
+	return nullptr;
 }
 
 
@@ -131,11 +399,27 @@ movie_recording::ptr movie_recording::create(running_machine &machine, screen_de
 			info_fields["System"] = std::string(machine.system().manufacturer).append(" ").append(machine.system().type.fullname());
 
 			auto mng_recording = std::make_unique<mng_movie_recording>(screen, std::move(info_fields));
-			if (mng_recording->initialize(std::move(file), snap_bitmap))
+			if (mng_recording->initialize(std::move(file), snap_bitmap, machine.options().snap_compression()))
 				result = std::move(mng_recording);
 		}
 		break;
 
+	case movie_recording::format::ENCODER:
+		{
+			auto encoder_recording = std::make_unique<encoder_movie_recording>(screen);
+			if (encoder_recording->initialize(machine.options().encoder(), std::move(file), snap_bitmap.width(), snap_bitmap.height()))
+				result = std::move(encoder_recording);
+		}
+		break;
+
+	case movie_recording::format::SHARED:
+		{
+			auto shared_recording = std::make_unique<shared_movie_recording>(screen);
+			if (shared_recording->initialize(std::move(file), snap_bitmap.width(), snap_bitmap.height(), machine.sample_rate()))
+				result = std::move(shared_recording);
+		}
+		break;
+
 	default:
 		throw false;
 	}
@@ -155,13 +439,43 @@ const char *movie_recording::format_file_extension(movie_recording::format fmt)
 {
 	switch (fmt)
 	{
-		case format::AVI:   return "avi";
-		case format::MNG:   return "mng";
-		default:            throw false;
+		case format::AVI:       return "avi";
+		case format::MNG:       return "mng";
+		case format::ENCODER:   return "mkv";
+		case format::SHARED:    return "shm";
+		default:                throw false;
 	}
 }
 
 
+//-------------------------------------------------
+//  movie_recording::format_name
+//-------------------------------------------------
+
+const char *movie_recording::format_name(movie_recording::format fmt)
+{
+	switch (fmt)
+	{
+		case format::AVI:       return "AVI";
+		case format::MNG:       return "MNG";
+		case format::ENCODER:   return "encoder";
+		case format::SHARED:    return "shared memory";
+		default:                throw false;
+	}
+}
+
+
+//-------------------------------------------------
+//  avi_movie_recording - destructor
+//-------------------------------------------------
+
+avi_movie_recording::~avi_movie_recording()
+{
+	// the file closes with us, so everything queued has to reach it first
+	finish_writes();
+}
+
+
 //-------------------------------------------------
 //  avi_movie_recording::initialize
 //-------------------------------------------------
@@ -213,19 +527,16 @@ bool avi_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 
 
 //-------------------------------------------------
-//  avi_movie_recording::append_video_frame
+//  avi_movie_recording::append_sound_samples
 //-------------------------------------------------
 
-bool avi_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool avi_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
 {
-	g_profiler.start(PROFILER_MOVIE_REC);
-
 	// write the next frame
 	avi_file::error avierr = m_avi_file->append_sound_samples(0, sound + 0, numsamples, 1);
 	if (avierr == avi_file::error::NONE)
 		avierr = m_avi_file->append_sound_samples(1, sound + 1, numsamples, 1);
 
-	g_profiler.stop();
 	return avierr == avi_file::error::NONE;
 }
 
@@ -237,6 +548,7 @@ bool avi_movie_recording::add_sound_to_recording(const s16 *sound, int numsample
 mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::string, std::string> &&info_fields)
 	: movie_recording(screen)
 	, m_info_fields(std::move(info_fields))
+	, m_compression(-1)
 {
 }
 
@@ -247,6 +559,7 @@ mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::st
 
 mng_movie_recording::~mng_movie_recording()
 {
+	finish_writes();
 	if (m_mng_file)
 		util::mng_capture_stop(*m_mng_file);
 }
@@ -256,7 +569,7 @@ mng_movie_recording::~mng_movie_recording()
 //  mng_movie_recording::initialize
 //-------------------------------------------------
 
-bool mng_movie_recording::initialize(std::unique_ptr<emu_file> &&file, bitmap_t &snap_bitmap)
+bool mng_movie_recording::initialize(std::unique_ptr<emu_file> &&file, bitmap_t &snap_bitmap, int compression)
 {
 	// compute the frame time (MNG rate is an unsigned integer)
 	attotime period = screen() ? screen()->frame_period() : attotime::from_hz(screen_device::DEFAULT_FRAME_RATE);
@@ -264,6 +577,7 @@ bool mng_movie_recording::initialize(std::unique_ptr<emu_file> &&file, bitmap_t
 	set_frame_period(attotime::from_hz(rate));
 
 	m_mng_file = std::move(file);
+	m_compression = compression;
 	util::png_error pngerr = util::mng_capture_start(*m_mng_file, snap_bitmap, rate);
 	if (pngerr != util::png_error::NONE)
 		osd_printf_error("Error capturing MNG, png_error=%d\n", std::underlying_type_t<util::png_error>(pngerr));
@@ -285,17 +599,232 @@ bool mng_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 			pnginfo.add_text(ent.first, ent.second);
 	}
 
-	util::png_error error = util::mng_capture_frame(*m_mng_file, pnginfo, bitmap, palette_entries, palette);
+	util::png_error error = util::mng_capture_frame(*m_mng_file, pnginfo, bitmap, palette_entries, palette, m_compression);
 	return error == util::png_error::NONE;
 }
 
 
 //-------------------------------------------------
-//  mng_movie_recording::add_sound_to_recording
+//  mng_movie_recording::append_sound_samples
 //-------------------------------------------------
 
-bool mng_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool mng_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
 {
 	// not supported; do nothing
 	return true;
 }
+
+
+//-------------------------------------------------
+//  encoder_movie_recording - destructor
+//-------------------------------------------------
+
+encoder_movie_recording::~encoder_movie_recording()
+{
+	finish_writes();
+
+	// closing the pipe ends the encoder's input; wait for it to finish the file
+	if (m_pipe)
+	{
+		int const status = pclose(m_pipe);
+		if (status != 0)
+			osd_printf_error("Movie encoder exited with status %d\n", status);
+#if !defined(_WIN32)
+		std::signal(SIGPIPE, m_old_sigpipe);
+#endif
+	}
+}
+
+
+//-------------------------------------------------
+//  encoder_movie_recording::initialize
+//-------------------------------------------------
+
+bool encoder_movie_recording::initialize(std::string_view command, std::unique_ptr<emu_file> &&file, int32_t width, int32_t height)
+{
+	// we only use the file we're passed to get the full path; the encoder writes it
+	std::string fullpath = file->fullpath();
+	file.reset();
+
+	attotime period = screen() ? screen()->frame_period() : attotime::from_hz(screen_device::DEFAULT_FRAME_RATE);
+	set_frame_period(period);
+	m_width = width;
+	m_height = height;
+
+	// fill in the command line
+	std::string cmdline;
+	for (size_t pos = 0; pos < command.length(); pos++)
+	{
+		if (command[pos] != '%' || (pos + 1) == command.length())
+		{
+			cmdline.push_back(command[pos]);
+			continue;
+		}
+		switch (command[++pos])
+		{
+		case 'w':   cmdline.append(std::to_string(width)); break;
+		case 'h':   cmdline.append(std::to_string(height)); break;
+		case 'r':   cmdline.append(util::string_format("%.6f", period.as_hz())); break;
+		case 'p':   cmdline.append(ENDIANNESS_NATIVE == ENDIANNESS_LITTLE ? "bgr0" : "0rgb"); break;
+		case 'o':   cmdline.append(shell_quote(fullpath)); break;
+		default:    cmdline.push_back(command[pos]); break;
+		}
+	}
+
+#if !defined(_WIN32)
+	// an encoder that quits early must produce a write error rather than kill us
+	m_old_sigpipe = std::signal(SIGPIPE, SIG_IGN);
+#endif
+
+	osd_printf_verbose("Starting movie encoder: %s\n", cmdline);
+	m_pipe = popen(cmdline.c_str(), POPEN_WRITE);
+	if (!m_pipe)
+	{
+		osd_printf_error("Error starting movie encoder: %s\n", cmdline);
+#if !defined(_WIN32)
+		std::signal(SIGPIPE, m_old_sigpipe);
+#endif
+	}
+	return m_pipe != nullptr;
+}
+
+
+//-------------------------------------------------
+//  encoder_movie_recording::append_single_video_frame
+//-------------------------------------------------
+
+bool encoder_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries)
+{
+	// raw video has no way to change size part way through
+	if (bitmap.width() != m_width || bitmap.height() != m_height)
+		return false;
+
+	for (int32_t y = 0; y < m_height; y++)
+		if (fwrite(&bitmap.pix(y), sizeof(u32), m_width, m_pipe) != size_t(m_width))
+			return false;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  encoder_movie_recording::append_sound_samples
+//-------------------------------------------------
+
+bool encoder_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
+{
+	// the pipe carries video only; record sound with -wavwrite alongside
+	return true;
+}
+
+
+//-------------------------------------------------
+//  shared_movie_recording - destructor
+//-------------------------------------------------
+
+shared_movie_recording::~shared_movie_recording()
+{
+	// the mapping goes away with us, so nothing may still be writing to it
+	finish_writes();
+}
+
+
+//-------------------------------------------------
+//  shared_movie_recording::initialize
+//-------------------------------------------------
+
+bool shared_movie_recording::initialize(std::unique_ptr<emu_file> &&file, int32_t width, int32_t height, int sample_rate)
+{
+	// we only use the file we're passed to get the full path
+	std::string fullpath = file->fullpath();
+	file.reset();
+
+	attotime period = screen() ? screen()->frame_period() : attotime::from_hz(screen_device::DEFAULT_FRAME_RATE);
+	set_frame_period(period);
+
+	// keep a second of sound, and keep everything 64-bit aligned
+	u32 const pitch = width * sizeof(u32);
+	u64 const header_size = (sizeof(shared_movie_header) + 63) & ~u64(63);
+	u64 const frame_bytes = (u64(pitch) * height + 63) & ~u64(63);
+	u64 const sound_offset = header_size + frame_bytes * shared_movie_header::FRAME_SLOTS;
+	u32 const sound_samples = std::max(sample_rate, 1);
+	m_mapping = std::make_unique<osd::shared_mapping>(fullpath, sound_offset + u64(sound_samples) * 2 * sizeof(s16));
+	if (!*m_mapping)
+	{
+		osd_printf_error("Error mapping shared movie file %s\n", fullpath);
+		return false;
+	}
+
+	// readers may already have the file open, so mark it empty before describing it
+	m_header = new (m_mapping->get()) shared_movie_header;
+	m_header->frame_count.store(0, std::memory_order_relaxed);
+	m_header->sound_count.store(0, std::memory_order_relaxed);
+	for (auto &slot : m_header->slot_frame)
+		slot.store(0, std::memory_order_relaxed);
+	std::copy_n("MAMESHM", 8, m_header->magic);
+	m_header->version = 1;
+	m_header->header_size = header_size;
+	m_header->width = width;
+	m_header->height = height;
+	m_header->pitch = pitch;
+	m_header->frame_slots = shared_movie_header::FRAME_SLOTS;
+	m_header->frame_bytes = frame_bytes;
+	m_header->frame_period = period.as_attoseconds();
+	m_header->sample_rate = sample_rate;
+	m_header->sound_samples = sound_samples;
+	m_header->sound_offset = sound_offset;
+	std::atomic_thread_fence(std::memory_order_release);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  shared_movie_recording::append_single_video_frame
+//-------------------------------------------------
+
+bool shared_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries)
+{
+	// the layout has no way to change size part way through
+	if (bitmap.width() != s32(m_header->width) || bitmap.height() != s32(m_header->height))
+		return false;
+
+	// invalidate the slot, fill it, then publish it
+	u64 const frame = m_header->frame_count.load(std::memory_order_relaxed) + 1;
+	u32 const slot = frame % shared_movie_header::FRAME_SLOTS;
+	m_header->slot_frame[slot].store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	u8 *const dest = reinterpret_cast<u8 *>(m_mapping->get()) + m_header->header_size + m_header->frame_bytes * slot;
+	for (u32 y = 0; y < m_header->height; y++)
+		std::copy_n(&bitmap.pix(y), m_header->width, reinterpret_cast<u32 *>(dest + y * m_header->pitch));
+
+	m_header->slot_frame[slot].store(frame, std::memory_order_release);
+	m_header->frame_count.store(frame, std::memory_order_release);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  shared_movie_recording::append_sound_samples
+//-------------------------------------------------
+
+bool shared_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
+{
+	// copy into the ring in at most two pieces, then publish the new count
+	s16 *const ring = reinterpret_cast<s16 *>(reinterpret_cast<u8 *>(m_mapping->get()) + m_header->sound_offset);
+	u32 const size = m_header->sound_samples;
+	u64 count = m_header->sound_count.load(std::memory_order_relaxed);
+	if (u32(numsamples) > size)
+	{
+		// only the end of an oversized update fits
+		count += numsamples - size;
+		sound += (numsamples - size) * 2;
+		numsamples = size;
+	}
+	u32 const start = count % size;
+	u32 const first = std::min<u32>(numsamples, size - start);
+	std::copy_n(sound, first * 2, ring + start * 2);
+	std::copy_n(sound + first * 2, (numsamples - first) * 2, ring);
+
+	m_header->sound_count.store(count + numsamples, std::memory_order_release);
+	return true;
+}
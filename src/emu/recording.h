@@ -17,7 +17,10 @@
 #ifndef MAME_EMU_RECORDING_H
 #define MAME_EMU_RECORDING_H
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include "attotime.h"
 #include "palette.h"
@@ -38,7 +41,9 @@ public:
 	enum class format
 	{
 		MNG,
-		AVI
+		AVI,
+		ENCODER,    // raw frames piped to an external encoder
+		SHARED      // latest frames and sound published in shared memory
 	};
 
 	typedef std::unique_ptr<movie_recording> ptr;
@@ -51,16 +56,16 @@ public:
 	attotime frame_period()                 { return m_frame_period; }
 	void set_next_frame_time(attotime time) { m_next_frame_time = time; }
 	attotime next_frame_time() const        { return m_next_frame_time; }
+	u32 dropped_frames() const              { return m_dropped_frames; }
 
 	// methods
 	bool append_video_frame(bitmap_rgb32 &bitmap, attotime curtime);
-
-	// virtuals
-	virtual bool add_sound_to_recording(const s16 *sound, int numsamples) = 0;
+	bool add_sound_to_recording(const s16 *sound, int numsamples);
 
 	// statics
 	static movie_recording::ptr create(running_machine &machine, screen_device *screen, format fmt, std::unique_ptr<emu_file> &&file, bitmap_rgb32 &snap_bitmap);
 	static const char *format_file_extension(format fmt);
+	static const char *format_name(format fmt);
 
 protected:
 	// ctor
@@ -68,18 +73,52 @@ protected:
 	movie_recording(const movie_recording &) = delete;
 	movie_recording(movie_recording &&) = delete;
 
-	// virtuals
+	// virtuals, called on the encoder thread
 	virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) = 0;
+	virtual bool append_sound_samples(const s16 *sound, int numsamples) = 0;
 
 	// accessors
 	int current_frame() const { return m_frame; }
 	void set_frame_period(attotime time) { m_frame_period = time; }
 
+	// wait for everything queued to be written; derived classes call this before closing their files
+	void finish_writes();
+
 private:
+	// frames and sound updates that can be queued for the encoder; when
+	// every frame buffer is busy frames are dropped, but sound always waits
+	static constexpr int VIDEO_CHUNKS = 8;
+	static constexpr int SOUND_CHUNKS = 64;
+
+	struct chunk
+	{
+		movie_recording *owner = nullptr;
+		bitmap_rgb32 bitmap;                // copy of the frame
+		std::vector<rgb_t> palette;         // copy of the screen palette
+		int frames = 0;                     // number of movie frames it fills, 0 for sound
+		std::vector<s16> sound;             // interleaved stereo samples
+		osd_work_item *item = nullptr;      // write in flight, if any
+	};
+
+	void retire(chunk &c);
+	void queue(chunk &c);
+	void write(chunk &c);
+	static void *write_chunk(void *param, int threadid);
+
 	screen_device * m_screen;               // screen associated with this movie (can be nullptr)
 	attotime        m_frame_period;         // duration of movie frame
 	attotime        m_next_frame_time;      // time of next frame
 	int             m_frame;                // current movie frame number
+
+	// encoder thread
+	osd_work_queue *                  m_queue;          // single-threaded I/O queue, so chunks are written in order
+	std::array<chunk, VIDEO_CHUNKS>   m_video_chunks;
+	std::array<chunk, SOUND_CHUNKS>   m_sound_chunks;
+	int                               m_next_video;
+	int                               m_next_sound;
+	int                               m_pending_frames; // frames dropped since the last one queued, filled by the next
+	u32                               m_dropped_frames; // total frames dropped
+	std::atomic<bool>                 m_error;          // a write failed
 };
 
 
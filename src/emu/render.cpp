@@ -96,6 +96,22 @@ struct render_target::object_transform
 	bool                no_center;          // center the container?
 };
 
+// an element_cache_entry remembers the geometry built for a layout element
+// item so it can be reused while the item's transform and state are steady
+struct render_target::element_cache_entry
+{
+	const void *        item = nullptr;     // layout item this was built for
+	bool                valid = false;      // holds geometry for the item?
+	object_transform    xform;              // item transform it was built with
+	int                 state;              // element state it was built with
+	bool                clipped;            // entirely outside the target?
+	render_bounds       bounds;             // clipped primitive bounds
+	render_bounds       full_bounds;        // unclipped primitive bounds
+	render_quad_texuv   texcoords;          // clipped texture coordinates
+	s32                 texwidth;           // requested texture width
+	s32                 texheight;          // requested texture height
+};
+
 
 
 //**************************************************************************
@@ -296,7 +312,9 @@ render_texture::render_texture()
 		m_old_id(~0ULL),
 		m_scaler(nullptr),
 		m_param(nullptr),
-		m_curseq(0)
+		m_curseq(0),
+		m_content_seq(0),
+		m_palette_serial(0)
 {
 	m_sbounds.set(0, -1, 0, -1);
 	memset(m_scaled, 0, sizeof(m_scaled));
@@ -352,6 +370,8 @@ void render_texture::release()
 	m_sbounds.set(0, -1, 0, -1);
 	m_format = TEXFORMAT_ARGB32;
 	m_curseq = 0;
+	m_content_seq = 0;
+	m_palette_serial = 0;
 }
 
 
@@ -375,6 +395,7 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	m_bitmap = &bitmap;
 	m_sbounds = sbounds;
 	m_format = format;
+	m_content_seq = ++m_curseq;
 
 	// invalidate all scaled versions
 	for (auto & elem : m_scaled)
@@ -525,6 +546,184 @@ const rgb_t *render_texture::get_adjusted_palette(render_container &container, u
 }
 
 
+//-------------------------------------------------
+//  content_seqid - return a sequence number that
+//  only changes when set_bitmap is called or the
+//  container's palette changes, for textures
+//  whose owner always calls set_bitmap after
+//  drawing
+//-------------------------------------------------
+
+u32 render_texture::content_seqid(u32 palette_serial)
+{
+	if (palette_serial != m_palette_serial)
+	{
+		m_palette_serial = palette_serial;
+		m_content_seq = ++m_curseq;
+	}
+	return m_content_seq;
+}
+
+
+
+//**************************************************************************
+//  RENDER GLYPH ATLAS
+//**************************************************************************
+
+// scaled font glyphs are packed onto a few large pages instead of each
+// character keeping its own scaled bitmaps, so a screen full of text
+// references a handful of textures that only need uploading again when
+// a new glyph (or a new size of one) is added
+class render_glyph_atlas
+{
+public:
+	static constexpr u32 PAGE_SIZE = 1024;
+	static constexpr u32 MAX_PAGES = 4;
+	static constexpr u32 MAX_GLYPH = 256;
+
+	render_glyph_atlas(render_manager &manager) : m_manager(manager), m_clock(0) { m_pages.reserve(MAX_PAGES); }
+
+	~render_glyph_atlas()
+	{
+		for (page &p : m_pages)
+		{
+			m_manager.invalidate_all(p.bitmap.get());
+			m_manager.texture_free(p.texture);
+		}
+	}
+
+	// fill in texinfo and the sub-rectangle for a scaled glyph; returns
+	// false if the caller should scale it into its own bitmap instead
+	bool get_scaled(render_texture &texture, u32 width, u32 height, render_texinfo &texinfo, render_bounds &uv, render_primitive_list &primlist)
+	{
+		if (!texture.m_scaler || !texture.m_bitmap || texture.m_format != TEXFORMAT_ARGB32)
+			return false;
+		if (width == 0) width = 1;
+		if (height == 0) height = 1;
+		if (width > MAX_GLYPH || height > MAX_GLYPH)
+			return false;
+
+		auto const key = std::make_tuple(texture.m_id, texture.m_content_seq, width, height);
+		auto found = m_slots.find(key);
+		if (found == m_slots.end())
+		{
+			// find room on a page, starting over on the least recently used one if necessary
+			u32 x, y;
+			page *dest = nullptr;
+			for (page &p : m_pages)
+				if (allocate(p, width, height, x, y))
+				{
+					dest = &p;
+					break;
+				}
+			if (!dest && (m_pages.size() < MAX_PAGES))
+			{
+				m_pages.emplace_back();
+				page &p = m_pages.back();
+				p.bitmap = std::make_unique<bitmap_argb32>(PAGE_SIZE, PAGE_SIZE);
+				p.bitmap->fill(0);
+				p.texture = m_manager.texture_alloc();
+				if (allocate(p, width, height, x, y))
+					dest = &p;
+			}
+			if (!dest)
+			{
+				page *oldest = nullptr;
+				for (page &p : m_pages)
+					if ((!oldest || (p.last_used < oldest->last_used)) && !primlist.has_reference(p.bitmap.get()))
+						oldest = &p;
+				if (!oldest)
+					return false;
+				evict(*oldest);
+				if (!allocate(*oldest, width, height, x, y))
+					return false;
+				dest = oldest;
+			}
+
+			// let the glyph's scaler draw straight into the page
+			bitmap_argb32 target(&dest->bitmap->pix(y, x), width, height, dest->bitmap->rowpixels());
+			(*texture.m_scaler)(target, downcast<bitmap_argb32 &>(*texture.m_bitmap), texture.m_sbounds, texture.m_param);
+			dest->seqid++;
+			dest->keys.push_back(key);
+			found = m_slots.emplace(key, slot{ unsigned(dest - &m_pages[0]), x, y }).first;
+		}
+
+		page &p = m_pages[found->second.page];
+		p.last_used = ++m_clock;
+		primlist.add_reference(p.bitmap.get());
+		texinfo.base = &p.bitmap->pix(0);
+		texinfo.rowpixels = p.bitmap->rowpixels();
+		texinfo.width = PAGE_SIZE;
+		texinfo.height = PAGE_SIZE;
+		texinfo.seqid = p.seqid;
+		texinfo.unique_id = p.texture->m_id;
+		texinfo.old_id = ~0ULL;
+		uv.x0 = float(found->second.x) / float(PAGE_SIZE);
+		uv.y0 = float(found->second.y) / float(PAGE_SIZE);
+		uv.x1 = float(found->second.x + width) / float(PAGE_SIZE);
+		uv.y1 = float(found->second.y + height) / float(PAGE_SIZE);
+		return true;
+	}
+
+private:
+	using slot_key = std::tuple<u64, u32, u32, u32>;
+
+	struct slot
+	{
+		unsigned    page;                       // index of the page holding the glyph
+		u32         x, y;                       // top left of the glyph on the page
+	};
+
+	struct page
+	{
+		std::unique_ptr<bitmap_argb32>  bitmap; // page pixels
+		render_texture *    texture = nullptr;  // only used for its unique ID
+		u32                 seqid = 1;          // bumped whenever pixels change
+		u64                 last_used = 0;      // clock value when last referenced
+		u32                 shelf_x = 0;        // next free column on the current shelf
+		u32                 shelf_y = 0;        // top of the current shelf
+		u32                 shelf_height = 0;   // height of the current shelf
+		std::vector<slot_key> keys;             // glyphs stored on this page
+	};
+
+	// simple shelf packer: glyphs are placed left to right, and a new shelf
+	// is started below the tallest glyph when a row fills up
+	static bool allocate(page &p, u32 width, u32 height, u32 &x, u32 &y)
+	{
+		u32 const w = width + 1, h = height + 1;
+		if ((p.shelf_x + w) > PAGE_SIZE)
+		{
+			p.shelf_y += p.shelf_height;
+			p.shelf_x = 0;
+			p.shelf_height = 0;
+		}
+		if ((p.shelf_y + h) > PAGE_SIZE)
+			return false;
+		x = p.shelf_x;
+		y = p.shelf_y;
+		p.shelf_x += w;
+		p.shelf_height = std::max(p.shelf_height, h);
+		return true;
+	}
+
+	void evict(page &p)
+	{
+		m_manager.invalidate_all(p.bitmap.get());
+		for (slot_key const &key : p.keys)
+			m_slots.erase(key);
+		p.keys.clear();
+		p.bitmap->fill(0);
+		p.seqid++;
+		p.shelf_x = p.shelf_y = p.shelf_height = 0;
+	}
+
+	render_manager &        m_manager;          // manager that owns the page textures
+	std::vector<page>       m_pages;            // pages allocated so far
+	std::map<slot_key, slot> m_slots;           // where each scaled glyph lives
+	u64                     m_clock;            // LRU clock for page eviction
+};
+
+
 
 //**************************************************************************
 //  RENDER CONTAINER
@@ -540,6 +739,7 @@ render_container::render_container(render_manager &manager, screen_device *scree
 	, m_screen(screen)
 	, m_overlaybitmap(nullptr)
 	, m_overlaytexture(nullptr)
+	, m_palette_serial(0)
 {
 	// make sure it is empty
 	empty();
@@ -772,6 +972,8 @@ render_container::item &render_container::add_generic(u8 type, float x0, float y
 
 void render_container::recompute_lookups()
 {
+	m_palette_serial++;
+
 	// recompute the 256 entry lookup table
 	for (int i = 0; i < 0x100; i++)
 	{
@@ -824,6 +1026,7 @@ void render_container::update_palette()
 	// iterate over dirty items and update them
 	if (dirty != nullptr)
 	{
+		m_palette_serial++;
 		palette_t &palette = m_palclient->palette();
 		const rgb_t *adjusted_palette = palette.entry_list_adjusted();
 
@@ -949,7 +1152,10 @@ template <typename T> render_target::render_target(render_manager &manager, T &&
 	m_layerconfig = m_base_layerconfig;
 
 	// load the layout files
-	load_layout_files(std::forward<T>(layout), flags & RENDER_CREATE_SINGLE_FILE);
+	{
+		machine_manager::startup_phase phase(manager.machine().manager(), "layout load");
+		load_layout_files(std::forward<T>(layout), flags & RENDER_CREATE_SINGLE_FILE);
+	}
 	for (layout_file &file : *m_filelist)
 		for (layout_view &view : file.views())
 			if (!(m_flags & RENDER_CREATE_NO_ART) || !view.has_art())
@@ -1001,6 +1207,8 @@ int render_target::index() const
 
 void render_target::set_bounds(s32 width, s32 height, float pixel_aspect)
 {
+	if (width != m_width || height != m_height)
+		m_element_cache.clear();
 	m_width = width;
 	m_height = height;
 	m_bounds.x0 = m_bounds.y0 = 0;
@@ -1033,6 +1241,8 @@ void render_target::set_view(unsigned viewindex)
 
 void render_target::set_max_texture_size(int maxwidth, int maxheight)
 {
+	if (maxwidth != m_maxtexwidth || maxheight != m_maxtexheight)
+		m_element_cache.clear();
 	m_maxtexwidth = maxwidth;
 	m_maxtexheight = maxheight;
 }
@@ -1342,7 +1552,11 @@ render_primitive_list &render_target::get_primitives()
 	{
 		// we're running - iterate over items in the view
 		current_view().prepare_items();
-		for (layout_view::item &curitem : current_view().visible_items())
+		layout_view::item_ref_vector const &items = current_view().visible_items();
+		if (m_element_cache.size() != items.size())
+			m_element_cache.resize(items.size());
+		auto cache = m_element_cache.begin();
+		for (layout_view::item &curitem : items)
 		{
 			// first apply orientation to the bounds
 			render_bounds bounds = curitem.bounds();
@@ -1363,7 +1577,16 @@ render_primitive_list &render_target::get_primitives()
 			if (curitem.screen())
 				add_container_primitives(list, root_xform, item_xform, curitem.screen()->container(), curitem.blend_mode());
 			else
-				add_element_primitives(list, item_xform, *curitem.element(), curitem.element_state(), curitem.blend_mode());
+			{
+				// entries follow the visible items, so drop any left by another item
+				if (cache->item != &curitem)
+				{
+					cache->item = &curitem;
+					cache->valid = false;
+				}
+				add_element_primitives(list, item_xform, *curitem.element(), curitem.element_state(), curitem.blend_mode(), *cache);
+			}
+			++cache;
 		}
 	}
 	else
@@ -2364,13 +2587,32 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					width = std::min(width, m_maxtexwidth);
 					height = std::min(height, m_maxtexheight);
 
-					curitem.texture()->get_scaled(width, height, prim->texture, list, curitem.flags());
+					// characters come from the shared glyph pages where possible
+					render_bounds atlasuv;
+					bool const atlas = (curitem.internal() & INTERNAL_FLAG_CHAR)
+							&& (m_maxtexwidth >= render_glyph_atlas::PAGE_SIZE) && (m_maxtexheight >= render_glyph_atlas::PAGE_SIZE)
+							&& m_manager.m_glyph_atlas->get_scaled(*curitem.texture(), width, height, prim->texture, atlasuv, list);
+					if (!atlas)
+						curitem.texture()->get_scaled(width, height, prim->texture, list, curitem.flags());
 
 					// set the palette
 					prim->texture.palette = curitem.texture()->get_adjusted_palette(container, prim->texture.palette_length);
 
+					// screen textures are only drawn into before a set_bitmap call, so
+					// renderers can keep their converted copy until it or the palette changes
+					if (curitem.flags() & PRIMFLAG_SCREENTEX_MASK)
+						prim->texture.seqid = curitem.texture()->content_seqid(container.palette_serial());
+
 					// determine UV coordinates
 					prim->texcoords = oriented_texcoords[finalorient];
+					if (atlas)
+					{
+						for (render_texuv *uv : { &prim->texcoords.tl, &prim->texcoords.tr, &prim->texcoords.bl, &prim->texcoords.br })
+						{
+							uv->u = atlasuv.x0 + uv->u * (atlasuv.x1 - atlasuv.x0);
+							uv->v = atlasuv.y0 + uv->v * (atlasuv.y1 - atlasuv.y0);
+						}
+					}
 
 					// apply clipping
 					clipped = render_clip_quad(&prim->bounds, &cliprect, &prim->texcoords);
@@ -2492,10 +2734,12 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 
 //-------------------------------------------------
 //  add_element_primitives - add the primitive
-//  for an element in the current state
+//  for an element in the given state, reusing the
+//  geometry from the last frame if the item has
+//  not changed
 //-------------------------------------------------
 
-void render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode)
+void render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode, element_cache_entry &cache)
 {
 	// limit state range to non-negative values
 	if (state < 0)
@@ -2503,14 +2747,33 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 
 	// get a pointer to the relevant texture
 	render_texture *texture = element.state_texture(state);
-	if (texture)
-	{
-		render_primitive *prim = list.alloc(render_primitive::QUAD);
+	if (!texture)
+		return;
+
+	// rebuild the geometry only if the item moved, changed colour or changed state
+	bool const reuse =
+			cache.valid &&
+			(cache.state == state) &&
+			(cache.xform.xoffs == xform.xoffs) &&
+			(cache.xform.yoffs == xform.yoffs) &&
+			(cache.xform.xscale == xform.xscale) &&
+			(cache.xform.yscale == xform.yscale) &&
+			(cache.xform.orientation == xform.orientation) &&
+			(cache.xform.color.a == xform.color.a) &&
+			(cache.xform.color.r == xform.color.r) &&
+			(cache.xform.color.g == xform.color.g) &&
+			(cache.xform.color.b == xform.color.b);
+	if (reuse && cache.clipped)
+		return;
+
+	render_primitive *prim = list.alloc(render_primitive::QUAD);
 
-		// configure the basics
-		prim->color = xform.color;
-		prim->flags = PRIMFLAG_TEXORIENT(xform.orientation) | PRIMFLAG_BLENDMODE(blendmode) | PRIMFLAG_TEXFORMAT(texture->format());
+	// configure the basics
+	prim->color = xform.color;
+	prim->flags = PRIMFLAG_TEXORIENT(xform.orientation) | PRIMFLAG_BLENDMODE(blendmode) | PRIMFLAG_TEXFORMAT(texture->format());
 
+	if (!reuse)
+	{
 		// compute the bounds
 		s32 width = render_round_nearest(xform.xscale);
 		s32 height = render_round_nearest(xform.yscale);
@@ -2521,9 +2784,6 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 		width = (std::min)(width, m_maxtexwidth);
 		height = (std::min)(height, m_maxtexheight);
 
-		// get the scaled texture and append it
-		texture->get_scaled(width, height, prim->texture, list, prim->flags);
-
 		// compute the clip rect
 		render_bounds cliprect = prim->bounds & m_bounds;
 
@@ -2531,9 +2791,34 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 		prim->texcoords = oriented_texcoords[xform.orientation];
 		bool clipped = render_clip_quad(&prim->bounds, &cliprect, &prim->texcoords);
 
-		// add to the list or free if we're clipped out
-		list.append_or_return(*prim, clipped);
+		// remember the result for next time
+		cache.valid = true;
+		cache.xform = xform;
+		cache.state = state;
+		cache.clipped = clipped;
+		cache.bounds = prim->bounds;
+		cache.full_bounds = prim->full_bounds;
+		cache.texcoords = prim->texcoords;
+		cache.texwidth = width;
+		cache.texheight = height;
+
+		// don't bother getting a texture if we're clipped out
+		if (clipped)
+		{
+			list.append_or_return(*prim, true);
+			return;
+		}
 	}
+	else
+	{
+		prim->bounds = cache.bounds;
+		prim->full_bounds = cache.full_bounds;
+		prim->texcoords = cache.texcoords;
+	}
+
+	// get the scaled texture and append it
+	texture->get_scaled(cache.texwidth, cache.texheight, prim->texture, list, prim->flags);
+	list.append(*prim);
 }
 
 
@@ -3036,6 +3321,7 @@ render_manager::render_manager(running_machine &machine)
 	, m_ui_target(nullptr)
 	, m_live_textures(0)
 	, m_texture_id(0)
+	, m_glyph_atlas(std::make_unique<render_glyph_atlas>(*this))
 	, m_ui_container(new render_container(*this))
 {
 	// register callbacks
@@ -3056,6 +3342,7 @@ render_manager::~render_manager()
 	// free all the containers since they may own textures
 	container_free(m_ui_container);
 	m_screen_container_list.reset();
+	m_glyph_atlas.reset();
 
 	// better not be any outstanding textures when we die
 	assert(m_live_textures == 0);
@@ -154,6 +154,9 @@ constexpr u32 PRIMFLAG_GET_VECTORBUF(u32 x) { return (x & PRIMFLAG_VECTORBUF_MAS
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+// pages of scaled font glyphs shared between characters (internal to render.cpp)
+class render_glyph_atlas;
+
 // texture scaling callback
 typedef void (*texture_scaler_func)(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 
@@ -317,6 +320,7 @@ class render_texture
 	friend class fixed_allocator<render_texture>;
 	friend class render_manager;
 	friend class render_target;
+	friend class render_glyph_atlas;
 
 	// construction/destruction
 	render_texture();
@@ -346,6 +350,7 @@ private:
 	// internal helpers
 	void get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0);
 	const rgb_t *get_adjusted_palette(render_container &container, u32 &out_length);
+	u32 content_seqid(u32 palette_serial);
 
 	static const int MAX_TEXTURE_SCALES = 16;
 
@@ -369,6 +374,8 @@ private:
 	texture_scaler_func m_scaler;                   // scaling callback
 	void *              m_param;                    // scaling callback parameter
 	u32                 m_curseq;                   // current sequence number
+	u32                 m_content_seq;              // sequence number of the current bitmap contents
+	u32                 m_palette_serial;           // container palette serial the contents were tagged with
 	scaled_texture      m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
 };
 
@@ -478,6 +485,7 @@ private:
 	item &add_generic(u8 type, float x0, float y0, float x1, float y1, rgb_t argb);
 	void recompute_lookups();
 	void update_palette();
+	u32 palette_serial() const { return m_palette_serial; }
 
 	// internal state
 	render_container *      m_next;                 // the next container in the list
@@ -491,6 +499,7 @@ private:
 	std::unique_ptr<palette_client> m_palclient;    // client to the screen palette
 	std::vector<rgb_t>      m_bcglookup;            // copy of screen palette with bcg adjustment
 	rgb_t                   m_bcglookup256[0x400];  // lookup table for brightness/contrast/gamma
+	u32                     m_palette_serial;       // bumped whenever the lookup tables change
 };
 
 
@@ -581,6 +590,7 @@ private:
 
 	// private classes declared in render.cpp
 	struct object_transform;
+	struct element_cache_entry;
 
 	// internal helpers
 	enum constructor_impl_t { CONSTRUCTOR_IMPL };
@@ -593,7 +603,7 @@ private:
 	bool load_layout_file(const char *dirname, const internal_layout &layout_data, device_t *device = nullptr);
 	bool load_layout_file(device_t &device, util::xml::data_node const &rootnode, const char *searchpath, const char *dirname);
 	void add_container_primitives(render_primitive_list &list, const object_transform &root_xform, const object_transform &xform, render_container &container, int blendmode);
-	void add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode);
+	void add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode, element_cache_entry &cache);
 	std::pair<float, float> map_point_internal(s32 target_x, s32 target_y);
 
 	// config callbacks
@@ -641,6 +651,7 @@ private:
 	render_layer_config     m_base_layerconfig;         // the layer configuration at the time of first frame
 	int                     m_maxtexwidth;              // maximum width of a texture
 	int                     m_maxtexheight;             // maximum height of a texture
+	std::vector<element_cache_entry> m_element_cache;   // element geometry from the last frame, by visible item
 	simple_list<render_container> m_debug_containers;   // list of debug containers
 	s32                     m_clear_extent_count;       // number of clear extents
 	s32                     m_clear_extents[MAX_CLEAR_EXTENTS]; // array of clear extents
@@ -718,6 +729,7 @@ private:
 	u32                             m_live_textures;    // number of live textures
 	u64                             m_texture_id;       // rolling texture ID counter
 	fixed_allocator<render_texture> m_texture_allocator;// texture allocator
+	std::unique_ptr<render_glyph_atlas> m_glyph_atlas;  // shared pages for scaled font glyphs
 
 	// containers for the UI and for screens
 	render_container *              m_ui_container;     // UI container
@@ -13,6 +13,10 @@
 #include "eminline.h"
 #include "video/rgbutil.h"
 #include "render.h"
+#include "osdcore.h"
+
+#include <algorithm>
+#include <array>
 
 
 template<typename _PixelType, int _SrcShiftR, int _SrcShiftG, int _SrcShiftB, int _DstShiftR, int _DstShiftG, int _DstShiftB, bool _NoDestRead = false, bool _BilinearFilter = false>
@@ -337,10 +341,16 @@ private:
 	//  draw_line - draw a line or point
 	//-------------------------------------------------
 
-	static void draw_line(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void draw_line(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 miny, s32 maxy, u32 pitch)
 	{
-		// internal tables
-		static u32 s_cosine_table[2049];
+		// internal tables; built once, since bands may draw lines concurrently
+		static const std::array<u32, 2049> s_cosine_table = []
+		{
+			std::array<u32, 2049> table;
+			for (int entry = 0; entry <= 2048; entry++)
+				table[entry] = int(double(1.0 / cos(atan(double(entry) / 2048.0))) * 0x10000000 + 0.5);
+			return table;
+		}();
 
 		// compute the start/end coordinates
 		int x1 = int(prim.bounds.x0 * 65536.0f);
@@ -353,11 +363,6 @@ private:
 
 		if (PRIMFLAG_GET_ANTIALIAS(prim.flags))
 		{
-			// build up the cosine table if we haven't yet
-			if (s_cosine_table[0] == 0)
-				for (int entry = 0; entry <= 2048; entry++)
-					s_cosine_table[entry] = int(double(1.0 / cos(atan(double(entry) / 2048.0))) * 0x10000000 + 0.5);
-
 			int beam = prim.width * 65536.0f;
 			if (beam < 0x00010000)
 				beam = 0x00010000;
@@ -382,7 +387,7 @@ private:
 					{
 						dx = bwidth;    // init diameter of beam
 						dy = y1 >> 16;
-						if (dy >= 0 && dy < height)
+						if (dy >= miny && dy < maxy)
 							draw_aa_pixel(dstdata, pitch, x1, dy, apply_intensity(0xff & (~y1 >> 8), col));
 						dy++;
 						dx -= 0x10000 - (0xffff & y1); // take off amount plotted
@@ -390,11 +395,11 @@ private:
 						dx >>= 16;                   // adjust to pixel (solid) count
 						while (dx--)                 // plot rest of pixels
 						{
-							if (dy >= 0 && dy < height)
+							if (dy >= miny && dy < maxy)
 								draw_aa_pixel(dstdata, pitch, x1, dy, col);
 							dy++;
 						}
-						if (dy >= 0 && dy < height)
+						if (dy >= miny && dy < maxy)
 							draw_aa_pixel(dstdata, pitch, x1, dy, apply_intensity(a1,col));
 					}
 					if (x1 == xx) break;
@@ -414,7 +419,7 @@ private:
 				x1 -= bwidth >> 1; // start back half the width
 				for (;;)
 				{
-					if (y1 >= 0 && y1 < height)
+					if (y1 >= miny && y1 < maxy)
 					{
 						dy = bwidth;    // calc diameter of beam
 						dx = x1 >> 16;
@@ -457,7 +462,7 @@ private:
 			{
 				for (;;)
 				{
-					if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height)
+					if (x1 >= 0 && x1 < width && y1 >= miny && y1 < maxy)
 						draw_aa_pixel(dstdata, pitch, x1, y1, col);
 					if (x1 == x2) break;
 					x1 += sx;
@@ -473,7 +478,7 @@ private:
 			{
 				for (;;)
 				{
-					if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height)
+					if (x1 >= 0 && x1 < width && y1 >= miny && y1 < maxy)
 						draw_aa_pixel(dstdata, pitch, x1, y1, col);
 					if (y1 == y2) break;
 					y1 += sy;
@@ -498,7 +503,7 @@ private:
 	//  draw_rect - draw a solid rectangle
 	//-------------------------------------------------
 
-	static void draw_rect(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void draw_rect(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 miny, s32 maxy, u32 pitch)
 	{
 		render_bounds fpos = prim.bounds;
 		assert(fpos.x0 <= fpos.x1);
@@ -515,10 +520,10 @@ private:
 		if (startx >= width) startx = width;
 		if (endx < 0) endx = 0;
 		if (endx >= width) endx = width;
-		if (starty < 0) starty = 0;
-		if (starty >= height) starty = height;
-		if (endy < 0) endy = 0;
-		if (endy >= height) endy = height;
+		if (starty < miny) starty = miny;
+		if (starty >= maxy) starty = maxy;
+		if (endy < miny) endy = miny;
+		if (endy >= maxy) endy = maxy;
 
 		// bail if nothing left
 		if (fpos.x0 > fpos.x1 || fpos.y0 > fpos.y1)
@@ -1697,7 +1702,7 @@ private:
 	//  drawing routine
 	//-------------------------------------------------
 
-	static void setup_and_draw_textured_quad(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void setup_and_draw_textured_quad(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, s32 miny, s32 maxy, u32 pitch)
 	{
 		assert(prim.bounds.x0 <= prim.bounds.x1);
 		assert(prim.bounds.y0 <= prim.bounds.y1);
@@ -1744,6 +1749,16 @@ private:
 			setup.startv -= 0x8000;
 		}
 
+		// restrict to our band, stepping U/V down to its first row
+		if (setup.starty < miny)
+		{
+			setup.startu += (miny - setup.starty) * setup.dudy;
+			setup.startv += (miny - setup.starty) * setup.dvdy;
+			setup.starty = miny;
+		}
+		if (setup.endy > maxy)
+			setup.endy = maxy;
+
 		// render based on the texture coordinates
 		switch (prim.flags & (PRIMFLAG_TEXFORMAT_MASK | PRIMFLAG_BLENDMODE_MASK))
 		{
@@ -1796,34 +1811,87 @@ private:
 
 
 	//**************************************************************************
-	//  PRIMARY ENTRY POINT
+	//  BANDED RENDERING
 	//**************************************************************************
 
 	//-------------------------------------------------
-	//  draw_primitives - draw a series of primitives
-	//  using a software rasterizer
+	//  draw_band - draw a series of primitives into
+	//  rows miny to maxy - 1 of the target
 	//-------------------------------------------------
 
-public:
-	static void draw_primitives(const render_primitive_list &primlist, void *dstdata, u32 width, u32 height, u32 pitch)
+	static void draw_band(const render_primitive_list &primlist, _PixelType *dstdata, u32 width, u32 height, s32 miny, s32 maxy, u32 pitch)
 	{
 		// loop over the list and render each element
 		for (const render_primitive *prim = primlist.first(); prim != nullptr; prim = prim->next())
 			switch (prim->type)
 			{
 				case render_primitive::LINE:
-					draw_line(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+					draw_line(*prim, dstdata, width, miny, maxy, pitch);
 					break;
 
 				case render_primitive::QUAD:
 					if (!prim->texture.base)
-						draw_rect(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+						draw_rect(*prim, dstdata, width, miny, maxy, pitch);
 					else
-						setup_and_draw_textured_quad(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+						setup_and_draw_textured_quad(*prim, dstdata, width, height, miny, maxy, pitch);
 					break;
 
 				default:
 					throw emu_fatalerror("Unexpected render_primitive type");
 			}
 	}
+
+	// bands are at least this many rows, and there are at most this many of them
+	static constexpr u32 MIN_BAND_ROWS = 64;
+	static constexpr u32 MAX_BANDS = 16;
+
+	struct band_params
+	{
+		const render_primitive_list *primlist;
+		_PixelType *dstdata;
+		u32 width, height, pitch;
+		s32 miny, maxy;
+	};
+
+	static void *draw_band_callback(void *param, int threadid)
+	{
+		const band_params &band = *reinterpret_cast<const band_params *>(param);
+		draw_band(*band.primlist, band.dstdata, band.width, band.height, band.miny, band.maxy, band.pitch);
+		return nullptr;
+	}
+
+
+	//**************************************************************************
+	//  PRIMARY ENTRY POINT
+	//**************************************************************************
+
+	//-------------------------------------------------
+	//  draw_primitives - draw a series of primitives
+	//  using a software rasterizer; given a work
+	//  queue, horizontal bands of the target are
+	//  drawn in parallel
+	//-------------------------------------------------
+
+public:
+	static void draw_primitives(const render_primitive_list &primlist, void *dstdata, u32 width, u32 height, u32 pitch, osd_work_queue *queue = nullptr)
+	{
+		_PixelType *const dest = reinterpret_cast<_PixelType *>(dstdata);
+
+		// every band walks the whole list, so overlapping primitives still draw in order
+		u32 const bands = queue ? std::min(MAX_BANDS, height / MIN_BAND_ROWS) : 1;
+		if (bands <= 1)
+		{
+			draw_band(primlist, dest, width, height, 0, height, pitch);
+			return;
+		}
+
+		band_params params[MAX_BANDS];
+		for (u32 band = 0; band < bands; band++)
+			params[band] = band_params{ &primlist, dest, width, height, pitch, s32(height * band / bands), s32(height * (band + 1) / bands) };
+
+		// the first band is drawn here while the workers take the rest
+		osd_work_item_queue_multiple(queue, draw_band_callback, bands - 1, &params[1], sizeof(params[1]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		draw_band_callback(&params[0], 0);
+		osd_work_queue_wait(queue, osd_ticks_per_second() * 100);
+	}
 };
@@ -30,6 +30,7 @@
 #include <cstring>
 #include <iomanip>
 #include <limits>
+#include <list>
 #include <locale>
 #include <sstream>
 #include <stdexcept>
@@ -1607,28 +1608,22 @@ private:
 
 	void draw_svg(bitmap_argb32 &dest, rectangle const &bounds, int state)
 	{
-		// rasterise into a temporary bitmap
+		// rasterising is expensive, so reuse the image if it was drawn at this size recently
 		float const xscale(bounds.width() / m_svg->width);
 		float const yscale(bounds.height() / m_svg->height);
 		float const drawscale((std::max)(xscale, yscale));
-		bitmap_argb32 tempbitmap(int(m_svg->width * drawscale), int(m_svg->height * drawscale));
-		nsvgRasterize(
-				m_rasterizer.get(),
-				m_svg.get(),
-				0, 0, drawscale,
-				reinterpret_cast<unsigned char *>(&tempbitmap.pix(0)),
-				tempbitmap.width(), tempbitmap.height(),
-				tempbitmap.rowbytes());
+		bitmap_argb32 const &raster(get_svg_raster(int(m_svg->width * drawscale), int(m_svg->height * drawscale), drawscale));
 
 		// correct colour format and multiply by state colour
+		bitmap_argb32 tempbitmap(raster.width(), raster.height());
 		bool havealpha(false);
 		render_color const c(color(state));
 		for (s32 y = 0; tempbitmap.height() > y; ++y)
 		{
+			u8 const *src(reinterpret_cast<u8 const *>(&raster.pix(y)));
 			u32 *dst(&tempbitmap.pix(y));
-			for (s32 x = 0; tempbitmap.width() > x; ++x, ++dst)
+			for (s32 x = 0; tempbitmap.width() > x; ++x, ++dst, src += 4)
 			{
-				u8 const *const src(reinterpret_cast<u8 const *>(dst));
 				rgb_t const d(
 						u8((float(src[3]) * c.a) + 0.5),
 						u8((float(src[0]) * c.r) + 0.5),
@@ -1666,6 +1661,33 @@ private:
 		}
 	}
 
+	bitmap_argb32 const &get_svg_raster(s32 width, s32 height, float drawscale)
+	{
+		auto found = std::find_if(
+				m_svg_rasters.begin(),
+				m_svg_rasters.end(),
+				[width, height] (bitmap_argb32 const &bitmap) { return (bitmap.width() == width) && (bitmap.height() == height); });
+		if (m_svg_rasters.end() != found)
+		{
+			// keep the most recently used size at the front
+			m_svg_rasters.splice(m_svg_rasters.begin(), m_svg_rasters, found);
+			return m_svg_rasters.front();
+		}
+
+		// rasterise into a new bitmap, dropping the least recently used size if necessary
+		if (SVG_RASTER_CACHE_SIZE <= m_svg_rasters.size())
+			m_svg_rasters.pop_back();
+		bitmap_argb32 &result(m_svg_rasters.emplace_front(width, height));
+		nsvgRasterize(
+				m_rasterizer.get(),
+				m_svg.get(),
+				0, 0, drawscale,
+				reinterpret_cast<unsigned char *>(&result.pix(0)),
+				result.width(), result.height(),
+				result.rowbytes());
+		return result;
+	}
+
 	void alpha_blend(bitmap_argb32 const &srcbitmap, bitmap_argb32 &dstbitmap, rectangle const &bounds)
 	{
 		for (s32 y0 = 0, y1 = bounds.top(); bounds.bottom() >= y1; ++y0, ++y1)
@@ -1949,9 +1971,13 @@ private:
 			return "";
 	}
 
+	// number of distinct sizes to keep rasterised SVG images for
+	static constexpr std::size_t SVG_RASTER_CACHE_SIZE = 4;
+
 	// internal state
 	util::nsvg_image_ptr            m_svg;              // parsed SVG image
 	std::shared_ptr<NSVGrasterizer> m_rasterizer;       // SVG rasteriser
+	std::list<bitmap_argb32>        m_svg_rasters;      // recently rasterised SVG images, most recent first
 	bitmap_argb32                   m_bitmap;           // source bitmap for images
 	bool                            m_hasalpha = false; // is there any alpha component present?
 
@@ -4282,10 +4308,28 @@ void layout_view::set_recomputed_callback(recomputed_delegate &&handler)
 
 void layout_view::preload()
 {
+	// several items can share an element, which only needs loading once
+	std::vector<layout_element *> elements;
 	for (item &curitem : m_visible_items)
 	{
 		if (curitem.element())
-			curitem.element()->preload();
+			elements.push_back(curitem.element());
+	}
+	std::sort(elements.begin(), elements.end());
+	elements.erase(std::unique(elements.begin(), elements.end()), elements.end());
+
+	// elements load independently, and decoding their images dominates, so do them concurrently
+	osd_work_queue *const queue = (elements.size() > 1) ? osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI) : nullptr;
+	if (queue)
+	{
+		osd_work_item_queue_multiple(queue, &layout_view::preload_element, elements.size(), &elements[0], sizeof(elements[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(queue, 100 * osd_ticks_per_second());
+		osd_work_queue_free(queue);
+	}
+	else
+	{
+		for (layout_element *element : elements)
+			element->preload();
 	}
 
 	if (!m_preload.isnull())
@@ -4293,6 +4337,18 @@ void layout_view::preload()
 }
 
 
+//-------------------------------------------------
+//  preload_element - load one element on a
+//  worker thread
+//-------------------------------------------------
+
+void *layout_view::preload_element(void *param, int threadid)
+{
+	(*reinterpret_cast<layout_element **>(param))->preload();
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  resolve_tags - resolve tags
 //-------------------------------------------------
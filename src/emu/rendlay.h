@@ -492,6 +492,7 @@ private:
 			bool init);
 
 	static std::string make_name(layout_environment &env, util::xml::data_node const &viewnode);
+	static void *preload_element(void *param, int threadid);
 
 	// internal state
 	float                       m_effaspect;        // X/Y of the layout in current configuration
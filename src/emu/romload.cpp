@@ -17,7 +17,10 @@
 #include "softlist_dev.h"
 #include "ui/uimain.h"
 
+#include "osdfile.h"
+
 #include <algorithm>
+#include <cstdio>
 #include <set>
 
 
@@ -502,7 +505,7 @@ void rom_load_manager::dump_wrong_and_correct_checksums(const util::hash_collect
     and hash signatures of a file
 -------------------------------------------------*/
 
-void rom_load_manager::verify_length_and_hash(emu_file *file, std::string_view name, u32 explength, const util::hash_collection &hashes)
+void rom_load_manager::verify_length_and_hash(emu_file *file, std::string_view name, u32 explength, const util::hash_collection &hashes, bool known)
 {
 	// we've already complained if there is no file
 	if (!file)
@@ -524,14 +527,11 @@ void rom_load_manager::verify_length_and_hash(emu_file *file, std::string_view n
 	}
 	else
 	{
-		// verify checksums
-		util::hash_collection const &acthashes = file->hashes(hashes.hash_types());
-		if (hashes != acthashes)
+		// verify checksums, unless the file is known to match already
+		if (!known && (hashes != file->hashes(hashes.hash_types())))
 		{
 			// otherwise, it's just bad
-			util::hash_collection const &all_acthashes = (acthashes.hash_types() == util::hash_collection::HASH_TYPES_ALL)
-					? acthashes
-					: file->hashes(util::hash_collection::HASH_TYPES_ALL);
+			util::hash_collection const &all_acthashes = file->hashes(util::hash_collection::HASH_TYPES_ALL);
 			m_errorstring.append(string_format("%s WRONG CHECKSUMS:\n", name));
 			dump_wrong_and_correct_checksums(hashes, all_acthashes);
 			m_warnings++;
@@ -546,6 +546,191 @@ void rom_load_manager::verify_length_and_hash(emu_file *file, std::string_view n
 }
 
 
+/*-------------------------------------------------
+    queue_verify - hand a file that's been read
+    to a worker to hash while the next is read;
+    it is verified in order by finish_verifies
+-------------------------------------------------*/
+
+void rom_load_manager::queue_verify(std::unique_ptr<emu_file> &&file, std::string_view name, u32 explength, util::hash_collection &&hashes)
+{
+	if (!m_hash_queue)
+		m_hash_queue.reset(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI));
+
+	pending_verify &pending = m_pending_verifies.emplace_back(std::move(file), name, explength, std::move(hashes));
+	if (!pending.hashes.flag(util::hash_collection::FLAG_NO_DUMP))
+	{
+		// files verified on an earlier run needn't be hashed again
+		if (!m_hash_cache_path.empty() && hash_cache_key(*pending.file, pending.cachekey, pending.cachesize, pending.cachetime))
+		{
+			auto const found(m_hash_cache.find(pending.cachekey));
+			if ((m_hash_cache.end() != found) && (found->second.size == pending.cachesize) && (found->second.modified == pending.cachetime) && (found->second.hashes == pending.hashes))
+				pending.known = true;
+		}
+
+		// a stored ZIP entry is still being read from its archive, so hash it before letting go of that
+		if (!pending.known && pending.file->is_read_in_place())
+			pending.file->hashes(pending.hashes.hash_types());
+		else if (m_hash_queue && !pending.known)
+			pending.item = osd_work_item_queue(m_hash_queue.get(), &rom_load_manager::hash_file, &pending, 0);
+	}
+
+	// the next ROM is likely in the same archive, and it can only be found in the cache once closed
+	pending.file->close_archive();
+
+	// don't keep too many whole files in memory
+	finish_verifies(m_pending_verifies.size() > 8);
+}
+
+
+/*-------------------------------------------------
+    finish_verifies - verify the files whose
+    hashes are ready, or all of them if asked to
+    wait
+-------------------------------------------------*/
+
+void rom_load_manager::finish_verifies(bool wait)
+{
+	while (!m_pending_verifies.empty())
+	{
+		pending_verify &pending = m_pending_verifies.front();
+		if (pending.item)
+		{
+			if (!osd_work_item_wait(pending.item, wait ? (100 * osd_ticks_per_second()) : 0))
+				break;
+			osd_work_item_release(pending.item);
+			pending.item = nullptr;
+		}
+
+		LOG("Verifying length (%X) and checksums\n", pending.explength);
+		verify_length_and_hash(pending.file.get(), pending.name, pending.explength, pending.hashes, pending.known);
+		LOG("Verify finished\n");
+
+		// remember files that checked out
+		if (!pending.known && !pending.cachekey.empty() && (pending.file->size() == pending.explength))
+		{
+			util::hash_collection const &acthashes = pending.file->hashes(pending.hashes.hash_types());
+			if (acthashes == pending.hashes)
+			{
+				m_hash_cache[pending.cachekey] = hash_cache_entry{ pending.cachesize, pending.cachetime, acthashes };
+				m_hash_cache_dirty = true;
+			}
+		}
+		m_pending_verifies.pop_front();
+	}
+}
+
+
+/*-------------------------------------------------
+    hash_file - compute the hashes a file will be
+    checked against on a worker thread
+-------------------------------------------------*/
+
+void *rom_load_manager::hash_file(void *param, int threadid)
+{
+	pending_verify &pending = *reinterpret_cast<pending_verify *>(param);
+	pending.file->hashes(pending.hashes.hash_types());
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    hash_cache_key - identify a file for the
+    verified hash cache by its path, or its
+    archive's path and its name within it, along
+    with the size and modification time of what's
+    on disk
+-------------------------------------------------*/
+
+bool rom_load_manager::hash_cache_key(emu_file &file, std::string &key, u64 &size, s64 &modified)
+{
+	bool const archived(*file.archive_path());
+	std::string const path(archived ? file.archive_path() : file.fullpath());
+	std::unique_ptr<osd::directory::entry> const info(osd_stat(path));
+	if (!info)
+		return false;
+
+	key = path;
+	if (archived)
+		key.append(1, '\t').append(file.filename());
+	size = info->size;
+	modified = info->last_modified.time_since_epoch().count();
+	return true;
+}
+
+
+/*-------------------------------------------------
+    load_hash_cache - read the hashes of files
+    verified on earlier runs, one per line as
+    size, modification time, hashes and key
+-------------------------------------------------*/
+
+void rom_load_manager::load_hash_cache()
+{
+	char const *const path(machine().options().hash_cache_directory());
+	if (!path || !*path)
+		return;
+	m_hash_cache_path = path;
+
+	emu_file file(m_hash_cache_path, OPEN_FLAG_READ);
+	if (file.open("romhash.txt") != osd_file::error::NONE)
+		return;
+
+	char buffer[4096];
+	if (!file.gets(buffer, std::size(buffer)) || (strtrimrightspace(std::string_view(buffer)) != "# ROM hash cache 1"))
+		return;
+
+	while (file.gets(buffer, std::size(buffer)))
+	{
+		char *end;
+		u64 const size(std::strtoull(buffer, &end, 10));
+		s64 const modified(std::strtoll(end, &end, 10));
+		while (' ' == *end)
+			++end;
+		char *const hashstart(end);
+		while (*end && (' ' != *end))
+			++end;
+
+		std::string_view const key(strtrimrightspace(std::string_view(*end ? (end + 1) : end)));
+		hash_cache_entry entry{ size, modified, util::hash_collection() };
+		if (!key.empty() && entry.hashes.from_internal_string(std::string_view(hashstart, end - hashstart)))
+			m_hash_cache.emplace(key, std::move(entry));
+	}
+}
+
+
+/*-------------------------------------------------
+    save_hash_cache - write out the verified hash
+    cache if anything was added
+-------------------------------------------------*/
+
+void rom_load_manager::save_hash_cache()
+{
+	if (!m_hash_cache_dirty)
+		return;
+	m_hash_cache_dirty = false;
+
+	emu_file file(m_hash_cache_path, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open("romhash.txt") != osd_file::error::NONE)
+		return;
+
+	file.puts("# ROM hash cache 1\n");
+	for (auto const &entry : m_hash_cache)
+		file.printf("%u %d %s %s\n", entry.second.size, entry.second.modified, entry.second.hashes.internal_string(), entry.first);
+}
+
+
+rom_load_manager::pending_verify::~pending_verify()
+{
+	// a load that failed part way can drop files still being hashed
+	if (item)
+	{
+		osd_work_item_wait(item, 100 * osd_ticks_per_second());
+		osd_work_item_release(item);
+	}
+}
+
+
 /*-------------------------------------------------
     display_loading_rom_message - display
     messages about ROM loading to the user
@@ -929,8 +1114,10 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 		{
 			// handle files
 			bool const irrelevantbios = (ROM_GETBIOSFLAGS(romp) != 0) && (ROM_GETBIOSFLAGS(romp) != bios);
+			rom_entry const *const verifyrom = romp;
 			rom_entry const *baserom = romp;
 			int explength = 0;
+			u32 verifylength = 0;
 
 			// open the file if it is a non-BIOS or matches the current BIOS
 			LOG("Opening ROM file: %s\n", ROM_GETNAME(romp));
@@ -939,7 +1126,11 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 			{
 				file = open_rom_file(searchpath, romp, tried_file_names, from_list);
 				if (!file)
+				{
+					// keep the messages in ROM order
+					finish_verifies(true);
 					handle_missing_file(romp, tried_file_names, CHDERR_NONE);
+				}
 			}
 
 			// loop until we run out of reloads
@@ -965,13 +1156,9 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 				}
 				while (ROMENTRY_ISCONTINUE(romp) || ROMENTRY_ISIGNORE(romp));
 
-				// if this was the first use of this file, verify the length and CRC
+				// if this was the first use of this file, it's what we verify the length against
 				if (baserom)
-				{
-					LOG("Verifying length (%X) and checksums\n", explength);
-					verify_length_and_hash(file.get(), baserom->name(), explength, util::hash_collection(baserom->hashdata()));
-					LOG("Verify finished\n");
-				}
+					verifylength = explength;
 
 				// re-seek to the start and clear the baserom so we don't reverify
 				if (file)
@@ -981,18 +1168,181 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 			}
 			while (ROMENTRY_ISRELOAD(romp));
 
-			// close the file
+			// hash and verify the file while we carry on reading, then close it
 			if (file)
-			{
-				LOG("Closing ROM file\n");
-				file.reset();
-			}
+				queue_verify(std::move(file), verifyrom->name(), verifylength, util::hash_collection(verifyrom->hashdata()));
 		}
 		else
 		{
 			romp++; // something else - skip
 		}
 	}
+
+	// everything in the region is verified before we move on
+	finish_verifies(true);
+}
+
+
+/*-------------------------------------------------
+    is_mappable_region - can a region be mapped
+    straight from its ROM file? it has to be a
+    plain copy of a single file, with nothing
+    the loader would have to rearrange
+-------------------------------------------------*/
+
+bool rom_load_manager::is_mappable_region(const rom_entry *region, u8 width, endianness_t endianness) const
+{
+	if (!machine().options().map_roms())
+		return false;
+
+	// post-processing would write to every byte anyway
+	if (ROMREGION_ISINVERTED(region) || (width > 1 && endianness != ENDIANNESS_NATIVE))
+		return false;
+
+	// exactly one unconditional ROM_LOAD, nothing after it
+	const rom_entry *const romp = region + 1;
+	if (!ROMENTRY_ISFILE(romp) || !ROMENTRY_ISREGIONEND(romp + 1) || ROM_GETBIOSFLAGS(romp))
+		return false;
+
+	// covering the whole region, with no interleaving
+	return (ROM_GETOFFSET(romp) == 0)
+			&& (ROM_GETLENGTH(romp) == ROMREGION_GETLENGTH(region))
+			&& (ROM_GETBITWIDTH(romp) == 8)
+			&& (ROM_GETGROUPSIZE(romp) == 1)
+			&& (ROM_GETSKIPCOUNT(romp) == 0);
+}
+
+
+/*-------------------------------------------------
+    process_mapped_region - load a mappable region,
+    mapping the file if it isn't in an archive and
+    reading it the usual way otherwise
+-------------------------------------------------*/
+
+void rom_load_manager::process_mapped_region(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, const rom_entry *region, std::string const &regiontag, u8 width, endianness_t endianness)
+{
+	const rom_entry *const romp = region + 1;
+	u32 const length = ROM_GETLENGTH(romp);
+	std::vector<std::string> tried_file_names;
+
+	LOG("Opening ROM file: %s\n", ROM_GETNAME(romp));
+	std::unique_ptr<emu_file> file = open_rom_file(searchpath, romp, tried_file_names, false);
+
+	std::unique_ptr<osd::file_mapping> mapping;
+	if (file && !file->is_archived() && (file->size() == length))
+		mapping = std::make_unique<osd::file_mapping>(file->fullpath(), length);
+
+	if (mapping && *mapping)
+	{
+		m_region = machine().memory().region_alloc(regiontag, std::move(mapping), width, endianness);
+		LOG("Mapped %X bytes of %s @ %p\n", m_region->bytes(), file->fullpath(), m_region->base());
+	}
+	else
+	{
+		// the same as the general path: zeroed or erased, then read
+		m_region = machine().memory().region_alloc(regiontag, length, width, endianness);
+		LOG("Allocated %X bytes @ %p\n", m_region->bytes(), m_region->base());
+		memset(m_region->base(), ROMREGION_ISERASE(region) ? ROMREGION_GETERASEVAL(region) : 0, m_region->bytes());
+		if (!file)
+			handle_missing_file(romp, tried_file_names, CHDERR_NONE);
+		read_rom_data(file.get(), region, romp);
+	}
+
+	LOG("Verifying length (%X) and checksums\n", length);
+	verify_length_and_hash(file.get(), romp->name(), length, util::hash_collection(romp->hashdata()));
+}
+
+
+/*-------------------------------------------------
+    shared_region_key - work out the name a region
+    is published under in the shared ROM directory,
+    from everything that determines its contents;
+    empty if it can't be shared
+-------------------------------------------------*/
+
+std::string rom_load_manager::shared_region_key(device_t &device, const rom_entry *region, u8 width, endianness_t endianness) const
+{
+	char const *const path(machine().options().shared_rom_directory());
+	if (!path || !*path)
+		return std::string();
+
+	util::sha1_creator key;
+	auto const append_entry =
+			[&key] (const rom_entry *entry)
+			{
+				u32 const fields[3] = { entry->get_offset(), entry->get_length(), entry->get_flags() };
+				key.append(entry->name().c_str(), entry->name().length() + 1);
+				key.append(entry->hashdata().c_str(), entry->hashdata().length() + 1);
+				key.append(fields, sizeof(fields));
+			};
+
+	u32 const params[3] = { u32(device.system_bios()), width, u32(endianness) };
+	key.append(params, sizeof(params));
+	append_entry(region);
+	for (const rom_entry *romp = region + 1; !ROMENTRY_ISREGIONEND(romp); romp++)
+	{
+		// copies depend on another region that may be named the same but hold something else
+		if (ROMENTRY_ISCOPY(romp))
+			return std::string();
+		append_entry(romp);
+	}
+	return key.finish().as_string() + ".rgn";
+}
+
+
+/*-------------------------------------------------
+    attach_shared_region - map a region published
+    by another instance; the mapping is private,
+    so drivers can still patch or decrypt it
+-------------------------------------------------*/
+
+bool rom_load_manager::attach_shared_region(std::string const &key, std::string const &regiontag, u32 length, u8 width, endianness_t endianness)
+{
+	emu_file file(machine().options().shared_rom_directory(), OPEN_FLAG_READ);
+	if ((file.open(key) != osd_file::error::NONE) || file.is_archived() || (file.size() != length))
+		return false;
+
+	auto mapping = std::make_unique<osd::file_mapping>(file.fullpath(), length);
+	if (!*mapping)
+		return false;
+
+	m_region = machine().memory().region_alloc(regiontag, std::move(mapping), width, endianness);
+	LOG("Attached %X bytes of shared region %s @ %p\n", m_region->bytes(), key.c_str(), m_region->base());
+	return true;
+}
+
+
+/*-------------------------------------------------
+    publish_shared_region - write a region that
+    loaded cleanly for other instances to attach;
+    it goes in under a temporary name and is then
+    renamed so nobody sees it half written
+-------------------------------------------------*/
+
+void rom_load_manager::publish_shared_region(memory_region &region, std::string const &key)
+{
+	std::string tempname(util::string_format("%s.%d.tmp", key, osd_getpid()));
+	std::string temppath;
+	{
+		emu_file file(machine().options().shared_rom_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		if (file.open(tempname) != osd_file::error::NONE)
+			return;
+		temppath = file.fullpath();
+		bool const ok(file.write(region.base(), region.bytes()) == region.bytes());
+		file.close();
+		if (!ok)
+		{
+			osd_file::remove(temppath);
+			return;
+		}
+	}
+
+	// if another instance got there first, theirs is just as good
+	std::string const finalpath(temppath.substr(0, temppath.length() - tempname.length()) + key);
+	if (std::rename(temppath.c_str(), finalpath.c_str()) != 0)
+		osd_file::remove(temppath);
+	else
+		LOG("Published shared region %s as %s\n", region.name().c_str(), key.c_str());
 }
 
 
@@ -1041,6 +1391,18 @@ chd_error rom_load_manager::open_disk_diff(emu_options &options, const rom_entry
 }
 
 
+/*-------------------------------------------------
+    ~open_chd - report how well the hunk cache did
+-------------------------------------------------*/
+
+rom_load_manager::open_chd::~open_chd()
+{
+	chd_file &chd = m_origchd;
+	if (chd.cache_hits() != 0 || chd.cache_misses() != 0)
+		osd_printf_verbose("Disk %s: %u hunk cache hits, %u misses\n", m_region, chd.cache_hits(), chd.cache_misses());
+}
+
+
 /*-------------------------------------------------
     process_disk_entries - process all disk entries
     for a region
@@ -1048,6 +1410,8 @@ chd_error rom_load_manager::open_disk_diff(emu_options &options, const rom_entry
 
 void rom_load_manager::process_disk_entries(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, std::string_view regiontag, const rom_entry *romp, std::function<const rom_entry * ()> next_parent)
 {
+	machine_manager::startup_phase phase(machine().manager(), "CHD open");
+
 	/* remove existing disk entries for this region */
 	m_chd_list.erase(std::remove_if(m_chd_list.begin(), m_chd_list.end(),
 			[regiontag] (std::unique_ptr<open_chd> &chd) { return chd->region() == regiontag; }), m_chd_list.end());
@@ -1075,6 +1439,10 @@ void rom_load_manager::process_disk_entries(std::initializer_list<std::reference
 				continue;
 			}
 
+			/* keep recently read hunks around; a diff reads unchanged ones through this, so shares it */
+			if (chd->orig_chd().compressed())
+				chd->orig_chd().set_cache_size(u64(machine().options().chd_cache_size()) << 20);
+
 			/* get the header and extract the SHA1 */
 			util::hash_collection acthashes;
 			acthashes.add_sha1(chd->orig_chd().sha1());
@@ -1322,6 +1690,7 @@ void rom_load_manager::load_software_part_region(device_t &device, software_list
 	// now go back and post-process all the regions
 	for (const rom_entry *region = start_region; region != nullptr; region = rom_next_region(region))
 		region_post_process(device.memregion(region->name()), ROMREGION_ISINVERTED(region));
+	save_hash_cache();
 
 	// display the results and exit
 	display_rom_load_results(true);
@@ -1337,6 +1706,8 @@ void rom_load_manager::process_region_list()
 	// loop until we hit the end
 	device_enumerator deviter(machine().root_device());
 	std::vector<std::string> searchpath;
+	std::set<memory_region const *> shared;
+	std::vector<std::pair<memory_region *, std::string> > publish;
 	for (device_t &device : deviter)
 	{
 		searchpath.clear();
@@ -1358,6 +1729,24 @@ void rom_load_manager::process_region_list()
 				endianness_t endianness = ROMREGION_ISBIGENDIAN(region) ? ENDIANNESS_BIG : ENDIANNESS_LITTLE;
 				normalize_flags_for_device(regiontag, width, endianness);
 
+				// plain copies of a single file can be paged in from it on demand
+				if (searchpath.empty())
+					searchpath = device.searchpath();
+				if (is_mappable_region(region, width, endianness))
+				{
+					process_mapped_region({ searchpath }, region, regiontag, width, endianness);
+					continue;
+				}
+
+				// another instance may already have loaded the same thing
+				std::string sharedkey(shared_region_key(device, region, width, endianness));
+				if (!sharedkey.empty() && attach_shared_region(sharedkey, regiontag, regionlength, width, endianness))
+				{
+					shared.emplace(m_region);
+					continue;
+				}
+				int const problems(m_errors + m_warnings);
+
 				// remember the base and length
 				m_region = machine().memory().region_alloc(regiontag, regionlength, width, endianness);
 				LOG("Allocated %X bytes @ %p\n", m_region->bytes(), m_region->base());
@@ -1376,6 +1765,10 @@ void rom_load_manager::process_region_list()
 					searchpath = device.searchpath();
 				assert(!searchpath.empty());
 				process_rom_entries({ searchpath }, device.system_bios(), region, region + 1, false);
+
+				// publish it for later instances if nothing went wrong
+				if (!sharedkey.empty() && ((m_errors + m_warnings) == problems))
+					publish.emplace_back(m_region, std::move(sharedkey));
 			}
 			else if (ROMREGION_ISDISKDATA(region))
 			{
@@ -1395,10 +1788,18 @@ void rom_load_manager::process_region_list()
 		}
 	}
 
-	// now go back and post-process all the regions
+	// now go back and post-process all the regions; shared ones were published that way
 	for (device_t &device : deviter)
 		for (const rom_entry *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
-			region_post_process(device.memregion(region->name()), ROMREGION_ISINVERTED(region));
+		{
+			memory_region *const rgn(device.memregion(region->name()));
+			if (shared.find(rgn) == shared.end())
+				region_post_process(rgn, ROMREGION_ISINVERTED(region));
+		}
+
+	// before drivers get a chance to patch or decrypt them, offer the clean ones to other instances
+	for (auto &entry : publish)
+		publish_shared_region(*entry.first, entry.second);
 
 	// and finally register all per-game parameters
 	for (device_t &device : deviter)
@@ -1427,6 +1828,8 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 	, m_romsloadedsize(0)
 	, m_romstotalsize(0)
 	, m_chd_list()
+	, m_hash_queue(nullptr, &osd_work_queue_free)
+	, m_hash_cache_dirty(false)
 	, m_region(nullptr)
 	, m_errorstring()
 	, m_softwarningstring()
@@ -1471,7 +1874,9 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 	m_chd_list.clear();
 
 	// process the ROM entries we were passed
+	load_hash_cache();
 	process_region_list();
+	save_hash_cache();
 
 	// display the results and exit
 	display_rom_load_results(false);
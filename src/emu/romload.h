@@ -17,8 +17,11 @@
 
 #include <functional>
 #include <initializer_list>
+#include <list>
+#include <memory>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 
@@ -382,10 +385,37 @@ TYPE DEFINITIONS
 
 class rom_load_manager
 {
+	// a ROM file being hashed on a worker thread, verified once that's done
+	struct pending_verify
+	{
+		pending_verify(std::unique_ptr<emu_file> &&f, std::string_view n, u32 l, util::hash_collection &&h) : file(std::move(f)), name(n), explength(l), hashes(std::move(h)) { }
+		pending_verify(pending_verify const &) = delete;
+		~pending_verify();
+
+		std::unique_ptr<emu_file> file;
+		std::string name;
+		u32 explength;
+		util::hash_collection hashes;
+		osd_work_item *item = nullptr;
+		std::string cachekey;
+		u64 cachesize = 0;
+		s64 cachetime = 0;
+		bool known = false;
+	};
+
+	// a file that was verified on an earlier run
+	struct hash_cache_entry
+	{
+		u64 size;
+		s64 modified;
+		util::hash_collection hashes;
+	};
+
 	class open_chd
 	{
 	public:
 		open_chd(std::string_view region) : m_region(region) { }
+		~open_chd();
 
 		std::string_view region() const { return m_region; }
 		chd_file &chd() { return m_diffchd.opened() ? m_diffchd : m_origchd; }
@@ -436,7 +466,13 @@ private:
 	void fill_random(u8 *base, u32 length);
 	void handle_missing_file(const rom_entry *romp, const std::vector<std::string> &tried_file_names, chd_error chderr);
 	void dump_wrong_and_correct_checksums(const util::hash_collection &hashes, const util::hash_collection &acthashes);
-	void verify_length_and_hash(emu_file *file, std::string_view name, u32 explength, const util::hash_collection &hashes);
+	void verify_length_and_hash(emu_file *file, std::string_view name, u32 explength, const util::hash_collection &hashes, bool known = false);
+	void queue_verify(std::unique_ptr<emu_file> &&file, std::string_view name, u32 explength, util::hash_collection &&hashes);
+	void finish_verifies(bool wait);
+	static void *hash_file(void *param, int threadid);
+	static bool hash_cache_key(emu_file &file, std::string &key, u64 &size, s64 &modified);
+	void load_hash_cache();
+	void save_hash_cache();
 	void display_loading_rom_message(const char *name, bool from_list);
 	void display_rom_load_results(bool from_list);
 	void region_post_process(memory_region *region, bool invert);
@@ -447,6 +483,11 @@ private:
 	void fill_rom_data(const rom_entry *romp);
 	void copy_rom_data(const rom_entry *romp);
 	void process_rom_entries(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, u8 bios, const rom_entry *parent_region, const rom_entry *romp, bool from_list);
+	bool is_mappable_region(const rom_entry *region, u8 width, endianness_t endianness) const;
+	void process_mapped_region(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, const rom_entry *region, std::string const &regiontag, u8 width, endianness_t endianness);
+	std::string shared_region_key(device_t &device, const rom_entry *region, u8 width, endianness_t endianness) const;
+	bool attach_shared_region(std::string const &key, std::string const &regiontag, u32 length, u8 width, endianness_t endianness);
+	void publish_shared_region(memory_region &region, std::string const &key);
 	chd_error open_disk_diff(emu_options &options, const rom_entry *romp, chd_file &source, chd_file &diff_chd);
 	void process_disk_entries(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, std::string_view regiontag, const rom_entry *romp, std::function<const rom_entry * ()> next_parent);
 	void normalize_flags_for_device(std::string_view rgntag, u8 &width, endianness_t &endian);
@@ -466,6 +507,12 @@ private:
 
 	std::vector<std::unique_ptr<open_chd>> m_chd_list;     /* disks */
 
+	std::unique_ptr<osd_work_queue, void (*)(osd_work_queue *)> m_hash_queue; // queue hashing ROM files
+	std::list<pending_verify> m_pending_verifies; // files being hashed, in load order
+	std::string         m_hash_cache_path;    // directory for the verified hash cache, if enabled
+	std::unordered_map<std::string, hash_cache_entry> m_hash_cache; // files verified on earlier runs
+	bool                m_hash_cache_dirty;   // whether the cache needs saving
+
 	memory_region *     m_region;             // info about current region
 
 	std::string         m_errorstring;        // error string
@@ -26,6 +26,10 @@
 #include "emuopts.h"
 #include "coreutil.h"
 
+#include <algorithm>
+#include <map>
+#include <sstream>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -64,11 +68,36 @@ save_manager::save_manager(running_machine &machine)
 	: m_machine(machine)
 	, m_reg_allowed(true)
 	, m_illegal_regs(0)
+	, m_callback_queue(nullptr)
+	, m_profiling(*machine.options().state_report() != 0)
+	, m_profile_saves(0)
+	, m_profile_loads(0)
+	, m_presave_ticks(0)
+	, m_postload_ticks(0)
+	, m_write_queue(nullptr)
+	, m_write_item(nullptr)
+	, m_write_level(FCOMPRESS_MEDIUM)
+	, m_write_error(STATERR_NONE)
 {
 	m_rewind = std::make_unique<rewinder>(*this);
 }
 
 
+//-------------------------------------------------
+//  ~save_manager - destructor
+//-------------------------------------------------
+
+save_manager::~save_manager()
+{
+	// let a background write reach the disk
+	finish_write(true);
+	if (m_write_queue)
+		osd_work_queue_free(m_write_queue);
+	if (m_callback_queue)
+		osd_work_queue_free(m_callback_queue);
+}
+
+
 //-------------------------------------------------
 //  allow_registration - allow/disallow
 //  registrations to happen
@@ -131,7 +160,7 @@ const char *save_manager::indexed_item(int index, void *&base, u32 &valsize, u32
 //  function callback
 //-------------------------------------------------
 
-void save_manager::register_presave(save_prepost_delegate func)
+void save_manager::register_presave(save_prepost_delegate func, bool independent)
 {
 	// check for invalid timing
 	if (!m_reg_allowed)
@@ -143,7 +172,7 @@ void save_manager::register_presave(save_prepost_delegate func)
 			fatalerror("Duplicate save state function (%s/%s)\n", cb->m_func.name(), func.name());
 
 	// allocate a new entry
-	m_presave_list.push_back(std::make_unique<state_callback>(func));
+	m_presave_list.push_back(std::make_unique<state_callback>(func, independent));
 }
 
 
@@ -152,7 +181,7 @@ void save_manager::register_presave(save_prepost_delegate func)
 //  register a post-load function callback
 //-------------------------------------------------
 
-void save_manager::register_postload(save_prepost_delegate func)
+void save_manager::register_postload(save_prepost_delegate func, bool independent)
 {
 	// check for invalid timing
 	if (!m_reg_allowed)
@@ -164,7 +193,7 @@ void save_manager::register_postload(save_prepost_delegate func)
 			fatalerror("Duplicate save state function (%s/%s)\n", cb->m_func.name(), func.name());
 
 	// allocate a new entry
-	m_postload_list.push_back(std::make_unique<state_callback>(func));
+	m_postload_list.push_back(std::make_unique<state_callback>(func, independent));
 }
 
 
@@ -234,8 +263,23 @@ save_error save_manager::check_file(running_machine &machine, emu_file &file, co
 
 void save_manager::dispatch_postload()
 {
-	for (auto &func : m_postload_list)
-		func->m_func();
+	dispatch(m_postload_list);
+}
+
+
+//-------------------------------------------------
+//  buffer_bytes - bytes held for rewind, the
+//  background writer and in-memory states
+//-------------------------------------------------
+
+size_t save_manager::buffer_bytes() const
+{
+	size_t bytes = m_write_buffer.capacity();
+	if (m_rewind)
+		bytes += m_rewind->bytes();
+	for (auto const &state : m_ramstate_list)
+		bytes += state->bytes();
+	return bytes;
 }
 
 
@@ -246,8 +290,145 @@ void save_manager::dispatch_postload()
 
 void save_manager::dispatch_presave()
 {
-	for (auto &func : m_presave_list)
-		func->m_func();
+	dispatch(m_presave_list);
+}
+
+
+//-------------------------------------------------
+//  dispatch - invoke a list of callbacks: the
+//  independent ones together on the work queue,
+//  then the rest in order of registration
+//-------------------------------------------------
+
+void save_manager::dispatch(std::vector<std::unique_ptr<state_callback>> &list)
+{
+	int independent = 0;
+	for (auto &func : list)
+		if (func->m_independent)
+			independent++;
+
+	if (independent > 1)
+	{
+		if (!m_callback_queue)
+			m_callback_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+		for (auto &func : list)
+			if (func->m_independent && (!m_callback_queue || !osd_work_item_queue(m_callback_queue, dispatch_callback, func.get(), WORK_ITEM_FLAG_AUTO_RELEASE)))
+				func->m_func();
+		if (m_callback_queue)
+			osd_work_queue_wait(m_callback_queue, osd_ticks_per_second() * 100);
+	}
+	else if (independent != 0)
+	{
+		for (auto &func : list)
+			if (func->m_independent)
+				func->m_func();
+	}
+
+	for (auto &func : list)
+		if (!func->m_independent)
+			func->m_func();
+}
+
+
+//-------------------------------------------------
+//  dispatch_callback - run an independent
+//  callback on a work queue thread
+//-------------------------------------------------
+
+void *save_manager::dispatch_callback(void *param, int threadid)
+{
+	reinterpret_cast<state_callback *>(param)->m_func();
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  state_report - describe the size of every
+//  registered item and, if profiling, the time
+//  taken to save and load it, grouped by device
+//  with the largest first
+//-------------------------------------------------
+
+std::string save_manager::state_report() const
+{
+	struct group
+	{
+		std::string name;
+		size_t bytes = 0;
+		osd_ticks_t save_ticks = 0;
+		osd_ticks_t load_ticks = 0;
+		std::vector<const state_entry *> entries;
+	};
+
+	// gather the entries by device, or by module for those that don't belong to one
+	std::vector<group> groups;
+	std::map<std::string, size_t> lookup;
+	size_t total = 0;
+	for (const auto &entry : m_entry_list)
+	{
+		const std::string name = entry->m_device ? entry->m_device->tag() : entry->m_module;
+		auto const found = lookup.emplace(name, groups.size());
+		if (found.second)
+			groups.emplace_back().name = name;
+
+		group &g = groups[found.first->second];
+		const size_t bytes = size_t(entry->m_typesize) * entry->m_typecount * entry->m_blockcount;
+		g.bytes += bytes;
+		g.save_ticks += entry->m_save_ticks;
+		g.load_ticks += entry->m_load_ticks;
+		g.entries.emplace_back(entry.get());
+		total += bytes;
+	}
+
+	const auto entry_bytes = [] (const state_entry *entry) { return size_t(entry->m_typesize) * entry->m_typecount * entry->m_blockcount; };
+	std::sort(groups.begin(), groups.end(), [] (const group &a, const group &b) { return a.bytes > b.bytes; });
+	for (group &g : groups)
+		std::stable_sort(g.entries.begin(), g.entries.end(), [&entry_bytes] (const state_entry *a, const state_entry *b) { return entry_bytes(a) > entry_bytes(b); });
+
+	// times are averages per save or load in microseconds
+	const double tps = double(osd_ticks_per_second());
+	const auto usec = [tps] (osd_ticks_t ticks, u32 count) { return count ? (double(ticks) * 1'000'000.0 / tps / double(count)) : 0.0; };
+
+	std::ostringstream result;
+	util::stream_format(result, "Save state: %u bytes in %u items from %u devices\n", total, m_entry_list.size(), groups.size());
+	util::stream_format(result, "Timed: %u saves, %u loads\n", m_profile_saves, m_profile_loads);
+	util::stream_format(result, "Pre-save functions:  %u, %.3f us per save\n", m_presave_list.size(), usec(m_presave_ticks, m_profile_saves));
+	util::stream_format(result, "Post-load functions: %u, %.3f us per load\n\n", m_postload_list.size(), usec(m_postload_ticks, m_profile_loads));
+	util::stream_format(result, "%-48s %12s %12s %12s\n", "Device/item", "bytes", "us/save", "us/load");
+	for (const group &g : groups)
+	{
+		util::stream_format(result, "%-48s %12u %12.3f %12.3f\n", g.name, g.bytes, usec(g.save_ticks, m_profile_saves), usec(g.load_ticks, m_profile_loads));
+		for (const state_entry *entry : g.entries)
+			util::stream_format(result, "  %-46s %12u %12.3f %12.3f\n", entry->m_name, entry_bytes(entry), usec(entry->m_save_ticks, m_profile_saves), usec(entry->m_load_ticks, m_profile_loads));
+	}
+	return std::move(result).str();
+}
+
+
+//-------------------------------------------------
+//  write_state_report - write the state report to
+//  a file, timing a save first if none was made
+//-------------------------------------------------
+
+void save_manager::write_state_report(const char *filename)
+{
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(filename) != osd_file::error::NONE)
+	{
+		osd_printf_warning("Unable to open save state report file %s\n", filename);
+		return;
+	}
+
+	if (m_profile_saves == 0 && m_illegal_regs == 0)
+	{
+		std::vector<u8> scratch(ram_state::get_size(*this));
+		const bool profiling = m_profiling;
+		m_profiling = true;
+		write_buffer(scratch.data(), scratch.size());
+		m_profiling = profiling;
+	}
+
+	file.puts(state_report());
 }
 
 
@@ -266,14 +447,113 @@ save_error save_manager::write_file(emu_file &file)
 				file.seek(0, SEEK_SET);
 				return true;
 			},
-			[&file] ()
+			[this, &file] ()
 			{
-				file.compress(FCOMPRESS_MEDIUM);
+				file.compress(machine().options().state_compression());
 				return true;
 			});
 }
 
 
+//-------------------------------------------------
+//  write_file_async - take a snapshot of the
+//  state, then compress and write it to the file
+//  on a work queue so the emulation thread isn't
+//  held up; the file is only taken on success
+//-------------------------------------------------
+
+save_error save_manager::write_file_async(std::unique_ptr<emu_file> &&file)
+{
+	// only one write in flight at a time
+	finish_write(true);
+
+	m_write_buffer.resize(ram_state::get_size(*this));
+	const save_error err = write_buffer(m_write_buffer.data(), m_write_buffer.size());
+	if (err != STATERR_NONE)
+		return err;
+
+	m_write_file = std::move(file);
+	m_write_level = machine().options().state_compression();
+	m_write_error = STATERR_NONE;
+
+	if (!m_write_queue)
+		m_write_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	if (m_write_queue)
+		m_write_item = osd_work_item_queue(m_write_queue, write_file_callback, this, 0);
+	if (!m_write_item)
+		write_file_callback(this, 0);
+	return STATERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  write_pending - true while a background write
+//  is still running
+//-------------------------------------------------
+
+bool save_manager::write_pending()
+{
+	return m_write_item && !osd_work_item_wait(m_write_item, 0);
+}
+
+
+//-------------------------------------------------
+//  finish_write - collect the result of a
+//  background write once it is done, waiting for
+//  it if asked to; STATERR_NONE if there's
+//  nothing to report, including while a write
+//  that isn't being waited for is still running
+//-------------------------------------------------
+
+save_error save_manager::finish_write(bool wait)
+{
+	if (m_write_item)
+	{
+		// the worker owns the buffer and the file until it's done, so never give up on it
+		if (!wait && !osd_work_item_wait(m_write_item, 0))
+			return STATERR_NONE;
+		while (!osd_work_item_wait(m_write_item, osd_ticks_per_second() * 10)) { }
+		osd_work_item_release(m_write_item);
+		m_write_item = nullptr;
+	}
+
+	const save_error err = m_write_error;
+	m_write_error = STATERR_NONE;
+	return err;
+}
+
+
+//-------------------------------------------------
+//  write_file_callback - write a snapshot out in
+//  the same layout as write_file
+//-------------------------------------------------
+
+void *save_manager::write_file_callback(void *param, int threadid)
+{
+	save_manager &save = *reinterpret_cast<save_manager *>(param);
+	emu_file &file = *save.m_write_file;
+	const u8 *const data = save.m_write_buffer.data();
+	const size_t size = save.m_write_buffer.size();
+
+	// the header goes out uncompressed, the rest through zlib
+	file.compress(FCOMPRESS_NONE);
+	file.seek(0, SEEK_SET);
+	bool ok = file.write(data, HEADER_SIZE) == HEADER_SIZE;
+	file.compress(save.m_write_level);
+	ok = ok && (file.write(data + HEADER_SIZE, size - HEADER_SIZE) == u32(size - HEADER_SIZE));
+
+	if (!ok)
+	{
+		save.m_write_error = STATERR_WRITE_ERROR;
+		file.remove_on_close();
+	}
+
+	// closing flushes the compressor, so do that here too
+	save.m_write_file.reset();
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  read_file - read the data from a file
 //-------------------------------------------------
@@ -409,7 +689,15 @@ inline save_error save_manager::do_write(T check_space, U write_block, V start_h
 		return STATERR_WRITE_ERROR;
 
 	// call the pre-save functions
+	const bool profiling = m_profiling;
+	osd_ticks_t start = profiling ? osd_ticks() : 0;
 	dispatch_presave();
+	if (profiling)
+	{
+		const osd_ticks_t now = osd_ticks();
+		m_presave_ticks += now - start;
+		start = now;
+	}
 
 	// then write all the data
 	for (auto &entry : m_entry_list)
@@ -419,7 +707,16 @@ inline save_error save_manager::do_write(T check_space, U write_block, V start_h
 		for (u32 b = 0; entry->m_blockcount > b; ++b, data += entry->m_stride)
 			if (!write_block(data, blocksize))
 				return STATERR_WRITE_ERROR;
+
+		if (profiling)
+		{
+			const osd_ticks_t now = osd_ticks();
+			entry->m_save_ticks += now - start;
+			start = now;
+		}
 	}
+	if (profiling)
+		m_profile_saves++;
 	return STATERR_NONE;
 }
 
@@ -456,6 +753,8 @@ inline save_error save_manager::do_read(T check_length, U read_block, V start_he
 	const bool flip = NATIVE_ENDIAN_VALUE_LE_BE((header[9] & SS_MSB_FIRST) != 0, (header[9] & SS_MSB_FIRST) == 0);
 
 	// read all the data, flipping if necessary
+	const bool profiling = m_profiling;
+	osd_ticks_t start = profiling ? osd_ticks() : 0;
 	for (auto &entry : m_entry_list)
 	{
 		const u32 blocksize = entry->m_typesize * entry->m_typecount;
@@ -467,10 +766,22 @@ inline save_error save_manager::do_read(T check_length, U read_block, V start_he
 		// handle flipping
 		if (flip)
 			entry->flip_data();
+
+		if (profiling)
+		{
+			const osd_ticks_t now = osd_ticks();
+			entry->m_load_ticks += now - start;
+			start = now;
+		}
 	}
 
 	// call the post-load functions
 	dispatch_postload();
+	if (profiling)
+	{
+		m_postload_ticks += osd_ticks() - start;
+		m_profile_loads++;
+	}
 
 	return STATERR_NONE;
 }
@@ -565,8 +876,9 @@ save_error save_manager::validate_header(const u8 *header, const char *gamename,
 //  state_callback - constructor
 //-------------------------------------------------
 
-save_manager::state_callback::state_callback(save_prepost_delegate callback)
+save_manager::state_callback::state_callback(save_prepost_delegate callback, bool independent)
 	: m_func(std::move(callback))
+	, m_independent(independent)
 {
 }
 
@@ -577,15 +889,10 @@ save_manager::state_callback::state_callback(save_prepost_delegate callback)
 
 ram_state::ram_state(save_manager &save)
 	: m_save(save)
-	, m_data()
+	, m_data(get_size(save))
 	, m_valid(false)
 	, m_time(m_save.machine().time())
 {
-	m_data.reserve(get_size(save));
-	m_data.clear();
-	m_data.rdbuf()->clear();
-	m_data.seekp(0);
-	m_data.seekg(0);
 }
 
 
@@ -607,17 +914,17 @@ size_t ram_state::get_size(save_manager &save)
 
 //-------------------------------------------------
 //  save - write the current machine state to the
-//  allocated stream
+//  buffer; nothing is allocated, so this is cheap
+//  enough to do every frame
 //-------------------------------------------------
 
 save_error ram_state::save()
 {
 	// initialize
 	m_valid = false;
-	m_data.seekp(0);
 
 	// get the save manager to write state
-	const save_error err = m_save.write_stream(m_data);
+	const save_error err = m_save.write_buffer(m_data.data(), m_data.size());
 	if (err != STATERR_NONE)
 		return err;
 
@@ -631,20 +938,85 @@ save_error ram_state::save()
 
 //-------------------------------------------------
 //  load - restore the machine state from the
-//  stream
+//  buffer
 //-------------------------------------------------
 
 save_error ram_state::load()
 {
-	// initialize
-	m_data.seekg(0);
-
 	// if we have illegal registrations, return an error
 	if (m_save.m_illegal_regs > 0)
 		return STATERR_ILLEGAL_REGISTRATIONS;
 
 	// get the save manager to load state
-	return m_save.read_stream(m_data);
+	return m_save.read_buffer(m_data.data(), m_data.size());
+}
+
+
+//-------------------------------------------------
+//  delta_encode - append the difference between
+//  a block of the previous state and the data
+//  now at that offset to a delta: runs of a
+//  count of unchanged bytes since the last run,
+//  a count of changed bytes and the changed
+//  bytes XORed, so it can be applied in either
+//  direction.  the previous state is brought up
+//  to date in place
+//-------------------------------------------------
+
+static void delta_encode(std::vector<u8> &delta, size_t &last, u8 *prev, const u8 *curr, size_t size, size_t offset)
+{
+	// gaps shorter than a run header are cheaper to carry along as changed bytes
+	const size_t min_gap = 2 * sizeof(u32);
+
+	size_t pos = 0;
+	while (true)
+	{
+		while (pos < size && prev[pos] == curr[pos])
+			pos++;
+		if (pos == size)
+			break;
+
+		size_t end = pos, same = 0;
+		while (end < size && same < min_gap)
+		{
+			same = (prev[end] == curr[end]) ? (same + 1) : 0;
+			end++;
+		}
+		end -= same;
+
+		const u32 header[2] = { u32(offset + pos - last), u32(end - pos) };
+		const size_t start = delta.size();
+		delta.resize(start + sizeof(header) + (end - pos));
+		memcpy(&delta[start], header, sizeof(header));
+		for (u8 *dest = &delta[start + sizeof(header)]; pos < end; pos++)
+		{
+			*dest++ = prev[pos] ^ curr[pos];
+			prev[pos] = curr[pos];
+		}
+		last = offset + end;
+	}
+}
+
+
+//-------------------------------------------------
+//  delta_apply - XOR a delta built by
+//  delta_encode into a state
+//-------------------------------------------------
+
+static void delta_apply(u8 *data, const std::vector<u8> &delta)
+{
+	const u8 *src = delta.data();
+	const u8 *const end = src + delta.size();
+	while (src < end)
+	{
+		u32 header[2];
+		memcpy(header, src, sizeof(header));
+		src += sizeof(header);
+
+		data += header[0];
+		for (u32 count = 0; count < header[1]; count++)
+			*data++ ^= *src++;
+	}
 }
 
 
@@ -657,9 +1029,10 @@ rewinder::rewinder(save_manager &save)
 	, m_enabled(save.machine().options().rewind())
 	, m_capacity(save.machine().options().rewind_capacity())
 	, m_current_index(REWIND_INDEX_NONE)
-	, m_first_invalid_index(REWIND_INDEX_NONE)
 	, m_first_time_warning(true)
 	, m_first_time_note(true)
+	, m_total_size(0)
+	, m_next_serial(1)
 {
 }
 
@@ -693,9 +1066,9 @@ void rewinder::clamp_capacity()
 
 
 //-------------------------------------------------
-//  invalidate - mark all the future states as
-//  invalid to prevent loading them, as the
-//  current input might have changed
+//  invalidate - drop all the future states to
+//  prevent loading them, as the current input
+//  might have changed
 //-------------------------------------------------
 
 void rewinder::invalidate()
@@ -703,15 +1076,11 @@ void rewinder::invalidate()
 	if (!m_enabled)
 		return;
 
-	// is there anything to invalidate?
-	if (!current_index_is_last())
+	while (s32(m_state_list.size()) > m_current_index + 1)
 	{
-		// all states starting from the current one will be invalid
-		m_first_invalid_index = m_current_index;
-
-		// actually invalidate
-		for (auto it = m_state_list.begin() + m_first_invalid_index; it < m_state_list.end(); ++it)
-			it->get()->m_valid = false;
+		m_total_size -= m_state_list.back().size();
+		m_state_list.pop_back();
+		m_serials.pop_back();
 	}
 }
 
@@ -729,51 +1098,63 @@ bool rewinder::capture()
 		return false;
 	}
 
-	if (current_index_is_last())
-	{
-		// we need to create a new state
-		std::unique_ptr<ram_state> state = std::make_unique<ram_state>(m_save);
-		const save_error error = state->save();
+	// anything ahead of where we are is no longer reachable
+	invalidate();
 
-		// validate the state
+	// store only what changed since the current state, comparing the registered items in
+	// place; the oldest state needs nothing at all, since it's only ever reached by stepping
+	// back from the one after it
+	const size_t size = ram_state::get_size(m_save);
+	save_error error;
+	if (m_state_list.empty() || m_current.size() != size)
+	{
+		m_current.resize(size);
+		error = m_save.write_buffer(m_current.data(), size);
 		if (error == STATERR_NONE)
-			// it's safe to append
-			m_state_list.push_back(std::move(state));
-		else
 		{
-			// internal error, complain and evacuate
-			report_error(error, rewind_operation::SAVE);
-			return false;
+			m_state_list.clear();
+			m_state_list.emplace_back();
+			m_serials.assign(1, m_next_serial++);
+			m_total_size = 0;
 		}
 	}
 	else
 	{
-		// invalidate the future states
-		invalidate();
-
-		// update the existing state
-		ram_state *state = m_state_list.at(m_current_index).get();
-		const save_error error = state->save();
-
-		// validate the state
-		if (error != STATERR_NONE)
+		std::vector<u8> delta;
+		size_t offset = 0, last = 0;
+		error = m_save.do_write(
+				[] (size_t total_size) { return true; },
+				[this, &delta, &offset, &last] (const void *data, size_t size)
+				{
+					delta_encode(delta, last, &m_current[offset], reinterpret_cast<const u8 *>(data), size, offset);
+					offset += size;
+					return true;
+				},
+				[] () { return true; },
+				[] () { return true; });
+		if (error == STATERR_NONE)
 		{
-			// internal error, complain and evacuate
-			report_error(error, rewind_operation::SAVE);
-			return false;
+			m_total_size += delta.size();
+			m_state_list.push_back(std::move(delta));
+			m_serials.push_back(m_next_serial++);
 		}
 	}
 
-	// make sure we will fit in
-	if (!check_size())
-		// the list keeps growing
-		m_current_index++;
+	if (error != STATERR_NONE)
+	{
+		// internal error, complain and evacuate; the current copy may be partly updated
+		m_state_list.clear();
+		m_serials.clear();
+		m_current.clear();
+		m_total_size = 0;
+		m_current_index = REWIND_INDEX_NONE;
+		report_error(error, rewind_operation::SAVE);
+		return false;
+	}
+	m_current_index = m_state_list.size() - 1;
 
-	// update first invalid index
-	if (current_index_is_last())
-		m_first_invalid_index = REWIND_INDEX_NONE;
-	else
-		m_first_invalid_index = m_current_index + 1;
+	// make sure we will fit in
+	check_size();
 
 	// success
 	report_error(STATERR_NONE, rewind_operation::SAVE);
@@ -795,22 +1176,18 @@ bool rewinder::step()
 	}
 
 	// do we have states to load?
-	if (m_current_index <= REWIND_INDEX_FIRST || m_first_invalid_index == REWIND_INDEX_FIRST)
+	if (m_current_index <= REWIND_INDEX_FIRST)
 	{
 		// no valid states, complain and evacuate
 		report_error(STATERR_NOT_FOUND, rewind_operation::LOAD);
 		return false;
 	}
 
-	// prepare to load the last valid index if we're too far ahead
-	if (m_first_invalid_index > REWIND_INDEX_NONE && m_current_index > m_first_invalid_index)
-		m_current_index = m_first_invalid_index;
-
-	// step back and obtain the state pointer
-	ram_state *state = m_state_list.at(--m_current_index).get();
+	// undo the current state's delta to get the one before it
+	delta_apply(m_current.data(), m_state_list[m_current_index--]);
 
-	// try to load and report the result
-	const save_error error = state->load();
+	// try to load straight from it and report the result
+	const save_error error = m_save.read_buffer(m_current.data(), m_current.size());
 	report_error(error, rewind_operation::LOAD);
 
 	if (error == save_error::STATERR_NONE)
@@ -821,64 +1198,75 @@ bool rewinder::step()
 
 
 //-------------------------------------------------
-//  check_size - shrink the state list if it is
-//  about to hit the capacity. returns true if
-//  the list got shrank
+//  seek - move to the state captured with the
+//  given serial number, in either direction,
+//  returns true on success
 //-------------------------------------------------
 
-bool rewinder::check_size()
+bool rewinder::seek(u64 serial)
 {
 	if (!m_enabled)
+	{
+		report_error(STATERR_DISABLED, rewind_operation::LOAD);
 		return false;
+	}
 
-	// state sizes in bytes
-	const size_t singlesize = ram_state::get_size(m_save);
-	size_t totalsize = m_state_list.size() * singlesize;
+	auto const found = std::find(m_serials.begin(), m_serials.end(), serial);
+	if (found == m_serials.end())
+	{
+		report_error(STATERR_NOT_FOUND, rewind_operation::LOAD);
+		return false;
+	}
 
-	// convert our limit from megabytes
-	const size_t capsize = m_capacity * 1024 * 1024;
+	// the deltas are XORs, so they take a state forwards as well as back
+	s32 const index = found - m_serials.begin();
+	while (m_current_index > index)
+		delta_apply(m_current.data(), m_state_list[m_current_index--]);
+	while (m_current_index < index)
+		delta_apply(m_current.data(), m_state_list[++m_current_index]);
 
-	// safety check that shouldn't be allowed to trigger
-	if (totalsize > capsize)
-	{
-		// states to remove
-		const u32 count = (totalsize - capsize) / singlesize;
+	const save_error error = m_save.read_buffer(m_current.data(), m_current.size());
+	report_error(error, rewind_operation::LOAD);
+	return error == save_error::STATERR_NONE;
+}
 
-		// drop everything that's beyond capacity
-		m_state_list.erase(m_state_list.begin(), m_state_list.begin() + count);
-	}
 
-	// update before new check
-	totalsize = m_state_list.size() * singlesize;
+//-------------------------------------------------
+//  check_size - drop the oldest states if the
+//  deltas and the working copies exceed the
+//  capacity. returns true if the list got shrank
+//-------------------------------------------------
 
-	// check if capacity will be hit by the newly captured state
-	if (totalsize + singlesize >= capsize)
-	{
-		// check if we have spare states ahead
-		if (!current_index_is_last())
-			// no need to move states around
-			return false;
+bool rewinder::check_size()
+{
+	if (!m_enabled)
+		return false;
 
-		// we can now get the first state and invalidate it
-		std::unique_ptr<ram_state> first(std::move(m_state_list.front()));
-		first->m_valid = false;
+	// the full copy of the current state and the save buffer count against the capacity too
+	const size_t singlesize = ram_state::get_size(m_save);
+	const size_t capsize = m_capacity * 1024 * 1024;
 
-		// move it to the end for future use
-		m_state_list.push_back(std::move(first));
+	bool shrank = false;
+	while (m_state_list.size() > 1 && m_total_size + 2 * singlesize > capsize)
+	{
+		// the new oldest state no longer needs a way back
 		m_state_list.erase(m_state_list.begin());
+		m_serials.erase(m_serials.begin());
+		m_total_size -= m_state_list.front().size();
+		std::vector<u8>().swap(m_state_list.front());
+		m_current_index--;
+		shrank = true;
+	}
 
-		if (m_first_time_note)
-		{
-			m_save.machine().logerror("Rewind note: Capacity has been reached. Old savestates will be erased.\n");
-			m_save.machine().logerror("Capacity: %d bytes. Savestate size: %d bytes. Savestate count: %d.\n",
-				totalsize, singlesize, m_state_list.size());
-			m_first_time_note = false;
-		}
-
-		return true;
+	if (shrank && m_first_time_note)
+	{
+		m_save.machine().logerror("Rewind note: Capacity has been reached. Old savestates will be erased.\n");
+		m_save.machine().logerror("Capacity: %d bytes. Savestate size: %d bytes. Savestate count: %d.\n",
+			capsize, singlesize, m_state_list.size());
+		m_first_time_note = false;
 	}
 
-	return false;
+	return shrank;
 }
 
 
@@ -975,6 +1363,8 @@ save_manager::state_entry::state_entry(
 	, m_typecount(valcount)
 	, m_blockcount(blockcount)
 	, m_stride(stride)
+	, m_save_ticks(0)
+	, m_load_ticks(0)
 {
 }
 
@@ -17,6 +17,7 @@
 #ifndef MAME_EMU_SAVE_H
 #define MAME_EMU_SAVE_H
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <memory>
@@ -122,6 +123,8 @@ class save_manager
 		u32             m_typecount;            // number of items in each block
 		u32             m_blockcount;           // number of blocks of items
 		u32             m_stride;               // stride between blocks of items in units of item size
+		osd_ticks_t     m_save_ticks;           // time spent saving this entry while profiling
+		osd_ticks_t     m_load_ticks;           // time spent loading this entry while profiling
 	};
 
 	friend class ram_state;
@@ -136,20 +139,28 @@ public:
 
 	// construction/destruction
 	save_manager(running_machine &machine);
+	~save_manager();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
 	rewinder *rewind() { return m_rewind.get(); }
+	size_t buffer_bytes() const;
 	int registration_count() const { return m_entry_list.size(); }
 	bool registration_allowed() const { return m_reg_allowed; }
 
+	// profiling
+	bool profiling() const { return m_profiling; }
+	void set_profiling(bool profiling) { m_profiling = profiling; }
+	std::string state_report() const;
+	void write_state_report(const char *filename);
+
 	// registration control
 	void allow_registration(bool allowed = true);
 	const char *indexed_item(int index, void *&base, u32 &valsize, u32 &valcount, u32 &blockcount, u32 &stride) const;
 
 	// function registration
-	void register_presave(save_prepost_delegate func);
-	void register_postload(save_prepost_delegate func);
+	void register_presave(save_prepost_delegate func, bool independent = false);
+	void register_postload(save_prepost_delegate func, bool independent = false);
 
 	// callback dispatching
 	void dispatch_presave();
@@ -286,6 +297,11 @@ public:
 	save_error write_file(emu_file &file);
 	save_error read_file(emu_file &file);
 
+	// snapshot the state now, compress and write it to the file in the background
+	save_error write_file_async(std::unique_ptr<emu_file> &&file);
+	bool write_pending();
+	save_error finish_write(bool wait);
+
 	save_error write_stream(std::ostream &str);
 	save_error read_stream(std::istream &str);
 
@@ -298,9 +314,10 @@ private:
 	{
 	public:
 		// construction/destruction
-		state_callback(save_prepost_delegate callback);
+		state_callback(save_prepost_delegate callback, bool independent);
 
 		save_prepost_delegate m_func;                 // delegate
+		bool                  m_independent;          // touches nothing another callback does, so can run alongside them
 	};
 
 	// internal helpers
@@ -308,9 +325,12 @@ private:
 	save_error do_write(T check_space, U write_block, V start_header, W start_data);
 	template <typename T, typename U, typename V, typename W>
 	save_error do_read(T check_length, U read_block, V start_header, W start_data);
+	void dispatch(std::vector<std::unique_ptr<state_callback>> &list);
+	static void *dispatch_callback(void *param, int threadid);
 	u32 signature() const;
 	void dump_registry() const;
 	static save_error validate_header(const u8 *header, const char *gamename, u32 signature, void (CLIB_DECL *errormsg)(const char *fmt, ...), const char *error_prefix);
+	static void *write_file_callback(void *param, int threadid);
 
 	// internal state
 	running_machine &         m_machine;              // reference to our machine
@@ -322,12 +342,28 @@ private:
 	std::vector<std::unique_ptr<ram_state>>      m_ramstate_list;    // list of ram states
 	std::vector<std::unique_ptr<state_callback>> m_presave_list;     // list of pre-save functions
 	std::vector<std::unique_ptr<state_callback>> m_postload_list;    // list of post-load functions
+	osd_work_queue *          m_callback_queue;       // queue independent pre-save and post-load functions run on
+
+	// profiling
+	bool                      m_profiling;            // time every entry and callback when saving and loading
+	u32                       m_profile_saves;        // number of saves timed
+	u32                       m_profile_loads;        // number of loads timed
+	osd_ticks_t               m_presave_ticks;        // time spent in pre-save functions
+	osd_ticks_t               m_postload_ticks;       // time spent in post-load functions
+
+	// background file writing
+	osd_work_queue *          m_write_queue;          // queue the compression and write run on
+	osd_work_item *           m_write_item;           // write in flight, if any
+	std::unique_ptr<emu_file> m_write_file;           // file it goes to
+	std::vector<u8>           m_write_buffer;         // snapshot of the state
+	int                       m_write_level;          // compression level
+	save_error                m_write_error;          // result of the write
 };
 
 class ram_state
 {
 	save_manager &     m_save;                        // reference to save_manager
-	util::vectorstream m_data;                        // save data buffer
+	std::vector<u8>    m_data;                        // save data buffer, sized once up front
 
 public:
 	bool               m_valid;                       // can we load this state?
@@ -337,6 +373,7 @@ public:
 	static size_t get_size(save_manager &save);
 	save_error save();
 	save_error load();
+	size_t bytes() const { return m_data.capacity(); }
 };
 
 class rewinder
@@ -345,10 +382,13 @@ class rewinder
 	bool           m_enabled;                         // enable rewind savestates
 	size_t         m_capacity;                        // total memory rewind states can occupy (MB, limited to 1-2048 in options)
 	s32            m_current_index;                   // where we are in time
-	s32            m_first_invalid_index;             // all states before this one are guarateed to be valid
 	bool           m_first_time_warning;              // keep track of warnings we report
 	bool           m_first_time_note;                 // keep track of notes
-	std::vector<std::unique_ptr<ram_state>> m_state_list; // rewinder's own ram states
+	std::vector<u8> m_current;                        // full copy of the state at the current index
+	std::vector<std::vector<u8>> m_state_list;        // per state, the delta taking it back to the one before
+	size_t         m_total_size;                      // total size of the deltas in bytes
+	std::vector<u64> m_serials;                       // per state, the serial number it was captured with
+	u64            m_next_serial;                     // serial number of the next capture
 
 	// load/save management
 	enum class rewind_operation
@@ -364,7 +404,6 @@ class rewinder
 	};
 
 	bool check_size();
-	bool current_index_is_last() { return m_current_index == m_state_list.size() - 1; }
 	void report_error(save_error type, rewind_operation operation);
 
 public:
@@ -374,6 +413,13 @@ public:
 	void invalidate();
 	bool capture();
 	bool step();
+
+	// states are identified by serial number, which doesn't change as old ones are dropped
+	u64 current_serial() const { return (m_current_index >= REWIND_INDEX_FIRST) ? m_serials[m_current_index] : 0; }
+	bool contains(u64 serial) const { return std::find(m_serials.begin(), m_serials.end(), serial) != m_serials.end(); }
+	bool seek(u64 serial);
+
+	size_t bytes() const { return m_current.capacity() + m_total_size; }
 };
 
 
@@ -10,6 +10,11 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 //**************************************************************************
 //  DEBUGGING
@@ -56,7 +61,10 @@ emu_timer::emu_timer() :
 	m_start(attotime::zero),
 	m_expire(attotime::never),
 	m_device(nullptr),
-	m_id(0)
+	m_id(0),
+	m_heap_expire(ATTOTICK_NEVER),
+	m_heap_sequence(0),
+	m_heap_index(0)
 {
 }
 
@@ -157,12 +165,13 @@ bool emu_timer::enable(bool enable)
 	const bool old = m_enabled;
 	if (old != enable)
 	{
+		auto const guard(machine().scheduler().concurrent_guard());
+
 		// set the enable flag
 		m_enabled = enable;
 
-		// remove the timer and insert back into the list
-		machine().scheduler().timer_list_remove(*this);
-		machine().scheduler().timer_list_insert(*this);
+		// move the timer to its new position in the queue
+		machine().scheduler().timer_list_reorder(*this);
 	}
 	return old;
 }
@@ -178,6 +187,7 @@ void emu_timer::adjust(attotime start_delay, s32 param, const attotime &period)
 {
 	// if this is the callback timer, mark it modified
 	device_scheduler &scheduler = machine().scheduler();
+	auto const guard(scheduler.concurrent_guard());
 	if (scheduler.m_callback_timer == this)
 		scheduler.m_callback_timer_modified = true;
 
@@ -194,12 +204,11 @@ void emu_timer::adjust(attotime start_delay, s32 param, const attotime &period)
 	m_expire = m_start + start_delay;
 	m_period = period;
 
-	// remove and re-insert the timer in its new order
-	scheduler.timer_list_remove(*this);
-	scheduler.timer_list_insert(*this);
+	// move the timer to its new position in the queue
+	scheduler.timer_list_reorder(*this);
 
 	// if this was inserted as the head, abort the current timeslice and resync
-	if (this == scheduler.first_timer())
+	if (this == scheduler.next_timer())
 		scheduler.abort_timeslice();
 }
 
@@ -282,10 +291,8 @@ inline void emu_timer::schedule_next_period()
 	m_start = m_expire;
 	m_expire += m_period;
 
-	// remove and re-insert us
-	device_scheduler &scheduler = machine().scheduler();
-	scheduler.timer_list_remove(*this);
-	scheduler.timer_list_insert(*this);
+	// move us to our new position in the queue
+	machine().scheduler().timer_list_reorder(*this);
 }
 
 
@@ -323,25 +330,217 @@ void emu_timer::device_timer_expired(emu_timer &timer, void *ptr, s32 param)
 //  DEVICE SCHEDULER
 //**************************************************************************
 
+thread_local device_execute_interface *device_scheduler::s_executing_device = nullptr;
+
+
+//-------------------------------------------------
+//  execute_class - where a device belongs in the
+//  execute list; devices that are suspended
+//  without eating cycles are parked and left out
+//  so they cost nothing each timeslice
+//-------------------------------------------------
+
+inline u8 device_scheduler::execute_class(const device_execute_interface &exec)
+{
+	return (exec.m_suspend == 0) ? EXECUTE_ACTIVE : exec.m_eatcycles ? EXECUTE_EATING : EXECUTE_PARKED;
+}
+
+
+// ======================> device_scheduler::trace_recorder
+
+// Records scheduler events for offline analysis with src/tools/schedtrace.
+// The file is an 8-byte "MAMESTRC" signature, a 32-bit version and a
+// 32-bit record size, followed by fixed-size records in host byte order.
+// Names are written once as a NAME record whose text fills the following
+// records.  Events are queued in a single-producer ring buffer (producers
+// on other threads are serialised by the concurrent lock) and written out
+// by a background thread; if the ring fills, events are dropped and the
+// count is written in the END record.
+class device_scheduler::trace_recorder
+{
+public:
+	enum : u8
+	{
+		NAME = 0,           // source = name ID, arg0 = length of the text that follows
+		TIMESLICE,          // time = base time, arg0/arg1 = low/high 32 bits of the length in attoseconds
+		EXECUTE,            // source = device, time = local time after, arg0 = cycles requested, arg1 = cycles ran
+		TIMER,              // source = timer owner, time = expiration, arg0 = device timer ID, arg1 = 1 if temporary
+		SYNCHRONIZE,        // source = executing device, time = when set, arg0 = target name ID, arg1 = 1 if zero duration
+		END                 // arg0 = number of dropped records
+	};
+
+	static constexpr u16 NO_NAME = 0xffff;
+	static constexpr u32 VERSION = 1;
+
+	struct record
+	{
+		u8              type;
+		u8              reserved;
+		u16             source;
+		s32             seconds;
+		s64             attoseconds;
+		u32             arg0;
+		u32             arg1;
+	};
+	static_assert(sizeof(record) == 24, "trace records must stay 24 bytes");
+
+	trace_recorder(std::unique_ptr<emu_file> &&file)
+		: m_file(std::move(file))
+		, m_ring(new record[RING_SIZE])
+		, m_head(0)
+		, m_tail(0)
+		, m_exit(false)
+		, m_dropped(0)
+	{
+		m_file->write("MAMESTRC", 8);
+		u32 const header[2] = { VERSION, sizeof(record) };
+		m_file->write(header, sizeof(header));
+		m_thread = std::thread([this] () { writer(); });
+	}
+
+	~trace_recorder()
+	{
+		push(END, NO_NAME, attotime::zero, m_dropped, 0);
+		m_exit = true;
+		m_thread.join();
+	}
+
+	// look up the ID for a name, writing it out the first time it is seen
+	u16 name(const char *text)
+	{
+		if (text == nullptr)
+			return NO_NAME;
+		auto const found = m_names.find(text);
+		if (found != m_names.end())
+			return found->second;
+		if (m_names.size() >= NO_NAME)
+			return NO_NAME;
+
+		// the name and its text must go into the ring together
+		u32 const length = strlen(text);
+		u32 const count = 1 + ((length + sizeof(record) - 1) / sizeof(record));
+		u32 const tail = m_tail.load(std::memory_order_relaxed);
+		if ((RING_SIZE - (tail - m_head.load(std::memory_order_acquire))) < count)
+		{
+			m_dropped++;
+			return NO_NAME;
+		}
+
+		u16 const id = m_names.size();
+		m_names.emplace(text, id);
+		record &header = m_ring[tail & (RING_SIZE - 1)];
+		header = record{ NAME, 0, id, 0, 0, length, 0 };
+		for (u32 index = 1; index < count; index++)
+		{
+			record &body = m_ring[(tail + index) & (RING_SIZE - 1)];
+			std::fill_n(reinterpret_cast<char *>(&body), sizeof(body), 0);
+			u32 const offset = (index - 1) * sizeof(record);
+			memcpy(&body, text + offset, std::min<u32>(length - offset, sizeof(record)));
+		}
+		m_tail.store(tail + count, std::memory_order_release);
+		return id;
+	}
+
+	// queue a single event
+	void push(u8 type, u16 source, const attotime &time, u32 arg0, u32 arg1)
+	{
+		u32 const tail = m_tail.load(std::memory_order_relaxed);
+		if ((tail - m_head.load(std::memory_order_acquire)) == RING_SIZE)
+		{
+			m_dropped++;
+			return;
+		}
+		m_ring[tail & (RING_SIZE - 1)] = record{ type, 0, source, time.seconds(), time.attoseconds(), arg0, arg1 };
+		m_tail.store(tail + 1, std::memory_order_release);
+	}
+
+private:
+	static constexpr u32 RING_SIZE = 65536;                 // must be a power of two
+
+	// drain the ring to the file until told to stop
+	void writer()
+	{
+		while (true)
+		{
+			u32 const head = m_head.load(std::memory_order_relaxed);
+			u32 const tail = m_tail.load(std::memory_order_acquire);
+			if (head == tail)
+			{
+				// check once more after being told to stop, in case the final records just arrived
+				if (m_exit && (m_tail.load(std::memory_order_acquire) == head))
+					break;
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				continue;
+			}
+
+			// write up to the end of the ring in one go
+			u32 const start = head & (RING_SIZE - 1);
+			u32 const count = std::min(tail - head, RING_SIZE - start);
+			m_file->write(&m_ring[start], count * sizeof(record));
+			m_head.store(head + count, std::memory_order_release);
+		}
+	}
+
+	std::unique_ptr<emu_file>       m_file;         // output file, only touched by the writer thread after construction
+	std::unique_ptr<record []>      m_ring;         // ring of queued records
+	std::atomic<u32>                m_head;         // next record to write out
+	std::atomic<u32>                m_tail;         // next free record
+	std::atomic<bool>               m_exit;         // set to make the writer finish up
+	u32                             m_dropped;      // records lost because the ring was full
+	std::unordered_map<const char *, u16> m_names;  // IDs of names already written
+	std::thread                     m_thread;       // writer thread
+};
+
+
 //-------------------------------------------------
 //  device_scheduler - constructor
 //-------------------------------------------------
 
 device_scheduler::device_scheduler(running_machine &machine) :
 	m_machine(machine),
-	m_executing_device(nullptr),
 	m_execute_list(nullptr),
+	m_execute_list_rebuilds(0),
+	m_execute_list_updates(0),
+	m_execute_stats_second(0),
+	m_execute_stats_count(0),
+	m_execute_stats_previous(0),
+	m_idle_skipping(0),
 	m_basetime(attotime::zero),
+	m_basetick(0),
 	m_timer_list(nullptr),
+	m_timer_sequence(0),
+	m_timer_free(nullptr),
+	m_timer_pool_size(0),
+	m_timers_live(0),
+	m_timers_peak(0),
+	m_timer_allocs(0),
+	m_temp_timer_allocs(0),
+	m_count_timer_sources(machine.options().verbose()),
 	m_callback_timer(nullptr),
 	m_callback_timer_modified(false),
 	m_callback_timer_expire_time(attotime::zero),
 	m_suspend_changes_pending(true),
-	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
+	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000),
+	m_adaptive_quantum(machine.options().adaptive_quantum()),
+	m_adaptive_shift(0),
+	m_quiet_quanta(0),
+	m_quantum_interactions(0),
+	m_adaptive_stats_second(0),
+	m_adaptive_stats_quanta(0),
+	m_adaptive_stats_interactions(0),
+	m_adaptive_stats_min(0),
+	m_adaptive_stats_max(0),
+	m_device_profile(false),
+	m_device_profile_json(false),
+	m_device_profile_perf(false),
+	m_device_profile_frames(0),
+	m_domain_queue(nullptr),
+	m_concurrent(false)
 {
-	// append a single never-expiring timer so there is always one in the list
-	m_timer_list = &m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), nullptr, true);
-	m_timer_list->adjust(attotime::never);
+	std::fill(std::begin(m_adaptive_stats_histogram), std::end(m_adaptive_stats_histogram), 0);
+
+	// append a single never-expiring timer so there is always one in the queue
+	timer_pool_alloc().init(machine, timer_expired_delegate(), nullptr, true).adjust(attotime::never);
 
 	// register global states
 	machine.save().save_item(NAME(m_basetime));
@@ -356,9 +555,21 @@ device_scheduler::device_scheduler(running_machine &machine) :
 
 device_scheduler::~device_scheduler()
 {
-	// remove all timers
+	// stop the worker threads
+	if (m_domain_queue != nullptr)
+		osd_work_queue_free(m_domain_queue);
+
+	dump_timer_pool_stats();
+	osd_printf_verbose("Scheduler: execute list rebuilt %u times, updated %u times (%.1f/s)\n",
+			m_execute_list_rebuilds,
+			m_execute_list_updates,
+			(m_basetime.as_double() > 0.0) ? (double(m_execute_list_updates) / m_basetime.as_double()) : 0.0);
+
+	// remove all timers and free the pool
 	while (m_timer_list != nullptr)
-		m_timer_allocator.reclaim(m_timer_list->release());
+		timer_pool_reclaim(m_timer_list->release());
+	for (emu_timer *slab : m_timer_slabs)
+		delete [] slab;
 }
 
 
@@ -374,7 +585,7 @@ attotime device_scheduler::time() const noexcept
 
 	// if we're executing as a particular CPU, use its local time as a base
 	// otherwise, return the global base time
-	return (m_executing_device != nullptr) ? m_executing_device->local_time() : m_basetime;
+	return (s_executing_device != nullptr) ? s_executing_device->local_time() : m_basetime;
 }
 
 
@@ -407,18 +618,38 @@ bool device_scheduler::can_save() const
 inline void device_scheduler::apply_suspend_changes()
 {
 	u32 suspendchanged = 0;
-	for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+	for (device_execute_interface *exec : m_execute_devices)
 	{
 		suspendchanged |= exec->m_suspend ^ exec->m_nextsuspend;
 		exec->m_suspend = exec->m_nextsuspend;
 		exec->m_nextsuspend &= ~SUSPEND_REASON_TIMESLICE;
 		exec->m_eatcycles = exec->m_nexteatcycles;
+		if (execute_class(*exec) != exec->m_exec_class)
+			m_execute_changed.push_back(exec);
 	}
 
-	// recompute the execute list if any CPUs changed their suspension state
-	if (suspendchanged != 0)
-		rebuild_execute_list();
-	else
+	// move any devices that started or stopped running
+	if (!m_execute_changed.empty())
+	{
+		for (device_execute_interface *exec : m_execute_changed)
+			update_execute_list(*exec);
+		m_execute_changed.clear();
+		if (m_domains.size() > 1)
+			rebuild_domain_lists();
+
+		// count the updates for each emulated second
+		if (m_execute_stats_second != m_basetime.seconds())
+		{
+			m_execute_stats_previous = (m_execute_stats_second + 1 == m_basetime.seconds()) ? m_execute_stats_count : 0;
+			m_execute_stats_second = m_basetime.seconds();
+			m_execute_stats_count = 0;
+		}
+		m_execute_stats_count++;
+		m_execute_list_updates++;
+	}
+
+	// check again next time if any CPUs changed their suspension state
+	if (suspendchanged == 0)
 		m_suspend_changes_pending = false;
 }
 
@@ -433,7 +664,7 @@ void device_scheduler::timeslice()
 	bool call_debugger = ((machine().debug_flags & DEBUG_FLAG_ENABLED) != 0);
 
 	// build the execution list if we don't have one yet
-	if (UNEXPECTED(m_execute_list == nullptr))
+	if (UNEXPECTED(m_execute_devices.empty()))
 		rebuild_execute_list();
 
 	// if the current quantum has expired, find a new one
@@ -441,107 +672,237 @@ void device_scheduler::timeslice()
 		m_quantum_allocator.reclaim(m_quantum_list.detach_head());
 
 	// loop until we hit the next timer
-	while (m_basetime < m_timer_list->m_expire)
+	while (m_basetick < next_timer()->m_heap_expire)
 	{
 		// by default, assume our target is the end of the next quantum
-		attotime target(m_basetime + attotime(0, m_quantum_list.first()->m_actual));
+		attotime target(m_basetime + attotime(0, current_quantum()));
 
 		// however, if the next timer is going to fire before then, override
-		if (m_timer_list->m_expire < target)
-			target = m_timer_list->m_expire;
+		if (next_timer()->m_expire < target)
+			target = next_timer()->m_expire;
 
 		LOG("------------------\n");
 		LOG("cpu_timeslice: target = %s\n", target.as_string(PRECISION));
+		if (UNEXPECTED(m_trace))
+		{
+			u64 const length = (target - m_basetime).as_attoseconds();
+			m_trace->push(trace_recorder::TIMESLICE, trace_recorder::NO_NAME, m_basetime, u32(length), u32(length >> 32));
+		}
 
 		// do we have pending suspension changes?
 		if (m_suspend_changes_pending)
 			apply_suspend_changes();
 
-		// loop over all CPUs
-		for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+		// loop over all CPUs, either on this thread or split across concurrent domains
+		if (m_domains.size() > 1 && !call_debugger)
+			execute_domains(target);
+		else
+			for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+				execute_device(*exec, target, call_debugger, false);
+		s_executing_device = nullptr;
+
+		// update the base time
+		m_basetime = target;
+		m_basetick = attotime_to_tick(target);
+
+		// widen or narrow the quantum based on what happened
+		if (m_adaptive_quantum)
+			update_adaptive_quantum();
+	}
+
+	// execute timers
+	execute_timers();
+}
+
+
+//-------------------------------------------------
+//  execute_device - run a single device up to
+//  the target time, pulling the target back if
+//  the device stops early
+//-------------------------------------------------
+
+inline void device_scheduler::execute_device(device_execute_interface &exec, attotime &target, bool call_debugger, bool concurrent)
+{
+	// only process if this CPU is executing or truly halted (not yielding)
+	// and if our target is later than the CPU's current time (coarse check)
+	if (EXPECTED((exec.m_suspend == 0 || exec.m_eatcycles) && target.seconds() >= exec.m_localtime.seconds()))
+	{
+		// compute how many attoseconds to execute this CPU
+		attoseconds_t delta = target.attoseconds() - exec.m_localtime.attoseconds();
+		if (delta < 0 && target.seconds() > exec.m_localtime.seconds())
+			delta += ATTOSECONDS_PER_SECOND;
+		assert(delta == (target - exec.m_localtime).as_attoseconds());
+
+		if (exec.m_attoseconds_per_cycle == 0)
 		{
-			// only process if this CPU is executing or truly halted (not yielding)
-			// and if our target is later than the CPU's current time (coarse check)
-			if (EXPECTED((exec->m_suspend == 0 || exec->m_eatcycles) && target.seconds() >= exec->m_localtime.seconds()))
+			exec.m_localtime = target;
+		}
+		// if we have enough for at least 1 cycle, do the math
+		else if (delta >= exec.m_attoseconds_per_cycle)
+		{
+			// idle loop detection taps the device's address spaces, so keep it away from other threads and the debugger
+			bool const idle_detect = exec.m_idle_detect && !concurrent && !call_debugger;
+
+			// compute how many cycles we want to execute
+			int ran = exec.m_cycles_running = divu_64x32(u64(delta) >> exec.m_divshift, exec.m_divisor);
+			int const requested = ran;
+			LOG("  cpu '%s': %d (%d cycles)\n", exec.device().tag(), delta, exec.m_cycles_running);
+
+			// if we're not suspended or waiting in an idle loop, actually execute
+			bool const idle = exec.m_suspend == 0 && idle_detect && exec.idle_skip();
+			if (exec.m_suspend == 0 && !idle)
 			{
-				// compute how many attoseconds to execute this CPU
-				attoseconds_t delta = target.attoseconds() - exec->m_localtime.attoseconds();
-				if (delta < 0 && target.seconds() > exec->m_localtime.seconds())
-					delta += ATTOSECONDS_PER_SECOND;
-				assert(delta == (target - exec->m_localtime).as_attoseconds());
+				// the profiler isn't thread-safe, so concurrent domains aren't profiled
+				if (!concurrent)
+					g_profiler.start(exec.m_profiler);
+
+				// host time is only measured when profiling, since reading the clock isn't free
+				osd_ticks_t const profile_start = (m_device_profile || util::scope_profiler::active()) ? osd_ticks() : 0;
+
+				// hardware counters are per thread, so concurrent domains only read them if they've opened their own
+				u64 perf_start[OSD_PERF_COUNTER_COUNT];
+				bool const perf = m_device_profile_perf && osd_perf_counters_read(perf_start);
+
+				// note that this global variable cycles_stolen can be modified
+				// via the call to cpu_execute
+				exec.m_cycles_stolen = 0;
+				s_executing_device = &exec;
+				*exec.m_icountptr = exec.m_cycles_running;
+				if (!call_debugger)
+					exec.run();
+				else
+				{
+					exec.debugger_start_cpu_hook(target);
+					exec.run();
+					exec.debugger_stop_cpu_hook();
+				}
+
+				// adjust for any cycles we took back
+				assert(ran >= *exec.m_icountptr);
+				ran -= *exec.m_icountptr;
+				assert(ran >= exec.m_cycles_stolen);
+				ran -= exec.m_cycles_stolen;
+				if (!concurrent)
+					g_profiler.stop();
 
-				if (exec->m_attoseconds_per_cycle == 0)
+				if (idle_detect)
+					exec.idle_sample();
+
+				osd_ticks_t const profile_end = profile_start ? osd_ticks() : 0;
+				u64 perf_end[OSD_PERF_COUNTER_COUNT];
+				if (perf && osd_perf_counters_read(perf_end))
 				{
-					exec->m_localtime = target;
+					for (int counter = 0; counter < OSD_PERF_COUNTER_COUNT; counter++)
+						exec.m_profile_perf[counter] += perf_end[counter] - perf_start[counter];
 				}
-				// if we have enough for at least 1 cycle, do the math
-				else if (delta >= exec->m_attoseconds_per_cycle)
+				if (profile_start)
+					util::scope_profiler::record(exec.m_profile_scope, profile_start, profile_end);
+				if (m_device_profile)
 				{
-					// compute how many cycles we want to execute
-					int ran = exec->m_cycles_running = divu_64x32(u64(delta) >> exec->m_divshift, exec->m_divisor);
-					LOG("  cpu '%s': %d (%d cycles)\n", exec->device().tag(), delta, exec->m_cycles_running);
-
-					// if we're not suspended, actually execute
-					if (exec->m_suspend == 0)
-					{
-						g_profiler.start(exec->m_profiler);
-
-						// note that this global variable cycles_stolen can be modified
-						// via the call to cpu_execute
-						exec->m_cycles_stolen = 0;
-						m_executing_device = exec;
-						*exec->m_icountptr = exec->m_cycles_running;
-						if (!call_debugger)
-							exec->run();
-						else
-						{
-							exec->debugger_start_cpu_hook(target);
-							exec->run();
-							exec->debugger_stop_cpu_hook();
-						}
-
-						// adjust for any cycles we took back
-						assert(ran >= *exec->m_icountptr);
-						ran -= *exec->m_icountptr;
-						assert(ran >= exec->m_cycles_stolen);
-						ran -= exec->m_cycles_stolen;
-						g_profiler.stop();
-					}
-
-					// account for these cycles
-					exec->m_totalcycles += ran;
-
-					// update the local time for this CPU
-					attotime deltatime;
-					if (ran < exec->m_cycles_per_second)
-						deltatime = attotime(0, exec->m_attoseconds_per_cycle * ran);
-					else
-					{
-						u32 remainder;
-						s32 secs = divu_64x32_rem(ran, exec->m_cycles_per_second, remainder);
-						deltatime = attotime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
-					}
-					assert(deltatime >= attotime::zero);
-					exec->m_localtime += deltatime;
-					LOG("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION));
-
-					// if the new local CPU time is less than our target, move the target up, but not before the base
-					if (exec->m_localtime < target)
-					{
-						target = std::max(exec->m_localtime, m_basetime);
-						LOG("         (new target)\n");
-					}
+					exec.m_profile_ticks += profile_end - profile_start;
+					exec.m_profile_cycles += ran;
+					exec.m_profile_timeslices++;
 				}
 			}
-		}
-		m_executing_device = nullptr;
+			else
+			{
+				// on-chip peripherals that count the CPU's cycles are kept going the same way as when it spins
+				if (idle)
+				{
+					*exec.m_icountptr = ran;
+					exec.execute_burn(ran);
+				}
 
-		// update the base time
-		m_basetime = target;
+				// suspended but eating cycles, or skipping an idle loop
+				if (m_device_profile)
+					exec.m_profile_eaten += ran;
+			}
+
+			// account for these cycles
+			exec.m_totalcycles += ran;
+
+			// update the local time for this CPU
+			attotime deltatime;
+			if (ran < exec.m_cycles_per_second)
+				deltatime = attotime(0, exec.m_attoseconds_per_cycle * ran);
+			else
+			{
+				u32 remainder;
+				s32 secs = divu_64x32_rem(ran, exec.m_cycles_per_second, remainder);
+				deltatime = attotime(secs, u64(remainder) * exec.m_attoseconds_per_cycle);
+			}
+			assert(deltatime >= attotime::zero);
+			exec.m_localtime += deltatime;
+			LOG("         %d ran, %d total, time = %s\n", ran, s32(exec.m_totalcycles), exec.m_localtime.as_string(PRECISION));
+			if (UNEXPECTED(m_trace))
+			{
+				auto const guard(concurrent_guard());
+				m_trace->push(trace_recorder::EXECUTE, m_trace->name(exec.device().tag()), exec.m_localtime, requested, ran);
+			}
+
+			// if the new local CPU time is less than our target, move the target up, but not before the base
+			if (exec.m_localtime < target)
+			{
+				target = std::max(exec.m_localtime, m_basetime);
+				LOG("         (new target)\n");
+			}
+		}
 	}
+}
 
-	// execute timers
-	execute_timers();
+
+//-------------------------------------------------
+//  execute_domains - run each execution domain
+//  up to the target time, concurrently with the
+//  others; the earliest time any of them stopped
+//  at becomes the new target
+//-------------------------------------------------
+
+void device_scheduler::execute_domains(attotime &target)
+{
+	for (execution_domain &domain : m_domains)
+		domain.m_target = target;
+
+	// domains other than the first run on the worker threads
+	if (m_domain_queue == nullptr)
+		m_domain_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	m_concurrent = true;
+	osd_work_item_queue_multiple(m_domain_queue, execute_domain_callback, m_domains.size() - 1, &m_domains[1], sizeof(m_domains[1]), WORK_ITEM_FLAG_AUTO_RELEASE);
+
+	// the first one runs here, then wait for the rest
+	execute_domain_callback(&m_domains[0], 0);
+	osd_work_queue_wait(m_domain_queue, osd_ticks_per_second() * 100);
+	m_concurrent = false;
+
+	for (execution_domain &domain : m_domains)
+		target = std::min(target, domain.m_target);
+}
+
+
+//-------------------------------------------------
+//  execute_domain_callback - run all the devices
+//  in a single execution domain
+//-------------------------------------------------
+
+void *device_scheduler::execute_domain_callback(void *param, int threadid)
+{
+	execution_domain &domain = *reinterpret_cast<execution_domain *>(param);
+	for (device_execute_interface *exec : domain.m_devices)
+		domain.m_scheduler->execute_device(*exec, domain.m_target, false, true);
+	s_executing_device = nullptr;
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  outside_main_domain - true if the calling
+//  thread is running a device from an execution
+//  domain other than the main one
+//-------------------------------------------------
+
+bool device_scheduler::outside_main_domain() const noexcept
+{
+	return m_concurrent && (s_executing_device != nullptr) && (s_executing_device->execution_domain() != 0);
 }
 
 
@@ -552,8 +913,8 @@ void device_scheduler::timeslice()
 
 void device_scheduler::abort_timeslice()
 {
-	if (m_executing_device != nullptr)
-		m_executing_device->abort_timeslice();
+	if (s_executing_device != nullptr)
+		s_executing_device->abort_timeslice();
 }
 
 
@@ -563,17 +924,20 @@ void device_scheduler::abort_timeslice()
 
 void device_scheduler::trigger(int trigid, const attotime &after)
 {
+	auto const guard(concurrent_guard());
+	note_interaction();
+
 	// ensure we have a list of executing devices
-	if (m_execute_list == nullptr)
+	if (m_execute_devices.empty())
 		rebuild_execute_list();
 
 	// if we have a non-zero time, schedule a timer
 	if (after != attotime::zero)
 		timer_set(after, timer_expired_delegate(FUNC(device_scheduler::timed_trigger), this), trigid);
 
-	// send the trigger to everyone who cares
+	// send the trigger to everyone who cares, including parked devices
 	else
-		for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+		for (device_execute_interface *exec : m_execute_devices)
 			exec->trigger(trigid);
 }
 
@@ -588,6 +952,8 @@ void device_scheduler::boost_interleave(const attotime &timeslice_time, const at
 	// ignore timeslices > 1 second
 	if (timeslice_time.seconds() > 0)
 		return;
+	auto const guard(concurrent_guard());
+	note_interaction();
 	add_scheduling_quantum(timeslice_time, boost_duration);
 }
 
@@ -599,7 +965,8 @@ void device_scheduler::boost_interleave(const attotime &timeslice_time, const at
 
 emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback, void *ptr)
 {
-	return &m_timer_allocator.alloc()->init(machine(), callback, ptr, false);
+	auto const guard(concurrent_guard());
+	return &timer_pool_alloc().init(machine(), callback, ptr, false);
 }
 
 
@@ -611,7 +978,17 @@ emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback, void *
 
 void device_scheduler::timer_set(const attotime &duration, timer_expired_delegate callback, int param, void *ptr)
 {
-	m_timer_allocator.alloc()->init(machine(), callback, ptr, true).adjust(duration, param);
+	auto const guard(concurrent_guard());
+
+	// zero-length timers come from synchronize(), which is how devices talk to each other
+	if (duration.is_zero())
+		note_interaction();
+	m_temp_timer_allocs++;
+	if (UNEXPECTED(m_count_timer_sources))
+		m_callback_temp_timers[callback.name() ? callback.name() : "unnamed"]++;
+	if (UNEXPECTED(m_trace))
+		trace_synchronize(callback.name(), duration);
+	timer_pool_alloc().init(machine(), callback, ptr, true).adjust(duration, param);
 }
 
 
@@ -622,7 +999,8 @@ void device_scheduler::timer_set(const attotime &duration, timer_expired_delegat
 
 emu_timer *device_scheduler::timer_alloc(device_t &device, device_timer_id id, void *ptr)
 {
-	return &m_timer_allocator.alloc()->init(device, id, ptr, false);
+	auto const guard(concurrent_guard());
+	return &timer_pool_alloc().init(device, id, ptr, false);
 }
 
 
@@ -634,7 +1012,17 @@ emu_timer *device_scheduler::timer_alloc(device_t &device, device_timer_id id, v
 
 void device_scheduler::timer_set(const attotime &duration, device_t &device, device_timer_id id, int param, void *ptr)
 {
-	m_timer_allocator.alloc()->init(device, id, ptr, true).adjust(duration, param);
+	auto const guard(concurrent_guard());
+
+	// zero-length timers come from synchronize(), which is how devices talk to each other
+	if (duration.is_zero())
+		note_interaction();
+	m_temp_timer_allocs++;
+	if (UNEXPECTED(m_count_timer_sources))
+		m_device_temp_timers[&device]++;
+	if (UNEXPECTED(m_trace))
+		trace_synchronize(device.tag(), duration);
+	timer_pool_alloc().init(device, id, ptr, true).adjust(duration, param);
 }
 
 
@@ -645,7 +1033,7 @@ void device_scheduler::timer_set(const attotime &duration, device_t &device, dev
 
 void device_scheduler::eat_all_cycles()
 {
-	for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+	for (device_execute_interface *exec : m_execute_devices)
 		exec->eat_cycles(1000000000);
 }
 
@@ -681,25 +1069,24 @@ void device_scheduler::presave()
 
 void device_scheduler::postload()
 {
-	// remove all timers and make a private list of permanent ones
-	simple_list<emu_timer> private_list;
-	while (m_timer_list != nullptr)
-	{
-		emu_timer &timer = *m_timer_list;
+	// the base time was restored behind our back
+	m_basetick = attotime_to_tick(m_basetime);
 
-		// temporary timers go away entirely (except our special never-expiring one)
-		if (timer.m_temporary && !timer.expire().is_never())
-			m_timer_allocator.reclaim(timer.release());
-
-		// permanent ones get added to our private list
-		else
-			private_list.append(timer_list_remove(timer));
+	// temporary timers go away entirely (except our special never-expiring one)
+	emu_timer *next;
+	for (emu_timer *timer = m_timer_list; timer != nullptr; timer = next)
+	{
+		next = timer->next();
+		if (timer->m_temporary && !timer->expire().is_never())
+			timer_pool_reclaim(timer->release());
 	}
 
-	// now re-insert them; this effectively re-sorts them by time
-	emu_timer *timer;
-	while ((timer = private_list.detach_head()) != nullptr)
-		timer_list_insert(*timer);
+	// take the permanent ones in their current order and re-queue them; this effectively re-sorts them by time
+	std::vector<emu_timer *> timers(m_timer_heap);
+	std::sort(timers.begin(), timers.end(), [] (emu_timer const *a, emu_timer const *b) { return timer_heap_before(*a, *b); });
+	m_timer_heap.clear();
+	for (emu_timer *timer : timers)
+		timer_heap_push(*timer);
 
 	m_suspend_changes_pending = true;
 	rebuild_execute_list();
@@ -720,18 +1107,18 @@ void device_scheduler::postload()
 void device_scheduler::compute_perfect_interleave()
 {
 	// ensure we have a list of executing devices
-	if (m_execute_list == nullptr)
+	if (m_execute_devices.empty())
 		rebuild_execute_list();
 
 	// start with the first one
-	device_execute_interface *first = m_execute_list;
-	if (first != nullptr)
+	if (!m_execute_devices.empty())
 	{
 		// start with a huge time factor and find the 2nd smallest cycle time
-		attoseconds_t smallest = first->minimum_quantum();
+		attoseconds_t smallest = m_execute_devices.front()->minimum_quantum();
 		attoseconds_t perfect = ATTOSECONDS_PER_SECOND - 1;
-		for (device_execute_interface *exec = first->m_nextexec; exec != nullptr; exec = exec->m_nextexec)
+		for (auto it = std::next(m_execute_devices.begin()); it != m_execute_devices.end(); ++it)
 		{
+			device_execute_interface *const exec = *it;
 			// find the 2nd smallest cycle interval
 			attoseconds_t curquantum = exec->minimum_quantum();
 			if (curquantum < smallest)
@@ -786,17 +1173,30 @@ void device_scheduler::rebuild_execute_list()
 	device_execute_interface *suspend_list = nullptr;
 	device_execute_interface **suspend_tailptr = &suspend_list;
 
-	// iterate over all devices
+	// iterate over all devices; parked devices are left out entirely
+	m_execute_devices.clear();
+	m_domains.clear();
+
+	// the main domain always comes first, so it runs on this thread
+	m_domains.push_back(execution_domain{ this, 0, { }, attotime::zero });
 	for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
 	{
+		exec.m_exec_index = m_execute_devices.size();
+		exec.m_exec_class = execute_class(exec);
+		m_execute_devices.push_back(&exec);
+
+		// make sure its execution domain exists
+		if (std::find_if(m_domains.begin(), m_domains.end(), [&exec] (execution_domain const &d) { return d.m_id == exec.m_execution_domain; }) == m_domains.end())
+			m_domains.push_back(execution_domain{ this, exec.m_execution_domain, { }, attotime::zero });
+
 		// append to the appropriate list
 		exec.m_nextexec = nullptr;
-		if (exec.m_suspend == 0)
+		if (exec.m_exec_class == EXECUTE_ACTIVE)
 		{
 			*active_tailptr = &exec;
 			active_tailptr = &exec.m_nextexec;
 		}
-		else
+		else if (exec.m_exec_class == EXECUTE_EATING)
 		{
 			*suspend_tailptr = &exec;
 			suspend_tailptr = &exec.m_nextexec;
@@ -805,59 +1205,108 @@ void device_scheduler::rebuild_execute_list()
 
 	// append the suspend list to the end of the active list
 	*active_tailptr = suspend_list;
+	rebuild_domain_lists();
+	m_execute_list_rebuilds++;
 }
 
 
 //-------------------------------------------------
-//  timer_list_insert - insert a new timer into
-//  the list at the appropriate location
+//  update_execute_list - move a single device to
+//  its new place in the execute list after its
+//  suspend state changed
 //-------------------------------------------------
 
-inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
+void device_scheduler::update_execute_list(device_execute_interface &exec)
 {
-	// disabled timers sort to the end
-	const attotime expire = timer.m_enabled ? timer.m_expire : attotime::never;
+	// unlink it from wherever it was
+	if (exec.m_exec_class != EXECUTE_PARKED)
+	{
+		device_execute_interface **prevptr = &m_execute_list;
+		while (*prevptr != &exec)
+			prevptr = &(*prevptr)->m_nextexec;
+		*prevptr = exec.m_nextexec;
+		exec.m_nextexec = nullptr;
+	}
 
-	// loop over the timer list
-	emu_timer *prevtimer = nullptr;
-	for (emu_timer *curtimer = m_timer_list; curtimer != nullptr; prevtimer = curtimer, curtimer = curtimer->next())
+	// running devices come first, then those eating cycles, each in device order
+	exec.m_exec_class = execute_class(exec);
+	if (exec.m_exec_class != EXECUTE_PARKED)
 	{
-		// if the current list entry expires after us, we should be inserted before it
-		if (curtimer->m_expire > expire)
-		{
-			// link the new guy in before the current list entry
-			timer.m_prev = prevtimer;
-			timer.m_next = curtimer;
+		device_execute_interface **prevptr = &m_execute_list;
+		while (*prevptr != nullptr && ((*prevptr)->m_exec_class < exec.m_exec_class || ((*prevptr)->m_exec_class == exec.m_exec_class && (*prevptr)->m_exec_index < exec.m_exec_index)))
+			prevptr = &(*prevptr)->m_nextexec;
+		exec.m_nextexec = *prevptr;
+		*prevptr = &exec;
+	}
+}
 
-			if (prevtimer != nullptr)
-				prevtimer->m_next = &timer;
-			else
-				m_timer_list = &timer;
 
-			curtimer->m_prev = &timer;
-			return timer;
-		}
+//-------------------------------------------------
+//  rebuild_domain_lists - sort the devices in the
+//  execute list into their execution domains,
+//  keeping the same order within each
+//-------------------------------------------------
+
+void device_scheduler::rebuild_domain_lists()
+{
+	for (execution_domain &domain : m_domains)
+		domain.m_devices.clear();
+	for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+	{
+		auto domain = std::find_if(m_domains.begin(), m_domains.end(), [exec] (execution_domain const &d) { return d.m_id == exec->m_execution_domain; });
+		domain->m_devices.push_back(exec);
 	}
+}
+
 
-	// need to insert after the last one
-	if (prevtimer != nullptr)
-		prevtimer->m_next = &timer;
+//-------------------------------------------------
+//  execute_list_updates_per_second - number of
+//  times the execute list changed during the last
+//  full emulated second
+//-------------------------------------------------
+
+u32 device_scheduler::execute_list_updates_per_second() const
+{
+	if (m_basetime.seconds() == m_execute_stats_second)
+		return m_execute_stats_previous;
+	else if (m_basetime.seconds() == m_execute_stats_second + 1)
+		return m_execute_stats_count;
 	else
-		m_timer_list = &timer;
+		return 0;
+}
 
-	timer.m_prev = prevtimer;
-	timer.m_next = nullptr;
+
+//-------------------------------------------------
+//  timer_list_insert - add a new timer to the
+//  list of all timers and queue it at the
+//  appropriate location
+//-------------------------------------------------
+
+inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
+{
+	// link it in at the head of the list of all timers
+	timer.m_prev = nullptr;
+	timer.m_next = m_timer_list;
+	if (m_timer_list != nullptr)
+		m_timer_list->m_prev = &timer;
+	m_timer_list = &timer;
+
+	// then add it to the queue
+	timer_heap_push(timer);
 	return timer;
 }
 
 
 //-------------------------------------------------
 //  timer_list_remove - remove a timer from the
-//  linked list
+//  list of all timers and from the queue
 //-------------------------------------------------
 
 inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 {
+	// remove it from the queue
+	timer_heap_erase(timer);
+
 	// remove it from the list
 	if (timer.m_prev != nullptr)
 		timer.m_prev->m_next = timer.m_next;
@@ -871,19 +1320,176 @@ inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 }
 
 
+//-------------------------------------------------
+//  timer_list_reorder - move a timer to the
+//  correct position in the queue after its
+//  expiration time or enable state changed
+//-------------------------------------------------
+
+inline void device_scheduler::timer_list_reorder(emu_timer &timer)
+{
+	// this is equivalent to removing and re-inserting it, so it goes after any timers with the same expiration time
+	const attotick_t old_expire = timer.m_heap_expire;
+	timer.m_heap_expire = timer.m_enabled ? attotime_to_tick(timer.m_expire) : ATTOTICK_NEVER;
+	timer.m_heap_sequence = m_timer_sequence++;
+
+	// an earlier expiration can only move it up, anything else can only move it down
+	if (timer.m_heap_expire < old_expire)
+		timer_heap_sift_up(timer.m_heap_index);
+	else
+		timer_heap_sift_down(timer.m_heap_index);
+}
+
+
+//-------------------------------------------------
+//  timer_pool_alloc - take a timer from the pool,
+//  adding a new slab if it has run dry
+//-------------------------------------------------
+
+emu_timer &device_scheduler::timer_pool_alloc()
+{
+	if (m_timer_free == nullptr)
+	{
+		// each slab is as large as all the previous ones combined, so the pool doubles to follow the peak
+		const u32 count = std::max(m_timer_pool_size, TIMER_SLAB_MINIMUM);
+		emu_timer *const slab = new emu_timer[count];
+		m_timer_slabs.push_back(slab);
+		m_timer_pool_size += count;
+		for (u32 index = 0; index < count; index++)
+			slab[index].m_next = (index + 1 < count) ? &slab[index + 1] : nullptr;
+		m_timer_free = slab;
+	}
+
+	emu_timer &result = *m_timer_free;
+	m_timer_free = result.m_next;
+	m_timer_allocs++;
+	if (++m_timers_live > m_timers_peak)
+		m_timers_peak = m_timers_live;
+	return result;
+}
+
+
+//-------------------------------------------------
+//  timer_pool_reclaim - return a released timer
+//  to the pool
+//-------------------------------------------------
+
+inline void device_scheduler::timer_pool_reclaim(emu_timer &timer)
+{
+	timer.m_next = m_timer_free;
+	m_timer_free = &timer;
+	m_timers_live--;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_push - add a timer to the queue;
+//  disabled timers sort to the end
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_push(emu_timer &timer)
+{
+	timer.m_heap_expire = timer.m_enabled ? attotime_to_tick(timer.m_expire) : ATTOTICK_NEVER;
+	timer.m_heap_sequence = m_timer_sequence++;
+	timer.m_heap_index = m_timer_heap.size();
+	m_timer_heap.push_back(&timer);
+	timer_heap_sift_up(timer.m_heap_index);
+}
+
+
+//-------------------------------------------------
+//  timer_heap_erase - remove an arbitrary timer
+//  from the queue
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_erase(emu_timer &timer)
+{
+	// move the last entry into the vacated slot
+	const u32 index = timer.m_heap_index;
+	assert(m_timer_heap[index] == &timer);
+	emu_timer &last = *m_timer_heap.back();
+	m_timer_heap.pop_back();
+	if (&last == &timer)
+		return;
+
+	m_timer_heap[index] = &last;
+	last.m_heap_index = index;
+
+	// and restore the heap property around it
+	if (index > 0 && timer_heap_before(last, *m_timer_heap[(index - 1) / 2]))
+		timer_heap_sift_up(index);
+	else
+		timer_heap_sift_down(index);
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_up - move the timer at the
+//  given position towards the root until its
+//  parent sorts before it
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_sift_up(u32 index)
+{
+	emu_timer *const timer = m_timer_heap[index];
+	while (index > 0)
+	{
+		const u32 parent = (index - 1) / 2;
+		if (!timer_heap_before(*timer, *m_timer_heap[parent]))
+			break;
+		m_timer_heap[index] = m_timer_heap[parent];
+		m_timer_heap[index]->m_heap_index = index;
+		index = parent;
+	}
+	m_timer_heap[index] = timer;
+	timer->m_heap_index = index;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_down - move the timer at the
+//  given position towards the leaves until both
+//  children sort after it
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_sift_down(u32 index)
+{
+	const u32 count = m_timer_heap.size();
+	emu_timer *const timer = m_timer_heap[index];
+	while (true)
+	{
+		// find the child that sorts first
+		u32 child = (index * 2) + 1;
+		if (child >= count)
+			break;
+		if ((child + 1) < count && timer_heap_before(*m_timer_heap[child + 1], *m_timer_heap[child]))
+			child++;
+
+		// stop if we sort before it
+		if (!timer_heap_before(*m_timer_heap[child], *timer))
+			break;
+		m_timer_heap[index] = m_timer_heap[child];
+		m_timer_heap[index]->m_heap_index = index;
+		index = child;
+	}
+	m_timer_heap[index] = timer;
+	timer->m_heap_index = index;
+}
+
+
 //-------------------------------------------------
 //  execute_timers - execute timers that are due
 //-------------------------------------------------
 
 inline void device_scheduler::execute_timers()
 {
-	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_list->m_expire.as_string(PRECISION));
+	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), next_timer()->m_expire.as_string(PRECISION));
 
 	// now process any timers that are overdue
-	while (m_timer_list->m_expire <= m_basetime)
+	while (next_timer()->m_heap_expire <= m_basetick)
 	{
 		// if this is a one-shot timer, disable it now
-		emu_timer &timer = *m_timer_list;
+		emu_timer &timer = *next_timer();
 		bool was_enabled = timer.m_enabled;
 		if (timer.m_period.is_zero() || timer.m_period.is_never())
 			timer.m_enabled = false;
@@ -898,6 +1504,12 @@ inline void device_scheduler::execute_timers()
 		{
 			g_profiler.start(PROFILER_TIMER_CALLBACK);
 
+			if (UNEXPECTED(m_trace))
+			{
+				u16 const source = m_trace->name(timer.m_device ? timer.m_device->tag() : timer.m_callback.name());
+				m_trace->push(trace_recorder::TIMER, source, timer.m_expire, timer.m_id, timer.m_temporary ? 1 : 0);
+			}
+
 			if (!timer.m_callback.isnull())
 			{
 				if (timer.m_device != nullptr)
@@ -905,6 +1517,13 @@ inline void device_scheduler::execute_timers()
 				else
 					LOG("execute_timers: timer callback %s\n", timer.m_callback.name());
 				timer.m_callback(timer.m_ptr, timer.m_param);
+
+				// a device skipping an idle loop may just have been interrupted by one of its own peripherals
+				if (UNEXPECTED(m_idle_skipping != 0) && timer.m_device)
+				{
+					for (device_execute_interface *exec : m_execute_devices)
+						exec->idle_timer_fired(*timer.m_device);
+				}
 			}
 
 			g_profiler.stop();
@@ -915,7 +1534,7 @@ inline void device_scheduler::execute_timers()
 		{
 			// if the timer is temporary, remove it now
 			if (timer.m_temporary)
-				m_timer_allocator.reclaim(timer.release());
+				timer_pool_reclaim(timer.release());
 
 			// otherwise, reschedule it
 			else
@@ -973,6 +1592,291 @@ void device_scheduler::add_scheduling_quantum(const attotime &quantum, const att
 }
 
 
+//-------------------------------------------------
+//  current_quantum - return the duration of the
+//  quantum to use for the next timeslice
+//-------------------------------------------------
+
+inline attoseconds_t device_scheduler::current_quantum() const
+{
+	// only the base quantum is widened; boosted interleave is always honoured
+	quantum_slot const &quant = *m_quantum_list.first();
+	if (!m_adaptive_shift || !quant.m_expire.is_never())
+		return quant.m_actual;
+
+	// never widen past a 60Hz frame
+	attoseconds_t const limit = HZ_TO_ATTOSECONDS(60);
+	return (quant.m_actual >= (limit >> m_adaptive_shift)) ? std::max(quant.m_actual, limit) : (quant.m_actual << m_adaptive_shift);
+}
+
+
+//-------------------------------------------------
+//  update_adaptive_quantum - widen the quantum
+//  after a run of quanta without any interaction
+//  between devices, and go straight back to the
+//  base quantum as soon as there is one
+//-------------------------------------------------
+
+void device_scheduler::update_adaptive_quantum()
+{
+	// accumulate statistics, and dump them once per emulated second
+	attoseconds_t const quantum = current_quantum();
+	if (m_adaptive_stats_second != m_basetime.seconds())
+	{
+		dump_adaptive_quantum_stats();
+		m_adaptive_stats_second = m_basetime.seconds();
+	}
+	if (!m_adaptive_stats_quanta || (quantum < m_adaptive_stats_min))
+		m_adaptive_stats_min = quantum;
+	if (!m_adaptive_stats_quanta || (quantum > m_adaptive_stats_max))
+		m_adaptive_stats_max = quantum;
+	m_adaptive_stats_quanta++;
+	m_adaptive_stats_interactions += m_quantum_interactions;
+	m_adaptive_stats_histogram[m_adaptive_shift]++;
+
+	if (m_quantum_interactions)
+	{
+		m_adaptive_shift = 0;
+		m_quiet_quanta = 0;
+	}
+	else if ((++m_quiet_quanta >= ADAPTIVE_QUIET_QUANTA) && (m_adaptive_shift < ADAPTIVE_MAX_SHIFT))
+	{
+		m_adaptive_shift++;
+		m_quiet_quanta = 0;
+	}
+	m_quantum_interactions = 0;
+}
+
+
+//-------------------------------------------------
+//  dump_adaptive_quantum_stats - report how the
+//  quantum was widened over the last second
+//-------------------------------------------------
+
+void device_scheduler::dump_adaptive_quantum_stats()
+{
+	if (!m_adaptive_stats_quanta)
+		return;
+
+	std::ostringstream histogram;
+	for (u32 shift = 0; shift <= ADAPTIVE_MAX_SHIFT; shift++)
+		if (m_adaptive_stats_histogram[shift])
+			util::stream_format(histogram, " x%u:%u", 1U << shift, m_adaptive_stats_histogram[shift]);
+	osd_printf_verbose("Scheduler: second %d: %u quanta, %u interactions, quantum %.3f-%.3f us,%s\n",
+			m_adaptive_stats_second,
+			m_adaptive_stats_quanta,
+			m_adaptive_stats_interactions,
+			ATTOSECONDS_TO_DOUBLE(m_adaptive_stats_min) * 1e6,
+			ATTOSECONDS_TO_DOUBLE(m_adaptive_stats_max) * 1e6,
+			histogram.str());
+
+	m_adaptive_stats_quanta = 0;
+	m_adaptive_stats_interactions = 0;
+	std::fill(std::begin(m_adaptive_stats_histogram), std::end(m_adaptive_stats_histogram), 0);
+}
+
+
+//-------------------------------------------------
+//  dump_timer_pool_stats - report how heavily the
+//  timer pool was used, and by whom
+//-------------------------------------------------
+
+void device_scheduler::dump_timer_pool_stats() const
+{
+	const double seconds = m_basetime.as_double();
+	osd_printf_verbose("Scheduler: %u timers in %u slabs, peak %u live, %u allocations (%u temporary, %.1f/s)\n",
+			m_timer_pool_size,
+			m_timer_slabs.size(),
+			m_timers_peak,
+			m_timer_allocs,
+			m_temp_timer_allocs,
+			(seconds > 0.0) ? (double(m_temp_timer_allocs) / seconds) : 0.0);
+
+	// list the sources of temporary timers, busiest first
+	std::vector<std::pair<std::string, u64> > sources;
+	for (auto const &entry : m_device_temp_timers)
+		sources.emplace_back(entry.first->tag(), entry.second);
+	for (auto const &entry : m_callback_temp_timers)
+		sources.emplace_back(entry.first, entry.second);
+	std::sort(sources.begin(), sources.end(), [] (auto const &a, auto const &b) { return a.second > b.second; });
+	for (auto const &source : sources)
+		osd_printf_verbose("Scheduler:   %-40s %10u temporary timers (%.1f/s)\n",
+				source.first,
+				source.second,
+				(seconds > 0.0) ? (double(source.second) / seconds) : 0.0);
+}
+
+
+//-------------------------------------------------
+//  open_device_profile - start writing per-device
+//  statistics every frame if requested
+//-------------------------------------------------
+
+void device_scheduler::open_device_profile()
+{
+	const char *const filename = machine().options().device_profile();
+	if (!filename || !*filename)
+		return;
+
+	m_device_profile_file = std::make_unique<emu_file>(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	osd_file::error const filerr = m_device_profile_file->open(filename);
+	if (filerr != osd_file::error::NONE)
+	{
+		osd_printf_warning("Unable to open device profile file %s\n", filename);
+		m_device_profile_file.reset();
+		return;
+	}
+
+	m_device_profile = true;
+	m_count_timer_sources = true;
+	m_device_profile_json = core_filename_ends_with(filename, ".json");
+	m_device_profile_perf = machine().options().perf_counters() && osd_perf_counters_open();
+	if (m_device_profile_json)
+		m_device_profile_file->printf("{\n\t\"system\": \"%s\",\n\t\"frames\": [", machine().system().name);
+	else if (m_device_profile_perf)
+		m_device_profile_file->puts("frame,time,device,host_ns,cycles,eaten,timeslices,host_cycles,host_instructions,llc_misses,branch_misses\n");
+	else
+		m_device_profile_file->puts("frame,time,device,host_ns,cycles,eaten,timeslices\n");
+
+	machine().add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&device_scheduler::sample_device_profile, this));
+	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&device_scheduler::close_device_profile, this));
+}
+
+
+//-------------------------------------------------
+//  sample_device_profile - write out what each
+//  device did during the last frame and reset
+//  the counters
+//-------------------------------------------------
+
+void device_scheduler::sample_device_profile()
+{
+	const double ns_per_tick = 1.0e9 / double(osd_ticks_per_second());
+	const double now = m_basetime.as_double();
+
+	if (m_device_profile_json)
+		m_device_profile_file->printf("%s\n\t\t{ \"frame\": %u, \"time\": %.9f, \"devices\": [", m_device_profile_frames ? "," : "", m_device_profile_frames, now);
+
+	bool first = true;
+	for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+	{
+		const u64 host_ns = u64(double(exec.m_profile_ticks) * ns_per_tick);
+		if (m_device_profile_json)
+		{
+			m_device_profile_file->printf("%s\n\t\t\t{ \"device\": \"%s\", \"host_ns\": %u, \"cycles\": %u, \"eaten\": %u, \"timeslices\": %u",
+					first ? "" : ",",
+					exec.device().tag(),
+					host_ns,
+					exec.m_profile_cycles,
+					exec.m_profile_eaten,
+					exec.m_profile_timeslices);
+			if (m_device_profile_perf)
+			{
+				m_device_profile_file->printf(", \"host_cycles\": %u, \"host_instructions\": %u, \"llc_misses\": %u, \"branch_misses\": %u",
+						exec.m_profile_perf[OSD_PERF_CYCLES],
+						exec.m_profile_perf[OSD_PERF_INSTRUCTIONS],
+						exec.m_profile_perf[OSD_PERF_CACHE_MISSES],
+						exec.m_profile_perf[OSD_PERF_BRANCH_MISSES]);
+			}
+			m_device_profile_file->puts(" }");
+		}
+		else
+		{
+			m_device_profile_file->printf("%u,%.9f,%s,%u,%u,%u,%u",
+					m_device_profile_frames,
+					now,
+					exec.device().tag(),
+					host_ns,
+					exec.m_profile_cycles,
+					exec.m_profile_eaten,
+					exec.m_profile_timeslices);
+			if (m_device_profile_perf)
+			{
+				m_device_profile_file->printf(",%u,%u,%u,%u",
+						exec.m_profile_perf[OSD_PERF_CYCLES],
+						exec.m_profile_perf[OSD_PERF_INSTRUCTIONS],
+						exec.m_profile_perf[OSD_PERF_CACHE_MISSES],
+						exec.m_profile_perf[OSD_PERF_BRANCH_MISSES]);
+			}
+			m_device_profile_file->puts("\n");
+		}
+		first = false;
+
+		exec.m_profile_ticks = 0;
+		exec.m_profile_cycles = 0;
+		exec.m_profile_eaten = 0;
+		exec.m_profile_timeslices = 0;
+		std::fill(std::begin(exec.m_profile_perf), std::end(exec.m_profile_perf), 0);
+	}
+
+	if (m_device_profile_json)
+		m_device_profile_file->puts(" ] }");
+	m_device_profile_frames++;
+}
+
+
+//-------------------------------------------------
+//  close_device_profile - finish off the profile
+//  file at exit
+//-------------------------------------------------
+
+void device_scheduler::close_device_profile()
+{
+	if (m_device_profile_json)
+		m_device_profile_file->puts("\n\t]\n}\n");
+	m_device_profile_file.reset();
+	m_device_profile = false;
+	m_device_profile_perf = false;
+}
+
+
+//-------------------------------------------------
+//  open_trace - start recording a scheduler
+//  trace if requested
+//-------------------------------------------------
+
+void device_scheduler::open_trace()
+{
+	const char *const filename = machine().options().scheduler_trace();
+	if (!filename || !*filename)
+		return;
+
+	auto file = std::make_unique<emu_file>(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	osd_file::error const filerr = file->open(filename);
+	if (filerr != osd_file::error::NONE)
+	{
+		osd_printf_warning("Unable to open scheduler trace file %s\n", filename);
+		return;
+	}
+
+	m_trace = std::make_unique<trace_recorder>(std::move(file));
+	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&device_scheduler::close_trace, this));
+}
+
+
+//-------------------------------------------------
+//  close_trace - flush and close the scheduler
+//  trace at exit
+//-------------------------------------------------
+
+void device_scheduler::close_trace()
+{
+	m_trace.reset();
+}
+
+
+//-------------------------------------------------
+//  trace_synchronize - record a temporary timer
+//  being set, and who set it
+//-------------------------------------------------
+
+void device_scheduler::trace_synchronize(const char *target, const attotime &duration)
+{
+	u16 const origin = s_executing_device ? m_trace->name(s_executing_device->device().tag()) : trace_recorder::NO_NAME;
+	m_trace->push(trace_recorder::SYNCHRONIZE, origin, time(), m_trace->name(target), duration.is_zero() ? 1 : 0);
+}
+
+
 //-------------------------------------------------
 //  dump_timers - dump the current timer state
 //-------------------------------------------------
@@ -38,7 +38,6 @@ class emu_timer
 {
 	friend class device_scheduler;
 	friend class simple_list<emu_timer>;
-	friend class fixed_allocator<emu_timer>;
 	friend class resource_pool_object<emu_timer>;
 
 	// construction/destruction
@@ -83,8 +82,8 @@ private:
 
 	// internal state
 	running_machine *   m_machine;      // reference to the owning machine
-	emu_timer *         m_next;         // next timer in order in the list
-	emu_timer *         m_prev;         // previous timer in order in the list
+	emu_timer *         m_next;         // next timer in the list of all timers
+	emu_timer *         m_prev;         // previous timer in the list of all timers
 	timer_expired_delegate m_callback;  // callback function
 	s32                 m_param;        // integer parameter
 	void *              m_ptr;          // pointer parameter
@@ -95,6 +94,9 @@ private:
 	attotime            m_expire;       // time when the timer will expire
 	device_t *          m_device;       // for device timers, a pointer to the device
 	device_timer_id     m_id;           // for device timers, the ID of the timer
+	attotick_t          m_heap_expire;  // expiration time used for ordering in the scheduler's heap
+	u64                 m_heap_sequence; // order of insertion in the heap, used to break ties
+	u32                 m_heap_index;   // current position in the scheduler's heap
 };
 
 
@@ -114,7 +116,8 @@ public:
 	running_machine &machine() const noexcept { return m_machine; }
 	attotime time() const noexcept;
 	emu_timer *first_timer() const { return m_timer_list; }
-	device_execute_interface *currently_executing() const noexcept { return m_executing_device; }
+	device_execute_interface *currently_executing() const noexcept { return s_executing_device; }
+	bool outside_main_domain() const noexcept;
 	bool can_save() const;
 
 	// execution
@@ -133,8 +136,27 @@ public:
 	emu_timer *timer_alloc(device_t &device, device_timer_id id = 0, void *ptr = nullptr);
 	void timer_set(const attotime &duration, device_t &device, device_timer_id id = 0, int param = 0, void *ptr = nullptr);
 
+	// timer pool statistics
+	u32 timer_pool_size() const { return m_timer_pool_size; }
+	u32 timers_live() const { return m_timers_live; }
+	u32 timers_peak() const { return m_timers_peak; }
+	u64 timer_allocs() const { return m_timer_allocs; }
+	u64 temporary_timer_allocs() const { return m_temp_timer_allocs; }
+	const std::unordered_map<const device_t *, u64> &device_temporary_timers() const { return m_device_temp_timers; }
+	const std::unordered_map<std::string_view, u64> &callback_temporary_timers() const { return m_callback_temp_timers; }
+
+	// execute list statistics
+	u64 execute_list_rebuilds() const { return m_execute_list_rebuilds; }
+	u64 execute_list_updates() const { return m_execute_list_updates; }
+	u32 execute_list_updates_per_second() const;
+
+	// per-device profiling and tracing
+	void open_device_profile();
+	void open_trace();
+
 	// debugging
 	void dump_timers() const;
+	void dump_timer_pool_stats() const;
 
 	// for emergencies only!
 	void eat_all_cycles();
@@ -146,25 +168,78 @@ private:
 	void postload();
 
 	// scheduling helpers
+	void execute_device(device_execute_interface &exec, attotime &target, bool call_debugger, bool concurrent);
+	void execute_domains(attotime &target);
+	static void *execute_domain_callback(void *param, int threadid);
+	std::unique_lock<std::recursive_mutex> concurrent_guard() { return m_concurrent ? std::unique_lock<std::recursive_mutex>(m_concurrent_lock) : std::unique_lock<std::recursive_mutex>(); }
 	void compute_perfect_interleave();
+	enum : u8 { EXECUTE_ACTIVE, EXECUTE_EATING, EXECUTE_PARKED };
+	static u8 execute_class(const device_execute_interface &exec);
 	void rebuild_execute_list();
+	void update_execute_list(device_execute_interface &exec);
+	void rebuild_domain_lists();
 	void apply_suspend_changes();
 	void add_scheduling_quantum(const attotime &quantum, const attotime &duration);
+	attoseconds_t current_quantum() const;
+	void note_interaction() { m_quantum_interactions++; }
+	void update_adaptive_quantum();
+	void dump_adaptive_quantum_stats();
+
+	// profiling helpers
+	void sample_device_profile();
+	void close_device_profile();
+	void close_trace();
+	void trace_synchronize(const char *target, const attotime &duration);
 
 	// timer helpers
 	emu_timer &timer_list_insert(emu_timer &timer);
 	emu_timer &timer_list_remove(emu_timer &timer);
+	void timer_list_reorder(emu_timer &timer);
 	void execute_timers();
 
+	// timer pool helpers
+	emu_timer &timer_pool_alloc();
+	void timer_pool_reclaim(emu_timer &timer);
+
+	// timer heap helpers
+	emu_timer *next_timer() const { return m_timer_heap.front(); }
+	static bool timer_heap_before(const emu_timer &a, const emu_timer &b) { return (a.m_heap_expire < b.m_heap_expire) || ((a.m_heap_expire == b.m_heap_expire) && (a.m_heap_sequence < b.m_heap_sequence)); }
+	void timer_heap_push(emu_timer &timer);
+	void timer_heap_erase(emu_timer &timer);
+	void timer_heap_sift_up(u32 index);
+	void timer_heap_sift_down(u32 index);
+
 	// internal state
 	running_machine &           m_machine;                  // reference to our machine
-	device_execute_interface *  m_executing_device;         // pointer to currently executing device
 	device_execute_interface *  m_execute_list;             // list of devices to be executed
+	std::vector<device_execute_interface *> m_execute_devices; // all executing devices, parked or not
+	std::vector<device_execute_interface *> m_execute_changed; // devices to move in the execute list
+	u64                         m_execute_list_rebuilds;    // full rebuilds of the execute list
+	u64                         m_execute_list_updates;     // incremental updates to the execute list
+	seconds_t                   m_execute_stats_second;     // emulated second being counted
+	u32                         m_execute_stats_count;      // updates during that second
+	u32                         m_execute_stats_previous;   // updates during the second before it
+	u32                         m_idle_skipping;            // devices currently skipping an idle loop
 	attotime                    m_basetime;                 // global basetime; everything moves forward from here
+	attotick_t                  m_basetick;                 // global basetime as ticks, for quick comparisons
 
 	// list of active timers
-	emu_timer *                 m_timer_list;               // head of the active list
-	fixed_allocator<emu_timer>  m_timer_allocator;          // allocator for timers
+	emu_timer *                 m_timer_list;               // head of the list of all timers
+	std::vector<emu_timer *>    m_timer_heap;               // binary min-heap of timers ordered by expiration
+	u64                         m_timer_sequence;           // insertion counter for keeping equal expirations in order
+
+	// pool of timers, grown in slabs as the peak number of live timers increases
+	static constexpr u32 TIMER_SLAB_MINIMUM = 64;           // timers in the first slab
+	std::vector<emu_timer *>    m_timer_slabs;              // blocks of timers owned by the pool
+	emu_timer *                 m_timer_free;               // head of the list of unused timers
+	u32                         m_timer_pool_size;          // total timers across all slabs
+	u32                         m_timers_live;              // timers currently allocated
+	u32                         m_timers_peak;              // most timers allocated at once
+	u64                         m_timer_allocs;             // total timer allocations
+	u64                         m_temp_timer_allocs;        // temporary timer allocations
+	std::unordered_map<const device_t *, u64> m_device_temp_timers; // temporary timer allocations by device
+	bool                        m_count_timer_sources;      // count temporary timers by source, for -verbose and profiling
+	std::unordered_map<std::string_view, u64> m_callback_temp_timers; // temporary timer allocations by callback name
 
 	// other internal states
 	emu_timer *                 m_callback_timer;           // pointer to the current callback timer
@@ -188,6 +263,48 @@ private:
 	simple_list<quantum_slot>   m_quantum_list;             // list of active quanta
 	fixed_allocator<quantum_slot> m_quantum_allocator;      // allocator for quanta
 	attoseconds_t               m_quantum_minimum;          // duration of minimum quantum
+
+	// adaptive quantum widening
+	static constexpr u32 ADAPTIVE_MAX_SHIFT = 10;           // widen by at most 1024 times
+	static constexpr u32 ADAPTIVE_QUIET_QUANTA = 4;         // quiet quanta needed before widening further
+	bool                        m_adaptive_quantum;         // are we widening quanta when nothing interacts?
+	u32                         m_adaptive_shift;           // current widening factor, as a power of two
+	u32                         m_quiet_quanta;             // consecutive quanta without interactions
+	u32                         m_quantum_interactions;     // interactions between devices during this quantum
+	seconds_t                   m_adaptive_stats_second;    // emulated second the statistics cover
+	u64                         m_adaptive_stats_quanta;    // quanta executed this second
+	u64                         m_adaptive_stats_interactions; // interactions this second
+	attoseconds_t               m_adaptive_stats_min;       // smallest quantum used this second
+	attoseconds_t               m_adaptive_stats_max;       // largest quantum used this second
+	u32                         m_adaptive_stats_histogram[ADAPTIVE_MAX_SHIFT + 1]; // quanta executed at each widening factor
+
+	// per-device profiling
+	bool                        m_device_profile;           // true if we are accumulating per-device statistics
+	bool                        m_device_profile_json;      // true to write JSON rather than CSV
+	bool                        m_device_profile_perf;      // true to count host hardware events too
+	u64                         m_device_profile_frames;    // frames sampled so far
+	std::unique_ptr<emu_file>   m_device_profile_file;      // file receiving the samples
+
+	// scheduler trace for offline analysis
+	class trace_recorder;
+	std::unique_ptr<trace_recorder> m_trace;                // recorder, if -scheduler_trace is enabled
+
+	// concurrent execution domains
+	class execution_domain
+	{
+	public:
+		device_scheduler *                      m_scheduler;    // owning scheduler
+		int                                     m_id;           // configured domain number
+		std::vector<device_execute_interface *> m_devices;      // devices in this domain, in execution order
+		attotime                                m_target;       // target time for the current timeslice
+	};
+	std::vector<execution_domain> m_domains;                    // domains with devices in them
+	osd_work_queue *            m_domain_queue;             // work queue for running domains concurrently
+	bool                        m_concurrent;               // true while domains are executing concurrently
+	std::recursive_mutex        m_concurrent_lock;          // protects timers and triggers during concurrent execution
+
+	// pointer to the device currently executing on this thread
+	static thread_local device_execute_interface *s_executing_device;
 };
 
 
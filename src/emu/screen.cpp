@@ -548,6 +548,7 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_max_width(100)
 	, m_width(100)
 	, m_height(100)
+	, m_render_scale(1)
 	, m_visarea(0, 99, 0, 99)
 	, m_texformat()
 	, m_curbitmap(0)
@@ -569,6 +570,7 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_scanline_timer(nullptr)
 	, m_frame_number(0)
 	, m_partial_updates_this_frame(0)
+	, m_raster_frame(0)
 {
 	m_unique_id = m_id_counter;
 	m_id_counter++;
@@ -681,7 +683,11 @@ void screen_device::device_validity_check(validity_checker &valid) const
 	{
 		if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
 			osd_printf_error("Non-raster display cannot have a variable width\n");
+		if (m_video_attributes & VIDEO_SCALABLE)
+			osd_printf_error("Non-raster display cannot be scalable\n");
 	}
+	if ((m_video_attributes & VIDEO_SCALABLE) && (m_video_attributes & VIDEO_VARIABLE_WIDTH))
+		osd_printf_error("Variable width display cannot be scalable\n");
 
 	// check for zero frame rate
 	if (m_refresh == 0)
@@ -807,6 +813,10 @@ void screen_device::device_start()
 		}
 	}
 
+	// scalable screens render everything screen-sized at the chosen multiple
+	if (m_video_attributes & VIDEO_SCALABLE)
+		m_render_scale = std::clamp(machine().options().render_scale(), 1, 8);
+
 	// configure bitmap formats and allocate screen bitmaps
 	// svg is RGB32 too, and doesn't have any update method
 	const bool screen16 = !m_screen_update_ind16.isnull();
@@ -1105,8 +1115,19 @@ void screen_device::realloc_screen_bitmaps()
 
 	// determine effective size to allocate
 	const bool per_scanline = (m_video_attributes & VIDEO_VARIABLE_WIDTH);
-	s32 effwidth = std::max(per_scanline ? m_max_width : m_width, m_visarea.right() + 1);
-	s32 effheight = std::max(m_height, m_visarea.bottom() + 1);
+	s32 effwidth = std::max(per_scanline ? m_max_width : m_width, m_visarea.right() + 1) * m_render_scale;
+	s32 effheight = std::max(m_height, m_visarea.bottom() + 1) * m_render_scale;
+
+	// OSD renderers may be handed the screen bitmaps' memory by reference and
+	// still be reading it for a frame in flight, so rather than letting the
+	// resize below free it, move outgrown storage aside for a few frames
+	for (auto &bitmap : m_bitmap)
+		if (bitmap.valid() && (effwidth > bitmap.width() || effheight > bitmap.height()))
+		{
+			m_retired_bitmaps.emplace_back();
+			m_retired_bitmaps.back().m_frame = m_frame_number;
+			bitmap.reallocate(effwidth, effheight, m_retired_bitmaps.back().m_ind16, m_retired_bitmaps.back().m_rgb32);
+		}
 
 	// reize all registered screen bitmaps
 	for (auto &item : m_auto_bitmap_list)
@@ -1118,13 +1139,43 @@ void screen_device::realloc_screen_bitmaps()
 		m_bitmap[0].set_palette(m_palette->palette());
 		m_bitmap[1].set_palette(m_palette->palette());
 	}
-	m_texture[0]->set_bitmap(m_bitmap[0], m_visarea, m_bitmap[0].texformat());
-	m_texture[1]->set_bitmap(m_bitmap[1], m_visarea, m_bitmap[1].texformat());
+	m_texture[0]->set_bitmap(m_bitmap[0], scale_rect(m_visarea), m_bitmap[0].texformat());
+	m_texture[1]->set_bitmap(m_bitmap[1], scale_rect(m_visarea), m_bitmap[1].texformat());
 
 	allocate_scan_bitmaps();
 }
 
 
+//-------------------------------------------------
+//  scale_rect - convert a rectangle in screen
+//  pixels to one in screen bitmap pixels
+//-------------------------------------------------
+
+rectangle screen_device::scale_rect(const rectangle &rect) const
+{
+	if (m_render_scale == 1)
+		return rect;
+	return rectangle(
+			rect.left() * m_render_scale, ((rect.right() + 1) * m_render_scale) - 1,
+			rect.top() * m_render_scale, ((rect.bottom() + 1) * m_render_scale) - 1);
+}
+
+
+//-------------------------------------------------
+//  release_retired_bitmaps - free outgrown screen
+//  bitmaps once no OSD frame can refer to them
+//-------------------------------------------------
+
+void screen_device::release_retired_bitmaps()
+{
+	auto const expired = std::find_if(
+			m_retired_bitmaps.begin(),
+			m_retired_bitmaps.end(),
+			[this] (retired_bitmap const &retired) { return (m_frame_number - retired.m_frame) < 3; });
+	m_retired_bitmaps.erase(m_retired_bitmaps.begin(), expired);
+}
+
+
 //-------------------------------------------------
 //  pre_update_scanline - check if the bitmap for
 //  a specific scanline needs its size updated
@@ -1226,8 +1277,8 @@ bool screen_device::update_partial(int scanline)
 			switch (curbitmap.format())
 			{
 				default:
-				case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-				case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
+				case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), scale_rect(clip));   break;
+				case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), scale_rect(clip));   break;
 			}
 		}
 		else
@@ -1328,8 +1379,8 @@ void screen_device::update_now()
 					switch (curbitmap.format())
 					{
 						default:
-						case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-						case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
+						case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), scale_rect(clip));   break;
+						case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), scale_rect(clip));   break;
 					}
 				}
 
@@ -1381,8 +1432,8 @@ void screen_device::update_now()
 			switch (curbitmap.format())
 			{
 				default:
-				case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-				case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
+				case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), scale_rect(clip));   break;
+				case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), scale_rect(clip));   break;
 			}
 		}
 
@@ -1409,6 +1460,7 @@ void screen_device::reset_partial_updates()
 	m_last_partial_scan = 0;
 	m_partial_scan_hpos = -1;
 	m_partial_updates_this_frame = 0;
+	m_raster_frame++;
 	m_scanline0_timer->adjust(time_until_pos(0));
 }
 
@@ -1424,6 +1476,10 @@ u32 screen_device::pixel(s32 x, s32 y)
 	if (!curbitmap.valid())
 		return 0;
 
+	// scalable screens are sampled at the top left of each screen pixel
+	x *= m_render_scale;
+	y *= m_render_scale;
+
 	const int srcwidth = curbitmap.width();
 	const int srcheight = curbitmap.height();
 
@@ -1483,10 +1539,10 @@ void screen_device::pixels(u32 *buffer)
 			for (int y = visarea.min_y; y <= visarea.max_y; y++)
 			{
 				bitmap_ind16 &srcbitmap = per_scanline ? *(bitmap_ind16 *)m_scan_bitmaps[m_curbitmap][y] : curbitmap.as_ind16();
-				const u16 *src = &srcbitmap.pix(per_scanline ? 0 : y, visarea.min_x);
-				for (int x = visarea.min_x; x <= visarea.max_x; x++)
+				const u16 *src = &srcbitmap.pix(per_scanline ? 0 : (y * m_render_scale), visarea.min_x * m_render_scale);
+				for (int x = visarea.min_x; x <= visarea.max_x; x++, src += m_render_scale)
 				{
-					*buffer++ = palette[*src++];
+					*buffer++ = palette[*src];
 				}
 			}
 			break;
@@ -1497,10 +1553,10 @@ void screen_device::pixels(u32 *buffer)
 			for (int y = visarea.min_y; y <= visarea.max_y; y++)
 			{
 				bitmap_rgb32 &srcbitmap = per_scanline ? *(bitmap_rgb32 *)m_scan_bitmaps[m_curbitmap][y] : curbitmap.as_rgb32();
-				const u32 *src = &srcbitmap.pix(per_scanline ? 0 : y, visarea.min_x);
-				for (int x = visarea.min_x; x <= visarea.max_x; x++)
+				const u32 *src = &srcbitmap.pix(per_scanline ? 0 : (y * m_render_scale), visarea.min_x * m_render_scale);
+				for (int x = visarea.min_x; x <= visarea.max_x; x++, src += m_render_scale)
 				{
-					*buffer++ = *src++;
+					*buffer++ = *src;
 				}
 			}
 			break;
@@ -1624,6 +1680,24 @@ void screen_device::register_vblank_callback(vblank_state_delegate vblank_callba
 }
 
 
+//-------------------------------------------------
+//  bitmap_bytes - bytes allocated for the screen
+//  bitmaps and the bitmaps that track them
+//-------------------------------------------------
+
+size_t screen_device::bitmap_bytes() const
+{
+	size_t bytes = m_bitmap[0].allocated_bytes() + m_bitmap[1].allocated_bytes();
+	bytes += m_priority.allocated_bytes() + m_burnin.allocated_bytes() + m_screen_overlay_bitmap.allocated_bytes();
+	for (auto const &list : m_scan_bitmaps)
+		for (bitmap_t const *bitmap : list)
+			bytes += bitmap->allocated_bytes();
+	for (auto const &item : m_auto_bitmap_list)
+		bytes += item->m_bitmap.allocated_bytes();
+	return bytes;
+}
+
+
 //-------------------------------------------------
 //  register_screen_bitmap - registers a bitmap
 //  that should track the screen size
@@ -1690,6 +1764,8 @@ void screen_device::vblank_end()
 
 	// increment the frame number counter
 	m_frame_number++;
+	if (!m_retired_bitmaps.empty())
+		release_retired_bitmaps();
 }
 
 
@@ -68,6 +68,10 @@ constexpr u32 UPDATE_HAS_NOT_CHANGED = 0x0001;   // the video has not changed
  @def VIDEO_VARIABLE_WIDTH
  causes the screen to construct its final bitmap from a composite upscale of individual scanline bitmaps
 
+ @def VIDEO_SCALABLE
+ screen update can render at the internal resolution multiplier chosen with -render_scale: the screen
+ bitmaps and the cliprect passed to it are scaled up by render_scale(), while the visible area stays native
+
  @}
  */
 
@@ -78,6 +82,7 @@ constexpr u32 VIDEO_SELF_RENDER             = 0x0008;
 constexpr u32 VIDEO_ALWAYS_UPDATE           = 0x0080;
 constexpr u32 VIDEO_UPDATE_SCANLINE         = 0x0100;
 constexpr u32 VIDEO_VARIABLE_WIDTH          = 0x0200;
+constexpr u32 VIDEO_SCALABLE                = 0x0400;
 
 
 //**************************************************************************
@@ -115,6 +120,18 @@ public:
 
 	// resizing
 	void resize(int width, int height) { live().resize(width, height); }
+	void reallocate(int width, int height, bitmap_ind16 &old_ind16, bitmap_rgb32 &old_rgb32)
+	{
+		// swap in fresh storage and hand back the old for deferred release
+		palette_t *const palette = live().palette();
+		switch (m_format)
+		{
+			case BITMAP_FORMAT_IND16:   old_ind16 = std::move(m_ind16);  m_ind16 = bitmap_ind16(width, height);  break;
+			case BITMAP_FORMAT_RGB32:   old_rgb32 = std::move(m_rgb32);  m_rgb32 = bitmap_rgb32(width, height);  break;
+			default:                    break;
+		}
+		live().set_palette(palette);
+	}
 
 	// conversion
 	operator bitmap_t &() { return live(); }
@@ -132,6 +149,7 @@ public:
 	bool valid() const { return live().valid(); }
 	palette_t *palette() const { return live().palette(); }
 	const rectangle &cliprect() const { return live().cliprect(); }
+	size_t allocated_bytes() const { return size_t(m_ind16.allocated_bytes()) + m_rgb32.allocated_bytes(); }
 
 	// operations
 	void set_palette(palette_t *palette) { live().set_palette(palette); }
@@ -197,6 +215,8 @@ public:
 	int width() const { return m_width; }
 	int height() const { return m_height; }
 	const rectangle &visible_area() const { return m_visarea; }
+	u32 video_attributes() const { return m_video_attributes; }
+	int render_scale() const { return m_render_scale; }
 	const rectangle &cliprect() const { return m_bitmap[0].cliprect(); }
 	bool oldstyle_vblank_supplied() const { return m_oldstyle_vblank_supplied; }
 	attoseconds_t refresh_attoseconds() const { return m_refresh; }
@@ -379,6 +399,7 @@ public:
 	device_palette_interface &palette() const { assert(m_palette != nullptr); return *m_palette; }
 	bool has_palette() const { return m_palette != nullptr; }
 	screen_bitmap &curbitmap() { return m_bitmap[m_curtexture]; }
+	size_t bitmap_bytes() const;
 
 	// dynamic configuration
 	void configure(int width, int height, const rectangle &visarea, attoseconds_t frame_period);
@@ -412,6 +433,18 @@ public:
 	bool update_partial(int scanline);
 	void update_now();
 	void reset_partial_updates();
+	u64 raster_frame() const { return m_raster_frame; }
+
+	// change a piece of raster-relevant state, forcing a partial update
+	// only if the value actually differs from what was drawn so far
+	template <typename T, typename U> bool update_partial_on_change(T &state, U &&value)
+	{
+		if (state == value)
+			return false;
+		update_partial(vpos());
+		state = std::forward<U>(value);
+		return true;
+	}
 
 	// additional helpers
 	void register_vblank_callback(vblank_state_delegate vblank_callback);
@@ -450,6 +483,8 @@ private:
 	// internal helpers
 	void set_container(render_container &container) { m_container = &container; }
 	void realloc_screen_bitmaps();
+	void release_retired_bitmaps();
+	rectangle scale_rect(const rectangle &rect) const;
 	void vblank_begin();
 	void vblank_end();
 	void finalize_burnin();
@@ -477,6 +512,14 @@ private:
 	u32                 m_video_attributes;         // flags describing the video system
 	optional_memory_region m_svg_region;            // the region in which the svg data is in
 
+	// screen bitmap storage kept alive past a resize
+	struct retired_bitmap
+	{
+		u64                         m_frame;
+		bitmap_ind16                m_ind16;
+		bitmap_rgb32                m_rgb32;
+	};
+
 	// internal state
 	render_container *  m_container;                // pointer to our container
 	std::unique_ptr<svg_renderer> m_svg; // the svg renderer
@@ -484,6 +527,7 @@ private:
 	int                 m_max_width;                // maximum width encountered
 	int                 m_width;                    // current width (HTOTAL)
 	int                 m_height;                   // current height (VTOTAL)
+	int                 m_render_scale;             // internal resolution multiplier for VIDEO_SCALABLE
 	rectangle           m_visarea;                  // current visible area (HBLANK end/start, VBLANK end/start)
 	std::vector<int>    m_scan_widths;              // current width, in samples, of each individual scanline
 
@@ -492,6 +536,7 @@ private:
 	render_texture *    m_texture[2];               // 2x textures for the screen bitmap
 	screen_bitmap       m_bitmap[2];                // 2x bitmaps for rendering
 	std::vector<bitmap_t *> m_scan_bitmaps[2];      // 2x bitmaps for each individual scanline
+	std::vector<retired_bitmap> m_retired_bitmaps;  // outgrown bitmaps the OSD may still reference
 	bitmap_ind8         m_priority;                 // priority bitmap
 	bitmap_ind64        m_burnin;                   // burn-in bitmap
 	u8                  m_curbitmap;                // current bitmap index
@@ -517,6 +562,7 @@ private:
 	emu_timer *         m_scanline_timer;           // scanline timer
 	u64                 m_frame_number;             // the current frame number
 	u32                 m_partial_updates_this_frame;// partial update counter this frame
+	u64                 m_raster_frame;             // incremented each time partial updates are reset
 
 	bool                m_is_primary_screen;
 
@@ -549,6 +595,108 @@ private:
 // device type definition
 DECLARE_DEVICE_TYPE(SCREEN, screen_device)
 
+
+// ======================> screen_raster_log
+
+// Records the values a piece of raster-relevant state takes over the course
+// of a frame, tagged with the first scanline each applies to. Drivers call
+// set() from their register write handlers instead of update_partial(), and
+// then draw the whole frame in one pass from their screen update callback,
+// using for_each_span() to get each run of lines that shares a value.
+// Writes that don't change the value are coalesced away, and the log starts
+// over from the last value once the screen begins a new frame.
+template <typename T>
+class screen_raster_log
+{
+public:
+	screen_raster_log(screen_device &screen, T const &initial = T())
+		: m_screen(screen)
+		, m_frame(screen.raster_frame())
+		, m_spans(1, span{ 0, initial })
+	{
+	}
+
+	// record a value taking effect on the line after the beam position
+	void set(T const &value)
+	{
+		sync();
+		int const vpos = m_screen.vpos();
+
+		// in VBLANK after this frame has been drawn, the value applies to all of the next one
+		if (vpos > m_screen.visible_area().bottom() && !(m_screen.video_attributes() & VIDEO_UPDATE_AFTER_VBLANK))
+		{
+			m_spans.assign(1, span{ 0, value });
+			return;
+		}
+
+		// replace a value set earlier on the same line, dropping it if it's now redundant
+		int const line = vpos + 1;
+		if (m_spans.back().start >= line)
+		{
+			m_spans.back().value = value;
+			if (m_spans.size() > 1 && m_spans[m_spans.size() - 2].value == value)
+				m_spans.pop_back();
+		}
+		else if (!(m_spans.back().value == value))
+		{
+			m_spans.push_back(span{ line, value });
+		}
+	}
+
+	// value in effect on the given scanline
+	T const &at(int scanline)
+	{
+		sync();
+		auto it = std::upper_bound(m_spans.begin(), m_spans.end(), scanline, [] (int line, span const &s) { return line < s.start; });
+		return std::prev(it)->value;
+	}
+
+	// most recently set value
+	T const &current() { sync(); return m_spans.back().value; }
+
+	// call func(clip, value) for each run of lines within cliprect sharing a value
+	template <typename F> void for_each_span(rectangle const &cliprect, F &&func)
+	{
+		sync();
+		for (size_t i = 0; i < m_spans.size(); i++)
+		{
+			int const top = std::max(cliprect.top(), m_spans[i].start);
+			int const bottom = std::min(cliprect.bottom(), (i + 1 < m_spans.size()) ? (m_spans[i + 1].start - 1) : cliprect.bottom());
+			if (top <= bottom)
+			{
+				rectangle clip(cliprect);
+				clip.sety(top, bottom);
+				func(clip, m_spans[i].value);
+			}
+		}
+	}
+
+private:
+	struct span
+	{
+		int start;      // first scanline this value applies to
+		T value;        // the value
+	};
+
+	// collapse to the final value once the screen has moved on to a new frame
+	void sync()
+	{
+		if (m_frame != m_screen.raster_frame())
+		{
+			m_frame = m_screen.raster_frame();
+			if (m_spans.size() > 1)
+			{
+				m_spans.front().value = std::move(m_spans.back().value);
+				m_spans.resize(1);
+			}
+		}
+	}
+
+	screen_device &     m_screen;
+	u64                 m_frame;
+	std::vector<span>   m_spans;
+};
+
 // iterator helper
 typedef device_type_enumerator<screen_device> screen_device_enumerator;
 
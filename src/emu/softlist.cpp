@@ -832,6 +832,229 @@ void softlist_parser::parse_soft_end(const char *tagname)
 }
 
 
+//**************************************************************************
+//  SOFTWARE LIST CACHE
+//**************************************************************************
+
+namespace {
+
+// bump this whenever the layout of the cache changes
+constexpr char SOFTLIST_CACHE_MAGIC[8] = { 'M', 'S', 'W', 'L', 'I', 'S', 'T', '1' };
+
+} // anonymous namespace
+
+
+// little-endian integers and length-prefixed strings
+class softlist_cache::writer
+{
+public:
+	std::vector<u8> &data() { return m_data; }
+
+	void u32le(u32 value)
+	{
+		for (int i = 0; 4 > i; ++i)
+			m_data.push_back(u8(value >> (i * 8)));
+	}
+
+	void u64le(u64 value)
+	{
+		u32le(u32(value));
+		u32le(u32(value >> 32));
+	}
+
+	void string(std::string_view value)
+	{
+		u32le(value.length());
+		m_data.insert(m_data.end(), value.begin(), value.end());
+	}
+
+	void features(const std::list<feature_list_item> &list)
+	{
+		u32le(list.size());
+		for (const feature_list_item &item : list)
+		{
+			string(item.name());
+			string(item.value());
+		}
+	}
+
+private:
+	std::vector<u8> m_data;
+};
+
+
+// reads back what the writer produced, failing on anything out of bounds
+class softlist_cache::reader
+{
+public:
+	reader(const std::vector<u8> &data) : m_data(data), m_position(0), m_ok(true) { }
+
+	bool ok() const { return m_ok; }
+	bool done() const { return m_data.size() == m_position; }
+
+	bool check(void const *expected, std::size_t length)
+	{
+		if (!need(length) || std::memcmp(&m_data[m_position], expected, length))
+			return m_ok = false;
+		m_position += length;
+		return true;
+	}
+
+	u32 u32le()
+	{
+		if (!need(4))
+			return 0;
+		u32 result = 0;
+		for (int i = 0; 4 > i; ++i)
+			result |= u32(m_data[m_position++]) << (i * 8);
+		return result;
+	}
+
+	u64 u64le()
+	{
+		u64 const low = u32le();
+		return low | (u64(u32le()) << 32);
+	}
+
+	std::string string()
+	{
+		u32 const length = u32le();
+		if (!need(length))
+			return std::string();
+		std::string result(reinterpret_cast<char const *>(&m_data[m_position]), length);
+		m_position += length;
+		return result;
+	}
+
+	void features(std::list<feature_list_item> &list)
+	{
+		for (u32 count = u32le(); m_ok && count; --count)
+		{
+			std::string name = string();
+			std::string value = string();
+			list.emplace_back(std::move(name), std::move(value));
+		}
+	}
+
+private:
+	bool need(std::size_t length)
+	{
+		if (m_ok && ((m_data.size() - m_position) < length))
+			m_ok = false;
+		return m_ok;
+	}
+
+	const std::vector<u8> &m_data;
+	std::size_t m_position;
+	bool m_ok;
+};
+
+
+//-------------------------------------------------
+//  build - serialise a parsed software list
+//-------------------------------------------------
+
+std::vector<u8> softlist_cache::build(std::string_view source, u64 size, s64 modified, const std::string &description, const std::list<software_info> &infolist, const std::string &errors)
+{
+	writer out;
+	out.data().assign(std::begin(SOFTLIST_CACHE_MAGIC), std::end(SOFTLIST_CACHE_MAGIC));
+	out.string(source);
+	out.u64le(size);
+	out.u64le(u64(modified));
+	out.string(description);
+	out.string(errors);
+
+	out.u32le(infolist.size());
+	for (const software_info &info : infolist)
+	{
+		out.string(info.m_shortname);
+		out.string(info.m_longname);
+		out.string(info.m_parentname);
+		out.string(info.m_year);
+		out.string(info.m_publisher);
+		out.u32le(info.m_supported);
+		out.features(info.m_other_info);
+		out.features(info.m_shared_info);
+
+		out.u32le(info.m_partdata.size());
+		for (const software_part &part : info.m_partdata)
+		{
+			out.string(part.m_name);
+			out.string(part.m_interface);
+			out.features(part.m_featurelist);
+			out.u32le(part.m_romdata.size());
+			for (const rom_entry &entry : part.m_romdata)
+			{
+				out.string(entry.name());
+				out.string(entry.hashdata());
+				out.u32le(entry.get_offset());
+				out.u32le(entry.get_length());
+				out.u32le(entry.get_flags());
+			}
+		}
+	}
+
+	return std::move(out.data());
+}
+
+
+//-------------------------------------------------
+//  restore - rebuild a software list from a
+//  cache image if it matches the source file
+//-------------------------------------------------
+
+bool softlist_cache::restore(const std::vector<u8> &image, std::string_view source, u64 size, s64 modified, std::string &description, std::list<software_info> &infolist, std::string &errors)
+{
+	reader in(image);
+	if (!in.check(SOFTLIST_CACHE_MAGIC, sizeof(SOFTLIST_CACHE_MAGIC)))
+		return false;
+	if ((in.string() != source) || (in.u64le() != size) || (in.u64le() != u64(modified)) || !in.ok())
+		return false;
+
+	std::string newdescription = in.string();
+	std::string newerrors = in.string();
+	std::list<software_info> newlist;
+	for (u32 infocount = in.u32le(); in.ok() && infocount; --infocount)
+	{
+		std::string shortname = in.string();
+		std::string longname = in.string();
+		std::string parentname = in.string();
+		software_info &info = newlist.emplace_back(std::move(shortname), std::move(parentname), "yes");
+		info.m_longname = std::move(longname);
+		info.m_year = in.string();
+		info.m_publisher = in.string();
+		info.m_supported = in.u32le();
+		in.features(info.m_other_info);
+		in.features(info.m_shared_info);
+
+		for (u32 partcount = in.u32le(); in.ok() && partcount; --partcount)
+		{
+			std::string name = in.string();
+			std::string interface = in.string();
+			software_part &part = info.m_partdata.emplace_back(info, std::move(name), std::move(interface));
+			in.features(part.m_featurelist);
+			u32 const romcount = in.u32le();
+			for (u32 romindex = 0; in.ok() && (romcount > romindex); ++romindex)
+			{
+				std::string romname = in.string();
+				std::string hashdata = in.string();
+				u32 const offset = in.u32le();
+				u32 const length = in.u32le();
+				u32 const flags = in.u32le();
+				part.m_romdata.emplace_back(std::move(romname), std::move(hashdata), offset, length, flags);
+			}
+		}
+	}
+	if (!in.ok() || !in.done())
+		return false;
+
+	description = std::move(newdescription);
+	errors = std::move(newerrors);
+	infolist = std::move(newlist);
+	return true;
+}
+
+
 //-------------------------------------------------
 //  software_name_parse - helper that splits a
 //  software identifier (software_list:software:part)
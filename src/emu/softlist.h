@@ -19,6 +19,8 @@
 #include "corefile.h"
 
 #include <list>
+#include <string_view>
+#include <vector>
 
 
 //**************************************************************************
@@ -67,6 +69,7 @@ private:
 class software_part
 {
 	friend class softlist_parser;
+	friend class softlist_cache;
 
 public:
 	// construction/destruction
@@ -105,6 +108,7 @@ private:
 class software_info
 {
 	friend class softlist_parser;
+	friend class softlist_cache;
 
 public:
 	// construction/destruction
@@ -207,6 +211,25 @@ private:
 };
 
 
+// ======================> softlist_cache
+
+// compact binary copy of a parsed software list, so an unchanged list
+// needn't be parsed again
+class softlist_cache
+{
+public:
+	// serialise a parsed list, tagged with the size and modification time of its source
+	static std::vector<u8> build(std::string_view source, u64 size, s64 modified, const std::string &description, const std::list<software_info> &infolist, const std::string &errors);
+
+	// rebuild a list from a cache image; returns false if it's stale or damaged
+	static bool restore(const std::vector<u8> &image, std::string_view source, u64 size, s64 modified, std::string &description, std::list<software_info> &infolist, std::string &errors);
+
+private:
+	class writer;
+	class reader;
+};
+
+
 // ----- Helpers -----
 
 // parses a software identifier (e.g. - 'apple2e:agentusa:flop1') into its constituent parts (returns false if cannot parse)
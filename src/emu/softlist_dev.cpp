@@ -90,6 +90,7 @@ software_list_device::software_list_device(const machine_config &mconfig, const
 	m_filter(nullptr),
 	m_parsed(false),
 	m_file(mconfig.options().hash_path(), OPEN_FLAG_READ),
+	m_cache_path(mconfig.options().softlist_cache_directory()),
 	m_description("")
 {
 }
@@ -289,11 +290,18 @@ void software_list_device::parse()
 	const osd_file::error filerr = m_file.open(m_list_name + ".xml");
 	if (filerr == osd_file::error::NONE)
 	{
-		// parse if no error
-		std::ostringstream errs;
-		softlist_parser parser(m_file, m_file.filename(), m_description, m_infolist, errs);
+		// an unchanged list can be restored from the cache instead
+		std::unique_ptr<osd::directory::entry> const source(!m_cache_path.empty() ? osd_stat(m_file.fullpath()) : nullptr);
+		if (!source || !load_cache(*source))
+		{
+			// parse if no error
+			std::ostringstream errs;
+			softlist_parser parser(m_file, m_file.filename(), m_description, m_infolist, errs);
+			m_errors = errs.str();
+			if (source)
+				save_cache(*source);
+		}
 		m_file.close();
-		m_errors = errs.str();
 	}
 	else
 		m_errors = string_format("Error opening file: %s\n", filename());
@@ -303,6 +311,47 @@ void software_list_device::parse()
 }
 
 
+//-------------------------------------------------
+//  load_cache - restore the parsed list from the
+//  cache if it was made from this version of
+//  the file
+//-------------------------------------------------
+
+bool software_list_device::load_cache(const osd::directory::entry &source)
+{
+	emu_file file(m_cache_path, OPEN_FLAG_READ);
+	if (file.open(m_list_name + ".swc") != osd_file::error::NONE)
+		return false;
+
+	std::vector<u8> image(file.size());
+	if (image.empty() || (file.read(&image[0], image.size()) != image.size()))
+		return false;
+
+	s64 const modified = source.last_modified.time_since_epoch().count();
+	if (!softlist_cache::restore(image, m_file.fullpath(), source.size, modified, m_description, m_infolist, m_errors))
+		return false;
+
+	osd_printf_verbose("Restored %s from cache\n", m_file.fullpath());
+	return true;
+}
+
+
+//-------------------------------------------------
+//  save_cache - save the parsed list so later
+//  runs can skip parsing it
+//-------------------------------------------------
+
+void software_list_device::save_cache(const osd::directory::entry &source)
+{
+	s64 const modified = source.last_modified.time_since_epoch().count();
+	std::vector<u8> const image(softlist_cache::build(m_file.fullpath(), source.size, modified, m_description, m_infolist, m_errors));
+
+	emu_file file(m_cache_path, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(m_list_name + ".swc") == osd_file::error::NONE)
+		file.write(&image[0], image.size());
+}
+
+
 //-------------------------------------------------
 //  is_compatible - determine if we are compatible
 //  with the given software_list_device
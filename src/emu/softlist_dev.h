@@ -143,6 +143,8 @@ protected:
 private:
 	// internal helpers
 	void parse();
+	bool load_cache(const osd::directory::entry &source);
+	void save_cache(const osd::directory::entry &source);
 	void internal_validity_check(validity_checker &valid) ATTR_COLD;
 
 	// configuration state
@@ -153,6 +155,7 @@ private:
 	// internal state
 	bool                        m_parsed;
 	emu_file                    m_file;
+	std::string                 m_cache_path;
 	std::string                 m_description;
 	std::string                 m_errors;
 	std::list<software_info>    m_infolist;
@@ -14,6 +14,7 @@
 #include "osdepend.h"
 #include "config.h"
 #include "wavwrite.h"
+#include "flac.h"
 
 
 
@@ -39,7 +40,6 @@
 //  GLOBAL VARIABLES
 //**************************************************************************
 
-const attotime sound_manager::STREAMS_UPDATE_ATTOTIME = attotime::from_hz(STREAMS_UPDATE_FREQUENCY);
 
 
 
@@ -380,7 +380,7 @@ void sound_stream_output::init(sound_stream &stream, u32 index, char const *tag)
 	for (int index = 0; index < filename.size(); index++)
 		if (filename[index] == ':')
 			filename[index] = '_';
-	if (dynamic_cast<default_resampler_stream *>(&stream) != nullptr)
+	if (dynamic_cast<default_resampler_stream *>(&stream) != nullptr || dynamic_cast<polyphase_resampler_stream *>(&stream) != nullptr)
 		filename += "_resampler";
 	filename += "_OUT_";
 	char buf[10];
@@ -565,7 +565,11 @@ sound_stream::sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output
 	m_empty_buffer(100),
 	m_output_base(output_base),
 	m_output(outputs),
-	m_output_view(outputs)
+	m_output_view(outputs),
+	m_defer_writes(!m_synchronous && device.machine().options().defer_sound_writes()),
+	m_applying_writes(false),
+	m_update_ticks(0),
+	m_update_time(0.0)
 {
 	sound_assert(outputs > 0);
 
@@ -579,6 +583,7 @@ sound_stream::sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output
 	std::string state_tag = string_format("%d", m_device.machine().sound().unique_id());
 	auto &save = m_device.machine().save();
 	save.save_item(&m_device, "stream.sample_rate", state_tag.c_str(), 0, NAME(m_sample_rate));
+	save.register_presave(save_prepost_delegate(FUNC(sound_stream::presave), this));
 	save.register_postload(save_prepost_delegate(FUNC(sound_stream::postload), this));
 
 	// initialize all inputs
@@ -588,7 +593,10 @@ sound_stream::sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output
 		sound_stream_output *resampler = nullptr;
 		if (!m_resampling_disabled)
 		{
-			m_resampler_list.push_back(std::make_unique<default_resampler_stream>(m_device));
+			if (m_device.machine().options().polyphase_resampler())
+				m_resampler_list.push_back(std::make_unique<polyphase_resampler_stream>(m_device));
+			else
+				m_resampler_list.push_back(std::make_unique<default_resampler_stream>(m_device));
 			resampler = &m_resampler_list.back()->m_output[0];
 		}
 
@@ -629,6 +637,20 @@ sound_stream::~sound_stream()
 }
 
 
+//-------------------------------------------------
+//  buffer_bytes - bytes allocated for the output
+//  buffers
+//-------------------------------------------------
+
+size_t sound_stream::buffer_bytes() const
+{
+	size_t bytes = 0;
+	for (auto const &output : m_output)
+		bytes += output.buffer_bytes();
+	return bytes;
+}
+
+
 //-------------------------------------------------
 //  set_sample_rate - set the sample rate on a
 //  given stream
@@ -662,6 +684,7 @@ void sound_stream::set_input(int index, sound_stream *input_stream, int output_i
 	// wire it up
 	m_input[index].set_source((input_stream != nullptr) ? &input_stream->m_output[output_index] : nullptr);
 	m_input[index].set_gain(gain);
+	m_device.machine().sound().m_stream_groups_dirty = true;
 
 	// update sample rates now that we know the input
 	sample_rate_changed();
@@ -675,17 +698,73 @@ void sound_stream::set_input(int index, sound_stream *input_stream, int output_i
 
 void sound_stream::update()
 {
+	// stream state isn't synchronised, so other execution domains can't touch it
+	if (m_device.machine().scheduler().outside_main_domain())
+		throw emu_fatalerror("%s: sound stream updated from execution domain %d\n", m_device.tag(), m_device.machine().scheduler().currently_executing()->execution_domain());
+
 	// ignore any update requests if we're already up to date
 	attotime start = m_output[0].end_time();
 	attotime end = m_device.machine().time();
 	if (start >= end)
+	{
+		// writes queued up to now still need applying
+		if (!m_deferred_writes.empty())
+			apply_deferred_writes(end);
 		return;
+	}
 
 	// regular update then
 	update_view(start, end);
 }
 
 
+//-------------------------------------------------
+//  timed_write - apply a change to the stream's
+//  state at the current time, either now or when
+//  the stream is next updated
+//-------------------------------------------------
+
+void sound_stream::timed_write(std::function<void ()> &&write)
+{
+	if (m_device.machine().scheduler().outside_main_domain())
+		throw emu_fatalerror("%s: sound stream written from execution domain %d\n", m_device.tag(), m_device.machine().scheduler().currently_executing()->execution_domain());
+
+	attotime const now = m_device.machine().time();
+	if (!m_defer_writes || now <= m_output[0].end_time())
+	{
+		update();
+		write();
+	}
+	else
+	{
+		m_deferred_writes.emplace_back(now, std::move(write));
+	}
+}
+
+
+//-------------------------------------------------
+//  apply_deferred_writes - generate up to the
+//  time of each queued write that falls before
+//  the given end, then apply it
+//-------------------------------------------------
+
+void sound_stream::apply_deferred_writes(attotime const &end)
+{
+	m_applying_writes = true;
+	while (!m_deferred_writes.empty() && m_deferred_writes.front().first <= end)
+	{
+		auto write = std::move(m_deferred_writes.front());
+		m_deferred_writes.pop_front();
+
+		attotime const start = m_output[0].end_time();
+		if (start < write.first)
+			update_view(start, write.first);
+		write.second();
+	}
+	m_applying_writes = false;
+}
+
+
 //-------------------------------------------------
 //  update_view - force a stream to update to
 //  the current emulated time and return a view
@@ -704,6 +783,10 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 	if (start > end)
 		start = end;
 
+	// writes queued within this period change the output partway through it
+	if (!m_deferred_writes.empty() && !m_applying_writes)
+		apply_deferred_writes(end);
+
 	g_profiler.start(PROFILER_SOUND);
 
 	// reposition our start to coincide with the current buffer end
@@ -739,7 +822,9 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 #endif
 
 			// if we have an extended callback, that's all we need
+			osd_ticks_t const start_ticks = osd_ticks();
 			m_callback_ex(*this, m_input_view, m_output_view);
+			m_update_ticks += osd_ticks() - start_ticks;
 
 #if (SOUND_DEBUG)
 			// make sure everything was overwritten
@@ -851,12 +936,26 @@ void sound_stream::sample_rate_changed()
 }
 
 
+//-------------------------------------------------
+//  presave - save/restore callback
+//-------------------------------------------------
+
+void sound_stream::presave()
+{
+	// the saved device state must include any queued writes
+	update();
+}
+
+
 //-------------------------------------------------
 //  postload - save/restore callback
 //-------------------------------------------------
 
 void sound_stream::postload()
 {
+	// anything still queued belonged to the state we just replaced
+	m_deferred_writes.clear();
+
 	// set the end time of all of our streams to now
 	for (auto &output : m_output)
 		output.set_end_time(m_device.machine().time());
@@ -1048,6 +1147,167 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 
 
 
+//-------------------------------------------------
+//  polyphase_resampler_stream - derived
+//  sound_stream class that resamples through a
+//  band-limited polyphase filter
+//-------------------------------------------------
+
+polyphase_resampler_stream::polyphase_resampler_stream(device_t &device) :
+	sound_stream(device, 1, 1, 0, SAMPLE_RATE_OUTPUT_ADAPTIVE, stream_update_delegate(&polyphase_resampler_stream::resampler_sound_update, this), STREAM_DISABLE_INPUT_RESAMPLING),
+	m_max_latency(0),
+	m_table_ratio(0.0)
+{
+	// create a name
+	m_name = "Polyphase Resampler '";
+	m_name += device.tag();
+	m_name += "'";
+}
+
+
+//-------------------------------------------------
+//  build_table - compute a Blackman-windowed sinc
+//  for each phase, with the cutoff just below the
+//  lower of the two Nyquist frequencies
+//-------------------------------------------------
+
+void polyphase_resampler_stream::build_table(double ratio)
+{
+	m_table_ratio = ratio;
+	m_table.resize(PHASES * TAPS);
+
+	double const cutoff = 0.9 * std::min(1.0, ratio);
+	for (int phase = 0; phase < PHASES; phase++)
+	{
+		stream_buffer::sample_t *const coeffs = &m_table[phase * TAPS];
+		double const frac = double(phase) / double(PHASES);
+
+		// tap i sits (frac + TAPS/2 - 1 - i) samples before the output position
+		double sum = 0.0;
+		for (int tap = 0; tap < TAPS; tap++)
+		{
+			double const x = frac + double(TAPS / 2 - 1 - tap);
+			double const arg = M_PI * cutoff * x;
+			double const sinc = (x == 0.0) ? 1.0 : (std::sin(arg) / arg);
+			double const w = 2.0 * M_PI * (x + double(TAPS / 2)) / double(TAPS);
+			double const window = (std::fabs(x) >= double(TAPS / 2)) ? 0.0 : (0.42 - 0.5 * std::cos(w) + 0.08 * std::cos(2.0 * w));
+			double const value = sinc * window;
+			coeffs[tap] = stream_buffer::sample_t(value);
+			sum += value;
+		}
+
+		// normalise each phase to unity gain at DC
+		for (int tap = 0; tap < TAPS; tap++)
+			coeffs[tap] = stream_buffer::sample_t(coeffs[tap] / sum);
+	}
+}
+
+
+//-------------------------------------------------
+//  resampler_sound_update - stream callback
+//  handler for resampling an input stream to the
+//  target sample rate of the output
+//-------------------------------------------------
+
+void polyphase_resampler_stream::resampler_sound_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
+{
+	sound_assert(inputs.size() == 1);
+	sound_assert(outputs.size() == 1);
+
+	auto &input = inputs[0];
+	auto &output = outputs[0];
+
+	// if the input has an invalid rate, just fill with zeros
+	if (input.sample_rate() <= 1)
+	{
+		output.fill(0);
+		return;
+	}
+
+	// inputs far above the output rate are first box-averaged down to no
+	// less than twice the output rate, so the filter cost per output sample
+	// stays fixed however fast the source chip runs
+	double const step = double(input.sample_rate()) / double(output.sample_rate());
+	s32 const decimate = std::max(1, s32(step / 2.0));
+	double const ratio = double(output.sample_rate()) * decimate / double(input.sample_rate());
+	if (ratio != m_table_ratio)
+		build_table(ratio);
+
+	// the filter needs TAPS/2 decimated samples either side of each output;
+	// delay the output by enough to have the later half available
+	s64 latency_samples = s64(TAPS / 2 + 2) * decimate + 1;
+	if (latency_samples <= m_max_latency)
+		latency_samples = m_max_latency;
+	else
+		m_max_latency = latency_samples;
+	attotime const latency = latency_samples * input.sample_period();
+	attotime const lookback = s64(TAPS / 2 + 2) * decimate * input.sample_period();
+
+	// clamp the latency to the start (only relevant at the beginning)
+	s32 dstindex = 0;
+	attotime output_start = output.start_time();
+	auto numsamples = output.samples();
+	while (latency + lookback > output_start && dstindex < numsamples)
+	{
+		output.put(dstindex++, 0);
+		output_start += output.sample_period();
+	}
+	if (dstindex >= numsamples)
+		return;
+
+	// create a rebased input buffer covering the lookback and everything after
+	read_stream_view rebased(input, output_start - latency - lookback);
+	attotime const rebased_start = rebased.start_time();
+	sound_assert(rebased_start + latency <= output_start);
+
+	// box-average the input in groups aligned to the absolute sample number,
+	// so consecutive updates see the same decimated signal
+	u64 const absolute = u64(rebased_start.seconds()) * input.sample_rate() + rebased_start.attoseconds() / rebased.sample_period_attoseconds();
+	s32 const first = (decimate - s32(absolute % decimate)) % decimate;
+	s32 const count = (s32(rebased.samples()) - first) / decimate;
+	if (count <= 0)
+	{
+		output.fill(0, dstindex);
+		return;
+	}
+	m_decimated.resize(count);
+	stream_buffer::sample_t const scale = 1.0f / stream_buffer::sample_t(decimate);
+	for (s32 index = 0, srcindex = first; index < count; index++)
+	{
+		stream_buffer::sample_t sum = 0;
+		for (s32 sub = 0; sub < decimate; sub++)
+			sum += rebased.get(srcindex++);
+		m_decimated[index] = sum * scale;
+	}
+
+	// position of the first output, in input samples from the rebased start
+	double srcpos = double((output_start - latency - rebased_start).as_attoseconds()) / double(rebased.sample_period_attoseconds());
+
+	// decimated sample n is centred on input sample first + n*decimate + (decimate-1)/2
+	double const centre = double(first) + double(decimate - 1) * 0.5;
+	for ( ; dstindex < numsamples; dstindex++, srcpos += step)
+	{
+		double const pos = (srcpos - centre) / double(decimate);
+		s32 const base = s32(pos);
+		s32 const phase = std::min(s32((pos - double(base)) * PHASES), PHASES - 1);
+		s32 const tapbase = base - (TAPS / 2 - 1);
+		sound_assert(tapbase >= 0 && tapbase + TAPS <= count);
+
+		// the dot product over contiguous arrays vectorises
+		stream_buffer::sample_t sample = 0;
+		if (tapbase >= 0 && tapbase + TAPS <= count)
+		{
+			stream_buffer::sample_t const *const coeffs = &m_table[phase * TAPS];
+			stream_buffer::sample_t const *const source = &m_decimated[tapbase];
+			for (s32 tap = 0; tap < TAPS; tap++)
+				sample += source[tap] * coeffs[tap];
+		}
+		output.put(dstindex, sample);
+	}
+}
+
+
+
 //**************************************************************************
 //  SOUND MANAGER
 //**************************************************************************
@@ -1068,12 +1328,20 @@ sound_manager::sound_manager(running_machine &machine) :
 	m_rightmix(machine.sample_rate()),
 	m_compressor_scale(1.0),
 	m_compressor_counter(0),
+	m_compressor_step(1.01f),
+	m_update_frequency(std::clamp(machine.options().sound_update_rate(), STREAMS_UPDATE_FREQUENCY, 1000)),
 	m_muted(0),
 	m_nosound_mode(machine.osd().no_sound()),
 	m_attenuation(0),
 	m_unique_id(0),
-	m_wavfile(),
-	m_first_reset(true)
+	m_recorder(),
+	m_first_reset(true),
+	m_concurrent_streams(machine.options().sound_threads()),
+	m_stream_groups_dirty(true),
+	m_stream_queue(nullptr),
+	m_stats_counter(0),
+	m_last_underflows(0),
+	m_last_overflows(0)
 {
 	// get filename for WAV file or AVI file if specified
 	const char *wavfile = machine.options().wav_write();
@@ -1102,9 +1370,14 @@ sound_manager::sound_manager(running_machine &machine) :
 	// set the starting attenuation
 	set_attenuation(machine.options().volume());
 
-	// start the periodic update flushing timer
+	// the compressor recovers at the same rate in real time however often we update
+	m_compressor_step = std::pow(1.01, double(STREAMS_UPDATE_FREQUENCY) / double(m_update_frequency));
+
+	// start the periodic update flushing timer; updating more often hands
+	// smaller chunks to the OSD sooner
+	attotime const update_period = attotime::from_hz(m_update_frequency);
 	m_update_timer = machine.scheduler().timer_alloc(timer_expired_delegate(FUNC(sound_manager::update), this));
-	m_update_timer->adjust(STREAMS_UPDATE_ATTOTIME, 0, STREAMS_UPDATE_ATTOTIME);
+	m_update_timer->adjust(update_period, 0, update_period);
 }
 
 
@@ -1114,6 +1387,8 @@ sound_manager::sound_manager(running_machine &machine) :
 
 sound_manager::~sound_manager()
 {
+	if (m_stream_queue != nullptr)
+		osd_work_queue_free(m_stream_queue);
 }
 
 
@@ -1131,20 +1406,126 @@ sound_stream *sound_manager::stream_alloc(device_t &device, u32 inputs, u32 outp
 			output_base += stream->output_count();
 
 	m_stream_list.push_back(std::make_unique<sound_stream>(device, inputs, outputs, output_base, sample_rate, callback, flags));
+	m_stream_groups_dirty = true;
 	return m_stream_list.back().get();
 }
 
 
+//**************************************************************************
+//  AUDIO RECORDER
+//**************************************************************************
+
+// encoding and disk writes happen on an I/O work queue so a slow disk or
+// the FLAC encoder never stall the emulation thread; only when every chunk
+// buffer is still waiting to be written does add() block
+class sound_manager::audio_recorder
+{
+public:
+	// number of updates that can be queued before add() waits
+	static constexpr int CHUNKS = 32;
+
+	audio_recorder() : m_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO)), m_next(0)
+	{
+		for (chunk &c : m_chunks)
+			c.owner = this;
+	}
+
+	~audio_recorder()
+	{
+		// let everything queued reach the file before closing it
+		for (chunk &c : m_chunks)
+			retire(c);
+		if (m_queue != nullptr)
+			osd_work_queue_free(m_queue);
+		if (m_flac)
+			m_flac->finish();
+	}
+
+	bool open(std::string_view filename, u32 sample_rate)
+	{
+		if (core_filename_ends_with(filename, ".flac"))
+		{
+			if (util::core_file::open(std::string(filename), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE, m_file) != osd_file::error::NONE)
+				return false;
+			m_flac = std::make_unique<flac_encoder>();
+			m_flac->set_sample_rate(sample_rate);
+			m_flac->set_num_channels(2);
+			return m_flac->reset(*m_file);
+		}
+		m_wavfile = util::wav_open(filename, sample_rate, 2);
+		return bool(m_wavfile);
+	}
+
+	// queue interleaved stereo samples for writing
+	void add(s16 const *data, u32 frames)
+	{
+		chunk &c = m_chunks[m_next];
+		m_next = (m_next + 1) % CHUNKS;
+		retire(c);
+		c.data.assign(data, data + frames * 2);
+		if (m_queue != nullptr)
+			c.item = osd_work_item_queue(m_queue, &audio_recorder::write_chunk, &c, 0);
+		if (c.item == nullptr)
+			write(c.data);
+	}
+
+private:
+	struct chunk
+	{
+		audio_recorder *owner = nullptr;
+		std::vector<s16> data;
+		osd_work_item *item = nullptr;
+	};
+
+	// wait for a chunk's previous write to finish
+	void retire(chunk &c)
+	{
+		if (c.item != nullptr)
+		{
+			osd_work_item_wait(c.item, osd_ticks_per_second() * 100);
+			osd_work_item_release(c.item);
+			c.item = nullptr;
+		}
+	}
+
+	static void *write_chunk(void *param, int threadid)
+	{
+		chunk &c = *reinterpret_cast<chunk *>(param);
+		c.owner->write(c.data);
+		return nullptr;
+	}
+
+	void write(std::vector<s16> &data)
+	{
+		if (m_flac)
+			m_flac->encode_interleaved(&data[0], data.size() / 2);
+		else
+			util::wav_add_data_16(*m_wavfile, &data[0], data.size());
+	}
+
+	osd_work_queue *m_queue;
+	std::array<chunk, CHUNKS> m_chunks;
+	int m_next;
+
+	util::wav_file_ptr m_wavfile;
+	util::core_file::ptr m_file;
+	std::unique_ptr<flac_encoder> m_flac;
+};
+
+
 //-------------------------------------------------
 //  start_recording - begin audio recording
 //-------------------------------------------------
 
 bool sound_manager::start_recording(std::string_view filename)
 {
-	if (m_wavfile)
+	if (m_recorder)
+		return false;
+	auto recorder = std::make_unique<audio_recorder>();
+	if (!recorder->open(filename, machine().sample_rate()))
 		return false;
-	m_wavfile = util::wav_open(filename, machine().sample_rate(), 2);
-	return bool(m_wavfile);
+	m_recorder = std::move(recorder);
+	return true;
 }
 
 bool sound_manager::start_recording()
@@ -1161,8 +1542,8 @@ bool sound_manager::start_recording()
 
 void sound_manager::stop_recording()
 {
-	// close any open WAV file
-	m_wavfile.reset();
+	// close any open WAV or FLAC file, once everything queued is written
+	m_recorder.reset();
 }
 
 
@@ -1450,6 +1831,56 @@ stream_buffer::sample_t sound_manager::adjust_toward_compressor_scale(stream_buf
 }
 
 
+//-------------------------------------------------
+//  update_statistics - roll the per-second audio
+//  pipeline figures over
+//-------------------------------------------------
+
+void sound_manager::update_statistics()
+{
+	// time spent in each stream's callback
+	double const tick_seconds = 1.0 / double(osd_ticks_per_second());
+	m_stats.update_time = 0.0;
+	for (auto &stream : m_stream_list)
+	{
+		stream->m_update_time = double(stream->m_update_ticks) * tick_seconds;
+		stream->m_update_ticks = 0;
+		m_stats.update_time += stream->m_update_time;
+	}
+
+	// host buffer state; the OSD counts are running totals
+	osd_audio_status status;
+	if (!m_nosound_mode && machine().osd().get_audio_status(status))
+	{
+		m_stats.underflows = status.underflows - m_last_underflows;
+		m_stats.overflows = status.overflows - m_last_overflows;
+		m_stats.buffer_fill = status.capacity ? (float(status.buffered) / float(status.capacity)) : -1.0f;
+		m_last_underflows = status.underflows;
+		m_last_overflows = status.overflows;
+	}
+	else
+	{
+		m_stats.underflows = m_stats.overflows = 0;
+		m_stats.buffer_fill = -1.0f;
+	}
+}
+
+
+//-------------------------------------------------
+//  stats_text - format the audio pipeline figures
+//  for display
+//-------------------------------------------------
+
+std::string sound_manager::stats_text() const
+{
+	std::string result = util::string_format("Audio: %u underruns, %u overruns", m_stats.underflows, m_stats.overflows);
+	if (m_stats.buffer_fill >= 0.0f)
+		result += util::string_format(", buffer %d%%", int(m_stats.buffer_fill * 100.0f + 0.5f));
+	result += util::string_format("\nStreams: %.2f ms/s", m_stats.update_time * 1000.0);
+	return result;
+}
+
+
 //-------------------------------------------------
 //  update - mix everything down to its final form
 //  and send it to the OSD layer
@@ -1472,6 +1903,26 @@ void sound_manager::update(void *ptr, int param)
 	// recompute the end time to an even sample boundary
 	attotime endtime = m_last_update + attotime(0, m_samples_this_update * sample_rate_attos);
 
+	// bring independent groups of streams up to date concurrently; the mix then finds them ready
+	if (m_concurrent_streams && !g_profiler.enabled())
+		update_stream_groups(endtime);
+
+	// in compute-only mode or while running ahead, keep the streams in step with emulation but skip mixing and output
+	if (machine().video().output_suppressed())
+	{
+		for (speaker_device &speaker : m_speakers)
+			speaker.mix(nullptr, nullptr, m_last_update, endtime, m_samples_this_update, true);
+		for (auto &stream : m_orphan_stream_list)
+			stream.first->update();
+
+		m_last_update = endtime;
+		m_update_number++;
+		apply_sample_rate_changes();
+
+		g_profiler.stop();
+		return;
+	}
+
 	// clear out the mix bufers
 	std::fill_n(&m_leftmix[0], m_samples_this_update, 0);
 	std::fill_n(&m_rightmix[0], m_samples_this_update, 0);
@@ -1484,17 +1935,8 @@ void sound_manager::update(void *ptr, int param)
 	stream_buffer::sample_t curmax = 0;
 	for (int sampindex = 0; sampindex < m_samples_this_update; sampindex++)
 	{
-		auto sample = m_leftmix[sampindex];
-		if (sample < 0)
-			sample = -sample;
-		if (sample > curmax)
-			curmax = sample;
-
-		sample = m_rightmix[sampindex];
-		if (sample < 0)
-			sample = -sample;
-		if (sample > curmax)
-			curmax = sample;
+		curmax = std::max(curmax, std::fabs(m_leftmix[sampindex]));
+		curmax = std::max(curmax, std::fabs(m_rightmix[sampindex]));
 	}
 
 	// pull in current compressor scale factor before modifying
@@ -1505,7 +1947,7 @@ void sound_manager::update(void *ptr, int param)
 	if (curmax * m_compressor_scale > 1.0)
 	{
 		m_compressor_scale = 1.0 / curmax;
-		m_compressor_counter = STREAMS_UPDATE_FREQUENCY / 5;
+		m_compressor_counter = m_update_frequency / 5;
 	}
 
 	// if we're currently scaled, wait a bit to see if we can trend back toward 1.0
@@ -1513,9 +1955,9 @@ void sound_manager::update(void *ptr, int param)
 		m_compressor_counter--;
 
 	// try to migrate toward 0 unless we're going to introduce clipping
-	else if (m_compressor_scale < 1.0 && curmax * 1.01 * m_compressor_scale < 1.0)
+	else if (m_compressor_scale < 1.0 && curmax * m_compressor_step * m_compressor_scale < 1.0)
 	{
-		m_compressor_scale *= 1.01f;
+		m_compressor_scale *= m_compressor_step;
 		if (m_compressor_scale > 1.0)
 			m_compressor_scale = 1.0;
 	}
@@ -1572,14 +2014,21 @@ void sound_manager::update(void *ptr, int param)
 			machine().osd().update_audio_stream(finalmix, finalmix_offset / 2);
 		machine().osd().add_audio_to_recording(finalmix, finalmix_offset / 2);
 		machine().video().add_sound_to_recording(finalmix, finalmix_offset / 2);
-		if (m_wavfile)
-			util::wav_add_data_16(*m_wavfile, finalmix, finalmix_offset);
+		if (m_recorder)
+			m_recorder->add(finalmix, finalmix_offset / 2);
 	}
 
 	// update any orphaned streams so they don't get too far behind
 	for (auto &stream : m_orphan_stream_list)
 		stream.first->update();
 
+	// refresh the statistics once a second
+	if (--m_stats_counter <= 0)
+	{
+		update_statistics();
+		m_stats_counter = m_update_frequency;
+	}
+
 	// remember the update time
 	m_last_update = endtime;
 	m_update_number++;
@@ -1592,3 +2041,133 @@ void sound_manager::update(void *ptr, int param)
 
 	g_profiler.stop();
 }
+
+
+//-------------------------------------------------
+//  build_stream_groups - partition the streams
+//  into groups that can be updated independently;
+//  streams sharing a device or connected through
+//  an input stay together, while the speakers'
+//  own streams are left to the mix
+//-------------------------------------------------
+
+void sound_manager::build_stream_groups()
+{
+	m_stream_groups.clear();
+	m_stream_groups_dirty = false;
+
+	// number the streams that take part
+	std::map<sound_stream *, u32> index;
+	std::vector<u32> parent;
+	for (auto &stream : m_stream_list)
+		if (dynamic_cast<speaker_device *>(&stream->device()) == nullptr)
+		{
+			index.emplace(stream.get(), parent.size());
+			parent.push_back(parent.size());
+		}
+
+	auto const find = [&parent] (u32 item)
+	{
+		while (parent[item] != item)
+			item = parent[item] = parent[parent[item]];
+		return item;
+	};
+
+	// join streams of the same device, and each stream with its sources
+	std::map<device_t *, u32> device_first;
+	std::vector<bool> serial(parent.size(), false);
+	for (auto &stream : m_stream_list)
+	{
+		auto const own = index.find(stream.get());
+		if (own == index.end())
+			continue;
+
+		// synchronous streams are updated on demand by their own timers
+		if (stream->synchronous())
+			serial[own->second] = true;
+
+		auto const first = device_first.emplace(&stream->device(), own->second);
+		parent[find(own->second)] = find(first.first->second);
+
+		for (int inputnum = 0; inputnum < stream->input_count(); inputnum++)
+		{
+			sound_stream_input &input = stream->input(inputnum);
+			if (!input.valid())
+				continue;
+
+			// a speaker feeding back into the graph can't be shared between threads
+			auto const source = index.find(&input.source().stream());
+			if (source == index.end())
+				serial[own->second] = true;
+			else
+				parent[find(own->second)] = find(source->second);
+		}
+	}
+
+	// collect the groups; any group holding a stream that must stay on this thread is dropped
+	std::vector<bool> serial_root(parent.size(), false);
+	for (u32 item = 0; item < parent.size(); item++)
+		if (serial[item])
+			serial_root[find(item)] = true;
+
+	std::map<u32, u32> group_of;
+	for (auto &stream : m_stream_list)
+	{
+		auto const own = index.find(stream.get());
+		if (own == index.end())
+			continue;
+		u32 const root = find(own->second);
+		if (serial_root[root])
+			continue;
+
+		auto const group = group_of.emplace(root, m_stream_groups.size());
+		if (group.second)
+			m_stream_groups.emplace_back();
+		m_stream_groups[group.first->second].m_streams.push_back(stream.get());
+	}
+
+	VPRINTF(("stream groups = %d\n", int(m_stream_groups.size())));
+}
+
+
+//-------------------------------------------------
+//  update_stream_groups - bring every independent
+//  group of streams up to the given time, each on
+//  its own thread
+//-------------------------------------------------
+
+void sound_manager::update_stream_groups(attotime const &endtime)
+{
+	if (m_stream_groups_dirty)
+		build_stream_groups();
+
+	// nothing to gain from a single group
+	if (m_stream_groups.size() < 2)
+		return;
+
+	for (stream_group &group : m_stream_groups)
+		group.m_end = endtime;
+
+	// groups other than the first run on the worker threads
+	if (m_stream_queue == nullptr)
+		m_stream_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	osd_work_item_queue_multiple(m_stream_queue, update_stream_group_callback, m_stream_groups.size() - 1, &m_stream_groups[1], sizeof(m_stream_groups[1]), WORK_ITEM_FLAG_AUTO_RELEASE);
+
+	// the first one runs here, then wait for the rest
+	update_stream_group_callback(&m_stream_groups[0], 0);
+	osd_work_queue_wait(m_stream_queue, osd_ticks_per_second() * 100);
+}
+
+
+//-------------------------------------------------
+//  update_stream_group_callback - update all the
+//  streams in a single group
+//-------------------------------------------------
+
+void *sound_manager::update_stream_group_callback(void *param, int threadid)
+{
+	stream_group &group = *reinterpret_cast<stream_group *>(param);
+	for (sound_stream *stream : group.m_streams)
+		stream->update_view(group.m_end, group.m_end);
+	return nullptr;
+}
@@ -63,6 +63,9 @@
 
 #include "wavwrite.h"
 
+#include <deque>
+#include <functional>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -129,6 +132,9 @@ private:
 	// return the current sample rate
 	u32 sample_rate() const { return m_sample_rate; }
 
+	// return the bytes allocated for sample data
+	size_t allocated_bytes() const { return m_buffer.capacity() * sizeof(sample_t); }
+
 	// set a new sample rate
 	void set_sample_rate(u32 rate, bool resample);
 
@@ -328,7 +334,39 @@ public:
 		return m_buffer->get(index);
 	}
 
+	// add the gain-scaled samples to a plain array of samples
+	void add_to(sample_t *dest, s32 start, s32 count) const
+	{
+		sound_assert(start + count <= samples());
+		while (count > 0)
+		{
+			s32 chunk = count;
+			sample_t const *const source = span(start, chunk);
+			sample_t const gain = m_gain;
+			for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+				dest[sampindex] += source[sampindex] * gain;
+			dest += chunk;
+			start += chunk;
+			count -= chunk;
+		}
+	}
+	void add_to(sample_t *dest, s32 count) const { add_to(dest, 0, count); }
+
 protected:
+	friend class write_stream_view;
+
+	// return a pointer to the raw sample at the given index, reducing count
+	// to the number of samples that follow it contiguously in the buffer;
+	// walking a view in these spans lets the inner loops vectorise
+	sample_t *span(s32 index, s32 &count) const
+	{
+		index += m_start;
+		if (index >= m_buffer->size())
+			index -= m_buffer->size();
+		count = std::min<s32>(count, m_buffer->size() - index);
+		return &m_buffer->m_buffer[index];
+	}
+
 	// normalize start/end
 	void normalize_start_end()
 	{
@@ -421,11 +459,13 @@ public:
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = start + m_start;
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		while (count > 0)
 		{
-			m_buffer->put(index, value);
-			index = m_buffer->next_index(index);
+			s32 chunk = count;
+			sample_t *const dest = span(start, chunk);
+			std::fill_n(dest, chunk, value);
+			start += chunk;
+			count -= chunk;
 		}
 	}
 	void fill(sample_t value, s32 start) { fill(value, start, samples() - start); }
@@ -436,11 +476,17 @@ public:
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = start + m_start;
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		sound_assert(start + count <= src.samples());
+		sample_t const gain = src.m_gain;
+		while (count > 0)
 		{
-			m_buffer->put(index, src.get(start + sampindex));
-			index = m_buffer->next_index(index);
+			s32 chunk = count;
+			sample_t *const dest = span(start, chunk);
+			sample_t const *const source = src.span(start, chunk);
+			for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+				dest[sampindex] = source[sampindex] * gain;
+			start += chunk;
+			count -= chunk;
 		}
 	}
 	void copy(read_stream_view const &src, s32 start) { copy(src, start, samples() - start); }
@@ -451,15 +497,56 @@ public:
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = start + m_start;
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		sound_assert(start + count <= src.samples());
+		sample_t const gain = src.m_gain;
+		while (count > 0)
 		{
-			m_buffer->put(index, m_buffer->get(index) + src.get(start + sampindex));
-			index = m_buffer->next_index(index);
+			s32 chunk = count;
+			sample_t *const dest = span(start, chunk);
+			sample_t const *const source = src.span(start, chunk);
+			for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+				dest[sampindex] += source[sampindex] * gain;
+			start += chunk;
+			count -= chunk;
 		}
 	}
 	void add(read_stream_view const &src, s32 start) { add(src, start, samples() - start); }
 	void add(read_stream_view const &src) { add(src, 0, samples()); }
+
+	// multiply part of the view by a gain and add an offset
+	void scale(sample_t gain, sample_t offset, s32 start, s32 count)
+	{
+		if (start + count > samples())
+			count = samples() - start;
+		while (count > 0)
+		{
+			s32 chunk = count;
+			sample_t *const dest = span(start, chunk);
+			for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+				dest[sampindex] = dest[sampindex] * gain + offset;
+			start += chunk;
+			count -= chunk;
+		}
+	}
+	void scale(sample_t gain, sample_t offset = 0) { scale(gain, offset, 0, samples()); }
+
+	// clamp part of the view to +/- the clamp value
+	void clamp(sample_t limit, s32 start, s32 count)
+	{
+		assert(limit >= sample_t(0));
+		if (start + count > samples())
+			count = samples() - start;
+		while (count > 0)
+		{
+			s32 chunk = count;
+			sample_t *const dest = span(start, chunk);
+			for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+				dest[sampindex] = std::clamp(dest[sampindex], -limit, limit);
+			start += chunk;
+			count -= chunk;
+		}
+	}
+	void clamp(sample_t limit = 1.0) { clamp(limit, 0, samples()); }
 };
 
 
@@ -488,6 +575,7 @@ public:
 	u32 index() const { return m_index; }
 	stream_buffer::sample_t gain() const { return m_gain; }
 	u32 buffer_sample_rate() const { return m_buffer.sample_rate(); }
+	size_t buffer_bytes() const { return m_buffer.allocated_bytes(); }
 
 	// simple setters
 	void set_gain(float gain) { m_gain = gain; }
@@ -613,6 +701,8 @@ public:
 	sound_stream *next() const { return m_next; }
 	device_t &device() const { return m_device; }
 	std::string name() const { return m_name; }
+	size_t buffer_bytes() const;
+	double update_time() const { return m_update_time; }
 	bool input_adaptive() const { return m_input_adaptive || m_synchronous; }
 	bool output_adaptive() const { return m_output_adaptive; }
 	bool synchronous() const { return m_synchronous; }
@@ -640,6 +730,12 @@ public:
 	// force an update to the current time
 	void update();
 
+	// apply a change to the state feeding this stream at the current time;
+	// normally this brings the stream up to date first, but with deferred
+	// writes the change is queued and applied in order during the next update
+	void timed_write(std::function<void ()> &&write);
+	bool deferring_writes() const { return m_defer_writes; }
+
 	// force an update to the current time, returning a view covering the given time period
 	read_stream_view update_view(attotime start, attotime end, u32 outputnum = 0);
 
@@ -662,9 +758,15 @@ private:
 	// if the sample rate has changed, this gets called to update internals
 	void sample_rate_changed();
 
+	// flush deferred writes before a save state
+	void presave();
+
 	// handle updates after a save state load
 	void postload();
 
+	// apply deferred writes timed before the given end time
+	void apply_deferred_writes(attotime const &end);
+
 	// re-print the synchronization timer
 	void reprime_sync_timer();
 
@@ -701,6 +803,15 @@ private:
 
 	// callback information
 	stream_update_delegate m_callback_ex;          // extended callback function
+
+	// deferred writes
+	bool m_defer_writes;                           // queue writes instead of updating on each one?
+	bool m_applying_writes;                        // are we partway through applying them?
+	std::deque<std::pair<attotime, std::function<void ()>>> m_deferred_writes; // queued writes and their times
+
+	// statistics
+	osd_ticks_t m_update_ticks;                    // ticks spent in the callback this period
+	double m_update_time;                          // seconds spent in the callback last period
 };
 
 
@@ -721,6 +832,33 @@ private:
 };
 
 
+// ======================> polyphase_resampler_stream
+
+class polyphase_resampler_stream : public sound_stream
+{
+	// filter length in (pre-decimated) input samples, and number of phases in the table
+	static constexpr int TAPS = 32;
+	static constexpr int PHASES = 256;
+
+public:
+	// construction/destruction
+	polyphase_resampler_stream(device_t &device);
+
+	// update handler
+	void resampler_sound_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs);
+
+private:
+	// rebuild the filter table for a new ratio of output to filter input rate
+	void build_table(double ratio);
+
+	// internal state
+	u32 m_max_latency;
+	double m_table_ratio;                 // ratio the filter table was built for
+	std::vector<stream_buffer::sample_t> m_table; // PHASES sets of TAPS coefficients
+	std::vector<stream_buffer::sample_t> m_decimated; // box-decimated input for one update
+};
+
+
 // ======================> sound_manager
 
 // structure describing an indexed mixer
@@ -735,18 +873,28 @@ class sound_manager
 {
 	friend class sound_stream;
 
+	// writes recorded audio out on a background thread
+	class audio_recorder;
+
 	// reasons for muting
 	static constexpr u8 MUTE_REASON_PAUSE = 0x01;
 	static constexpr u8 MUTE_REASON_UI = 0x02;
 	static constexpr u8 MUTE_REASON_DEBUGGER = 0x04;
 	static constexpr u8 MUTE_REASON_SYSTEM = 0x08;
 
-	// stream updates
-	static const attotime STREAMS_UPDATE_ATTOTIME;
-
 public:
+	// default (and minimum) number of stream updates per second
 	static constexpr int STREAMS_UPDATE_FREQUENCY = 50;
 
+	// audio pipeline statistics, gathered over the last full second
+	struct statistics
+	{
+		u32 underflows = 0;                   // host buffer underruns
+		u32 overflows = 0;                    // host buffer overruns (samples dropped)
+		float buffer_fill = -1.0f;            // host buffer fill level from 0 to 1, or negative if unknown
+		double update_time = 0.0;             // seconds spent in stream callbacks
+	};
+
 	// construction/destruction
 	sound_manager(running_machine &machine);
 	~sound_manager();
@@ -758,12 +906,14 @@ public:
 	attotime last_update() const { return m_last_update; }
 	int sample_count() const { return m_samples_this_update; }
 	int unique_id() { return m_unique_id++; }
+	const statistics &stats() const { return m_stats; }
+	std::string stats_text() const;
 
 	// allocate a new stream with a new-style callback
 	sound_stream *stream_alloc(device_t &device, u32 inputs, u32 outputs, u32 sample_rate, stream_update_delegate callback, sound_stream_flags flags);
 
 	// WAV recording
-	bool is_recording() const { return bool(m_wavfile); }
+	bool is_recording() const { return bool(m_recorder); }
 	bool start_recording();
 	bool start_recording(std::string_view filename);
 	void stop_recording();
@@ -810,8 +960,21 @@ private:
 	// helper to adjust scale factor toward a goal
 	stream_buffer::sample_t adjust_toward_compressor_scale(stream_buffer::sample_t curscale, stream_buffer::sample_t prevsample, stream_buffer::sample_t rawsample);
 
-	// periodic sound update, called STREAMS_UPDATE_FREQUENCY per second
+	// periodic sound update, called -sound_update_rate times per second
 	void update(void *ptr = nullptr, s32 param = 0);
+	void update_statistics();
+
+	// concurrent stream updates
+	void build_stream_groups();
+	void update_stream_groups(attotime const &endtime);
+	static void *update_stream_group_callback(void *param, int threadid);
+
+	// a set of streams that share a device or a connection, and so must be updated on one thread
+	struct stream_group
+	{
+		std::vector<sound_stream *> m_streams; // streams in the group
+		attotime m_end;                       // time to bring them up to
+	};
 
 	// internal state
 	running_machine &m_machine;           // reference to the running machine
@@ -828,17 +991,31 @@ private:
 
 	stream_buffer::sample_t m_compressor_scale; // current compressor scale factor
 	int m_compressor_counter;             // compressor update counter for backoff
+	stream_buffer::sample_t m_compressor_step; // per-update recovery factor, scaled to the update rate
+	int m_update_frequency;               // stream updates per second
 
 	u8 m_muted;                           // bitmask of muting reasons
 	bool m_nosound_mode;                  // true if we're in "nosound" mode
 	int m_attenuation;                    // current attentuation level (at the OSD)
 	int m_unique_id;                      // unique ID used for stream identification
-	util::wav_file_ptr m_wavfile;         // WAV file for streaming
+	std::unique_ptr<audio_recorder> m_recorder; // WAV or FLAC file for streaming
 
 	// streams data
 	std::vector<std::unique_ptr<sound_stream>> m_stream_list; // list of streams
 	std::map<sound_stream *, u8> m_orphan_stream_list; // list of orphaned streams
 	bool m_first_reset;                   // is this our first reset?
+
+	// concurrent update state
+	bool m_concurrent_streams;            // update stream groups on worker threads?
+	bool m_stream_groups_dirty;           // do the groups need rebuilding?
+	std::vector<stream_group> m_stream_groups; // independent groups of streams
+	osd_work_queue *m_stream_queue;       // work queue for updating the groups
+
+	// statistics
+	statistics m_stats;                   // figures for the last full second
+	int m_stats_counter;                  // updates left until the next refresh
+	u32 m_last_underflows;                // host buffer running totals at the last refresh
+	u32 m_last_overflows;
 };
 
 
@@ -91,22 +91,18 @@ void speaker_device::mix(stream_buffer::sample_t *leftmix, stream_buffer::sample
 	{
 		// if the speaker is centered, send to both left and right
 		if (m_x == 0)
-			for (int sample = 0; sample < expected_samples; sample++)
-			{
-				stream_buffer::sample_t cursample = view.get(sample);
-				leftmix[sample] += cursample;
-				rightmix[sample] += cursample;
-			}
+		{
+			view.add_to(leftmix, expected_samples);
+			view.add_to(rightmix, expected_samples);
+		}
 
 		// if the speaker is to the left, send only to the left
 		else if (m_x < 0)
-			for (int sample = 0; sample < expected_samples; sample++)
-				leftmix[sample] += view.get(sample);
+			view.add_to(leftmix, expected_samples);
 
 		// if the speaker is to the right, send only to the right
 		else
-			for (int sample = 0; sample < expected_samples; sample++)
-				rightmix[sample] += view.get(sample);
+			view.add_to(rightmix, expected_samples);
 	}
 }
 
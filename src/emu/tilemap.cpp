@@ -102,6 +102,11 @@ inline bool tilemap_t::gfx_elements_changed()
 //  SCANLINE RASTERIZERS
 //**************************************************************************
 
+// The masked loops below select rather than branch, writing every pixel
+// back (possibly unchanged) so the compiler can vectorise them; tile
+// transparency patterns are too irregular for a branch per pixel to
+// predict well.
+
 //-------------------------------------------------
 //  scanline_draw_opaque_null - draw to a nullptr
 //  bitmap, setting priority only
@@ -131,9 +136,12 @@ inline void tilemap_t::scanline_draw_masked_null(const u8 *maskptr, int mask, in
 		return;
 
 	// update priority across the scanline, checking the mask
+	u8 const primask = pcode >> 8, pricode = pcode;
 	for (int i = 0; i < count; i++)
-		if ((maskptr[i] & mask) == value)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	{
+		bool const hit = (maskptr[i] & mask) == value;
+		pri[i] = hit ? u8((pri[i] & primask) | pricode) : pri[i];
+	}
 }
 
 
@@ -187,25 +195,28 @@ inline void tilemap_t::scanline_draw_opaque_ind16(u16 *dest, const u16 *source,
 
 inline void tilemap_t::scanline_draw_masked_ind16(u16 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode)
 {
-	int pal = pcode >> 16;
+	u16 const pal = pcode >> 16;
 
 	// priority case
 	if ((pcode & 0xffff) != 0xff00)
 	{
+		u8 const primask = pcode >> 8, pricode = pcode;
 		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = source[i] + pal;
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
+		{
+			bool const hit = (maskptr[i] & mask) == value;
+			dest[i] = hit ? u16(source[i] + pal) : dest[i];
+			pri[i] = hit ? u8((pri[i] & primask) | pricode) : pri[i];
+		}
 	}
 
 	// no priority case
 	else
 	{
 		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = source[i] + pal;
+		{
+			bool const hit = (maskptr[i] & mask) == value;
+			dest[i] = hit ? u16(source[i] + pal) : dest[i];
+		}
 	}
 }
 
@@ -251,20 +262,23 @@ inline void tilemap_t::scanline_draw_masked_rgb32(u32 *dest, const u16 *source,
 	// priority case
 	if ((pcode & 0xffff) != 0xff00)
 	{
+		u8 const primask = pcode >> 8, pricode = pcode;
 		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = clut[source[i]];
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
+		{
+			bool const hit = (maskptr[i] & mask) == value;
+			dest[i] = hit ? u32(clut[source[i]]) : dest[i];
+			pri[i] = hit ? u8((pri[i] & primask) | pricode) : pri[i];
+		}
 	}
 
 	// no priority case
 	else
 	{
 		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = clut[source[i]];
+		{
+			bool const hit = (maskptr[i] & mask) == value;
+			dest[i] = hit ? u32(clut[source[i]]) : dest[i];
+		}
 	}
 }
 
@@ -431,7 +445,7 @@ void tilemap_t::init_common(
 	machine().save().save_item(m_device, "tilemap", nullptr, instance, NAME(m_dy_flipped));
 
 	// reset everything after a load
-	machine().save().register_postload(save_prepost_delegate(FUNC(tilemap_t::postload), this));
+	machine().save().register_postload(save_prepost_delegate(FUNC(tilemap_t::postload), this), true);
 }
 
 tilemap_t &tilemap_t::init(
@@ -504,14 +518,46 @@ void tilemap_t::mark_tile_dirty(tilemap_memory_index memindex)
 		// there may be no logical index for a given memory index
 		logical_index logindex = m_memory_to_logical[memindex];
 		if (logindex != INVALID_LOGICAL_INDEX)
-		{
-			m_tileflags[logindex] = TILE_FLAG_DIRTY;
-			m_all_tiles_clean = false;
-		}
+			mark_logical_dirty(logindex);
 	}
 }
 
 
+//-------------------------------------------------
+//  mark_group_dirty - mark dirty only the tiles
+//  last drawn using the given pen group
+//-------------------------------------------------
+
+void tilemap_t::mark_group_dirty(int group)
+{
+	// nothing to do if everything is going to be redrawn anyway
+	if (m_all_tiles_dirty)
+		return;
+
+	for (logical_index logindex = 0; logindex < m_tileflags.size(); logindex++)
+		if (m_tilegroup[logindex] == group && m_tileflags[logindex] != TILE_FLAG_DIRTY)
+			mark_logical_dirty(logindex);
+}
+
+
+//-------------------------------------------------
+//  mark_palette_dirty - mark dirty only the tiles
+//  last drawn with a palette base in the given
+//  range of pens
+//-------------------------------------------------
+
+void tilemap_t::mark_palette_dirty(pen_t start, u32 count)
+{
+	// nothing to do if everything is going to be redrawn anyway
+	if (m_all_tiles_dirty)
+		return;
+
+	for (logical_index logindex = 0; logindex < m_tileflags.size(); logindex++)
+		if (m_tilepalette[logindex] - start < count && m_tileflags[logindex] != TILE_FLAG_DIRTY)
+			mark_logical_dirty(logindex);
+}
+
+
 //-------------------------------------------------
 //  map_pens_to_layer - specify the mapping of one
 //  or more pens (where (<pen> & mask) == pen) to
@@ -542,9 +588,9 @@ void tilemap_t::map_pens_to_layer(int group, pen_t pen, pen_t mask, u8 layermask
 			array[cur] = layermask;
 		}
 
-	// everything gets dirty if anything changed
+	// only tiles drawn with this group are affected
 	if (changed)
-		mark_all_dirty();
+		mark_group_dirty(group);
 }
 
 
@@ -701,6 +747,9 @@ void tilemap_t::mappings_create()
 	m_memory_to_logical.resize(max_memory_index);
 	m_logical_to_memory.resize(max_logical_index);
 	m_tileflags.resize(max_logical_index);
+	m_tilegroup.resize(max_logical_index);
+	m_tilepalette.resize(max_logical_index);
+	m_rowdirty.resize(m_rows);
 
 	// update the mappings
 	mappings_update();
@@ -753,11 +802,28 @@ inline void tilemap_t::realize_all_dirty_tiles()
 	if (m_all_tiles_dirty || gfx_elements_changed())
 	{
 		memset(&m_tileflags[0], TILE_FLAG_DIRTY, m_tileflags.size());
+		std::fill(m_rowdirty.begin(), m_rowdirty.end(), 1);
 		m_all_tiles_dirty = false;
 		m_gfx_used = 0;
 	}
 }
 
+//-------------------------------------------------
+//  memory_bytes - bytes allocated for the cached
+//  pixmaps and per-tile tables
+//-------------------------------------------------
+
+size_t tilemap_t::memory_bytes() const
+{
+	return size_t(m_pixmap.allocated_bytes()) + m_flagsmap.allocated_bytes()
+			+ m_memory_to_logical.capacity() * sizeof(logical_index)
+			+ m_logical_to_memory.capacity() * sizeof(tilemap_memory_index)
+			+ (m_rowscroll.capacity() + m_colscroll.capacity()) * sizeof(s32)
+			+ m_tileflags.capacity() + m_tilegroup.capacity() + m_rowdirty.capacity()
+			+ m_tilepalette.capacity() * sizeof(u32);
+}
+
+
 //-------------------------------------------------
 //  pixmap_update - update the entire pixmap
 //-------------------------------------------------
@@ -777,12 +843,16 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	// flush the dirty state to all tiles as appropriate
 	realize_all_dirty_tiles();
 
-	// iterate over rows and columns
-	logical_index logindex = 0;
+	// iterate over the columns of rows that have anything dirty in them
 	for (u32 row = 0; row < m_rows; row++)
-		for (u32 col = 0; col < m_cols; col++, logindex++)
-			if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
-				tile_update(logindex, col, row);
+		if (m_rowdirty[row])
+		{
+			logical_index logindex = row * m_cols;
+			for (u32 col = 0; col < m_cols; col++, logindex++)
+				if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
+					tile_update(logindex, col, row);
+			m_rowdirty[row] = 0;
+		}
 
 	// mark it all clean
 	m_all_tiles_clean = true;
@@ -811,6 +881,8 @@ g_profiler.start(PROFILER_TILEMAP_UPDATE);
 	u32 y0 = m_tileheight * row;
 	m_tileflags[logindex] = tile_draw(m_tileinfo.pen_data, x0, y0,
 		m_tileinfo.palette_base, m_tileinfo.category, m_tileinfo.group, flags, m_tileinfo.pen_mask);
+	m_tilegroup[logindex] = m_tileinfo.group;
+	m_tilepalette[logindex] = m_tileinfo.palette_base;
 
 	// if mask data is specified, apply it
 	if ((flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && m_tileinfo.mask_data != nullptr)
@@ -1144,11 +1216,40 @@ g_profiler.start(PROFILER_TILEMAP_DRAW_ROZ);
 	// get the full pixmap for the tilemap
 	pixmap();
 
-	// then do the roz copy
-	draw_roz_core(screen, dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
+	// small layers are drawn directly; the rest are split into bands of rows
+	// that only read the pixmap and write disjoint parts of the destination
+	// and priority bitmaps, so they can be drawn in parallel
+	int const bands = std::min(blit.cliprect.height() / MIN_ROZ_BAND_ROWS, MAX_ROZ_BANDS);
+	osd_work_queue *const queue = (bands > 1) ? m_manager->work_queue() : nullptr;
+	if (!queue)
+	{
+		draw_roz_core(screen, dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
+	}
+	else
+	{
+		roz_band_parameters<_BitmapClass> params[MAX_ROZ_BANDS];
+		int const top = blit.cliprect.top();
+		int const height = blit.cliprect.height();
+		for (int band = 0; band < bands; band++)
+		{
+			params[band] = roz_band_parameters<_BitmapClass>{ this, &screen, &dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound };
+			params[band].blit.cliprect.sety(top + height * band / bands, top + height * (band + 1) / bands - 1);
+		}
+		osd_work_item_queue_multiple(queue, &tilemap_t::draw_roz_band<_BitmapClass>, bands - 1, &params[1], sizeof(params[1]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		draw_roz_band<_BitmapClass>(&params[0], 0);
+		osd_work_queue_wait(queue, osd_ticks_per_second() * 100);
+	}
 g_profiler.stop();
 }
 
+template<class _BitmapClass>
+void *tilemap_t::draw_roz_band(void *param, int threadid)
+{
+	auto const &band = *reinterpret_cast<roz_band_parameters<_BitmapClass> const *>(param);
+	band.tilemap->draw_roz_core(*band.screen, *band.dest, band.blit, band.startx, band.starty, band.incxx, band.incxy, band.incyx, band.incyy, band.wraparound);
+	return nullptr;
+}
+
 void tilemap_t::draw_roz(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect,
 		u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy,
 		bool wraparound, u32 flags, u8 priority, u8 priority_mask)
@@ -1576,7 +1677,8 @@ void tilemap_t::get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &col
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_work_queue(nullptr)
 {
 }
 
@@ -1600,6 +1702,22 @@ tilemap_manager::~tilemap_manager()
 				break;
 			}
 	}
+
+	if (m_work_queue)
+		osd_work_queue_free(m_work_queue);
+}
+
+
+//-------------------------------------------------
+//  work_queue - return the queue used for banded
+//  ROZ rendering, allocating it on first use
+//-------------------------------------------------
+
+osd_work_queue *tilemap_manager::work_queue()
+{
+	if (!m_work_queue)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	return m_work_queue;
 }
 
 
@@ -146,7 +146,10 @@
         any global state that is used by the tile_get_info callback but
         which is not reported via other calls to the tilemap code), you
         should invalidate the entire tilemap. You can do this by calling
-        tilemap_t::mark_all_dirty().
+        tilemap_t::mark_all_dirty(). If the change only affects tiles drawn
+        from a known range of colors (for example, a palette bank select
+        consulted by tile_get_info), tilemap_t::mark_palette_dirty() limits
+        the invalidation to those tiles.
 
     6. In your VIDEO_UPDATE callback, render the tiles by calling
         tilemap_t::draw() or tilemap_t::draw_roz(). If you need to do
@@ -457,6 +460,8 @@ public:
 	bitmap_ind16 &pixmap() { pixmap_update(); return m_pixmap; }
 	bitmap_ind8 &flagsmap() { pixmap_update(); return m_flagsmap; }
 	u8 *tile_flags() { pixmap_update(); return &m_tileflags[0]; }
+	device_t *device() const { return m_device; }
+	size_t memory_bytes() const;
 	tilemap_memory_index memory_index(u32 col, u32 row) { return m_mapper(col, row, m_cols, m_rows); }
 	void get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &color);
 
@@ -479,6 +484,8 @@ public:
 	void mark_mapping_dirty() { mappings_update(); }
 	void mark_tile_dirty(tilemap_memory_index memindex);
 	void mark_all_dirty() { m_all_tiles_dirty = true; m_all_tiles_clean = false; }
+	void mark_group_dirty(int group);
+	void mark_palette_dirty(pen_t start, u32 count);
 
 	// pen mapping
 	void map_pens_to_layer(int group, pen_t pen, pen_t mask, u8 layermask);
@@ -527,6 +534,23 @@ private:
 		u8                  alpha;
 	};
 
+	// parameters for rendering one horizontal band of a ROZ layer
+	template<class _BitmapClass>
+	struct roz_band_parameters
+	{
+		tilemap_t *         tilemap;
+		screen_device *     screen;
+		_BitmapClass *      dest;
+		blit_parameters     blit;
+		u32                 startx, starty;
+		int                 incxx, incxy, incyx, incyy;
+		bool                wraparound;
+	};
+
+	// ROZ layers taller than this are split into bands drawn in parallel
+	static constexpr int MIN_ROZ_BAND_ROWS = 32;
+	static constexpr int MAX_ROZ_BANDS = 16;
+
 	// inline helpers
 	s32 effective_rowscroll(int index, u32 screen_width);
 	s32 effective_colscroll(int index, u32 screen_height);
@@ -547,6 +571,7 @@ private:
 	void mappings_create();
 	void mappings_update();
 	void realize_all_dirty_tiles();
+	void mark_logical_dirty(logical_index logindex) { m_tileflags[logindex] = TILE_FLAG_DIRTY; m_rowdirty[logindex / m_cols] = true; m_all_tiles_clean = false; }
 
 	// internal drawing
 	void pixmap_update();
@@ -557,6 +582,7 @@ private:
 	template<class _BitmapClass> void draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_roz_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_instance(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int xpos, int ypos);
+	template<class _BitmapClass> static void *draw_roz_band(void *param, int threadid);
 	template<class _BitmapClass> void draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound);
 
 	// managers and devices
@@ -608,6 +634,9 @@ private:
 	// transparency mapping
 	bitmap_ind8                 m_flagsmap;             // per-pixel flags
 	std::vector<u8>             m_tileflags;            // per-tile flags
+	std::vector<u8>             m_tilegroup;            // per-tile pen group from the last render
+	std::vector<u32>            m_tilepalette;          // per-tile palette base from the last render
+	std::vector<u8>             m_rowdirty;             // per-row flag set when any tile in the row is dirty
 	u8                          m_pen_to_flags[MAX_PEN_TO_FLAGS * TILEMAP_NUM_GROUPS]; // mapping of pens to flags
 };
 
@@ -651,10 +680,14 @@ private:
 	// allocate an instance index
 	int alloc_instance() { return ++m_instance; }
 
+	// queue used to render large ROZ layers in bands
+	osd_work_queue *work_queue();
+
 	// internal state
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	osd_work_queue *        m_work_queue;
 };
 
 
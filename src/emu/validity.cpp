@@ -26,6 +26,27 @@
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+namespace {
+
+// drivers are validated in fixed-size chunks so the output doesn't depend on thread count
+constexpr std::size_t VALIDATE_CHUNK_SIZE = 16;
+
+struct validate_chunk_params
+{
+	validity_checker *parent;
+	game_driver const *const *begin;
+	game_driver const *const *end;
+	std::string output;
+	int errors;
+	int warnings;
+};
+
+// worker checker for the current thread, if any
+thread_local validity_checker *t_worker_checker = nullptr;
+
+} // anonymous namespace
+
+
 //**************************************************************************
 //  INLINE FUNCTIONS
 //**************************************************************************
@@ -121,6 +142,30 @@ void validity_checker::validate_tag(const char *tag)
 }
 
 
+//-------------------------------------------------
+//  already_checked - generic registry of things
+//  that only need checking once
+//-------------------------------------------------
+
+bool validity_checker::already_checked(const char *string)
+{
+	if (!m_already_checked.insert(string).second)
+		return true;
+
+	// workers also skip anything another worker has already found clean
+	if (m_parent)
+	{
+		{
+			std::lock_guard<std::mutex> guard(m_parent->m_shared_mutex);
+			if (m_parent->m_clean_checked.find(string) != m_parent->m_clean_checked.end())
+				return true;
+		}
+		m_pending_checked.emplace_back(string);
+	}
+	return false;
+}
+
+
 
 //**************************************************************************
 //  VALIDATION FUNCTIONS
@@ -140,6 +185,7 @@ validity_checker::validity_checker(emu_options &options, bool quick)
 	, m_current_ioport(nullptr)
 	, m_checking_card(false)
 	, m_quick(quick)
+	, m_parent(nullptr)
 {
 	// pre-populate the defstr map with all the default strings
 	for (int strnum = 1; strnum < INPUT_STRING_COUNT; strnum++)
@@ -150,13 +196,30 @@ validity_checker::validity_checker(emu_options &options, bool quick)
 	}
 }
 
+validity_checker::validity_checker(validity_checker &parent)
+	: m_drivlist(parent.m_drivlist.options())
+	, m_errors(0)
+	, m_warnings(0)
+	, m_print_verbose(parent.m_print_verbose)
+	, m_defstr_map(parent.m_defstr_map)
+	, m_current_driver(nullptr)
+	, m_current_device(nullptr)
+	, m_current_ioport(nullptr)
+	, m_checking_card(false)
+	, m_quick(parent.m_quick)
+	, m_parent(&parent)
+{
+}
+
 //-------------------------------------------------
 //  validity_checker - destructor
 //-------------------------------------------------
 
 validity_checker::~validity_checker()
 {
-	validate_end();
+	// workers never take over the outputs
+	if (!m_parent)
+		validate_end();
 }
 
 //-------------------------------------------------
@@ -219,17 +282,32 @@ bool validity_checker::check_all_matching(const char *string)
 		output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "\n");
 	}
 
-	// then iterate over all drivers and check them
+	// then gather all matching drivers, registering names and descriptions
+	// up front so duplicates are found the same way in any order
+	std::vector<game_driver const *> drivers;
 	m_drivlist.reset();
-	bool validated_any = false;
 	while (m_drivlist.next())
 	{
 		if (driver_list::matches(string, m_drivlist.driver().name))
 		{
-			validate_one(m_drivlist.driver());
-			validated_any = true;
+			game_driver const &driver(m_drivlist.driver());
+			drivers.emplace_back(&driver);
+			m_names_map.emplace(driver.name, &driver);
+			m_descriptions_map.emplace(driver.type.fullname(), &driver);
 		}
 	}
+	bool const validated_any = !drivers.empty();
+
+	// verbose output shows which driver is being validated in case one crashes, so keep it serial
+	if (m_print_verbose || (drivers.size() <= VALIDATE_CHUNK_SIZE))
+	{
+		for (game_driver const *driver : drivers)
+			validate_one(*driver);
+	}
+	else
+	{
+		validate_parallel(drivers);
+	}
 
 	// validate devices
 	if (!string)
@@ -338,6 +416,18 @@ void validity_checker::validate_one(const game_driver &driver)
 		output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "\n");
 	}
 
+	// if this driver was clean, so was everything it checked for the first time - let other workers skip it
+	if (m_parent && !m_pending_checked.empty())
+	{
+		if (m_errors == start_errors && m_warnings == start_warnings && m_verbose_text.empty())
+		{
+			std::lock_guard<std::mutex> guard(m_parent->m_shared_mutex);
+			for (std::string &checked : m_pending_checked)
+				m_parent->m_clean_checked.emplace(std::move(checked));
+		}
+		m_pending_checked.clear();
+	}
+
 	// reset the driver/device
 	m_current_driver = nullptr;
 	m_current_device = nullptr;
@@ -348,6 +438,81 @@ void validity_checker::validate_one(const game_driver &driver)
 }
 
 
+//-------------------------------------------------
+//  validate_parallel - validate drivers in
+//  chunks on worker threads, emitting results in
+//  the original order
+//-------------------------------------------------
+
+void validity_checker::validate_parallel(std::vector<game_driver const *> const &drivers)
+{
+	std::vector<validate_chunk_params> chunks((drivers.size() + VALIDATE_CHUNK_SIZE - 1) / VALIDATE_CHUNK_SIZE);
+	for (std::size_t index = 0; chunks.size() > index; ++index)
+	{
+		chunks[index].parent = this;
+		chunks[index].begin = &drivers[index * VALIDATE_CHUNK_SIZE];
+		chunks[index].end = &drivers[0] + std::min((index + 1) * VALIDATE_CHUNK_SIZE, drivers.size());
+		chunks[index].errors = 0;
+		chunks[index].warnings = 0;
+	}
+
+	osd_work_queue *const queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (!queue)
+	{
+		for (game_driver const *driver : drivers)
+			validate_one(*driver);
+		return;
+	}
+
+	std::vector<osd_work_item *> items;
+	items.reserve(chunks.size());
+	for (validate_chunk_params &chunk : chunks)
+		items.emplace_back(osd_work_item_queue(queue, &validity_checker::validate_chunk, &chunk, 0));
+
+	// collect the results in order as they finish
+	for (std::size_t index = 0; chunks.size() > index; ++index)
+	{
+		if (items[index])
+		{
+			while (!osd_work_item_wait(items[index], osd_ticks_per_second())) { }
+			osd_work_item_release(items[index]);
+		}
+		else
+		{
+			validate_chunk(&chunks[index], 0);
+		}
+
+		m_errors += chunks[index].errors;
+		m_warnings += chunks[index].warnings;
+		if (!chunks[index].output.empty())
+			output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "%s", chunks[index].output);
+	}
+	osd_work_queue_free(queue);
+}
+
+
+//-------------------------------------------------
+//  validate_chunk - work item callback for
+//  validating a run of drivers
+//-------------------------------------------------
+
+void *validity_checker::validate_chunk(void *param, int threadid)
+{
+	validate_chunk_params &chunk(*reinterpret_cast<validate_chunk_params *>(param));
+
+	validity_checker checker(*chunk.parent);
+	t_worker_checker = &checker;
+	for (game_driver const *const *driver = chunk.begin; chunk.end != driver; ++driver)
+		checker.validate_one(**driver);
+	t_worker_checker = nullptr;
+
+	chunk.output = std::move(checker.m_output);
+	chunk.errors = checker.m_errors;
+	chunk.warnings = checker.m_warnings;
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  validate_core - validate core internal systems
 //-------------------------------------------------
@@ -1460,19 +1625,24 @@ void validity_checker::validate_rgb()
 
 void validity_checker::validate_driver(device_t &root)
 {
-	// check for duplicate names
-	if (!m_names_map.insert(std::make_pair(m_current_driver->name, m_current_driver)).second)
+	// workers look up the parent's maps, which already hold every driver being validated
+	auto const first_driver = [this] (game_driver_map validity_checker::*map, std::string const &key)
 	{
-		const game_driver *match = m_names_map.find(m_current_driver->name)->second;
+		if (m_parent)
+			return (m_parent->*map).find(key)->second;
+		else
+			return (this->*map).emplace(key, m_current_driver).first->second;
+	};
+
+	// check for duplicate names
+	const game_driver *match = first_driver(&validity_checker::m_names_map, m_current_driver->name);
+	if (match != m_current_driver)
 		osd_printf_error("Driver name is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
-	}
 
 	// check for duplicate descriptions
-	if (!m_descriptions_map.insert(std::make_pair(m_current_driver->type.fullname(), m_current_driver)).second)
-	{
-		const game_driver *match = m_descriptions_map.find(m_current_driver->type.fullname())->second;
+	match = first_driver(&validity_checker::m_descriptions_map, m_current_driver->type.fullname());
+	if (match != m_current_driver)
 		osd_printf_error("Driver description is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
-	}
 
 	// determine if we are a clone
 	bool is_clone = (strcmp(m_current_driver->parent, "0") != 0);
@@ -2261,6 +2431,13 @@ void validity_checker::build_output_prefix(std::ostream &str) const
 
 void validity_checker::output_callback(osd_output_channel channel, const util::format_argument_pack<std::ostream> &args)
 {
+	// messages from a worker thread belong to its checker
+	if (t_worker_checker && (t_worker_checker != this))
+	{
+		t_worker_checker->output_callback(channel, args);
+		return;
+	}
+
 	std::ostringstream output;
 	switch (channel)
 	{
@@ -2301,7 +2478,15 @@ void validity_checker::output_callback(osd_output_channel channel, const util::f
 		break;
 
 	default:
-		chain_output(channel, args);
+		if (m_parent)
+		{
+			std::lock_guard<std::mutex> guard(m_parent->m_shared_mutex);
+			m_parent->chain_output(channel, args);
+		}
+		else
+		{
+			chain_output(channel, args);
+		}
 		break;
 	}
 }
@@ -2315,8 +2500,11 @@ void validity_checker::output_callback(osd_output_channel channel, const util::f
 template <typename Format, typename... Params>
 void validity_checker::output_via_delegate(osd_output_channel channel, Format &&fmt, Params &&...args)
 {
-	// call through to the delegate with the proper parameters
-	chain_output(channel, util::make_format_argument_pack(std::forward<Format>(fmt), std::forward<Params>(args)...));
+	// workers collect their output for the parent to emit in order
+	if (m_parent)
+		m_output.append(util::string_format(std::forward<Format>(fmt), std::forward<Params>(args)...));
+	else
+		chain_output(channel, util::make_format_argument_pack(std::forward<Format>(fmt), std::forward<Params>(args)...));
 }
 
 //-------------------------------------------------
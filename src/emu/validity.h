@@ -16,6 +16,9 @@
 #include "drivenum.h"
 #include "emuopts.h"
 
+#include <mutex>
+#include <vector>
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -47,7 +50,7 @@ public:
 	bool ioport_missing(const char *tag) { return !m_checking_card && (m_ioport_set.find(tag) == m_ioport_set.end()); }
 
 	// generic registry of already-checked stuff
-	bool already_checked(const char *string) { return !m_already_checked.insert(string).second; }
+	bool already_checked(const char *string);
 
 protected:
 	// osd_output interface
@@ -59,6 +62,9 @@ private:
 	using int_map = std::unordered_map<std::string, uintptr_t>;
 	using string_set = std::unordered_set<std::string>;
 
+	// worker checking a share of the drivers for a parent checker
+	validity_checker(validity_checker &parent);
+
 	// internal helpers
 	const char *ioport_string_from_index(u32 index);
 	int get_defstr_index(const char *string, bool suppress_error = false);
@@ -67,6 +73,8 @@ private:
 	void validate_begin();
 	void validate_end();
 	void validate_one(const game_driver &driver);
+	void validate_parallel(std::vector<game_driver const *> const &drivers);
+	static void *validate_chunk(void *param, int threadid);
 
 	// internal sub-checks
 	void validate_core();
@@ -121,6 +129,13 @@ private:
 	string_set              m_already_checked;
 	bool                    m_checking_card;
 	bool const              m_quick;
+
+	// parallel validation
+	validity_checker *const m_parent;
+	std::string             m_output;
+	std::vector<std::string> m_pending_checked;
+	std::mutex              m_shared_mutex;
+	string_set              m_clean_checked;
 };
 
 #endif // MAME_EMU_VALIDITY_H
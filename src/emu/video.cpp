@@ -54,6 +54,63 @@ const bool video_manager::s_skiptable[FRAMESKIP_LEVELS][FRAMESKIP_LEVELS] =
 
 
 
+//**************************************************************************
+//  FRAME TIME HISTOGRAM
+//**************************************************************************
+
+//-------------------------------------------------
+//  add - count one duration; below eight
+//  microseconds each microsecond has a bucket,
+//  above that each octave is split in eight
+//-------------------------------------------------
+
+void frame_time_histogram::add(osd_ticks_t ticks)
+{
+	u32 const us = u32(std::min<u64>(u64(ticks) * 1'000'000 / u64(osd_ticks_per_second()), ~u32(0)));
+	int bucket;
+	if (us < (1 << SUB_BITS))
+	{
+		bucket = int(us);
+	}
+	else
+	{
+		int const msb = 31 - count_leading_zeros(us);
+		bucket = ((msb - SUB_BITS + 1) << SUB_BITS) + int((us >> (msb - SUB_BITS)) & ((1 << SUB_BITS) - 1));
+	}
+	m_buckets[std::min(bucket, BUCKETS - 1)]++;
+	m_count++;
+}
+
+
+//-------------------------------------------------
+//  percentile - find the bucket holding the given
+//  fraction of samples and return its midpoint
+//-------------------------------------------------
+
+double frame_time_histogram::percentile(double fraction) const
+{
+	if (m_count == 0)
+		return 0.0;
+
+	u64 const target = std::max<u64>(1, u64(std::ceil(fraction * double(m_count))));
+	u64 seen = 0;
+	int bucket = 0;
+	for ( ; bucket < BUCKETS - 1; bucket++)
+	{
+		seen += m_buckets[bucket];
+		if (seen >= target)
+			break;
+	}
+
+	if (bucket < (1 << SUB_BITS))
+		return (double(bucket) + 0.5) * 1e-6;
+	int const shift = (bucket >> SUB_BITS) - 1;
+	u64 const lower = u64((1 << SUB_BITS) + (bucket & ((1 << SUB_BITS) - 1))) << shift;
+	return (double(lower) + double(u64(1) << shift) * 0.5) * 1e-6;
+}
+
+
+
 //**************************************************************************
 //  VIDEO MANAGER
 //**************************************************************************
@@ -85,13 +142,23 @@ video_manager::video_manager(running_machine &machine)
 	, m_overall_real_ticks(0)
 	, m_overall_emutime(attotime::zero)
 	, m_overall_valid_counter(0)
+	, m_frame_end_ticks(0)
 	, m_throttled(true)
 	, m_throttle_rate(1.0f)
 	, m_fastforward(false)
 	, m_seconds_to_run(machine.options().seconds_to_run())
+	, m_frames_to_run(machine.options().frames_to_run())
+	, m_frames_run(0)
+	, m_compute_only(false)
 	, m_auto_frameskip(machine.options().auto_frameskip())
 	, m_speed(original_speed_setting())
 	, m_low_latency(machine.options().low_latency())
+	, m_frame_delay(std::clamp(machine.options().frame_delay(), 0, 9))
+	, m_runahead(machine.options().runahead())
+	, m_speculating(false)
+	, m_speculative_frames(0)
+	, m_show_speculation(false)
+	, m_frame_completed(false)
 	, m_empty_skip_count(0)
 	, m_frameskip_max(m_auto_frameskip ? machine.options().frameskip() : 0)
 	, m_frameskip_level(m_auto_frameskip ? 0 : machine.options().frameskip())
@@ -116,6 +183,33 @@ video_manager::video_manager(running_machine &machine)
 	// extract initial execution state from global configuration settings
 	update_refresh_speed();
 
+	// compute-only mode is only meaningful if there's a point at which it ends
+	if (machine.options().compute_only())
+	{
+		if (m_seconds_to_run != 0 || m_frames_to_run != 0)
+		{
+			m_compute_only = true;
+			m_skipping_this_frame = true;
+		}
+		else
+			osd_printf_warning("Warning: -compute_only ignored without -seconds_to_run or -frames_to_run\n");
+	}
+
+	// run-ahead rewinds with save states, and stopping in the debugger partway through a speculative frame would be confusing
+	if (m_runahead != 0)
+	{
+		if (m_compute_only || (machine.debug_flags & DEBUG_FLAG_ENABLED) || !(machine.system().flags & MACHINE_SUPPORTS_SAVE) || machine.options().netplay()[0] != 0)
+		{
+			osd_printf_warning("Warning: -runahead ignored for systems without save state support, with the debugger, with -compute_only or with -netplay\n");
+			m_runahead = 0;
+		}
+		else
+		{
+			// real frames are never shown, only the last of the speculative frames run after them
+			m_skipping_this_frame = true;
+		}
+	}
+
 	const unsigned screen_count(screen_device_enumerator(machine.root_device()).count());
 	const bool no_screens(!screen_count);
 
@@ -212,7 +306,42 @@ void video_manager::frame_update(bool from_debugger)
 {
 	// only render sound and video if we're in the running phase
 	machine_phase const phase = machine().phase();
-	bool skipped_it = m_skipping_this_frame;
+
+	// in compute-only mode, do the bare minimum needed to keep the emulation going; frame
+	// notifiers still run so scripts get one callback per emulated frame
+	if (m_compute_only && !m_speculating && !from_debugger && !machine().paused())
+	{
+		emulator_info::periodic_check();
+		if (phase > machine_phase::INIT)
+		{
+			machine().call_notifiers(MACHINE_NOTIFY_FRAME);
+			if (phase == machine_phase::RUNNING)
+				m_frames_run++;
+			check_run_limit(machine().time());
+		}
+		return;
+	}
+
+	// a speculative frame is neither throttled nor counted, and at most the last one is shown
+	if (m_speculating && !from_debugger)
+	{
+		machine().ioport().speculative_frame_update();
+		if (--m_speculative_frames == 0 && m_show_speculation)
+		{
+			if (phase == machine_phase::RUNNING)
+				finish_screen_updates();
+			emulator_info::draw_user_interface(machine());
+			g_profiler.start(PROFILER_BLIT);
+			machine().osd().update(false);
+			g_profiler.stop();
+		}
+		m_skipping_this_frame = !m_show_speculation || m_speculative_frames != 1;
+		return;
+	}
+
+	// nothing runs ahead while paused, so the real frame has to be shown
+	osd_ticks_t const frame_start_ticks = osd_ticks();
+	bool skipped_it = m_skipping_this_frame && !(m_runahead != 0 && machine().paused());
 	if (phase == machine_phase::RUNNING && (!machine().paused() || machine().options().update_in_pause()))
 	{
 		bool anything_changed = finish_screen_updates();
@@ -228,20 +357,51 @@ void video_manager::frame_update(bool from_debugger)
 
 	// draw the user interface
 	emulator_info::draw_user_interface(machine());
+	osd_ticks_t const rendered_ticks = osd_ticks();
+	osd_ticks_t throttle_ticks = 0;
+
+	// with run-ahead, real frames are throttled but never shown
+	bool const throttle_it = !skipped_it || m_runahead != 0;
 
 	// if we're throttling, synchronize before rendering
 	attotime current_time = machine().time();
-	if (!from_debugger && !skipped_it && phase > machine_phase::INIT && !m_low_latency && effective_throttle())
+	if (!from_debugger && throttle_it && phase > machine_phase::INIT && !m_low_latency && effective_throttle())
+	{
 		update_throttle(current_time);
+		throttle_ticks += osd_ticks() - rendered_ticks;
+	}
 
 	// ask the OSD to update
+	osd_ticks_t const present_start_ticks = osd_ticks();
 	g_profiler.start(PROFILER_BLIT);
 	machine().osd().update(!from_debugger && skipped_it);
 	g_profiler.stop();
+	osd_ticks_t const present_ticks = osd_ticks() - present_start_ticks;
 
 	// we synchronize after rendering instead of before, if low latency mode is enabled
-	if (!from_debugger && !skipped_it && phase > machine_phase::INIT && m_low_latency && effective_throttle())
+	if (!from_debugger && throttle_it && phase > machine_phase::INIT && m_low_latency && effective_throttle())
+	{
 		update_throttle(current_time);
+		throttle_ticks += osd_ticks() - present_start_ticks - present_ticks;
+	}
+
+	// with a frame delay, the time between presenting a frame and emulating the next is spent
+	// waiting, so the input read below is as fresh as possible when the next frame is shown
+	if (!from_debugger && throttle_it && phase > machine_phase::INIT && m_frame_delay && !machine().paused() && effective_throttle())
+	{
+		osd_ticks_t const delay_start_ticks = osd_ticks();
+		delay_next_frame();
+		throttle_ticks += osd_ticks() - delay_start_ticks;
+	}
+
+	// record where the time went for frames shown at the throttled rate
+	if (!from_debugger)
+	{
+		if (throttle_it && phase == machine_phase::RUNNING && !machine().paused() && effective_throttle())
+			record_frame_times(frame_start_ticks, rendered_ticks, throttle_ticks, present_ticks);
+		else if (phase != machine_phase::RUNNING || machine().paused() || !effective_throttle())
+			m_frame_end_ticks = 0;
+	}
 
 	// get most recent input now
 	machine().osd().input_update();
@@ -258,8 +418,17 @@ void video_manager::frame_update(bool from_debugger)
 			update_frameskip();
 
 		// update speed computations
-		if (!skipped_it && phase > machine_phase::INIT)
+		if (throttle_it && phase > machine_phase::INIT)
 			recompute_speed(current_time);
+
+		// count the frame and see if it's time to go
+		if (phase == machine_phase::RUNNING && !machine().paused())
+		{
+			m_frames_run++;
+			m_frame_completed = true;
+		}
+		if (phase > machine_phase::INIT)
+			check_run_limit(current_time);
 	}
 
 	// call the end-of-frame callback
@@ -339,7 +508,7 @@ void video_manager::save_snapshot(screen_device *screen, emu_file &file)
 	// now do the actual work
 	const rgb_t *palette = (screen != nullptr && screen->has_palette()) ? screen->palette().palette()->entry_list_adjusted() : nullptr;
 	int entries = (screen != nullptr && screen->has_palette()) ? screen->palette().entries() : 0;
-	util::png_error error = util::png_write_bitmap(file, &pnginfo, m_snap_bitmap, entries, palette);
+	util::png_error error = util::png_write_bitmap(file, &pnginfo, m_snap_bitmap, entries, palette, machine().options().snap_compression());
 	if (error != util::png_error::NONE)
 		osd_printf_error("Error generating PNG for snapshot: png_error = %d\n", std::underlying_type_t<util::png_error>(error));
 }
@@ -522,10 +691,11 @@ void video_manager::exit()
 	// print a final result if we have at least 2 seconds' worth of data
 	if (!emulator_info::standalone() && m_overall_emutime.seconds() >= 1)
 	{
-		osd_ticks_t tps = osd_ticks_per_second();
-		double final_real_time = (double)m_overall_real_seconds + (double)m_overall_real_ticks / (double)tps;
+		double final_real_time = overall_real_time();
 		double final_emu_time = m_overall_emutime.as_double();
 		osd_printf_info("Average speed: %.2f%% (%d seconds)\n", 100 * final_emu_time / final_real_time, (m_overall_emutime + attotime(0, ATTOSECONDS_PER_SECOND / 2)).seconds());
+		if (m_frame_times[int(frame_phase::TOTAL)].count() != 0)
+			osd_printf_info("%s", frame_time_text());
 	}
 }
 
@@ -864,6 +1034,28 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 }
 
 
+//-------------------------------------------------
+//  delay_next_frame - wait part of a frame after
+//  presenting; with -waitvsync the OSD update
+//  returns at vblank, so this moves the start of
+//  the next frame (and its input sampling) later
+//  in the display's refresh
+//-------------------------------------------------
+
+void video_manager::delay_next_frame()
+{
+	// the first screen's refresh rate sets the frame length
+	screen_device *const screen = screen_device_enumerator(machine().root_device()).first();
+	attoseconds_t period = screen ? screen->frame_period().attoseconds() : (ATTOSECONDS_PER_SECOND / 60);
+	if (m_speed != 0 && m_speed != 1000)
+		period = period / m_speed * 1000;
+	period = attoseconds_t(period / m_throttle_rate);
+
+	osd_ticks_t const delay = osd_ticks_t(ATTOSECONDS_TO_DOUBLE(period) * osd_ticks_per_second() * m_frame_delay / 10);
+	throttle_until_ticks(osd_ticks() + delay);
+}
+
+
 //-------------------------------------------------
 //  update_frameskip - update frameskipping
 //  counters and periodically update autoframeskip
@@ -909,7 +1101,35 @@ void video_manager::update_frameskip()
 
 	// increment the frameskip counter and determine if we will skip the next frame
 	m_frameskip_counter = (m_frameskip_counter + 1) % FRAMESKIP_LEVELS;
-	m_skipping_this_frame = s_skiptable[effective_frameskip()][m_frameskip_counter];
+	m_skipping_this_frame = m_runahead || s_skiptable[effective_frameskip()][m_frameskip_counter];
+}
+
+
+//-------------------------------------------------
+//  begin_speculation - start running frames that
+//  will be thrown away again or have been run
+//  before, drawing at most the last of them
+//-------------------------------------------------
+
+void video_manager::begin_speculation(int frames, bool show_last)
+{
+	m_speculating = true;
+	m_speculative_frames = frames;
+	m_show_speculation = show_last;
+	m_skipping_this_frame = !m_show_speculation || m_speculative_frames != 1;
+}
+
+
+//-------------------------------------------------
+//  end_speculation - go back to running real
+//  frames
+//-------------------------------------------------
+
+void video_manager::end_speculation()
+{
+	m_speculating = false;
+	m_speculative_frames = 0;
+	m_skipping_this_frame = m_runahead || s_skiptable[effective_frameskip()][m_frameskip_counter];
 }
 
 
@@ -1001,20 +1221,121 @@ void video_manager::recompute_speed(const attotime &emutime)
 			m_overall_emutime += delta_emutime;
 		}
 	}
+}
 
-	// if we're past the "time-to-execute" requested, signal an exit
-	if (m_seconds_to_run != 0 && emutime.seconds() >= m_seconds_to_run)
+
+//-------------------------------------------------
+//  record_frame_times - add the durations of the
+//  parts of a shown frame to the histograms; the
+//  emulation part is everything since the last
+//  recorded frame ended, skipped frames included
+//-------------------------------------------------
+
+void video_manager::record_frame_times(osd_ticks_t start, osd_ticks_t rendered, osd_ticks_t throttle, osd_ticks_t present)
+{
+	osd_ticks_t const end = osd_ticks();
+	if (m_frame_end_ticks != 0)
 	{
-		// create a final screenshot
-		emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-		osd_file::error filerr = file.open(machine().basename() + PATH_SEPARATOR "final.png");
-		if (filerr == osd_file::error::NONE)
-			save_snapshot(nullptr, file);
+		m_frame_times[int(frame_phase::EMULATE)].add(start - m_frame_end_ticks);
+		m_frame_times[int(frame_phase::TOTAL)].add(end - m_frame_end_ticks);
+	}
+	m_frame_times[int(frame_phase::RENDER)].add(rendered - start);
+	m_frame_times[int(frame_phase::THROTTLE)].add(throttle);
+	m_frame_times[int(frame_phase::PRESENT)].add(present);
+	m_frame_end_ticks = end;
+}
 
-		//printf("Scheduled exit at %f\n", emutime.as_double());
-		// schedule our demise
-		machine().schedule_exit();
+
+//-------------------------------------------------
+//  frame_phase_name - name of a part of the frame
+//-------------------------------------------------
+
+const char *video_manager::frame_phase_name(frame_phase phase)
+{
+	switch (phase)
+	{
+	case frame_phase::EMULATE:  return "emulate";
+	case frame_phase::RENDER:   return "render";
+	case frame_phase::THROTTLE: return "throttle";
+	case frame_phase::PRESENT:  return "present";
+	case frame_phase::TOTAL:    return "frame";
+	default:                    return "";
+	}
+}
+
+
+//-------------------------------------------------
+//  frame_time_text - p50/p95/p99 of each part of
+//  the frame in milliseconds, one line per part
+//-------------------------------------------------
+
+std::string video_manager::frame_time_text() const
+{
+	std::ostringstream stream;
+	for (int phase = 0; phase < int(frame_phase::COUNT); phase++)
+	{
+		frame_time_histogram const &times = m_frame_times[phase];
+		if (times.count() != 0)
+			util::stream_format(stream, "%-8s p50 %6.2f  p95 %6.2f  p99 %6.2f ms\n",
+					frame_phase_name(frame_phase(phase)),
+					times.percentile(0.50) * 1000.0,
+					times.percentile(0.95) * 1000.0,
+					times.percentile(0.99) * 1000.0);
 	}
+	return stream.str();
+}
+
+
+//-------------------------------------------------
+//  set_compute_only - enter or leave the mode
+//  that skips all output; leaving it draws the
+//  current state of the screens
+//-------------------------------------------------
+
+void video_manager::set_compute_only(bool compute_only)
+{
+	if (compute_only == m_compute_only)
+		return;
+
+	m_compute_only = compute_only;
+	m_skipping_this_frame = compute_only;
+	if (!compute_only && machine().phase() == machine_phase::RUNNING)
+		finish_screen_updates();
+}
+
+
+//-------------------------------------------------
+//  check_run_limit - exit once the requested
+//  number of seconds or frames has been run,
+//  leaving a final screenshot (and optionally a
+//  saved state) behind
+//-------------------------------------------------
+
+void video_manager::check_run_limit(const attotime &emutime)
+{
+	// if we're past the "time-to-execute" requested, signal an exit
+	bool const time_reached = m_seconds_to_run != 0 && emutime.seconds() >= m_seconds_to_run;
+	bool const frames_reached = m_frames_to_run != 0 && m_frames_run >= m_frames_to_run;
+	if ((!time_reached && !frames_reached) || machine().exit_pending())
+		return;
+
+	// leave compute-only mode so the snapshot is valid
+	set_compute_only(false);
+
+	// create a final screenshot
+	emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	osd_file::error filerr = file.open(machine().basename() + PATH_SEPARATOR "final.png");
+	if (filerr == osd_file::error::NONE)
+		save_snapshot(nullptr, file);
+
+	//printf("Scheduled exit at %f\n", emutime.as_double());
+	// schedule our demise
+	machine().schedule_exit();
+
+	// write a final saved state if requested; this is handled before the exit takes effect
+	char const *const statename = machine().options().final_state();
+	if (statename && *statename)
+		machine().schedule_save(statename);
 }
 
 
@@ -1262,7 +1583,7 @@ void video_manager::toggle_record_movie(movie_recording::format format)
 	if (!is_recording())
 	{
 		begin_recording(nullptr, format);
-		machine().popmessage("REC START (%s)", format == movie_recording::format::MNG ? "MNG" : "AVI");
+		machine().popmessage("REC START (%s)", movie_recording::format_name(format));
 	}
 	else
 	{
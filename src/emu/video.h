@@ -33,6 +33,31 @@ constexpr int MAX_FRAMESKIP = FRAMESKIP_LEVELS - 2;
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+// ======================> frame_time_histogram
+
+// log-scale histogram of durations, eight buckets per octave from one
+// microsecond to half a minute
+class frame_time_histogram
+{
+public:
+	frame_time_histogram() { reset(); }
+
+	void reset() { std::fill(std::begin(m_buckets), std::end(m_buckets), 0); m_count = 0; }
+	void add(osd_ticks_t ticks);
+	u64 count() const { return m_count; }
+
+	// duration in seconds that the given fraction of samples don't exceed
+	double percentile(double fraction) const;
+
+private:
+	static constexpr int SUB_BITS = 3;
+	static constexpr int BUCKETS = 23 << SUB_BITS;
+
+	u32                 m_buckets[BUCKETS];
+	u64                 m_count;
+};
+
+
 // ======================> video_manager
 
 class video_manager
@@ -51,6 +76,10 @@ public:
 	bool throttled() const { return m_throttled; }
 	float throttle_rate() const { return m_throttle_rate; }
 	bool fastforward() const { return m_fastforward; }
+	bool compute_only() const { return m_compute_only; }
+	bool output_suppressed() const { return m_compute_only || m_speculating; }
+	int runahead() const { return m_runahead; }
+	u64 frames_run() const { return m_frames_run; }
 
 	// setters
 	void set_frameskip(int frameskip);
@@ -58,6 +87,7 @@ public:
 	void set_throttle_rate(float throttle_rate) { m_throttle_rate = throttle_rate; }
 	void set_fastforward(bool ffwd) { m_fastforward = ffwd; }
 	void set_output_changed() { m_output_changed = true; }
+	void set_compute_only(bool compute_only);
 
 	// misc
 	void toggle_record_movie(movie_recording::format format);
@@ -68,11 +98,25 @@ public:
 	// render a frame
 	void frame_update(bool from_debugger = false);
 
+	// run-ahead: frames emulated past the real one and thrown away again
+	bool take_frame_completed() { bool const completed = m_frame_completed; m_frame_completed = false; return completed; }
+	void begin_speculation(int frames, bool show_last);
+	void end_speculation();
+	bool speculating() const { return m_speculative_frames != 0; }
+
 	// current speed helpers
 	std::string speed_text();
 	double speed_percent() const { return m_speed_percent; }
+	attotime overall_emulated_time() const { return m_overall_emutime; }
+	double overall_real_time() const { return double(m_overall_real_seconds) + double(m_overall_real_ticks) / double(osd_ticks_per_second()); }
 	int effective_frameskip() const;
 
+	// frame time distribution, recorded for throttled frames while running
+	enum class frame_phase { EMULATE, RENDER, THROTTLE, PRESENT, TOTAL, COUNT };
+	static const char *frame_phase_name(frame_phase phase);
+	const frame_time_histogram &frame_times(frame_phase phase) const { return m_frame_times[int(phase)]; }
+	std::string frame_time_text() const;
+
 	// snapshots
 	bool snap_native() const { return m_snap_native; }
 	render_target &snapshot_target() { return *m_snap_target; }
@@ -111,9 +155,12 @@ private:
 	bool finish_screen_updates();
 	void update_throttle(attotime emutime);
 	osd_ticks_t throttle_until_ticks(osd_ticks_t target_ticks);
+	void delay_next_frame();
 	void update_frameskip();
 	void update_refresh_speed();
 	void recompute_speed(const attotime &emutime);
+	void check_run_limit(const attotime &emutime);
+	void record_frame_times(osd_ticks_t start, osd_ticks_t rendered, osd_ticks_t throttle, osd_ticks_t present);
 
 	// snapshot/movie helpers
 	void create_snapshot_bitmap(screen_device *screen);
@@ -146,14 +193,29 @@ private:
 	attotime            m_overall_emutime;          // accumulated emulated time at normal speed
 	u32                 m_overall_valid_counter;    // number of consecutive valid time periods
 
+	// frame time distribution
+	frame_time_histogram m_frame_times[int(frame_phase::COUNT)]; // durations of each part of the frame
+	osd_ticks_t         m_frame_end_ticks;          // osd_ticks at the end of the last recorded frame, or 0
+
 	// configuration
 	bool                m_throttled;                // flag: true if we're currently throttled
 	float               m_throttle_rate;            // target rate for throttling
 	bool                m_fastforward;              // flag: true if we're currently fast-forwarding
 	u32                 m_seconds_to_run;           // number of seconds to run before quitting
+	u32                 m_frames_to_run;            // number of frames to run before quitting
+	u64                 m_frames_run;               // number of frames run so far
+	bool                m_compute_only;             // flag: true if we're skipping all output until the run limit
 	bool                m_auto_frameskip;           // flag: true if we're automatically frameskipping
 	u32                 m_speed;                    // overall speed (*1000)
 	bool                m_low_latency;              // flag: true if we are throttling after blitting
+	int                 m_frame_delay;              // tenths of a frame to wait after presenting before emulating the next
+
+	// run-ahead
+	int                 m_runahead;                 // number of frames to run ahead of each real one
+	bool                m_speculating;              // flag: true while running ahead
+	int                 m_speculative_frames;       // speculative frames left to run
+	bool                m_show_speculation;         // flag: true to show the last speculative frame
+	bool                m_frame_completed;          // flag: true once a real frame has been completed
 
 	// frameskipping
 	u8                  m_empty_skip_count;         // number of empty frames we have skipped
@@ -0,0 +1,123 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    rgbavx.h
+
+    AVX2 optimised RGB utilities for two pixels at a time.
+
+    Each 128-bit half of the register holds one pixel laid out as the
+    SSE rgbaint_t has it.  AVX2 packs and unpacks work within halves, so
+    operations follow the SSE version step for step and give the same
+    results.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_RGBAVX_H
+#define MAME_EMU_VIDEO_RGBAVX_H
+
+#pragma once
+
+#include <immintrin.h>
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+class rgbaint2_t
+{
+public:
+	rgbaint2_t() { }
+	rgbaint2_t(u32 rgba0, u32 rgba1) { set(rgba0, rgba1); }
+	rgbaint2_t(const rgbaint_t& pixel0, const rgbaint_t& pixel1) { set(pixel0, pixel1); }
+	explicit rgbaint2_t(__m256i value) { m_value = value; }
+
+	rgbaint2_t(const rgbaint2_t& other) = default;
+	rgbaint2_t &operator=(const rgbaint2_t& other) = default;
+
+	void set(u32 rgba0, u32 rgba1) { m_value = _mm256_cvtepu8_epi32(_mm_unpacklo_epi32(_mm_cvtsi32_si128(rgba0), _mm_cvtsi32_si128(rgba1))); }
+	void set(const u32 *rgba) { m_value = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)rgba)); }
+	void set(const rgbaint_t& pixel0, const rgbaint_t& pixel1) { m_value = _mm256_inserti128_si256(_mm256_castsi128_si256(pixel0.m_value), pixel1.m_value, 1); }
+	void set_all(const s32 val) { m_value = _mm256_set1_epi32(val); }
+	void zero() { m_value = _mm256_setzero_si256(); }
+
+	rgbaint_t pixel0() const { return rgbaint_t(_mm256_castsi256_si128(m_value)); }
+	rgbaint_t pixel1() const { return rgbaint_t(_mm256_extracti128_si256(m_value, 1)); }
+
+	// store both pixels to consecutive locations
+	void to_rgba_clamp(u32 *dest) const
+	{
+		const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(m_value, _mm256_setzero_si256()), _mm256_setzero_si256());
+		_mm_storel_epi64((__m128i *)dest, _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(packed, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 4, 0))));
+	}
+
+	void add(const rgbaint2_t& color2) { m_value = _mm256_add_epi32(m_value, color2.m_value); }
+	void add_imm(const s32 imm) { m_value = _mm256_add_epi32(m_value, _mm256_set1_epi32(imm)); }
+	void sub(const rgbaint2_t& color2) { m_value = _mm256_sub_epi32(m_value, color2.m_value); }
+	void sub_imm(const s32 imm) { m_value = _mm256_sub_epi32(m_value, _mm256_set1_epi32(imm)); }
+	void subr(const rgbaint2_t& color2) { m_value = _mm256_sub_epi32(color2.m_value, m_value); }
+	void subr_imm(const s32 imm) { m_value = _mm256_sub_epi32(_mm256_set1_epi32(imm), m_value); }
+	void mul(const rgbaint2_t& color) { m_value = _mm256_mullo_epi32(m_value, color.m_value); }
+	void mul_imm(const s32 imm) { m_value = _mm256_mullo_epi32(m_value, _mm256_set1_epi32(imm)); }
+
+	void shl_imm(const u8 shift) { m_value = _mm256_sll_epi32(m_value, _mm_cvtsi32_si128(shift)); }
+	void shr_imm(const u8 shift) { m_value = _mm256_srl_epi32(m_value, _mm_cvtsi32_si128(shift)); }
+	void sra_imm(const u8 shift) { m_value = _mm256_sra_epi32(m_value, _mm_cvtsi32_si128(shift)); }
+
+	void or_reg(const rgbaint2_t& color2) { m_value = _mm256_or_si256(m_value, color2.m_value); }
+	void and_reg(const rgbaint2_t& color2) { m_value = _mm256_and_si256(m_value, color2.m_value); }
+	void xor_reg(const rgbaint2_t& color2) { m_value = _mm256_xor_si256(m_value, color2.m_value); }
+	void andnot_reg(const rgbaint2_t& color2) { m_value = _mm256_andnot_si256(color2.m_value, m_value); }
+
+	void or_imm(s32 value) { m_value = _mm256_or_si256(m_value, _mm256_set1_epi32(value)); }
+	void and_imm(s32 value) { m_value = _mm256_and_si256(m_value, _mm256_set1_epi32(value)); }
+	void xor_imm(s32 value) { m_value = _mm256_xor_si256(m_value, _mm256_set1_epi32(value)); }
+
+	void clamp_to_uint8() { m_value = _mm256_min_epi32(_mm256_max_epi32(m_value, _mm256_setzero_si256()), _mm256_set1_epi32(255)); }
+	void min(const s32 value) { m_value = _mm256_min_epi32(m_value, _mm256_set1_epi32(value)); }
+	void max(const s32 value) { m_value = _mm256_max_epi32(m_value, _mm256_set1_epi32(value)); }
+
+	void blend(const rgbaint2_t& other, u8 factor)
+	{
+		const __m256i scaled_other = _mm256_mullo_epi32(other.m_value, _mm256_set1_epi32(0x100 - factor));
+		m_value = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(m_value, _mm256_set1_epi32(factor)), scaled_other), 8);
+	}
+
+	void scale_and_clamp(const rgbaint2_t& scale)
+	{
+		mul(scale);
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	// This version needs absolute value of value and scale to be 11 bits or less
+	void scale_imm_and_clamp(const s16 scale)
+	{
+		const __m256i immv = _mm256_slli_epi16(_mm256_set1_epi16(scale), 4);
+		m_value = _mm256_slli_epi16(_mm256_packs_epi32(m_value, _mm256_setzero_si256()), 4);
+		m_value = _mm256_packus_epi16(_mm256_mulhi_epi16(m_value, immv), _mm256_setzero_si256());
+		m_value = _mm256_unpacklo_epi16(_mm256_unpacklo_epi8(m_value, _mm256_setzero_si256()), _mm256_setzero_si256());
+	}
+
+	// This function needs absolute value of color and scale to be 11 bits or less
+	void scale_add_and_clamp(const rgbaint2_t& scale, const rgbaint2_t& other)
+	{
+		const __m256i factor = _mm256_slli_epi16(_mm256_packs_epi32(scale.m_value, _mm256_setzero_si256()), 4);
+		m_value = _mm256_slli_epi16(_mm256_packs_epi32(m_value, _mm256_setzero_si256()), 4);
+		m_value = _mm256_srai_epi32(_mm256_unpacklo_epi16(_mm256_setzero_si256(), _mm256_mulhi_epi16(m_value, factor)), 16);
+		add(other);
+		clamp_to_uint8();
+	}
+
+	rgbaint2_t& operator+=(const rgbaint2_t& other) { add(other); return *this; }
+	rgbaint2_t& operator-=(const rgbaint2_t& other) { sub(other); return *this; }
+	rgbaint2_t& operator*=(const rgbaint2_t& other) { mul(other); return *this; }
+	rgbaint2_t& operator*=(const s32 other) { mul_imm(other); return *this; }
+	rgbaint2_t& operator>>=(const s32 shift) { sra_imm(shift); return *this; }
+
+protected:
+	__m256i m_value;
+};
+
+#endif // MAME_EMU_VIDEO_RGBAVX_H
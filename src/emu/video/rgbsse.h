@@ -479,6 +479,8 @@ public:
 	}
 
 protected:
+	friend class rgbaint2_t;
+
 	struct _statics
 	{
 		__m128  dummy_for_alignment;
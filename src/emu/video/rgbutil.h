@@ -7,6 +7,9 @@
     Utility definitions for RGB manipulation. Allows RGB handling to be
     performed in an abstracted fashion and optimized with SIMD.
 
+    rgbaint_t holds one pixel; rgbaint2_t holds two for batched pixel
+    processing, in a single register where AVX2 is available.
+
 ***************************************************************************/
 
 #ifndef MAME_EMU_VIDEO_RGBUTIL_H
@@ -17,16 +20,30 @@
 
 #define MAME_RGB_HIGH_PRECISION
 #include "rgbsse.h"
+#if defined(__AVX2__)
+#define MAME_RGB_AVX2
+#endif
 
 #elif defined(__ALTIVEC__)
 
 #define MAME_RGB_HIGH_PRECISION
 #include "rgbvmx.h"
 
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && !defined(__ARM_BIG_ENDIAN)
+
+#define MAME_RGB_HIGH_PRECISION
+#include "rgbneon.h"
+
 #else
 
 #include "rgbgen.h"
 
 #endif
 
+#if defined(MAME_RGB_AVX2)
+#include "rgbavx.h"
+#else
+#include "rgbwide.h"
+#endif
+
 #endif // MAME_EMU_VIDEO_RGBUTIL_H
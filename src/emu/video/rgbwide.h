@@ -0,0 +1,91 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    rgbwide.h
+
+    General RGB utilities for two pixels at a time.
+
+    This version holds the pixels in a pair of rgbaint_t, so it uses
+    whatever SIMD the single-pixel version does.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_RGBWIDE_H
+#define MAME_EMU_VIDEO_RGBWIDE_H
+
+#pragma once
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+class rgbaint2_t
+{
+public:
+	rgbaint2_t() { }
+	rgbaint2_t(u32 rgba0, u32 rgba1) { set(rgba0, rgba1); }
+	rgbaint2_t(const rgbaint_t& pixel0, const rgbaint_t& pixel1) { set(pixel0, pixel1); }
+
+	rgbaint2_t(const rgbaint2_t& other) = default;
+	rgbaint2_t &operator=(const rgbaint2_t& other) = default;
+
+	void set(u32 rgba0, u32 rgba1) { m_pixel[0].set(rgba0); m_pixel[1].set(rgba1); }
+	void set(const u32 *rgba) { set(rgba[0], rgba[1]); }
+	void set(const rgbaint_t& pixel0, const rgbaint_t& pixel1) { m_pixel[0] = pixel0; m_pixel[1] = pixel1; }
+	void set_all(const s32 val) { m_pixel[0].set_all(val); m_pixel[1].set_all(val); }
+	void zero() { m_pixel[0].zero(); m_pixel[1].zero(); }
+
+	rgbaint_t pixel0() const { return m_pixel[0]; }
+	rgbaint_t pixel1() const { return m_pixel[1]; }
+
+	// store both pixels to consecutive locations
+	void to_rgba_clamp(u32 *dest) const { dest[0] = m_pixel[0].to_rgba_clamp(); dest[1] = m_pixel[1].to_rgba_clamp(); }
+
+	void add(const rgbaint2_t& color2) { m_pixel[0].add(color2.m_pixel[0]); m_pixel[1].add(color2.m_pixel[1]); }
+	void add_imm(const s32 imm) { m_pixel[0].add_imm(imm); m_pixel[1].add_imm(imm); }
+	void sub(const rgbaint2_t& color2) { m_pixel[0].sub(color2.m_pixel[0]); m_pixel[1].sub(color2.m_pixel[1]); }
+	void sub_imm(const s32 imm) { m_pixel[0].sub_imm(imm); m_pixel[1].sub_imm(imm); }
+	void subr(const rgbaint2_t& color2) { m_pixel[0].subr(color2.m_pixel[0]); m_pixel[1].subr(color2.m_pixel[1]); }
+	void subr_imm(const s32 imm) { m_pixel[0].subr_imm(imm); m_pixel[1].subr_imm(imm); }
+	void mul(const rgbaint2_t& color) { m_pixel[0].mul(color.m_pixel[0]); m_pixel[1].mul(color.m_pixel[1]); }
+	void mul_imm(const s32 imm) { m_pixel[0].mul_imm(imm); m_pixel[1].mul_imm(imm); }
+
+	void shl_imm(const u8 shift) { m_pixel[0].shl_imm(shift); m_pixel[1].shl_imm(shift); }
+	void shr_imm(const u8 shift) { m_pixel[0].shr_imm(shift); m_pixel[1].shr_imm(shift); }
+	void sra_imm(const u8 shift) { m_pixel[0].sra_imm(shift); m_pixel[1].sra_imm(shift); }
+
+	void or_reg(const rgbaint2_t& color2) { m_pixel[0].or_reg(color2.m_pixel[0]); m_pixel[1].or_reg(color2.m_pixel[1]); }
+	void and_reg(const rgbaint2_t& color2) { m_pixel[0].and_reg(color2.m_pixel[0]); m_pixel[1].and_reg(color2.m_pixel[1]); }
+	void xor_reg(const rgbaint2_t& color2) { m_pixel[0].xor_reg(color2.m_pixel[0]); m_pixel[1].xor_reg(color2.m_pixel[1]); }
+	void andnot_reg(const rgbaint2_t& color2) { m_pixel[0].andnot_reg(color2.m_pixel[0]); m_pixel[1].andnot_reg(color2.m_pixel[1]); }
+
+	void or_imm(s32 value) { m_pixel[0].or_imm(value); m_pixel[1].or_imm(value); }
+	void and_imm(s32 value) { m_pixel[0].and_imm(value); m_pixel[1].and_imm(value); }
+	void xor_imm(s32 value) { m_pixel[0].xor_imm(value); m_pixel[1].xor_imm(value); }
+
+	void clamp_to_uint8() { m_pixel[0].clamp_to_uint8(); m_pixel[1].clamp_to_uint8(); }
+	void min(const s32 value) { m_pixel[0].min(value); m_pixel[1].min(value); }
+	void max(const s32 value) { m_pixel[0].max(value); m_pixel[1].max(value); }
+
+	void blend(const rgbaint2_t& other, u8 factor) { m_pixel[0].blend(other.m_pixel[0], factor); m_pixel[1].blend(other.m_pixel[1], factor); }
+	void scale_and_clamp(const rgbaint2_t& scale) { m_pixel[0].scale_and_clamp(scale.m_pixel[0]); m_pixel[1].scale_and_clamp(scale.m_pixel[1]); }
+	void scale_imm_and_clamp(const s16 scale) { m_pixel[0].scale_imm_and_clamp(scale); m_pixel[1].scale_imm_and_clamp(scale); }
+	void scale_add_and_clamp(const rgbaint2_t& scale, const rgbaint2_t& other)
+	{
+		m_pixel[0].scale_add_and_clamp(scale.m_pixel[0], other.m_pixel[0]);
+		m_pixel[1].scale_add_and_clamp(scale.m_pixel[1], other.m_pixel[1]);
+	}
+
+	rgbaint2_t& operator+=(const rgbaint2_t& other) { add(other); return *this; }
+	rgbaint2_t& operator-=(const rgbaint2_t& other) { sub(other); return *this; }
+	rgbaint2_t& operator*=(const rgbaint2_t& other) { mul(other); return *this; }
+	rgbaint2_t& operator*=(const s32 other) { mul_imm(other); return *this; }
+	rgbaint2_t& operator>>=(const s32 shift) { sra_imm(shift); return *this; }
+
+protected:
+	rgbaint_t m_pixel[2];
+};
+
+#endif // MAME_EMU_VIDEO_RGBWIDE_H
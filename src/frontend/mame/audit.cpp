@@ -21,6 +21,12 @@
 #include "chd.h"
 
 #include <algorithm>
+#include <cstring>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
 
 //#define VERBOSE 1
 #define LOG_OUTPUT_FUNC osd_printf_verbose
@@ -153,6 +159,55 @@ public:
 	}
 };
 
+
+
+// hashes of loose files, shared by all auditors so files that several sets
+// search (such as a parent's ROMs) and unchanged files on a re-audit are only
+// read once; archive members get their CRCs from the directory anyway
+class file_hash_cache
+{
+public:
+	util::hash_collection hashes(emu_file &file, const char *types)
+	{
+		if (file.is_archived())
+			return file.hashes(types);
+
+		std::string const path(file.fullpath());
+		std::unique_ptr<osd::directory::entry> const info(osd_stat(path));
+		if (!info)
+			return file.hashes(types);
+
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto const found(m_entries.find(path));
+			if ((m_entries.end() != found) && (found->second.size == info->size) && (found->second.modified == info->last_modified))
+			{
+				std::string const have(found->second.hashes.hash_types());
+				if (std::all_of(types, types + std::strlen(types), [&have] (char type) { return have.find(type) != std::string::npos; }))
+					return found->second.hashes;
+			}
+		}
+
+		util::hash_collection const result(file.hashes(types));
+		std::lock_guard<std::mutex> guard(m_mutex);
+		m_entries[path] = entry{ info->size, info->last_modified, result };
+		return result;
+	}
+
+private:
+	struct entry
+	{
+		std::uint64_t                           size;
+		std::chrono::system_clock::time_point   modified;
+		util::hash_collection                   hashes;
+	};
+
+	std::mutex                                  m_mutex;
+	std::unordered_map<std::string, entry>      m_entries;
+};
+
+file_hash_cache s_file_hashes;
+
 } // anonymous namespace
 
 
@@ -289,6 +344,49 @@ media_auditor::summary media_auditor::audit_media(const char *validation)
 }
 
 
+//-------------------------------------------------
+//  audit_media_parallel - audit the media of
+//  several drivers at once, each with its own
+//  enumerator and machine configuration
+//-------------------------------------------------
+
+void media_auditor::audit_media_parallel(emu_options &options, const std::vector<std::size_t> &drivers, const char *validation, const parallel_callback &callback)
+{
+	struct result
+	{
+		std::size_t                         driver;
+		std::unique_ptr<driver_enumerator>  enumerator;
+		std::unique_ptr<media_auditor>      auditor;
+		summary                             status;
+	};
+
+	auto const audit = [&options, validation] (std::size_t driver)
+	{
+		result r;
+		r.driver = driver;
+		r.enumerator = std::make_unique<driver_enumerator>(options, driver_list::driver(driver));
+		r.enumerator->next();
+		r.auditor = std::make_unique<media_auditor>(*r.enumerator);
+		r.status = r.auditor->audit_media(validation);
+		return r;
+	};
+
+	// keep enough sets in flight to cover both CPU and I/O waits
+	std::size_t const max_pending = std::max(4U, std::thread::hardware_concurrency() * 2);
+	std::queue<std::future<result> > queue;
+	auto next = drivers.begin();
+	while (!queue.empty() || (drivers.end() != next))
+	{
+		while ((queue.size() < max_pending) && (drivers.end() != next))
+			queue.push(std::async(std::launch::async, audit, *next++));
+
+		result const r(queue.front().get());
+		queue.pop();
+		callback(r.driver, *r.auditor, r.status);
+	}
+}
+
+
 //-------------------------------------------------
 //  audit_device - audit the device
 //-------------------------------------------------
@@ -597,7 +695,7 @@ media_auditor::audit_record &media_auditor::audit_one_rom(const std::vector<std:
 
 	// if it worked, get the actual length and hashes, then stop
 	if (filerr == osd_file::error::NONE)
-		record.set_actual(file.hashes(m_validation), file.size());
+		record.set_actual(s_file_hashes.hashes(file, m_validation), file.size());
 
 	// compute the final status
 	compute_status(record, rom, record.actual_length() != 0);
@@ -12,9 +12,11 @@
 
 #pragma once
 
+#include <functional>
 #include <iosfwd>
 #include <list>
 #include <utility>
+#include <vector>
 
 
 
@@ -35,6 +37,7 @@
 
 // forward declarations
 class driver_enumerator;
+class emu_options;
 class software_list_device;
 
 
@@ -147,6 +150,9 @@ public:
 	};
 	using record_list = std::list<audit_record>;
 
+	// receives the results of auditing one of several systems
+	using parallel_callback = std::function<void (std::size_t driver, const media_auditor &auditor, summary result)>;
+
 	// construction/destruction
 	media_auditor(const driver_enumerator &enumerator);
 
@@ -160,6 +166,9 @@ public:
 	summary audit_samples();
 	summary summarize(const char *name, std::ostream *output = nullptr) const;
 
+	// audit systems (by driver list index) concurrently, reporting results in the order given
+	static void audit_media_parallel(emu_options &options, const std::vector<std::size_t> &drivers, const char *validation, const parallel_callback &callback);
+
 private:
 	// internal helpers
 	template <typename T> void audit_regions(T do_audit, const rom_entry *region, std::size_t &found, std::size_t &required);
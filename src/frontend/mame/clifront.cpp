@@ -208,6 +208,7 @@ cli_frontend::~cli_frontend()
 void cli_frontend::start_execution(mame_machine_manager *manager, const std::vector<std::string> &args)
 {
 	std::ostringstream option_errors;
+	machine_manager::startup_phase options_phase(*manager, "options");
 
 	// because softlist evaluation relies on hashpath being populated, we are going to go through
 	// a special step to force it to be evaluated
@@ -249,13 +250,17 @@ void cli_frontend::start_execution(mame_machine_manager *manager, const std::vec
 		mame_options::parse_standard_inis(m_options, option_errors);
 		m_osd.set_verbose(m_options.verbose());
 	}
+	options_phase.stop();
 
 	// otherwise, check for a valid system
 	load_translation(m_options);
 
 	manager->start_http_server();
 
-	manager->start_luaengine();
+	{
+		machine_manager::startup_phase plugins_phase(*manager, "plugins");
+		manager->start_luaengine();
+	}
 
 	if (option_errors.tellp() > 0)
 		osd_printf_error("Error in command line:\n%s\n", strtrimspace(option_errors.str()));
@@ -882,23 +887,14 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 	unsigned incorrect = 0;
 	unsigned notfound = 0;
 
-	// iterate over drivers
+	// gather matching drivers
 	driver_enumerator drivlist(m_options);
-	media_auditor auditor(drivlist);
-	util::ovectorstream summary_string;
+	std::vector<std::size_t> drivers;
 	while (drivlist.next())
 	{
 		if (included(drivlist.driver().name))
 		{
-			// audit the ROMs in this set
-			media_auditor::summary summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
-
-			auto const clone_of = drivlist.clone();
-			print_summary(
-					auditor, summary, true,
-					"rom", drivlist.driver().name, (clone_of >= 0) ? drivlist.driver(clone_of).name : nullptr,
-					correct, incorrect, notfound,
-					summary_string);
+			drivers.emplace_back(drivlist.current());
 
 			// if it wasn't a wildcard, there can only be one
 			if (!iswild)
@@ -906,8 +902,23 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 		}
 	}
 
+	// audit the ROMs in these sets several at a time
+	util::ovectorstream summary_string;
+	media_auditor::audit_media_parallel(
+			m_options, drivers, AUDIT_VALIDATE_FAST,
+			[&] (std::size_t driver, media_auditor const &auditor, media_auditor::summary summary)
+			{
+				auto const clone_of = driver_list::clone(driver);
+				print_summary(
+						auditor, summary, true,
+						"rom", driver_list::driver(driver).name, (clone_of >= 0) ? driver_list::driver(clone_of).name : nullptr,
+						correct, incorrect, notfound,
+						summary_string);
+			});
+
 	if (iswild || !matchcount)
 	{
+		media_auditor auditor(drivlist);
 		machine_config config(GAME_NAME(___empty), m_options);
 		machine_config::token const tok(config.begin_configuration(config.root_device()));
 		for (device_type type : registered_device_types)
@@ -31,6 +31,7 @@
 #include <cstring>
 #include <future>
 #include <queue>
+#include <thread>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
@@ -408,14 +409,15 @@ void info_xml_creator::output(std::ostream &out, const std::function<bool(const
 	if (include_devices && filter)
 		devfilter = std::make_unique<device_type_set>();
 
-	// prepare a queue of futures
+	// prepare a queue of futures, deep enough to keep every core busy
 	std::queue<std::future<prepared_info>> queue;
+	size_t const max_pending = std::max(20U, std::thread::hardware_concurrency() * 2);
 
 	// try enumerating drivers and outputting them
 	while (!queue.empty() || (!drivlist_done && !filter_done))
 	{
 		// try populating the queue
-		while (queue.size() < 20 && !drivlist_done && !filter_done)
+		while (queue.size() < max_pending && !drivlist_done && !filter_done)
 		{
 			if (!drivlist.next())
 			{
@@ -754,37 +756,63 @@ void output_one_device(std::ostream &out, machine_config &config, device_t &devi
 
 void output_devices(std::ostream &out, emu_options &lookup_options, device_type_set const *filter)
 {
-	// get config for empty machine
-	machine_config config(GAME_NAME(___empty), lookup_options);
+	// collect the device types up front so they can be split into batches
+	std::vector<std::add_pointer_t<device_type> > types;
+	if (filter)
+	{
+		types.assign(filter->begin(), filter->end());
+	}
+	else
+	{
+		for (device_type type : registered_device_types)
+			types.emplace_back(&type);
+	}
 
-	auto const action = [&config, &out] (device_type type)
+	// each batch gets a machine config of its own, so batches can be
+	// generated concurrently and spliced back together in order
+	auto const batch = [&types, &lookup_options] (size_t start, size_t end)
 			{
-				// add it at the root of the machine config
-				device_t *dev;
+				// get config for empty machine
+				machine_config config(GAME_NAME(___empty), lookup_options);
+				std::ostringstream stream;
+
+				for (size_t index = start; index < end; index++)
 				{
-					machine_config::token const tok(config.begin_configuration(config.root_device()));
-					dev = config.device_add("_tmp", type, 0);
-				}
+					// add it at the root of the machine config
+					device_t *dev;
+					{
+						machine_config::token const tok(config.begin_configuration(config.root_device()));
+						dev = config.device_add("_tmp", *types[index], 0);
+					}
 
-				// notify this device and all its subdevices that they are now configured
-				for (device_t &device : device_enumerator(*dev))
-					if (!device.configured())
-						device.config_complete();
+					// notify this device and all its subdevices that they are now configured
+					for (device_t &device : device_enumerator(*dev))
+						if (!device.configured())
+							device.config_complete();
 
-				// print details and remove it
-				output_one_device(out, config, *dev, dev->tag());
-				machine_config::token const tok(config.begin_configuration(config.root_device()));
-				config.device_remove("_tmp");
+					// print details and remove it
+					output_one_device(stream, config, *dev, dev->tag());
+					machine_config::token const tok(config.begin_configuration(config.root_device()));
+					config.device_remove("_tmp");
+				}
+				return stream.str();
 			};
 
-	// run through devices
-	if (filter)
+	// run through devices, keeping a bounded number of batches in flight
+	size_t const BATCH_SIZE = 32;
+	size_t const max_pending = std::max(2U, std::thread::hardware_concurrency()) * 2;
+	std::queue<std::future<std::string> > queue;
+	size_t next = 0;
+	while (!queue.empty() || next < types.size())
 	{
-		for (std::add_pointer_t<device_type> type : *filter) action(*type);
-	}
-	else
-	{
-		for (device_type type : registered_device_types) action(type);
+		while (queue.size() < max_pending && next < types.size())
+		{
+			size_t const end = std::min(next + BATCH_SIZE, types.size());
+			queue.push(std::async(std::launch::async, batch, next, end));
+			next = end;
+		}
+		out << queue.front().get();
+		queue.pop();
 	}
 }
 
@@ -1946,26 +1974,30 @@ void output_slots(std::ostream &out, machine_config &config, device_t &device, c
 
 			for (auto &option : slot.option_list())
 			{
-				if (devtypes || (listed && option.second->selectable()))
+				device_type const &type = option.second->devtype();
+
+				// the card only needs to be instantiated to collect its subdevice types,
+				// and only the first time this type is seen
+				if (devtypes && devtypes->insert(&type).second)
 				{
-					device_t *const dev = config.device_add("_dummy", option.second->devtype(), option.second->clock());
+					device_t *const dev = config.device_add("_dummy", type, option.second->clock());
 					if (!dev->configured())
 						dev->config_complete();
 
-					if (devtypes)
-						for (device_t &subdevice : device_enumerator(*dev)) devtypes->insert(&subdevice.type());
-
-					if (listed && option.second->selectable())
-					{
-						out << util::string_format("\t\t\t<slotoption name=\"%s\"", normalize_string(option.second->name()));
-						out << util::string_format(" devname=\"%s\"", normalize_string(dev->shortname()));
-						if (slot.default_option() != nullptr && strcmp(slot.default_option(), option.second->name())==0)
-							out << " default=\"yes\"";
-						out << "/>\n";
-					}
+					for (device_t &subdevice : device_enumerator(*dev)) devtypes->insert(&subdevice.type());
 
 					config.device_remove("_dummy");
 				}
+
+				// the listing itself only needs the device type's metadata
+				if (listed && option.second->selectable())
+				{
+					out << util::string_format("\t\t\t<slotoption name=\"%s\"", normalize_string(option.second->name()));
+					out << util::string_format(" devname=\"%s\"", normalize_string(type.shortname()));
+					if (slot.default_option() != nullptr && strcmp(slot.default_option(), option.second->name())==0)
+						out << " default=\"yes\"";
+					out << "/>\n";
+				}
 			}
 
 			if (listed)
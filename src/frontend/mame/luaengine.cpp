@@ -422,7 +422,82 @@ static std::string process_snapshot_filename(running_machine &machine, const cha
 //  lua_engine - constructor
 //-------------------------------------------------
 
+//-------------------------------------------------
+//  async_job - Lua source run to completion in a
+//  state of its own on another thread
+//-------------------------------------------------
+
+struct lua_engine::async_job
+{
+	sol::protected_function callback;   // called with the result on the emulation thread
+	std::thread thread;
+	std::atomic<bool> done;
+	bool ok = false;
+	std::string result;                 // first value returned, or the error message
+
+	async_job(sol::protected_function &&cb, std::string &&script, std::string &&input)
+		: callback(std::move(cb))
+		, done(false)
+	{
+		thread = std::thread(
+				[this, script = std::move(script), input = std::move(input)] ()
+				{
+					sol::state state;
+					state.open_libraries();
+					state["package"]["preload"]["zlib"] = &luaopen_zlib;
+					sol::load_result load = state.load(script);
+					if (!load.valid())
+					{
+						sol::error err = load;
+						result = err.what();
+					}
+					else
+					{
+						sol::protected_function_result ret = load.get<sol::protected_function>()(input);
+						if (!ret.valid())
+						{
+							sol::error err = ret;
+							result = err.what();
+						}
+						else
+						{
+							ok = true;
+							if (ret.return_count() > 0 && ret.get_type() == sol::type::string)
+							{
+								result = ret.get<std::string>();
+							}
+							else if (ret.return_count() > 0 && ret.get_type() != sol::type::lua_nil)
+							{
+								// anything else is converted the way print would show it
+								sol::protected_function tostring = state["tostring"];
+								sol::protected_function_result str = tostring(ret.get<sol::object>());
+								if (!str.valid())
+								{
+									sol::error err = str;
+									result = err.what();
+									ok = false;
+								}
+								else if (str.get_type() == sol::type::string)
+								{
+									result = str.get<std::string>();
+								}
+								else
+								{
+									result = "'tostring' must return a string";
+									ok = false;
+								}
+							}
+						}
+					}
+					done.store(true, std::memory_order_release);
+				});
+	}
+};
+
+
 lua_engine::lua_engine()
+	: m_next_task(0)
+	, m_task_budget(0.001)
 {
 	m_machine = nullptr;
 	m_lua_state = luaL_newstate();  /* create state */
@@ -571,6 +646,7 @@ void lua_engine::on_machine_prestart()
 
 void lua_engine::on_machine_start()
 {
+	machine_manager::startup_phase phase(machine().manager(), "plugins");
 	execute_function("LUA_ON_START");
 }
 
@@ -597,6 +673,97 @@ void lua_engine::on_machine_resume()
 void lua_engine::on_machine_frame()
 {
 	execute_function("LUA_ON_FRAME");
+	finish_async_jobs(false);
+	run_tasks();
+}
+
+
+//-------------------------------------------------
+//  run_tasks - resume the cooperative tasks in
+//  turn until they are all done for this frame or
+//  the frame's budget is spent
+//-------------------------------------------------
+
+void lua_engine::run_tasks()
+{
+	if (m_tasks.empty())
+		return;
+
+	osd_ticks_t const end = osd_ticks() + osd_ticks_t(m_task_budget * double(osd_ticks_per_second()));
+	std::vector<bool> waiting(m_tasks.size(), false);
+	size_t remaining = m_tasks.size();
+	size_t index = m_next_task % m_tasks.size();
+	do
+	{
+		if (!waiting[index])
+		{
+			lua_rawgeti(m_lua_state, LUA_REGISTRYINDEX, m_tasks[index]);
+			lua_State *const L = lua_tothread(m_lua_state, -1);
+			lua_pop(m_lua_state, 1);
+			int const stat = lua_resume(L, nullptr, 0);
+			if (stat == LUA_YIELD)
+			{
+				// a task yielding true has nothing more to do until the next frame
+				if ((lua_gettop(L) > 0) && lua_toboolean(L, -1))
+				{
+					waiting[index] = true;
+					remaining--;
+				}
+				lua_settop(L, 0);
+			}
+			else
+			{
+				if (stat != LUA_OK)
+				{
+					osd_printf_error("[LUA ERROR] in task: %s\n", lua_tostring(L, -1));
+					lua_pop(L, 1);
+				}
+				luaL_unref(m_lua_state, LUA_REGISTRYINDEX, m_tasks[index]);
+				m_tasks.erase(m_tasks.begin() + index);
+				waiting.erase(waiting.begin() + index);
+				remaining--;
+				if (m_tasks.empty())
+					break;
+				index %= m_tasks.size();
+				continue;
+			}
+		}
+		index = (index + 1) % m_tasks.size();
+	}
+	while (remaining && (osd_ticks() < end));
+
+	// whoever missed out this frame goes first next frame
+	m_next_task = index;
+}
+
+
+//-------------------------------------------------
+//  finish_async_jobs - report jobs that have
+//  completed, or wait for all of them
+//-------------------------------------------------
+
+void lua_engine::finish_async_jobs(bool wait)
+{
+	for (auto it = m_async_jobs.begin(); it != m_async_jobs.end(); )
+	{
+		async_job &job = **it;
+		if (!wait && !job.done.load(std::memory_order_acquire))
+		{
+			++it;
+			continue;
+		}
+		job.thread.join();
+		if (!wait && job.callback.valid())
+		{
+			auto ret = job.ok ? invoke(job.callback, job.result) : invoke(job.callback, sol::lua_nil, job.result);
+			if (!ret.valid())
+			{
+				sol::error err = ret;
+				osd_printf_error("[LUA ERROR] in run_async callback: %s\n", err.what());
+			}
+		}
+		it = m_async_jobs.erase(it);
+	}
 }
 
 void lua_engine::on_frame_done()
@@ -684,6 +851,10 @@ void lua_engine::initialize()
  * emu.step() - advance one frame
  * emu.keypost(keys) - post keys to natural keyboard
  * emu.wait(len) - wait for len within coroutine
+ * emu.add_task(func) - run func as a coroutine resumed every frame; it yields with coroutine.yield(), or coroutine.yield(true) when done until the next frame
+ * emu.task_budget() - return the seconds per frame tasks may run for
+ * emu.set_task_budget(seconds) - set the seconds per frame tasks may run for
+ * emu.run_async(script, callback, [input]) - run Lua source in a separate state on another thread, passing input as its argument; callback(result, error) is called on a later frame
  * emu.lang_translate(str) - get translation for str if available
  * emu.subst_env(str) - substitute environment variables with values for str (semantics are OS-specific)
  *
@@ -692,7 +863,7 @@ void lua_engine::initialize()
  * emu.register_stop(callback) - register callback after stopping
  * emu.register_pause(callback) - register callback at pause
  * emu.register_resume(callback) - register callback at resume
- * emu.register_frame(callback) - register callback at end of frame
+ * emu.register_frame(callback) - register callback at end of each emulated frame, also while output is suppressed
  * emu.register_frame_done(callback) - register callback after frame is drawn to screen (for overlays)
  * emu.register_sound_update(callback) - register callback after sound update has generated new samples
  * emu.register_periodic(callback) - register periodic callback while program is running
@@ -797,6 +968,21 @@ void lua_engine::initialize()
 				engine->machine().scheduler().timer_set(attotime::from_double(lua_tonumber(L, 1)), timer_expired_delegate(FUNC(lua_engine::resume), engine), ref, nullptr);
 				return lua_yield(L, 0);
 			});
+	emu["add_task"] =
+		[this] (sol::function func)
+		{
+			lua_State *const L = lua_newthread(m_lua_state);
+			func.push(m_lua_state);
+			lua_xmove(m_lua_state, L, 1);
+			m_tasks.push_back(luaL_ref(m_lua_state, LUA_REGISTRYINDEX));
+		};
+	emu["task_budget"] = [this] () { return m_task_budget; };
+	emu["set_task_budget"] = [this] (double seconds) { m_task_budget = std::max(seconds, 0.0); };
+	emu["run_async"] =
+		[this] (const std::string &script, sol::protected_function callback, sol::optional<std::string> input)
+		{
+			m_async_jobs.emplace_back(std::make_unique<async_job>(std::move(callback), std::string(script), input ? std::move(*input) : std::string()));
+		};
 	emu["lang_translate"] = &lang_translate;
 	emu["pid"] = &osd_getpid;
 	emu["subst_env"] =
@@ -1270,9 +1456,30 @@ void lua_engine::initialize()
 				m.popmessage();
 		};
 	machine_type["logerror"]  = [] (running_machine &m, std::string const *str) { m.logerror("[luaengine] %s\n", str); };
+	machine_type["state_report"] = [] (running_machine &m) { return m.save().state_report(); };
+	machine_type["memory_report"] = [] (running_machine &m) { return m.memory_report(); };
+	machine_type["memory_usage"] =
+		[this] (running_machine &m)
+		{
+			m.sample_memory();
+			sol::table result = sol().create_table();
+			int index = 1;
+			m.memory_usage(
+					[this, &result, &index] (std::string const &owner, std::string const &category, size_t bytes, size_t peak)
+					{
+						sol::table usage = sol().create_table();
+						usage["owner"] = owner;
+						usage["category"] = category;
+						usage["bytes"] = bytes;
+						usage["peak"] = peak;
+						result[index++] = usage;
+					});
+			return result;
+		};
 	machine_type["system"] = sol::property(&running_machine::system);
 	machine_type["video"] = sol::property(&running_machine::video);
 	machine_type["sound"] = sol::property(&running_machine::sound);
+	machine_type["scheduler"] = sol::property(&running_machine::scheduler);
 	machine_type["render"] = sol::property(&running_machine::render);
 	machine_type["ioport"] = sol::property(&running_machine::ioport);
 	machine_type["parameters"] = sol::property(&running_machine::parameters);
@@ -1294,6 +1501,9 @@ void lua_engine::initialize()
 	machine_type["samplerate"] = sol::property(&running_machine::sample_rate);
 	machine_type["exit_pending"] = sol::property(&running_machine::exit_pending);
 	machine_type["hard_reset_pending"] = sol::property(&running_machine::hard_reset_pending);
+	machine_type["state_profiling"] = sol::property(
+			[] (running_machine &m) { return m.save().profiling(); },
+			[] (running_machine &m, bool profiling) { m.save().set_profiling(profiling); });
 	machine_type["devices"] = sol::property([] (running_machine &m) { return devenum<device_enumerator>(m.root_device()); });
 	machine_type["screens"] = sol::property([] (running_machine &m) { return devenum<screen_device_enumerator>(m.root_device()); });
 	machine_type["cassettes"] = sol::property([] (running_machine &m) { return devenum<cassette_device_enumerator>(m.root_device()); });
@@ -1408,6 +1618,18 @@ void lua_engine::initialize()
 				}
 				return sp_table;
 			});
+	device_type["opcode_stats"] = sol::property(
+			[this] (device_t &dev)
+			{
+				sol::table table = sol().create_table();
+				device_execute_interface *exec;
+				if (dev.interface(exec))
+				{
+					for (auto const &stat : exec->opcode_stats())
+						table[stat.first] = stat.second;
+				}
+				return table;
+			});
 	// FIXME: improve this
 	device_type["state"] = sol::property(
 			[this] (device_t &dev)
@@ -1667,6 +1889,28 @@ void lua_engine::initialize()
 	parameters_type["lookup"] = &parameters_manager::lookup;
 
 
+	auto scheduler_type = sol().registry().new_usertype<device_scheduler>("scheduler", sol::no_constructor);
+	scheduler_type["time"] = sol::property(&device_scheduler::time);
+	scheduler_type["timer_pool_size"] = sol::property(&device_scheduler::timer_pool_size);
+	scheduler_type["timers_live"] = sol::property(&device_scheduler::timers_live);
+	scheduler_type["timers_peak"] = sol::property(&device_scheduler::timers_peak);
+	scheduler_type["timer_allocs"] = sol::property(&device_scheduler::timer_allocs);
+	scheduler_type["temporary_timer_allocs"] = sol::property(&device_scheduler::temporary_timer_allocs);
+	scheduler_type["execute_list_rebuilds"] = sol::property(&device_scheduler::execute_list_rebuilds);
+	scheduler_type["execute_list_updates"] = sol::property(&device_scheduler::execute_list_updates);
+	scheduler_type["execute_list_updates_per_second"] = sol::property(&device_scheduler::execute_list_updates_per_second);
+	scheduler_type["temporary_timers"] = sol::property(
+			[this] (device_scheduler const &sched)
+			{
+				sol::table result = sol().create_table();
+				for (auto const &entry : sched.device_temporary_timers())
+					result[entry.first->tag()] = entry.second;
+				for (auto const &entry : sched.callback_temporary_timers())
+					result[std::string(entry.first)] = entry.second;
+				return result;
+			});
+
+
 	auto video_type = sol().registry().new_usertype<video_manager>("video", sol::no_constructor);
 	video_type["frame_update"] = [] (video_manager &vm) { vm.frame_update(true); };
 	video_type["snapshot"] = &video_manager::save_active_screen_snapshots;
@@ -1707,9 +1951,28 @@ void lua_engine::initialize()
 	video_type["throttled"] = sol::property(&video_manager::throttled, &video_manager::set_throttled);
 	video_type["throttle_rate"] = sol::property(&video_manager::throttle_rate, &video_manager::set_throttle_rate);
 	video_type["frameskip"] = sol::property(&video_manager::frameskip, &video_manager::set_frameskip);
+	video_type["compute_only"] = sol::property(&video_manager::compute_only, &video_manager::set_compute_only);
+	video_type["frames_run"] = sol::property(&video_manager::frames_run);
 	video_type["speed_percent"] = sol::property(&video_manager::speed_percent);
 	video_type["effective_frameskip"] = sol::property(&video_manager::effective_frameskip);
 	video_type["skip_this_frame"] = sol::property(&video_manager::skip_this_frame);
+	video_type["frame_times"] =
+		[this] (video_manager &vm)
+		{
+			// percentiles in seconds for each part of the frame, keyed by name
+			sol::table result = sol().create_table();
+			for (int phase = 0; phase < int(video_manager::frame_phase::COUNT); phase++)
+			{
+				frame_time_histogram const &times = vm.frame_times(video_manager::frame_phase(phase));
+				sol::table entry = sol().create_table();
+				entry["count"] = times.count();
+				entry["p50"] = times.percentile(0.50);
+				entry["p95"] = times.percentile(0.95);
+				entry["p99"] = times.percentile(0.99);
+				result[video_manager::frame_phase_name(video_manager::frame_phase(phase))] = entry;
+			}
+			return result;
+		};
 	video_type["snap_native"] = sol::property(&video_manager::snap_native);
 	video_type["is_recording"] = sol::property(&video_manager::is_recording);
 	video_type["snapshot_target"] = sol::property(&video_manager::snapshot_target);
@@ -1746,6 +2009,22 @@ void lua_engine::initialize()
 			&sound_manager::attenuation,
 			&sound_manager::set_attenuation);
 	sound_type["recording"] = sol::property(&sound_manager::is_recording);
+	sound_type["statistics"] = sol::property(
+			[] (sound_manager &sm, sol::this_state s)
+			{
+				sound_manager::statistics const &stats = sm.stats();
+				sol::table result = sol::state_view(s).create_table();
+				result["underflows"] = stats.underflows;
+				result["overflows"] = stats.overflows;
+				if (stats.buffer_fill >= 0.0f)
+					result["buffer_fill"] = stats.buffer_fill;
+				result["update_time"] = stats.update_time;
+				sol::table streams = sol::state_view(s).create_table();
+				for (auto &stream : sm.streams())
+					streams[stream->name()] = stream->update_time();
+				result["streams"] = streams;
+				return result;
+			});
 
 
 	auto ui_type = sol().registry().new_usertype<mame_ui_manager>("ui", sol::no_constructor);
@@ -1870,6 +2149,9 @@ bool lua_engine::frame_hook()
 
 void lua_engine::close()
 {
+	// the callbacks live in our state, so jobs still running are waited for and dropped
+	finish_async_jobs(true);
+	m_tasks.clear();
 	m_sol_state.reset();
 	if (m_lua_state)
 	{
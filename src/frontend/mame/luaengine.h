@@ -142,11 +142,19 @@ private:
 		bool yield;
 	};
 
+	struct async_job;
+
 	// internal state
 	lua_State *m_lua_state;
 	std::unique_ptr<sol::state_view> m_sol_state;
 	running_machine *m_machine;
 
+	// cooperative tasks and off-thread jobs, serviced once per frame
+	std::vector<int> m_tasks;                               // registry references to task coroutines
+	size_t m_next_task;                                     // task to resume first next frame
+	double m_task_budget;                                   // seconds per frame tasks may run for
+	std::list<std::unique_ptr<async_job> > m_async_jobs;    // jobs started and not yet reported
+
 	std::vector<std::string> m_menu;
 
 	template <typename R, typename T, typename D>
@@ -162,6 +170,8 @@ private:
 	void on_machine_frame();
 
 	void resume(void *ptr, int nparam);
+	void run_tasks();
+	void finish_async_jobs(bool wait);
 	void register_function(sol::function func, const char *id);
 	int enumerate_functions(const char *id, std::function<bool(const sol::protected_function &func)> &&callback);
 	bool execute_function(const char *id);
@@ -438,6 +438,7 @@ struct lua_engine::addr_space
 	template <typename T> void log_mem_write(offs_t address, T val);
 	template <typename T> T direct_mem_read(offs_t address);
 	template <typename T> void direct_mem_write(offs_t address, T val);
+	void direct_range(offs_t address, size_t length, u8 *dest, const u8 *src);
 
 	address_space &space;
 	device_memory_interface &dev;
@@ -118,6 +118,66 @@ void share_write(memory_share &share, offs_t address, T val)
 	}
 }
 
+//-------------------------------------------------
+//  copy_from_units/copy_to_units - copy bytes in
+//  address order out of or into memory held as
+//  units of the given width and endianness; a
+//  straight copy when that matches the host
+//-------------------------------------------------
+
+void copy_from_units(u8 *dest, const u8 *base, offs_t offset, size_t length, int bytewidth, endianness_t endianness)
+{
+	if ((bytewidth == 1) || (endianness == ENDIANNESS_NATIVE))
+		std::copy_n(base + offset, length, dest);
+	else
+		for (size_t i = 0; i < length; i++)
+			dest[i] = base[(offset + i) ^ (bytewidth - 1)];
+}
+
+void copy_to_units(u8 *base, const u8 *src, offs_t offset, size_t length, int bytewidth, endianness_t endianness)
+{
+	if ((bytewidth == 1) || (endianness == ENDIANNESS_NATIVE))
+		std::copy_n(src, length, base + offset);
+	else
+		for (size_t i = 0; i < length; i++)
+			base[(offset + i) ^ (bytewidth - 1)] = src[i];
+}
+
+//-------------------------------------------------
+//  block_read_range/block_write_range - bulk
+//  access to a region or share as a string of
+//  bytes in address order
+//  -> manager:machine():memory().regions[":maincpu"]:read_range(0xC000, 0x100)
+//-------------------------------------------------
+
+u8 *block_base(memory_region &region) { return region.base(); }
+u8 *block_base(memory_share &share) { return (u8 *)share.ptr(); }
+
+template <typename T>
+sol::object block_read_range(T &block, sol::this_state s, offs_t offset, offs_t length)
+{
+	lua_State *L = s;
+	if ((offset > block.bytes()) || (length > block.bytes() - offset))
+	{
+		luaL_error(L, "Invalid range");
+		return sol::lua_nil;
+	}
+	luaL_Buffer buff;
+	u8 *dest = (u8 *)luaL_buffinitsize(L, &buff, length);
+	copy_from_units(dest, block_base(block), offset, length, block.bytewidth(), block.endianness());
+	luaL_pushresultsize(&buff, length);
+	return sol::make_reference(L, sol::stack_reference(L, -1));
+}
+
+template <typename T>
+void block_write_range(T &block, sol::this_state s, offs_t offset, std::string_view data)
+{
+	if ((offset > block.bytes()) || (data.length() > block.bytes() - offset))
+		luaL_error(s, "Invalid range");
+	else
+		copy_to_units(block_base(block), (const u8 *)data.data(), offset, data.length(), block.bytewidth(), block.endianness());
+}
+
 } // anonymous namespace
 
 
@@ -402,6 +462,53 @@ void lua_engine::addr_space::direct_mem_write(offs_t address, T val)
 	}
 }
 
+//-------------------------------------------------
+//  direct_range - copy a range of bytes out of or
+//  into the memory backing a space, a chunk at a
+//  time where it is contiguous; bytes with no
+//  backing memory read as zero
+//  -> manager:machine().devices[":maincpu"].spaces["program"]:read_direct_range(0xC000, 0xC0FF)
+//-------------------------------------------------
+
+void lua_engine::addr_space::direct_range(offs_t address, size_t length, u8 *dest, const u8 *src)
+{
+	const offs_t lowmask = space.data_width() / 8 - 1;
+	const int bytewidth = space.data_width() / 8;
+	size_t pos = 0;
+	while (pos < length)
+	{
+		// chunks stop at 256-byte boundaries so contiguity is cheap to check
+		const offs_t addr = address + pos;
+		const size_t chunk = std::min<size_t>(0x100 - (addr & 0xff), length - pos);
+		// every unit has to be checked, handlers can be installed over part of a RAM range
+		u8 *const first = (u8 *)space.get_read_ptr(addr & ~lowmask);
+		bool contiguous = first != nullptr;
+		const offs_t units = ((((addr + chunk - 1) & ~lowmask) - (addr & ~lowmask)) / bytewidth) + 1;
+		for (offs_t i = 1; contiguous && (i < units); i++)
+			contiguous = (u8 *)space.get_read_ptr((addr & ~lowmask) + i * bytewidth) == first + i * bytewidth;
+		if (contiguous)
+		{
+			if (src)
+				copy_to_units(first - (addr & ~lowmask), src + pos, addr, chunk, bytewidth, space.endianness());
+			else
+				copy_from_units(dest + pos, first - (addr & ~lowmask), addr, chunk, bytewidth, space.endianness());
+		}
+		else
+		{
+			for (size_t i = 0; i < chunk; i++)
+			{
+				u8 *const base = (u8 *)space.get_read_ptr((addr + i) & ~lowmask);
+				const offs_t byte = (space.endianness() == ENDIANNESS_BIG) ? (BYTE8_XOR_BE(addr + i) & lowmask) : (BYTE8_XOR_LE(addr + i) & lowmask);
+				if (src && base)
+					base[byte] = src[pos + i];
+				else if (!src)
+					dest[pos + i] = base ? base[byte] : 0;
+			}
+		}
+		pos += chunk;
+	}
+}
+
 //-------------------------------------------------
 //  initialize_memory - register memory user types
 //-------------------------------------------------
@@ -517,6 +624,32 @@ void lua_engine::initialize_memory(sol::table &emu)
 			luaL_pushresultsize(&buff, byte_count);
 			return sol::make_reference(L, sol::stack_reference(L, -1));
 		};
+	addr_space_type["read_direct_range"] =
+		[] (addr_space &sp, sol::this_state s, offs_t first, offs_t last) -> sol::object
+		{
+			lua_State *L = s;
+			if (first > sp.space.addrmask() || last > sp.space.addrmask() || last < first)
+			{
+				luaL_error(L, "Invalid offset");
+				return sol::lua_nil;
+			}
+			size_t const length = size_t(last - first) + 1;
+			luaL_Buffer buff;
+			u8 *dest = (u8 *)luaL_buffinitsize(L, &buff, length);
+			sp.direct_range(first, length, dest, nullptr);
+			luaL_pushresultsize(&buff, length);
+			return sol::make_reference(L, sol::stack_reference(L, -1));
+		};
+	addr_space_type["write_direct_range"] =
+		[] (addr_space &sp, sol::this_state s, offs_t first, std::string_view data)
+		{
+			if (data.empty())
+				return;
+			if (first > sp.space.addrmask() || (data.length() - 1) > (sp.space.addrmask() - first))
+				luaL_error(s, "Invalid offset");
+			else
+				sp.direct_range(first, data.length(), nullptr, (const u8 *)data.data());
+		};
 	addr_space_type["name"] = sol::property([] (addr_space &sp) { return sp.space.name(); });
 	addr_space_type["shift"] = sol::property([] (addr_space &sp) { return sp.space.addr_shift(); });
 	addr_space_type["index"] = sol::property([] (addr_space &sp) { return sp.space.spacenum(); });
@@ -524,6 +657,7 @@ void lua_engine::initialize_memory(sol::table &emu)
 	addr_space_type["data_width"] = sol::property([] (addr_space &sp) { return sp.space.data_width(); });
 	addr_space_type["endianness"] = sol::property([] (addr_space &sp) { return sp.space.endianness(); });
 	addr_space_type["map"] = sol::property([] (addr_space &sp) { return sp.space.map(); });
+	addr_space_type["map_report"] = [] (addr_space &sp) { return sp.space.map_report(); };
 
 
 	auto addrmap_type = sol().registry().new_usertype<address_map>("addrmap", sol::no_constructor);
@@ -559,6 +693,28 @@ void lua_engine::initialize_memory(sol::table &emu)
 	memory_type["banks"] = sol::property([] (memory_manager &mm) { return standard_tag_object_ptr_map<memory_bank>(mm.banks()); });
 	memory_type["regions"] = sol::property([] (memory_manager &mm) { return standard_tag_object_ptr_map<memory_region>(mm.regions()); });
 	memory_type["shares"] = sol::property([] (memory_manager &mm) { return standard_tag_object_ptr_map<memory_share>(mm.shares()); });
+	memory_type["track_dirty"] = sol::overload(
+			[] (memory_manager &mm, memory_share &share) -> memory_dirty_tracker & { return mm.dirty_track(share); },
+			[] (memory_manager &mm, memory_share &share, u32 page_bytes) -> memory_dirty_tracker & { return mm.dirty_track(share, page_bytes); });
+	memory_type["untrack_dirty"] = &memory_manager::dirty_untrack;
+
+
+	auto dirty_type = sol().registry().new_usertype<memory_dirty_tracker>("dirty_tracker", sol::no_constructor);
+	dirty_type["dirty_pages"] =
+		[this] (memory_dirty_tracker &tracker)
+		{
+			sol::table result = sol().create_table();
+			int index = 1;
+			for (u32 page : tracker.dirty_pages())
+				result[index++] = page;
+			return result;
+		};
+	dirty_type["is_dirty"] = &memory_dirty_tracker::is_dirty;
+	dirty_type["clear"] = &memory_dirty_tracker::clear;
+	dirty_type["mark_all"] = &memory_dirty_tracker::mark_all;
+	dirty_type["any"] = sol::property(&memory_dirty_tracker::any);
+	dirty_type["page_bytes"] = sol::property(&memory_dirty_tracker::page_bytes);
+	dirty_type["page_count"] = sol::property(&memory_dirty_tracker::page_count);
 
 
 	auto bank_type = sol().registry().new_usertype<memory_bank>("membank", sol::no_constructor);
@@ -583,6 +739,8 @@ void lua_engine::initialize_memory(sol::table &emu)
 	region_type["write_u32"] = &region_write<u32>;
 	region_type["write_i64"] = &region_write<s64>;
 	region_type["write_u64"] = &region_write<u64>;
+	region_type["read_range"] = &block_read_range<memory_region>;
+	region_type["write_range"] = &block_write_range<memory_region>;
 	region_type["tag"] = sol::property(&memory_region::name);
 	region_type["size"] = sol::property(&memory_region::bytes);
 	region_type["length"] = sol::property([] (memory_region &r) { return r.bytes() / r.bytewidth(); });
@@ -608,6 +766,8 @@ void lua_engine::initialize_memory(sol::table &emu)
 	share_type["write_u32"] = &share_write<u32>;
 	share_type["write_i64"] = &share_write<s64>;
 	share_type["write_u64"] = &share_write<u64>;
+	share_type["read_range"] = &block_read_range<memory_share>;
+	share_type["write_range"] = &block_write_range<memory_share>;
 	share_type["tag"] = sol::property(&memory_share::name);
 	share_type["size"] = sol::property(&memory_share::bytes);
 	share_type["length"] = sol::property([] (memory_share &s) { return s.bytes() / s.bytewidth(); });
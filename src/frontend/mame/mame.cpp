@@ -105,6 +105,20 @@ void mame_machine_manager::update_machine()
 {
 	m_lua->set_machine(m_machine);
 	m_lua->attach_notifiers();
+	if (m_machine)
+		m_machine->add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&mame_machine_manager::frame_notify, this));
+}
+
+
+//-------------------------------------------------
+//  frame_notify - pass each emulated frame to the
+//  embedding host, if it asked for them
+//-------------------------------------------------
+
+void mame_machine_manager::frame_notify()
+{
+	if (m_frame_callback)
+		m_frame_callback(*m_machine);
 }
 
 
@@ -244,6 +258,7 @@ int mame_machine_manager::execute()
 			// but first, revert out any potential game-specific INI settings from previous runs via the internal UI
 			m_options.revert(OPTION_PRIORITY_INI);
 
+			machine_manager::startup_phase phase(*this, "options");
 			std::ostringstream errors;
 			mame_options::parse_standard_inis(m_options, errors);
 		}
@@ -258,7 +273,9 @@ int mame_machine_manager::execute()
 		}
 
 		// create the machine configuration
+		machine_manager::startup_phase config_phase(*this, "machine config");
 		machine_config config(*system, m_options);
+		config_phase.stop();
 
 		// create the machine structure and driver
 		running_machine machine(config, *this);
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <functional>
+
 class plugin_options;
 class osd_interface;
 
@@ -39,6 +41,10 @@ public:
 
 	virtual void update_machine() override;
 
+	// for hosts embedding the emulator: called at the end of every emulated frame,
+	// between frames, so the host can read state and set inputs for the next one
+	void set_frame_callback(std::function<void (running_machine &)> &&callback) { m_frame_callback = std::move(callback); }
+
 	void reset();
 	TIMER_CALLBACK_MEMBER(autoboot_callback);
 
@@ -71,8 +77,11 @@ private:
 	mame_machine_manager &operator=(mame_machine_manager const &) = delete;
 	mame_machine_manager &operator=(mame_machine_manager &&) = delete;
 
+	void frame_notify();
+
 	std::unique_ptr<plugin_options> m_plugins;              // pointer to plugin options
 	std::unique_ptr<lua_engine> m_lua;
+	std::function<void (running_machine &)> m_frame_callback; // host callback for each emulated frame
 
 	const game_driver *     m_new_driver_pending;   // pointer to the next pending driver
 	bool                    m_firstrun;
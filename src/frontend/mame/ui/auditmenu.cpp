@@ -188,38 +188,47 @@ void menu_audit::handle()
 
 void menu_audit::audit_fast()
 {
+	std::vector<std::size_t> drivers;
+	std::vector<ui_system_info *> infos(driver_list::total(), nullptr);
 	for (ui_system_info &info : m_availablesorted)
 	{
 		if (!info.available)
 		{
-			m_current.store(info.driver);
-			driver_enumerator enumerator(machine().options(), info.driver->name);
-			enumerator.next();
-			media_auditor auditor(enumerator);
-			media_auditor::summary const summary(auditor.audit_media(AUDIT_VALIDATE_FAST));
-			info.available = (summary == media_auditor::CORRECT) || (summary == media_auditor::BEST_AVAILABLE) || (summary == media_auditor::NONE_NEEDED);
-
-			// if everything looks good, include the driver
-			info.available = (summary == media_auditor::CORRECT) || (summary == media_auditor::BEST_AVAILABLE) || (summary == media_auditor::NONE_NEEDED);
-			++m_audited;
+			drivers.emplace_back(info.index);
+			infos[info.index] = &info;
 		}
 	}
+
+	media_auditor::audit_media_parallel(
+			machine().options(), drivers, AUDIT_VALIDATE_FAST,
+			[this, &infos] (std::size_t driver, media_auditor const &auditor, media_auditor::summary summary)
+			{
+				m_current.store(&driver_list::driver(driver));
+
+				// if everything looks good, include the driver
+				infos[driver]->available = (summary == media_auditor::CORRECT) || (summary == media_auditor::BEST_AVAILABLE) || (summary == media_auditor::NONE_NEEDED);
+				++m_audited;
+			});
 }
 
 void menu_audit::audit_all()
 {
+	std::vector<std::size_t> drivers;
 	driver_enumerator enumerator(machine().options());
-	media_auditor auditor(enumerator);
-	std::vector<bool> available(driver_list::total(), false);
 	while (enumerator.next())
-	{
-		m_current.store(&enumerator.driver());
-		media_auditor::summary const summary(auditor.audit_media(AUDIT_VALIDATE_FAST));
+		drivers.emplace_back(enumerator.current());
 
-		// if everything looks good, include the driver
-		available[enumerator.current()] = (summary == media_auditor::CORRECT) || (summary == media_auditor::BEST_AVAILABLE) || (summary == media_auditor::NONE_NEEDED);
-		++m_audited;
-	}
+	std::vector<bool> available(driver_list::total(), false);
+	media_auditor::audit_media_parallel(
+			machine().options(), drivers, AUDIT_VALIDATE_FAST,
+			[this, &available] (std::size_t driver, media_auditor const &auditor, media_auditor::summary summary)
+			{
+				m_current.store(&driver_list::driver(driver));
+
+				// if everything looks good, include the driver
+				available[driver] = (summary == media_auditor::CORRECT) || (summary == media_auditor::BEST_AVAILABLE) || (summary == media_auditor::NONE_NEEDED);
+				++m_audited;
+			});
 
 	for (ui_system_info &info : m_availablesorted)
 		info.available = available[info.index];
@@ -252,6 +252,10 @@ menu::menu(mame_ui_manager &mui, render_container &container)
 	, m_mouse_button(false)
 	, m_mouse_x(-1.0f)
 	, m_mouse_y(-1.0f)
+	, m_measured_items(0)
+	, m_measured_width(0.0f)
+	, m_measured_line_height(0.0f)
+	, m_measured_aspect(0.0f)
 {
 	assert(m_global_state); // not calling init is bad
 
@@ -286,6 +290,8 @@ void menu::reset(reset_options options)
 
 	// reset the item count back to 0
 	m_items.clear();
+	m_measured_items = 0;
+	m_measured_width = 0.0f;
 	m_visible_items = 0;
 	m_selected = 0;
 }
@@ -353,6 +359,9 @@ void menu::item_append(std::string &&text, std::string &&subtext, uint32_t flags
 	{
 		m_items.emplace(m_items.end() - 1, std::move(pitem));
 		--index;
+
+		// everything from here on has moved, so measure it again
+		m_measured_items = std::min<int>(m_measured_items, index);
 	}
 	else
 		m_items.emplace_back(std::move(pitem));
@@ -475,11 +484,19 @@ void menu::draw(uint32_t flags)
 	if (&machine().system() == &GAME_NAME(___empty) && !noimage)
 		draw_background();
 
-	// compute the width and height of the full menu
-	float visible_width = 0;
-	float visible_main_menu_height = 0;
-	for (auto const &pitem : m_items)
+	// compute the width and height of the full menu; measuring text is slow for long
+	// lists, so only items added since the last frame are measured unless the metrics changed
+	if ((line_height != m_measured_line_height) || (aspect != m_measured_aspect))
+	{
+		m_measured_items = 0;
+		m_measured_width = 0.0f;
+		m_measured_line_height = line_height;
+		m_measured_aspect = aspect;
+	}
+	for (int itemnum = m_measured_items; itemnum < m_items.size(); itemnum++)
 	{
+		menu_item const &pitem = m_items[itemnum];
+
 		// compute width of left hand side
 		float total_width = gutter_width + ui().get_string_width(pitem.text) + gutter_width;
 
@@ -488,12 +505,12 @@ void menu::draw(uint32_t flags)
 			total_width += 2.0f * gutter_width + ui().get_string_width(pitem.subtext);
 
 		// track the maximum
-		if (total_width > visible_width)
-			visible_width = total_width;
-
-		// track the height as well
-		visible_main_menu_height += line_height;
+		if (total_width > m_measured_width)
+			m_measured_width = total_width;
 	}
+	m_measured_items = m_items.size();
+	float visible_width = m_measured_width;
+	float visible_main_menu_height = float(m_items.size()) * line_height;
 
 	// account for extra space at the top and bottom
 	float const visible_extra_menu_height = m_customtop + m_custombottom;
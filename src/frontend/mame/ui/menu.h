@@ -413,6 +413,12 @@ private:
 	float                   m_mouse_x;
 	float                   m_mouse_y;
 
+	// widest item so far; only items appended since the last draw are measured
+	int                     m_measured_items;   // items measured so far, from the start
+	float                   m_measured_width;   // widest of them, including gutters
+	float                   m_measured_line_height; // metrics they were measured with
+	float                   m_measured_aspect;
+
 	static std::mutex       s_global_state_guard;
 	static global_state_map s_global_states;
 };
@@ -244,6 +244,7 @@ menu_select_game::menu_select_game(mame_ui_manager &mui, render_container &conta
 	// build drivers list
 	if (!load_available_machines())
 		build_available_list();
+	load_system_flags();
 
 	if (s_first_start)
 	{
@@ -1237,17 +1238,6 @@ render_texture *menu_select_game::get_icon_texture(int linenum, void *selectedre
 		if (m_icon_paths.empty())
 			m_icon_paths = make_icon_paths(nullptr);
 
-		// allocate an entry or allocate a texture on forced redraw
-		if (m_icons.end() == icon)
-		{
-			icon = m_icons.emplace(driver, texture_ptr(machine().render().texture_alloc(), machine().render())).first;
-		}
-		else
-		{
-			assert(!icon->second.texture);
-			icon->second.texture.reset(machine().render().texture_alloc());
-		}
-
 		// set clone status
 		bool cloneof = strcmp(driver->parent, "0");
 		if (cloneof)
@@ -1257,20 +1247,38 @@ render_texture *menu_select_game::get_icon_texture(int linenum, void *selectedre
 				cloneof = false;
 		}
 
-		bitmap_argb32 tmp;
-		emu_file snapfile(std::string(m_icon_paths), OPEN_FLAG_READ);
-		if (snapfile.open(std::string(driver->name) + ".ico") == osd_file::error::NONE)
+		// decode in the background, and draw nothing until it's ready
+		std::shared_ptr<bitmap_argb32> const tmp(fetch_image(
+				"ico\n" + m_icon_paths + '\n' + driver->name,
+				[paths = m_icon_paths, driver, cloneof] (bitmap_argb32 &bitmap)
+				{
+					emu_file snapfile(std::string(paths), OPEN_FLAG_READ);
+					if (snapfile.open(std::string(driver->name) + ".ico") == osd_file::error::NONE)
+					{
+						render_load_ico_highest_detail(snapfile, bitmap);
+						snapfile.close();
+					}
+					if (!bitmap.valid() && cloneof && (snapfile.open(std::string(driver->parent) + ".ico") == osd_file::error::NONE))
+					{
+						render_load_ico_highest_detail(snapfile, bitmap);
+						snapfile.close();
+					}
+				}));
+		if (!tmp)
+			return nullptr;
+
+		// allocate an entry or allocate a texture on forced redraw
+		if (m_icons.end() == icon)
 		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
+			icon = m_icons.emplace(driver, texture_ptr(machine().render().texture_alloc(), machine().render())).first;
 		}
-		if (!tmp.valid() && cloneof && (snapfile.open(std::string(driver->parent) + ".ico") == osd_file::error::NONE))
+		else
 		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
+			assert(!icon->second.texture);
+			icon->second.texture.reset(machine().render().texture_alloc());
 		}
 
-		scale_icon(std::move(tmp), icon->second);
+		scale_icon(*tmp, icon->second);
 	}
 
 	return icon->second.bitmap.valid() ? icon->second.texture.get() : nullptr;
@@ -1384,20 +1392,20 @@ float menu_select_game::draw_left_panel(float x1, float y1, float x2, float y2)
 
 
 //-------------------------------------------------
-//  get selected software and/or driver
+//  get software and/or driver for an item
 //-------------------------------------------------
 
-void menu_select_game::get_selection(ui_software_info const *&software, game_driver const *&driver) const
+void menu_select_game::get_item_selection(void *ref, ui_software_info const *&software, game_driver const *&driver) const
 {
 	if (m_populated_favorites)
 	{
-		software = reinterpret_cast<ui_software_info const *>(get_selection_ptr());
+		software = reinterpret_cast<ui_software_info const *>(ref);
 		driver = software ? software->driver : nullptr;
 	}
 	else
 	{
 		software = nullptr;
-		driver = reinterpret_cast<game_driver const *>(get_selection_ptr());
+		driver = reinterpret_cast<game_driver const *>(ref);
 	}
 }
 
@@ -59,8 +59,8 @@ private:
 	virtual float draw_left_panel(float x1, float y1, float x2, float y2) override;
 	virtual render_texture *get_icon_texture(int linenum, void *selectedref) override;
 
-	// get selected software and/or driver
-	virtual void get_selection(ui_software_info const *&software, game_driver const *&driver) const override;
+	// get software and/or driver for an item
+	virtual void get_item_selection(void *ref, ui_software_info const *&software, game_driver const *&driver) const override;
 	virtual bool accept_search() const override { return !isfavorite(); }
 
 	// text for main top/bottom panels
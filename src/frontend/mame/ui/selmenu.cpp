@@ -37,8 +37,16 @@
 #include "luaengine.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <optional>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 
 
@@ -152,6 +160,63 @@ void load_driver_image(bitmap_argb32 &bitmap, emu_file &file, game_driver const
 	}
 }
 
+
+// makes the cache key and a loader for a system or software item's
+// snapshot; the loader only captures copies so it can outlive the menu
+std::function<void (bitmap_argb32 &)> make_snapshot_loader(std::string const &searchstr, ui_software_info const *software, game_driver const *driver, std::string &key)
+{
+	if (software && (!software->startempty || !driver))
+	{
+		if (software->startempty == 1)
+		{
+			// Load driver snapshot
+			game_driver const &swdriver(*software->driver);
+			key = "snap\n" + searchstr + '\n' + swdriver.name;
+			return [searchstr, &swdriver] (bitmap_argb32 &bitmap)
+			{
+				emu_file snapfile(searchstr, OPEN_FLAG_READ);
+				load_driver_image(bitmap, snapfile, swdriver);
+			};
+		}
+		else
+		{
+			// First attempt from name list, second attempt from driver name + part name
+			std::string first(software->listname + PATH_SEPARATOR + software->shortname);
+			std::string second(software->driver->name + software->part + PATH_SEPARATOR + software->shortname);
+			key = "snap\n" + searchstr + '\n' + first + '\n' + second;
+			return [searchstr, first = std::move(first), second = std::move(second)] (bitmap_argb32 &bitmap)
+			{
+				emu_file snapfile(searchstr, OPEN_FLAG_READ);
+				load_image(bitmap, snapfile, first);
+				if (!bitmap.valid())
+					load_image(bitmap, snapfile, second);
+			};
+		}
+	}
+	else
+	{
+		key = "snap\n" + searchstr + '\n' + driver->name;
+		return [searchstr, driver] (bitmap_argb32 &bitmap)
+		{
+			emu_file snapfile(searchstr, OPEN_FLAG_READ);
+			load_driver_image(bitmap, snapfile, *driver);
+		};
+	}
+}
+
+
+bitmap_argb32 copy_bitmap(bitmap_argb32 const &source)
+{
+	bitmap_argb32 result;
+	if (source.valid())
+	{
+		result.allocate(source.width(), source.height());
+		for (int y = 0; source.height() > y; ++y)
+			std::copy_n(&source.pix(y), source.width(), &result.pix(y));
+	}
+	return result;
+}
+
 } // anonymous namespace
 
 constexpr std::size_t menu_select_launch::MAX_VISIBLE_SEARCH; // stupid non-inline semantics
@@ -220,6 +285,306 @@ menu_select_launch::system_flags::system_flags(machine_static_info const &info)
 {
 }
 
+menu_select_launch::system_flags::system_flags(
+		::machine_flags::type machine_flags,
+		device_t::feature_type unemulated_features,
+		device_t::feature_type imperfect_features,
+		bool has_keyboard,
+		bool has_analog,
+		rgb_t status_color)
+	: m_machine_flags(machine_flags)
+	, m_unemulated_features(unemulated_features)
+	, m_imperfect_features(imperfect_features)
+	, m_has_keyboard(has_keyboard)
+	, m_has_analog(has_analog)
+	, m_status_color(status_color)
+{
+}
+
+
+//-------------------------------------------------
+//  persistent system flags - building these
+//  means instantiating every system's machine
+//  configuration, so they're kept in a file
+//  that's only valid for the build that wrote
+//  it, and loaded in a single read; the store
+//  belongs to the menu cache, so the background
+//  thread finishes when the machine exits
+//-------------------------------------------------
+
+class menu_select_launch::system_flags_store
+{
+public:
+	system_flags_store() : m_started(false), m_abort(false), m_base(0), m_count(0) { }
+
+	~system_flags_store()
+	{
+		m_abort.store(true, std::memory_order_relaxed);
+		if (m_thread)
+			m_thread->join();
+	}
+
+	void start(std::string const &path)
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+		if (m_started)
+			return;
+		m_started = true;
+
+		if (!load(path))
+			m_thread = std::make_unique<std::thread>([this, path] () { populate(path); });
+	}
+
+	std::optional<system_flags> find(std::size_t index)
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+		if (!m_started || (index >= m_count))
+			return std::nullopt;
+
+		uint8_t const *const record(&m_image[m_base + (index * RECORD_SIZE)]);
+		if (!(record[16] & RECORD_VALID))
+			return std::nullopt;
+
+		return system_flags(
+				::machine_flags::type(get_u32(record + 0)),
+				device_t::feature_type(get_u32(record + 4)),
+				device_t::feature_type(get_u32(record + 8)),
+				record[16] & RECORD_KEYBOARD,
+				record[16] & RECORD_ANALOG,
+				rgb_t(get_u32(record + 12)));
+	}
+
+	void add(std::size_t index, system_flags const &flags)
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+		if (!m_started || (index >= m_count))
+			return;
+
+		uint8_t *const record(&m_image[m_base + (index * RECORD_SIZE)]);
+		put_u32(record + 0, flags.machine_flags());
+		put_u32(record + 4, flags.unemulated_features());
+		put_u32(record + 8, flags.imperfect_features());
+		put_u32(record + 12, flags.status_color());
+		record[16] = RECORD_VALID | (flags.has_keyboard() ? RECORD_KEYBOARD : 0) | (flags.has_analog() ? RECORD_ANALOG : 0);
+	}
+
+private:
+	static constexpr std::size_t RECORD_SIZE = 20;
+	static constexpr uint8_t RECORD_VALID = 0x01;
+	static constexpr uint8_t RECORD_KEYBOARD = 0x02;
+	static constexpr uint8_t RECORD_ANALOG = 0x04;
+	static constexpr char MAGIC[8] = { 'M', 'U', 'I', 'F', 'L', 'G', 'S', '1' };
+
+	static uint32_t get_u32(uint8_t const *src) { return src[0] | (src[1] << 8) | (src[2] << 16) | (uint32_t(src[3]) << 24); }
+	static void put_u32(uint8_t *dest, uint32_t value) { dest[0] = value; dest[1] = value >> 8; dest[2] = value >> 16; dest[3] = value >> 24; }
+
+	static std::string filename() { return std::string(emulator_info::get_configname()) + "_flags.dat"; }
+
+	// header is the magic, the build version, and the number of systems
+	std::vector<uint8_t> make_header() const
+	{
+		std::string_view const version(emulator_info::get_bare_build_version());
+		std::vector<uint8_t> result(sizeof(MAGIC) + 4 + version.length() + 4);
+		std::copy(std::begin(MAGIC), std::end(MAGIC), result.begin());
+		put_u32(&result[sizeof(MAGIC)], version.length());
+		std::copy(version.begin(), version.end(), result.begin() + sizeof(MAGIC) + 4);
+		put_u32(&result[result.size() - 4], driver_list::total());
+		return result;
+	}
+
+	// called with the mutex held; returns true if every system is present
+	bool load(std::string const &path)
+	{
+		std::vector<uint8_t> const header(make_header());
+		m_base = header.size();
+		m_count = driver_list::total();
+
+		emu_file file(path, OPEN_FLAG_READ);
+		if (file.open(filename()) == osd_file::error::NONE)
+		{
+			std::vector<uint8_t> image(file.size());
+			if ((image.size() == (m_base + (m_count * RECORD_SIZE))) &&
+					(file.read(&image[0], image.size()) == image.size()) &&
+					std::equal(header.begin(), header.end(), image.begin()))
+			{
+				m_image = std::move(image);
+				for (std::size_t index = 0; m_count > index; ++index)
+				{
+					if (!(m_image[m_base + (index * RECORD_SIZE) + 16] & RECORD_VALID))
+						return false;
+				}
+				return true;
+			}
+		}
+
+		// missing or stale - start from scratch
+		m_image = header;
+		m_image.resize(m_base + (m_count * RECORD_SIZE), 0U);
+		return false;
+	}
+
+	// if interrupted, the systems done so far are still written, and the
+	// next run fills in the rest
+	void populate(std::string const &path)
+	{
+		emu_options clean_options;
+		ui_options options;
+		for (std::size_t index = 0; (driver_list::total() > index) && !m_abort.load(std::memory_order_relaxed); ++index)
+		{
+			if (!find(index))
+			{
+				machine_config const mconfig(driver_list::driver(index), clean_options);
+				add(index, system_flags(machine_static_info(options, mconfig)));
+			}
+		}
+
+		std::vector<uint8_t> image;
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			image = m_image;
+		}
+		emu_file file(path, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		if (file.open(filename()) == osd_file::error::NONE)
+			file.write(&image[0], image.size());
+	}
+
+	std::mutex                      m_mutex;
+	std::unique_ptr<std::thread>    m_thread;
+	bool                            m_started;
+	std::atomic<bool>               m_abort;
+	std::vector<uint8_t>            m_image;
+	std::size_t                     m_base;
+	std::size_t                     m_count;
+};
+
+
+//-------------------------------------------------
+//  background artwork loader - snapshots and
+//  icons are decoded on a worker thread so
+//  scrolling doesn't wait for file access, and
+//  kept in an LRU cache bounded by total pixels
+//-------------------------------------------------
+
+class menu_select_launch::image_loader
+{
+public:
+	image_loader() : m_exit(false), m_pixels(0) { }
+
+	~image_loader()
+	{
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			m_exit = true;
+			m_urgent.reset();
+			m_queue.clear();
+		}
+		m_wakeup.notify_all();
+		if (m_thread.joinable())
+			m_thread.join();
+	}
+
+	// urgent requests jump the queue, replacing any earlier urgent request
+	std::shared_ptr<bitmap_argb32> fetch(std::string &&key, image_load_func &&load, bool urgent)
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto const found(m_loaded.find(key));
+		if (m_loaded.end() != found)
+		{
+			m_lru.splice(m_lru.end(), m_lru, found->second);
+			return found->second->second;
+		}
+
+		if (key == m_current)
+			return nullptr;
+		if (m_urgent && (m_urgent->first == key))
+			return nullptr;
+		auto const queued(std::find_if(m_queue.begin(), m_queue.end(), [&key] (request const &req) { return req.first == key; }));
+		if (urgent)
+		{
+			if (m_queue.end() != queued)
+				m_queue.erase(queued);
+			if (m_urgent)
+				m_queue.emplace_front(std::move(*m_urgent));
+			m_urgent.emplace(std::move(key), std::move(load));
+		}
+		else if (m_queue.end() == queued)
+		{
+			// anything this old has probably scrolled out of view
+			m_queue.emplace_back(std::move(key), std::move(load));
+			if (m_queue.size() > MAX_QUEUED)
+				m_queue.pop_front();
+		}
+
+		if (!m_thread.joinable())
+			m_thread = std::thread([this] () { run(); });
+		m_wakeup.notify_one();
+		return nullptr;
+	}
+
+private:
+	static constexpr std::size_t MAX_QUEUED = 64;
+	static constexpr std::size_t MAX_ENTRIES = 512;
+	static constexpr std::size_t MAX_PIXELS = 16 * 1024 * 1024;
+
+	using request = std::pair<std::string, image_load_func>;
+	using loaded_list = std::list<std::pair<std::string, std::shared_ptr<bitmap_argb32> > >;
+
+	static std::size_t cost(bitmap_argb32 const &bitmap) { return bitmap.valid() ? (std::size_t(bitmap.width()) * bitmap.height()) : 0U; }
+
+	void run()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (!m_exit)
+		{
+			if (!m_urgent && m_queue.empty())
+			{
+				m_wakeup.wait(lock);
+				continue;
+			}
+
+			request req;
+			if (m_urgent)
+			{
+				req = std::move(*m_urgent);
+				m_urgent.reset();
+			}
+			else
+			{
+				req = std::move(m_queue.front());
+				m_queue.pop_front();
+			}
+			m_current = req.first;
+
+			lock.unlock();
+			auto bitmap(std::make_shared<bitmap_argb32>());
+			req.second(*bitmap);
+			lock.lock();
+
+			m_current.clear();
+			m_pixels += cost(*bitmap);
+			m_lru.emplace_back(std::move(req.first), std::move(bitmap));
+			m_loaded.emplace(m_lru.back().first, std::prev(m_lru.end()));
+			while ((1U < m_lru.size()) && ((MAX_PIXELS < m_pixels) || (MAX_ENTRIES < m_lru.size())))
+			{
+				m_pixels -= cost(*m_lru.front().second);
+				m_loaded.erase(m_lru.front().first);
+				m_lru.pop_front();
+			}
+		}
+	}
+
+	std::mutex                                              m_mutex;
+	std::condition_variable                                 m_wakeup;
+	std::thread                                             m_thread;
+	bool                                                    m_exit;
+	std::optional<request>                                  m_urgent;
+	std::deque<request>                                     m_queue;
+	std::string                                             m_current;
+	loaded_list                                             m_lru;
+	std::unordered_map<std::string, loaded_list::iterator>  m_loaded;
+	std::size_t                                             m_pixels;
+};
+
 
 void menu_select_launch::reselect_last::reset()
 {
@@ -444,6 +809,8 @@ menu_select_launch::cache::cache(running_machine &machine)
 	, m_sw_toolbar_bitmap()
 	, m_toolbar_texture()
 	, m_sw_toolbar_texture()
+	, m_image_loader(std::make_unique<image_loader>())
+	, m_flags_store(std::make_unique<system_flags_store>())
 {
 	render_manager &render(machine.render());
 
@@ -596,10 +963,30 @@ menu_select_launch::system_flags const &menu_select_launch::get_system_flags(gam
 	if (m_flags.end() != found)
 		return found->second;
 
+	// try the persistent store
+	system_flags_store &store(m_cache->flags_store());
+	int const index(driver_list::find(driver));
+	std::optional<system_flags> stored((0 <= index) ? store.find(index) : std::nullopt);
+	if (stored)
+		return m_flags.emplace(&driver, *stored).first->second;
+
 	// aggregate flags
 	emu_options clean_options;
 	machine_config const mconfig(driver, clean_options);
-	return m_flags.emplace(&driver, machine_static_info(ui().options(), mconfig)).first->second;
+	system_flags const &result(m_flags.emplace(&driver, machine_static_info(ui().options(), mconfig)).first->second);
+	if (0 <= index)
+		store.add(index, result);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  load persistent system flags
+//-------------------------------------------------
+
+void menu_select_launch::load_system_flags()
+{
+	m_cache->flags_store().start(ui().options().ui_path());
 }
 
 
@@ -1167,7 +1554,7 @@ std::string menu_select_launch::make_icon_paths(char const *listname) const
 	return result;
 }
 
-bool menu_select_launch::scale_icon(bitmap_argb32 &&src, texture_and_bitmap &dst) const
+bool menu_select_launch::scale_icon(bitmap_argb32 &src, texture_and_bitmap &dst) const
 {
 	assert(dst.texture);
 	if (src.valid())
@@ -1184,6 +1571,7 @@ bool menu_select_launch::scale_icon(bitmap_argb32 &&src, texture_and_bitmap &dst
 
 		// reduce the source bitmap if it's too big
 		bitmap_argb32 tmp;
+		bitmap_argb32 *scaled(&src);
 		float const ratio((std::min)({ float(max_height) / src.height(), float(max_width) / src.width(), 1.0F }));
 		if (1.0F > ratio)
 		{
@@ -1191,17 +1579,14 @@ bool menu_select_launch::scale_icon(bitmap_argb32 &&src, texture_and_bitmap &dst
 			float const pix_width(src.width() * ratio);
 			tmp.allocate(int32_t(pix_width), int32_t(pix_height));
 			render_resample_argb_bitmap_hq(tmp, src, render_color{ 1.0F, 1.0F, 1.0F, 1.0F }, true);
-		}
-		else
-		{
-			tmp = std::move(src);
+			scaled = &tmp;
 		}
 
 		// copy into the destination
 		dst.bitmap.allocate(max_width, max_height);
-		for (int y = 0; tmp.height() > y; ++y)
-			for (int x = 0; tmp.width() > x; ++x)
-				dst.bitmap.pix(y, x) = tmp.pix(y, x);
+		for (int y = 0; scaled->height() > y; ++y)
+			for (int x = 0; scaled->width() > x; ++x)
+				dst.bitmap.pix(y, x) = scaled->pix(y, x);
 		dst.texture->set_bitmap(dst.bitmap, dst.bitmap.cliprect(), TEXFORMAT_ARGB32);
 		return true;
 	}
@@ -1213,6 +1598,11 @@ bool menu_select_launch::scale_icon(bitmap_argb32 &&src, texture_and_bitmap &dst
 	}
 }
 
+std::shared_ptr<bitmap_argb32> menu_select_launch::fetch_image(std::string &&key, image_load_func &&load, bool urgent)
+{
+	return m_cache->images().fetch(std::move(key), std::move(load), urgent);
+}
+
 
 template <typename T> bool menu_select_launch::select_bios(T const &driver, bool inlist)
 {
@@ -2275,27 +2665,8 @@ void menu_select_launch::arts_render(float origx1, float origy1, float origx2, f
 		// loads the image if necessary
 		if (!m_cache->snapx_software_is(software) || !snapx_valid() || m_switch_image)
 		{
-			emu_file snapfile(searchstr.c_str(), OPEN_FLAG_READ);
-			bitmap_argb32 tmp_bitmap;
-
-			if (software->startempty == 1)
-			{
-				// Load driver snapshot
-				load_driver_image(tmp_bitmap, snapfile, *software->driver);
-			}
-			else
-			{
-				// First attempt from name list
-				load_image(tmp_bitmap, snapfile, software->listname + PATH_SEPARATOR + software->shortname);
-
-				// Second attempt from driver name + part name
-				if (!tmp_bitmap.valid())
-					load_image(tmp_bitmap, snapfile, software->driver->name + software->part + PATH_SEPARATOR + software->shortname);
-			}
-
 			m_cache->set_snapx_software(software);
-			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
+			arts_load(searchstr, software, driver, origx1, origy1, origx2, origy2);
 		}
 
 		// if the image is available, loaded and valid, display it
@@ -2313,13 +2684,8 @@ void menu_select_launch::arts_render(float origx1, float origy1, float origx2, f
 		// loads the image if necessary
 		if (!m_cache->snapx_driver_is(driver) || !snapx_valid() || m_switch_image)
 		{
-			emu_file snapfile(searchstr, OPEN_FLAG_READ);
-			bitmap_argb32 tmp_bitmap;
-			load_driver_image(tmp_bitmap, snapfile, *driver);
-
 			m_cache->set_snapx_driver(driver);
-			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
+			arts_load(searchstr, nullptr, driver, origx1, origy1, origx2, origy2);
 		}
 
 		// if the image is available, loaded and valid, display it
@@ -2328,6 +2694,44 @@ void menu_select_launch::arts_render(float origx1, float origy1, float origx2, f
 }
 
 
+//-------------------------------------------------
+//  get the selected item's image from the
+//  background loader, and queue its neighbours
+//  so scrolling through the list finds them
+//  already decoded
+//-------------------------------------------------
+
+void menu_select_launch::arts_load(std::string const &searchstr, ui_software_info const *software, game_driver const *driver, float origx1, float origy1, float origx2, float origy2)
+{
+	std::string key;
+	image_load_func load(make_snapshot_loader(searchstr, software, driver, key));
+	std::shared_ptr<bitmap_argb32> const image(fetch_image(std::move(key), std::move(load), true));
+
+	// keep asking every frame until it arrives, and don't show the previous item's image meanwhile
+	m_switch_image = !image;
+	if (image)
+		arts_render_images(copy_bitmap(*image), origx1, origy1, origx2, origy2);
+
+	int const selected(selected_index());
+	for (int distance = 1; PREFETCH_IMAGES >= distance; ++distance)
+	{
+		for (int const index : { selected + distance, selected - distance })
+		{
+			if ((0 > index) || (item_count() <= index) || (uintptr_t(item(index).ref) <= skip_main_items))
+				continue;
+			ui_software_info const *nearsoft;
+			game_driver const *neardriver;
+			get_item_selection(item(index).ref, nearsoft, neardriver);
+			if (nearsoft || neardriver)
+			{
+				load = make_snapshot_loader(searchstr, nearsoft, neardriver, key);
+				fetch_image(std::move(key), std::move(load));
+			}
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  common function for images render
 //-------------------------------------------------
@@ -2481,7 +2885,7 @@ void menu_select_launch::arts_render_images(bitmap_argb32 &&tmp_bitmap, float or
 void menu_select_launch::draw_snapx(float origx1, float origy1, float origx2, float origy2)
 {
 	// if the image is available, loaded and valid, display it
-	if (snapx_valid())
+	if (snapx_valid() && !m_switch_image)
 	{
 		float const line_height = ui().get_line_height();
 		float const x1 = origx1 + 0.01f;
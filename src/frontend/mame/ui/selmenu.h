@@ -18,9 +18,11 @@
 
 #include "lrucache.h"
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <vector>
 
 
@@ -39,6 +41,7 @@ public:
 protected:
 	static constexpr std::size_t MAX_ICONS_RENDER = 128;
 	static constexpr std::size_t MAX_VISIBLE_SEARCH = 200;
+	static constexpr int PREFETCH_IMAGES = 2;            // neighbouring items' snapshots to load ahead
 
 	// tab navigation
 	enum class focused_menu
@@ -63,10 +66,20 @@ protected:
 	template <typename Key, typename Compare = std::less<Key> >
 	using texture_lru = util::lru_cache_map<Key, texture_and_bitmap, Compare>;
 
+	// decodes an image into the supplied bitmap on the artwork loader thread
+	using image_load_func = std::function<void (bitmap_argb32 &)>;
+
 	class system_flags
 	{
 	public:
 		system_flags(machine_static_info const &info);
+		system_flags(
+				::machine_flags::type machine_flags,
+				device_t::feature_type unemulated_features,
+				device_t::feature_type imperfect_features,
+				bool has_keyboard,
+				bool has_analog,
+				rgb_t status_color);
 		system_flags(system_flags const &) = default;
 		system_flags(system_flags &&) = default;
 		system_flags &operator=(system_flags const &) = default;
@@ -120,6 +133,9 @@ protected:
 
 	system_flags const &get_system_flags(game_driver const &driver);
 
+	// load the persistent system flags cache, completing it in the background if necessary
+	void load_system_flags();
+
 	void launch_system(game_driver const &driver) { launch_system(ui(), driver, nullptr, nullptr, nullptr); }
 	void launch_system(game_driver const &driver, ui_software_info const &swinfo) { launch_system(ui(), driver, &swinfo, nullptr, nullptr); }
 	void launch_system(game_driver const &driver, ui_software_info const &swinfo, std::string const &part) { launch_system(ui(), driver, &swinfo, &part, nullptr); }
@@ -145,7 +161,12 @@ protected:
 	// icon helpers
 	void check_for_icons(char const *listname);
 	std::string make_icon_paths(char const *listname) const;
-	bool scale_icon(bitmap_argb32 &&src, texture_and_bitmap &dst) const;
+	bool scale_icon(bitmap_argb32 &src, texture_and_bitmap &dst) const;
+
+	// artwork decoded in the background: returns nullptr and queues the
+	// load if the image with this key isn't ready yet; the bitmap is
+	// shared with the cache, so don't modify it
+	std::shared_ptr<bitmap_argb32> fetch_image(std::string &&key, image_load_func &&load, bool urgent = false);
 
 	// forcing refresh
 	void set_switch_image() { m_switch_image = true; }
@@ -159,6 +180,9 @@ protected:
 		return (uintptr_t(selected_ref) > skip_main_items) ? selected_ref : m_prev_selected;
 	}
 
+	// get selected software and/or driver
+	void get_selection(ui_software_info const *&software, game_driver const *&driver) const { get_item_selection(get_selection_ptr(), software, driver); }
+
 	static std::string make_system_audit_fail_text(media_auditor const &auditor, media_auditor::summary summary);
 	static std::string make_software_audit_fail_text(media_auditor const &auditor, media_auditor::summary summary);
 	static constexpr bool audit_passed(media_auditor::summary summary)
@@ -183,6 +207,8 @@ private:
 
 	class software_parts;
 	class bios_selection;
+	class image_loader;
+	class system_flags_store;
 
 	class cache
 	{
@@ -205,6 +231,9 @@ private:
 		texture_ptr_vector const &toolbar_texture() { return m_toolbar_texture; }
 		texture_ptr_vector const &sw_toolbar_texture() { return m_sw_toolbar_texture; }
 
+		image_loader &images() { return *m_image_loader; }
+		system_flags_store &flags_store() { return *m_flags_store; }
+
 	private:
 		bitmap_ptr              m_snapx_bitmap;
 		texture_ptr             m_snapx_texture;
@@ -219,6 +248,9 @@ private:
 		bitmap_vector           m_sw_toolbar_bitmap;
 		texture_ptr_vector      m_toolbar_texture;
 		texture_ptr_vector      m_sw_toolbar_texture;
+
+		std::unique_ptr<image_loader> m_image_loader;
+		std::unique_ptr<system_flags_store> m_flags_store;
 	};
 	using cache_ptr = std::shared_ptr<cache>;
 	using cache_ptr_map = std::map<running_machine *, cache_ptr>;
@@ -239,8 +271,8 @@ private:
 	void infos_render(float x1, float y1, float x2, float y2);
 	virtual void general_info(const game_driver *driver, std::string &buffer) = 0;
 
-	// get selected software and/or driver
-	virtual void get_selection(ui_software_info const *&software, game_driver const *&driver) const = 0;
+	// get software and/or driver for an item
+	virtual void get_item_selection(void *ref, ui_software_info const *&software, game_driver const *&driver) const = 0;
 	virtual bool accept_search() const { return true; }
 	void select_prev()
 	{
@@ -289,6 +321,7 @@ private:
 	void arts_render(float origx1, float origy1, float origx2, float origy2);
 	std::string arts_render_common(float origx1, float origy1, float origx2, float origy2);
 	void arts_render_images(bitmap_argb32 &&bitmap, float origx1, float origy1, float origx2, float origy2);
+	void arts_load(std::string const &searchstr, ui_software_info const *software, game_driver const *driver, float origx1, float origy1, float origx2, float origy2);
 	void draw_snapx(float origx1, float origy1, float origx2, float origy2);
 
 	// text for main top/bottom panels
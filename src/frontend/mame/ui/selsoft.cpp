@@ -581,6 +581,26 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 		if (m_icon_paths.end() == paths)
 			paths = m_icon_paths.emplace(swinfo->listname, make_icon_paths(swinfo->listname.c_str())).first;
 
+		// decode in the background, and draw nothing until it's ready
+		std::shared_ptr<bitmap_argb32> const tmp(fetch_image(
+				"ico\n" + paths->second + '\n' + swinfo->shortname,
+				[searchpath = paths->second, shortname = swinfo->shortname, parentname = swinfo->parentname] (bitmap_argb32 &bitmap)
+				{
+					emu_file snapfile(std::string(searchpath), OPEN_FLAG_READ);
+					if (snapfile.open(shortname + ".ico") == osd_file::error::NONE)
+					{
+						render_load_ico_highest_detail(snapfile, bitmap);
+						snapfile.close();
+					}
+					if (!bitmap.valid() && !parentname.empty() && (snapfile.open(parentname + ".ico") == osd_file::error::NONE))
+					{
+						render_load_ico_highest_detail(snapfile, bitmap);
+						snapfile.close();
+					}
+				}));
+		if (!tmp)
+			return nullptr;
+
 		// allocate an entry or allocate a texture on forced redraw
 		if (m_icons.end() == icon)
 		{
@@ -592,20 +612,7 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 			icon->second.texture.reset(machine().render().texture_alloc());
 		}
 
-		bitmap_argb32 tmp;
-		emu_file snapfile(std::string(paths->second), OPEN_FLAG_READ);
-		if (snapfile.open(std::string(swinfo->shortname) + ".ico") == osd_file::error::NONE)
-		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
-		}
-		if (!tmp.valid() && !swinfo->parentname.empty() && (snapfile.open(std::string(swinfo->parentname) + ".ico") == osd_file::error::NONE))
-		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
-		}
-
-		scale_icon(std::move(tmp), icon->second);
+		scale_icon(*tmp, icon->second);
 	}
 
 	return icon->second.bitmap.valid() ? icon->second.texture.get() : nullptr;
@@ -613,12 +620,12 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 
 
 //-------------------------------------------------
-//  get selected software and/or driver
+//  get software and/or driver for an item
 //-------------------------------------------------
 
-void menu_select_software::get_selection(ui_software_info const *&software, game_driver const *&driver) const
+void menu_select_software::get_item_selection(void *ref, ui_software_info const *&software, game_driver const *&driver) const
 {
-	software = reinterpret_cast<ui_software_info const *>(get_selection_ptr());
+	software = reinterpret_cast<ui_software_info const *>(ref);
 	driver = software ? software->driver : nullptr;
 }
 
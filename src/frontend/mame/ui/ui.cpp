@@ -1120,6 +1120,17 @@ void mame_ui_manager::draw_profiler(render_container &container)
 }
 
 
+//-------------------------------------------------
+//  draw_sound_stats
+//-------------------------------------------------
+
+void mame_ui_manager::draw_sound_stats(render_container &container)
+{
+	draw_text_full(container, machine().sound().stats_text(), 0.0f, 0.0f, 1.0f,
+		ui::text_layout::LEFT, ui::text_layout::WORD, OPAQUE_, rgb_t(0xf0, 0x10, 0xf0, 0xf0), rgb_t::black(), nullptr, nullptr);
+}
+
+
 //-------------------------------------------------
 //  start_save_state
 //-------------------------------------------------
@@ -1202,6 +1213,10 @@ uint32_t mame_ui_manager::handler_ingame(render_container &container)
 	if (show_profiler())
 		draw_profiler(container);
 
+	// audio pipeline statistics
+	if (machine().options().sound_stats())
+		draw_sound_stats(container);
+
 	// if we're single-stepping, pause now
 	if (single_step())
 	{
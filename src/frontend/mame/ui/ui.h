@@ -188,6 +188,7 @@ public:
 	void draw_timecode_counter(render_container &container);
 	void draw_timecode_total(render_container &container);
 	void draw_profiler(render_container &container);
+	void draw_sound_stats(render_container &container);
 	void start_save_state();
 	void start_load_state();
 
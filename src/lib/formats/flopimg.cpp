@@ -902,6 +902,7 @@ floppy_image::floppy_image(int _tracks, int _heads, uint32_t _form_factor)
 
 	form_factor = _form_factor;
 	variant = 0;
+	deferred_load = false;
 
 	track_array.resize(tracks*4+1);
 	for(int i=0; i<tracks*4+1; i++)
@@ -924,7 +925,7 @@ void floppy_image::get_actual_geometry(int &_tracks, int &_heads)
 
 	while(maxt >= 0) {
 		for(int i=0; i<=maxh; i++)
-			if(!track_array[maxt][i].cell_data.empty())
+			if(!track_array[maxt][i].cell_data.empty() || track_array[maxt][i].deferred)
 				goto track_done;
 		maxt--;
 	}
@@ -932,7 +933,7 @@ void floppy_image::get_actual_geometry(int &_tracks, int &_heads)
 	if(maxt >= 0)
 		while(maxh >= 0) {
 			for(int i=0; i<=maxt; i++)
-				if(!track_array[i][maxh].cell_data.empty())
+				if(!track_array[i][maxh].cell_data.empty() || track_array[i][maxh].deferred)
 					goto head_done;
 			maxh--;
 		}
@@ -946,7 +947,7 @@ int floppy_image::get_resolution() const
 	int mask = 0;
 	for(int i=0; i<=(tracks-1)*4; i++)
 		for(int j=0; j<heads; j++)
-			if(!track_array[i][j].cell_data.empty())
+			if(!track_array[i][j].cell_data.empty() || track_array[i][j].deferred)
 				mask |= 1 << (i & 3);
 	if(mask & 0xa)
 		return 2;
@@ -962,6 +963,8 @@ bool floppy_image::track_is_formatted(int track, int head, int subtrack)
 		return false;
 	if(int(track_array[idx].size()) <= head)
 		return false;
+	if(track_array[idx][head].deferred)
+		generate_track(track, head, subtrack);
 	const auto &data = track_array[idx][head].cell_data;
 	if(data.empty())
 		return false;
@@ -970,6 +973,24 @@ bool floppy_image::track_is_formatted(int track, int head, int subtrack)
 	return true;
 }
 
+bool floppy_image::track_is_deferred(int track, int head, int subtrack) const
+{
+	int idx = track*4 + subtrack;
+	if(int(track_array.size()) <= idx)
+		return false;
+	if(int(track_array[idx].size()) <= head)
+		return false;
+	return track_array[idx][head].deferred;
+}
+
+void floppy_image::generate_track(int track, int head, int subtrack)
+{
+	// Clear the flag first, the source fills the track through get_buffer
+	track_array[track*4+subtrack][head].deferred = false;
+	if(track_source)
+		track_source->generate(track, head, subtrack, this);
+}
+
 const char *floppy_image::get_variant_name(uint32_t form_factor, uint32_t variant)
 {
 	switch(variant) {
@@ -17,6 +17,7 @@
 #include "opresolv.h"
 #include "coretmpl.h"
 
+#include <memory>
 #include <vector>
 
 #ifndef LOG_FORMATS
@@ -649,6 +650,23 @@ floppy_image_format_t *floppy_image_format_creator()
 	return new _FormatClass();
 }
 
+// ======================> floppy_track_source
+
+//! Source for tracks whose cell data is only generated on first access.
+
+//! Formats able to rebuild any single track straight from the image
+//! file install one in the floppy_image with set_track_source() and
+//! mark the tracks it provides as deferred instead of generating them
+//! all at load time.
+class floppy_track_source
+{
+public:
+	virtual ~floppy_track_source() = default;
+
+	//! Generate the cell data for a deferred track into the image.
+	virtual void generate(int track, int head, int subtrack, floppy_image *image) = 0;
+};
+
 // ======================> floppy_image
 
 //! Class representing floppy image
@@ -759,7 +777,7 @@ public:
 	  @param head head number
 	  @return a pointer to the data buffer for this track and head
 	*/
-	std::vector<uint32_t> &get_buffer(int track, int head, int subtrack = 0) { assert(track < tracks && head < heads); return track_array[track*4+subtrack][head].cell_data; }
+	std::vector<uint32_t> &get_buffer(int track, int head, int subtrack = 0) { assert(track < tracks && head < heads); track_info &t = track_array[track*4+subtrack][head]; if(t.deferred) generate_track(track, head, subtrack); return t.cell_data; }
 
 	//! Sets the write splice position.
 	//! The "track splice" information indicates where to start writing
@@ -773,9 +791,9 @@ public:
 	    @param head
 	    @param pos the position
 	*/
-	void set_write_splice_position(int track, int head, uint32_t pos, int subtrack = 0) { assert(track < tracks && head < heads); track_array[track*4+subtrack][head].write_splice = pos; }
+	void set_write_splice_position(int track, int head, uint32_t pos, int subtrack = 0) { assert(track < tracks && head < heads); track_info &t = track_array[track*4+subtrack][head]; if(t.deferred) generate_track(track, head, subtrack); t.write_splice = pos; }
 	//! @return the current write splice position.
-	uint32_t get_write_splice_position(int track, int head, int subtrack = 0) const { assert(track < tracks && head < heads); return track_array[track*4+subtrack][head].write_splice; }
+	uint32_t get_write_splice_position(int track, int head, int subtrack = 0) { assert(track < tracks && head < heads); track_info &t = track_array[track*4+subtrack][head]; if(t.deferred) generate_track(track, head, subtrack); return t.write_splice; }
 	//! @return the maximal geometry supported by this format.
 	void get_maximal_geometry(int &tracks, int &heads) const;
 
@@ -788,6 +806,24 @@ public:
 	//! @return whether a given track is formatted
 	bool track_is_formatted(int track, int head, int subtrack = 0);
 
+	//! Allow formats to defer track generation to first access.
+	//! Only set by owners that keep the format alive as long as the
+	//! image, since the track source usually refers back to it.
+	void set_deferred_load(bool enable) { deferred_load = enable; }
+	//! @return whether the format may defer track generation.
+	bool deferred_load_allowed() const { return deferred_load; }
+
+	//! Install the source deferred tracks are generated from.
+	void set_track_source(std::unique_ptr<floppy_track_source> &&source) { track_source = std::move(source); }
+	//! @return the source deferred tracks are generated from, if any.
+	floppy_track_source *get_track_source() const { return track_source.get(); }
+
+	//! Mark a track as not generated yet; it is built by the track
+	//! source the first time its buffer or splice position is used.
+	void set_track_deferred(int track, int head, int subtrack = 0) { assert(track < tracks && head < heads); track_array[track*4+subtrack][head].deferred = true; }
+	//! @return whether a track is still untouched since it was deferred.
+	bool track_is_deferred(int track, int head, int subtrack = 0) const;
+
 	//! Returns the variant name for the particular disk form factor/variant
 	//! @param form_factor
 	//! @param variant
@@ -799,14 +835,20 @@ private:
 
 	uint32_t form_factor, variant;
 
+	bool deferred_load;
+	std::unique_ptr<floppy_track_source> track_source;
+
 	struct track_info
 	{
 		std::vector<uint32_t> cell_data;
 		uint32_t write_splice;
+		bool deferred;
 
-		track_info() { write_splice = 0; }
+		track_info() { write_splice = 0; deferred = false; }
 	};
 
+	void generate_track(int track, int head, int subtrack);
+
 	// track number multiplied by 4 then head
 	// last array size may be bigger than actual track size
 	std::vector<std::vector<track_info> > track_array;
@@ -10,6 +10,8 @@
 
 #include "formats/upd765_dsk.h"
 
+#include <cstring>
+
 
 upd765_format::upd765_format(const format *_formats) : file_header_skip_bytes(0), file_footer_skip_bytes(0), formats(_formats)
 {
@@ -175,19 +177,28 @@ floppy_image_format_t::desc_e* upd765_format::get_desc_mfm(const format &f, int
 	return desc;
 }
 
-bool upd765_format::load(io_generic *io, uint32_t form_factor, const std::vector<uint32_t> &variants, floppy_image *image)
+// Raw sectors of a loaded image, turned into a track when first accessed
+class upd765_format::deferred_tracks : public floppy_track_source
 {
-	int type = find_size(io, form_factor, variants);
-	if(type == -1)
-		return false;
+public:
+	deferred_tracks(upd765_format &format, int type) : m_format(format), m_type(type) { }
 
-	// format shouldn't exceed image geometry
-	const format &f = formats[type];
-	int img_tracks, img_heads;
-	image->get_maximal_geometry(img_tracks, img_heads);
-	if (f.track_count > img_tracks || f.head_count > img_heads)
-		return false;
+	virtual void generate(int track, int head, int subtrack, floppy_image *image) override
+	{
+		const format &f = m_format.formats[m_type];
+		if(subtrack || track >= f.track_count || head >= f.head_count)
+			return;
+		int const track_size = m_format.compute_track_size(f);
+		m_format.generate_track_from_sectors(f, track, head, &m_data[(track*f.head_count + head)*track_size], image);
+	}
+
+	upd765_format &m_format;
+	int m_type;
+	std::vector<uint8_t> m_data;
+};
 
+floppy_image_format_t::desc_e *upd765_format::get_track_desc(const format &f, int &total_size)
+{
 	floppy_image_format_t::desc_e *desc;
 	int current_size;
 	int end_gap_index;
@@ -202,11 +213,11 @@ bool upd765_format::load(io_generic *io, uint32_t form_factor, const std::vector
 		break;
 	}
 
-	int total_size = 200000000/f.cell_size;
+	total_size = 200000000/f.cell_size;
 	int remaining_size = total_size - current_size;
 	if(remaining_size < 0) {
 		osd_printf_error("upd765_format: Incorrect track layout, max_size=%d, current_size=%d\n", total_size, current_size);
-		return false;
+		return nullptr;
 	}
 
 	// Fixup the end gap
@@ -214,17 +225,59 @@ bool upd765_format::load(io_generic *io, uint32_t form_factor, const std::vector
 	desc[end_gap_index + 1].p2 = remaining_size & 15;
 	desc[end_gap_index + 1].p1 >>= 16-(remaining_size & 15);
 
-	int track_size = compute_track_size(f);
+	return desc;
+}
 
+void upd765_format::generate_track_from_sectors(const format &f, int track, int head, const uint8_t *data, floppy_image *image)
+{
 	uint8_t sectdata[40*512];
 	desc_s sectors[40];
+	int total_size;
 
-	for(int track=0; track < f.track_count; track++)
-		for(int head=0; head < f.head_count; head++) {
-			build_sector_description(f, sectdata, sectors, track, head);
-			io_generic_read(io, sectdata, file_header_skip_bytes + (track*f.head_count + head)*track_size, track_size);
-			generate_track(desc, track, head, sectors, f.sector_count, total_size, image);
-		}
+	floppy_image_format_t::desc_e *desc = get_track_desc(f, total_size);
+	build_sector_description(f, sectdata, sectors, track, head);
+	memcpy(sectdata, data, compute_track_size(f));
+	generate_track(desc, track, head, sectors, f.sector_count, total_size, image);
+}
+
+bool upd765_format::load(io_generic *io, uint32_t form_factor, const std::vector<uint32_t> &variants, floppy_image *image)
+{
+	int type = find_size(io, form_factor, variants);
+	if(type == -1)
+		return false;
+
+	// format shouldn't exceed image geometry
+	const format &f = formats[type];
+	int img_tracks, img_heads;
+	image->get_maximal_geometry(img_tracks, img_heads);
+	if (f.track_count > img_tracks || f.head_count > img_heads)
+		return false;
+
+	int total_size;
+	if(!get_track_desc(f, total_size))
+		return false;
+
+	int track_size = compute_track_size(f);
+
+	if(image->deferred_load_allowed()) {
+		// Keep the raw sectors around and only build the tracks the
+		// drive actually reaches
+		auto source = std::make_unique<deferred_tracks>(*this, type);
+		source->m_data.resize(f.track_count*f.head_count*track_size);
+		io_generic_read(io, source->m_data.data(), file_header_skip_bytes, source->m_data.size());
+		for(int track=0; track < f.track_count; track++)
+			for(int head=0; head < f.head_count; head++)
+				image->set_track_deferred(track, head);
+		image->set_track_source(std::move(source));
+	} else {
+		uint8_t trackdata[40*512];
+
+		for(int track=0; track < f.track_count; track++)
+			for(int head=0; head < f.head_count; head++) {
+				io_generic_read(io, trackdata, file_header_skip_bytes + (track*f.head_count + head)*track_size, track_size);
+				generate_track_from_sectors(f, track, head, trackdata, image);
+			}
+	}
 
 	image->set_form_variant(f.form_factor, f.variant);
 
@@ -249,9 +302,25 @@ bool upd765_format::save(io_generic *io, const std::vector<uint32_t> &variants,
 	// Format we're finally choosing
 	int chosen_candidate = -1;
 
+	// An image loaded by this format keeps its layout as long as the
+	// first track still fits it, and its untouched tracks are copied
+	// back as is
+	auto *source = dynamic_cast<deferred_tracks *>(image->get_track_source());
+	if(source && &source->m_format != this)
+		source = nullptr;
+	if(source && !image->track_is_deferred(0, 0)) {
+		candidates.push_back(source->m_type);
+		check_compatibility(image, candidates);
+		if(candidates.empty())
+			source = nullptr;
+		candidates.clear();
+	}
+	if(source)
+		chosen_candidate = source->m_type;
+
 	// Previously tested cell size
 	int min_cell_size = 0;
-	for(;;) {
+	while(chosen_candidate == -1) {
 		// Build the list of all formats for the immediately superior cell size
 		int cur_cell_size = 0;
 		candidates.clear();
@@ -344,9 +413,14 @@ bool upd765_format::save(io_generic *io, const std::vector<uint32_t> &variants,
 
 	for(int track=0; track < f.track_count; track++)
 		for(int head=0; head < f.head_count; head++) {
+			int offset = (track*f.head_count + head)*track_size;
+			if(source && image->track_is_deferred(track, head)) {
+				io_generic_write(io, &source->m_data[offset], offset, track_size);
+				continue;
+			}
 			build_sector_description(f, sectdata, sectors, track, head);
 			extract_sectors(image, f, sectors, track, head);
-			io_generic_write(io, sectdata, (track*f.head_count + head)*track_size, track_size);
+			io_generic_write(io, sectdata, offset, track_size);
 		}
 
 	return true;
@@ -45,6 +45,8 @@ public:
 	virtual bool supports_save() const override;
 
 protected:
+	class deferred_tracks;
+
 	uint64_t file_header_skip_bytes;
 	uint64_t file_footer_skip_bytes;
 
@@ -55,6 +57,8 @@ protected:
 	virtual void build_sector_description(const format &d, uint8_t *sectdata, desc_s *sectors, int track, int head) const;
 	void check_compatibility(floppy_image *image, std::vector<int> &candidates);
 	void extract_sectors(floppy_image *image, const format &f, desc_s *sdesc, int track, int head);
+	floppy_image_format_t::desc_e *get_track_desc(const format &f, int &total_size);
+	void generate_track_from_sectors(const format &f, int track, int head, const uint8_t *data, floppy_image *image);
 
 private:
 	format const *const formats;
@@ -10,6 +10,9 @@
 
 #include "formats/wd177x_dsk.h"
 
+#include <algorithm>
+#include <cstring>
+
 
 wd177x_format::wd177x_format(const format *_formats)
 {
@@ -197,6 +200,79 @@ floppy_image_format_t::desc_e* wd177x_format::get_desc_mfm(const format &f, int
 	return desc;
 }
 
+// Raw sectors of a loaded image, turned into a track when first accessed
+class wd177x_format::deferred_tracks : public floppy_track_source
+{
+public:
+	deferred_tracks(wd177x_format &format, int type) : m_format(format), m_type(type) { }
+
+	virtual void generate(int track, int head, int subtrack, floppy_image *image) override
+	{
+		const format &f = m_format.formats[m_type];
+		if(subtrack || track >= f.track_count || head >= f.head_count)
+			return;
+		m_format.generate_track_from_sectors(f, track, head, &m_data[m_format.get_image_offset(f, head, track)], image);
+	}
+
+	wd177x_format &m_format;
+	int m_type;
+	std::vector<uint8_t> m_data;
+};
+
+floppy_image_format_t::desc_e *wd177x_format::get_track_desc(const format &tf, int head, int track, int &total_size)
+{
+	floppy_image_format_t::desc_e *desc;
+	int current_size;
+	int end_gap_index;
+
+	switch (tf.encoding)
+	{
+	case floppy_image::FM:
+		desc = get_desc_fm(tf, current_size, end_gap_index);
+		break;
+	case floppy_image::MFM:
+	default:
+		desc = get_desc_mfm(tf, current_size, end_gap_index);
+		break;
+	}
+
+	total_size = 200000000/tf.cell_size;
+	int remaining_size = total_size - current_size;
+	if(remaining_size < 0) {
+		osd_printf_error("wd177x_format: Incorrect track layout, max_size=%d, current_size=%d\n", total_size, current_size);
+		return nullptr;
+	}
+
+	// Fixup the end gap
+	desc[end_gap_index].p2 = remaining_size / 16;
+	desc[end_gap_index + 1].p2 = remaining_size & 15;
+	desc[end_gap_index + 1].p1 >>= 16-(remaining_size & 15);
+
+	if (tf.encoding == floppy_image::FM)
+		desc[14].p1 = get_track_dam_fm(tf, head, track);
+	else
+		desc[16].p1 = get_track_dam_mfm(tf, head, track);
+
+	return desc;
+}
+
+bool wd177x_format::generate_track_from_sectors(const format &f, int track, int head, const uint8_t *data, floppy_image *image)
+{
+	uint8_t sectdata[40*512];
+	desc_s sectors[40];
+	int total_size;
+	const format &tf = get_track_format(f, head, track);
+
+	floppy_image_format_t::desc_e *desc = get_track_desc(tf, head, track, total_size);
+	if(!desc)
+		return false;
+
+	build_sector_description(tf, sectdata, sectors, track, head);
+	memcpy(sectdata, data, compute_track_size(tf));
+	generate_track(desc, track, head, sectors, tf.sector_count, total_size, image);
+	return true;
+}
+
 bool wd177x_format::load(io_generic *io, uint32_t form_factor, const std::vector<uint32_t> &variants, floppy_image *image)
 {
 	int type = find_size(io, form_factor, variants);
@@ -205,48 +281,36 @@ bool wd177x_format::load(io_generic *io, uint32_t form_factor, const std::vector
 
 	const format &f = formats[type];
 
-	for(int track=0; track < f.track_count; track++)
-		for(int head=0; head < f.head_count; head++) {
-			uint8_t sectdata[40*512];
-			desc_s sectors[40];
-			floppy_image_format_t::desc_e *desc;
-			int current_size;
-			int end_gap_index;
-			const format &tf = get_track_format(f, head, track);
-
-			switch (tf.encoding)
-			{
-			case floppy_image::FM:
-				desc = get_desc_fm(tf, current_size, end_gap_index);
-				break;
-			case floppy_image::MFM:
-			default:
-				desc = get_desc_mfm(tf, current_size, end_gap_index);
-				break;
+	if(image->deferred_load_allowed()) {
+		// Keep the raw sectors around and only build the tracks the
+		// drive actually reaches
+		auto source = std::make_unique<deferred_tracks>(*this, type);
+		int image_size = 0;
+		for(int track=0; track < f.track_count; track++)
+			for(int head=0; head < f.head_count; head++) {
+				int total_size;
+				const format &tf = get_track_format(f, head, track);
+				if(!get_track_desc(tf, head, track, total_size))
+					return false;
+				image_size = std::max(image_size, get_image_offset(f, head, track) + compute_track_size(tf));
 			}
 
-			int total_size = 200000000/tf.cell_size;
-			int remaining_size = total_size - current_size;
-			if(remaining_size < 0) {
-				osd_printf_error("wd177x_format: Incorrect track layout, max_size=%d, current_size=%d\n", total_size, current_size);
-				return false;
+		source->m_data.resize(image_size);
+		io_generic_read(io, source->m_data.data(), 0, image_size);
+		for(int track=0; track < f.track_count; track++)
+			for(int head=0; head < f.head_count; head++)
+				image->set_track_deferred(track, head);
+		image->set_track_source(std::move(source));
+	} else {
+		for(int track=0; track < f.track_count; track++)
+			for(int head=0; head < f.head_count; head++) {
+				uint8_t trackdata[40*512];
+				const format &tf = get_track_format(f, head, track);
+				io_generic_read(io, trackdata, get_image_offset(f, head, track), compute_track_size(tf));
+				if(!generate_track_from_sectors(f, track, head, trackdata, image))
+					return false;
 			}
-
-			// Fixup the end gap
-			desc[end_gap_index].p2 = remaining_size / 16;
-			desc[end_gap_index + 1].p2 = remaining_size & 15;
-			desc[end_gap_index + 1].p1 >>= 16-(remaining_size & 15);
-
-			if (tf.encoding == floppy_image::FM)
-				desc[14].p1 = get_track_dam_fm(tf, head, track);
-			else
-				desc[16].p1 = get_track_dam_mfm(tf, head, track);
-
-			build_sector_description(tf, sectdata, sectors, track, head);
-			int track_size = compute_track_size(tf);
-			io_generic_read(io, sectdata, get_image_offset(f, head, track), track_size);
-			generate_track(desc, track, head, sectors, tf.sector_count, total_size, image);
-		}
+	}
 
 	image->set_form_variant(f.form_factor, f.variant);
 
@@ -271,9 +335,25 @@ bool wd177x_format::save(io_generic *io, const std::vector<uint32_t> &variants,
 	// Format we're finally choosing
 	int chosen_candidate = -1;
 
+	// An image loaded by this format keeps its layout as long as the
+	// tracks written since still fit it, and its untouched tracks are
+	// copied back as is
+	auto *source = dynamic_cast<deferred_tracks *>(image->get_track_source());
+	if(source && &source->m_format != this)
+		source = nullptr;
+	if(source) {
+		const format &f = formats[source->m_type];
+		for(int track=0; source && track < f.track_count; track++)
+			for(int head=0; source && head < f.head_count; head++)
+				if(!image->track_is_deferred(track, head) && !track_is_compatible(image, get_track_format(f, head, track), track, head))
+					source = nullptr;
+		if(source)
+			chosen_candidate = source->m_type;
+	}
+
 	// Previously tested cell size
 	int min_cell_size = 0;
-	for(;;) {
+	while(chosen_candidate == -1) {
 		// Build the list of all formats for the immediately superior cell size
 		int cur_cell_size = 0;
 		candidates.clear();
@@ -367,10 +447,15 @@ bool wd177x_format::save(io_generic *io, const std::vector<uint32_t> &variants,
 	for(int track=0; track < f.track_count; track++) {
 		for(int head=0; head < f.head_count; head++) {
 			const format &tf = get_track_format(f, head, track);
+			int track_size = compute_track_size(tf);
+			int offset = get_image_offset(f, head, track);
+			if(source && image->track_is_deferred(track, head)) {
+				io_generic_write(io, &source->m_data[offset], offset, track_size);
+				continue;
+			}
 			build_sector_description(tf, sectdata, sectors, track, head);
 			extract_sectors(image, tf, sectors, track, head);
-			int track_size = compute_track_size(tf);
-			io_generic_write(io, sectdata, get_image_offset(f, head, track), track_size);
+			io_generic_write(io, sectdata, offset, track_size);
 		}
 	}
 
@@ -421,52 +506,10 @@ void wd177x_format::check_compatibility(floppy_image *image, std::vector<int> &c
 	int *ok_cands = &candidates[0];
 	for(unsigned int i=0; i < candidates.size(); i++) {
 		const format &f = formats[candidates[i]];
-		for(int track=0; track < f.track_count; track++) {
-			for(int head=0; head < f.head_count; head++) {
-				const format &tf = get_track_format(f, head, track);
-
-				auto bitstream = generate_bitstream_from_track(track, head, tf.cell_size, image);
-				std::vector<std::vector<uint8_t>> sectors;
-
-				switch (tf.encoding)
-				{
-				case floppy_image::FM:
-					sectors = extract_sectors_from_bitstream_fm_pc(bitstream);
-					break;
-				case floppy_image::MFM:
-					sectors = extract_sectors_from_bitstream_mfm_pc(bitstream);
-					break;
-				}
-				int ns = 0;
-				for(int j=0; j<256; j++)
-					if(!sectors[j].empty()) {
-						int sid;
-						if(tf.sector_base_id == -1) {
-							for(sid=0; sid < tf.sector_count; sid++)
-								if(tf.per_sector_id[sid] == j)
-									break;
-						} else
-							sid = j - tf.sector_base_id;
-						if(sid < 0 || sid > tf.sector_count)
-							goto fail;
-						if(tf.sector_base_size) {
-							if(sectors[j].size() != tf.sector_base_size)
-								goto fail;
-						} else {
-							if(sectors[j].size() != tf.per_sector_size[sid])
-								goto fail;
-						}
-						ns++;
-					}
-
-				if(ns > tf.sector_count)
+		for(int track=0; track < f.track_count; track++)
+			for(int head=0; head < f.head_count; head++)
+				if(!track_is_compatible(image, get_track_format(f, head, track), track, head))
 					goto fail;
-
-				// Be permissive of some missing sectors in later tracks
-				if(ns < tf.sector_count && track < 2)
-					goto fail;
-			}
-		}
 		*ok_cands++ = candidates[i];
 	fail:
 		;
@@ -474,6 +517,52 @@ void wd177x_format::check_compatibility(floppy_image *image, std::vector<int> &c
 	candidates.resize(ok_cands - &candidates[0]);
 }
 
+bool wd177x_format::track_is_compatible(floppy_image *image, const format &tf, int track, int head)
+{
+	auto bitstream = generate_bitstream_from_track(track, head, tf.cell_size, image);
+	std::vector<std::vector<uint8_t>> sectors;
+
+	switch (tf.encoding)
+	{
+	case floppy_image::FM:
+		sectors = extract_sectors_from_bitstream_fm_pc(bitstream);
+		break;
+	case floppy_image::MFM:
+		sectors = extract_sectors_from_bitstream_mfm_pc(bitstream);
+		break;
+	}
+	int ns = 0;
+	for(int j=0; j<256; j++)
+		if(!sectors[j].empty()) {
+			int sid;
+			if(tf.sector_base_id == -1) {
+				for(sid=0; sid < tf.sector_count; sid++)
+					if(tf.per_sector_id[sid] == j)
+						break;
+			} else
+				sid = j - tf.sector_base_id;
+			if(sid < 0 || sid > tf.sector_count)
+				return false;
+			if(tf.sector_base_size) {
+				if(sectors[j].size() != tf.sector_base_size)
+					return false;
+			} else {
+				if(sectors[j].size() != tf.per_sector_size[sid])
+					return false;
+			}
+			ns++;
+		}
+
+	if(ns > tf.sector_count)
+		return false;
+
+	// Be permissive of some missing sectors in later tracks
+	if(ns < tf.sector_count && track < 2)
+		return false;
+
+	return true;
+}
+
 // A track specific format is to be supplied.
 void wd177x_format::extract_sectors(floppy_image *image, const format &f, desc_s *sdesc, int track, int head)
 {
@@ -46,6 +46,8 @@ public:
 protected:
 	enum { FM_DAM = 0xf56f, FM_DDAM = 0xf56a, MFM_DAM = 0xfb, MFM_DDAM = 0xf8 };
 
+	class deferred_tracks;
+
 	const format *formats;
 
 	virtual const wd177x_format::format &get_track_format(const format &f, int head, int track);
@@ -59,7 +61,10 @@ protected:
 	int compute_track_size(const format &f) const;
 	virtual void build_sector_description(const format &d, uint8_t *sectdata, desc_s *sectors, int track, int head) const;
 	virtual void check_compatibility(floppy_image *image, std::vector<int> &candidates);
+	bool track_is_compatible(floppy_image *image, const format &tf, int track, int head);
 	void extract_sectors(floppy_image *image, const format &f, desc_s *sdesc, int track, int head);
+	floppy_image_format_t::desc_e *get_track_desc(const format &tf, int head, int track, int &total_size);
+	bool generate_track_from_sectors(const format &f, int track, int head, const uint8_t *data, floppy_image *image);
 };
 
 #endif // MAME_FORMATS_WD177X_DSK_H
@@ -15,6 +15,9 @@
 #include "../plib/plists.h"
 #include "../plib/pstring.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace netlist
 {
 	// -----------------------------------------------------------------------------
@@ -70,6 +73,19 @@ namespace netlist
 #endif
 		}
 
+		template <class R>
+		void qremove(const R &elem, const netlist_time_ext &exec_time) noexcept
+		{
+#if (!NL_USE_QUEUE_STATS)
+			m_queue.remove<false>(elem, exec_time);
+#else
+			if (!m_use_stats)
+				m_queue.remove<false>(elem, exec_time);
+			else
+				m_queue.remove<true>(elem, exec_time);
+#endif
+		}
+
 		// Control functions
 
 		void stop();
@@ -94,6 +110,25 @@ namespace netlist
 
 		void print_stats() const;
 
+		/// \brief Entry of the runtime profile
+		///
+		struct profile_entry
+		{
+			pstring       m_kind;     //!< "total", "queue", "solver" or "device"
+			pstring       m_name;
+			std::uint64_t m_calls;
+			nl_fptype     m_seconds;
+		};
+
+		/// \brief Where time was spent while statistics were enabled
+		///
+		/// The first entry is the time spent in the main loop, followed by
+		/// the time spent outside of device updates (queue handling) and an
+		/// entry for each matrix solver and each device that was called,
+		/// in order of decreasing time.
+		///
+		std::vector<profile_entry> profile() const;
+
 		constexpr bool stats_enabled() const noexcept { return m_use_stats; }
 		void enable_stats(bool val) noexcept { m_use_stats = val; }
 
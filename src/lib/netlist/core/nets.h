@@ -68,7 +68,7 @@ namespace netlist
 			void push_to_queue(const netlist_time &delay) noexcept
 			{
 				if (!!is_queued())
-					exec().qremove(this);
+					exec().qremove(this, m_next_scheduled_time);
 
 				m_next_scheduled_time = exec().time() + delay;
 #if (AVOID_NOOP_QUEUE_PUSHES)
@@ -185,7 +185,7 @@ namespace netlist
 #if (AVOID_NOOP_QUEUE_PUSHES)
 					if (!!is_queued())
 					{
-						exec().qremove(this);
+						exec().qremove(this, m_next_scheduled_time);
 						m_in_queue = queue_status::DELAYED_DUE_TO_INACTIVE;
 					}
 #endif
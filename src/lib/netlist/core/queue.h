@@ -31,8 +31,13 @@ namespace netlist
 		// template <class T, bool TS>
 		// using timed_queue = plib::timed_queue_heap<T, TS>;
 
+#if (NL_USE_CALENDAR_QUEUE)
+		template <class T, bool TS>
+		using timed_queue = plib::timed_queue_calendar<T, TS>;
+#else
 		template <class T, bool TS>
 		using timed_queue = plib::timed_queue_linear<T, TS>;
+#endif
 
 		// -----------------------------------------------------------------------------
 		// queue_t
@@ -83,8 +88,8 @@ namespace netlist
 				m_qsize = this->size();
 				for (std::size_t i = 0; i < m_qsize; i++ )
 				{
-					m_times[i] =  this->listptr()[i].exec_time().as_raw();
-					m_net_ids[i] = m_get_id(this->listptr()[i].object());
+					m_times[i] =  (*this)[i].exec_time().as_raw();
+					m_net_ids[i] = m_get_id((*this)[i].object());
 				}
 			}
 			void on_post_load(plib::state_manager_t &manager) override
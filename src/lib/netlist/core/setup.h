@@ -167,6 +167,8 @@ namespace netlist
 		param_ref_t find_param(const pstring &param_in) const;
 		// needed by nltool
 		std::vector<pstring> get_terminals_for_device_name(const pstring &devname) const;
+		// flattened C++ netlist with all subcircuits expanded
+		pstring flat_netlist(const pstring &name) const;
 
 		// needed by proxy device to check power terminals
 		detail::core_terminal_t *find_terminal(const pstring &terminal_in, detail::terminal_type atype, bool required = true) const;
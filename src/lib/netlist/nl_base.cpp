@@ -381,6 +381,41 @@ namespace netlist
 		log().verbose("Maximum pool memory allocated: {1:12} kB", nlstate().pool().max_alloc() >> 10);
 	}
 
+	std::vector<netlist_t::profile_entry> netlist_t::profile() const
+	{
+		std::vector<profile_entry> ret;
+		if (!m_use_stats)
+			return ret;
+
+		using ticks = plib::pperftime_t<true>;
+		const auto seconds = [](ticks::type t)
+		{
+			return plib::narrow_cast<nl_fptype>(t) / plib::narrow_cast<nl_fptype>(plib::chrono::exact_ticks::per_second());
+		};
+
+		ticks::type device_time(0);
+		std::vector<profile_entry> entries;
+		for (const auto &d : m_state.devices())
+		{
+			const auto *stats = d.second->stats();
+			if (stats == nullptr || stats->m_stat_total_time.count() == 0)
+				continue;
+			const bool is_solver(dynamic_cast<const solver::matrix_solver_t *>(d.second.get()) != nullptr);
+			entries.push_back({ is_solver ? "solver" : "device", d.first,
+				stats->m_stat_total_time.count(), seconds(stats->m_stat_total_time.total()) });
+			device_time += stats->m_stat_total_time.total();
+		}
+		std::sort(entries.begin(), entries.end(),
+				[](const profile_entry &a, const profile_entry &b) { return a.m_seconds > b.m_seconds; });
+
+		const ticks::type loop_time(m_stat_mainloop.total());
+		ret.push_back({ "total", "main loop", m_stat_mainloop.count(), seconds(loop_time) });
+		ret.push_back({ "queue", "queue and dispatch", m_perf_out_processed(),
+			seconds(loop_time > device_time ? loop_time - device_time : 0) });
+		ret.insert(ret.end(), entries.begin(), entries.end());
+		return ret;
+	}
+
 	void netlist_state_t::print_stats(stats_info &si) const
 	{
 		std::vector<size_t> index;
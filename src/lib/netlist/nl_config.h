@@ -66,6 +66,17 @@
 #define NL_USE_QUEUE_STATS             (0)
 #endif
 
+/// \brief  Use a calendar queue for the main event queue.
+///
+/// Logic events are scheduled within a few gate delays of the current
+/// time. A calendar queue keeps the sorted lists short for netlists
+/// with many pending events. Set to 0 to use the sorted linear queue.
+///
+
+#ifndef NL_USE_CALENDAR_QUEUE
+#define NL_USE_CALENDAR_QUEUE          (1)
+#endif
+
 /// \brief  Compile in academic solvers
 ///
 /// Set to 0 to disable compiling the following solvers:
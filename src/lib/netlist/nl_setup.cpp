@@ -17,7 +17,9 @@
 
 #include "solver/nld_solver.h"
 
+#include <algorithm>
 #include <sstream>
+#include <unordered_set>
 
 namespace netlist
 {
@@ -641,6 +643,76 @@ std::vector<pstring> setup_t::get_terminals_for_device_name(const pstring &devna
 	return terms;
 }
 
+pstring setup_t::flat_netlist(const pstring &name) const
+{
+	// Only builtin devices are emitted, macro devices have already been
+	// expanded into them. Parameters of macro devices are left out as well,
+	// their values have been substituted into the builtin devices.
+	std::unordered_set<pstring> devices;
+	pstring devs;
+	for (const auto &d : m_abstract.m_device_factory)
+		if (d.second->type() == factory::element_type::BUILTIN)
+		{
+			devices.insert(d.first);
+			devs += plib::pfmt("\tNET_REGISTER_DEV({1}, {2})\n")(d.second->name(), d.first);
+		}
+
+	std::vector<pstring> params;
+	std::vector<pstring> models;
+	for (const auto &p : m_abstract.m_param_values)
+	{
+		auto pos = plib::find_last_of(p.first, pstring("."));
+		if (pos == pstring::npos || devices.count(plib::left(p.first, pos)) == 0
+			|| m_params.find(p.first) == m_params.end())
+			continue;
+		pstring v = get_initial_param_val(p.first, "");
+		params.push_back(plib::pfmt("\tPARAM({1}, \"{2}\")\n")(p.first, v));
+		// follow models and the models they are based on
+		for (pstring m = plib::ucase(v); m_abstract.m_models.count(m) != 0; )
+		{
+			if (std::find(models.begin(), models.end(), m) != models.end())
+				break;
+			models.push_back(m);
+			const pstring &def = m_abstract.m_models.find(m)->second;
+			m = plib::ucase(plib::trim(plib::left(def, def.find('('))));
+		}
+	}
+
+	std::vector<pstring> aliases;
+	for (const auto &a : m_abstract.m_alias)
+		aliases.push_back(plib::pfmt("\tALIAS({1}, {2})\n")(a.first, a.second));
+
+	std::vector<pstring> hints;
+	for (const auto &h : m_abstract.m_hints)
+	{
+		auto pos = h.first.find(".HINT_");
+		if (pos != pstring::npos)
+			hints.push_back(plib::pfmt("\tHINT({1}, {2})\n")(plib::left(h.first, pos), h.first.substr(pos + 6)));
+	}
+
+	std::sort(params.begin(), params.end());
+	std::sort(models.begin(), models.end());
+	std::sort(aliases.begin(), aliases.end());
+	std::sort(hints.begin(), hints.end());
+
+	pstring ret = plib::pfmt("NETLIST_START({1})\n\n")(name);
+	for (const auto &m : models)
+		ret += plib::pfmt("\tNET_MODEL(\"{1} {2}\")\n")(m, m_abstract.m_models.find(m)->second);
+	ret += "\n" + devs + "\n";
+	for (const auto &a : aliases)
+		ret += a;
+	ret += "\n";
+	for (const auto &l : m_abstract.m_links)
+		ret += plib::pfmt("\tNET_C({1}, {2})\n")(l.first, l.second);
+	ret += "\n";
+	for (const auto &p : params)
+		ret += p;
+	for (const auto &h : hints)
+		ret += h;
+	ret += "\nNETLIST_END()\n";
+	return ret;
+}
+
 detail::core_terminal_t *setup_t::find_terminal(const pstring &terminal_in, bool required) const
 {
 	const pstring &tname = resolve_alias(terminal_in);
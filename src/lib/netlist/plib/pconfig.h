@@ -65,6 +65,19 @@
 ///
 #define PUSE_ALIGNED_HINTS      (PUSE_ALIGNED_OPTIMIZATIONS)
 
+/// \brief Use explicit SIMD for dense vector operations.
+///
+/// Set this to one to use AVX or NEON intrinsics for the row operations
+/// in \ref vector_ops.h when the target supports them.
+///
+#ifndef PUSE_SIMD_VECTOR_OPS
+#if defined(__EMSCRIPTEN__)
+#define PUSE_SIMD_VECTOR_OPS (0)
+#else
+#define PUSE_SIMD_VECTOR_OPS (1)
+#endif
+#endif
+
 /// \brief Number of bytes for cache line alignment
 ///
 #define PALIGN_CACHELINE        (64)
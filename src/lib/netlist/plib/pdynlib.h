@@ -11,6 +11,9 @@
 #include "pstring.h"
 #include "ptypes.h"
 
+#include <memory>
+#include <vector>
+
 namespace plib {
 	// ----------------------------------------------------------------------------------------
 	// pdynlib: dynamic loading of libraries  ...
@@ -93,6 +96,40 @@ namespace plib {
 		const dynlib_static_sym *m_syms;
 	};
 
+	/// \brief Look symbols up in several libraries in turn.
+	///
+	/// Symbols are taken from the first library that has them.
+	///
+	class dynlib_chain : public dynlib_base
+	{
+	public:
+		dynlib_chain() = default;
+
+		void add(std::unique_ptr<dynlib_base> &&lib)
+		{
+			if (lib->isLoaded())
+			{
+				m_libs.push_back(std::move(lib));
+				set_loaded(true);
+			}
+		}
+
+	protected:
+		void *getsym_p(const pstring &name) const noexcept override
+		{
+			for (const auto &lib : m_libs)
+			{
+				void *sym = lib->getsym<void *>(name);
+				if (sym != nullptr)
+					return sym;
+			}
+			return nullptr;
+		}
+
+	private:
+		std::vector<std::unique_ptr<dynlib_base>> m_libs;
+	};
+
 	template <typename R, typename... Args>
 	class dynproc
 	{
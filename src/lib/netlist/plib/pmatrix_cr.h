@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <array>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace plib
@@ -335,6 +336,78 @@ namespace plib
 			}
 		}
 
+		/// \brief record the elimination steps for the current fill pattern
+		///
+		/// Walks the sparsity pattern once, as gaussian_elimination does on
+		/// every call, and stores the positions each row elimination reads
+		/// and updates. Must be called after build_from_fill_mat.
+		///
+		void build_elimination_scheme()
+		{
+			const std::size_t iN = base_type::size();
+
+			m_ge_pivot_end.clear();
+			m_ge_elim.clear();
+			m_ge_update.clear();
+
+			for (std::size_t i = 0; i < iN - 1; i++)
+			{
+				std::size_t nzbdp = 0;
+				const std::size_t pi = base_type::diag[i] + 1;
+				const std::size_t piie = base_type::row_idx[i+1];
+
+				const auto *nz = base_type::m_nzbd[i];
+				while (auto j = nz[nzbdp++]) // NOLINT(bugprone-infinite-loop)
+				{
+					std::size_t pj = base_type::row_idx[j];
+					const std::size_t pje = base_type::row_idx[j+1];
+
+					while (base_type::col_idx[pj] < i)
+						pj++;
+
+					const std::size_t pf = pj++;
+
+					for (std::size_t pii = pi; pii<piie && pj < pje; pii++)
+					{
+						while (base_type::col_idx[pj] < base_type::col_idx[pii])
+							pj++;
+						if (base_type::col_idx[pj] == base_type::col_idx[pii])
+							m_ge_update.emplace_back(narrow_cast<index_type>(pii), narrow_cast<index_type>(pj++));
+					}
+					m_ge_elim.push_back({narrow_cast<index_type>(j), narrow_cast<index_type>(pf), m_ge_update.size()});
+				}
+				m_ge_pivot_end.push_back(m_ge_elim.size());
+			}
+		}
+
+		/// \brief gaussian elimination using the recorded scheme
+		///
+		/// Same result as gaussian_elimination, but only does the numeric
+		/// work. build_elimination_scheme must have been called.
+		///
+		template <typename V>
+		void gaussian_elimination_scheduled(V & RHS)
+		{
+			std::size_t e = 0;
+			std::size_t u = 0;
+
+			for (std::size_t i = 0; i < m_ge_pivot_end.size(); i++)
+			{
+				const auto f = reciprocal(base_type::A[base_type::diag[i]]);
+
+				for (const std::size_t ee = m_ge_pivot_end[i]; e < ee; e++)
+				{
+					const auto &el = m_ge_elim[e];
+					const typename base_type::value_type f1 = - base_type::A[el.factor] * f;
+
+					for (; u < el.update_end; u++)
+						base_type::A[m_ge_update[u].second] += base_type::A[m_ge_update[u].first] * f1;
+
+					RHS[el.row] += f1 * RHS[i];
+				}
+			}
+		}
+
 		int get_parallel_level(std::size_t k) const
 		{
 			for (std::size_t i = 0; i <  m_ge_par.size(); i++)
@@ -478,6 +551,17 @@ namespace plib
 			//  printf("%d %d\n", (int) k, (int) m_ge_par[k].size());
 		}
 		std::vector<std::vector<std::size_t>> m_ge_par; // parallel execution support for Gauss
+
+		struct ge_elim_t
+		{
+			index_type row;          // row eliminated
+			index_type factor;       // position of the element eliminated
+			std::size_t update_end;  // end of this elimination's updates in m_ge_update
+		};
+
+		std::vector<std::size_t> m_ge_pivot_end;  // end of each pivot row's eliminations in m_ge_elim
+		std::vector<ge_elim_t> m_ge_elim;
+		std::vector<std::pair<index_type, index_type>> m_ge_update;  // (source, target) positions in A
 	};
 
 	template<typename B>
@@ -14,8 +14,10 @@
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace plib {
 
@@ -83,6 +85,131 @@ namespace plib {
 		long m_count;
 	};
 
+	/// \brief Persistent worker threads for short parallel loops.
+	///
+	/// Workers spin for a while after each batch before parking, so
+	/// batches issued in quick succession don't pay for waking threads
+	/// up. The calling thread takes part in every batch.
+	///
+	class pworker_pool
+	{
+	public:
+		/// \brief Create a pool.
+		///
+		/// \param threads Total number of threads including the caller.
+		explicit pworker_pool(std::size_t threads)
+		: m_generation(0)
+		, m_next(0)
+		, m_checked_out(0)
+		, m_count(0)
+		, m_func(nullptr)
+		, m_param(nullptr)
+		, m_exit(false)
+		{
+			for (std::size_t i = 1; i < threads; i++)
+				m_threads.emplace_back([this] () { worker(); });
+		}
+
+		pworker_pool(const pworker_pool &) = delete;
+		pworker_pool &operator=(const pworker_pool &) = delete;
+		pworker_pool(pworker_pool &&) = delete;
+		pworker_pool &operator=(pworker_pool &&) = delete;
+
+		~pworker_pool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_exit = true;
+				m_generation.fetch_add(1, std::memory_order_release);
+			}
+			m_cv.notify_all();
+			for (auto &t : m_threads)
+				t.join();
+		}
+
+		std::size_t size() const noexcept { return m_threads.size() + 1; }
+
+		/// \brief Call what(i) for every i in [0, count) and wait for all of them.
+		template <typename T>
+		void for_each(std::size_t count, T &&what)
+		{
+			m_count = count;
+			m_func = [] (const void *param, std::size_t i) { (*static_cast<const std::remove_reference_t<T> *>(param))(i); };
+			m_param = &what;
+			m_next.store(0, std::memory_order_relaxed);
+			m_checked_out.store(0, std::memory_order_relaxed);
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_generation.fetch_add(1, std::memory_order_release);
+			}
+			m_cv.notify_all();
+
+			run_items();
+
+			// every worker has to check out before the batch state can be reused
+			for (std::size_t spins = 0; m_checked_out.load(std::memory_order_acquire) != m_threads.size(); spins++)
+				backoff(spins);
+		}
+
+	private:
+		static constexpr std::size_t BUSY_LOOPS = 1000;
+		static constexpr std::size_t SPIN_LOOPS = 20000;
+
+		// give up the time slice once a wait gets long, in case the
+		// thread being waited for shares this core
+		static void backoff(std::size_t spins)
+		{
+			if (spins >= BUSY_LOOPS)
+				std::this_thread::yield();
+		}
+
+		void run_items()
+		{
+			for (std::size_t i = m_next.fetch_add(1, std::memory_order_relaxed); i < m_count; i = m_next.fetch_add(1, std::memory_order_relaxed))
+				m_func(m_param, i);
+		}
+
+		void worker()
+		{
+			std::size_t seen = 0;
+			while (true)
+			{
+				std::size_t gen = m_generation.load(std::memory_order_acquire);
+				for (std::size_t spins = 0; gen == seen && spins < SPIN_LOOPS; spins++)
+				{
+					backoff(spins);
+					gen = m_generation.load(std::memory_order_acquire);
+				}
+				if (gen == seen)
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_cv.wait(lock, [this, seen] () { return m_generation.load(std::memory_order_acquire) != seen; });
+					gen = m_generation.load(std::memory_order_acquire);
+				}
+				seen = gen;
+				if (m_exit)
+					break;
+
+				run_items();
+				m_checked_out.fetch_add(1, std::memory_order_release);
+			}
+		}
+
+		std::vector<std::thread> m_threads;
+		std::mutex m_mutex;
+		std::condition_variable m_cv;
+		PALIGNAS_CACHELINE()
+		std::atomic<std::size_t> m_generation;
+		PALIGNAS_CACHELINE()
+		std::atomic<std::size_t> m_next;
+		PALIGNAS_CACHELINE()
+		std::atomic<std::size_t> m_checked_out;
+		std::size_t m_count;
+		void (*m_func)(const void *, std::size_t);
+		const void *m_param;
+		bool m_exit;
+	};
+
 
 } // namespace plib
 
@@ -172,6 +172,14 @@ namespace plib {
 			//printf("Element not found in delete %s\n", elem->name().c_str());
 		}
 
+		// the time hint is only used by timed_queue_calendar
+		template <bool KEEPSTAT, class R, typename Time>
+		void remove(const R &elem, const Time &exec_time) noexcept
+		{
+			plib::unused_var(exec_time);
+			remove<KEEPSTAT>(elem);
+		}
+
 		void clear() noexcept
 		{
 			lock_guard_type lck(m_lock);
@@ -276,6 +284,14 @@ namespace plib {
 			}
 		}
 
+		// the time hint is only used by timed_queue_calendar
+		template <bool KEEPSTAT, class R, typename Time>
+		void remove(const R &elem, const Time &exec_time) noexcept
+		{
+			plib::unused_var(exec_time);
+			remove<KEEPSTAT>(elem);
+		}
+
 		void clear()
 		{
 			lock_guard_type lck(m_lock);
@@ -303,6 +319,203 @@ namespace plib {
 		pperfcount_t<true> m_prof_remove; // NOLINT
 	};
 
+	// Calendar queue
+	//
+	// Entries are spread over BUCKETS buckets by time, each bucket
+	// 2^WIDTH_SHIFT time units wide and kept sorted like timed_queue_linear.
+	// Logic events are scheduled within a few gate delays of the current
+	// time, so pushes and pops only ever touch short lists close to the
+	// current bucket.  Entries more than a full turn of the calendar ahead
+	// share buckets with nearer ones and are skipped until their turn.
+	//
+	// Entries with equal times always land in the same bucket, so they are
+	// returned last in, first out exactly as timed_queue_linear does.
+
+	template <class T, bool TS, std::size_t BUCKETS = 256, unsigned WIDTH_SHIFT = 7>
+	class timed_queue_calendar
+	{
+	public:
+
+		static_assert((BUCKETS & (BUCKETS - 1)) == 0, "BUCKETS must be a power of 2");
+
+		explicit timed_queue_calendar(const std::size_t list_size)
+		: m_buckets(BUCKETS)
+		, m_capacity(list_size)
+		{
+			clear();
+		}
+		~timed_queue_calendar() = default;
+
+		PCOPYASSIGNMOVE(timed_queue_calendar, delete)
+
+		std::size_t capacity() const noexcept { return m_capacity; }
+		bool empty() const noexcept { return m_size == 0; }
+
+		template<bool KEEPSTAT, typename... Args>
+		void emplace(Args&&... args) noexcept
+		{
+			push<KEEPSTAT>(T(std::forward<Args>(args)...));
+		}
+
+		template<bool KEEPSTAT>
+		void push(T && e) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			const bool new_top(m_size == 0 || e <= top());
+			const std::size_t b(bucket_of(e.exec_time()));
+			bucket_type &list(m_buckets[b]);
+			list.push_back(std::move(e));
+			for (std::size_t i = list.size() - 1; i > 0 && list[i-1] < list[i]; --i)
+			{
+				std::swap(list[i-1], list[i]);
+				if (KEEPSTAT)
+					m_prof_sortmove.inc();
+			}
+			if (new_top)
+				m_top = b;
+			++m_size;
+			if (KEEPSTAT)
+				m_prof_call.inc();
+		}
+
+		void pop() noexcept
+		{
+			bucket_type &list(m_buckets[m_top]);
+			const auto t(list.back().exec_time());
+			list.pop_back();
+			if (--m_size != 0)
+				find_top(t);
+		}
+
+		const T &top() const noexcept { return m_size ? m_buckets[m_top].back() : m_never; }
+
+		template <bool KEEPSTAT, class R>
+		void remove(const R &elem) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			if (KEEPSTAT)
+				m_prof_remove.inc();
+			for (std::size_t b = 0; b < BUCKETS; b++)
+				if (remove_from(b, elem))
+					return;
+		}
+
+		// the time the element was queued for narrows the search to one bucket
+		template <bool KEEPSTAT, class R, typename Time>
+		void remove(const R &elem, const Time &exec_time) noexcept
+		{
+			{
+				// Lock
+				lock_guard_type lck(m_lock);
+				if (KEEPSTAT)
+					m_prof_remove.inc();
+				if (remove_from(bucket_of(exec_time), elem))
+					return;
+			}
+			remove<false>(elem);
+		}
+
+		void clear() noexcept
+		{
+			lock_guard_type lck(m_lock);
+			for (auto &list : m_buckets)
+				list.clear();
+			m_size = 0;
+			m_top = 0;
+		}
+
+		// save state support & mame disasm
+		// Buckets are visited in index order.  Within a bucket the order
+		// matches timed_queue_linear, which is all pushing the entries
+		// again needs to restore the queue.
+
+		std::size_t size() const noexcept { return m_size; }
+		const T & operator[](std::size_t index) const noexcept
+		{
+			for (const auto &list : m_buckets)
+			{
+				if (index < list.size())
+					return list[index];
+				index -= list.size();
+			}
+			return m_never;
+		}
+	private:
+		using mutex_type       = pspin_mutex<TS>;
+		using lock_guard_type  = std::lock_guard<mutex_type>;
+		using bucket_type      = std::vector<T>;
+
+		template <typename Time>
+		static std::size_t bucket_of(const Time &t) noexcept
+		{
+			return static_cast<std::size_t>(t.as_raw() >> WIDTH_SHIFT) & (BUCKETS - 1);
+		}
+
+		template <class R>
+		bool remove_from(std::size_t b, const R &elem) noexcept
+		{
+			bucket_type &list(m_buckets[b]);
+			for (std::size_t i = list.size(); i-- > 0; )
+			{
+				// == operator ignores time!
+				if (list[i] == elem)
+				{
+					const bool was_top(b == m_top && i + 1 == list.size());
+					const auto t(list[i].exec_time());
+					list.erase(list.begin() + static_cast<std::ptrdiff_t>(i));
+					if (--m_size != 0 && was_top)
+						find_top(t);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// Locate the earliest entry, given that none is earlier than t.
+		template <typename Time>
+		void find_top(const Time &t) noexcept
+		{
+			const auto slot(t.as_raw() >> WIDTH_SHIFT);
+			for (std::size_t i = 0; i < BUCKETS; i++)
+			{
+				const std::size_t b((static_cast<std::size_t>(slot) + i) & (BUCKETS - 1));
+				const bucket_type &list(m_buckets[b]);
+				if (!list.empty() && (list.back().exec_time().as_raw() >> WIDTH_SHIFT) <= slot + static_cast<decltype(slot)>(i))
+				{
+					m_top = b;
+					return;
+				}
+			}
+
+			// nothing within a turn of the calendar: search directly
+			const T *best(nullptr);
+			for (std::size_t b = 0; b < BUCKETS; b++)
+			{
+				const bucket_type &list(m_buckets[b]);
+				if (!list.empty() && (best == nullptr || list.back() < *best))
+				{
+					best = &list.back();
+					m_top = b;
+				}
+			}
+		}
+
+		mutex_type               m_lock;
+		std::vector<bucket_type> m_buckets;
+		std::size_t              m_capacity;
+		std::size_t              m_size = 0;
+		std::size_t              m_top = 0;
+		T                        m_never = T::never();
+
+	public:
+		// profiling
+		pperfcount_t<true> m_prof_sortmove; // NOLINT
+		pperfcount_t<true> m_prof_call; // NOLINT
+		pperfcount_t<true> m_prof_remove; // NOLINT
+	};
+
 } // namespace plib
 
 #endif // PTIMED_QUEUE_H_
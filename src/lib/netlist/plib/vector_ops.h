@@ -18,6 +18,16 @@
 #include <array>
 #include <type_traits>
 
+#if PUSE_SIMD_VECTOR_OPS
+#if defined(__AVX__)
+#include <immintrin.h>
+#define PHAS_SIMD_AVX (1)
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define PHAS_SIMD_NEON (1)
+#endif
+#endif
+
 #if !defined(__clang__) && !defined(_MSC_VER) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ > 6))
 #if !(__GNUC__ > 7 || (__GNUC__ == 7 && __GNUC_MINOR__ > 3))
 #pragma GCC diagnostic push
@@ -110,6 +120,51 @@ namespace plib
 			result[i] += scalar * v[i];
 	}
 
+	// Explicit SIMD versions for the row operations of the dense solvers.
+	// Multiply and add are kept separate so results match the loop above.
+
+#if defined(PHAS_SIMD_AVX)
+	inline void vec_add_mult_scalar_p(const std::size_t n, double * result, const double * v, double scalar) noexcept
+	{
+		const __m256d s = _mm256_set1_pd(scalar);
+		std::size_t i = 0;
+		for ( ; i + 4 <= n; i += 4)
+			_mm256_storeu_pd(result + i, _mm256_add_pd(_mm256_loadu_pd(result + i), _mm256_mul_pd(s, _mm256_loadu_pd(v + i))));
+		for ( ; i < n; i++)
+			result[i] += scalar * v[i];
+	}
+
+	inline void vec_add_mult_scalar_p(const std::size_t n, float * result, const float * v, float scalar) noexcept
+	{
+		const __m256 s = _mm256_set1_ps(scalar);
+		std::size_t i = 0;
+		for ( ; i + 8 <= n; i += 8)
+			_mm256_storeu_ps(result + i, _mm256_add_ps(_mm256_loadu_ps(result + i), _mm256_mul_ps(s, _mm256_loadu_ps(v + i))));
+		for ( ; i < n; i++)
+			result[i] += scalar * v[i];
+	}
+#elif defined(PHAS_SIMD_NEON)
+	inline void vec_add_mult_scalar_p(const std::size_t n, double * result, const double * v, double scalar) noexcept
+	{
+		const float64x2_t s = vdupq_n_f64(scalar);
+		std::size_t i = 0;
+		for ( ; i + 2 <= n; i += 2)
+			vst1q_f64(result + i, vaddq_f64(vld1q_f64(result + i), vmulq_f64(s, vld1q_f64(v + i))));
+		for ( ; i < n; i++)
+			result[i] += scalar * v[i];
+	}
+
+	inline void vec_add_mult_scalar_p(const std::size_t n, float * result, const float * v, float scalar) noexcept
+	{
+		const float32x4_t s = vdupq_n_f32(scalar);
+		std::size_t i = 0;
+		for ( ; i + 4 <= n; i += 4)
+			vst1q_f32(result + i, vaddq_f32(vld1q_f32(result + i), vmulq_f32(s, vld1q_f32(v + i))));
+		for ( ; i < n; i++)
+			result[i] += scalar * v[i];
+	}
+#endif
+
 	template<typename R, typename V>
 	void vec_add_ip(R & result, const V & v) noexcept
 	{
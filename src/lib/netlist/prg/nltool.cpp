@@ -26,6 +26,7 @@
 #include <iomanip> // scanf
 #include <ios>
 #include <iostream> // scanf
+#include <map>
 
 #ifndef NL_DISABLE_DYNAMIC_LOAD
 #define NL_DISABLE_DYNAMIC_LOAD 0
@@ -46,7 +47,7 @@ public:
 		m_errors(0),
 
 		opt_grp1(*this,     "General options",              "The following options apply to all commands."),
-		opt_cmd (*this,     "c", "cmd",         0,          std::vector<pstring>({"run","validate","convert","listdevices","listmodels","static","header","docheader","tests"}), "run|validate|convert|listdevices|listmodels|static|header|docheader|tests"),
+		opt_cmd (*this,     "c", "cmd",         0,          std::vector<pstring>({"run","validate","convert","listdevices","listmodels","static","header","docheader","tests","fpcheck","flatten"}), "run|validate|convert|listdevices|listmodels|static|header|docheader|tests|fpcheck|flatten"),
 		opt_includes(*this, "I", "include",                 "Add the directory to the list of directories to be searched for header files. This option may be specified repeatedly."),
 		opt_defines(*this,  "D", "define",                  "predefine value as macro, e.g. -Dname=value. If '=value' is omitted predefine it as 1. This option may be specified repeatedly."),
 		opt_rfolders(*this, "r", "rom",                     "where to look for data files"),
@@ -67,7 +68,7 @@ public:
 		opt_dir(*this,      "d", "dir",        "",          "output directory for the generated files."),
 		opt_out(*this,      "o", "output",     "",          "single output file for the generated code.\nEither --dir or --output can be specificied"),
 
-		opt_grp4(*this,     "Options for run command",      "These options are only used by the run command."),
+		opt_grp4(*this,     "Options for run command",      "These options are used by the run and fpcheck commands."),
 		opt_ttr (*this,     "t", "time_to_run", 1,          "time to run the emulation (seconds)"),
 		opt_boostlib(*this,  "",  "boost_lib", "builtin",   "generic: will use generic solvers.\nbuiltin: Use optimized solvers compiled in.\nsomelib.so: Use library with precompiled solvers."),
 		opt_stats(*this,    "s", "statistics",              "gather runtime statistics"),
@@ -97,7 +98,11 @@ public:
 		opt_ex4(*this,     "nltool --cmd static --output src/lib/netlist/generated/static_solvers.cpp src/mame/audio/nl_*.cpp src/mame/machine/nl_*.cpp",
 				"Create static solvers for the MAME project."),
 		opt_ex5(*this,     "nltool --cmd tests",
-			"Run unit tests. In case the unit tests are not linked in, this will do nothing.")
+			"Run unit tests. In case the unit tests are not linked in, this will do nothing."),
+		opt_ex6(*this,     "nltool -c fpcheck -t 2 -i congo_bongo.csv congo_bongo.cpp",
+			"Run the netlist with DOUBLE and with FLOAT solvers and list the solvers accurate enough to use FLOAT."),
+		opt_ex7(*this,     "nltool -c flatten -n congo_bongo -o nl_congo_bongo_flat.cpp congo_bongo.cpp",
+			"Write the netlist with all subcircuits expanded as a single C++ netlist.")
 		{}
 
 	int execute() override;
@@ -161,6 +166,8 @@ private:
 	plib::option_example opt_ex3;
 	plib::option_example opt_ex4;
 	plib::option_example opt_ex5;
+	plib::option_example opt_ex6;
+	plib::option_example opt_ex7;
 
 	struct compile_map_entry
 	{
@@ -175,8 +182,12 @@ private:
 	void logger(plib::plog_level l, const pstring &ls);
 
 	void run_with_progress(netlist_tool_t &nt, netlist::netlist_time_ext nlstart, netlist::netlist_time_ext ttr);
+	std::vector<std::vector<netlist::nl_fptype>> sample_solver_nets(
+			const std::vector<std::pair<pstring, pstring>> &params,
+			pstring &main_solver, std::vector<pstring> &net_solvers);
 
 	void run();
+	void fpcheck();
 	void validate();
 	void convert();
 
@@ -184,6 +195,7 @@ private:
 		const pstring &name, netlist::solver::static_compile_target target,
 		compile_map &map);
 	void static_compile();
+	void flatten();
 
 	void mac_out(const pstring &s, bool cont = true);
 	void header_entry(const netlist::factory::element_t *e);
@@ -251,7 +263,8 @@ public:
 			const std::vector<pstring> &logs,
 			const std::vector<pstring> &defines,
 			const std::vector<pstring> &roms,
-			const std::vector<pstring> &includes)
+			const std::vector<pstring> &includes,
+			const std::vector<std::pair<pstring, pstring>> &params = {})
 	{
 		// read the netlist ...
 
@@ -268,6 +281,10 @@ public:
 		parser().include(name);
 		parser().register_dynamic_log_devices(logs);
 
+		// overrides for values set by the netlist
+		for (const auto & p : params)
+			parser().register_param(p.first, p.second);
+
 		// start devices
 		setup().prepare_to_run();
 	}
@@ -529,6 +546,139 @@ void tool_app_t::run()
 	pout("{1:f} seconds emulation took {2:f} real time ==> {3:5.2f}%\n",
 			(ttr - nlstart).as_fp<netlist::nl_fptype>(), emutime,
 			(ttr - nlstart).as_fp<netlist::nl_fptype>() / emutime * netlist::nlconst::hundred());
+
+	if (opt_stats())
+	{
+		auto profile(nt.exec().profile());
+		const auto total(profile.empty() ? netlist::nlconst::zero() : profile[0].m_seconds);
+		pout("\n{1:-6} {2:-40} {3:12} {4:10} {5:6}\n", "kind", "name", "calls", "seconds", "%");
+		for (const auto &e : profile)
+			pout("{1:-6} {2:-40} {3:12} {4:10.4f} {5:6.2f}\n", e.m_kind, e.m_name, e.m_calls, e.m_seconds,
+				total > netlist::nlconst::zero() ? e.m_seconds / total * netlist::nlconst::hundred() : netlist::nlconst::zero());
+	}
+}
+
+// Run the netlist and sample the voltage of every net handled by a matrix
+// solver at even intervals.  Returns one row of voltages per sample.
+
+static constexpr std::size_t FPCHECK_SAMPLES = 1000;
+
+std::vector<std::vector<netlist::nl_fptype>> tool_app_t::sample_solver_nets(
+		const std::vector<std::pair<pstring, pstring>> &params,
+		pstring &main_solver, std::vector<pstring> &net_solvers)
+{
+	netlist_tool_t nt(plib::plog_delegate(&tool_app_t::logger, this), "netlist", opt_boostlib());
+
+	if (!opt_verb())
+		nt.log().verbose.set_enabled(false);
+	if (opt_quiet())
+		nt.log().info.set_enabled(false);
+
+	nt.read_netlist(opt_files()[0], opt_name(),
+			opt_logs(),
+			m_defines, opt_rfolders(), opt_includes(), params);
+
+	std::vector<input_t> inps = read_input(nt.setup(), opt_inp());
+	nt.free_setup_resources();
+	nt.exec().reset();
+
+	std::vector<const netlist::analog_net_t *> nets;
+	net_solvers.clear();
+	for (const auto &n : nt.nets())
+	{
+		const auto *an = dynamic_cast<const netlist::analog_net_t *>(n.get());
+		if (an != nullptr && an->solver() != nullptr)
+		{
+			nets.push_back(an);
+			net_solvers.push_back(an->solver()->name());
+		}
+	}
+	main_solver = (nt.exec().solver() != nullptr) ? nt.exec().solver()->name() : pstring("");
+
+	std::vector<std::vector<netlist::nl_fptype>> samples;
+	std::size_t pos = 0;
+	for (std::size_t s = 1; s <= FPCHECK_SAMPLES; s++)
+	{
+		const auto next(netlist::netlist_time_ext::from_fp(opt_ttr() * static_cast<netlist::nl_fptype>(s)
+			/ static_cast<netlist::nl_fptype>(FPCHECK_SAMPLES)));
+		for (; pos < inps.size() && inps[pos].m_time < next; pos++)
+		{
+			if (inps[pos].m_time > nt.exec().time())
+				nt.exec().process_queue(inps[pos].m_time - nt.exec().time());
+			inps[pos].setparam();
+		}
+		nt.exec().process_queue(next - nt.exec().time());
+
+		samples.emplace_back();
+		for (const auto *n : nets)
+			samples.back().push_back(n->Q_Analog());
+	}
+	nt.exec().stop();
+	return samples;
+}
+
+// Compare a run with FLOAT solvers against a DOUBLE reference run. A solver
+// passes if no net it handles strays further from the reference than
+// FPCHECK_RELTOL of the net's peak voltage, or FPCHECK_ABSTOL for nets
+// close to zero.
+
+void tool_app_t::fpcheck()
+{
+	using netlist::nl_fptype;
+	const nl_fptype FPCHECK_RELTOL = netlist::nlconst::magic(1e-3);
+	const nl_fptype FPCHECK_ABSTOL = netlist::nlconst::magic(1e-4);
+
+	if (opt_files().size() != 1)
+		throw netlist::nl_exception("nltool: fpcheck needs exactly one file");
+
+	if (!netlist::config::use_float_matrix::value)
+	{
+		pout("FLOAT solvers are not compiled in (NL_USE_FLOAT_MATRIX)\n");
+		return;
+	}
+
+	pstring main_solver;
+	std::vector<pstring> owners;
+	pout("reference run with DOUBLE solvers ...\n");
+	const auto ref(sample_solver_nets({}, main_solver, owners));
+	if (owners.empty())
+	{
+		pout("netlist has no matrix solvers\n");
+		return;
+	}
+
+	pstring unused;
+	std::vector<pstring> float_owners;
+	pout("check run with FLOAT solvers ...\n");
+	const auto chk(sample_solver_nets({{main_solver + ".FPTYPE", "FLOAT"}}, unused, float_owners));
+	if (float_owners != owners)
+		throw netlist::nl_exception("nltool: FLOAT run built different solvers");
+
+	// worst error relative to the tolerance, per solver
+	std::map<pstring, std::pair<std::size_t, nl_fptype>> result;
+	for (std::size_t i = 0; i < owners.size(); i++)
+	{
+		nl_fptype peak = netlist::nlconst::zero();
+		nl_fptype err = netlist::nlconst::zero();
+		for (std::size_t s = 0; s < ref.size(); s++)
+		{
+			peak = std::max(peak, plib::abs(ref[s][i]));
+			err = std::max(err, plib::abs(chk[s][i] - ref[s][i]));
+		}
+		auto &r = result[owners[i]];
+		r.first++;
+		r.second = std::max(r.second, err / std::max(peak * FPCHECK_RELTOL, FPCHECK_ABSTOL));
+	}
+
+	pout("\n{1:-30} {2:6} {3:12} {4}\n", "solver", "nets", "error/tol", "");
+	for (const auto &r : result)
+		pout("{1:-30} {2:6} {3:12.4f} {4}\n", r.first, r.second.first, r.second.second,
+			r.second.second <= netlist::nlconst::one() ? "FLOAT" : "DOUBLE");
+
+	pout("\n");
+	for (const auto &r : result)
+		if (r.second.second <= netlist::nlconst::one())
+			pout("PARAM({1}.FPTYPE, FLOAT)\n", r.first);
 }
 
 void tool_app_t::validate()
@@ -712,6 +862,34 @@ void tool_app_t::static_compile()
 	}
 }
 
+void tool_app_t::flatten()
+{
+	if (opt_files().size() != 1)
+		throw netlist::nl_exception("nltool: flatten needs exactly one file");
+
+	netlist_tool_t nt(plib::plog_delegate(&tool_app_t::logger, this), "netlist", opt_boostlib());
+
+	nt.log().verbose.set_enabled(false);
+	nt.log().info.set_enabled(false);
+
+	nt.read_netlist(opt_files()[0], opt_name(),
+			opt_logs(),
+			m_defines, opt_rfolders(), opt_includes());
+
+	pstring name = opt_name.was_specified() ? opt_name() : pstring("flat");
+	pstring flat = nt.setup().flat_netlist(name);
+
+	if (opt_out.was_specified())
+	{
+		plib::ofstream sout(opt_out());
+		if (sout.fail())
+			throw netlist::nl_exception(netlist::MF_FILE_OPEN_ERROR(opt_out()));
+		sout << putf8string(flat);
+	}
+	else
+		pout("{}", flat);
+}
+
 
 
 // "Description: The Swiss army knife for timing purposes\n"
@@ -1307,10 +1485,14 @@ int tool_app_t::execute()
 			listmodels();
 		else if (cmd == "run")
 			run();
+		else if (cmd == "fpcheck")
+			fpcheck();
 		else if (cmd == "validate")
 			validate();
 		else if (cmd == "static")
 			static_compile();
+		else if (cmd == "flatten")
+			flatten();
 		else if (cmd == "header")
 			create_header();
 		else if (cmd == "docheader")
@@ -50,7 +50,11 @@ namespace solver
 		, m_stat_newton_raphson(*this, "m_stat_newton_raphson", 0)
 		, m_stat_newton_raphson_fail(*this, "m_stat_newton_raphson_fail", 0)
 		, m_stat_vsolver_calls(*this, "m_stat_vsolver_calls", 0)
+		, m_stat_ts_accepted(*this, "m_stat_ts_accepted", 0)
+		, m_stat_ts_rejected(*this, "m_stat_ts_rejected", 0)
+		, m_ts_err_m_1(*this, "m_ts_err_m_1", nlconst::one())
 		, m_last_step(*this, "m_last_step", netlist_time_ext::zero())
+		, m_batch_end(*this, "m_batch_end", netlist_time_ext::zero())
 		, m_ops(0)
 	{
 		setup_base(this->state().setup(), nets);
@@ -553,6 +557,32 @@ namespace solver
 
 	}
 
+	netlist_time matrix_solver_t::control_timestep(fptype cur_ts, fptype err, fptype lte_ts, fptype min_ts, fptype max_ts) noexcept
+	{
+		if (err > nlconst::one())
+			++m_stat_ts_rejected;
+		else
+			++m_stat_ts_accepted;
+
+		fptype new_ts(lte_ts);
+		if (m_params.m_dynamic_pi)
+		{
+			// PI controller (Gustafsson): the integral term follows the
+			// current error, the proportional term its trend. Exponents are
+			// 0.7/k and 0.4/k with k = 2 for the first order estimate. This
+			// avoids the step size oscillating around the LTE limit.
+			const fptype e(std::max(err, nlconst::magic(1e-6)));
+			const fptype fac(nlconst::magic(0.9) * plib::pow(e, nlconst::magic(-0.35))
+				* plib::pow(m_ts_err_m_1(), nlconst::magic(0.2)));
+			new_ts = cur_ts * std::max(nlconst::magic(0.2), std::min(nlconst::two(), fac));
+			m_ts_err_m_1 = e;
+		}
+		new_ts = std::max(std::min(new_ts, max_ts), min_ts);
+
+		// FIXME: Factor 2 below is important. Without, we get timing issues. This must be a bug elsewhere.
+		return std::max(netlist_time::from_fp(new_ts), netlist_time::quantum() * 2);
+	}
+
 	int matrix_solver_t::get_net_idx(const analog_net_t *net) const noexcept
 	{
 		for (std::size_t k = 0; k < m_terms.size(); k++)
@@ -654,8 +684,14 @@ namespace solver
 			log().verbose("       ==> {1} nets", this->m_terms.size());
 			log().verbose("       has {1} dynamic elements", this->dynamic_device_count());
 			log().verbose("       has {1} timestep elements", this->timestep_device_count());
-			log().verbose("       {1:6.3} average newton raphson loops",
-						static_cast<fptype>(this->m_stat_newton_raphson) / static_cast<fptype>(this->m_stat_vsolver_calls));
+			log().verbose("       {1:6.3} average newton raphson loops, {2} total, {3} exceeded NR_LOOPS",
+						static_cast<fptype>(this->m_stat_newton_raphson) / static_cast<fptype>(this->m_stat_vsolver_calls),
+						this->m_stat_newton_raphson, this->m_stat_newton_raphson_fail);
+			if (this->m_stat_ts_accepted + this->m_stat_ts_rejected > 0)
+				log().verbose("       {1:10} time steps accepted {2:10} over DYNAMIC_LTE ({3:6.2} %)",
+						this->m_stat_ts_accepted, this->m_stat_ts_rejected,
+						nlconst::hundred() * static_cast<fptype>(this->m_stat_ts_rejected)
+							/ static_cast<fptype>(this->m_stat_ts_accepted + this->m_stat_ts_rejected));
 			log().verbose("       {1:10} invocations ({2:6.0} Hz)  {3:10} gs fails ({4:6.2} %) {5:6.3} average",
 					this->m_stat_calculations,
 					static_cast<fptype>(this->m_stat_calculations) / this->exec().time().as_fp<fptype>(),
@@ -79,14 +79,17 @@ namespace solver
 		// general parameters
 		constexpr nl_fptype          m_gmin() { return nlconst::magic(1e-9); }
 		constexpr bool               m_pivot() { return false; }
+		constexpr bool               m_dense_rows() { return false; }
 		constexpr nl_fptype          m_nr_recalc_delay(){ return netlist_time::quantum().as_fp<nl_fptype>(); }
 		constexpr int                m_parallel() { return 0; }
+		constexpr nl_fptype          m_batch_time() { return nlconst::zero(); }
 
 		constexpr nl_fptype          m_min_ts_ts() { return nlconst::magic(1e-9); }
 		// automatic time step
 		constexpr bool               m_dynamic_ts() { return false; }
 		constexpr nl_fptype          m_dynamic_lte() { return nlconst::magic(1e-5); }
 		constexpr nl_fptype          m_dynamic_min_ts() { return nlconst::magic(1e-6); }
+		constexpr bool               m_dynamic_pi() { return false; }
 
 		// matrix sorting
 		constexpr matrix_sort_type_e m_sort_type() { return matrix_sort_type_e::PREFER_IDENTITY_TOP_LEFT; }
@@ -120,14 +123,17 @@ namespace solver
 		// general parameters
 		, m_gmin(parent, prefix + "GMIN", defaults.m_gmin())
 		, m_pivot(parent, prefix + "PIVOT", defaults.m_pivot())               ///< use pivoting on supported solvers
+		, m_dense_rows(parent, prefix + "DENSE_ROWS", defaults.m_dense_rows())  ///< eliminate well filled rows with vector operations on supported solvers
 		, m_nr_recalc_delay(parent, prefix + "NR_RECALC_DELAY", defaults.m_nr_recalc_delay()) ///< Delay to next solve attempt if nr loops exceeded
 		, m_parallel(parent, prefix + "PARALLEL", defaults.m_parallel())
+		, m_batch_time(parent, prefix + "BATCH_TIME", defaults.m_batch_time()) ///< Fold input changes arriving within this time into one solve
 		, m_min_ts_ts(parent, prefix + "MIN_TS_TS", defaults.m_min_ts_ts()) ///< The minimum time step for solvers with time stepping devices.
 
 		// automatic time step
 		, m_dynamic_ts(parent, prefix + "DYNAMIC_TS", defaults.m_dynamic_ts())     ///< Use dynamic time stepping
 		, m_dynamic_lte(parent, prefix + "DYNAMIC_LTE", defaults.m_dynamic_lte())    ///< dynamic time stepping slope
 		, m_dynamic_min_ts(parent, prefix + "DYNAMIC_MIN_TIMESTEP", defaults.m_dynamic_min_ts()) ///< smallest time step allowed
+		, m_dynamic_pi(parent, prefix + "DYNAMIC_PI", defaults.m_dynamic_pi()) ///< use a PI controller on the truncation error to pick the time step
 
 		// matrix sorting
 		, m_sort_type(parent, prefix + "SORT_TYPE", defaults.m_sort_type())
@@ -160,12 +166,15 @@ namespace solver
 		param_num_t<std::size_t> m_gs_loops;
 		param_fp_t m_gmin;
 		param_logic_t  m_pivot;
+		param_logic_t  m_dense_rows;
 		param_fp_t m_nr_recalc_delay;
 		param_int_t m_parallel;
+		param_fp_t m_batch_time;
 		param_fp_t m_min_ts_ts;
 		param_logic_t m_dynamic_ts;
 		param_fp_t m_dynamic_lte;
 		param_fp_t m_dynamic_min_ts;
+		param_logic_t m_dynamic_pi;
 		param_enum_t<matrix_sort_type_e> m_sort_type;
 
 		param_logic_t m_use_gabs;
@@ -280,6 +289,17 @@ namespace solver
 		template <typename F>
 		void change_state(F f)
 		{
+			// With BATCH_TIME set, the first change opens a window and
+			// schedules one solve at its end. Changes arriving before then,
+			// e.g. further edges from logic driving the group through
+			// proxies, are applied and left for that solve.
+			const bool batching(m_params.m_batch_time() > nlconst::zero());
+			if (batching && exec().time() < m_batch_end())
+			{
+				f();
+				return;
+			}
+
 			// We only need to update the net first if this is a time stepping net
 			if (timestep_device_count() > 0)
 			{
@@ -288,13 +308,15 @@ namespace solver
 				update_inputs();
 			}
 			f();
-			if (timestep_device_count() > 0)
+			netlist_time ts(timestep_device_count() > 0
+				? netlist_time::from_fp(m_params.m_min_ts_ts())
+				: netlist_time::quantum());
+			if (batching)
 			{
-				PFDEBUG(printf("here2\n");)
-				this->reschedule(netlist_time::from_fp(m_params.m_min_ts_ts()));
+				ts = std::max(ts, netlist_time::from_fp(m_params.m_batch_time()));
+				m_batch_end = exec().time() + ts;
 			}
-			else
-				this->reschedule(netlist_time::quantum());
+			this->reschedule(ts);
 		}
 
 		NETLIB_RESETI();
@@ -330,6 +352,16 @@ namespace solver
 			return max_rail;
 		}
 
+		/// \brief pick the next time step from the truncation error estimate
+		///
+		/// err is the largest local truncation error of the step just taken
+		/// relative to DYNAMIC_LTE, lte_ts the step which would bring it to
+		/// DYNAMIC_LTE. Steps with err > 1 are counted as rejected. Since
+		/// the solve time is fixed by the event queue they are kept, the
+		/// controller shortens the next step instead.
+		///
+		netlist_time control_timestep(fptype cur_ts, fptype err, fptype lte_ts, fptype min_ts, fptype max_ts) noexcept;
+
 		const solver_parameters_t &m_params;
 
 		plib::pmatrix2d_vrl<fptype, arena_type>    m_gonn;
@@ -374,8 +406,13 @@ namespace solver
 		state_var<std::size_t> m_stat_newton_raphson;
 		state_var<std::size_t> m_stat_newton_raphson_fail;
 		state_var<std::size_t> m_stat_vsolver_calls;
+		state_var<std::size_t> m_stat_ts_accepted;
+		state_var<std::size_t> m_stat_ts_rejected;
+
+		state_var<fptype> m_ts_err_m_1;
 
 		state_var<netlist_time_ext> m_last_step;
+		state_var<netlist_time_ext> m_batch_end;  // solve folding in changes under BATCH_TIME is due here
 		plib::aligned_vector<nldelegate_ts> m_step_funcs;
 		plib::aligned_vector<nldelegate_dyn> m_dynamic_funcs;
 		plib::aligned_vector<device_arena::unique_ptr<proxied_analog_output_t>> m_inps;
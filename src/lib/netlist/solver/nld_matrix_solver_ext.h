@@ -172,6 +172,7 @@ namespace solver
 		netlist_time compute_next_timestep(fptype cur_ts, fptype min_ts, fptype max_ts) override
 		{
 			fptype new_solver_timestep_sq(max_ts * max_ts);
+			fptype err(plib::constants<fptype>::zero()); // largest truncation error relative to DYNAMIC_LTE
 
 			for (std::size_t k = 0; k < size(); k++)
 			{
@@ -193,13 +194,12 @@ namespace solver
 					// save the sqrt for the end
 					const fptype new_net_timestep_sq = m_params.m_dynamic_lte / plib::abs(nlconst::half()*DD2);
 					new_solver_timestep_sq = std::min(new_net_timestep_sq, new_solver_timestep_sq);
+					err = std::max(err, hn * hn / new_net_timestep_sq);
 				}
 			}
 
-			new_solver_timestep_sq = std::max(plib::sqrt(new_solver_timestep_sq), min_ts);
-
-			// FIXME: Factor 2 below is important. Without, we get timing issues. This must be a bug elsewhere.
-			return std::max(netlist_time::from_fp(new_solver_timestep_sq), netlist_time::quantum() * 2);
+			return this->control_timestep(cur_ts, static_cast<nl_fptype>(err),
+				static_cast<nl_fptype>(plib::sqrt(new_solver_timestep_sq)), min_ts, max_ts);
 		}
 
 		template <typename M>
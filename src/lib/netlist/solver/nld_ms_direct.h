@@ -73,13 +73,30 @@ namespace solver
 				const auto &nzrd = this->m_terms[i].m_nzrd;
 				const auto &nzbd = this->m_terms[i].m_nzbd;
 
-				for (auto &j : nzbd)
+				// Entries right of the diagonal outside nzrd are zero, so
+				// a well filled row can be eliminated as a contiguous
+				// block with vector operations instead of by index.
+				const std::size_t rest = kN - i - 1;
+				if (this->m_params.m_dense_rows && nzrd.size() * 2 >= rest)
 				{
-					auto &Aj = m_A[j];
-					const FT f1 = -f * Aj[i];
-					for (auto &k : nzrd)
-						Aj[k] += Ai[k] * f1;
-					this->m_RHS[j] += this->m_RHS[i] * f1;
+					for (auto &j : nzbd)
+					{
+						auto &Aj = m_A[j];
+						const FT f1 = -f * Aj[i];
+						plib::vec_add_mult_scalar_p(rest, &Aj[i+1], &Ai[i+1], f1);
+						this->m_RHS[j] += this->m_RHS[i] * f1;
+					}
+				}
+				else
+				{
+					for (auto &j : nzbd)
+					{
+						auto &Aj = m_A[j];
+						const FT f1 = -f * Aj[i];
+						for (auto &k : nzrd)
+							Aj[k] += Ai[k] * f1;
+						this->m_RHS[j] += this->m_RHS[i] * f1;
+					}
 				}
 			}
 		}
@@ -64,6 +64,7 @@ namespace solver
 			this->log_fill(fill, mat);
 
 			mat.build_from_fill_mat(fill);
+			mat.build_elimination_scheme();
 
 			for (mat_index_type k=0; k<iN; k++)
 			{
@@ -331,7 +332,8 @@ namespace solver
 			// now solve it
 			// parallel is slow -- very slow
 			// mat.gaussian_elimination_parallel(RHS);
-			mat.gaussian_elimination(this->m_RHS);
+			// the pattern is fixed, so use the elimination recorded in the constructor
+			mat.gaussian_elimination_scheduled(this->m_RHS);
 			// backward substitution
 			mat.gaussian_back_substitution(this->m_new_V, this->m_RHS);
 		}
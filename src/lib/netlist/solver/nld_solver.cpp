@@ -54,7 +54,7 @@ namespace devices
 	NETLIB_HANDLER(solver, fb_step)
 	{
 		const netlist_time_ext now(exec().time());
-		const std::size_t nthreads = m_params.m_parallel() < 2 ? 1 : std::min(static_cast<std::size_t>(m_params.m_parallel()), plib::omp::get_max_threads());
+		const std::size_t nthreads = m_pool ? m_pool->size() : 1;
 		const netlist_time_ext sched(now + (nthreads <= 1 ? netlist_time_ext::zero() : netlist_time_ext::from_nsec(100)));
 		plib::uninitialised_array<solver::matrix_solver_t *, config::MAX_SOLVER_QUEUE_SIZE::value> tmp; //NOLINT
 		plib::uninitialised_array<netlist_time, config::MAX_SOLVER_QUEUE_SIZE::value> nt; //NOLINT
@@ -71,9 +71,25 @@ namespace devices
 			m_queue.pop();
 		}
 
-		// FIXME: Disabled for now since parallel processing will decrease performance
-		//        for tested applications. More testing required here
-		if (true || nthreads < 2)
+		// Handing groups to other threads only pays off if there's enough
+		// work besides the biggest group, which bounds the speedup.
+		// Nonlinear groups usually need several Newton-Raphson iterations.
+		constexpr std::size_t PARALLEL_MIN_OPS = 1000;
+		bool parallel = false;
+		if (!KEEP_STATS && nthreads > 1 && p > 1)
+		{
+			std::size_t total = 0;
+			std::size_t largest = 0;
+			for (std::size_t i = 0; i < p; i++)
+			{
+				const std::size_t cost = tmp[i]->ops() * (tmp[i]->dynamic_device_count() > 0 ? 4 : 1);
+				total += cost;
+				largest = std::max(largest, cost);
+			}
+			parallel = (total - largest) >= PARALLEL_MIN_OPS;
+		}
+
+		if (!parallel)
 		{
 			if (!KEEP_STATS)
 			{
@@ -101,8 +117,7 @@ namespace devices
 		}
 		else
 		{
-			plib::omp::set_num_threads(nthreads);
-			plib::omp::for_static(static_cast<std::size_t>(0), p, [&tmp, &nt,now](std::size_t i)
+			m_pool->for_each(p, [&tmp, &nt, now](std::size_t i)
 				{
 					nt[i] = tmp[i]->solve(now, "parallel");
 				});
@@ -482,6 +497,13 @@ namespace devices
 			m_mat_solvers.push_back(std::move(ms));
 		}
 
+		// the worker pool persists so batches don't pay for starting threads
+		const std::size_t nthreads = std::min(static_cast<std::size_t>(std::max(m_params.m_parallel(), 0)), static_cast<std::size_t>(std::thread::hardware_concurrency()));
+		if (nthreads > 1 && m_mat_solvers.size() > 1)
+		{
+			log().verbose("Using {1} threads for solving", nthreads);
+			m_pool = std::make_unique<plib::pworker_pool>(nthreads);
+		}
 	}
 
 	solver::static_compile_container NETLIB_NAME(solver)::create_solver_code(solver::static_compile_target target)
@@ -146,6 +146,7 @@ public:
 	bool valid() const { return (m_base != nullptr); }
 	palette_t *palette() const { return m_palette; }
 	const rectangle &cliprect() const { return m_cliprect; }
+	uint32_t allocated_bytes() const { return m_allocbytes; }
 
 	// allocation/sizing
 	void allocate(int width, int height, int xslop = 0, int yslop = 0);
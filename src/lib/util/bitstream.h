@@ -38,8 +38,11 @@ public:
 	uint32_t flush();
 
 private:
+	// internal helpers
+	void refill();
+
 	// internal state
-	uint32_t          m_buffer;       // current bit accumulator
+	uint64_t          m_buffer;       // current bit accumulator, left-justified
 	int             m_bits;         // number of bits in the accumulator
 	const uint8_t *   m_read;         // read pointer
 	uint32_t          m_doffset;      // byte offset within the data
@@ -90,6 +93,39 @@ inline bitstream_in::bitstream_in(const void *src, uint32_t srclength)
 }
 
 
+//-------------------------------------------------
+//  refill - top up the accumulator, a whole word
+//  at a time away from the end of the data
+//-------------------------------------------------
+
+inline void bitstream_in::refill()
+{
+	if (m_doffset + 8 <= m_dlength)
+	{
+		// load eight bytes big-endian and keep the whole ones that fit
+		uint64_t word = 0;
+		for (int byte = 0; byte < 8; byte++)
+			word = (word << 8) | m_read[m_doffset + byte];
+		int const bytes = (64 - m_bits) >> 3;
+		m_buffer |= word >> m_bits;
+		m_bits += bytes * 8;
+		m_buffer &= ~uint64_t(0) << (64 - m_bits);
+		m_doffset += bytes;
+	}
+	else
+	{
+		// near the end, a byte at a time with zeroes past it
+		while (m_bits <= 56)
+		{
+			if (m_doffset < m_dlength)
+				m_buffer |= uint64_t(m_read[m_doffset]) << (56 - m_bits);
+			m_doffset++;
+			m_bits += 8;
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  peek - fetch the requested number of bits
 //  but don't advance the input pointer
@@ -102,18 +138,10 @@ inline uint32_t bitstream_in::peek(int numbits)
 
 	// fetch data if we need more
 	if (numbits > m_bits)
-	{
-		while (m_bits <= 24)
-		{
-			if (m_doffset < m_dlength)
-				m_buffer |= m_read[m_doffset] << (24 - m_bits);
-			m_doffset++;
-			m_bits += 8;
-		}
-	}
+		refill();
 
 	// return the data
-	return m_buffer >> (32 - numbits);
+	return uint32_t(m_buffer >> (64 - numbits));
 }
 
 
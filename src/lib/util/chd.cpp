@@ -16,10 +16,13 @@
 #include "flac.h"
 #include "cdrom.h"
 #include "coretmpl.h"
+#include "scopeprof.h"
+#include "osdfile.h"
 #include <zlib.h>
 #include <ctime>
 #include <cstddef>
 #include <cstdlib>
+#include <limits>
 #include <new>
 #include "eminline.h"
 
@@ -189,9 +192,20 @@ inline void chd_file::file_read(uint64_t offset, void *dest, uint32_t length)
 	if (m_file == nullptr)
 		throw CHDERR_NOT_OPEN;
 
+	// copy straight out of the mapping if there is one
+	if (m_mapping && (offset + length) <= m_mapping->size())
+	{
+		memcpy(dest, reinterpret_cast<const uint8_t *>(m_mapping->get()) + offset, length);
+		return;
+	}
+
 	// seek and read
-	m_file->seek(offset, SEEK_SET);
-	uint32_t count = m_file->read(dest, length);
+	uint32_t count;
+	{
+		std::lock_guard<std::mutex> lock(m_file_mutex);
+		m_file->seek(offset, SEEK_SET);
+		count = m_file->read(dest, length);
+	}
 	if (count != length)
 		throw CHDERR_READ_ERROR;
 }
@@ -289,7 +303,8 @@ inline uint8_t chd_file::bits_for_value(uint64_t value)
 
 chd_file::chd_file()
 	: m_file(nullptr),
-		m_owns_file(false)
+		m_owns_file(false),
+		m_prefetch_queue(nullptr)
 {
 	// reset state
 	memset(m_decompressor, 0, sizeof(m_decompressor));
@@ -761,6 +776,15 @@ chd_error chd_file::open(const char *filename, bool writeable, chd_file *parent)
 	// we now own this file
 	file.release();
 	m_owns_file = true;
+
+	// reading a hunk then costs no more than a copy (or a page fault); nothing writes
+	// through this handle, so a private mapping always sees what the file holds
+	if (!writeable && m_file->size() <= std::numeric_limits<std::size_t>::max())
+	{
+		m_mapping = std::make_unique<osd::file_mapping>(filename, std::size_t(m_file->size()));
+		if (!*m_mapping)
+			m_mapping.reset();
+	}
 	return err;
 }
 
@@ -802,7 +826,19 @@ chd_error chd_file::open(util::core_file &file, bool writeable, chd_file *parent
 
 void chd_file::close()
 {
+	// stop reading ahead before anything goes away under the workers
+	if (m_prefetch_queue != nullptr)
+	{
+		for (auto &slot : m_prefetch)
+			prefetch_retire(*slot);
+		osd_work_queue_free(m_prefetch_queue);
+		m_prefetch_queue = nullptr;
+	}
+	m_prefetch.clear();
+	m_prefetch_last = ~0;
+
 	// reset file characteristics
+	m_mapping.reset();
 	if (m_owns_file && m_file)
 		delete m_file;
 	m_file = nullptr;
@@ -845,6 +881,9 @@ void chd_file::close()
 	// reset caching
 	m_cache.clear();
 	m_cachehunk = ~0;
+	m_hunk_cache.reset();
+	m_cache_hits = 0;
+	m_cache_misses = 0;
 }
 
 /**
@@ -872,6 +911,66 @@ void chd_file::close()
 
 chd_error chd_file::read_hunk(uint32_t hunknum, void *buffer)
 {
+	// serve repeat reads from the cache
+	bool const cacheable = m_hunk_cache && buffer != nullptr && hunknum < m_hunkcount;
+	if (cacheable)
+	{
+		auto const found = m_hunk_cache->find(hunknum);
+		if (found != m_hunk_cache->end())
+		{
+			m_cache_hits++;
+			memcpy(buffer, &found->second[0], m_hunkbytes);
+			return CHDERR_NONE;
+		}
+		m_cache_misses++;
+	}
+
+	// only add the entry once the read is complete, as reading a self or
+	// parent reference can read other hunks and change the cache
+	chd_error const result = read_hunk_uncached(hunknum, buffer);
+	if (cacheable && result == CHDERR_NONE)
+	{
+		auto const *src = reinterpret_cast<const uint8_t *>(buffer);
+		(*m_hunk_cache)[hunknum].assign(src, src + m_hunkbytes);
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  read_hunk_uncached - read a hunk, from the
+//  read-ahead if it got there first
+//-------------------------------------------------
+
+chd_error chd_file::read_hunk_uncached(uint32_t hunknum, void *buffer)
+{
+	// hand back hunks read ahead, and keep reading ahead while access is sequential
+	if (m_prefetch_queue != nullptr && buffer != nullptr && hunknum < m_hunkcount)
+	{
+		bool const sequential = hunknum == m_prefetch_last + 1;
+		m_prefetch_last = hunknum;
+
+		chd_error result;
+		bool const hit = prefetch_take(hunknum, buffer, result);
+		if (sequential)
+			prefetch_start(hunknum + 1);
+		if (hit)
+			return result;
+	}
+	return decode_hunk(hunknum, buffer);
+}
+
+
+//-------------------------------------------------
+//  decode_hunk - read and decompress a single
+//  hunk on the caller's thread
+//-------------------------------------------------
+
+chd_error chd_file::decode_hunk(uint32_t hunknum, void *buffer)
+{
+	static util::scope_profiler::scope_id const s_scope = util::scope_profiler::register_scope("CHD read hunk");
+	util::profile_scope scope(s_scope);
+
 	// wrap this for clean reporting
 	try
 	{
@@ -922,7 +1021,7 @@ chd_error chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						return CHDERR_NONE;
 
 					case V34_MAP_ENTRY_TYPE_SELF_HUNK:
-						return read_hunk(blockoffs, dest);
+						return decode_hunk(blockoffs, dest);
 
 					case V34_MAP_ENTRY_TYPE_PARENT_HUNK:
 						if (m_parent_missing)
@@ -960,12 +1059,7 @@ chd_error chd_file::read_hunk(uint32_t hunknum, void *buffer)
 					case COMPRESSION_TYPE_1:
 					case COMPRESSION_TYPE_2:
 					case COMPRESSION_TYPE_3:
-						file_read(blockoffs, &m_compressed[0], blocklen);
-						m_decompressor[rawmap[0]]->decompress(&m_compressed[0], blocklen, dest, m_hunkbytes);
-						if (!m_decompressor[rawmap[0]]->lossy() && dest != nullptr && util::crc16_creator::simple(dest, m_hunkbytes) != blockcrc)
-							throw CHDERR_DECOMPRESSION_ERROR;
-						if (m_decompressor[rawmap[0]]->lossy() && util::crc16_creator::simple(&m_compressed[0], blocklen) != blockcrc)
-							throw CHDERR_DECOMPRESSION_ERROR;
+						decompress_hunk(rawmap, *m_decompressor[rawmap[0]], &m_compressed[0], dest);
 						return CHDERR_NONE;
 
 					case COMPRESSION_NONE:
@@ -975,7 +1069,7 @@ chd_error chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						return CHDERR_NONE;
 
 					case COMPRESSION_SELF:
-						return read_hunk(blockoffs, dest);
+						return decode_hunk(blockoffs, dest);
 
 					case COMPRESSION_PARENT:
 						if (m_parent_missing)
@@ -996,6 +1090,152 @@ chd_error chd_file::read_hunk(uint32_t hunknum, void *buffer)
 	}
 }
 
+//-------------------------------------------------
+//  decompress_hunk - read and decompress a v5
+//  hunk compressed with one of the file's codecs;
+//  safe on any thread given its own codec and
+//  buffer
+//-------------------------------------------------
+
+void chd_file::decompress_hunk(const uint8_t *rawmap, chd_decompressor &decompressor, uint8_t *compressed, uint8_t *dest)
+{
+	static util::scope_profiler::scope_id const s_scope = util::scope_profiler::register_scope("CHD decompress");
+	util::profile_scope scope(s_scope);
+
+	uint32_t const blocklen = be_read(&rawmap[1], 3);
+	uint64_t const blockoffs = be_read(&rawmap[4], 6);
+	util::crc16_t const blockcrc = be_read(&rawmap[10], 2);
+
+	file_read(blockoffs, compressed, blocklen);
+	decompressor.decompress(compressed, blocklen, dest, m_hunkbytes);
+	if (!decompressor.lossy() && dest != nullptr && util::crc16_creator::simple(dest, m_hunkbytes) != blockcrc)
+		throw CHDERR_DECOMPRESSION_ERROR;
+	if (decompressor.lossy() && util::crc16_creator::simple(compressed, blocklen) != blockcrc)
+		throw CHDERR_DECOMPRESSION_ERROR;
+}
+
+
+//-------------------------------------------------
+//  prefetch_take - if a hunk has been read ahead,
+//  wait for it and copy it out
+//-------------------------------------------------
+
+bool chd_file::prefetch_take(uint32_t hunknum, void *buffer, chd_error &result)
+{
+	for (auto &slot : m_prefetch)
+		if (slot->hunknum == hunknum)
+		{
+			osd_work_item_wait(slot->item, osd_ticks_per_second() * 100);
+			result = slot->result;
+			if (result == CHDERR_NONE)
+				memcpy(buffer, &slot->data[0], m_hunkbytes);
+			prefetch_retire(*slot);
+			return true;
+		}
+	return false;
+}
+
+
+//-------------------------------------------------
+//  prefetch_start - start decompressing the hunks
+//  a sequential reader will want next
+//-------------------------------------------------
+
+void chd_file::prefetch_start(uint32_t hunknum)
+{
+	uint32_t const end = std::min<uint32_t>(hunknum + m_prefetch.size(), m_hunkcount);
+	for (uint32_t hunk = hunknum; hunk < end; hunk++)
+	{
+		// only hunks compressed with a codec are worth it; lossy ones may need configuring first
+		const uint8_t *rawmap = &m_rawmap[m_mapentrybytes * hunk];
+		if (rawmap[0] > COMPRESSION_TYPE_3 || m_decompressor[rawmap[0]]->lossy())
+			continue;
+
+		// find a slot not already holding a hunk we still want
+		prefetch_slot *free = nullptr;
+		bool pending = false;
+		for (auto &slot : m_prefetch)
+		{
+			if (slot->hunknum == hunk)
+				pending = true;
+			else if (slot->hunknum < hunknum || slot->hunknum >= end)
+				free = slot.get();
+		}
+		if (pending || free == nullptr)
+			continue;
+		prefetch_retire(*free);
+
+		// make sure it has a codec of the right type
+		chd_decompressor *&decompressor = free->decompressor[rawmap[0]];
+		if (decompressor == nullptr)
+		{
+			decompressor = chd_codec_list::new_decompressor(m_compression[rawmap[0]], *this);
+			if (decompressor == nullptr)
+				continue;
+		}
+
+		free->hunknum = hunk;
+		free->item = osd_work_item_queue(m_prefetch_queue, &chd_file::prefetch_hunk, free, 0);
+		if (free->item == nullptr)
+			free->hunknum = ~0;
+	}
+}
+
+
+//-------------------------------------------------
+//  prefetch_retire - wait for a slot's read to
+//  finish and empty it
+//-------------------------------------------------
+
+void chd_file::prefetch_retire(prefetch_slot &slot)
+{
+	if (slot.item != nullptr)
+	{
+		osd_work_item_wait(slot.item, osd_ticks_per_second() * 100);
+		osd_work_item_release(slot.item);
+		slot.item = nullptr;
+	}
+	slot.hunknum = ~0;
+}
+
+
+//-------------------------------------------------
+//  prefetch_hunk - worker callback reading and
+//  decompressing one hunk ahead
+//-------------------------------------------------
+
+void *chd_file::prefetch_hunk(void *param, int threadid)
+{
+	prefetch_slot &slot = *reinterpret_cast<prefetch_slot *>(param);
+	chd_file &chd = *slot.owner;
+	const uint8_t *rawmap = &chd.m_rawmap[chd.m_mapentrybytes * slot.hunknum];
+	try
+	{
+		chd.decompress_hunk(rawmap, *slot.decompressor[rawmap[0]], &slot.compressed[0], &slot.data[0]);
+		slot.result = CHDERR_NONE;
+	}
+	catch (chd_error &err)
+	{
+		slot.result = err;
+	}
+	catch (...)
+	{
+		slot.result = CHDERR_DECOMPRESSION_ERROR;
+	}
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  ~prefetch_slot - free the slot's codecs
+//-------------------------------------------------
+
+chd_file::prefetch_slot::~prefetch_slot()
+{
+	for (chd_decompressor *decompressor : this->decompressor)
+		delete decompressor;
+}
+
 /**
  * @fn  chd_error chd_file::write_hunk(uint32_t hunknum, const void *buffer)
  *
@@ -1036,6 +1276,10 @@ chd_error chd_file::write_hunk(uint32_t hunknum, const void *buffer)
 		if (compressed())
 			throw CHDERR_FILE_NOT_WRITEABLE;
 
+		// don't let the cache hand back what was there before
+		if (m_hunk_cache)
+			m_hunk_cache->erase(hunknum);
+
 		// see if we have allocated the space on disk for this hunk
 		uint8_t *rawmap = &m_rawmap[hunknum * 4];
 		uint32_t rawentry = be_read(rawmap, 4);
@@ -1606,6 +1850,45 @@ util::sha1_t chd_file::compute_overall_sha1(util::sha1_t rawsha1)
 	return overall_sha1.finish();
 }
 
+//-------------------------------------------------
+//  set_read_ahead - change how many hunks are
+//  decompressed ahead of a sequential reader
+//-------------------------------------------------
+
+void chd_file::set_read_ahead(uint32_t hunks)
+{
+	if (m_prefetch_queue == nullptr)
+		return;
+
+	// let everything in flight land before changing the slots
+	for (auto &slot : m_prefetch)
+		prefetch_retire(*slot);
+	m_prefetch.resize(std::min<size_t>(hunks, m_prefetch.size()));
+	while (m_prefetch.size() < hunks)
+	{
+		auto slot = std::make_unique<prefetch_slot>();
+		slot->owner = this;
+		slot->compressed.resize(m_hunkbytes);
+		slot->data.resize(m_hunkbytes);
+		m_prefetch.push_back(std::move(slot));
+	}
+}
+
+
+//-------------------------------------------------
+//  set_cache_size - keep up to this many bytes of
+//  decompressed hunks; zero turns the cache off
+//-------------------------------------------------
+
+void chd_file::set_cache_size(uint64_t bytes)
+{
+	uint64_t const hunks = m_hunkbytes ? (bytes / m_hunkbytes) : 0;
+	if (hunks == 0)
+		m_hunk_cache.reset();
+	else
+		m_hunk_cache = std::make_unique<util::lru_cache_map<uint32_t, std::vector<uint8_t> > >(hunks);
+}
+
 /**
  * @fn  chd_error chd_file::codec_configure(chd_codec_type codec, int param, void *config)
  *
@@ -2428,6 +2711,14 @@ chd_error chd_file::open_common(bool writeable)
 
 		// finish opening the file
 		create_open_common();
+
+		// compressed files opened for reading get read-ahead for sequential access
+		if (!writeable && m_version >= 5 && compressed())
+		{
+			m_prefetch_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+			if (m_prefetch_queue != nullptr)
+				set_read_ahead(PREFETCH_HUNKS);
+		}
 		return CHDERR_NONE;
 	}
 
@@ -18,7 +18,10 @@
 #include "corefile.h"
 #include "hashing.h"
 #include "chdcodec.h"
+#include "lrucache.h"
 #include <atomic>
+#include <memory>
+#include <mutex>
 
 /***************************************************************************
 
@@ -280,6 +283,9 @@ enum chd_error
 class chd_codec;
 
 
+namespace osd { class file_mapping; }
+
+
 // ======================> chd_file
 
 // core file class
@@ -361,6 +367,14 @@ public:
 	// codec interfaces
 	chd_error codec_configure(chd_codec_type codec, int param, void *config);
 
+	// number of hunks decompressed ahead of sequential reads on worker threads (compressed files opened read-only)
+	void set_read_ahead(uint32_t hunks);
+
+	// decompressed hunk cache; children read unchanged hunks through their parent, so they share its cache
+	void set_cache_size(uint64_t bytes);
+	uint64_t cache_hits() const { return m_cache_hits; }
+	uint64_t cache_misses() const { return m_cache_misses; }
+
 	// static helpers
 	static const char *error_string(chd_error err);
 
@@ -368,6 +382,23 @@ private:
 	struct metadata_entry;
 	struct metadata_hash;
 
+	// read-ahead: a hunk being decompressed on a worker thread
+	struct prefetch_slot
+	{
+		~prefetch_slot();
+
+		chd_file *              owner = nullptr;            // file the hunk belongs to
+		uint32_t                hunknum = ~uint32_t(0);     // hunk held, or ~0 if none
+		std::vector<uint8_t>    compressed;                 // compressed data read by the worker
+		std::vector<uint8_t>    data;                       // decompressed hunk
+		chd_decompressor *      decompressor[4] = { };      // codecs of its own, as they keep state
+		chd_error               result = CHDERR_NONE;       // outcome of the read
+		osd_work_item *         item = nullptr;             // read in flight, if any
+	};
+
+	// hunks decompressed ahead of a sequential reader, unless told otherwise
+	static const uint32_t PREFETCH_HUNKS = 4;
+
 	// inline helpers
 	uint64_t be_read(const uint8_t *base, int numbytes);
 	void be_write(uint8_t *base, uint64_t value, int numbytes);
@@ -392,6 +423,13 @@ private:
 	void hunk_write_compressed(uint32_t hunknum, int8_t compression, const uint8_t *compressed, uint32_t complength, util::crc16_t crc16);
 	void hunk_copy_from_self(uint32_t hunknum, uint32_t otherhunk);
 	void hunk_copy_from_parent(uint32_t hunknum, uint64_t parentunit);
+	chd_error read_hunk_uncached(uint32_t hunknum, void *buffer);
+	chd_error decode_hunk(uint32_t hunknum, void *buffer);
+	void decompress_hunk(const uint8_t *rawmap, chd_decompressor &decompressor, uint8_t *compressed, uint8_t *dest);
+	bool prefetch_take(uint32_t hunknum, void *buffer, chd_error &result);
+	void prefetch_start(uint32_t hunknum);
+	void prefetch_retire(prefetch_slot &slot);
+	static void *prefetch_hunk(void *param, int threadid);
 	bool metadata_find(chd_metadata_tag metatag, int32_t metaindex, metadata_entry &metaentry, bool resume = false);
 	void metadata_set_previous_next(uint64_t prevoffset, uint64_t nextoffset);
 	void metadata_update_hash();
@@ -399,6 +437,7 @@ private:
 
 	// file characteristics
 	util::core_file *       m_file;             // handle to the open core file
+	std::unique_ptr<osd::file_mapping> m_mapping; // read-only files opened by name are read through a mapping
 	bool                    m_owns_file;        // flag indicating if this file should be closed on chd_close()
 	bool                    m_allow_reads;      // permit reads from this CHD?
 	bool                    m_allow_writes;     // permit writes to this CHD?
@@ -434,6 +473,17 @@ private:
 	// caching
 	std::vector<uint8_t>          m_cache;            // single-hunk cache for partial reads/writes
 	uint32_t                  m_cachehunk;        // which hunk is in the cache?
+
+	// decompressed hunk cache
+	std::unique_ptr<util::lru_cache_map<uint32_t, std::vector<uint8_t> > > m_hunk_cache; // recently read hunks, or nullptr if none
+	uint64_t                  m_cache_hits;       // reads served from the hunk cache
+	uint64_t                  m_cache_misses;     // reads that had to decompress
+
+	// read-ahead
+	osd_work_queue *        m_prefetch_queue;   // queue decompressing upcoming hunks, or nullptr if none
+	std::vector<std::unique_ptr<prefetch_slot>> m_prefetch; // hunks on their way
+	uint32_t                  m_prefetch_last;    // last hunk read, to spot sequential access
+	std::mutex              m_file_mutex;       // the workers share the file with the caller
 };
 
 
@@ -18,6 +18,9 @@
 #include <zlib.h>
 #include "lzma/C/LzmaEnc.h"
 #include "lzma/C/LzmaDec.h"
+#if defined(USE_ZSTD)
+#include <zstd.h>
+#endif
 #include <new>
 
 
@@ -159,6 +162,48 @@ private:
 };
 
 
+#if defined(USE_ZSTD)
+
+// ======================> chd_zstd_compressor
+
+// Zstandard compressor
+class chd_zstd_compressor : public chd_compressor
+{
+public:
+	// construction/destruction
+	chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy);
+	~chd_zstd_compressor();
+
+	// core functionality
+	virtual uint32_t compress(const uint8_t *src, uint32_t srclen, uint8_t *dest) override;
+
+private:
+	// internal state
+	ZSTD_CCtx *             m_context;
+};
+
+
+// ======================> chd_zstd_decompressor
+
+// Zstandard decompressor
+class chd_zstd_decompressor : public chd_decompressor
+{
+public:
+	// construction/destruction
+	chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy);
+	~chd_zstd_decompressor();
+
+	// core functionality
+	virtual void decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen) override;
+
+private:
+	// internal state
+	ZSTD_DCtx *             m_context;
+};
+
+#endif // defined(USE_ZSTD)
+
+
 // ======================> chd_huffman_compressor
 
 // Huffman compressor
@@ -468,11 +513,17 @@ const chd_codec_list::codec_entry chd_codec_list::s_codec_list[] =
 	{ CHD_CODEC_LZMA,       false,  "LZMA",                 &chd_codec_list::construct_compressor<chd_lzma_compressor>,     &chd_codec_list::construct_decompressor<chd_lzma_decompressor> },
 	{ CHD_CODEC_HUFFMAN,    false,  "Huffman",              &chd_codec_list::construct_compressor<chd_huffman_compressor>,  &chd_codec_list::construct_decompressor<chd_huffman_decompressor> },
 	{ CHD_CODEC_FLAC,       false,  "FLAC",                 &chd_codec_list::construct_compressor<chd_flac_compressor>,     &chd_codec_list::construct_decompressor<chd_flac_decompressor> },
+#if defined(USE_ZSTD)
+	{ CHD_CODEC_ZSTD,       false,  "Zstandard",            &chd_codec_list::construct_compressor<chd_zstd_compressor>,     &chd_codec_list::construct_decompressor<chd_zstd_decompressor> },
+#endif
 
 	// general codecs with CD frontend
 	{ CHD_CODEC_CD_ZLIB,    false,  "CD Deflate",           &chd_codec_list::construct_compressor<chd_cd_compressor<chd_zlib_compressor, chd_zlib_compressor> >,        &chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_zlib_decompressor, chd_zlib_decompressor> > },
 	{ CHD_CODEC_CD_LZMA,    false,  "CD LZMA",              &chd_codec_list::construct_compressor<chd_cd_compressor<chd_lzma_compressor, chd_zlib_compressor> >,        &chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_lzma_decompressor, chd_zlib_decompressor> > },
 	{ CHD_CODEC_CD_FLAC,    false,  "CD FLAC",              &chd_codec_list::construct_compressor<chd_cd_flac_compressor>,  &chd_codec_list::construct_decompressor<chd_cd_flac_decompressor> },
+#if defined(USE_ZSTD)
+	{ CHD_CODEC_CD_ZSTD,    false,  "CD Zstandard",         &chd_codec_list::construct_compressor<chd_cd_compressor<chd_zstd_compressor, chd_zstd_compressor> >,        &chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_zstd_decompressor, chd_zstd_decompressor> > },
+#endif
 
 	// A/V codecs
 	{ CHD_CODEC_AVHUFF,     false,  "A/V Huffman",          &chd_codec_list::construct_compressor<chd_avhuff_compressor>,   &chd_codec_list::construct_decompressor<chd_avhuff_decompressor> },
@@ -1193,6 +1244,103 @@ void chd_lzma_decompressor::decompress(const uint8_t *src, uint32_t complen, uin
 
 
 
+#if defined(USE_ZSTD)
+
+//**************************************************************************
+//  ZSTANDARD COMPRESSOR
+//**************************************************************************
+
+//-------------------------------------------------
+//  chd_zstd_compressor - constructor
+//-------------------------------------------------
+
+chd_zstd_compressor::chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+	: chd_compressor(chd, hunkbytes, lossy)
+	, m_context(ZSTD_createCCtx())
+{
+	if (!m_context)
+		throw std::bad_alloc();
+}
+
+
+//-------------------------------------------------
+//  ~chd_zstd_compressor - destructor
+//-------------------------------------------------
+
+chd_zstd_compressor::~chd_zstd_compressor()
+{
+	ZSTD_freeCCtx(m_context);
+}
+
+
+//-------------------------------------------------
+//  compress - compress data using the Zstandard
+//  codec
+//-------------------------------------------------
+
+uint32_t chd_zstd_compressor::compress(const uint8_t *src, uint32_t srclen, uint8_t *dest)
+{
+	// each hunk is a frame of its own, so the decoder can start anywhere; leave
+	// out the checksum and size, as the CHD already records both
+	ZSTD_CCtx_reset(m_context, ZSTD_reset_session_and_parameters);
+	ZSTD_CCtx_setParameter(m_context, ZSTD_c_compressionLevel, ZSTD_maxCLevel());
+	ZSTD_CCtx_setParameter(m_context, ZSTD_c_checksumFlag, 0);
+	ZSTD_CCtx_setParameter(m_context, ZSTD_c_contentSizeFlag, 0);
+
+	// if we ended up with more data than we started with, return an error
+	size_t const result = ZSTD_compress2(m_context, dest, srclen, src, srclen);
+	if (ZSTD_isError(result) || result >= srclen)
+		throw CHDERR_COMPRESSION_ERROR;
+
+	// otherwise, return the length
+	return result;
+}
+
+
+
+//**************************************************************************
+//  ZSTANDARD DECOMPRESSOR
+//**************************************************************************
+
+//-------------------------------------------------
+//  chd_zstd_decompressor - constructor
+//-------------------------------------------------
+
+chd_zstd_decompressor::chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+	: chd_decompressor(chd, hunkbytes, lossy)
+	, m_context(ZSTD_createDCtx())
+{
+	if (!m_context)
+		throw std::bad_alloc();
+}
+
+
+//-------------------------------------------------
+//  ~chd_zstd_decompressor - destructor
+//-------------------------------------------------
+
+chd_zstd_decompressor::~chd_zstd_decompressor()
+{
+	ZSTD_freeDCtx(m_context);
+}
+
+
+//-------------------------------------------------
+//  decompress - decompress data using the
+//  Zstandard codec
+//-------------------------------------------------
+
+void chd_zstd_decompressor::decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen)
+{
+	size_t const result = ZSTD_decompressDCtx(m_context, dest, destlen, src, complen);
+	if (ZSTD_isError(result) || result != destlen)
+		throw CHDERR_DECOMPRESSION_ERROR;
+}
+
+#endif // defined(USE_ZSTD)
+
+
+
 //**************************************************************************
 //  HUFFMAN COMPRESSOR
 //**************************************************************************
@@ -175,11 +175,13 @@ const chd_codec_type CHD_CODEC_ZLIB         = CHD_MAKE_TAG('z','l','i','b');
 const chd_codec_type CHD_CODEC_LZMA         = CHD_MAKE_TAG('l','z','m','a');
 const chd_codec_type CHD_CODEC_HUFFMAN      = CHD_MAKE_TAG('h','u','f','f');
 const chd_codec_type CHD_CODEC_FLAC         = CHD_MAKE_TAG('f','l','a','c');
+const chd_codec_type CHD_CODEC_ZSTD         = CHD_MAKE_TAG('z','s','t','d');    // needs USE_ZSTD
 
 // general codecs with CD frontend
 const chd_codec_type CHD_CODEC_CD_ZLIB      = CHD_MAKE_TAG('c','d','z','l');
 const chd_codec_type CHD_CODEC_CD_LZMA      = CHD_MAKE_TAG('c','d','l','z');
 const chd_codec_type CHD_CODEC_CD_FLAC      = CHD_MAKE_TAG('c','d','f','l');
+const chd_codec_type CHD_CODEC_CD_ZSTD      = CHD_MAKE_TAG('c','d','z','s');    // needs USE_ZSTD
 
 // A/V codecs
 const chd_codec_type CHD_CODEC_AVHUFF       = CHD_MAKE_TAG('a','v','h','u');
@@ -45,3 +45,7 @@ util::disasm_interface::u64 util::disasm_interface::decrypt64(u64 value, offs_t
 	throw ("unimplemented decrypt64 called");
 }
 
+util::disasm_interface::u64 util::disasm_interface::decode_mode() const
+{
+	return 0;
+}
@@ -43,6 +43,9 @@ public:
 	static constexpr u32 OVERINSTSHIFT   = 27;           // bits to shift after masking to get the value
 	static constexpr u32 LENGTHMASK      = 0x0000ffff;   // the low 16-bits contain the actual length
 
+	// Value returned by decode_mode when the text depends on live CPU state, so it can't be reused
+	static constexpr u64 DECODE_MODE_LIVE = ~u64(0);
+
 	static inline u32 step_over_extra(u32 x) {
 		return x << OVERINSTSHIFT;
 	}
@@ -73,6 +76,7 @@ public:
 	virtual u16 decrypt16(u16 value, offs_t pc, bool opcode) const;
 	virtual u32 decrypt32(u32 value, offs_t pc, bool opcode) const;
 	virtual u64 decrypt64(u64 value, offs_t pc, bool opcode) const;
+	virtual u64 decode_mode() const;
 
 	virtual u32 opcode_alignment() const = 0;
 	virtual offs_t disassemble(std::ostream &stream, offs_t pc, const data_buffer &opcodes, const data_buffer &params) = 0;
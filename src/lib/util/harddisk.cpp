@@ -11,7 +11,9 @@
 #include <cassert>
 #include "harddisk.h"
 #include "osdcore.h"
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 
 /***************************************************************************
     TYPE DEFINITIONS
@@ -190,6 +192,28 @@ uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer)
 }
 
 
+/*-------------------------------------------------
+    hard_disk_read - read a run of consecutive
+    sectors from a hard disk in one request
+-------------------------------------------------*/
+
+uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, uint32_t count, void *buffer)
+{
+	if (file->chd)
+	{
+		chd_error err = file->chd->read_units(lbasector, buffer, count);
+		return (err == CHDERR_NONE);
+	}
+	else
+	{
+		uint32_t actual = 0;
+		file->fhandle->seek(file->info.fileoffset + (uint64_t(lbasector) * file->info.sectorbytes), SEEK_SET);
+		actual = file->fhandle->read(buffer, count * file->info.sectorbytes);
+		return (actual == count * file->info.sectorbytes);
+	}
+}
+
+
 /*-------------------------------------------------
     hard_disk_write - write  sectors to a hard
     disk
@@ -222,3 +246,104 @@ uint32_t hard_disk_write(hard_disk_file *file, uint32_t lbasector, const void *b
 		return (actual == file->info.sectorbytes);
 	}
 }
+
+
+
+/***************************************************************************
+    READ-AHEAD
+***************************************************************************/
+
+hard_disk_read_ahead::hard_disk_read_ahead()
+	: m_queue(nullptr)
+	, m_item(nullptr)
+	, m_file(nullptr)
+	, m_lba(0)
+	, m_count(0)
+	, m_result(0)
+{
+}
+
+hard_disk_read_ahead::~hard_disk_read_ahead()
+{
+	reset();
+	if (m_queue)
+		osd_work_queue_free(m_queue);
+}
+
+
+/*-------------------------------------------------
+    start - queue the read of a run of sectors
+-------------------------------------------------*/
+
+void hard_disk_read_ahead::start(hard_disk_file *file, uint32_t lbasector, uint32_t count)
+{
+	reset();
+	if (!file || count < 2)
+		return;
+
+	m_file = file;
+	m_lba = lbasector;
+	m_count = std::min(count, MAX_SECTORS);
+	m_buffer.resize(m_count * file->info.sectorbytes);
+
+	if (!m_queue)
+		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	if (m_queue)
+		m_item = osd_work_item_queue(m_queue, read_callback, this, 0);
+	if (!m_item)
+		m_file = nullptr;
+}
+
+
+/*-------------------------------------------------
+    read - read one sector, waiting for the run
+    if it covers the sector and is still going
+-------------------------------------------------*/
+
+uint32_t hard_disk_read_ahead::read(hard_disk_file *file, uint32_t lbasector, void *buffer)
+{
+	if (file == m_file && lbasector >= m_lba && lbasector - m_lba < m_count)
+	{
+		osd_work_item_wait(m_item, osd_ticks_per_second() * 100);
+		if (m_result)
+		{
+			memcpy(buffer, &m_buffer[(lbasector - m_lba) * file->info.sectorbytes], file->info.sectorbytes);
+			return 1;
+		}
+	}
+
+	// anything the run doesn't cover goes straight to the disk, which
+	// must not be read from two threads at once
+	reset();
+	return hard_disk_read(file, lbasector, buffer);
+}
+
+
+/*-------------------------------------------------
+    reset - forget the current run
+-------------------------------------------------*/
+
+void hard_disk_read_ahead::reset()
+{
+	if (m_item)
+	{
+		osd_work_item_wait(m_item, osd_ticks_per_second() * 100);
+		osd_work_item_release(m_item);
+		m_item = nullptr;
+	}
+	m_file = nullptr;
+	m_count = 0;
+}
+
+
+/*-------------------------------------------------
+    read_callback - perform the read on the work
+    queue
+-------------------------------------------------*/
+
+void *hard_disk_read_ahead::read_callback(void *param, int threadid)
+{
+	hard_disk_read_ahead *const ahead = reinterpret_cast<hard_disk_read_ahead *>(param);
+	ahead->m_result = hard_disk_read(ahead->m_file, ahead->m_lba, ahead->m_count, &ahead->m_buffer[0]);
+	return nullptr;
+}
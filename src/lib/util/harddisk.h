@@ -16,6 +16,8 @@
 #include "osdcore.h"
 #include "chd.h"
 
+#include <vector>
+
 
 /***************************************************************************
     TYPE DEFINITIONS
@@ -33,6 +35,38 @@ struct hard_disk_info
 };
 
 
+// reads a run of sectors as one request on a work queue, so the caller
+// keeps emulating until it actually needs each sector
+class hard_disk_read_ahead
+{
+public:
+	static constexpr uint32_t MAX_SECTORS = 256;
+
+	hard_disk_read_ahead();
+	~hard_disk_read_ahead();
+
+	// start reading up to MAX_SECTORS sectors, replacing any earlier run
+	void start(hard_disk_file *file, uint32_t lbasector, uint32_t count);
+
+	// read a sector, from the run if it covers it and from the disk otherwise
+	uint32_t read(hard_disk_file *file, uint32_t lbasector, void *buffer);
+
+	// drop the run, waiting for it to finish; call before writing to the disk
+	void reset();
+
+private:
+	static void *read_callback(void *param, int threadid);
+
+	osd_work_queue *        m_queue;    // queue the reads run on
+	osd_work_item *         m_item;     // read in flight or finished, if any
+	hard_disk_file *        m_file;     // disk the run comes from
+	uint32_t                m_lba;      // first sector of the run
+	uint32_t                m_count;    // number of sectors in the run
+	uint32_t                m_result;   // result of the read
+	std::vector<uint8_t>    m_buffer;   // sector data
+};
+
+
 
 /***************************************************************************
     FUNCTION PROTOTYPES
@@ -47,6 +81,7 @@ chd_file *hard_disk_get_chd(hard_disk_file *file);
 hard_disk_info *hard_disk_get_info(hard_disk_file *file);
 
 uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer);
+uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, uint32_t count, void *buffer);
 uint32_t hard_disk_write(hard_disk_file *file, uint32_t lbasector, const void *buffer);
 
 #endif // MAME_UTIL_HARDDISK_H
@@ -16,6 +16,16 @@
 #include <iomanip>
 #include <sstream>
 
+#if defined(__SHA__) && defined(__SSE4_1__)
+#include <immintrin.h>
+#define MAME_SHA1_SHANI 1
+#endif
+
+#if defined(__ARM_FEATURE_CRC32) && defined(LSB_FIRST)
+#include <arm_acle.h>
+#define MAME_CRC32_ARMV8 1
+#endif
+
 
 namespace util {
 
@@ -86,6 +96,54 @@ inline void sha1_r4(uint32_t *data, std::array<uint32_t, 5> &d, unsigned i)
 	d[(i + 3) % 5] = sha1_rol(d[(i + 3) % 5], 30);
 }
 
+#if defined(MAME_SHA1_SHANI)
+
+// four groups of four rounds with the SHA extensions; each group consumes
+// one schedule vector and advances the schedule for the ones to come
+template <int Func>
+inline void sha1_shani_rounds(__m128i &abcd, __m128i (&e)[2], __m128i (&msg)[4], unsigned first)
+{
+	for (unsigned g = first; g < first + 5U; g++)
+	{
+		__m128i &cur = e[g & 1];
+		cur = g ? _mm_sha1nexte_epu32(cur, msg[g & 3]) : _mm_add_epi32(cur, msg[0]);
+		e[~g & 1] = abcd;
+		if (g >= 3U && g <= 18U)
+			msg[(g + 1) & 3] = _mm_sha1msg2_epu32(msg[(g + 1) & 3], msg[g & 3]);
+		abcd = _mm_sha1rnds4_epu32(abcd, cur, Func);
+		if (g >= 1U && g <= 16U)
+			msg[(g - 1) & 3] = _mm_sha1msg1_epu32(msg[(g - 1) & 3], msg[g & 3]);
+		if (g >= 2U && g <= 17U)
+			msg[(g - 2) & 3] = _mm_xor_si128(msg[(g - 2) & 3], msg[g & 3]);
+	}
+}
+
+inline void sha1_process(std::array<uint32_t, 5> &st, uint32_t *data)
+{
+	// the state is stored E, D, C, B, A so the top four load as one vector
+	__m128i abcd = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&st[1]));
+	__m128i const abcd_save = abcd;
+	__m128i const e_save = _mm_set_epi32(st[0], 0, 0, 0);
+	__m128i e[2] = { e_save, _mm_setzero_si128() };
+
+	// the buffer already holds native words; the instructions want W0 on top
+	__m128i msg[4];
+	for (unsigned i = 0U; i < 4U; i++)
+		msg[i] = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&data[i * 4])), 0x1b);
+
+	sha1_shani_rounds<0>(abcd, e, msg, 0U);
+	sha1_shani_rounds<1>(abcd, e, msg, 5U);
+	sha1_shani_rounds<2>(abcd, e, msg, 10U);
+	sha1_shani_rounds<3>(abcd, e, msg, 15U);
+
+	abcd = _mm_add_epi32(abcd, abcd_save);
+	e[0] = _mm_sha1nexte_epu32(e[0], e_save);
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(&st[1]), abcd);
+	st[0] = uint32_t(_mm_extract_epi32(e[0], 3));
+}
+
+#else // MAME_SHA1_SHANI
+
 inline void sha1_process(std::array<uint32_t, 5> &st, uint32_t *data)
 {
 	std::array<uint32_t, 5> d = st;
@@ -104,6 +162,8 @@ inline void sha1_process(std::array<uint32_t, 5> &st, uint32_t *data)
 		st[i] += d[i];
 }
 
+#endif // MAME_SHA1_SHANI
+
 } // anonymous namespace
 
 
@@ -329,7 +389,22 @@ std::string crc32_t::as_string() const
 
 void crc32_creator::append(const void *data, uint32_t length)
 {
+#if defined(MAME_CRC32_ARMV8)
+	// ARMv8 has instructions for this polynomial; eight bytes at a time
+	auto const *src = reinterpret_cast<const uint8_t *>(data);
+	uint32_t crc = ~m_accum.m_raw;
+	for ( ; length >= 8U; src += 8, length -= 8U)
+	{
+		uint64_t word;
+		memcpy(&word, src, sizeof(word));
+		crc = __crc32d(crc, word);
+	}
+	for ( ; length; src++, length--)
+		crc = __crc32b(crc, *src);
+	m_accum.m_raw = ~crc;
+#else
 	m_accum.m_raw = crc32(m_accum, reinterpret_cast<const Bytef *>(data), length);
+#endif
 }
 
 
@@ -22,6 +22,10 @@
 #include <cstring>
 #include <new>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 
 namespace util {
 
@@ -214,11 +218,81 @@ private:
 			return png_error::DECOMPRESS_ERROR;
 	}
 
+#if defined(__SSE2__)
+	// the predictors that depend on the previous pixel can't be vectorised
+	// across the row, but RGB and RGBA pixels can be done a pixel at a time
+	static __m128i load_pixel(uint8_t const *p, int bpp)
+	{
+		std::uint32_t v = 0;
+		std::memcpy(&v, p, bpp);
+		return _mm_unpacklo_epi8(_mm_cvtsi32_si128(v), _mm_setzero_si128());
+	}
+
+	static __m128i store_pixel(uint8_t *p, __m128i v, int bpp)
+	{
+		v = _mm_and_si128(v, _mm_set1_epi16(0x00ff));
+		std::uint32_t const r = _mm_cvtsi128_si32(_mm_packus_epi16(v, v));
+		std::memcpy(p, &r, bpp);
+		return v;
+	}
+
+	static __m128i abs_epi16(__m128i v)
+	{
+		return _mm_max_epi16(v, _mm_sub_epi16(_mm_setzero_si128(), v));
+	}
+
+	static __m128i select_epi16(__m128i mask, __m128i a, __m128i b)
+	{
+		return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+	}
+
+	static void unfilter_row_pixels(std::uint8_t type, uint8_t const *src, uint8_t *dst, uint8_t const *dstprev, int bpp, std::uint32_t rowbytes)
+	{
+		__m128i a = _mm_setzero_si128();
+		__m128i c = _mm_setzero_si128();
+		for (std::uint32_t x = 0; rowbytes > x; x += bpp)
+		{
+			__m128i const s = load_pixel(src + x, bpp);
+			switch (type)
+			{
+			case PNG_PF_Sub:
+				a = store_pixel(dst + x, _mm_add_epi16(s, a), bpp);
+				break;
+
+			case PNG_PF_Average:
+				a = store_pixel(dst + x, _mm_add_epi16(s, _mm_srli_epi16(_mm_add_epi16(a, load_pixel(dstprev + x, bpp)), 1)), bpp);
+				break;
+
+			case PNG_PF_Paeth:
+				{
+					__m128i const b = load_pixel(dstprev + x, bpp);
+					__m128i const pa = abs_epi16(_mm_sub_epi16(b, c));
+					__m128i const pb = abs_epi16(_mm_sub_epi16(a, c));
+					__m128i const pc = abs_epi16(_mm_add_epi16(_mm_sub_epi16(b, c), _mm_sub_epi16(a, c)));
+					__m128i const smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+					__m128i const prediction = select_epi16(_mm_cmpeq_epi16(smallest, pa), a, select_epi16(_mm_cmpeq_epi16(smallest, pb), b, c));
+					a = store_pixel(dst + x, _mm_add_epi16(s, prediction), bpp);
+					c = b;
+				}
+				break;
+			}
+		}
+	}
+#endif
+
 	png_error unfilter_row(std::uint8_t type, uint8_t const *src, uint8_t *dst, uint8_t const *dstprev, int bpp, std::uint32_t rowbytes)
 	{
 		if (0 != pnginfo.filter_method)
 			return png_error::UNKNOWN_FILTER;
 
+#if defined(__SSE2__)
+		if (((3 == bpp) || (4 == bpp)) && ((PNG_PF_Sub == type) || (dstprev && ((PNG_PF_Average == type) || (PNG_PF_Paeth == type)))))
+		{
+			unfilter_row_pixels(type, src, dst, dstprev, bpp, rowbytes);
+			return png_error::NONE;
+		}
+#endif
+
 		switch (type)
 		{
 		case PNG_PF_None: // no filter, just copy
@@ -905,7 +979,7 @@ static png_error write_chunk(core_file &fp, const uint8_t *data, uint32_t type,
     chunk to the given file by deflating it
 -------------------------------------------------*/
 
-static png_error write_deflated_chunk(core_file &fp, uint8_t *data, uint32_t type, uint32_t length)
+static png_error write_deflated_chunk(core_file &fp, uint8_t *data, uint32_t type, uint32_t length, int compression)
 {
 	uint64_t lengthpos = fp.tell();
 	uint8_t tempbuff[8192];
@@ -927,7 +1001,7 @@ static png_error write_deflated_chunk(core_file &fp, uint8_t *data, uint32_t typ
 	memset(&stream, 0, sizeof(stream));
 	stream.next_in = data;
 	stream.avail_in = length;
-	zerr = deflateInit(&stream, Z_DEFAULT_COMPRESSION);
+	zerr = deflateInit(&stream, compression);
 	if (zerr != Z_OK)
 		return png_error::COMPRESS_ERROR;
 
@@ -1129,7 +1203,7 @@ static png_error convert_bitmap_to_image_rgb(png_info &pnginfo, const bitmap_t &
     chunks to the given file
 -------------------------------------------------*/
 
-static png_error write_png_stream(core_file &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette)
+static png_error write_png_stream(core_file &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette, int compression)
 {
 	uint8_t tempbuff[16];
 	png_error error;
@@ -1163,7 +1237,7 @@ static png_error write_png_stream(core_file &fp, png_info &pnginfo, const bitmap
 		return error;
 
 	// write a single IDAT chunk
-	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1));
+	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1), compression);
 	if (error != png_error::NONE)
 		return error;
 
@@ -1210,7 +1284,7 @@ static png_error write_png_stream(core_file &fp, png_info &pnginfo, const bitmap
 }
 
 
-png_error png_write_bitmap(core_file &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette)
+png_error png_write_bitmap(core_file &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, int compression)
 {
 	// use a dummy pnginfo if none passed to us
 	png_info pnginfo;
@@ -1222,7 +1296,7 @@ png_error png_write_bitmap(core_file &fp, png_info *info, bitmap_t const &bitmap
 		return png_error::FILE_ERROR;
 
 	/* write the rest of the PNG data */
-	return write_png_stream(fp, *info, bitmap, palette_length, palette);
+	return write_png_stream(fp, *info, bitmap, palette_length, palette, compression);
 }
 
 
@@ -1261,7 +1335,7 @@ png_error mng_capture_start(core_file &fp, bitmap_t &bitmap, unsigned rate)
 }
 
 /**
- * @fn  png_error mng_capture_frame(core_file &fp, png_info *info, bitmap_t &bitmap, int palette_length, const rgb_t *palette)
+ * @fn  png_error mng_capture_frame(core_file &fp, png_info *info, bitmap_t &bitmap, int palette_length, const rgb_t *palette, int compression)
  *
  * @brief   Mng capture frame.
  *
@@ -1270,13 +1344,14 @@ png_error mng_capture_start(core_file &fp, bitmap_t &bitmap, unsigned rate)
  * @param [in,out]  bitmap  The bitmap.
  * @param   palette_length  Length of the palette.
  * @param   palette         The palette.
+ * @param   compression     The zlib compression level.
  *
  * @return  A png_error.
  */
 
-png_error mng_capture_frame(core_file &fp, png_info &info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette)
+png_error mng_capture_frame(core_file &fp, png_info &info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, int compression)
 {
-	return write_png_stream(fp, info, bitmap, palette_length, palette);
+	return write_png_stream(fp, info, bitmap, palette_length, palette, compression);
 }
 
 /**
@@ -103,10 +103,11 @@ private:
 
 png_error png_read_bitmap(core_file &fp, bitmap_argb32 &bitmap);
 
-png_error png_write_bitmap(core_file &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette);
+// compression is a zlib level: 1 is fastest, 9 smallest, -1 zlib's default
+png_error png_write_bitmap(core_file &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, int compression = -1);
 
 png_error mng_capture_start(core_file &fp, bitmap_t &bitmap, unsigned rate);
-png_error mng_capture_frame(core_file &fp, png_info &info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette);
+png_error mng_capture_frame(core_file &fp, png_info &info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, int compression = -1);
 png_error mng_capture_stop(core_file &fp);
 
 } // namespace util
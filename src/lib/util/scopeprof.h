@@ -0,0 +1,220 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    scopeprof.h
+
+    Thread-aware scoped profiler that records named, nested scopes on
+    a host-time timeline and writes them as Chromium trace-event JSON.
+
+****************************************************************************
+
+    Register a scope name once, then put a profile_scope object on the
+    stack around the work to be measured:
+
+    {
+        static util::scope_profiler::scope_id const id = util::scope_profiler::register_scope("decode");
+        util::profile_scope scope(id);
+
+        your_work_here();
+    }
+
+    Scopes may nest and may be opened on any thread; each thread keeps
+    its own event log, so nesting shows up as a hierarchy per thread when
+    the JSON is loaded into chrome://tracing or Perfetto.  Each log is a
+    ring holding the most recent scopes; older ones are overwritten and
+    counted as dropped.  When recording isn't active a scope costs one
+    relaxed atomic load.
+
+***************************************************************************/
+
+#ifndef MAME_UTIL_SCOPEPROF_H
+#define MAME_UTIL_SCOPEPROF_H
+
+#pragma once
+
+#include "osdcore.h"
+#include "strformat.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace util {
+
+// ======================> scope_profiler
+
+class scope_profiler
+{
+public:
+	typedef std::uint32_t scope_id;
+
+	// scope names can be registered at any time from any thread; the same
+	// name always gives the same id
+	static scope_id register_scope(std::string_view name)
+	{
+		std::lock_guard<std::mutex> lock(s_lock);
+		auto const found = s_ids.emplace(std::string(name), scope_id(s_names.size()));
+		if (found.second)
+			s_names.emplace_back(name);
+		return found.first->second;
+	}
+
+	// start recording, discarding anything recorded before and keeping up
+	// to the given number of the most recent scopes for each thread
+	static void start(std::size_t events_per_thread)
+	{
+		std::lock_guard<std::mutex> lock(s_lock);
+		s_capacity = events_per_thread ? events_per_thread : 1;
+		for (auto &log : s_threads)
+		{
+			std::lock_guard<std::mutex> loglock(log->lock);
+			log->events.clear();
+			log->events.shrink_to_fit();
+			log->next = 0;
+			log->dropped = 0;
+		}
+		s_start_ticks = osd_ticks();
+		s_active.store(true, std::memory_order_release);
+	}
+
+	static void stop() { s_active.store(false, std::memory_order_release); }
+	static bool active() { return s_active.load(std::memory_order_relaxed); }
+
+	// name the calling thread on the timeline
+	static void set_thread_name(std::string_view name)
+	{
+		thread_log &log = local();
+		std::lock_guard<std::mutex> lock(log.lock);
+		log.name = name;
+	}
+
+	// add a completed scope for the calling thread
+	static void record(scope_id scope, osd_ticks_t start, osd_ticks_t end)
+	{
+		if (!active())
+			return;
+		thread_log &log = local();
+		std::lock_guard<std::mutex> lock(log.lock);
+		if (log.events.size() < s_capacity)
+		{
+			log.events.push_back(event{ scope, start, end });
+		}
+		else
+		{
+			log.events[log.next] = event{ scope, start, end };
+			log.next = (log.next + 1) % log.events.size();
+			log.dropped++;
+		}
+	}
+
+	// write everything recorded so far as a trace-event JSON object
+	static void write_json(std::ostream &stream)
+	{
+		std::lock_guard<std::mutex> lock(s_lock);
+		double const scale = 1'000'000.0 / double(osd_ticks_per_second());
+		char const *separator = "\n";
+		stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		for (auto &log : s_threads)
+		{
+			std::lock_guard<std::mutex> loglock(log->lock);
+			util::stream_format(stream, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}", separator, log->id, escape(log->name));
+			separator = ",\n";
+			for (std::size_t i = 0; i < log->events.size(); i++)
+			{
+				event const &ev = log->events[(log->next + i) % log->events.size()];
+				if (ev.start < s_start_ticks)
+					continue;
+				util::stream_format(stream, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+						escape(s_names[ev.scope]), log->id, double(ev.start - s_start_ticks) * scale, double(ev.end - ev.start) * scale);
+			}
+			if (log->dropped)
+				util::stream_format(stream, ",\n{\"name\":\"%u events dropped\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}",
+						log->dropped, log->id, double(osd_ticks() - s_start_ticks) * scale);
+		}
+		stream << "\n]}\n";
+	}
+
+private:
+	struct event
+	{
+		scope_id        scope;
+		osd_ticks_t     start;
+		osd_ticks_t     end;
+	};
+
+	// logs outlive their threads so the timeline can still be written
+	struct thread_log
+	{
+		std::mutex          lock;
+		std::vector<event>  events;
+		std::size_t         next = 0;
+		std::string         name;
+		unsigned            id = 0;
+		std::uint64_t       dropped = 0;
+	};
+
+	static thread_log &local()
+	{
+		thread_local thread_log *t_log = nullptr;
+		if (!t_log)
+		{
+			std::lock_guard<std::mutex> lock(s_lock);
+			auto &log = s_threads.emplace_back(std::make_unique<thread_log>());
+			log->id = unsigned(s_threads.size());
+			log->name = util::string_format("thread %u", log->id);
+			t_log = log.get();
+		}
+		return *t_log;
+	}
+
+	static std::string escape(std::string_view text)
+	{
+		std::string result;
+		for (char const ch : text)
+		{
+			if (ch == '"' || ch == '\\')
+				result += '\\';
+			if (std::uint8_t(ch) >= 0x20)
+				result += ch;
+		}
+		return result;
+	}
+
+	static inline std::atomic<bool>                         s_active{ false };
+	static inline std::mutex                                s_lock;
+	static inline std::vector<std::string>                  s_names;
+	static inline std::map<std::string, scope_id, std::less<> > s_ids;
+	static inline std::vector<std::unique_ptr<thread_log> > s_threads;
+	static inline osd_ticks_t                               s_start_ticks = 0;
+	static inline std::size_t                               s_capacity = 1;
+};
+
+
+// ======================> profile_scope
+
+class profile_scope
+{
+public:
+	profile_scope(scope_profiler::scope_id scope) : m_scope(scope), m_start(scope_profiler::active() ? osd_ticks() : 0) { }
+	~profile_scope() { if (m_start) scope_profiler::record(m_scope, m_start, osd_ticks()); }
+
+	profile_scope(profile_scope const &) = delete;
+	profile_scope &operator=(profile_scope const &) = delete;
+
+private:
+	scope_profiler::scope_id    m_scope;
+	osd_ticks_t                 m_start;
+};
+
+} // namespace util
+
+#endif // MAME_UTIL_SCOPEPROF_H
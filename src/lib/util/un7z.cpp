@@ -235,6 +235,10 @@ public:
 
 	virtual error decompress(void *buffer, std::uint32_t length) override { return m_impl->decompress(buffer, length); }
 
+	// everything in a 7z is compressed, usually in solid blocks
+	virtual bool current_is_stored() const override { return false; }
+	virtual error read_stored(std::uint64_t offset, void *buffer, std::uint32_t length, std::uint32_t &actual) override { actual = 0; return error::UNSUPPORTED; }
+
 private:
 	m7z_file_impl::ptr m_impl;
 };
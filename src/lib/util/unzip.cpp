@@ -27,6 +27,7 @@
 #include <cstring>
 #include <cstdlib>
 #include <ctime>
+#include <limits>
 #include <mutex>
 #include <ratio>
 #include <utility>
@@ -48,11 +49,13 @@ public:
 		: m_filename(filename)
 		, m_file()
 		, m_length(0)
+		, m_modified()
 		, m_ecd()
 		, m_cd()
 		, m_cd_pos(0)
 		, m_header()
 		, m_curr_is_dir(false)
+		, m_stored_offset(NO_STORED_OFFSET)
 		, m_buffer()
 	{
 		std::fill(m_buffer.begin(), m_buffer.end(), 0);
@@ -84,6 +87,10 @@ public:
 
 	archive_file::error initialize()
 	{
+		// an index saved by an earlier run saves reading anything from the archive
+		if (load_index())
+			return archive_file::error::NONE;
+
 		// read ecd data
 		auto const ziperr = read_ecd();
 		if (ziperr != archive_file::error::NONE)
@@ -137,9 +144,16 @@ public:
 		}
 		osd_printf_verbose("unzip: read %s central directory\n", m_filename);
 
+		save_index();
 		return archive_file::error::NONE;
 	}
 
+	static void set_index_path(std::string &&path)
+	{
+		std::lock_guard<std::mutex> guard(s_cache_mutex);
+		s_index_path = std::move(path);
+	}
+
 	int first_file()
 	{
 		m_cd_pos = 0;
@@ -182,6 +196,12 @@ public:
 
 	archive_file::error decompress(void *buffer, std::uint32_t length);
 
+	bool current_is_stored() const
+	{
+		return !m_curr_is_dir && (m_header.compression == 0) && (m_header.compressed_length == m_header.uncompressed_length);
+	}
+	archive_file::error read_stored(std::uint64_t offset, void *buffer, std::uint32_t length, std::uint32_t &actual);
+
 private:
 	zip_file_impl(const zip_file_impl &) = delete;
 	zip_file_impl(zip_file_impl &&) = delete;
@@ -227,6 +247,19 @@ private:
 		return std::chrono::system_clock::from_time_t(std::mktime(&datetime));
 	}
 
+	// persistent central directory index
+	static std::string index_path()
+	{
+		std::lock_guard<std::mutex> guard(s_cache_mutex);
+		return s_index_path;
+	}
+	std::string index_filename(std::string const &path) const
+	{
+		return path + PATH_SEPARATOR + sha1_creator::simple(m_filename.c_str(), m_filename.length()).as_string() + ".zix";
+	}
+	bool load_index();
+	void save_index() const;
+
 	// ZIP file parsing
 	archive_file::error read_ecd();
 	archive_file::error get_compressed_data_offset(std::uint64_t &offset);
@@ -266,13 +299,16 @@ private:
 	};
 
 	static constexpr std::size_t        DECOMPRESS_BUFSIZE = 16384;
+	static constexpr std::uint64_t      NO_STORED_OFFSET = ~std::uint64_t(0);
 	static constexpr std::size_t        CACHE_SIZE = 8; // number of open files to cache
 	static std::array<ptr, CACHE_SIZE>  s_cache;
 	static std::mutex                   s_cache_mutex;
+	static std::string                  s_index_path;   // directory for persistent central directory indexes
 
 	const std::string           m_filename;                 // copy of ZIP filename (for caching)
 	osd_file::ptr               m_file;                     // OSD file handle
 	std::uint64_t               m_length;                   // length of zip file
+	std::chrono::system_clock::time_point m_modified;       // last modified time of zip file, for the index
 
 	ecd                         m_ecd;                      // end of central directory
 
@@ -280,6 +316,7 @@ private:
 	std::uint32_t               m_cd_pos;                   // position in central directory
 	file_header                 m_header;                   // current file header
 	bool                        m_curr_is_dir;              // current file is directory
+	std::uint64_t               m_stored_offset;            // offset of current file's data if stored, once known
 
 	std::array<std::uint8_t, DECOMPRESS_BUFSIZE> m_buffer;  // buffer for decompression
 };
@@ -315,6 +352,9 @@ public:
 
 	virtual error decompress(void *buffer, std::uint32_t length) override { return m_impl->decompress(buffer, length); }
 
+	virtual bool current_is_stored() const override { return m_impl->current_is_stored(); }
+	virtual error read_stored(std::uint64_t offset, void *buffer, std::uint32_t length, std::uint32_t &actual) override { return m_impl->read_stored(offset, buffer, length, actual); }
+
 private:
 	zip_file_impl::ptr m_impl;
 };
@@ -655,6 +695,131 @@ private:
 
 std::array<zip_file_impl::ptr, zip_file_impl::CACHE_SIZE> zip_file_impl::s_cache;
 std::mutex zip_file_impl::s_cache_mutex;
+std::string zip_file_impl::s_index_path;
+
+constexpr char INDEX_MAGIC[8] = { 'M', 'Z', 'I', 'X', 'v', '1', 0, 0 };
+constexpr std::size_t INDEX_HEADER_LENGTH = sizeof(INDEX_MAGIC) + (10 * 8);
+
+void put_index_qword(std::vector<std::uint8_t> &data, std::uint64_t value)
+{
+	for (int byte = 0; byte < 8; byte++)
+		data.push_back(std::uint8_t(value >> (byte * 8)));
+}
+
+std::uint64_t get_index_qword(std::uint8_t const *&src)
+{
+	std::uint64_t value = 0;
+	for (int byte = 0; byte < 8; byte++)
+		value |= std::uint64_t(*src++) << (byte * 8);
+	return value;
+}
+
+
+
+/*-------------------------------------------------
+    load_index - fill in the central directory
+    from an index written by an earlier run, if
+    the archive's size and modification time
+    still match it
+-------------------------------------------------*/
+
+bool zip_file_impl::load_index()
+{
+	std::string const path = index_path();
+	if (path.empty())
+		return false;
+
+	auto const stat = osd_stat(m_filename);
+	if (!stat || (stat->type != osd::directory::entry::entry_type::FILE))
+		return false;
+	m_modified = stat->last_modified;
+
+	// read the whole index
+	osd_file::ptr file;
+	std::uint64_t length;
+	if (osd_file::open(index_filename(path), OPEN_FLAG_READ, file, length) != osd_file::error::NONE)
+		return false;
+	if ((length < INDEX_HEADER_LENGTH) || (length > std::numeric_limits<std::uint32_t>::max()))
+		return false;
+	std::vector<std::uint8_t> data(length);
+	std::uint32_t read_length;
+	if ((file->read(&data[0], 0, length, read_length) != osd_file::error::NONE) || (read_length != length))
+		return false;
+
+	// check it describes this archive as it is now
+	std::uint8_t const *src = &data[0];
+	if (memcmp(src, INDEX_MAGIC, sizeof(INDEX_MAGIC)))
+		return false;
+	src += sizeof(INDEX_MAGIC);
+	std::uint64_t const size = get_index_qword(src);
+	std::int64_t const modified = get_index_qword(src);
+	std::uint64_t const namelength = get_index_qword(src);
+	if ((size != stat->size) || (modified != std::int64_t(m_modified.time_since_epoch().count())) || (namelength != m_filename.length()))
+		return false;
+
+	ecd index_ecd;
+	index_ecd.disk_number          = get_index_qword(src);
+	index_ecd.cd_start_disk_number = get_index_qword(src);
+	index_ecd.cd_disk_entries      = get_index_qword(src);
+	index_ecd.cd_total_entries     = get_index_qword(src);
+	index_ecd.cd_size              = get_index_qword(src);
+	index_ecd.cd_start_disk_offset = get_index_qword(src);
+	std::uint64_t const cdlength = get_index_qword(src);
+	if ((cdlength != index_ecd.cd_size) || ((length - INDEX_HEADER_LENGTH) != (namelength + cdlength)))
+		return false;
+	if (m_filename.compare(0, namelength, reinterpret_cast<char const *>(src), namelength))
+		return false;
+	src += namelength;
+
+	try { m_cd.assign(src, src + cdlength); }
+	catch (...) { return false; }
+	m_ecd = index_ecd;
+	m_length = size;
+	osd_printf_verbose("unzip: read %s central directory from index\n", m_filename);
+	return true;
+}
+
+
+/*-------------------------------------------------
+    save_index - write the central directory out
+    for later runs
+-------------------------------------------------*/
+
+void zip_file_impl::save_index() const
+{
+	std::string const path = index_path();
+	if (path.empty())
+		return;
+
+	// key on what the archive looked like when it was read
+	auto const stat = osd_stat(m_filename);
+	if (!stat || (stat->type != osd::directory::entry::entry_type::FILE) || (stat->size != m_length))
+		return;
+
+	std::vector<std::uint8_t> data(std::begin(INDEX_MAGIC), std::end(INDEX_MAGIC));
+	put_index_qword(data, stat->size);
+	put_index_qword(data, stat->last_modified.time_since_epoch().count());
+	put_index_qword(data, m_filename.length());
+	put_index_qword(data, m_ecd.disk_number);
+	put_index_qword(data, m_ecd.cd_start_disk_number);
+	put_index_qword(data, m_ecd.cd_disk_entries);
+	put_index_qword(data, m_ecd.cd_total_entries);
+	put_index_qword(data, m_ecd.cd_size);
+	put_index_qword(data, m_ecd.cd_start_disk_offset);
+	put_index_qword(data, m_cd.size());
+	data.insert(data.end(), m_filename.begin(), m_filename.end());
+	data.insert(data.end(), m_cd.begin(), m_cd.end());
+	if (data.size() > std::numeric_limits<std::uint32_t>::max())
+		return;
+
+	osd_file::ptr file;
+	std::uint64_t length;
+	std::uint32_t written;
+	if ((osd_file::open(index_filename(path), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file, length) != osd_file::error::NONE)
+			|| (file->write(&data[0], 0, data.size(), written) != osd_file::error::NONE)
+			|| (written != data.size()))
+		osd_printf_verbose("unzip: unable to write %s index\n", m_filename);
+}
 
 
 
@@ -704,6 +869,9 @@ void zip_file_impl::close(ptr &&zip)
 
 int zip_file_impl::search(std::uint32_t search_crc, const std::string &search_filename, bool matchcrc, bool matchname, bool partialpath)
 {
+	// whatever we find, we don't know where its data is yet
+	m_stored_offset = NO_STORED_OFFSET;
+
 	// if we're at or past the end, we're done
 	while ((m_cd_pos + central_dir_entry_reader::minimum_length()) <= m_ecd.cd_size)
 	{
@@ -866,6 +1034,49 @@ archive_file::error zip_file_impl::decompress(void *buffer, std::uint32_t length
 
 
 
+/*-------------------------------------------------
+    read_stored - read part of a stored file
+    straight into the caller's buffer
+-------------------------------------------------*/
+
+archive_file::error zip_file_impl::read_stored(std::uint64_t offset, void *buffer, std::uint32_t length, std::uint32_t &actual)
+{
+	actual = 0;
+	if (!current_is_stored())
+		return archive_file::error::UNSUPPORTED;
+
+	// find the data the first time through; this opens the file if need be
+	if (m_stored_offset == NO_STORED_OFFSET)
+	{
+		std::uint64_t dataoffset;
+		auto const ziperr = get_compressed_data_offset(dataoffset);
+		if (ziperr != archive_file::error::NONE)
+			return ziperr;
+		m_stored_offset = dataoffset;
+	}
+	else
+	{
+		auto const ziperr = reopen();
+		if (ziperr != archive_file::error::NONE)
+			return ziperr;
+	}
+
+	// clip to the end of the file
+	if (offset >= m_header.uncompressed_length)
+		return archive_file::error::NONE;
+	length = std::uint32_t((std::min<std::uint64_t>)(length, m_header.uncompressed_length - offset));
+
+	auto const filerr = m_file->read(buffer, m_stored_offset + offset, length, actual);
+	if (filerr != osd_file::error::NONE)
+	{
+		osd_printf_error("unzip: error reading %s from %s (%d)\n", m_header.file_name, m_filename, int(filerr));
+		return archive_file::error::FILE_ERROR;
+	}
+	return archive_file::error::NONE;
+}
+
+
+
 /***************************************************************************
     ZIP FILE PARSING
 ***************************************************************************/
@@ -1469,6 +1680,17 @@ archive_file::error archive_file::open_zip(const std::string &filename, ptr &res
 }
 
 
+/*-------------------------------------------------
+    set_index_path - keep ZIP central directories
+    in this directory between runs
+-------------------------------------------------*/
+
+void archive_file::set_index_path(std::string &&path)
+{
+	zip_file_impl::set_index_path(std::move(path));
+}
+
+
 /*-------------------------------------------------
     zip_file_cache_clear - clear the ZIP file
     cache and free all memory
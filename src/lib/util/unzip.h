@@ -60,6 +60,9 @@ public:
 	// clear out all open files from the cache
 	static void cache_clear();
 
+	// keep ZIP central directories in this directory between runs; empty disables it
+	static void set_index_path(std::string &&path);
+
 
 	/* ----- contained file access ----- */
 
@@ -81,6 +84,10 @@ public:
 
 	// decompress the most recently found file in the ZIP
 	virtual error decompress(void *buffer, std::uint32_t length) = 0;
+
+	// read part of the most recently found file straight from the archive, if it's stored uncompressed
+	virtual bool current_is_stored() const = 0;
+	virtual error read_stored(std::uint64_t offset, void *buffer, std::uint32_t length, std::uint32_t &actual) = 0;
 };
 
 } // namespace util
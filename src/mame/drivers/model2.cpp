@@ -2498,7 +2498,7 @@ void model2_state::model2_screen(machine_config &config)
 	m_tiles->xvout_write_callback().set(FUNC(model2_state::vertical_sync_w));
 
 	SCREEN(config, m_screen, SCREEN_TYPE_RASTER);
-	m_screen->set_video_attributes(VIDEO_UPDATE_AFTER_VBLANK);
+	m_screen->set_video_attributes(VIDEO_UPDATE_AFTER_VBLANK | VIDEO_SCALABLE);
 	// TODO: from System 24, might not be accurate for Model 2
 	m_screen->set_raw(VIDEO_CLOCK/2, 656, 0/*+69*/, 496/*+69*/, 424, 0/*+25*/, 384/*+25*/);
 	m_screen->set_screen_update(FUNC(model2_state::screen_update_model2));
@@ -229,6 +229,7 @@ protected:
 	void geo_parse( void );
 	void model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &cliprect );
 	void draw_framebuffer(bitmap_rgb32 &bitmap, const rectangle &cliprect );
+	void copy_sys24_bitmap(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 
 	void model2_timers(machine_config &config);
 	void model2_screen(machine_config &config);
@@ -637,10 +638,11 @@ public:
 public:
 	using triangle = model2_state::triangle;
 
-	model2_renderer(model2_state& state)
-		: poly_manager<float, m2_poly_extra_data, 4, 0x10000>(state.machine())
+	model2_renderer(model2_state& state, int scale)
+		: poly_manager<float, m2_poly_extra_data, 4, 0x10000>(state.machine(), FLAG_BIN_TILES)
 		, m_state(state)
-		, m_destmap(512, 512)
+		, m_destmap(512 * scale, 512 * scale)
+		, m_scale(scale)
 	{
 		m_renderfuncs[0] = &model2_renderer::model2_3d_render_0;
 		m_renderfuncs[1] = &model2_renderer::model2_3d_render_1;
@@ -721,6 +723,7 @@ public:
 private:
 	model2_state& m_state;
 	bitmap_rgb32 m_destmap;
+	int m_scale;
 	int16_t m_xoffs,m_yoffs;
 };
 
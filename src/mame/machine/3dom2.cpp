@@ -1939,6 +1939,9 @@ void m2_cde_device::start_dma(uint32_t ch)
 #if 0
 		logerror("%s: CDE DMA %u: [%.8x] -> [%.8x], 0x%.8x bytes\n", machine().describe_context(), ch, dma_ch.m_cbad, dma_ch.m_cpad, dma_ch.m_ccnt);
 #endif
+		// Anything translated from the destination is about to be stale
+		m_cpu1->invalidate_code(dma_ch.m_cpad, dma_ch.m_ccnt);
+
 		// Determine the BioBus device from the address
 		const uint32_t slot = address_to_biobus_slot(dma_ch.m_cbad);
 
@@ -1993,11 +1996,6 @@ void m2_cde_device::next_dma(uint32_t ch)
 {
 	dma_channel &dma_ch = m_dma[ch];
 
-	// TODO: HACK!
-#if 1
-	m_cpu1->set_cache_dirty();
-#endif
-
 	if (dma_ch.m_ccnt != 0)
 		throw emu_fatalerror("m2_cde_device::next_dma: DMA count non-zero during next DMA");
 
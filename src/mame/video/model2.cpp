@@ -777,8 +777,17 @@ void model2_renderer::model2_3d_render(triangle *tri, const rectangle &cliprect)
 	/* select renderer based on attributes (bit15 = checker, bit14 = textured, bit13 = transparent */
 	renderer = (tri->texheader[0] >> 13) & 7;
 
-	/* calculate and clip to viewport */
+	/* calculate and clip to viewport, at the screen's internal resolution */
 	rectangle vp(tri->viewport[0] + m_xoffs, tri->viewport[2] + m_xoffs, (384-tri->viewport[3]) + m_yoffs, (384-tri->viewport[1]) + m_yoffs);
+	if (m_scale != 1)
+	{
+		vp.set(vp.left() * m_scale, ((vp.right() + 1) * m_scale) - 1, vp.top() * m_scale, ((vp.bottom() + 1) * m_scale) - 1);
+		for (poly_vertex &vertex : tri->v)
+		{
+			vertex.x *= m_scale;
+			vertex.y *= m_scale;
+		}
+	}
 	vp &= cliprect;
 
 	extra.state = &m_state;
@@ -943,12 +952,13 @@ void model2_state::draw_framebuffer( bitmap_rgb32 &bitmap, const rectangle &clip
 	// TODO: halved crtc values?
 	int xoffs = (-m_crtc_xoffset)/2;
 	int yoffs = m_crtc_yoffset/2;
+	int const scale = m_screen->render_scale();
 
 	for (int y = cliprect.min_y; y <= cliprect.max_y; ++y)
 	{
 		for (int x = cliprect.min_x; x <= cliprect.max_x; x++)
 		{
-			int offset = (x + xoffs) + (y + yoffs)*512;
+			int offset = ((x / scale) + xoffs) + ((y / scale) + yoffs)*512;
 			int b = (fbvram[offset] >> 0) & 0x1f;
 			int r = (fbvram[offset] >> 5) & 0x1f;
 			int g = (fbvram[offset] >> 10) & 0x1f;
@@ -2557,7 +2567,7 @@ void model2_state::video_start()
 
 	m_sys24_bitmap.allocate(width, height+4);
 
-	m_poly = std::make_unique<model2_renderer>(*this);
+	m_poly = std::make_unique<model2_renderer>(*this, m_screen->render_scale());
 
 	/* initialize the hardware rasterizer */
 	raster_init( memregion("textures") );
@@ -2591,16 +2601,30 @@ void model2_state::video_start()
 	save_pointer(NAME(m_gamma_table), 256);
 }
 
+// the tilemaps are always drawn at native resolution; when the 3D is rendered
+// at a higher internal resolution they're scaled up to match
+void model2_state::copy_sys24_bitmap(bitmap_rgb32 &bitmap, const rectangle &cliprect)
+{
+	int const scale = m_screen->render_scale();
+	if (scale == 1)
+		copybitmap_trans(bitmap, m_sys24_bitmap, 0, 0, 0, 0, cliprect, 0);
+	else
+		copyrozbitmap_trans(bitmap, cliprect, m_sys24_bitmap, 0x8000 / scale, 0x8000 / scale, 0x10000 / scale, 0, 0, 0x10000 / scale, false, 0);
+}
+
 u32 model2_state::screen_update_model2(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	int const scale = screen.render_scale();
+	rectangle const tileclip(cliprect.left() / scale, cliprect.right() / scale, cliprect.top() / scale, cliprect.bottom() / scale);
+
 	//logerror("--- frame ---\n");
 	bitmap.fill(m_palette->pen(0), cliprect);
-	m_sys24_bitmap.fill(0, cliprect);
+	m_sys24_bitmap.fill(0, tileclip);
 
 	for(int layer = 3; layer >= 0; layer--)
-		m_tiles->draw(screen, m_sys24_bitmap, cliprect, layer<<1, 0, 0);
+		m_tiles->draw(screen, m_sys24_bitmap, tileclip, layer<<1, 0, 0);
 
-	copybitmap_trans(bitmap, m_sys24_bitmap, 0, 0, 0, 0, cliprect, 0);
+	copy_sys24_bitmap(bitmap, cliprect);
 
 	/* tell the rasterizer we're starting a frame */
 	if(m_render_test_mode == true)
@@ -2617,12 +2641,12 @@ u32 model2_state::screen_update_model2(screen_device &screen, bitmap_rgb32 &bitm
 		model2_3d_frame_end( bitmap, cliprect );
 	}
 
-	m_sys24_bitmap.fill(0, cliprect);
+	m_sys24_bitmap.fill(0, tileclip);
 
 	for (int layer = 3; layer >= 0; layer--)
-		m_tiles->draw(screen, m_sys24_bitmap, cliprect, (layer<<1) | 1, 0, 0);
+		m_tiles->draw(screen, m_sys24_bitmap, tileclip, (layer<<1) | 1, 0, 0);
 
-	copybitmap_trans(bitmap, m_sys24_bitmap, 0, 0, 0, 0, cliprect, 0);
+	copy_sys24_bitmap(bitmap, cliprect);
 
 	return 0;
 }
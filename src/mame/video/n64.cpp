@@ -446,6 +446,17 @@ int32_t n64_rdp::alpha_combiner_equation(int32_t a, int32_t b, int32_t c, int32_
 	return a;
 }
 
+static bool combiner_reads(const color_inputs_t &inputs, int cycle, const color_t *color, const color_t *alpha)
+{
+	const color_t *const used[] = {
+		inputs.combiner_rgbsub_a[cycle], inputs.combiner_rgbsub_b[cycle], inputs.combiner_rgbmul[cycle], inputs.combiner_rgbadd[cycle],
+		inputs.combiner_alphasub_a[cycle], inputs.combiner_alphasub_b[cycle], inputs.combiner_alphamul[cycle], inputs.combiner_alphaadd[cycle] };
+	for (const color_t *input : used)
+		if (input == color || input == alpha)
+			return true;
+	return false;
+}
+
 void n64_rdp::set_suba_input_rgb(color_t** input, int32_t code, rdp_span_aux* userdata)
 {
 	switch (code & 0xf)
@@ -2151,6 +2162,10 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 				set_sub_input_alpha(&userdata->m_color_inputs.combiner_alphasub_b[1], m_combine.sub_b_a1, userdata);
 				set_mul_input_alpha(&userdata->m_color_inputs.combiner_alphamul[1], m_combine.mul_a1, userdata);
 				set_sub_input_alpha(&userdata->m_color_inputs.combiner_alphaadd[1], m_combine.add_a1, userdata);
+
+				// Note which per-pixel inputs the combiner reads so the span functions can skip the others
+				userdata->m_needs_texel0 = combiner_reads(userdata->m_color_inputs, 1, &userdata->m_texel0_color, &userdata->m_texel0_alpha);
+				userdata->m_needs_noise = ((m_combine.sub_a_rgb0 & 0xf) == 7) || ((m_combine.sub_a_rgb1 & 0xf) == 7);
 			}
 
 			if (spix == 3)
@@ -3630,12 +3645,18 @@ void n64_rdp::span_draw_1cycle(int32_t scanline, const extent_t &extent, const r
 			rgbaz_correct_triangle(offx, offy, &sr, &sg, &sb, &sa, &sz, userdata, object);
 			rgbaz_clip(sr, sg, sb, sa, &sz, userdata);
 
-			((m_tex_pipe).*(m_tex_pipe.m_cycle[cycle0]))(&userdata->m_texel0_color, &userdata->m_texel0_color, sss, sst, tilenum, 0, userdata, object);
-			uint32_t t0a = userdata->m_texel0_color.get_a();
-			userdata->m_texel0_alpha.set(t0a, t0a, t0a, t0a);
+			if (userdata->m_needs_texel0)
+			{
+				((m_tex_pipe).*(m_tex_pipe.m_cycle[cycle0]))(&userdata->m_texel0_color, &userdata->m_texel0_color, sss, sst, tilenum, 0, userdata, object);
+				uint32_t t0a = userdata->m_texel0_color.get_a();
+				userdata->m_texel0_alpha.set(t0a, t0a, t0a, t0a);
+			}
 
-			const uint8_t noise = machine().rand() << 3; // Not accurate
-			userdata->m_noise_color.set(0, noise, noise, noise);
+			if (userdata->m_needs_noise)
+			{
+				const uint8_t noise = machine().rand() << 3; // Not accurate
+				userdata->m_noise_color.set(0, noise, noise, noise);
+			}
 
 			rgbaint_t rgbsub_a(*userdata->m_color_inputs.combiner_rgbsub_a[1]);
 			rgbaint_t rgbsub_b(*userdata->m_color_inputs.combiner_rgbsub_b[1]);
@@ -3861,8 +3882,11 @@ void n64_rdp::span_draw_2cycle(int32_t scanline, const extent_t &extent, const r
 			userdata->m_texel1_alpha.set(t1a, t1a, t1a, t1a);
 			userdata->m_next_texel_alpha.set(tna, tna, tna, tna);
 
-			const uint8_t noise = machine().rand() << 3; // Not accurate
-			userdata->m_noise_color.set(0, noise, noise, noise);
+			if (userdata->m_needs_noise)
+			{
+				const uint8_t noise = machine().rand() << 3; // Not accurate
+				userdata->m_noise_color.set(0, noise, noise, noise);
+			}
 
 			rgbaint_t rgbsub_a(*userdata->m_color_inputs.combiner_rgbsub_a[0]);
 			rgbaint_t rgbsub_b(*userdata->m_color_inputs.combiner_rgbsub_b[0]);
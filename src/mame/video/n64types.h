@@ -305,6 +305,8 @@ struct rdp_span_aux
 	int32_t               m_dzpix_enc;
 	uint8_t*              m_tmem;                /* pointer to texture cache for this polygon */
 	bool                m_start_span;
+	bool                m_needs_texel0;         /* 1-cycle combiner reads texel 0 */
+	bool                m_needs_noise;          /* combiner reads the noise input */
 	rgbaint_t           m_clamp_diff[8];
 };
 
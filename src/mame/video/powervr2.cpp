@@ -2456,7 +2456,7 @@ inline void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int
 }
 
 template <powervr2_device::pix_sample_fn sample_fn, int group_no>
-inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti,
 									float y0, float y1,
 									float xl, float xr,
 									float ul, float ur,
@@ -2475,10 +2475,13 @@ inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
 	float dy;
 	int yy0, yy1;
 
-	if(y1 <= 0)
+	float const ymin = cliprect.top();
+	float const ymax = std::min(cliprect.bottom() + 1, 480);
+
+	if(y1 <= ymin)
 		return;
-	if(y1 > 480)
-		y1 = 480;
+	if(y1 > ymax)
+		y1 = ymax;
 
 	float bl[4], br[4], offl[4], offr[4];
 	memcpy(bl, bl_in, sizeof(bl));
@@ -2486,23 +2489,24 @@ inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
 	memcpy(offl, offl_in, sizeof(offl));
 	memcpy(offr, offr_in, sizeof(offr));
 
-	if(y0 < 0) {
-		xl += -dxldy*y0;
-		xr += -dxrdy*y0;
-		ul += -duldy*y0;
-		ur += -durdy*y0;
-		vl += -dvldy*y0;
-		vr += -dvrdy*y0;
-		wl += -dwldy*y0;
-		wr += -dwrdy*y0;
+	if(y0 < ymin) {
+		float const skip = ymin - y0;
+		xl += dxldy*skip;
+		xr += dxrdy*skip;
+		ul += duldy*skip;
+		ur += durdy*skip;
+		vl += dvldy*skip;
+		vr += dvrdy*skip;
+		wl += dwldy*skip;
+		wr += dwrdy*skip;
 
 		for (idx = 0; idx < 4; idx++) {
-			bl[idx] += -dbldy[idx] * y0;
-			br[idx] += -dbrdy[idx] * y0;
-			offl[idx] += -doldy[idx] * y0;
-			offr[idx] += -dordy[idx] * y0;
+			bl[idx] += dbldy[idx] * skip;
+			br[idx] += dbrdy[idx] * skip;
+			offl[idx] += doldy[idx] * skip;
+			offr[idx] += dordy[idx] * skip;
 		}
-		y0 = 0;
+		y0 = ymin;
 	}
 
 	yy0 = round(y0);
@@ -2587,13 +2591,13 @@ void powervr2_device::sort_vertices(const vert *v, int *i0, int *i1, int *i2)
 
 
 template <powervr2_device::pix_sample_fn sample_fn, int group_no>
-inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v0, const vert *v1, const vert *v2)
+inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti, const vert *v0, const vert *v1, const vert *v2)
 {
 	float dy01, dy02, dy12;
 
 	float dx01dy, dx02dy, dx12dy, du01dy, du02dy, du12dy, dv01dy, dv02dy, dv12dy, dw01dy, dw02dy, dw12dy;
 
-	if(v0->y >= 480 || v2->y < 0)
+	if(v0->y >= std::min(cliprect.bottom() + 1, 480) || v2->y < cliprect.top())
 		return;
 
 	float db01[4] = {
@@ -2705,15 +2709,15 @@ inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti
 			return;
 
 		if(v1->x > v0->x)
-			render_span<sample_fn, group_no>(bitmap, ti, v1->y, v2->y, v0->x, v1->x, v0->u, v1->u, v0->v, v1->v, v0->w, v1->w, v0->b, v1->b, v0->o, v1->o, dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy, db02dy, db12dy, do02dy, do12dy);
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v1->y, v2->y, v0->x, v1->x, v0->u, v1->u, v0->v, v1->v, v0->w, v1->w, v0->b, v1->b, v0->o, v1->o, dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy, db02dy, db12dy, do02dy, do12dy);
 		else
-			render_span<sample_fn, group_no>(bitmap, ti, v1->y, v2->y, v1->x, v0->x, v1->u, v0->u, v1->v, v0->v, v1->w, v0->w, v1->b, v0->b, v1->o, v0->o, dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy, db12dy, db02dy, do12dy, do02dy);
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v1->y, v2->y, v1->x, v0->x, v1->u, v0->u, v1->v, v0->v, v1->w, v0->w, v1->b, v0->b, v1->o, v0->o, dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy, db12dy, db02dy, do12dy, do02dy);
 
 	} else if(!dy12) {
 		if(v2->x > v1->x)
-			render_span<sample_fn, group_no>(bitmap, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o, dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy, db01dy, db02dy, do01dy, do02dy);
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o, dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy, db01dy, db02dy, do01dy, do02dy);
 		else
-			render_span<sample_fn, group_no>(bitmap, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o, dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy, db02dy, db01dy, do02dy, do01dy);
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o, dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy, db02dy, db01dy, do02dy, do01dy);
 
 	} else {
 			float idk_b[4] = {
@@ -2729,17 +2733,17 @@ inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti
 				v0->o[3] + do02dy[3] * dy01
 			};
 		if(dx01dy < dx02dy) {
-			render_span<sample_fn, group_no>(bitmap, ti, v0->y, v1->y,
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v0->y, v1->y,
 						v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o,
 						dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy, db01dy, db02dy, do01dy, do02dy);
-			render_span<sample_fn, group_no>(bitmap, ti, v1->y, v2->y,
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v1->y, v2->y,
 						v1->x, v0->x + dx02dy*dy01, v1->u, v0->u + du02dy*dy01, v1->v, v0->v + dv02dy*dy01, v1->w, v0->w + dw02dy*dy01, v1->b, idk_b, v1->o, idk_o,
 						dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy, db12dy, db02dy, do12dy, do02dy);
 		} else {
-			render_span<sample_fn, group_no>(bitmap, ti, v0->y, v1->y,
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v0->y, v1->y,
 						v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o,
 						dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy, db02dy, db01dy, do02dy, do01dy);
-			render_span<sample_fn, group_no>(bitmap, ti, v1->y, v2->y,
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v1->y, v2->y,
 						v0->x + dx02dy*dy01, v1->x, v0->u + du02dy*dy01, v1->u, v0->v + dv02dy*dy01, v1->v, v0->w + dw02dy*dy01, v1->w, idk_b, v1->b, idk_o, v1->o,
 						dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy, db02dy, db12dy, do02dy, do12dy);
 		}
@@ -2747,7 +2751,7 @@ inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti
 }
 
 template <int group_no>
-void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v)
+void powervr2_device::render_tri(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti, const vert *v)
 {
 	int i0, i1, i2;
 
@@ -2760,16 +2764,16 @@ void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *
 		if (bilinear) {
 			switch (ti->tsinstruction) {
 			case 0:
-				render_tri_sorted<&powervr2_device::sample_textured<0,true>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<0,true>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			case 1:
-				render_tri_sorted<&powervr2_device::sample_textured<1,true>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<1,true>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			case 2:
-				render_tri_sorted<&powervr2_device::sample_textured<2,true>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<2,true>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			case 3:
-				render_tri_sorted<&powervr2_device::sample_textured<3,true>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<3,true>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			default:
 				/*
@@ -2777,21 +2781,21 @@ void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *
 				 * AND'd with 3
 				 */
 				logerror("%s - tsinstruction is 0x%08x\n", (unsigned)ti->tsinstruction);
-				render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 			}
 		} else {
 			switch (ti->tsinstruction) {
 			case 0:
-				render_tri_sorted<&powervr2_device::sample_textured<0,false>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<0,false>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			case 1:
-				render_tri_sorted<&powervr2_device::sample_textured<1,false>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<1,false>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			case 2:
-				render_tri_sorted<&powervr2_device::sample_textured<2,false>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<2,false>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			case 3:
-				render_tri_sorted<&powervr2_device::sample_textured<3,false>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<3,false>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			default:
 				/*
@@ -2799,11 +2803,11 @@ void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *
 				 * AND'd with 3
 				 */
 				logerror("%s - tsinstruction is 0x%08x\n", (unsigned)ti->tsinstruction);
-				render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 			}
 		}
 	} else {
-			render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+			render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 	}
 }
 
@@ -2837,22 +2841,48 @@ void powervr2_device::render_group_to_accumulation_buffer(bitmap_rgb32 &bitmap,c
 		if(ev == -1)
 			continue;
 
-		for(i=sv; i <= ev; i++)
-		{
-			vert *tv = grab[rs].verts + i;
-			tv->u = tv->u * ts->ti.sizex * tv->w;
-			tv->v = tv->v * ts->ti.sizey * tv->w;
-		}
-
 		for(i=sv; i <= ev-2; i++)
 		{
 			if (!(debug_dip_status&0x2))
-				render_tri<group_no>(bitmap, &ts->ti, grab[rs].verts + i);
+				render_tri<group_no>(bitmap, cliprect, &ts->ti, grab[rs].verts + i);
+
+		}
+	}
+}
+
+// scales the texture coordinates of every strip in a display list by the
+// texture size and W, ready for rendering
+void powervr2_device::prepare_group_vertices(int group_no)
+{
+	struct poly_group *grp = grab[renderselect].groups + group_no;
+
+	for (int cs=0;cs < grp->strips_size;cs++)
+	{
+		strip *ts = &grp->strips[cs];
+		if(ts->evert == -1)
+			continue;
 
+		for(int i=ts->svert; i <= ts->evert; i++)
+		{
+			vert *tv = grab[renderselect].verts + i;
+			tv->u = tv->u * ts->ti.sizex * tv->w;
+			tv->v = tv->v * ts->ti.sizey * tv->w;
 		}
 	}
 }
 
+// renders all display lists into one band of rows of the accumulation buffer
+void *powervr2_device::render_band(void *param, int threadid)
+{
+	auto const &band = *reinterpret_cast<render_band_parameters const *>(param);
+
+	// TODO: modifier volumes
+	band.device->render_group_to_accumulation_buffer<DISPLAY_LIST_OPAQUE>(*band.bitmap, band.cliprect);
+	band.device->render_group_to_accumulation_buffer<DISPLAY_LIST_TRANS>(*band.bitmap, band.cliprect);
+	band.device->render_group_to_accumulation_buffer<DISPLAY_LIST_PUNCH_THROUGH>(*band.bitmap, band.cliprect);
+	return nullptr;
+}
+
 void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect) {
 	if (renderselect < 0)
 		return;
@@ -2864,10 +2894,24 @@ void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const
 	uint32_t c=space.read_dword(0x05000000+((isp_backgnd_t & 0xfffff8)>>1)+(3+3)*4);
 	bitmap.fill(c, cliprect);
 
-	// TODO: modifier volumes
-	render_group_to_accumulation_buffer<DISPLAY_LIST_OPAQUE>(bitmap, cliprect);
-	render_group_to_accumulation_buffer<DISPLAY_LIST_TRANS>(bitmap, cliprect);
-	render_group_to_accumulation_buffer<DISPLAY_LIST_PUNCH_THROUGH>(bitmap, cliprect);
+	prepare_group_vertices(DISPLAY_LIST_OPAQUE);
+	prepare_group_vertices(DISPLAY_LIST_TRANS);
+	prepare_group_vertices(DISPLAY_LIST_PUNCH_THROUGH);
+
+	// each pixel only depends on the primitives covering it and its own
+	// W buffer entry, so render tile-high bands of rows in parallel; each
+	// band still draws the display lists in order
+	render_band_parameters params[RENDER_BANDS];
+	for (int band = 0; band < RENDER_BANDS; band++)
+	{
+		params[band].device = this;
+		params[band].bitmap = &bitmap;
+		params[band].cliprect = cliprect;
+		params[band].cliprect.sety(std::max(cliprect.top(), band * 32), std::min(cliprect.bottom(), band * 32 + 31));
+	}
+	osd_work_item_queue_multiple(work_queue, &powervr2_device::render_band, RENDER_BANDS - 1, &params[1], sizeof(params[1]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	render_band(&params[0], 0);
+	osd_work_queue_wait(work_queue, osd_ticks_per_second() * 100);
 
 	grab[renderselect].busy=0;
 }
@@ -3978,6 +4022,8 @@ void powervr2_device::device_start()
 
 	grab = std::make_unique<receiveddata[]>(NUM_BUFFERS);
 
+	work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	pvr_build_parameterconfig();
 
 	computedilated();
@@ -4108,6 +4154,13 @@ void powervr2_device::device_start()
 	save_item(NAME(next_y));
 }
 
+void powervr2_device::device_stop()
+{
+	if (work_queue)
+		osd_work_queue_free(work_queue);
+	work_queue = nullptr;
+}
+
 void powervr2_device::device_reset()
 {
 	softreset =                 0x00000007;
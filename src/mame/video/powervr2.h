@@ -49,6 +49,7 @@ public:
 	uint32_t dilated1[15][1024];
 	int dilatechose[64];
 	float wbuffer[480][640];
+	osd_work_queue *work_queue = nullptr;   // queue for rendering bands of the accumulation buffer
 
 
 	// the real accumulation buffer is a 32x32x8bpp buffer into which tiles get rendered before they get copied to the framebuffer
@@ -343,6 +344,7 @@ public:
 
 protected:
 	virtual void device_start() override;
+	virtual void device_stop() override;
 	virtual void device_reset() override;
 
 private:
@@ -507,7 +509,7 @@ private:
 									float const offl[4], float const offr[4]);
 
 	template <pix_sample_fn sample_fn, int group_no>
-		inline void render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+		inline void render_span(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti,
 								float y0, float y1,
 								float xl, float xr,
 								float ul, float ur,
@@ -523,16 +525,27 @@ private:
 								float const doldy[4], float const dordy[4]);
 
 	template <pix_sample_fn sample_fn, int group_no>
-		inline void render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti,
+		inline void render_tri_sorted(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti,
 										const vert *v0,
 										const vert *v1, const vert *v2);
 
 	template <int group_no>
-		void render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v);
+		void render_tri(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti, const vert *v);
 
 	template <int group_no>
 		void render_group_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 
+	// the accumulation buffer is rendered in tile-high bands of rows
+	static constexpr int RENDER_BANDS = 480 / 32;
+	struct render_band_parameters
+	{
+		powervr2_device *device;
+		bitmap_rgb32 *bitmap;
+		rectangle cliprect;
+	};
+
+	void prepare_group_vertices(int group_no);
+	static void *render_band(void *param, int threadid);
 	void sort_vertices(const vert *v, int *i0, int *i1, int *i2);
 	void render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void pvr_accumulationbuffer_to_framebuffer(address_space &space, int x, int y);
@@ -369,6 +369,7 @@ public:
 		m_extended_mode(false),
 		m_send_stop_packet(false),
 		m_target_xml_sent(false),
+		m_batching(false),
 		m_triggered_breakpoint(nullptr),
 		m_triggered_watchpoint(nullptr),
 		m_readbuf_len(0),
@@ -428,6 +429,9 @@ public:
 	cmd_reply handle_s(const char *buf);
 	cmd_reply handle_z(const char *buf);
 	cmd_reply handle_Z(const char *buf);
+	cmd_reply handle_batch(const char *buf);
+	cmd_reply handle_breakpoint_list();
+	cmd_reply dispatch_packet(const char *packet);
 
 	enum readbuf_state
 	{
@@ -462,6 +466,8 @@ private:
 	bool m_extended_mode;
 	bool m_send_stop_packet;
 	bool m_target_xml_sent;     // the 'g', 'G', 'p', and 'P' commands only work once target.xml has been sent
+	bool m_batching;            // replies are collected into m_batch_reply rather than sent
+	std::string m_batch_reply;
 
 	struct gdb_register
 	{
@@ -700,6 +706,12 @@ void debug_gdbstub::send_ack()
 //-------------------------------------------------------------------------
 void debug_gdbstub::send_reply(const char *str)
 {
+	if ( m_batching )
+	{
+		m_batch_reply += str;
+		return;
+	}
+
 	size_t length = strlen(str);
 
 	uint8_t checksum = 0;
@@ -972,6 +984,7 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 	{
 		std::string reply = string_format("PacketSize=%x", MAX_PACKET_SIZE);
 		reply += ";qXfer:features:read+";
+		reply += ";qMameBatch+";
 		send_reply(reply.c_str());
 		return REPLY_NONE;
 	}
@@ -999,6 +1012,14 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 			}
 		}
 	}
+	else if ( name == "MameBatch" )
+	{
+		return handle_batch(params.c_str());
+	}
+	else if ( name == "MameBreakpoints" )
+	{
+		return handle_breakpoint_list();
+	}
 	else if ( name == "fThreadInfo" )
 	{
 		send_reply("m1");
@@ -1140,6 +1161,72 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_Z(const char *buf)
 	return REPLY_UNSUPPORTED;
 }
 
+//-------------------------------------------------------------------------
+// Run several packets separated by '|' in one round trip, replying with
+// their replies separated by '|'. Packets that resume or stop the target
+// are not allowed in a batch, and neither are monitor commands, since any
+// of them could resume it (directly, through an alias or a source file).
+debug_gdbstub::cmd_reply debug_gdbstub::handle_batch(const char *buf)
+{
+	if ( m_batching )
+		return REPLY_ENN;
+
+	std::string reply;
+	m_batching = true;
+	for ( bool first = true; ; first = false )
+	{
+		const char *end = strchr(buf, '|');
+		std::string packet = end ? std::string(buf, end - buf) : std::string(buf);
+		if ( !first )
+			reply += '|';
+
+		m_batch_reply.clear();
+		cmd_reply result = REPLY_UNSUPPORTED;
+		if ( !packet.empty() && !strchr("!?cDks", packet[0]) && strncmp(packet.c_str(), "qRcmd,", 6) != 0 )
+			result = dispatch_packet(packet.c_str());
+		if ( result == REPLY_OK )
+			reply += "OK";
+		else if ( result == REPLY_ENN )
+			reply += "E01";
+		else if ( result == REPLY_NONE )
+			reply += m_batch_reply;
+
+		if ( !end )
+			break;
+		buf = end + 1;
+	}
+	m_batching = false;
+	m_batch_reply.clear();
+
+	send_reply(reply.c_str());
+	return REPLY_NONE;
+}
+
+//-------------------------------------------------------------------------
+// List the enabled breakpoints and watchpoints as 'type,address,kind'
+// entries separated by ';', using the types of the 'Z' packet.
+debug_gdbstub::cmd_reply debug_gdbstub::handle_breakpoint_list()
+{
+	device_debug *debug = m_debugger_console->get_visible_cpu()->debug();
+	std::string reply = "l";
+	for ( const auto &bpp: debug->breakpoint_list() )
+	{
+		const debug_breakpoint &bp = *bpp.second;
+		if ( bp.enabled() )
+			reply += string_format("%s0,%x,0", (reply.length() > 1) ? ";" : "", bp.address());
+	}
+	for ( const auto &wp: debug->watchpoint_vector(m_address_space->spacenum()) )
+	{
+		if ( !wp->enabled() )
+			continue;
+		int type = (wp->type() == read_or_write::WRITE) ? 2 : (wp->type() == read_or_write::READ) ? 3 : 4;
+		auto mapped = m_address_map.find(wp->address());
+		uint64_t address = (mapped != m_address_map.end()) ? mapped->second : wp->address();
+		reply += string_format("%s%d,%" PRIx64 ",%x", (reply.length() > 1) ? ";" : "", type, address, wp->length());
+	}
+	send_reply(reply.c_str());
+	return REPLY_NONE;
+}
 
 //-------------------------------------------------------------------------
 void debug_gdbstub::send_stop_packet()
@@ -1177,10 +1264,22 @@ void debug_gdbstub::handle_packet()
 	// (‘$#00’) should be returned. That way it is possible to extend
 	// the protocol. A newer GDB can tell if a packet is supported
 	// based on that response.
+	cmd_reply reply = dispatch_packet((const char *) m_packet_buf);
+	if ( reply == REPLY_OK )
+		send_reply("OK");
+	else if ( reply == REPLY_ENN )
+		send_reply("E01");
+	else if ( reply == REPLY_UNSUPPORTED )
+		send_reply("");
+}
+
+//-------------------------------------------------------------------------
+debug_gdbstub::cmd_reply debug_gdbstub::dispatch_packet(const char *packet)
+{
 	cmd_reply reply = REPLY_UNSUPPORTED;
 
-	const char *buf = (const char *) m_packet_buf+1;
-	switch ( m_packet_buf[0] )
+	const char *buf = packet+1;
+	switch ( packet[0] )
 	{
 		case '!': reply = handle_exclamation(buf); break;
 		case '?': reply = handle_question(buf); break;
@@ -1199,12 +1298,7 @@ void debug_gdbstub::handle_packet()
 		case 'z': reply = handle_z(buf); break;
 		case 'Z': reply = handle_Z(buf); break;
 	}
-	if ( reply == REPLY_OK )
-		send_reply("OK");
-	else if ( reply == REPLY_ENN )
-		send_reply("E01");
-	else if ( reply == REPLY_UNSUPPORTED )
-		send_reply("");
+	return reply;
 }
 
 //-------------------------------------------------------------------------
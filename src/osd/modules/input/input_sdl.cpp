@@ -26,6 +26,7 @@
 #include <queue>
 #include <iterator>
 #include <algorithm>
+#include <array>
 
 // MAME headers
 #include "emu.h"
@@ -358,6 +359,17 @@ public:
 	}
 
 protected:
+	// pass a switch change on with the host time SDL saw it at, before the state is updated
+	void post_switch_event(input_item_id itemid, bool pressed, const SDL_Event &sdlevent)
+	{
+		input_device_item *const item = (itemid != ITEM_ID_INVALID) ? device()->item(itemid) : nullptr;
+		if (item)
+		{
+			// SDL stamps events in milliseconds on its own clock
+			Uint32 const age = SDL_GetTicks() - sdlevent.common.timestamp;
+			item->post_event(pressed ? 1 : 0, osd_ticks() - osd_ticks_t(age) * osd_ticks_per_second() / 1000);
+		}
+	}
 	std::shared_ptr<sdl_window_info> focus_window()
 	{
 		return sdl_event_manager::instance().focus_window();
@@ -372,11 +384,13 @@ class sdl_keyboard_device : public sdl_device
 {
 public:
 	keyboard_state keyboard;
+	std::array<input_item_id, MAX_KEYS> scancode_item;
 
 	sdl_keyboard_device(running_machine &machine, const char *name, const char *id, input_module &module)
 		: sdl_device(machine, name, id, DEVICE_CLASS_KEYBOARD, module),
 		keyboard({{0}})
 	{
+		scancode_item.fill(ITEM_ID_INVALID);
 	}
 
 	void process_event(SDL_Event &sdlevent) override
@@ -384,6 +398,8 @@ public:
 		switch (sdlevent.type)
 		{
 		case SDL_KEYDOWN:
+			if (sdlevent.key.keysym.scancode < MAX_KEYS && !keyboard.state[sdlevent.key.keysym.scancode])
+				post_switch_event(scancode_item[sdlevent.key.keysym.scancode], true, sdlevent);
 			keyboard.state[sdlevent.key.keysym.scancode] = 0x80;
 			if (sdlevent.key.keysym.sym < 0x20)
 				machine().ui_input().push_char_event(osd_common_t::s_window_list.front()->target(), sdlevent.key.keysym.sym);
@@ -403,6 +419,8 @@ public:
 			break;
 
 		case SDL_KEYUP:
+			if (sdlevent.key.keysym.scancode < MAX_KEYS)
+				post_switch_event(scancode_item[sdlevent.key.keysym.scancode], false, sdlevent);
 			keyboard.state[sdlevent.key.keysym.scancode] = 0x00;
 			break;
 
@@ -593,12 +611,14 @@ class sdl_joystick_device : public sdl_device
 public:
 	sdl_joystick_state    joystick;
 	sdl_api_state         sdl_state;
+	std::array<input_item_id, MAX_BUTTONS> button_item;
 
 	sdl_joystick_device(running_machine &machine, const char *name, const char *id, input_module &module)
 		: sdl_device(machine, name, id, DEVICE_CLASS_JOYSTICK, module),
 			joystick({{0}}),
 			sdl_state({ nullptr })
 	{
+		button_item.fill(ITEM_ID_INVALID);
 	}
 
 	~sdl_joystick_device()
@@ -672,7 +692,10 @@ public:
 		case SDL_JOYBUTTONDOWN:
 		case SDL_JOYBUTTONUP:
 			if (sdlevent.jbutton.button < MAX_BUTTONS)
+			{
+				post_switch_event(button_item[sdlevent.jbutton.button], sdlevent.jbutton.state == SDL_PRESSED, sdlevent);
 				joystick.buttons[sdlevent.jbutton.button] = (sdlevent.jbutton.state == SDL_PRESSED) ? 0x80 : 0;
+			}
 			break;
 		}
 	}
@@ -809,7 +832,9 @@ public:
 			char defname[20];
 			snprintf(defname, sizeof(defname) - 1, "%s", local_table[keynum].ui_name);
 
-			devinfo->device()->add_item(defname, itemid, generic_button_get_state<std::int32_t>, &devinfo->keyboard.state[local_table[keynum].sdl_scancode]);
+			itemid = devinfo->device()->add_item(defname, itemid, generic_button_get_state<std::int32_t>, &devinfo->keyboard.state[local_table[keynum].sdl_scancode]);
+			if (local_table[keynum].sdl_scancode < MAX_KEYS)
+				devinfo->scancode_item[local_table[keynum].sdl_scancode] = itemid;
 		}
 
 		osd_printf_verbose("Keyboard: Registered %s\n", devinfo->name());
@@ -1101,7 +1126,9 @@ public:
 					itemid = ITEM_ID_OTHER_SWITCH;
 
 				snprintf(tempname, sizeof(tempname), "button %d", button);
-				devinfo->device()->add_item(tempname, itemid, generic_button_get_state<std::int32_t>, &devinfo->joystick.buttons[button]);
+				itemid = devinfo->device()->add_item(tempname, itemid, generic_button_get_state<std::int32_t>, &devinfo->joystick.buttons[button]);
+				if (button < MAX_BUTTONS)
+					devinfo->button_item[button] = itemid;
 			}
 
 			// loop over all hats
@@ -10,6 +10,7 @@
 
 // MAME headers
 #include "osdcore.h"
+#include "osdfile.h"
 #include "osdlib.h"
 
 #include <csignal>
@@ -19,7 +20,10 @@
 #include <memory>
 
 #include <dlfcn.h>
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
 #include <sys/sysctl.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -167,6 +171,63 @@ int osd_getpid()
 }
 
 
+//============================================================
+//  osd_get_peak_memory_usage
+//============================================================
+
+std::uint64_t osd_get_peak_memory_usage()
+{
+	// unlike other Unix-like systems, ru_maxrss is in bytes here
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage))
+		return 0;
+	return std::uint64_t(usage.ru_maxrss);
+}
+
+
+//============================================================
+//  osd_get_process_cpu_time
+//============================================================
+
+double osd_get_process_cpu_time()
+{
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage))
+		return 0.0;
+	return double(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + double(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000000.0;
+}
+
+
+//============================================================
+//  osd_perf_counters_open
+//============================================================
+
+bool osd_perf_counters_open()
+{
+	// macOS has no public interface to the performance counters
+	return false;
+}
+
+
+//============================================================
+//  osd_perf_counters_read
+//============================================================
+
+bool osd_perf_counters_read(std::uint64_t *values)
+{
+	return false;
+}
+
+
+//============================================================
+//  osd_perf_counters_close
+//============================================================
+
+void osd_perf_counters_close()
+{
+}
+
+
 namespace osd {
 
 namespace {
@@ -270,6 +331,83 @@ bool virtual_memory_allocation::do_set_access(void *start, std::size_t size, uns
 	return mprotect(start, size, prot) == 0;
 }
 
+void *large_memory_allocation::do_alloc(std::size_t size, std::size_t &actual, bool &large_pages)
+{
+	long const p(sysconf(_SC_PAGE_SIZE));
+	if (0 >= p)
+		return nullptr;
+	std::size_t const s((size + p - 1) / p * p);
+	if (!s)
+		return nullptr;
+
+#if defined(VM_FLAGS_SUPERPAGE_SIZE_2MB)
+	// superpages need a 2MB multiple, and fail outright if the kernel can't supply them
+	std::size_t const huge(std::size_t(2) << 20);
+	std::size_t const hs((size + huge - 1) & ~(huge - 1));
+	void *const super(mmap(nullptr, hs, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, VM_FLAGS_SUPERPAGE_SIZE_2MB, 0));
+	if (super != (void *)-1)
+	{
+		actual = hs;
+		large_pages = true;
+		return super;
+	}
+#endif
+
+	void *const result(mmap(nullptr, s, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0));
+	if (result == (void *)-1)
+		return nullptr;
+	actual = s;
+	large_pages = false;
+	return result;
+}
+
+void large_memory_allocation::do_free(void *start, std::size_t size)
+{
+	munmap(start, size);
+}
+
+void *file_mapping::do_map(std::string const &path, std::size_t size)
+{
+	if (!size)
+		return nullptr;
+	int const fd(::open(path.c_str(), O_RDONLY));
+	if (fd < 0)
+		return nullptr;
+
+	// a short file would fault on access past its end rather than read as zero
+	struct stat st;
+	void *result((fstat(fd, &st) == 0 && std::uint64_t(st.st_size) >= size)
+			? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0)
+			: (void *)-1);
+	::close(fd);
+	return (result == (void *)-1) ? nullptr : result;
+}
+
+void file_mapping::do_unmap(void *start, std::size_t size)
+{
+	munmap(reinterpret_cast<char *>(start), size);
+}
+
+void *shared_mapping::do_map(std::string const &path, std::size_t size)
+{
+	if (!size)
+		return nullptr;
+	int const fd(::open(path.c_str(), O_RDWR | O_CREAT, 0644));
+	if (fd < 0)
+		return nullptr;
+
+	void *result((ftruncate(fd, size) == 0)
+			? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+			: (void *)-1);
+	::close(fd);
+	return (result == (void *)-1) ? nullptr : result;
+}
+
+void shared_mapping::do_unmap(void *start, std::size_t size)
+{
+	munmap(reinterpret_cast<char *>(start), size);
+}
+
 
 dynamic_module::ptr dynamic_module::open(std::vector<std::string> &&names)
 {
@@ -10,6 +10,7 @@
 
 // MAME headers
 #include "osdcore.h"
+#include "osdfile.h"
 #include "osdlib.h"
 
 #include <SDL2/SDL.h>
@@ -17,14 +18,24 @@
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <memory>
 
 #include <dlfcn.h>
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
 
 //============================================================
 //  osd_getenv
@@ -103,6 +114,150 @@ int osd_getpid()
 }
 
 
+//============================================================
+//  osd_get_peak_memory_usage
+//============================================================
+
+std::uint64_t osd_get_peak_memory_usage()
+{
+	// ru_maxrss is in kilobytes on Linux and the BSDs
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage))
+		return 0;
+	return std::uint64_t(usage.ru_maxrss) * 1024;
+}
+
+
+//============================================================
+//  osd_get_process_cpu_time
+//============================================================
+
+double osd_get_process_cpu_time()
+{
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage))
+		return 0.0;
+	return double(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + double(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000000.0;
+}
+
+
+#if defined(__linux__)
+
+namespace {
+
+// one event group per thread, led by the cycle counter so all events are
+// read together with a single system call
+struct perf_group
+{
+	int fd[OSD_PERF_COUNTER_COUNT] = { -1, -1, -1, -1 };
+	int slot[OSD_PERF_COUNTER_COUNT] = { -1, -1, -1, -1 };
+	int count = 0;
+};
+
+thread_local perf_group t_perf_group;
+
+int perf_event_open(std::uint32_t type, std::uint64_t config, int group)
+{
+	struct perf_event_attr attr;
+	std::memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.read_format = PERF_FORMAT_GROUP;
+	attr.disabled = (group < 0) ? 1 : 0;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return int(syscall(__NR_perf_event_open, &attr, 0, -1, group, 0));
+}
+
+} // anonymous namespace
+
+#endif
+
+
+//============================================================
+//  osd_perf_counters_open
+//============================================================
+
+bool osd_perf_counters_open()
+{
+#if defined(__linux__)
+	perf_group &group = t_perf_group;
+	if (group.count)
+		return true;
+
+	// there's no point without cycles and instructions; the others are optional
+	static std::uint64_t const s_configs[OSD_PERF_COUNTER_COUNT] = {
+			PERF_COUNT_HW_CPU_CYCLES,
+			PERF_COUNT_HW_INSTRUCTIONS,
+			PERF_COUNT_HW_CACHE_MISSES,
+			PERF_COUNT_HW_BRANCH_MISSES };
+	for (int counter = 0; counter < OSD_PERF_COUNTER_COUNT; counter++)
+	{
+		group.fd[counter] = perf_event_open(PERF_TYPE_HARDWARE, s_configs[counter], group.count ? group.fd[OSD_PERF_CYCLES] : -1);
+		if (group.fd[counter] >= 0)
+			group.slot[counter] = group.count++;
+		else if (counter <= OSD_PERF_INSTRUCTIONS)
+		{
+			osd_perf_counters_close();
+			return false;
+		}
+	}
+
+	ioctl(group.fd[OSD_PERF_CYCLES], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(group.fd[OSD_PERF_CYCLES], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	return true;
+#else
+	return false;
+#endif
+}
+
+
+//============================================================
+//  osd_perf_counters_read
+//============================================================
+
+bool osd_perf_counters_read(std::uint64_t *values)
+{
+#if defined(__linux__)
+	perf_group const &group = t_perf_group;
+	if (!group.count)
+		return false;
+
+	// a group read gives the number of events followed by their values
+	std::uint64_t buffer[1 + OSD_PERF_COUNTER_COUNT];
+	ssize_t const expected = sizeof(buffer[0]) * (1 + group.count);
+	if (read(group.fd[OSD_PERF_CYCLES], buffer, expected) != expected)
+		return false;
+	for (int counter = 0; counter < OSD_PERF_COUNTER_COUNT; counter++)
+		values[counter] = (group.slot[counter] >= 0) ? buffer[1 + group.slot[counter]] : 0;
+	return true;
+#else
+	return false;
+#endif
+}
+
+
+//============================================================
+//  osd_perf_counters_close
+//============================================================
+
+void osd_perf_counters_close()
+{
+#if defined(__linux__)
+	perf_group &group = t_perf_group;
+	for (int counter = OSD_PERF_COUNTER_COUNT - 1; counter >= 0; counter--)
+	{
+		if (group.fd[counter] >= 0)
+			close(group.fd[counter]);
+		group.fd[counter] = -1;
+		group.slot[counter] = -1;
+	}
+	group.count = 0;
+#endif
+}
+
+
 namespace osd {
 
 namespace {
@@ -226,6 +381,91 @@ bool virtual_memory_allocation::do_set_access(void *start, std::size_t size, uns
 	return mprotect(reinterpret_cast<char *>(start), size, prot) == 0;
 }
 
+void *large_memory_allocation::do_alloc(std::size_t size, std::size_t &actual, bool &large_pages)
+{
+	// huge pages are 2MB on the hosts we care about; round up so either mechanism can use them
+	std::size_t const huge(std::size_t(2) << 20);
+	std::size_t const s((size + huge - 1) & ~(huge - 1));
+	if (!s)
+		return nullptr;
+
+#if defined(MAP_HUGETLB)
+	// explicit huge pages only work if the administrator has reserved some
+	void *const hugetlb(mmap(nullptr, s, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0));
+	if (hugetlb != (void *)-1)
+	{
+		actual = s;
+		large_pages = true;
+		return hugetlb;
+	}
+#endif
+
+	// otherwise map an aligned block of ordinary pages and ask for transparent huge pages
+	char *const base(reinterpret_cast<char *>(mmap(nullptr, s + huge, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0)));
+	if (base == (char *)-1)
+		return nullptr;
+	std::size_t const head((huge - (reinterpret_cast<std::uintptr_t>(base) & (huge - 1))) & (huge - 1));
+	if (head)
+		munmap(base, head);
+	if (huge - head)
+		munmap(base + head + s, huge - head);
+	char *const result(base + head);
+#if defined(MADV_HUGEPAGE)
+	large_pages = madvise(result, s, MADV_HUGEPAGE) == 0;
+#else
+	large_pages = false;
+#endif
+	actual = s;
+	return result;
+}
+
+void large_memory_allocation::do_free(void *start, std::size_t size)
+{
+	munmap(reinterpret_cast<char *>(start), size);
+}
+
+void *file_mapping::do_map(std::string const &path, std::size_t size)
+{
+	if (!size)
+		return nullptr;
+	int const fd(::open(path.c_str(), O_RDONLY));
+	if (fd < 0)
+		return nullptr;
+
+	// a short file would fault on access past its end rather than read as zero
+	struct stat st;
+	void *result((fstat(fd, &st) == 0 && std::uint64_t(st.st_size) >= size)
+			? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0)
+			: (void *)-1);
+	::close(fd);
+	return (result == (void *)-1) ? nullptr : result;
+}
+
+void file_mapping::do_unmap(void *start, std::size_t size)
+{
+	munmap(reinterpret_cast<char *>(start), size);
+}
+
+void *shared_mapping::do_map(std::string const &path, std::size_t size)
+{
+	if (!size)
+		return nullptr;
+	int const fd(::open(path.c_str(), O_RDWR | O_CREAT, 0644));
+	if (fd < 0)
+		return nullptr;
+
+	void *result((ftruncate(fd, size) == 0)
+			? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+			: (void *)-1);
+	::close(fd);
+	return (result == (void *)-1) ? nullptr : result;
+}
+
+void shared_mapping::do_unmap(void *start, std::size_t size)
+{
+	munmap(reinterpret_cast<char *>(start), size);
+}
+
 
 dynamic_module::ptr dynamic_module::open(std::vector<std::string> &&names)
 {
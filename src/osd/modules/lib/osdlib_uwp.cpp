@@ -12,6 +12,7 @@
 #include "osdlib.h"
 #include "osdcomm.h"
 #include "osdcore.h"
+#include "osdfile.h"
 #include "strconv.h"
 
 #include <cstdio>
@@ -162,6 +163,58 @@ int osd_getpid()
 }
 
 
+//============================================================
+//  osd_get_peak_memory_usage
+//============================================================
+
+std::uint64_t osd_get_peak_memory_usage()
+{
+	// process memory counters aren't available to UWP applications
+	return 0;
+}
+
+
+//============================================================
+//  osd_get_process_cpu_time
+//============================================================
+
+double osd_get_process_cpu_time()
+{
+	// nor are process times
+	return 0.0;
+}
+
+
+//============================================================
+//  osd_perf_counters_open
+//============================================================
+
+bool osd_perf_counters_open()
+{
+	// nor are performance counters
+	return false;
+}
+
+
+//============================================================
+//  osd_perf_counters_read
+//============================================================
+
+bool osd_perf_counters_read(std::uint64_t *values)
+{
+	return false;
+}
+
+
+//============================================================
+//  osd_perf_counters_close
+//============================================================
+
+void osd_perf_counters_close()
+{
+}
+
+
 namespace osd {
 
 bool invalidate_instruction_cache(void const *start, std::size_t size)
@@ -204,4 +257,45 @@ bool virtual_memory_allocation::do_set_access(void *start, std::size_t size, uns
 	return VirtualProtectFromApp(start, size, p, &o) != 0;
 }
 
+void *large_memory_allocation::do_alloc(std::size_t size, std::size_t &actual, bool &large_pages)
+{
+	// store applications can't hold SeLockMemoryPrivilege, so this is always ordinary pages
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	SIZE_T const s((size + info.dwPageSize - 1) / info.dwPageSize * info.dwPageSize);
+	if (!s)
+		return nullptr;
+	LPVOID const result(VirtualAllocFromApp(nullptr, s, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+	if (result)
+	{
+		actual = s;
+		large_pages = false;
+	}
+	return result;
+}
+
+void large_memory_allocation::do_free(void *start, std::size_t size)
+{
+	VirtualFree(start, 0, MEM_RELEASE);
+}
+
+void *file_mapping::do_map(std::string const &path, std::size_t size)
+{
+	// store applications only get at files through brokered storage APIs
+	return nullptr;
+}
+
+void file_mapping::do_unmap(void *start, std::size_t size)
+{
+}
+
+void *shared_mapping::do_map(std::string const &path, std::size_t size)
+{
+	return nullptr;
+}
+
+void shared_mapping::do_unmap(void *start, std::size_t size)
+{
+}
+
 } // namespace osd
@@ -12,6 +12,7 @@
 #include "osdlib.h"
 #include "osdcomm.h"
 #include "osdcore.h"
+#include "osdfile.h"
 #include "strconv.h"
 
 #ifdef OSD_WINDOWS
@@ -23,6 +24,7 @@
 
 #include <windows.h>
 #include <memoryapi.h>
+#include <psapi.h>
 
 #ifndef _MSC_VER
 #include <unistd.h>
@@ -191,6 +193,66 @@ int osd_getpid()
 	return GetCurrentProcessId();
 }
 
+//============================================================
+//  osd_get_peak_memory_usage
+//============================================================
+
+std::uint64_t osd_get_peak_memory_usage()
+{
+	PROCESS_MEMORY_COUNTERS counters;
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+		return 0;
+	return std::uint64_t(counters.PeakWorkingSetSize);
+}
+
+//============================================================
+//  osd_get_process_cpu_time
+//============================================================
+
+double osd_get_process_cpu_time()
+{
+	// kernel and user times come in units of 100ns
+	FILETIME creation, exit, kernel, user;
+	if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+		return 0.0;
+	ULARGE_INTEGER k, u;
+	k.LowPart = kernel.dwLowDateTime;
+	k.HighPart = kernel.dwHighDateTime;
+	u.LowPart = user.dwLowDateTime;
+	u.HighPart = user.dwHighDateTime;
+	return double(k.QuadPart + u.QuadPart) / 10000000.0;
+}
+
+
+//============================================================
+//  osd_perf_counters_open
+//============================================================
+
+bool osd_perf_counters_open()
+{
+	// performance counters need a kernel driver on Windows
+	return false;
+}
+
+
+//============================================================
+//  osd_perf_counters_read
+//============================================================
+
+bool osd_perf_counters_read(std::uint64_t *values)
+{
+	return false;
+}
+
+
+//============================================================
+//  osd_perf_counters_close
+//============================================================
+
+void osd_perf_counters_close()
+{
+}
+
 //============================================================
 //  osd_dynamic_bind
 //============================================================
@@ -302,6 +364,112 @@ bool virtual_memory_allocation::do_set_access(void *start, std::size_t size, uns
 	return VirtualProtect(start, size, p, &o) != 0;
 }
 
+void *large_memory_allocation::do_alloc(std::size_t size, std::size_t &actual, bool &large_pages)
+{
+	// large pages need SeLockMemoryPrivilege granted to the user; try to enable it once
+	static bool const privileged = []
+	{
+		HANDLE token;
+		if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+			return false;
+		TOKEN_PRIVILEGES tp;
+		tp.PrivilegeCount = 1;
+		tp.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+		bool const result(LookupPrivilegeValue(nullptr, SE_LOCK_MEMORY_NAME, &tp.Privileges[0].Luid)
+				&& AdjustTokenPrivileges(token, FALSE, &tp, 0, nullptr, nullptr)
+				&& (GetLastError() == ERROR_SUCCESS));
+		CloseHandle(token);
+		return result;
+	}();
+
+	SIZE_T const large(privileged ? GetLargePageMinimum() : 0);
+	if (large)
+	{
+		SIZE_T const s((size + large - 1) / large * large);
+		LPVOID const result(s ? VirtualAlloc(nullptr, s, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE) : nullptr);
+		if (result)
+		{
+			actual = s;
+			large_pages = true;
+			return result;
+		}
+	}
+
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	SIZE_T const s((size + info.dwPageSize - 1) / info.dwPageSize * info.dwPageSize);
+	if (!s)
+		return nullptr;
+	LPVOID const result(VirtualAlloc(nullptr, s, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+	if (result)
+	{
+		actual = s;
+		large_pages = false;
+	}
+	return result;
+}
+
+void large_memory_allocation::do_free(void *start, std::size_t size)
+{
+	VirtualFree(start, 0, MEM_RELEASE);
+}
+
+void *file_mapping::do_map(std::string const &path, std::size_t size)
+{
+	if (!size)
+		return nullptr;
+	osd::text::tstring const t_path(osd::text::to_tstring(path));
+	HANDLE const file(CreateFile(t_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+	if (file == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	// a short file would fault on access past its end rather than read as zero
+	LARGE_INTEGER length;
+	LPVOID result(nullptr);
+	if (GetFileSizeEx(file, &length) && (std::uint64_t(length.QuadPart) >= size))
+	{
+		HANDLE const mapping(CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr));
+		if (mapping)
+		{
+			result = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+			CloseHandle(mapping);
+		}
+	}
+	CloseHandle(file);
+	return result;
+}
+
+void file_mapping::do_unmap(void *start, std::size_t size)
+{
+	UnmapViewOfFile(start);
+}
+
+void *shared_mapping::do_map(std::string const &path, std::size_t size)
+{
+	if (!size)
+		return nullptr;
+	osd::text::tstring const t_path(osd::text::to_tstring(path));
+	HANDLE const file(CreateFile(t_path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr));
+	if (file == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	// the mapping extends the file to the requested size
+	LPVOID result(nullptr);
+	HANDLE const mapping(CreateFileMapping(file, nullptr, PAGE_READWRITE, DWORD(std::uint64_t(size) >> 32), DWORD(size), nullptr));
+	if (mapping)
+	{
+		result = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size);
+		CloseHandle(mapping);
+	}
+	CloseHandle(file);
+	return result;
+}
+
+void shared_mapping::do_unmap(void *start, std::size_t size)
+{
+	UnmapViewOfFile(start);
+}
+
 
 dynamic_module::ptr dynamic_module::open(std::vector<std::string> &&names)
 {
@@ -157,6 +157,9 @@ const options_entry osd_options::s_option_entries[] =
 	{ OSDOPTION_BGFX_PATH,                    "bgfx",            OPTION_STRING, "path to BGFX-related files" },
 	{ OSDOPTION_BGFX_BACKEND,                 "auto",            OPTION_STRING, "BGFX backend to use (d3d9, d3d11, metal, opengl, gles)" },
 	{ OSDOPTION_BGFX_DEBUG,                   "0",               OPTION_BOOLEAN, "enable BGFX debugging statistics" },
+	{ OSDOPTION_BGFX_RENDER_THREAD,           "1",               OPTION_BOOLEAN, "render on a separate thread, with at most one frame queued behind emulation" },
+	{ OSDOPTION_BGFX_FRAME_LATENCY "(0-3)",   "1",               OPTION_INTEGER, "maximum number of frames the graphics driver may queue (0 for driver default; Direct3D 11/12 only)" },
+	{ OSDOPTION_BGFX_PROFILE,                 "0",               OPTION_BOOLEAN, "measure GPU time per screen chain and report it on exit" },
 	{ OSDOPTION_BGFX_SCREEN_CHAINS,           "default",         OPTION_STRING, "comma-delimited list of screen chain JSON names, colon-delimited per-window" },
 	{ OSDOPTION_BGFX_SHADOW_MASK,             "slot-mask.png",   OPTION_STRING, "shadow mask texture name" },
 	{ OSDOPTION_BGFX_LUT,                     "",                OPTION_STRING, "LUT texture name" },
@@ -559,6 +562,17 @@ void osd_common_t::set_mastervolume(int attenuation)
 }
 
 
+//-------------------------------------------------
+//  get_audio_status - report the state of the
+//  host audio buffer
+//-------------------------------------------------
+
+bool osd_common_t::get_audio_status(osd_audio_status &status)
+{
+	return (m_sound != nullptr) && m_sound->get_status(status);
+}
+
+
 //-------------------------------------------------
 //  customize_input_type_list - provide OSD
 //  additions/modifications to the input list
@@ -88,6 +88,9 @@
 #define OSDOPTION_BGFX_PATH             "bgfx_path"
 #define OSDOPTION_BGFX_BACKEND          "bgfx_backend"
 #define OSDOPTION_BGFX_DEBUG            "bgfx_debug"
+#define OSDOPTION_BGFX_RENDER_THREAD    "bgfx_render_thread"
+#define OSDOPTION_BGFX_FRAME_LATENCY    "bgfx_frame_latency"
+#define OSDOPTION_BGFX_PROFILE          "bgfx_profile"
 #define OSDOPTION_BGFX_SCREEN_CHAINS    "bgfx_screen_chains"
 #define OSDOPTION_BGFX_SHADOW_MASK      "bgfx_shadow_mask"
 #define OSDOPTION_BGFX_LUT              "bgfx_lut"
@@ -164,6 +167,9 @@ public:
 	const char *bgfx_path() const { return value(OSDOPTION_BGFX_PATH); }
 	const char *bgfx_backend() const { return value(OSDOPTION_BGFX_BACKEND); }
 	bool bgfx_debug() const { return bool_value(OSDOPTION_BGFX_DEBUG); }
+	bool bgfx_render_thread() const { return bool_value(OSDOPTION_BGFX_RENDER_THREAD); }
+	int bgfx_frame_latency() const { return int_value(OSDOPTION_BGFX_FRAME_LATENCY); }
+	bool bgfx_profile() const { return bool_value(OSDOPTION_BGFX_PROFILE); }
 	const char *bgfx_screen_chains() const { return value(OSDOPTION_BGFX_SCREEN_CHAINS); }
 	const char *bgfx_shadow_mask() const { return value(OSDOPTION_BGFX_SHADOW_MASK); }
 	const char *bgfx_lut() const { return value(OSDOPTION_BGFX_LUT); }
@@ -202,6 +208,7 @@ public:
 	// audio overridables
 	virtual void update_audio_stream(const int16_t *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual bool get_audio_status(osd_audio_status &status) override;
 	virtual bool no_sound() override;
 
 	// input overridables
@@ -35,6 +35,7 @@ typedef int (*pcap_setfilter_fn)(pcap_t *, struct bpf_program *);
 typedef int (*pcap_sendpacket_fn)(pcap_t *, const u_char *, int);
 typedef int (*pcap_set_datalink_fn)(pcap_t *, int);
 typedef int (*pcap_dispatch_fn)(pcap_t *, int, pcap_handler, u_char *);
+typedef int (*pcap_setnonblock_fn)(pcap_t *, int, char *);
 
 class pcap_module : public osd_module, public netdev_module
 {
@@ -42,7 +43,7 @@ public:
 	pcap_module()
 		: osd_module(OSD_NETDEV_PROVIDER, "pcap"), netdev_module(),
 		  pcap_findalldevs_dl(nullptr), pcap_open_live_dl(nullptr), pcap_next_ex_dl(nullptr), pcap_compile_dl(nullptr),
-		  pcap_close_dl(nullptr), pcap_setfilter_dl(nullptr), pcap_sendpacket_dl(nullptr), pcap_set_datalink_dl(nullptr), pcap_dispatch_dl(nullptr)
+		  pcap_close_dl(nullptr), pcap_setfilter_dl(nullptr), pcap_sendpacket_dl(nullptr), pcap_set_datalink_dl(nullptr), pcap_dispatch_dl(nullptr), pcap_setnonblock_dl(nullptr)
 	{
 	}
 
@@ -64,6 +65,7 @@ public:
 		pcap_sendpacket_dl = pcap_dll->bind<pcap_sendpacket_fn>("pcap_sendpacket");
 		pcap_set_datalink_dl = pcap_dll->bind<pcap_set_datalink_fn>("pcap_set_datalink");
 		pcap_dispatch_dl = pcap_dll->bind<pcap_dispatch_fn>("pcap_dispatch");
+		pcap_setnonblock_dl = pcap_dll->bind<pcap_setnonblock_fn>("pcap_setnonblock");
 
 		if (!pcap_findalldevs_dl || !pcap_open_live_dl    || !pcap_next_ex_dl   ||
 			!pcap_compile_dl     || !pcap_close_dl        || !pcap_setfilter_dl ||
@@ -87,6 +89,7 @@ public:
 	pcap_sendpacket_fn   pcap_sendpacket_dl;
 	pcap_set_datalink_fn pcap_set_datalink_dl;
 	pcap_dispatch_fn     pcap_dispatch_dl;
+	pcap_setnonblock_fn  pcap_setnonblock_dl; // optional
 };
 
 // FIXME: bridge between pcap_module and netdev_pcap
@@ -94,14 +97,13 @@ static pcap_module *module = nullptr;
 
 #ifdef SDLMAME_MACOSX
 struct netdev_pcap_context {
-	uint8_t *pkt;
-	int len;
 	pcap_t *p;
 
 	uint8_t packets[32][1600];
 	int packetlens[32];
 	int head;
 	int tail;
+	bool held;      // the tail packet was handed out and is released on the next receive
 };
 #endif
 
@@ -133,16 +135,18 @@ static void netdev_pcap_handler(u_char *user, const struct pcap_pkthdr *h, const
 		printf("buffer full, dropping packet\n");
 		return;
 	}
-	memcpy(ctx->packets[ctx->head], bytes, h->len);
-	ctx->packetlens[ctx->head] = h->len;
+	int const len = std::min<int>(h->caplen, sizeof(ctx->packets[0]));
+	memcpy(ctx->packets[ctx->head], bytes, len);
+	ctx->packetlens[ctx->head] = len;
 	OSAtomicCompareAndSwapInt(ctx->head, (ctx->head+1) & 0x1F, &ctx->head);
 }
 
 static void *netdev_pcap_blocker(void *arg) {
 	struct netdev_pcap_context *ctx = (struct netdev_pcap_context*)arg;
 
+	// take everything in the capture buffer each time it wakes up
 	while(ctx && ctx->p) {
-		(*module->pcap_dispatch_dl)(ctx->p, 1, netdev_pcap_handler, (u_char*)ctx);
+		(*module->pcap_dispatch_dl)(ctx->p, -1, netdev_pcap_handler, (u_char*)ctx);
 	}
 
 	return 0;
@@ -175,8 +179,14 @@ netdev_pcap::netdev_pcap(const char *name, class device_network_interface *ifdev
 #ifdef SDLMAME_MACOSX
 	m_ctx.head = 0;
 	m_ctx.tail = 0;
+	m_ctx.held = false;
 	m_ctx.p = m_p;
 	pthread_create(&m_thread, nullptr, netdev_pcap_blocker, &m_ctx);
+#else
+	// polls run from an emulation timer, so an empty capture buffer mustn't wait
+	// out the read timeout; packets are then read straight from libpcap's buffer
+	if (module->pcap_setnonblock_dl && (*module->pcap_setnonblock_dl)(m_p, 1, errbuf) == -1)
+		osd_printf_verbose("Unable to make %s non-blocking: %s\n", name, errbuf);
 #endif
 }
 
@@ -214,26 +224,28 @@ int netdev_pcap::send(uint8_t *buf, int len)
 int netdev_pcap::recv_dev(uint8_t **buf)
 {
 #ifdef SDLMAME_MACOSX
-	uint8_t pktbuf[2048];
-	int ret;
-
 	// no device open?
 	if(!m_p) return 0;
 
+	// the packet handed out last time has been consumed by now
+	if(m_ctx.held) {
+		OSAtomicCompareAndSwapInt(m_ctx.tail, (m_ctx.tail+1) & 0x1F, &m_ctx.tail);
+		m_ctx.held = false;
+	}
+
 	// Empty
 	if(OSAtomicCompareAndSwapInt(m_ctx.head, m_ctx.tail, &m_ctx.tail)) {
 		return 0;
 	}
 
-	memcpy(pktbuf, m_ctx.packets[m_ctx.tail], m_ctx.packetlens[m_ctx.tail]);
-	ret = m_ctx.packetlens[m_ctx.tail];
-	OSAtomicCompareAndSwapInt(m_ctx.tail, (m_ctx.tail+1) & 0x1F, &m_ctx.tail);
-	*buf = pktbuf;
-	return ret;
+	// hand out the ring slot itself rather than a copy
+	*buf = m_ctx.packets[m_ctx.tail];
+	m_ctx.held = true;
+	return m_ctx.packetlens[m_ctx.tail];
 #else
 	struct pcap_pkthdr *header;
 	if(!m_p) return 0;
-	return ((*module->pcap_next_ex_dl)(m_p, &header, (const u_char **)buf) == 1)?header->len:0;
+	return ((*module->pcap_next_ex_dl)(m_p, &header, (const u_char **)buf) == 1)?header->caplen:0;
 #endif
 }
 
@@ -38,6 +38,10 @@ bgfx_chain::bgfx_chain(std::string name, std::string author, bool transform, tar
 	, m_current_time(0)
 	, m_screen_index(screen_index)
 	, m_has_converter(false)
+	, m_first_view(0)
+	, m_view_count(0)
+	, m_gpu_time(0.0)
+	, m_gpu_frames(0)
 {
 	for (bgfx_target* target : m_target_list)
 	{
@@ -48,6 +52,11 @@ bgfx_chain::bgfx_chain(std::string name, std::string author, bool transform, tar
 
 bgfx_chain::~bgfx_chain()
 {
+	if (m_gpu_frames > 0)
+	{
+		osd_printf_info("BGFX: chain %s took %.3f ms of GPU time per frame over %u frames\n", m_name, m_gpu_time / m_gpu_frames, m_gpu_frames);
+	}
+
 	for (bgfx_slider* slider : m_sliders)
 	{
 		delete slider;
@@ -115,6 +124,8 @@ void bgfx_chain::process(chain_manager::screen_prim &prim, int view, int screen,
 			current_view++;
 		}
 	}
+	m_first_view = view;
+	m_view_count = current_view - view;
 
 	m_current_time = bx::getHPCounter();
 	static int64_t last = m_current_time;
@@ -130,6 +141,32 @@ void bgfx_chain::process(chain_manager::screen_prim &prim, int view, int screen,
 	}
 }
 
+void bgfx_chain::update_gpu_time(const bgfx::Stats& stats)
+{
+	if (m_view_count == 0 || stats.gpuTimerFreq == 0)
+	{
+		return;
+	}
+
+	int64_t ticks = 0;
+	bool seen = false;
+	for (uint16_t i = 0; i < stats.numViews; i++)
+	{
+		const bgfx::ViewStats& view_stats = stats.viewStats[i];
+		if (view_stats.view >= m_first_view && view_stats.view < m_first_view + m_view_count)
+		{
+			ticks += view_stats.gpuTimeEnd - view_stats.gpuTimeBegin;
+			seen = true;
+		}
+	}
+
+	if (seen)
+	{
+		m_gpu_time += double(ticks) * 1000.0 / double(stats.gpuTimerFreq);
+		m_gpu_frames++;
+	}
+}
+
 uint32_t bgfx_chain::applicable_passes()
 {
 	int applicable_passes = 0;
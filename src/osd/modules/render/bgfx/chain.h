@@ -32,6 +32,7 @@ public:
 
 	void process(chain_manager::screen_prim &prim, int view, int screen, texture_manager& textures, osd_window &window, uint64_t blend = 0L);
 	void repopulate_targets();
+	void update_gpu_time(const bgfx::Stats& stats);
 
 	// Getters
 	std::vector<bgfx_slider*>& sliders() { return m_sliders; }
@@ -61,6 +62,12 @@ private:
 	uint32_t                            m_screen_index;
 	bool                                m_has_converter;
 	bool                                m_has_adjuster;
+
+	// views used by the last process() call and the GPU time measured for them
+	uint32_t                            m_first_view;
+	uint32_t                            m_view_count;
+	double                              m_gpu_time;
+	uint32_t                            m_gpu_frames;
 };
 
 #endif // __DRAWBGFX_CHAIN__
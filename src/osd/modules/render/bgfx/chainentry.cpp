@@ -40,7 +40,26 @@ bgfx_chain_entry::bgfx_chain_entry(std::string name, bgfx_effect* effect, clear_
 	, m_targets(targets)
 	, m_output(output)
 	, m_apply_tint(apply_tint)
+	, m_screen_dims(effect->uniform("u_screen_dims"))
+	, m_inv_screen_dims(effect->uniform("u_inv_screen_dims"))
+	, m_screen_scale(effect->uniform("u_screen_scale"))
+	, m_screen_offset(effect->uniform("u_screen_offset"))
+	, m_screen_count(effect->uniform("u_screen_count"))
+	, m_source_dims(effect->uniform("u_source_dims"))
+	, m_target_dims(effect->uniform("u_target_dims"))
+	, m_target_scale(effect->uniform("u_target_scale"))
+	, m_rotation_type(effect->uniform("u_rotation_type"))
+	, m_swap_xy(effect->uniform("u_swap_xy"))
+	, m_quad_dims(effect->uniform("u_quad_dims"))
+	, m_screen_index(effect->uniform("u_screen_index"))
 {
+	for (bgfx_entry_uniform* uniform : m_uniforms)
+	{
+		if (uniform->name() != "s_tex")
+		{
+			m_bound_uniforms.push_back(uniform);
+		}
+	}
 }
 
 bgfx_chain_entry::~bgfx_chain_entry()
@@ -86,12 +105,9 @@ void bgfx_chain_entry::submit(int view, chain_manager::screen_prim &prim, textur
 
 	setup_auto_uniforms(prim, textures, screen_count, screen_width, screen_height, screen_scale_x, screen_scale_y, screen_offset_x, screen_offset_y, rotation_type, swap_xy, screen);
 
-	for (bgfx_entry_uniform* uniform : m_uniforms)
+	for (bgfx_entry_uniform* uniform : m_bound_uniforms)
 	{
-		if (uniform->name() != "s_tex")
-		{
-			uniform->bind();
-		}
+		uniform->bind();
 	}
 
 	m_effect->submit(view, blend);
@@ -113,125 +129,113 @@ void bgfx_chain_entry::setup_screensize_uniforms(texture_manager& textures, uint
 		height = float(textures.provider(name)->height());
 	}
 
-	bgfx_uniform* screen_dims = m_effect->uniform("u_screen_dims");
-	if (screen_dims != nullptr)
+	if (m_screen_dims != nullptr)
 	{
 		float values[2] = { width, height };
-		screen_dims->set(values, sizeof(float) * 2);
+		m_screen_dims->set(values, sizeof(float) * 2);
 	}
 
-	bgfx_uniform* inv_screen_dims = m_effect->uniform("u_inv_screen_dims");
-	if (inv_screen_dims != nullptr)
+	if (m_inv_screen_dims != nullptr)
 	{
 		float values[2] = { 1.0f / width, 1.0f / height };
-		inv_screen_dims->set(values, sizeof(float) * 2);
+		m_inv_screen_dims->set(values, sizeof(float) * 2);
 	}
 }
 
 void bgfx_chain_entry::setup_screenscale_uniforms(float screen_scale_x, float screen_scale_y)
 {
-	bgfx_uniform* screen_scale = m_effect->uniform("u_screen_scale");
-	if (screen_scale != nullptr)
+	if (m_screen_scale != nullptr)
 	{
 		float values[2] = { screen_scale_x, screen_scale_y };
-		screen_scale->set(values, sizeof(float) * 2);
+		m_screen_scale->set(values, sizeof(float) * 2);
 	}
 }
 
 void bgfx_chain_entry::setup_screenoffset_uniforms(float screen_offset_x, float screen_offset_y)
 {
-	bgfx_uniform* screen_offset = m_effect->uniform("u_screen_offset");
-	if (screen_offset != nullptr)
+	if (m_screen_offset != nullptr)
 	{
 		float values[2] = { screen_offset_x, screen_offset_y };
-		screen_offset->set(values, sizeof(float) * 2);
+		m_screen_offset->set(values, sizeof(float) * 2);
 	}
 }
 
 void bgfx_chain_entry::setup_screencount_uniforms(uint16_t screen_count)
 {
-	bgfx_uniform* u_screen_count = m_effect->uniform("u_screen_count");
-	if (u_screen_count != nullptr)
+	if (m_screen_count != nullptr)
 	{
 		float values[1] = { float(screen_count) };
-		u_screen_count->set(values, sizeof(float));
+		m_screen_count->set(values, sizeof(float));
 	}
 }
 
 void bgfx_chain_entry::setup_sourcesize_uniform(chain_manager::screen_prim &prim) const
 {
-	bgfx_uniform* source_dims = m_effect->uniform("u_source_dims");
-	if (source_dims != nullptr)
+	if (m_source_dims != nullptr)
 	{
-		source_dims->set(&prim.m_tex_width, sizeof(float) * 2);
+		m_source_dims->set(&prim.m_tex_width, sizeof(float) * 2);
 	}
 }
 
 void bgfx_chain_entry::setup_targetsize_uniform(int32_t screen) const
 {
-	bgfx_uniform* target_dims = m_effect->uniform("u_target_dims");
-	if (target_dims != nullptr)
+	if (m_target_dims != nullptr)
 	{
 		bgfx_target* output = m_targets.target(screen, m_output);
 		if (output != nullptr)
 		{
 			float values[2] = { float(output->width()), float(output->height()) };
-			target_dims->set(values, sizeof(float) * 2);
+			m_target_dims->set(values, sizeof(float) * 2);
 		}
 	}
 }
 
 void bgfx_chain_entry::setup_targetscale_uniform(int32_t screen) const
 {
-	bgfx_uniform* target_scale = m_effect->uniform("u_target_scale");
-	if (target_scale != nullptr)
+	if (m_target_scale != nullptr)
 	{
 		bgfx_target* output = m_targets.target(screen, m_output);
 		if (output != nullptr)
 		{
 			float values[2] = { float(output->scale()), float(output->scale()) };
-			target_scale->set(values, sizeof(float) * 2);
+			m_target_scale->set(values, sizeof(float) * 2);
 		}
 	}
 }
 
 void bgfx_chain_entry::setup_rotationtype_uniform(uint32_t rotation_type) const
 {
-	bgfx_uniform* rotation_type_uniform = m_effect->uniform("u_rotation_type");
-	if (rotation_type_uniform != nullptr)
+	if (m_rotation_type != nullptr)
 	{
 		float values[1] = { float(rotation_type) };
-		rotation_type_uniform->set(values, sizeof(float));
+		m_rotation_type->set(values, sizeof(float));
 	}
 }
 
 void bgfx_chain_entry::setup_swapxy_uniform(bool swap_xy) const
 {
-	bgfx_uniform* swap_xy_uniform = m_effect->uniform("u_swap_xy");
-	if (swap_xy_uniform != nullptr)
+	if (m_swap_xy != nullptr)
 	{
 		float values[1] = { swap_xy ? 1.0f : 0.0f };
-		swap_xy_uniform->set(values, sizeof(float));
+		m_swap_xy->set(values, sizeof(float));
 	}
 }
 
 void bgfx_chain_entry::setup_quaddims_uniform(chain_manager::screen_prim &prim) const
 {
-	bgfx_uniform* quad_dims_uniform = m_effect->uniform("u_quad_dims");
-	if (quad_dims_uniform != nullptr)
+	if (m_quad_dims != nullptr)
 	{
 		float values[2] = { float(prim.m_quad_width), float(prim.m_quad_height) };
-		quad_dims_uniform->set(values, sizeof(float) * 2);
+		m_quad_dims->set(values, sizeof(float) * 2);
 	}
 }
 
 void bgfx_chain_entry::setup_screenindex_uniform(int32_t screen) const
 {
-	bgfx_uniform* screen_index = m_effect->uniform("u_screen_index");
-	if (screen_index != nullptr)
+	if (m_screen_index != nullptr)
 	{
 		float values[1] = { float(screen) };
-		screen_index->set(values, sizeof(float));
+		m_screen_index->set(values, sizeof(float));
 	}
 }
 
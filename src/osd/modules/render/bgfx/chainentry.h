@@ -26,6 +26,7 @@
 class bgfx_effect;
 class bgfx_target;
 class bgfx_entry_uniform;
+class bgfx_uniform;
 class bgfx_suppressor;
 class clear_state;
 class texture_manager;
@@ -70,6 +71,21 @@ private:
 	target_manager&                     m_targets;
 	std::string                         m_output;
 	bool                                m_apply_tint;
+
+	// resolved once from the effect so submitting doesn't look uniforms up by name
+	std::vector<bgfx_entry_uniform*>    m_bound_uniforms;
+	bgfx_uniform*                       m_screen_dims;
+	bgfx_uniform*                       m_inv_screen_dims;
+	bgfx_uniform*                       m_screen_scale;
+	bgfx_uniform*                       m_screen_offset;
+	bgfx_uniform*                       m_screen_count;
+	bgfx_uniform*                       m_source_dims;
+	bgfx_uniform*                       m_target_dims;
+	bgfx_uniform*                       m_target_scale;
+	bgfx_uniform*                       m_rotation_type;
+	bgfx_uniform*                       m_swap_xy;
+	bgfx_uniform*                       m_quad_dims;
+	bgfx_uniform*                       m_screen_index;
 };
 
 #endif // __DRAWBGFX_CHAIN_ENTRY__
@@ -462,10 +462,13 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 			}
 		}
 
+		// screen textures point straight at the screen device's bitmaps,
+		// which are double-buffered and outlive a resize by a few frames,
+		// so hand them to bgfx by reference rather than copying each frame
 		bgfx::TextureFormat::Enum dst_format = bgfx::TextureFormat::RGBA8;
 		uint16_t pitch = prim.m_rowpixels;
 		const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
-			prim.m_rowpixels, tex_height, prim.m_prim->texture.palette, prim.m_prim->texture.base, &pitch);
+			prim.m_rowpixels, tex_height, prim.m_prim->texture.palette, prim.m_prim->texture.base, &pitch, true);
 
 		if (texture == nullptr)
 		{
@@ -587,6 +590,18 @@ uint32_t chain_manager::process_screen_chains(uint32_t view, osd_window& window)
 	return used_views;
 }
 
+void chain_manager::update_gpu_times()
+{
+	const bgfx::Stats* stats = bgfx::getStats();
+	for (bgfx_chain* chain : m_screen_chains)
+	{
+		if (chain != nullptr)
+		{
+			chain->update_gpu_time(*stats);
+		}
+	}
+}
+
 bool chain_manager::has_applicable_chain(uint32_t screen)
 {
 	return screen < m_screen_count && m_current_chain[screen] != CHAIN_NONE && m_screen_chains[screen] != nullptr;
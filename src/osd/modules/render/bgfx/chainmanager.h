@@ -54,6 +54,7 @@ public:
 
 	uint32_t update_screen_textures(uint32_t view, render_primitive *starting_prim, osd_window& window);
 	uint32_t process_screen_chains(uint32_t view, osd_window& window);
+	void update_gpu_times();
 
 	// Getters
 	running_machine& machine() const { return m_machine; }
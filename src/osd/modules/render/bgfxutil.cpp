@@ -14,7 +14,7 @@
 #include "render.h"
 
 
-const bgfx::Memory* bgfx_util::mame_texture_data_to_bgfx_texture_data(bgfx::TextureFormat::Enum &dst_format, uint32_t src_format, int rowpixels, int height, const rgb_t *palette, void *base, uint16_t *out_pitch)
+const bgfx::Memory* bgfx_util::mame_texture_data_to_bgfx_texture_data(bgfx::TextureFormat::Enum &dst_format, uint32_t src_format, int rowpixels, int height, const rgb_t *palette, void *base, uint16_t *out_pitch, bool reference)
 {
 	bgfx::TextureInfo info;
 	switch (src_format)
@@ -33,6 +33,11 @@ const bgfx::Memory* bgfx_util::mame_texture_data_to_bgfx_texture_data(bgfx::Text
 			break;
 	}
 	bgfx::calcTextureSize(info, rowpixels, height, 1, false, false, 1, dst_format);
+
+	// a reference avoids a full-frame copy, but the caller must keep the
+	// memory alive and unmodified until bgfx has consumed it two frames on
+	if (reference)
+		return bgfx::makeRef(base, info.storageSize);
 	return bgfx::copy(base, info.storageSize);
 }
 
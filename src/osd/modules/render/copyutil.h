@@ -17,10 +17,12 @@ class copy_util
 public:
 	static inline void copyline_palette16(uint32_t *dst, const uint16_t *src, int width, const rgb_t *palette)
 	{
+		// indexed loop with a plain mask-and-shift swizzle so the compiler
+		// can turn the lookup into a gather where the target has one
 		for (int x = 0; x < width; x++)
 		{
-			rgb_t srcpixel = palette[*src++];
-			*dst++ = 0xff000000 | (srcpixel.b() << 16) | (srcpixel.g() << 8) | srcpixel.r();
+			uint32_t const srcpixel = palette[src[x]];
+			dst[x] = 0xff000000 | ((srcpixel & 0x000000ff) << 16) | (srcpixel & 0x0000ff00) | ((srcpixel >> 16) & 0x000000ff);
 		}
 	}
 
@@ -302,10 +302,19 @@ int renderer_bgfx::create()
 		{
 			printf("Unknown backend type '%s', going with auto-detection\n", backend.c_str());
 		}
+		init.resolution.maxFrameLatency = std::clamp(m_options.bgfx_frame_latency(), 0, 3);
+
+		// bgfx renders on its own thread unless a frame is rendered before initialization;
+		// bgfx::frame() then only waits for the previous frame, so one frame can be queued
+		if (!m_options.bgfx_render_thread())
+		{
+			bgfx::renderFrame();
+		}
+
 		bgfx::init(init);
 		bgfx::reset(m_width[win->index()], m_height[win->index()], video_config.waitvsync ? BGFX_RESET_VSYNC : BGFX_RESET_NONE);
-		// Enable debug text.
-		bgfx::setDebug(m_options.bgfx_debug() ? BGFX_DEBUG_STATS : BGFX_DEBUG_TEXT);
+		// Enable debug text, and per-view GPU timing if chains are being profiled
+		bgfx::setDebug((m_options.bgfx_debug() ? BGFX_DEBUG_STATS : BGFX_DEBUG_TEXT) | (m_options.bgfx_profile() ? BGFX_DEBUG_PROFILER : 0));
 		m_dimensions = osd_dim(m_width[0], m_height[0]);
 	}
 
@@ -857,6 +866,12 @@ int renderer_bgfx::draw(int update)
 		s_current_view = 0;
 	}
 
+	// pick up the GPU time of the chains' views from the last frame bgfx rendered
+	if (m_options.bgfx_profile())
+	{
+		m_chains->update_gpu_times();
+	}
+
 	win->m_primlist->acquire_lock();
 	uint32_t num_screens = m_chains->update_screen_textures(s_current_view, win->m_primlist->first(), *win.get());
 	win->m_primlist->release_lock();
@@ -16,6 +16,8 @@
 
 renderer_gdi::~renderer_gdi()
 {
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
 }
 
 //============================================================
@@ -24,6 +26,8 @@ renderer_gdi::~renderer_gdi()
 
 int renderer_gdi::create()
 {
+	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	// fill in the bitmap info header
 	m_bminfo.bmiHeader.biSize            = sizeof(m_bminfo.bmiHeader);
 	m_bminfo.bmiHeader.biPlanes          = 1;
@@ -86,7 +90,7 @@ int renderer_gdi::draw(const int update)
 
 	// draw the primitives to the bitmap
 	win->m_primlist->acquire_lock();
-	software_renderer<uint32_t, 0,0,0, 16,8,0>::draw_primitives(*win->m_primlist, m_bmdata.get(), width, height, pitch);
+	software_renderer<uint32_t, 0,0,0, 16,8,0>::draw_primitives(*win->m_primlist, m_bmdata.get(), width, height, pitch, m_work_queue);
 	win->m_primlist->release_lock();
 
 	// fill in bitmap-specific info
@@ -32,6 +32,7 @@ public:
 		: osd_renderer(window, FLAG_NONE)
 		, m_bmdata(nullptr)
 		, m_bmsize(0)
+		, m_work_queue(nullptr)
 	{
 	}
 	virtual ~renderer_gdi();
@@ -50,6 +51,7 @@ private:
 	BITMAPINFO                  m_bminfo;
 	std::unique_ptr<uint8_t []> m_bmdata;
 	size_t                      m_bmsize;
+	osd_work_queue *            m_work_queue;   // for rasterising bands of the bitmap in parallel
 };
 
 #endif // MAME_OSD_MODULES_RENDER_DRAWGDI_H
@@ -2097,12 +2097,23 @@ static inline void copyline_palette16(uint32_t *dst, const uint16_t *src, int wi
 	assert(xborderpix == 0 || xborderpix == 1);
 	if (xborderpix)
 		*dst++ = 0xff000000 | palette[*src];
-	for (x = 0; x < width; x++)
+	if (xprescale == 1)
 	{
-		int srcpix = *src++;
-		uint32_t dstval = 0xff000000 | palette[srcpix];
-		for (int x2 = 0; x2 < xprescale; x2++)
-			*dst++ = dstval;
+		// the common unscaled case is a straight lookup the compiler can vectorise
+		for (x = 0; x < width; x++)
+			dst[x] = 0xff000000 | palette[src[x]];
+		dst += width;
+		src += width;
+	}
+	else
+	{
+		for (x = 0; x < width; x++)
+		{
+			int srcpix = *src++;
+			uint32_t dstval = 0xff000000 | palette[srcpix];
+			for (int x2 = 0; x2 < xprescale; x2++)
+				*dst++ = dstval;
+		}
 	}
 	if (xborderpix)
 		*dst++ = 0xff000000 | palette[*--src];
@@ -240,6 +240,8 @@ int renderer_sdl1::create()
 	m_yuv_lookup = nullptr;
 	m_blittimer = 0;
 
+	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	yuv_init();
 	osd_printf_verbose("Leave renderer_sdl2::create\n");
 	return 0;
@@ -253,6 +255,9 @@ renderer_sdl1::~renderer_sdl1()
 {
 	destroy_all_textures();
 
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
+
 	SDL_DestroyRenderer(m_sdl_renderer);
 }
 
@@ -402,27 +407,27 @@ int renderer_sdl1::draw(int update)
 		switch (rmask)
 		{
 			case 0xff000000:
-				software_renderer<uint32_t, 0,0,0, 24,16,8>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				software_renderer<uint32_t, 0,0,0, 24,16,8>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 4, m_work_queue);
 				break;
 
 			case 0x0000ff00:
-				software_renderer<uint32_t, 0,0,0, 8,16,24>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				software_renderer<uint32_t, 0,0,0, 8,16,24>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 4, m_work_queue);
 				break;
 
 			case 0x00ff0000:
-				software_renderer<uint32_t, 0,0,0, 16,8,0>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				software_renderer<uint32_t, 0,0,0, 16,8,0>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 4, m_work_queue);
 				break;
 
 			case 0x000000ff:
-				software_renderer<uint32_t, 0,0,0, 0,8,16>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				software_renderer<uint32_t, 0,0,0, 0,8,16>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 4, m_work_queue);
 				break;
 
 			case 0xf800:
-				software_renderer<uint16_t, 3,2,3, 11,5,0>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 2);
+				software_renderer<uint16_t, 3,2,3, 11,5,0>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 2, m_work_queue);
 				break;
 
 			case 0x7c00:
-				software_renderer<uint16_t, 3,3,3, 10,5,0>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 2);
+				software_renderer<uint16_t, 3,3,3, 10,5,0>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 2, m_work_queue);
 				break;
 
 			default:
@@ -434,7 +439,7 @@ int renderer_sdl1::draw(int update)
 	{
 		assert (m_yuv_bitmap != nullptr);
 		assert (surfptr != nullptr);
-		software_renderer<uint16_t, 3,3,3, 10,5,0>::draw_primitives(*win->m_primlist, m_yuv_bitmap.get(), mamewidth, mameheight, mamewidth);
+		software_renderer<uint16_t, 3,3,3, 10,5,0>::draw_primitives(*win->m_primlist, m_yuv_bitmap.get(), mamewidth, mameheight, mamewidth, m_work_queue);
 		sm->yuv_blit(m_yuv_bitmap.get(), surfptr, pitch, m_yuv_lookup.get(), mamewidth, mameheight);
 	}
 
@@ -34,6 +34,7 @@ public:
 		, m_last_vofs(0)
 		, m_blit_dim(0, 0)
 		, m_last_dim(0, 0)
+		, m_work_queue(nullptr)
 	{
 	}
 	virtual ~renderer_sdl1();
@@ -71,6 +72,9 @@ private:
 	int                 m_last_vofs;
 	osd_dim             m_blit_dim;
 	osd_dim             m_last_dim;
+
+	// bands of the target are rasterised in parallel on this queue
+	osd_work_queue *    m_work_queue;
 };
 
 struct sdl_scale_mode
@@ -66,6 +66,7 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, int16_t const *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual bool get_status(osd_audio_status &status) const override;
 
 private:
 	struct node_detail
@@ -325,6 +326,19 @@ void sound_coreaudio::set_mastervolume(int attenuation)
 }
 
 
+bool sound_coreaudio::get_status(osd_audio_status &status) const
+{
+	if (!m_buffer)
+		return false;
+
+	status.underflows = m_underflows;
+	status.overflows = m_overflows;
+	status.buffered = buffer_used() / m_sample_bytes;
+	status.capacity = m_buffer_size / m_sample_bytes;
+	return true;
+}
+
+
 bool sound_coreaudio::create_graph(osd_options const &options)
 {
 	OSStatus err;
@@ -68,6 +68,7 @@ public:
 	// sound_module
 	virtual void update_audio_stream(bool is_throttled, int16_t const *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual bool get_status(osd_audio_status &status) const override;
 
 private:
 	class buffer
@@ -372,6 +373,23 @@ void sound_direct_sound::set_mastervolume(int attenuation)
 }
 
 
+//============================================================
+//  get_status
+//============================================================
+
+bool sound_direct_sound::get_status(osd_audio_status &status) const
+{
+	if (!m_stream_buffer)
+		return false;
+
+	// the fill level would need a round trip to the play cursor, so leave it unknown
+	status.underflows = m_buffer_underflows;
+	status.overflows = m_buffer_overflows;
+	status.capacity = 0;
+	return true;
+}
+
+
 //============================================================
 //  dsound_init
 //============================================================
@@ -23,6 +23,7 @@
 #include "../../sdl/osdsdl.h"
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <memory>
 
@@ -46,7 +47,7 @@ public:
 	sound_sdl() :
 		osd_module(OSD_SOUND_PROVIDER, "sdl"), sound_module(),
 		stream_in_initialized(0),
-		attenuation(0), buf_locked(0), stream_buffer(nullptr), stream_buffer_size(0), buffer_underflows(0), buffer_overflows(0)
+		attenuation(0), stream_buffer(nullptr), stream_buffer_size(0), buffer_underflows(0), buffer_overflows(0)
 {
 		sdl_xfer_samples = SDL_XFER_SAMPLES;
 	}
@@ -59,28 +60,29 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual bool get_status(osd_audio_status &status) const override;
 
 private:
+	// single producer (emulation thread), single consumer (SDL audio thread);
+	// each side only writes its own index, so no lock is needed
 	class ring_buffer
 	{
 	public:
 		ring_buffer(size_t size);
 
-		size_t data_size() const { return (tail - head + buffer_size) % buffer_size; }
-		size_t free_size() const { return (head - tail - 1 + buffer_size) % buffer_size; }
+		size_t data_size() const { return (tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire) + buffer_size) % buffer_size; }
+		size_t free_size() const { return (head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire) - 1 + buffer_size) % buffer_size; }
 		int append(const void *data, size_t size);
 		int pop(void *data, size_t size);
 
 	private:
 		std::unique_ptr<int8_t []> const buffer;
 		size_t const buffer_size;
-		int head = 0, tail = 0;
+		std::atomic<size_t> head = 0, tail = 0;
 	};
 
 	static void sdl_callback(void *userdata, Uint8 *stream, int len);
 
-	void lock_buffer();
-	void unlock_buffer();
 	void attenuate(int16_t *data, int bytes);
 	void copy_sample_data(bool is_throttled, const int16_t *data, int bytes_to_copy);
 	int sdl_create_buffers();
@@ -90,13 +92,12 @@ private:
 	int stream_in_initialized;
 	int attenuation;
 
-	int              buf_locked;
 	std::unique_ptr<ring_buffer> stream_buffer;
 	uint32_t         stream_buffer_size;
 
 
-	// diagnostics
-	int              buffer_underflows;
+	// diagnostics; underflows are counted on the SDL audio thread
+	std::atomic<int> buffer_underflows;
 	int              buffer_overflows;
 	std::unique_ptr<std::ofstream> sound_log;
 };
@@ -131,15 +132,18 @@ int sound_sdl::ring_buffer::append(const void *data, size_t size)
 	if (free_size() < size)
 		return -1;
 
+	size_t const start = tail.load(std::memory_order_relaxed);
 	int8_t const *const data8 = reinterpret_cast<int8_t const *>(data);
-	size_t sz = buffer_size - tail;
+	size_t sz = buffer_size - start;
 	if (size <= sz)
 		sz = size;
 	else
 		std::copy_n(&data8[sz], size - sz, &buffer[0]);
 
-	std::copy_n(data8, sz, &buffer[tail]);
-	tail = (tail + size) % buffer_size;
+	std::copy_n(data8, sz, &buffer[start]);
+
+	// publish the data to the consumer
+	tail.store((start + size) % buffer_size, std::memory_order_release);
 
 	return 0;
 }
@@ -153,8 +157,9 @@ int sound_sdl::ring_buffer::pop(void *data, size_t size)
 	if (data_size() < size)
 		return -1;
 
+	size_t const start = head.load(std::memory_order_relaxed);
 	int8_t *const data8 = reinterpret_cast<int8_t *>(data);
-	size_t sz = buffer_size - head;
+	size_t sz = buffer_size - start;
 	if (size <= sz)
 		sz = size;
 	else
@@ -163,9 +168,11 @@ int sound_sdl::ring_buffer::pop(void *data, size_t size)
 		std::fill_n(&buffer[0], size - sz, 0);
 	}
 
-	std::copy_n(&buffer[head], sz, data8);
-	std::fill_n(&buffer[head], sz, 0);
-	head = (head + size) % buffer_size;
+	std::copy_n(&buffer[start], sz, data8);
+	std::fill_n(&buffer[start], sz, 0);
+
+	// hand the space back to the producer
+	head.store((start + size) % buffer_size, std::memory_order_release);
 
 	return 0;
 }
@@ -174,33 +181,6 @@ int sound_sdl::ring_buffer::pop(void *data, size_t size)
 //  sound_sdl - destructor
 //============================================================
 
-//============================================================
-//  lock_buffer
-//============================================================
-void sound_sdl::lock_buffer()
-{
-	if (!buf_locked)
-		SDL_LockAudio();
-	buf_locked++;
-
-	if (LOG_SOUND)
-		*sound_log << "locking\n";
-}
-
-//============================================================
-//  unlock_buffer
-//============================================================
-void sound_sdl::unlock_buffer()
-{
-	buf_locked--;
-	if (!buf_locked)
-		SDL_UnlockAudio();
-
-	if (LOG_SOUND)
-		*sound_log << "unlocking\n";
-
-}
-
 //============================================================
 //  Apply attenuation
 //============================================================
@@ -223,9 +203,8 @@ void sound_sdl::attenuate(int16_t *data, int bytes_to_copy)
 
 void sound_sdl::copy_sample_data(bool is_throttled, const int16_t *data, int bytes_to_copy)
 {
-	lock_buffer();
+	// the ring buffer is safe against the callback without taking the SDL audio lock
 	int const err = stream_buffer->append(data, bytes_to_copy);
-	unlock_buffer();
 
 	if (LOG_SOUND && err)
 		*sound_log << "Late detection of overflow. This shouldn't happen.\n";
@@ -295,6 +274,22 @@ void sound_sdl::set_mastervolume(int _attenuation)
 	}
 }
 
+//============================================================
+//  get_status
+//============================================================
+
+bool sound_sdl::get_status(osd_audio_status &status) const
+{
+	if (!stream_buffer)
+		return false;
+
+	status.underflows = buffer_underflows.load(std::memory_order_relaxed);
+	status.overflows = buffer_overflows;
+	status.buffered = stream_buffer->data_size() / 4;
+	status.capacity = stream_buffer_size / 4;
+	return true;
+}
+
 //============================================================
 //  sdl_callback
 //============================================================
@@ -443,7 +438,6 @@ int sound_sdl::sdl_create_buffers()
 	osd_printf_verbose("sdl_create_buffers: creating stream buffer of %u bytes\n", stream_buffer_size);
 
 	stream_buffer = std::make_unique<ring_buffer>(stream_buffer_size);
-	buf_locked = 0;
 	return 0;
 }
 
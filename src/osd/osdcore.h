@@ -17,6 +17,7 @@
 #include "strformat.h"
 
 #include <cstdarg>
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 #include <string>
@@ -39,6 +40,57 @@ const char *osd_getenv(const char *name);
 int osd_getpid();
 
 
+/// \brief Get peak memory usage
+///
+/// \return The largest resident set size the current process has
+///   reached so far in bytes, or zero if it can't be determined.
+std::uint64_t osd_get_peak_memory_usage();
+
+
+/// \brief Get processor time used
+///
+/// \return The user and system processor time the current process
+///   has used so far in seconds, or zero if it can't be determined.
+double osd_get_process_cpu_time();
+
+
+/// \brief Hardware performance counters
+///
+/// Events counted for the calling thread by
+/// osd_perf_counters_read.
+enum osd_perf_counter
+{
+	OSD_PERF_CYCLES,            ///< Host processor cycles
+	OSD_PERF_INSTRUCTIONS,      ///< Host instructions retired
+	OSD_PERF_CACHE_MISSES,      ///< Last-level cache misses
+	OSD_PERF_BRANCH_MISSES,     ///< Mispredicted branches
+	OSD_PERF_COUNTER_COUNT
+};
+
+
+/// \brief Start counting hardware events for the calling thread
+///
+/// Does nothing if the calling thread is already counting.
+/// \return True if the calling thread is counting events, or false
+///   if the host doesn't support it or access is denied.
+bool osd_perf_counters_open();
+
+
+/// \brief Read hardware event counts for the calling thread
+///
+/// \param [out] values Receives OSD_PERF_COUNTER_COUNT counts
+///   indexed by osd_perf_counter.  Counts only mean anything relative
+///   to earlier reads on the same thread, and events the host can't
+///   count read as zero.
+/// \return True if the counts were read, or false if the calling
+///   thread isn't counting events.
+bool osd_perf_counters_read(std::uint64_t *values);
+
+
+/// \brief Stop counting hardware events for the calling thread
+void osd_perf_counters_close();
+
+
 /*-----------------------------------------------------------------------------
     osd_uchar_from_osdchar: convert the given character or sequence of
         characters from the OS-default encoding to a Unicode character
@@ -176,7 +228,8 @@ typedef void *(*osd_work_callback)(void *param, int threadid);
             WORK_QUEUE_FLAG_HIGH_FREQ - indicates that items are expected
                 to be queued at high frequency and acted upon quickly; in
                 general, this implies doing some spin-waiting internally
-                before falling back to OS-specific synchronization
+                before falling back to OS-specific synchronization, for as
+                long as spinning keeps finding work
 
     Return value:
 
@@ -337,6 +390,89 @@ void *osd_work_item_result(osd_work_item *item);
 void osd_work_item_release(osd_work_item *item);
 
 
+/* osd_work_profile_callback receives the host time spent running a work item */
+typedef void (*osd_work_profile_callback)(const char *thread, osd_ticks_t start, osd_ticks_t end);
+
+/*-----------------------------------------------------------------------------
+    osd_work_set_profile_callback: time every work item that runs
+
+    Parameters:
+
+        callback - function called on the thread that ran each work item
+            after it completes, or nullptr to stop timing
+
+    Return value:
+
+        None.
+
+    Notes:
+
+        The thread parameter names the pool or I/O thread that ran the
+        item, or is nullptr when a waiting thread ran it itself.  The
+        callback may be called on several threads at once.
+-----------------------------------------------------------------------------*/
+void osd_work_set_profile_callback(osd_work_profile_callback callback);
+
+
+
+/***************************************************************************
+    MEMORY INTERFACES
+***************************************************************************/
+
+namespace osd {
+
+/*-----------------------------------------------------------------------------
+    large_memory_allocation: zero-filled read/write memory for large
+    emulated RAM blocks
+
+    Notes:
+
+        - Backed by huge/large pages where the host allows it, which
+          cuts TLB misses on random access to hundreds of megabytes
+        - Falls back to ordinary pages otherwise; large_pages() reports
+          which one the host actually gave us
+-----------------------------------------------------------------------------*/
+
+class large_memory_allocation
+{
+public:
+	large_memory_allocation(large_memory_allocation const &) = delete;
+	large_memory_allocation &operator=(large_memory_allocation const &) = delete;
+
+	large_memory_allocation() { }
+	large_memory_allocation(std::size_t size)
+	{
+		m_memory = do_alloc(size, m_size, m_large_pages);
+	}
+	large_memory_allocation(large_memory_allocation &&that) : m_memory(that.m_memory), m_size(that.m_size), m_large_pages(that.m_large_pages)
+	{
+		that.m_memory = nullptr;
+		that.m_size = 0U;
+		that.m_large_pages = false;
+	}
+	~large_memory_allocation()
+	{
+		if (m_memory)
+			do_free(m_memory, m_size);
+	}
+
+	explicit operator bool() const { return bool(m_memory); }
+	void *get() { return m_memory; }
+	std::size_t size() const { return m_size; }
+	bool large_pages() const { return m_large_pages; }
+
+private:
+	static void *do_alloc(std::size_t size, std::size_t &actual, bool &large_pages);
+	static void do_free(void *start, std::size_t size);
+
+	void *m_memory = nullptr;
+	std::size_t m_size = 0U;
+	bool m_large_pages = false;
+};
+
+} // namespace osd
+
+
 
 /***************************************************************************
     MISCELLANEOUS INTERFACES
@@ -53,6 +53,18 @@ public:
 	virtual bool get_bitmap(char32_t chnum, bitmap_argb32 &bitmap, std::int32_t &width, std::int32_t &xoffs, std::int32_t &yoffs) = 0;
 };
 
+// ======================> osd_audio_status
+
+// state of the host audio buffer; the counts are running totals
+struct osd_audio_status
+{
+	uint32_t underflows = 0;            // times the device ran out of data
+	uint32_t overflows = 0;             // times submitted samples were dropped
+	uint32_t buffered = 0;              // stereo samples waiting to be played
+	uint32_t capacity = 0;              // buffer size in stereo samples, or 0 if unknown
+};
+
+
 // ======================> osd_interface
 
 // description of the currently-running machine
@@ -74,6 +86,7 @@ public:
 	virtual void update_audio_stream(const int16_t *buffer, int samples_this_frame) = 0;
 	virtual void set_mastervolume(int attenuation) = 0;
 	virtual bool no_sound() = 0;
+	virtual bool get_audio_status(osd_audio_status &status) = 0;
 
 	// input overridables
 	virtual void customize_input_type_list(std::vector<input_type_entry> &typelist) = 0;
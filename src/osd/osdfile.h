@@ -13,6 +13,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -285,6 +286,109 @@ namespace osd
 };
 
 
+/***************************************************************************
+    FILE MAPPING INTERFACES
+***************************************************************************/
+
+namespace osd {
+
+/*-----------------------------------------------------------------------------
+    file_mapping: a private copy-on-write view of the start of a file
+
+    Notes:
+
+        - Pages are read from the file on first access and shared with
+          every other process mapping it until they are written to
+        - Writes stay private to the mapping and never reach the file
+-----------------------------------------------------------------------------*/
+
+class file_mapping
+{
+public:
+	file_mapping(file_mapping const &) = delete;
+	file_mapping &operator=(file_mapping const &) = delete;
+
+	file_mapping() { }
+	file_mapping(std::string const &path, std::size_t size)
+	{
+		m_memory = do_map(path, size);
+		if (m_memory)
+			m_size = size;
+	}
+	file_mapping(file_mapping &&that) : m_memory(that.m_memory), m_size(that.m_size)
+	{
+		that.m_memory = nullptr;
+		that.m_size = 0U;
+	}
+	~file_mapping()
+	{
+		if (m_memory)
+			do_unmap(m_memory, m_size);
+	}
+
+	explicit operator bool() const { return bool(m_memory); }
+	void *get() { return m_memory; }
+	std::size_t size() const { return m_size; }
+
+private:
+	static void *do_map(std::string const &path, std::size_t size);
+	static void do_unmap(void *start, std::size_t size);
+
+	void *m_memory = nullptr;
+	std::size_t m_size = 0U;
+};
+
+
+/*-----------------------------------------------------------------------------
+    shared_mapping: a read/write view of a file shared with other processes
+
+    Notes:
+
+        - The file is created if needed and sized to the mapping, so its
+          previous contents are not meaningful
+        - Writes are visible to every other process mapping the same file;
+          on Linux a file under /dev/shm never touches the disk
+-----------------------------------------------------------------------------*/
+
+class shared_mapping
+{
+public:
+	shared_mapping(shared_mapping const &) = delete;
+	shared_mapping &operator=(shared_mapping const &) = delete;
+
+	shared_mapping() { }
+	shared_mapping(std::string const &path, std::size_t size)
+	{
+		m_memory = do_map(path, size);
+		if (m_memory)
+			m_size = size;
+	}
+	shared_mapping(shared_mapping &&that) : m_memory(that.m_memory), m_size(that.m_size)
+	{
+		that.m_memory = nullptr;
+		that.m_size = 0U;
+	}
+	~shared_mapping()
+	{
+		if (m_memory)
+			do_unmap(m_memory, m_size);
+	}
+
+	explicit operator bool() const { return bool(m_memory); }
+	void *get() { return m_memory; }
+	std::size_t size() const { return m_size; }
+
+private:
+	static void *do_map(std::string const &path, std::size_t size);
+	static void do_unmap(void *start, std::size_t size);
+
+	void *m_memory = nullptr;
+	std::size_t m_size = 0U;
+};
+
+} // namespace osd
+
+
 /// \brief Return a directory entry for a path.
 ///
 /// \param [in] path The path in question.
@@ -18,9 +18,13 @@
 #endif
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
 #include <thread>
 #include <vector>
 #include <algorithm>
+#include <cstdio>
 // MAME headers
 #include "osdcore.h"
 #include "osdsync.h"
@@ -100,78 +104,66 @@ int osd_get_num_processors()
 //  TYPE DEFINITIONS
 //============================================================
 
-struct work_thread_info
+// how a queue's items get run
+enum class queue_mode
 {
-	work_thread_info(uint32_t aid, osd_work_queue &aqueue)
-	: queue(aqueue)
-	, handle(nullptr)
-	, wakeevent(false, false)  // auto-reset, not signalled
-	, active(0)
-	, id(aid)
-#if KEEP_STATISTICS
-	, itemsdone(0)
-	, actruntime(0)
-	, runtime(0)
-	, spintime(0)
-	, waittime(0)
-#endif
-	{
-	}
-	osd_work_queue &    queue;          // pointer back to the queue
-	std::thread *       handle;         // handle to the thread
-	osd_event           wakeevent;      // wake event for the thread
-	std::atomic<int32_t>  active;         // are we actively processing work?
-	uint32_t              id;
+	SYNC,       // no threads: run on the calling thread as they're queued
+	SERIAL,     // one at a time in order, by whichever pool thread picks the queue up
+	IO,         // one at a time in order, on a thread of the queue's own
+	MULTI       // spread across the pool's threads
+};
 
-#if KEEP_STATISTICS
-	int32_t               itemsdone;
-	osd_ticks_t         actruntime;
-	osd_ticks_t         runtime;
-	osd_ticks_t         spintime;
-	osd_ticks_t         waittime;
-#endif
+
+// a task in a pool thread's deque: a single item of a multi queue, or a
+// serial queue to drain (item == nullptr)
+struct work_task
+{
+	osd_work_queue *    queue;
+	osd_work_item *     item;
 };
 
 
 struct osd_work_queue
 {
 	osd_work_queue()
-	: list(nullptr)
-	, tailptr(nullptr)
+	: mode(queue_mode::SYNC)
 	, free(nullptr)
+	, scheduled(false)
 	, items(0)
-	, livethreads(0)
+	, active(0)
 	, waiting(0)
 	, exiting(0)
-	, threads(0)
 	, flags(0)
-	, doneevent(true, true)     // manual reset, signalled
+	, spin(0)
+	, io_thread(nullptr)
+	, wakeevent(false, false)   // auto-reset, not signalled
 #if KEEP_STATISTICS
 	, itemsqueued(0)
 	, setevents(0)
-	, extraitems(0)
 	, spinloops(0)
 #endif
 	{
 	}
 
-	std::mutex          lock;           // lock for protecting the queue
-	std::atomic<osd_work_item *> list;  // list of items in the queue
-	osd_work_item ** volatile tailptr;  // pointer to the tail pointer of work items in the queue
-	std::atomic<osd_work_item *> free;  // free list of work items
-	std::atomic<int32_t>  items;          // items in the queue
-	std::atomic<int32_t>  livethreads;    // number of live threads
-	std::atomic<int32_t>  waiting;        // is someone waiting on the queue to complete?
-	std::atomic<int32_t>  exiting;        // should the threads exit on their next opportunity?
-	uint32_t              threads;        // number of threads in this queue
+	queue_mode          mode;           // how items are run
+	std::mutex          lock;           // lock for protecting the free and serial lists
+	osd_work_item *     free;           // free list of work items
+	std::deque<osd_work_item *> serial; // items waiting on a serial or I/O queue
+	bool                scheduled;      // is a serial queue waiting in (or being drained by) the pool?
+	std::atomic<int32_t>  items;          // items queued and not yet finished
+	std::atomic<int32_t>  active;         // tasks taken from the pool and not yet finished
+	std::atomic<int32_t>  waiting;        // number of threads blocked waiting on the queue to complete
+	std::atomic<int32_t>  exiting;        // should the I/O thread exit on its next opportunity?
 	uint32_t              flags;          // creation flags
-	std::vector<work_thread_info *>  thread;         // array of thread information
-	osd_event           doneevent;      // event signalled when work is complete
+	std::atomic<osd_ticks_t> spin;      // adaptive spin before blocking in osd_work_queue_wait; a hint, so relaxed
+	std::thread *       io_thread;      // the I/O queue's own thread
+	osd_event           wakeevent;      // wake event for the I/O thread
+	std::mutex          donelock;       // lock for blocking until work is complete
+	std::condition_variable donecond;   // notified when work is complete and someone is waiting
 
 #if KEEP_STATISTICS
 	std::atomic<int32_t>  itemsqueued;    // total items queued
 	std::atomic<int32_t>  setevents;      // number of times we called SetEvent
-	std::atomic<int32_t>  extraitems;     // how many extra items we got after the first in the queue loop
 	std::atomic<int32_t>  spinloops;      // how many times spinning bought us more items
 #endif
 };
@@ -201,20 +193,82 @@ struct osd_work_item
 	std::atomic<int32_t>  done;           // is the item done?
 };
 
+
+// the threads shared by every non-I/O queue; each has its own deque of
+// tasks and steals from the others when it runs dry
+class work_pool
+{
+public:
+	static work_pool *acquire();
+	static void release();
+
+	int threads() const { return int(m_workers.size()); }
+
+	void push(work_task const *tasks, int count);
+	bool take_for(osd_work_queue *queue, work_task &task);
+	bool take_item(osd_work_item *item);
+	bool take_drain(osd_work_queue *queue);
+	std::vector<work_task> purge(osd_work_queue *queue);
+
+	int acquire_helper_id();
+	void release_helper_id(int id);
+
+private:
+	struct worker
+	{
+		std::mutex              lock;   // protects the deque
+		std::deque<work_task>   tasks;  // tasks queued on this thread
+		std::thread *           handle = nullptr;
+	};
+
+	work_pool(int threads);
+	~work_pool();
+
+	template <typename Match> bool take_matching(Match &&match, work_task &task);
+	bool take(int index, work_task &task);
+	void run(int index);
+
+	std::vector<std::unique_ptr<worker> > m_workers;
+	std::atomic<int32_t>    m_pending;      // tasks in all the deques
+	std::atomic<uint32_t>   m_next;         // round-robin target for tasks queued from outside the pool
+	std::atomic<int32_t>    m_exiting;
+	std::mutex              m_sleep_lock;
+	std::condition_variable m_wakeup;
+	int                     m_sleeping;     // threads blocked on m_wakeup
+	std::atomic<uint32_t>   m_helpers;      // IDs past the pool threads' taken by threads helping while they wait
+
+	static std::mutex       s_lock;
+	static work_pool *      s_pool;
+	static int              s_refs;
+	static thread_local int s_index;        // this thread's index in the pool, or -1
+};
+
+std::mutex work_pool::s_lock;
+work_pool *work_pool::s_pool = nullptr;
+int work_pool::s_refs = 0;
+thread_local int work_pool::s_index = -1;
+
 //============================================================
 //  GLOBAL VARIABLES
 //============================================================
 
 int osd_num_processors = 0;
 
+// callback thread IDs in use by threads running items of queues with no pool
+static std::atomic<uint32_t> s_sync_ids(0);
+
+// work item timing hook, and the name of each pool or I/O thread to report to it
+static std::atomic<osd_work_profile_callback> s_profile_callback(nullptr);
+static thread_local char s_thread_name[32];
+
 //============================================================
 //  FUNCTION PROTOTYPES
 //============================================================
 
 static int effective_num_processors();
-static void * worker_thread_entry(void *param);
-static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread);
-static bool queue_has_list_items(osd_work_queue *queue);
+static void run_item(osd_work_item &item, int threadid);
+static void drain_serial(osd_work_queue *queue);
+static void io_thread_entry(osd_work_queue *queue);
 
 //============================================================
 //  osd_thread_adjust_priority
@@ -245,85 +299,426 @@ int thread_adjust_priority(std::thread *thread, int adjust)
 }
 
 //============================================================
-//  osd_work_queue_alloc
+//  work_pool::acquire/release - the pool is created
+//  for the first queue that needs it and goes away
+//  with the last
 //============================================================
 
-osd_work_queue *osd_work_queue_alloc(int flags)
+work_pool *work_pool::acquire()
 {
-	int threadnum;
-	int numprocs = effective_num_processors();
-	osd_work_queue *queue;
-	int osdthreadnum = 0;
-	int allocthreadnum;
-	const char *osdworkqueuemaxthreads = osd_getenv(ENV_WORKQUEUEMAXTHREADS);
+	std::lock_guard<std::mutex> lock(s_lock);
+	if (!s_pool)
+	{
+		// one thread per processor other than the caller's, as multi queues used to get
+		int threads = effective_num_processors() - 1;
+		const char *osdworkqueuemaxthreads = osd_getenv(ENV_WORKQUEUEMAXTHREADS);
+		int osdthreadnum = 0;
+		if (osdworkqueuemaxthreads != nullptr && sscanf(osdworkqueuemaxthreads, "%d", &osdthreadnum) == 1 && threads > osdthreadnum)
+			threads = osdthreadnum;
+#if defined(SDLMAME_EMSCRIPTEN)
+		// threads are not supported at all
+		threads = 0;
+#endif
+		// leave an ID free for a thread outside the pool helping out while it waits
+		s_pool = new work_pool(std::max(std::min(threads, WORK_MAX_THREADS - 1), 0));
+	}
+	++s_refs;
+	return s_pool;
+}
 
-	// allocate a new queue
-	queue = new osd_work_queue();
+void work_pool::release()
+{
+	std::lock_guard<std::mutex> lock(s_lock);
+	if (!--s_refs)
+	{
+		delete s_pool;
+		s_pool = nullptr;
+	}
+}
 
-	// initialize basic queue members
-	queue->tailptr = (osd_work_item **)&queue->list;
-	queue->flags = flags;
 
-	// determine how many threads to create...
-	// on a single-CPU system, create 1 thread for I/O queues, and 0 threads for everything else
-	if (numprocs == 1)
-		threadnum = (flags & WORK_QUEUE_FLAG_IO) ? 1 : 0;
-	// on an n-CPU system, create n-1 threads for multi queues, and 1 thread for everything else
-	else
-		threadnum = (flags & WORK_QUEUE_FLAG_MULTI) ? (numprocs - 1) : 1;
+//============================================================
+//  work_pool::work_pool/~work_pool
+//============================================================
 
-	if (osdworkqueuemaxthreads != nullptr && sscanf(osdworkqueuemaxthreads, "%d", &osdthreadnum) == 1 && threadnum > osdthreadnum)
-		threadnum = osdthreadnum;
+work_pool::work_pool(int threads)
+	: m_pending(0)
+	, m_next(0)
+	, m_exiting(0)
+	, m_sleeping(0)
+	, m_helpers(0)
+{
+	for (int index = 0; index < threads; index++)
+		m_workers.emplace_back(std::make_unique<worker>());
+	for (int index = 0; index < threads; index++)
+	{
+		m_workers[index]->handle = new std::thread([this, index] () { run(index); });
+		thread_adjust_priority(m_workers[index]->handle, 0);
+	}
+}
 
-#if defined(SDLMAME_EMSCRIPTEN)
-	// threads are not supported at all
-	threadnum = 0;
-#endif
+work_pool::~work_pool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_sleep_lock);
+		m_exiting = true;
+	}
+	m_wakeup.notify_all();
+	for (auto &w : m_workers)
+	{
+		w->handle->join();
+		delete w->handle;
+	}
+}
+
+
+//============================================================
+//  work_pool::push - queue tasks on the calling pool
+//  thread's own deque, or spread them round the pool
+//============================================================
+
+void work_pool::push(work_task const *tasks, int count)
+{
+	for (int tasknum = 0; tasknum < count; tasknum++)
+	{
+		worker &w = *m_workers[(s_index >= 0 && s_pool == this) ? s_index : (m_next++ % m_workers.size())];
+		std::lock_guard<std::mutex> lock(w.lock);
+		w.tasks.push_back(tasks[tasknum]);
+	}
+	m_pending += count;
+
+	// take the lock so a thread that's about to block sees the new work or gets the notification
+	std::lock_guard<std::mutex> lock(m_sleep_lock);
+	if (m_sleeping)
+	{
+		if (count > 1)
+			m_wakeup.notify_all();
+		else
+			m_wakeup.notify_one();
+	}
+}
+
+
+//============================================================
+//  work_pool::take - pop from our own deque, or steal
+//  from the far end of another thread's
+//============================================================
+
+bool work_pool::take(int index, work_task &task)
+{
+	if (!m_pending.load(std::memory_order_relaxed))
+		return false;
+
+	for (int offset = 0; offset < threads(); offset++)
+	{
+		worker &w = *m_workers[(index + offset) % threads()];
+		std::lock_guard<std::mutex> lock(w.lock);
+		if (!w.tasks.empty())
+		{
+			if (!offset)
+			{
+				task = w.tasks.front();
+				w.tasks.pop_front();
+			}
+			else
+			{
+				task = w.tasks.back();
+				w.tasks.pop_back();
+			}
+			++task.queue->active;
+			--m_pending;
+			return true;
+		}
+	}
+	return false;
+}
 
-	// clamp to the maximum
-	queue->threads = std::min(threadnum, WORK_MAX_THREADS);
 
-	// allocate memory for thread array (+1 to count the calling thread if WORK_QUEUE_FLAG_MULTI)
-	if (flags & WORK_QUEUE_FLAG_MULTI)
-		allocthreadnum = queue->threads + 1;
+//============================================================
+//  work_pool::take_* - claim a particular queued task,
+//  so a thread that's waiting can run it itself
+//============================================================
+
+template <typename Match>
+bool work_pool::take_matching(Match &&match, work_task &task)
+{
+	if (!m_pending.load(std::memory_order_relaxed))
+		return false;
+
+	for (auto &w : m_workers)
+	{
+		std::lock_guard<std::mutex> lock(w->lock);
+		auto const found = std::find_if(w->tasks.begin(), w->tasks.end(), match);
+		if (found != w->tasks.end())
+		{
+			task = *found;
+			w->tasks.erase(found);
+			++task.queue->active;
+			--m_pending;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool work_pool::take_for(osd_work_queue *queue, work_task &task)
+{
+	return take_matching([queue] (work_task const &t) { return (t.queue == queue) && t.item; }, task);
+}
+
+bool work_pool::take_item(osd_work_item *item)
+{
+	work_task task;
+	return take_matching([item] (work_task const &t) { return t.item == item; }, task);
+}
+
+bool work_pool::take_drain(osd_work_queue *queue)
+{
+	work_task task;
+	return take_matching([queue] (work_task const &t) { return (t.queue == queue) && !t.item; }, task);
+}
+
+
+//============================================================
+//  work_pool::purge - remove everything a queue that's
+//  being freed still has waiting
+//============================================================
+
+std::vector<work_task> work_pool::purge(osd_work_queue *queue)
+{
+	std::vector<work_task> result;
+	for (auto &w : m_workers)
+	{
+		std::lock_guard<std::mutex> lock(w->lock);
+		auto const end = std::remove_if(
+				w->tasks.begin(),
+				w->tasks.end(),
+				[queue, &result] (work_task const &t)
+				{
+					if (t.queue != queue)
+						return false;
+					result.push_back(t);
+					return true;
+				});
+		w->tasks.erase(end, w->tasks.end());
+	}
+	m_pending -= int32_t(result.size());
+	return result;
+}
+
+
+//============================================================
+//  work_pool::acquire_helper_id - get a callback
+//  thread ID for a thread helping out while it
+//  waits, or -1 if it has to block instead; a pool
+//  thread keeps its own index, as nothing else runs
+//  under it meanwhile, and other threads each take
+//  one of the IDs past the pool threads'
+//============================================================
+
+int work_pool::acquire_helper_id()
+{
+	if (s_index >= 0)
+		return s_index;
+	for (int id = threads(); id < WORK_MAX_THREADS; id++)
+	{
+		uint32_t const bit = uint32_t(1) << id;
+		if (!(m_helpers.fetch_or(bit) & bit))
+			return id;
+	}
+	return -1;
+}
+
+void work_pool::release_helper_id(int id)
+{
+	if ((id >= 0) && (id != s_index))
+		m_helpers.fetch_and(~(uint32_t(1) << id));
+}
+
+
+//============================================================
+//  work_pool::run - pool thread main loop
+//============================================================
+
+void work_pool::run(int index)
+{
+	s_index = index;
+	snprintf(s_thread_name, sizeof(s_thread_name), "worker %d", index);
+
+	// spinning is only worthwhile while high-frequency work keeps turning up: the
+	// budget grows when a spin finds work and shrinks when it doesn't, so an idle
+	// pool settles into blocking
+	osd_ticks_t spin = 0;
+	while (!m_exiting)
+	{
+		work_task task;
+		if (take(index, task))
+		{
+			if ((task.queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ) && !spin)
+				spin = SPIN_LOOP_TIME / 8;
+			if (task.item)
+				run_item(*task.item, index);
+			else
+				drain_serial(task.queue);
+			--task.queue->active;
+			continue;
+		}
+
+		if (spin)
+		{
+			spin_while<std::atomic<int32_t>, int32_t>(&m_pending, 0, spin);
+			bool const found = m_pending != 0;
+			spin = found ? std::min<osd_ticks_t>(spin * 2, SPIN_LOOP_TIME) : (spin / 2);
+			if (found)
+				continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_sleep_lock);
+		if (m_exiting || m_pending)
+			continue;
+		osd_ticks_t const slept = osd_ticks();
+		++m_sleeping;
+		m_wakeup.wait(lock);
+		--m_sleeping;
+
+		// woken again almost immediately: worth spinning next time
+		if ((osd_ticks() - slept) < SPIN_LOOP_TIME)
+			spin = std::max<osd_ticks_t>(spin, SPIN_LOOP_TIME / 8);
+	}
+}
+
+
+//============================================================
+//  run_item - run a single item and signal anyone
+//  waiting on it or its queue
+//============================================================
+
+static void run_item(osd_work_item &item, int threadid)
+{
+	osd_work_queue &queue = item.queue;
+
+	// call the callback and stash the result
+	osd_work_profile_callback const profile = s_profile_callback.load(std::memory_order_relaxed);
+	if (profile)
+	{
+		osd_ticks_t const start = osd_ticks();
+		item.result = (*item.callback)(item.param, threadid);
+		profile(s_thread_name[0] ? s_thread_name : nullptr, start, osd_ticks());
+	}
 	else
-		allocthreadnum = queue->threads;
+	{
+		item.result = (*item.callback)(item.param, threadid);
+	}
 
-#if KEEP_STATISTICS
-	printf("osdprocs: %d effecprocs: %d threads: %d allocthreads: %d osdthreads: %d maxthreads: %d queuethreads: %d\n", osd_num_processors, numprocs, threadnum, allocthreadnum, osdthreadnum, WORK_MAX_THREADS, queue->threads);
-#endif
+	// decrement the item count after we are done
+	int32_t const remaining = --queue.items;
+	item.done = true;
 
-	for (threadnum = 0; threadnum < allocthreadnum; threadnum++)
-		queue->thread.push_back(new work_thread_info(threadnum, *queue));
+	// if it's an auto-release item, release it
+	if (item.flags & WORK_ITEM_FLAG_AUTO_RELEASE)
+		osd_work_item_release(&item);
 
-	// iterate over threads
-	for (threadnum = 0; threadnum < queue->threads; threadnum++)
+	// set the result and signal the event
+	else
 	{
-		work_thread_info *thread = queue->thread[threadnum];
+		std::lock_guard<std::mutex> lock(queue.lock);
+		if (item.event != nullptr)
+		{
+			item.event->set();
+			add_to_stat(queue.setevents, 1);
+		}
+	}
 
-		// create the thread
-		thread->handle = new std::thread(worker_thread_entry, thread);
-		if (thread->handle == nullptr)
-			goto error;
+	// any number of threads can be waiting; taking the lock ensures each has
+	// either seen the queue empty or is blocked and will be woken
+	if (!remaining && queue.waiting)
+	{
+		{
+			std::lock_guard<std::mutex> lock(queue.donelock);
+		}
+		queue.donecond.notify_all();
+		add_to_stat(queue.setevents, 1);
+	}
+}
 
-		// set its priority: I/O threads get high priority because they are assumed to be
-		// blocked most of the time; other threads just match the creator's priority
-		if (flags & WORK_QUEUE_FLAG_IO)
-			thread_adjust_priority(thread->handle, 1);
-		else
-			thread_adjust_priority(thread->handle, 0);
+
+//============================================================
+//  drain_serial - run a serial or I/O queue's items in
+//  order until it's empty
+//============================================================
+
+static void drain_serial(osd_work_queue *queue)
+{
+	while (true)
+	{
+		osd_work_item *item;
+		{
+			std::lock_guard<std::mutex> lock(queue->lock);
+			if (queue->serial.empty())
+			{
+				queue->scheduled = false;
+				break;
+			}
+			item = queue->serial.front();
+			queue->serial.pop_front();
+		}
+		run_item(*item, 0);
 	}
+}
 
-	// start a timer going for "waittime" on the main thread
-	if (flags & WORK_QUEUE_FLAG_MULTI)
+
+//============================================================
+//  io_thread_entry - an I/O queue's own thread, which
+//  can block without holding up the pool
+//============================================================
+
+static void io_thread_entry(osd_work_queue *queue)
+{
+	snprintf(s_thread_name, sizeof(s_thread_name), "I/O worker");
+	while (!queue->exiting)
 	{
-		begin_timing(queue->thread[queue->threads]->waittime);
+		queue->wakeevent.wait(OSD_EVENT_WAIT_INFINITE);
+		if (queue->exiting)
+			break;
+		drain_serial(queue);
+	}
+}
+
+
+//============================================================
+//  osd_work_queue_alloc
+//============================================================
+
+osd_work_queue *osd_work_queue_alloc(int flags)
+{
+	// allocate a new queue
+	auto *queue = new osd_work_queue();
+	queue->flags = flags;
+
+	if (flags & WORK_QUEUE_FLAG_IO)
+	{
+		// I/O queues get a thread of their own even on a single-CPU system, since they spend most of their time blocked
+#if !defined(SDLMAME_EMSCRIPTEN)
+		queue->mode = queue_mode::IO;
+		queue->io_thread = new std::thread(io_thread_entry, queue);
+		thread_adjust_priority(queue->io_thread, 1);
+#endif
+	}
+	else
+	{
+		// everything else shares the pool; with no pool threads, items run as they're queued
+		work_pool *const pool = work_pool::acquire();
+		if (pool->threads())
+			queue->mode = (flags & WORK_QUEUE_FLAG_MULTI) ? queue_mode::MULTI : queue_mode::SERIAL;
+		else
+			work_pool::release();
 	}
-	return queue;
 
-error:
-	osd_work_queue_free(queue);
-	return nullptr;
+#if KEEP_STATISTICS
+	printf("osdprocs: %d effecprocs: %d mode: %d\n", osd_num_processors, effective_num_processors(), int(queue->mode));
+#endif
+
+	return queue;
 }
 
 
@@ -344,44 +739,67 @@ int osd_work_queue_items(osd_work_queue *queue)
 
 bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 {
-	// if no threads, no waiting
-	if (queue->threads == 0)
-		return true;
-
 	// if no items, we're done
 	if (queue->items == 0)
 		return true;
 
-	// if this is a multi queue, help out rather than doing nothing
-	if (queue->flags & WORK_QUEUE_FLAG_MULTI)
+	// help out rather than doing nothing: run this queue's items that haven't been picked up yet
+	if (queue->mode == queue_mode::MULTI)
 	{
-		work_thread_info *thread = queue->thread[queue->threads];
-
-		end_timing(thread->waittime);
-
-		// process what we can as a worker thread
-		worker_thread_process(queue, thread);
-
-		// if we're a high frequency queue, spin until done
-		if (queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue->items != 0)
+		work_pool *const pool = work_pool::acquire();
+		int const id = pool->acquire_helper_id();
+		work_task task;
+		while ((id >= 0) && pool->take_for(queue, task))
 		{
-			// spin until we're done
-			begin_timing(thread->spintime);
-			spin_while_not<std::atomic<int>,int>(&queue->items, 0, timeout);
-			end_timing(thread->spintime);
+			run_item(*task.item, id);
+			--queue->active;
+		}
+		pool->release_helper_id(id);
+		work_pool::release();
+	}
+	else if (queue->mode == queue_mode::SERIAL)
+	{
+		work_pool *const pool = work_pool::acquire();
+		if (pool->take_drain(queue))
+		{
+			drain_serial(queue);
+			--queue->active;
+		}
+		work_pool::release();
+	}
+	if (queue->items == 0)
+		return true;
 
-			begin_timing(thread->waittime);
-			return (queue->items == 0);
+	// the rest is running on other threads; high-frequency queues spin for a while if that's been paying off
+	osd_ticks_t const spin = queue->spin.load(std::memory_order_relaxed);
+	if ((queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ) && spin)
+	{
+		spin_while_not<std::atomic<int32_t>, int32_t>(&queue->items, 0, std::min(spin, timeout));
+		bool const finished = queue->items == 0;
+		queue->spin.store(finished ? std::min<osd_ticks_t>(spin * 2, SPIN_LOOP_TIME) : (spin / 2), std::memory_order_relaxed);
+		if (finished)
+		{
+			add_to_stat(queue->spinloops, 1);
+			return true;
 		}
-		begin_timing(thread->waittime);
 	}
 
-	// reset our done event and double-check the items before waiting
-	queue->doneevent.reset();
-	queue->waiting = true;
-	if (queue->items != 0)
-		queue->doneevent.wait(timeout);
-	queue->waiting = false;
+	// count ourselves as waiting before checking the items again, so whoever
+	// finishes the last item knows to wake us
+	osd_ticks_t const blocked = osd_ticks();
+	{
+		std::unique_lock<std::mutex> lock(queue->donelock);
+		++queue->waiting;
+		queue->donecond.wait_for(
+				lock,
+				std::chrono::milliseconds(std::min<osd_ticks_t>(timeout, osd_ticks_per_second() * 10000) * 1000 / osd_ticks_per_second()),
+				[queue] () { return queue->items == 0; });
+		--queue->waiting;
+	}
+
+	// finished soon after blocking: spin next time
+	if ((queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ) && ((osd_ticks() - blocked) < SPIN_LOOP_TIME))
+		queue->spin.store(std::max<osd_ticks_t>(queue->spin.load(std::memory_order_relaxed), SPIN_LOOP_TIME / 8), std::memory_order_relaxed);
 
 	// return true if we actually hit 0
 	return (queue->items == 0);
@@ -394,68 +812,44 @@ bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 
 void osd_work_queue_free(osd_work_queue *queue)
 {
-	// stop the timer for "waittime" on the main thread
-	if (queue->flags & WORK_QUEUE_FLAG_MULTI)
-	{
-		end_timing(queue->thread[queue->threads]->waittime);
-	}
+	std::vector<osd_work_item *> discard;
 
-	// signal all the threads to exit
-	queue->exiting = true;
-	for (int threadnum = 0; threadnum < queue->threads; threadnum++)
+	if (queue->mode == queue_mode::IO)
 	{
-		work_thread_info *thread = queue->thread[threadnum];
-		thread->wakeevent.set();
+		// signal the thread to exit and wait for it to go away
+		queue->exiting = true;
+		queue->wakeevent.set();
+		queue->io_thread->join();
+		delete queue->io_thread;
 	}
-
-	// wait for all the threads to go away
-	for (int threadnum = 0; threadnum < queue->threads; threadnum++)
+	else if (queue->mode != queue_mode::SYNC)
 	{
-		work_thread_info *thread = queue->thread[threadnum];
-
-		// block on the thread going away, then close the handle
-		if (thread->handle != nullptr)
+		// take back anything still queued in the pool, then wait for items already running
+		work_pool *const pool = work_pool::acquire();
+		for (work_task const &task : pool->purge(queue))
 		{
-			thread->handle->join();
-			delete thread->handle;
+			if (task.item)
+				discard.push_back(task.item);
 		}
-
-	}
-
-#if KEEP_STATISTICS
-	// output per-thread statistics
-	for (work_thread_info *thread : queue->thread)
-	{
-		osd_ticks_t total = thread->runtime + thread->waittime + thread->spintime;
-		printf("Thread %d:  items=%9d run=%5.2f%% (%5.2f%%)  spin=%5.2f%%  wait/other=%5.2f%% total=%9d\n",
-				thread->id, thread->itemsdone,
-				(double)thread->runtime * 100.0 / (double)total,
-				(double)thread->actruntime * 100.0 / (double)total,
-				(double)thread->spintime * 100.0 / (double)total,
-				(double)thread->waittime * 100.0 / (double)total,
-				(uint32_t) total);
+		while (queue->active)
+			std::this_thread::yield();
+		work_pool::release();
+		work_pool::release();
 	}
-#endif
-
-	// free the list
-	for (auto & th : queue->thread)
-		delete th;
-	queue->thread.clear();
 
 	// free all items in the free list
-	while (queue->free.load() != nullptr)
+	while (queue->free != nullptr)
 	{
-		auto *item = (osd_work_item *)queue->free;
+		osd_work_item *item = queue->free;
 		queue->free = item->next;
 		delete item->event;
 		delete item;
 	}
 
-	// free all items in the active list
-	while (queue->list.load() != nullptr)
+	// free all items that never ran
+	discard.insert(discard.end(), queue->serial.begin(), queue->serial.end());
+	for (osd_work_item *item : discard)
 	{
-		auto *item = (osd_work_item *)queue->list;
-		queue->list = item->next;
 		delete item->event;
 		delete item;
 	}
@@ -463,7 +857,6 @@ void osd_work_queue_free(osd_work_queue *queue)
 #if KEEP_STATISTICS
 	printf("Items queued   = %9d\n", queue->itemsqueued.load());
 	printf("SetEvent calls = %9d\n", queue->setevents.load());
-	printf("Extra items    = %9d\n", queue->extraitems.load());
 	printf("Spin loops     = %9d\n", queue->spinloops.load());
 #endif
 
@@ -478,22 +871,20 @@ void osd_work_queue_free(osd_work_queue *queue)
 
 osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_callback callback, int32_t numitems, void *parambase, int32_t paramstep, uint32_t flags)
 {
-	osd_work_item *itemlist = nullptr, *lastitem = nullptr;
-	osd_work_item **item_tailptr = &itemlist;
-	int itemnum;
+	std::vector<osd_work_item *> itemlist;
+	itemlist.reserve(numitems);
 
 	// loop over items, building up a local list of work
-	for (itemnum = 0; itemnum < numitems; itemnum++)
+	for (int itemnum = 0; itemnum < numitems; itemnum++)
 	{
 		osd_work_item *item;
 
 		// first allocate a new work item; try the free list first
 		{
 			std::lock_guard<std::mutex> lock(queue->lock);
-			do
-			{
-				item = (osd_work_item *)queue->free;
-			} while (item != nullptr && !queue->free.compare_exchange_weak(item, item->next, std::memory_order_release, std::memory_order_relaxed));
+			item = queue->free;
+			if (item != nullptr)
+				queue->free = item->next;
 		}
 
 		// if nothing, allocate something new
@@ -501,8 +892,6 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 		{
 			// allocate the item
 			item = new osd_work_item(*queue);
-			if (item == nullptr)
-				return nullptr;
 		}
 		else
 		{
@@ -517,53 +906,75 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 		item->flags = flags;
 
 		// advance to the next
-		lastitem = item;
-		*item_tailptr = item;
-		item_tailptr = &item->next;
+		itemlist.push_back(item);
 		parambase = (uint8_t *)parambase + paramstep;
 	}
-
-	// enqueue the whole thing within the critical section
-	{
-		std::lock_guard<std::mutex> lock(queue->lock);
-		*queue->tailptr = itemlist;
-		queue->tailptr = item_tailptr;
-	}
+	osd_work_item *const lastitem = itemlist.back();
 
 	// increment the number of items in the queue
 	queue->items += numitems;
 	add_to_stat(queue->itemsqueued, numitems);
 
-	// look for free threads to do the work
-	if (queue->livethreads < queue->threads)
+	switch (queue->mode)
 	{
-		int threadnum;
+	case queue_mode::SYNC:
+		{
+			// if no threads, run the queue now on this thread, under an ID no
+			// other thread is using for the same
+			int id = -1;
+			while (id < 0)
+			{
+				for (int candidate = 0; (id < 0) && (candidate < WORK_MAX_THREADS); candidate++)
+					if (!(s_sync_ids.fetch_or(uint32_t(1) << candidate) & (uint32_t(1) << candidate)))
+						id = candidate;
+				if (id < 0)
+					std::this_thread::yield();
+			}
+			for (osd_work_item *item : itemlist)
+				run_item(*item, id);
+			s_sync_ids.fetch_and(~(uint32_t(1) << id));
+		}
+		break;
 
-		// iterate over all the threads
-		for (threadnum = 0; threadnum < queue->threads; threadnum++)
+	case queue_mode::MULTI:
 		{
-			work_thread_info *thread = queue->thread[threadnum];
+			// each item is a task in its own right
+			std::vector<work_task> tasks;
+			tasks.reserve(numitems);
+			for (osd_work_item *item : itemlist)
+				tasks.push_back(work_task{ queue, item });
+			work_pool *const pool = work_pool::acquire();
+			pool->push(&tasks[0], numitems);
+			work_pool::release();
+		}
+		break;
 
-			// if this thread is not active, wake him up
-			if (!thread->active)
+	case queue_mode::SERIAL:
+	case queue_mode::IO:
+		{
+			// append to the queue, and schedule it if nobody's draining it already
+			bool schedule;
 			{
-				thread->wakeevent.set();
-				add_to_stat(queue->setevents, 1);
-
-				// for non-shared, the first one we find is good enough
-				if (--numitems == 0)
-					break;
+				std::lock_guard<std::mutex> lock(queue->lock);
+				queue->serial.insert(queue->serial.end(), itemlist.begin(), itemlist.end());
+				schedule = !queue->scheduled;
+				queue->scheduled = true;
+			}
+			if (queue->mode == queue_mode::IO)
+			{
+				queue->wakeevent.set();
+			}
+			else if (schedule)
+			{
+				work_task const task{ queue, nullptr };
+				work_pool *const pool = work_pool::acquire();
+				pool->push(&task, 1);
+				work_pool::release();
 			}
 		}
+		break;
 	}
 
-	// if no threads, run the queue now on this thread
-	if (queue->threads == 0)
-	{
-		end_timing(queue->thread[0]->waittime);
-		worker_thread_process(queue, queue->thread[0]);
-		begin_timing(queue->thread[0]->waittime);
-	}
 	// only return the item if it won't get released automatically
 	return (flags & WORK_ITEM_FLAG_AUTO_RELEASE) ? nullptr : lastitem;
 }
@@ -579,24 +990,44 @@ bool osd_work_item_wait(osd_work_item *item, osd_ticks_t timeout)
 	if (item->done)
 		return true;
 
-	// if we don't have an event, create one
-	if (item->event == nullptr)
+	// if nobody has started it yet, run it here rather than blocking a thread the pool may need
+	osd_work_queue &queue = item->queue;
+	if (queue.mode == queue_mode::MULTI)
 	{
-		std::lock_guard<std::mutex> lock(item->queue.lock);
-		item->event = new osd_event(true, false);     // manual reset, not signalled
+		work_pool *const pool = work_pool::acquire();
+		int const id = pool->acquire_helper_id();
+		if ((id >= 0) && pool->take_item(item))
+		{
+			run_item(*item, id);
+			--queue.active;
+		}
+		pool->release_helper_id(id);
+		work_pool::release();
 	}
-	else
-		item->event->reset();
+	else if (queue.mode == queue_mode::SERIAL)
+	{
+		work_pool *const pool = work_pool::acquire();
+		if (pool->take_drain(&queue))
+		{
+			drain_serial(&queue);
+			--queue.active;
+		}
+		work_pool::release();
+	}
+	if (item->done)
+		return true;
 
-	// if we don't have an event, we need to spin (shouldn't ever really happen)
-	if (item->event == nullptr)
+	// if we don't have an event, create one
 	{
-		// TODO: do we need to measure the spin time here as well? and how can we do it?
-		spin_while<std::atomic<int>,int>(&item->done, 0, timeout);
+		std::lock_guard<std::mutex> lock(queue.lock);
+		if (item->event == nullptr)
+			item->event = new osd_event(true, false);     // manual reset, not signalled
+		else
+			item->event->reset();
 	}
 
-	// otherwise, block on the event until done
-	else if (!item->done)
+	// block on the event until done
+	if (!item->done)
 		item->event->wait(timeout);
 
 	// return true if the refcount actually hit 0
@@ -620,18 +1051,23 @@ void *osd_work_item_result(osd_work_item *item)
 
 void osd_work_item_release(osd_work_item *item)
 {
-	osd_work_item *next;
-
 	// make sure we're done first
 	osd_work_item_wait(item, 100 * osd_ticks_per_second());
 
 	// add us to the free list on our queue
 	std::lock_guard<std::mutex> lock(item->queue.lock);
-	do
-	{
-		next = (osd_work_item *) item->queue.free;
-		item->next = next;
-	} while (!item->queue.free.compare_exchange_weak(next, item, std::memory_order_release, std::memory_order_relaxed));
+	item->next = item->queue.free;
+	item->queue.free = item;
+}
+
+
+//============================================================
+//  osd_work_set_profile_callback
+//============================================================
+
+void osd_work_set_profile_callback(osd_work_profile_callback callback)
+{
+	s_profile_callback.store(callback, std::memory_order_relaxed);
 }
 
 
@@ -662,158 +1098,3 @@ static int effective_num_processors()
 		return physprocs;
 	}
 }
-
-
-//============================================================
-//  worker_thread_entry
-//============================================================
-
-static void *worker_thread_entry(void *param)
-{
-	auto *thread = (work_thread_info *)param;
-	osd_work_queue &queue = thread->queue;
-
-	// loop until we exit
-	for ( ;; )
-	{
-		// block waiting for work or exit
-		// bail on exit, and only wait if there are no pending items in queue
-		if (queue.exiting)
-			break;
-
-		if (!queue_has_list_items(&queue))
-		{
-			begin_timing(thread->waittime);
-			thread->wakeevent.wait( OSD_EVENT_WAIT_INFINITE);
-			end_timing(thread->waittime);
-		}
-
-		if (queue.exiting)
-			break;
-
-		// indicate that we are live
-		thread->active = true;
-		++queue.livethreads;
-
-		// process work items
-		for ( ;; )
-		{
-			// process as much as we can
-			worker_thread_process(&queue, thread);
-
-			// if we're a high frequency queue, spin for a while before giving up
-			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue.list.load() == nullptr)
-			{
-				// spin for a while looking for more work
-				begin_timing(thread->spintime);
-				spin_while<std::atomic<osd_work_item *>, osd_work_item *>(&queue.list, (osd_work_item *)nullptr, SPIN_LOOP_TIME);
-				end_timing(thread->spintime);
-			}
-
-			// if nothing more, release the processor
-			if (!queue_has_list_items(&queue))
-				break;
-			add_to_stat(queue.spinloops, 1);
-		}
-
-		// decrement the live thread count
-		thread->active = false;
-		--queue.livethreads;
-	}
-
-	return nullptr;
-}
-
-
-//============================================================
-//  worker_thread_process
-//============================================================
-
-static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread)
-{
-	int threadid = thread->id;
-
-	begin_timing(thread->runtime);
-
-	// loop until everything is processed
-	while (true)
-	{
-		osd_work_item *item = nullptr;
-
-		bool end_loop = false;
-
-		// use a critical section to synchronize the removal of items
-		{
-			std::lock_guard<std::mutex> lock(queue->lock);
-
-			if (queue->list.load() == nullptr)
-			{
-				end_loop = true;
-			}
-			else
-			{
-				// pull the item from the queue
-				item = (osd_work_item *)queue->list;
-				if (item != nullptr)
-				{
-					queue->list = item->next;
-					if (queue->list.load() == nullptr)
-						queue->tailptr = (osd_work_item **)&queue->list;
-				}
-			}
-		}
-
-		if (end_loop)
-			break;
-
-		// process non-NULL items
-		if (item != nullptr)
-		{
-			// call the callback and stash the result
-			begin_timing(thread->actruntime);
-			item->result = (*item->callback)(item->param, threadid);
-			end_timing(thread->actruntime);
-
-			// decrement the item count after we are done
-			--queue->items;
-			item->done = true;
-			add_to_stat(thread->itemsdone, 1);
-
-			// if it's an auto-release item, release it
-			if (item->flags & WORK_ITEM_FLAG_AUTO_RELEASE)
-				osd_work_item_release(item);
-
-			// set the result and signal the event
-			else
-			{
-				std::lock_guard<std::mutex> lock(queue->lock);
-
-				if (item->event != nullptr)
-				{
-					item->event->set();
-					add_to_stat(item->queue.setevents, 1);
-				}
-			}
-
-			// if we removed an item and there's still work to do, bump the stats
-			if (queue_has_list_items(queue))
-				add_to_stat(queue->extraitems, 1);
-		}
-	}
-
-	// we don't need to set the doneevent for multi queues because they spin
-	if (queue->waiting)
-	{
-		queue->doneevent.set();
-		add_to_stat(queue->setevents, 1);
-	}
-
-	end_timing(thread->runtime);
-}
-
-bool queue_has_list_items(osd_work_queue *queue)
-{
-	std::lock_guard<std::mutex> lock(queue->lock);
-	bool has_list_items = (queue->list.load() != nullptr);
-	return has_list_items;
-}
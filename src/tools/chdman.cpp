@@ -29,6 +29,7 @@
 #include <limits>
 #include <memory>
 #include <new>
+#include <thread>
 #include <unordered_map>
 
 using util::string_format;
@@ -632,7 +633,8 @@ static const command_description s_commands[] =
 	{ COMMAND_VERIFY, do_verify, ": verifies a CHD's integrity",
 		{
 			REQUIRED OPTION_INPUT,
-			OPTION_INPUT_PARENT
+			OPTION_INPUT_PARENT,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -709,7 +711,8 @@ static const command_description s_commands[] =
 			OPTION_INPUT_START_BYTE,
 			OPTION_INPUT_START_HUNK,
 			OPTION_INPUT_LENGTH_BYTES,
-			OPTION_INPUT_LENGTH_HUNKS
+			OPTION_INPUT_LENGTH_HUNKS,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -722,7 +725,8 @@ static const command_description s_commands[] =
 			OPTION_INPUT_START_BYTE,
 			OPTION_INPUT_START_HUNK,
 			OPTION_INPUT_LENGTH_BYTES,
-			OPTION_INPUT_LENGTH_HUNKS
+			OPTION_INPUT_LENGTH_HUNKS,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -733,6 +737,7 @@ static const command_description s_commands[] =
 			OPTION_OUTPUT_FORCE,
 			REQUIRED OPTION_INPUT,
 			OPTION_INPUT_PARENT,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -1208,6 +1213,21 @@ static void parse_numprocessors(const parameters_map &params)
 }
 
 
+//-------------------------------------------------
+//  configure_read_ahead - decompress far enough
+//  ahead of a sequential pass over the input that
+//  every processor has a hunk to work on while
+//  the main thread hashes or writes out the data
+//-------------------------------------------------
+
+static void configure_read_ahead(chd_file &input_chd)
+{
+	extern int osd_num_processors;
+	int const processors = (osd_num_processors > 0) ? osd_num_processors : std::max(1U, std::thread::hardware_concurrency());
+	input_chd.set_read_ahead(std::min(processors * 2, 64));
+}
+
+
 //-------------------------------------------------
 //  compression_string - create a friendly string
 //  describing a set of compressors
@@ -1572,10 +1592,15 @@ static void do_info(parameters_map &params)
 
 static void do_verify(parameters_map &params)
 {
+	// process numprocessors first, as the input's worker threads start when it opens
+	parse_numprocessors(params);
+
 	// parse out input files
 	chd_file input_parent_chd;
 	chd_file input_chd;
 	parse_input_chd_parameters(params, input_chd, input_parent_chd);
+	configure_read_ahead(input_chd);
+	configure_read_ahead(input_parent_chd);
 
 	// only makes sense for compressed CHDs with valid SHA1's
 	if (!input_chd.compressed())
@@ -2305,10 +2330,15 @@ static void do_copy(parameters_map &params)
 
 static void do_extract_raw(parameters_map &params)
 {
+	// process numprocessors first, as the input's worker threads start when it opens
+	parse_numprocessors(params);
+
 	// parse out input files
 	chd_file input_parent_chd;
 	chd_file input_chd;
 	parse_input_chd_parameters(params, input_chd, input_parent_chd);
+	configure_read_ahead(input_chd);
+	configure_read_ahead(input_parent_chd);
 
 	// parse out input start/end
 	uint64_t input_start;
@@ -2383,10 +2413,15 @@ static void do_extract_raw(parameters_map &params)
 
 static void do_extract_cd(parameters_map &params)
 {
+	// process numprocessors first, as the input's worker threads start when it opens
+	parse_numprocessors(params);
+
 	// parse out input files
 	chd_file input_parent_chd;
 	chd_file input_chd;
 	parse_input_chd_parameters(params, input_chd, input_parent_chd);
+	configure_read_ahead(input_chd);
+	configure_read_ahead(input_parent_chd);
 
 	// further process input file
 	cdrom_file *cdrom = cdrom_open(&input_chd);
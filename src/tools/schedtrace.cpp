@@ -0,0 +1,309 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    schedtrace.cpp
+
+    Summarise a trace written by the emulator's -scheduler_trace option:
+    which timers fire most often, which devices synchronize the most, and
+    how much of their requested timeslices devices actually get to run.
+
+***************************************************************************/
+
+#include "osdcomm.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+// must match device_scheduler::trace_recorder in src/emu/schedule.cpp
+enum : uint8_t
+{
+	TRACE_NAME = 0,
+	TRACE_TIMESLICE,
+	TRACE_EXECUTE,
+	TRACE_TIMER,
+	TRACE_SYNCHRONIZE,
+	TRACE_END
+};
+
+static constexpr uint16_t TRACE_NO_NAME = 0xffff;
+static constexpr uint32_t TRACE_VERSION = 1;
+static constexpr int DEFAULT_TOP = 20;
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+struct trace_record
+{
+	uint8_t     type;
+	uint8_t     reserved;
+	uint16_t    source;
+	int32_t     seconds;
+	int64_t     attoseconds;
+	uint32_t    arg0;
+	uint32_t    arg1;
+};
+static_assert(sizeof(trace_record) == 24, "trace records must be 24 bytes");
+
+struct device_stats
+{
+	uint64_t    timeslices = 0;
+	uint64_t    requested = 0;
+	uint64_t    ran = 0;
+	uint64_t    synchronizes = 0;
+	uint64_t    timer_sets = 0;
+};
+
+struct trace_summary
+{
+	std::vector<std::string>                                names;
+	std::map<std::string, uint64_t>                         timers;
+	std::map<std::string, device_stats>                     devices;
+	std::map<std::pair<std::string, std::string>, uint64_t> sync_pairs;
+	uint64_t    timeslices = 0;
+	double      timeslice_total = 0.0;
+	double      first_time = -1.0;
+	double      last_time = 0.0;
+	uint32_t    dropped = 0;
+	bool        ended = false;
+};
+
+
+
+/***************************************************************************
+    CORE IMPLEMENTATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    name_of - look up the text for a name ID
+-------------------------------------------------*/
+
+static const std::string &name_of(const trace_summary &summary, uint16_t id)
+{
+	static const std::string none("(none)");
+	return (id < summary.names.size()) ? summary.names[id] : none;
+}
+
+
+/*-------------------------------------------------
+    read_trace - read and accumulate every record
+    in the file
+-------------------------------------------------*/
+
+static bool read_trace(FILE *file, trace_summary &summary)
+{
+	// check the header
+	char signature[8];
+	uint32_t header[2];
+	if (fread(signature, sizeof(signature), 1, file) != 1 || memcmp(signature, "MAMESTRC", 8) != 0 || fread(header, sizeof(header), 1, file) != 1)
+	{
+		fprintf(stderr, "Not a scheduler trace file\n");
+		return false;
+	}
+	if (header[0] != TRACE_VERSION || header[1] != sizeof(trace_record))
+	{
+		fprintf(stderr, "Unsupported trace version %u (record size %u)\n", header[0], header[1]);
+		return false;
+	}
+
+	trace_record record;
+	while (fread(&record, sizeof(record), 1, file) == 1)
+	{
+		double const time = double(record.seconds) + double(record.attoseconds) * 1e-18;
+		switch (record.type)
+		{
+		case TRACE_NAME:
+			{
+				// the text follows in as many records as it needs
+				std::string text(record.arg0, '\0');
+				size_t const count = (record.arg0 + sizeof(trace_record) - 1) / sizeof(trace_record);
+				std::vector<char> buffer(count * sizeof(trace_record));
+				if (count && fread(buffer.data(), sizeof(trace_record), count, file) != count)
+				{
+					fprintf(stderr, "Trace is truncated\n");
+					return true;
+				}
+				text.assign(buffer.data(), record.arg0);
+				if (summary.names.size() <= record.source)
+					summary.names.resize(record.source + 1);
+				summary.names[record.source] = text;
+			}
+			break;
+
+		case TRACE_TIMESLICE:
+			{
+				double const length = double((uint64_t(record.arg1) << 32) | record.arg0) * 1e-18;
+				summary.timeslices++;
+				summary.timeslice_total += length;
+				if (summary.first_time < 0.0)
+					summary.first_time = time;
+				summary.last_time = std::max(summary.last_time, time + length);
+			}
+			break;
+
+		case TRACE_EXECUTE:
+			{
+				device_stats &stats = summary.devices[name_of(summary, record.source)];
+				stats.timeslices++;
+				stats.requested += record.arg0;
+				stats.ran += record.arg1;
+			}
+			break;
+
+		case TRACE_TIMER:
+			summary.timers[name_of(summary, record.source)]++;
+			break;
+
+		case TRACE_SYNCHRONIZE:
+			{
+				std::string const &origin = name_of(summary, record.source);
+				device_stats &stats = summary.devices[origin];
+				if (record.arg1)
+					stats.synchronizes++;
+				else
+					stats.timer_sets++;
+				if (record.arg1)
+					summary.sync_pairs[std::make_pair(origin, name_of(summary, uint16_t(record.arg0)))]++;
+			}
+			break;
+
+		case TRACE_END:
+			summary.dropped = record.arg0;
+			summary.ended = true;
+			break;
+
+		default:
+			fprintf(stderr, "Unknown record type %u\n", record.type);
+			return false;
+		}
+	}
+	return true;
+}
+
+
+/*-------------------------------------------------
+    top_entries - sort a map by descending count
+    and trim it
+-------------------------------------------------*/
+
+template <typename Key>
+static std::vector<std::pair<Key, uint64_t>> top_entries(const std::map<Key, uint64_t> &counts, int top)
+{
+	std::vector<std::pair<Key, uint64_t>> result(counts.begin(), counts.end());
+	std::sort(result.begin(), result.end(), [] (auto const &a, auto const &b) { return a.second > b.second; });
+	if (result.size() > size_t(top))
+		result.resize(top);
+	return result;
+}
+
+
+/*-------------------------------------------------
+    print_summary - write the report
+-------------------------------------------------*/
+
+static void print_summary(const trace_summary &summary, int top)
+{
+	double const duration = std::max(summary.last_time - std::max(summary.first_time, 0.0), 1e-9);
+	auto const rate = [duration] (uint64_t count) { return double(count) / duration; };
+
+	printf("Emulated time:  %.6f s\n", duration);
+	printf("Timeslices:     %llu (%.1f/s, average %.3f us)\n",
+			(unsigned long long)summary.timeslices,
+			rate(summary.timeslices),
+			summary.timeslices ? (summary.timeslice_total / double(summary.timeslices) * 1e6) : 0.0);
+	if (summary.dropped)
+		printf("WARNING: %u records were dropped while tracing\n", summary.dropped);
+	if (!summary.ended)
+		printf("WARNING: trace has no end record; the emulator may not have exited cleanly\n");
+
+	printf("\nHot timers:\n");
+	printf("  %-40s %12s %12s\n", "timer", "fired", "per second");
+	for (auto const &entry : top_entries(summary.timers, top))
+		printf("  %-40s %12llu %12.1f\n", entry.first.c_str(), (unsigned long long)entry.second, rate(entry.second));
+
+	printf("\nSynchronizing devices:\n");
+	printf("  %-40s %12s %12s %12s\n", "device", "synchronize", "per second", "timer_set");
+	std::map<std::string, uint64_t> syncs;
+	for (auto const &entry : summary.devices)
+		if (entry.second.synchronizes || entry.second.timer_sets)
+			syncs[entry.first] = entry.second.synchronizes;
+	for (auto const &entry : top_entries(syncs, top))
+		printf("  %-40s %12llu %12.1f %12llu\n", entry.first.c_str(), (unsigned long long)entry.second, rate(entry.second), (unsigned long long)summary.devices.at(entry.first).timer_sets);
+
+	printf("\nBusiest synchronize targets:\n");
+	printf("  %-30s %-30s %12s\n", "from", "to", "count");
+	for (auto const &entry : top_entries(summary.sync_pairs, top))
+		printf("  %-30s %-30s %12llu\n", entry.first.first.c_str(), entry.first.second.c_str(), (unsigned long long)entry.second);
+
+	// devices that are often cut short are the ones paying for the interleave
+	printf("\nDevice execution:\n");
+	printf("  %-40s %12s %16s %16s %8s\n", "device", "timeslices", "requested", "ran", "ran %");
+	for (auto const &entry : summary.devices)
+	{
+		device_stats const &stats = entry.second;
+		if (!stats.timeslices)
+			continue;
+		printf("  %-40s %12llu %16llu %16llu %7.1f%%\n",
+				entry.first.c_str(),
+				(unsigned long long)stats.timeslices,
+				(unsigned long long)stats.requested,
+				(unsigned long long)stats.ran,
+				stats.requested ? (100.0 * double(stats.ran) / double(stats.requested)) : 100.0);
+	}
+}
+
+
+/*-------------------------------------------------
+    main - main entry point
+-------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+	const char *filename = nullptr;
+	int top = DEFAULT_TOP;
+	bool usage = false;
+	for (int arg = 1; arg < argc; arg++)
+	{
+		if (!strcmp(argv[arg], "-top") && (arg + 1) < argc)
+			top = std::max(atoi(argv[++arg]), 1);
+		else if (filename == nullptr)
+			filename = argv[arg];
+		else
+			usage = true;
+	}
+	if (usage || filename == nullptr)
+	{
+		fprintf(stderr, "Usage:\n    schedtrace <trace file> [-top <count>]\n");
+		return 1;
+	}
+
+	FILE *const file = fopen(filename, "rb");
+	if (file == nullptr)
+	{
+		fprintf(stderr, "Unable to open %s\n", filename);
+		return 1;
+	}
+
+	trace_summary summary;
+	bool const success = read_trace(file, summary);
+	fclose(file);
+	if (!success)
+		return 1;
+
+	print_summary(summary, top);
+	return 0;
+}
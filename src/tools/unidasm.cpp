@@ -207,6 +207,7 @@ using util::BIT;
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #ifdef _WIN32
@@ -353,6 +354,7 @@ struct options
 	uint8_t                 lower;
 	uint8_t                 upper;
 	uint8_t                 flipped;
+	uint8_t                 trace;
 	int                     mode;
 	const dasm_table_entry *dasm;
 	uint32_t                skip;
@@ -1105,6 +1107,8 @@ static int parse_options(int argc, char *argv[], options *opts)
 				pending_count = true;
 			else if(tolower((uint8_t)curarg[1]) == 'n')
 				opts->norawbytes = true;
+			else if(tolower((uint8_t)curarg[1]) == 't')
+				opts->trace = true;
 			else if(tolower((uint8_t)curarg[1]) == 'u')
 				opts->upper = true;
 			else if(tolower((uint8_t)curarg[1]) == 'x')
@@ -1182,7 +1186,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 usage:
 	printf("Usage: %s <filename> -arch <architecture> [-basepc <pc>] \n", argv[0]);
 	printf("   [-mode <n>] [-norawbytes] [-xchbytes] [-flipped] [-upper] [-lower]\n");
-	printf("   [-skip <n>] [-count <n>]\n");
+	printf("   [-skip <n>] [-count <n>] [-trace]\n");
 	printf("\n");
 	printf("Supported architectures:");
 	const int colwidth = 1 + std::strlen(std::max_element(std::begin(dasm_table), std::end(dasm_table), [](const dasm_table_entry &a, const dasm_table_entry &b) { return std::strlen(a.name) < std::strlen(b.name); })->name);
@@ -1201,6 +1205,71 @@ usage:
 };
 
 
+// Disassemble a binary trace written by the debugger's "trace <file>,<cpu>,binary"
+static int disassemble_trace(const options &opts, const u8 *data, u32 length, util::disasm_interface *disasm)
+{
+	if(length < 8 || memcmp(data, "MAMETRC1", 8) != 0) {
+		std::fprintf(stderr, "'%s' is not a binary trace\n", opts.filename);
+		return 1;
+	}
+
+	if(disasm->interface_flags() & util::disasm_interface::INTERNAL_DECRYPTION) {
+		std::fprintf(stderr, "Binary traces can't be disassembled for architectures with encrypted opcodes\n");
+		return 1;
+	}
+
+	// opcode bytes are stored in little-endian units of the bus width
+	const u32 unit = opts.dasm->pcshift < 0 ? 1 << -opts.dasm->pcshift : 1;
+	const u32 swap = opts.dasm->endian == be ? unit - 1 : 0;
+	auto get32 = [data](u32 pos) -> u32 { return data[pos] | (data[pos+1] << 8) | (data[pos+2] << 16) | (u32(data[pos+3]) << 24); };
+
+	std::unordered_map<offs_t, std::string> lines;
+	u32 printed = 0;
+	u32 pos = 8;
+	while(pos < length) {
+		const u8 type = data[pos++];
+		if(type == 'C' && pos + 5 <= length && pos + 5 + data[pos + 4] <= length) {
+			// opcode bytes for a PC, replacing any earlier ones after a bank switch
+			const offs_t pc = get32(pos);
+			const u32 size = data[pos + 4];
+			unidasm_data_buffer buffer(disasm, opts.dasm);
+			buffer.data.resize(size + 8, 0x00);
+			buffer.size = size;
+			buffer.base_pc = pc;
+			for(u32 i = 0; i != size; i++)
+				buffer.data[i] = data[pos + 5 + (i ^ swap)];
+
+			std::ostringstream stream;
+			disasm->disassemble(stream, pc, buffer, buffer);
+			std::string line = stream.str();
+			if(opts.lower)
+				std::transform(line.begin(), line.end(), line.begin(), [](char c) { return tolower(c); });
+			else if(opts.upper)
+				std::transform(line.begin(), line.end(), line.begin(), [](char c) { return toupper(c); });
+			lines[pc] = std::move(line);
+			pos += 5 + size;
+
+		} else if(type == 'P' && pos + 4 <= length && pos + 4 + u64(get32(pos)) * 4 <= length) {
+			// executed PCs
+			const u32 count = get32(pos);
+			pos += 4;
+			for(u32 i = 0; i != count; i++, pos += 4) {
+				if(opts.count != 0 && printed == opts.count)
+					return 0;
+				const offs_t pc = get32(pos);
+				util::stream_format(std::cout, "%08x: %s\n", pc, lines[pc]);
+				printed++;
+			}
+
+		} else {
+			std::fprintf(stderr, "Corrupt binary trace at offset %u\n", pos - 1);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+
 int main(int argc, char *argv[])
 {
 	// Parse options first
@@ -1252,6 +1321,13 @@ int main(int argc, char *argv[])
 	std::unique_ptr<util::disasm_interface> disasm(opts.dasm->alloc());
 	u32 flags = disasm->interface_flags();
 
+	// Binary traces are a sequence of PCs rather than an image
+	if(opts.trace) {
+		int result = disassemble_trace(opts, (const u8 *)data, length, disasm.get());
+		free(data);
+		return result;
+	}
+
 	// Compute the granularity in bytes (1-8)
 	offs_t granularity = opts.dasm->pcshift < 0 ? disasm->opcode_alignment() << -opts.dasm->pcshift : disasm->opcode_alignment() >> opts.dasm->pcshift;
 
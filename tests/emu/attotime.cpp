@@ -4,8 +4,80 @@
 #include "eminline.h"
 #include "attotime.h"
 
+#include <vector>
+
 TEST_CASE("convert 1 sec to attotime", "[emu]")
 {
    attotime value = attotime::from_seconds(1);
    REQUIRE(value.as_attoseconds() == 1000000000000000000);
 }
+
+namespace {
+
+// a spread of times around the interesting boundaries
+std::vector<attotime> tick_test_times()
+{
+   std::vector<attotime> times = {
+         attotime::zero,
+         attotime(0, 1),
+         attotime(0, ATTOSECONDS_PER_SECOND - 1),
+         attotime(1, 0),
+         attotime(1, 1),
+         attotime(-1, 0),
+         attotime(-1, ATTOSECONDS_PER_SECOND - 1),
+         attotime(ATTOTIME_MAX_SECONDS - 1, ATTOSECONDS_PER_SECOND - 1),
+         attotime::never };
+   u64 seed = 0x123456789abcdef;
+   for (int i = 0; i < 200; i++)
+   {
+      seed = seed * 6364136223846793005U + 1442695040888963407U;
+      times.emplace_back(seconds_t((seed >> 40) % 100000), attoseconds_t((seed >> 1) % ATTOSECONDS_PER_SECOND));
+   }
+   return times;
+}
+
+} // anonymous namespace
+
+TEST_CASE("attotime survives a round trip through ticks", "[emu]")
+{
+   for (attotime const &time : tick_test_times())
+      REQUIRE(tick_to_attotime(attotime_to_tick(time)) == time);
+}
+
+TEST_CASE("all never values become the same tick", "[emu]")
+{
+   REQUIRE((attotime_to_tick(attotime::never) == ATTOTICK_NEVER));
+   REQUIRE((attotime_to_tick(attotime(ATTOTIME_MAX_SECONDS, 12345)) == ATTOTICK_NEVER));
+   REQUIRE((attotime_to_tick(attotime(ATTOTIME_MAX_SECONDS + 1, 0)) == ATTOTICK_NEVER));
+   REQUIRE((attotime_to_tick(attotime::never + attotime::from_seconds(1)) == ATTOTICK_NEVER));
+}
+
+TEST_CASE("ticks order the same way as attotime", "[emu]")
+{
+   std::vector<attotime> const times = tick_test_times();
+   for (attotime const &a : times)
+   {
+      for (attotime const &b : times)
+      {
+         attotick_t const ta = attotime_to_tick(a);
+         attotick_t const tb = attotime_to_tick(b);
+         REQUIRE((ta < tb) == (a < b));
+         REQUIRE((ta <= tb) == (a <= b));
+         REQUIRE((ta == tb) == (a == b));
+      }
+   }
+}
+
+TEST_CASE("attotime sums convert to the same ticks", "[emu]")
+{
+   std::vector<attotime> const times = tick_test_times();
+   for (attotime const &a : times)
+   {
+      for (attotime const &b : times)
+      {
+         attotime const sum = a + b;
+         if (!sum.is_never() && (a.seconds() >= 0) && (b.seconds() >= 0))
+            REQUIRE((attotime_to_tick(sum) == (attotime_to_tick(a) + attotime_to_tick(b))));
+      }
+   }
+}
@@ -0,0 +1,203 @@
+#include "catch.hpp"
+#include "emucore.h"
+#include "video/rgbutil.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+/*
+    Performance regression tests.  These are hidden from a normal run;
+    select them with the perf tag:
+
+        mametests [perf]
+
+    Each test times a kernel and compares its cost per item with the
+    figure stored for it in the baseline file named by the
+    MAME_PERF_BASELINES environment variable.  A test fails if it's
+    slower than its baseline by more than MAME_PERF_TOLERANCE, a fraction
+    that defaults to 0.15.
+
+    Timings only compare on like hardware, so no baselines are kept in
+    the tree.  Run once with MAME_PERF_RECORD=1 on each type of build
+    host to write the figures it measures to its baseline file.
+*/
+
+namespace {
+
+volatile u32 g_perf_sink;
+
+
+//-------------------------------------------------
+//  load_baselines - read "name nanoseconds"
+//  lines, ignoring blank lines and comments
+//-------------------------------------------------
+
+std::map<std::string, double> load_baselines(const char *path)
+{
+	std::map<std::string, double> result;
+	std::ifstream file(path);
+	std::string name;
+	while (file >> name)
+	{
+		if (name[0] == '#')
+		{
+			std::getline(file, name);
+			continue;
+		}
+		double value;
+		if (file >> value)
+			result[name] = value;
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  save_baselines - write baselines back out
+//-------------------------------------------------
+
+void save_baselines(const char *path, std::map<std::string, double> const &baselines)
+{
+	std::ofstream file(path, std::ios::trunc);
+	file << "# nanoseconds per item for the [perf] tests\n";
+	for (auto const &entry : baselines)
+		file << entry.first << ' ' << entry.second << '\n';
+}
+
+
+//-------------------------------------------------
+//  time_per_item - time a kernel that handles
+//  the given number of items per call, taking
+//  the best of several batches to reject
+//  interference from the rest of the system
+//-------------------------------------------------
+
+template <typename Kernel>
+double time_per_item(Kernel &&kernel, u64 items)
+{
+	using clock = std::chrono::steady_clock;
+
+	// warm up, then find a repeat count that runs long enough to time reliably
+	kernel();
+	u64 repeats = 1;
+	while (true)
+	{
+		auto const start = clock::now();
+		for (u64 i = 0; i < repeats; i++)
+			kernel();
+		if ((clock::now() - start) >= std::chrono::milliseconds(20))
+			break;
+		repeats *= 2;
+	}
+
+	double best = std::numeric_limits<double>::max();
+	for (int batch = 0; batch < 5; batch++)
+	{
+		auto const start = clock::now();
+		for (u64 i = 0; i < repeats; i++)
+			kernel();
+		std::chrono::duration<double, std::nano> const elapsed = clock::now() - start;
+		best = std::min(best, elapsed.count() / double(repeats * items));
+	}
+	return best;
+}
+
+
+//-------------------------------------------------
+//  check_baseline - compare a timing with its
+//  baseline, or record it
+//-------------------------------------------------
+
+void check_baseline(const char *name, double measured)
+{
+	char const *const path = std::getenv("MAME_PERF_BASELINES");
+	if (!path || !*path)
+	{
+		WARN(name << ": " << measured << " ns per item; set MAME_PERF_BASELINES to compare with a baseline");
+		return;
+	}
+
+	std::map<std::string, double> baselines = load_baselines(path);
+	char const *const record = std::getenv("MAME_PERF_RECORD");
+	if (record && *record && (*record != '0'))
+	{
+		baselines[name] = measured;
+		save_baselines(path, baselines);
+		WARN(name << ": recorded " << measured << " ns per item");
+		return;
+	}
+
+	auto const found = baselines.find(name);
+	if (found == baselines.end())
+	{
+		WARN(name << ": " << measured << " ns per item; no baseline recorded");
+		return;
+	}
+
+	char const *const tolerance_text = std::getenv("MAME_PERF_TOLERANCE");
+	double const tolerance = (tolerance_text && *tolerance_text) ? std::atof(tolerance_text) : 0.15;
+	INFO(name << ": " << measured << " ns per item against a baseline of " << found->second);
+	REQUIRE(measured <= (found->second * (1.0 + tolerance)));
+}
+
+
+//-------------------------------------------------
+//  random_pixels - repeatable pseudo-random data
+//-------------------------------------------------
+
+template <typename T>
+std::vector<T> random_pixels(std::size_t count, u32 seed)
+{
+	std::vector<T> result(count);
+	for (T &pixel : result)
+	{
+		seed = seed * 1103515245 + 12345;
+		pixel = T(seed >> 8);
+	}
+	return result;
+}
+
+} // anonymous namespace
+
+
+TEST_CASE("rgbaint_t bilinear filter throughput", "[.][perf][emu][video]")
+{
+	constexpr int PIXELS = 4096;
+	std::vector<u32> const texels = random_pixels<u32>(PIXELS + 65, 0x1234);
+	std::vector<u8> const fractions = random_pixels<u8>(PIXELS * 2, 0x5678);
+	std::vector<u32> dest(PIXELS);
+
+	check_baseline("rgbaint_bilinear_filter", time_per_item([&] ()
+	{
+		for (int i = 0; i < PIXELS; i++)
+			dest[i] = rgbaint_t::bilinear_filter(texels[i], texels[i + 1], texels[i + 64], texels[i + 65], fractions[i * 2], fractions[i * 2 + 1]);
+		g_perf_sink = dest[PIXELS - 1];
+	}, PIXELS));
+}
+
+TEST_CASE("rgbaint_t scale, add and clamp throughput", "[.][perf][emu][video]")
+{
+	constexpr int PIXELS = 4096;
+	std::vector<u32> const source = random_pixels<u32>(PIXELS, 0x9abc);
+	std::vector<u32> dest = random_pixels<u32>(PIXELS, 0xdef0);
+	rgbaint_t const scale(0x80, 0xc0, 0x40, 0xff);
+
+	check_baseline("rgbaint_scale_add_and_clamp", time_per_item([&] ()
+	{
+		for (int i = 0; i < PIXELS; i++)
+		{
+			rgbaint_t color(source[i]);
+			color.scale_add_and_clamp(scale, rgbaint_t(dest[i]));
+			dest[i] = color.to_rgba_clamp();
+		}
+		g_perf_sink = dest[PIXELS - 1];
+	}, PIXELS));
+}
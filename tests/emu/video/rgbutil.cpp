@@ -1034,3 +1034,151 @@ TEST_CASE("check rgb", "[emu][video]")
 		check_expected();
 	}
 }
+
+TEST_CASE("check rgb pairs", "[emu][video]")
+{
+	/*
+	    rgbaint2_t must give the same results as rgbaint_t applied to
+	    each pixel, whichever implementation is in use.  Inputs are kept
+	    within the ranges the scaling functions document.
+	*/
+
+	rgbaint_t pixel0, pixel1, other0, other1;
+	rgbaint2_t pair, other;
+	auto check_pair = [&] ()
+	{
+		const rgbaint_t actual0 = pair.pixel0();
+		const rgbaint_t actual1 = pair.pixel1();
+		REQUIRE(actual0.get_a32() == pixel0.get_a32());
+		REQUIRE(actual0.get_r32() == pixel0.get_r32());
+		REQUIRE(actual0.get_g32() == pixel0.get_g32());
+		REQUIRE(actual0.get_b32() == pixel0.get_b32());
+		REQUIRE(actual1.get_a32() == pixel1.get_a32());
+		REQUIRE(actual1.get_r32() == pixel1.get_r32());
+		REQUIRE(actual1.get_g32() == pixel1.get_g32());
+		REQUIRE(actual1.get_b32() == pixel1.get_b32());
+	};
+	auto random_pixels = [&] (s32 mask)
+	{
+		pixel0.set(random_i32() & mask, random_i32() & mask, random_i32() & mask, random_i32() & mask);
+		pixel1.set(random_i32() & mask, random_i32() & mask, random_i32() & mask, random_i32() & mask);
+		other0.set(random_i32() & mask, random_i32() & mask, random_i32() & mask, random_i32() & mask);
+		other1.set(random_i32() & mask, random_i32() & mask, random_i32() & mask, random_i32() & mask);
+		pair.set(pixel0, pixel1);
+		other.set(other0, other1);
+	};
+
+	SECTION("rgbaint2_t::set(u32, u32) and to_rgba_clamp")
+	{
+		const u32 rgba[2] = { random_u32(), random_u32() };
+		pair.set(rgba[0], rgba[1]);
+		pixel0.set(rgba[0]);
+		pixel1.set(rgba[1]);
+		check_pair();
+		pair.set(rgba);
+		check_pair();
+
+		u32 packed[2];
+		random_pixels(0x3ff);
+		pixel0.sub_imm(0x100);
+		pixel1.sub_imm(0x100);
+		pair.sub_imm(0x100);
+		pair.to_rgba_clamp(packed);
+		REQUIRE(packed[0] == u32(pixel0.to_rgba_clamp()));
+		REQUIRE(packed[1] == u32(pixel1.to_rgba_clamp()));
+	}
+
+	SECTION("rgbaint2_t arithmetic")
+	{
+		random_pixels(~0);
+		pixel0.add(other0);
+		pixel1.add(other1);
+		pair.add(other);
+		check_pair();
+		pixel0.sub(other0);
+		pixel1.sub(other1);
+		pair.sub(other);
+		check_pair();
+		pixel0.subr(other0);
+		pixel1.subr(other1);
+		pair.subr(other);
+		check_pair();
+		pixel0.mul(other0);
+		pixel1.mul(other1);
+		pair.mul(other);
+		check_pair();
+		const s32 imm = random_i32();
+		pixel0.mul_imm(imm);
+		pixel1.mul_imm(imm);
+		pair.mul_imm(imm);
+		check_pair();
+	}
+
+	SECTION("rgbaint2_t shifts and logical operations")
+	{
+		random_pixels(~0);
+		const u8 shift = random_u32() % 31 + 1;
+		pixel0.shl_imm(shift);
+		pixel1.shl_imm(shift);
+		pair.shl_imm(shift);
+		check_pair();
+		pixel0.sra_imm(shift);
+		pixel1.sra_imm(shift);
+		pair.sra_imm(shift);
+		check_pair();
+		pixel0.shr_imm(shift);
+		pixel1.shr_imm(shift);
+		pair.shr_imm(shift);
+		check_pair();
+		pixel0.xor_reg(other0);
+		pixel1.xor_reg(other1);
+		pair.xor_reg(other);
+		check_pair();
+		pixel0.andnot_reg(other0);
+		pixel1.andnot_reg(other1);
+		pair.andnot_reg(other);
+		check_pair();
+		pixel0.or_imm(0x0f0f0f0f);
+		pixel1.or_imm(0x0f0f0f0f);
+		pair.or_imm(0x0f0f0f0f);
+		check_pair();
+	}
+
+	SECTION("rgbaint2_t clamping and blending")
+	{
+		random_pixels(0x3ff);
+		pixel0.sub_imm(0x100);
+		pixel1.sub_imm(0x100);
+		pair.sub_imm(0x100);
+		pixel0.clamp_to_uint8();
+		pixel1.clamp_to_uint8();
+		pair.clamp_to_uint8();
+		check_pair();
+
+		const u8 factor = random_u32();
+		pixel0.blend(other0, factor);
+		pixel1.blend(other1, factor);
+		pair.blend(other, factor);
+		check_pair();
+
+		random_pixels(0x1ff);
+		pixel0.scale_and_clamp(other0);
+		pixel1.scale_and_clamp(other1);
+		pair.scale_and_clamp(other);
+		check_pair();
+
+		random_pixels(0x3ff);
+		const s16 scale = random_u32() & 0x3ff;
+		pixel0.scale_imm_and_clamp(scale);
+		pixel1.scale_imm_and_clamp(scale);
+		pair.scale_imm_and_clamp(scale);
+		check_pair();
+
+		random_pixels(0x3ff);
+		const rgbaint2_t add{ rgbaint_t(random_u32()), rgbaint_t(random_u32()) };
+		pixel0.scale_add_and_clamp(other0, add.pixel0());
+		pixel1.scale_add_and_clamp(other1, add.pixel1());
+		pair.scale_add_and_clamp(other, add);
+		check_pair();
+	}
+}
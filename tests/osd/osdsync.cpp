@@ -0,0 +1,147 @@
+#include "catch.hpp"
+
+#include "osdcore.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+extern int osd_num_processors;
+
+
+/*
+    Work queue stress tests.  Callbacks index per-thread state by the
+    thread ID they're given, so callbacks of one queue that run at the
+    same time must never share an ID.  These run nested waits from pool
+    threads and waits from several other threads at once; they're most
+    useful built with -fsanitize=thread.
+*/
+
+namespace {
+
+// counts callbacks that ran with an ID another callback was still using
+class id_checker
+{
+public:
+	id_checker()
+	{
+		for (auto &busy : m_busy)
+			busy = 0;
+	}
+
+	void enter(int threadid)
+	{
+		if ((threadid < 0) || (threadid >= WORK_MAX_THREADS))
+			++m_bad_ids;
+		else if (m_busy[threadid].exchange(1))
+			++m_clashes;
+		++m_runs;
+	}
+
+	void leave(int threadid)
+	{
+		if ((threadid >= 0) && (threadid < WORK_MAX_THREADS))
+			m_busy[threadid] = 0;
+	}
+
+	int bad_ids() const { return m_bad_ids; }
+	int clashes() const { return m_clashes; }
+	int runs() const { return m_runs; }
+
+private:
+	std::array<std::atomic<int>, WORK_MAX_THREADS> m_busy;
+	std::atomic<int> m_bad_ids{ 0 };
+	std::atomic<int> m_clashes{ 0 };
+	std::atomic<int> m_runs{ 0 };
+};
+
+struct nested_context
+{
+	osd_work_queue *inner;
+	id_checker outer_ids;
+	id_checker inner_ids;
+	std::atomic<uint32_t> sink{ 0 };
+};
+
+constexpr int OUTER_ITEMS = 64;
+constexpr int INNER_ITEMS = 8;
+
+void spin(nested_context &context)
+{
+	uint32_t value = 0;
+	for (int i = 0; i < 2000; i++)
+		value = value * 1103515245 + 12345;
+	context.sink += value;
+}
+
+void *inner_callback(void *param, int threadid)
+{
+	nested_context &context = *reinterpret_cast<nested_context *>(param);
+	context.inner_ids.enter(threadid);
+	spin(context);
+	context.inner_ids.leave(threadid);
+	return nullptr;
+}
+
+void *outer_callback(void *param, int threadid)
+{
+	// queue work on the shared inner queue and help with it while waiting
+	nested_context &context = *reinterpret_cast<nested_context *>(param);
+	context.outer_ids.enter(threadid);
+	osd_work_item_queue_multiple(context.inner, inner_callback, INNER_ITEMS, &context, 0, WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(context.inner, 100 * osd_ticks_per_second());
+	context.outer_ids.leave(threadid);
+	return nullptr;
+}
+
+void run_nested(int processors, int waiters)
+{
+	osd_num_processors = processors;
+	nested_context context;
+	osd_work_queue *const outer = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	context.inner = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
+	// each waiter queues outer items, and the last one of each batch is waited on directly
+	std::vector<std::thread> threads;
+	for (int waiter = 0; waiter < waiters; waiter++)
+	{
+		threads.emplace_back(
+				[outer, &context] ()
+				{
+					for (int batch = 0; batch < 4; batch++)
+					{
+						osd_work_item_queue_multiple(outer, outer_callback, OUTER_ITEMS / 4 - 1, &context, 0, WORK_ITEM_FLAG_AUTO_RELEASE);
+						osd_work_item *const item = osd_work_item_queue(outer, outer_callback, &context, 0);
+						osd_work_item_wait(item, 100 * osd_ticks_per_second());
+						osd_work_item_release(item);
+						osd_work_queue_wait(outer, 100 * osd_ticks_per_second());
+					}
+				});
+	}
+	for (std::thread &thread : threads)
+		thread.join();
+
+	osd_work_queue_free(outer);
+	osd_work_queue_free(context.inner);
+	osd_num_processors = 0;
+
+	INFO(processors << " processors, " << waiters << " waiting threads");
+	REQUIRE(context.outer_ids.runs() == waiters * OUTER_ITEMS);
+	REQUIRE(context.inner_ids.runs() == waiters * OUTER_ITEMS * INNER_ITEMS);
+	REQUIRE(context.outer_ids.bad_ids() == 0);
+	REQUIRE(context.inner_ids.bad_ids() == 0);
+	REQUIRE(context.outer_ids.clashes() == 0);
+	REQUIRE(context.inner_ids.clashes() == 0);
+}
+
+} // anonymous namespace
+
+
+TEST_CASE("Work queue callbacks get distinct thread IDs", "[osd]")
+{
+	for (int processors : { 1, 4, 16 })
+		for (int waiters : { 1, 3 })
+			run_nested(processors, waiters);
+}